@@ -7,6 +7,7 @@
 
 include_directories(
     ${PROJECT_SOURCE_DIR}
+    ${ASPIA_THIRD_PARTY_DIR}/libaom/include
     ${ASPIA_THIRD_PARTY_DIR}/libvpx/include
     ${ASPIA_THIRD_PARTY_DIR}/libyuv/include
     ${ASPIA_THIRD_PARTY_DIR}/zlib-ng/include
@@ -14,6 +15,7 @@ include_directories(
     ${ASPIA_THIRD_PARTY_DIR}/libsodium/include)
 
 link_directories(
+    ${ASPIA_THIRD_PARTY_DIR}/libaom/lib
     ${ASPIA_THIRD_PARTY_DIR}/libvpx/lib
     ${ASPIA_THIRD_PARTY_DIR}/libyuv/lib
     ${ASPIA_THIRD_PARTY_DIR}/zlib-ng/lib
@@ -26,22 +28,39 @@ link_directories(
 list(APPEND SOURCE_BASE
     ${PROJECT_SOURCE_DIR}/base/aligned_memory.cc
     ${PROJECT_SOURCE_DIR}/base/aligned_memory.h
+    ${PROJECT_SOURCE_DIR}/base/buffer_pool.cc
+    ${PROJECT_SOURCE_DIR}/base/buffer_pool.h
     ${PROJECT_SOURCE_DIR}/base/clipboard.cc
     ${PROJECT_SOURCE_DIR}/base/clipboard.h
+    ${PROJECT_SOURCE_DIR}/base/cpu_dispatch.cc
+    ${PROJECT_SOURCE_DIR}/base/cpu_dispatch.h
     ${PROJECT_SOURCE_DIR}/base/errno_logging.cc
     ${PROJECT_SOURCE_DIR}/base/errno_logging.h
     ${PROJECT_SOURCE_DIR}/base/file_logger.cc
     ${PROJECT_SOURCE_DIR}/base/file_logger.h
+    ${PROJECT_SOURCE_DIR}/base/function_runnable.h
     ${PROJECT_SOURCE_DIR}/base/keycode_converter.cc
     ${PROJECT_SOURCE_DIR}/base/keycode_converter.h
     ${PROJECT_SOURCE_DIR}/base/locale_loader.cc
     ${PROJECT_SOURCE_DIR}/base/locale_loader.h
+    ${PROJECT_SOURCE_DIR}/base/memory_counters.cc
+    ${PROJECT_SOURCE_DIR}/base/memory_counters.h
+    ${PROJECT_SOURCE_DIR}/base/message_class.h
+    ${PROJECT_SOURCE_DIR}/base/message_priority.h
     ${PROJECT_SOURCE_DIR}/base/message_serialization.h
+    ${PROJECT_SOURCE_DIR}/base/power_monitor.cc
+    ${PROJECT_SOURCE_DIR}/base/power_monitor.h
+    ${PROJECT_SOURCE_DIR}/base/process_stats.cc
+    ${PROJECT_SOURCE_DIR}/base/process_stats.h
     ${PROJECT_SOURCE_DIR}/base/service.h
     ${PROJECT_SOURCE_DIR}/base/service_controller.cc
     ${PROJECT_SOURCE_DIR}/base/service_controller.h
     ${PROJECT_SOURCE_DIR}/base/service_impl.h
     ${PROJECT_SOURCE_DIR}/base/service_impl_win.cc
+    ${PROJECT_SOURCE_DIR}/base/spsc_queue.h
+    ${PROJECT_SOURCE_DIR}/base/thread_wakeup.h
+    ${PROJECT_SOURCE_DIR}/base/trace_logger.cc
+    ${PROJECT_SOURCE_DIR}/base/trace_logger.h
     ${PROJECT_SOURCE_DIR}/base/typed_buffer.h)
 
 list(APPEND SOURCE_BASE_WIN
@@ -58,23 +77,18 @@ list(APPEND SOURCE_BASE_WIN
     ${PROJECT_SOURCE_DIR}/base/win/security_helpers.h)
 
 list(APPEND SOURCE_CLIENT
-    ${PROJECT_SOURCE_DIR}/client/client.cc
-    ${PROJECT_SOURCE_DIR}/client/client.h
-    ${PROJECT_SOURCE_DIR}/client/client_session.h
-    ${PROJECT_SOURCE_DIR}/client/client_session_desktop_manage.cc
-    ${PROJECT_SOURCE_DIR}/client/client_session_desktop_manage.h
-    ${PROJECT_SOURCE_DIR}/client/client_session_desktop_view.cc
-    ${PROJECT_SOURCE_DIR}/client/client_session_desktop_view.h
-    ${PROJECT_SOURCE_DIR}/client/client_session_file_transfer.cc
-    ${PROJECT_SOURCE_DIR}/client/client_session_file_transfer.h
-    ${PROJECT_SOURCE_DIR}/client/client_session_system_info.cc
-    ${PROJECT_SOURCE_DIR}/client/client_session_system_info.h
     ${PROJECT_SOURCE_DIR}/client/client_user_authorizer.cc
     ${PROJECT_SOURCE_DIR}/client/client_user_authorizer.h
     ${PROJECT_SOURCE_DIR}/client/computer_factory.cc
     ${PROJECT_SOURCE_DIR}/client/computer_factory.h
     ${PROJECT_SOURCE_DIR}/client/connect_data.cc
     ${PROJECT_SOURCE_DIR}/client/connect_data.h
+    ${PROJECT_SOURCE_DIR}/client/encoding_selector.cc
+    ${PROJECT_SOURCE_DIR}/client/encoding_selector.h
+    ${PROJECT_SOURCE_DIR}/client/file_multi_uploader.cc
+    ${PROJECT_SOURCE_DIR}/client/file_multi_uploader.h
+    ${PROJECT_SOURCE_DIR}/client/file_remote_copier.cc
+    ${PROJECT_SOURCE_DIR}/client/file_remote_copier.h
     ${PROJECT_SOURCE_DIR}/client/file_remove_queue_builder.cc
     ${PROJECT_SOURCE_DIR}/client/file_remove_queue_builder.h
     ${PROJECT_SOURCE_DIR}/client/file_remove_task.cc
@@ -88,7 +102,28 @@ list(APPEND SOURCE_CLIENT
     ${PROJECT_SOURCE_DIR}/client/file_transfer_queue_builder.cc
     ${PROJECT_SOURCE_DIR}/client/file_transfer_queue_builder.h
     ${PROJECT_SOURCE_DIR}/client/file_transfer_task.cc
-    ${PROJECT_SOURCE_DIR}/client/file_transfer_task.h)
+    ${PROJECT_SOURCE_DIR}/client/file_transfer_task.h
+    ${PROJECT_SOURCE_DIR}/client/inventory_client.cc
+    ${PROJECT_SOURCE_DIR}/client/inventory_client.h
+    ${PROJECT_SOURCE_DIR}/client/load_test_client.cc
+    ${PROJECT_SOURCE_DIR}/client/load_test_client.h
+    ${PROJECT_SOURCE_DIR}/client/video_decode_thread.cc
+    ${PROJECT_SOURCE_DIR}/client/video_decode_thread.h
+    ${PROJECT_SOURCE_DIR}/client/wall_client.cc
+    ${PROJECT_SOURCE_DIR}/client/wall_client.h)
+
+list(APPEND SOURCE_CLIENT_SESSION
+    ${PROJECT_SOURCE_DIR}/client/client.cc
+    ${PROJECT_SOURCE_DIR}/client/client.h
+    ${PROJECT_SOURCE_DIR}/client/client_session.h
+    ${PROJECT_SOURCE_DIR}/client/client_session_desktop_manage.cc
+    ${PROJECT_SOURCE_DIR}/client/client_session_desktop_manage.h
+    ${PROJECT_SOURCE_DIR}/client/client_session_desktop_view.cc
+    ${PROJECT_SOURCE_DIR}/client/client_session_desktop_view.h
+    ${PROJECT_SOURCE_DIR}/client/client_session_file_transfer.cc
+    ${PROJECT_SOURCE_DIR}/client/client_session_file_transfer.h
+    ${PROJECT_SOURCE_DIR}/client/client_session_system_info.cc
+    ${PROJECT_SOURCE_DIR}/client/client_session_system_info.h)
 
 list(APPEND SOURCE_CLIENT_UI
     ${PROJECT_SOURCE_DIR}/client/ui/authorization_dialog.cc
@@ -103,6 +138,10 @@ list(APPEND SOURCE_CLIENT_UI
     ${PROJECT_SOURCE_DIR}/client/ui/desktop_panel.cc
     ${PROJECT_SOURCE_DIR}/client/ui/desktop_panel.h
     ${PROJECT_SOURCE_DIR}/client/ui/desktop_panel.ui
+    ${PROJECT_SOURCE_DIR}/client/ui/desktop_renderer_gl.cc
+    ${PROJECT_SOURCE_DIR}/client/ui/desktop_renderer_gl.h
+    ${PROJECT_SOURCE_DIR}/client/ui/desktop_wall_window.cc
+    ${PROJECT_SOURCE_DIR}/client/ui/desktop_wall_window.h
     ${PROJECT_SOURCE_DIR}/client/ui/desktop_widget.cc
     ${PROJECT_SOURCE_DIR}/client/ui/desktop_widget.h
     ${PROJECT_SOURCE_DIR}/client/ui/desktop_window.cc
@@ -117,6 +156,8 @@ list(APPEND SOURCE_CLIENT_UI
     ${PROJECT_SOURCE_DIR}/client/ui/file_manager_window.cc
     ${PROJECT_SOURCE_DIR}/client/ui/file_manager_window.h
     ${PROJECT_SOURCE_DIR}/client/ui/file_manager_window.ui
+    ${PROJECT_SOURCE_DIR}/client/ui/file_multi_upload_window.cc
+    ${PROJECT_SOURCE_DIR}/client/ui/file_multi_upload_window.h
     ${PROJECT_SOURCE_DIR}/client/ui/file_panel.cc
     ${PROJECT_SOURCE_DIR}/client/ui/file_panel.h
     ${PROJECT_SOURCE_DIR}/client/ui/file_panel.ui
@@ -128,38 +169,74 @@ list(APPEND SOURCE_CLIENT_UI
     ${PROJECT_SOURCE_DIR}/client/ui/file_transfer_dialog.ui
     ${PROJECT_SOURCE_DIR}/client/ui/file_tree_widget.cc
     ${PROJECT_SOURCE_DIR}/client/ui/file_tree_widget.h
+    ${PROJECT_SOURCE_DIR}/client/ui/file_type_cache.cc
+    ${PROJECT_SOURCE_DIR}/client/ui/file_type_cache.h
     ${PROJECT_SOURCE_DIR}/client/ui/key_sequence_dialog.cc
     ${PROJECT_SOURCE_DIR}/client/ui/key_sequence_dialog.h
     ${PROJECT_SOURCE_DIR}/client/ui/key_sequence_dialog.ui
     ${PROJECT_SOURCE_DIR}/client/ui/status_dialog.cc
     ${PROJECT_SOURCE_DIR}/client/ui/status_dialog.h
     ${PROJECT_SOURCE_DIR}/client/ui/status_dialog.ui
+    ${PROJECT_SOURCE_DIR}/client/ui/statistics_overlay.cc
+    ${PROJECT_SOURCE_DIR}/client/ui/statistics_overlay.h
     ${PROJECT_SOURCE_DIR}/client/ui/system_info_window.cc
     ${PROJECT_SOURCE_DIR}/client/ui/system_info_window.h
     ${PROJECT_SOURCE_DIR}/client/ui/system_info_window.ui)
 
 list(APPEND SOURCE_CODEC
+    ${PROJECT_SOURCE_DIR}/codec/compressor.cc
     ${PROJECT_SOURCE_DIR}/codec/compressor.h
+    ${PROJECT_SOURCE_DIR}/codec/compressor_lz4.cc
+    ${PROJECT_SOURCE_DIR}/codec/compressor_lz4.h
     ${PROJECT_SOURCE_DIR}/codec/compressor_zlib.cc
     ${PROJECT_SOURCE_DIR}/codec/compressor_zlib.h
+    ${PROJECT_SOURCE_DIR}/codec/compressor_zstd.cc
+    ${PROJECT_SOURCE_DIR}/codec/compressor_zstd.h
     ${PROJECT_SOURCE_DIR}/codec/cursor_decoder.cc
     ${PROJECT_SOURCE_DIR}/codec/cursor_decoder.h
     ${PROJECT_SOURCE_DIR}/codec/cursor_encoder.cc
     ${PROJECT_SOURCE_DIR}/codec/cursor_encoder.h
+    ${PROJECT_SOURCE_DIR}/codec/decompressor.cc
     ${PROJECT_SOURCE_DIR}/codec/decompressor.h
+    ${PROJECT_SOURCE_DIR}/codec/decompressor_lz4.cc
+    ${PROJECT_SOURCE_DIR}/codec/decompressor_lz4.h
     ${PROJECT_SOURCE_DIR}/codec/decompressor_zlib.cc
     ${PROJECT_SOURCE_DIR}/codec/decompressor_zlib.h
+    ${PROJECT_SOURCE_DIR}/codec/decompressor_zstd.cc
+    ${PROJECT_SOURCE_DIR}/codec/decompressor_zstd.h
     ${PROJECT_SOURCE_DIR}/codec/pixel_translator.cc
     ${PROJECT_SOURCE_DIR}/codec/pixel_translator.h
+    ${PROJECT_SOURCE_DIR}/codec/pixel_translator_neon.cc
+    ${PROJECT_SOURCE_DIR}/codec/pixel_translator_neon.h
+    ${PROJECT_SOURCE_DIR}/codec/pixel_translator_sse2.cc
+    ${PROJECT_SOURCE_DIR}/codec/pixel_translator_sse2.h
+    ${PROJECT_SOURCE_DIR}/codec/scoped_aom_codec.cc
+    ${PROJECT_SOURCE_DIR}/codec/scoped_aom_codec.h
     ${PROJECT_SOURCE_DIR}/codec/scoped_vpx_codec.cc
     ${PROJECT_SOURCE_DIR}/codec/scoped_vpx_codec.h
     ${PROJECT_SOURCE_DIR}/codec/video_decoder.cc
     ${PROJECT_SOURCE_DIR}/codec/video_decoder.h
+    ${PROJECT_SOURCE_DIR}/codec/video_decoder_av1.cc
+    ${PROJECT_SOURCE_DIR}/codec/video_decoder_av1.h
+    ${PROJECT_SOURCE_DIR}/codec/video_decoder_h264.cc
+    ${PROJECT_SOURCE_DIR}/codec/video_decoder_h264.h
+    ${PROJECT_SOURCE_DIR}/codec/video_decoder_hybrid.cc
+    ${PROJECT_SOURCE_DIR}/codec/video_decoder_hybrid.h
+    ${PROJECT_SOURCE_DIR}/codec/video_decoder_palette.cc
+    ${PROJECT_SOURCE_DIR}/codec/video_decoder_palette.h
     ${PROJECT_SOURCE_DIR}/codec/video_decoder_vpx.cc
     ${PROJECT_SOURCE_DIR}/codec/video_decoder_vpx.h
     ${PROJECT_SOURCE_DIR}/codec/video_decoder_zlib.cc
     ${PROJECT_SOURCE_DIR}/codec/video_decoder_zlib.h
     ${PROJECT_SOURCE_DIR}/codec/video_encoder.h
+    ${PROJECT_SOURCE_DIR}/codec/video_encoder_av1.cc
+    ${PROJECT_SOURCE_DIR}/codec/video_encoder_av1.h
+    ${PROJECT_SOURCE_DIR}/codec/video_encoder_h264.cc
+    ${PROJECT_SOURCE_DIR}/codec/video_encoder_h264.h
+    ${PROJECT_SOURCE_DIR}/codec/video_encoder_hybrid.cc
+    ${PROJECT_SOURCE_DIR}/codec/video_encoder_hybrid.h
+    ${PROJECT_SOURCE_DIR}/codec/video_encoder_palette.cc
+    ${PROJECT_SOURCE_DIR}/codec/video_encoder_palette.h
     ${PROJECT_SOURCE_DIR}/codec/video_encoder_vpx.cc
     ${PROJECT_SOURCE_DIR}/codec/video_encoder_vpx.h
     ${PROJECT_SOURCE_DIR}/codec/video_encoder_zlib.cc
@@ -190,13 +267,15 @@ list(APPEND SOURCE_CONSOLE
     ${PROJECT_SOURCE_DIR}/console/computer_group_mime_data.h
     ${PROJECT_SOURCE_DIR}/console/computer_group_tree.cc
     ${PROJECT_SOURCE_DIR}/console/computer_group_tree.h
-    ${PROJECT_SOURCE_DIR}/console/computer_item.cc
-    ${PROJECT_SOURCE_DIR}/console/computer_item.h
+    ${PROJECT_SOURCE_DIR}/console/computer_index.cc
+    ${PROJECT_SOURCE_DIR}/console/computer_index.h
     ${PROJECT_SOURCE_DIR}/console/computer_mime_data.h
+    ${PROJECT_SOURCE_DIR}/console/computer_model.cc
+    ${PROJECT_SOURCE_DIR}/console/computer_model.h
+    ${PROJECT_SOURCE_DIR}/console/computer_prober.cc
+    ${PROJECT_SOURCE_DIR}/console/computer_prober.h
     ${PROJECT_SOURCE_DIR}/console/computer_tree.cc
     ${PROJECT_SOURCE_DIR}/console/computer_tree.h
-    ${PROJECT_SOURCE_DIR}/console/console_main.cc
-    ${PROJECT_SOURCE_DIR}/console/console_main.h
     ${PROJECT_SOURCE_DIR}/console/console_settings.cc
     ${PROJECT_SOURCE_DIR}/console/console_settings.h
     ${PROJECT_SOURCE_DIR}/console/console_statusbar.cc
@@ -208,13 +287,17 @@ list(APPEND SOURCE_CONSOLE
     ${PROJECT_SOURCE_DIR}/console/console_window.ui
     ${PROJECT_SOURCE_DIR}/console/open_address_book_dialog.cc
     ${PROJECT_SOURCE_DIR}/console/open_address_book_dialog.h
-    ${PROJECT_SOURCE_DIR}/console/open_address_book_dialog.ui)
+    ${PROJECT_SOURCE_DIR}/console/open_address_book_dialog.ui
+    ${PROJECT_SOURCE_DIR}/console/pending_address_book_tab.cc
+    ${PROJECT_SOURCE_DIR}/console/pending_address_book_tab.h)
 
 list(APPEND SOURCE_CRYPTO
     ${PROJECT_SOURCE_DIR}/crypto/data_encryptor.cc
     ${PROJECT_SOURCE_DIR}/crypto/data_encryptor.h
     ${PROJECT_SOURCE_DIR}/crypto/encryptor.cc
     ${PROJECT_SOURCE_DIR}/crypto/encryptor.h
+    ${PROJECT_SOURCE_DIR}/crypto/password_hash.cc
+    ${PROJECT_SOURCE_DIR}/crypto/password_hash.h
 	${PROJECT_SOURCE_DIR}/crypto/random.cc
     ${PROJECT_SOURCE_DIR}/crypto/random.h
 	${PROJECT_SOURCE_DIR}/crypto/secure_memory.cc
@@ -224,8 +307,14 @@ list(APPEND SOURCE_DESKTOP_CAPTURE
     ${PROJECT_SOURCE_DIR}/desktop_capture/capture_scheduler.cc
     ${PROJECT_SOURCE_DIR}/desktop_capture/capture_scheduler.h
     ${PROJECT_SOURCE_DIR}/desktop_capture/capturer.h
+    ${PROJECT_SOURCE_DIR}/desktop_capture/capturer_dxgi.cc
+    ${PROJECT_SOURCE_DIR}/desktop_capture/capturer_dxgi.h
     ${PROJECT_SOURCE_DIR}/desktop_capture/capturer_gdi.cc
     ${PROJECT_SOURCE_DIR}/desktop_capture/capturer_gdi.h
+    ${PROJECT_SOURCE_DIR}/desktop_capture/capturer_replay.cc
+    ${PROJECT_SOURCE_DIR}/desktop_capture/capturer_replay.h
+    ${PROJECT_SOURCE_DIR}/desktop_capture/cursor_capturer.cc
+    ${PROJECT_SOURCE_DIR}/desktop_capture/cursor_capturer.h
     ${PROJECT_SOURCE_DIR}/desktop_capture/desktop_frame.cc
     ${PROJECT_SOURCE_DIR}/desktop_capture/desktop_frame.h
     ${PROJECT_SOURCE_DIR}/desktop_capture/desktop_frame_aligned.cc
@@ -234,28 +323,65 @@ list(APPEND SOURCE_DESKTOP_CAPTURE
     ${PROJECT_SOURCE_DIR}/desktop_capture/desktop_frame_dib.h
     ${PROJECT_SOURCE_DIR}/desktop_capture/desktop_frame_qimage.cc
     ${PROJECT_SOURCE_DIR}/desktop_capture/desktop_frame_qimage.h
+    ${PROJECT_SOURCE_DIR}/desktop_capture/desktop_frame_texture.cc
+    ${PROJECT_SOURCE_DIR}/desktop_capture/desktop_frame_texture.h
+    ${PROJECT_SOURCE_DIR}/desktop_capture/desktop_frame_yuv.cc
+    ${PROJECT_SOURCE_DIR}/desktop_capture/desktop_frame_yuv.h
     ${PROJECT_SOURCE_DIR}/desktop_capture/diff_block_avx2.cc
     ${PROJECT_SOURCE_DIR}/desktop_capture/diff_block_avx2.h
+    ${PROJECT_SOURCE_DIR}/desktop_capture/diff_block_avx512.cc
+    ${PROJECT_SOURCE_DIR}/desktop_capture/diff_block_avx512.h
+    ${PROJECT_SOURCE_DIR}/desktop_capture/diff_block_c.h
+    ${PROJECT_SOURCE_DIR}/desktop_capture/diff_block_neon.cc
+    ${PROJECT_SOURCE_DIR}/desktop_capture/diff_block_neon.h
     ${PROJECT_SOURCE_DIR}/desktop_capture/diff_block_sse2.cc
     ${PROJECT_SOURCE_DIR}/desktop_capture/diff_block_sse2.h
     ${PROJECT_SOURCE_DIR}/desktop_capture/diff_block_sse3.cc
     ${PROJECT_SOURCE_DIR}/desktop_capture/diff_block_sse3.h
+    ${PROJECT_SOURCE_DIR}/desktop_capture/diff_hash_sse42.cc
+    ${PROJECT_SOURCE_DIR}/desktop_capture/diff_hash_sse42.h
     ${PROJECT_SOURCE_DIR}/desktop_capture/differ.cc
     ${PROJECT_SOURCE_DIR}/desktop_capture/differ.h
+    ${PROJECT_SOURCE_DIR}/desktop_capture/frame_hashes.cc
+    ${PROJECT_SOURCE_DIR}/desktop_capture/frame_hashes.h
+    ${PROJECT_SOURCE_DIR}/desktop_capture/frame_recorder.cc
+    ${PROJECT_SOURCE_DIR}/desktop_capture/frame_recorder.h
     ${PROJECT_SOURCE_DIR}/desktop_capture/mouse_cursor.cc
     ${PROJECT_SOURCE_DIR}/desktop_capture/mouse_cursor.h
     ${PROJECT_SOURCE_DIR}/desktop_capture/mouse_cursor_cache.cc
     ${PROJECT_SOURCE_DIR}/desktop_capture/mouse_cursor_cache.h
     ${PROJECT_SOURCE_DIR}/desktop_capture/pixel_format.cc
-    ${PROJECT_SOURCE_DIR}/desktop_capture/pixel_format.h)
+    ${PROJECT_SOURCE_DIR}/desktop_capture/pixel_format.h
+    ${PROJECT_SOURCE_DIR}/desktop_capture/scroll_detector.cc
+    ${PROJECT_SOURCE_DIR}/desktop_capture/scroll_detector.h
+    ${PROJECT_SOURCE_DIR}/desktop_capture/tile_cache.cc
+    ${PROJECT_SOURCE_DIR}/desktop_capture/tile_cache.h)
 
 list(APPEND SOURCE_DESKTOP_CAPTURE_WIN
+    ${PROJECT_SOURCE_DIR}/desktop_capture/win/cursor.cc
+    ${PROJECT_SOURCE_DIR}/desktop_capture/win/cursor.h
+    ${PROJECT_SOURCE_DIR}/desktop_capture/win/cursor_sse2.cc
+    ${PROJECT_SOURCE_DIR}/desktop_capture/win/cursor_sse2.h
     ${PROJECT_SOURCE_DIR}/desktop_capture/win/desktop.cc
     ${PROJECT_SOURCE_DIR}/desktop_capture/win/desktop.h
+    ${PROJECT_SOURCE_DIR}/desktop_capture/win/screen_capture_utils.cc
+    ${PROJECT_SOURCE_DIR}/desktop_capture/win/screen_capture_utils.h
     ${PROJECT_SOURCE_DIR}/desktop_capture/win/scoped_thread_desktop.cc
     ${PROJECT_SOURCE_DIR}/desktop_capture/win/scoped_thread_desktop.h)
 
 list(APPEND SOURCE_HOST
+    ${PROJECT_SOURCE_DIR}/host/cpu_governor.cc
+    ${PROJECT_SOURCE_DIR}/host/cpu_governor.h
+    ${PROJECT_SOURCE_DIR}/host/desktop_effects.cc
+    ${PROJECT_SOURCE_DIR}/host/desktop_effects.h
+    ${PROJECT_SOURCE_DIR}/host/file_archive_depacketizer.cc
+    ${PROJECT_SOURCE_DIR}/host/file_archive_depacketizer.h
+    ${PROJECT_SOURCE_DIR}/host/file_archive_packetizer.cc
+    ${PROJECT_SOURCE_DIR}/host/file_archive_packetizer.h
+    ${PROJECT_SOURCE_DIR}/host/file_block_hash.cc
+    ${PROJECT_SOURCE_DIR}/host/file_block_hash.h
+    ${PROJECT_SOURCE_DIR}/host/file_delta.cc
+    ${PROJECT_SOURCE_DIR}/host/file_delta.h
     ${PROJECT_SOURCE_DIR}/host/file_depacketizer.cc
     ${PROJECT_SOURCE_DIR}/host/file_depacketizer.h
     ${PROJECT_SOURCE_DIR}/host/file_packetizer.cc
@@ -266,12 +392,12 @@ list(APPEND SOURCE_HOST
     ${PROJECT_SOURCE_DIR}/host/file_request.h
     ${PROJECT_SOURCE_DIR}/host/file_worker.cc
     ${PROJECT_SOURCE_DIR}/host/file_worker.h
-    ${PROJECT_SOURCE_DIR}/host/host_config_main.cc
-    ${PROJECT_SOURCE_DIR}/host/host_config_main.h
+    ${PROJECT_SOURCE_DIR}/host/file_worker_thread.cc
+    ${PROJECT_SOURCE_DIR}/host/file_worker_thread.h
+    ${PROJECT_SOURCE_DIR}/host/host_metrics.cc
+    ${PROJECT_SOURCE_DIR}/host/host_metrics.h
     ${PROJECT_SOURCE_DIR}/host/host_notifier.cc
     ${PROJECT_SOURCE_DIR}/host/host_notifier.h
-    ${PROJECT_SOURCE_DIR}/host/host_notifier_main.cc
-    ${PROJECT_SOURCE_DIR}/host/host_notifier_main.h
     ${PROJECT_SOURCE_DIR}/host/host_server.cc
     ${PROJECT_SOURCE_DIR}/host/host_server.h
     ${PROJECT_SOURCE_DIR}/host/host_session.cc
@@ -286,6 +412,8 @@ list(APPEND SOURCE_HOST
     ${PROJECT_SOURCE_DIR}/host/host_session_fake_file_transfer.h
     ${PROJECT_SOURCE_DIR}/host/host_session_file_transfer.cc
     ${PROJECT_SOURCE_DIR}/host/host_session_file_transfer.h
+    ${PROJECT_SOURCE_DIR}/host/host_session_group.cc
+    ${PROJECT_SOURCE_DIR}/host/host_session_group.h
     ${PROJECT_SOURCE_DIR}/host/host_session_system_info.cc
     ${PROJECT_SOURCE_DIR}/host/host_session_system_info.h
     ${PROJECT_SOURCE_DIR}/host/host_settings.cc
@@ -294,8 +422,16 @@ list(APPEND SOURCE_HOST
     ${PROJECT_SOURCE_DIR}/host/host_user_authorizer.h
     ${PROJECT_SOURCE_DIR}/host/input_injector.cc
     ${PROJECT_SOURCE_DIR}/host/input_injector.h
+    ${PROJECT_SOURCE_DIR}/host/memory_governor.cc
+    ${PROJECT_SOURCE_DIR}/host/memory_governor.h
     ${PROJECT_SOURCE_DIR}/host/screen_updater.cc
     ${PROJECT_SOURCE_DIR}/host/screen_updater.h
+    ${PROJECT_SOURCE_DIR}/host/session_record_reader.cc
+    ${PROJECT_SOURCE_DIR}/host/session_record_reader.h
+    ${PROJECT_SOURCE_DIR}/host/session_recorder.cc
+    ${PROJECT_SOURCE_DIR}/host/session_recorder.h
+    ${PROJECT_SOURCE_DIR}/host/system_info_cache.cc
+    ${PROJECT_SOURCE_DIR}/host/system_info_cache.h
     ${PROJECT_SOURCE_DIR}/host/system_info_request.cc
     ${PROJECT_SOURCE_DIR}/host/system_info_request.h
     ${PROJECT_SOURCE_DIR}/host/user.cc
@@ -317,30 +453,52 @@ list(APPEND SOURCE_HOST_UI
 list(APPEND SOURCE_HOST_WIN
     ${PROJECT_SOURCE_DIR}/host/win/host.cc
     ${PROJECT_SOURCE_DIR}/host/win/host.h
-    ${PROJECT_SOURCE_DIR}/host/win/host_main.cc
-    ${PROJECT_SOURCE_DIR}/host/win/host_main.h
     ${PROJECT_SOURCE_DIR}/host/win/host_process.cc
     ${PROJECT_SOURCE_DIR}/host/win/host_process.h
+    ${PROJECT_SOURCE_DIR}/host/win/host_process_group.cc
+    ${PROJECT_SOURCE_DIR}/host/win/host_process_group.h
     ${PROJECT_SOURCE_DIR}/host/win/host_process_impl.cc
     ${PROJECT_SOURCE_DIR}/host/win/host_process_impl.h
+    ${PROJECT_SOURCE_DIR}/host/win/host_process_pool.cc
+    ${PROJECT_SOURCE_DIR}/host/win/host_process_pool.h
     ${PROJECT_SOURCE_DIR}/host/win/host_service.cc
     ${PROJECT_SOURCE_DIR}/host/win/host_service.h
-    ${PROJECT_SOURCE_DIR}/host/win/host_service_main.cc
-    ${PROJECT_SOURCE_DIR}/host/win/host_service_main.h)
+    ${PROJECT_SOURCE_DIR}/host/win/host_settings_watcher.cc
+    ${PROJECT_SOURCE_DIR}/host/win/host_settings_watcher.h
+    ${PROJECT_SOURCE_DIR}/host/win/scoped_thread_role.cc
+    ${PROJECT_SOURCE_DIR}/host/win/scoped_thread_role.h)
 
 list(APPEND SOURCE_IPC
     ${PROJECT_SOURCE_DIR}/ipc/ipc_channel.cc
     ${PROJECT_SOURCE_DIR}/ipc/ipc_channel.h
     ${PROJECT_SOURCE_DIR}/ipc/ipc_server.cc
-    ${PROJECT_SOURCE_DIR}/ipc/ipc_server.h)
+    ${PROJECT_SOURCE_DIR}/ipc/ipc_server.h
+    ${PROJECT_SOURCE_DIR}/ipc/ipc_shared_buffer.cc
+    ${PROJECT_SOURCE_DIR}/ipc/ipc_shared_buffer.h)
 
 list(APPEND SOURCE_NETWORK
+    ${PROJECT_SOURCE_DIR}/network/bandwidth_estimator.cc
+    ${PROJECT_SOURCE_DIR}/network/bandwidth_estimator.h
+    ${PROJECT_SOURCE_DIR}/network/datagram_path.cc
+    ${PROJECT_SOURCE_DIR}/network/datagram_path.h
     ${PROJECT_SOURCE_DIR}/network/firewall_manager.cc
     ${PROJECT_SOURCE_DIR}/network/firewall_manager.h
+    ${PROJECT_SOURCE_DIR}/network/iocp_socket.cc
+    ${PROJECT_SOURCE_DIR}/network/iocp_socket.h
+    ${PROJECT_SOURCE_DIR}/network/loopback_channels.cc
+    ${PROJECT_SOURCE_DIR}/network/loopback_channels.h
     ${PROJECT_SOURCE_DIR}/network/network_channel.cc
     ${PROJECT_SOURCE_DIR}/network/network_channel.h
+    ${PROJECT_SOURCE_DIR}/network/network_io_threads.cc
+    ${PROJECT_SOURCE_DIR}/network/network_io_threads.h
     ${PROJECT_SOURCE_DIR}/network/network_server.cc
-    ${PROJECT_SOURCE_DIR}/network/network_server.h)
+    ${PROJECT_SOURCE_DIR}/network/network_server.h
+    ${PROJECT_SOURCE_DIR}/network/relay_agent.cc
+    ${PROJECT_SOURCE_DIR}/network/relay_agent.h
+    ${PROJECT_SOURCE_DIR}/network/relay_protocol.cc
+    ${PROJECT_SOURCE_DIR}/network/relay_protocol.h
+    ${PROJECT_SOURCE_DIR}/network/token_bucket.cc
+    ${PROJECT_SOURCE_DIR}/network/token_bucket.h)
 
 list(APPEND SOURCE_PROTOCOL
     ${PROJECT_SOURCE_DIR}/protocol/address_book.pb.cc
@@ -355,19 +513,37 @@ list(APPEND SOURCE_PROTOCOL
     ${PROJECT_SOURCE_DIR}/protocol/file_transfer_session.pb.cc
     ${PROJECT_SOURCE_DIR}/protocol/file_transfer_session.pb.h
     ${PROJECT_SOURCE_DIR}/protocol/file_transfer_session.proto
+    ${PROJECT_SOURCE_DIR}/protocol/host_session.pb.cc
+    ${PROJECT_SOURCE_DIR}/protocol/host_session.pb.h
+    ${PROJECT_SOURCE_DIR}/protocol/host_session.proto
     ${PROJECT_SOURCE_DIR}/protocol/key_exchange.pb.cc
     ${PROJECT_SOURCE_DIR}/protocol/key_exchange.pb.h
     ${PROJECT_SOURCE_DIR}/protocol/key_exchange.proto
     ${PROJECT_SOURCE_DIR}/protocol/notifier.pb.cc
     ${PROJECT_SOURCE_DIR}/protocol/notifier.pb.h
     ${PROJECT_SOURCE_DIR}/protocol/notifier.proto
+    ${PROJECT_SOURCE_DIR}/protocol/relay.pb.cc
+    ${PROJECT_SOURCE_DIR}/protocol/relay.pb.h
+    ${PROJECT_SOURCE_DIR}/protocol/relay.proto
     ${PROJECT_SOURCE_DIR}/protocol/system_info_session.pb.cc
     ${PROJECT_SOURCE_DIR}/protocol/system_info_session.pb.h
     ${PROJECT_SOURCE_DIR}/protocol/system_info_session.proto)
 
+list(APPEND SOURCE_RELAY
+    ${PROJECT_SOURCE_DIR}/relay/relay_pipe.cc
+    ${PROJECT_SOURCE_DIR}/relay/relay_pipe.h
+    ${PROJECT_SOURCE_DIR}/relay/relay_server.cc
+    ${PROJECT_SOURCE_DIR}/relay/relay_server.h)
+
 list(APPEND SOURCE_RESOURCES
     ${PROJECT_SOURCE_DIR}/resources/resources.qrc)
 
+list(APPEND SOURCE_SYSTEM_INFO
+    ${PROJECT_SOURCE_DIR}/system_info/category.cc
+    ${PROJECT_SOURCE_DIR}/system_info/category.h
+    ${PROJECT_SOURCE_DIR}/system_info/category_dmi.cc
+    ${PROJECT_SOURCE_DIR}/system_info/category_dmi.h)
+
 list(APPEND SOURCE_SYSTEM_INFO_PROTOCOL
     ${PROJECT_SOURCE_DIR}/system_info/protocol/dmi.pb.cc
 	${PROJECT_SOURCE_DIR}/system_info/protocol/dmi.pb.h
@@ -377,11 +553,44 @@ list(APPEND SOURCE_SYSTEM_INFO_UI
     ${PROJECT_SOURCE_DIR}/system_info/ui/dmi_parser.cc
     ${PROJECT_SOURCE_DIR}/system_info/ui/dmi_parser.h
     ${PROJECT_SOURCE_DIR}/system_info/ui/dmi_parser.ui
+    ${PROJECT_SOURCE_DIR}/system_info/ui/info_model.cc
+    ${PROJECT_SOURCE_DIR}/system_info/ui/info_model.h
+    ${PROJECT_SOURCE_DIR}/system_info/ui/parse_thread.cc
+    ${PROJECT_SOURCE_DIR}/system_info/ui/parse_thread.h
     ${PROJECT_SOURCE_DIR}/system_info/ui/parser.h)
 
+# The entry points of the applications. They are exported from the libraries, so they are not
+# placed in the static runtime.
+list(APPEND SOURCE_MAIN
+    ${PROJECT_SOURCE_DIR}/client/file_transfer_bench_main.cc
+    ${PROJECT_SOURCE_DIR}/client/file_transfer_bench_main.h
+    ${PROJECT_SOURCE_DIR}/client/inventory_main.cc
+    ${PROJECT_SOURCE_DIR}/client/inventory_main.h
+    ${PROJECT_SOURCE_DIR}/client/load_test_main.cc
+    ${PROJECT_SOURCE_DIR}/client/load_test_main.h
+    ${PROJECT_SOURCE_DIR}/codec/codec_bench_main.cc
+    ${PROJECT_SOURCE_DIR}/codec/codec_bench_main.h
+    ${PROJECT_SOURCE_DIR}/codec/kernel_bench_main.cc
+    ${PROJECT_SOURCE_DIR}/codec/kernel_bench_main.h
+    ${PROJECT_SOURCE_DIR}/host/win/host_main.cc
+    ${PROJECT_SOURCE_DIR}/host/win/host_main.h
+    ${PROJECT_SOURCE_DIR}/host/win/host_service_main.cc
+    ${PROJECT_SOURCE_DIR}/host/win/host_service_main.h
+    ${PROJECT_SOURCE_DIR}/network/network_bench_main.cc
+    ${PROJECT_SOURCE_DIR}/network/network_bench_main.h
+    ${PROJECT_SOURCE_DIR}/relay/relay_main.cc
+    ${PROJECT_SOURCE_DIR}/relay/relay_main.h)
+
+list(APPEND SOURCE_MAIN_UI
+    ${PROJECT_SOURCE_DIR}/console/console_main.cc
+    ${PROJECT_SOURCE_DIR}/console/console_main.h
+    ${PROJECT_SOURCE_DIR}/host/host_config_main.cc
+    ${PROJECT_SOURCE_DIR}/host/host_config_main.h
+    ${PROJECT_SOURCE_DIR}/host/host_notifier_main.cc
+    ${PROJECT_SOURCE_DIR}/host/host_notifier_main.h)
+
 list(APPEND SOURCE
     ${PROJECT_SOURCE_DIR}/build_config.cc
     ${PROJECT_SOURCE_DIR}/build_config.h
     ${PROJECT_SOURCE_DIR}/core_export.h
-    ${PROJECT_SOURCE_DIR}/version.h
-    ${PROJECT_SOURCE_DIR}/aspia_core.rc)
+    ${PROJECT_SOURCE_DIR}/version.h)
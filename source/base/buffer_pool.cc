@@ -0,0 +1,127 @@
+//
+// PROJECT:         Aspia
+// FILE:            base/buffer_pool.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "base/buffer_pool.h"
+
+#include "base/aligned_memory.h"
+#include "base/memory_counters.h"
+
+namespace aspia {
+
+namespace {
+
+// Small buffers are rounded up to a page, large buffers to 64 kB.
+constexpr size_t kSmallGranularity = 4096;
+constexpr size_t kLargeGranularity = 64 * 1024;
+
+// Limits of the cached memory. Enough for several 4K frames with the image buffers of
+// the encoders.
+constexpr size_t kMaxCachedSize = 256 * 1024 * 1024;
+constexpr size_t kMaxCachedBuffersPerClass = 4;
+
+} // namespace
+
+void BufferPool::Deleter::operator()(quint8* buffer) const
+{
+    BufferPool::instance()->release(buffer, size_);
+}
+
+// static
+BufferPool* BufferPool::instance()
+{
+    // The pool is never destroyed, because the buffers are released by the threads that may
+    // be still running when the static objects are destroyed.
+    static BufferPool* pool = new BufferPool();
+    return pool;
+}
+
+// static
+size_t BufferPool::sizeClass(size_t size)
+{
+    const size_t granularity = (size < kLargeGranularity) ? kSmallGranularity : kLargeGranularity;
+    return (size + granularity - 1) & ~(granularity - 1);
+}
+
+BufferPool::Buffer BufferPool::allocate(size_t size)
+{
+    quint8* buffer = acquire(size);
+    if (!buffer)
+        return Buffer();
+
+    return Buffer(buffer, Deleter(size));
+}
+
+quint8* BufferPool::acquire(size_t size)
+{
+    if (!size)
+        return nullptr;
+
+    const size_t size_class = sizeClass(size);
+
+    {
+        std::scoped_lock<std::mutex> lock(lock_);
+
+        auto it = free_buffers_.find(size_class);
+        if (it != free_buffers_.end() && !it->second.empty())
+        {
+            quint8* buffer = it->second.back();
+            it->second.pop_back();
+
+            cached_size_ -= size_class;
+            MemoryCounters::add(MemoryCounters::CacheMemory, -static_cast<qint64>(size_class));
+            return buffer;
+        }
+    }
+
+    return static_cast<quint8*>(qMallocAligned(size_class, kAlignment));
+}
+
+void BufferPool::release(quint8* buffer, size_t size)
+{
+    if (!buffer)
+        return;
+
+    const size_t size_class = sizeClass(size);
+
+    {
+        std::scoped_lock<std::mutex> lock(lock_);
+
+        std::vector<quint8*>& buffers = free_buffers_[size_class];
+
+        if (buffers.size() < kMaxCachedBuffersPerClass &&
+            cached_size_ + size_class <= kMaxCachedSize)
+        {
+            buffers.push_back(buffer);
+            cached_size_ += size_class;
+            MemoryCounters::add(MemoryCounters::CacheMemory, size_class);
+            return;
+        }
+    }
+
+    alignedFree(buffer);
+}
+
+void BufferPool::clear()
+{
+    std::map<size_t, std::vector<quint8*>> free_buffers;
+
+    {
+        std::scoped_lock<std::mutex> lock(lock_);
+        free_buffers.swap(free_buffers_);
+
+        MemoryCounters::add(MemoryCounters::CacheMemory, -static_cast<qint64>(cached_size_));
+        cached_size_ = 0;
+    }
+
+    for (const auto& size_class : free_buffers)
+    {
+        for (quint8* buffer : size_class.second)
+            alignedFree(buffer);
+    }
+}
+
+} // namespace aspia
@@ -0,0 +1,76 @@
+//
+// PROJECT:         Aspia
+// FILE:            base/buffer_pool.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_BASE__BUFFER_POOL_H
+#define _ASPIA_BASE__BUFFER_POOL_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace aspia {
+
+//
+// Process-wide cache of the aligned memory buffers. The buffers are grouped by the size
+// classes. A released buffer stays in the pool and is returned by the next allocation of
+// the same size class, so the frames and the image buffers recreated when the screen size
+// changes or the session restarts do not hit the allocator and do not cause page faults.
+//
+class BufferPool
+{
+public:
+    // Alignment of the buffers (cache line size, enough for AVX2).
+    static const size_t kAlignment = 64;
+
+    class Deleter
+    {
+    public:
+        Deleter() = default;
+        explicit Deleter(size_t size) : size_(size) {}
+
+        void operator()(quint8* buffer) const;
+
+        // Size of the buffer passed to allocate().
+        size_t size() const { return size_; }
+
+    private:
+        size_t size_ = 0;
+    };
+
+    using Buffer = std::unique_ptr<quint8[], Deleter>;
+
+    static BufferPool* instance();
+
+    // Returns the buffer of at least |size| bytes or an empty buffer if the memory could not
+    // be allocated. The contents of the buffer are undefined.
+    Buffer allocate(size_t size);
+
+    // Raw interface for the buffers whose ownership is passed to other objects (QImage).
+    // |size| for release() must be the same as for acquire().
+    quint8* acquire(size_t size);
+    void release(quint8* buffer, size_t size);
+
+    // Frees all cached buffers.
+    void clear();
+
+private:
+    BufferPool() = default;
+    ~BufferPool() = default;
+
+    static size_t sizeClass(size_t size);
+
+    std::mutex lock_;
+    std::map<size_t, std::vector<quint8*>> free_buffers_;
+    size_t cached_size_ = 0;
+
+    Q_DISABLE_COPY(BufferPool)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_BASE__BUFFER_POOL_H
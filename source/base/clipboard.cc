@@ -12,12 +12,50 @@
 #include <QGuiApplication>
 #include <QMimeData>
 
+#include "codec/compressor.h"
+#include "codec/decompressor.h"
+
 namespace aspia {
 
 namespace {
 
 const char kMimeTypeTextUtf8[] = "text/plain; charset=UTF-8";
 
+// The clipboard of this size is sent in one event.
+constexpr quint32 kMaxInlineSize = 64 * 1024;
+
+constexpr quint32 kChunkSize = 256 * 1024;
+
+// Number of the chunks requested ahead of the received ones.
+constexpr quint32 kChunksInFlight = 4;
+
+// The larger clipboard is not sent.
+constexpr size_t kMaxDataSize = 64 * 1024 * 1024;
+
+// The smaller data is sent uncompressed.
+constexpr size_t kMinCompressSize = 256;
+
+constexpr proto::desktop::Compression kCompression = proto::desktop::COMPRESSION_ZSTD;
+constexpr int kCompressionRatio = 3;
+
+// FNV-1a.
+constexpr quint64 kHashOffset = 14695981039346656037ULL;
+constexpr quint64 kHashPrime = 1099511628211ULL;
+
+quint64 hashData(const std::string& data)
+{
+    quint64 hash = kHashOffset;
+
+    for (char byte : data)
+    {
+        hash ^= static_cast<quint8>(byte);
+        hash *= kHashPrime;
+    }
+
+    // Zero means that the hash is unknown.
+    return hash ? hash : 1;
+}
+
 } // namespace
 
 Clipboard::Clipboard(QObject* parent)
@@ -35,19 +73,37 @@ Clipboard::~Clipboard()
 
 void Clipboard::injectClipboardEvent(const proto::desktop::ClipboardEvent& event)
 {
-    if (event.mime_type() != kMimeTypeTextUtf8)
-        return;
+    switch (event.type())
+    {
+        case proto::desktop::ClipboardEvent::TYPE_ANNOUNCE:
+            readAnnounce(event);
+            break;
 
-    last_mime_type_ = event.mime_type();
-    last_data_ = event.data();
+        case proto::desktop::ClipboardEvent::TYPE_REQUEST:
+            readRequest(event);
+            break;
 
-    QString text = QString::fromStdString(event.data());
+        case proto::desktop::ClipboardEvent::TYPE_DATA:
+        {
+            std::string data;
 
-#if defined(Q_OS_WIN)
-    text.replace(QLatin1String("\n"), QLatin1String("\r\n"));
-#endif
+            if (event.mime_type() != kMimeTypeTextUtf8 || !readData(event, &data))
+                return;
 
-    QGuiApplication::clipboard()->setText(text);
+            if (event.size())
+            {
+                readChunk(event, data);
+                return;
+            }
+
+            last_hash_ = hashData(data);
+            setClipboard(data);
+        }
+        break;
+
+        default:
+            break;
+    }
 }
 
 void Clipboard::dataChanged()
@@ -56,15 +112,249 @@ void Clipboard::dataChanged()
     if (!mime_data->hasText())
         return;
 
+    std::string data = QString(mime_data->text()).replace(
+        QLatin1String("\r\n"), QLatin1String("\n")).toStdString();
+
+    const quint64 hash = hashData(data);
+
+    // The injected clipboard and the repeated copies are not sent.
+    if (hash == last_hash_)
+        return;
+
+    if (data.size() > kMaxDataSize)
+    {
+        qWarning() << "The clipboard is too large to be sent:" << data.size();
+        return;
+    }
+
+    last_hash_ = hash;
+
     proto::desktop::ClipboardEvent event;
     event.set_mime_type(kMimeTypeTextUtf8);
-    event.set_data(QString(mime_data->text()).replace(
-        QLatin1String("\r\n"), QLatin1String("\n")).toStdString());
 
-    if (event.mime_type() == last_mime_type_ && event.data() == last_data_)
-        return;
+    if (!(features_ & proto::desktop::FEATURE_CLIPBOARD_CHUNKS) || data.size() <= kMaxInlineSize)
+    {
+        outgoing_data_.clear();
+        setData(&event, data.data(), data.size());
+    }
+    else
+    {
+        event.set_type(proto::desktop::ClipboardEvent::TYPE_ANNOUNCE);
+        event.set_hash(hash);
+        event.set_size(static_cast<quint32>(data.size()));
+
+        outgoing_data_ = std::move(data);
+    }
 
     emit clipboardEvent(event);
 }
 
+void Clipboard::readAnnounce(const proto::desktop::ClipboardEvent& event)
+{
+    if (event.mime_type() != kMimeTypeTextUtf8 || !event.size() || event.size() > kMaxDataSize)
+        return;
+
+    // The previous clipboard is not received anymore.
+    incoming_hash_ = event.hash();
+    incoming_size_ = event.size();
+    request_offset_ = 0;
+
+    incoming_data_.clear();
+    incoming_data_.reserve(incoming_size_);
+
+    sendRequest();
+}
+
+void Clipboard::readRequest(const proto::desktop::ClipboardEvent& event)
+{
+    // The clipboard may be changed after the announce.
+    if (outgoing_data_.empty() ||
+        event.hash() != last_hash_ ||
+        event.offset() >= outgoing_data_.size())
+    {
+        return;
+    }
+
+    const size_t size = qMin<size_t>(kChunkSize, outgoing_data_.size() - event.offset());
+
+    proto::desktop::ClipboardEvent chunk;
+    chunk.set_mime_type(kMimeTypeTextUtf8);
+    chunk.set_hash(last_hash_);
+    chunk.set_size(static_cast<quint32>(outgoing_data_.size()));
+    chunk.set_offset(event.offset());
+    setData(&chunk, outgoing_data_.data() + event.offset(), size);
+
+    emit clipboardEvent(chunk);
+}
+
+void Clipboard::readChunk(const proto::desktop::ClipboardEvent& event, const std::string& data)
+{
+    // The chunks of the replaced clipboard and the chunks out of order are ignored.
+    if (event.hash() != incoming_hash_ ||
+        event.size() != incoming_size_ ||
+        event.offset() != incoming_data_.size() ||
+        event.offset() + data.size() > incoming_size_)
+    {
+        return;
+    }
+
+    incoming_data_.append(data);
+
+    if (incoming_data_.size() < incoming_size_)
+    {
+        sendRequest();
+        return;
+    }
+
+    if (hashData(incoming_data_) != incoming_hash_)
+    {
+        qWarning("The received clipboard does not match the announced one");
+    }
+    else
+    {
+        last_hash_ = incoming_hash_;
+        setClipboard(incoming_data_);
+    }
+
+    incoming_hash_ = 0;
+    incoming_size_ = 0;
+    incoming_data_.clear();
+    incoming_data_.shrink_to_fit();
+}
+
+void Clipboard::sendRequest()
+{
+    while (request_offset_ < incoming_size_ &&
+           request_offset_ - incoming_data_.size() < kChunkSize * kChunksInFlight)
+    {
+        proto::desktop::ClipboardEvent event;
+        event.set_type(proto::desktop::ClipboardEvent::TYPE_REQUEST);
+        event.set_hash(incoming_hash_);
+        event.set_offset(request_offset_);
+
+        emit clipboardEvent(event);
+
+        request_offset_ += kChunkSize;
+    }
+}
+
+void Clipboard::setClipboard(const std::string& data)
+{
+    QString text = QString::fromStdString(data);
+
+#if defined(Q_OS_WIN)
+    text.replace(QLatin1String("\n"), QLatin1String("\r\n"));
+#endif
+
+    QGuiApplication::clipboard()->setText(text);
+}
+
+void Clipboard::setData(proto::desktop::ClipboardEvent* event, const char* data, size_t size)
+{
+    if (!(features_ & proto::desktop::FEATURE_CLIPBOARD_COMPRESSION) || size < kMinCompressSize)
+    {
+        event->set_data(data, size);
+        return;
+    }
+
+    if (!compressor_)
+        compressor_ = Compressor::create(kCompression, kCompressionRatio);
+
+    compressor_->reset();
+
+    // The compressed data is sent only if it is smaller.
+    std::string* compressed = event->mutable_data();
+    compressed->resize(size);
+
+    const quint8* input = reinterpret_cast<const quint8*>(data);
+    quint8* output = reinterpret_cast<quint8*>(compressed->data());
+
+    size_t used = 0;
+    size_t filled = 0;
+    bool compress_again = true;
+
+    while (compress_again && filled < size)
+    {
+        size_t consumed = 0;
+        size_t written = 0;
+
+        compress_again = compressor_->process(input + used, size - used,
+                                              output + filled, size - filled,
+                                              Compressor::CompressorFinish,
+                                              &consumed, &written);
+        used += consumed;
+        filled += written;
+    }
+
+    if (compress_again || used != size || filled >= size)
+    {
+        event->set_data(data, size);
+        return;
+    }
+
+    compressed->resize(filled);
+    event->set_compression(kCompression);
+    event->set_uncompressed_size(static_cast<quint32>(size));
+}
+
+bool Clipboard::readData(const proto::desktop::ClipboardEvent& event, std::string* data)
+{
+    if (!event.uncompressed_size())
+    {
+        *data = event.data();
+        return true;
+    }
+
+    // The chunk is not larger than the whole clipboard, which is limited.
+    if (event.uncompressed_size() > kMaxDataSize || event.data().empty())
+    {
+        qWarning() << "Invalid compressed clipboard:" << event.uncompressed_size();
+        return false;
+    }
+
+    if (!decompressor_ || decompressor_type_ != event.compression())
+    {
+        decompressor_ = Decompressor::create(event.compression());
+        if (!decompressor_)
+        {
+            qWarning() << "Unsupported clipboard compression:" << event.compression();
+            return false;
+        }
+
+        decompressor_type_ = event.compression();
+    }
+
+    data->resize(event.uncompressed_size());
+
+    const quint8* input = reinterpret_cast<const quint8*>(event.data().data());
+    const size_t input_size = event.data().size();
+    quint8* output = reinterpret_cast<quint8*>(data->data());
+
+    size_t used = 0;
+    size_t filled = 0;
+    bool decompress_again = true;
+
+    while (decompress_again && used < input_size && filled < data->size())
+    {
+        size_t consumed = 0;
+        size_t written = 0;
+
+        decompress_again = decompressor_->process(input + used, input_size - used,
+                                                  output + filled, data->size() - filled,
+                                                  &consumed, &written);
+        used += consumed;
+        filled += written;
+    }
+
+    decompressor_->reset();
+
+    if (filled != data->size())
+    {
+        qWarning("The compressed clipboard is damaged");
+        return false;
+    }
+
+    return true;
+}
+
 } // namespace aspia
@@ -10,10 +10,22 @@
 
 #include <QObject>
 
+#include <memory>
+
 #include "protocol/desktop_session.pb.h"
 
 namespace aspia {
 
+class Compressor;
+class Decompressor;
+
+//
+// Synchronizes the text clipboard with the other side. The changes are compared by the hash, so
+// the injected clipboard and the repeated copies are not sent back. If the other side supports
+// FEATURE_CLIPBOARD_CHUNKS, then the large clipboard is only announced and the other side
+// requests it by chunks, a few chunks at a time, so it does not delay the video. With
+// FEATURE_CLIPBOARD_COMPRESSION the data which is not too small is compressed.
+//
 class Clipboard : public QObject
 {
     Q_OBJECT
@@ -22,6 +34,9 @@ public:
     Clipboard(QObject* parent = nullptr);
     ~Clipboard();
 
+    // Sets the features of the other side. Must be called before the first event.
+    void setFeatures(quint32 features) { features_ = features; }
+
 public slots:
     // Receiving the incoming clipboard.
     void injectClipboardEvent(const proto::desktop::ClipboardEvent& event);
@@ -33,8 +48,33 @@ private slots:
     void dataChanged();
 
 private:
-    std::string last_mime_type_;
-    std::string last_data_;
+    void readAnnounce(const proto::desktop::ClipboardEvent& event);
+    void readRequest(const proto::desktop::ClipboardEvent& event);
+    void readChunk(const proto::desktop::ClipboardEvent& event, const std::string& data);
+    void sendRequest();
+    void setClipboard(const std::string& data);
+
+    // Sets |data| of |event|, compressed if the other side supports it.
+    void setData(proto::desktop::ClipboardEvent* event, const char* data, size_t size);
+    bool readData(const proto::desktop::ClipboardEvent& event, std::string* data);
+
+    quint32 features_ = 0;
+
+    std::unique_ptr<Compressor> compressor_;
+    std::unique_ptr<Decompressor> decompressor_;
+    proto::desktop::Compression decompressor_type_ = proto::desktop::COMPRESSION_ZLIB;
+
+    // Hash of the last sent or injected clipboard.
+    quint64 last_hash_ = 0;
+
+    // The announced clipboard, which is sent by chunks on the requests.
+    std::string outgoing_data_;
+
+    // The clipboard which is received by chunks.
+    quint64 incoming_hash_ = 0;
+    quint32 incoming_size_ = 0;
+    quint32 request_offset_ = 0;
+    std::string incoming_data_;
 
     Q_DISABLE_COPY(Clipboard)
 };
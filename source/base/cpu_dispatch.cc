@@ -0,0 +1,149 @@
+//
+// PROJECT:         Aspia
+// FILE:            base/cpu_dispatch.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "base/cpu_dispatch.h"
+
+#include <QDebug>
+#include <QStringList>
+
+#include <libyuv/cpu_id.h>
+
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <string>
+
+namespace aspia {
+
+namespace {
+
+const char* kInstructionSetNames[CpuDispatch::InstructionSetCount] =
+{
+    "c", "sse2", "ssse3", "sse42", "avx2", "avx512", "neon"
+};
+
+// The bits of the disabled instruction sets.
+std::atomic<quint32> disabled_sets { 0 };
+
+std::mutex logged_lock;
+
+// The kernels whose implementations are already logged.
+std::set<std::string>& loggedKernels()
+{
+    static std::set<std::string> kernels;
+    return kernels;
+}
+
+bool isSupported(CpuDispatch::InstructionSet instruction_set)
+{
+    switch (instruction_set)
+    {
+        case CpuDispatch::C:
+            return true;
+
+        case CpuDispatch::SSE2:
+            return libyuv::TestCpuFlag(libyuv::kCpuHasSSE2) != 0;
+
+        case CpuDispatch::SSSE3:
+            return libyuv::TestCpuFlag(libyuv::kCpuHasSSSE3) != 0;
+
+        case CpuDispatch::SSE42:
+            return libyuv::TestCpuFlag(libyuv::kCpuHasSSE42) != 0;
+
+        case CpuDispatch::AVX2:
+            return libyuv::TestCpuFlag(libyuv::kCpuHasAVX2) != 0;
+
+        case CpuDispatch::AVX512:
+            return libyuv::TestCpuFlag(libyuv::kCpuHasAVX512BW) != 0;
+
+        case CpuDispatch::NEON:
+            return libyuv::TestCpuFlag(libyuv::kCpuHasNEON) != 0;
+
+        default:
+            return false;
+    }
+}
+
+} // namespace
+
+// static
+bool CpuDispatch::isEnabled(InstructionSet instruction_set)
+{
+    if (instruction_set == C)
+        return true;
+
+    if (disabled_sets.load(std::memory_order_relaxed) & (1U << instruction_set))
+        return false;
+
+    return isSupported(instruction_set);
+}
+
+// static
+bool CpuDispatch::setOverride(const QString& disabled_list)
+{
+    quint32 disabled = 0;
+
+    for (const auto& item : disabled_list.split(QLatin1Char(','), QString::SkipEmptyParts))
+    {
+        const QString set_name = item.trimmed().toLower();
+
+        if (set_name == QLatin1String("all"))
+        {
+            disabled |= ~1U;
+            continue;
+        }
+
+        bool found = false;
+
+        for (int i = SSE2; i < InstructionSetCount; ++i)
+        {
+            if (set_name == QLatin1String(kInstructionSetNames[i]))
+            {
+                disabled |= 1U << i;
+                found = true;
+                break;
+            }
+        }
+
+        if (!found)
+        {
+            qWarning() << "Unknown instruction set:" << set_name;
+            return false;
+        }
+    }
+
+    disabled_sets.store(disabled, std::memory_order_relaxed);
+
+    if (disabled)
+        qInfo() << "Disabled instruction sets:" << disabled_list;
+
+    return true;
+}
+
+// static
+const char* CpuDispatch::name(InstructionSet instruction_set)
+{
+    if (instruction_set < 0 || instruction_set >= InstructionSetCount)
+        return "unknown";
+
+    return kInstructionSetNames[instruction_set];
+}
+
+// static
+void CpuDispatch::logSelection(const char* kernel, InstructionSet instruction_set)
+{
+    {
+        std::scoped_lock<std::mutex> lock(logged_lock);
+
+        if (!loggedKernels().insert(kernel).second)
+            return;
+    }
+
+    qInfo("Kernel %s: %s", kernel, name(instruction_set));
+}
+
+} // namespace aspia
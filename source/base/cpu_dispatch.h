@@ -0,0 +1,85 @@
+//
+// PROJECT:         Aspia
+// FILE:            base/cpu_dispatch.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_BASE__CPU_DISPATCH_H
+#define _ASPIA_BASE__CPU_DISPATCH_H
+
+#include <QString>
+
+#include <initializer_list>
+
+namespace aspia {
+
+//
+// Selects the implementations of the vector kernels by the instruction sets of the processor.
+// Each kernel lists its implementations from the most preferred one, and the first one whose
+// instruction set is enabled is used. The instruction sets may be disabled by the override
+// for the benchmarks and for comparing the implementations on the same computer. The chosen
+// implementation of each kernel is logged once for the process.
+//
+class CpuDispatch
+{
+public:
+    enum InstructionSet
+    {
+        C, // The portable implementation, always enabled.
+        SSE2,
+        SSSE3,
+        SSE42,
+        AVX2,
+        AVX512, // AVX-512 BW.
+        NEON,
+
+        InstructionSetCount
+    };
+
+    template <typename Func>
+    struct Implementation
+    {
+        InstructionSet instruction_set;
+        Func func;
+    };
+
+    // Returns true if the processor supports |instruction_set| and it is not disabled.
+    static bool isEnabled(InstructionSet instruction_set);
+
+    // Disables the instruction sets listed by their names separated by commas, for example
+    // "avx512,avx2". "all" disables all of them except C, an empty list enables all again.
+    // Must be called at the start of the process, because the kernels which are already
+    // selected are not changed. Returns false if the list contains an unknown name.
+    static bool setOverride(const QString& disabled_list);
+
+    // Returns the function of the first enabled implementation of |kernel|. The list should
+    // end with the C implementation. nullptr may be used as the function of C if the caller
+    // has its own portable code.
+    template <typename Func>
+    static Func select(const char* kernel, std::initializer_list<Implementation<Func>> list)
+    {
+        for (const auto& implementation : list)
+        {
+            if (isEnabled(implementation.instruction_set))
+            {
+                logSelection(kernel, implementation.instruction_set);
+                return implementation.func;
+            }
+        }
+
+        logSelection(kernel, C);
+        return nullptr;
+    }
+
+    static const char* name(InstructionSet instruction_set);
+
+private:
+    static void logSelection(const char* kernel, InstructionSet instruction_set);
+
+    Q_DISABLE_COPY(CpuDispatch)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_BASE__CPU_DISPATCH_H
@@ -11,7 +11,11 @@
 #include <QDebug>
 #include <QDir>
 #include <QTextStream>
-#include <QThread>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 namespace aspia {
 
@@ -19,6 +23,31 @@ QScopedPointer<QFile> FileLogger::file_;
 
 namespace {
 
+// The writer thread is woken up when this size of the messages is pending.
+constexpr int kWriteThreshold = 64 * 1024;
+
+// Otherwise the messages are written with this interval.
+constexpr std::chrono::milliseconds kWriteInterval{ 1000 };
+
+// When the pending messages exceed the limit, the debug and the information messages are
+// dropped. The warnings are dropped after twice the limit.
+constexpr int kMaxPendingSize = 4 * 1024 * 1024;
+
+constexpr qint64 kMaxFileSize = 32 * 1024 * 1024;
+
+// Protects the pending messages and the state of the writer thread.
+std::mutex pending_lock;
+std::condition_variable pending_event;
+QByteArray pending_messages;
+int dropped_messages = 0;
+bool terminate_writer = false;
+
+// Protects the file. It is taken before |pending_lock|, so the messages are written in the
+// order in which they are added.
+std::mutex file_lock;
+
+std::thread writer_thread;
+
 const char* typeName(QtMsgType type)
 {
     switch (type)
@@ -43,13 +72,47 @@ const char* typeName(QtMsgType type)
     }
 }
 
+bool isDroppable(QtMsgType type, int pending_size)
+{
+    switch (type)
+    {
+        case QtDebugMsg:
+        case QtInfoMsg:
+            return pending_size >= kMaxPendingSize;
+
+        case QtWarningMsg:
+            return pending_size >= kMaxPendingSize * 2;
+
+        default:
+            return false;
+    }
+}
+
 } // namespace
 
 FileLogger::FileLogger() = default;
 
 FileLogger::~FileLogger()
 {
+    if (!writer_thread.joinable())
+        return;
+
     qInfo("Logging finished");
+
+    {
+        std::scoped_lock<std::mutex> lock(pending_lock);
+        terminate_writer = true;
+    }
+
+    pending_event.notify_one();
+    writer_thread.join();
+
+    // The messages of the remaining destructors are not written after the writer is stopped.
+    qInstallMessageHandler(nullptr);
+
+    std::scoped_lock<std::mutex> lock(file_lock);
+    writePendingMessages();
+    file_.reset();
 }
 
 bool FileLogger::startLogging(const QString& prefix)
@@ -77,6 +140,9 @@ bool FileLogger::startLogging(const QString& prefix)
         return false;
     }
 
+    terminate_writer = false;
+    writer_thread = std::thread(&FileLogger::writerThread);
+
     qInstallMessageHandler(messageHandler);
 
     qInfo() << "Logging started.";
@@ -97,7 +163,8 @@ void FileLogger::messageHandler(QtMsgType type,
     if (last_slash_pos != -1)
         filename.remove(0, last_slash_pos + 1);
 
-    QTextStream stream(file_.data());
+    QString message;
+    QTextStream stream(&message);
 
     stream << QDateTime::currentDateTime().toString(QStringLiteral("hh:mm:ss.zzz"))
            << QLatin1Char(' ')
@@ -107,7 +174,118 @@ void FileLogger::messageHandler(QtMsgType type,
            << msg
            << endl;
 
-    stream.flush();
+    const QByteArray buffer = message.toUtf8();
+
+    if (type == QtFatalMsg)
+    {
+        // The process is terminated after the handler, so the message is written before.
+        std::scoped_lock<std::mutex> file_guard(file_lock);
+
+        {
+            std::scoped_lock<std::mutex> lock(pending_lock);
+            pending_messages += buffer;
+        }
+
+        writePendingMessages();
+        return;
+    }
+
+    bool wake_up_writer;
+
+    {
+        std::scoped_lock<std::mutex> lock(pending_lock);
+
+        if (isDroppable(type, pending_messages.size()))
+        {
+            ++dropped_messages;
+            return;
+        }
+
+        const int prev_size = pending_messages.size();
+        pending_messages += buffer;
+
+        wake_up_writer = prev_size < kWriteThreshold && pending_messages.size() >= kWriteThreshold;
+    }
+
+    if (wake_up_writer)
+        pending_event.notify_one();
+}
+
+// static
+void FileLogger::writerThread()
+{
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(pending_lock);
+
+            pending_event.wait_for(lock, kWriteInterval, []()
+            {
+                return terminate_writer || pending_messages.size() >= kWriteThreshold;
+            });
+
+            if (terminate_writer)
+                return;
+        }
+
+        std::scoped_lock<std::mutex> lock(file_lock);
+        writePendingMessages();
+    }
+}
+
+// static
+void FileLogger::writePendingMessages()
+{
+    QByteArray buffer;
+    int dropped = 0;
+
+    {
+        std::scoped_lock<std::mutex> lock(pending_lock);
+
+        buffer.swap(pending_messages);
+        dropped = dropped_messages;
+        dropped_messages = 0;
+
+        // The buffer of the same capacity is used for the next messages.
+        pending_messages.reserve(qMin(buffer.capacity(), kMaxPendingSize));
+    }
+
+    if (!file_)
+        return;
+
+    if (buffer.isEmpty() && !dropped)
+        return;
+
+    file_->write(buffer);
+
+    // The messages are dropped after the pending messages.
+    if (dropped)
+    {
+        file_->write(QString("%1 WARNING %2 messages dropped\n")
+                     .arg(QDateTime::currentDateTime().toString(QStringLiteral("hh:mm:ss.zzz")))
+                     .arg(dropped)
+                     .toUtf8());
+    }
+
+    file_->flush();
+
+    if (file_->size() >= kMaxFileSize)
+        rotateFile();
+}
+
+// static
+void FileLogger::rotateFile()
+{
+    const QString file_path = file_->fileName();
+    const QString old_file_path = file_path + QLatin1String(".old");
+
+    file_->close();
+
+    QFile::remove(old_file_path);
+    QFile::rename(file_path, old_file_path);
+
+    // If the file is not renamed, then the messages are appended to it.
+    file_->open(QFile::WriteOnly | QFile::Append | QFile::Text);
 }
 
 } // namespace aspia
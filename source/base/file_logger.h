@@ -13,6 +13,14 @@
 
 namespace aspia {
 
+//
+// Writes the log messages into the file in the logging directory. The messages are formatted on
+// the calling thread and are written by the background thread, so the logging in the hot paths
+// does not wait for the disk. If the disk does not keep up, then the debug and the information
+// messages are dropped first and the number of the dropped messages is written to the log. The
+// fatal messages are written immediately, because the process is terminated after them. When
+// the file exceeds the size limit, it is renamed to ".old" and a new file is started.
+//
 class FileLogger
 {
 public:
@@ -26,6 +34,12 @@ private:
                                const QMessageLogContext& context,
                                const QString& msg);
 
+    static void writerThread();
+
+    // Writes the pending messages. Must be called with the lock of the file held.
+    static void writePendingMessages();
+    static void rotateFile();
+
     static QScopedPointer<QFile> file_;
 
     Q_DISABLE_COPY(FileLogger);
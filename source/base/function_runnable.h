@@ -0,0 +1,43 @@
+//
+// PROJECT:         Aspia
+// FILE:            base/function_runnable.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_BASE__FUNCTION_RUNNABLE_H
+#define _ASPIA_BASE__FUNCTION_RUNNABLE_H
+
+#include <QRunnable>
+
+#include <functional>
+#include <utility>
+
+namespace aspia {
+
+// Runs |function| in QThreadPool, which deletes the runnable after the run (QRunnable::create
+// appears only in Qt 5.15).
+class FunctionRunnable : public QRunnable
+{
+public:
+    explicit FunctionRunnable(std::function<void()> function)
+        : function_(std::move(function))
+    {
+        // Nothing
+    }
+
+    // QRunnable implementation.
+    void run() override
+    {
+        function_();
+    }
+
+private:
+    std::function<void()> function_;
+
+    Q_DISABLE_COPY(FunctionRunnable)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_BASE__FUNCTION_RUNNABLE_H
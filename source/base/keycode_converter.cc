@@ -10,6 +10,8 @@
 
 #include <QtCore>
 
+#include <iterator>
+
 namespace aspia {
 
 namespace {
@@ -25,12 +27,87 @@ namespace {
 #else
 #define USB_KEYMAP(usb, evdev, xkb, win, mac, qt) {usb, 0, qt}
 #endif
-#define USB_KEYMAP_DECLARATION const KeycodeMapEntry usb_keycode_map[] =
+#define USB_KEYMAP_DECLARATION constexpr KeycodeMapEntry usb_keycode_map[] =
 #include "base/keycode_converter_data.inc"
 #undef USB_KEYMAP
 #undef USB_KEYMAP_DECLARATION
 
-const size_t kKeycodeMapEntries = _countof(usb_keycode_map);
+constexpr size_t kKeycodeMapEntries = std::size(usb_keycode_map);
+
+// The keycodes are found by the hash tables which are built at compile time, one for each
+// field of the entries. A slot contains the index of the entry in |usb_keycode_map| and the
+// collisions are resolved by the linear probing. The tables are filled less than by half, so
+// a keycode is found in one or two probes.
+constexpr int kLookupTableBits = 9;
+constexpr size_t kLookupTableSize = 1 << kLookupTableBits;
+constexpr quint8 kEmptySlot = 0xFF;
+
+static_assert(kKeycodeMapEntries < kEmptySlot, "The index of the entry does not fit the slot");
+static_assert(kKeycodeMapEntries * 2 < kLookupTableSize, "The lookup table is too small");
+
+struct LookupTable
+{
+    quint8 slots[kLookupTableSize];
+};
+
+constexpr size_t lookupSlot(quint32 keycode)
+{
+    // Fibonacci hashing.
+    return static_cast<quint32>(keycode * 2654435769U) >> (32 - kLookupTableBits);
+}
+
+constexpr size_t nextSlot(size_t slot)
+{
+    return (slot + 1) & (kLookupTableSize - 1);
+}
+
+// If several entries have the same keycode, the first of them is found, as by the linear search.
+template <typename T>
+constexpr LookupTable buildLookupTable(T KeycodeMapEntry::* field)
+{
+    LookupTable table = {};
+
+    for (size_t slot = 0; slot < kLookupTableSize; ++slot)
+        table.slots[slot] = kEmptySlot;
+
+    for (size_t i = 0; i < kKeycodeMapEntries; ++i)
+    {
+        const T keycode = usb_keycode_map[i].*field;
+        size_t slot = lookupSlot(static_cast<quint32>(keycode));
+
+        while (table.slots[slot] != kEmptySlot &&
+               usb_keycode_map[table.slots[slot]].*field != keycode)
+        {
+            slot = nextSlot(slot);
+        }
+
+        if (table.slots[slot] == kEmptySlot)
+            table.slots[slot] = static_cast<quint8>(i);
+    }
+
+    return table;
+}
+
+constexpr LookupTable kUsbLookupTable = buildLookupTable(&KeycodeMapEntry::usb_keycode);
+constexpr LookupTable kNativeLookupTable = buildLookupTable(&KeycodeMapEntry::native_keycode);
+constexpr LookupTable kQtLookupTable = buildLookupTable(&KeycodeMapEntry::qt_keycode);
+
+// Returns the entry with |keycode| or the first entry (the invalid keycodes) if it is not found.
+template <typename T>
+const KeycodeMapEntry& findEntry(const LookupTable& table, T KeycodeMapEntry::* field, T keycode)
+{
+    // The table always has the empty slots, so the probing is finished.
+    for (size_t slot = lookupSlot(static_cast<quint32>(keycode));
+         table.slots[slot] != kEmptySlot;
+         slot = nextSlot(slot))
+    {
+        const KeycodeMapEntry& entry = usb_keycode_map[table.slots[slot]];
+        if (entry.*field == keycode)
+            return entry;
+    }
+
+    return usb_keycode_map[0];
+}
 
 } // namespace
 
@@ -63,37 +140,20 @@ int KeycodeConverter::usbKeycodeToNativeKeycode(quint32 usb_keycode)
         usb_keycode = 0x070068; // F13.
 #endif
 
-    for (size_t i = 0; i < kKeycodeMapEntries; ++i)
-    {
-        if (usb_keycode_map[i].usb_keycode == usb_keycode)
-            return usb_keycode_map[i].native_keycode;
-    }
-
-    return invalidNativeKeycode();
+    return findEntry(kUsbLookupTable, &KeycodeMapEntry::usb_keycode, usb_keycode).native_keycode;
 }
 
 // static
 quint32 KeycodeConverter::nativeKeycodeToUsbKeycode(int native_keycode)
 {
-    for (size_t i = 0; i < kKeycodeMapEntries; ++i)
-    {
-        if (usb_keycode_map[i].native_keycode == native_keycode)
-            return usb_keycode_map[i].usb_keycode;
-    }
-
-    return invalidUsbKeycode();
+    return findEntry(kNativeLookupTable, &KeycodeMapEntry::native_keycode, native_keycode)
+        .usb_keycode;
 }
 
 // static
 quint32 KeycodeConverter::qtKeycodeToUsbKeycode(int qt_keycode)
 {
-    for (size_t i = 0; i < kKeycodeMapEntries; ++i)
-    {
-        if (usb_keycode_map[i].qt_keycode == qt_keycode)
-            return usb_keycode_map[i].usb_keycode;
-    }
-
-    return invalidUsbKeycode();
+    return findEntry(kQtLookupTable, &KeycodeMapEntry::qt_keycode, qt_keycode).usb_keycode;
 }
 
 } // namespace aspia
@@ -14,27 +14,26 @@
 
 namespace aspia {
 
-LocaleLoader::LocaleLoader()
-{
-    QStringList qm_file_list =
-        QDir(translationsDir()).entryList(QStringList() << QStringLiteral("*.qm"));
+namespace {
 
+// The locale of "aspia_ru.qm" is "ru".
+QString localeName(const QString& qm_file)
+{
     QRegExp regexp(QStringLiteral("([a-zA-Z0-9-_]+)_([^.]*).qm"));
 
-    for (const auto& qm_file : qm_file_list)
-    {
-        if (regexp.exactMatch(qm_file))
-        {
-            const QString locale_name = regexp.cap(2);
+    if (!regexp.exactMatch(qm_file))
+        return QString();
 
-            if (locale_list_.contains(locale_name))
-                locale_list_[locale_name].push_back(qm_file);
-            else
-                locale_list_.insert(locale_name, QStringList() << qm_file);
-        }
-    }
+    return regexp.cap(2);
 }
 
+QStringList qmFileList(const QString& filter)
+{
+    return QDir(LocaleLoader::translationsDir()).entryList(QStringList() << filter, QDir::Files);
+}
+
+} // namespace
+
 LocaleLoader::~LocaleLoader()
 {
     removeTranslators();
@@ -44,15 +43,16 @@ QStringList LocaleLoader::localeList() const
 {
     QStringList list;
 
-    QHashIterator<QString, QStringList> iter(locale_list_);
-    while (iter.hasNext())
+    for (const auto& qm_file : qmFileList(QStringLiteral("*.qm")))
     {
-        iter.next();
-        list.push_back(iter.key());
+        const QString locale_name = localeName(qm_file);
+
+        if (!locale_name.isEmpty() && !list.contains(locale_name))
+            list.push_back(locale_name);
     }
 
     const QString english_locale = QStringLiteral("en");
-    if (!locale_list_.contains(english_locale))
+    if (!list.contains(english_locale))
         list.push_back(english_locale);
 
     return list;
@@ -74,19 +74,32 @@ QStringList LocaleLoader::sortedLocaleList() const
 
 QStringList LocaleLoader::fileList(const QString& locale_name) const
 {
-    if (!contains(locale_name))
+    if (locale_name.isEmpty())
         return QStringList();
 
-    return locale_list_[locale_name];
+    const QString filter = QStringLiteral("*_") + locale_name + QStringLiteral(".qm");
+    QStringList list;
+
+    // The filter also matches the files of the locales with the same suffix.
+    for (const auto& qm_file : qmFileList(filter))
+    {
+        if (localeName(qm_file) == locale_name)
+            list.push_back(qm_file);
+    }
+
+    return list;
 }
 
 bool LocaleLoader::contains(const QString& locale_name) const
 {
-    return locale_list_.contains(locale_name);
+    return !fileList(locale_name).isEmpty();
 }
 
 void LocaleLoader::installTranslators(const QString& locale_name)
 {
+    if (locale_name == installed_locale_)
+        return;
+
     removeTranslators();
 
     const QString translations_dir = translationsDir();
@@ -106,9 +119,10 @@ void LocaleLoader::installTranslators(const QString& locale_name)
             translator_list_.push_back(translator);
         }
     }
+
+    installed_locale_ = locale_name;
 }
 
-// static
 QString LocaleLoader::translationsDir()
 {
     return QCoreApplication::applicationDirPath() + QStringLiteral("/translations/");
@@ -123,6 +137,7 @@ void LocaleLoader::removeTranslators()
     }
 
     translator_list_.clear();
+    installed_locale_.clear();
 }
 
 } // namespace aspia
@@ -8,17 +8,21 @@
 #ifndef _ASPIA_BASE__LOCALE_LOADER_H
 #define _ASPIA_BASE__LOCALE_LOADER_H
 
-#include <QHash>
 #include <QStringList>
 
 class QTranslator;
 
 namespace aspia {
 
+//
+// The locales are found by the names of the translation files. The directory is listed only
+// when the list of all locales is requested, and only the files of the installed locale are
+// loaded.
+//
 class LocaleLoader
 {
 public:
-    LocaleLoader();
+    LocaleLoader() = default;
     ~LocaleLoader();
 
     QStringList localeList() const;
@@ -32,7 +36,7 @@ public:
 private:
     void removeTranslators();
 
-    QHash<QString, QStringList> locale_list_;
+    QString installed_locale_;
     QList<QTranslator*> translator_list_;
 
     Q_DISABLE_COPY(LocaleLoader)
@@ -0,0 +1,77 @@
+//
+// PROJECT:         Aspia
+// FILE:            base/memory_counters.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "base/memory_counters.h"
+
+#include <qt_windows.h>
+#include <psapi.h>
+
+#include <atomic>
+
+namespace aspia {
+
+namespace {
+
+std::atomic<qint64> counters[MemoryCounters::SubsystemCount];
+
+} // namespace
+
+// static
+void MemoryCounters::add(Subsystem subsystem, qint64 size)
+{
+    Q_ASSERT(subsystem >= 0 && subsystem < SubsystemCount);
+    counters[subsystem].fetch_add(size, std::memory_order_relaxed);
+}
+
+// static
+qint64 MemoryCounters::value(Subsystem subsystem)
+{
+    Q_ASSERT(subsystem >= 0 && subsystem < SubsystemCount);
+    return counters[subsystem].load(std::memory_order_relaxed);
+}
+
+// static
+qint64 MemoryCounters::processMemory()
+{
+    PROCESS_MEMORY_COUNTERS_EX memory_counters;
+
+    if (!GetProcessMemoryInfo(GetCurrentProcess(),
+                              reinterpret_cast<PROCESS_MEMORY_COUNTERS*>(&memory_counters),
+                              sizeof(memory_counters)))
+    {
+        return -1;
+    }
+
+    return static_cast<qint64>(memory_counters.PrivateUsage);
+}
+
+MemoryCounters::Charge::Charge(Subsystem subsystem, qint64 size)
+    : subsystem_(subsystem),
+      size_(size)
+{
+    if (size_)
+        MemoryCounters::add(subsystem_, size_);
+}
+
+MemoryCounters::Charge::~Charge()
+{
+    if (size_)
+        MemoryCounters::add(subsystem_, -size_);
+}
+
+void MemoryCounters::Charge::add(qint64 size)
+{
+    size_ += size;
+    MemoryCounters::add(subsystem_, size);
+}
+
+void MemoryCounters::Charge::reset(qint64 size)
+{
+    add(size - size_);
+}
+
+} // namespace aspia
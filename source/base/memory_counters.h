@@ -0,0 +1,66 @@
+//
+// PROJECT:         Aspia
+// FILE:            base/memory_counters.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_BASE__MEMORY_COUNTERS_H
+#define _ASPIA_BASE__MEMORY_COUNTERS_H
+
+#include <QtGlobal>
+
+namespace aspia {
+
+//
+// Process-wide counters of the memory held by the subsystems. Only the large buffers are
+// counted: the pixels of the frames, the maps of the differ, the images of the encoders, the
+// write queues of the channels and the caches. The rest of the private memory of the process
+// (the heaps, the internal frames of the codecs) is the difference with processMemory().
+//
+class MemoryCounters
+{
+public:
+    enum Subsystem
+    {
+        FrameMemory,
+        DifferMemory,
+        EncoderMemory,
+        QueueMemory,
+        CacheMemory,
+
+        SubsystemCount
+    };
+
+    static void add(Subsystem subsystem, qint64 size);
+    static qint64 value(Subsystem subsystem);
+
+    // The private bytes of the process or -1 on error.
+    static qint64 processMemory();
+
+    // Charges |subsystem| with the size while the object exists.
+    class Charge
+    {
+    public:
+        explicit Charge(Subsystem subsystem, qint64 size = 0);
+        ~Charge();
+
+        void add(qint64 size);
+        void reset(qint64 size);
+
+        qint64 size() const { return size_; }
+
+    private:
+        const Subsystem subsystem_;
+        qint64 size_;
+
+        Q_DISABLE_COPY(Charge)
+    };
+
+private:
+    Q_DISABLE_COPY(MemoryCounters)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_BASE__MEMORY_COUNTERS_H
@@ -0,0 +1,31 @@
+//
+// PROJECT:         Aspia
+// FILE:            base/message_class.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_BASE__MESSAGE_CLASS_H
+#define _ASPIA_BASE__MESSAGE_CLASS_H
+
+namespace aspia {
+
+// Kind of the message. It is passed with the message by the network and IPC channels, so
+// the host and the schedulers can handle the message without parsing it. The values are sent
+// to the peer and must not be changed.
+enum MessageClass
+{
+    GenericMessage    = 0, // Authorization, configuration and other messages.
+    VideoMessage      = 1, // Video packets.
+    CursorMessage     = 2, // Cursor shapes and positions.
+    InputMessage      = 3, // Pointer and keyboard events.
+    ClipboardMessage  = 4, // Clipboard events.
+    FileMessage       = 5, // File transfer requests and replies.
+    StatisticsMessage = 6, // Statistics of the session process for the host, not relayed.
+
+    LastMessageClass = StatisticsMessage
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_BASE__MESSAGE_CLASS_H
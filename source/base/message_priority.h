@@ -0,0 +1,24 @@
+//
+// PROJECT:         Aspia
+// FILE:            base/message_priority.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_BASE__MESSAGE_PRIORITY_H
+#define _ASPIA_BASE__MESSAGE_PRIORITY_H
+
+namespace aspia {
+
+// Priority of the outgoing messages. A message is sent before the queued messages of a lower
+// priority which have not started to be sent yet.
+enum MessagePriority
+{
+    HighPriority,   // Input events and cursor shapes.
+    NormalPriority, // Video packets and other messages.
+    LowPriority     // File data.
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_BASE__MESSAGE_PRIORITY_H
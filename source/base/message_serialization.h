@@ -15,19 +15,35 @@
 
 namespace aspia {
 
-static QByteArray serializeMessage(const google::protobuf::MessageLite& message)
+// Serializes the message into |buffer| after |reserved_size| bytes. The reserved area is left
+// for a header (the message size, the authentication tag and so on) which is filled by the
+// caller, so the serialized data does not need to be copied again. The capacity of the buffer
+// is reused.
+static bool serializeMessageTo(const google::protobuf::MessageLite& message,
+                               int reserved_size,
+                               QByteArray* buffer)
 {
     size_t size = message.ByteSizeLong();
     if (!size)
     {
         qWarning("Empty messages are not allowed");
-        return QByteArray();
+        return false;
     }
 
+    buffer->resize(reserved_size + static_cast<int>(size));
+
+    message.SerializeWithCachedSizesToArray(
+        reinterpret_cast<uint8_t*>(buffer->data()) + reserved_size);
+    return true;
+}
+
+static QByteArray serializeMessage(const google::protobuf::MessageLite& message)
+{
     QByteArray buffer;
-    buffer.resize(size);
 
-    message.SerializeWithCachedSizesToArray(reinterpret_cast<uint8_t*>(buffer.data()));
+    if (!serializeMessageTo(message, 0, &buffer))
+        return QByteArray();
+
     return buffer;
 }
 
@@ -0,0 +1,59 @@
+//
+// PROJECT:         Aspia
+// FILE:            base/power_monitor.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "base/power_monitor.h"
+
+#include <QDebug>
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+namespace aspia {
+
+namespace {
+
+// The status of the power is read with this interval.
+constexpr std::chrono::seconds kSampleInterval(5);
+
+// The values of SYSTEM_POWER_STATUS.
+constexpr BYTE kACLineOffline = 0;
+constexpr BYTE kBatterySaverOn = 1;
+
+} // namespace
+
+bool PowerMonitor::update()
+{
+    const Clock::time_point now = Clock::now();
+
+    if (sampled_ && now - sample_time_ < kSampleInterval)
+        return false;
+
+    sample_time_ = now;
+    sampled_ = true;
+
+    SYSTEM_POWER_STATUS status;
+    if (!GetSystemPowerStatus(&status))
+        return false;
+
+    // The desktop computers report the unknown state of the power line.
+    const bool power_saving =
+        status.ACLineStatus == kACLineOffline || status.SystemStatusFlag == kBatterySaverOn;
+
+    if (power_saving == power_saving_)
+        return false;
+
+    power_saving_ = power_saving;
+
+    if (power_saving_)
+        qInfo("The power saving mode is enabled: on the battery or by the battery saver");
+    else
+        qInfo("The power saving mode is disabled: on the power line");
+
+    return true;
+}
+
+} // namespace aspia
@@ -0,0 +1,46 @@
+//
+// PROJECT:         Aspia
+// FILE:            base/power_monitor.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_BASE__POWER_MONITOR_H
+#define _ASPIA_BASE__POWER_MONITOR_H
+
+#include <QtGlobal>
+
+#include <chrono>
+
+namespace aspia {
+
+//
+// Tracks whether the computer should save the power: it runs on the battery or the battery
+// saver of the system is on. The sessions capture, encode and paint less often in this mode
+// and return to the normal rate when the computer is connected to the power line.
+//
+class PowerMonitor
+{
+public:
+    PowerMonitor() = default;
+    ~PowerMonitor() = default;
+
+    // Must be called periodically. Returns true if the mode is changed.
+    bool update();
+
+    bool isPowerSaving() const { return power_saving_; }
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    bool power_saving_ = false;
+
+    Clock::time_point sample_time_;
+    bool sampled_ = false;
+
+    Q_DISABLE_COPY(PowerMonitor)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_BASE__POWER_MONITOR_H
@@ -0,0 +1,54 @@
+//
+// PROJECT:         Aspia
+// FILE:            base/process_stats.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "base/process_stats.h"
+
+#include <qt_windows.h>
+
+#include <algorithm>
+
+namespace aspia {
+
+namespace {
+
+qint64 toNanoseconds(const FILETIME& time)
+{
+    ULARGE_INTEGER value;
+    value.LowPart = time.dwLowDateTime;
+    value.HighPart = time.dwHighDateTime;
+    return static_cast<qint64>(value.QuadPart) * 100;
+}
+
+} // namespace
+
+qint64 processCpuTime()
+{
+    FILETIME creation_time;
+    FILETIME exit_time;
+    FILETIME kernel_time;
+    FILETIME user_time;
+
+    if (!GetProcessTimes(GetCurrentProcess(),
+                         &creation_time, &exit_time, &kernel_time, &user_time))
+    {
+        return 0;
+    }
+
+    return toNanoseconds(kernel_time) + toNanoseconds(user_time);
+}
+
+qint64 percentile(std::vector<qint64>& values, int percent)
+{
+    if (values.empty())
+        return -1;
+
+    auto nth = values.begin() + (values.size() - 1) * percent / 100;
+    std::nth_element(values.begin(), nth, values.end());
+    return *nth;
+}
+
+} // namespace aspia
@@ -0,0 +1,27 @@
+//
+// PROJECT:         Aspia
+// FILE:            base/process_stats.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_BASE__PROCESS_STATS_H
+#define _ASPIA_BASE__PROCESS_STATS_H
+
+#include <QtGlobal>
+
+#include <vector>
+
+namespace aspia {
+
+// Returns the user and the kernel time of all threads of the process in nanoseconds or 0 on
+// error.
+qint64 processCpuTime();
+
+// Returns the value at |percent| of the sorted values or -1 if there are no values. The order
+// of |values| is changed.
+qint64 percentile(std::vector<qint64>& values, int percent);
+
+} // namespace aspia
+
+#endif // _ASPIA_BASE__PROCESS_STATS_H
@@ -0,0 +1,121 @@
+//
+// PROJECT:         Aspia
+// FILE:            base/spsc_queue.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_BASE__SPSC_QUEUE_H
+#define _ASPIA_BASE__SPSC_QUEUE_H
+
+#include <QtGlobal>
+
+#include <atomic>
+#include <vector>
+
+namespace aspia {
+
+//
+// Bounded lock-free queue of one producer and one consumer. The producers of several threads
+// are allowed if they are serialized by the caller, for example by a lock which they hold
+// anyway. The values are moved into the preallocated slots, so the queue does not allocate
+// after the construction. The producer and the consumer keep the copies of the index of each
+// other and read the shared index only when the copy says that the queue is full or empty.
+//
+template <typename T>
+class SpscQueue
+{
+public:
+    // |capacity| is rounded up to a power of two.
+    explicit SpscQueue(size_t capacity)
+        : slots_(roundCapacity(capacity)),
+          mask_(slots_.size() - 1)
+    {
+        // Nothing
+    }
+
+    // Adds |value| without making it visible to the consumer. The staged values are taken
+    // by the consumer together after commit(). Returns false if the queue is full.
+    bool stage(T&& value)
+    {
+        if (staged_tail_ - cached_head_ == slots_.size())
+        {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            if (staged_tail_ - cached_head_ == slots_.size())
+                return false;
+        }
+
+        slots_[staged_tail_ & mask_] = std::move(value);
+        ++staged_tail_;
+        return true;
+    }
+
+    void commit()
+    {
+        tail_.store(staged_tail_, std::memory_order_release);
+    }
+
+    bool tryPush(T&& value)
+    {
+        if (!stage(std::move(value)))
+            return false;
+
+        commit();
+        return true;
+    }
+
+    // Called by the consumer. Returns false if the queue is empty.
+    bool tryPop(T* value)
+    {
+        const size_t head = head_.load(std::memory_order_relaxed);
+
+        if (head == cached_tail_)
+        {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (head == cached_tail_)
+                return false;
+        }
+
+        *value = std::move(slots_[head & mask_]);
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Called by the consumer.
+    bool empty() const
+    {
+        return head_.load(std::memory_order_relaxed) == tail_.load(std::memory_order_acquire);
+    }
+
+    size_t capacity() const { return slots_.size(); }
+
+private:
+    static size_t roundCapacity(size_t capacity)
+    {
+        size_t result = 2;
+        while (result < capacity)
+            result <<= 1;
+        return result;
+    }
+
+    // The indexes of the producer and of the consumer are in the different cache lines.
+    static const size_t kCacheLineSize = 64;
+
+    std::vector<T> slots_;
+    const size_t mask_;
+
+    // Written by the consumer.
+    alignas(kCacheLineSize) std::atomic<size_t> head_ { 0 };
+    size_t cached_tail_ = 0;
+
+    // Written by the producer.
+    alignas(kCacheLineSize) std::atomic<size_t> tail_ { 0 };
+    size_t staged_tail_ = 0;
+    size_t cached_head_ = 0;
+
+    Q_DISABLE_COPY(SpscQueue)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_BASE__SPSC_QUEUE_H
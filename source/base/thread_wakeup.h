@@ -0,0 +1,76 @@
+//
+// PROJECT:         Aspia
+// FILE:            base/thread_wakeup.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_BASE__THREAD_WAKEUP_H
+#define _ASPIA_BASE__THREAD_WAKEUP_H
+
+#include <QtGlobal>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+namespace aspia {
+
+//
+// Wakes the consumer of a lock-free queue which sleeps while the queue is empty. The producer
+// takes the lock only if the consumer sleeps, so the handoffs to the busy consumer cost one
+// atomic operation.
+//
+class ThreadWakeup
+{
+public:
+    ThreadWakeup() = default;
+    ~ThreadWakeup() = default;
+
+    // Called by the consumer. Returns when |ready| returns true. |ready| is checked after the
+    // consumer is marked as sleeping, so the wake() after the change is never missed.
+    template <typename Predicate>
+    void wait(Predicate ready)
+    {
+        while (true)
+        {
+            sleeping_.store(true, std::memory_order_seq_cst);
+
+            // Either the producer sees the consumer sleeping or the consumer sees the change.
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            if (ready())
+            {
+                sleeping_.store(false, std::memory_order_relaxed);
+                return;
+            }
+
+            std::unique_lock<std::mutex> lock(lock_);
+            while (sleeping_.load(std::memory_order_seq_cst))
+                condition_.wait(lock);
+        }
+    }
+
+    // Called by the producer after the change of the state which |ready| checks.
+    void wake()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (!sleeping_.exchange(false, std::memory_order_seq_cst))
+            return;
+
+        std::scoped_lock<std::mutex> lock(lock_);
+        condition_.notify_one();
+    }
+
+private:
+    std::atomic<bool> sleeping_ { false };
+    std::mutex lock_;
+    std::condition_variable condition_;
+
+    Q_DISABLE_COPY(ThreadWakeup)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_BASE__THREAD_WAKEUP_H
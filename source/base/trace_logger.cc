@@ -0,0 +1,174 @@
+//
+// PROJECT:         Aspia
+// FILE:            base/trace_logger.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "base/trace_logger.h"
+
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QDebug>
+#include <QDir>
+#include <QThread>
+
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+namespace aspia {
+
+std::atomic_bool TraceLogger::enabled_{ false };
+QScopedPointer<QFile> TraceLogger::file_;
+
+namespace {
+
+// The spans are written by blocks, so the threads of the pipeline do not wait for the disk
+// after each span.
+constexpr size_t kMaxPendingSpans = 1024;
+
+struct Span
+{
+    const char* name;
+    qint64 begin_time;
+    qint64 end_time;
+    quint64 thread_id;
+    quint32 frame_id;
+};
+
+std::mutex spans_lock;
+std::vector<Span> pending_spans;
+
+// The first record does not have the separator.
+bool first_record = true;
+
+void writeRecord(QFile* file, const QByteArray& record)
+{
+    if (!first_record)
+        file->write(",\n");
+
+    file->write(record);
+    first_record = false;
+}
+
+} // namespace
+
+TraceLogger::TraceLogger() = default;
+
+TraceLogger::~TraceLogger()
+{
+    if (!enabled_)
+        return;
+
+    enabled_ = false;
+
+    std::scoped_lock<std::mutex> lock(spans_lock);
+
+    flush();
+
+    file_->write("\n]\n");
+    file_.reset();
+
+    qInfo("Tracing finished");
+}
+
+bool TraceLogger::startTracing(const QString& prefix)
+{
+    QDir directory(QDir::tempPath() + QLatin1String("/aspia"));
+    if (!directory.exists())
+    {
+        if (!directory.mkpath(directory.path()))
+        {
+            qWarning() << "Unable to create tracing directory: " << directory.path();
+            return false;
+        }
+    }
+
+    QString file_path = QString("%1/%2_%3.json")
+        .arg(directory.path())
+        .arg(prefix)
+        .arg(QDateTime::currentDateTime().toString(QStringLiteral("yyyy-MM-dd_hh.mm.ss.zzz")));
+
+    std::scoped_lock<std::mutex> lock(spans_lock);
+
+    file_.reset(new QFile(file_path));
+
+    if (!file_->open(QFile::WriteOnly | QFile::Truncate))
+    {
+        qWarning() << "Unable to create tracing file: " << file_->errorString();
+        file_.reset();
+        return false;
+    }
+
+    // The viewer accepts the array of events without the closing bracket, so the file of the
+    // terminated process is also loaded.
+    file_->write("[\n");
+    first_record = true;
+
+    writeRecord(file_.data(),
+                QString("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%1,"
+                        "\"args\":{\"name\":\"%2\"}}")
+                .arg(QCoreApplication::applicationPid())
+                .arg(prefix)
+                .toUtf8());
+
+    enabled_ = true;
+
+    qInfo() << "Tracing started:" << file_path;
+    return true;
+}
+
+// static
+qint64 TraceLogger::currentTime()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+// static
+void TraceLogger::addSpan(const char* name, qint64 begin_time, qint64 end_time, quint32 frame_id)
+{
+    const quint64 thread_id = reinterpret_cast<quint64>(QThread::currentThreadId());
+
+    std::scoped_lock<std::mutex> lock(spans_lock);
+
+    // Tracing may be finished after the span is started.
+    if (!file_)
+        return;
+
+    pending_spans.push_back(Span{ name, begin_time, end_time, thread_id, frame_id });
+
+    if (pending_spans.size() >= kMaxPendingSpans)
+        flush();
+}
+
+// static
+void TraceLogger::flush()
+{
+    const qint64 process_id = QCoreApplication::applicationPid();
+
+    for (const auto& span : pending_spans)
+    {
+        QByteArray record = QString("{\"name\":\"%1\",\"ph\":\"X\",\"ts\":%2,\"dur\":%3,"
+                                    "\"pid\":%4,\"tid\":%5")
+            .arg(QLatin1String(span.name))
+            .arg(span.begin_time)
+            .arg(span.end_time - span.begin_time)
+            .arg(process_id)
+            .arg(span.thread_id)
+            .toUtf8();
+
+        if (span.frame_id)
+            record += QString(",\"args\":{\"frame_id\":%1}").arg(span.frame_id).toUtf8();
+
+        record += '}';
+
+        writeRecord(file_.data(), record);
+    }
+
+    pending_spans.clear();
+    file_->flush();
+}
+
+} // namespace aspia
@@ -0,0 +1,83 @@
+//
+// PROJECT:         Aspia
+// FILE:            base/trace_logger.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_BASE__TRACE_LOGGER_H
+#define _ASPIA_BASE__TRACE_LOGGER_H
+
+#include <QFile>
+#include <QScopedPointer>
+
+#include <atomic>
+
+namespace aspia {
+
+//
+// Writes the time spans of the stages of the desktop pipeline in the JSON format of the Chrome
+// trace viewer (chrome://tracing or ui.perfetto.dev). The files of the host and the client can
+// be loaded together: the times are taken from the system clock, and the spans of the same
+// frame have the same "frame_id" argument. If tracing is not started, then each span costs one
+// load of an atomic flag.
+//
+class TraceLogger
+{
+public:
+    TraceLogger();
+    ~TraceLogger();
+
+    // Starts writing the spans into the file with |prefix| in the logging directory.
+    bool startTracing(const QString& prefix);
+
+    static bool isEnabled() { return enabled_.load(std::memory_order_relaxed); }
+
+    // Returns the current time in microseconds since the epoch.
+    static qint64 currentTime();
+
+    // Adds the span |name| of the current thread. |name| must be a string literal. If
+    // |frame_id| is not zero, then it is written as the argument of the span.
+    static void addSpan(const char* name, qint64 begin_time, qint64 end_time, quint32 frame_id);
+
+private:
+    static void flush();
+
+    static std::atomic_bool enabled_;
+    static QScopedPointer<QFile> file_;
+
+    Q_DISABLE_COPY(TraceLogger);
+};
+
+// Adds the span from the construction to the destruction of the object.
+class ScopedTrace
+{
+public:
+    explicit ScopedTrace(const char* name, quint32 frame_id = 0)
+        : name_(name),
+          frame_id_(frame_id),
+          begin_time_(TraceLogger::isEnabled() ? TraceLogger::currentTime() : -1)
+    {
+        // Nothing
+    }
+
+    ~ScopedTrace()
+    {
+        if (begin_time_ != -1)
+            TraceLogger::addSpan(name_, begin_time_, TraceLogger::currentTime(), frame_id_);
+    }
+
+    // The frame may become known inside the span.
+    void setFrameId(quint32 frame_id) { frame_id_ = frame_id; }
+
+private:
+    const char* name_;
+    quint32 frame_id_;
+    const qint64 begin_time_;
+
+    Q_DISABLE_COPY(ScopedTrace);
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_BASE__TRACE_LOGGER_H
@@ -120,6 +120,15 @@ LONG RegistryKey::open(HKEY rootkey, const wchar_t* subkey, REGSAM access)
     return result;
 }
 
+LONG RegistryKey::watchChanges(HANDLE event)
+{
+    Q_ASSERT(event);
+
+    return RegNotifyChangeKeyValue(key_, TRUE,
+                                   REG_NOTIFY_CHANGE_NAME | REG_NOTIFY_CHANGE_LAST_SET,
+                                   event, TRUE);
+}
+
 void RegistryKey::close()
 {
     if (key_)
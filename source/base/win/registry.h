@@ -75,6 +75,12 @@ public:
     // Sets a string value.
     LONG writeValue(const wchar_t* name, const wchar_t* in_value);
 
+    //
+    // Signals |event| once when the key, its values or its subkeys are changed. The watch
+    // must be started again after each change. The key needs the KEY_NOTIFY access.
+    //
+    LONG watchChanges(HANDLE event);
+
     // Closes this reg key.
     void close();
 
@@ -9,10 +9,15 @@
 
 #include <QtCore/QtPlugin>
 Q_IMPORT_PLUGIN (QWindowsIntegrationPlugin);
+
+// The style is used only by the widgets.
+#if defined(UI_IMPLEMENTATION)
 Q_IMPORT_PLUGIN (QWindowsVistaStylePlugin);
+#endif // defined(UI_IMPLEMENTATION)
 
 namespace aspia {
 
 const int kDefaultHostTcpPort = 8050;
+const int kDefaultRelayTcpPort = 8060;
 
 } // namespace aspia
@@ -27,6 +27,7 @@
 namespace aspia {
 
 extern const int kDefaultHostTcpPort;
+extern const int kDefaultRelayTcpPort;
 
 } // namespace
 
@@ -7,6 +7,8 @@
 
 #include "client/client.h"
 
+#include <QTimerEvent>
+
 #include "client/ui/authorization_dialog.h"
 #include "client/ui/status_dialog.h"
 #include "client/client_session_desktop_manage.h"
@@ -17,23 +19,27 @@
 
 namespace aspia {
 
+namespace {
+
+// The host keeps the suspended session for a minute.
+constexpr int kMaxResumeAttempts = 10;
+constexpr std::chrono::seconds kResumeInterval{ 3 };
+
+} // namespace
+
 Client::Client(const ConnectData& connect_data, QObject* parent)
     : QObject(parent),
       connect_data_(connect_data)
 {
-    // Create a network channel.
-    network_channel_ = NetworkChannel::createClient(this);
-
     // Create a status dialog. It displays all information about the progress of the connection
     // and errors.
     status_dialog_ = new StatusDialog();
 
-    connect(network_channel_, &NetworkChannel::connected, this, &Client::onChannelConnected);
-    connect(network_channel_, &NetworkChannel::errorOccurred, this, &Client::onChannelError);
-    connect(network_channel_, &NetworkChannel::disconnected, this, &Client::onChannelDisconnected);
-
     connect(status_dialog_, &StatusDialog::finished, [this](int /* result */)
     {
+        stopping_ = true;
+        stopResume();
+
         // When the status dialog is finished, we stop the connection.
         network_channel_->stop();
 
@@ -44,14 +50,25 @@ Client::Client(const ConnectData& connect_data, QObject* parent)
         emit clientTerminated(this);
     });
 
-    QString address = connect_data_.address();
-    int port = connect_data_.port();
-
     status_dialog_->show();
     status_dialog_->activateWindow();
 
-    status_dialog_->addStatus(tr("Attempt to connect to %1:%2.").arg(address).arg(port));
-    network_channel_->connectToHost(address, port);
+    connectToHost();
+}
+
+void Client::timerEvent(QTimerEvent* event)
+{
+    if (event->timerId() == resume_timer_id_)
+    {
+        killTimer(resume_timer_id_);
+        resume_timer_id_ = 0;
+
+        ++resume_attempts_;
+        connectToHost();
+        return;
+    }
+
+    QObject::timerEvent(event);
 }
 
 void Client::onChannelConnected()
@@ -64,6 +81,13 @@ void Client::onChannelConnected()
     authorizer_->setUserName(connect_data_.userName());
     authorizer_->setPassword(connect_data_.password());
 
+    if (resuming_)
+        authorizer_->setResumeTicket(resume_ticket_);
+
+    authorizer_->setChallengeNonce(network_channel_->challengeNonce());
+    authorizer_->setHostAddress(
+        connect_data_.address() + QLatin1Char(':') + QString::number(connect_data_.port()));
+
     // Connect authorizer to network.
     connect(authorizer_, &ClientUserAuthorizer::writeMessage,
             network_channel_, &NetworkChannel::writeMessage);
@@ -86,6 +110,28 @@ void Client::onChannelConnected()
     // If successful, we start the session.
     connect(authorizer_, &ClientUserAuthorizer::finished, this, &Client::onAuthorizationFinished);
 
+    // The host needs the user name to send the parameters of the password hash.
+    if (!resuming_ && (connect_data_.userName().isEmpty() || connect_data_.password().isEmpty()))
+    {
+        AuthorizationDialog dialog(status_dialog_);
+
+        dialog.setUserName(connect_data_.userName());
+        dialog.setPassword(connect_data_.password());
+
+        if (dialog.exec() == AuthorizationDialog::Rejected)
+        {
+            status_dialog_->addStatus(tr("Authorization is canceled by the user."));
+            authorizer_->cancel();
+            return;
+        }
+
+        connect_data_.setUserName(dialog.userName());
+        connect_data_.setPassword(dialog.password());
+
+        authorizer_->setUserName(connect_data_.userName());
+        authorizer_->setPassword(connect_data_.password());
+    }
+
     // Now run authorization.
     status_dialog_->addStatus(tr("Authorization started."));
     authorizer_->start();
@@ -94,15 +140,39 @@ void Client::onChannelConnected()
 void Client::onChannelDisconnected()
 {
     status_dialog_->addStatus(tr("Disconnected."));
+
+    if (resuming_)
+    {
+        if (!stopping_)
+            scheduleResume();
+        return;
+    }
+
+    if (session_.isNull())
+        return;
+
+    if (!stopping_ && !resume_ticket_.isEmpty())
+    {
+        suspendSession();
+        return;
+    }
+
+    session_->closeSession();
 }
 
 void Client::onChannelError(const QString& message)
 {
     status_dialog_->addStatus(tr("Network error: %1.").arg(message));
+
+    // The connection of the attempt to resume the session may fail before it is established.
+    if (resuming_ && !stopping_)
+        scheduleResume();
 }
 
 void Client::onAuthorizationFinished(proto::auth::Status status)
 {
+    const QByteArray resume_ticket = authorizer_->resumeTicket();
+    const QByteArray config_request = authorizer_->configRequest();
     delete authorizer_;
 
     switch (status)
@@ -112,18 +182,47 @@ void Client::onAuthorizationFinished(proto::auth::Status status)
             break;
 
         case proto::auth::STATUS_ACCESS_DENIED:
+        {
             status_dialog_->addStatus(tr("Authorization error: Access denied."));
-            return;
+
+            // The session is finished on the host.
+            if (resuming_)
+            {
+                stopResume();
+                session_->closeSession();
+            }
+        }
+        return;
 
         case proto::auth::STATUS_CANCELED:
+        {
             status_dialog_->addStatus(tr("Authorization has been canceled."));
-            return;
+
+            if (resuming_ && !stopping_)
+                scheduleResume();
+        }
+        return;
 
         default:
             status_dialog_->addStatus(tr("Authorization error: Unknown status code."));
             return;
     }
 
+    resume_ticket_ = resume_ticket;
+
+    if (resuming_)
+    {
+        stopResume();
+        connectSession();
+
+        if (read_pending_)
+            network_channel_->readMessage();
+
+        status_dialog_->addStatus(tr("Session resumed."));
+        session_->resumeSession();
+        return;
+    }
+
     switch (connect_data_.sessionType())
     {
         case proto::auth::SESSION_TYPE_DESKTOP_MANAGE:
@@ -147,12 +246,7 @@ void Client::onAuthorizationFinished(proto::auth::Status status)
             return;
     }
 
-    // Messages received from the network are sent to the session.
-    connect(session_, &ClientSession::readMessage, network_channel_, &NetworkChannel::readMessage);
-    connect(network_channel_, &NetworkChannel::messageReceived, session_, &ClientSession::messageReceived);
-    connect(session_, &ClientSession::writeMessage, network_channel_, &NetworkChannel::writeMessage);
-    connect(network_channel_, &NetworkChannel::messageWritten, session_, &ClientSession::messageWritten);
-    connect(network_channel_, &NetworkChannel::disconnected, session_, &ClientSession::closeSession);
+    connectSession();
 
     // When closing the session (closing the window), close the status dialog.
     connect(session_, &ClientSession::closedByUser, this, &Client::onSessionClosedByUser);
@@ -165,6 +259,9 @@ void Client::onAuthorizationFinished(proto::auth::Status status)
     status_dialog_->addStatus(tr("Session started."));
     status_dialog_->hide();
 
+    if (!config_request.isEmpty())
+        session_->setConfigRequest(config_request);
+
     session_->startSession();
 }
 
@@ -177,7 +274,117 @@ void Client::onSessionClosedByUser()
 void Client::onSessionError(const QString& message)
 {
     status_dialog_->addStatus(message);
+
+    stopping_ = true;
+
+    if (resuming_)
+    {
+        stopResume();
+        session_->closeSession();
+    }
+
     network_channel_->stop();
 }
 
+void Client::connectToHost()
+{
+    // The channel of the previous connection or of the failed attempt is not used anymore.
+    if (!network_channel_.isNull())
+    {
+        disconnect(network_channel_, nullptr, this, nullptr);
+        network_channel_->stop();
+        network_channel_->deleteLater();
+    }
+
+    network_channel_ = NetworkChannel::createClient(this);
+
+    // The desktop sessions receive the video by the datagrams if the host sends them.
+    const proto::auth::SessionType session_type = connect_data_.sessionType();
+    network_channel_->setDatagramsEnabled(
+        session_type == proto::auth::SESSION_TYPE_DESKTOP_MANAGE ||
+        session_type == proto::auth::SESSION_TYPE_DESKTOP_VIEW);
+
+    connect(network_channel_, &NetworkChannel::connected, this, &Client::onChannelConnected);
+    connect(network_channel_, &NetworkChannel::errorOccurred, this, &Client::onChannelError);
+    connect(network_channel_, &NetworkChannel::disconnected, this, &Client::onChannelDisconnected);
+
+    QString address = connect_data_.address();
+    int port = connect_data_.port();
+
+    status_dialog_->addStatus(tr("Attempt to connect to %1:%2.").arg(address).arg(port));
+    // The alternate addresses are raced with the main one, the first connected is used.
+    network_channel_->connectToHost(
+        QStringList(address) + connect_data_.alternateAddresses(), port);
+}
+
+void Client::connectSession()
+{
+    // Messages received from the network are sent to the session.
+    connect(session_, &ClientSession::readMessage, network_channel_, &NetworkChannel::readMessage);
+    connect(network_channel_, &NetworkChannel::messageReceived, session_, &ClientSession::messageReceived);
+    connect(session_, &ClientSession::writeMessage, network_channel_, &NetworkChannel::writeMessage);
+    connect(network_channel_, &NetworkChannel::messageWritten, session_, &ClientSession::messageWritten);
+    connect(network_channel_, &NetworkChannel::messageLost, session_, &ClientSession::messageLost);
+
+    connect(network_channel_, &NetworkChannel::writeQueueFull, session_, [this]()
+    {
+        session_->setWriteBlocked(true);
+    });
+
+    connect(network_channel_, &NetworkChannel::writeQueueDrained, session_, [this]()
+    {
+        session_->setWriteBlocked(false);
+    });
+
+    // The channel of the resumed session is new, and the previous one could be full.
+    session_->setWriteBlocked(network_channel_->isWriteQueueFull());
+}
+
+void Client::suspendSession()
+{
+    // The messages of the session are dropped until the connection is restored.
+    read_pending_ = network_channel_->isReadPending();
+
+    disconnect(session_, nullptr, network_channel_, nullptr);
+    disconnect(network_channel_, nullptr, session_, nullptr);
+
+    status_dialog_->addStatus(tr("Connection lost. Attempt to resume the session."));
+
+    resuming_ = true;
+    resume_attempts_ = 0;
+
+    scheduleResume();
+}
+
+void Client::scheduleResume()
+{
+    if (resume_timer_id_)
+        return;
+
+    if (resume_attempts_ >= kMaxResumeAttempts)
+    {
+        status_dialog_->addStatus(tr("Unable to resume the session."));
+
+        stopResume();
+        session_->closeSession();
+        return;
+    }
+
+    // The first attempt is made at once, because the connection is often lost only for
+    // a moment.
+    resume_timer_id_ = startTimer(
+        resume_attempts_ ? kResumeInterval : std::chrono::milliseconds::zero());
+}
+
+void Client::stopResume()
+{
+    if (resume_timer_id_)
+    {
+        killTimer(resume_timer_id_);
+        resume_timer_id_ = 0;
+    }
+
+    resuming_ = false;
+}
+
 } // namespace aspia
@@ -25,9 +25,16 @@ public:
     Client(const ConnectData& connect_data, QObject* parent = nullptr);
     ~Client() = default;
 
+    // The connection data with the streaming profile updated by the session.
+    const ConnectData& connectData() const { return connect_data_; }
+
 signals:
     void clientTerminated(Client* client);
 
+protected:
+    // QObject implementation.
+    void timerEvent(QTimerEvent* event) override;
+
 private slots:
     void onChannelConnected();
     void onChannelDisconnected();
@@ -37,6 +44,15 @@ private slots:
     void onSessionError(const QString& message);
 
 private:
+    void connectToHost();
+    void connectSession();
+
+    // The desktop sessions are not closed after the loss of the connection. The client connects
+    // again and resumes the session by the ticket of the previous connection.
+    void suspendSession();
+    void scheduleResume();
+    void stopResume();
+
     ConnectData connect_data_;
 
     QPointer<NetworkChannel> network_channel_;
@@ -44,6 +60,17 @@ private:
     QPointer<ClientUserAuthorizer> authorizer_;
     QPointer<ClientSession> session_;
 
+    QByteArray resume_ticket_;
+    bool resuming_ = false;
+    int resume_attempts_ = 0;
+    int resume_timer_id_ = 0;
+
+    // The session waits for a message which was not received on the lost connection.
+    bool read_pending_ = false;
+
+    // The connection is closed by the user or after an error of the session.
+    bool stopping_ = false;
+
     Q_DISABLE_COPY(Client)
 };
 
@@ -10,6 +10,9 @@
 
 #include <QObject>
 
+#include "base/message_class.h"
+#include "base/message_priority.h"
+
 namespace aspia {
 
 class ClientSession : public QObject
@@ -31,15 +34,47 @@ public slots:
     // Message with ID |message_id| sent.
     virtual void messageWritten(int message_id) = 0;
 
+    // The host sends the config request of the desktop session with the result of the
+    // authorization, so the config is sent before the session is started on the host. Called
+    // before startSession().
+    virtual void setConfigRequest(const QByteArray& /* config_request */)
+    {
+        // Nothing
+    }
+
     // Starts session.
     virtual void startSession() = 0;
 
     // Closes the session. When a slot is called, signal |sessionClosed| is not generated.
     virtual void closeSession() = 0;
 
+    // Continues the session on the new connection after the loss of the previous one. The
+    // messages which were in flight on the lost connection are not delivered.
+    virtual void resumeSession()
+    {
+        // Nothing
+    }
+
+    // The write queue of the network channel has exceeded its high watermark or has been
+    // drained. The session should not produce more messages while it is blocked.
+    virtual void setWriteBlocked(bool /* blocked */)
+    {
+        // Nothing
+    }
+
+    // The messages of |message_class| which the host has sent by the datagrams are lost.
+    // Called between the messages in place of the lost ones.
+    virtual void messageLost(MessageClass /* message_class */)
+    {
+        // Nothing
+    }
+
 signals:
     // Indicates an outgoing message.
-    void writeMessage(int message_id, const QByteArray& buffer);
+    void writeMessage(int message_id,
+                      const QByteArray& buffer,
+                      MessagePriority priority = NormalPriority,
+                      MessageClass message_class = GenericMessage);
 
     // Indicates that it is ready to receive the next incoming message.
     void readMessage();
@@ -7,7 +7,10 @@
 
 #include "client/client_session_desktop_manage.h"
 
+#include <QTimerEvent>
+
 #include "base/message_serialization.h"
+#include "base/trace_logger.h"
 #include "client/ui/desktop_window.h"
 #include "codec/cursor_decoder.h"
 
@@ -18,11 +21,33 @@ namespace {
 const quint32 kSupportedVideoEncodings =
     proto::desktop::VIDEO_ENCODING_ZLIB |
     proto::desktop::VIDEO_ENCODING_VP8 |
-    proto::desktop::VIDEO_ENCODING_VP9;
+    proto::desktop::VIDEO_ENCODING_VP9 |
+    proto::desktop::VIDEO_ENCODING_VP9_LOSSY |
+    proto::desktop::VIDEO_ENCODING_AV1 |
+    proto::desktop::VIDEO_ENCODING_H264 |
+    proto::desktop::VIDEO_ENCODING_LZ4 |
+    proto::desktop::VIDEO_ENCODING_ZSTD |
+    proto::desktop::VIDEO_ENCODING_HYBRID |
+    proto::desktop::VIDEO_ENCODING_PALETTE;
 
 const quint32 kSupportedFeatures =
     proto::desktop::FEATURE_CURSOR_SHAPE |
-    proto::desktop::FEATURE_CLIPBOARD;
+    proto::desktop::FEATURE_CLIPBOARD |
+    proto::desktop::FEATURE_REDUCED_EFFECTS;
+
+// The pointer movements are sent not more often than once per this interval. The button changes
+// and the keys are sent immediately.
+constexpr int kInputSendInterval = 8; // ms
+
+// The local cursor follows the mouse immediately. The positions of the host correct it.
+const quint32 kLocalCursorFeatures = proto::desktop::FEATURE_CURSOR_POSITION;
+
+const quint32 kClipboardFeatures =
+    proto::desktop::FEATURE_CLIPBOARD_CHUNKS |
+    proto::desktop::FEATURE_CLIPBOARD_COMPRESSION;
+
+// The input is stamped only while the statistics are shown.
+const quint32 kDiagnosticFeatures = proto::desktop::FEATURE_LATENCY_PROBE;
 
 } // namespace
 
@@ -54,29 +79,48 @@ quint32 ClientSessionDesktopManage::supportedFeatures()
 
 void ClientSessionDesktopManage::messageReceived(const QByteArray& buffer)
 {
-    proto::desktop::HostToClient message;
+    ScopedTrace trace("receive");
 
-    if (!parseMessage(buffer, message))
+    if (!readHostMessage(buffer))
     {
         emit errorOccurred(tr("Session error: Invalid message from host."));
         return;
     }
 
-    if (message.has_video_packet() || message.has_cursor_shape())
+    if (incoming_message_.has_video_packet() || incoming_message_.has_cursor_shape() ||
+        incoming_message_.has_cursor_position())
     {
-        if (message.has_video_packet())
-            readVideoPacket(message.video_packet());
+        if (incoming_message_.has_video_packet())
+        {
+            trace.setFrameId(incoming_message_.video_packet().trace_id());
+            readVideoPacket();
+        }
 
-        if (message.has_cursor_shape())
-            readCursorShape(message.cursor_shape());
+        if (incoming_message_.has_cursor_shape())
+            readCursorShape(incoming_message_.cursor_shape());
+
+        if (incoming_message_.has_cursor_position())
+            readCursorPosition(incoming_message_.cursor_position());
+    }
+    else if (incoming_message_.has_clipboard_event())
+    {
+        readClipboardEvent(incoming_message_.clipboard_event());
+    }
+    else if (incoming_message_.has_config_request())
+    {
+        readConfigRequest(incoming_message_.config_request());
+    }
+    else if (incoming_message_.has_screen_list())
+    {
+        readScreenList(incoming_message_.screen_list());
     }
-    else if (message.has_clipboard_event())
+    else if (incoming_message_.has_ping())
     {
-        readClipboardEvent(message.clipboard_event());
+        readPing(incoming_message_.ping());
     }
-    else if (message.has_config_request())
+    else if (incoming_message_.has_latency_probe())
     {
-        readConfigRequest(message.config_request());
+        readLatencyProbe(incoming_message_.latency_probe());
     }
     else
     {
@@ -94,35 +138,94 @@ void ClientSessionDesktopManage::messageWritten(int /* message_id */)
 
 void ClientSessionDesktopManage::onSendConfig(const proto::desktop::Config& config)
 {
-    if (!(config.features() & proto::desktop::FEATURE_CURSOR_SHAPE))
-        cursor_decoder_.reset();
-
     proto::desktop::ClientToHost message;
     message.mutable_config()->CopyFrom(config);
+    message.mutable_config()->set_features(
+        config.features() | protocolFeatures() | kLocalCursorFeatures | kClipboardFeatures |
+        kDiagnosticFeatures);
+    setupCursorDecoder(message.mutable_config());
+    setupTileCache(message.mutable_config());
+    setupViewport(message.mutable_config());
     emit writeMessage(-1, serializeMessage(message));
+
+    if (!isWindowVisible())
+        sendVisibility();
+
+    if (!isWholeFrameVisible())
+        sendVisibleArea();
 }
 
 void ClientSessionDesktopManage::onSendKeyEvent(quint32 usb_keycode, quint32 flags)
 {
+    if (input_events_enabled_)
+    {
+        proto::desktop::KeyEvent* event =
+            input_message_.mutable_input_events()->add_event()->mutable_key_event();
+        event->set_usb_keycode(usb_keycode);
+        event->set_flags(flags);
+
+        sendInputEvents();
+        return;
+    }
+
     proto::desktop::ClientToHost message;
 
     proto::desktop::KeyEvent* event = message.mutable_key_event();
     event->set_usb_keycode(usb_keycode);
     event->set_flags(flags);
+    event->set_probe_time(takeLatencyProbe());
 
-    emit writeMessage(-1, serializeMessage(message));
+    emit writeMessage(-1, serializeMessage(message), HighPriority, InputMessage);
 }
 
 void ClientSessionDesktopManage::onSendPointerEvent(const QPoint& pos, quint32 mask)
 {
+    if (input_events_enabled_)
+    {
+        auto* events = input_message_.mutable_input_events()->mutable_event();
+
+        // A movement replaces the previous one if the buttons have not changed between them.
+        if (!events->empty() && events->rbegin()->has_pointer_event() &&
+            events->rbegin()->pointer_event().mask() == mask)
+        {
+            proto::desktop::PointerEvent* event = events->rbegin()->mutable_pointer_event();
+            event->set_x(pos.x());
+            event->set_y(pos.y());
+        }
+        else
+        {
+            const bool buttons_changed = mask != prev_pointer_mask_;
+
+            proto::desktop::PointerEvent* event = events->Add()->mutable_pointer_event();
+            event->set_x(pos.x());
+            event->set_y(pos.y());
+            event->set_mask(mask);
+
+            prev_pointer_mask_ = mask;
+
+            if (buttons_changed)
+            {
+                sendInputEvents();
+                return;
+            }
+        }
+
+        // The first movement after a pause is sent immediately, the following ones with the
+        // next tick.
+        if (!input_timer_id_)
+            sendInputEvents();
+        return;
+    }
+
     proto::desktop::ClientToHost message;
 
     proto::desktop::PointerEvent* event = message.mutable_pointer_event();
     event->set_x(pos.x());
     event->set_y(pos.y());
     event->set_mask(mask);
+    event->set_probe_time(takeLatencyProbe());
 
-    emit writeMessage(-1, serializeMessage(message));
+    emit writeMessage(-1, serializeMessage(message), HighPriority, InputMessage);
 }
 
 void ClientSessionDesktopManage::onSendClipboardEvent(const proto::desktop::ClipboardEvent& event)
@@ -134,37 +237,67 @@ void ClientSessionDesktopManage::onSendClipboardEvent(const proto::desktop::Clip
     proto::desktop::ClientToHost message;
     message.mutable_clipboard_event()->CopyFrom(event);
 
-    emit writeMessage(-1, serializeMessage(message));
+    // The clipboard data is sent after the input.
+    emit writeMessage(-1, serializeMessage(message),
+                      event.data().empty() ? NormalPriority : LowPriority,
+                      ClipboardMessage);
 }
 
-void ClientSessionDesktopManage::readConfigRequest(
-    const proto::desktop::ConfigRequest& config_request)
+void ClientSessionDesktopManage::timerEvent(QTimerEvent* event)
 {
-    proto::desktop::Config config = connect_data_->desktopConfig();
+    if (event->timerId() != input_timer_id_)
+    {
+        ClientSessionDesktopView::timerEvent(event);
+        return;
+    }
 
-    desktop_window_->setSupportedVideoEncodings(config_request.video_encodings());
-    desktop_window_->setSupportedFeatures(config_request.features());
+    // The timer is stopped after a tick without the input.
+    if (!input_message_.has_input_events() || input_message_.input_events().event_size() == 0)
+    {
+        killTimer(input_timer_id_);
+        input_timer_id_ = 0;
+        return;
+    }
 
-    // If current video encoding not supported.
-    if (!(config_request.video_encodings() & config.video_encoding()))
+    sendInputEvents();
+}
+
+void ClientSessionDesktopManage::sendInputEvents()
+{
+    // The last event of the message is the latest input which the frames can show.
+    auto* events = input_message_.mutable_input_events()->mutable_event();
+    if (!events->empty())
     {
-        if (!(config_request.video_encodings() & kSupportedVideoEncodings))
-        {
-            emit errorOccurred(tr("Session error: There are no supported video encodings."));
-            return;
-        }
+        proto::desktop::InputEvent* event = events->Mutable(events->size() - 1);
+        const qint64 probe_time = takeLatencyProbe();
+
+        if (event->has_pointer_event())
+            event->mutable_pointer_event()->set_probe_time(probe_time);
         else
-        {
-            if (!desktop_window_->requireConfigChange(&config))
-            {
-                emit errorOccurred(tr("Session error: Canceled by the user."));
-                return;
-            }
-        }
+            event->mutable_key_event()->set_probe_time(probe_time);
     }
 
-    connect_data_->setDesktopConfig(config);
-    onSendConfig(config);
+    emit writeMessage(-1, serializeMessage(input_message_), HighPriority, InputMessage);
+    input_message_.mutable_input_events()->clear_event();
+
+    if (!input_timer_id_)
+        input_timer_id_ = startTimer(kInputSendInterval, Qt::PreciseTimer);
+}
+
+void ClientSessionDesktopManage::readCursorPosition(
+    const proto::desktop::CursorPosition& cursor_position)
+{
+    desktop_window_->setHostCursorPosition(QPoint(cursor_position.x(), cursor_position.y()));
+}
+
+void ClientSessionDesktopManage::readConfigRequest(
+    const proto::desktop::ConfigRequest& config_request)
+{
+    // The older hosts receive one event per message.
+    input_events_enabled_ =
+        (config_request.features() & proto::desktop::FEATURE_INPUT_EVENTS) != 0;
+
+    ClientSessionDesktopView::readConfigRequest(config_request);
 }
 
 void ClientSessionDesktopManage::readCursorShape(const proto::desktop::CursorShape& cursor_shape)
@@ -12,8 +12,6 @@
 
 namespace aspia {
 
-class CursorDecoder;
-
 class ClientSessionDesktopManage : public ClientSessionDesktopView
 {
     Q_OBJECT
@@ -36,12 +34,25 @@ public slots:
     void onSendPointerEvent(const QPoint& pos, quint32 mask);
     void onSendClipboardEvent(const proto::desktop::ClipboardEvent& event);
 
+protected:
+    // QObject implementation.
+    void timerEvent(QTimerEvent* event) override;
+
+    // ClientSessionDesktopView implementation.
+    void readConfigRequest(const proto::desktop::ConfigRequest& config_request) override;
+    void readCursorShape(const proto::desktop::CursorShape& cursor_shape) override;
+    void readCursorPosition(const proto::desktop::CursorPosition& cursor_position) override;
+
 private:
-    void readConfigRequest(const proto::desktop::ConfigRequest& config_request);
-    void readCursorShape(const proto::desktop::CursorShape& cursor_shape);
     void readClipboardEvent(const proto::desktop::ClipboardEvent& clipboard_event);
-
-    std::unique_ptr<CursorDecoder> cursor_decoder_;
+    void sendInputEvents();
+
+    // The input events which have not been sent yet. The pointer movements are coalesced
+    // until the next tick of the timer.
+    bool input_events_enabled_ = false;
+    proto::desktop::ClientToHost input_message_;
+    quint32 prev_pointer_mask_ = 0;
+    int input_timer_id_ = 0;
 
     Q_DISABLE_COPY(ClientSessionDesktopManage)
 };
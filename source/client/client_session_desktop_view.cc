@@ -7,8 +7,25 @@
 
 #include "client/client_session_desktop_view.h"
 
+#include <QDateTime>
+#include <QGuiApplication>
+#include <QScreen>
+#include <QTimerEvent>
+#include <QWindow>
+
+#include <map>
+#include <vector>
+
+#include <google/protobuf/io/coded_stream.h>
+
 #include "base/message_serialization.h"
+#include "base/process_stats.h"
+#include "base/trace_logger.h"
 #include "client/ui/desktop_window.h"
+#include "client/video_decode_thread.h"
+#include "codec/cursor_decoder.h"
+#include "codec/video_util.h"
+#include "desktop_capture/frame_hashes.h"
 
 namespace aspia {
 
@@ -19,10 +36,65 @@ enum MessageId { ConfigMessageId };
 const quint32 kSupportedVideoEncodings =
     proto::desktop::VIDEO_ENCODING_ZLIB |
     proto::desktop::VIDEO_ENCODING_VP8 |
-    proto::desktop::VIDEO_ENCODING_VP9;
+    proto::desktop::VIDEO_ENCODING_VP9 |
+    proto::desktop::VIDEO_ENCODING_VP9_LOSSY |
+    proto::desktop::VIDEO_ENCODING_AV1 |
+    proto::desktop::VIDEO_ENCODING_H264 |
+    proto::desktop::VIDEO_ENCODING_LZ4 |
+    proto::desktop::VIDEO_ENCODING_ZSTD |
+    proto::desktop::VIDEO_ENCODING_HYBRID |
+    proto::desktop::VIDEO_ENCODING_PALETTE;
 
 const quint32 kSupportedFeatures = 0;
 
+// Used if the refresh rate of the display is unknown.
+constexpr qreal kDefaultRefreshRate = 60.0;
+
+// The highest rate of the presentation in the power saving mode.
+constexpr qreal kPowerSavingRefreshRate = 30.0;
+
+// The tiles of the palette encoding cached by the decoder (16 KB each).
+constexpr quint32 kTileCacheSize = 512;
+
+// The input is probed not more often than once per the interval. The probe which is not
+// answered in the timeout (the input does not change the screen) is abandoned.
+constexpr qint64 kLatencyProbeInterval = 250 * 1000; // us
+constexpr qint64 kLatencyProbeTimeout = 2000 * 1000; // us
+
+// The statistics show the latency of the last samples.
+constexpr size_t kMaxLatencySamples = 100;
+
+const quint32 kProtocolFeatures =
+    proto::desktop::FEATURE_COPY_RECT |
+    proto::desktop::FEATURE_VIDEO_ACK |
+    proto::desktop::FEATURE_ZLIB_CHUNKS |
+    proto::desktop::FEATURE_ZLIB_STREAM |
+    proto::desktop::FEATURE_SCREEN_LIST |
+    proto::desktop::FEATURE_CURSOR_CACHE |
+    proto::desktop::FEATURE_VISIBILITY |
+    proto::desktop::FEATURE_PACKED_RECTS |
+    proto::desktop::FEATURE_RESYNC |
+    proto::desktop::FEATURE_VISIBLE_AREA;
+
+// The local cursor of the view session does not control the remote one, so the remote cursor
+// is drawn by the client at the position reported by the host.
+const quint32 kRemoteCursorFeatures =
+    proto::desktop::FEATURE_CURSOR_SHAPE |
+    proto::desktop::FEATURE_CURSOR_POSITION;
+
+// The cursor caches are kept while the client is running, so the cursors are not sent again
+// after a reconnect to the same host. The sessions live in the UI thread.
+std::map<QString, std::unique_ptr<MouseCursorCache>>& cursorCacheStore()
+{
+    static std::map<QString, std::unique_ptr<MouseCursorCache>> store;
+    return store;
+}
+
+QString hostKey(const ConnectData* connect_data)
+{
+    return connect_data->address() + QLatin1Char(':') + QString::number(connect_data->port());
+}
+
 } // namespace
 
 ClientSessionDesktopView::ClientSessionDesktopView(
@@ -30,11 +102,24 @@ ClientSessionDesktopView::ClientSessionDesktopView(
     : ClientSession(parent),
       connect_data_(connect_data)
 {
+    decode_thread_ = std::make_unique<VideoDecodeThread>(this);
     desktop_window_ = new DesktopWindow(connect_data_);
 
+    // The conversion to RGB is done by the GPU if it is available.
+    decode_thread_->setYuvOutput(desktop_window_->isYuvRenderingSupported());
+
     connect(desktop_window_, &DesktopWindow::sendConfig,
             this, &ClientSessionDesktopView::onSendConfig);
 
+    connect(desktop_window_, &DesktopWindow::selectScreen,
+            this, &ClientSessionDesktopView::onSelectScreen);
+
+    connect(desktop_window_, &DesktopWindow::visibilityChanged,
+            this, &ClientSessionDesktopView::onVisibilityChanged);
+
+    connect(desktop_window_, &DesktopWindow::visibleAreaChanged,
+            this, &ClientSessionDesktopView::onVisibleAreaChanged);
+
     // When the window is closed, we close the session.
     connect(desktop_window_, &DesktopWindow::windowClose,
             this, &ClientSessionDesktopView::closedByUser);
@@ -42,6 +127,7 @@ ClientSessionDesktopView::ClientSessionDesktopView(
 
 ClientSessionDesktopView::~ClientSessionDesktopView()
 {
+    saveCursorCache();
     delete desktop_window_;
 }
 
@@ -59,21 +145,38 @@ quint32 ClientSessionDesktopView::supportedFeatures()
 
 void ClientSessionDesktopView::messageReceived(const QByteArray& buffer)
 {
-    proto::desktop::HostToClient message;
+    ScopedTrace trace("receive");
 
-    if (!parseMessage(buffer, message))
+    if (!readHostMessage(buffer))
     {
         emit errorOccurred(tr("Session error: Invalid message from host."));
         return;
     }
 
-    if (message.has_video_packet())
+    if (incoming_message_.has_video_packet())
+    {
+        trace.setFrameId(incoming_message_.video_packet().trace_id());
+        readVideoPacket();
+    }
+    else if (incoming_message_.has_cursor_shape() || incoming_message_.has_cursor_position())
+    {
+        if (incoming_message_.has_cursor_shape())
+            readCursorShape(incoming_message_.cursor_shape());
+
+        if (incoming_message_.has_cursor_position())
+            readCursorPosition(incoming_message_.cursor_position());
+    }
+    else if (incoming_message_.has_config_request())
+    {
+        readConfigRequest(incoming_message_.config_request());
+    }
+    else if (incoming_message_.has_screen_list())
     {
-        readVideoPacket(message.video_packet());
+        readScreenList(incoming_message_.screen_list());
     }
-    else if (message.has_config_request())
+    else if (incoming_message_.has_ping())
     {
-        readConfigRequest(message.config_request());
+        readPing(incoming_message_.ping());
     }
     else
     {
@@ -89,11 +192,41 @@ void ClientSessionDesktopView::messageWritten(int /* message_id */)
     // Nothing
 }
 
+void ClientSessionDesktopView::setConfigRequest(const QByteArray& config_request)
+{
+    std::unique_ptr<proto::desktop::ConfigRequest> message =
+        std::make_unique<proto::desktop::ConfigRequest>();
+
+    if (!parseMessage(config_request, *message))
+        return;
+
+    // The encodings which depend on the hardware of the host are offered only by the session,
+    // so the config with them waits for its request.
+    if (!(message->video_encodings() & connect_data_->desktopConfig().video_encoding()))
+        return;
+
+    early_config_request_ = std::move(message);
+}
+
 void ClientSessionDesktopView::startSession()
 {
     desktop_window_->show();
     desktop_window_->activateWindow();
 
+    statistics_clock_.start();
+    ping_clock_.start();
+    statistics_timer_id_ = startTimer(std::chrono::seconds(1));
+
+    // The host reads the config when the session is started and sends the first frame without
+    // waiting for the round trip of its own request.
+    if (early_config_request_)
+    {
+        readConfigRequest(*early_config_request_);
+        early_config_request_.reset();
+
+        early_config_ = connect_data_->desktopConfig().SerializeAsString();
+    }
+
     emit readMessage();
 }
 
@@ -106,54 +239,660 @@ void ClientSessionDesktopView::closeSession()
     desktop_window_->close();
 }
 
+void ClientSessionDesktopView::resumeSession()
+{
+    // The host starts the stream again with the screen list and the empty cursor cache when it
+    // receives the config. The frame is kept, so the first frame may contain only the tiles
+    // which differ from it.
+    proto::desktop::Config config = connect_data_->desktopConfig();
+    setupFrameHashes(&config);
+    onSendConfig(config);
+}
+
+void ClientSessionDesktopView::messageLost(MessageClass message_class)
+{
+    if (message_class != VideoMessage)
+        return;
+
+    // The refresh is requested again if its packets are lost too.
+    video_lost_ = true;
+
+    proto::desktop::ClientToHost message;
+    message.mutable_refresh_request()->set_frames_lost(true);
+    emit writeMessage(-1, serializeMessage(message));
+}
+
+void ClientSessionDesktopView::customEvent(QEvent* event)
+{
+    switch (event->type())
+    {
+        case VideoDecodeThread::DecodeEvent::kType:
+        {
+            VideoDecodeThread::DecodeEvent* decode_event =
+                reinterpret_cast<VideoDecodeThread::DecodeEvent*>(event);
+
+            decode_time_ += decode_event->decode_time * 1000;
+            ++decoded_packets_;
+
+            if (decode_event->frame_ready)
+            {
+                ++decoded_frames_;
+                schedulePresent();
+            }
+
+            if (decode_event->refresh_required)
+            {
+                proto::desktop::ClientToHost message;
+                message.mutable_refresh_request();
+                emit writeMessage(-1, serializeMessage(message));
+            }
+
+            sendVideoAck(decode_event->frame_id, decode_event->decode_time);
+        }
+        break;
+
+        case VideoDecodeThread::PresentEvent::kType:
+            presentFrame();
+            break;
+
+        case VideoDecodeThread::ErrorEvent::kType:
+        {
+            switch (reinterpret_cast<VideoDecodeThread::ErrorEvent*>(event)->error)
+            {
+                case VideoDecodeThread::Error::UNSUPPORTED_ENCODING:
+                    emit errorOccurred(tr("Session error: Video decoder not initialized."));
+                    break;
+
+                case VideoDecodeThread::Error::WRONG_FRAME_SIZE:
+                    emit errorOccurred(tr("Session error: Wrong video frame size."));
+                    break;
+
+                case VideoDecodeThread::Error::FRAME_NOT_INITIALIZED:
+                    emit errorOccurred(
+                        tr("Session error: The desktop frame is not initialized."));
+                    break;
+
+                case VideoDecodeThread::Error::WRONG_COPY_RECT:
+                    emit errorOccurred(tr("Session error: Wrong copy rectangle."));
+                    break;
+
+                case VideoDecodeThread::Error::DECODE_FAILED:
+                    emit errorOccurred(
+                        tr("Session error: The video packet could not be decoded."));
+                    break;
+            }
+        }
+        break;
+
+        default:
+            ClientSession::customEvent(event);
+            break;
+    }
+}
+
+void ClientSessionDesktopView::timerEvent(QTimerEvent* event)
+{
+    if (event->timerId() == present_timer_id_)
+    {
+        killTimer(present_timer_id_);
+        present_timer_id_ = 0;
+
+        presentFrame();
+        return;
+    }
+
+    if (event->timerId() == statistics_timer_id_)
+    {
+        updateStatistics();
+        return;
+    }
+
+    ClientSession::timerEvent(event);
+}
+
+// static
+quint32 ClientSessionDesktopView::protocolFeatures()
+{
+    return kProtocolFeatures;
+}
+
 void ClientSessionDesktopView::onSendConfig(const proto::desktop::Config& config)
 {
     proto::desktop::ClientToHost message;
     message.mutable_config()->CopyFrom(config);
+    message.mutable_config()->set_features(
+        config.features() | kProtocolFeatures | kRemoteCursorFeatures);
+    setupCursorDecoder(message.mutable_config());
+    setupTileCache(message.mutable_config());
+    setupViewport(message.mutable_config());
     emit writeMessage(ConfigMessageId, serializeMessage(message));
+
+    // The host starts with the bandwidth of the previous session only once.
+    if (config.initial_bandwidth())
+    {
+        proto::desktop::Config stored_config = connect_data_->desktopConfig();
+        stored_config.clear_initial_bandwidth();
+        connect_data_->setDesktopConfig(stored_config);
+    }
+
+    if (!window_visible_)
+        sendVisibility();
+
+    if (!visible_area_.isEmpty())
+        sendVisibleArea();
+}
+
+void ClientSessionDesktopView::onSelectScreen(qint64 screen_id)
+{
+    proto::desktop::ClientToHost message;
+    message.mutable_screen()->set_id(screen_id);
+    emit writeMessage(-1, serializeMessage(message));
+}
+
+void ClientSessionDesktopView::onVisibilityChanged(bool visible)
+{
+    window_visible_ = visible;
+    sendVisibility();
 }
 
-void ClientSessionDesktopView::readVideoPacket(const proto::desktop::VideoPacket& packet)
+void ClientSessionDesktopView::sendVisibility()
 {
-    if (video_encoding_ != packet.encoding())
+    // The previous versions of the host do not pause the capture.
+    if (!(host_features_ & proto::desktop::FEATURE_VISIBILITY))
+        return;
+
+    proto::desktop::ClientToHost message;
+    message.mutable_visibility()->set_hidden(!window_visible_);
+    emit writeMessage(-1, serializeMessage(message));
+}
+
+void ClientSessionDesktopView::onVisibleAreaChanged(const QRect& area)
+{
+    visible_area_ = area;
+    sendVisibleArea();
+}
+
+void ClientSessionDesktopView::sendVisibleArea()
+{
+    // The previous versions of the host encode the whole frame.
+    if (!(host_features_ & proto::desktop::FEATURE_VISIBLE_AREA))
+        return;
+
+    proto::desktop::ClientToHost message;
+    VideoUtil::toVideoRect(visible_area_, message.mutable_visible_area()->mutable_rect());
+    emit writeMessage(-1, serializeMessage(message));
+}
+
+bool ClientSessionDesktopView::readHostMessage(const QByteArray& buffer)
+{
+    // HostToClient::Clear() deletes the video packet, so the packet is detached before and
+    // the new message is merged into it.
+    if (incoming_message_.has_video_packet())
+        free_packet_.reset(incoming_message_.release_video_packet());
+
+    incoming_message_.Clear();
+
+    if (!free_packet_)
+        free_packet_ = decode_thread_->takeFreePacket();
+
+    if (free_packet_)
+    {
+        free_packet_->Clear();
+        incoming_message_.set_allocated_video_packet(free_packet_.release());
+    }
+
+    google::protobuf::io::CodedInputStream stream(
+        reinterpret_cast<const quint8*>(buffer.constData()), buffer.size());
+
+    if (!incoming_message_.MergeFromCodedStream(&stream) || !stream.ConsumedEntireMessage())
     {
-        video_decoder_ = VideoDecoder::create(packet.encoding());
-        video_encoding_ = packet.encoding();
+        qWarning("Received message that is not a valid protocol buffer");
+        return false;
     }
 
-    if (!video_decoder_)
+    // The video packets always have the encoding. If the packet is empty, then the message
+    // does not contain it.
+    if (incoming_message_.has_video_packet() &&
+        incoming_message_.video_packet().encoding() == proto::desktop::VIDEO_ENCODING_UNKNOWN)
     {
-        emit errorOccurred(tr("Session error: Video decoder not initialized."));
-        return;
+        free_packet_.reset(incoming_message_.release_video_packet());
     }
 
-    if (packet.has_format())
+    received_bytes_ += buffer.size();
+
+    if (incoming_message_.has_video_packet())
+    {
+        const proto::desktop::VideoPacket& packet = incoming_message_.video_packet();
+
+        encode_time_ += packet.encode_time();
+
+        if (packet.psnr() > 0)
+        {
+            psnr_ = packet.psnr();
+            ssim_ = packet.ssim();
+        }
+
+        // The hybrid packets are measured by the lossy layer.
+        for (const auto& layer : packet.layer())
+        {
+            if (layer.psnr() > 0)
+            {
+                psnr_ = layer.psnr();
+                ssim_ = layer.ssim();
+            }
+        }
+    }
+
+    return true;
+}
+
+void ClientSessionDesktopView::readVideoPacket()
+{
+    ++received_packets_;
+
+    if (video_lost_)
     {
-        const proto::desktop::Size& size = packet.format().screen_size();
+        const proto::desktop::VideoPacket& packet = incoming_message_.video_packet();
 
-        if (size.width() <= 0 || size.height() <= 0)
+        // The packets which refer to the lost ones are not decoded. The first packet of the
+        // refresh contains the format. The dropped packets are still acknowledged, because the
+        // host waits for them.
+        if (!packet.has_format())
         {
-            emit errorOccurred(tr("Session error: Wrong video frame size."));
+            sendVideoAck(packet.frame_id(), 0);
             return;
         }
 
-        desktop_window_->resizeDesktopFrame(QSize(size.width(), size.height()));
+        video_lost_ = false;
+    }
+
+    // The packet is returned by the decode thread after the decoding.
+    decode_thread_->decodePacket(
+        std::unique_ptr<proto::desktop::VideoPacket>(incoming_message_.release_video_packet()));
+}
+
+void ClientSessionDesktopView::schedulePresent()
+{
+    if (present_timer_id_)
+        return;
+
+    // The frames are painted at most once per refresh of the display. The packets decoded
+    // in the meantime are coalesced into the next frame.
+    QScreen* screen = QGuiApplication::primaryScreen();
+
+    QWindow* window = desktop_window_->windowHandle();
+    if (window && window->screen())
+        screen = window->screen();
+
+    qreal refresh_rate = screen ? screen->refreshRate() : 0;
+    if (refresh_rate < 1)
+        refresh_rate = kDefaultRefreshRate;
+
+    if (power_monitor_.isPowerSaving())
+        refresh_rate = qMin(refresh_rate, kPowerSavingRefreshRate);
+
+    const qint64 interval = qRound64(1000.0 / refresh_rate);
+
+    if (!present_clock_.isValid() || present_clock_.elapsed() >= interval)
+    {
+        presentFrame();
+    }
+    else
+    {
+        present_timer_id_ = startTimer(static_cast<int>(interval - present_clock_.elapsed()),
+                                       Qt::PreciseTimer);
+    }
+}
+
+void ClientSessionDesktopView::presentFrame()
+{
+    QRegion dirty_region;
+
+    // If the decoder is busy, then the frame is presented by the PresentEvent.
+    if (!decode_thread_->presentFrame(&dirty_region))
+        return;
+
+    present_clock_.start();
+    ++presented_frames_;
+
+    if (const DesktopFrameYUV* yuv_frame = decode_thread_->yuvFrame())
+        desktop_window_->drawDesktopFrame(yuv_frame, dirty_region);
+    else
+        desktop_window_->drawDesktopFrame(decode_thread_->frame(), dirty_region);
+
+    if (probe_packet_ && decoded_packets_ >= probe_packet_)
+        addLatencySample();
+}
+
+void ClientSessionDesktopView::sendVideoAck(quint32 frame_id, qint64 decode_time)
+{
+    // The host waits for the acknowledgement before sending new packets.
+    if (!frame_id)
+        return;
+
+    proto::desktop::ClientToHost message;
+
+    proto::desktop::VideoAck* video_ack = message.mutable_video_ack();
+    video_ack->set_frame_id(frame_id);
+    video_ack->set_decode_time(static_cast<quint32>(decode_time));
+
+    emit writeMessage(-1, serializeMessage(message));
+}
+
+void ClientSessionDesktopView::readPing(const proto::desktop::Ping& ping)
+{
+    round_trip_time_ = ping_clock_.elapsed() - ping.time();
+    ping_time_ = -1;
+}
+
+qint64 ClientSessionDesktopView::takeLatencyProbe()
+{
+    if (!(host_features_ & proto::desktop::FEATURE_LATENCY_PROBE) ||
+        !desktop_window_->isStatisticsEnabled())
+    {
+        return 0;
+    }
+
+    const qint64 current_time = currentTime();
+
+    if (probe_time_)
+    {
+        if (current_time - probe_time_ < kLatencyProbeTimeout)
+            return 0;
+
+        probe_time_ = 0;
+        probe_packet_ = 0;
+    }
+
+    if (last_probe_time_ && current_time - last_probe_time_ < kLatencyProbeInterval)
+        return 0;
+
+    probe_time_ = current_time;
+    last_probe_time_ = current_time;
+    return current_time;
+}
+
+void ClientSessionDesktopView::readLatencyProbe(const proto::desktop::LatencyProbe& latency_probe)
+{
+    // The answer of the abandoned probe is ignored.
+    if (!probe_time_ || latency_probe.time() != probe_time_)
+        return;
+
+    probe_host_delay_ = latency_probe.host_delay();
+    probe_receive_time_ = currentTime();
+    probe_packet_ = received_packets_;
+}
+
+qint64 ClientSessionDesktopView::currentTime() const
+{
+    // The zero time is not a probe.
+    return qMax(ping_clock_.nsecsElapsed() / 1000, qint64(1));
+}
+
+void ClientSessionDesktopView::addLatencySample()
+{
+    const qint64 current_time = currentTime();
+
+    LatencySample sample;
+    sample.total = current_time - probe_time_;
+    sample.host = probe_host_delay_;
+    sample.client = current_time - probe_receive_time_;
+    sample.network = qMax(sample.total - sample.host - sample.client, qint64(0));
+
+    latency_samples_.push_back(sample);
+    if (latency_samples_.size() > kMaxLatencySamples)
+        latency_samples_.pop_front();
+
+    probe_time_ = 0;
+    probe_packet_ = 0;
+}
+
+void ClientSessionDesktopView::updateStatistics()
+{
+    power_monitor_.update();
+
+    const qint64 elapsed = qMax(statistics_clock_.restart(), qint64(1));
+
+    EncodingSelector::Measurement measurement;
+
+    measurement.bitrate = received_bytes_ * 8 / elapsed;
+    measurement.round_trip_time = round_trip_time_;
+    measurement.frames = decoded_frames_;
+
+    // The ping which is not returned yet shows the growth of the queues earlier. The hosts of
+    // the previous versions never return it.
+    if (ping_time_ != -1 && round_trip_time_ != -1)
+    {
+        measurement.round_trip_time =
+            qMax(measurement.round_trip_time, ping_clock_.elapsed() - ping_time_);
+    }
+
+    if (decoded_frames_)
+    {
+        measurement.encode_time = encode_time_ / decoded_frames_;
+        measurement.decode_time = decode_time_ / decoded_frames_;
+    }
+
+    const bool statistics_enabled = desktop_window_->isStatisticsEnabled();
+
+    if (statistics_enabled)
+    {
+        StatisticsOverlay::Statistics statistics;
+
+        statistics.frame_rate = static_cast<int>(presented_frames_ * 1000 / elapsed);
+        statistics.dropped_frames = qMax(decoded_frames_ - presented_frames_, 0);
+        statistics.bitrate = measurement.bitrate;
+        statistics.round_trip_time = round_trip_time_;
+        statistics.paint_time = desktop_window_->paintTime();
+        statistics.encode_time = measurement.encode_time;
+        statistics.decode_time = measurement.decode_time;
+        statistics.psnr = psnr_;
+        statistics.ssim = ssim_;
+
+        if (!latency_samples_.empty())
+        {
+            std::vector<qint64> total, host, network, client;
+
+            for (const auto& sample : latency_samples_)
+            {
+                total.push_back(sample.total);
+                host.push_back(sample.host);
+                network.push_back(sample.network);
+                client.push_back(sample.client);
+            }
+
+            statistics.input_latency = percentile(total, 50);
+            statistics.input_latency_p95 = percentile(total, 95);
+            statistics.host_latency = percentile(host, 50);
+            statistics.network_latency = percentile(network, 50);
+            statistics.client_latency = percentile(client, 50);
+        }
+
+        desktop_window_->setStatistics(statistics);
+    }
+
+    // The hosts of the previous versions do not return the ping.
+    if (statistics_enabled || connect_data_->desktopConfig().auto_encoding())
+    {
+        proto::desktop::ClientToHost message;
+        message.mutable_ping()->set_time(ping_clock_.elapsed());
+        emit writeMessage(-1, serializeMessage(message));
+
+        if (ping_time_ == -1)
+            ping_time_ = message.ping().time();
+    }
+
+    received_bytes_ = 0;
+    decoded_frames_ = 0;
+    presented_frames_ = 0;
+    encode_time_ = 0;
+    decode_time_ = 0;
+
+    selectEncoding(measurement);
+}
+
+void ClientSessionDesktopView::selectEncoding(const EncodingSelector::Measurement& measurement)
+{
+    proto::desktop::Config config = connect_data_->desktopConfig();
+
+    if (!config.auto_encoding() || !host_video_encodings_)
+    {
+        encoding_selector_.reset();
+        return;
+    }
+
+    if (!encoding_selector_)
+    {
+        encoding_selector_ = std::make_unique<EncodingSelector>(
+            host_video_encodings_ & kSupportedVideoEncodings);
+
+        const int upgrade_samples = connect_data_->streamingProfile().upgrade_samples();
+        if (upgrade_samples)
+            encoding_selector_->setUpgradeSamples(upgrade_samples);
     }
 
-    DesktopFrame* frame = desktop_window_->desktopFrame();
-    if (!frame)
+    const bool changed = encoding_selector_->update(measurement, &config);
+
+    saveStreamingProfile(config);
+
+    if (!changed)
+        return;
+
+    connect_data_->setDesktopConfig(config);
+    onSendConfig(config);
+}
+
+void ClientSessionDesktopView::saveStreamingProfile(const proto::desktop::Config& config)
+{
+    proto::address_book::StreamingProfile profile;
+
+    profile.set_update_time(QDateTime::currentSecsSinceEpoch());
+    profile.set_video_encoding(config.video_encoding());
+    profile.mutable_pixel_format()->CopyFrom(config.pixel_format());
+    profile.set_compress_ratio(config.compress_ratio());
+    profile.set_min_round_trip_time(encoding_selector_->minRoundTripTime());
+    profile.set_upgrade_samples(encoding_selector_->upgradeSamples());
+
+    // The bitrate of the previous session is kept until the link is measured.
+    const qint64 bitrate = encoding_selector_->maxBitrate();
+    profile.set_bitrate(bitrate ? static_cast<quint32>(bitrate) :
+                                  connect_data_->streamingProfile().bitrate());
+
+    connect_data_->setStreamingProfile(profile);
+}
+
+void ClientSessionDesktopView::readScreenList(const proto::desktop::ScreenList& screen_list)
+{
+    desktop_window_->setScreenList(screen_list);
+}
+
+void ClientSessionDesktopView::readCursorShape(const proto::desktop::CursorShape& cursor_shape)
+{
+    if (!cursor_decoder_)
+        cursor_decoder_ = std::make_unique<CursorDecoder>();
+
+    std::shared_ptr<MouseCursor> mouse_cursor = cursor_decoder_->decode(cursor_shape);
+    if (!mouse_cursor)
+        return;
+
+    QImage image(mouse_cursor->data(),
+                 mouse_cursor->size().width(),
+                 mouse_cursor->size().height(),
+                 mouse_cursor->stride(),
+                 QImage::Format::Format_ARGB32);
+
+    // The image does not own the data of the cursor, so it is copied.
+    desktop_window_->setRemoteCursor(image.copy(), mouse_cursor->hotSpot());
+}
+
+void ClientSessionDesktopView::setupCursorDecoder(proto::desktop::Config* config)
+{
+    if (!(config->features() & proto::desktop::FEATURE_CURSOR_SHAPE))
     {
-        emit errorOccurred(tr("Session error: The desktop frame is not initialized."));
+        saveCursorCache();
+        cursor_decoder_.reset();
         return;
     }
 
-    if (!video_decoder_->decode(packet, frame))
+    // The config sent during the session restarts the cursor encoder of the host with an empty
+    // cache. The cursors sent before it may be still in flight, so the hashes are reported only
+    // with the first config.
+    if (cursor_decoder_)
+        return;
+
+    cursor_decoder_ = std::make_unique<CursorDecoder>();
+
+    auto& store = cursorCacheStore();
+
+    auto it = store.find(hostKey(connect_data_));
+    if (it == store.end())
+        return;
+
+    cursor_decoder_->setCache(std::move(it->second));
+    store.erase(it);
+
+    const MouseCursorCache* cache = cursor_decoder_->cache();
+
+    for (quint64 hash : cache->hashes())
+        config->add_cursor_cache(hash);
+
+    config->set_cursor_cache_next(static_cast<quint32>(cache->nextSlot()));
+}
+
+// static
+void ClientSessionDesktopView::setupTileCache(proto::desktop::Config* config)
+{
+    if (config->video_encoding() == proto::desktop::VIDEO_ENCODING_PALETTE)
+        config->set_tile_cache_size(kTileCacheSize);
+    else
+        config->clear_tile_cache_size();
+}
+
+void ClientSessionDesktopView::setupViewport(proto::desktop::Config* config)
+{
+    if (!(config->features() & proto::desktop::FEATURE_SCALING) || !desktop_window_)
     {
-        emit errorOccurred(tr("Session error: The video packet could not be decoded."));
+        config->clear_viewport();
         return;
     }
 
-    desktop_window_->drawDesktopFrame();
+    VideoUtil::toVideoSize(desktop_window_->viewportSize(), config->mutable_viewport());
+}
+
+void ClientSessionDesktopView::setupFrameHashes(proto::desktop::Config* config)
+{
+    if (!(host_features_ & proto::desktop::FEATURE_RESYNC))
+        return;
+
+    // The decoded packets which are not presented yet are not in the current frame.
+    presentFrame();
+
+    QSize frame_size;
+    const std::vector<quint64> hashes = decode_thread_->frameHashes(&frame_size);
+    if (hashes.empty())
+        return;
+
+    proto::desktop::FrameHashes* frame_hashes = config->mutable_frame_hashes();
+
+    VideoUtil::toVideoSize(frame_size, frame_hashes->mutable_screen_size());
+    frame_hashes->set_tile_size(FrameHashes::kTileSize);
+
+    for (quint64 hash : hashes)
+        frame_hashes->add_hash(hash);
+}
+
+void ClientSessionDesktopView::saveCursorCache()
+{
+    if (!cursor_decoder_ || !cursor_decoder_->cache())
+        return;
+
+    cursorCacheStore()[hostKey(connect_data_)] = cursor_decoder_->takeCache();
+}
+
+void ClientSessionDesktopView::readCursorPosition(
+    const proto::desktop::CursorPosition& cursor_position)
+{
+    desktop_window_->setRemoteCursorPosition(QPoint(cursor_position.x(), cursor_position.y()));
 }
 
 void ClientSessionDesktopView::readConfigRequest(
@@ -163,6 +902,8 @@ void ClientSessionDesktopView::readConfigRequest(
 
     desktop_window_->setSupportedVideoEncodings(config_request.video_encodings());
     desktop_window_->setSupportedFeatures(config_request.features());
+    host_features_ = config_request.features();
+    host_video_encodings_ = config_request.video_encodings();
 
     // If current video encoding not supported.
     if (!(config_request.video_encodings() & config.video_encoding()))
@@ -183,6 +924,16 @@ void ClientSessionDesktopView::readConfigRequest(
     }
 
     connect_data_->setDesktopConfig(config);
+
+    if (!early_config_.empty())
+    {
+        const bool config_sent = early_config_ == config.SerializeAsString();
+        early_config_.clear();
+
+        if (config_sent)
+            return;
+    }
+
     onSendConfig(config);
 }
 
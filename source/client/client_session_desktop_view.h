@@ -8,17 +8,25 @@
 #ifndef _ASPIA_CLIENT__CLIENT_SESSION_DESKTOP_VIEW_H
 #define _ASPIA_CLIENT__CLIENT_SESSION_DESKTOP_VIEW_H
 
+#include <QElapsedTimer>
 #include <QPointer>
+#include <QRect>
 #include <QThread>
 
+#include <deque>
+
+#include "base/power_monitor.h"
 #include "client/client_session.h"
 #include "client/connect_data.h"
-#include "codec/video_decoder.h"
+#include "client/encoding_selector.h"
 #include "protocol/address_book.pb.h"
+#include "protocol/desktop_session.pb.h"
 
 namespace aspia {
 
+class CursorDecoder;
 class DesktopWindow;
+class VideoDecodeThread;
 
 class ClientSessionDesktopView : public ClientSession
 {
@@ -35,22 +43,165 @@ public slots:
     // ClientSession implementation.
     void messageReceived(const QByteArray& buffer) override;
     void messageWritten(int message_id) override;
+    void setConfigRequest(const QByteArray& config_request) override;
     void startSession() override;
     void closeSession() override;
+    void resumeSession() override;
+    void messageLost(MessageClass message_class) override;
 
     virtual void onSendConfig(const proto::desktop::Config& config);
+    void onSelectScreen(qint64 screen_id);
+    void onVisibilityChanged(bool visible);
+    void onVisibleAreaChanged(const QRect& area);
 
 protected:
-    void readVideoPacket(const proto::desktop::VideoPacket& packet);
+    // QObject implementation.
+    void customEvent(QEvent* event) override;
+    void timerEvent(QTimerEvent* event) override;
+
+    // Features of the protocol which are requested regardless of the user settings.
+    static quint32 protocolFeatures();
+
+    // Parses the message into |incoming_message_|. The video packets decoded earlier are
+    // reused with their allocated buffers.
+    bool readHostMessage(const QByteArray& buffer);
+
+    // Passes the video packet of |incoming_message_| to the decode thread.
+    void readVideoPacket();
+    void readScreenList(const proto::desktop::ScreenList& screen_list);
+    virtual void readConfigRequest(const proto::desktop::ConfigRequest& config_request);
+    virtual void readCursorShape(const proto::desktop::CursorShape& cursor_shape);
+    void readPing(const proto::desktop::Ping& ping);
+
+    // Returns the time to stamp on the next input event if the input latency is measured, or 0.
+    // The latency is measured while the statistics are shown, one probe at a time.
+    qint64 takeLatencyProbe();
+    void readLatencyProbe(const proto::desktop::LatencyProbe& latency_probe);
+
+    // Creates the cursor decoder if the cursor shapes are enabled in |config|. The cache of the
+    // previous session with the host is restored and reported to the host in |config|.
+    void setupCursorDecoder(proto::desktop::Config* config);
+    void saveCursorCache();
+
+    // Requests the cache of the tiles if the encoding of |config| supports it.
+    static void setupTileCache(proto::desktop::Config* config);
+
+    // Reports the size of the window to the host if the scaling is enabled in |config|.
+    void setupViewport(proto::desktop::Config* config);
+
+    // Reports the hashes of the tiles of the current frame to the host if it supports the
+    // resync, so the resumed session does not start from the whole screen.
+    void setupFrameHashes(proto::desktop::Config* config);
+
+    virtual void readCursorPosition(const proto::desktop::CursorPosition& cursor_position);
+
+    // Reports the visibility of the window if the host supports FEATURE_VISIBILITY. The config
+    // is followed by the report if the window is hidden.
+    void sendVisibility();
+    bool isWindowVisible() const { return window_visible_; }
+
+    // Reports the visible area of the window if the host supports FEATURE_VISIBLE_AREA. The
+    // config is followed by the report if the window shows only a part of the frame.
+    void sendVisibleArea();
+    bool isWholeFrameVisible() const { return visible_area_.isEmpty(); }
+
+    proto::desktop::HostToClient incoming_message_;
+    std::unique_ptr<CursorDecoder> cursor_decoder_;
 
     ConnectData* connect_data_;
     QPointer<DesktopWindow> desktop_window_;
 
 private:
-    void readConfigRequest(const proto::desktop::ConfigRequest& config_request);
-
-    proto::desktop::VideoEncoding video_encoding_ = proto::desktop::VIDEO_ENCODING_UNKNOWN;
-    std::unique_ptr<VideoDecoder> video_decoder_;
+    void sendVideoAck(quint32 frame_id, qint64 decode_time);
+    void schedulePresent();
+    void presentFrame();
+    void updateStatistics();
+
+    // The times in microseconds by |ping_clock_|.
+    qint64 currentTime() const;
+    void addLatencySample();
+
+    // Changes the config if the automatic encoding is enabled.
+    void selectEncoding(const EncodingSelector::Measurement& measurement);
+
+    // Stores the link and the settings chosen by the automatic encoding in the connection data.
+    void saveStreamingProfile(const proto::desktop::Config& config);
+
+    // The packets are decoded outside of the UI thread.
+    std::unique_ptr<VideoDecodeThread> decode_thread_;
+
+    // Time since the last presentation of the frame and the timer of the next one.
+    QElapsedTimer present_clock_;
+    int present_timer_id_ = 0;
+
+    // The frames are presented less often while the computer runs on the battery. The power
+    // is checked with the statistics.
+    PowerMonitor power_monitor_;
+
+    // The video packet of the previous message or a packet decoded earlier.
+    std::unique_ptr<proto::desktop::VideoPacket> free_packet_;
+
+    // The counters of the statistics since their previous update. The host is pinged only
+    // when the statistics are shown.
+    int statistics_timer_id_ = 0;
+    QElapsedTimer statistics_clock_;
+    QElapsedTimer ping_clock_;
+    qint64 received_bytes_ = 0;
+    int decoded_frames_ = 0;
+    int presented_frames_ = 0;
+    qint64 encode_time_ = 0;
+    qint64 decode_time_ = 0;
+    qint64 round_trip_time_ = -1;
+
+    // The last quality measured by the host. It is not reset, because the host measures only
+    // some of the frames.
+    float psnr_ = 0;
+    float ssim_ = 0;
+
+    // The time of the oldest ping which is not returned yet or -1.
+    qint64 ping_time_ = -1;
+
+    // The parts of the latency of the input (in microseconds) from the event to the paint of
+    // the frame which shows it.
+    struct LatencySample
+    {
+        qint64 total;
+        qint64 host;
+        qint64 network;
+        qint64 client;
+    };
+
+    // The probe is answered by the frame which is captured after the injection of the event.
+    // The answer follows the last packet of the frame, so the frame is shown when the packets
+    // up to |probe_packet_| are decoded.
+    qint64 probe_time_ = 0;
+    qint64 last_probe_time_ = 0;
+    qint64 probe_host_delay_ = 0;
+    qint64 probe_receive_time_ = 0;
+    quint64 probe_packet_ = 0;
+    quint64 received_packets_ = 0;
+    quint64 decoded_packets_ = 0;
+
+    // The video packets are lost, and the next ones are dropped until the refresh.
+    bool video_lost_ = false;
+    std::deque<LatencySample> latency_samples_;
+
+    // The config request which is received with the result of the authorization and the
+    // config which is sent for it. The config is not sent again for the request of the
+    // session if it is the same.
+    std::unique_ptr<proto::desktop::ConfigRequest> early_config_request_;
+    std::string early_config_;
+
+    // Created while the automatic encoding is enabled.
+    std::unique_ptr<EncodingSelector> encoding_selector_;
+
+    // The features and the encodings of the host from the config request.
+    quint32 host_features_ = 0;
+    quint32 host_video_encodings_ = 0;
+    bool window_visible_ = true;
+
+    // The part of the frame which the window shows, or empty for the whole frame.
+    QRect visible_area_;
 
     Q_DISABLE_COPY(ClientSessionDesktopView)
 };
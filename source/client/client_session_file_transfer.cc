@@ -40,8 +40,8 @@ ClientSessionFileTransfer::~ClientSessionFileTransfer()
         worker_thread_->wait();
     }
 
-    for (auto task : tasks_)
-        delete task;
+    for (auto& task : tasks_)
+        delete task.second;
     tasks_.clear();
 
     delete file_manager_;
@@ -65,14 +65,32 @@ void ClientSessionFileTransfer::messageReceived(const QByteArray& buffer)
         return;
     }
 
-    tasks_.front()->sendReply(reply);
-    tasks_.pop_front();
+    reading_ = false;
+
+    // The hosts of the old versions send the replies in the order of the requests without
+    // the identifiers.
+    auto task = reply.request_id() ? tasks_.find(reply.request_id()) : tasks_.begin();
+    if (task == tasks_.end())
+    {
+        emit errorOccurred(tr("Session error: Invalid message from host."));
+        return;
+    }
+
+    if (task->second)
+    {
+        task->second->sendReply(reply);
+        delete task->second;
+    }
+
+    tasks_.erase(task);
+
+    readReply();
 }
 
 void ClientSessionFileTransfer::messageWritten(int message_id)
 {
     Q_ASSERT(message_id == RequestMessageId);
-    emit readMessage();
+    readReply();
 }
 
 void ClientSessionFileTransfer::startSession()
@@ -108,10 +126,32 @@ void ClientSessionFileTransfer::closeSession()
     file_manager_->close();
 }
 
+void ClientSessionFileTransfer::setWriteBlocked(bool blocked)
+{
+    // The session is not started before the transfers.
+    if (file_manager_)
+        file_manager_->setRemoteBlocked(blocked);
+}
+
+void ClientSessionFileTransfer::readReply()
+{
+    // Several requests can be sent before the replies to them are received.
+    if (reading_ || tasks_.empty())
+        return;
+
+    reading_ = true;
+    emit readMessage();
+}
+
 void ClientSessionFileTransfer::remoteRequest(FileRequest* request)
 {
-    tasks_.push_back(QPointer<FileRequest>(request));
-    emit writeMessage(RequestMessageId, serializeMessage(request->request()));
+    // The replies of the lists of the directories can be received before the replies of the
+    // packets of the transfers which are requested earlier.
+    proto::file_transfer::Request message = request->request();
+    message.set_request_id(++last_request_id_);
+
+    tasks_.emplace(message.request_id(), QPointer<FileRequest>(request));
+    emit writeMessage(RequestMessageId, serializeMessage(message), LowPriority, FileMessage);
 }
 
 } // namespace aspia
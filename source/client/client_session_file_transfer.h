@@ -8,9 +8,10 @@
 #ifndef _ASPIA_CLIENT__CLIENT_SESSION_FILE_TRANSFER_H
 #define _ASPIA_CLIENT__CLIENT_SESSION_FILE_TRANSFER_H
 
-#include <QQueue>
 #include <QPointer>
 
+#include <map>
+
 #include "client/client_session.h"
 #include "client/connect_data.h"
 #include "host/file_request.h"
@@ -18,9 +19,6 @@
 
 namespace aspia {
 
-Q_DECLARE_METATYPE(proto::file_transfer::Request);
-Q_DECLARE_METATYPE(proto::file_transfer::Reply);
-
 class FileManagerWindow;
 class FileWorker;
 
@@ -38,18 +36,24 @@ public slots:
     void messageWritten(int message_id) override;
     void startSession() override;
     void closeSession() override;
+    void setWriteBlocked(bool blocked) override;
 
 private slots:
     void remoteRequest(FileRequest* request);
 
 private:
+    void readReply();
+
     ConnectData* connect_data_;
     QPointer<FileManagerWindow> file_manager_;
 
     QPointer<FileWorker> worker_;
     QPointer<QThread> worker_thread_;
 
-    QQueue<QPointer<FileRequest>> tasks_;
+    // The requests which are sent to the host by the identifiers.
+    std::map<quint64, QPointer<FileRequest>> tasks_;
+    quint64 last_request_id_ = 0;
+    bool reading_ = false;
 
     Q_DISABLE_COPY(ClientSessionFileTransfer)
 };
@@ -9,6 +9,7 @@
 
 #include "base/message_serialization.h"
 #include "client/ui/system_info_window.h"
+#include "system_info/category_dmi.h"
 
 namespace aspia {
 
@@ -41,7 +42,12 @@ void ClientSessionSystemInfo::messageReceived(const QByteArray& buffer)
         return;
     }
 
-    // TODO
+    // The compressed replies are not requested.
+    if (reply.has_category() && window_)
+    {
+        window_->readReply(QString::fromStdString(reply.category().uuid()),
+                           QByteArray::fromStdString(reply.category().data()));
+    }
 }
 
 void ClientSessionSystemInfo::messageWritten(int message_id)
@@ -60,6 +66,10 @@ void ClientSessionSystemInfo::startSession()
 
     window_->show();
     window_->activateWindow();
+
+    proto::system_info::Request request;
+    request.mutable_category_request()->set_uuid(CategoryDmi::kUuid);
+    emit writeMessage(RequestMessageId, serializeMessage(request));
 }
 
 void ClientSessionSystemInfo::closeSession()
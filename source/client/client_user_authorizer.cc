@@ -7,53 +7,243 @@
 
 #include "client/client_user_authorizer.h"
 
-#include <QCryptographicHash>
+#include <QHash>
+#include <QThread>
 
 #include "base/message_serialization.h"
-#include "client/ui/authorization_dialog.h"
+#include "crypto/password_hash.h"
+#include "crypto/random.h"
 #include "crypto/secure_memory.h"
 
+extern "C" {
+#define SODIUM_STATIC
+
+#pragma warning(push, 3)
+#include <sodium.h>
+#pragma warning(pop)
+} // extern "C"
+
 namespace aspia {
 
 namespace {
 
-const quint32 kKeyHashingRounds = 100000;
-const quint32 kPasswordHashingRounds = 100000;
-
 enum MessageId { LogonRequest, ClientChallenge };
 
-QByteArray createPasswordHash(const QString& password)
+// The hashes of the passwords (never the passwords) of the users which have been authorized by
+// the hosts, by the address of the host and the name of the user. Additional sessions to the
+// same computer are authorized without hashing the password again. An entry is used only with
+// the same parameters of the hash and the same typed password, and is removed when the host
+// rejects the user. The typed password is compared by its digest with the random key of the
+// process, so the cache does not keep anything which can be checked against the password
+// outside of the process.
+class PasswordHashCache
 {
-    QByteArray data = password.toUtf8();
+public:
+    PasswordHashCache()
+        : digest_key_(Random::generateBuffer(crypto_generichash_KEYBYTES))
+    {
+        // Nothing
+    }
 
-    for (int i = 0; i < kPasswordHashingRounds; ++i)
+    ~PasswordHashCache()
     {
-        data = QCryptographicHash::hash(data, QCryptographicHash::Sha512);
+        for (auto it = entries_.begin(); it != entries_.end(); ++it)
+        {
+            secureMemZero(&it->password_digest);
+            secureMemZero(&it->password_hash);
+        }
+
+        secureMemZero(&digest_key_);
     }
 
-    return data;
-}
+    QByteArray find(const QString& key,
+                    const proto::auth::ServerChallenge& challenge,
+                    const QString& password) const
+    {
+        auto entry = entries_.constFind(key);
+        if (entry == entries_.constEnd() ||
+            entry->password_hashing != challenge.password_hashing() ||
+            entry->salt != challenge.password_salt() ||
+            entry->ops_limit != challenge.ops_limit() ||
+            entry->mem_limit != challenge.mem_limit())
+        {
+            return QByteArray();
+        }
 
-QByteArray createSessionKey(const QByteArray& password_hash, const QByteArray& nonce)
-{
-    QByteArray data = password_hash;
+        QByteArray password_digest = passwordDigest(password);
+
+        const bool matched = !password_digest.isEmpty() &&
+            sodium_memcmp(password_digest.constData(), entry->password_digest.constData(),
+                          password_digest.size()) == 0;
+
+        secureMemZero(&password_digest);
+
+        if (!matched)
+            return QByteArray();
 
-    for (quint32 i = 0; i < kKeyHashingRounds; ++i)
+        return entry->password_hash;
+    }
+
+    void store(const QString& key,
+               const proto::auth::ServerChallenge& challenge,
+               const QString& password,
+               const QByteArray& password_hash)
+    {
+        remove(key);
+
+        QByteArray password_digest = passwordDigest(password);
+        if (password_digest.isEmpty())
+            return;
+
+        Entry& entry = entries_[key];
+        entry.password_hashing = challenge.password_hashing();
+        entry.salt = challenge.password_salt();
+        entry.ops_limit = challenge.ops_limit();
+        entry.mem_limit = challenge.mem_limit();
+        entry.password_digest = password_digest;
+        entry.password_hash = password_hash;
+
+        secureMemZero(&password_digest);
+    }
+
+    void remove(const QString& key)
+    {
+        auto entry = entries_.find(key);
+        if (entry == entries_.end())
+            return;
+
+        secureMemZero(&entry->password_digest);
+        secureMemZero(&entry->password_hash);
+        entries_.erase(entry);
+    }
+
+private:
+    // Returns an empty buffer if the digest can not be created.
+    QByteArray passwordDigest(const QString& password) const
     {
-        QCryptographicHash hash(QCryptographicHash::Sha512);
+        QByteArray password_utf8 = password.toUtf8();
+        QByteArray password_digest(crypto_generichash_BYTES, 0);
+
+        const int ret = crypto_generichash(
+            reinterpret_cast<quint8*>(password_digest.data()), password_digest.size(),
+            reinterpret_cast<const quint8*>(password_utf8.constData()), password_utf8.size(),
+            reinterpret_cast<const quint8*>(digest_key_.constData()), digest_key_.size());
+
+        secureMemZero(&password_utf8);
 
-        hash.addData(data);
-        hash.addData(nonce);
+        if (ret != 0)
+        {
+            qWarning("crypto_generichash failed");
+            return QByteArray();
+        }
 
-        data = hash.result();
+        return password_digest;
     }
 
-    return data;
+    struct Entry
+    {
+        proto::auth::PasswordHashing password_hashing = proto::auth::PASSWORD_HASHING_SHA512;
+        std::string salt;
+        quint32 ops_limit = 0;
+        quint32 mem_limit = 0;
+        QByteArray password_digest;
+        QByteArray password_hash;
+    };
+
+    QByteArray digest_key_;
+    QHash<QString, Entry> entries_;
+
+    Q_DISABLE_COPY(PasswordHashCache)
+};
+
+PasswordHashCache& passwordHashCache()
+{
+    // The authorizers are used only by the UI thread.
+    static PasswordHashCache cache;
+    return cache;
+}
+
+// The parameters of the password hashes (without the nonces) of the users which have been
+// authorized by the hosts, by the address of the host and the name of the user.
+QHash<QString, proto::auth::ServerChallenge>& challengeCache()
+{
+    // The authorizers are used only by the UI thread.
+    static QHash<QString, proto::auth::ServerChallenge> cache;
+    return cache;
 }
 
 } // namespace
 
-ClientUserAuthorizer::ClientUserAuthorizer(QWidget* parent)
+// Computes the hash of the password and the session key, so the UI thread is not blocked by
+// the hashing.
+class ClientUserAuthorizer::HashThread : public QThread
+{
+public:
+    HashThread(const QString& password,
+               const QByteArray& password_hash,
+               const proto::auth::ServerChallenge& challenge,
+               QObject* parent)
+        : QThread(parent),
+          password_(password),
+          password_hash_(password_hash),
+          challenge_(challenge)
+    {
+        // Nothing
+    }
+
+    ~HashThread()
+    {
+        // The hashing can not be interrupted.
+        wait();
+
+        secureMemZero(&password_);
+        secureMemZero(&password_hash_);
+        secureMemZero(&session_key_);
+    }
+
+    const QByteArray& passwordHash() const { return password_hash_; }
+    const QByteArray& sessionKey() const { return session_key_; }
+    const proto::auth::ServerChallenge& challenge() const { return challenge_; }
+
+protected:
+    // QThread implementation.
+    void run() override
+    {
+        const QByteArray nonce = QByteArray::fromStdString(challenge_.nonce());
+
+        if (challenge_.password_hashing() == proto::auth::PASSWORD_HASHING_ARGON2ID)
+        {
+            if (password_hash_.isEmpty())
+            {
+                password_hash_ = PasswordHash::create(password_,
+                                                      QByteArray::fromStdString(
+                                                          challenge_.password_salt()),
+                                                      challenge_.ops_limit(),
+                                                      challenge_.mem_limit());
+            }
+
+            if (!password_hash_.isEmpty())
+                session_key_ = PasswordHash::createSessionKey(password_hash_, nonce);
+        }
+        else
+        {
+            if (password_hash_.isEmpty())
+                password_hash_ = PasswordHash::createLegacy(password_);
+
+            session_key_ = PasswordHash::createLegacySessionKey(password_hash_, nonce);
+        }
+    }
+
+private:
+    QString password_;
+    QByteArray password_hash_;
+    QByteArray session_key_;
+    const proto::auth::ServerChallenge challenge_;
+
+    Q_DISABLE_COPY(HashThread)
+};
+
+ClientUserAuthorizer::ClientUserAuthorizer(QObject* parent)
     : QObject(parent)
 {
     // Nothing
@@ -63,8 +253,11 @@ ClientUserAuthorizer::~ClientUserAuthorizer()
 {
     secureMemZero(&username_);
     secureMemZero(&password_);
+    secureMemZero(&password_hash_);
+    secureMemZero(&resume_ticket_);
 
     cancel();
+    hash_thread_.reset();
 }
 
 void ClientUserAuthorizer::setSessionType(proto::auth::SessionType session_type)
@@ -82,6 +275,21 @@ void ClientUserAuthorizer::setPassword(const QString& password)
     password_ = password;
 }
 
+void ClientUserAuthorizer::setResumeTicket(const QByteArray& resume_ticket)
+{
+    resume_ticket_ = resume_ticket;
+}
+
+void ClientUserAuthorizer::setChallengeNonce(const QByteArray& challenge_nonce)
+{
+    challenge_nonce_ = challenge_nonce;
+}
+
+void ClientUserAuthorizer::setHostAddress(const QString& host_address)
+{
+    host_address_ = host_address;
+}
+
 void ClientUserAuthorizer::start()
 {
     if (state_ != NotStarted)
@@ -90,13 +298,46 @@ void ClientUserAuthorizer::start()
         return;
     }
 
+    state_ = Started;
+
+    // The host needs the user name to send the parameters of the password hash.
+    if (resume_ticket_.isEmpty() && (username_.isEmpty() || password_.isEmpty()))
+    {
+        emit errorOccurred(tr("The user name or the password is not specified."));
+        cancel();
+        return;
+    }
+
     proto::auth::ClientToHost message;
 
     // We do not support other authorization methods yet.
     message.mutable_logon_request()->set_method(proto::auth::METHOD_BASIC);
+    message.mutable_logon_request()->set_username(username_.toStdString());
+
+    if (!resume_ticket_.isEmpty())
+    {
+        message.mutable_logon_request()->set_resume_ticket(
+            resume_ticket_.constData(), resume_ticket_.size());
+    }
+    else if (!challenge_nonce_.isEmpty() && !host_address_.isEmpty())
+    {
+        auto cached = challengeCache().constFind(challengeKey());
+        if (cached != challengeCache().constEnd())
+        {
+            message.mutable_logon_request()->mutable_expected_challenge()->CopyFrom(*cached);
+            early_challenge_ = true;
+        }
+    }
 
-    state_ = Started;
     emit writeMessage(LogonRequest, serializeMessage(message));
+
+    // The session key is created for the nonce of the channel while the request is sent.
+    if (early_challenge_)
+    {
+        proto::auth::ServerChallenge challenge(message.logon_request().expected_challenge());
+        challenge.set_nonce(challenge_nonce_.constData(), challenge_nonce_.size());
+        startHashing(challenge);
+    }
 }
 
 void ClientUserAuthorizer::cancel()
@@ -113,6 +354,10 @@ void ClientUserAuthorizer::messageWritten(int message_id)
     if (state_ == Finished)
         return;
 
+    // The reply to the early client challenge is read after the challenge is written.
+    if (message_id == LogonRequest && early_challenge_)
+        return;
+
     emit readMessage();
 }
 
@@ -144,34 +389,67 @@ void ClientUserAuthorizer::messageReceived(const QByteArray& buffer)
 void ClientUserAuthorizer::readServerChallenge(
     const proto::auth::ServerChallenge& server_challenge)
 {
-    QByteArray nonce = QByteArray(server_challenge.nonce().c_str(),
-                                  server_challenge.nonce().size());
-    if (nonce.isEmpty())
+    if (server_challenge.nonce().empty())
     {
         emit errorOccurred(tr("Authorization error: Empty nonce is not allowed."));
         cancel();
         return;
     }
 
-    if (username_.isEmpty() || password_.isEmpty())
+    if (server_challenge.password_hashing() == proto::auth::PASSWORD_HASHING_ARGON2ID &&
+        (server_challenge.password_salt().size() != PasswordHash::kSaltSize ||
+         !PasswordHash::isValidLimits(server_challenge.ops_limit(),
+                                      server_challenge.mem_limit())))
     {
-        AuthorizationDialog dialog(dynamic_cast<QWidget*>(parent()));
+        emit errorOccurred(tr("Authorization error: Wrong parameters of the password hash."));
+        cancel();
+        return;
+    }
 
-        dialog.setUserName(username_);
-        dialog.setPassword(password_);
+    // The host has not accepted the parameters of the previous connection.
+    if (early_challenge_)
+        challengeCache().remove(challengeKey());
 
-        if (dialog.exec() == AuthorizationDialog::Rejected)
-        {
-            emit errorOccurred(tr("Authorization is canceled by the user."));
-            cancel();
-            return;
-        }
+    startHashing(server_challenge);
+}
+
+void ClientUserAuthorizer::startHashing(const proto::auth::ServerChallenge& server_challenge)
+{
+    QByteArray password_hash;
+    if (!host_address_.isEmpty())
+        password_hash = passwordHashCache().find(challengeKey(), server_challenge, password_);
+
+    hash_thread_ = std::make_unique<HashThread>(
+        password_, password_hash, server_challenge, this);
+
+    secureMemZero(&password_hash);
+
+    connect(hash_thread_.get(), &QThread::finished,
+            this, &ClientUserAuthorizer::onPasswordHashed);
+
+    hash_thread_->start();
+}
+
+void ClientUserAuthorizer::onPasswordHashed()
+{
+    std::unique_ptr<HashThread> hash_thread = std::move(hash_thread_);
+
+    if (state_ == Finished)
+        return;
 
-        username_ = dialog.userName();
-        password_ = dialog.password();
+    QByteArray session_key = hash_thread->sessionKey();
+    if (session_key.isEmpty())
+    {
+        emit errorOccurred(tr("Authorization error: Unable to create the password hash."));
+        cancel();
+        return;
     }
 
-    QByteArray session_key = createSessionKey(createPasswordHash(password_), nonce);
+    secureMemZero(&password_hash_);
+    password_hash_ = hash_thread->passwordHash();
+
+    challenge_ = std::make_unique<proto::auth::ServerChallenge>(hash_thread->challenge());
+    challenge_->clear_nonce();
 
     proto::auth::ClientToHost message;
 
@@ -195,7 +473,34 @@ void ClientUserAuthorizer::readServerChallenge(
 void ClientUserAuthorizer::readLogonResult(const proto::auth::LogonResult& logon_result)
 {
     state_ = Finished;
+
+    secureMemZero(&resume_ticket_);
+    resume_ticket_ = QByteArray::fromStdString(logon_result.resume_ticket());
+    config_request_ = QByteArray::fromStdString(logon_result.config_request());
+
+    // The resumed sessions are authorized without the challenge.
+    if (challenge_ && !host_address_.isEmpty())
+    {
+        if (logon_result.status() == proto::auth::STATUS_SUCCESS)
+        {
+            challengeCache().insert(challengeKey(), *challenge_);
+            passwordHashCache().store(challengeKey(), *challenge_, password_, password_hash_);
+        }
+        else
+        {
+            challengeCache().remove(challengeKey());
+            passwordHashCache().remove(challengeKey());
+        }
+    }
+
+    secureMemZero(&password_hash_);
+
     emit finished(logon_result.status());
 }
 
+QString ClientUserAuthorizer::challengeKey() const
+{
+    return host_address_ + QLatin1Char('/') + username_.toLower();
+}
+
 } // namespace aspia
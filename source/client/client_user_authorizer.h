@@ -10,6 +10,10 @@
 
 #include <QObject>
 
+#include <memory>
+
+#include "base/message_class.h"
+#include "base/message_priority.h"
 #include "protocol/authorization.pb.h"
 
 namespace aspia {
@@ -21,7 +25,9 @@ class ClientUserAuthorizer : public QObject
 public:
     enum State { NotStarted, Started, Finished };
 
-    explicit ClientUserAuthorizer(QWidget* parent);
+    // The user name and the password must be set before the start unless the session is
+    // resumed. The authorizer does not ask them, so it is used by the processes without UI.
+    explicit ClientUserAuthorizer(QObject* parent = nullptr);
     ~ClientUserAuthorizer();
 
     proto::auth::SessionType sessionType() const { return session_type_; }
@@ -33,6 +39,22 @@ public:
     QString password() const { return password_; }
     void setPassword(const QString& password);
 
+    // If the ticket is set before the start, then the session of the previous connection is
+    // resumed without the password. After the successful authorization the new ticket of the
+    // connection is returned. It is empty if the session can not be resumed.
+    QByteArray resumeTicket() const { return resume_ticket_; }
+    void setResumeTicket(const QByteArray& resume_ticket);
+
+    // The challenge nonce of the channel and the address of the host. If the host has sent
+    // the nonce, then the client which has been authorized by the host before sends the
+    // session key without waiting for the challenge.
+    void setChallengeNonce(const QByteArray& challenge_nonce);
+    void setHostAddress(const QString& host_address);
+
+    // The serialized config request of the desktop session which the host sends with the
+    // result of the authorization. Empty if it is not sent.
+    QByteArray configRequest() const { return config_request_; }
+
 public slots:
     void start();
     void cancel();
@@ -42,17 +64,45 @@ public slots:
 signals:
     void finished(proto::auth::Status status);
     void errorOccurred(const QString& message);
-    void writeMessage(int message_id, const QByteArray& buffer);
+    void writeMessage(int message_id,
+                      const QByteArray& buffer,
+                      MessagePriority priority = NormalPriority,
+                      MessageClass message_class = GenericMessage);
     void readMessage();
 
+private slots:
+    void onPasswordHashed();
+
 private:
+    class HashThread;
+
     void readServerChallenge(const proto::auth::ServerChallenge& server_challenge);
+    void startHashing(const proto::auth::ServerChallenge& server_challenge);
+    QString challengeKey() const;
     void readLogonResult(const proto::auth::LogonResult& logon_result);
 
     State state_ = NotStarted;
     proto::auth::SessionType session_type_ = proto::auth::SESSION_TYPE_UNKNOWN;
     QString username_;
     QString password_;
+    QByteArray resume_ticket_;
+    QByteArray challenge_nonce_;
+    QString host_address_;
+    QByteArray config_request_;
+
+    // The client challenge is sent after the logon request without waiting for the challenge
+    // of the host.
+    bool early_challenge_ = false;
+
+    // The parameters of the hash of the challenge without the nonce. Null until the session
+    // key is created.
+    std::unique_ptr<proto::auth::ServerChallenge> challenge_;
+
+    // The hash of the password of the sent session key. It is cached for the host if the
+    // user is authorized.
+    QByteArray password_hash_;
+
+    std::unique_ptr<HashThread> hash_thread_;
 
     Q_DISABLE_COPY(ClientUserAuthorizer)
 };
@@ -67,4 +67,42 @@ void ComputerFactory::setDefaultDesktopViewConfig(proto::desktop::Config* config
     VideoUtil::toVideoPixelFormat(PixelFormat::RGB565(), config->mutable_pixel_format());
 }
 
+// static
+QStringList ComputerFactory::alternateAddresses(const proto::address_book::Computer& computer)
+{
+    QStringList addresses;
+
+    for (const auto& address : computer.alternate_addresses())
+        addresses.append(QString::fromStdString(address));
+
+    return addresses;
+}
+
+// static
+void ComputerFactory::applyStreamingProfile(const proto::address_book::Computer& computer,
+                                            proto::desktop::Config* config)
+{
+    if (!config->auto_encoding() || !computer.has_streaming_profile())
+        return;
+
+    const proto::address_book::StreamingProfile& profile = computer.streaming_profile();
+
+    // The encoding which the host does not support is changed when the session starts.
+    if (profile.video_encoding() != proto::desktop::VIDEO_ENCODING_UNKNOWN)
+    {
+        config->set_video_encoding(profile.video_encoding());
+        config->mutable_pixel_format()->CopyFrom(profile.pixel_format());
+
+        if (profile.compress_ratio())
+            config->set_compress_ratio(profile.compress_ratio());
+    }
+
+    // The limit of the client is not exceeded by the start of the encoder.
+    quint32 bandwidth = profile.bitrate();
+    if (config->bandwidth_limit())
+        bandwidth = qMin(bandwidth, config->bandwidth_limit());
+
+    config->set_initial_bandwidth(bandwidth);
+}
+
 } // namespace aspia
@@ -8,6 +8,8 @@
 #ifndef _ASPIA_CLIENT__COMPUTER_FACTORY_H
 #define _ASPIA_CLIENT__COMPUTER_FACTORY_H
 
+#include <QStringList>
+
 #include "protocol/address_book.pb.h"
 
 namespace aspia {
@@ -23,6 +25,13 @@ public:
     static void setDefaultDesktopManageConfig(proto::desktop::Config* config);
     static void setDefaultDesktopViewConfig(proto::desktop::Config* config);
 
+    static QStringList alternateAddresses(const proto::address_book::Computer& computer);
+
+    // Starts the desktop session with the automatic encoding from the settings which were
+    // chosen in the previous session with |computer|.
+    static void applyStreamingProfile(const proto::address_book::Computer& computer,
+                                      proto::desktop::Config* config);
+
 private:
     Q_DISABLE_COPY(ComputerFactory)
 };
@@ -8,8 +8,9 @@
 #ifndef _ASPIA_CLIENT__CONNECT_DATA_H
 #define _ASPIA_CLIENT__CONNECT_DATA_H
 
-#include <QString>
+#include <QStringList>
 
+#include "protocol/address_book.pb.h"
 #include "protocol/authorization.pb.h"
 #include "protocol/desktop_session.pb.h"
 
@@ -27,6 +28,10 @@ public:
     QString address() const { return address_; }
     void setAddress(const QString& address) { address_ = address; }
 
+    // The addresses which are tried together with address().
+    QStringList alternateAddresses() const { return alternate_addresses_; }
+    void setAlternateAddresses(const QStringList& addresses) { alternate_addresses_ = addresses; }
+
     int port() const { return port_; }
     void setPort(int port) { port_ = port; }
 
@@ -42,15 +47,29 @@ public:
     proto::desktop::Config desktopConfig() const { return desktop_config_; }
     void setDesktopConfig(const proto::desktop::Config& config) { desktop_config_ = config; }
 
+    // The profile of the previous session, which is updated by the session with the automatic
+    // encoding.
+    const proto::address_book::StreamingProfile& streamingProfile() const
+    {
+        return streaming_profile_;
+    }
+
+    void setStreamingProfile(const proto::address_book::StreamingProfile& profile)
+    {
+        streaming_profile_ = profile;
+    }
+
 private:
     QString computer_name_;
     QString address_;
+    QStringList alternate_addresses_;
     int port_ = 0;
     QString user_name_;
     QString password_;
 
     proto::auth::SessionType session_type_ = proto::auth::SESSION_TYPE_UNKNOWN;
     proto::desktop::Config desktop_config_;
+    proto::address_book::StreamingProfile streaming_profile_;
 };
 
 } // namespace aspia
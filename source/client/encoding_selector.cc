@@ -0,0 +1,206 @@
+//
+// PROJECT:         Aspia
+// FILE:            client/encoding_selector.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "client/encoding_selector.h"
+
+#include "codec/video_util.h"
+
+namespace aspia {
+
+namespace {
+
+// The round trip time above the minimum by this value and by the minimum itself means that the
+// link is congested.
+constexpr qint64 kQueueDelay = 50;
+
+// The time of the encoding or the decoding of a frame (in microseconds) which does not allow
+// the smooth updates.
+constexpr qint64 kMaxCodecTime = 40000;
+
+// The numbers of the consecutive measurements after which the level is changed.
+constexpr int kCongestedSamples = 3;
+constexpr int kSlowSamples = 5;
+constexpr int kMinUpgradeSamples = 15;
+constexpr int kMaxUpgradeSamples = 240;
+
+} // namespace
+
+// static
+const EncodingSelector::Level EncodingSelector::kLevels[] =
+{
+    { proto::desktop::VIDEO_ENCODING_VP8, proto::desktop::VIDEO_ENCODING_UNKNOWN, false, 0 },
+    { proto::desktop::VIDEO_ENCODING_VP9_LOSSY, proto::desktop::VIDEO_ENCODING_HYBRID, false, 6 },
+    { proto::desktop::VIDEO_ENCODING_ZSTD, proto::desktop::VIDEO_ENCODING_ZLIB, true, 6 },
+    { proto::desktop::VIDEO_ENCODING_ZSTD, proto::desktop::VIDEO_ENCODING_ZLIB, false, 6 },
+    { proto::desktop::VIDEO_ENCODING_LZ4, proto::desktop::VIDEO_ENCODING_UNKNOWN, false, 0 }
+};
+
+EncodingSelector::EncodingSelector(quint32 video_encodings)
+    : video_encodings_(video_encodings),
+      upgrade_samples_(kMinUpgradeSamples)
+{
+    // Nothing
+}
+
+bool EncodingSelector::update(const Measurement& measurement, proto::desktop::Config* config)
+{
+    // The config may be changed by the user.
+    const int current_level = currentLevel(*config);
+    if (current_level != level_)
+    {
+        level_ = current_level;
+        congested_samples_ = 0;
+        slow_samples_ = 0;
+        idle_samples_ = 0;
+    }
+
+    if (level_ == -1)
+        return false;
+
+    bool congested = false;
+
+    if (measurement.round_trip_time >= 0)
+    {
+        if (min_round_trip_time_ == -1 || measurement.round_trip_time < min_round_trip_time_)
+            min_round_trip_time_ = measurement.round_trip_time;
+
+        congested =
+            measurement.round_trip_time > min_round_trip_time_ * 2 + kQueueDelay;
+    }
+
+    const bool slow = measurement.frames > 0 &&
+        (measurement.encode_time > kMaxCodecTime || measurement.decode_time > kMaxCodecTime);
+
+    if (!congested && measurement.bitrate > max_bitrate_)
+        max_bitrate_ = measurement.bitrate;
+
+    congested_samples_ = congested ? congested_samples_ + 1 : 0;
+    slow_samples_ = (slow && !congested) ? slow_samples_ + 1 : 0;
+
+    // The idle screen does not show if the link is able to carry the next level. Without the
+    // round trip time the congestion is not detected, so the level is not raised.
+    if (congested || measurement.round_trip_time < 0)
+        idle_samples_ = 0;
+    else if (measurement.frames > 0)
+        ++idle_samples_;
+
+    int level = -1;
+
+    if (congested_samples_ >= kCongestedSamples)
+    {
+        level = nextLevel(level_, -1);
+        if (level != -1)
+            upgrade_samples_ = qMin(upgrade_samples_ * 2, kMaxUpgradeSamples);
+    }
+    else if (slow_samples_ >= kSlowSamples)
+    {
+        // The lossy levels take more time of the processors than the raw pixels.
+        level = nextLevel(qMax(level_, 1), +1);
+    }
+    else if (idle_samples_ >= upgrade_samples_)
+    {
+        level = nextLevel(level_, +1);
+    }
+
+    if (level == -1)
+        return false;
+
+    qInfo("Level of the encoding is changed from %d to %d (bitrate %lld kbps, rtt %lld ms)",
+          level_, level, measurement.bitrate, measurement.round_trip_time);
+
+    level_ = level;
+    congested_samples_ = 0;
+    slow_samples_ = 0;
+    idle_samples_ = 0;
+
+    applyLevel(level_, config);
+    return true;
+}
+
+void EncodingSelector::setUpgradeSamples(int upgrade_samples)
+{
+    upgrade_samples_ = qBound(kMinUpgradeSamples, upgrade_samples, kMaxUpgradeSamples);
+}
+
+proto::desktop::VideoEncoding EncodingSelector::encoding(int level) const
+{
+    const Level& entry = kLevels[level];
+
+    if (video_encodings_ & entry.video_encoding)
+        return entry.video_encoding;
+
+    if (video_encodings_ & entry.fallback_encoding)
+        return entry.fallback_encoding;
+
+    return proto::desktop::VIDEO_ENCODING_UNKNOWN;
+}
+
+int EncodingSelector::currentLevel(const proto::desktop::Config& config) const
+{
+    int level;
+
+    switch (config.video_encoding())
+    {
+        case proto::desktop::VIDEO_ENCODING_VP8:
+            level = 0;
+            break;
+
+        case proto::desktop::VIDEO_ENCODING_ZLIB:
+        case proto::desktop::VIDEO_ENCODING_ZSTD:
+        {
+            const PixelFormat pixel_format = VideoUtil::fromVideoPixelFormat(config.pixel_format());
+            level = pixel_format.isEqual(PixelFormat::ARGB()) ? 3 : 2;
+        }
+        break;
+
+        case proto::desktop::VIDEO_ENCODING_LZ4:
+            level = 4;
+            break;
+
+        default:
+            level = 1;
+            break;
+    }
+
+    if (encoding(level) != proto::desktop::VIDEO_ENCODING_UNKNOWN)
+        return level;
+
+    const int lower_level = nextLevel(level, -1);
+    if (lower_level != -1)
+        return lower_level;
+
+    return nextLevel(level, +1);
+}
+
+int EncodingSelector::nextLevel(int level, int direction) const
+{
+    const int count = static_cast<int>(sizeof(kLevels) / sizeof(kLevels[0]));
+
+    for (level += direction; level >= 0 && level < count; level += direction)
+    {
+        if (encoding(level) != proto::desktop::VIDEO_ENCODING_UNKNOWN)
+            return level;
+    }
+
+    return -1;
+}
+
+void EncodingSelector::applyLevel(int level, proto::desktop::Config* config) const
+{
+    const Level& entry = kLevels[level];
+
+    config->set_video_encoding(encoding(level));
+
+    VideoUtil::toVideoPixelFormat(
+        entry.high_color ? PixelFormat::RGB565() : PixelFormat::ARGB(),
+        config->mutable_pixel_format());
+
+    if (entry.compress_ratio)
+        config->set_compress_ratio(entry.compress_ratio);
+}
+
+} // namespace aspia
@@ -0,0 +1,110 @@
+//
+// PROJECT:         Aspia
+// FILE:            client/encoding_selector.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CLIENT__ENCODING_SELECTOR_H
+#define _ASPIA_CLIENT__ENCODING_SELECTOR_H
+
+#include <QtGlobal>
+
+#include "protocol/desktop_session.pb.h"
+
+namespace aspia {
+
+//
+// Chooses the encoding, the pixel format and the compression ratio of the desktop session by
+// the measured quality of the link. The levels are ordered from the lowest bandwidth (lossy
+// video) to the lowest cost of the processors (raw pixels with a fast compression). The level
+// is lowered when the round trip time grows above its minimum, which means that the queues of
+// the link are filled. It is raised when the link has no queues for some time, or earlier if
+// the encoder of the host or the decoder of the client does not keep up with the frames. After
+// the level is lowered, the next attempt to raise it waits longer, so it does not oscillate on
+// the links with the capacity between the levels.
+//
+class EncodingSelector
+{
+public:
+    // |video_encodings| are supported by both the client and the host.
+    explicit EncodingSelector(quint32 video_encodings);
+    ~EncodingSelector() = default;
+
+    struct Measurement
+    {
+        // Kilobits per second received from the host.
+        qint64 bitrate = 0;
+
+        // Round trip time of the session in milliseconds or -1 if it is not known.
+        qint64 round_trip_time = -1;
+
+        // Average times of a frame in microseconds.
+        qint64 encode_time = 0;
+        qint64 decode_time = 0;
+
+        // The frames decoded since the previous measurement.
+        int frames = 0;
+    };
+
+    // Must be called once per second. Returns true if |config| is changed.
+    bool update(const Measurement& measurement, proto::desktop::Config* config);
+
+    // The highest bitrate (kbit/s) received without the congestion of the link.
+    qint64 maxBitrate() const { return max_bitrate_; }
+
+    qint64 minRoundTripTime() const { return min_round_trip_time_; }
+
+    // The idle samples which are required to raise the level. Kept between the sessions with
+    // the host, so the level which the link did not carry is not tried again soon.
+    int upgradeSamples() const { return upgrade_samples_; }
+    void setUpgradeSamples(int upgrade_samples);
+
+private:
+    struct Level
+    {
+        proto::desktop::VideoEncoding video_encoding;
+
+        // Used if the host does not support |video_encoding|.
+        proto::desktop::VideoEncoding fallback_encoding;
+
+        bool high_color;
+        int compress_ratio;
+    };
+
+    // Returns the encoding of |level| which is supported or VIDEO_ENCODING_UNKNOWN.
+    proto::desktop::VideoEncoding encoding(int level) const;
+
+    // Returns the level which is closest to |config|.
+    int currentLevel(const proto::desktop::Config& config) const;
+
+    // Returns the next supported level in |direction| (+1 or -1) from |level| or -1.
+    int nextLevel(int level, int direction) const;
+
+    void applyLevel(int level, proto::desktop::Config* config) const;
+
+    static const Level kLevels[];
+
+    const quint32 video_encodings_;
+    int level_ = -1;
+
+    // The minimal round trip time of the session.
+    qint64 min_round_trip_time_ = -1;
+    qint64 max_bitrate_ = 0;
+
+    // The number of the last measurements of the congested and idle link and of the slow
+    // encoder or decoder.
+    int congested_samples_ = 0;
+    int idle_samples_ = 0;
+    int slow_samples_ = 0;
+
+    // The idle samples which are required to raise the level. Doubled after each return to the
+    // lower level.
+    int upgrade_samples_;
+
+    Q_DISABLE_COPY(EncodingSelector)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_CLIENT__ENCODING_SELECTOR_H
@@ -0,0 +1,598 @@
+//
+// PROJECT:         Aspia
+// FILE:            client/file_multi_uploader.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "client/file_multi_uploader.h"
+
+#include <QFileInfo>
+
+#include <algorithm>
+#include <limits>
+
+#include "base/message_serialization.h"
+#include "client/client_user_authorizer.h"
+#include "client/file_status.h"
+#include "host/file_packetizer.h"
+#include "network/network_channel.h"
+
+namespace aspia {
+
+namespace {
+
+enum MessageId { RequestMessageId };
+
+// The packets are compressed once for all hosts, so the slower and better compression is
+// used. The large packets reduce the overhead of each message.
+constexpr qint64 kPacketSize = 1024 * 1024; // 1MB
+constexpr proto::file_transfer::PacketCompression kPacketCompression =
+    proto::file_transfer::PACKET_COMPRESSION_ZSTD;
+
+// The packets which are sent to one host and are not written by it yet.
+constexpr qint64 kMaxPendingSize = 8 * 1024 * 1024; // 8MB
+
+// The packets which are read and are not sent to all attached hosts yet. If the faster hosts
+// need more, then the slowest hosts are detached.
+constexpr qint64 kMaxSharedSize = 64 * 1024 * 1024; // 64MB
+
+// The sizes of the transfer are counted without the compression.
+qint64 packetDataSize(const proto::file_transfer::Packet& packet)
+{
+    if (packet.compression() != proto::file_transfer::PACKET_COMPRESSION_NONE)
+        return packet.data_size();
+
+    return packet.data().size();
+}
+
+QByteArray packetMessage(std::unique_ptr<proto::file_transfer::Packet> packet)
+{
+    proto::file_transfer::Request request;
+    request.set_allocated_packet(packet.release());
+    return serializeMessage(request);
+}
+
+} // namespace
+
+struct FileMultiUploader::Target
+{
+    enum class State { CONNECTING, CREATING, SENDING, FINISHED };
+
+    // The request which is sent and is not replied yet.
+    struct PendingRequest
+    {
+        qint64 size = 0;
+        bool last = false;
+    };
+
+    explicit Target(const ConnectData& connect_data)
+        : connect_data(connect_data)
+    {
+        this->connect_data.setSessionType(proto::auth::SESSION_TYPE_FILE_TRANSFER);
+    }
+
+    ConnectData connect_data;
+    State state = State::CONNECTING;
+    QString status_string;
+    bool succeeded = false;
+
+    QPointer<NetworkChannel> channel;
+    QPointer<ClientUserAuthorizer> authorizer;
+
+    // The replies are received in the order of the requests.
+    std::deque<PendingRequest> pending;
+    qint64 pending_size = 0;
+    qint64 written_size = 0;
+    bool last_sent = false;
+
+    // The index of the next shared packet. The detached target reads the file from
+    // |detached_offset| by its own packetizer.
+    size_t next_packet = 0;
+    bool detached = false;
+    qint64 detached_offset = 0;
+    std::unique_ptr<FilePacketizer> packetizer;
+};
+
+FileMultiUploader::FileMultiUploader(const QString& source_path,
+                                     const QString& target_path,
+                                     bool overwrite,
+                                     const QVector<ConnectData>& computers,
+                                     QObject* parent)
+    : QObject(parent),
+      source_path_(source_path),
+      target_path_(target_path),
+      overwrite_(overwrite)
+{
+    for (const auto& connect_data : computers)
+        targets_.push_back(std::make_unique<Target>(connect_data));
+}
+
+FileMultiUploader::~FileMultiUploader()
+{
+    // The channels are deleted as the children.
+    for (auto& target : targets_)
+        delete target->authorizer;
+}
+
+void FileMultiUploader::start()
+{
+    active_count_ = targetCount();
+
+    file_size_ = QFileInfo(source_path_).size();
+
+    packetizer_ = FilePacketizer::create(source_path_);
+    if (!packetizer_)
+    {
+        failAll(tr("Failed to open file \"%1\"").arg(source_path_));
+        return;
+    }
+
+    for (int i = 0; i < targetCount(); ++i)
+    {
+        const ConnectData& connect_data = targets_[i]->connect_data;
+
+        // The authorizer asks the missing credentials by the dialog.
+        if (connect_data.userName().isEmpty() || connect_data.password().isEmpty())
+        {
+            finishTarget(i, tr("The user name or the password is not specified."));
+            continue;
+        }
+
+        connectToHost(i);
+    }
+}
+
+const ConnectData& FileMultiUploader::connectData(int index) const
+{
+    return targets_[index]->connect_data;
+}
+
+int FileMultiUploader::progress(int index) const
+{
+    const Target& target = *targets_[index];
+
+    if (!file_size_)
+        return target.last_sent && target.pending.empty() ? 100 : 0;
+
+    return static_cast<int>(target.written_size * 100 / file_size_);
+}
+
+QString FileMultiUploader::statusString(int index) const
+{
+    return targets_[index]->status_string;
+}
+
+bool FileMultiUploader::isFinished(int index) const
+{
+    return targets_[index]->state == Target::State::FINISHED;
+}
+
+bool FileMultiUploader::isSucceeded(int index) const
+{
+    return targets_[index]->succeeded;
+}
+
+void FileMultiUploader::connectToHost(int index)
+{
+    Target& target = *targets_[index];
+
+    target.channel = NetworkChannel::createClient(this);
+
+    connect(target.channel, &NetworkChannel::connected, this, [this, index]()
+    {
+        onChannelConnected(index);
+    });
+
+    connect(target.channel, &NetworkChannel::disconnected, this, [this, index]()
+    {
+        finishTarget(index, tr("Disconnected."));
+    });
+
+    connect(target.channel, &NetworkChannel::errorOccurred, this,
+            [this, index](const QString& message)
+    {
+        finishTarget(index, tr("Network error: %1.").arg(message));
+    });
+
+    setStatus(index, tr("Connecting..."));
+    target.channel->connectToHost(target.connect_data.address(), target.connect_data.port());
+}
+
+void FileMultiUploader::onChannelConnected(int index)
+{
+    Target& target = *targets_[index];
+
+    target.authorizer = new ClientUserAuthorizer(nullptr);
+
+    target.authorizer->setSessionType(target.connect_data.sessionType());
+    target.authorizer->setUserName(target.connect_data.userName());
+    target.authorizer->setPassword(target.connect_data.password());
+
+    connect(target.authorizer, &ClientUserAuthorizer::writeMessage,
+            target.channel, &NetworkChannel::writeMessage);
+
+    connect(target.authorizer, &ClientUserAuthorizer::readMessage,
+            target.channel, &NetworkChannel::readMessage);
+
+    connect(target.channel, &NetworkChannel::messageReceived,
+            target.authorizer, &ClientUserAuthorizer::messageReceived);
+
+    connect(target.channel, &NetworkChannel::messageWritten,
+            target.authorizer, &ClientUserAuthorizer::messageWritten);
+
+    connect(target.authorizer, &ClientUserAuthorizer::finished,
+            this, [this, index](proto::auth::Status status)
+    {
+        onAuthorizationFinished(index, status);
+    });
+
+    setStatus(index, tr("Authorization..."));
+    target.authorizer->start();
+}
+
+void FileMultiUploader::onAuthorizationFinished(int index, proto::auth::Status status)
+{
+    Target& target = *targets_[index];
+
+    // The authorizer can not be deleted while it emits the signal.
+    target.authorizer->deleteLater();
+
+    switch (status)
+    {
+        case proto::auth::STATUS_SUCCESS:
+            break;
+
+        case proto::auth::STATUS_ACCESS_DENIED:
+            finishTarget(index, tr("Authorization error: Access denied."));
+            return;
+
+        case proto::auth::STATUS_CANCELED:
+            finishTarget(index, tr("Authorization has been canceled."));
+            return;
+
+        default:
+            finishTarget(index, tr("Authorization error: Unknown status code."));
+            return;
+    }
+
+    // The next messages belong to the session.
+    disconnect(target.channel, &NetworkChannel::messageReceived,
+               target.authorizer, &ClientUserAuthorizer::messageReceived);
+    disconnect(target.channel, &NetworkChannel::messageWritten,
+               target.authorizer, &ClientUserAuthorizer::messageWritten);
+
+    connect(target.channel, &NetworkChannel::messageReceived, this,
+            [this, index](const QByteArray& buffer)
+    {
+        onMessageReceived(index, buffer);
+    });
+
+    connect(target.channel, &NetworkChannel::messageWritten, this, [this, index]()
+    {
+        onMessageWritten(index);
+    });
+
+    proto::file_transfer::Request request;
+
+    proto::file_transfer::UploadRequest* upload_request = request.mutable_upload_request();
+    upload_request->set_path(target_path_.toStdString());
+    upload_request->set_overwrite(overwrite_);
+
+    target.state = Target::State::CREATING;
+    setStatus(index, tr("Creating the file..."));
+
+    sendRequest(index, serializeMessage(request), 0, false);
+}
+
+void FileMultiUploader::onMessageReceived(int index, const QByteArray& buffer)
+{
+    Target& target = *targets_[index];
+
+    proto::file_transfer::Reply reply;
+
+    if (!parseMessage(buffer, reply) || target.pending.empty())
+    {
+        finishTarget(index, tr("Session error: Invalid message from host."));
+        return;
+    }
+
+    const Target::PendingRequest request = target.pending.front();
+    target.pending.pop_front();
+    target.pending_size -= request.size;
+
+    if (reply.status() != proto::file_transfer::STATUS_SUCCESS)
+    {
+        if (target.state == Target::State::CREATING)
+        {
+            finishTarget(index, tr("Failed to create file \"%1\": %2")
+                         .arg(target_path_)
+                         .arg(fileStatusToString(reply.status())));
+        }
+        else
+        {
+            finishTarget(index, tr("Failed to write file \"%1\": %2")
+                         .arg(target_path_)
+                         .arg(fileStatusToString(reply.status())));
+        }
+
+        // The packets which were kept for this target are released.
+        sendPackets();
+        return;
+    }
+
+    if (target.state == Target::State::CREATING)
+    {
+        target.state = Target::State::SENDING;
+        setStatus(index, tr("Uploading..."));
+    }
+    else
+    {
+        const int old_progress = progress(index);
+        target.written_size += request.size;
+
+        if (request.last)
+        {
+            target.succeeded = true;
+            finishTarget(index, tr("Completed."));
+            sendPackets();
+            return;
+        }
+
+        if (progress(index) != old_progress)
+            emit targetChanged(index);
+    }
+
+    sendPackets();
+    readReply(index);
+}
+
+void FileMultiUploader::onMessageWritten(int index)
+{
+    readReply(index);
+}
+
+void FileMultiUploader::sendRequest(int index, const QByteArray& message, qint64 size, bool last)
+{
+    Target& target = *targets_[index];
+
+    Target::PendingRequest request;
+    request.size = size;
+    request.last = last;
+
+    target.pending.push_back(request);
+    target.pending_size += size;
+
+    // The buffer of the shared packet is not copied, all channels refer to the same data.
+    target.channel->writeMessage(RequestMessageId, message, LowPriority, FileMessage);
+}
+
+void FileMultiUploader::readReply(int index)
+{
+    Target& target = *targets_[index];
+
+    // Several requests can be sent before the replies to them are received.
+    if (target.pending.empty() || !target.channel || target.channel->isReadPending())
+        return;
+
+    target.channel->readMessage();
+}
+
+void FileMultiUploader::sendPackets()
+{
+    releaseSharedPackets();
+
+    for (int i = 0; i < targetCount(); ++i)
+    {
+        Target& target = *targets_[i];
+
+        while (target.state == Target::State::SENDING && !target.last_sent &&
+               target.pending_size < kMaxPendingSize)
+        {
+            if (!sendPacket(i))
+                break;
+        }
+    }
+
+    releaseSharedPackets();
+}
+
+bool FileMultiUploader::sendPacket(int index)
+{
+    Target& target = *targets_[index];
+
+    if (target.detached)
+    {
+        if (!target.packetizer)
+        {
+            target.packetizer = FilePacketizer::create(source_path_);
+
+            // The target which is detached before the first packet starts the file as usual.
+            if (!target.packetizer ||
+                (target.detached_offset && !target.packetizer->skip(target.detached_offset)))
+            {
+                finishTarget(index, tr("Failed to read file \"%1\"").arg(source_path_));
+                return false;
+            }
+        }
+
+        std::unique_ptr<proto::file_transfer::Packet> packet =
+            target.packetizer->readNextPacket(kPacketSize, kPacketCompression);
+        if (!packet)
+        {
+            finishTarget(index, tr("Failed to read file \"%1\"").arg(source_path_));
+            return false;
+        }
+
+        const qint64 size = packetDataSize(*packet);
+        const bool last = packet->flags() & proto::file_transfer::Packet::FLAG_LAST_PACKET;
+
+        if (last)
+        {
+            target.last_sent = true;
+            target.packetizer.reset();
+        }
+
+        sendRequest(index, packetMessage(std::move(packet)), size, last);
+        return true;
+    }
+
+    if (target.next_packet - shared_start_ == shared_packets_.size())
+    {
+        if (shared_size_ >= kMaxSharedSize)
+        {
+            detachSlowestTargets();
+
+            if (target.detached)
+                return true;
+
+            if (shared_size_ >= kMaxSharedSize)
+                return false;
+        }
+
+        if (!readSharedPacket())
+            return false;
+    }
+
+    const SharedPacket& packet = shared_packets_[target.next_packet - shared_start_];
+
+    ++target.next_packet;
+
+    if (packet.last)
+        target.last_sent = true;
+
+    sendRequest(index, packet.message, packet.size, packet.last);
+    return true;
+}
+
+bool FileMultiUploader::readSharedPacket()
+{
+    std::unique_ptr<proto::file_transfer::Packet> packet;
+
+    if (packetizer_)
+        packet = packetizer_->readNextPacket(kPacketSize, kPacketCompression);
+
+    if (!packet)
+    {
+        packetizer_.reset();
+
+        // The detached targets read the file by themselves.
+        for (int i = 0; i < targetCount(); ++i)
+        {
+            if (!targets_[i]->detached)
+                finishTarget(i, tr("Failed to read file \"%1\"").arg(source_path_));
+        }
+
+        return false;
+    }
+
+    SharedPacket shared_packet;
+    shared_packet.offset = read_offset_;
+    shared_packet.size = packetDataSize(*packet);
+    shared_packet.last = packet->flags() & proto::file_transfer::Packet::FLAG_LAST_PACKET;
+    shared_packet.message = packetMessage(std::move(packet));
+
+    read_offset_ += shared_packet.size;
+    shared_size_ += shared_packet.message.size();
+
+    if (shared_packet.last)
+        packetizer_.reset();
+
+    shared_packets_.push_back(std::move(shared_packet));
+    return true;
+}
+
+void FileMultiUploader::detachSlowestTargets()
+{
+    size_t slowest_packet = std::numeric_limits<size_t>::max();
+
+    for (const auto& target : targets_)
+    {
+        if (target->state != Target::State::FINISHED && !target->detached)
+            slowest_packet = std::min(slowest_packet, target->next_packet);
+    }
+
+    const size_t index = slowest_packet - shared_start_;
+    if (slowest_packet == std::numeric_limits<size_t>::max() || index >= shared_packets_.size())
+        return;
+
+    // The targets which are still connecting are the slowest ones too.
+    const qint64 offset = shared_packets_[index].offset;
+
+    for (auto& target : targets_)
+    {
+        if (target->state != Target::State::FINISHED && !target->detached &&
+            target->next_packet == slowest_packet)
+        {
+            target->detached = true;
+            target->detached_offset = offset;
+        }
+    }
+
+    releaseSharedPackets();
+}
+
+void FileMultiUploader::releaseSharedPackets()
+{
+    size_t first_packet = shared_start_ + shared_packets_.size();
+
+    for (const auto& target : targets_)
+    {
+        if (target->state != Target::State::FINISHED && !target->detached)
+            first_packet = std::min(first_packet, target->next_packet);
+    }
+
+    while (shared_start_ < first_packet)
+    {
+        shared_size_ -= shared_packets_.front().message.size();
+        shared_packets_.pop_front();
+        ++shared_start_;
+    }
+}
+
+void FileMultiUploader::setStatus(int index, const QString& status_string)
+{
+    targets_[index]->status_string = status_string;
+    emit targetChanged(index);
+}
+
+void FileMultiUploader::finishTarget(int index, const QString& status_string)
+{
+    Target& target = *targets_[index];
+
+    if (target.state == Target::State::FINISHED)
+        return;
+
+    target.state = Target::State::FINISHED;
+    target.packetizer.reset();
+
+    if (target.channel)
+    {
+        target.channel->disconnect(this);
+        target.channel->stop();
+        target.channel->deleteLater();
+        target.channel = nullptr;
+    }
+
+    if (target.authorizer)
+    {
+        target.authorizer->deleteLater();
+        target.authorizer = nullptr;
+    }
+
+    setStatus(index, status_string);
+
+    if (!--active_count_)
+    {
+        packetizer_.reset();
+        emit finished();
+    }
+}
+
+void FileMultiUploader::failAll(const QString& status_string)
+{
+    for (int i = 0; i < targetCount(); ++i)
+        finishTarget(i, status_string);
+}
+
+} // namespace aspia
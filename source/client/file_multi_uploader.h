@@ -0,0 +1,129 @@
+//
+// PROJECT:         Aspia
+// FILE:            client/file_multi_uploader.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CLIENT__FILE_MULTI_UPLOADER_H
+#define _ASPIA_CLIENT__FILE_MULTI_UPLOADER_H
+
+#include <QByteArray>
+#include <QPointer>
+#include <QVector>
+
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include "client/connect_data.h"
+#include "protocol/authorization.pb.h"
+#include "protocol/file_transfer_session.pb.h"
+
+namespace aspia {
+
+class ClientUserAuthorizer;
+class FilePacketizer;
+class NetworkChannel;
+
+//
+// Uploads one local file to many hosts at the same time. Each packet of the file is read,
+// compressed and serialized once and the same message is sent to all hosts. The packets are
+// kept until they are sent to all hosts, and each host has its own limit of the packets which
+// are sent and not written yet. If the slowest hosts keep too many packets, then they are
+// detached from the shared packets and read the rest of the file by themselves, so they do
+// not stall the faster hosts. The credentials must be in the connection data, because they
+// are not asked.
+//
+class FileMultiUploader : public QObject
+{
+    Q_OBJECT
+
+public:
+    // |target_path| is the full path of the file on the hosts. If |overwrite| is true, then
+    // the existing files are replaced.
+    FileMultiUploader(const QString& source_path,
+                      const QString& target_path,
+                      bool overwrite,
+                      const QVector<ConnectData>& computers,
+                      QObject* parent);
+    ~FileMultiUploader();
+
+    void start();
+
+    const QString& sourcePath() const { return source_path_; }
+    const QString& targetPath() const { return target_path_; }
+
+    int targetCount() const { return static_cast<int>(targets_.size()); }
+    const ConnectData& connectData(int index) const;
+
+    // The percentage of the file which is written by the host.
+    int progress(int index) const;
+
+    // The state of the upload or the error.
+    QString statusString(int index) const;
+
+    bool isFinished(int index) const;
+
+    // The file is written completely by the host.
+    bool isSucceeded(int index) const;
+
+signals:
+    void targetChanged(int index);
+
+    // All hosts have finished or failed.
+    void finished();
+
+private:
+    struct Target;
+
+    // The packet of the shared reading which starts at |offset| of the file.
+    struct SharedPacket
+    {
+        QByteArray message;
+        qint64 offset = 0;
+        qint64 size = 0;
+        bool last = false;
+    };
+
+    void connectToHost(int index);
+    void onChannelConnected(int index);
+    void onAuthorizationFinished(int index, proto::auth::Status status);
+    void onMessageReceived(int index, const QByteArray& buffer);
+    void onMessageWritten(int index);
+
+    void sendRequest(int index, const QByteArray& message, qint64 size, bool last);
+    void readReply(int index);
+    void sendPackets();
+    bool sendPacket(int index);
+    bool readSharedPacket();
+    void detachSlowestTargets();
+    void releaseSharedPackets();
+
+    void setStatus(int index, const QString& status_string);
+    void finishTarget(int index, const QString& status_string);
+    void failAll(const QString& status_string);
+
+    const QString source_path_;
+    const QString target_path_;
+    const bool overwrite_;
+
+    std::vector<std::unique_ptr<Target>> targets_;
+
+    // The packets which are read and not sent to all attached targets yet.
+    // |shared_start_| is the index of the first of them in the file.
+    std::unique_ptr<FilePacketizer> packetizer_;
+    std::deque<SharedPacket> shared_packets_;
+    size_t shared_start_ = 0;
+    qint64 shared_size_ = 0;
+    qint64 read_offset_ = 0;
+    qint64 file_size_ = 0;
+
+    int active_count_ = 0;
+
+    Q_DISABLE_COPY(FileMultiUploader)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_CLIENT__FILE_MULTI_UPLOADER_H
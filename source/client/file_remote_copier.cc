@@ -0,0 +1,94 @@
+//
+// PROJECT:         Aspia
+// FILE:            client/file_remote_copier.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "client/file_remote_copier.h"
+
+#include "client/file_status.h"
+
+namespace aspia {
+
+namespace {
+
+const char* kReplySlot = "reply";
+
+QString appendPath(const QString& directory_path, const QString& name)
+{
+    if (directory_path.endsWith(QLatin1Char('/')) || directory_path.endsWith(QLatin1Char('\\')))
+        return directory_path + name;
+
+    return directory_path + QLatin1Char('/') + name;
+}
+
+} // namespace
+
+FileRemoteCopier::FileRemoteCopier(const ConnectData& target, bool overwrite, QObject* parent)
+    : QObject(parent),
+      target_(target),
+      overwrite_(overwrite)
+{
+    // Nothing
+}
+
+void FileRemoteCopier::start(const QString& source_path,
+                             const QString& target_path,
+                             const QStringList& file_names)
+{
+    source_path_ = source_path;
+    target_path_ = target_path;
+    file_names_ = file_names;
+    current_index_ = -1;
+    errors_.clear();
+
+    copyNextFile();
+}
+
+void FileRemoteCopier::cancel()
+{
+    // The file which is copied now is finished by the host.
+    file_names_ = file_names_.mid(0, current_index_ + 1);
+}
+
+void FileRemoteCopier::reply(const proto::file_transfer::Request& request,
+                             const proto::file_transfer::Reply& reply)
+{
+    if (!request.has_remote_copy_request())
+        return;
+
+    if (reply.status() != proto::file_transfer::STATUS_SUCCESS)
+    {
+        QString error_string = QString::fromStdString(reply.error_string());
+        if (error_string.isEmpty())
+            error_string = fileStatusToString(reply.status());
+
+        errors_.append(QStringLiteral("%1: %2").arg(file_names_[current_index_]).arg(error_string));
+    }
+
+    copyNextFile();
+}
+
+void FileRemoteCopier::copyNextFile()
+{
+    ++current_index_;
+
+    if (current_index_ >= file_names_.size())
+    {
+        emit finished(errors_);
+        return;
+    }
+
+    const QString& file_name = file_names_[current_index_];
+
+    emit currentItemChanged(current_index_, file_name);
+    emit request(FileRequest::remoteCopyRequest(this,
+                                                appendPath(source_path_, file_name),
+                                                target_,
+                                                appendPath(target_path_, file_name),
+                                                overwrite_,
+                                                kReplySlot));
+}
+
+} // namespace aspia
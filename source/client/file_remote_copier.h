@@ -0,0 +1,70 @@
+//
+// PROJECT:         Aspia
+// FILE:            client/file_remote_copier.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CLIENT__FILE_REMOTE_COPIER_H
+#define _ASPIA_CLIENT__FILE_REMOTE_COPIER_H
+
+#include <QStringList>
+
+#include "client/connect_data.h"
+#include "host/file_request.h"
+#include "protocol/file_transfer_session.pb.h"
+
+namespace aspia {
+
+//
+// Copies the files of the host to another host. The client only sends the requests, and the
+// host connects to the other host and uploads the files by itself, so the speed does not
+// depend on the connection of the client. The files are copied one by one.
+//
+class FileRemoteCopier : public QObject
+{
+    Q_OBJECT
+
+public:
+    FileRemoteCopier(const ConnectData& target, bool overwrite, QObject* parent);
+    ~FileRemoteCopier() = default;
+
+    // |file_names| are the names of the files in |source_path| which are copied to
+    // |target_path| of the other host.
+    void start(const QString& source_path,
+               const QString& target_path,
+               const QStringList& file_names);
+
+    // The files which are not copied yet are skipped.
+    void cancel();
+
+signals:
+    void request(FileRequest* request);
+    void currentItemChanged(int index, const QString& file_name);
+
+    // |errors| contains the descriptions of the files which are not copied.
+    void finished(const QStringList& errors);
+
+public slots:
+    void reply(const proto::file_transfer::Request& request,
+               const proto::file_transfer::Reply& reply);
+
+private:
+    void copyNextFile();
+
+    const ConnectData target_;
+    const bool overwrite_;
+
+    QString source_path_;
+    QString target_path_;
+    QStringList file_names_;
+    int current_index_ = -1;
+
+    QStringList errors_;
+
+    Q_DISABLE_COPY(FileRemoteCopier)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_CLIENT__FILE_REMOTE_COPIER_H
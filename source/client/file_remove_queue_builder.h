@@ -34,22 +34,12 @@ signals:
     // Signals an error when building a task queue. |message| contains a description of the error.
     void error(const QString& message);
 
-    // Signals an outbound request.
-    void request(FileRequest* request);
-
 public slots:
-    // Starts building of the task queue.
+    // Starts building of the task queue. The directories are not listed, they are removed
+    // with their items by one request.
     void start(const QString& path, const QList<FileRemover::Item>& items);
 
-    // Reads the reply to the request.
-    void reply(const proto::file_transfer::Request& request,
-               const proto::file_transfer::Reply& reply);
-
 private:
-    void processNextPendingTask();
-    void processError(const QString& message);
-
-    QQueue<FileRemoveTask> pending_tasks_;
     QQueue<FileRemoveTask> tasks_;
 
     Q_DISABLE_COPY(FileRemoveQueueBuilder)
@@ -40,9 +40,6 @@ void FileRemover::start(const QString& path, const QList<Item>& items)
     connect(builder_, &FileRemoveQueueBuilder::finished,
             builder_, &FileRemoveQueueBuilder::deleteLater);
 
-    connect(builder_, &FileRemoveQueueBuilder::request,
-            this, &FileRemover::request);
-
     builder_->start(path, items);
 }
 
@@ -139,7 +136,9 @@ void FileRemover::processTask()
     int percentage = (tasks_count_ - tasks_.size()) * 100 / tasks_count_;
 
     emit progressChanged(tasks_.front().path(), percentage);
-    emit request(FileRequest::removeRequest(this, tasks_.front().path(), kReplySlot));
+    // The directories are removed with their items by the side which has them.
+    emit request(FileRequest::removeRequest(
+        this, tasks_.front().path(), tasks_.front().isDirectory(), kReplySlot));
 }
 
 void FileRemover::processNextTask()
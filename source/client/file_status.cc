@@ -51,6 +51,9 @@ QString fileStatusToString(proto::file_transfer::Status status)
         case proto::file_transfer::STATUS_FILE_READ_ERROR:
             return QCoreApplication::tr("Could not read file", "FileStatus");
 
+        case proto::file_transfer::STATUS_CANCELED:
+            return QCoreApplication::tr("Canceled", "FileStatus");
+
         default:
             return QCoreApplication::tr("Unknown status code", "FileStatus");
     }
@@ -16,6 +16,57 @@ namespace {
 
 const char* kSourceReplySlot = "sourceReply";
 const char* kTargetReplySlot = "targetReply";
+const char* kBatchSourceReplySlot = "batchSourceReply";
+const char* kBatchTargetReplySlot = "batchTargetReply";
+
+// The files which fit into one packet are read by one request to the source and written by
+// one request to the target. The requests of up to kMaxBatchFiles such files are sent
+// together, so the small files do not wait for the round trips of each other.
+constexpr qint64 kMaxSmallFileSize = 64 * 1024; // 64kB
+constexpr int kMaxBatchFiles = 32;
+
+// The packets of the file are requested from the source without waiting for the previous ones
+// to be written to the target while fewer bytes are requested and not written yet. So the
+// speed of the transfer is not limited by one packet per round trip. The limit is twice the
+// amount of data transferred during the round trip. The minimum is small, so the links which
+// are limited by the host do not keep the data of many seconds in the queue of the host.
+constexpr qint64 kMinPendingSize = 1024 * 1024; // 1MB
+constexpr qint64 kMaxPendingSize = 64 * 1024 * 1024; // 64MB
+
+// The size of the packets is chosen so that a packet is transferred for about this time at
+// the measured speed. On the fast links the large packets reduce the overhead of each message.
+constexpr qint64 kPacketDuration = 20; // 20ms
+
+// The interval of the measurement of the speed.
+constexpr qint64 kSpeedInterval = 500; // 500ms
+
+// Zstandard compresses better, but it is slower than LZ4. It does not keep up with the links
+// faster than this speed.
+constexpr qint64 kMaxZstdSpeed = 64 * 1024 * 1024; // 64MB/s
+
+// The directories with at least kMinArchiveFiles files of this average size or smaller are
+// transferred as one archive. The many small files do not need the requests of their own and
+// are compressed together.
+constexpr int kMinArchiveFiles = 16;
+constexpr qint64 kMaxArchiveAverageSize = 256 * 1024; // 256kB
+
+// The overwritten files of this size and larger are replaced by sending only the blocks which
+// the existing file does not contain.
+constexpr qint64 kMinDeltaFileSize = 1024 * 1024; // 1MB
+
+// The packets are passed from the source to the target as they are. The sizes of the
+// transfer are counted without the compression and include the copied blocks and the zeros.
+qint64 packetDataSize(const proto::file_transfer::Packet& packet)
+{
+    qint64 size = packet.copied_size() + packet.zero_size();
+
+    if (packet.compression() != proto::file_transfer::PACKET_COMPRESSION_NONE)
+        size += packet.data_size();
+    else
+        size += packet.data().size();
+
+    return size;
+}
 
 } // namespace
 
@@ -31,7 +82,8 @@ FileTransfer::FileTransfer(Type type, QObject* parent)
     actions_.insert(FileOpenError,
                     QPair<Actions, Action>(Abort | Skip | SkipAll, Ask));
     actions_.insert(FileAlreadyExists,
-                    QPair<Actions, Action>(Abort | Skip | SkipAll | Replace | ReplaceAll, Ask));
+                    QPair<Actions, Action>(Abort | Skip | SkipAll | Replace | ReplaceAll |
+                                           Resume | ResumeAll, Ask));
     actions_.insert(FileWriteError,
                     QPair<Actions, Action>(Abort | Skip | SkipAll, Ask));
     actions_.insert(FileReadError,
@@ -84,6 +136,30 @@ FileTransferTask& FileTransfer::currentTask()
     return tasks_.front();
 }
 
+void FileTransfer::setFixedPacketSize(qint64 packet_size)
+{
+    fixed_packet_size_ = packet_size;
+
+    if (fixed_packet_size_)
+        packet_size_ = fixed_packet_size_;
+}
+
+void FileTransfer::setFixedPendingSize(qint64 pending_size)
+{
+    fixed_pending_size_ = pending_size;
+}
+
+void FileTransfer::setRemoteBlocked(bool blocked)
+{
+    remote_blocked_ = blocked;
+
+    if (!remote_blocked_ && packets_deferred_)
+    {
+        packets_deferred_ = false;
+        requestPackets();
+    }
+}
+
 void FileTransfer::targetReply(const proto::file_transfer::Request& request,
                                const proto::file_transfer::Reply& reply)
 {
@@ -105,6 +181,12 @@ void FileTransfer::targetReply(const proto::file_transfer::Request& request,
     {
         if (reply.status() != proto::file_transfer::STATUS_SUCCESS)
         {
+            if (archive_)
+            {
+                cancelArchive();
+                return;
+            }
+
             Error error_type = FileCreateError;
 
             if (reply.status() == proto::file_transfer::STATUS_PATH_ALREADY_EXISTS)
@@ -117,45 +199,59 @@ void FileTransfer::targetReply(const proto::file_transfer::Request& request,
             return;
         }
 
-        sourceRequest(FileRequest::packetRequest(this, kSourceReplySlot));
+        // The source continues from the end of the written part if it matches or sends only
+        // the blocks which the overwritten file does not contain.
+        partial_file_.Clear();
+        signature_.Clear();
+
+        // The blocks of zeros are not sent if the target can write them by itself.
+        zero_ranges_ = reply.zero_ranges();
+
+        if (reply.has_partial_file())
+            partial_file_ = reply.partial_file();
+        else if (reply.has_signature())
+            signature_ = reply.signature();
+
+        requestPackets();
     }
     else if (request.has_packet())
     {
+        const qint64 packet_size = packetDataSize(request.packet());
+
+        --pending_packets_;
+        unwritten_size_ -= packet_size;
+
         if (reply.status() != proto::file_transfer::STATUS_SUCCESS)
         {
-            processError(FileWriteError,
-                         tr("Failed to write file \"%1\": %2")
-                         .arg(currentTask().targetPath())
-                         .arg(fileStatusToString(reply.status())));
+            packetError(FileWriteError,
+                        tr("Failed to write file \"%1\": %2")
+                        .arg(currentTask().targetPath())
+                        .arg(fileStatusToString(reply.status())));
             return;
         }
 
-        if (currentTask().size() && total_size_)
+        if (packet_error_)
         {
-            qint64 packet_size = request.packet().data().size();
-
-            task_transfered_size_ += packet_size;
-            total_transfered_size_ += packet_size;
-
-            int task_percentage = task_transfered_size_ * 100 / currentTask().size();
-            int total_percentage = total_transfered_size_ * 100 / total_size_;
+            processPacketError();
+            return;
+        }
 
-            if (task_percentage != task_percentage_ || total_percentage != total_percentage_)
-            {
-                task_percentage_ = task_percentage;
-                total_percentage_ = total_percentage;
+        if (archive_)
+            addArchiveFiles(reply);
 
-                emit progressChanged(total_percentage_, task_percentage_);
-            }
-        }
+        updateSpeed(request.packet());
+        updateProgress(packet_size);
 
         if (request.packet().flags() & proto::file_transfer::Packet::FLAG_LAST_PACKET)
         {
+            if (archive_)
+                requeueArchiveFiles();
+
             processNextTask();
             return;
         }
 
-        sourceRequest(FileRequest::packetRequest(this, kSourceReplySlot));
+        requestPackets();
     }
     else
     {
@@ -170,6 +266,12 @@ void FileTransfer::sourceReply(const proto::file_transfer::Request& request,
     {
         if (reply.status() != proto::file_transfer::STATUS_SUCCESS)
         {
+            if (archive_)
+            {
+                cancelArchive();
+                return;
+            }
+
             processError(FileOpenError,
                          tr("Failed to open file \"%1\": %2")
                          .arg(currentTask().sourcePath()
@@ -177,24 +279,67 @@ void FileTransfer::sourceReply(const proto::file_transfer::Request& request,
             return;
         }
 
+        if (archive_)
+        {
+            // The existing files are replaced only if it is already chosen by the user. The
+            // others are reported by the target and transferred after the archive.
+            targetRequest(FileRequest::archiveUploadRequest(
+                this,
+                currentTask().targetPath(),
+                defaultAction(FileAlreadyExists) == ReplaceAll,
+                kTargetReplySlot));
+            return;
+        }
+
         targetRequest(FileRequest::uploadRequest(
             this,
             currentTask().targetPath(),
             currentTask().overwrite(),
+            currentTask().resume(),
+            useDelta(),
             kTargetReplySlot));
     }
     else if (request.has_packet_request())
     {
+        unanswered_size_ -= request.packet_request().packet_size();
+
         if (reply.status() != proto::file_transfer::STATUS_SUCCESS)
         {
-            processError(FileReadError,
-                         tr("Failed to read file \"%1\": %2")
-                         .arg(currentTask().sourcePath())
-                         .arg(fileStatusToString(reply.status())));
+            --pending_packets_;
+
+            packetError(FileReadError,
+                        tr("Failed to read file \"%1\": %2")
+                        .arg(currentTask().sourcePath())
+                        .arg(fileStatusToString(reply.status())));
             return;
         }
 
-        targetRequest(FileRequest::packet(this, reply.packet(), kTargetReplySlot));
+        if (packet_error_)
+        {
+            // The packets which were requested before the error are not written.
+            --pending_packets_;
+            processPacketError();
+            return;
+        }
+
+        const proto::file_transfer::Packet& packet = reply.packet();
+
+        if (packet.flags() & proto::file_transfer::Packet::FLAG_FIRST_PACKET)
+        {
+            file_size_ = packet.file_size();
+
+            // The part of the resumed file is already transferred.
+            received_size_ = packet.offset();
+            updateProgress(packet.offset());
+        }
+
+        const qint64 packet_size = packetDataSize(packet);
+
+        received_size_ += packet_size;
+        unwritten_size_ += packet_size;
+
+        targetRequest(FileRequest::packet(this, packet, kTargetReplySlot));
+        requestPackets();
     }
     else
     {
@@ -202,6 +347,49 @@ void FileTransfer::sourceReply(const proto::file_transfer::Request& request,
     }
 }
 
+void FileTransfer::batchSourceReply(const proto::file_transfer::Request& /* request */,
+                                    const proto::file_transfer::Reply& reply)
+{
+    // The replies to the batch which was aborted.
+    if (batch_replies_ >= static_cast<int>(batch_.size()))
+        return;
+
+    const int index = batch_replies_++;
+    BatchFile& file = batch_[index];
+
+    file.source_status = reply.status();
+
+    if (reply.status() == proto::file_transfer::STATUS_SUCCESS && reply.has_packet() &&
+        (reply.packet().flags() & proto::file_transfer::Packet::FLAG_LAST_PACKET))
+    {
+        const FileTransferTask& task = tasks_[index];
+
+        file.single_packet = true;
+        file.size = packetDataSize(reply.packet());
+
+        batch_targets_.enqueue(index);
+        ++batch_pending_;
+
+        targetRequest(FileRequest::uploadRequest(
+            this, task.targetPath(), task.overwrite(), reply.packet(), kBatchTargetReplySlot));
+    }
+
+    if (!--batch_pending_)
+        processBatch();
+}
+
+void FileTransfer::batchTargetReply(const proto::file_transfer::Request& /* request */,
+                                    const proto::file_transfer::Reply& reply)
+{
+    if (batch_targets_.isEmpty())
+        return;
+
+    batch_[batch_targets_.dequeue()].target_status = reply.status();
+
+    if (!--batch_pending_)
+        processBatch();
+}
+
 void FileTransfer::taskQueueError(const QString& message)
 {
     emit error(this, OtherError, message);
@@ -237,6 +425,17 @@ void FileTransfer::applyAction(Error error_type, Action action)
         }
         break;
 
+        case Action::Resume:
+        case Action::ResumeAll:
+        {
+            if (action == Action::ResumeAll)
+                setDefaultAction(error_type, action);
+
+            currentTask().setResume(true);
+            processTask(true);
+        }
+        break;
+
         case Action::Skip:
         case Action::SkipAll:
         {
@@ -254,10 +453,41 @@ void FileTransfer::applyAction(Error error_type, Action action)
 }
 
 void FileTransfer::processTask(bool overwrite)
+{
+    if (!overwrite)
+    {
+        // The results of the files which are transferred together are processed in order.
+        if (!batch_.empty())
+        {
+            processBatch();
+            return;
+        }
+
+        if (startBatch())
+            return;
+    }
+
+    startTask(overwrite);
+}
+
+void FileTransfer::startTask(bool overwrite)
 {
     task_percentage_ = 0;
     task_transfered_size_ = 0;
 
+    // The size of the packets and the speed are kept from the previous tasks.
+    file_size_ = -1;
+    received_size_ = 0;
+    unanswered_size_ = 0;
+    unwritten_size_ = 0;
+    pending_packets_ = 0;
+    packets_deferred_ = false;
+    packet_error_ = false;
+
+    archive_ = false;
+    archive_tasks_.clear();
+    archive_files_.clear();
+
     FileTransferTask& task = currentTask();
 
     task.setOverwrite(overwrite);
@@ -265,9 +495,17 @@ void FileTransfer::processTask(bool overwrite)
     emit currentItemChanged(task.sourcePath(), task.targetPath());
 
     if (task.isDirectory())
-        targetRequest(FileRequest::createDirectoryRequest(this, task.targetPath(), kTargetReplySlot));
+    {
+        if (startArchive())
+            return;
+
+        targetRequest(FileRequest::createDirectoryRequest(
+            this, task.targetPath(), kTargetReplySlot));
+    }
     else
+    {
         sourceRequest(FileRequest::downloadRequest(this, task.sourcePath(), kSourceReplySlot));
+    }
 }
 
 void FileTransfer::processNextTask()
@@ -299,6 +537,365 @@ void FileTransfer::processError(Error error_type, const QString& message)
     emit error(this, error_type, message);
 }
 
+bool FileTransfer::startBatch()
+{
+    int count = 0;
+
+    while (count < kMaxBatchFiles && count < tasks_.size())
+    {
+        const FileTransferTask& task = tasks_[count];
+
+        if (task.isDirectory() || task.size() > kMaxSmallFileSize)
+            break;
+
+        ++count;
+    }
+
+    if (count < 2)
+        return false;
+
+    // The existing files are replaced only if it is already chosen by the user.
+    const bool overwrite = defaultAction(FileAlreadyExists) == ReplaceAll;
+
+    batch_.assign(count, BatchFile());
+    batch_replies_ = 0;
+    batch_targets_.clear();
+    batch_pending_ = count;
+
+    for (int i = 0; i < count; ++i)
+    {
+        FileTransferTask& task = tasks_[i];
+
+        task.setOverwrite(overwrite);
+
+        sourceRequest(FileRequest::downloadRequest(
+            this, task.sourcePath(), kMaxSmallFileSize, packetCompression(),
+            kBatchSourceReplySlot));
+    }
+
+    return true;
+}
+
+bool FileTransfer::startArchive()
+{
+    if (!archive_supported_)
+        return false;
+
+    const QString directory_path = currentTask().sourcePath();
+
+    int count = 0;
+    int file_count = 0;
+    qint64 size = 0;
+
+    // The items of the directory and its subdirectories follow it in the queue.
+    for (int i = 1; i < tasks_.size(); ++i)
+    {
+        const FileTransferTask& task = tasks_[i];
+
+        if (!task.sourcePath().startsWith(directory_path))
+            break;
+
+        ++count;
+
+        if (!task.isDirectory())
+        {
+            ++file_count;
+            size += task.size();
+        }
+    }
+
+    if (file_count < kMinArchiveFiles || size / file_count > kMaxArchiveAverageSize)
+        return false;
+
+    archive_ = true;
+    archive_size_ = size;
+    archive_tasks_ = tasks_.mid(1, count);
+
+    tasks_.erase(tasks_.begin() + 1, tasks_.begin() + 1 + count);
+
+    sourceRequest(FileRequest::archiveDownloadRequest(this, directory_path, kSourceReplySlot));
+    return true;
+}
+
+void FileTransfer::cancelArchive()
+{
+    // The source or the target does not support the archives, so the items are transferred
+    // separately.
+    archive_supported_ = false;
+
+    for (int i = archive_tasks_.size() - 1; i >= 0; --i)
+        tasks_.insert(1, archive_tasks_[i]);
+
+    startTask(currentTask().overwrite());
+}
+
+void FileTransfer::addArchiveFiles(const proto::file_transfer::Reply& reply)
+{
+    for (const auto& path : reply.failed_files())
+        archive_files_.insert(QString::fromStdString(path));
+
+    // The existing files are not asked about if the user has chosen to skip them.
+    if (defaultAction(FileAlreadyExists) == SkipAll)
+        return;
+
+    for (const auto& path : reply.existing_files())
+        archive_files_.insert(QString::fromStdString(path));
+}
+
+void FileTransfer::requeueArchiveFiles()
+{
+    const int directory_size = currentTask().sourcePath().size();
+    int position = 1;
+
+    // The files keep the order of the list. Their sizes are counted once more.
+    for (const FileTransferTask& task : archive_tasks_)
+    {
+        if (task.isDirectory() || !archive_files_.contains(task.sourcePath().mid(directory_size)))
+            continue;
+
+        total_size_ += task.size();
+        tasks_.insert(position++, task);
+    }
+}
+
+void FileTransfer::processBatch()
+{
+    while (!batch_.empty())
+    {
+        const BatchFile file = batch_.front();
+        batch_.pop_front();
+
+        FileTransferTask& task = currentTask();
+
+        emit currentItemChanged(task.sourcePath(), task.targetPath());
+
+        if (file.source_status != proto::file_transfer::STATUS_SUCCESS)
+        {
+            if (file.source_status == proto::file_transfer::STATUS_FILE_READ_ERROR)
+            {
+                processError(FileReadError,
+                             tr("Failed to read file \"%1\": %2")
+                             .arg(task.sourcePath())
+                             .arg(fileStatusToString(file.source_status)));
+            }
+            else
+            {
+                processError(FileOpenError,
+                             tr("Failed to open file \"%1\": %2")
+                             .arg(task.sourcePath())
+                             .arg(fileStatusToString(file.source_status)));
+            }
+            return;
+        }
+
+        // The file has grown since the list of the tasks was built. It is transferred as
+        // a regular file.
+        if (!file.single_packet)
+        {
+            startTask(task.overwrite());
+            return;
+        }
+
+        if (file.target_status != proto::file_transfer::STATUS_SUCCESS)
+        {
+            Error error_type = FileCreateError;
+
+            if (file.target_status == proto::file_transfer::STATUS_PATH_ALREADY_EXISTS)
+                error_type = FileAlreadyExists;
+            else if (file.target_status == proto::file_transfer::STATUS_FILE_WRITE_ERROR)
+                error_type = FileWriteError;
+
+            processError(error_type,
+                         tr("Failed to create file \"%1\": %2")
+                         .arg(task.targetPath())
+                         .arg(fileStatusToString(file.target_status)));
+            return;
+        }
+
+        task_percentage_ = 0;
+        task_transfered_size_ = 0;
+
+        updateProgress(file.size);
+
+        tasks_.pop_front();
+    }
+
+    if (tasks_.isEmpty())
+    {
+        emit finished();
+        return;
+    }
+
+    processTask(false);
+}
+
+void FileTransfer::updateProgress(qint64 transfered_size)
+{
+    const qint64 task_size = archive_ ? archive_size_ : currentTask().size();
+
+    if (!task_size || !total_size_)
+        return;
+
+    // The archive also contains the headers of its items.
+    if (archive_)
+        transfered_size = qMin(transfered_size, task_size - task_transfered_size_);
+
+    task_transfered_size_ += transfered_size;
+    total_transfered_size_ += transfered_size;
+
+    int task_percentage = task_transfered_size_ * 100 / task_size;
+    int total_percentage = total_transfered_size_ * 100 / total_size_;
+
+    if (task_percentage != task_percentage_ || total_percentage != total_percentage_)
+    {
+        task_percentage_ = task_percentage;
+        total_percentage_ = total_percentage;
+
+        emit progressChanged(total_percentage_, task_percentage_);
+    }
+}
+
+void FileTransfer::requestPackets()
+{
+    if (packet_error_)
+        return;
+
+    if (remote_blocked_)
+    {
+        packets_deferred_ = true;
+        return;
+    }
+
+    // Only the first packet is requested until the size of the file is known.
+    if (file_size_ < 0)
+    {
+        if (!pending_packets_)
+        {
+            first_packet_timer_.start();
+            requestPacket();
+        }
+
+        return;
+    }
+
+    // The source can send smaller packets than requested. In this case more packets are
+    // requested after the replies.
+    const qint64 max_pending_size = maxPendingSize();
+
+    while (received_size_ + unanswered_size_ < file_size_ &&
+           unanswered_size_ + unwritten_size_ < max_pending_size)
+    {
+        requestPacket();
+    }
+}
+
+void FileTransfer::requestPacket()
+{
+    // The first request of the resumed or the overwritten file contains the part or the
+    // signature of the target file.
+    if (file_size_ < 0 && (partial_file_.size() || signature_.block_size()))
+    {
+        sourceRequest(FileRequest::packetRequest(this, packet_size_, packetCompression(),
+                                                 zero_ranges_, partial_file_, signature_,
+                                                 kSourceReplySlot));
+        signature_.Clear();
+    }
+    else
+    {
+        sourceRequest(FileRequest::packetRequest(
+            this, packet_size_, packetCompression(), zero_ranges_, kSourceReplySlot));
+    }
+
+    unanswered_size_ += packet_size_;
+    ++pending_packets_;
+}
+
+void FileTransfer::updateSpeed(const proto::file_transfer::Packet& packet)
+{
+    // Nothing else is transferred with the first packet, so its time is the round trip time.
+    if (packet.flags() & proto::file_transfer::Packet::FLAG_FIRST_PACKET)
+    {
+        round_trip_time_ = first_packet_timer_.elapsed();
+
+        speed_timer_.start();
+        speed_size_ = 0;
+        return;
+    }
+
+    speed_size_ += packetDataSize(packet);
+
+    const qint64 elapsed = speed_timer_.elapsed();
+    if (elapsed < kSpeedInterval)
+        return;
+
+    speed_ = speed_size_ * 1000 / elapsed;
+
+    speed_timer_.start();
+    speed_size_ = 0;
+
+    if (fixed_packet_size_)
+        return;
+
+    // The size is a power of two, so it does not change for small changes of the speed.
+    const qint64 packet_size = speed_ * kPacketDuration / 1000;
+
+    packet_size_ = FilePacketizer::kMinPacketSize;
+
+    while (packet_size_ * 2 <= packet_size && packet_size_ < FilePacketizer::kMaxPacketSize)
+        packet_size_ *= 2;
+}
+
+qint64 FileTransfer::maxPendingSize() const
+{
+    if (fixed_pending_size_)
+        return fixed_pending_size_;
+
+    const qint64 pending_size =
+        qBound(kMinPendingSize, speed_ * round_trip_time_ / 1000 * 2, kMaxPendingSize);
+
+    return qMax(pending_size, packet_size_ * 2);
+}
+
+bool FileTransfer::useDelta()
+{
+    const FileTransferTask& task = currentTask();
+
+    // The small files are sent faster than their signatures are calculated.
+    return task.overwrite() && !task.resume() && task.size() >= kMinDeltaFileSize;
+}
+
+proto::file_transfer::PacketCompression FileTransfer::packetCompression() const
+{
+    // Until the speed is measured it is assumed to be slow.
+    if (speed_ > kMaxZstdSpeed)
+        return proto::file_transfer::PACKET_COMPRESSION_LZ4;
+
+    return proto::file_transfer::PACKET_COMPRESSION_ZSTD;
+}
+
+void FileTransfer::packetError(Error error_type, const QString& message)
+{
+    if (!packet_error_)
+    {
+        packet_error_ = true;
+        packet_error_type_ = error_type;
+        packet_error_message_ = message;
+    }
+
+    processPacketError();
+}
+
+void FileTransfer::processPacketError()
+{
+    // The replies to the packets requested before the error must be received before the next
+    // task is started.
+    if (pending_packets_)
+        return;
+
+    packet_error_ = false;
+    processError(packet_error_type_, packet_error_message_);
+}
+
 void FileTransfer::sourceRequest(FileRequest* request)
 {
     if (type_ == Downloader)
@@ -8,12 +8,17 @@
 #ifndef _ASPIA_CLIENT__FILE_TRANSFER_H
 #define _ASPIA_CLIENT__FILE_TRANSFER_H
 
+#include <QElapsedTimer>
 #include <QQueue>
 #include <QPair>
 #include <QPointer>
 #include <QMap>
+#include <QSet>
+
+#include <deque>
 
 #include "client/file_transfer_task.h"
+#include "host/file_packetizer.h"
 #include "host/file_request.h"
 #include "protocol/file_transfer_session.pb.h"
 
@@ -50,7 +55,9 @@ public:
         Skip       = 2,
         SkipAll    = 4,
         Replace    = 5,
-        ReplaceAll = 6
+        ReplaceAll = 6,
+        Resume     = 8,
+        ResumeAll  = 16
     };
     Q_DECLARE_FLAGS(Actions, Action)
 
@@ -83,6 +90,15 @@ public:
 
     FileTransferTask& currentTask();
 
+    // If the sizes are not zero, then they are used instead of the sizes which are chosen
+    // from the measured speed. Used by the benchmark to compare the settings.
+    void setFixedPacketSize(qint64 packet_size);
+    void setFixedPendingSize(qint64 pending_size);
+
+    // The packets are not requested while the channel to the remote computer is blocked by
+    // its write queue. The requests are continued when it is unblocked.
+    void setRemoteBlocked(bool blocked);
+
 signals:
     void started();
     void finished();
@@ -97,13 +113,33 @@ private slots:
                      const proto::file_transfer::Reply& reply);
     void sourceReply(const proto::file_transfer::Request& request,
                     const proto::file_transfer::Reply& reply);
+    void batchSourceReply(const proto::file_transfer::Request& request,
+                          const proto::file_transfer::Reply& reply);
+    void batchTargetReply(const proto::file_transfer::Request& request,
+                          const proto::file_transfer::Reply& reply);
     void taskQueueError(const QString& message);
     void taskQueueReady();
 
 private:
     void processTask(bool overwrite);
+    void startTask(bool overwrite);
+    bool startBatch();
+    bool startArchive();
+    void cancelArchive();
+    void addArchiveFiles(const proto::file_transfer::Reply& reply);
+    void requeueArchiveFiles();
+    void processBatch();
+    void updateProgress(qint64 transfered_size);
     void processNextTask();
     void processError(Error error_type, const QString& message);
+    void requestPackets();
+    void requestPacket();
+    void updateSpeed(const proto::file_transfer::Packet& packet);
+    qint64 maxPendingSize() const;
+    bool useDelta();
+    proto::file_transfer::PacketCompression packetCompression() const;
+    void packetError(Error error_type, const QString& message);
+    void processPacketError();
     void sourceRequest(FileRequest* request);
     void targetRequest(FileRequest* request);
 
@@ -119,6 +155,69 @@ private:
 
     int total_percentage_ = 0;
     int task_percentage_ = 0;
+
+    // The packets of the current task. The size of the file is known from the first packet.
+    // |unanswered_size_| bytes are requested from the source and not received yet,
+    // |unwritten_size_| bytes are received and not written to the target yet.
+    qint64 file_size_ = -1;
+    qint64 received_size_ = 0;
+    qint64 unanswered_size_ = 0;
+    qint64 unwritten_size_ = 0;
+    int pending_packets_ = 0;
+
+    // The packets of the current task are requested after the channel is unblocked.
+    bool remote_blocked_ = false;
+    bool packets_deferred_ = false;
+
+    // The part of the resumed file which the target has already written or the signature of
+    // the overwritten file.
+    proto::file_transfer::PartialFile partial_file_;
+    proto::file_transfer::FileSignature signature_;
+
+    // The target writes the zero ranges of the packets.
+    bool zero_ranges_ = false;
+
+    // The size of the requested packets is chosen from the measured speed of the transfer
+    // and the round trip time.
+    qint64 packet_size_ = FilePacketizer::kMinPacketSize;
+    qint64 speed_ = 0; // Bytes per second.
+    qint64 round_trip_time_ = 0; // Milliseconds.
+    QElapsedTimer first_packet_timer_;
+    QElapsedTimer speed_timer_;
+    qint64 speed_size_ = 0;
+    qint64 fixed_packet_size_ = 0;
+    qint64 fixed_pending_size_ = 0;
+
+    // The results of the small files at the head of the queue which are transferred together.
+    // The replies of the source and of the target are received in the order of the requests.
+    struct BatchFile
+    {
+        proto::file_transfer::Status source_status = proto::file_transfer::STATUS_UNKNOWN;
+        proto::file_transfer::Status target_status = proto::file_transfer::STATUS_UNKNOWN;
+
+        // The source has sent the whole file in one packet of |size| bytes.
+        bool single_packet = false;
+        qint64 size = 0;
+    };
+
+    std::deque<BatchFile> batch_;
+    int batch_replies_ = 0;
+    QQueue<int> batch_targets_;
+    int batch_pending_ = 0;
+
+    // The directory at the head of the queue which is transferred as one archive. Its items
+    // are removed from the queue. The files which the target does not write are transferred
+    // separately after the archive, so the user is asked about them as usual.
+    bool archive_ = false;
+    bool archive_supported_ = true;
+    QList<FileTransferTask> archive_tasks_;
+    QSet<QString> archive_files_;
+    qint64 archive_size_ = 0;
+
+    // The error of a packet is processed when the replies to all pending packets are received.
+    bool packet_error_ = false;
+    Error packet_error_type_ = OtherError;
+    QString packet_error_message_;
 };
 
 Q_DECLARE_OPERATORS_FOR_FLAGS(FileTransfer::Actions)
@@ -0,0 +1,579 @@
+//
+// PROJECT:         Aspia
+// FILE:            client/file_transfer_bench_main.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "client/file_transfer_bench_main.h"
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QDebug>
+#include <QDir>
+#include <QDirIterator>
+#include <QElapsedTimer>
+#include <QEventLoop>
+#include <QFile>
+#include <QFileInfo>
+#include <QPointer>
+#include <QTemporaryDir>
+#include <QTextStream>
+#include <QThread>
+#include <QTimer>
+
+#include <functional>
+#include <map>
+#include <random>
+#include <vector>
+
+#include "base/message_serialization.h"
+#include "base/process_stats.h"
+#include "client/file_transfer.h"
+#include "host/file_request.h"
+#include "host/file_worker.h"
+#include "host/file_worker_thread.h"
+#include "network/loopback_channels.h"
+#include "network/network_channel.h"
+#include "network/network_server.h"
+#include "version.h"
+
+namespace aspia {
+
+namespace {
+
+enum MessageId { RequestMessageId, ReplyMessageId };
+
+constexpr int kDefaultPort = 28051;
+constexpr int kDefaultSmallFiles = 2000;
+constexpr int kDefaultSmallFileSize = 16 * 1024;
+constexpr int kDefaultHugeFileSize = 256; // In megabytes.
+constexpr int kDefaultLatency = 50; // In milliseconds.
+
+// The files are written by the blocks of this size.
+constexpr int kWriteBlockSize = 64 * 1024;
+
+// Zero means the size which is chosen by FileTransfer from the measured speed.
+const qint64 kDefaultPacketSizes[] = { 0, 64 * 1024, 1024 * 1024, 4 * 1024 * 1024 };
+const qint64 kDefaultWindows[] = { 0, 1024 * 1024, 8 * 1024 * 1024, 64 * 1024 * 1024 };
+
+const char kSmallDirectory[] = "small";
+const char kHugeFile[] = "huge.bin";
+
+struct Scenario
+{
+    QString name;
+    bool small_files;
+    bool huge_file;
+    bool latency; // The round trip time of the link is emulated.
+};
+
+const Scenario kScenarios[] =
+{
+    { QStringLiteral("small"),   true,  false, false },
+    { QStringLiteral("huge"),    false, true,  false },
+    { QStringLiteral("latency"), true,  true,  true  }
+};
+
+struct BenchConfig
+{
+    Scenario scenario;
+    qint64 packet_size;
+    qint64 window;
+    int latency; // Round trip time in milliseconds.
+};
+
+struct Statistics
+{
+    qint64 files = 0;
+    qint64 bytes = 0;
+    qint64 elapsed_time = 0; // In nanoseconds.
+    qint64 cpu_time = 0;     // In nanoseconds, the both sides of the transfer.
+};
+
+// The data of the files is random, so the transfer measures the packets and not the
+// compression.
+bool createFile(const QString& path, qint64 size, std::mt19937* random)
+{
+    QFile file(path);
+    if (!file.open(QFile::WriteOnly))
+    {
+        qWarning() << "Unable to create file" << path;
+        return false;
+    }
+
+    std::vector<quint32> block(kWriteBlockSize / sizeof(quint32));
+
+    while (size > 0)
+    {
+        for (auto& value : block)
+            value = (*random)();
+
+        const qint64 block_size = qMin(size, static_cast<qint64>(kWriteBlockSize));
+
+        if (file.write(reinterpret_cast<const char*>(block.data()), block_size) != block_size)
+        {
+            qWarning() << "Unable to write file" << path;
+            return false;
+        }
+
+        size -= block_size;
+    }
+
+    return true;
+}
+
+bool createSourceFiles(const QString& path, int small_files, int small_file_size,
+                       qint64 huge_file_size)
+{
+    QDir source(path);
+    if (!source.mkpath(kSmallDirectory))
+    {
+        qWarning() << "Unable to create directory" << source.filePath(kSmallDirectory);
+        return false;
+    }
+
+    std::mt19937 random;
+
+    for (int i = 0; i < small_files; ++i)
+    {
+        const QString file_path =
+            source.filePath(QStringLiteral("%1/%2.bin").arg(kSmallDirectory).arg(i));
+
+        if (!createFile(file_path, small_file_size, &random))
+            return false;
+    }
+
+    return createFile(source.filePath(kHugeFile), huge_file_size, &random);
+}
+
+// Adds the number and the size of the files in |path| or of the file |path| itself.
+void countFiles(const QString& path, qint64* files, qint64* bytes)
+{
+    const QFileInfo file_info(path);
+    if (file_info.isFile())
+    {
+        ++*files;
+        *bytes += file_info.size();
+        return;
+    }
+
+    QDirIterator it(path, QDir::Files, QDirIterator::Subdirectories);
+    while (it.hasNext())
+    {
+        it.next();
+
+        ++*files;
+        *bytes += it.fileInfo().size();
+    }
+}
+
+// Uploads the files of the scenario from |source_path| to |target_path|. The local requests
+// are executed by |local_worker| as in the file manager, the remote requests are sent through
+// the channels to FileWorkerThread as in the file transfer session of the host. The latency is
+// added to both directions of the client.
+bool runBenchmark(const BenchConfig& config,
+                  const QString& source_path,
+                  const QString& target_path,
+                  FileWorker* local_worker,
+                  NetworkChannel* host,
+                  NetworkChannel* client,
+                  Statistics* stats)
+{
+    QDir(target_path).removeRecursively();
+    if (!QDir().mkpath(target_path))
+    {
+        qWarning() << "Unable to create directory" << target_path;
+        return false;
+    }
+
+    QList<FileTransfer::Item> items;
+    qint64 expected_files = 0;
+    qint64 expected_bytes = 0;
+
+    if (config.scenario.small_files)
+    {
+        const QString path = QDir(source_path).filePath(kSmallDirectory);
+
+        qint64 files = 0;
+        qint64 bytes = 0;
+        countFiles(path, &files, &bytes);
+
+        items.push_back(FileTransfer::Item(kSmallDirectory, bytes, true));
+        expected_files += files;
+        expected_bytes += bytes;
+    }
+
+    if (config.scenario.huge_file)
+    {
+        const qint64 size = QFileInfo(QDir(source_path).filePath(kHugeFile)).size();
+
+        items.push_back(FileTransfer::Item(kHugeFile, size, false));
+        ++expected_files;
+        expected_bytes += size;
+    }
+
+    QEventLoop loop;
+    FileWorkerThread host_worker;
+    FileTransfer transfer(FileTransfer::Uploader, nullptr);
+
+    transfer.setFixedPacketSize(config.packet_size);
+    transfer.setFixedPendingSize(config.window);
+
+    std::map<quint64, QPointer<FileRequest>> requests;
+    quint64 last_request_id = 0;
+    quint64 last_host_request_id = 0;
+    bool failed = false;
+
+    auto fail = [&](const QString& message)
+    {
+        qWarning() << message;
+        failed = true;
+        loop.quit();
+    };
+
+    // The timers are stopped with the loop, so the delayed messages of the failed transfer
+    // refer to nothing.
+    auto delay = [&](const std::function<void()>& function)
+    {
+        if (!config.latency)
+        {
+            function();
+            return;
+        }
+
+        QTimer::singleShot(config.latency / 2, Qt::PreciseTimer, &loop, function);
+    };
+
+    auto dispatch_reply = [&](const QByteArray& buffer)
+    {
+        proto::file_transfer::Reply reply;
+        if (!parseMessage(buffer, reply))
+        {
+            fail(QStringLiteral("Invalid reply of the host"));
+            return;
+        }
+
+        auto request = requests.find(reply.request_id());
+        if (request == requests.end())
+        {
+            fail(QStringLiteral("Unexpected reply of the host"));
+            return;
+        }
+
+        if (request->second)
+        {
+            request->second->sendReply(reply);
+            delete request->second;
+        }
+
+        requests.erase(request);
+    };
+
+    // The host.
+    QObject::connect(host, &NetworkChannel::messageReceived, &loop,
+                     [&](const QByteArray& buffer)
+    {
+        proto::file_transfer::Request request;
+        if (!parseMessage(buffer, request))
+        {
+            fail(QStringLiteral("Invalid request of the client"));
+            return;
+        }
+
+        host_worker.addRequest(++last_host_request_id, request);
+        host->readMessage();
+    });
+
+    QObject::connect(&host_worker, &FileWorkerThread::replyReady, &loop,
+                     [&](quint64 /* request_id */, const QByteArray& reply)
+    {
+        host->writeMessage(ReplyMessageId, reply, LowPriority, FileMessage);
+    });
+
+    // The client.
+    QObject::connect(client, &NetworkChannel::messageReceived, &loop,
+                     [&](const QByteArray& buffer)
+    {
+        client->readMessage();
+        delay([&, buffer]() { dispatch_reply(buffer); });
+    });
+
+    QObject::connect(&transfer, &FileTransfer::localRequest,
+                     local_worker, &FileWorker::executeRequest);
+
+    QObject::connect(&transfer, &FileTransfer::remoteRequest, &loop, [&](FileRequest* request)
+    {
+        proto::file_transfer::Request message = request->request();
+        message.set_request_id(++last_request_id);
+
+        requests.emplace(message.request_id(), QPointer<FileRequest>(request));
+
+        const QByteArray buffer = serializeMessage(message);
+        delay([client, buffer]()
+        {
+            client->writeMessage(RequestMessageId, buffer, LowPriority, FileMessage);
+        });
+    });
+
+    QObject::connect(&transfer, &FileTransfer::error, &loop,
+                     [&](FileTransfer* /* transfer */, FileTransfer::Error error_type,
+                         const QString& message)
+    {
+        qWarning() << message;
+        failed = true;
+        transfer.applyAction(error_type, FileTransfer::Abort);
+    });
+
+    QObject::connect(&transfer, &FileTransfer::finished, &loop, &QEventLoop::quit);
+
+    auto stop_on_disconnect = [&]() { fail(QStringLiteral("The channel is disconnected")); };
+
+    QObject::connect(host, &NetworkChannel::disconnected, &loop, stop_on_disconnect);
+    QObject::connect(client, &NetworkChannel::disconnected, &loop, stop_on_disconnect);
+
+    host_worker.start();
+
+    // The reading of the previous measurement can be still pending.
+    if (!host->isReadPending())
+        host->readMessage();
+    if (!client->isReadPending())
+        client->readMessage();
+
+    QElapsedTimer timer;
+    const qint64 cpu_time = processCpuTime();
+
+    timer.start();
+
+    transfer.start(QDir::toNativeSeparators(source_path),
+                   QDir::toNativeSeparators(target_path),
+                   items);
+    loop.exec();
+
+    stats->elapsed_time = timer.nsecsElapsed();
+    stats->cpu_time = processCpuTime() - cpu_time;
+
+    if (failed)
+        return false;
+
+    countFiles(target_path, &stats->files, &stats->bytes);
+
+    if (stats->files != expected_files || stats->bytes != expected_bytes)
+    {
+        qWarning("The transferred files do not match the source files");
+        return false;
+    }
+
+    return true;
+}
+
+QString sizeString(qint64 size)
+{
+    if (!size)
+        return QStringLiteral("auto");
+
+    if (size % (1024 * 1024) == 0)
+        return QString::number(size / (1024 * 1024)) + QLatin1Char('M');
+
+    if (size % 1024 == 0)
+        return QString::number(size / 1024) + QLatin1Char('K');
+
+    return QString::number(size);
+}
+
+void printHeader(QTextStream& out)
+{
+    out << qSetFieldWidth(10) << right << "scenario" << "packet" << "window"
+        << qSetFieldWidth(10) << "files" << "mb/s" << "files/s" << "cpu_%" << "cpu_ns/b"
+        << qSetFieldWidth(0) << endl;
+}
+
+void printResult(QTextStream& out, const BenchConfig& config, const Statistics& stats)
+{
+    const double seconds = qMax(stats.elapsed_time, qint64(1)) / 1000000000.0;
+    const double bytes = qMax(stats.bytes, qint64(1));
+
+    out << qSetFieldWidth(10) << right << config.scenario.name
+        << sizeString(config.packet_size) << sizeString(config.window)
+        << stats.files
+        << fixed << qSetRealNumberPrecision(1)
+        << stats.bytes / seconds / (1024.0 * 1024.0) << stats.files / seconds
+        << stats.cpu_time * 100.0 / qMax(stats.elapsed_time, qint64(1))
+        << qSetRealNumberPrecision(2) << stats.cpu_time / bytes
+        << qSetFieldWidth(0) << endl;
+}
+
+} // namespace
+
+int fileTransferBenchMain(int argc, char *argv[])
+{
+    QCoreApplication application(argc, argv);
+    application.setOrganizationName(QStringLiteral("Aspia"));
+    application.setApplicationName(QStringLiteral("File Transfer Bench"));
+    application.setApplicationVersion(QStringLiteral(ASPIA_VERSION_STRING));
+
+    qRegisterMetaType<proto::file_transfer::Request>();
+    qRegisterMetaType<proto::file_transfer::Reply>();
+
+    const QCommandLineOption port_option = loopbackPortOption(kDefaultPort);
+    QCommandLineOption scenario_option(QStringLiteral("scenario"),
+                                       QStringLiteral("Scenario: small, huge or latency."),
+                                       QStringLiteral("scenario"));
+    QCommandLineOption files_option(QStringLiteral("files"),
+                                    QStringLiteral("Number of the small files."),
+                                    QStringLiteral("files"),
+                                    QString::number(kDefaultSmallFiles));
+    QCommandLineOption file_size_option(QStringLiteral("file-size"),
+                                        QStringLiteral("Size of the small files in bytes."),
+                                        QStringLiteral("size"),
+                                        QString::number(kDefaultSmallFileSize));
+    QCommandLineOption huge_size_option(QStringLiteral("huge-size"),
+                                        QStringLiteral("Size of the huge file in megabytes."),
+                                        QStringLiteral("size"),
+                                        QString::number(kDefaultHugeFileSize));
+    QCommandLineOption latency_option(QStringLiteral("latency"),
+                                      QStringLiteral("Round trip time of the latency scenario "
+                                                     "in milliseconds."),
+                                      QStringLiteral("latency"),
+                                      QString::number(kDefaultLatency));
+    QCommandLineOption packet_size_option(QStringLiteral("packet-size"),
+                                          QStringLiteral("Size of the packets in bytes, 0 for "
+                                                         "the size chosen from the speed."),
+                                          QStringLiteral("size"));
+    QCommandLineOption window_option(QStringLiteral("window"),
+                                     QStringLiteral("Maximum size of the packets in flight in "
+                                                    "bytes, 0 for the size chosen from the "
+                                                    "speed."),
+                                     QStringLiteral("size"));
+    QCommandLineOption directory_option(QStringLiteral("directory"),
+                                        QStringLiteral("Directory of the temporary files."),
+                                        QStringLiteral("path"),
+                                        QDir::tempPath());
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(
+        QStringLiteral("Measures the upload of the files through the encrypted network "
+                       "channel on the loopback connection. The CPU time includes the both "
+                       "sides of the transfer. Without the packet size and the window the "
+                       "typical settings are measured."));
+    parser.addHelpOption();
+    parser.addOption(port_option);
+    parser.addOption(scenario_option);
+    parser.addOption(files_option);
+    parser.addOption(file_size_option);
+    parser.addOption(huge_size_option);
+    parser.addOption(latency_option);
+    parser.addOption(packet_size_option);
+    parser.addOption(window_option);
+    parser.addOption(directory_option);
+    parser.process(application);
+
+    const int small_files = parser.value(files_option).toInt();
+    const int small_file_size = parser.value(file_size_option).toInt();
+    const qint64 huge_file_size = parser.value(huge_size_option).toLongLong() * 1024 * 1024;
+    const int latency = parser.value(latency_option).toInt();
+
+    if (small_files <= 0 || small_file_size < 0 || huge_file_size <= 0 || latency < 0)
+    {
+        qWarning("Invalid number of the files, size or latency");
+        return 1;
+    }
+
+    std::vector<qint64> packet_sizes;
+    if (parser.isSet(packet_size_option))
+        packet_sizes.push_back(parser.value(packet_size_option).toLongLong());
+    else
+        packet_sizes.assign(std::begin(kDefaultPacketSizes), std::end(kDefaultPacketSizes));
+
+    std::vector<qint64> windows;
+    if (parser.isSet(window_option))
+        windows.push_back(parser.value(window_option).toLongLong());
+    else
+        windows.assign(std::begin(kDefaultWindows), std::end(kDefaultWindows));
+
+    std::vector<BenchConfig> configs;
+
+    for (const auto& scenario : kScenarios)
+    {
+        if (parser.isSet(scenario_option) && parser.value(scenario_option) != scenario.name)
+            continue;
+
+        for (qint64 packet_size : packet_sizes)
+        {
+            for (qint64 window : windows)
+            {
+                if (packet_size < 0 || window < 0)
+                {
+                    qWarning("Invalid packet size or window");
+                    return 1;
+                }
+
+                BenchConfig config;
+                config.scenario = scenario;
+                config.packet_size = packet_size;
+                config.window = window;
+                config.latency = scenario.latency ? latency : 0;
+
+                configs.push_back(config);
+            }
+        }
+    }
+
+    if (configs.empty())
+    {
+        qWarning() << "Unknown scenario" << parser.value(scenario_option);
+        return 1;
+    }
+
+    QTemporaryDir directory(
+        QDir(parser.value(directory_option)).filePath(QStringLiteral("aspia_bench_XXXXXX")));
+    if (!directory.isValid())
+    {
+        qWarning("Unable to create the temporary directory");
+        return 1;
+    }
+
+    const QString source_path = directory.filePath(QStringLiteral("source"));
+    const QString target_path = directory.filePath(QStringLiteral("target"));
+
+    if (!createSourceFiles(source_path, small_files, small_file_size, huge_file_size))
+        return 1;
+
+    NetworkServer server;
+    NetworkChannel* host = nullptr;
+    NetworkChannel* client = nullptr;
+
+    if (!connectLoopbackChannels(&server, parser.value(port_option).toInt(), &host, &client))
+        return 1;
+
+    QThread local_thread;
+    FileWorker* local_worker = new FileWorker();
+    local_worker->moveToThread(&local_thread);
+    local_thread.start();
+
+    QTextStream out(stdout);
+    printHeader(out);
+
+    int result = 0;
+
+    for (const auto& config : configs)
+    {
+        Statistics stats;
+        if (!runBenchmark(config, source_path, target_path, local_worker, host, client, &stats))
+        {
+            qWarning() << "The measurement of the scenario" << config.scenario.name << "failed";
+            result = 1;
+            break;
+        }
+
+        printResult(out, config, stats);
+    }
+
+    local_thread.quit();
+    local_thread.wait();
+    delete local_worker;
+
+    return result;
+}
+
+} // namespace aspia
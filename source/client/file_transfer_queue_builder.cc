@@ -18,6 +18,9 @@ namespace {
 
 const char* kReplySlot = "reply";
 
+// The items of a directory and its subdirectories are received by parts of this size.
+constexpr int kFileListPart = 10000;
+
 QString normalizePath(const QString& path)
 {
     QString normalized_path = path;
@@ -49,7 +52,10 @@ void FileTransferQueueBuilder::start(const QString& source_path,
     emit started();
 
     for (const auto& item : items)
-        addPendingTask(source_path, target_path, item.name, item.is_directory, item.size);
+    {
+        pending_tasks_.push_back(
+            createTask(source_path, target_path, item.name, item.is_directory, item.size));
+    }
 
     processNextPendingTask();
 }
@@ -72,19 +78,25 @@ void FileTransferQueueBuilder::reply(const proto::file_transfer::Request& reques
         return;
     }
 
-    // If we get a list of files, then the last task is a directory.
-    const FileTransferTask& last_task = tasks_.back();
-    Q_ASSERT(last_task.isDirectory());
-
+    // The list contains the whole subtree of the directory. Each directory is before its
+    // items, so the directories are created before their files.
     for (int i = 0; i < reply.file_list().item_size(); ++i)
     {
         const proto::file_transfer::FileList::Item& item = reply.file_list().item(i);
 
-        addPendingTask(last_task.sourcePath(),
-                       last_task.targetPath(),
-                       QString::fromStdString(item.name()),
-                       item.is_directory(),
-                       item.size());
+        tasks_.push_back(createTask(list_source_path_,
+                                    list_target_path_,
+                                    QString::fromStdString(item.name()),
+                                    item.is_directory(),
+                                    item.size()));
+    }
+
+    if (reply.file_list().continuation_id())
+    {
+        emit request(FileRequest::fileListRequest(
+            this, list_source_path_, kFileListPart, reply.file_list().continuation_id(), true,
+            kReplySlot));
+        return;
     }
 
     processNextPendingTask();
@@ -108,7 +120,11 @@ void FileTransferQueueBuilder::processNextPendingTask()
         return;
     }
 
-    emit request(FileRequest::fileListRequest(this, current.sourcePath(), kReplySlot));
+    list_source_path_ = current.sourcePath();
+    list_target_path_ = current.targetPath();
+
+    emit request(FileRequest::fileListRequest(
+        this, list_source_path_, kFileListPart, 0, true, kReplySlot));
 }
 
 void FileTransferQueueBuilder::processError(const QString& message)
@@ -119,11 +135,12 @@ void FileTransferQueueBuilder::processError(const QString& message)
     emit finished();
 }
 
-void FileTransferQueueBuilder::addPendingTask(const QString& source_dir,
-                                              const QString& target_dir,
-                                              const QString& item_name,
-                                              bool is_directory,
-                                              qint64 size)
+// static
+FileTransferTask FileTransferQueueBuilder::createTask(const QString& source_dir,
+                                                      const QString& target_dir,
+                                                      const QString& item_name,
+                                                      bool is_directory,
+                                                      qint64 size)
 {
     QString source_path = normalizePath(source_dir) + item_name;
     QString target_path = normalizePath(target_dir) + item_name;
@@ -134,7 +151,7 @@ void FileTransferQueueBuilder::addPendingTask(const QString& source_dir,
         target_path = normalizePath(target_path);
     }
 
-    pending_tasks_.push_back(FileTransferTask(source_path, target_path, is_directory, size));
+    return FileTransferTask(source_path, target_path, is_directory, size);
 }
 
 } // namespace aspia
@@ -48,17 +48,23 @@ public slots:
                const proto::file_transfer::Reply& reply);
 
 private:
-    void addPendingTask(const QString& source_dir,
-                        const QString& target_dir,
-                        const QString& item_name,
-                        bool is_directory,
-                        qint64 size);
+    static FileTransferTask createTask(const QString& source_dir,
+                                       const QString& target_dir,
+                                       const QString& item_name,
+                                       bool is_directory,
+                                       qint64 size);
     void processNextPendingTask();
     void processError(const QString& message);
 
+    // The selected items. The items of the selected directories are added to |tasks_| from
+    // their recursive lists.
     QQueue<FileTransferTask> pending_tasks_;
     QQueue<FileTransferTask> tasks_;
 
+    // The selected directory which is listed now.
+    QString list_source_path_;
+    QString list_target_path_;
+
     Q_DISABLE_COPY(FileTransferQueueBuilder)
 };
 
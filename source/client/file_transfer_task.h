@@ -37,11 +37,16 @@ public:
     bool overwrite() const { return overwrite_; }
     void setOverwrite(bool value) { overwrite_ = value; }
 
+    // The existing file is continued if it is the beginning of the source file.
+    bool resume() const { return resume_; }
+    void setResume(bool value) { resume_ = value; }
+
 private:
     QString source_path_;
     QString target_path_;
     bool is_directory_;
     bool overwrite_ = false;
+    bool resume_ = false;
     qint64 size_;
 };
 
@@ -0,0 +1,331 @@
+//
+// PROJECT:         Aspia
+// FILE:            client/inventory_client.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "client/inventory_client.h"
+
+#include <QTimerEvent>
+
+#include "base/message_serialization.h"
+#include "client/client_user_authorizer.h"
+#include "codec/decompressor.h"
+#include "network/network_channel.h"
+#include "protocol/system_info_session.pb.h"
+
+namespace aspia {
+
+namespace {
+
+enum MessageId { RequestMessageId };
+
+// The larger categories are not accepted from the host.
+constexpr quint32 kMaxCategorySize = 64 * 1024 * 1024; // 64 MB
+
+} // namespace
+
+InventoryClient::InventoryClient(const ConnectData& connect_data,
+                                 const QStringList& uuids,
+                                 QObject* parent)
+    : QObject(parent),
+      connect_data_(connect_data),
+      uuids_(uuids)
+{
+    connect_data_.setSessionType(proto::auth::SESSION_TYPE_SYSTEM_INFO);
+}
+
+InventoryClient::~InventoryClient()
+{
+    delete authorizer_;
+    delete channel_;
+}
+
+void InventoryClient::start(int timeout)
+{
+    // The authorizer asks the missing credentials by the dialog.
+    if (connect_data_.userName().isEmpty() || connect_data_.password().isEmpty())
+    {
+        finish(tr("The user name or the password is not specified."));
+        return;
+    }
+
+    channel_ = NetworkChannel::createClient(this);
+
+    connect(channel_, &NetworkChannel::connected, this, &InventoryClient::onChannelConnected);
+
+    connect(channel_, &NetworkChannel::disconnected, this, [this]()
+    {
+        finish(tr("Disconnected."));
+    });
+
+    connect(channel_, &NetworkChannel::errorOccurred, this, [this](const QString& message)
+    {
+        finish(tr("Network error: %1.").arg(message));
+    });
+
+    timer_id_ = startTimer(timeout);
+    channel_->connectToHost(
+        QStringList(connect_data_.address()) + connect_data_.alternateAddresses(),
+        connect_data_.port());
+}
+
+void InventoryClient::timerEvent(QTimerEvent* event)
+{
+    if (event->timerId() == timer_id_)
+    {
+        finish(tr("Timeout."));
+        return;
+    }
+
+    QObject::timerEvent(event);
+}
+
+void InventoryClient::onChannelConnected()
+{
+    authorizer_ = new ClientUserAuthorizer(nullptr);
+
+    authorizer_->setSessionType(connect_data_.sessionType());
+    authorizer_->setUserName(connect_data_.userName());
+    authorizer_->setPassword(connect_data_.password());
+
+    connect(authorizer_, &ClientUserAuthorizer::writeMessage,
+            channel_, &NetworkChannel::writeMessage);
+
+    connect(authorizer_, &ClientUserAuthorizer::readMessage,
+            channel_, &NetworkChannel::readMessage);
+
+    connect(channel_, &NetworkChannel::messageReceived,
+            authorizer_, &ClientUserAuthorizer::messageReceived);
+
+    connect(channel_, &NetworkChannel::messageWritten,
+            authorizer_, &ClientUserAuthorizer::messageWritten);
+
+    connect(authorizer_, &ClientUserAuthorizer::finished,
+            this, &InventoryClient::onAuthorizationFinished);
+
+    authorizer_->start();
+}
+
+void InventoryClient::onAuthorizationFinished(proto::auth::Status status)
+{
+    // The authorizer can not be deleted while it emits the signal.
+    authorizer_->deleteLater();
+
+    switch (status)
+    {
+        case proto::auth::STATUS_SUCCESS:
+            break;
+
+        case proto::auth::STATUS_ACCESS_DENIED:
+            finish(tr("Authorization error: Access denied."));
+            return;
+
+        case proto::auth::STATUS_CANCELED:
+            finish(tr("Authorization has been canceled."));
+            return;
+
+        default:
+            finish(tr("Authorization error: Unknown status code."));
+            return;
+    }
+
+    // The next messages belong to the session.
+    disconnect(channel_, &NetworkChannel::messageReceived,
+               authorizer_, &ClientUserAuthorizer::messageReceived);
+    disconnect(channel_, &NetworkChannel::messageWritten,
+               authorizer_, &ClientUserAuthorizer::messageWritten);
+
+    connect(channel_, &NetworkChannel::messageReceived,
+            this, &InventoryClient::onMessageReceived);
+    connect(channel_, &NetworkChannel::messageWritten,
+            this, &InventoryClient::onMessageWritten);
+
+    if (uuids_.isEmpty())
+    {
+        // The categories are requested when the list of them is received.
+        proto::system_info::Request request;
+        request.mutable_category_list_request()->set_dummy(1);
+        channel_->writeMessage(RequestMessageId, serializeMessage(request));
+        return;
+    }
+
+    sendRequest(uuids_);
+}
+
+void InventoryClient::onMessageReceived(const QByteArray& buffer)
+{
+    proto::system_info::Reply reply;
+
+    if (!parseMessage(buffer, reply))
+    {
+        finish(tr("Session error: Invalid message from host."));
+        return;
+    }
+
+    if (reply.has_category_list())
+    {
+        QStringList uuids;
+
+        for (const auto& uuid : reply.category_list().uuid())
+            uuids.push_back(QString::fromStdString(uuid));
+
+        if (uuids.isEmpty())
+        {
+            finish(QString());
+            return;
+        }
+
+        sendRequest(uuids);
+        return;
+    }
+
+    if (!reply.has_category())
+    {
+        finish(tr("Session error: Invalid message from host."));
+        return;
+    }
+
+    const proto::system_info::Category& category = reply.category();
+    const QString uuid = QString::fromStdString(category.uuid());
+
+    if (!remaining_.remove(uuid))
+    {
+        finish(tr("Session error: Invalid message from host."));
+        return;
+    }
+
+    Category result;
+    result.uuid = uuid;
+
+    if (category.uncompressed_size())
+    {
+        if (!decompress(category.compression(), category.data(),
+                        category.uncompressed_size(), &result.data))
+        {
+            finish(tr("Session error: Unable to decompress the category."));
+            return;
+        }
+    }
+    else
+    {
+        result.data = QByteArray::fromStdString(category.data());
+    }
+
+    categories_.push_back(std::move(result));
+
+    if (remaining_.isEmpty())
+    {
+        finish(QString());
+        return;
+    }
+
+    channel_->readMessage();
+}
+
+void InventoryClient::onMessageWritten(int message_id)
+{
+    Q_ASSERT(message_id == RequestMessageId);
+
+    // The replies to the previous request may be being read.
+    if (!channel_->isReadPending())
+        channel_->readMessage();
+}
+
+void InventoryClient::sendRequest(const QStringList& uuids)
+{
+    proto::system_info::Request request;
+
+    proto::system_info::CategoryBatchRequest* batch_request =
+        request.mutable_category_batch_request();
+
+    // The host replies each category once.
+    for (const auto& uuid : uuids)
+    {
+        if (remaining_.contains(uuid))
+            continue;
+
+        remaining_.insert(uuid);
+        batch_request->add_uuid(uuid.toStdString());
+    }
+
+    batch_request->set_compress(true);
+    batch_request->set_compression(compression_);
+
+    channel_->writeMessage(RequestMessageId, serializeMessage(request));
+}
+
+bool InventoryClient::decompress(proto::desktop::Compression compression,
+                                 const std::string& source,
+                                 quint32 uncompressed_size,
+                                 QByteArray* data)
+{
+    if (uncompressed_size > kMaxCategorySize)
+        return false;
+
+    if (!decompressor_ || compression_ != compression)
+    {
+        decompressor_ = Decompressor::create(compression);
+        if (!decompressor_)
+            return false;
+
+        compression_ = compression;
+    }
+
+    data->resize(static_cast<int>(uncompressed_size));
+
+    const quint8* input = reinterpret_cast<const quint8*>(source.data());
+    const size_t input_size = source.size();
+
+    quint8* output = reinterpret_cast<quint8*>(data->data());
+    const size_t output_size = uncompressed_size;
+
+    bool decompress_again = true;
+    size_t used = 0;
+    size_t filled = 0;
+
+    while (decompress_again && filled < output_size)
+    {
+        size_t consumed = 0;
+        size_t written = 0;
+
+        decompress_again = decompressor_->process(input + used, input_size - used,
+                                                  output + filled, output_size - filled,
+                                                  &consumed, &written);
+        used += consumed;
+        filled += written;
+
+        // The data is truncated.
+        if (!consumed && !written)
+            break;
+    }
+
+    decompressor_->reset();
+    return filled == output_size;
+}
+
+void InventoryClient::finish(const QString& error_string)
+{
+    if (finished_)
+        return;
+
+    finished_ = true;
+    error_string_ = error_string;
+
+    if (timer_id_)
+    {
+        killTimer(timer_id_);
+        timer_id_ = 0;
+    }
+
+    if (channel_)
+    {
+        channel_->disconnect(this);
+        channel_->stop();
+    }
+
+    emit finished(this);
+}
+
+} // namespace aspia
@@ -0,0 +1,102 @@
+//
+// PROJECT:         Aspia
+// FILE:            client/inventory_client.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CLIENT__INVENTORY_CLIENT_H
+#define _ASPIA_CLIENT__INVENTORY_CLIENT_H
+
+#include <QByteArray>
+#include <QPointer>
+#include <QSet>
+#include <QStringList>
+#include <QVector>
+
+#include <memory>
+
+#include "client/connect_data.h"
+#include "protocol/authorization.pb.h"
+#include "protocol/desktop_session.pb.h"
+
+namespace aspia {
+
+class ClientUserAuthorizer;
+class Decompressor;
+class NetworkChannel;
+
+//
+// Collects the categories of the system information from one host without the user interface.
+// All categories are requested by one message and the host replies them as soon as they are
+// collected. The credentials must be in the connection data, because they are not asked.
+//
+class InventoryClient : public QObject
+{
+    Q_OBJECT
+
+public:
+    struct Category
+    {
+        QString uuid;
+        QByteArray data;
+    };
+
+    // If |uuids| is empty, all categories of the host are collected.
+    InventoryClient(const ConnectData& connect_data, const QStringList& uuids, QObject* parent);
+    ~InventoryClient();
+
+    // The collection is finished after |timeout| milliseconds even if not all categories are
+    // received.
+    void start(int timeout);
+
+    const ConnectData& connectData() const { return connect_data_; }
+
+    // Empty if all categories are received.
+    QString errorString() const { return error_string_; }
+
+    const QVector<Category>& categories() const { return categories_; }
+
+signals:
+    void finished(InventoryClient* client);
+
+protected:
+    void timerEvent(QTimerEvent* event) override;
+
+private slots:
+    void onChannelConnected();
+    void onAuthorizationFinished(proto::auth::Status status);
+    void onMessageReceived(const QByteArray& buffer);
+    void onMessageWritten(int message_id);
+
+private:
+    void sendRequest(const QStringList& uuids);
+    bool decompress(proto::desktop::Compression compression,
+                    const std::string& source,
+                    quint32 uncompressed_size,
+                    QByteArray* data);
+    void finish(const QString& error_string);
+
+    ConnectData connect_data_;
+    QStringList uuids_;
+
+    QPointer<NetworkChannel> channel_;
+    QPointer<ClientUserAuthorizer> authorizer_;
+    int timer_id_ = 0;
+
+    // The categories which are requested and not yet received.
+    QSet<QString> remaining_;
+    QVector<Category> categories_;
+
+    std::unique_ptr<Decompressor> decompressor_;
+    proto::desktop::Compression compression_ = proto::desktop::COMPRESSION_ZSTD;
+
+    QString error_string_;
+    bool finished_ = false;
+
+    Q_DISABLE_COPY(InventoryClient)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_CLIENT__INVENTORY_CLIENT_H
@@ -0,0 +1,13 @@
+//
+// PROJECT:         Aspia
+// FILE:            client/inventory_entry_point.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "client/inventory_main.h"
+
+int main(int argc, char *argv[])
+{
+    return aspia::inventoryMain(argc, argv);
+}
@@ -0,0 +1,335 @@
+//
+// PROJECT:         Aspia
+// FILE:            client/inventory_main.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "client/inventory_main.h"
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QDataStream>
+#include <QDateTime>
+#include <QDebug>
+#include <QEventLoop>
+#include <QFile>
+#include <QSaveFile>
+#include <QTextStream>
+
+#include <deque>
+#include <functional>
+
+#include "base/message_serialization.h"
+#include "client/computer_factory.h"
+#include "client/inventory_client.h"
+#include "crypto/data_encryptor.h"
+#include "crypto/password_hash.h"
+#include "crypto/secure_memory.h"
+#include "protocol/address_book.pb.h"
+#include "version.h"
+
+namespace aspia {
+
+namespace {
+
+constexpr int kDefaultConnections = 64;
+constexpr int kDefaultTimeout = 60; // 60 seconds
+
+//
+// The output file starts with kMagic and kVersion. Then each host is written as a record:
+// name, address and port of the computer, the time of the collection (UTC), the error (empty
+// if all categories are received) and the number of the categories, each of them as the uuid
+// and the serialized data. The host is written as soon as its collection is finished, so the
+// order of the records differs from the order of the address book.
+//
+constexpr quint32 kMagic = 0x49505341; // "ASPI"
+constexpr quint32 kVersion = 1;
+
+bool loadAddressBook(const QString& file_path,
+                     QByteArray password,
+                     proto::address_book::Data* data)
+{
+    QFile file(file_path);
+
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        qWarning() << "Unable to open the address book" << file_path << ":" << file.errorString();
+        return false;
+    }
+
+    QByteArray buffer = file.readAll();
+
+    proto::address_book::File address_book_file;
+    const bool parsed = address_book_file.ParseFromArray(buffer.constData(), buffer.size());
+    secureMemZero(&buffer);
+
+    if (!parsed)
+    {
+        qWarning("The address book file is corrupted or has an unknown format");
+        return false;
+    }
+
+    QByteArray key;
+
+    switch (address_book_file.encryption_type())
+    {
+        case proto::address_book::ENCRYPTION_TYPE_NONE:
+            return data->ParseFromString(address_book_file.data());
+
+        case proto::address_book::ENCRYPTION_TYPE_XCHACHA20_POLY1305:
+        {
+            key = DataEncryptor::createKey(
+                password,
+                QByteArray::fromStdString(address_book_file.hashing_salt()),
+                address_book_file.hashing_rounds());
+        }
+        break;
+
+        case proto::address_book::ENCRYPTION_TYPE_XCHACHA20_POLY1305_ARGON2ID:
+        {
+            // The parameters of the file are checked before the memory is allocated for them.
+            if (!PasswordHash::isValidLimits(address_book_file.hashing_rounds(),
+                                             address_book_file.hashing_memory()))
+            {
+                qWarning("The address book file is corrupted or has an unknown format");
+                return false;
+            }
+
+            key = DataEncryptor::createKey(
+                password,
+                QByteArray::fromStdString(address_book_file.hashing_salt()),
+                address_book_file.hashing_rounds(),
+                address_book_file.hashing_memory());
+        }
+        break;
+
+        default:
+            qWarning("The address book file is encrypted with an unsupported encryption type");
+            return false;
+    }
+
+    secureMemZero(&password);
+
+    QByteArray decrypted_data;
+
+    const bool decrypted = !key.isEmpty() &&
+        DataEncryptor::decrypt(address_book_file.data().c_str(),
+                               static_cast<int>(address_book_file.data().size()),
+                               key,
+                               &decrypted_data);
+    secureMemZero(&key);
+
+    if (!decrypted)
+    {
+        qWarning("Unable to decrypt the address book with the specified password");
+        return false;
+    }
+
+    const bool result = parseMessage(decrypted_data, *data);
+    secureMemZero(&decrypted_data);
+
+    if (!result)
+        qWarning("The address book file is corrupted or has an unknown format");
+
+    return result;
+}
+
+void addComputers(const proto::address_book::ComputerGroup& group,
+                  std::deque<ConnectData>* computers)
+{
+    for (const auto& computer : group.computer())
+    {
+        ConnectData connect_data;
+
+        connect_data.setComputerName(QString::fromStdString(computer.name()));
+        connect_data.setAddress(QString::fromStdString(computer.address()));
+        connect_data.setAlternateAddresses(ComputerFactory::alternateAddresses(computer));
+        connect_data.setPort(computer.port());
+        connect_data.setUserName(QString::fromStdString(computer.username()));
+        connect_data.setPassword(QString::fromStdString(computer.password()));
+
+        computers->push_back(std::move(connect_data));
+    }
+
+    for (const auto& child_group : group.computer_group())
+        addComputers(child_group, computers);
+}
+
+void writeRecord(QDataStream& stream, const InventoryClient* client)
+{
+    const ConnectData& connect_data = client->connectData();
+
+    stream << connect_data.computerName()
+           << connect_data.address()
+           << quint16(connect_data.port())
+           << QDateTime::currentDateTimeUtc()
+           << client->errorString()
+           << quint32(client->categories().size());
+
+    for (const auto& category : client->categories())
+        stream << category.uuid << category.data;
+}
+
+} // namespace
+
+int inventoryMain(int argc, char *argv[])
+{
+    QCoreApplication application(argc, argv);
+    application.setOrganizationName(QStringLiteral("Aspia"));
+    application.setApplicationName(QStringLiteral("Inventory"));
+    application.setApplicationVersion(QStringLiteral(ASPIA_VERSION_STRING));
+
+    QCommandLineOption output_option(QStringLiteral("output"),
+                                     QStringLiteral("Path of the output file."),
+                                     QStringLiteral("file"));
+    QCommandLineOption category_option(QStringLiteral("category"),
+                                       QStringLiteral("UUID of the category to collect. May be "
+                                                      "specified several times. Without it all "
+                                                      "categories of the hosts are collected."),
+                                       QStringLiteral("uuid"));
+    QCommandLineOption connections_option(QStringLiteral("connections"),
+                                          QStringLiteral("Maximum number of the hosts which are "
+                                                         "connected at the same time."),
+                                          QStringLiteral("count"),
+                                          QString::number(kDefaultConnections));
+    QCommandLineOption timeout_option(QStringLiteral("timeout"),
+                                      QStringLiteral("Time in seconds for the collection from "
+                                                     "one host."),
+                                      QStringLiteral("timeout"),
+                                      QString::number(kDefaultTimeout));
+    QCommandLineOption password_option(QStringLiteral("password-stdin"),
+                                       QStringLiteral("Read the password of the address book "
+                                                      "from the standard input."));
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(
+        QStringLiteral("Collects the system information from the computers of the address book "
+                       "without the user interface. The credentials of the computers must be "
+                       "saved in the address book."));
+    parser.addHelpOption();
+    parser.addVersionOption();
+    parser.addPositionalArgument(QStringLiteral("address_book"),
+                                 QStringLiteral("Path of the address book file."));
+    parser.addOption(output_option);
+    parser.addOption(category_option);
+    parser.addOption(connections_option);
+    parser.addOption(timeout_option);
+    parser.addOption(password_option);
+    parser.process(application);
+
+    if (parser.positionalArguments().size() != 1 || !parser.isSet(output_option))
+        parser.showHelp(1);
+
+    const int max_connections = parser.value(connections_option).toInt();
+    const int timeout = parser.value(timeout_option).toInt() * 1000;
+
+    if (max_connections <= 0 || timeout <= 0)
+    {
+        qWarning("Invalid number of the connections or timeout");
+        return 1;
+    }
+
+    QByteArray password;
+
+    // The password is not passed by the command line, because it is seen by other users.
+    if (parser.isSet(password_option))
+    {
+        QString line = QTextStream(stdin).readLine();
+        password = line.toUtf8();
+        secureMemZero(&line);
+    }
+
+    proto::address_book::Data address_book;
+
+    if (!loadAddressBook(parser.positionalArguments().front(), std::move(password), &address_book))
+        return 1;
+
+    std::deque<ConnectData> computers;
+    addComputers(address_book.root_group(), &computers);
+    secureMemZero(address_book.mutable_salt1());
+    secureMemZero(address_book.mutable_salt2());
+    address_book.Clear();
+
+    QSaveFile output_file(parser.value(output_option));
+
+    if (!output_file.open(QIODevice::WriteOnly))
+    {
+        qWarning() << "Unable to create the output file" << output_file.fileName() << ":"
+                   << output_file.errorString();
+        return 1;
+    }
+
+    QDataStream stream(&output_file);
+    stream.setVersion(QDataStream::Qt_5_0);
+    stream.setByteOrder(QDataStream::LittleEndian);
+
+    stream << kMagic << kVersion;
+
+    const QStringList uuids = parser.values(category_option);
+    const size_t total_count = computers.size();
+    size_t failed_count = 0;
+    int active_count = 0;
+
+    QTextStream out(stdout);
+    QEventLoop loop;
+
+    std::function<void()> start_next = [&]()
+    {
+        while (active_count < max_connections && !computers.empty())
+        {
+            InventoryClient* client = new InventoryClient(computers.front(), uuids, &loop);
+            computers.pop_front();
+
+            QObject::connect(client, &InventoryClient::finished, &loop,
+                             [&](InventoryClient* finished_client)
+            {
+                writeRecord(stream, finished_client);
+
+                const ConnectData& connect_data = finished_client->connectData();
+
+                if (!finished_client->errorString().isEmpty())
+                {
+                    out << connect_data.computerName() << " (" << connect_data.address()
+                        << "): " << finished_client->errorString() << endl;
+                    ++failed_count;
+                }
+
+                finished_client->deleteLater();
+                --active_count;
+
+                if (!active_count && computers.empty())
+                {
+                    loop.quit();
+                    return;
+                }
+
+                start_next();
+            },
+            Qt::QueuedConnection);
+
+            ++active_count;
+
+            // The signal is queued, because the client may be finished at once.
+            client->start(timeout);
+        }
+    };
+
+    if (!computers.empty())
+    {
+        start_next();
+        loop.exec();
+    }
+
+    if (stream.status() != QDataStream::Ok || !output_file.commit())
+    {
+        qWarning() << "Unable to write the output file" << output_file.fileName() << ":"
+                   << output_file.errorString();
+        return 1;
+    }
+
+    out << "Hosts: " << total_count << ", failed: " << failed_count << endl;
+    return 0;
+}
+
+} // namespace aspia
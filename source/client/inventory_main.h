@@ -0,0 +1,19 @@
+//
+// PROJECT:         Aspia
+// FILE:            client/inventory_main.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CLIENT__INVENTORY_MAIN_H
+#define _ASPIA_CLIENT__INVENTORY_MAIN_H
+
+#include "core_export.h"
+
+namespace aspia {
+
+int CORE_EXPORT inventoryMain(int argc, char *argv[]);
+
+} // namespace aspia
+
+#endif // _ASPIA_CLIENT__INVENTORY_MAIN_H
@@ -0,0 +1,511 @@
+//
+// PROJECT:         Aspia
+// FILE:            client/load_test_client.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "client/load_test_client.h"
+
+#include <QTimerEvent>
+
+#include "base/message_serialization.h"
+#include "client/client_user_authorizer.h"
+#include "client/computer_factory.h"
+#include "client/file_status.h"
+#include "client/video_decode_thread.h"
+#include "network/network_channel.h"
+#include "protocol/file_transfer_session.pb.h"
+#include "protocol/system_info_session.pb.h"
+
+namespace aspia {
+
+namespace {
+
+enum MessageId { ConfigMessageId };
+
+constexpr int kPingInterval = 1000; // 1 second
+
+// The pointer is moved back and forth along the diagonal of this square near the top left
+// corner of the screen.
+constexpr int kInputOrigin = 100;
+constexpr int kInputRange = 100;
+
+// The features of the desktop client of the viewer, so the host does the same work.
+constexpr quint32 kDesktopFeatures =
+    proto::desktop::FEATURE_COPY_RECT |
+    proto::desktop::FEATURE_VIDEO_ACK |
+    proto::desktop::FEATURE_ZLIB_CHUNKS |
+    proto::desktop::FEATURE_ZLIB_STREAM |
+    proto::desktop::FEATURE_PACKED_RECTS;
+
+bool isDesktopSession(proto::auth::SessionType session_type)
+{
+    return session_type == proto::auth::SESSION_TYPE_DESKTOP_MANAGE ||
+           session_type == proto::auth::SESSION_TYPE_DESKTOP_VIEW;
+}
+
+} // namespace
+
+LoadTestClient::LoadTestClient(const ConnectData& connect_data,
+                               const Options& options,
+                               QObject* parent)
+    : QObject(parent),
+      connect_data_(connect_data),
+      options_(options)
+{
+    // Nothing
+}
+
+LoadTestClient::~LoadTestClient()
+{
+    delete decode_thread_;
+    delete authorizer_;
+    delete channel_;
+}
+
+void LoadTestClient::start()
+{
+    // The authorizer asks the missing credentials by the dialog.
+    if (connect_data_.userName().isEmpty() || connect_data_.password().isEmpty())
+    {
+        finish(tr("The user name or the password is not specified."));
+        return;
+    }
+
+    channel_ = NetworkChannel::createClient(this);
+
+    connect(channel_, &NetworkChannel::connected, this, &LoadTestClient::onChannelConnected);
+
+    connect(channel_, &NetworkChannel::disconnected, this, [this]()
+    {
+        finish(tr("Disconnected."));
+    });
+
+    connect(channel_, &NetworkChannel::errorOccurred, this, [this](const QString& message)
+    {
+        finish(tr("Network error: %1.").arg(message));
+    });
+
+    channel_->connectToHost(
+        QStringList(connect_data_.address()) + connect_data_.alternateAddresses(),
+        connect_data_.port());
+}
+
+LoadTestClient::Counters LoadTestClient::takeCounters()
+{
+    Counters counters = counters_;
+    counters.elapsed_time = counters_clock_.isValid() ? counters_clock_.restart() : 0;
+
+    counters_ = Counters();
+    return counters;
+}
+
+void LoadTestClient::timerEvent(QTimerEvent* event)
+{
+    if (event->timerId() == ping_timer_id_)
+    {
+        sendPing();
+        return;
+    }
+
+    if (event->timerId() == input_timer_id_)
+    {
+        sendInputEvent();
+        return;
+    }
+
+    if (event->timerId() == request_timer_id_)
+    {
+        killTimer(request_timer_id_);
+        request_timer_id_ = 0;
+
+        sendRequest();
+        return;
+    }
+
+    QObject::timerEvent(event);
+}
+
+void LoadTestClient::customEvent(QEvent* event)
+{
+    switch (event->type())
+    {
+        case VideoDecodeThread::DecodeEvent::kType:
+        {
+            VideoDecodeThread::DecodeEvent* decode_event =
+                reinterpret_cast<VideoDecodeThread::DecodeEvent*>(event);
+
+            // The frame is presented at once, so the decoder does not wait for the viewer.
+            if (decode_event->frame_ready)
+            {
+                QRegion dirty_region;
+                decode_thread_->presentFrame(&dirty_region);
+            }
+
+            if (decode_event->refresh_required && channel_)
+            {
+                proto::desktop::ClientToHost message;
+                message.mutable_refresh_request();
+                channel_->writeMessage(-1, serializeMessage(message));
+            }
+
+            sendVideoAck(decode_event->frame_id, decode_event->decode_time);
+        }
+        break;
+
+        case VideoDecodeThread::PresentEvent::kType:
+        {
+            QRegion dirty_region;
+            decode_thread_->presentFrame(&dirty_region);
+        }
+        break;
+
+        case VideoDecodeThread::ErrorEvent::kType:
+            finish(tr("Session error: The video packet could not be decoded."));
+            break;
+
+        default:
+            QObject::customEvent(event);
+            break;
+    }
+}
+
+void LoadTestClient::onChannelConnected()
+{
+    authorizer_ = new ClientUserAuthorizer(nullptr);
+
+    authorizer_->setSessionType(connect_data_.sessionType());
+    authorizer_->setUserName(connect_data_.userName());
+    authorizer_->setPassword(connect_data_.password());
+    authorizer_->setChallengeNonce(channel_->challengeNonce());
+    authorizer_->setHostAddress(
+        connect_data_.address() + QLatin1Char(':') + QString::number(connect_data_.port()));
+
+    connect(authorizer_, &ClientUserAuthorizer::writeMessage,
+            channel_, &NetworkChannel::writeMessage);
+
+    connect(authorizer_, &ClientUserAuthorizer::readMessage,
+            channel_, &NetworkChannel::readMessage);
+
+    connect(channel_, &NetworkChannel::messageReceived,
+            authorizer_, &ClientUserAuthorizer::messageReceived);
+
+    connect(channel_, &NetworkChannel::messageWritten,
+            authorizer_, &ClientUserAuthorizer::messageWritten);
+
+    connect(authorizer_, &ClientUserAuthorizer::finished,
+            this, &LoadTestClient::onAuthorizationFinished);
+
+    authorizer_->start();
+}
+
+void LoadTestClient::onAuthorizationFinished(proto::auth::Status status)
+{
+    // The authorizer can not be deleted while it emits the signal.
+    authorizer_->deleteLater();
+
+    switch (status)
+    {
+        case proto::auth::STATUS_SUCCESS:
+            break;
+
+        case proto::auth::STATUS_ACCESS_DENIED:
+            finish(tr("Authorization error: Access denied."));
+            return;
+
+        case proto::auth::STATUS_CANCELED:
+            finish(tr("Authorization has been canceled."));
+            return;
+
+        default:
+            finish(tr("Authorization error: Unknown status code."));
+            return;
+    }
+
+    // The next messages belong to the session.
+    disconnect(channel_, &NetworkChannel::messageReceived,
+               authorizer_, &ClientUserAuthorizer::messageReceived);
+    disconnect(channel_, &NetworkChannel::messageWritten,
+               authorizer_, &ClientUserAuthorizer::messageWritten);
+
+    connect(channel_, &NetworkChannel::messageReceived,
+            this, &LoadTestClient::onMessageReceived);
+
+    active_ = true;
+    clock_.start();
+    counters_clock_.start();
+
+    if (isDesktopSession(connect_data_.sessionType()))
+    {
+        if (options_.decode)
+            decode_thread_ = new VideoDecodeThread(this);
+
+        ping_timer_id_ = startTimer(kPingInterval);
+
+        if (options_.input_rate > 0 &&
+            connect_data_.sessionType() == proto::auth::SESSION_TYPE_DESKTOP_MANAGE)
+        {
+            input_timer_id_ = startTimer(qMax(1, 1000 / options_.input_rate), Qt::PreciseTimer);
+        }
+    }
+    else
+    {
+        sendRequest();
+    }
+
+    channel_->readMessage();
+}
+
+void LoadTestClient::onMessageReceived(const QByteArray& buffer)
+{
+    counters_.bytes += buffer.size();
+
+    if (isDesktopSession(connect_data_.sessionType()))
+        readDesktopMessage(buffer);
+    else
+        readReply(buffer);
+
+    if (channel_)
+        channel_->readMessage();
+}
+
+void LoadTestClient::readDesktopMessage(const QByteArray& buffer)
+{
+    proto::desktop::HostToClient message;
+
+    if (!parseMessage(buffer, message))
+    {
+        finish(tr("Session error: Invalid message from host."));
+        return;
+    }
+
+    if (message.has_video_packet())
+    {
+        readVideoPacket(std::unique_ptr<proto::desktop::VideoPacket>(
+            message.release_video_packet()));
+    }
+    else if (message.has_config_request())
+    {
+        readConfigRequest(message.config_request());
+    }
+    else if (message.has_ping())
+    {
+        addRoundTrip(clock_.elapsed() - message.ping().time());
+    }
+
+    // The cursor and the other messages are only counted.
+}
+
+void LoadTestClient::readConfigRequest(const proto::desktop::ConfigRequest& config_request)
+{
+    proto::desktop::Config config =
+        connect_data_.sessionType() == proto::auth::SESSION_TYPE_DESKTOP_MANAGE ?
+        ComputerFactory::defaultDesktopManageConfig() :
+        ComputerFactory::defaultDesktopViewConfig();
+
+    if (!(config_request.video_encodings() & config.video_encoding()))
+    {
+        if (config_request.video_encodings() & proto::desktop::VIDEO_ENCODING_VP8)
+        {
+            config.set_video_encoding(proto::desktop::VIDEO_ENCODING_VP8);
+        }
+        else if (config_request.video_encodings() & proto::desktop::VIDEO_ENCODING_ZLIB)
+        {
+            config.set_video_encoding(proto::desktop::VIDEO_ENCODING_ZLIB);
+        }
+        else
+        {
+            finish(tr("Session error: There are no supported video encodings."));
+            return;
+        }
+    }
+
+    config.set_features(config.features() | kDesktopFeatures);
+
+    proto::desktop::ClientToHost message;
+    message.mutable_config()->CopyFrom(config);
+    channel_->writeMessage(ConfigMessageId, serializeMessage(message));
+}
+
+void LoadTestClient::readVideoPacket(std::unique_ptr<proto::desktop::VideoPacket> packet)
+{
+    if (decode_thread_)
+    {
+        decode_thread_->decodePacket(std::move(packet));
+        return;
+    }
+
+    // Without the decoding the frame is acknowledged as soon as it is received.
+    sendVideoAck(packet->frame_id(), 0);
+}
+
+void LoadTestClient::readReply(const QByteArray& buffer)
+{
+    if (request_time_ < 0)
+    {
+        finish(tr("Session error: Invalid message from host."));
+        return;
+    }
+
+    addRoundTrip(clock_.elapsed() - request_time_);
+    request_time_ = -1;
+    ++counters_.requests;
+
+    if (connect_data_.sessionType() == proto::auth::SESSION_TYPE_FILE_TRANSFER)
+    {
+        proto::file_transfer::Reply reply;
+
+        if (!parseMessage(buffer, reply))
+        {
+            finish(tr("Session error: Invalid message from host."));
+            return;
+        }
+
+        if (reply.status() != proto::file_transfer::STATUS_SUCCESS)
+        {
+            finish(tr("Session error: %1").arg(fileStatusToString(reply.status())));
+            return;
+        }
+    }
+    else
+    {
+        proto::system_info::Reply reply;
+
+        if (!parseMessage(buffer, reply))
+        {
+            finish(tr("Session error: Invalid message from host."));
+            return;
+        }
+
+        if (reply.has_category_list())
+        {
+            for (const auto& uuid : reply.category_list().uuid())
+                categories_.append(QString::fromStdString(uuid));
+        }
+    }
+
+    if (options_.request_interval > 0)
+        request_timer_id_ = startTimer(options_.request_interval);
+    else
+        sendRequest();
+}
+
+void LoadTestClient::sendVideoAck(quint32 frame_id, qint64 decode_time)
+{
+    // Only the last packet of the frame is acknowledged.
+    if (!frame_id || !channel_)
+        return;
+
+    ++counters_.frames;
+
+    proto::desktop::ClientToHost message;
+
+    proto::desktop::VideoAck* video_ack = message.mutable_video_ack();
+    video_ack->set_frame_id(frame_id);
+    video_ack->set_decode_time(static_cast<quint32>(decode_time));
+
+    channel_->writeMessage(-1, serializeMessage(message));
+}
+
+void LoadTestClient::sendRequest()
+{
+    if (!channel_)
+        return;
+
+    QByteArray buffer;
+
+    if (connect_data_.sessionType() == proto::auth::SESSION_TYPE_FILE_TRANSFER)
+    {
+        proto::file_transfer::Request request;
+        request.mutable_drive_list_request()->set_dummy(1);
+        request.set_request_id(++last_request_id_);
+        buffer = serializeMessage(request);
+    }
+    else
+    {
+        proto::system_info::Request request;
+
+        // The categories are requested in turn when the list of them is received.
+        if (categories_.isEmpty())
+        {
+            request.mutable_category_list_request()->set_dummy(1);
+        }
+        else
+        {
+            request.mutable_category_request()->set_uuid(
+                categories_[next_category_++ % categories_.size()].toStdString());
+        }
+
+        buffer = serializeMessage(request);
+    }
+
+    request_time_ = clock_.elapsed();
+    channel_->writeMessage(-1, buffer);
+}
+
+void LoadTestClient::sendPing()
+{
+    proto::desktop::ClientToHost message;
+    message.mutable_ping()->set_time(clock_.elapsed());
+    channel_->writeMessage(-1, serializeMessage(message));
+}
+
+void LoadTestClient::sendInputEvent()
+{
+    const int step = input_step_++ % (kInputRange * 2);
+    const int offset = step < kInputRange ? step : kInputRange * 2 - step;
+
+    proto::desktop::ClientToHost message;
+
+    proto::desktop::PointerEvent* pointer_event = message.mutable_pointer_event();
+    pointer_event->set_mask(proto::desktop::PointerEvent::EMPTY);
+    pointer_event->set_x(kInputOrigin + offset);
+    pointer_event->set_y(kInputOrigin + offset);
+
+    ++counters_.input_events;
+    channel_->writeMessage(-1, serializeMessage(message));
+}
+
+void LoadTestClient::addRoundTrip(qint64 round_trip_time)
+{
+    ++counters_.round_trips;
+    counters_.round_trip_time += round_trip_time;
+    counters_.max_round_trip_time = qMax(counters_.max_round_trip_time, round_trip_time);
+}
+
+void LoadTestClient::finish(const QString& error_string)
+{
+    if (!error_string_.isEmpty())
+        return;
+
+    active_ = false;
+    error_string_ = error_string;
+
+    for (int* timer_id : { &ping_timer_id_, &input_timer_id_, &request_timer_id_ })
+    {
+        if (*timer_id)
+        {
+            killTimer(*timer_id);
+            *timer_id = 0;
+        }
+    }
+
+    if (channel_)
+    {
+        channel_->disconnect(this);
+        channel_->stop();
+        channel_->deleteLater();
+        channel_ = nullptr;
+    }
+
+    if (authorizer_)
+    {
+        authorizer_->deleteLater();
+        authorizer_ = nullptr;
+    }
+
+    emit finished(this);
+}
+
+} // namespace aspia
@@ -0,0 +1,135 @@
+//
+// PROJECT:         Aspia
+// FILE:            client/load_test_client.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CLIENT__LOAD_TEST_CLIENT_H
+#define _ASPIA_CLIENT__LOAD_TEST_CLIENT_H
+
+#include <QElapsedTimer>
+#include <QPointer>
+#include <QStringList>
+
+#include <memory>
+
+#include "client/connect_data.h"
+#include "protocol/authorization.pb.h"
+#include "protocol/desktop_session.pb.h"
+
+namespace aspia {
+
+class ClientUserAuthorizer;
+class NetworkChannel;
+class VideoDecodeThread;
+
+//
+// One session of the load test of the host without the user interface. The desktop session
+// receives the screen and acknowledges the frames as soon as they are received, or after they
+// are decoded by the real decoders if the decoding is enabled. The pointer is moved by the
+// synthetic events at the input rate. The file transfer and the system info sessions repeat
+// the requests of the list of the drives and of the categories one at a time. The round trip
+// time is measured by the pings of the desktop session and by the requests of the other
+// sessions. The credentials must be in the connection data, because they are not asked.
+//
+class LoadTestClient : public QObject
+{
+    Q_OBJECT
+
+public:
+    struct Options
+    {
+        bool decode = false;
+        int input_rate = 0; // Pointer events per second, 0 if the input is not injected.
+        int request_interval = 100; // In milliseconds, between the reply and the next request.
+    };
+
+    // The counters since the previous call of takeCounters().
+    struct Counters
+    {
+        qint64 frames = 0;
+        qint64 bytes = 0;
+        qint64 requests = 0;
+        qint64 input_events = 0;
+        qint64 round_trips = 0;
+        qint64 round_trip_time = 0; // Sum in milliseconds.
+        qint64 max_round_trip_time = 0; // In milliseconds.
+        qint64 elapsed_time = 0; // In milliseconds.
+    };
+
+    LoadTestClient(const ConnectData& connect_data, const Options& options, QObject* parent);
+    ~LoadTestClient();
+
+    void start();
+
+    const ConnectData& connectData() const { return connect_data_; }
+
+    // The session is established and works.
+    bool isActive() const { return active_; }
+
+    // Empty until the session fails.
+    QString errorString() const { return error_string_; }
+
+    Counters takeCounters();
+
+signals:
+    // The session has failed. The client does not connect again.
+    void finished(LoadTestClient* client);
+
+protected:
+    // QObject implementation.
+    void timerEvent(QTimerEvent* event) override;
+    void customEvent(QEvent* event) override;
+
+private slots:
+    void onChannelConnected();
+    void onAuthorizationFinished(proto::auth::Status status);
+    void onMessageReceived(const QByteArray& buffer);
+
+private:
+    void readDesktopMessage(const QByteArray& buffer);
+    void readConfigRequest(const proto::desktop::ConfigRequest& config_request);
+    void readVideoPacket(std::unique_ptr<proto::desktop::VideoPacket> packet);
+    void readReply(const QByteArray& buffer);
+    void sendVideoAck(quint32 frame_id, qint64 decode_time);
+    void sendRequest();
+    void sendPing();
+    void sendInputEvent();
+    void addRoundTrip(qint64 round_trip_time);
+    void finish(const QString& error_string);
+
+    ConnectData connect_data_;
+    const Options options_;
+
+    QPointer<NetworkChannel> channel_;
+    QPointer<ClientUserAuthorizer> authorizer_;
+    VideoDecodeThread* decode_thread_ = nullptr;
+
+    bool active_ = false;
+    QString error_string_;
+
+    // The times of the pings and of the requests are measured by |clock_|.
+    QElapsedTimer clock_;
+    QElapsedTimer counters_clock_;
+    Counters counters_;
+
+    int ping_timer_id_ = 0;
+    int input_timer_id_ = 0;
+    int request_timer_id_ = 0;
+
+    // The time of the request which is not replied yet or -1.
+    qint64 request_time_ = -1;
+    quint64 last_request_id_ = 0;
+    int input_step_ = 0;
+
+    // The categories of the system info which are requested in turn.
+    QStringList categories_;
+    int next_category_ = 0;
+
+    Q_DISABLE_COPY(LoadTestClient)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_CLIENT__LOAD_TEST_CLIENT_H
@@ -0,0 +1,13 @@
+//
+// PROJECT:         Aspia
+// FILE:            client/load_test_entry_point.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "client/load_test_main.h"
+
+int main(int argc, char *argv[])
+{
+    return aspia::loadTestMain(argc, argv);
+}
@@ -0,0 +1,468 @@
+//
+// PROJECT:         Aspia
+// FILE:            client/load_test_main.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "client/load_test_main.h"
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QTextStream>
+#include <QTimer>
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <psapi.h>
+#include <tlhelp32.h>
+
+#include <map>
+#include <vector>
+
+#include "base/win/scoped_object.h"
+#include "client/load_test_client.h"
+#include "crypto/secure_memory.h"
+#include "version.h"
+
+namespace aspia {
+
+namespace {
+
+constexpr int kDefaultDuration = 60; // 60 seconds
+constexpr int kDefaultInterval = 5; // 5 seconds
+constexpr int kDefaultConnectRate = 10; // Sessions per second.
+constexpr int kDefaultInputRate = 10; // Pointer events per second.
+constexpr int kDefaultRequestInterval = 100; // 100 ms
+
+const char kDefaultHostProcesses[] = "aspia_host_service.exe,aspia_host.exe";
+
+struct Session
+{
+    LoadTestClient* client;
+
+    // The counters of the whole test.
+    LoadTestClient::Counters total;
+};
+
+void addCounters(const LoadTestClient::Counters& counters, LoadTestClient::Counters* total)
+{
+    total->frames += counters.frames;
+    total->bytes += counters.bytes;
+    total->requests += counters.requests;
+    total->input_events += counters.input_events;
+    total->round_trips += counters.round_trips;
+    total->round_trip_time += counters.round_trip_time;
+    total->max_round_trip_time = qMax(total->max_round_trip_time, counters.max_round_trip_time);
+    total->elapsed_time += counters.elapsed_time;
+}
+
+QString sessionTypeName(proto::auth::SessionType session_type)
+{
+    switch (session_type)
+    {
+        case proto::auth::SESSION_TYPE_DESKTOP_MANAGE:
+            return QStringLiteral("desktop");
+
+        case proto::auth::SESSION_TYPE_DESKTOP_VIEW:
+            return QStringLiteral("view");
+
+        case proto::auth::SESSION_TYPE_FILE_TRANSFER:
+            return QStringLiteral("file");
+
+        case proto::auth::SESSION_TYPE_SYSTEM_INFO:
+            return QStringLiteral("sysinfo");
+
+        default:
+            return QStringLiteral("unknown");
+    }
+}
+
+//
+// Measures the CPU and the memory of the processes of the host. It works only if the test is
+// started on the computer of the host by the user who can open the processes of the service.
+//
+class HostUsage
+{
+public:
+    explicit HostUsage(const QStringList& process_names)
+        : process_names_(process_names)
+    {
+        // Nothing
+    }
+
+    struct Sample
+    {
+        int processes = 0;
+        double cpu_usage = 0; // In percent of all processors.
+        qint64 memory = 0; // The working sets in bytes.
+    };
+
+    // The CPU usage is measured since the previous call.
+    Sample sample()
+    {
+        Sample sample;
+
+        ScopedHandle snapshot(CreateToolhelp32Snapshot(TH32CS_SNAPPROCESS, 0));
+        if (!snapshot.isValid())
+            return sample;
+
+        std::map<DWORD, qint64> cpu_times;
+
+        PROCESSENTRY32W entry;
+        entry.dwSize = sizeof(entry);
+
+        for (BOOL found = Process32FirstW(snapshot, &entry); found;
+             found = Process32NextW(snapshot, &entry))
+        {
+            const QString name = QString::fromWCharArray(entry.szExeFile);
+            if (!process_names_.contains(name, Qt::CaseInsensitive))
+                continue;
+
+            ScopedHandle process(
+                OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION, FALSE, entry.th32ProcessID));
+            if (!process.isValid())
+                continue;
+
+            FILETIME creation_time;
+            FILETIME exit_time;
+            FILETIME kernel_time;
+            FILETIME user_time;
+
+            if (!GetProcessTimes(process, &creation_time, &exit_time, &kernel_time, &user_time))
+                continue;
+
+            PROCESS_MEMORY_COUNTERS memory_counters;
+            if (GetProcessMemoryInfo(process, &memory_counters, sizeof(memory_counters)))
+                sample.memory += memory_counters.WorkingSetSize;
+
+            const qint64 cpu_time = toNanoseconds(kernel_time) + toNanoseconds(user_time);
+            cpu_times[entry.th32ProcessID] = cpu_time;
+
+            // The processes which are started after the previous sample have used their whole
+            // time since then.
+            auto previous = cpu_times_.find(entry.th32ProcessID);
+            const qint64 previous_time = previous != cpu_times_.end() ? previous->second : 0;
+
+            cpu_delta_ += cpu_time - previous_time;
+            ++sample.processes;
+        }
+
+        if (timer_.isValid())
+        {
+            SYSTEM_INFO system_info;
+            GetSystemInfo(&system_info);
+
+            const double elapsed =
+                qMax(timer_.nsecsElapsed(), qint64(1)) * system_info.dwNumberOfProcessors;
+
+            sample.cpu_usage = cpu_delta_ * 100.0 / elapsed;
+        }
+
+        timer_.start();
+        cpu_times_ = std::move(cpu_times);
+        cpu_delta_ = 0;
+
+        return sample;
+    }
+
+private:
+    static qint64 toNanoseconds(const FILETIME& time)
+    {
+        ULARGE_INTEGER value;
+        value.LowPart = time.dwLowDateTime;
+        value.HighPart = time.dwHighDateTime;
+        return static_cast<qint64>(value.QuadPart) * 100;
+    }
+
+    const QStringList process_names_;
+    std::map<DWORD, qint64> cpu_times_;
+    qint64 cpu_delta_ = 0;
+    QElapsedTimer timer_;
+
+    Q_DISABLE_COPY(HostUsage)
+};
+
+void printHeader(QTextStream& out)
+{
+    out << qSetFieldWidth(8) << right << "time_s" << "active" << "failed"
+        << qSetFieldWidth(10) << "fps" << "min_fps" << "mbit/s" << "req/s" << "rtt_ms"
+        << "max_rtt" << "host_cpu" << "host_mb"
+        << qSetFieldWidth(0) << endl;
+}
+
+void printSessions(QTextStream& out, const std::vector<Session>& sessions)
+{
+    out << endl
+        << qSetFieldWidth(8) << right << "session" << "type"
+        << qSetFieldWidth(10) << "fps" << "mbit/s" << "req/s" << "rtt_ms" << "max_rtt"
+        << qSetFieldWidth(0) << "  status" << endl;
+
+    for (size_t i = 0; i < sessions.size(); ++i)
+    {
+        const LoadTestClient& client = *sessions[i].client;
+        const LoadTestClient::Counters& total = sessions[i].total;
+
+        const double seconds = qMax(total.elapsed_time, qint64(1)) / 1000.0;
+
+        out << qSetFieldWidth(8) << right << i
+            << sessionTypeName(client.connectData().sessionType())
+            << qSetFieldWidth(10) << fixed << qSetRealNumberPrecision(1)
+            << total.frames / seconds
+            << total.bytes * 8 / seconds / 1000000.0
+            << total.requests / seconds
+            << total.round_trip_time / static_cast<double>(qMax(total.round_trips, qint64(1)))
+            << total.max_round_trip_time
+            << qSetFieldWidth(0) << "  "
+            << (client.errorString().isEmpty() ? QStringLiteral("OK") : client.errorString())
+            << endl;
+    }
+}
+
+} // namespace
+
+int loadTestMain(int argc, char *argv[])
+{
+    QCoreApplication application(argc, argv);
+    application.setOrganizationName(QStringLiteral("Aspia"));
+    application.setApplicationName(QStringLiteral("Load Test"));
+    application.setApplicationVersion(QStringLiteral(ASPIA_VERSION_STRING));
+
+    QCommandLineOption port_option(QStringLiteral("port"),
+                                   QStringLiteral("Port of the host."),
+                                   QStringLiteral("port"),
+                                   QString::number(kDefaultHostTcpPort));
+    QCommandLineOption user_option(QStringLiteral("user"),
+                                   QStringLiteral("User name of the host."),
+                                   QStringLiteral("name"));
+    QCommandLineOption password_option(QStringLiteral("password-stdin"),
+                                       QStringLiteral("Read the password of the user from the "
+                                                      "standard input."));
+    QCommandLineOption desktop_option(QStringLiteral("desktop"),
+                                      QStringLiteral("Number of the desktop manage sessions."),
+                                      QStringLiteral("count"),
+                                      QStringLiteral("0"));
+    QCommandLineOption view_option(QStringLiteral("view"),
+                                   QStringLiteral("Number of the desktop view sessions."),
+                                   QStringLiteral("count"),
+                                   QStringLiteral("0"));
+    QCommandLineOption file_option(QStringLiteral("file"),
+                                   QStringLiteral("Number of the file transfer sessions."),
+                                   QStringLiteral("count"),
+                                   QStringLiteral("0"));
+    QCommandLineOption system_info_option(QStringLiteral("system-info"),
+                                          QStringLiteral("Number of the system info sessions."),
+                                          QStringLiteral("count"),
+                                          QStringLiteral("0"));
+    QCommandLineOption decode_option(QStringLiteral("decode"),
+                                     QStringLiteral("Decode the video by the real decoders."));
+    QCommandLineOption input_rate_option(QStringLiteral("input-rate"),
+                                         QStringLiteral("Pointer events per second of each "
+                                                        "desktop manage session, 0 to disable."),
+                                         QStringLiteral("rate"),
+                                         QString::number(kDefaultInputRate));
+    QCommandLineOption request_interval_option(
+        QStringLiteral("request-interval"),
+        QStringLiteral("Interval between the requests of the file transfer and the system "
+                       "info sessions in milliseconds."),
+        QStringLiteral("ms"),
+        QString::number(kDefaultRequestInterval));
+    QCommandLineOption connect_rate_option(QStringLiteral("connect-rate"),
+                                           QStringLiteral("Sessions opened per second."),
+                                           QStringLiteral("rate"),
+                                           QString::number(kDefaultConnectRate));
+    QCommandLineOption duration_option(QStringLiteral("duration"),
+                                       QStringLiteral("Duration of the test in seconds."),
+                                       QStringLiteral("duration"),
+                                       QString::number(kDefaultDuration));
+    QCommandLineOption interval_option(QStringLiteral("interval"),
+                                       QStringLiteral("Interval of the reports in seconds."),
+                                       QStringLiteral("interval"),
+                                       QString::number(kDefaultInterval));
+    QCommandLineOption host_process_option(
+        QStringLiteral("host-process"),
+        QStringLiteral("Comma-separated names of the processes of the host which usage is "
+                       "reported if the test runs on the computer of the host."),
+        QStringLiteral("names"),
+        QLatin1String(kDefaultHostProcesses));
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(
+        QStringLiteral("Opens many sessions to one host and reports the frame rate, the round "
+                       "trip time and the usage of the host by the sessions."));
+    parser.addHelpOption();
+    parser.addVersionOption();
+    parser.addPositionalArgument(QStringLiteral("address"), QStringLiteral("Address of the host."));
+    parser.addOption(port_option);
+    parser.addOption(user_option);
+    parser.addOption(password_option);
+    parser.addOption(desktop_option);
+    parser.addOption(view_option);
+    parser.addOption(file_option);
+    parser.addOption(system_info_option);
+    parser.addOption(decode_option);
+    parser.addOption(input_rate_option);
+    parser.addOption(request_interval_option);
+    parser.addOption(connect_rate_option);
+    parser.addOption(duration_option);
+    parser.addOption(interval_option);
+    parser.addOption(host_process_option);
+    parser.process(application);
+
+    if (parser.positionalArguments().size() != 1)
+        parser.showHelp(1);
+
+    LoadTestClient::Options options;
+    options.decode = parser.isSet(decode_option);
+    options.input_rate = parser.value(input_rate_option).toInt();
+    options.request_interval = parser.value(request_interval_option).toInt();
+
+    const int connect_rate = parser.value(connect_rate_option).toInt();
+    const int duration = parser.value(duration_option).toInt() * 1000;
+    const int interval = parser.value(interval_option).toInt() * 1000;
+
+    if (options.input_rate < 0 || options.request_interval < 0 || connect_rate <= 0 ||
+        duration <= 0 || interval <= 0)
+    {
+        qWarning("Invalid rate, interval or duration");
+        return 1;
+    }
+
+    ConnectData connect_data;
+    connect_data.setAddress(parser.positionalArguments().front());
+    connect_data.setPort(parser.value(port_option).toInt());
+    connect_data.setUserName(parser.value(user_option));
+
+    // The password is not passed by the command line, because it is seen by other users.
+    if (parser.isSet(password_option))
+    {
+        QString line = QTextStream(stdin).readLine();
+        connect_data.setPassword(line);
+        secureMemZero(&line);
+    }
+
+    const std::pair<const QCommandLineOption*, proto::auth::SessionType> session_options[] =
+    {
+        { &desktop_option, proto::auth::SESSION_TYPE_DESKTOP_MANAGE },
+        { &view_option, proto::auth::SESSION_TYPE_DESKTOP_VIEW },
+        { &file_option, proto::auth::SESSION_TYPE_FILE_TRANSFER },
+        { &system_info_option, proto::auth::SESSION_TYPE_SYSTEM_INFO }
+    };
+
+    std::vector<Session> sessions;
+
+    for (const auto& session_option : session_options)
+    {
+        const int count = parser.value(*session_option.first).toInt();
+
+        connect_data.setSessionType(session_option.second);
+
+        for (int i = 0; i < count; ++i)
+            sessions.push_back(Session{ new LoadTestClient(connect_data, options, &application) });
+    }
+
+    if (sessions.empty())
+    {
+        qWarning("No sessions are specified");
+        return 1;
+    }
+
+    HostUsage host_usage(
+        parser.value(host_process_option).split(QLatin1Char(','), QString::SkipEmptyParts));
+    host_usage.sample();
+
+    QTextStream out(stdout);
+    printHeader(out);
+
+    // The sessions are opened gradually, so the host is not limited by the burst of the
+    // connections.
+    size_t started = 0;
+
+    QTimer connect_timer;
+    QObject::connect(&connect_timer, &QTimer::timeout, [&]()
+    {
+        if (started < sessions.size())
+            sessions[started++].client->start();
+        else
+            connect_timer.stop();
+    });
+    connect_timer.start(qMax(1, 1000 / connect_rate));
+
+    QElapsedTimer test_clock;
+    test_clock.start();
+
+    QTimer report_timer;
+    QObject::connect(&report_timer, &QTimer::timeout, [&]()
+    {
+        int active = 0;
+        int failed = 0;
+        int desktops = 0;
+        double fps = 0;
+        double min_fps = 0;
+
+        LoadTestClient::Counters sum;
+
+        for (auto& session : sessions)
+        {
+            const LoadTestClient::Counters counters = session.client->takeCounters();
+            addCounters(counters, &session.total);
+
+            if (!session.client->errorString().isEmpty())
+                ++failed;
+
+            if (!session.client->isActive())
+                continue;
+
+            ++active;
+            addCounters(counters, &sum);
+
+            const proto::auth::SessionType session_type =
+                session.client->connectData().sessionType();
+
+            if (session_type == proto::auth::SESSION_TYPE_DESKTOP_MANAGE ||
+                session_type == proto::auth::SESSION_TYPE_DESKTOP_VIEW)
+            {
+                const double session_fps =
+                    counters.frames * 1000.0 / qMax(counters.elapsed_time, qint64(1));
+
+                min_fps = desktops ? qMin(min_fps, session_fps) : session_fps;
+                fps += session_fps;
+                ++desktops;
+            }
+        }
+
+        const HostUsage::Sample usage = host_usage.sample();
+        const double seconds = interval / 1000.0;
+
+        out << qSetFieldWidth(8) << right << test_clock.elapsed() / 1000 << active << failed
+            << qSetFieldWidth(10) << fixed << qSetRealNumberPrecision(1)
+            << (desktops ? fps / desktops : 0.0) << min_fps
+            << sum.bytes * 8 / seconds / 1000000.0
+            << sum.requests / seconds
+            << sum.round_trip_time / static_cast<double>(qMax(sum.round_trips, qint64(1)))
+            << sum.max_round_trip_time;
+
+        if (usage.processes)
+            out << usage.cpu_usage << usage.memory / (1024 * 1024);
+        else
+            out << "-" << "-";
+
+        out << qSetFieldWidth(0) << endl;
+    });
+    report_timer.start(interval);
+
+    QTimer::singleShot(duration, &application, &QCoreApplication::quit);
+
+    application.exec();
+
+    printSessions(out, sessions);
+
+    for (auto& session : sessions)
+        delete session.client;
+
+    return 0;
+}
+
+} // namespace aspia
@@ -0,0 +1,19 @@
+//
+// PROJECT:         Aspia
+// FILE:            client/load_test_main.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CLIENT__LOAD_TEST_MAIN_H
+#define _ASPIA_CLIENT__LOAD_TEST_MAIN_H
+
+#include "core_export.h"
+
+namespace aspia {
+
+int CORE_EXPORT loadTestMain(int argc, char *argv[]);
+
+} // namespace aspia
+
+#endif // _ASPIA_CLIENT__LOAD_TEST_MAIN_H
@@ -22,6 +22,15 @@ enum ColorDepth
     COLOR_DEPTH_RGB111
 };
 
+// Returns true if the encoding sends the raw pixels of the selected color depth.
+bool isRawEncoding(int video_encoding)
+{
+    return video_encoding == proto::desktop::VIDEO_ENCODING_ZLIB ||
+           video_encoding == proto::desktop::VIDEO_ENCODING_LZ4 ||
+           video_encoding == proto::desktop::VIDEO_ENCODING_ZSTD ||
+           video_encoding == proto::desktop::VIDEO_ENCODING_HYBRID;
+}
+
 } // namespace
 
 DesktopConfigDialog::DesktopConfigDialog(const proto::desktop::Config& config,
@@ -35,18 +44,46 @@ DesktopConfigDialog::DesktopConfigDialog(const proto::desktop::Config& config,
 {
     ui.setupUi(this);
 
+    if (supported_video_encodings_ & proto::desktop::VIDEO_ENCODING_H264)
+        ui.combo_codec->addItem(QStringLiteral("H.264 (Hardware)"),
+                                QVariant(proto::desktop::VIDEO_ENCODING_H264));
+
+    if (supported_video_encodings_ & proto::desktop::VIDEO_ENCODING_AV1)
+        ui.combo_codec->addItem(QStringLiteral("AV1"),
+                                QVariant(proto::desktop::VIDEO_ENCODING_AV1));
+
     if (supported_video_encodings_ & proto::desktop::VIDEO_ENCODING_VP9)
         ui.combo_codec->addItem(QStringLiteral("VP9 (LossLess)"),
                                 QVariant(proto::desktop::VIDEO_ENCODING_VP9));
 
+    if (supported_video_encodings_ & proto::desktop::VIDEO_ENCODING_VP9_LOSSY)
+        ui.combo_codec->addItem(QStringLiteral("VP9"),
+                                QVariant(proto::desktop::VIDEO_ENCODING_VP9_LOSSY));
+
+    if (supported_video_encodings_ & proto::desktop::VIDEO_ENCODING_HYBRID)
+        ui.combo_codec->addItem(QStringLiteral("Hybrid (ZLIB + VP8)"),
+                                QVariant(proto::desktop::VIDEO_ENCODING_HYBRID));
+
+    if (supported_video_encodings_ & proto::desktop::VIDEO_ENCODING_PALETTE)
+        ui.combo_codec->addItem(QStringLiteral("Palette (UI and text)"),
+                                QVariant(proto::desktop::VIDEO_ENCODING_PALETTE));
+
     if (supported_video_encodings_ & proto::desktop::VIDEO_ENCODING_VP8)
         ui.combo_codec->addItem(QStringLiteral("VP8"),
                                 QVariant(proto::desktop::VIDEO_ENCODING_VP8));
 
+    if (supported_video_encodings_ & proto::desktop::VIDEO_ENCODING_ZSTD)
+        ui.combo_codec->addItem(QStringLiteral("Zstandard"),
+                                QVariant(proto::desktop::VIDEO_ENCODING_ZSTD));
+
     if (supported_video_encodings_ & proto::desktop::VIDEO_ENCODING_ZLIB)
         ui.combo_codec->addItem(QStringLiteral("ZLIB"),
                                 QVariant(proto::desktop::VIDEO_ENCODING_ZLIB));
 
+    if (supported_video_encodings_ & proto::desktop::VIDEO_ENCODING_LZ4)
+        ui.combo_codec->addItem(QStringLiteral("LZ4 (LAN)"),
+                                QVariant(proto::desktop::VIDEO_ENCODING_LZ4));
+
     int current_codec = ui.combo_codec->findData(QVariant(config.video_encoding()));
     if (current_codec == -1)
         current_codec = 0;
@@ -81,7 +118,10 @@ DesktopConfigDialog::DesktopConfigDialog(const proto::desktop::Config& config,
     ui.slider_compression_ratio->setValue(config.compress_ratio());
     onCompressionRatioChanged(config.compress_ratio());
 
+    ui.checkbox_auto_encoding->setChecked(config.auto_encoding());
+
     ui.spin_update_interval->setValue(config.update_interval());
+    ui.spin_bandwidth_limit->setValue(config.bandwidth_limit());
 
     if (config.features() & proto::desktop::FEATURE_CURSOR_SHAPE)
         ui.checkbox_cursor_shape->setChecked(true);
@@ -95,6 +135,18 @@ DesktopConfigDialog::DesktopConfigDialog(const proto::desktop::Config& config,
     if (!(supported_features_ & proto::desktop::FEATURE_CLIPBOARD))
         ui.checkbox_clipboard->setEnabled(false);
 
+    if (config.features() & proto::desktop::FEATURE_SCALING)
+        ui.checkbox_scaling->setChecked(true);
+
+    if (!(supported_features_ & proto::desktop::FEATURE_SCALING))
+        ui.checkbox_scaling->setEnabled(false);
+
+    if (config.features() & proto::desktop::FEATURE_REDUCED_EFFECTS)
+        ui.checkbox_reduced_effects->setChecked(true);
+
+    if (!(supported_features_ & proto::desktop::FEATURE_REDUCED_EFFECTS))
+        ui.checkbox_reduced_effects->setEnabled(false);
+
     connect(ui.combo_codec, QOverload<int>::of(&QComboBox::currentIndexChanged),
             this, &DesktopConfigDialog::onCodecChanged);
 
@@ -110,15 +162,22 @@ DesktopConfigDialog::DesktopConfigDialog(const proto::desktop::Config& config,
 
 void DesktopConfigDialog::onCodecChanged(int item_index)
 {
-    bool has_pixel_format =
-        (ui.combo_codec->itemData(item_index).toInt() == proto::desktop::VIDEO_ENCODING_ZLIB);
+    const int video_encoding = ui.combo_codec->itemData(item_index).toInt();
+
+    bool has_pixel_format = isRawEncoding(video_encoding);
+
+    // LZ4 has no compression levels. The palette encoding always sends 32 bit pixels, the
+    // ratio is used for the tiles with many colors.
+    bool has_compression_ratio =
+        (has_pixel_format && video_encoding != proto::desktop::VIDEO_ENCODING_LZ4) ||
+        video_encoding == proto::desktop::VIDEO_ENCODING_PALETTE;
 
     ui.label_color_depth->setEnabled(has_pixel_format);
     ui.combo_color_depth->setEnabled(has_pixel_format);
-    ui.label_compression_ratio->setEnabled(has_pixel_format);
-    ui.slider_compression_ratio->setEnabled(has_pixel_format);
-    ui.label_fast->setEnabled(has_pixel_format);
-    ui.label_best->setEnabled(has_pixel_format);
+    ui.label_compression_ratio->setEnabled(has_compression_ratio);
+    ui.slider_compression_ratio->setEnabled(has_compression_ratio);
+    ui.label_fast->setEnabled(has_compression_ratio);
+    ui.label_best->setEnabled(has_compression_ratio);
 }
 
 void DesktopConfigDialog::onCompressionRatioChanged(int value)
@@ -135,7 +194,7 @@ void DesktopConfigDialog::onButtonBoxClicked(QAbstractButton* button)
 
         config_.set_video_encoding(video_encoding);
 
-        if (video_encoding == proto::desktop::VIDEO_ENCODING_ZLIB)
+        if (isRawEncoding(video_encoding))
         {
             PixelFormat pixel_format;
 
@@ -170,8 +229,14 @@ void DesktopConfigDialog::onButtonBoxClicked(QAbstractButton* button)
 
             config_.set_compress_ratio(ui.slider_compression_ratio->value());
         }
+        else if (video_encoding == proto::desktop::VIDEO_ENCODING_PALETTE)
+        {
+            config_.set_compress_ratio(ui.slider_compression_ratio->value());
+        }
 
+        config_.set_auto_encoding(ui.checkbox_auto_encoding->isChecked());
         config_.set_update_interval(ui.spin_update_interval->value());
+        config_.set_bandwidth_limit(ui.spin_bandwidth_limit->value());
 
         quint32 features = 0;
 
@@ -181,6 +246,12 @@ void DesktopConfigDialog::onButtonBoxClicked(QAbstractButton* button)
         if (ui.checkbox_clipboard->isChecked())
             features |= proto::desktop::FEATURE_CLIPBOARD;
 
+        if (ui.checkbox_scaling->isChecked())
+            features |= proto::desktop::FEATURE_SCALING;
+
+        if (ui.checkbox_reduced_effects->isChecked())
+            features |= proto::desktop::FEATURE_REDUCED_EFFECTS;
+
         config_.set_features(features);
 
         accept();
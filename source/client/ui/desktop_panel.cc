@@ -7,6 +7,7 @@
 
 #include "client/ui/desktop_panel.h"
 
+#include <QActionGroup>
 #include <QMenu>
 
 #include "client/ui/key_sequence_dialog.h"
@@ -19,9 +20,13 @@ DesktopPanel::DesktopPanel(proto::auth::SessionType session_type, QWidget* paren
     ui.setupUi(this);
 
     connect(ui.button_settings, &QPushButton::pressed, this, &DesktopPanel::settingsButton);
+    connect(ui.button_statistics, &QPushButton::clicked, this, &DesktopPanel::switchStatistics);
     connect(ui.button_autosize, &QPushButton::pressed, this, &DesktopPanel::onAutosizeButton);
     connect(ui.button_full_screen, &QPushButton::clicked, this, &DesktopPanel::onFullscreenButton);
 
+    // The button is shown when the host reports several screens.
+    ui.button_screens->hide();
+
     if (session_type == proto::auth::SESSION_TYPE_DESKTOP_MANAGE)
     {
         keys_menu_ = new QMenu(this);
@@ -74,6 +79,84 @@ DesktopPanel::DesktopPanel(proto::auth::SessionType session_type, QWidget* paren
     hide_timer_id_ = startTimer(std::chrono::seconds(1));
 }
 
+void DesktopPanel::setScreenList(const proto::desktop::ScreenList& screen_list)
+{
+    delete screens_menu_;
+
+    int display_count = 0;
+
+    for (int i = 0; i < screen_list.screen_size(); ++i)
+    {
+        if (!screen_list.screen(i).window())
+            ++display_count;
+    }
+
+    // The full desktop and one screen are the same picture.
+    if (display_count <= 2 && display_count == screen_list.screen_size())
+    {
+        ui.button_screens->hide();
+        adjustSize();
+        return;
+    }
+
+    screens_menu_ = new QMenu(this);
+
+    QActionGroup* screens_group = new QActionGroup(screens_menu_);
+    QMenu* windows_menu = nullptr;
+
+    for (int i = 0; i < screen_list.screen_size(); ++i)
+    {
+        const proto::desktop::Screen& screen = screen_list.screen(i);
+        const qint64 screen_id = screen.id();
+
+        QString title = QString::fromStdString(screen.title());
+
+        // The whole desktop has id -1.
+        if (screen_id == -1)
+            title = tr("All screens");
+
+        QAction* action;
+
+        // The windows of the applications are in a submenu after the screens.
+        if (screen.window())
+        {
+            if (!windows_menu)
+            {
+                screens_menu_->addSeparator();
+                windows_menu = screens_menu_->addMenu(tr("Application window"));
+            }
+
+            action = windows_menu->addAction(title);
+        }
+        else
+        {
+            action = screens_menu_->addAction(title);
+        }
+
+        action->setCheckable(true);
+        action->setChecked(screen_id == screen_list.current_screen());
+        screens_group->addAction(action);
+
+        connect(action, &QAction::triggered, this, [this, screen_id]()
+        {
+            emit screenSelected(screen_id);
+        });
+    }
+
+    connect(screens_menu_, &QMenu::aboutToShow, [this]() { allow_hide_ = false; });
+    connect(screens_menu_, &QMenu::aboutToHide, [this]()
+    {
+        allow_hide_ = true;
+
+        if (leaved_)
+            delayedHide();
+    });
+
+    ui.button_screens->setMenu(screens_menu_);
+    ui.button_screens->show();
+    adjustSize();
+}
+
 void DesktopPanel::timerEvent(QTimerEvent* event)
 {
     if (event->timerId() == hide_timer_id_)
@@ -11,6 +11,7 @@
 #include <QPointer>
 
 #include "protocol/authorization.pb.h"
+#include "protocol/desktop_session.pb.h"
 #include "ui_desktop_panel.h"
 
 namespace aspia {
@@ -23,11 +24,15 @@ public:
     DesktopPanel(proto::auth::SessionType session_type, QWidget* parent);
     ~DesktopPanel() = default;
 
+    void setScreenList(const proto::desktop::ScreenList& screen_list);
+
 signals:
     void keySequence(int key_secuence);
     void switchToFullscreen(bool fullscreen);
     void switchToAutosize();
     void settingsButton();
+    void switchStatistics(bool enable);
+    void screenSelected(qint64 screen_id);
 
 protected:
     // QFrame implementation.
@@ -50,6 +55,7 @@ private:
 
     Ui::DesktopPanel ui;
     QPointer<QMenu> keys_menu_;
+    QPointer<QMenu> screens_menu_;
     int hide_timer_id_ = 0;
 
     bool allow_hide_ = true;
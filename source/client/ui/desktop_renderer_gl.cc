@@ -0,0 +1,355 @@
+//
+// PROJECT:         Aspia
+// FILE:            client/ui/desktop_renderer_gl.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "client/ui/desktop_renderer_gl.h"
+
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QOpenGLContext>
+#include <QOpenGLShaderProgram>
+#include <QPainter>
+
+#include "base/trace_logger.h"
+#include "desktop_capture/desktop_frame_qimage.h"
+
+namespace aspia {
+
+namespace {
+
+// The attributes of the shaders.
+constexpr int kPositionAttribute = 0;
+constexpr int kTexCoordAttribute = 1;
+
+const char kVertexShader[] =
+    "attribute highp vec2 position;\n"
+    "attribute highp vec2 tex_coord;\n"
+    "varying highp vec2 frag_tex_coord;\n"
+    "void main()\n"
+    "{\n"
+    "    frag_tex_coord = tex_coord;\n"
+    "    gl_Position = vec4(position, 0.0, 1.0);\n"
+    "}\n";
+
+// The pixels of the frame are stored as BGRA and uploaded as RGBA, because GL_BGRA is not
+// available in OpenGL ES. The channels are swapped back by the shader.
+const char kRgbFragmentShader[] =
+    "varying highp vec2 frag_tex_coord;\n"
+    "uniform sampler2D plane0;\n"
+    "void main()\n"
+    "{\n"
+    "    gl_FragColor = vec4(texture2D(plane0, frag_tex_coord).bgr, 1.0);\n"
+    "}\n";
+
+// BT.601 with the limited range, the same as libyuv uses for the conversion on the CPU.
+const char kYuvFragmentShader[] =
+    "varying highp vec2 frag_tex_coord;\n"
+    "uniform sampler2D plane0;\n"
+    "uniform sampler2D plane1;\n"
+    "uniform sampler2D plane2;\n"
+    "void main()\n"
+    "{\n"
+    "    highp float y = 1.164 * (texture2D(plane0, frag_tex_coord).r - 0.0625);\n"
+    "    highp float u = texture2D(plane1, frag_tex_coord).r - 0.5;\n"
+    "    highp float v = texture2D(plane2, frag_tex_coord).r - 0.5;\n"
+    "    gl_FragColor = vec4(y + 1.596 * v, y - 0.391 * u - 0.813 * v, y + 2.018 * u, 1.0);\n"
+    "}\n";
+
+const char* kPlaneUniforms[] = { "plane0", "plane1", "plane2" };
+
+// The quad covers the whole widget. The first row of the texture is the top of the screen.
+const GLfloat kPositions[] = { -1.0f, -1.0f, 1.0f, -1.0f, -1.0f, 1.0f, 1.0f, 1.0f };
+const GLfloat kTexCoords[] = { 0.0f, 1.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f };
+
+} // namespace
+
+DesktopRendererGL::DesktopRendererGL(QWidget* parent)
+    : QOpenGLWidget(parent)
+{
+    // The input is handled by the parent widget.
+    setAttribute(Qt::WA_TransparentForMouseEvents);
+    setFocusPolicy(Qt::NoFocus);
+}
+
+DesktopRendererGL::~DesktopRendererGL()
+{
+    releaseTextures();
+}
+
+// static
+bool DesktopRendererGL::isAvailable()
+{
+    static const bool available = []()
+    {
+        QOpenGLContext context;
+
+        if (!context.create())
+        {
+            qInfo("OpenGL is not available. The desktop is drawn by QPainter");
+            return false;
+        }
+
+        // The shaders are required.
+        if (!context.isOpenGLES() && context.format().majorVersion() < 2)
+        {
+            qInfo("OpenGL 2.0 is not supported. The desktop is drawn by QPainter");
+            return false;
+        }
+
+        return true;
+    }();
+
+    return available;
+}
+
+void DesktopRendererGL::setDesktopFrame(const DesktopFrameQImage* frame,
+                                        const QRegion& dirty_region)
+{
+    frame_ = frame;
+    yuv_frame_ = nullptr;
+
+    frameChanged(frame ? frame->size() : QSize(), false, dirty_region);
+}
+
+void DesktopRendererGL::setDesktopFrame(const DesktopFrameYUV* frame,
+                                        const QRegion& dirty_region)
+{
+    frame_ = nullptr;
+    yuv_frame_ = frame;
+
+    frameChanged(frame ? frame->size() : QSize(), true, dirty_region);
+}
+
+void DesktopRendererGL::frameChanged(const QSize& size, bool yuv, const QRegion& dirty_region)
+{
+    // The other frame of the decoder contains all previous changes, so the accumulated region
+    // is uploaded from the new frame.
+    if (size == frame_size_ && yuv == texture_yuv_)
+        upload_region_ += dirty_region;
+    else
+        upload_region_ = QRect(QPoint(), size);
+
+    frame_size_ = size;
+    update();
+}
+
+void DesktopRendererGL::setRemoteCursor(const QImage& image, const QRect& rect)
+{
+    remote_cursor_ = image;
+    remote_cursor_rect_ = rect;
+    update();
+}
+
+void DesktopRendererGL::initializeGL()
+{
+    initializeOpenGLFunctions();
+
+    // The context is created again when the widget is moved to another top-level window.
+    for (int i = 0; i < kTextureCount; ++i)
+        textures_[i] = 0;
+
+    texture_size_ = QSize();
+    upload_region_ = QRect(QPoint(), frame_size_);
+
+    rgb_program_ = createProgram(kRgbFragmentShader);
+    yuv_program_ = createProgram(kYuvFragmentShader);
+
+    connect(context(), &QOpenGLContext::aboutToBeDestroyed,
+            this, &DesktopRendererGL::releaseTextures, Qt::UniqueConnection);
+}
+
+void DesktopRendererGL::paintGL()
+{
+    ScopedTrace trace("paint");
+
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    QOpenGLShaderProgram* program = yuv_frame_ ? yuv_program_.get() : rgb_program_.get();
+
+    if ((!frame_ && !yuv_frame_) || !program)
+        return;
+
+    QElapsedTimer paint_timer;
+    paint_timer.start();
+
+    uploadFrame();
+
+    program->bind();
+
+    const int texture_count = yuv_frame_ ? kTextureCount : 1;
+
+    for (int i = 0; i < texture_count; ++i)
+    {
+        program->setUniformValue(kPlaneUniforms[i], i);
+
+        glActiveTexture(GL_TEXTURE0 + i);
+        glBindTexture(GL_TEXTURE_2D, textures_[i]);
+    }
+
+    program->enableAttributeArray(kPositionAttribute);
+    program->enableAttributeArray(kTexCoordAttribute);
+    program->setAttributeArray(kPositionAttribute, kPositions, 2);
+    program->setAttributeArray(kTexCoordAttribute, kTexCoords, 2);
+
+    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+
+    program->disableAttributeArray(kPositionAttribute);
+    program->disableAttributeArray(kTexCoordAttribute);
+    program->release();
+
+    for (int i = texture_count - 1; i >= 0; --i)
+    {
+        glActiveTexture(GL_TEXTURE0 + i);
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+
+    if (!remote_cursor_.isNull() && !remote_cursor_rect_.isEmpty())
+    {
+        // The cursor is small, so it is drawn by QPainter over the frame.
+        QPainter painter(this);
+        painter.drawImage(remote_cursor_rect_, remote_cursor_);
+    }
+
+    paint_time_ = (paint_time_ * 7 + paint_timer.nsecsElapsed() / 1000) / 8;
+}
+
+std::unique_ptr<QOpenGLShaderProgram> DesktopRendererGL::createProgram(
+    const char* fragment_shader)
+{
+    std::unique_ptr<QOpenGLShaderProgram> program = std::make_unique<QOpenGLShaderProgram>();
+
+    program->addShaderFromSourceCode(QOpenGLShader::Vertex, kVertexShader);
+    program->addShaderFromSourceCode(QOpenGLShader::Fragment, fragment_shader);
+    program->bindAttributeLocation("position", kPositionAttribute);
+    program->bindAttributeLocation("tex_coord", kTexCoordAttribute);
+
+    if (!program->link())
+    {
+        qWarning() << "Unable to link the shaders: " << program->log();
+        return nullptr;
+    }
+
+    return program;
+}
+
+void DesktopRendererGL::uploadFrame()
+{
+    const bool yuv = yuv_frame_ != nullptr;
+
+    if (texture_size_ != frame_size_ || texture_yuv_ != yuv ||
+        (yuv && texture_layout_ != yuv_frame_->layout()))
+    {
+        texture_size_ = frame_size_;
+        texture_yuv_ = yuv;
+
+        if (yuv)
+            texture_layout_ = yuv_frame_->layout();
+
+        allocateTextures();
+        upload_region_ = QRect(QPoint(), frame_size_);
+    }
+
+    // GL_UNPACK_ROW_LENGTH is not available in OpenGL ES 2.0, so the whole rows of the changed
+    // areas are uploaded. The rows of the frames follow each other without gaps.
+    QRegion rows;
+
+    for (const auto& rect : upload_region_ & QRect(QPoint(), frame_size_))
+        rows += QRect(0, rect.top(), frame_size_.width(), rect.height());
+
+    upload_region_ = QRegion();
+
+    if (!yuv)
+    {
+        glBindTexture(GL_TEXTURE_2D, textures_[0]);
+
+        for (const auto& rect : rows)
+        {
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, rect.top(), rect.width(), rect.height(),
+                            GL_RGBA, GL_UNSIGNED_BYTE, frame_->frameDataAtPos(0, rect.top()));
+        }
+
+        glBindTexture(GL_TEXTURE_2D, 0);
+        return;
+    }
+
+    // The rows of the planes have any width.
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    for (int i = 0; i < kTextureCount; ++i)
+    {
+        glBindTexture(GL_TEXTURE_2D, textures_[i]);
+
+        for (const auto& rect : rows)
+        {
+            const QRect plane_rect = yuv_frame_->planeRect(i, rect);
+
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, plane_rect.top(),
+                            plane_rect.width(), plane_rect.height(),
+                            GL_LUMINANCE, GL_UNSIGNED_BYTE,
+                            yuv_frame_->plane(i) + plane_rect.top() * yuv_frame_->stride(i));
+        }
+    }
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+}
+
+void DesktopRendererGL::allocateTextures()
+{
+    if (!textures_[0])
+        glGenTextures(kTextureCount, textures_);
+
+    const int texture_count = texture_yuv_ ? kTextureCount : 1;
+
+    for (int i = 0; i < texture_count; ++i)
+    {
+        glBindTexture(GL_TEXTURE_2D, textures_[i]);
+
+        // The textures with any size are allowed in OpenGL ES 2.0 only without mipmaps and
+        // with the clamping.
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+        if (texture_yuv_)
+        {
+            const QSize plane_size = (i == 0 || texture_layout_ == DesktopFrameYUV::Layout::I444) ?
+                texture_size_ : QSize((texture_size_.width() + 1) / 2,
+                                      (texture_size_.height() + 1) / 2);
+
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_LUMINANCE,
+                         plane_size.width(), plane_size.height(), 0,
+                         GL_LUMINANCE, GL_UNSIGNED_BYTE, nullptr);
+        }
+        else
+        {
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA,
+                         texture_size_.width(), texture_size_.height(), 0,
+                         GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        }
+    }
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void DesktopRendererGL::releaseTextures()
+{
+    if (!textures_[0] || !context())
+        return;
+
+    makeCurrent();
+    glDeleteTextures(kTextureCount, textures_);
+
+    for (int i = 0; i < kTextureCount; ++i)
+        textures_[i] = 0;
+
+    texture_size_ = QSize();
+    doneCurrent();
+}
+
+} // namespace aspia
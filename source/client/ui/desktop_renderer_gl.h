@@ -0,0 +1,92 @@
+//
+// PROJECT:         Aspia
+// FILE:            client/ui/desktop_renderer_gl.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CLIENT__UI__DESKTOP_RENDERER_GL_H
+#define _ASPIA_CLIENT__UI__DESKTOP_RENDERER_GL_H
+
+#include <QImage>
+#include <QOpenGLFunctions>
+#include <QOpenGLWidget>
+
+#include <memory>
+
+#include "desktop_capture/desktop_frame_yuv.h"
+
+class QOpenGLShaderProgram;
+
+namespace aspia {
+
+class DesktopFrameQImage;
+
+//
+// Draws the remote desktop with OpenGL. The frame is kept in textures and only the changed
+// rows are uploaded. The textures are stretched to the size of the widget by the GPU. The
+// planar frames are converted to RGB by the shader.
+//
+class DesktopRendererGL : public QOpenGLWidget, protected QOpenGLFunctions
+{
+    Q_OBJECT
+
+public:
+    explicit DesktopRendererGL(QWidget* parent);
+    ~DesktopRendererGL();
+
+    // Returns true if an OpenGL context with the shaders can be created.
+    static bool isAvailable();
+
+    // The frame must be valid until the next call.
+    void setDesktopFrame(const DesktopFrameQImage* frame, const QRegion& dirty_region);
+    void setDesktopFrame(const DesktopFrameYUV* frame, const QRegion& dirty_region);
+
+    // If |rect| is empty, then the cursor is not drawn.
+    void setRemoteCursor(const QImage& image, const QRect& rect);
+
+    // Returns the smoothed time of drawing the frame in microseconds.
+    qint64 paintTime() const { return paint_time_; }
+
+protected:
+    // QOpenGLWidget implementation.
+    void initializeGL() override;
+    void paintGL() override;
+
+private:
+    static const int kTextureCount = DesktopFrameYUV::kPlaneCount;
+
+    void frameChanged(const QSize& size, bool yuv, const QRegion& dirty_region);
+    std::unique_ptr<QOpenGLShaderProgram> createProgram(const char* fragment_shader);
+    void uploadFrame();
+    void allocateTextures();
+    void releaseTextures();
+
+    // Only one of the frames is set.
+    const DesktopFrameQImage* frame_ = nullptr;
+    const DesktopFrameYUV* yuv_frame_ = nullptr;
+    QSize frame_size_;
+
+    // The areas of the frame which are not uploaded to the textures yet.
+    QRegion upload_region_;
+
+    std::unique_ptr<QOpenGLShaderProgram> rgb_program_;
+    std::unique_ptr<QOpenGLShaderProgram> yuv_program_;
+
+    // The RGB frames use only the first texture.
+    GLuint textures_[kTextureCount] = { 0 };
+    QSize texture_size_;
+    bool texture_yuv_ = false;
+    DesktopFrameYUV::Layout texture_layout_ = DesktopFrameYUV::Layout::I420;
+
+    QImage remote_cursor_;
+    QRect remote_cursor_rect_;
+
+    qint64 paint_time_ = 0;
+
+    Q_DISABLE_COPY(DesktopRendererGL)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_CLIENT__UI__DESKTOP_RENDERER_GL_H
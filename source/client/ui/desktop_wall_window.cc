@@ -0,0 +1,145 @@
+//
+// PROJECT:         Aspia
+// FILE:            client/ui/desktop_wall_window.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "client/ui/desktop_wall_window.h"
+
+#include <QMouseEvent>
+#include <QPainter>
+#include <QPaintEvent>
+
+#include <cmath>
+
+#include "client/wall_client.h"
+
+namespace aspia {
+
+namespace {
+
+// The host scales the screen down to fit into this size.
+const QSize kThumbnailSize(320, 180);
+
+constexpr int kTileMargin = 4;
+
+} // namespace
+
+DesktopWallWindow::DesktopWallWindow(const QString& title,
+                                     const QVector<ConnectData>& computers,
+                                     QWidget* parent)
+    : QWidget(parent)
+{
+    setWindowTitle(tr("Monitoring Wall - %1").arg(title));
+    setAttribute(Qt::WA_OpaquePaintEvent);
+
+    for (const auto& connect_data : computers)
+    {
+        WallClient* client = new WallClient(connect_data, kThumbnailSize, this);
+
+        connect(client, &WallClient::changed, this, [this](WallClient* changed_client)
+        {
+            update(tileRect(clients_.indexOf(changed_client)));
+        });
+
+        clients_.push_back(client);
+    }
+
+    for (auto client : clients_)
+        client->start();
+}
+
+QSize DesktopWallWindow::sizeHint() const
+{
+    const int columns = columnCount();
+    const int rows = (clients_.size() + columns - 1) / columns;
+
+    // The tiles are shown at the half of the thumbnail size by default.
+    return QSize(columns * (kThumbnailSize.width() / 2 + kTileMargin) + kTileMargin,
+                 rows * (kThumbnailSize.height() / 2 + fontMetrics().height() + kTileMargin) +
+                     kTileMargin);
+}
+
+void DesktopWallWindow::paintEvent(QPaintEvent* event)
+{
+    QPainter painter(this);
+    painter.fillRect(event->rect(), Qt::black);
+    painter.setRenderHint(QPainter::SmoothPixmapTransform);
+    painter.setPen(Qt::white);
+
+    const int text_height = fontMetrics().height();
+
+    for (int i = 0; i < clients_.size(); ++i)
+    {
+        const WallClient* client = clients_[i];
+
+        const QRect tile = tileRect(i);
+        if (!event->rect().intersects(tile))
+            continue;
+
+        const QRect screen_rect = tile.adjusted(0, 0, 0, -text_height);
+        const QImage& image = client->image();
+
+        if (!image.isNull())
+        {
+            // The aspect ratio of the screen is kept.
+            QRect image_rect(QPoint(), image.size().scaled(screen_rect.size(),
+                                                           Qt::KeepAspectRatio));
+            image_rect.moveCenter(screen_rect.center());
+
+            painter.drawImage(image_rect, image);
+        }
+
+        if (!client->statusString().isEmpty())
+        {
+            painter.drawText(screen_rect, Qt::AlignCenter | Qt::TextWordWrap,
+                             client->statusString());
+        }
+
+        const QRect name_rect(tile.left(), screen_rect.bottom() + 1, tile.width(), text_height);
+
+        painter.drawText(name_rect, Qt::AlignCenter,
+                         fontMetrics().elidedText(client->connectData().computerName(),
+                                                  Qt::ElideRight, tile.width()));
+    }
+}
+
+void DesktopWallWindow::mouseDoubleClickEvent(QMouseEvent* event)
+{
+    for (int i = 0; i < clients_.size(); ++i)
+    {
+        if (tileRect(i).contains(event->pos()))
+        {
+            emit computerDoubleClicked(clients_[i]->connectData());
+            return;
+        }
+    }
+
+    QWidget::mouseDoubleClickEvent(event);
+}
+
+QRect DesktopWallWindow::tileRect(int index) const
+{
+    if (index < 0 || index >= clients_.size())
+        return QRect();
+
+    const int columns = columnCount();
+    const int rows = (clients_.size() + columns - 1) / columns;
+
+    const int tile_width = (width() - kTileMargin) / columns - kTileMargin;
+    const int tile_height = (height() - kTileMargin) / rows - kTileMargin;
+
+    return QRect(kTileMargin + (index % columns) * (tile_width + kTileMargin),
+                 kTileMargin + (index / columns) * (tile_height + kTileMargin),
+                 tile_width,
+                 tile_height);
+}
+
+int DesktopWallWindow::columnCount() const
+{
+    // The grid is about square.
+    return qMax(1, static_cast<int>(std::ceil(std::sqrt(clients_.size()))));
+}
+
+} // namespace aspia
@@ -0,0 +1,56 @@
+//
+// PROJECT:         Aspia
+// FILE:            client/ui/desktop_wall_window.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CLIENT__UI__DESKTOP_WALL_WINDOW_H
+#define _ASPIA_CLIENT__UI__DESKTOP_WALL_WINDOW_H
+
+#include <QVector>
+#include <QWidget>
+
+#include "client/connect_data.h"
+
+namespace aspia {
+
+class WallClient;
+
+//
+// Shows the thumbnails of the screens of many hosts in a grid. The thumbnails are updated
+// about once per second, so the whole wall costs about as much as one full desktop session.
+//
+class DesktopWallWindow : public QWidget
+{
+    Q_OBJECT
+
+public:
+    DesktopWallWindow(const QString& title,
+                      const QVector<ConnectData>& computers,
+                      QWidget* parent = nullptr);
+    ~DesktopWallWindow() = default;
+
+    QSize sizeHint() const override;
+
+signals:
+    // The thumbnail of the computer is double clicked.
+    void computerDoubleClicked(const ConnectData& connect_data);
+
+protected:
+    // QWidget implementation.
+    void paintEvent(QPaintEvent* event) override;
+    void mouseDoubleClickEvent(QMouseEvent* event) override;
+
+private:
+    QRect tileRect(int index) const;
+    int columnCount() const;
+
+    QVector<WallClient*> clients_;
+
+    Q_DISABLE_COPY(DesktopWallWindow)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_CLIENT__UI__DESKTOP_WALL_WINDOW_H
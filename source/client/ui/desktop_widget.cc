@@ -7,16 +7,21 @@
 
 #include "client/ui/desktop_widget.h"
 
+#include <QCursor>
 #include <QDebug>
 #include <QPainter>
 #include <QWheelEvent>
 
+#include <algorithm>
+
 #if defined(Q_OS_WIN)
 #define WIN32_LEAN_AND_MEAN
 #include <windows.h>
 #endif // defined(Q_OS_WIN)
 
 #include "base/keycode_converter.h"
+#include "base/trace_logger.h"
+#include "client/ui/desktop_renderer_gl.h"
 #include "desktop_capture/desktop_frame_qimage.h"
 #include "protocol/desktop_session.pb.h"
 
@@ -27,6 +32,13 @@ namespace {
 constexpr quint32 kWheelMask =
     proto::desktop::PointerEvent::WHEEL_DOWN | proto::desktop::PointerEvent::WHEEL_UP;
 
+// The host reports the position of the cursor a round trip after the input. Older positions
+// are not expected anymore.
+constexpr size_t kMaxSentPositions = 64;
+
+// The local cursor is not moved while the user is moving it.
+constexpr qint64 kCursorCorrectionDelay = 300; // ms
+
 bool isNumLockActivated()
 {
 #if defined(Q_OS_WIN)
@@ -55,17 +67,41 @@ DesktopWidget::DesktopWidget(QWidget* parent)
     setAttribute(Qt::WA_OpaquePaintEvent);
     setAttribute(Qt::WA_NoSystemBackground);
     setMouseTracking(true);
+
+    if (DesktopRendererGL::isAvailable())
+        renderer_ = new DesktopRendererGL(this);
 }
 
-void DesktopWidget::resizeDesktopFrame(const QSize& screen_size)
+void DesktopWidget::drawDesktopFrame(const DesktopFrameQImage* frame,
+                                     const QRegion& dirty_region)
 {
-    frame_ = DesktopFrameQImage::create(screen_size);
-    resize(screen_size);
+    frame_ = frame;
+
+    if (renderer_)
+        renderer_->setDesktopFrame(frame, dirty_region);
+
+    frameChanged(frame ? frame->size() : QSize(), dirty_region);
 }
 
-DesktopFrame* DesktopWidget::desktopFrame()
+void DesktopWidget::drawDesktopFrame(const DesktopFrameYUV* frame, const QRegion& dirty_region)
 {
-    return frame_.get();
+    // The planar frames are requested only if the renderer is available.
+    Q_ASSERT(renderer_);
+
+    frame_ = nullptr;
+    renderer_->setDesktopFrame(frame, dirty_region);
+
+    frameChanged(frame ? frame->size() : QSize(), dirty_region);
+}
+
+bool DesktopWidget::isYuvRenderingSupported() const
+{
+    return renderer_ != nullptr;
+}
+
+qint64 DesktopWidget::paintTime() const
+{
+    return renderer_ ? renderer_->paintTime() : paint_time_;
 }
 
 void DesktopWidget::doMouseEvent(QEvent::Type event_type,
@@ -73,7 +109,7 @@ void DesktopWidget::doMouseEvent(QEvent::Type event_type,
                                  const QPoint& pos,
                                  const QPoint& delta)
 {
-    if (!frame_ || !frame_->contains(pos.x(), pos.y()))
+    if (!QRect(QPoint(), frame_size_).contains(pos))
         return;
 
     quint32 mask;
@@ -117,6 +153,15 @@ void DesktopWidget::doMouseEvent(QEvent::Type event_type,
 
     if (prev_pos_ != pos || prev_mask_ != mask)
     {
+        if (prev_pos_ != pos)
+        {
+            sent_positions_.push_back(pos);
+            if (sent_positions_.size() > kMaxSentPositions)
+                sent_positions_.pop_front();
+
+            input_clock_.start();
+        }
+
         prev_pos_ = pos;
         prev_mask_ = mask & ~kWheelMask;
 
@@ -194,15 +239,123 @@ void DesktopWidget::executeKeySequense(int key_sequence)
         emit sendKeyEvent(*it, flags);
 }
 
-void DesktopWidget::paintEvent(QPaintEvent* /* event */)
+void DesktopWidget::setRemoteCursor(const QImage& image, const QPoint& hotspot)
 {
-    if (frame_)
+    update(remoteCursorRect());
+
+    remote_cursor_ = image;
+    remote_cursor_hotspot_ = hotspot;
+
+    remoteCursorChanged();
+}
+
+void DesktopWidget::setRemoteCursorPosition(const QPoint& position)
+{
+    // Only the old and the new areas of the cursor are repainted.
+    update(remoteCursorRect());
+
+    remote_cursor_position_ = position;
+    has_remote_cursor_position_ = true;
+
+    remoteCursorChanged();
+}
+
+void DesktopWidget::setHostCursorPosition(const QPoint& position)
+{
+    // The host reports the positions caused by the input of the client with a delay. The local
+    // cursor is ahead of them and is not moved back.
+    auto echo = std::find(sent_positions_.begin(), sent_positions_.end(), position);
+    if (echo != sent_positions_.end())
     {
+        sent_positions_.erase(sent_positions_.begin(), echo);
+        return;
+    }
+
+    // The cursor is moved by an application or by the user of the host. The local cursor is
+    // corrected only when the user of the client does not move it.
+    if (input_clock_.isValid() && input_clock_.elapsed() < kCursorCorrectionDelay)
+        return;
+
+    if (!underMouse() || !isActiveWindow() || !QRect(QPoint(), frame_size_).contains(position))
+        return;
+
+    sent_positions_.clear();
+
+    // The mouse move event of the new position is not sent back to the host.
+    prev_pos_ = position;
+    QCursor::setPos(mapToGlobal(position));
+}
+
+QRect DesktopWidget::remoteCursorRect() const
+{
+    if (remote_cursor_.isNull() || !has_remote_cursor_position_)
+        return QRect();
+
+    return QRect(remote_cursor_position_ - remote_cursor_hotspot_, remote_cursor_.size());
+}
+
+void DesktopWidget::frameChanged(const QSize& size, const QRegion& dirty_region)
+{
+    frame_size_ = size;
+
+    if (!frame_size_.isEmpty() && frame_size_ != this->size())
+    {
+        resize(frame_size_);
+
+        if (!renderer_)
+            update();
+        return;
+    }
+
+    // The new frame contains the whole image, but only the changed areas are repainted.
+    if (!renderer_)
+        update(dirty_region);
+}
+
+void DesktopWidget::remoteCursorChanged()
+{
+    if (renderer_)
+        renderer_->setRemoteCursor(remote_cursor_, remoteCursorRect());
+    else
+        update(remoteCursorRect());
+}
+
+void DesktopWidget::paintEvent(QPaintEvent* event)
+{
+    // The renderer covers the whole widget.
+    if (frame_ && !renderer_)
+    {
+        ScopedTrace trace("paint");
+
+        QElapsedTimer paint_timer;
+        paint_timer.start();
+
         QPainter painter(this);
-        painter.drawImage(rect(), frame_->constImage());
+
+        // The widget has the size of the frame, so the areas are drawn without scaling.
+        const QImage& image = frame_->constImage();
+
+        for (const auto& rect : event->region())
+            painter.drawImage(rect, image, rect);
+
+        // The painter is clipped by the region of the event, so the cursor is drawn only
+        // over the repainted areas.
+        const QRect cursor_rect = remoteCursorRect();
+        if (!cursor_rect.isEmpty() && event->region().intersects(cursor_rect))
+            painter.drawImage(cursor_rect.topLeft(), remote_cursor_);
+
+        paint_time_ = (paint_time_ * 7 + paint_timer.nsecsElapsed() / 1000) / 8;
     }
 }
 
+void DesktopWidget::resizeEvent(QResizeEvent* event)
+{
+    if (renderer_)
+        renderer_->setGeometry(rect());
+
+    QWidget::resizeEvent(event);
+}
+
 void DesktopWidget::mouseMoveEvent(QMouseEvent* event)
 {
     doMouseEvent(event->type(), event->buttons(), event->pos());
@@ -8,15 +8,21 @@
 #ifndef _ASPIA_CLIENT__UI__DESKTOP_WIDGET_H
 #define _ASPIA_CLIENT__UI__DESKTOP_WIDGET_H
 
+#include <QElapsedTimer>
 #include <QEvent>
+#include <QImage>
+#include <QPointer>
 #include <QWidget>
-#include <memory>
+
+#include <deque>
 
 #include "desktop_capture/desktop_frame.h"
 
 namespace aspia {
 
 class DesktopFrameQImage;
+class DesktopFrameYUV;
+class DesktopRendererGL;
 
 class DesktopWidget : public QWidget
 {
@@ -26,8 +32,15 @@ public:
     explicit DesktopWidget(QWidget* parent);
     ~DesktopWidget() = default;
 
-    void resizeDesktopFrame(const QSize& screen_size);
-    DesktopFrame* desktopFrame();
+    // The frame is owned by the decoder of the session and must be valid until the next call.
+    void drawDesktopFrame(const DesktopFrameQImage* frame, const QRegion& dirty_region);
+    void drawDesktopFrame(const DesktopFrameYUV* frame, const QRegion& dirty_region);
+
+    // Returns true if the planar frames can be drawn without the conversion to RGB.
+    bool isYuvRenderingSupported() const;
+
+    // Returns the smoothed time of drawing the frame in microseconds.
+    qint64 paintTime() const;
 
     void doMouseEvent(QEvent::Type event_type,
                       const Qt::MouseButtons& buttons,
@@ -35,6 +48,16 @@ public:
                       const QPoint& delta = QPoint());
     void doKeyEvent(QKeyEvent* event);
 
+    // The remote cursor is drawn over the frame. Used by the sessions in which the local cursor
+    // does not move the remote one.
+    void setRemoteCursor(const QImage& image, const QPoint& hotspot);
+    void setRemoteCursorPosition(const QPoint& position);
+
+    // The local cursor has the shape of the remote one and moves without waiting for the host.
+    // The position reported by the host corrects the local cursor if the cursor has been moved
+    // on the host by something other than the input of the client.
+    void setHostCursorPosition(const QPoint& position);
+
 public slots:
     void executeKeySequense(int key_sequence);
 
@@ -45,6 +68,7 @@ signals:
 protected:
     // QWidget implementation.
     void paintEvent(QPaintEvent* event) override;
+    void resizeEvent(QResizeEvent* event) override;
     void mouseMoveEvent(QMouseEvent* event) override;
     void mousePressEvent(QMouseEvent* event) override;
     void mouseReleaseEvent(QMouseEvent* event) override;
@@ -55,11 +79,31 @@ protected:
     void leaveEvent(QEvent *event) override;
 
 private:
-    std::unique_ptr<DesktopFrameQImage> frame_;
+    QRect remoteCursorRect() const;
+    void frameChanged(const QSize& size, const QRegion& dirty_region);
+    void remoteCursorChanged();
+
+    // Set only if the frame is drawn by QPainter.
+    const DesktopFrameQImage* frame_ = nullptr;
+    QSize frame_size_;
+    qint64 paint_time_ = 0;
+
+    // If OpenGL is available, then the frame is drawn by the renderer which covers the widget.
+    QPointer<DesktopRendererGL> renderer_;
+
+    QImage remote_cursor_;
+    QPoint remote_cursor_hotspot_;
+    QPoint remote_cursor_position_;
+    bool has_remote_cursor_position_ = false;
 
     QPoint prev_pos_;
     quint32 prev_mask_ = 0;
 
+    // The positions sent to the host which have not been reported back yet and the time of
+    // the last sent position.
+    std::deque<QPoint> sent_positions_;
+    QElapsedTimer input_clock_;
+
     Q_DISABLE_COPY(DesktopWidget)
 };
 
@@ -24,6 +24,17 @@
 
 namespace aspia {
 
+namespace {
+
+// The config with the new viewport is sent when the window has not been resized for this time.
+constexpr int kViewportChangeDelay = 500; // 500 ms
+
+// The visible area which is reported to the host is extended by this margin, so the changes
+// next to the window are received before they are scrolled into it.
+constexpr int kVisibleAreaMargin = 256;
+
+} // namespace
+
 DesktopWindow::DesktopWindow(ConnectData* connect_data, QWidget* parent)
     : QWidget(parent),
       connect_data_(connect_data)
@@ -69,6 +80,19 @@ DesktopWindow::DesktopWindow(ConnectData* connect_data, QWidget* parent)
     connect(panel_, &DesktopPanel::keySequence, desktop_, &DesktopWidget::executeKeySequense);
     connect(panel_, &DesktopPanel::settingsButton, this, &DesktopWindow::changeSettings);
     connect(panel_, &DesktopPanel::switchToAutosize, this, &DesktopWindow::autosizeWindow);
+    connect(panel_, &DesktopPanel::screenSelected, this, &DesktopWindow::selectScreen);
+
+    connect(panel_, &DesktopPanel::switchStatistics, this, [this](bool enable)
+    {
+        delete statistics_;
+
+        if (enable)
+        {
+            statistics_ = new StatisticsOverlay(this);
+            statistics_->move(0, 0);
+            statistics_->show();
+        }
+    });
 
     connect(panel_, &DesktopPanel::switchToFullscreen, this, [this](bool fullscreen)
     {
@@ -89,29 +113,35 @@ DesktopWindow::DesktopWindow(ConnectData* connect_data, QWidget* parent)
     connect(desktop_, &DesktopWidget::sendPointerEvent, this, &DesktopWindow::onPointerEvent);
     connect(desktop_, &DesktopWidget::sendKeyEvent, this, &DesktopWindow::sendKeyEvent);
 
+    connect(scroll_area_->horizontalScrollBar(), &QScrollBar::valueChanged,
+            this, &DesktopWindow::updateVisibleArea);
+    connect(scroll_area_->verticalScrollBar(), &QScrollBar::valueChanged,
+            this, &DesktopWindow::updateVisibleArea);
+
     desktop_->installEventFilter(this);
     scroll_area_->viewport()->installEventFilter(this);
 }
 
-void DesktopWindow::resizeDesktopFrame(const QSize& screen_size)
+void DesktopWindow::drawDesktopFrame(const DesktopFrameQImage* frame,
+                                     const QRegion& dirty_region)
 {
-    QSize prev_size = desktop_->size();
+    const QSize prev_size = desktop_->size();
 
-    desktop_->resizeDesktopFrame(screen_size);
-
-    if (screen_size != prev_size && !isMaximized() && !isFullScreen())
-        autosizeWindow();
+    desktop_->drawDesktopFrame(frame, dirty_region);
+    frameDrawn(prev_size);
 }
 
-void DesktopWindow::drawDesktopFrame()
+void DesktopWindow::drawDesktopFrame(const DesktopFrameYUV* frame, const QRegion& dirty_region)
 {
-    desktop_->update();
-    panel_->update();
+    const QSize prev_size = desktop_->size();
+
+    desktop_->drawDesktopFrame(frame, dirty_region);
+    frameDrawn(prev_size);
 }
 
-DesktopFrame* DesktopWindow::desktopFrame()
+bool DesktopWindow::isYuvRenderingSupported() const
 {
-    return desktop_->desktopFrame();
+    return desktop_->isYuvRenderingSupported();
 }
 
 void DesktopWindow::injectCursor(const QCursor& cursor)
@@ -119,6 +149,21 @@ void DesktopWindow::injectCursor(const QCursor& cursor)
     desktop_->setCursor(cursor);
 }
 
+void DesktopWindow::setRemoteCursor(const QImage& image, const QPoint& hotspot)
+{
+    desktop_->setRemoteCursor(image, hotspot);
+}
+
+void DesktopWindow::setRemoteCursorPosition(const QPoint& position)
+{
+    desktop_->setRemoteCursorPosition(position);
+}
+
+void DesktopWindow::setHostCursorPosition(const QPoint& position)
+{
+    desktop_->setHostCursorPosition(position);
+}
+
 void DesktopWindow::injectClipboard(const proto::desktop::ClipboardEvent& event)
 {
     if (!clipboard_.isNull())
@@ -147,6 +192,7 @@ void DesktopWindow::setSupportedFeatures(quint32 features)
             if (config.features() & proto::desktop::FEATURE_CLIPBOARD)
             {
                 clipboard_ = new Clipboard(this);
+                clipboard_->setFeatures(supported_features_);
 
                 connect(clipboard_, &Clipboard::clipboardEvent,
                         this, &DesktopWindow::sendClipboardEvent);
@@ -181,6 +227,27 @@ bool DesktopWindow::requireConfigChange(proto::desktop::Config* config)
     return false;
 }
 
+void DesktopWindow::setScreenList(const proto::desktop::ScreenList& screen_list)
+{
+    panel_->setScreenList(screen_list);
+}
+
+bool DesktopWindow::isStatisticsEnabled() const
+{
+    return !statistics_.isNull();
+}
+
+void DesktopWindow::setStatistics(const StatisticsOverlay::Statistics& statistics)
+{
+    if (!statistics_.isNull())
+        statistics_->setStatistics(statistics);
+}
+
+qint64 DesktopWindow::paintTime() const
+{
+    return desktop_->paintTime();
+}
+
 void DesktopWindow::onPointerEvent(const QPoint& pos, quint32 mask)
 {
     QPoint cursor = desktop_->mapTo(scroll_area_, pos);
@@ -242,6 +309,68 @@ void DesktopWindow::changeSettings()
     }
 }
 
+QSize DesktopWindow::viewportSize()
+{
+    viewport_size_ = scroll_area_->size();
+    return viewport_size_;
+}
+
+bool DesktopWindow::isScalingEnabled() const
+{
+    return (supported_features_ & proto::desktop::FEATURE_SCALING) &&
+           (connect_data_->desktopConfig().features() & proto::desktop::FEATURE_SCALING);
+}
+
+void DesktopWindow::updateVisibility()
+{
+    // The hide event of the minimized window is not sent on all platforms.
+    const bool visible = isVisible() && !isMinimized();
+    if (visible == visible_)
+        return;
+
+    visible_ = visible;
+    emit visibilityChanged(visible);
+}
+
+void DesktopWindow::updateVisibleArea()
+{
+    const QRect frame_rect(QPoint(), desktop_->size());
+    const QRect visible_rect =
+        QRect(-desktop_->pos(), scroll_area_->viewport()->size()).intersected(frame_rect);
+
+    QRect area;
+
+    if (visible_rect != frame_rect)
+    {
+        // The area is not reported again while the window is scrolled within the margin.
+        if (frame_rect.contains(visible_area_) && visible_area_.contains(visible_rect))
+            return;
+
+        area = visible_rect.adjusted(-kVisibleAreaMargin, -kVisibleAreaMargin,
+                                     kVisibleAreaMargin, kVisibleAreaMargin)
+                   .intersected(frame_rect);
+    }
+
+    if (area == visible_area_)
+        return;
+
+    visible_area_ = area;
+    emit visibleAreaChanged(area);
+}
+
+void DesktopWindow::frameDrawn(const QSize& prev_size)
+{
+    // The scaled frames follow the size of the window.
+    if (desktop_->size() != prev_size && !isMaximized() && !isFullScreen() &&
+        !isScalingEnabled())
+    {
+        autosizeWindow();
+    }
+
+    updateVisibleArea();
+    panel_->update();
+}
+
 void DesktopWindow::autosizeWindow()
 {
     QRect screen_rect = QApplication::desktop()->availableGeometry(this);
@@ -263,6 +392,16 @@ void DesktopWindow::autosizeWindow()
 
 void DesktopWindow::timerEvent(QTimerEvent* event)
 {
+    if (event->timerId() == viewport_timer_id_)
+    {
+        killTimer(viewport_timer_id_);
+        viewport_timer_id_ = 0;
+
+        if (isScalingEnabled() && scroll_area_->size() != viewport_size_)
+            emit sendConfig(connect_data_->desktopConfig());
+        return;
+    }
+
     if (event->timerId() == scroll_timer_id_)
     {
         if (scroll_delta_.x() != 0)
@@ -296,7 +435,17 @@ void DesktopWindow::timerEvent(QTimerEvent* event)
 void DesktopWindow::resizeEvent(QResizeEvent* event)
 {
     panel_->move(QPoint(width() / 2 - panel_->width() / 2, 0));
+
+    if (isScalingEnabled())
+    {
+        if (viewport_timer_id_)
+            killTimer(viewport_timer_id_);
+
+        viewport_timer_id_ = startTimer(kViewportChangeDelay);
+    }
+
     QWidget::resizeEvent(event);
+    updateVisibleArea();
 }
 
 void DesktopWindow::closeEvent(QCloseEvent* event)
@@ -305,6 +454,26 @@ void DesktopWindow::closeEvent(QCloseEvent* event)
     QWidget::closeEvent(event);
 }
 
+void DesktopWindow::changeEvent(QEvent* event)
+{
+    if (event->type() == QEvent::WindowStateChange)
+        updateVisibility();
+
+    QWidget::changeEvent(event);
+}
+
+void DesktopWindow::showEvent(QShowEvent* event)
+{
+    updateVisibility();
+    QWidget::showEvent(event);
+}
+
+void DesktopWindow::hideEvent(QHideEvent* event)
+{
+    updateVisibility();
+    QWidget::hideEvent(event);
+}
+
 bool DesktopWindow::eventFilter(QObject* object, QEvent* event)
 {
     if (object == desktop_)
@@ -12,6 +12,7 @@
 #include <QWidget>
 
 #include "client/connect_data.h"
+#include "client/ui/statistics_overlay.h"
 #include "protocol/desktop_session.pb.h"
 
 class QHBoxLayout;
@@ -20,7 +21,8 @@ class QScrollArea;
 namespace aspia {
 
 class Clipboard;
-class DesktopFrame;
+class DesktopFrameQImage;
+class DesktopFrameYUV;
 class DesktopPanel;
 class DesktopWidget;
 
@@ -32,15 +34,35 @@ public:
     DesktopWindow(ConnectData* connect_data, QWidget* parent = nullptr);
     ~DesktopWindow() = default;
 
-    void resizeDesktopFrame(const QSize& screen_size);
-    void drawDesktopFrame();
-    DesktopFrame* desktopFrame();
+    // Shows the decoded frame. |dirty_region| contains the areas changed since the previous
+    // frame. The frame must be valid until the next call.
+    void drawDesktopFrame(const DesktopFrameQImage* frame, const QRegion& dirty_region);
+    void drawDesktopFrame(const DesktopFrameYUV* frame, const QRegion& dirty_region);
+
+    // Returns true if the planar frames can be drawn. Otherwise only the RGB frames are drawn.
+    bool isYuvRenderingSupported() const;
+
     void injectCursor(const QCursor& cursor);
+    void setRemoteCursor(const QImage& image, const QPoint& hotspot);
+    void setRemoteCursorPosition(const QPoint& position);
+    void setHostCursorPosition(const QPoint& position);
     void injectClipboard(const proto::desktop::ClipboardEvent& event);
 
     void setSupportedVideoEncodings(quint32 video_encodings);
     void setSupportedFeatures(quint32 features);
     bool requireConfigChange(proto::desktop::Config* config);
+    void setScreenList(const proto::desktop::ScreenList& screen_list);
+
+    // The statistics are shown if they are enabled by the panel.
+    bool isStatisticsEnabled() const;
+    void setStatistics(const StatisticsOverlay::Statistics& statistics);
+
+    // Returns the smoothed time of drawing the frame in microseconds.
+    qint64 paintTime() const;
+
+    // Returns the size of the area which shows the screen. If the scaling is enabled, then
+    // the config is sent again when the window is resized to another size.
+    QSize viewportSize();
 
 signals:
     void windowClose();
@@ -48,12 +70,23 @@ signals:
     void sendKeyEvent(quint32 usb_keycode, quint32 flags);
     void sendPointerEvent(const QPoint& pos, quint32 mask);
     void sendClipboardEvent(const proto::desktop::ClipboardEvent& event);
+    void selectScreen(qint64 screen_id);
+
+    // The window is minimized or hidden (|visible| is false) or shown again.
+    void visibilityChanged(bool visible);
+
+    // The window shows only |area| of the frame, or the whole frame if |area| is empty. The
+    // area includes the margin around the visible part.
+    void visibleAreaChanged(const QRect& area);
 
 protected:
     // QWidget implementation.
     void timerEvent(QTimerEvent* event) override;
     void resizeEvent(QResizeEvent* event) override;
     void closeEvent(QCloseEvent* event) override;
+    void changeEvent(QEvent* event) override;
+    void showEvent(QShowEvent* event) override;
+    void hideEvent(QHideEvent* event) override;
 
     bool eventFilter(QObject* object, QEvent* event) override;
 
@@ -61,8 +94,13 @@ private slots:
     void onPointerEvent(const QPoint& pos, quint32 mask);
     void changeSettings();
     void autosizeWindow();
+    void updateVisibleArea();
 
 private:
+    void frameDrawn(const QSize& prev_size);
+    bool isScalingEnabled() const;
+    void updateVisibility();
+
     ConnectData* connect_data_;
 
     quint32 supported_video_encodings_ = 0;
@@ -72,13 +110,24 @@ private:
     QPointer<QScrollArea> scroll_area_;
     QPointer<DesktopPanel> panel_;
     QPointer<DesktopWidget> desktop_;
+    QPointer<StatisticsOverlay> statistics_;
     QPointer<Clipboard> clipboard_;
 
     int scroll_timer_id_ = 0;
     QPoint scroll_delta_;
 
+    // The viewport of the last config and the delay of the next one.
+    QSize viewport_size_;
+    int viewport_timer_id_ = 0;
+
     bool is_maximized_ = false;
 
+    // The last state reported by visibilityChanged().
+    bool visible_ = true;
+
+    // The last area reported by visibleAreaChanged().
+    QRect visible_area_;
+
     Q_DISABLE_COPY(DesktopWindow)
 };
 
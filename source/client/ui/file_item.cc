@@ -10,6 +10,7 @@
 #include <QCoreApplication>
 #include <QDateTime>
 
+#include "client/ui/file_type_cache.h"
 #include "host/file_platform_util.h"
 
 namespace aspia {
@@ -59,7 +60,8 @@ QString sizeToString(qint64 size)
 
 } // namespace
 
-FileItem::FileItem(const proto::file_transfer::FileList::Item& item)
+FileItem::FileItem(const proto::file_transfer::FileList::Item& item,
+                   FileTypeCache* type_cache)
     : is_directory_(item.is_directory()),
       size_(item.size()),
       last_modified_(item.modification_time())
@@ -76,12 +78,14 @@ FileItem::FileItem(const proto::file_transfer::FileList::Item& item)
     }
     else
     {
-        QPair<QIcon, QString> type_info = FilePlatformUtil::fileTypeInfo(name_);
+        QIcon icon;
+        QString description;
 
-        setIcon(0, type_info.first);
+        type_pending_ = !type_cache->typeInfo(name_, &icon, &description);
+
+        setIcon(0, icon);
         setText(1, sizeToString(item.size()));
-        setText(2, type_info.second);
-        
+        setText(2, description);
     }
 
     setText(3, QDateTime::fromSecsSinceEpoch(
@@ -101,6 +105,24 @@ QString FileItem::currentName() const
     return text(0);
 }
 
+bool FileItem::updateFileType(FileTypeCache* type_cache)
+{
+    if (!type_pending_)
+        return false;
+
+    QIcon icon;
+    QString description;
+
+    if (!type_cache->typeInfo(name_, &icon, &description))
+        return false;
+
+    type_pending_ = false;
+
+    setIcon(0, icon);
+    setText(2, description);
+    return true;
+}
+
 bool FileItem::operator<(const QTreeWidgetItem& other) const
 {
     const FileItem* file_item = reinterpret_cast<const FileItem*>(&other);
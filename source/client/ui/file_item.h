@@ -14,10 +14,12 @@
 
 namespace aspia {
 
+class FileTypeCache;
+
 class FileItem : public QTreeWidgetItem
 {
 public:
-    explicit FileItem(const proto::file_transfer::FileList::Item& item);
+    FileItem(const proto::file_transfer::FileList::Item& item, FileTypeCache* type_cache);
     explicit FileItem(const QString& directory_name);
     ~FileItem() = default;
 
@@ -27,6 +29,10 @@ public:
     qint64 fileSize() const { return size_; }
     time_t lastModified() const { return last_modified_; }
 
+    // Sets the icon and the description of the file type if they were not cached when the
+    // item was created. Returns true if the item is changed.
+    bool updateFileType(FileTypeCache* type_cache);
+
 protected:
     bool operator<(const QTreeWidgetItem& other) const override;
 
@@ -35,6 +41,7 @@ private:
     bool is_directory_;
     qint64 size_ = 0;
     time_t last_modified_ = 0;
+    bool type_pending_ = false;
 
     Q_DISABLE_COPY(FileItem)
 };
@@ -8,9 +8,16 @@
 #include "client/ui/file_manager_window.h"
 
 #include <QDebug>
+#include <QInputDialog>
+#include <QMessageBox>
+#include <QProgressDialog>
 
+#include "build_config.h"
+#include "client/ui/authorization_dialog.h"
 #include "client/ui/file_remove_dialog.h"
 #include "client/ui/file_transfer_dialog.h"
+#include "client/ui/file_type_cache.h"
+#include "client/file_remote_copier.h"
 
 namespace aspia {
 
@@ -30,6 +37,11 @@ FileManagerWindow::FileManagerWindow(ConnectData* connect_data, QWidget* parent)
     ui.local_panel->setPanelName(tr("Local Computer"));
     ui.remote_panel->setPanelName(tr("Remote Computer"));
 
+    // The types of the remote files are described by the local shell too.
+    FileTypeCache* type_cache = new FileTypeCache(this);
+    ui.local_panel->setFileTypeCache(type_cache);
+    ui.remote_panel->setFileTypeCache(type_cache);
+
     QList<int> sizes;
     sizes.push_back(width() / 2);
     sizes.push_back(width() / 2);
@@ -44,6 +56,11 @@ FileManagerWindow::FileManagerWindow(ConnectData* connect_data, QWidget* parent)
     connect(ui.remote_panel, &FilePanel::receiveItems, this, &FileManagerWindow::receiveItems);
     connect(ui.local_panel, &FilePanel::request, this, &FileManagerWindow::localRequest);
     connect(ui.remote_panel, &FilePanel::request, this, &FileManagerWindow::remoteRequest);
+
+    // The files of the remote computer are copied by the computer itself.
+    ui.remote_panel->setComputerCopyEnabled(true);
+    connect(ui.remote_panel, &FilePanel::copyToComputer,
+            this, &FileManagerWindow::copyToComputer);
 }
 
 void FileManagerWindow::refresh()
@@ -52,6 +69,12 @@ void FileManagerWindow::refresh()
     ui.remote_panel->refresh();
 }
 
+void FileManagerWindow::setRemoteBlocked(bool blocked)
+{
+    remote_blocked_ = blocked;
+    emit remoteBlocked(blocked);
+}
+
 void FileManagerWindow::closeEvent(QCloseEvent* event)
 {
     emit windowClose();
@@ -132,6 +155,97 @@ void FileManagerWindow::receiveItems(FilePanel* sender, const QList<FileTransfer
     }
 }
 
+void FileManagerWindow::copyToComputer(FilePanel* sender, const QStringList& file_names)
+{
+    Q_ASSERT(sender == ui.remote_panel);
+
+    const QString address = QInputDialog::getText(
+        this, tr("Copy to Another Computer"), tr("Address of the computer (host[:port]):"));
+    if (address.isEmpty())
+        return;
+
+    ConnectData target;
+    target.setAddress(address);
+    target.setPort(kDefaultHostTcpPort);
+
+    const int port_separator = address.lastIndexOf(QLatin1Char(':'));
+    if (port_separator != -1)
+    {
+        bool ok = false;
+        const int port = address.mid(port_separator + 1).toInt(&ok);
+
+        if (!ok || port <= 0 || port > 65535)
+        {
+            QMessageBox::warning(this,
+                                 tr("Warning"),
+                                 tr("The port of the computer is not valid."),
+                                 QMessageBox::Ok);
+            return;
+        }
+
+        target.setAddress(address.left(port_separator));
+        target.setPort(port);
+    }
+
+    // The credentials are sent to the remote computer, which connects to the other computer.
+    AuthorizationDialog auth_dialog(this);
+    if (auth_dialog.exec() != AuthorizationDialog::Accepted)
+        return;
+
+    target.setUserName(auth_dialog.userName());
+    target.setPassword(auth_dialog.password());
+
+    const QString target_path = QInputDialog::getText(
+        this, tr("Copy to Another Computer"), tr("Folder on the computer:"),
+        QLineEdit::Normal, sender->currentPath());
+    if (target_path.isEmpty())
+        return;
+
+    const int ret = QMessageBox::question(this,
+                                          tr("Copy to Another Computer"),
+                                          tr("Replace the existing files?"),
+                                          QMessageBox::Yes | QMessageBox::No |
+                                          QMessageBox::Cancel);
+    if (ret == QMessageBox::Cancel)
+        return;
+
+    QProgressDialog* progress_dialog = new QProgressDialog(
+        tr("Copying files..."), tr("Cancel"), 0, file_names.size(), this);
+    progress_dialog->setWindowTitle(tr("Copy to Another Computer"));
+    progress_dialog->setAttribute(Qt::WA_DeleteOnClose);
+    progress_dialog->setMinimumDuration(0);
+
+    FileRemoteCopier* copier = new FileRemoteCopier(target, ret == QMessageBox::Yes,
+                                                    progress_dialog);
+
+    connect(copier, &FileRemoteCopier::request, this, &FileManagerWindow::remoteRequest);
+    connect(progress_dialog, &QProgressDialog::canceled, copier, &FileRemoteCopier::cancel);
+
+    connect(copier, &FileRemoteCopier::currentItemChanged,
+            [progress_dialog](int index, const QString& file_name)
+    {
+        progress_dialog->setValue(index);
+        progress_dialog->setLabelText(tr("Copying \"%1\"...").arg(file_name));
+    });
+
+    connect(copier, &FileRemoteCopier::finished, [this, progress_dialog](const QStringList& errors)
+    {
+        progress_dialog->close();
+
+        if (!errors.isEmpty())
+        {
+            QMessageBox::warning(this,
+                                 tr("Warning"),
+                                 tr("Some files were not copied:\n%1").arg(errors.join('\n')),
+                                 QMessageBox::Ok);
+        }
+    });
+
+    connect(this, &FileManagerWindow::windowClose, progress_dialog, &QProgressDialog::close);
+
+    copier->start(sender->currentPath(), target_path, file_names);
+}
+
 void FileManagerWindow::transferItems(FileTransfer::Type type,
                                       const QString& source_path,
                                       const QString& target_path,
@@ -161,6 +275,7 @@ void FileManagerWindow::transferItems(FileTransfer::Type type,
     connect(transfer, &FileTransfer::error, progress_dialog, &FileTransferDialog::showError);
     connect(transfer, &FileTransfer::localRequest, this, &FileManagerWindow::localRequest);
     connect(transfer, &FileTransfer::remoteRequest, this, &FileManagerWindow::remoteRequest);
+    connect(this, &FileManagerWindow::remoteBlocked, transfer, &FileTransfer::setRemoteBlocked);
 
     connect(progress_dialog, &FileTransferDialog::finished, [progress_dialog](int /* result */)
     {
@@ -169,6 +284,7 @@ void FileManagerWindow::transferItems(FileTransfer::Type type,
 
     connect(this, &FileManagerWindow::windowClose, progress_dialog, &FileTransferDialog::close);
 
+    transfer->setRemoteBlocked(remote_blocked_);
     transfer->start(source_path, target_path, items);
 }
 
@@ -24,10 +24,15 @@ public:
 public slots:
     void refresh();
 
+    // The transfers do not request more packets while the requests to the remote computer
+    // can not be written.
+    void setRemoteBlocked(bool blocked);
+
 signals:
     void windowClose();
     void localRequest(FileRequest* request);
     void remoteRequest(FileRequest* request);
+    void remoteBlocked(bool blocked);
 
 protected:
     // QWidget implementation.
@@ -37,6 +42,7 @@ private slots:
     void removeItems(FilePanel* sender, const QList<FileRemover::Item>& items);
     void sendItems(FilePanel* sender, const QList<FileTransfer::Item>& items);
     void receiveItems(FilePanel* sender, const QList<FileTransfer::Item>& items);
+    void copyToComputer(FilePanel* sender, const QStringList& file_names);
 
 private:
     void transferItems(FileTransfer::Type type,
@@ -45,6 +51,7 @@ private:
                        const QList<FileTransfer::Item>& items);
 
     Ui::FileManagerWindow ui;
+    bool remote_blocked_ = false;
 
     Q_DISABLE_COPY(FileManagerWindow)
 };
@@ -0,0 +1,102 @@
+//
+// PROJECT:         Aspia
+// FILE:            client/ui/file_multi_upload_window.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "client/ui/file_multi_upload_window.h"
+
+#include <QHeaderView>
+#include <QLabel>
+#include <QTreeWidget>
+#include <QVBoxLayout>
+
+#include "client/file_multi_uploader.h"
+
+namespace aspia {
+
+namespace {
+
+enum Column
+{
+    COLUMN_NAME     = 0,
+    COLUMN_ADDRESS  = 1,
+    COLUMN_PROGRESS = 2,
+    COLUMN_STATUS   = 3
+};
+
+} // namespace
+
+FileMultiUploadWindow::FileMultiUploadWindow(const QString& source_path,
+                                             const QString& target_path,
+                                             bool overwrite,
+                                             const QVector<ConnectData>& computers,
+                                             QWidget* parent)
+    : QWidget(parent)
+{
+    setWindowTitle(tr("Upload File"));
+    resize(640, 480);
+
+    summary_label_ = new QLabel(this);
+    summary_label_->setText(tr("Uploading \"%1\" to \"%2\"").arg(source_path).arg(target_path));
+
+    tree_ = new QTreeWidget(this);
+    tree_->setRootIsDecorated(false);
+    tree_->setHeaderLabels(
+        QStringList() << tr("Name") << tr("Address") << tr("Progress") << tr("Status"));
+    tree_->header()->setStretchLastSection(true);
+
+    QVBoxLayout* layout = new QVBoxLayout(this);
+    layout->addWidget(summary_label_);
+    layout->addWidget(tree_);
+
+    for (const auto& connect_data : computers)
+    {
+        QTreeWidgetItem* item = new QTreeWidgetItem(tree_);
+
+        item->setText(COLUMN_NAME, connect_data.computerName());
+        item->setText(COLUMN_ADDRESS,
+                      connect_data.address() + QLatin1Char(':') +
+                      QString::number(connect_data.port()));
+        item->setText(COLUMN_PROGRESS, QStringLiteral("0%"));
+    }
+
+    uploader_ = new FileMultiUploader(source_path, target_path, overwrite, computers, this);
+
+    connect(uploader_, &FileMultiUploader::targetChanged,
+            this, &FileMultiUploadWindow::onTargetChanged);
+    connect(uploader_, &FileMultiUploader::finished,
+            this, &FileMultiUploadWindow::onFinished);
+
+    uploader_->start();
+}
+
+void FileMultiUploadWindow::onTargetChanged(int index)
+{
+    QTreeWidgetItem* item = tree_->topLevelItem(index);
+    if (!item)
+        return;
+
+    item->setText(COLUMN_PROGRESS, QString::number(uploader_->progress(index)) +
+                  QLatin1Char('%'));
+    item->setText(COLUMN_STATUS, uploader_->statusString(index));
+}
+
+void FileMultiUploadWindow::onFinished()
+{
+    int completed = 0;
+
+    for (int i = 0; i < uploader_->targetCount(); ++i)
+    {
+        if (uploader_->progress(i) == 100)
+            ++completed;
+    }
+
+    summary_label_->setText(tr("\"%1\" is uploaded to %2 of %3 computers")
+                            .arg(uploader_->sourcePath())
+                            .arg(completed)
+                            .arg(uploader_->targetCount()));
+}
+
+} // namespace aspia
@@ -0,0 +1,53 @@
+//
+// PROJECT:         Aspia
+// FILE:            client/ui/file_multi_upload_window.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CLIENT__UI__FILE_MULTI_UPLOAD_WINDOW_H
+#define _ASPIA_CLIENT__UI__FILE_MULTI_UPLOAD_WINDOW_H
+
+#include <QVector>
+#include <QWidget>
+
+#include "client/connect_data.h"
+
+class QLabel;
+class QTreeWidget;
+
+namespace aspia {
+
+class FileMultiUploader;
+
+//
+// Shows the progress of the upload of one file to many hosts. The upload is stopped when the
+// window is closed.
+//
+class FileMultiUploadWindow : public QWidget
+{
+    Q_OBJECT
+
+public:
+    FileMultiUploadWindow(const QString& source_path,
+                          const QString& target_path,
+                          bool overwrite,
+                          const QVector<ConnectData>& computers,
+                          QWidget* parent = nullptr);
+    ~FileMultiUploadWindow() = default;
+
+private slots:
+    void onTargetChanged(int index);
+    void onFinished();
+
+private:
+    FileMultiUploader* uploader_;
+    QLabel* summary_label_;
+    QTreeWidget* tree_;
+
+    Q_DISABLE_COPY(FileMultiUploadWindow)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_CLIENT__UI__FILE_MULTI_UPLOAD_WINDOW_H
@@ -9,11 +9,14 @@
 
 #include <QAction>
 #include <QDebug>
+#include <QHeaderView>
 #include <QKeyEvent>
 #include <QMenu>
 #include <QMessageBox>
+#include <QSignalBlocker>
 
 #include "client/ui/file_item.h"
+#include "client/ui/file_type_cache.h"
 #include "client/file_remover.h"
 #include "client/file_status.h"
 #include "host/file_platform_util.h"
@@ -24,6 +27,20 @@ namespace aspia {
 namespace {
 
 const char* kReplySlot = "reply";
+const char* kPrefetchReplySlot = "prefetchReply";
+
+// The list of the files is received by parts, so the huge directories do not block the
+// panel. The first part is small to show it quickly.
+constexpr int kFirstFileListPart = 1000;
+constexpr int kFileListPart = 10000;
+
+// The cost of the cached lists is the number of the items.
+constexpr int kMaxCachedItems = 200000;
+
+// The subdirectories of the shown directory are listed ahead of the navigation. Only the
+// small lists are kept, the larger ones are requested again when the subdirectory is opened.
+constexpr int kMaxPrefetchedFolders = 8;
+constexpr int kMaxPrefetchedItems = 1000;
 
 QString normalizePath(const QString& path)
 {
@@ -53,7 +70,8 @@ QString parentPath(const QString& path)
 } // namespace
 
 FilePanel::FilePanel(QWidget* parent)
-    : QWidget(parent)
+    : QWidget(parent),
+      list_cache_(kMaxCachedItems)
 {
     ui.setupUi(this);
 
@@ -86,6 +104,14 @@ void FilePanel::setPanelName(const QString& name)
     ui.label_name->setText(name);
 }
 
+void FilePanel::setFileTypeCache(FileTypeCache* type_cache)
+{
+    Q_ASSERT(!type_cache_);
+    type_cache_ = type_cache;
+
+    connect(type_cache_, &FileTypeCache::fileTypesReady, this, &FilePanel::onFileTypesReady);
+}
+
 void FilePanel::setCurrentPath(const QString& path)
 {
     current_path_ = normalizePath(path);
@@ -133,8 +159,19 @@ void FilePanel::reply(const proto::file_transfer::Request& request,
     }
     else if (request.has_file_list_request())
     {
+        --pending_list_requests_;
+
+        // The list of the previous directory.
+        if (skipped_list_replies_)
+        {
+            --skipped_list_replies_;
+            return;
+        }
+
         if (reply.status() != proto::file_transfer::STATUS_SUCCESS)
         {
+            ui.tree->setSortingEnabled(true);
+
             QMessageBox::warning(this,
                                  tr("Warning"),
                                  tr("Failed to get list of files: %1")
@@ -143,7 +180,29 @@ void FilePanel::reply(const proto::file_transfer::Request& request,
             return;
         }
 
-        updateFiles(reply.file_list());
+        const proto::file_transfer::FileList& list = reply.file_list();
+
+        if (!request.file_list_request().continuation_id())
+        {
+            // The cached list is already shown.
+            if (list.not_modified())
+            {
+                proto::file_transfer::FileList* cached_list = list_cache_.object(current_path_);
+                if (cached_list)
+                    prefetchFolders(*cached_list);
+                return;
+            }
+
+            clearFiles();
+
+            // The hosts of the old versions do not send the modification time and their
+            // lists are not cached.
+            loading_list_.reset();
+            if (list.modification_time())
+                loading_list_ = std::make_unique<proto::file_transfer::FileList>();
+        }
+
+        addFiles(list);
     }
     else if (request.has_create_directory_request())
     {
@@ -173,8 +232,30 @@ void FilePanel::reply(const proto::file_transfer::Request& request,
     }
 }
 
+void FilePanel::prefetchReply(const proto::file_transfer::Request& request,
+                              const proto::file_transfer::Reply& reply)
+{
+    --pending_prefetch_requests_;
+
+    const proto::file_transfer::FileList& list = reply.file_list();
+
+    if (reply.status() != proto::file_transfer::STATUS_SUCCESS ||
+        !list.modification_time() || list.truncated())
+    {
+        return;
+    }
+
+    const QString path = QString::fromStdString(request.file_list_request().path());
+
+    list_cache_.insert(path, new proto::file_transfer::FileList(list), list.item_size() + 1);
+}
+
 void FilePanel::refresh()
 {
+    // The files of the current directory are listed again even if the directory is not
+    // modified, because the sizes and the times of the files are not checked.
+    list_cache_.remove(current_path_);
+
     emit request(FileRequest::driveListRequest(this, kReplySlot));
 }
 
@@ -237,7 +318,26 @@ void FilePanel::onAddressItemChanged(int index)
         }
     }
 
-    emit request(FileRequest::fileListRequest(this, current_path_, kReplySlot));
+    // The parts of the previous list which are not received yet are not shown.
+    skipped_list_replies_ = pending_list_requests_;
+    loading_list_.reset();
+
+    ++pending_list_requests_;
+
+    proto::file_transfer::FileList* cached_list = list_cache_.object(current_path_);
+    if (cached_list)
+    {
+        // The list is shown at once. It is replaced if the directory is modified.
+        showCachedFiles(*cached_list);
+
+        emit request(FileRequest::fileListRevalidationRequest(
+            this, current_path_, kFirstFileListPart, cached_list->modification_time(),
+            kReplySlot));
+        return;
+    }
+
+    emit request(FileRequest::fileListRequest(
+        this, current_path_, kFirstFileListPart, 0, false, kReplySlot));
 }
 
 void FilePanel::onFileDoubleClicked(QTreeWidgetItem* item, int column)
@@ -305,6 +405,7 @@ void FilePanel::onFileContextMenu(const QPoint& point)
     QMenu menu;
 
     QScopedPointer<QAction> copy_action;
+    QScopedPointer<QAction> computer_copy_action;
     QScopedPointer<QAction> delete_action;
 
     if (selectedFilesCount() > 0)
@@ -315,6 +416,16 @@ void FilePanel::onFileContextMenu(const QPoint& point)
             QIcon(QStringLiteral(":/icon/cross-script.png")), tr("&Delete\tDelete")));
 
         menu.addAction(copy_action.data());
+
+        if (computer_copy_enabled_)
+        {
+            computer_copy_action.reset(new QAction(
+                QIcon(QStringLiteral(":/icon/computer.png")),
+                tr("Copy to &Another Computer...")));
+
+            menu.addAction(computer_copy_action.data());
+        }
+
         menu.addAction(delete_action.data());
         menu.addSeparator();
     }
@@ -332,10 +443,38 @@ void FilePanel::onFileContextMenu(const QPoint& point)
         removeSelected();
     else if (selected_action == copy_action.data())
         sendSelected();
+    else if (selected_action == computer_copy_action.data())
+        copySelectedToComputer();
     else if (selected_action == add_folder_action.data())
         addFolder();
 }
 
+void FilePanel::onFileTypesReady()
+{
+    // The tree sorts all items again after each change of the column of the sorting, so the
+    // signals of the model are blocked and the items are sorted once if necessary.
+    QSignalBlocker blocker(ui.tree->model());
+    bool changed = false;
+
+    for (int i = 0; i < ui.tree->topLevelItemCount(); ++i)
+    {
+        FileItem* file_item = dynamic_cast<FileItem*>(ui.tree->topLevelItem(i));
+        if (file_item && file_item->updateFileType(type_cache_))
+            changed = true;
+    }
+
+    blocker.unblock();
+
+    if (!changed)
+        return;
+
+    // Sorting by the type of the file.
+    if (ui.tree->isSortingEnabled() && ui.tree->sortColumn() == 2)
+        ui.tree->sortItems(2, ui.tree->header()->sortIndicatorOrder());
+
+    ui.tree->viewport()->update();
+}
+
 void FilePanel::toChildFolder(const QString& child_name)
 {
     setCurrentPath(current_path_ + child_name);
@@ -410,6 +549,39 @@ void FilePanel::sendSelected()
     emit sendItems(this, items);
 }
 
+void FilePanel::copySelectedToComputer()
+{
+    QStringList file_names;
+    bool directory_selected = false;
+
+    for (int i = 0; i < ui.tree->topLevelItemCount(); ++i)
+    {
+        FileItem* file_item = dynamic_cast<FileItem*>(ui.tree->topLevelItem(i));
+
+        if (!file_item || !ui.tree->isItemSelected(file_item))
+            continue;
+
+        if (file_item->isDirectory())
+            directory_selected = true;
+        else
+            file_names.append(file_item->currentName());
+    }
+
+    if (directory_selected)
+    {
+        QMessageBox::information(this,
+                                 tr("Information"),
+                                 tr("Only the files are copied to another computer. The "
+                                    "selected folders are skipped."),
+                                 QMessageBox::Ok);
+    }
+
+    if (file_names.isEmpty())
+        return;
+
+    emit copyToComputer(this, file_names);
+}
+
 QString FilePanel::addressItemPath(int index) const
 {
     QString path = ui.address_bar->itemData(index).toString();
@@ -452,7 +624,7 @@ void FilePanel::updateDrives(const proto::file_transfer::DriveList& list)
         setCurrentPath(current_path_);
 }
 
-void FilePanel::updateFiles(const proto::file_transfer::FileList& list)
+void FilePanel::clearFiles()
 {
     for (int i = ui.tree->topLevelItemCount() - 1; i >= 0; --i)
     {
@@ -460,8 +632,89 @@ void FilePanel::updateFiles(const proto::file_transfer::FileList& list)
         delete item;
     }
 
+    // The items are sorted once after the last part of the list.
+    ui.tree->setSortingEnabled(false);
+}
+
+void FilePanel::addFiles(const proto::file_transfer::FileList& list)
+{
+    QList<QTreeWidgetItem*> items;
+    items.reserve(list.item_size());
+
+    for (int i = 0; i < list.item_size(); ++i)
+        items.append(new FileItem(list.item(i), type_cache_));
+
+    ui.tree->addTopLevelItems(items);
+
+    if (loading_list_)
+    {
+        if (list.modification_time())
+            loading_list_->set_modification_time(list.modification_time());
+
+        loading_list_->mutable_item()->MergeFrom(list.item());
+    }
+
+    if (list.continuation_id())
+    {
+        ++pending_list_requests_;
+        emit request(FileRequest::fileListRequest(
+            this, current_path_, kFileListPart, list.continuation_id(), false, kReplySlot));
+        return;
+    }
+
+    ui.tree->setSortingEnabled(true);
+
+    if (loading_list_)
+    {
+        const int cost = loading_list_->item_size() + 1;
+        proto::file_transfer::FileList* cached_list = loading_list_.release();
+
+        // The list which is larger than the cache is deleted by the insertion.
+        if (list_cache_.insert(current_path_, cached_list, cost))
+            prefetchFolders(*cached_list);
+    }
+}
+
+void FilePanel::showCachedFiles(const proto::file_transfer::FileList& list)
+{
+    clearFiles();
+
+    QList<QTreeWidgetItem*> items;
+    items.reserve(list.item_size());
+
     for (int i = 0; i < list.item_size(); ++i)
-        ui.tree->addTopLevelItem(new FileItem(list.item(i)));
+        items.append(new FileItem(list.item(i), type_cache_));
+
+    ui.tree->addTopLevelItems(items);
+    ui.tree->setSortingEnabled(true);
+}
+
+void FilePanel::prefetchFolders(const proto::file_transfer::FileList& list)
+{
+    // The subdirectories of the previous directory are still requested.
+    if (pending_prefetch_requests_)
+        return;
+
+    // The replies can change the cache, so the paths are collected before the requests.
+    QStringList paths;
+
+    for (int i = 0; i < list.item_size() && paths.size() < kMaxPrefetchedFolders; ++i)
+    {
+        const proto::file_transfer::FileList::Item& item = list.item(i);
+        if (!item.is_directory())
+            continue;
+
+        const QString path = normalizePath(current_path_ + QString::fromStdString(item.name()));
+        if (!list_cache_.contains(path))
+            paths.append(path);
+    }
+
+    for (const auto& path : paths)
+    {
+        ++pending_prefetch_requests_;
+        emit request(FileRequest::fileListPrefetchRequest(
+            this, path, kMaxPrefetchedItems, kPrefetchReplySlot));
+    }
 }
 
 int FilePanel::selectedFilesCount()
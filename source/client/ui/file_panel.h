@@ -8,6 +8,8 @@
 #ifndef _ASPIA_CLIENT__UI__FILE_PANEL_H
 #define _ASPIA_CLIENT__UI__FILE_PANEL_H
 
+#include <QCache>
+
 #include "client/file_remover.h"
 #include "client/file_transfer.h"
 #include "protocol/file_transfer_session.pb.h"
@@ -15,6 +17,8 @@
 
 namespace aspia {
 
+class FileTypeCache;
+
 class FilePanel : public QWidget
 {
     Q_OBJECT
@@ -28,15 +32,25 @@ public:
     QString currentPath() const { return current_path_; }
     void setCurrentPath(const QString& path);
 
+    // Adds the copying of the selected files to another computer to the context menu.
+    void setComputerCopyEnabled(bool enable) { computer_copy_enabled_ = enable; }
+
+    // The cache of the file types shared by the panels of the window. Must be set before the
+    // files are listed.
+    void setFileTypeCache(FileTypeCache* type_cache);
+
 signals:
     void request(FileRequest* request);
     void removeItems(FilePanel* sender, const QList<FileRemover::Item>& items);
     void sendItems(FilePanel* sender, const QList<FileTransfer::Item>& items);
     void receiveItems(FilePanel* sender, const QList<FileTransfer::Item>& items);
+    void copyToComputer(FilePanel* sender, const QStringList& file_names);
 
 public slots:
     void reply(const proto::file_transfer::Request& request,
                const proto::file_transfer::Reply& reply);
+    void prefetchReply(const proto::file_transfer::Request& request,
+                       const proto::file_transfer::Reply& reply);
     void refresh();
 
 protected:
@@ -49,21 +63,40 @@ private slots:
     void onFileSelectionChanged();
     void onFileNameChanged(FileItem* file_item);
     void onFileContextMenu(const QPoint& point);
+    void onFileTypesReady();
 
     void toChildFolder(const QString& child_name);
     void toParentFolder();
     void addFolder();
     void removeSelected();
     void sendSelected();
+    void copySelectedToComputer();
 
 private:
     QString addressItemPath(int index) const;
     void updateDrives(const proto::file_transfer::DriveList& list);
-    void updateFiles(const proto::file_transfer::FileList& list);
+    void clearFiles();
+    void addFiles(const proto::file_transfer::FileList& list);
+    void showCachedFiles(const proto::file_transfer::FileList& list);
+    void prefetchFolders(const proto::file_transfer::FileList& list);
     int selectedFilesCount();
 
     Ui::FilePanel ui;
     QString current_path_;
+    bool computer_copy_enabled_ = false;
+    FileTypeCache* type_cache_ = nullptr;
+
+    // The replies to the list requests come in the order of the requests. The parts of the
+    // previous directory which are received after the change of the directory are skipped.
+    int pending_list_requests_ = 0;
+    int skipped_list_replies_ = 0;
+
+    // The lists of the visited and the prefetched directories by the paths. The cached list is
+    // shown at once and the host sends the list again only if the directory is modified.
+    // |loading_list_| collects the parts of the current directory.
+    QCache<QString, proto::file_transfer::FileList> list_cache_;
+    std::unique_ptr<proto::file_transfer::FileList> loading_list_;
+    int pending_prefetch_requests_ = 0;
 
     Q_DISABLE_COPY(FilePanel)
 };
@@ -69,6 +69,8 @@ void FileTransferDialog::showError(FileTransfer* transfer,
     QAbstractButton* skip_all_button = nullptr;
     QAbstractButton* replace_button = nullptr;
     QAbstractButton* replace_all_button = nullptr;
+    QAbstractButton* resume_button = nullptr;
+    QAbstractButton* resume_all_button = nullptr;
     QAbstractButton* abort_button = nullptr;
 
     FileTransfer::Actions actions = transfer->availableActions(error_type);
@@ -85,6 +87,12 @@ void FileTransferDialog::showError(FileTransfer* transfer,
     if (actions & FileTransfer::ReplaceAll)
         replace_all_button = dialog.addButton(tr("Replace All"), QMessageBox::ButtonRole::ActionRole);
 
+    if (actions & FileTransfer::Resume)
+        resume_button = dialog.addButton(tr("Resume"), QMessageBox::ButtonRole::ActionRole);
+
+    if (actions & FileTransfer::ResumeAll)
+        resume_all_button = dialog.addButton(tr("Resume All"), QMessageBox::ButtonRole::ActionRole);
+
     if (actions & FileTransfer::Abort)
         abort_button = dialog.addButton(tr("Abort"), QMessageBox::ButtonRole::ActionRole);
 
@@ -113,6 +121,16 @@ void FileTransferDialog::showError(FileTransfer* transfer,
             transfer->applyAction(error_type, FileTransfer::ReplaceAll);
             return;
         }
+        else if (button == resume_button)
+        {
+            transfer->applyAction(error_type, FileTransfer::Resume);
+            return;
+        }
+        else if (button == resume_all_button)
+        {
+            transfer->applyAction(error_type, FileTransfer::ResumeAll);
+            return;
+        }
     }
 
     transfer->applyAction(error_type, FileTransfer::Abort);
@@ -0,0 +1,104 @@
+//
+// PROJECT:         Aspia
+// FILE:            client/ui/file_type_cache.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "client/ui/file_type_cache.h"
+
+#include <QElapsedTimer>
+#include <QTimerEvent>
+
+#include "host/file_platform_util.h"
+
+namespace aspia {
+
+namespace {
+
+// The time of one slice of the lookups. The shell may take milliseconds for each type.
+constexpr qint64 kLookupSlice = 15; // 15 milliseconds
+
+// The directories with the numbered files may have many extensions. The cache is started
+// again instead of growing without limit.
+constexpr int kMaxCachedTypes = 4096;
+
+} // namespace
+
+FileTypeCache::FileTypeCache(QObject* parent)
+    : QObject(parent),
+      default_icon_(QStringLiteral(":/icon/document.png"))
+{
+    // Nothing
+}
+
+bool FileTypeCache::typeInfo(const QString& file_name, QIcon* icon, QString* description)
+{
+    const QString type = extension(file_name);
+
+    auto it = types_.constFind(type);
+    if (it != types_.constEnd())
+    {
+        *icon = it->first;
+        *description = it->second;
+        return true;
+    }
+
+    *icon = default_icon_;
+    description->clear();
+
+    if (!queued_types_.contains(type))
+    {
+        queued_types_.insert(type);
+        queue_.append(type);
+
+        if (!timer_id_)
+            timer_id_ = startTimer(0);
+    }
+
+    return false;
+}
+
+void FileTypeCache::timerEvent(QTimerEvent* event)
+{
+    if (event->timerId() != timer_id_)
+    {
+        QObject::timerEvent(event);
+        return;
+    }
+
+    if (types_.size() + queue_.size() > kMaxCachedTypes)
+        types_.clear();
+
+    QElapsedTimer slice_timer;
+    slice_timer.start();
+
+    while (!queue_.isEmpty() && slice_timer.elapsed() < kLookupSlice)
+    {
+        const QString type = queue_.takeFirst();
+        queued_types_.remove(type);
+
+        // The shell takes the type by the extension of the name.
+        types_.insert(type, FilePlatformUtil::fileTypeInfo(QStringLiteral("file") + type));
+    }
+
+    if (queue_.isEmpty())
+    {
+        killTimer(timer_id_);
+        timer_id_ = 0;
+    }
+
+    emit fileTypesReady();
+}
+
+// static
+QString FileTypeCache::extension(const QString& file_name)
+{
+    const int dot = file_name.lastIndexOf(QLatin1Char('.'));
+    if (dot == -1)
+        return QString();
+
+    return file_name.mid(dot).toLower();
+}
+
+} // namespace aspia
@@ -0,0 +1,66 @@
+//
+// PROJECT:         Aspia
+// FILE:            client/ui/file_type_cache.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CLIENT__UI__FILE_TYPE_CACHE_H
+#define _ASPIA_CLIENT__UI__FILE_TYPE_CACHE_H
+
+#include <QHash>
+#include <QIcon>
+#include <QObject>
+#include <QPair>
+#include <QSet>
+#include <QStringList>
+
+namespace aspia {
+
+//
+// The icons and the descriptions of the file types by the extensions of the files. The shell
+// returns the same type info for all files with the same extension, because the files are not
+// read by it. The types which are not cached yet are looked up in the short slices of the idle
+// time of the UI thread, so the large lists of the files are shown at once with the default
+// icon, and the items are updated when fileTypesReady() is emitted. The icons are converted to
+// the pixmaps, so the lookups can not be moved to another thread.
+//
+class FileTypeCache : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit FileTypeCache(QObject* parent = nullptr);
+    ~FileTypeCache() = default;
+
+    // Returns true if the type of |file_name| is cached. Otherwise the default icon and an
+    // empty description are returned and the type is queued for the lookup.
+    bool typeInfo(const QString& file_name, QIcon* icon, QString* description);
+
+signals:
+    // Some of the queued types are cached.
+    void fileTypesReady();
+
+protected:
+    // QObject implementation.
+    void timerEvent(QTimerEvent* event) override;
+
+private:
+    static QString extension(const QString& file_name);
+
+    QHash<QString, QPair<QIcon, QString>> types_;
+
+    // The extensions which are queued for the lookup. |queued_types_| contains the same ones
+    // to check them quickly.
+    QStringList queue_;
+    QSet<QString> queued_types_;
+
+    QIcon default_icon_;
+    int timer_id_ = 0;
+
+    Q_DISABLE_COPY(FileTypeCache)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_CLIENT__UI__FILE_TYPE_CACHE_H
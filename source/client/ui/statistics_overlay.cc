@@ -0,0 +1,78 @@
+//
+// PROJECT:         Aspia
+// FILE:            client/ui/statistics_overlay.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "client/ui/statistics_overlay.h"
+
+namespace aspia {
+
+namespace {
+
+QString milliseconds(qint64 microseconds)
+{
+    return QString::number(static_cast<double>(microseconds) / 1000.0, 'f', 1);
+}
+
+} // namespace
+
+StatisticsOverlay::StatisticsOverlay(QWidget* parent)
+    : QLabel(parent)
+{
+    // The overlay does not take the input of the remote desktop.
+    setAttribute(Qt::WA_TransparentForMouseEvents);
+    setStyleSheet(QStringLiteral("background-color: rgba(0, 0, 0, 160); color: white;"));
+    setMargin(6);
+
+    setStatistics(Statistics());
+}
+
+void StatisticsOverlay::setStatistics(const Statistics& statistics)
+{
+    QString round_trip_time = tr("unknown");
+    if (statistics.round_trip_time >= 0)
+        round_trip_time = tr("%1 ms").arg(statistics.round_trip_time);
+
+    QString quality = tr("unknown");
+    if (statistics.psnr > 0)
+    {
+        quality = tr("PSNR %1 dB, SSIM %2")
+            .arg(statistics.psnr, 0, 'f', 1)
+            .arg(statistics.ssim, 0, 'f', 3);
+    }
+
+    QString input_latency = tr("unknown");
+    if (statistics.input_latency >= 0)
+    {
+        input_latency = tr("%1 ms (p95 %2 ms): host %3, network %4, client %5 ms")
+            .arg(milliseconds(statistics.input_latency))
+            .arg(milliseconds(statistics.input_latency_p95))
+            .arg(milliseconds(statistics.host_latency))
+            .arg(milliseconds(statistics.network_latency))
+            .arg(milliseconds(statistics.client_latency));
+    }
+
+    setText(tr("Frame rate: %1 fps (dropped: %2)\n"
+               "Bitrate: %3 kbps\n"
+               "Round trip time: %4\n"
+               "Encoding: %5 ms\n"
+               "Decoding: %6 ms\n"
+               "Painting: %7 ms\n"
+               "Quality: %8\n"
+               "Input latency: %9")
+            .arg(statistics.frame_rate)
+            .arg(statistics.dropped_frames)
+            .arg(statistics.bitrate)
+            .arg(round_trip_time)
+            .arg(milliseconds(statistics.encode_time))
+            .arg(milliseconds(statistics.decode_time))
+            .arg(milliseconds(statistics.paint_time))
+            .arg(quality)
+            .arg(input_latency));
+
+    adjustSize();
+}
+
+} // namespace aspia
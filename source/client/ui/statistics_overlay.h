@@ -0,0 +1,66 @@
+//
+// PROJECT:         Aspia
+// FILE:            client/ui/statistics_overlay.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CLIENT__UI__STATISTICS_OVERLAY_H
+#define _ASPIA_CLIENT__UI__STATISTICS_OVERLAY_H
+
+#include <QLabel>
+
+namespace aspia {
+
+//
+// Shows the current statistics of the desktop session over the remote desktop.
+//
+class StatisticsOverlay : public QLabel
+{
+    Q_OBJECT
+
+public:
+    struct Statistics
+    {
+        // The frames shown per second and the decoded frames replaced by the next ones before
+        // they were shown.
+        int frame_rate = 0;
+        int dropped_frames = 0;
+
+        // Kilobits per second received from the host.
+        qint64 bitrate = 0;
+
+        // Round trip time of the session in milliseconds or -1 if it is not known.
+        qint64 round_trip_time = -1;
+
+        // Average times of a frame in microseconds.
+        qint64 encode_time = 0;
+        qint64 decode_time = 0;
+        qint64 paint_time = 0;
+
+        // The last quality of a frame measured by the host, 0 if the host does not measure it.
+        double psnr = 0;
+        double ssim = 0;
+
+        // The median and the 95th percentile of the latency of the input in microseconds from
+        // the event to the paint of the frame, and the medians of its parts. -1 if the latency
+        // is not measured.
+        qint64 input_latency = -1;
+        qint64 input_latency_p95 = -1;
+        qint64 host_latency = -1;
+        qint64 network_latency = -1;
+        qint64 client_latency = -1;
+    };
+
+    explicit StatisticsOverlay(QWidget* parent);
+    ~StatisticsOverlay() = default;
+
+    void setStatistics(const Statistics& statistics);
+
+private:
+    Q_DISABLE_COPY(StatisticsOverlay)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_CLIENT__UI__STATISTICS_OVERLAY_H
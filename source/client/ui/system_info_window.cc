@@ -7,6 +7,10 @@
 
 #include "client/ui/system_info_window.h"
 
+#include <QVBoxLayout>
+
+#include "system_info/ui/dmi_parser.h"
+
 namespace aspia {
 
 SystemInfoWindow::SystemInfoWindow(ConnectData* connect_data, QWidget* parent)
@@ -21,6 +25,19 @@ SystemInfoWindow::SystemInfoWindow(ConnectData* connect_data, QWidget* parent)
         computer_name = connect_data->address();
 
     setWindowTitle(tr("%1 - Aspia System Information").arg(computer_name));
+
+    ui.category_tree->addTopLevelItem(new QTreeWidgetItem(QStringList() << tr("DMI")));
+
+    QVBoxLayout* layout = new QVBoxLayout(ui.category_frame);
+    layout->setContentsMargins(0, 0, 0, 0);
+
+    parser_ = new DmiParser(ui.category_frame);
+    layout->addWidget(parser_);
+}
+
+void SystemInfoWindow::readReply(const QString& uuid, const QByteArray& data)
+{
+    parser_->readReply(uuid, data);
 }
 
 void SystemInfoWindow::closeEvent(QCloseEvent* event)
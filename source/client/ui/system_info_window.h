@@ -13,6 +13,7 @@
 
 namespace aspia {
 
+class Parser;
 class SystemInfoRequest;
 
 class SystemInfoWindow : public QWidget
@@ -23,6 +24,9 @@ public:
     SystemInfoWindow(ConnectData* connect_data, QWidget* parent = nullptr);
     ~SystemInfoWindow() = default;
 
+    // Passes the data of the category to its parser. The parsing is done in the background.
+    void readReply(const QString& uuid, const QByteArray& data);
+
 signals:
     void windowClose();
     void request(SystemInfoRequest* request);
@@ -33,6 +37,7 @@ protected:
 
 private:
     Ui::SystemInfoWindow ui;
+    Parser* parser_;
 
     Q_DISABLE_COPY(SystemInfoWindow)
 };
@@ -0,0 +1,483 @@
+//
+// PROJECT:         Aspia
+// FILE:            client/video_decode_thread.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "client/video_decode_thread.h"
+
+#include <QCoreApplication>
+#include <QDebug>
+#include <QElapsedTimer>
+
+#include <libyuv/convert_argb.h>
+#include <libyuv/convert_from_argb.h>
+
+#include "base/trace_logger.h"
+#include "codec/video_decoder.h"
+#include "codec/video_util.h"
+#include "desktop_capture/desktop_frame_qimage.h"
+#include "desktop_capture/frame_hashes.h"
+#include "desktop_capture/desktop_frame_yuv.h"
+
+namespace aspia {
+
+namespace {
+
+// Number of decoded packets kept to reuse their buffers.
+constexpr size_t kMaxFreePackets = 2;
+
+void copyFrameRect(const DesktopFrame* source, DesktopFrame* target, const QRect& rect)
+{
+    const int row_size = rect.width() * source->format().bytesPerPixel();
+
+    const quint8* src = source->frameDataAtPos(rect.topLeft());
+    quint8* dst = target->frameDataAtPos(rect.topLeft());
+
+    for (int y = 0; y < rect.height(); ++y)
+    {
+        memcpy(dst, src, row_size);
+
+        src += source->stride();
+        dst += target->stride();
+    }
+}
+
+// Expands |rect| to the chroma samples of the frame which contain it.
+QRect chromaAlignedRect(const DesktopFrameYUV* frame, const QRect& rect)
+{
+    if (frame->layout() == DesktopFrameYUV::Layout::I444)
+        return rect;
+
+    const QRect plane_rect = frame->planeRect(1, rect);
+
+    return QRect(plane_rect.x() * 2, plane_rect.y() * 2,
+                 plane_rect.width() * 2, plane_rect.height() * 2) &
+           QRect(QPoint(), frame->size());
+}
+
+// The frames are converted only when the session switches between the encodings with the
+// planar output and without it.
+void convertRect(const DesktopFrameQImage* source, DesktopFrameYUV* target, const QRect& area)
+{
+    const QRect rect = chromaAlignedRect(target, area);
+    const QRect uv_rect = target->planeRect(1, rect);
+
+    quint8* y = target->plane(0) + rect.top() * target->stride(0) + rect.left();
+    quint8* u = target->plane(1) + uv_rect.top() * target->stride(1) + uv_rect.left();
+    quint8* v = target->plane(2) + uv_rect.top() * target->stride(2) + uv_rect.left();
+
+    if (target->layout() == DesktopFrameYUV::Layout::I420)
+    {
+        libyuv::ARGBToI420(source->frameDataAtPos(rect.topLeft()), source->stride(),
+                           y, target->stride(0), u, target->stride(1), v, target->stride(2),
+                           rect.width(), rect.height());
+    }
+    else
+    {
+        libyuv::ARGBToI444(source->frameDataAtPos(rect.topLeft()), source->stride(),
+                           y, target->stride(0), u, target->stride(1), v, target->stride(2),
+                           rect.width(), rect.height());
+    }
+}
+
+void convertRect(const DesktopFrameYUV* source, DesktopFrameQImage* target, const QRect& area)
+{
+    const QRect rect = chromaAlignedRect(source, area);
+    const QRect uv_rect = source->planeRect(1, rect);
+
+    const quint8* y = source->plane(0) + rect.top() * source->stride(0) + rect.left();
+    const quint8* u = source->plane(1) + uv_rect.top() * source->stride(1) + uv_rect.left();
+    const quint8* v = source->plane(2) + uv_rect.top() * source->stride(2) + uv_rect.left();
+
+    if (source->layout() == DesktopFrameYUV::Layout::I420)
+    {
+        libyuv::I420ToARGB(y, source->stride(0), u, source->stride(1), v, source->stride(2),
+                           target->frameDataAtPos(rect.topLeft()), target->stride(),
+                           rect.width(), rect.height());
+    }
+    else
+    {
+        libyuv::I444ToARGB(y, source->stride(0), u, source->stride(1), v, source->stride(2),
+                           target->frameDataAtPos(rect.topLeft()), target->stride(),
+                           rect.width(), rect.height());
+    }
+}
+
+void addDirtyRects(const proto::desktop::VideoPacket& packet, QRegion* region)
+{
+    // The malformed rectangles are reported by the decoder.
+    std::vector<QRect> rects;
+    VideoUtil::dirtyRects(packet, &rects);
+
+    for (const QRect& rect : rects)
+        *region += rect;
+
+    // The layers of the hybrid encoding have their own rectangles.
+    for (int i = 0; i < packet.layer_size(); ++i)
+        addDirtyRects(packet.layer(i), region);
+}
+
+} // namespace
+
+QSize VideoDecodeThread::Frame::size() const
+{
+    if (is_yuv)
+        return yuv ? yuv->size() : QSize();
+
+    return rgb ? rgb->size() : QSize();
+}
+
+VideoDecodeThread::VideoDecodeThread(QObject* parent)
+    : QThread(parent)
+{
+    start(QThread::HighPriority);
+}
+
+VideoDecodeThread::~VideoDecodeThread()
+{
+    {
+        std::scoped_lock<std::mutex> lock(lock_);
+        terminate_ = true;
+    }
+
+    condition_.notify_one();
+    wait();
+}
+
+void VideoDecodeThread::setYuvOutput(bool enable)
+{
+    std::scoped_lock<std::mutex> lock(lock_);
+    yuv_output_ = enable;
+}
+
+void VideoDecodeThread::decodePacket(std::unique_ptr<proto::desktop::VideoPacket> packet)
+{
+    {
+        std::scoped_lock<std::mutex> lock(lock_);
+        packets_.push_back(std::move(packet));
+    }
+
+    condition_.notify_one();
+}
+
+std::unique_ptr<proto::desktop::VideoPacket> VideoDecodeThread::takeFreePacket()
+{
+    std::scoped_lock<std::mutex> lock(lock_);
+
+    if (free_packets_.empty())
+        return nullptr;
+
+    std::unique_ptr<proto::desktop::VideoPacket> packet = std::move(free_packets_.back());
+    free_packets_.pop_back();
+    return packet;
+}
+
+bool VideoDecodeThread::presentFrame(QRegion* dirty_region)
+{
+    {
+        std::scoped_lock<std::mutex> lock(lock_);
+
+        if (!frame_ready_)
+            return false;
+
+        if (decoding_)
+        {
+            present_requested_ = true;
+            return false;
+        }
+
+        std::swap(front_frame_, back_frame_);
+
+        // After the swap the other frame does not have the changes since the last swap.
+        sync_region_ = present_region_;
+
+        dirty_region->swap(present_region_);
+        present_region_ = QRegion();
+
+        frame_ready_ = false;
+        present_requested_ = false;
+    }
+
+    condition_.notify_one();
+    return true;
+}
+
+const DesktopFrameQImage* VideoDecodeThread::frame() const
+{
+    return front_frame_.is_yuv ? nullptr : front_frame_.rgb.get();
+}
+
+const DesktopFrameYUV* VideoDecodeThread::yuvFrame() const
+{
+    return front_frame_.is_yuv ? front_frame_.yuv.get() : nullptr;
+}
+
+std::vector<quint64> VideoDecodeThread::frameHashes(QSize* frame_size)
+{
+    std::scoped_lock<std::mutex> lock(lock_);
+
+    if (frame_ready_ || decoding_ || !packets_.empty() || front_frame_.is_yuv ||
+        !front_frame_.rgb)
+    {
+        return std::vector<quint64>();
+    }
+
+    *frame_size = front_frame_.rgb->size();
+    return FrameHashes::compute(front_frame_.rgb.get());
+}
+
+void VideoDecodeThread::run()
+{
+    while (true)
+    {
+        std::unique_ptr<proto::desktop::VideoPacket> packet;
+        bool yuv_output;
+
+        {
+            std::unique_lock<std::mutex> lock(lock_);
+
+            // The back frame is not changed while the UI is waiting for it.
+            condition_.wait(lock, [this]()
+            {
+                return terminate_ || (!packets_.empty() && !present_requested_);
+            });
+
+            if (terminate_)
+                return;
+
+            packet = std::move(packets_.front());
+            packets_.pop_front();
+
+            yuv_output = yuv_output_;
+            decoding_ = true;
+        }
+
+        QElapsedTimer decode_timer;
+        decode_timer.start();
+
+        DecodeEvent* event = new DecodeEvent();
+        event->frame_id = packet->frame_id();
+
+        QRegion dirty_region;
+
+        {
+            ScopedTrace trace("decode", packet->trace_id());
+
+            if (!decode(*packet, yuv_output, &dirty_region, event))
+            {
+                delete event;
+                return;
+            }
+        }
+
+        event->decode_time = decode_timer.elapsed();
+
+        // The span from the capture on the host is valid if the clocks are synchronized.
+        if (packet->capture_time() && TraceLogger::isEnabled())
+        {
+            TraceLogger::addSpan("capture_to_decode", packet->capture_time(),
+                                 TraceLogger::currentTime(), packet->trace_id());
+        }
+
+        std::scoped_lock<std::mutex> lock(lock_);
+
+        decoding_ = false;
+
+        if (event->refresh_required)
+        {
+            // The back frame is partially decoded and is not shown until the refresh.
+            frame_ready_ = false;
+            present_region_ = QRegion();
+        }
+        else if (event->frame_ready)
+        {
+            present_region_ += dirty_region;
+            frame_ready_ = true;
+        }
+
+        if (present_requested_)
+        {
+            if (frame_ready_)
+                QCoreApplication::postEvent(parent(), new PresentEvent());
+            else
+                present_requested_ = false;
+        }
+
+        if (free_packets_.size() < kMaxFreePackets)
+            free_packets_.push_back(std::move(packet));
+
+        QCoreApplication::postEvent(parent(), event);
+    }
+}
+
+bool VideoDecodeThread::decode(const proto::desktop::VideoPacket& packet,
+                               bool yuv_output,
+                               QRegion* dirty_region,
+                               DecodeEvent* event)
+{
+    if (refresh_pending_)
+    {
+        // The packets encoded before the refresh refer to the lost state of the decoder.
+        if (!packet.has_format())
+            return true;
+
+        refresh_pending_ = false;
+        video_decoder_.reset();
+        video_encoding_ = proto::desktop::VIDEO_ENCODING_UNKNOWN;
+    }
+
+    if (video_encoding_ != packet.encoding())
+    {
+        video_decoder_ = VideoDecoder::create(packet.encoding());
+        video_encoding_ = packet.encoding();
+    }
+
+    if (!video_decoder_)
+    {
+        QCoreApplication::postEvent(parent(), new ErrorEvent(Error::UNSUPPORTED_ENCODING));
+        return false;
+    }
+
+    const bool yuv = yuv_output && video_decoder_->canDecodeYuv();
+
+    if (!prepareBackFrame(packet, yuv))
+        return false;
+
+    const QRect frame_rect(QPoint(), back_frame_.size());
+
+    for (int i = 0; i < packet.copy_rect_size(); ++i)
+    {
+        DesktopFrame::MoveRect move_rect = VideoUtil::fromVideoCopyRect(packet.copy_rect(i));
+
+        if (!frame_rect.contains(move_rect.target) ||
+            !frame_rect.contains(QRect(move_rect.source, move_rect.target.size())))
+        {
+            QCoreApplication::postEvent(parent(), new ErrorEvent(Error::WRONG_COPY_RECT));
+            return false;
+        }
+
+        if (yuv)
+            back_frame_.yuv->copyRect(move_rect.source, move_rect.target);
+        else
+            back_frame_.rgb->copyRect(move_rect.source, move_rect.target);
+
+        *dirty_region += move_rect.target;
+    }
+
+    const bool decoded = yuv ? video_decoder_->decodeYuv(packet, &back_frame_.yuv) :
+                               video_decoder_->decode(packet, back_frame_.rgb.get());
+    if (!decoded)
+    {
+        // The decoding starts from the packets with the format. If such a packet can not be
+        // decoded, then the refresh does not help.
+        if (packet.has_format())
+        {
+            QCoreApplication::postEvent(parent(), new ErrorEvent(Error::DECODE_FAILED));
+            return false;
+        }
+
+        qWarning("The video packet could not be decoded. The screen is requested again");
+
+        // The frame is not shown until the refresh.
+        refresh_pending_ = true;
+        event->refresh_required = true;
+        return true;
+    }
+
+    if (packet.has_format())
+        *dirty_region = frame_rect;
+    else
+        addDirtyRects(packet, dirty_region);
+
+    *dirty_region &= frame_rect;
+    event->frame_ready = true;
+    return true;
+}
+
+bool VideoDecodeThread::prepareBackFrame(const proto::desktop::VideoPacket& packet, bool yuv)
+{
+    QSize frame_size;
+
+    if (packet.has_format())
+    {
+        const proto::desktop::Size& size = packet.format().screen_size();
+
+        if (size.width() <= 0 || size.height() <= 0)
+        {
+            QCoreApplication::postEvent(parent(), new ErrorEvent(Error::WRONG_FRAME_SIZE));
+            return false;
+        }
+
+        frame_size = QSize(size.width(), size.height());
+    }
+    else if (!front_frame_.size().isEmpty())
+    {
+        frame_size = front_frame_.size();
+    }
+    else if (!back_frame_.size().isEmpty())
+    {
+        frame_size = back_frame_.size();
+    }
+    else
+    {
+        QCoreApplication::postEvent(parent(), new ErrorEvent(Error::FRAME_NOT_INITIALIZED));
+        return false;
+    }
+
+    QRegion sync_region;
+    sync_region.swap(sync_region_);
+
+    // The image of the other type is outdated.
+    if (back_frame_.is_yuv != yuv)
+        sync_region = QRect(QPoint(), frame_size);
+
+    back_frame_.is_yuv = yuv;
+
+    if (yuv)
+    {
+        // The layout of the previous image is kept. The decoder changes it if necessary.
+        DesktopFrameYUV::Layout layout = DesktopFrameYUV::Layout::I420;
+        if (front_frame_.is_yuv && front_frame_.yuv)
+            layout = front_frame_.yuv->layout();
+
+        if (!back_frame_.yuv || back_frame_.yuv->size() != frame_size ||
+            back_frame_.yuv->layout() != layout)
+        {
+            back_frame_.yuv = DesktopFrameYUV::create(frame_size, layout);
+            sync_region = QRect(QPoint(), frame_size);
+        }
+    }
+    else if (!back_frame_.rgb || back_frame_.rgb->size() != frame_size)
+    {
+        back_frame_.rgb = DesktopFrameQImage::create(frame_size);
+        sync_region = QRect(QPoint(), frame_size);
+    }
+
+    if ((yuv && !back_frame_.yuv) || (!yuv && !back_frame_.rgb))
+    {
+        QCoreApplication::postEvent(parent(), new ErrorEvent(Error::FRAME_NOT_INITIALIZED));
+        return false;
+    }
+
+    // The front frame is only read by the UI thread, so it is copied without the lock.
+    if (front_frame_.size() != frame_size)
+        return true;
+
+    for (const auto& rect : sync_region)
+    {
+        if (yuv && front_frame_.is_yuv)
+            back_frame_.yuv->copyFrom(*front_frame_.yuv, rect);
+        else if (yuv)
+            convertRect(front_frame_.rgb.get(), back_frame_.yuv.get(), rect);
+        else if (front_frame_.is_yuv)
+            convertRect(front_frame_.yuv.get(), back_frame_.rgb.get(), rect);
+        else
+            copyFrameRect(front_frame_.rgb.get(), back_frame_.rgb.get(), rect);
+    }
+
+    return true;
+}
+
+} // namespace aspia
@@ -0,0 +1,201 @@
+//
+// PROJECT:         Aspia
+// FILE:            client/video_decode_thread.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CLIENT__VIDEO_DECODE_THREAD_H
+#define _ASPIA_CLIENT__VIDEO_DECODE_THREAD_H
+
+#include <QEvent>
+#include <QRegion>
+#include <QThread>
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "protocol/desktop_session.pb.h"
+
+namespace aspia {
+
+class DesktopFrameQImage;
+class DesktopFrameYUV;
+class VideoDecoder;
+
+//
+// The video packets of the session are decoded in a separate thread, so that large updates do
+// not block the UI thread. The packets are decoded into the back frame as soon as they arrive.
+// The owner gets a DecodeEvent for each packet and makes the latest decoded frame current by
+// presentFrame() when it is time to paint. The changes of the packets decoded between two
+// presentations are coalesced, so after a burst of packets only the last frame is painted.
+//
+// If the YUV output is enabled, then the decoders which support it output the planar image
+// without the conversion to RGB. The current frame is either RGB or YUV.
+//
+class VideoDecodeThread : public QThread
+{
+    Q_OBJECT
+
+public:
+    explicit VideoDecodeThread(QObject* parent);
+    ~VideoDecodeThread();
+
+    enum class Error
+    {
+        UNSUPPORTED_ENCODING,
+        WRONG_FRAME_SIZE,
+        FRAME_NOT_INITIALIZED,
+        WRONG_COPY_RECT,
+        DECODE_FAILED
+    };
+
+    // Enables the planar output for the renderers which convert YUV to RGB themselves.
+    void setYuvOutput(bool enable);
+
+    // Queues the packet for decoding. The result is reported by a DecodeEvent.
+    void decodePacket(std::unique_ptr<proto::desktop::VideoPacket> packet);
+
+    // Returns a decoded packet to reuse its allocated buffers or nullptr.
+    std::unique_ptr<proto::desktop::VideoPacket> takeFreePacket();
+
+    // Makes the latest decoded frame current and returns the areas changed since the previous
+    // presentation in |dirty_region|. The current frame is not changed until the next call.
+    // If the decoder is in the middle of a packet, then the frame is not changed and false is
+    // returned. In this case a PresentEvent is posted when the packet is decoded. Returns false
+    // also if there is no new frame.
+    bool presentFrame(QRegion* dirty_region);
+
+    // The current frame. Only one of the methods returns a frame.
+    const DesktopFrameQImage* frame() const;
+    const DesktopFrameYUV* yuvFrame() const;
+
+    // Returns the hashes of the tiles of the current RGB frame and its size. Returns an empty
+    // list if the frame is YUV or the decoded packets are not presented yet.
+    std::vector<quint64> frameHashes(QSize* frame_size);
+
+    class DecodeEvent : public QEvent
+    {
+    public:
+        static const int kType = QEvent::User + 1;
+
+        DecodeEvent()
+            : QEvent(static_cast<QEvent::Type>(kType))
+        {
+            // Nothing
+        }
+
+        // Identifier of the packet for VideoAck.
+        quint32 frame_id = 0;
+
+        // Time of the decoding of the packet in milliseconds.
+        qint64 decode_time = 0;
+
+        // The packet has changed the frame and presentFrame() should be called.
+        bool frame_ready = false;
+
+        // The packet could not be decoded. The following packets are skipped until the next
+        // packet with the format, so the screen must be requested again.
+        bool refresh_required = false;
+
+    private:
+        Q_DISABLE_COPY(DecodeEvent)
+    };
+
+    // After the error the packets are not decoded anymore.
+    class ErrorEvent : public QEvent
+    {
+    public:
+        static const int kType = QEvent::User + 2;
+
+        explicit ErrorEvent(Error error)
+            : QEvent(static_cast<QEvent::Type>(kType)),
+              error(error)
+        {
+            // Nothing
+        }
+
+        const Error error;
+
+    private:
+        Q_DISABLE_COPY(ErrorEvent)
+    };
+
+    // The frame can be presented now.
+    class PresentEvent : public QEvent
+    {
+    public:
+        static const int kType = QEvent::User + 3;
+
+        PresentEvent()
+            : QEvent(static_cast<QEvent::Type>(kType))
+        {
+            // Nothing
+        }
+
+    private:
+        Q_DISABLE_COPY(PresentEvent)
+    };
+
+protected:
+    // QThread implementation.
+    void run() override;
+
+private:
+    struct Frame
+    {
+        QSize size() const;
+
+        std::unique_ptr<DesktopFrameQImage> rgb;
+        std::unique_ptr<DesktopFrameYUV> yuv;
+
+        // True if |yuv| contains the image.
+        bool is_yuv = false;
+    };
+
+    // Decodes the packet into |back_frame_|. Returns false if the error is posted.
+    bool decode(const proto::desktop::VideoPacket& packet,
+                bool yuv,
+                QRegion* dirty_region,
+                DecodeEvent* event);
+    bool prepareBackFrame(const proto::desktop::VideoPacket& packet, bool yuv);
+
+    std::mutex lock_;
+    std::condition_variable condition_;
+    bool terminate_ = false;
+    bool yuv_output_ = false;
+
+    std::deque<std::unique_ptr<proto::desktop::VideoPacket>> packets_;
+    std::vector<std::unique_ptr<proto::desktop::VideoPacket>> free_packets_;
+
+    // The frames and |sync_region_| are changed by presentFrame() only while |decoding_| is
+    // not set. The decoder does not touch them at that time.
+    bool decoding_ = false;
+    Frame front_frame_;
+    Frame back_frame_;
+
+    // The back frame contains the changes of |present_region_| since the last presentation.
+    bool frame_ready_ = false;
+    QRegion present_region_;
+
+    // The owner waits for the current packet to present the frame. The next packet is not
+    // decoded until then.
+    bool present_requested_ = false;
+
+    // Areas of the front frame which are not copied to the back frame yet.
+    QRegion sync_region_;
+
+    // The following fields are used only by the decoder thread.
+    std::unique_ptr<VideoDecoder> video_decoder_;
+    proto::desktop::VideoEncoding video_encoding_ = proto::desktop::VIDEO_ENCODING_UNKNOWN;
+    bool refresh_pending_ = false;
+
+    Q_DISABLE_COPY(VideoDecodeThread)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_CLIENT__VIDEO_DECODE_THREAD_H
@@ -0,0 +1,452 @@
+//
+// PROJECT:         Aspia
+// FILE:            client/wall_client.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "client/wall_client.h"
+
+#include <QThreadPool>
+#include <QTimerEvent>
+
+#include "base/function_runnable.h"
+#include "base/message_serialization.h"
+#include "client/client_user_authorizer.h"
+#include "client/computer_factory.h"
+#include "codec/video_decoder.h"
+#include "codec/video_util.h"
+#include "desktop_capture/desktop_frame_qimage.h"
+#include "network/network_channel.h"
+
+namespace aspia {
+
+namespace {
+
+enum MessageId { ConfigMessageId };
+
+// The thumbnails change slowly, so one frame per second is enough.
+constexpr quint32 kUpdateInterval = 1000; // 1 second
+
+constexpr int kReconnectInterval = 10000; // 10 seconds
+
+// The threads are shared by all clients of the wall. The packets of one client are decoded by
+// one task at a time in the order of receiving.
+QThreadPool* decodeThreadPool()
+{
+    static QThreadPool thread_pool;
+    return &thread_pool;
+}
+
+} // namespace
+
+WallClient::WallClient(const ConnectData& connect_data,
+                       const QSize& thumbnail_size,
+                       QObject* parent)
+    : QObject(parent),
+      connect_data_(connect_data),
+      thumbnail_size_(thumbnail_size)
+{
+    connect_data_.setSessionType(proto::auth::SESSION_TYPE_DESKTOP_VIEW);
+}
+
+WallClient::~WallClient()
+{
+    {
+        std::unique_lock<std::mutex> lock(lock_);
+
+        // The task is not able to post the results to the deleted object.
+        terminating_ = true;
+        decode_finished_.wait(lock, [this]() { return !decoding_; });
+    }
+
+    delete authorizer_;
+    delete channel_;
+}
+
+void WallClient::start()
+{
+    // The authorizer asks the missing credentials by the dialog.
+    if (connect_data_.userName().isEmpty() || connect_data_.password().isEmpty())
+    {
+        setStatus(tr("The user name or the password is not specified."));
+        return;
+    }
+
+    connectToHost();
+}
+
+void WallClient::timerEvent(QTimerEvent* event)
+{
+    if (event->timerId() == reconnect_timer_id_)
+    {
+        killTimer(reconnect_timer_id_);
+        reconnect_timer_id_ = 0;
+
+        connectToHost();
+        return;
+    }
+
+    QObject::timerEvent(event);
+}
+
+void WallClient::onChannelConnected()
+{
+    authorizer_ = new ClientUserAuthorizer(nullptr);
+
+    authorizer_->setSessionType(connect_data_.sessionType());
+    authorizer_->setUserName(connect_data_.userName());
+    authorizer_->setPassword(connect_data_.password());
+    authorizer_->setChallengeNonce(channel_->challengeNonce());
+    authorizer_->setHostAddress(
+        connect_data_.address() + QLatin1Char(':') + QString::number(connect_data_.port()));
+
+    connect(authorizer_, &ClientUserAuthorizer::writeMessage,
+            channel_, &NetworkChannel::writeMessage);
+
+    connect(authorizer_, &ClientUserAuthorizer::readMessage,
+            channel_, &NetworkChannel::readMessage);
+
+    connect(channel_, &NetworkChannel::messageReceived,
+            authorizer_, &ClientUserAuthorizer::messageReceived);
+
+    connect(channel_, &NetworkChannel::messageWritten,
+            authorizer_, &ClientUserAuthorizer::messageWritten);
+
+    connect(authorizer_, &ClientUserAuthorizer::finished,
+            this, &WallClient::onAuthorizationFinished);
+
+    setStatus(tr("Authorization..."));
+    authorizer_->start();
+}
+
+void WallClient::onAuthorizationFinished(proto::auth::Status status)
+{
+    // The authorizer can not be deleted while it emits the signal.
+    authorizer_->deleteLater();
+
+    switch (status)
+    {
+        case proto::auth::STATUS_SUCCESS:
+            break;
+
+        // The credentials do not become valid by themselves.
+        case proto::auth::STATUS_ACCESS_DENIED:
+            stop(tr("Authorization error: Access denied."), false);
+            return;
+
+        case proto::auth::STATUS_CANCELED:
+            stop(tr("Authorization has been canceled."), false);
+            return;
+
+        default:
+            stop(tr("Authorization error: Unknown status code."), true);
+            return;
+    }
+
+    // The next messages belong to the session.
+    disconnect(channel_, &NetworkChannel::messageReceived,
+               authorizer_, &ClientUserAuthorizer::messageReceived);
+    disconnect(channel_, &NetworkChannel::messageWritten,
+               authorizer_, &ClientUserAuthorizer::messageWritten);
+
+    connect(channel_, &NetworkChannel::messageReceived,
+            this, &WallClient::onMessageReceived);
+
+    setStatus(tr("Waiting for the screen..."));
+    channel_->readMessage();
+}
+
+void WallClient::onMessageReceived(const QByteArray& buffer)
+{
+    proto::desktop::HostToClient message;
+
+    if (!parseMessage(buffer, message))
+    {
+        stop(tr("Session error: Invalid message from host."), true);
+        return;
+    }
+
+    if (message.has_video_packet())
+    {
+        readVideoPacket(std::unique_ptr<proto::desktop::VideoPacket>(
+            message.release_video_packet()));
+    }
+    else if (message.has_config_request())
+    {
+        readConfigRequest(message.config_request());
+    }
+
+    // The cursor and the other messages are not shown by the wall.
+    if (channel_)
+        channel_->readMessage();
+}
+
+void WallClient::onFrameDecoded()
+{
+    {
+        std::scoped_lock<std::mutex> lock(lock_);
+        image_ = decoded_image_;
+    }
+
+    status_string_.clear();
+    emit changed(this);
+}
+
+void WallClient::onRefreshRequired()
+{
+    if (!channel_)
+        return;
+
+    proto::desktop::ClientToHost message;
+    message.mutable_refresh_request();
+    channel_->writeMessage(-1, serializeMessage(message));
+}
+
+void WallClient::onDecodeError()
+{
+    if (!channel_)
+        return;
+
+    stop(tr("Session error: The video packet could not be decoded."), true);
+}
+
+void WallClient::connectToHost()
+{
+    channel_ = NetworkChannel::createClient(this);
+
+    connect(channel_, &NetworkChannel::connected, this, &WallClient::onChannelConnected);
+
+    connect(channel_, &NetworkChannel::disconnected, this, [this]()
+    {
+        stop(tr("Disconnected."), true);
+    });
+
+    connect(channel_, &NetworkChannel::errorOccurred, this, [this](const QString& message)
+    {
+        stop(tr("Network error: %1.").arg(message), true);
+    });
+
+    setStatus(tr("Connecting..."));
+    channel_->connectToHost(
+        QStringList(connect_data_.address()) + connect_data_.alternateAddresses(),
+        connect_data_.port());
+}
+
+void WallClient::readConfigRequest(const proto::desktop::ConfigRequest& config_request)
+{
+    proto::desktop::Config config = ComputerFactory::defaultDesktopViewConfig();
+
+    // VP8 sends the small changes of the thumbnail in a few bytes.
+    if (config_request.video_encodings() & proto::desktop::VIDEO_ENCODING_VP8)
+    {
+        config.set_video_encoding(proto::desktop::VIDEO_ENCODING_VP8);
+    }
+    else if (config_request.video_encodings() & proto::desktop::VIDEO_ENCODING_ZLIB)
+    {
+        config.set_video_encoding(proto::desktop::VIDEO_ENCODING_ZLIB);
+    }
+    else
+    {
+        stop(tr("Session error: There are no supported video encodings."), false);
+        return;
+    }
+
+    // The host scales the screen down, so the full screen is neither encoded nor sent.
+    config.set_features(proto::desktop::FEATURE_SCALING);
+    config.set_update_interval(kUpdateInterval);
+    VideoUtil::toVideoSize(thumbnail_size_, config.mutable_viewport());
+
+    proto::desktop::ClientToHost message;
+    message.mutable_config()->CopyFrom(config);
+    channel_->writeMessage(ConfigMessageId, serializeMessage(message));
+}
+
+void WallClient::readVideoPacket(std::unique_ptr<proto::desktop::VideoPacket> packet)
+{
+    std::scoped_lock<std::mutex> lock(lock_);
+
+    packets_.push_back(std::move(packet));
+
+    if (decoding_)
+        return;
+
+    decoding_ = true;
+    decodeThreadPool()->start(new FunctionRunnable([this]() { decodePackets(); }));
+}
+
+void WallClient::setStatus(const QString& status_string)
+{
+    status_string_ = status_string;
+    emit changed(this);
+}
+
+void WallClient::stop(const QString& status_string, bool reconnect)
+{
+    if (channel_)
+    {
+        channel_->disconnect(this);
+        channel_->stop();
+        channel_->deleteLater();
+        channel_ = nullptr;
+    }
+
+    if (authorizer_)
+    {
+        authorizer_->deleteLater();
+        authorizer_ = nullptr;
+    }
+
+    {
+        std::scoped_lock<std::mutex> lock(lock_);
+
+        // The next session starts a new stream.
+        packets_.clear();
+        reset_decoder_ = true;
+    }
+
+    if (reconnect && !reconnect_timer_id_)
+        reconnect_timer_id_ = startTimer(kReconnectInterval);
+
+    setStatus(status_string);
+}
+
+void WallClient::decodePackets()
+{
+    bool frame_ready = false;
+
+    for (;;)
+    {
+        std::unique_ptr<proto::desktop::VideoPacket> packet;
+
+        {
+            std::scoped_lock<std::mutex> lock(lock_);
+
+            if (reset_decoder_)
+            {
+                reset_decoder_ = false;
+                frame_ready = false;
+
+                video_decoder_.reset();
+                video_encoding_ = proto::desktop::VIDEO_ENCODING_UNKNOWN;
+                refresh_pending_ = false;
+            }
+
+            if (terminating_ || packets_.empty())
+            {
+                // Only the last frame of the decoded packets is shown.
+                if (frame_ready && !terminating_)
+                {
+                    decoded_image_ = frame_->constImage().copy();
+                    QMetaObject::invokeMethod(this, "onFrameDecoded", Qt::QueuedConnection);
+                }
+
+                decoding_ = false;
+                decode_finished_.notify_all();
+                return;
+            }
+
+            packet = std::move(packets_.front());
+            packets_.pop_front();
+        }
+
+        switch (decodePacket(*packet))
+        {
+            case DecodeResult::FRAME_READY:
+                frame_ready = true;
+                break;
+
+            case DecodeResult::SKIPPED:
+                break;
+
+            case DecodeResult::REFRESH_REQUIRED:
+                QMetaObject::invokeMethod(this, "onRefreshRequired", Qt::QueuedConnection);
+                break;
+
+            case DecodeResult::FAILED:
+            {
+                std::scoped_lock<std::mutex> lock(lock_);
+
+                // The rest of the stream can not be decoded.
+                packets_.clear();
+                frame_ready = false;
+                QMetaObject::invokeMethod(this, "onDecodeError", Qt::QueuedConnection);
+            }
+            break;
+        }
+    }
+}
+
+WallClient::DecodeResult WallClient::decodePacket(const proto::desktop::VideoPacket& packet)
+{
+    if (refresh_pending_)
+    {
+        // The packets encoded before the refresh refer to the lost state of the decoder.
+        if (!packet.has_format())
+            return DecodeResult::SKIPPED;
+
+        refresh_pending_ = false;
+        video_decoder_.reset();
+        video_encoding_ = proto::desktop::VIDEO_ENCODING_UNKNOWN;
+    }
+
+    if (video_encoding_ != packet.encoding())
+    {
+        video_decoder_ = VideoDecoder::create(packet.encoding());
+        video_encoding_ = packet.encoding();
+    }
+
+    if (!video_decoder_)
+        return DecodeResult::FAILED;
+
+    if (packet.has_format())
+    {
+        const proto::desktop::Size& size = packet.format().screen_size();
+
+        if (size.width() <= 0 || size.height() <= 0)
+            return DecodeResult::FAILED;
+
+        const QSize frame_size(size.width(), size.height());
+
+        if (!frame_ || frame_->size() != frame_size)
+        {
+            frame_ = DesktopFrameQImage::create(frame_size);
+            if (!frame_)
+                return DecodeResult::FAILED;
+        }
+    }
+    else if (!frame_)
+    {
+        return DecodeResult::FAILED;
+    }
+
+    const QRect frame_rect(QPoint(), frame_->size());
+
+    for (int i = 0; i < packet.copy_rect_size(); ++i)
+    {
+        DesktopFrame::MoveRect move_rect = VideoUtil::fromVideoCopyRect(packet.copy_rect(i));
+
+        if (!frame_rect.contains(move_rect.target) ||
+            !frame_rect.contains(QRect(move_rect.source, move_rect.target.size())))
+        {
+            return DecodeResult::FAILED;
+        }
+
+        frame_->copyRect(move_rect.source, move_rect.target);
+    }
+
+    if (!video_decoder_->decode(packet, frame_.get()))
+    {
+        // The decoding starts from the packets with the format. If such a packet can not be
+        // decoded, then the refresh does not help.
+        if (packet.has_format())
+            return DecodeResult::FAILED;
+
+        refresh_pending_ = true;
+        return DecodeResult::REFRESH_REQUIRED;
+    }
+
+    return DecodeResult::FRAME_READY;
+}
+
+} // namespace aspia
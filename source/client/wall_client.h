@@ -0,0 +1,118 @@
+//
+// PROJECT:         Aspia
+// FILE:            client/wall_client.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CLIENT__WALL_CLIENT_H
+#define _ASPIA_CLIENT__WALL_CLIENT_H
+
+#include <QImage>
+#include <QPointer>
+#include <QSize>
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+#include "client/connect_data.h"
+#include "protocol/authorization.pb.h"
+#include "protocol/desktop_session.pb.h"
+
+namespace aspia {
+
+class ClientUserAuthorizer;
+class DesktopFrameQImage;
+class NetworkChannel;
+class VideoDecoder;
+
+//
+// Receives the thumbnail of the screen of one host for the monitoring wall. The host scales
+// the screen down to the thumbnail by itself and sends it at a low frame rate. The packets of
+// all clients are decoded by one shared thread pool in turn, so the number of the threads does
+// not depend on the number of the hosts. The credentials must be in the connection data,
+// because they are not asked. After the errors the client connects to the host again.
+//
+class WallClient : public QObject
+{
+    Q_OBJECT
+
+public:
+    WallClient(const ConnectData& connect_data, const QSize& thumbnail_size, QObject* parent);
+    ~WallClient();
+
+    void start();
+
+    const ConnectData& connectData() const { return connect_data_; }
+
+    // The last decoded screen of the host. It is null until the first frame is received.
+    const QImage& image() const { return image_; }
+
+    // Empty while the screen is received.
+    QString statusString() const { return status_string_; }
+
+signals:
+    // The image or the status is changed.
+    void changed(WallClient* client);
+
+protected:
+    void timerEvent(QTimerEvent* event) override;
+
+private slots:
+    void onChannelConnected();
+    void onAuthorizationFinished(proto::auth::Status status);
+    void onMessageReceived(const QByteArray& buffer);
+
+    // Called by the decoding task.
+    void onFrameDecoded();
+    void onRefreshRequired();
+    void onDecodeError();
+
+private:
+    enum class DecodeResult { FRAME_READY, SKIPPED, REFRESH_REQUIRED, FAILED };
+
+    void connectToHost();
+    void readConfigRequest(const proto::desktop::ConfigRequest& config_request);
+    void readVideoPacket(std::unique_ptr<proto::desktop::VideoPacket> packet);
+    void setStatus(const QString& status_string);
+
+    // Stops the connection. If |reconnect| is true, then the client connects again later.
+    void stop(const QString& status_string, bool reconnect);
+
+    // Called by the thread of the pool.
+    void decodePackets();
+    DecodeResult decodePacket(const proto::desktop::VideoPacket& packet);
+
+    ConnectData connect_data_;
+    const QSize thumbnail_size_;
+
+    QPointer<NetworkChannel> channel_;
+    QPointer<ClientUserAuthorizer> authorizer_;
+    int reconnect_timer_id_ = 0;
+
+    QString status_string_;
+    QImage image_;
+
+    // Used only by the decoding task.
+    std::unique_ptr<VideoDecoder> video_decoder_;
+    proto::desktop::VideoEncoding video_encoding_ = proto::desktop::VIDEO_ENCODING_UNKNOWN;
+    std::unique_ptr<DesktopFrameQImage> frame_;
+    bool refresh_pending_ = false;
+
+    // Shared with the decoding task.
+    std::mutex lock_;
+    std::condition_variable decode_finished_;
+    std::deque<std::unique_ptr<proto::desktop::VideoPacket>> packets_;
+    QImage decoded_image_;
+    bool decoding_ = false;
+    bool reset_decoder_ = false;
+    bool terminating_ = false;
+
+    Q_DISABLE_COPY(WallClient)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_CLIENT__WALL_CLIENT_H
@@ -0,0 +1,13 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/codec_bench_entry_point.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "codec/codec_bench_main.h"
+
+int main(int argc, char *argv[])
+{
+    return aspia::codecBenchMain(argc, argv);
+}
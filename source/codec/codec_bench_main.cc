@@ -0,0 +1,820 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/codec_bench_main.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "codec/codec_bench_main.h"
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QTextStream>
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "base/cpu_dispatch.h"
+#include "base/message_serialization.h"
+#include "codec/video_decoder.h"
+#include "codec/video_encoder_av1.h"
+#include "codec/video_encoder_hybrid.h"
+#include "codec/video_encoder_palette.h"
+#include "codec/video_encoder_vpx.h"
+#include "codec/video_encoder_zlib.h"
+#include "codec/video_util.h"
+#include "desktop_capture/capturer_replay.h"
+#include "desktop_capture/desktop_frame_aligned.h"
+#include "desktop_capture/differ.h"
+#include "version.h"
+
+namespace aspia {
+
+namespace {
+
+constexpr int kDefaultFrameCount = 300;
+constexpr int kDefaultCompressRatio = 6;
+
+// The cache of the palette encoding as requested by the client.
+constexpr int kTileCacheSize = 512;
+
+// The page of the synthetic desktop.
+constexpr int kMargin = 40;
+constexpr int kLineHeight = 20;
+constexpr int kGlyphWidth = 8;
+constexpr int kGlyphHeight = 12;
+
+constexpr quint32 kPaperColor = 0xFFFFFFFF;
+constexpr quint32 kInkColor = 0xFF202020;
+
+// The video is played in the window of this size in the center of the screen.
+constexpr int kVideoWidth = 640;
+constexpr int kVideoHeight = 360;
+
+enum class Scenario
+{
+    TYPING,    // A character every few frames and a blinking caret.
+    SCROLLING, // The page is scrolled by a line every frame.
+    VIDEO,     // The video is played in a window, the rest of the screen is static.
+    IDLE,      // Only the clock is changed once a second.
+    REPLAY     // The frames of a recording of FrameRecorder.
+};
+
+struct ScenarioInfo
+{
+    Scenario scenario;
+    const char* name;
+};
+
+const ScenarioInfo kScenarios[] =
+{
+    { Scenario::TYPING,    "typing"    },
+    { Scenario::SCROLLING, "scrolling" },
+    { Scenario::VIDEO,     "video"     },
+    { Scenario::IDLE,      "idle"      }
+};
+
+struct EncodingInfo
+{
+    proto::desktop::VideoEncoding encoding;
+    const char* name;
+};
+
+const EncodingInfo kEncodings[] =
+{
+    { proto::desktop::VIDEO_ENCODING_ZLIB,      "zlib"      },
+    { proto::desktop::VIDEO_ENCODING_LZ4,       "lz4"       },
+    { proto::desktop::VIDEO_ENCODING_ZSTD,      "zstd"      },
+    { proto::desktop::VIDEO_ENCODING_VP8,       "vp8"       },
+    { proto::desktop::VIDEO_ENCODING_VP9,       "vp9"       },
+    { proto::desktop::VIDEO_ENCODING_VP9_LOSSY, "vp9_lossy" },
+    { proto::desktop::VIDEO_ENCODING_HYBRID,    "hybrid"    },
+    { proto::desktop::VIDEO_ENCODING_PALETTE,   "palette"   },
+    { proto::desktop::VIDEO_ENCODING_AV1,       "av1"       }
+};
+
+struct PixelFormatInfo
+{
+    PixelFormat (*format)();
+    const char* name;
+};
+
+const PixelFormatInfo kPixelFormats[] =
+{
+    { &PixelFormat::ARGB,   "argb"   },
+    { &PixelFormat::RGB565, "rgb565" },
+    { &PixelFormat::RGB332, "rgb332" },
+    { &PixelFormat::RGB222, "rgb222" },
+    { &PixelFormat::RGB111, "rgb111" }
+};
+
+struct BenchConfig
+{
+    proto::desktop::VideoEncoding encoding;
+    const char* encoding_name;
+    PixelFormat pixel_format;
+    const char* pixel_format_name;
+    int compress_ratio;
+};
+
+struct Statistics
+{
+    QSize screen_size;
+    int frames = 0;
+    int encoded_frames = 0;
+
+    // The time of the stages in nanoseconds.
+    qint64 diff_time = 0;
+    qint64 encode_time = 0;
+    qint64 serialize_time = 0;
+    qint64 decode_time = 0;
+
+    // The size of the updated areas in the source format and the size of the packets.
+    qint64 raw_bytes = 0;
+    qint64 encoded_bytes = 0;
+
+    // The difference between the source and the decoded frames.
+    double squared_error = 0;
+    qint64 compared_samples = 0;
+};
+
+// The pixel format and the compression ratio are used only by the encodings of the raw pixels.
+bool hasPixelFormat(proto::desktop::VideoEncoding encoding)
+{
+    switch (encoding)
+    {
+        case proto::desktop::VIDEO_ENCODING_ZLIB:
+        case proto::desktop::VIDEO_ENCODING_LZ4:
+        case proto::desktop::VIDEO_ENCODING_ZSTD:
+        case proto::desktop::VIDEO_ENCODING_HYBRID:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+std::unique_ptr<VideoEncoder> createEncoder(const BenchConfig& config)
+{
+    switch (config.encoding)
+    {
+        case proto::desktop::VIDEO_ENCODING_ZLIB:
+        case proto::desktop::VIDEO_ENCODING_LZ4:
+        case proto::desktop::VIDEO_ENCODING_ZSTD:
+            return VideoEncoderZLIB::create(config.pixel_format,
+                                            config.compress_ratio,
+                                            VideoUtil::compressionForEncoding(config.encoding),
+                                            true,
+                                            true);
+
+        case proto::desktop::VIDEO_ENCODING_VP8:
+            return VideoEncoderVPX::createVP8(0);
+
+        case proto::desktop::VIDEO_ENCODING_VP9:
+            return VideoEncoderVPX::createVP9(0, 0);
+
+        case proto::desktop::VIDEO_ENCODING_VP9_LOSSY:
+            return VideoEncoderVPX::createVP9Lossy(0, 0);
+
+        case proto::desktop::VIDEO_ENCODING_AV1:
+            return VideoEncoderAV1::create(0);
+
+        case proto::desktop::VIDEO_ENCODING_HYBRID:
+            return VideoEncoderHybrid::create(
+                VideoEncoderZLIB::create(config.pixel_format,
+                                         config.compress_ratio,
+                                         proto::desktop::COMPRESSION_ZLIB,
+                                         true,
+                                         true),
+                VideoEncoderVPX::createVP8(0, false));
+
+        case proto::desktop::VIDEO_ENCODING_PALETTE:
+            // The palette encoding always sends 32 bit pixels and is measured with the default
+            // ratio.
+            return VideoEncoderPalette::create(kDefaultCompressRatio, kTileCacheSize);
+
+        default:
+            return nullptr;
+    }
+}
+
+//
+// Draws the frames of a scenario. The frames resemble a text editor on the white page, so the
+// codecs see the mostly flat areas with the sharp edges of the glyphs as on the real desktop.
+// The sequence is the same for each run.
+//
+class FrameGenerator
+{
+public:
+    FrameGenerator(Scenario scenario, const QSize& size)
+        : scenario_(scenario),
+          page_rect_(kMargin, kMargin, size.width() - kMargin * 2, size.height() - kMargin * 2)
+    {
+        // Nothing
+    }
+
+    void firstFrame(DesktopFrame* frame)
+    {
+        fillRect(frame, QRect(QPoint(), frame->size()), kPaperColor);
+
+        for (int y = page_rect_.top(); y + kLineHeight <= page_rect_.bottom(); y += kLineHeight)
+            drawTextLine(frame, y);
+
+        cursor_ = QPoint(page_rect_.left(), page_rect_.top() + page_rect_.height() * 2 / 3);
+        cursor_.setY(cursor_.y() - (cursor_.y() - page_rect_.top()) % kLineHeight);
+
+        if (scenario_ == Scenario::VIDEO)
+            drawVideo(frame);
+    }
+
+    // Changes |frame| which contains the previous frame of the sequence to the next one.
+    void nextFrame(DesktopFrame* frame)
+    {
+        ++frame_number_;
+
+        switch (scenario_)
+        {
+            case Scenario::TYPING:
+                typeCharacter(frame);
+                break;
+
+            case Scenario::SCROLLING:
+                scrollPage(frame);
+                break;
+
+            case Scenario::VIDEO:
+                drawVideo(frame);
+                break;
+
+            case Scenario::IDLE:
+                if (frame_number_ % 30 == 0)
+                    drawClock(frame);
+                break;
+
+            case Scenario::REPLAY:
+                break;
+        }
+    }
+
+private:
+    quint32 random()
+    {
+        seed_ = seed_ * 1103515245 + 12345;
+        return seed_ >> 16;
+    }
+
+    void fillRect(DesktopFrame* frame, const QRect& rect, quint32 color)
+    {
+        const QRect fill_rect = rect.intersected(QRect(QPoint(), frame->size()));
+
+        for (int y = fill_rect.top(); y <= fill_rect.bottom(); ++y)
+        {
+            quint32* row = reinterpret_cast<quint32*>(frame->frameDataAtPos(fill_rect.left(), y));
+
+            for (int x = 0; x < fill_rect.width(); ++x)
+                row[x] = color;
+        }
+    }
+
+    void drawGlyph(DesktopFrame* frame, int x, int y)
+    {
+        fillRect(frame, QRect(x, y, kGlyphWidth, kLineHeight), kPaperColor);
+
+        const quint32 shape = random() | (random() << 16);
+
+        // The glyph is a random pattern of the strokes with the antialiased edges.
+        for (int row = 0; row < kGlyphHeight; ++row)
+        {
+            quint32* pixels = reinterpret_cast<quint32*>(
+                frame->frameDataAtPos(x, y + kLineHeight - kGlyphHeight - 2 + row));
+
+            for (int column = 1; column < kGlyphWidth - 1; ++column)
+            {
+                const int bit = (row / 3) * 8 + column;
+
+                if (shape & (1u << (bit % 32)))
+                    pixels[column] = (column == 1 || column == kGlyphWidth - 2) ?
+                        0xFF909090 : kInkColor;
+            }
+        }
+    }
+
+    void drawTextLine(DesktopFrame* frame, int y)
+    {
+        // Some lines are empty, as between the paragraphs.
+        if (random() % 6 == 0)
+            return;
+
+        const int length = page_rect_.width() * static_cast<int>(random() % 50 + 50) / 100;
+        int x = page_rect_.left();
+
+        while (x + kGlyphWidth <= page_rect_.left() + length)
+        {
+            const int word_length = static_cast<int>(random() % 8) + 2;
+
+            for (int i = 0; i < word_length && x + kGlyphWidth <= page_rect_.right(); ++i)
+            {
+                drawGlyph(frame, x, y);
+                x += kGlyphWidth;
+            }
+
+            x += kGlyphWidth;
+        }
+    }
+
+    void typeCharacter(DesktopFrame* frame)
+    {
+        // A character is typed every fourth frame (about 8 characters per second at 30 frames
+        // per second).
+        if (frame_number_ % 4 == 0)
+        {
+            if (random() % 6 == 0)
+                fillRect(frame, QRect(cursor_, QSize(kGlyphWidth, kLineHeight)), kPaperColor);
+            else
+                drawGlyph(frame, cursor_.x(), cursor_.y());
+
+            cursor_.rx() += kGlyphWidth;
+
+            if (cursor_.x() + kGlyphWidth > page_rect_.right())
+            {
+                cursor_.setX(page_rect_.left());
+                cursor_.ry() += kLineHeight;
+
+                if (cursor_.y() + kLineHeight > page_rect_.bottom())
+                    cursor_.setY(page_rect_.top());
+
+                fillRect(frame, QRect(page_rect_.left(), cursor_.y(),
+                                      page_rect_.width(), kLineHeight), kPaperColor);
+            }
+        }
+
+        // The caret blinks twice a second.
+        const bool caret_visible = (frame_number_ / 15) % 2 == 0;
+
+        fillRect(frame, QRect(cursor_.x(), cursor_.y() + 2, 2, kLineHeight - 4),
+                 caret_visible ? kInkColor : kPaperColor);
+    }
+
+    void scrollPage(DesktopFrame* frame)
+    {
+        const int row_size = page_rect_.width() * frame->format().bytesPerPixel();
+
+        for (int y = page_rect_.top(); y + kLineHeight <= page_rect_.bottom(); ++y)
+        {
+            memmove(frame->frameDataAtPos(page_rect_.left(), y),
+                    frame->frameDataAtPos(page_rect_.left(), y + kLineHeight),
+                    row_size);
+        }
+
+        const int last_line = page_rect_.bottom() + 1 - kLineHeight;
+
+        fillRect(frame, QRect(page_rect_.left(), last_line, page_rect_.width(), kLineHeight),
+                 kPaperColor);
+        drawTextLine(frame, last_line);
+    }
+
+    void drawVideo(DesktopFrame* frame)
+    {
+        const QRect video_rect =
+            QRect(QPoint((frame->size().width() - kVideoWidth) / 2,
+                         (frame->size().height() - kVideoHeight) / 2),
+                  QSize(kVideoWidth, kVideoHeight)).intersected(QRect(QPoint(), frame->size()));
+
+        const int t = frame_number_;
+
+        // The smooth moving gradients with a weak noise, as in the natural video.
+        for (int y = video_rect.top(); y <= video_rect.bottom(); ++y)
+        {
+            quint32* row = reinterpret_cast<quint32*>(frame->frameDataAtPos(video_rect.left(), y));
+
+            for (int x = 0; x < video_rect.width(); ++x)
+            {
+                const quint32 noise = random() & 0x0F;
+                const quint32 red = ((x + t * 3) / 2 + noise) & 0xFF;
+                const quint32 green = ((y + t * 2) / 2 + noise) & 0xFF;
+                const quint32 blue = ((x + y + t * 5) / 4 + noise) & 0xFF;
+
+                row[x] = 0xFF000000 | (red << 16) | (green << 8) | blue;
+            }
+        }
+    }
+
+    void drawClock(DesktopFrame* frame)
+    {
+        const int y = page_rect_.bottom() + 1 + (kMargin - kLineHeight) / 2;
+        int x = page_rect_.right() + 1 - kGlyphWidth * 5;
+
+        for (int i = 0; i < 5; ++i, x += kGlyphWidth)
+            drawGlyph(frame, x, y);
+    }
+
+    const Scenario scenario_;
+    const QRect page_rect_;
+
+    quint32 seed_ = 1;
+    int frame_number_ = 0;
+    QPoint cursor_;
+
+    Q_DISABLE_COPY(FrameGenerator)
+};
+
+void addSquaredError(const DesktopFrame* source, const DesktopFrame* decoded, Statistics* stats)
+{
+    for (int y = 0; y < source->size().height(); ++y)
+    {
+        const quint8* source_row = source->frameDataAtPos(0, y);
+        const quint8* decoded_row = decoded->frameDataAtPos(0, y);
+
+        quint64 row_error = 0;
+
+        for (int x = 0; x < source->size().width() * 4; x += 4)
+        {
+            // The alpha channel is not compared.
+            for (int channel = 0; channel < 3; ++channel)
+            {
+                const int difference = source_row[x + channel] - decoded_row[x + channel];
+                row_error += difference * difference;
+            }
+        }
+
+        stats->squared_error += static_cast<double>(row_error);
+    }
+
+    stats->compared_samples += source->size().width() * source->size().height() * 3;
+}
+
+void copyFrame(const DesktopFrame* source, DesktopFrame* target)
+{
+    for (int y = 0; y < source->size().height(); ++y)
+    {
+        memcpy(target->frameDataAtPos(0, y), source->frameDataAtPos(0, y),
+               source->size().width() * source->format().bytesPerPixel());
+    }
+}
+
+bool runBenchmark(const BenchConfig& config,
+                  Scenario scenario,
+                  const QString& replay_file,
+                  int frame_count,
+                  Statistics* stats)
+{
+    std::unique_ptr<CapturerReplay> replay;
+    const DesktopFrame* replay_frame = nullptr;
+
+    if (scenario == Scenario::REPLAY)
+    {
+        replay = CapturerReplay::create(replay_file, CapturerReplay::Speed::MAXIMUM);
+        if (!replay)
+            return false;
+
+        replay_frame = replay->captureImage();
+        if (!replay_frame)
+            return false;
+
+        stats->screen_size = replay_frame->size();
+    }
+
+    const QSize screen_size = stats->screen_size;
+
+    std::unique_ptr<VideoEncoder> encoder = createEncoder(config);
+    std::unique_ptr<VideoDecoder> decoder = VideoDecoder::create(config.encoding);
+    if (!encoder || !decoder)
+    {
+        qWarning("Unable to create the codec");
+        return false;
+    }
+
+    std::unique_ptr<DesktopFrame> frames[2] =
+    {
+        DesktopFrameAligned::create(screen_size, PixelFormat::ARGB()),
+        DesktopFrameAligned::create(screen_size, PixelFormat::ARGB())
+    };
+
+    // The client decodes to the 32-bit frame regardless of the pixel format of the encoder.
+    std::unique_ptr<DesktopFrame> decoded_frame =
+        DesktopFrameAligned::create(screen_size, PixelFormat::ARGB());
+
+    if (!frames[0] || !frames[1] || !decoded_frame)
+    {
+        qWarning("Unable to create the frames");
+        return false;
+    }
+
+    const size_t frame_size = frames[0]->stride() * screen_size.height();
+
+    Differ differ(screen_size);
+    FrameGenerator generator(scenario, screen_size);
+
+    proto::desktop::VideoPacket packet;
+    QByteArray buffer;
+    QElapsedTimer timer;
+
+    for (int i = 0; i < frame_count; ++i)
+    {
+        DesktopFrame* prev_frame = frames[(i + 1) % 2].get();
+        DesktopFrame* curr_frame = frames[i % 2].get();
+
+        if (i == 0)
+        {
+            if (replay)
+                copyFrame(replay_frame, curr_frame);
+            else
+                generator.firstFrame(curr_frame);
+
+            *curr_frame->mutableUpdatedRegion() = QRect(QPoint(), screen_size);
+        }
+        else
+        {
+            if (replay)
+            {
+                // The recording is replayed from the start after the last frame.
+                replay_frame = replay->captureImage();
+                if (!replay_frame || replay_frame->size() != screen_size)
+                    break;
+
+                copyFrame(replay_frame, curr_frame);
+            }
+            else
+            {
+                memcpy(curr_frame->frameData(), prev_frame->frameData(), frame_size);
+                generator.nextFrame(curr_frame);
+            }
+
+            timer.start();
+            differ.calcDirtyRegion(prev_frame->frameData(),
+                                   curr_frame->frameData(),
+                                   curr_frame->mutableUpdatedRegion());
+            stats->diff_time += timer.nsecsElapsed();
+        }
+
+        ++stats->frames;
+
+        // The screen updater does not encode the frames without changes either.
+        if (curr_frame->updatedRegion().isEmpty() && !encoder->isTopOffPending())
+            continue;
+
+        for (const auto& rect : curr_frame->updatedRegion())
+            stats->raw_bytes += rect.width() * rect.height() * 4;
+
+        timer.start();
+        if (!encoder->encode(curr_frame, &packet))
+        {
+            qWarning("Unable to encode the frame");
+            return false;
+        }
+        stats->encode_time += timer.nsecsElapsed();
+
+        timer.start();
+        if (!serializeMessageTo(packet, 0, &buffer))
+            return false;
+        stats->serialize_time += timer.nsecsElapsed();
+
+        stats->encoded_bytes += buffer.size();
+
+        timer.start();
+        if (!decoder->decode(packet, decoded_frame.get()))
+        {
+            qWarning("Unable to decode the frame");
+            return false;
+        }
+        stats->decode_time += timer.nsecsElapsed();
+
+        ++stats->encoded_frames;
+
+        addSquaredError(curr_frame, decoded_frame.get(), stats);
+    }
+
+    return true;
+}
+
+void printHeader(QTextStream& out)
+{
+    out << qSetFieldWidth(10) << left << "scenario" << "encoding" << "format"
+        << qSetFieldWidth(6) << "ratio"
+        << qSetFieldWidth(10) << right << "diff_ms" << "encode_ms" << "serial_ms" << "decode_ms"
+        << qSetFieldWidth(12) << "bytes/frame" << qSetFieldWidth(8) << "x_comp"
+        << qSetFieldWidth(9) << "psnr_db" << "fps" << "mpix/s"
+        << qSetFieldWidth(0) << endl;
+}
+
+void printResult(QTextStream& out,
+                 const char* scenario_name,
+                 const BenchConfig& config,
+                 const Statistics& stats)
+{
+    const QSize& screen_size = stats.screen_size;
+
+    const double frames = qMax(stats.frames, 1);
+    const double encoded_frames = qMax(stats.encoded_frames, 1);
+
+    const double diff_ms = stats.diff_time / frames / 1000000.0;
+    const double encode_ms = stats.encode_time / encoded_frames / 1000000.0;
+    const double serialize_ms = stats.serialize_time / encoded_frames / 1000000.0;
+    const double decode_ms = stats.decode_time / encoded_frames / 1000000.0;
+
+    // All stages of the sequence against its length.
+    const double total_seconds = (stats.diff_time + stats.encode_time +
+                                  stats.serialize_time + stats.decode_time) / 1000000000.0;
+    const double fps = total_seconds > 0 ? stats.frames / total_seconds : 0;
+    const double mpix = fps * screen_size.width() * screen_size.height() / 1000000.0;
+
+    const double compression =
+        stats.encoded_bytes > 0 ? static_cast<double>(stats.raw_bytes) / stats.encoded_bytes : 0;
+
+    QString psnr = QStringLiteral("inf");
+    if (stats.compared_samples > 0 && stats.squared_error > 0)
+    {
+        const double mse = stats.squared_error / stats.compared_samples;
+        psnr = QString::number(10.0 * std::log10(255.0 * 255.0 / mse), 'f', 2);
+    }
+
+    out << qSetFieldWidth(10) << left << scenario_name << config.encoding_name;
+
+    if (hasPixelFormat(config.encoding))
+        out << config.pixel_format_name << qSetFieldWidth(6) << config.compress_ratio;
+    else
+        out << "-" << qSetFieldWidth(6) << "-";
+
+    out << qSetFieldWidth(10) << right << fixed << qSetRealNumberPrecision(3)
+        << diff_ms << encode_ms << serialize_ms << decode_ms
+        << qSetFieldWidth(12) << stats.encoded_bytes / qMax(stats.frames, 1)
+        << qSetFieldWidth(8) << qSetRealNumberPrecision(1) << compression
+        << qSetFieldWidth(9) << psnr << fps << mpix
+        << qSetFieldWidth(0) << endl;
+}
+
+} // namespace
+
+int codecBenchMain(int argc, char *argv[])
+{
+    QCoreApplication application(argc, argv);
+    application.setOrganizationName(QStringLiteral("Aspia"));
+    application.setApplicationName(QStringLiteral("Codec Bench"));
+    application.setApplicationVersion(QStringLiteral(ASPIA_VERSION_STRING));
+
+    QCommandLineOption width_option(QStringLiteral("width"),
+                                    QStringLiteral("Width of the screen."),
+                                    QStringLiteral("width"),
+                                    QStringLiteral("1920"));
+    QCommandLineOption height_option(QStringLiteral("height"),
+                                     QStringLiteral("Height of the screen."),
+                                     QStringLiteral("height"),
+                                     QStringLiteral("1080"));
+    QCommandLineOption frames_option(QStringLiteral("frames"),
+                                     QStringLiteral("Number of the frames of each scenario."),
+                                     QStringLiteral("frames"),
+                                     QString::number(kDefaultFrameCount));
+    QCommandLineOption scenario_option(QStringLiteral("scenario"),
+                                       QStringLiteral("typing, scrolling, video or idle."),
+                                       QStringLiteral("scenario"));
+    QCommandLineOption encoding_option(QStringLiteral("encoding"),
+                                       QStringLiteral("zlib, lz4, zstd, vp8, vp9, vp9_lossy "
+                                                      "or hybrid."),
+                                       QStringLiteral("encoding"));
+    QCommandLineOption format_option(QStringLiteral("pixel_format"),
+                                     QStringLiteral("argb, rgb565, rgb332, rgb222 or rgb111."),
+                                     QStringLiteral("pixel_format"));
+    QCommandLineOption ratio_option(QStringLiteral("compress_ratio"),
+                                    QStringLiteral("Compression ratio of the raw pixels."),
+                                    QStringLiteral("compress_ratio"));
+    QCommandLineOption replay_option(QStringLiteral("replay"),
+                                     QStringLiteral("The recording of the screen which is "
+                                                    "measured instead of the scenarios."),
+                                     QStringLiteral("file"));
+    QCommandLineOption disable_option(QStringLiteral("disable_simd"),
+                                      QStringLiteral("The instruction sets which the kernels "
+                                                     "do not use: sse2, ssse3, sse42, avx2, "
+                                                     "avx512, neon or all."),
+                                      QStringLiteral("sets"));
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(
+        QStringLiteral("Measures the differ, the encoders and the decoders on the synthetic "
+                       "desktop sequences. Without options all combinations are measured."));
+    parser.addHelpOption();
+    parser.addOption(width_option);
+    parser.addOption(height_option);
+    parser.addOption(frames_option);
+    parser.addOption(scenario_option);
+    parser.addOption(encoding_option);
+    parser.addOption(format_option);
+    parser.addOption(ratio_option);
+    parser.addOption(replay_option);
+    parser.addOption(disable_option);
+    parser.process(application);
+
+    if (!CpuDispatch::setOverride(parser.value(disable_option)))
+        return 1;
+
+    const QSize screen_size(parser.value(width_option).toInt(),
+                            parser.value(height_option).toInt());
+    const int frame_count = parser.value(frames_option).toInt();
+
+    if (screen_size.width() < kVideoWidth || screen_size.height() < kVideoHeight ||
+        frame_count <= 0)
+    {
+        qWarning("Invalid screen size or number of frames");
+        return 1;
+    }
+
+    std::vector<int> compress_ratios;
+    if (parser.isSet(ratio_option))
+        compress_ratios.push_back(parser.value(ratio_option).toInt());
+    else
+        compress_ratios = { 1, kDefaultCompressRatio, 9 };
+
+    std::vector<BenchConfig> configs;
+
+    for (const auto& encoding : kEncodings)
+    {
+        if (parser.isSet(encoding_option) && parser.value(encoding_option) != encoding.name)
+            continue;
+
+        if (!hasPixelFormat(encoding.encoding))
+        {
+            configs.push_back(
+                { encoding.encoding, encoding.name, PixelFormat::ARGB(), "-", 0 });
+            continue;
+        }
+
+        for (const auto& format : kPixelFormats)
+        {
+            if (parser.isSet(format_option) && parser.value(format_option) != format.name)
+                continue;
+
+            for (int compress_ratio : compress_ratios)
+            {
+                configs.push_back(
+                    { encoding.encoding, encoding.name, format.format(), format.name,
+                      compress_ratio });
+            }
+        }
+    }
+
+    if (configs.empty())
+    {
+        qWarning("Unknown encoding or pixel format");
+        return 1;
+    }
+
+    QTextStream out(stdout);
+
+    out << "Screen " << screen_size.width() << "x" << screen_size.height() << ", "
+        << frame_count << " frames per scenario" << endl << endl;
+
+    printHeader(out);
+
+    bool found_scenario = false;
+
+    for (const auto& scenario : kScenarios)
+    {
+        if (parser.isSet(replay_option) ||
+            (parser.isSet(scenario_option) && parser.value(scenario_option) != scenario.name))
+        {
+            continue;
+        }
+
+        found_scenario = true;
+
+        for (const auto& config : configs)
+        {
+            Statistics stats;
+            stats.screen_size = screen_size;
+
+            if (!runBenchmark(config, scenario.scenario, QString(), frame_count, &stats))
+                return 1;
+
+            printResult(out, scenario.name, config, stats);
+        }
+    }
+
+    if (parser.isSet(replay_option))
+    {
+        found_scenario = true;
+
+        for (const auto& config : configs)
+        {
+            Statistics stats;
+
+            if (!runBenchmark(config, Scenario::REPLAY, parser.value(replay_option),
+                              frame_count, &stats))
+            {
+                return 1;
+            }
+
+            printResult(out, "replay", config, stats);
+        }
+    }
+
+    if (!found_scenario)
+    {
+        qWarning("Unknown scenario");
+        return 1;
+    }
+
+    return 0;
+}
+
+} // namespace aspia
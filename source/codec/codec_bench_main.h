@@ -0,0 +1,19 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/codec_bench_main.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CODEC__CODEC_BENCH_MAIN_H
+#define _ASPIA_CODEC__CODEC_BENCH_MAIN_H
+
+#include "core_export.h"
+
+namespace aspia {
+
+int CORE_EXPORT codecBenchMain(int argc, char *argv[]);
+
+} // namespace aspia
+
+#endif // _ASPIA_CODEC__CODEC_BENCH_MAIN_H
@@ -0,0 +1,36 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/compressor.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "codec/compressor.h"
+
+#include "codec/compressor_lz4.h"
+#include "codec/compressor_zlib.h"
+#include "codec/compressor_zstd.h"
+
+namespace aspia {
+
+// static
+std::unique_ptr<Compressor> Compressor::create(proto::desktop::Compression compression,
+                                               int compress_ratio)
+{
+    switch (compression)
+    {
+        case proto::desktop::COMPRESSION_ZLIB:
+            return std::make_unique<CompressorZLIB>(compress_ratio);
+
+        case proto::desktop::COMPRESSION_LZ4:
+            return std::make_unique<CompressorLZ4>();
+
+        case proto::desktop::COMPRESSION_ZSTD:
+            return std::make_unique<CompressorZstd>(compress_ratio);
+
+        default:
+            return nullptr;
+    }
+}
+
+} // namespace aspia
@@ -8,6 +8,10 @@
 #ifndef _ASPIA_CODEC__COMPRESSOR_H
 #define _ASPIA_CODEC__COMPRESSOR_H
 
+#include <memory>
+
+#include "protocol/desktop_session.pb.h"
+
 namespace aspia {
 
 //
@@ -30,12 +34,22 @@ public:
 
     virtual ~Compressor() = default;
 
+    // Returns nullptr if |compression| is not supported. |compress_ratio| is ignored by LZ4.
+    static std::unique_ptr<Compressor> create(proto::desktop::Compression compression,
+                                              int compress_ratio);
+
     //
     // Resets all the internal state so the compressor behaves as if it
     // was just created.
     //
     virtual void reset() = 0;
 
+    //
+    // Changes the ratio for the following data. The stream is continued, so the method must
+    // be called after a flush or a reset. The compressors without the levels ignore it.
+    //
+    virtual void setCompressRatio(int /* compress_ratio */) {}
+
     //
     // Compress |input_data| with |input_size| bytes.
     //
@@ -0,0 +1,148 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/compressor_lz4.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "codec/compressor_lz4.h"
+
+#include <QDebug>
+
+namespace aspia {
+
+namespace {
+
+// The input is compressed by parts of this size to limit the size of the internal buffer.
+constexpr size_t kMaxInputSize = 64 * 1024;
+
+} // namespace
+
+CompressorLZ4::CompressorLZ4()
+{
+    memset(&preferences_, 0, sizeof(preferences_));
+
+    preferences_.frameInfo.blockSizeID = LZ4F_max64KB;
+    preferences_.frameInfo.blockMode = LZ4F_blockLinked;
+
+    LZ4F_errorCode_t ret = LZ4F_createCompressionContext(&context_, LZ4F_VERSION);
+    Q_ASSERT(!LZ4F_isError(ret));
+}
+
+CompressorLZ4::~CompressorLZ4()
+{
+    LZ4F_freeCompressionContext(context_);
+}
+
+void CompressorLZ4::reset()
+{
+    // The context is reset by the beginning of the next frame.
+    buffer_.clear();
+    buffer_pos_ = 0;
+    started_ = false;
+    finished_ = false;
+}
+
+void CompressorLZ4::writeBuffer(quint8* output_data, size_t output_size, size_t* written)
+{
+    const size_t size = qMin(buffer_.size() - buffer_pos_, output_size - *written);
+
+    memcpy(output_data + *written, buffer_.data() + buffer_pos_, size);
+
+    buffer_pos_ += size;
+    *written += size;
+}
+
+bool CompressorLZ4::process(const quint8* input_data,
+                            size_t input_size,
+                            quint8* output_data,
+                            size_t output_size,
+                            CompressorFlush flush,
+                            size_t* consumed,
+                            size_t* written)
+{
+    Q_ASSERT(output_size != 0);
+
+    *consumed = 0;
+    *written = 0;
+
+    writeBuffer(output_data, output_size, written);
+
+    if (!started_)
+    {
+        buffer_.resize(LZ4F_HEADER_SIZE_MAX);
+
+        size_t ret = LZ4F_compressBegin(context_, buffer_.data(), buffer_.size(), &preferences_);
+        if (LZ4F_isError(ret))
+        {
+            qWarning() << "LZ4F_compressBegin failed: " << LZ4F_getErrorName(ret);
+            return false;
+        }
+
+        buffer_.resize(ret);
+        buffer_pos_ = 0;
+        started_ = true;
+
+        writeBuffer(output_data, output_size, written);
+    }
+
+    while (!hasBufferedData() && *consumed < input_size)
+    {
+        const size_t size = qMin(input_size - *consumed, kMaxInputSize);
+
+        buffer_.resize(LZ4F_compressBound(size, &preferences_));
+
+        size_t ret = LZ4F_compressUpdate(context_,
+                                         buffer_.data(), buffer_.size(),
+                                         input_data + *consumed, size,
+                                         nullptr);
+        if (LZ4F_isError(ret))
+        {
+            qWarning() << "LZ4F_compressUpdate failed: " << LZ4F_getErrorName(ret);
+            return false;
+        }
+
+        buffer_.resize(ret);
+        buffer_pos_ = 0;
+        *consumed += size;
+
+        writeBuffer(output_data, output_size, written);
+    }
+
+    if (!hasBufferedData() && *consumed == input_size && !finished_ &&
+        flush != CompressorNoFlush)
+    {
+        buffer_.resize(LZ4F_compressBound(0, &preferences_));
+
+        size_t ret;
+
+        if (flush == CompressorFinish)
+        {
+            ret = LZ4F_compressEnd(context_, buffer_.data(), buffer_.size(), nullptr);
+            finished_ = true;
+        }
+        else
+        {
+            ret = LZ4F_flush(context_, buffer_.data(), buffer_.size(), nullptr);
+        }
+
+        if (LZ4F_isError(ret))
+        {
+            qWarning() << "LZ4 flush failed: " << LZ4F_getErrorName(ret);
+            return false;
+        }
+
+        buffer_.resize(ret);
+        buffer_pos_ = 0;
+
+        writeBuffer(output_data, output_size, written);
+    }
+
+    // Like ZLIB, the compressor must be called again until the flushed data is written.
+    if (flush == CompressorSyncFlush)
+        return hasBufferedData() || *consumed < input_size;
+
+    return !finished_ || hasBufferedData();
+}
+
+} // namespace aspia
@@ -0,0 +1,56 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/compressor_lz4.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CODEC__COMPRESSOR_LZ4_H
+#define _ASPIA_CODEC__COMPRESSOR_LZ4_H
+
+#include <lz4frame.h>
+
+#include <vector>
+
+#include "codec/compressor.h"
+
+namespace aspia {
+
+// Produces the LZ4 frame format. The compressed blocks are written to the internal buffer
+// first, because LZ4 requires the output buffer of the worst case size.
+class CompressorLZ4 : public Compressor
+{
+public:
+    CompressorLZ4();
+    ~CompressorLZ4();
+
+    bool process(const quint8* input_data,
+                 size_t input_size,
+                 quint8* output_data,
+                 size_t output_size,
+                 CompressorFlush flush,
+                 size_t* consumed,
+                 size_t* written) override;
+
+    void reset() override;
+
+private:
+    // Copies the pending data of the internal buffer to the output.
+    void writeBuffer(quint8* output_data, size_t output_size, size_t* written);
+    bool hasBufferedData() const { return buffer_pos_ < buffer_.size(); }
+
+    LZ4F_cctx* context_ = nullptr;
+    LZ4F_preferences_t preferences_;
+
+    std::vector<quint8> buffer_;
+    size_t buffer_pos_ = 0;
+
+    bool started_ = false;
+    bool finished_ = false;
+
+    Q_DISABLE_COPY(CompressorLZ4)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_CODEC__COMPRESSOR_LZ4_H
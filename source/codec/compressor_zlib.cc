@@ -34,6 +34,30 @@ void CompressorZLIB::reset()
 {
     int ret = zng_deflateReset(&stream_);
     Q_ASSERT(ret == Z_OK);
+
+    if (pending_ratio_ != -1)
+    {
+        ret = zng_deflateParams(&stream_, pending_ratio_, Z_DEFAULT_STRATEGY);
+        Q_ASSERT(ret == Z_OK);
+
+        pending_ratio_ = -1;
+    }
+}
+
+void CompressorZLIB::setCompressRatio(int compress_ratio)
+{
+    // After the flush there is no pending data, so the parameters are changed without the
+    // output.
+    quint8 output;
+
+    stream_.avail_in  = 0;
+    stream_.avail_out = 0;
+    stream_.next_out  = &output;
+
+    int ret = zng_deflateParams(&stream_, compress_ratio, Z_DEFAULT_STRATEGY);
+
+    // The finished stream can not be changed until it is reset.
+    pending_ratio_ = (ret == Z_OK) ? -1 : compress_ratio;
 }
 
 bool CompressorZLIB::process(const quint8* input_data,
@@ -29,10 +29,14 @@ public:
                  size_t* written) override;
 
     void reset() override;
+    void setCompressRatio(int compress_ratio) override;
 
 private:
     zng_stream stream_;
 
+    // The ratio which is set by the next reset or -1.
+    int pending_ratio_ = -1;
+
     Q_DISABLE_COPY(CompressorZLIB)
 };
 
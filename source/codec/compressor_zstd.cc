@@ -0,0 +1,96 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/compressor_zstd.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "codec/compressor_zstd.h"
+
+#include <QDebug>
+
+namespace aspia {
+
+CompressorZstd::CompressorZstd(int compress_ratio)
+    : stream_(ZSTD_createCCtx())
+{
+    Q_ASSERT(stream_);
+
+    size_t ret = ZSTD_CCtx_setParameter(stream_, ZSTD_c_compressionLevel, compress_ratio);
+    Q_ASSERT(!ZSTD_isError(ret));
+}
+
+CompressorZstd::~CompressorZstd()
+{
+    ZSTD_freeCCtx(stream_);
+}
+
+void CompressorZstd::reset()
+{
+    size_t ret = ZSTD_CCtx_reset(stream_, ZSTD_reset_session_only);
+    Q_ASSERT(!ZSTD_isError(ret));
+}
+
+void CompressorZstd::setCompressRatio(int compress_ratio)
+{
+    // The level may be changed inside the frame. It takes effect with the next frame of the
+    // stream.
+    size_t ret = ZSTD_CCtx_setParameter(stream_, ZSTD_c_compressionLevel, compress_ratio);
+    if (ZSTD_isError(ret))
+        qWarning() << "Unable to change zstd level: " << ZSTD_getErrorName(ret);
+}
+
+bool CompressorZstd::process(const quint8* input_data,
+                             size_t input_size,
+                             quint8* output_data,
+                             size_t output_size,
+                             CompressorFlush flush,
+                             size_t* consumed,
+                             size_t* written)
+{
+    Q_ASSERT(output_size != 0);
+
+    ZSTD_inBuffer input = { input_data, input_size, 0 };
+    ZSTD_outBuffer output = { output_data, output_size, 0 };
+
+    ZSTD_EndDirective mode = ZSTD_e_continue;
+
+    switch (flush)
+    {
+        case CompressorSyncFlush:
+            mode = ZSTD_e_flush;
+            break;
+
+        case CompressorFinish:
+            mode = ZSTD_e_end;
+            break;
+
+        case CompressorNoFlush:
+            mode = ZSTD_e_continue;
+            break;
+
+        default:
+            qWarning("Unsupported flush mode");
+            break;
+    }
+
+    size_t ret = ZSTD_compressStream2(stream_, &output, &input, mode);
+
+    *consumed = input.pos;
+    *written = output.pos;
+
+    if (ZSTD_isError(ret))
+    {
+        qWarning() << "zstd compression failed: " << ZSTD_getErrorName(ret);
+        return false;
+    }
+
+    // For the flush and the end of the stream |ret| is the number of bytes which are not
+    // flushed yet.
+    if (flush != CompressorNoFlush)
+        return ret != 0;
+
+    return true;
+}
+
+} // namespace aspia
@@ -0,0 +1,42 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/compressor_zstd.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CODEC__COMPRESSOR_ZSTD_H
+#define _ASPIA_CODEC__COMPRESSOR_ZSTD_H
+
+#include <zstd.h>
+
+#include "codec/compressor.h"
+
+namespace aspia {
+
+class CompressorZstd : public Compressor
+{
+public:
+    explicit CompressorZstd(int compress_ratio);
+    ~CompressorZstd();
+
+    bool process(const quint8* input_data,
+                 size_t input_size,
+                 quint8* output_data,
+                 size_t output_size,
+                 CompressorFlush flush,
+                 size_t* consumed,
+                 size_t* written) override;
+
+    void reset() override;
+    void setCompressRatio(int compress_ratio) override;
+
+private:
+    ZSTD_CCtx* stream_;
+
+    Q_DISABLE_COPY(CompressorZstd)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_CODEC__COMPRESSOR_ZSTD_H
@@ -14,6 +14,18 @@ namespace aspia {
 bool CursorDecoder::decompressCursor(const proto::desktop::CursorShape& cursor_shape,
                                      quint8* image)
 {
+    if (!decompressor_ || compression_ != cursor_shape.compression())
+    {
+        decompressor_ = Decompressor::create(cursor_shape.compression());
+        if (!decompressor_)
+        {
+            qWarning() << "Unsupported cursor compression: " << cursor_shape.compression();
+            return false;
+        }
+
+        compression_ = cursor_shape.compression();
+    }
+
     const quint8* src = reinterpret_cast<const quint8*>(cursor_shape.data().data());
     const size_t src_size = cursor_shape.data().size();
     const size_t row_size = cursor_shape.width() * sizeof(quint32);
@@ -36,7 +48,7 @@ bool CursorDecoder::decompressCursor(const proto::desktop::CursorShape& cursor_s
         size_t written = 0;
         size_t consumed = 0;
 
-        decompress_again = decompressor_.process(src + used,
+        decompress_again = decompressor_->process(src + used,
                                                  src_size - used,
                                                  image + row_pos,
                                                  row_size - row_pos,
@@ -53,7 +65,7 @@ bool CursorDecoder::decompressCursor(const proto::desktop::CursorShape& cursor_s
         }
     }
 
-    decompressor_.reset();
+    decompressor_->reset();
     return true;
 }
 
@@ -63,8 +75,16 @@ std::shared_ptr<MouseCursor> CursorDecoder::decode(const proto::desktop::CursorS
 
     if (cursor_shape.flags() & proto::desktop::CursorShape::CACHE)
     {
-        // Bits 0-4 contain the cursor position in the cache.
-        cache_index = cursor_shape.flags() & 0x1F;
+        // Bits 0-4 contain the cursor position in the cache. The large cache uses the
+        // separate field.
+        cache_index = cursor_shape.cache_index() ?
+            cursor_shape.cache_index() : (cursor_shape.flags() & 0x1F);
+
+        if (!cache_)
+        {
+            qWarning("Host did not send cache reset command");
+            return nullptr;
+        }
     }
     else
     {
@@ -91,7 +111,8 @@ std::shared_ptr<MouseCursor> CursorDecoder::decode(const proto::desktop::CursorS
 
         if (cursor_shape.flags() & proto::desktop::CursorShape::RESET_CACHE)
         {
-            size_t cache_size = cursor_shape.flags() & 0x1F;
+            size_t cache_size = cursor_shape.cache_size() ?
+                cursor_shape.cache_size() : (cursor_shape.flags() & 0x1F);
 
             if (!MouseCursorCache::isValidCacheSize(cache_size))
                 return nullptr;
@@ -8,7 +8,7 @@
 #ifndef _ASPIA_CODEC__CURSOR_DECODER_H
 #define _ASPIA_CODEC__CURSOR_DECODER_H
 
-#include "codec/decompressor_zlib.h"
+#include "codec/decompressor.h"
 #include "desktop_capture/mouse_cursor_cache.h"
 #include "protocol/desktop_session.pb.h"
 
@@ -22,11 +22,19 @@ public:
 
     std::shared_ptr<MouseCursor> decode(const proto::desktop::CursorShape& cursor_shape);
 
+    // The cache is kept by the client between the sessions with the same host.
+    const MouseCursorCache* cache() const { return cache_.get(); }
+    std::unique_ptr<MouseCursorCache> takeCache() { return std::move(cache_); }
+    void setCache(std::unique_ptr<MouseCursorCache> cache) { cache_ = std::move(cache); }
+
 private:
     bool decompressCursor(const proto::desktop::CursorShape& cursor_shape, quint8* image);
 
     std::unique_ptr<MouseCursorCache> cache_;
-    DecompressorZLIB decompressor_;
+
+    // The decompressor is created again if the compression of the cursor shapes changes.
+    proto::desktop::Compression compression_ = proto::desktop::COMPRESSION_ZLIB;
+    std::unique_ptr<Decompressor> decompressor_;
 
     Q_DISABLE_COPY(CursorDecoder)
 };
@@ -16,6 +16,9 @@ namespace {
 // Cache size can be in the range from 2 to 31.
 constexpr quint8 kCacheSize = 16;
 
+// Cache size used with FEATURE_CURSOR_CACHE.
+constexpr size_t kLargeCacheSize = 256;
+
 // The compression ratio can be in the range of 1 to 9.
 constexpr int kCompressionRatio = 6;
 
@@ -27,9 +30,11 @@ quint8* getOutputBuffer(proto::desktop::CursorShape* cursor_shape, size_t size)
 
 } // namespace
 
-CursorEncoder::CursorEncoder()
-    : compressor_(kCompressionRatio),
-      cache_(kCacheSize)
+CursorEncoder::CursorEncoder(proto::desktop::Compression compression, bool large_cache)
+    : compression_(compression),
+      large_cache_(large_cache),
+      compressor_(Compressor::create(compression, kCompressionRatio)),
+      cache_(large_cache ? kLargeCacheSize : kCacheSize)
 {
     static_assert(kCacheSize >= 2 && kCacheSize <= 31);
     static_assert(kCompressionRatio >= 1 && kCompressionRatio <= 9);
@@ -38,7 +43,7 @@ CursorEncoder::CursorEncoder()
 void CursorEncoder::compressCursor(proto::desktop::CursorShape* cursor_shape,
                                    const MouseCursor* mouse_cursor)
 {
-    compressor_.reset();
+    compressor_->reset();
 
     int width = mouse_cursor->size().width();
     int height = mouse_cursor->size().height();
@@ -67,7 +72,7 @@ void CursorEncoder::compressCursor(proto::desktop::CursorShape* cursor_shape,
         size_t consumed = 0;
         size_t written = 0;
 
-        compress_again = compressor_.process(
+        compress_again = compressor_->process(
             source_pos + row_pos, row_size - row_pos,
             compressed_pos + filled, packet_size - filled,
             flush, &consumed, &written);
@@ -122,16 +127,33 @@ std::unique_ptr<proto::desktop::CursorShape> CursorEncoder::encode(
         cursor_shape->set_hotspot_x(mouse_cursor->hotSpot().x());
         cursor_shape->set_hotspot_y(mouse_cursor->hotSpot().y());
 
+        cursor_shape->set_compression(compression_);
         compressCursor(cursor_shape.get(), mouse_cursor.get());
 
         // If the cache is empty, then set the cache reset flag on the client
         // side and pass the maximum cache size.
-        cursor_shape->set_flags(cache_.isEmpty() ?
-            (proto::desktop::CursorShape::RESET_CACHE | (kCacheSize & 0x1F)) : 0);
+        if (cache_.isEmpty())
+        {
+            if (large_cache_)
+            {
+                cursor_shape->set_flags(proto::desktop::CursorShape::RESET_CACHE);
+                cursor_shape->set_cache_size(static_cast<quint32>(cache_.size()));
+            }
+            else
+            {
+                cursor_shape->set_flags(
+                    proto::desktop::CursorShape::RESET_CACHE | (kCacheSize & 0x1F));
+            }
+        }
 
         // Add the cursor to the cache.
         cache_.add(std::move(mouse_cursor));
     }
+    else if (large_cache_)
+    {
+        cursor_shape->set_flags(proto::desktop::CursorShape::CACHE);
+        cursor_shape->set_cache_index(static_cast<quint32>(index));
+    }
     else
     {
         cursor_shape->set_flags(proto::desktop::CursorShape::CACHE | (index & 0x1F));
@@ -140,4 +162,12 @@ std::unique_ptr<proto::desktop::CursorShape> CursorEncoder::encode(
     return cursor_shape;
 }
 
+bool CursorEncoder::restoreClientCache(const std::vector<quint64>& hashes, size_t next_slot)
+{
+    if (!large_cache_)
+        return false;
+
+    return cache_.restore(hashes, next_slot);
+}
+
 } // namespace aspia
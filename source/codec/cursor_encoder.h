@@ -10,7 +10,7 @@
 
 #include <memory>
 
-#include "codec/compressor_zlib.h"
+#include "codec/compressor.h"
 #include "desktop_capture/mouse_cursor_cache.h"
 #include "protocol/desktop_session.pb.h"
 
@@ -19,16 +19,25 @@ namespace aspia {
 class CursorEncoder
 {
 public:
-    CursorEncoder();
+    // If |large_cache| is true, then the client supports FEATURE_CURSOR_CACHE.
+    explicit CursorEncoder(
+        proto::desktop::Compression compression = proto::desktop::COMPRESSION_ZLIB,
+        bool large_cache = false);
     ~CursorEncoder() = default;
 
     std::unique_ptr<proto::desktop::CursorShape> encode(std::unique_ptr<MouseCursor> mouse_cursor);
 
+    // Uses the cursors cached by the client from the previous sessions. Returns false if the
+    // client cache does not match the cache of the encoder.
+    bool restoreClientCache(const std::vector<quint64>& hashes, size_t next_slot);
+
 private:
     void compressCursor(proto::desktop::CursorShape* cursor_shape,
                         const MouseCursor* mouse_cursor);
 
-    CompressorZLIB compressor_;
+    const proto::desktop::Compression compression_;
+    const bool large_cache_;
+    std::unique_ptr<Compressor> compressor_;
     MouseCursorCache cache_;
 
     Q_DISABLE_COPY(CursorEncoder)
@@ -0,0 +1,35 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/decompressor.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "codec/decompressor.h"
+
+#include "codec/decompressor_lz4.h"
+#include "codec/decompressor_zlib.h"
+#include "codec/decompressor_zstd.h"
+
+namespace aspia {
+
+// static
+std::unique_ptr<Decompressor> Decompressor::create(proto::desktop::Compression compression)
+{
+    switch (compression)
+    {
+        case proto::desktop::COMPRESSION_ZLIB:
+            return std::make_unique<DecompressorZLIB>();
+
+        case proto::desktop::COMPRESSION_LZ4:
+            return std::make_unique<DecompressorLZ4>();
+
+        case proto::desktop::COMPRESSION_ZSTD:
+            return std::make_unique<DecompressorZstd>();
+
+        default:
+            return nullptr;
+    }
+}
+
+} // namespace aspia
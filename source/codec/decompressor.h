@@ -8,6 +8,10 @@
 #ifndef _ASPIA_CODEC__DECOMPRESSOR_H
 #define _ASPIA_CODEC__DECOMPRESSOR_H
 
+#include <memory>
+
+#include "protocol/desktop_session.pb.h"
+
 namespace aspia {
 
 //
@@ -23,6 +27,9 @@ class Decompressor
 public:
     virtual ~Decompressor() = default;
 
+    // Returns nullptr if |compression| is not supported.
+    static std::unique_ptr<Decompressor> create(proto::desktop::Compression compression);
+
     //
     // Resets all the internal state so the decompressor behaves as if it was
     // just created.
@@ -0,0 +1,57 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/decompressor_lz4.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "codec/decompressor_lz4.h"
+
+#include <QDebug>
+
+namespace aspia {
+
+DecompressorLZ4::DecompressorLZ4()
+{
+    LZ4F_errorCode_t ret = LZ4F_createDecompressionContext(&context_, LZ4F_VERSION);
+    Q_ASSERT(!LZ4F_isError(ret));
+}
+
+DecompressorLZ4::~DecompressorLZ4()
+{
+    LZ4F_freeDecompressionContext(context_);
+}
+
+void DecompressorLZ4::reset()
+{
+    LZ4F_resetDecompressionContext(context_);
+}
+
+bool DecompressorLZ4::process(const quint8* input_data,
+                              size_t input_size,
+                              quint8* output_data,
+                              size_t output_size,
+                              size_t* consumed,
+                              size_t* written)
+{
+    Q_ASSERT(output_size != 0);
+
+    size_t src_size = input_size;
+    size_t dst_size = output_size;
+
+    size_t ret = LZ4F_decompress(context_, output_data, &dst_size, input_data, &src_size, nullptr);
+
+    *consumed = src_size;
+    *written = dst_size;
+
+    if (LZ4F_isError(ret))
+    {
+        qWarning() << "LZ4 decompression failed: " << LZ4F_getErrorName(ret);
+        return false;
+    }
+
+    // Zero means that the frame is completely decoded.
+    return ret != 0;
+}
+
+} // namespace aspia
@@ -0,0 +1,41 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/decompressor_lz4.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CODEC__DECOMPRESSOR_LZ4_H
+#define _ASPIA_CODEC__DECOMPRESSOR_LZ4_H
+
+#include <lz4frame.h>
+
+#include "codec/decompressor.h"
+
+namespace aspia {
+
+class DecompressorLZ4 : public Decompressor
+{
+public:
+    DecompressorLZ4();
+    ~DecompressorLZ4();
+
+    void reset() override;
+
+    // Decompressor implementations.
+    bool process(const quint8* input_data,
+                 size_t input_size,
+                 quint8* output_data,
+                 size_t output_size,
+                 size_t* consumed,
+                 size_t* written) override;
+
+private:
+    LZ4F_dctx* context_ = nullptr;
+
+    Q_DISABLE_COPY(DecompressorLZ4)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_CODEC__DECOMPRESSOR_LZ4_H
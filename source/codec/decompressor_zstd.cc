@@ -0,0 +1,58 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/decompressor_zstd.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "codec/decompressor_zstd.h"
+
+#include <QDebug>
+
+namespace aspia {
+
+DecompressorZstd::DecompressorZstd()
+    : stream_(ZSTD_createDCtx())
+{
+    Q_ASSERT(stream_);
+}
+
+DecompressorZstd::~DecompressorZstd()
+{
+    ZSTD_freeDCtx(stream_);
+}
+
+void DecompressorZstd::reset()
+{
+    size_t ret = ZSTD_DCtx_reset(stream_, ZSTD_reset_session_only);
+    Q_ASSERT(!ZSTD_isError(ret));
+}
+
+bool DecompressorZstd::process(const quint8* input_data,
+                               size_t input_size,
+                               quint8* output_data,
+                               size_t output_size,
+                               size_t* consumed,
+                               size_t* written)
+{
+    Q_ASSERT(output_size != 0);
+
+    ZSTD_inBuffer input = { input_data, input_size, 0 };
+    ZSTD_outBuffer output = { output_data, output_size, 0 };
+
+    size_t ret = ZSTD_decompressStream(stream_, &output, &input);
+
+    *consumed = input.pos;
+    *written = output.pos;
+
+    if (ZSTD_isError(ret))
+    {
+        qWarning() << "zstd decompression failed: " << ZSTD_getErrorName(ret);
+        return false;
+    }
+
+    // Zero means that the frame is completely decoded.
+    return ret != 0;
+}
+
+} // namespace aspia
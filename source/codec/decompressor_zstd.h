@@ -0,0 +1,41 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/decompressor_zstd.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CODEC__DECOMPRESSOR_ZSTD_H
+#define _ASPIA_CODEC__DECOMPRESSOR_ZSTD_H
+
+#include <zstd.h>
+
+#include "codec/decompressor.h"
+
+namespace aspia {
+
+class DecompressorZstd : public Decompressor
+{
+public:
+    DecompressorZstd();
+    ~DecompressorZstd();
+
+    void reset() override;
+
+    // Decompressor implementations.
+    bool process(const quint8* input_data,
+                 size_t input_size,
+                 quint8* output_data,
+                 size_t output_size,
+                 size_t* consumed,
+                 size_t* written) override;
+
+private:
+    ZSTD_DCtx* stream_;
+
+    Q_DISABLE_COPY(DecompressorZstd)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_CODEC__DECOMPRESSOR_ZSTD_H
@@ -0,0 +1,13 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/kernel_bench_entry_point.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "codec/kernel_bench_main.h"
+
+int main(int argc, char *argv[])
+{
+    return aspia::kernelBenchMain(argc, argv);
+}
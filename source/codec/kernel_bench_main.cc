@@ -0,0 +1,554 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/kernel_bench_main.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "codec/kernel_bench_main.h"
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QStringList>
+#include <QTextStream>
+
+#include <libyuv/convert_from_argb.h>
+#include <libyuv/cpu_id.h>
+
+#if defined(Q_PROCESSOR_X86)
+#include <intrin.h>
+#endif
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <vector>
+
+#include "base/cpu_dispatch.h"
+#include "codec/cursor_encoder.h"
+#include "codec/pixel_translator.h"
+#include "desktop_capture/diff_block_avx2.h"
+#include "desktop_capture/diff_block_avx512.h"
+#include "desktop_capture/diff_block_c.h"
+#include "desktop_capture/diff_block_neon.h"
+#include "desktop_capture/diff_block_sse2.h"
+#include "desktop_capture/diff_block_sse3.h"
+#include "desktop_capture/mouse_cursor.h"
+#include "version.h"
+
+namespace aspia {
+
+namespace {
+
+constexpr int kDefaultPasses = 10;
+
+// The cursors of each pass of the cursor encoder. They differ from all previous cursors, so the
+// cache of the encoder does not hide the encoding.
+constexpr int kCursorCount = 64;
+constexpr int kCursorSize = 32;
+
+// The paths are measured from the portable code to the widest vectors. The path of an
+// instruction set also uses the sets before it in the list, as the processors which have it.
+const CpuDispatch::InstructionSet kPaths[] =
+{
+    CpuDispatch::C,
+#if defined(Q_PROCESSOR_X86)
+    CpuDispatch::SSE2,
+    CpuDispatch::SSSE3,
+    CpuDispatch::SSE42,
+    CpuDispatch::AVX2,
+    CpuDispatch::AVX512
+#elif defined(Q_PROCESSOR_ARM)
+    CpuDispatch::NEON
+#endif
+};
+
+typedef quint8(*DiffFullBlockFunc)(const quint8*, const quint8*, int);
+
+struct DiffKernel
+{
+    int block_size;
+    CpuDispatch::InstructionSet instruction_set;
+    DiffFullBlockFunc func;
+};
+
+const DiffKernel kDiffKernels[] =
+{
+    { 8,  CpuDispatch::C,      diffFullBlock_C<8>          },
+    { 16, CpuDispatch::C,      diffFullBlock_C<16>         },
+    { 32, CpuDispatch::C,      diffFullBlock_C<32>         },
+#if defined(Q_PROCESSOR_X86)
+    { 8,  CpuDispatch::SSE2,   diffFullBlock_8x8_SSE2      },
+    { 16, CpuDispatch::SSE2,   diffFullBlock_16x16_SSE2    },
+    { 32, CpuDispatch::SSE2,   diffFullBlock_32x32_SSE2    },
+    { 8,  CpuDispatch::SSSE3,  diffFullBlock_8x8_SSE3      },
+    { 16, CpuDispatch::SSSE3,  diffFullBlock_16x16_SSE3    },
+    { 32, CpuDispatch::SSSE3,  diffFullBlock_32x32_SSE3    },
+    { 8,  CpuDispatch::AVX2,   diffFullBlock_8x8_AVX2      },
+    { 16, CpuDispatch::AVX2,   diffFullBlock_16x16_AVX2    },
+    { 32, CpuDispatch::AVX2,   diffFullBlock_32x32_AVX2    },
+    { 16, CpuDispatch::AVX512, diffFullBlock_16x16_AVX512  },
+    { 32, CpuDispatch::AVX512, diffFullBlock_32x32_AVX512  },
+#elif defined(Q_PROCESSOR_ARM)
+    { 8,  CpuDispatch::NEON,   diffFullBlock_8x8_NEON      },
+    { 16, CpuDispatch::NEON,   diffFullBlock_16x16_NEON    },
+    { 32, CpuDispatch::NEON,   diffFullBlock_32x32_NEON    },
+#endif
+};
+
+struct PixelFormatInfo
+{
+    PixelFormat (*format)();
+    const char* name;
+};
+
+// One format of each size, so all specializations of the translators are measured.
+const PixelFormatInfo kPixelFormats[] =
+{
+    { &PixelFormat::ARGB,   "argb"   },
+    { &PixelFormat::RGB565, "rgb565" },
+    { &PixelFormat::RGB332, "rgb332" }
+};
+
+// The fastest of the passes. The first pass also warms the caches.
+struct Measurement
+{
+    qint64 bytes = 0;
+    quint64 cycles = std::numeric_limits<quint64>::max();
+    qint64 nsecs = std::numeric_limits<qint64>::max();
+};
+
+// The results of the kernels are accumulated here, so the calls are not optimized out.
+volatile quint32 result_sink = 0;
+
+// The time stamp counter runs at the nominal frequency of the processor. Other processors have
+// no such counter, and only the time is measured.
+quint64 readCycles()
+{
+#if defined(Q_PROCESSOR_X86)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+bool hasCycles()
+{
+#if defined(Q_PROCESSOR_X86)
+    return true;
+#else
+    return false;
+#endif
+}
+
+Measurement measure(int passes, qint64 bytes_per_pass, const std::function<void()>& pass)
+{
+    Measurement result;
+    result.bytes = bytes_per_pass;
+
+    QElapsedTimer timer;
+
+    for (int i = 0; i < passes; ++i)
+    {
+        timer.start();
+        const quint64 start_cycles = readCycles();
+
+        pass();
+
+        result.cycles = qMin(result.cycles, readCycles() - start_cycles);
+        result.nsecs = qMin(result.nsecs, timer.nsecsElapsed());
+    }
+
+    return result;
+}
+
+void fillRandom(std::vector<quint8>* buffer, quint32 seed)
+{
+    for (auto& value : *buffer)
+    {
+        seed = seed * 1664525U + 1013904223U;
+        value = static_cast<quint8>(seed >> 24);
+    }
+}
+
+// libyuv selects its own functions by the flags of the processor, so they are masked as well.
+int libyuvFlags(CpuDispatch::InstructionSet path)
+{
+    int flags = libyuv::kCpuInitialized | libyuv::kCpuHasX86 | libyuv::kCpuHasARM;
+
+    if (path == CpuDispatch::NEON)
+        return flags | libyuv::kCpuHasNEON;
+
+    if (path >= CpuDispatch::SSE2)
+        flags |= libyuv::kCpuHasSSE2;
+
+    if (path >= CpuDispatch::SSSE3)
+        flags |= libyuv::kCpuHasSSSE3;
+
+    if (path >= CpuDispatch::SSE42)
+        flags |= libyuv::kCpuHasSSE41 | libyuv::kCpuHasSSE42;
+
+    if (path >= CpuDispatch::AVX2)
+        flags |= libyuv::kCpuHasAVX | libyuv::kCpuHasAVX2 | libyuv::kCpuHasFMA3;
+
+    if (path >= CpuDispatch::AVX512)
+        flags |= libyuv::kCpuHasAVX512BW | libyuv::kCpuHasAVX512VL;
+
+    return flags;
+}
+
+// The kernels which are created after the call use only |path| and the paths before it.
+void selectPath(CpuDispatch::InstructionSet path)
+{
+    // The flags of libyuv are also read by the dispatch, so they are restored first.
+    libyuv::MaskCpuFlags(-1);
+
+    QStringList disabled;
+
+    for (int i = path + 1; i < CpuDispatch::InstructionSetCount; ++i)
+    {
+        const auto instruction_set = static_cast<CpuDispatch::InstructionSet>(i);
+        disabled.append(QLatin1String(CpuDispatch::name(instruction_set)));
+    }
+
+    CpuDispatch::setOverride(disabled.join(QLatin1Char(',')));
+    libyuv::MaskCpuFlags(libyuvFlags(path));
+}
+
+void resetPath()
+{
+    libyuv::MaskCpuFlags(-1);
+    CpuDispatch::setOverride(QString());
+}
+
+void printHeader(QTextStream& out)
+{
+    out << qSetFieldWidth(26) << left << "kernel"
+        << qSetFieldWidth(8) << "path"
+        << qSetFieldWidth(12) << right << "bytes"
+        << qSetFieldWidth(13) << "cycles/byte" << "ns/byte" << "gb/s"
+        << qSetFieldWidth(0) << endl;
+}
+
+void printResult(QTextStream& out,
+                 const QString& kernel,
+                 CpuDispatch::InstructionSet path,
+                 const Measurement& measurement)
+{
+    const double bytes = qMax<qint64>(measurement.bytes, 1);
+    const double nsecs = qMax<qint64>(measurement.nsecs, 1);
+
+    out << qSetFieldWidth(26) << left << kernel
+        << qSetFieldWidth(8) << CpuDispatch::name(path)
+        << qSetFieldWidth(12) << right << measurement.bytes
+        << qSetFieldWidth(13) << fixed << qSetRealNumberPrecision(3);
+
+    if (hasCycles())
+        out << measurement.cycles / bytes;
+    else
+        out << "-";
+
+    out << nsecs / bytes << bytes / nsecs << qSetFieldWidth(0) << endl;
+}
+
+class KernelBench
+{
+public:
+    KernelBench(QTextStream& out, const QSize& size, int passes, const QString& filter)
+        : out_(out),
+          size_(size),
+          passes_(passes),
+          filter_(filter)
+    {
+        // The paths of the processor are found before any of them is masked.
+        resetPath();
+
+        for (const auto path : kPaths)
+        {
+            if (CpuDispatch::isEnabled(path))
+                paths_.push_back(path);
+        }
+    }
+
+    void run()
+    {
+        runDiff();
+        runTranslate();
+        runYuv();
+        runCursorEncoder();
+        resetPath();
+    }
+
+private:
+    bool isSelected(const QString& kernel) const
+    {
+        return filter_.isEmpty() || kernel.startsWith(filter_);
+    }
+
+    bool isSupported(CpuDispatch::InstructionSet path) const
+    {
+        return std::find(paths_.begin(), paths_.end(), path) != paths_.end();
+    }
+
+    // The frames are equal, so each block is compared to its end as in the unchanged areas of
+    // the screen.
+    void runDiff()
+    {
+        const int bytes_per_row = size_.width() * 4;
+
+        std::vector<quint8> prev_image(bytes_per_row * size_.height());
+        fillRandom(&prev_image, 1);
+        const std::vector<quint8> curr_image(prev_image);
+
+        for (const auto& kernel : kDiffKernels)
+        {
+            const QString name =
+                QString(QStringLiteral("diff_block_%1x%1")).arg(kernel.block_size);
+            if (!isSelected(name) || !isSupported(kernel.instruction_set))
+                continue;
+
+            const int blocks_x = size_.width() / kernel.block_size;
+            const int blocks_y = size_.height() / kernel.block_size;
+            const int block_bytes = kernel.block_size * 4;
+            const int block_stride_y = bytes_per_row * kernel.block_size;
+
+            const qint64 bytes =
+                static_cast<qint64>(blocks_x) * blocks_y * block_bytes * kernel.block_size;
+
+            Measurement measurement = measure(passes_, bytes, [&]()
+            {
+                quint32 result = 0;
+
+                for (int y = 0; y < blocks_y; ++y)
+                {
+                    const quint8* prev_block = prev_image.data() + y * block_stride_y;
+                    const quint8* curr_block = curr_image.data() + y * block_stride_y;
+
+                    for (int x = 0; x < blocks_x; ++x)
+                    {
+                        result += kernel.func(prev_block, curr_block, bytes_per_row);
+
+                        prev_block += block_bytes;
+                        curr_block += block_bytes;
+                    }
+                }
+
+                result_sink = result_sink + result;
+            });
+
+            printResult(out_, name, kernel.instruction_set, measurement);
+        }
+    }
+
+    void runTranslate()
+    {
+        const int pixels = size_.width() * size_.height();
+
+        std::vector<quint8> source(pixels * 4);
+        std::vector<quint8> target(pixels * 4);
+        fillRandom(&source, 2);
+
+        for (const auto& source_format : kPixelFormats)
+        {
+            for (const auto& target_format : kPixelFormats)
+            {
+                const QString name = QString(QStringLiteral("translate_%1_%2"))
+                    .arg(QLatin1String(source_format.name))
+                    .arg(QLatin1String(target_format.name));
+                if (!isSelected(name))
+                    continue;
+
+                const int source_bpp = source_format.format().bytesPerPixel();
+                const int target_bpp = target_format.format().bytesPerPixel();
+
+                for (const auto path : paths_)
+                {
+                    selectPath(path);
+
+                    std::unique_ptr<PixelTranslator> translator =
+                        PixelTranslator::create(source_format.format(), target_format.format());
+                    if (!translator)
+                        continue;
+
+                    Measurement measurement = measure(passes_, pixels * source_bpp, [&]()
+                    {
+                        translator->translate(source.data(), size_.width() * source_bpp,
+                                              target.data(), size_.width() * target_bpp,
+                                              size_.width(), size_.height());
+                    });
+
+                    printResult(out_, name, path, measurement);
+                }
+            }
+        }
+    }
+
+    void runYuv()
+    {
+        const int width = size_.width();
+        const int height = size_.height();
+
+        std::vector<quint8> argb(width * height * 4);
+        fillRandom(&argb, 3);
+
+        // The planes of I444 are large enough for I420.
+        std::vector<quint8> y_plane(width * height);
+        std::vector<quint8> u_plane(width * height);
+        std::vector<quint8> v_plane(width * height);
+
+        const qint64 bytes = static_cast<qint64>(width) * height * 4;
+
+        for (const auto path : paths_)
+        {
+            selectPath(path);
+
+            if (isSelected(QStringLiteral("argb_to_i420")))
+            {
+                Measurement measurement = measure(passes_, bytes, [&]()
+                {
+                    libyuv::ARGBToI420(argb.data(), width * 4,
+                                       y_plane.data(), width,
+                                       u_plane.data(), (width + 1) / 2,
+                                       v_plane.data(), (width + 1) / 2,
+                                       width, height);
+                });
+
+                printResult(out_, QStringLiteral("argb_to_i420"), path, measurement);
+            }
+
+            if (isSelected(QStringLiteral("argb_to_i444")))
+            {
+                Measurement measurement = measure(passes_, bytes, [&]()
+                {
+                    libyuv::ARGBToI444(argb.data(), width * 4,
+                                       y_plane.data(), width,
+                                       u_plane.data(), width,
+                                       v_plane.data(), width,
+                                       width, height);
+                });
+
+                printResult(out_, QStringLiteral("argb_to_i444"), path, measurement);
+            }
+        }
+    }
+
+    // The cursors are arrows with the edge of the transparent pixels, like the real ones. The
+    // compressors choose their own code, so the paths differ only by the kernels of Aspia.
+    void runCursorEncoder()
+    {
+        if (!isSelected(QStringLiteral("cursor_encoder")))
+            return;
+
+        const int cursor_bytes = kCursorSize * kCursorSize * 4;
+        quint32 sequence = 0;
+
+        for (const auto path : paths_)
+        {
+            selectPath(path);
+
+            CursorEncoder encoder(proto::desktop::COMPRESSION_ZLIB, true);
+
+            Measurement measurement = measure(passes_, kCursorCount * cursor_bytes, [&]()
+            {
+                for (int i = 0; i < kCursorCount; ++i)
+                {
+                    std::unique_ptr<quint8[]> data(new quint8[cursor_bytes]);
+                    quint32* pixels = reinterpret_cast<quint32*>(data.get());
+
+                    for (int y = 0; y < kCursorSize; ++y)
+                    {
+                        for (int x = 0; x < kCursorSize; ++x)
+                            pixels[y * kCursorSize + x] = x <= y ? 0xFF000000 | (x * y) : 0;
+                    }
+
+                    pixels[0] = 0xFF000000 | ++sequence;
+
+                    std::unique_ptr<proto::desktop::CursorShape> shape = encoder.encode(
+                        MouseCursor::create(std::move(data),
+                                            QSize(kCursorSize, kCursorSize),
+                                            QPoint(0, 0)));
+                    if (shape)
+                        result_sink = result_sink + shape->data().size();
+                }
+            });
+
+            printResult(out_, QStringLiteral("cursor_encoder"), path, measurement);
+        }
+    }
+
+    QTextStream& out_;
+    const QSize size_;
+    const int passes_;
+    const QString filter_;
+
+    std::vector<CpuDispatch::InstructionSet> paths_;
+
+    Q_DISABLE_COPY(KernelBench)
+};
+
+} // namespace
+
+int kernelBenchMain(int argc, char *argv[])
+{
+    QCoreApplication application(argc, argv);
+    application.setOrganizationName(QStringLiteral("Aspia"));
+    application.setApplicationName(QStringLiteral("Kernel Bench"));
+    application.setApplicationVersion(QStringLiteral(ASPIA_VERSION_STRING));
+
+    QCommandLineOption width_option(QStringLiteral("width"),
+                                    QStringLiteral("Width of the images."),
+                                    QStringLiteral("width"),
+                                    QStringLiteral("1920"));
+    QCommandLineOption height_option(QStringLiteral("height"),
+                                     QStringLiteral("Height of the images."),
+                                     QStringLiteral("height"),
+                                     QStringLiteral("1080"));
+    QCommandLineOption passes_option(QStringLiteral("passes"),
+                                     QStringLiteral("Number of the passes of each kernel. The "
+                                                    "fastest one is reported."),
+                                     QStringLiteral("passes"),
+                                     QString::number(kDefaultPasses));
+    QCommandLineOption kernel_option(QStringLiteral("kernel"),
+                                     QStringLiteral("Measures only the kernels whose names start "
+                                                    "with the prefix, for example diff_block or "
+                                                    "translate_argb."),
+                                     QStringLiteral("prefix"));
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(
+        QStringLiteral("Measures the vector kernels of the differ, the pixel translators, "
+                       "the conversions to YUV and the cursor encoder on every path of the "
+                       "processor."));
+    parser.addHelpOption();
+    parser.addOption(width_option);
+    parser.addOption(height_option);
+    parser.addOption(passes_option);
+    parser.addOption(kernel_option);
+    parser.process(application);
+
+    const QSize size(parser.value(width_option).toInt(), parser.value(height_option).toInt());
+    const int passes = parser.value(passes_option).toInt();
+
+    // The vector translators process the rows of 8 pixels, and the blocks of the differ are up
+    // to 32 pixels.
+    if (size.width() < 32 || size.width() % 8 || size.height() < 32 || passes <= 0)
+    {
+        qWarning("Invalid size of the images or number of the passes");
+        return 1;
+    }
+
+    QTextStream out(stdout);
+
+    out << "Images " << size.width() << "x" << size.height() << ", "
+        << passes << " passes per kernel" << endl << endl;
+
+    printHeader(out);
+
+    KernelBench bench(out, size, passes, parser.value(kernel_option));
+    bench.run();
+
+    return 0;
+}
+
+} // namespace aspia
@@ -0,0 +1,19 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/kernel_bench_main.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CODEC__KERNEL_BENCH_MAIN_H
+#define _ASPIA_CODEC__KERNEL_BENCH_MAIN_H
+
+#include "core_export.h"
+
+namespace aspia {
+
+int CORE_EXPORT kernelBenchMain(int argc, char *argv[]);
+
+} // namespace aspia
+
+#endif // _ASPIA_CODEC__KERNEL_BENCH_MAIN_H
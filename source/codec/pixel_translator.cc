@@ -7,10 +7,122 @@
 
 #include "codec/pixel_translator.h"
 
+#include <cstring>
+
+#include "base/cpu_dispatch.h"
+#include "codec/pixel_translator_neon.h"
+#include "codec/pixel_translator_sse2.h"
+
 namespace aspia {
 
 namespace {
 
+typedef void(*TranslateFunc)(const quint8*, int, quint8*, int, int, int);
+
+// The vector kernels translate groups of 8 pixels. The remaining columns are translated by
+// the table translator.
+class PixelTranslatorSIMD : public PixelTranslator
+{
+public:
+    PixelTranslatorSIMD(TranslateFunc translate_func,
+                        std::unique_ptr<PixelTranslator> tail_translator,
+                        int source_bytes_per_pixel,
+                        int target_bytes_per_pixel)
+        : translate_func_(translate_func),
+          tail_translator_(std::move(tail_translator)),
+          source_bytes_per_pixel_(source_bytes_per_pixel),
+          target_bytes_per_pixel_(target_bytes_per_pixel)
+    {
+        // Nothing
+    }
+
+    ~PixelTranslatorSIMD() = default;
+
+    void translate(const quint8* src, int src_stride,
+                   quint8* dst, int dst_stride,
+                   int width, int height) override
+    {
+        const int simd_width = width & ~7;
+
+        if (simd_width)
+            translate_func_(src, src_stride, dst, dst_stride, simd_width, height);
+
+        if (simd_width != width)
+        {
+            tail_translator_->translate(src + simd_width * source_bytes_per_pixel_, src_stride,
+                                        dst + simd_width * target_bytes_per_pixel_, dst_stride,
+                                        width - simd_width, height);
+        }
+    }
+
+private:
+    TranslateFunc translate_func_;
+    std::unique_ptr<PixelTranslator> tail_translator_;
+
+    const int source_bytes_per_pixel_;
+    const int target_bytes_per_pixel_;
+
+    Q_DISABLE_COPY(PixelTranslatorSIMD)
+};
+
+// Returns the vector kernel for the pair of formats or nullptr.
+TranslateFunc simdTranslateFunc(const PixelFormat& source_format, const PixelFormat& target_format)
+{
+    if (source_format == PixelFormat::ARGB() && target_format == PixelFormat::RGB565())
+    {
+        return CpuDispatch::select<TranslateFunc>("translate_argb_rgb565",
+        {
+#if defined(Q_PROCESSOR_X86)
+            { CpuDispatch::SSE2, translateARGBToRGB565_SSE2 },
+#elif defined(Q_PROCESSOR_ARM)
+            { CpuDispatch::NEON, translateARGBToRGB565_NEON },
+#endif
+            { CpuDispatch::C, nullptr }
+        });
+    }
+
+    if (source_format == PixelFormat::ARGB() && target_format == PixelFormat::RGB332())
+    {
+        return CpuDispatch::select<TranslateFunc>("translate_argb_rgb332",
+        {
+#if defined(Q_PROCESSOR_X86)
+            { CpuDispatch::SSE2, translateARGBToRGB332_SSE2 },
+#elif defined(Q_PROCESSOR_ARM)
+            { CpuDispatch::NEON, translateARGBToRGB332_NEON },
+#endif
+            { CpuDispatch::C, nullptr }
+        });
+    }
+
+    if (source_format == PixelFormat::RGB565() && target_format == PixelFormat::ARGB())
+    {
+        return CpuDispatch::select<TranslateFunc>("translate_rgb565_argb",
+        {
+#if defined(Q_PROCESSOR_X86)
+            { CpuDispatch::SSE2, translateRGB565ToARGB_SSE2 },
+#elif defined(Q_PROCESSOR_ARM)
+            { CpuDispatch::NEON, translateRGB565ToARGB_NEON },
+#endif
+            { CpuDispatch::C, nullptr }
+        });
+    }
+
+    if (source_format == PixelFormat::RGB332() && target_format == PixelFormat::ARGB())
+    {
+        return CpuDispatch::select<TranslateFunc>("translate_rgb332_argb",
+        {
+#if defined(Q_PROCESSOR_X86)
+            { CpuDispatch::SSE2, translateRGB332ToARGB_SSE2 },
+#elif defined(Q_PROCESSOR_ARM)
+            { CpuDispatch::NEON, translateRGB332ToARGB_NEON },
+#endif
+            { CpuDispatch::C, nullptr }
+        });
+    }
+
+    return nullptr;
+}
+
 template<int kSourceBpp, int kTargetBpp>
 class PixelTranslatorT : public PixelTranslator
 {
@@ -223,11 +335,41 @@ private:
     Q_DISABLE_COPY(PixelTranslatorFrom8_16bppT)
 };
 
-} // namespace
+// The pixels of the same format are copied by rows.
+class PixelTranslatorCopy : public PixelTranslator
+{
+public:
+    explicit PixelTranslatorCopy(int bytes_per_pixel)
+        : bytes_per_pixel_(bytes_per_pixel)
+    {
+        // Nothing
+    }
 
-// static
-std::unique_ptr<PixelTranslator> PixelTranslator::create(const PixelFormat& source_format,
-                                                         const PixelFormat& target_format)
+    ~PixelTranslatorCopy() = default;
+
+    void translate(const quint8* src, int src_stride,
+                   quint8* dst, int dst_stride,
+                   int width, int height) override
+    {
+        const int row_size = width * bytes_per_pixel_;
+
+        for (int y = 0; y < height; ++y)
+        {
+            memcpy(dst, src, row_size);
+
+            src += src_stride;
+            dst += dst_stride;
+        }
+    }
+
+private:
+    const int bytes_per_pixel_;
+
+    Q_DISABLE_COPY(PixelTranslatorCopy)
+};
+
+std::unique_ptr<PixelTranslator> createTableTranslator(const PixelFormat& source_format,
+                                                       const PixelFormat& target_format)
 {
     switch (target_format.bytesPerPixel())
     {
@@ -283,4 +425,28 @@ std::unique_ptr<PixelTranslator> PixelTranslator::create(const PixelFormat& sour
     return nullptr;
 }
 
+} // namespace
+
+// static
+std::unique_ptr<PixelTranslator> PixelTranslator::create(const PixelFormat& source_format,
+                                                         const PixelFormat& target_format)
+{
+    if (source_format == target_format)
+        return std::make_unique<PixelTranslatorCopy>(source_format.bytesPerPixel());
+
+    std::unique_ptr<PixelTranslator> translator =
+        createTableTranslator(source_format, target_format);
+    if (!translator)
+        return nullptr;
+
+    TranslateFunc translate_func = simdTranslateFunc(source_format, target_format);
+    if (!translate_func)
+        return translator;
+
+    return std::make_unique<PixelTranslatorSIMD>(translate_func,
+                                                 std::move(translator),
+                                                 source_format.bytesPerPixel(),
+                                                 target_format.bytesPerPixel());
+}
+
 } // namespace aspia
@@ -0,0 +1,157 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/pixel_translator_neon.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "codec/pixel_translator_neon.h"
+
+#if defined(Q_PROCESSOR_ARM)
+
+#if defined(Q_CC_MSVC) && defined(Q_PROCESSOR_ARM_64)
+#include <arm64_neon.h>
+#else
+#include <arm_neon.h>
+#endif
+
+namespace aspia {
+
+namespace {
+
+// Scales the 8-bit channels to |max| with rounding: (value * max + 127) / 255.
+// (x + 1 + (x >> 8)) >> 8 is equal to x / 255 for all the values used here.
+uint16x8_t scaleFrom8bit(uint8x8_t value, quint16 max)
+{
+    uint16x8_t x = vmlaq_n_u16(vdupq_n_u16(127), vmovl_u8(value), max);
+    x = vaddq_u16(x, vaddq_u16(vdupq_n_u16(1), vshrq_n_u16(x, 8)));
+    return vshrq_n_u16(x, 8);
+}
+
+// Scales the channels of |max| to 8 bits with truncation: value * 255 / max.
+// The multipliers are found for every max in use: 31, 63, 7 and 3.
+template <int kShift, quint16 kMultiplier>
+uint8x8_t scaleTo8bit(uint16x8_t value)
+{
+    value = vshlq_n_u16(value, kShift);
+
+    const uint16x4_t low = vshrn_n_u32(vmull_n_u16(vget_low_u16(value), kMultiplier), 16);
+    const uint16x4_t high = vshrn_n_u32(vmull_n_u16(vget_high_u16(value), kMultiplier), 16);
+
+    return vmovn_u16(vcombine_u16(low, high));
+}
+
+// Stores 8 ARGB pixels. The alpha is zero.
+void storeARGB(quint8* dst, uint8x8_t red, uint8x8_t green, uint8x8_t blue)
+{
+    uint8x8x4_t pixels;
+
+    pixels.val[0] = blue;
+    pixels.val[1] = green;
+    pixels.val[2] = red;
+    pixels.val[3] = vdup_n_u8(0);
+
+    vst4_u8(dst, pixels);
+}
+
+} // namespace
+
+void translateARGBToRGB565_NEON(const quint8* src, int src_stride,
+                                quint8* dst, int dst_stride,
+                                int width, int height)
+{
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; x += 8)
+        {
+            const uint8x8x4_t argb = vld4_u8(src + x * 4);
+
+            const uint16x8_t pixels = vorrq_u16(
+                vorrq_u16(vshlq_n_u16(scaleFrom8bit(argb.val[2], 31), 11),
+                          vshlq_n_u16(scaleFrom8bit(argb.val[1], 63), 5)),
+                scaleFrom8bit(argb.val[0], 31));
+
+            vst1q_u16(reinterpret_cast<uint16_t*>(dst + x * 2), pixels);
+        }
+
+        src += src_stride;
+        dst += dst_stride;
+    }
+}
+
+void translateARGBToRGB332_NEON(const quint8* src, int src_stride,
+                                quint8* dst, int dst_stride,
+                                int width, int height)
+{
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; x += 8)
+        {
+            const uint8x8x4_t argb = vld4_u8(src + x * 4);
+
+            const uint16x8_t pixels = vorrq_u16(
+                vorrq_u16(vshlq_n_u16(scaleFrom8bit(argb.val[2], 7), 5),
+                          vshlq_n_u16(scaleFrom8bit(argb.val[1], 7), 2)),
+                scaleFrom8bit(argb.val[0], 3));
+
+            vst1_u8(dst + x, vmovn_u16(pixels));
+        }
+
+        src += src_stride;
+        dst += dst_stride;
+    }
+}
+
+void translateRGB565ToARGB_NEON(const quint8* src, int src_stride,
+                                quint8* dst, int dst_stride,
+                                int width, int height)
+{
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; x += 8)
+        {
+            const uint16x8_t pixels = vld1q_u16(reinterpret_cast<const uint16_t*>(src + x * 2));
+
+            const uint16x8_t red = vshrq_n_u16(pixels, 11);
+            const uint16x8_t green = vandq_u16(vshrq_n_u16(pixels, 5), vdupq_n_u16(0x3F));
+            const uint16x8_t blue = vandq_u16(pixels, vdupq_n_u16(0x1F));
+
+            storeARGB(dst + x * 4,
+                      scaleTo8bit<4, 33693>(red),
+                      scaleTo8bit<3, 33159>(green),
+                      scaleTo8bit<4, 33693>(blue));
+        }
+
+        src += src_stride;
+        dst += dst_stride;
+    }
+}
+
+void translateRGB332ToARGB_NEON(const quint8* src, int src_stride,
+                                quint8* dst, int dst_stride,
+                                int width, int height)
+{
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; x += 8)
+        {
+            const uint16x8_t pixels = vmovl_u8(vld1_u8(src + x));
+
+            const uint16x8_t red = vshrq_n_u16(pixels, 5);
+            const uint16x8_t green = vandq_u16(vshrq_n_u16(pixels, 2), vdupq_n_u16(0x07));
+            const uint16x8_t blue = vandq_u16(pixels, vdupq_n_u16(0x03));
+
+            storeARGB(dst + x * 4,
+                      scaleTo8bit<6, 37303>(red),
+                      scaleTo8bit<6, 37303>(green),
+                      scaleTo8bit<7, 43520>(blue));
+        }
+
+        src += src_stride;
+        dst += dst_stride;
+    }
+}
+
+} // namespace aspia
+
+#endif // defined(Q_PROCESSOR_ARM)
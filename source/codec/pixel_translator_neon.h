@@ -0,0 +1,33 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/pixel_translator_neon.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CODEC__PIXEL_TRANSLATOR_NEON_H
+#define _ASPIA_CODEC__PIXEL_TRANSLATOR_NEON_H
+
+namespace aspia {
+
+// |width| must be a multiple of 8. The results are the same as of the table translators.
+
+void translateARGBToRGB565_NEON(const quint8* src, int src_stride,
+                                quint8* dst, int dst_stride,
+                                int width, int height);
+
+void translateARGBToRGB332_NEON(const quint8* src, int src_stride,
+                                quint8* dst, int dst_stride,
+                                int width, int height);
+
+void translateRGB565ToARGB_NEON(const quint8* src, int src_stride,
+                                quint8* dst, int dst_stride,
+                                int width, int height);
+
+void translateRGB332ToARGB_NEON(const quint8* src, int src_stride,
+                                quint8* dst, int dst_stride,
+                                int width, int height);
+
+} // namespace aspia
+
+#endif // _ASPIA_CODEC__PIXEL_TRANSLATOR_NEON_H
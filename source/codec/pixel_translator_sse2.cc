@@ -0,0 +1,167 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/pixel_translator_sse2.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "codec/pixel_translator_sse2.h"
+
+#if defined(Q_PROCESSOR_X86)
+
+#if defined(Q_CC_MSVC)
+#include <intrin.h>
+#else
+#include <emmintrin.h>
+#endif
+
+namespace aspia {
+
+namespace {
+
+// Scales the 8-bit channels to |max| with rounding: (value * max + 127) / 255.
+// (x + 1 + (x >> 8)) >> 8 is equal to x / 255 for all the values used here.
+__m128i scaleFrom8bit(__m128i value, short max)
+{
+    __m128i x = _mm_add_epi16(_mm_mullo_epi16(value, _mm_set1_epi16(max)), _mm_set1_epi16(127));
+    x = _mm_add_epi16(x, _mm_add_epi16(_mm_set1_epi16(1), _mm_srli_epi16(x, 8)));
+    return _mm_srli_epi16(x, 8);
+}
+
+// Scales the channels of |max| to 8 bits with truncation: value * 255 / max.
+// The multipliers are found for every max in use: 31, 63, 7 and 3.
+template <int kShift, unsigned short kMultiplier>
+__m128i scaleTo8bit(__m128i value)
+{
+    return _mm_mulhi_epu16(_mm_slli_epi16(value, kShift), _mm_set1_epi16(static_cast<short>(kMultiplier)));
+}
+
+// Loads 8 ARGB pixels and returns their channels as 16-bit values.
+void loadARGB(const quint8* src, __m128i* red, __m128i* green, __m128i* blue)
+{
+    const __m128i mask = _mm_set1_epi32(0xFF);
+
+    const __m128i p0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    const __m128i p1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 16));
+
+    *blue = _mm_packs_epi32(_mm_and_si128(p0, mask), _mm_and_si128(p1, mask));
+    *green = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(p0, 8), mask),
+                             _mm_and_si128(_mm_srli_epi32(p1, 8), mask));
+    *red = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(p0, 16), mask),
+                           _mm_and_si128(_mm_srli_epi32(p1, 16), mask));
+}
+
+// Stores 8 ARGB pixels from their 16-bit channels. The alpha is zero.
+void storeARGB(quint8* dst, __m128i red, __m128i green, __m128i blue)
+{
+    const __m128i blue_green = _mm_or_si128(blue, _mm_slli_epi16(green, 8));
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_unpacklo_epi16(blue_green, red));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 16), _mm_unpackhi_epi16(blue_green, red));
+}
+
+} // namespace
+
+void translateARGBToRGB565_SSE2(const quint8* src, int src_stride,
+                                quint8* dst, int dst_stride,
+                                int width, int height)
+{
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; x += 8)
+        {
+            __m128i red, green, blue;
+            loadARGB(src + x * 4, &red, &green, &blue);
+
+            const __m128i pixels = _mm_or_si128(
+                _mm_or_si128(_mm_slli_epi16(scaleFrom8bit(red, 31), 11),
+                             _mm_slli_epi16(scaleFrom8bit(green, 63), 5)),
+                scaleFrom8bit(blue, 31));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x * 2), pixels);
+        }
+
+        src += src_stride;
+        dst += dst_stride;
+    }
+}
+
+void translateARGBToRGB332_SSE2(const quint8* src, int src_stride,
+                                quint8* dst, int dst_stride,
+                                int width, int height)
+{
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; x += 8)
+        {
+            __m128i red, green, blue;
+            loadARGB(src + x * 4, &red, &green, &blue);
+
+            const __m128i pixels = _mm_or_si128(
+                _mm_or_si128(_mm_slli_epi16(scaleFrom8bit(red, 7), 5),
+                             _mm_slli_epi16(scaleFrom8bit(green, 7), 2)),
+                scaleFrom8bit(blue, 3));
+
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + x),
+                             _mm_packus_epi16(pixels, _mm_setzero_si128()));
+        }
+
+        src += src_stride;
+        dst += dst_stride;
+    }
+}
+
+void translateRGB565ToARGB_SSE2(const quint8* src, int src_stride,
+                                quint8* dst, int dst_stride,
+                                int width, int height)
+{
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; x += 8)
+        {
+            const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x * 2));
+
+            const __m128i red = _mm_srli_epi16(pixels, 11);
+            const __m128i green = _mm_and_si128(_mm_srli_epi16(pixels, 5), _mm_set1_epi16(0x3F));
+            const __m128i blue = _mm_and_si128(pixels, _mm_set1_epi16(0x1F));
+
+            storeARGB(dst + x * 4,
+                      scaleTo8bit<4, 33693>(red),
+                      scaleTo8bit<3, 33159>(green),
+                      scaleTo8bit<4, 33693>(blue));
+        }
+
+        src += src_stride;
+        dst += dst_stride;
+    }
+}
+
+void translateRGB332ToARGB_SSE2(const quint8* src, int src_stride,
+                                quint8* dst, int dst_stride,
+                                int width, int height)
+{
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; x += 8)
+        {
+            const __m128i pixels = _mm_unpacklo_epi8(
+                _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + x)), _mm_setzero_si128());
+
+            const __m128i red = _mm_srli_epi16(pixels, 5);
+            const __m128i green = _mm_and_si128(_mm_srli_epi16(pixels, 2), _mm_set1_epi16(0x07));
+            const __m128i blue = _mm_and_si128(pixels, _mm_set1_epi16(0x03));
+
+            storeARGB(dst + x * 4,
+                      scaleTo8bit<6, 37303>(red),
+                      scaleTo8bit<6, 37303>(green),
+                      scaleTo8bit<7, 43520>(blue));
+        }
+
+        src += src_stride;
+        dst += dst_stride;
+    }
+}
+
+} // namespace aspia
+
+#endif // defined(Q_PROCESSOR_X86)
@@ -0,0 +1,33 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/pixel_translator_sse2.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CODEC__PIXEL_TRANSLATOR_SSE2_H
+#define _ASPIA_CODEC__PIXEL_TRANSLATOR_SSE2_H
+
+namespace aspia {
+
+// |width| must be a multiple of 8. The results are the same as of the table translators.
+
+void translateARGBToRGB565_SSE2(const quint8* src, int src_stride,
+                                quint8* dst, int dst_stride,
+                                int width, int height);
+
+void translateARGBToRGB332_SSE2(const quint8* src, int src_stride,
+                                quint8* dst, int dst_stride,
+                                int width, int height);
+
+void translateRGB565ToARGB_SSE2(const quint8* src, int src_stride,
+                                quint8* dst, int dst_stride,
+                                int width, int height);
+
+void translateRGB332ToARGB_SSE2(const quint8* src, int src_stride,
+                                quint8* dst, int dst_stride,
+                                int width, int height);
+
+} // namespace aspia
+
+#endif // _ASPIA_CODEC__PIXEL_TRANSLATOR_SSE2_H
@@ -0,0 +1,27 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/scoped_aom_codec.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "codec/scoped_aom_codec.h"
+
+extern "C"
+{
+#include "aom/aom_codec.h"
+}
+
+namespace aspia {
+
+void AomCodecDeleter::operator()(aom_codec_ctx_t* codec)
+{
+    if (codec)
+    {
+        aom_codec_err_t ret = aom_codec_destroy(codec);
+        Q_ASSERT(ret == AOM_CODEC_OK);
+        delete codec;
+    }
+}
+
+} // namespace aspia
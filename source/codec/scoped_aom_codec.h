@@ -0,0 +1,29 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/scoped_aom_codec.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CODEC__SCOPED_AOM_CODEC_H
+#define _ASPIA_CODEC__SCOPED_AOM_CODEC_H
+
+#include <memory>
+
+extern "C"
+{
+typedef struct aom_codec_ctx aom_codec_ctx_t;
+}
+
+namespace aspia {
+
+struct AomCodecDeleter
+{
+    void operator()(aom_codec_ctx_t* codec);
+};
+
+using ScopedAomCodec = std::unique_ptr<aom_codec_ctx_t, AomCodecDeleter>;
+
+} // namespace aspia
+
+#endif // _ASPIA_CODEC__SCOPED_AOM_CODEC_H
@@ -7,6 +7,10 @@
 
 #include "codec/video_decoder.h"
 
+#include "codec/video_decoder_av1.h"
+#include "codec/video_decoder_h264.h"
+#include "codec/video_decoder_hybrid.h"
+#include "codec/video_decoder_palette.h"
 #include "codec/video_decoder_vpx.h"
 #include "codec/video_decoder_zlib.h"
 
@@ -20,12 +24,31 @@ std::unique_ptr<VideoDecoder> VideoDecoder::create(proto::desktop::VideoEncoding
         case proto::desktop::VIDEO_ENCODING_ZLIB:
             return VideoDecoderZLIB::create();
 
+        case proto::desktop::VIDEO_ENCODING_LZ4:
+            return VideoDecoderZLIB::create(proto::desktop::COMPRESSION_LZ4);
+
+        case proto::desktop::VIDEO_ENCODING_ZSTD:
+            return VideoDecoderZLIB::create(proto::desktop::COMPRESSION_ZSTD);
+
         case proto::desktop::VIDEO_ENCODING_VP8:
             return VideoDecoderVPX::createVP8();
 
         case proto::desktop::VIDEO_ENCODING_VP9:
+        case proto::desktop::VIDEO_ENCODING_VP9_LOSSY:
             return VideoDecoderVPX::createVP9();
 
+        case proto::desktop::VIDEO_ENCODING_H264:
+            return VideoDecoderH264::create();
+
+        case proto::desktop::VIDEO_ENCODING_HYBRID:
+            return VideoDecoderHybrid::create();
+
+        case proto::desktop::VIDEO_ENCODING_PALETTE:
+            return VideoDecoderPalette::create();
+
+        case proto::desktop::VIDEO_ENCODING_AV1:
+            return VideoDecoderAV1::create();
+
         default:
             return nullptr;
     }
@@ -11,6 +11,7 @@
 #include <memory>
 
 #include "desktop_capture/desktop_frame.h"
+#include "desktop_capture/desktop_frame_yuv.h"
 #include "protocol/desktop_session.pb.h"
 
 namespace aspia {
@@ -23,6 +24,18 @@ public:
     static std::unique_ptr<VideoDecoder> create(proto::desktop::VideoEncoding encoding);
 
     virtual bool decode(const proto::desktop::VideoPacket& packet, DesktopFrame* frame) = 0;
+
+    // Returns true if the decoder is able to output the planar image without the conversion
+    // to RGB.
+    virtual bool canDecodeYuv() const { return false; }
+
+    // Decodes the packet into the planar frame. If the layout of the decoded image differs
+    // from |frame|, then the frame is created again with the whole image.
+    virtual bool decodeYuv(const proto::desktop::VideoPacket& /* packet */,
+                           std::unique_ptr<DesktopFrameYUV>* /* frame */)
+    {
+        return false;
+    }
 };
 
 } // namespace aspia
@@ -0,0 +1,198 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/video_decoder_av1.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "codec/video_decoder_av1.h"
+
+#include <libyuv/convert_argb.h>
+#include <libyuv/planar_functions.h>
+
+#include <QDebug>
+#include <QThread>
+
+#include "codec/video_util.h"
+
+namespace aspia {
+
+// static
+std::unique_ptr<VideoDecoderAV1> VideoDecoderAV1::create()
+{
+    ScopedAomCodec codec(new aom_codec_ctx_t());
+
+    aom_codec_dec_cfg_t config;
+    memset(&config, 0, sizeof(config));
+
+    // Tiles and rows of AV1 frames are decoded in parallel.
+    config.threads = qBound(1, QThread::idealThreadCount(), 8);
+    config.allow_lowbitdepth = 1;
+
+    aom_codec_err_t ret = aom_codec_dec_init(codec.get(), aom_codec_av1_dx(), &config, 0);
+    if (ret != AOM_CODEC_OK)
+    {
+        qWarning() << "aom_codec_dec_init failed: " << aom_codec_err_to_string(ret);
+
+        // The context is not initialized, so it is not destroyed by the deleter.
+        delete codec.release();
+        return nullptr;
+    }
+
+    return std::unique_ptr<VideoDecoderAV1>(new VideoDecoderAV1(std::move(codec)));
+}
+
+VideoDecoderAV1::VideoDecoderAV1(ScopedAomCodec codec)
+    : codec_(std::move(codec))
+{
+    // Nothing
+}
+
+bool VideoDecoderAV1::decode(const proto::desktop::VideoPacket& packet, DesktopFrame* frame)
+{
+    aom_image_t* image = decodeImage(packet, frame->size());
+    if (!image)
+        return false;
+
+    const QRect frame_rect(QPoint(), frame->size());
+
+    const int y_stride = image->stride[AOM_PLANE_Y];
+    const int uv_stride = image->stride[AOM_PLANE_U];
+
+    std::vector<QRect> rects;
+    if (!VideoUtil::dirtyRects(packet, &rects))
+    {
+        qWarning("The packed rectangles are malformed");
+        return false;
+    }
+
+    for (const QRect& rect : rects)
+    {
+        if (!frame_rect.contains(rect))
+        {
+            qWarning("The rectangle is outside the screen area");
+            return false;
+        }
+
+        const int y_offset = y_stride * rect.y() + rect.x();
+        const int uv_offset = uv_stride * (rect.y() / 2) + rect.x() / 2;
+
+        libyuv::I420ToARGB(image->planes[AOM_PLANE_Y] + y_offset, y_stride,
+                           image->planes[AOM_PLANE_U] + uv_offset, uv_stride,
+                           image->planes[AOM_PLANE_V] + uv_offset, uv_stride,
+                           frame->frameDataAtPos(rect.topLeft()),
+                           frame->stride(),
+                           rect.width(),
+                           rect.height());
+    }
+
+    return true;
+}
+
+bool VideoDecoderAV1::decodeYuv(const proto::desktop::VideoPacket& packet,
+                                std::unique_ptr<DesktopFrameYUV>* frame)
+{
+    aom_image_t* image = decodeImage(packet, (*frame)->size());
+    if (!image)
+        return false;
+
+    const QRect frame_rect(QPoint(), (*frame)->size());
+    QRegion region;
+
+    if ((*frame)->layout() != DesktopFrameYUV::Layout::I420)
+    {
+        *frame = DesktopFrameYUV::create(frame_rect.size(), DesktopFrameYUV::Layout::I420);
+        if (!*frame)
+            return false;
+
+        // The decoded image contains the whole screen.
+        region = frame_rect;
+    }
+    else
+    {
+        std::vector<QRect> rects;
+        if (!VideoUtil::dirtyRects(packet, &rects))
+        {
+            qWarning("The packed rectangles are malformed");
+            return false;
+        }
+
+        for (const QRect& rect : rects)
+        {
+            if (!frame_rect.contains(rect))
+            {
+                qWarning("The rectangle is outside the screen area");
+                return false;
+            }
+
+            region += rect;
+        }
+    }
+
+    DesktopFrameYUV* target = frame->get();
+
+    // The planes are copied without the conversion.
+    for (const auto& rect : region)
+    {
+        for (int plane = 0; plane < DesktopFrameYUV::kPlaneCount; ++plane)
+        {
+            const QRect plane_rect = target->planeRect(plane, rect);
+
+            const quint8* src = image->planes[plane] +
+                plane_rect.top() * image->stride[plane] + plane_rect.left();
+            quint8* dst = target->plane(plane) +
+                plane_rect.top() * target->stride(plane) + plane_rect.left();
+
+            libyuv::CopyPlane(src, image->stride[plane], dst, target->stride(plane),
+                              plane_rect.width(), plane_rect.height());
+        }
+    }
+
+    return true;
+}
+
+aom_image_t* VideoDecoderAV1::decodeImage(const proto::desktop::VideoPacket& packet,
+                                          const QSize& size)
+{
+    aom_codec_err_t ret =
+        aom_codec_decode(codec_.get(),
+                         reinterpret_cast<const quint8*>(packet.data().data()),
+                         packet.data().size(),
+                         nullptr);
+    if (ret != AOM_CODEC_OK)
+    {
+        const char* error = aom_codec_error(codec_.get());
+        const char* error_detail = aom_codec_error_detail(codec_.get());
+
+        qWarning() << "Decoding failed:" << (error ? error : "(NULL)") << "\n"
+                   << "Details: " << (error_detail ? error_detail : "(NULL)");
+        return nullptr;
+    }
+
+    aom_codec_iter_t iter = nullptr;
+
+    // Gets the decoded data.
+    aom_image_t* image = aom_codec_get_frame(codec_.get(), &iter);
+    if (!image)
+    {
+        qWarning("No video frame decoded");
+        return nullptr;
+    }
+
+    // The host encodes only 8 bit I420 images.
+    if (image->fmt != AOM_IMG_FMT_I420)
+    {
+        qWarning() << "Unsupported image format: " << image->fmt;
+        return nullptr;
+    }
+
+    if (QSize(image->d_w, image->d_h) != size)
+    {
+        qWarning("Size of the encoded frame doesn't match size in the header");
+        return nullptr;
+    }
+
+    return image;
+}
+
+} // namespace aspia
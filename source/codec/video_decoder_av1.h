@@ -0,0 +1,47 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/video_decoder_av1.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CODEC__VIDEO_DECODER_AV1_H
+#define _ASPIA_CODEC__VIDEO_DECODER_AV1_H
+
+extern "C" {
+#include <aom/aom_decoder.h>
+#include <aom/aomdx.h>
+} // extern "C"
+
+#include "codec/scoped_aom_codec.h"
+#include "codec/video_decoder.h"
+
+namespace aspia {
+
+class VideoDecoderAV1 : public VideoDecoder
+{
+public:
+    ~VideoDecoderAV1() = default;
+
+    // Returns nullptr if the decoder can not be initialized.
+    static std::unique_ptr<VideoDecoderAV1> create();
+
+    bool decode(const proto::desktop::VideoPacket& packet, DesktopFrame* frame) override;
+    bool canDecodeYuv() const override { return true; }
+    bool decodeYuv(const proto::desktop::VideoPacket& packet,
+                   std::unique_ptr<DesktopFrameYUV>* frame) override;
+
+private:
+    explicit VideoDecoderAV1(ScopedAomCodec codec);
+
+    // Returns the decoded image or nullptr. The image is valid until the next call.
+    aom_image_t* decodeImage(const proto::desktop::VideoPacket& packet, const QSize& size);
+
+    ScopedAomCodec codec_;
+
+    Q_DISABLE_COPY(VideoDecoderAV1)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_CODEC__VIDEO_DECODER_AV1_H
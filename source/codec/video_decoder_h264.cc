@@ -0,0 +1,484 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/video_decoder_h264.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "codec/video_decoder_h264.h"
+
+#include <QDebug>
+
+#include <codecapi.h>
+#include <d3d10.h>
+#include <mferror.h>
+
+#include <libyuv/convert_argb.h>
+
+#include "codec/video_util.h"
+
+namespace aspia {
+
+namespace {
+
+// Duration of the frame in 100-nanosecond units. The decoder does not use the timestamps, but
+// they must increase.
+constexpr LONGLONG kFrameDuration = 10000000 / 30;
+
+// MFCreateDXGIDeviceManager is available since Windows 8.
+typedef HRESULT(WINAPI* MFCreateDXGIDeviceManagerFunc)(UINT*, IMFDXGIDeviceManager**);
+
+} // namespace
+
+VideoDecoderH264::~VideoDecoderH264()
+{
+    // The objects of Media Foundation must be released before the shutdown.
+    transform_.Reset();
+    device_manager_.Reset();
+    device_.Reset();
+
+    if (media_foundation_started_)
+        MFShutdown();
+}
+
+// static
+std::unique_ptr<VideoDecoderH264> VideoDecoderH264::create()
+{
+    std::unique_ptr<VideoDecoderH264> decoder(new VideoDecoderH264());
+
+    HRESULT hr = MFStartup(MF_VERSION, MFSTARTUP_LITE);
+    if (FAILED(hr))
+    {
+        qWarning("MFStartup failed: 0x%08X", hr);
+        return nullptr;
+    }
+
+    decoder->media_foundation_started_ = true;
+
+    if (!decoder->createTransform())
+        return nullptr;
+
+    return decoder;
+}
+
+bool VideoDecoderH264::createTransform()
+{
+    MFT_REGISTER_TYPE_INFO input_type_info = { MFMediaType_Video, MFVideoFormat_H264 };
+    MFT_REGISTER_TYPE_INFO output_type_info = { MFMediaType_Video, MFVideoFormat_NV12 };
+
+    IMFActivate** activates = nullptr;
+    UINT32 count = 0;
+
+    HRESULT hr = MFTEnumEx(MFT_CATEGORY_VIDEO_DECODER,
+                           MFT_ENUM_FLAG_SYNCMFT | MFT_ENUM_FLAG_SORTANDFILTER,
+                           &input_type_info,
+                           &output_type_info,
+                           &activates,
+                           &count);
+    if (FAILED(hr))
+    {
+        qWarning("MFTEnumEx failed: 0x%08X", hr);
+        return false;
+    }
+
+    if (count)
+        hr = activates[0]->ActivateObject(IID_PPV_ARGS(transform_.GetAddressOf()));
+
+    for (UINT32 i = 0; i < count; ++i)
+        activates[i]->Release();
+
+    CoTaskMemFree(activates);
+
+    if (!count)
+    {
+        qWarning("H.264 decoder not found");
+        return false;
+    }
+
+    if (FAILED(hr))
+    {
+        qWarning("ActivateObject failed: 0x%08X", hr);
+        return false;
+    }
+
+    // The device manager must be set before the media types.
+    enableHardwareAcceleration();
+
+    Microsoft::WRL::ComPtr<IMFAttributes> attributes;
+
+    hr = transform_->GetAttributes(attributes.GetAddressOf());
+    if (SUCCEEDED(hr))
+    {
+        // The decoder outputs the picture immediately after the input without buffering.
+        attributes->SetUINT32(CODECAPI_AVLowLatencyMode, TRUE);
+    }
+
+    Microsoft::WRL::ComPtr<IMFMediaType> input_type;
+
+    hr = MFCreateMediaType(input_type.GetAddressOf());
+    if (SUCCEEDED(hr))
+        hr = input_type->SetGUID(MF_MT_MAJOR_TYPE, MFMediaType_Video);
+    if (SUCCEEDED(hr))
+        hr = input_type->SetGUID(MF_MT_SUBTYPE, MFVideoFormat_H264);
+    if (SUCCEEDED(hr))
+        hr = input_type->SetUINT32(MF_MT_INTERLACE_MODE, MFVideoInterlace_Progressive);
+    if (SUCCEEDED(hr))
+        hr = transform_->SetInputType(0, input_type.Get(), 0);
+
+    if (FAILED(hr))
+    {
+        qWarning("Unable to set the input type: 0x%08X", hr);
+        return false;
+    }
+
+    if (!setOutputType())
+        return false;
+
+    hr = transform_->ProcessMessage(MFT_MESSAGE_NOTIFY_BEGIN_STREAMING, 0);
+    if (SUCCEEDED(hr))
+        hr = transform_->ProcessMessage(MFT_MESSAGE_NOTIFY_START_OF_STREAM, 0);
+
+    if (FAILED(hr))
+    {
+        qWarning("Unable to start the stream: 0x%08X", hr);
+        return false;
+    }
+
+    return true;
+}
+
+void VideoDecoderH264::enableHardwareAcceleration()
+{
+    Microsoft::WRL::ComPtr<IMFAttributes> attributes;
+
+    HRESULT hr = transform_->GetAttributes(attributes.GetAddressOf());
+    if (FAILED(hr))
+        return;
+
+    UINT32 is_d3d11_aware = FALSE;
+
+    if (FAILED(attributes->GetUINT32(MF_SA_D3D11_AWARE, &is_d3d11_aware)) || !is_d3d11_aware)
+    {
+        qInfo("The decoder does not support Direct3D 11. Software decoding is used");
+        return;
+    }
+
+    HMODULE mfplat_module = GetModuleHandleW(L"mfplat.dll");
+    if (!mfplat_module)
+        return;
+
+    MFCreateDXGIDeviceManagerFunc create_device_manager_func =
+        reinterpret_cast<MFCreateDXGIDeviceManagerFunc>(
+            GetProcAddress(mfplat_module, "MFCreateDXGIDeviceManager"));
+    if (!create_device_manager_func)
+        return;
+
+    hr = D3D11CreateDevice(nullptr,
+                           D3D_DRIVER_TYPE_HARDWARE,
+                           nullptr,
+                           D3D11_CREATE_DEVICE_VIDEO_SUPPORT | D3D11_CREATE_DEVICE_BGRA_SUPPORT,
+                           nullptr,
+                           0,
+                           D3D11_SDK_VERSION,
+                           device_.GetAddressOf(),
+                           nullptr,
+                           nullptr);
+    if (FAILED(hr))
+    {
+        qWarning("D3D11CreateDevice failed: 0x%08X", hr);
+        return;
+    }
+
+    // The device is used by the decoder from its own threads.
+    Microsoft::WRL::ComPtr<ID3D10Multithread> multithread;
+
+    hr = device_.As(&multithread);
+    if (SUCCEEDED(hr))
+        multithread->SetMultithreadProtected(TRUE);
+
+    UINT reset_token = 0;
+
+    hr = create_device_manager_func(&reset_token, device_manager_.GetAddressOf());
+    if (SUCCEEDED(hr))
+        hr = device_manager_->ResetDevice(device_.Get(), reset_token);
+    if (SUCCEEDED(hr))
+    {
+        hr = transform_->ProcessMessage(MFT_MESSAGE_SET_D3D_MANAGER,
+                                        reinterpret_cast<ULONG_PTR>(device_manager_.Get()));
+    }
+
+    if (FAILED(hr))
+    {
+        qWarning("Unable to enable the hardware acceleration: 0x%08X", hr);
+
+        device_manager_.Reset();
+        device_.Reset();
+        return;
+    }
+
+    qInfo("Hardware accelerated H.264 decoding is used");
+}
+
+bool VideoDecoderH264::setOutputType()
+{
+    for (DWORD type_index = 0;; ++type_index)
+    {
+        Microsoft::WRL::ComPtr<IMFMediaType> output_type;
+
+        HRESULT hr = transform_->GetOutputAvailableType(0, type_index,
+                                                        output_type.GetAddressOf());
+        if (FAILED(hr))
+        {
+            qWarning("NV12 output is not supported by the decoder: 0x%08X", hr);
+            return false;
+        }
+
+        GUID subtype = GUID_NULL;
+
+        hr = output_type->GetGUID(MF_MT_SUBTYPE, &subtype);
+        if (FAILED(hr) || subtype != MFVideoFormat_NV12)
+            continue;
+
+        hr = transform_->SetOutputType(0, output_type.Get(), 0);
+        if (FAILED(hr))
+        {
+            qWarning("SetOutputType failed: 0x%08X", hr);
+            return false;
+        }
+
+        UINT32 width = 0;
+        UINT32 height = 0;
+
+        MFGetAttributeSize(output_type.Get(), MF_MT_FRAME_SIZE, &width, &height);
+        picture_size_ = QSize(width, height);
+
+        UINT32 stride = 0;
+
+        if (FAILED(output_type->GetUINT32(MF_MT_DEFAULT_STRIDE, &stride)))
+            stride = width;
+
+        default_stride_ = static_cast<LONG>(stride);
+        return true;
+    }
+}
+
+bool VideoDecoderH264::processInput(const std::string& data)
+{
+    Microsoft::WRL::ComPtr<IMFMediaBuffer> buffer;
+
+    HRESULT hr = MFCreateMemoryBuffer(static_cast<DWORD>(data.size()), buffer.GetAddressOf());
+    if (FAILED(hr))
+    {
+        qWarning("MFCreateMemoryBuffer failed: 0x%08X", hr);
+        return false;
+    }
+
+    BYTE* buffer_data = nullptr;
+
+    hr = buffer->Lock(&buffer_data, nullptr, nullptr);
+    if (FAILED(hr))
+    {
+        qWarning("IMFMediaBuffer::Lock failed: 0x%08X", hr);
+        return false;
+    }
+
+    memcpy(buffer_data, data.data(), data.size());
+
+    buffer->Unlock();
+    buffer->SetCurrentLength(static_cast<DWORD>(data.size()));
+
+    Microsoft::WRL::ComPtr<IMFSample> sample;
+
+    hr = MFCreateSample(sample.GetAddressOf());
+    if (SUCCEEDED(hr))
+        hr = sample->AddBuffer(buffer.Get());
+    if (SUCCEEDED(hr))
+        hr = sample->SetSampleTime(timestamp_);
+    if (SUCCEEDED(hr))
+        hr = sample->SetSampleDuration(kFrameDuration);
+
+    if (FAILED(hr))
+    {
+        qWarning("Unable to create the sample: 0x%08X", hr);
+        return false;
+    }
+
+    timestamp_ += kFrameDuration;
+
+    hr = transform_->ProcessInput(0, sample.Get(), 0);
+    if (FAILED(hr))
+    {
+        qWarning("ProcessInput failed: 0x%08X", hr);
+        return false;
+    }
+
+    return true;
+}
+
+HRESULT VideoDecoderH264::processOutput(Microsoft::WRL::ComPtr<IMFSample>* sample)
+{
+    while (true)
+    {
+        MFT_OUTPUT_STREAM_INFO stream_info;
+        memset(&stream_info, 0, sizeof(stream_info));
+
+        HRESULT hr = transform_->GetOutputStreamInfo(0, &stream_info);
+        if (FAILED(hr))
+            return hr;
+
+        const bool provides_samples = (stream_info.dwFlags &
+            (MFT_OUTPUT_STREAM_PROVIDES_SAMPLES | MFT_OUTPUT_STREAM_CAN_PROVIDE_SAMPLES)) != 0;
+
+        sample->Reset();
+
+        MFT_OUTPUT_DATA_BUFFER output;
+        memset(&output, 0, sizeof(output));
+
+        if (!provides_samples)
+        {
+            Microsoft::WRL::ComPtr<IMFMediaBuffer> buffer;
+
+            hr = MFCreateMemoryBuffer(stream_info.cbSize, buffer.GetAddressOf());
+            if (SUCCEEDED(hr))
+                hr = MFCreateSample(sample->GetAddressOf());
+            if (SUCCEEDED(hr))
+                hr = (*sample)->AddBuffer(buffer.Get());
+
+            if (FAILED(hr))
+                return hr;
+
+            output.pSample = sample->Get();
+        }
+
+        DWORD status = 0;
+
+        hr = transform_->ProcessOutput(0, 1, &output, &status);
+
+        if (output.pEvents)
+            output.pEvents->Release();
+
+        // The sample provided by the decoder is owned by the caller.
+        if (provides_samples && output.pSample)
+            sample->Attach(output.pSample);
+
+        if (hr == MF_E_TRANSFORM_STREAM_CHANGE)
+        {
+            // The decoder has parsed the stream and the picture size is known now.
+            if (!setOutputType())
+                return hr;
+
+            continue;
+        }
+
+        return hr;
+    }
+}
+
+bool VideoDecoderH264::convertPicture(IMFSample* sample, DesktopFrame* frame)
+{
+    Microsoft::WRL::ComPtr<IMFMediaBuffer> buffer;
+
+    HRESULT hr = sample->ConvertToContiguousBuffer(buffer.GetAddressOf());
+    if (FAILED(hr))
+    {
+        qWarning("ConvertToContiguousBuffer failed: 0x%08X", hr);
+        return false;
+    }
+
+    // The buffers of DXVA are locked through IMF2DBuffer, which returns the actual pitch of
+    // the surface.
+    Microsoft::WRL::ComPtr<IMF2DBuffer> buffer_2d;
+
+    BYTE* data = nullptr;
+    LONG pitch = default_stride_;
+
+    if (SUCCEEDED(buffer.As(&buffer_2d)))
+        hr = buffer_2d->Lock2D(&data, &pitch);
+    else
+        hr = buffer->Lock(&data, nullptr, nullptr);
+
+    if (FAILED(hr))
+    {
+        qWarning("Unable to lock the picture: 0x%08X", hr);
+        return false;
+    }
+
+    const quint8* y_data = data;
+    const quint8* uv_data = data + pitch * picture_size_.height();
+    const QRect picture_rect(QPoint(), picture_size_);
+
+    for (const auto& rect : pending_region_)
+    {
+        if (!picture_rect.contains(rect))
+            continue;
+
+        // The chroma of NV12 is subsampled 2x2, so the rectangle starts at even coordinates.
+        const int x = rect.x() & ~1;
+        const int y = rect.y() & ~1;
+
+        libyuv::NV12ToARGB(y_data + pitch * y + x, pitch,
+                           uv_data + pitch * (y / 2) + x, pitch,
+                           frame->frameDataAtPos(x, y),
+                           frame->stride(),
+                           rect.x() + rect.width() - x,
+                           rect.y() + rect.height() - y);
+    }
+
+    if (buffer_2d)
+        buffer_2d->Unlock2D();
+    else
+        buffer->Unlock();
+
+    pending_region_ = QRegion();
+    return true;
+}
+
+bool VideoDecoderH264::decode(const proto::desktop::VideoPacket& packet, DesktopFrame* frame)
+{
+    const QRect frame_rect(QPoint(), frame->size());
+
+    std::vector<QRect> rects;
+    if (!VideoUtil::dirtyRects(packet, &rects))
+    {
+        qWarning("The packed rectangles are malformed");
+        return false;
+    }
+
+    for (const QRect& rect : rects)
+    {
+        if (!frame_rect.contains(rect))
+        {
+            qWarning("The rectangle is outside the screen area");
+            return false;
+        }
+
+        pending_region_ += rect;
+    }
+
+    // The encoder may send the packet without the data if the picture is delayed.
+    if (packet.data().empty())
+        return true;
+
+    if (!processInput(packet.data()))
+        return false;
+
+    while (true)
+    {
+        Microsoft::WRL::ComPtr<IMFSample> sample;
+
+        HRESULT hr = processOutput(&sample);
+        if (hr == MF_E_TRANSFORM_NEED_MORE_INPUT)
+            return true;
+
+        if (FAILED(hr))
+        {
+            qWarning("ProcessOutput failed: 0x%08X", hr);
+            return false;
+        }
+
+        if (sample && !convertPicture(sample.Get(), frame))
+            return false;
+    }
+}
+
+} // namespace aspia
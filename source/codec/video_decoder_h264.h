@@ -0,0 +1,67 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/video_decoder_h264.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CODEC__VIDEO_DECODER_H264_H
+#define _ASPIA_CODEC__VIDEO_DECODER_H264_H
+
+#include <QRegion>
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <d3d11.h>
+#include <mfapi.h>
+#include <mftransform.h>
+#include <wrl/client.h>
+
+#include "codec/video_decoder.h"
+
+namespace aspia {
+
+//
+// H.264 decoder based on the decoder of Media Foundation. If the decoder supports Direct3D 11,
+// then the decoding is made by the GPU (DXVA).
+//
+class VideoDecoderH264 : public VideoDecoder
+{
+public:
+    ~VideoDecoderH264();
+
+    static std::unique_ptr<VideoDecoderH264> create();
+
+    bool decode(const proto::desktop::VideoPacket& packet, DesktopFrame* frame) override;
+
+private:
+    VideoDecoderH264() = default;
+
+    bool createTransform();
+    void enableHardwareAcceleration();
+    bool setOutputType();
+    bool processInput(const std::string& data);
+    HRESULT processOutput(Microsoft::WRL::ComPtr<IMFSample>* sample);
+    bool convertPicture(IMFSample* sample, DesktopFrame* frame);
+
+    bool media_foundation_started_ = false;
+
+    Microsoft::WRL::ComPtr<ID3D11Device> device_;
+    Microsoft::WRL::ComPtr<IMFDXGIDeviceManager> device_manager_;
+    Microsoft::WRL::ComPtr<IMFTransform> transform_;
+
+    // Size and stride of the decoded pictures.
+    QSize picture_size_;
+    LONG default_stride_ = 0;
+
+    // Rectangles of the packets whose pictures have not been received from the decoder yet.
+    QRegion pending_region_;
+
+    LONGLONG timestamp_ = 0;
+
+    Q_DISABLE_COPY(VideoDecoderH264)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_CODEC__VIDEO_DECODER_H264_H
@@ -0,0 +1,51 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/video_decoder_hybrid.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "codec/video_decoder_hybrid.h"
+
+#include <QDebug>
+
+namespace aspia {
+
+// static
+std::unique_ptr<VideoDecoderHybrid> VideoDecoderHybrid::create()
+{
+    return std::unique_ptr<VideoDecoderHybrid>(new VideoDecoderHybrid());
+}
+
+bool VideoDecoderHybrid::decode(const proto::desktop::VideoPacket& packet, DesktopFrame* frame)
+{
+    for (int i = 0; i < packet.layer_size(); ++i)
+    {
+        const proto::desktop::VideoPacket& layer = packet.layer(i);
+
+        if (layer.encoding() == proto::desktop::VIDEO_ENCODING_HYBRID)
+        {
+            qWarning("Nested hybrid layers are not allowed");
+            return false;
+        }
+
+        std::unique_ptr<VideoDecoder>& decoder = decoders_[layer.encoding()];
+
+        if (!decoder)
+        {
+            decoder = VideoDecoder::create(layer.encoding());
+            if (!decoder)
+            {
+                qWarning() << "Unsupported layer encoding:" << layer.encoding();
+                return false;
+            }
+        }
+
+        if (!decoder->decode(layer, frame))
+            return false;
+    }
+
+    return true;
+}
+
+} // namespace aspia
@@ -0,0 +1,37 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/video_decoder_hybrid.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CODEC__VIDEO_DECODER_HYBRID_H
+#define _ASPIA_CODEC__VIDEO_DECODER_HYBRID_H
+
+#include <map>
+
+#include "codec/video_decoder.h"
+
+namespace aspia {
+
+class VideoDecoderHybrid : public VideoDecoder
+{
+public:
+    ~VideoDecoderHybrid() = default;
+
+    static std::unique_ptr<VideoDecoderHybrid> create();
+
+    bool decode(const proto::desktop::VideoPacket& packet, DesktopFrame* frame) override;
+
+private:
+    VideoDecoderHybrid() = default;
+
+    // Decoders of the layers. They are created when the layer is received first time.
+    std::map<proto::desktop::VideoEncoding, std::unique_ptr<VideoDecoder>> decoders_;
+
+    Q_DISABLE_COPY(VideoDecoderHybrid)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_CODEC__VIDEO_DECODER_HYBRID_H
@@ -0,0 +1,392 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/video_decoder_palette.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "codec/video_decoder_palette.h"
+
+#include <QDebug>
+
+#include <cstring>
+
+#include "codec/video_encoder_palette.h"
+#include "codec/video_util.h"
+
+namespace aspia {
+
+//
+// Each chunk of the packet is the data of the dirty rectangle with the same index (a tile of
+// 64x64 pixels or less). The first byte of the chunk is the type of the tile:
+//
+// TILE_TYPE_SOLID: the color of all pixels of the tile (4 bytes).
+//
+// TILE_TYPE_PALETTE: the number of colors N (1 byte), N colors (4 bytes each) and the runs of
+// the pixels from left to right and from top to bottom. A run may continue on the next row.
+// The low 7 bits of the first byte of the run are the index of the color. If the high bit is
+// not set, the run is one pixel. Otherwise the length of the run minus two follows in the
+// groups of 7 bits, the lowest group first; the high bit of the groups except the last one
+// is set.
+//
+// TILE_TYPE_RAW: the pixels of the tile without the padding compressed with ZLIB. Each raw
+// tile is compressed by a separate stream.
+//
+// TILE_TYPE_CACHED: the slot of the tile cache (2 bytes) which contains the tile of the same
+// size.
+//
+// If the cache is used (VideoPacketFormat::tile_cache_size is not zero), then the type of the
+// tile may contain kCacheFlag. In this case the slot (2 bytes) follows the type and the tile
+// is stored in the slot after it is decoded. The cache is cleared by the format.
+//
+// The colors and pixels are in the pixel format of the packet (32 bits per pixel).
+//
+
+namespace {
+
+using TileType = VideoEncoderPalette::TileType;
+
+constexpr quint8 kRunFlag = 0x80;
+constexpr int kBytesPerPixel = 4;
+
+void fillRow(quint32* dst, quint32 color, int count)
+{
+    for (int i = 0; i < count; ++i)
+        dst[i] = color;
+}
+
+quint32 readColor(const quint8* src)
+{
+    quint32 color;
+    memcpy(&color, src, sizeof(color));
+    return color;
+}
+
+int readSlot(const quint8* src)
+{
+    return src[0] | (src[1] << 8);
+}
+
+} // namespace
+
+VideoDecoderPalette::VideoDecoderPalette(std::unique_ptr<Decompressor> decompressor)
+    : decompressor_(std::move(decompressor))
+{
+    // Nothing
+}
+
+// static
+std::unique_ptr<VideoDecoderPalette> VideoDecoderPalette::create()
+{
+    std::unique_ptr<Decompressor> decompressor =
+        Decompressor::create(proto::desktop::COMPRESSION_ZLIB);
+    if (!decompressor)
+        return nullptr;
+
+    return std::unique_ptr<VideoDecoderPalette>(
+        new VideoDecoderPalette(std::move(decompressor)));
+}
+
+bool VideoDecoderPalette::decode(const proto::desktop::VideoPacket& packet,
+                                 DesktopFrame* target_frame)
+{
+    if (packet.has_format())
+    {
+        const PixelFormat format =
+            VideoUtil::fromVideoPixelFormat(packet.format().pixel_format());
+
+        // The tiles are written to the frame without the translation.
+        if (format.bytesPerPixel() != kBytesPerPixel || format != target_frame->format())
+        {
+            qWarning("Unsupported pixel format");
+            return false;
+        }
+
+        has_format_ = true;
+        tile_cache_.reset();
+
+        const quint32 tile_cache_size = packet.format().tile_cache_size();
+        if (tile_cache_size != 0)
+        {
+            if (!TileCache::isValidCacheSize(static_cast<int>(tile_cache_size)))
+            {
+                qWarning() << "Invalid tile cache size: " << tile_cache_size;
+                return false;
+            }
+
+            tile_cache_ = std::make_unique<TileCache>(static_cast<int>(tile_cache_size));
+        }
+    }
+
+    if (!has_format_)
+    {
+        qWarning("A packet with image information was not received");
+        return false;
+    }
+
+    std::vector<QRect> tiles;
+    if (!VideoUtil::dirtyRects(packet, &tiles))
+    {
+        qWarning("The packed rectangles are malformed");
+        return false;
+    }
+
+    if (static_cast<size_t>(packet.chunk_size()) != tiles.size())
+    {
+        qWarning("The number of chunks does not match the number of rectangles");
+        return false;
+    }
+
+    const QRect frame_rect = QRect(QPoint(), target_frame->size());
+
+    for (int i = 0; i < packet.chunk_size(); ++i)
+    {
+        const QRect& tile = tiles[i];
+
+        if (!frame_rect.contains(tile) ||
+            tile.width() > VideoEncoderPalette::kTileSize ||
+            tile.height() > VideoEncoderPalette::kTileSize)
+        {
+            qWarning("The rectangle is outside the screen area");
+            return false;
+        }
+
+        if (!decodeTile(packet.chunk(i), tile, target_frame))
+        {
+            qWarning("Failed to decode the tile");
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool VideoDecoderPalette::decodeTile(const std::string& chunk,
+                                     const QRect& tile,
+                                     DesktopFrame* target_frame)
+{
+    if (chunk.empty())
+        return false;
+
+    const quint8* src = reinterpret_cast<const quint8*>(chunk.data()) + 1;
+    size_t src_size = chunk.size() - 1;
+
+    quint8 type = static_cast<quint8>(chunk[0]);
+    int slot = TileCache::kInvalidSlot;
+
+    if (type == TileType::TILE_TYPE_CACHED || (type & VideoEncoderPalette::kCacheFlag))
+    {
+        if (!tile_cache_ || src_size < 2)
+            return false;
+
+        slot = readSlot(src);
+        src += 2;
+        src_size -= 2;
+
+        if (type == TileType::TILE_TYPE_CACHED)
+            return src_size == 0 && decodeCachedTile(slot, tile, target_frame);
+
+        type &= ~VideoEncoderPalette::kCacheFlag;
+    }
+
+    bool result;
+
+    switch (type)
+    {
+        case TileType::TILE_TYPE_SOLID:
+            result = decodeSolidTile(src, src_size, tile, target_frame);
+            break;
+
+        case TileType::TILE_TYPE_PALETTE:
+            result = decodePaletteTile(src, src_size, tile, target_frame);
+            break;
+
+        case TileType::TILE_TYPE_RAW:
+            result = decodeRawTile(src, src_size, tile, target_frame);
+            break;
+
+        default:
+            return false;
+    }
+
+    if (!result || slot == TileCache::kInvalidSlot)
+        return result;
+
+    return tile_cache_->store(slot,
+                              tile.size(),
+                              target_frame->frameDataAtPos(tile.topLeft()),
+                              target_frame->stride());
+}
+
+bool VideoDecoderPalette::decodeCachedTile(int slot,
+                                           const QRect& tile,
+                                           DesktopFrame* target_frame)
+{
+    const quint8* pixels = tile_cache_->pixels(slot, tile.size());
+    if (!pixels)
+        return false;
+
+    const size_t row_size = tile.width() * kBytesPerPixel;
+
+    for (int y = 0; y < tile.height(); ++y)
+    {
+        memcpy(target_frame->frameDataAtPos(tile.left(), tile.top() + y),
+               pixels + y * row_size,
+               row_size);
+    }
+
+    return true;
+}
+
+bool VideoDecoderPalette::decodeSolidTile(const quint8* src,
+                                          size_t src_size,
+                                          const QRect& tile,
+                                          DesktopFrame* target_frame)
+{
+    if (src_size != sizeof(quint32))
+        return false;
+
+    const quint32 color = readColor(src);
+
+    for (int y = tile.top(); y <= tile.bottom(); ++y)
+    {
+        fillRow(reinterpret_cast<quint32*>(target_frame->frameDataAtPos(tile.left(), y)),
+                color, tile.width());
+    }
+
+    return true;
+}
+
+bool VideoDecoderPalette::decodePaletteTile(const quint8* src,
+                                            size_t src_size,
+                                            const QRect& tile,
+                                            DesktopFrame* target_frame)
+{
+    if (src_size < 1)
+        return false;
+
+    const int palette_size = src[0];
+    if (palette_size < 2 || palette_size > VideoEncoderPalette::kMaxPaletteSize)
+        return false;
+
+    size_t pos = 1 + palette_size * sizeof(quint32);
+    if (pos > src_size)
+        return false;
+
+    quint32 palette[VideoEncoderPalette::kMaxPaletteSize];
+
+    for (int i = 0; i < palette_size; ++i)
+        palette[i] = readColor(src + 1 + i * sizeof(quint32));
+
+    int x = 0;
+    int y = 0;
+
+    while (y < tile.height())
+    {
+        if (pos >= src_size)
+            return false;
+
+        const quint8 value = src[pos++];
+        const quint8 index = value & ~kRunFlag;
+
+        if (index >= palette_size)
+            return false;
+
+        quint32 length = 1;
+
+        if (value & kRunFlag)
+        {
+            quint32 extra = 0;
+            int shift = 0;
+
+            for (;;)
+            {
+                // A tile has at most kTileSize * kTileSize pixels, so three groups are enough.
+                if (pos >= src_size || shift > 14)
+                    return false;
+
+                const quint8 group = src[pos++];
+                extra |= static_cast<quint32>(group & 0x7F) << shift;
+                shift += 7;
+
+                if (!(group & 0x80))
+                    break;
+            }
+
+            length = extra + 2;
+        }
+
+        const quint32 color = palette[index];
+
+        // The run continues on the next rows.
+        while (length)
+        {
+            if (y >= tile.height())
+                return false;
+
+            const int count = static_cast<int>(qMin<quint32>(length, tile.width() - x));
+
+            fillRow(reinterpret_cast<quint32*>(
+                        target_frame->frameDataAtPos(tile.left() + x, tile.top() + y)),
+                    color, count);
+
+            length -= count;
+            x += count;
+
+            if (x == tile.width())
+            {
+                x = 0;
+                ++y;
+            }
+        }
+    }
+
+    return pos == src_size;
+}
+
+bool VideoDecoderPalette::decodeRawTile(const quint8* src,
+                                        size_t src_size,
+                                        const QRect& tile,
+                                        DesktopFrame* target_frame)
+{
+    const size_t row_size = tile.width() * kBytesPerPixel;
+    const size_t output_size = row_size * tile.height();
+
+    pixels_.resize(output_size);
+
+    decompressor_->reset();
+
+    size_t used = 0;
+    size_t filled = 0;
+    bool decompress_again = true;
+
+    while (decompress_again && filled < output_size)
+    {
+        size_t consumed = 0;
+        size_t written = 0;
+
+        decompress_again = decompressor_->process(src + used, src_size - used,
+                                                  pixels_.data() + filled, output_size - filled,
+                                                  &consumed, &written);
+        used += consumed;
+        filled += written;
+
+        // The data is truncated.
+        if (!consumed && !written)
+            break;
+    }
+
+    if (filled != output_size)
+        return false;
+
+    for (int y = 0; y < tile.height(); ++y)
+    {
+        memcpy(target_frame->frameDataAtPos(tile.left(), tile.top() + y),
+               pixels_.data() + y * row_size,
+               row_size);
+    }
+
+    return true;
+}
+
+} // namespace aspia
@@ -0,0 +1,56 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/video_decoder_palette.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CODEC__VIDEO_DECODER_PALETTE_H
+#define _ASPIA_CODEC__VIDEO_DECODER_PALETTE_H
+
+#include <QRect>
+
+#include <vector>
+
+#include "codec/decompressor.h"
+#include "codec/video_decoder.h"
+#include "desktop_capture/tile_cache.h"
+
+namespace aspia {
+
+class VideoDecoderPalette : public VideoDecoder
+{
+public:
+    ~VideoDecoderPalette() = default;
+
+    static std::unique_ptr<VideoDecoderPalette> create();
+
+    bool decode(const proto::desktop::VideoPacket& packet, DesktopFrame* target_frame) override;
+
+private:
+    explicit VideoDecoderPalette(std::unique_ptr<Decompressor> decompressor);
+
+    bool decodeTile(const std::string& chunk, const QRect& tile, DesktopFrame* target_frame);
+    bool decodeCachedTile(int slot, const QRect& tile, DesktopFrame* target_frame);
+    bool decodeSolidTile(const quint8* src, size_t src_size, const QRect& tile,
+                         DesktopFrame* target_frame);
+    bool decodePaletteTile(const quint8* src, size_t src_size, const QRect& tile,
+                           DesktopFrame* target_frame);
+    bool decodeRawTile(const quint8* src, size_t src_size, const QRect& tile,
+                       DesktopFrame* target_frame);
+
+    std::unique_ptr<Decompressor> decompressor_;
+    bool has_format_ = false;
+
+    // The tiles received since the last format, if the host has requested the cache.
+    std::unique_ptr<TileCache> tile_cache_;
+
+    // The decompressed pixels of the current raw tile.
+    std::vector<quint8> pixels_;
+
+    Q_DISABLE_COPY(VideoDecoderPalette)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_CODEC__VIDEO_DECODER_PALETTE_H
@@ -9,8 +9,10 @@
 
 #include <libyuv/convert_from.h>
 #include <libyuv/convert_argb.h>
+#include <libyuv/planar_functions.h>
 
 #include <QDebug>
+#include <QThread>
 
 #include "codec/video_util.h"
 
@@ -18,12 +20,23 @@ namespace aspia {
 
 namespace {
 
+// Limit of the number of decoder threads. More threads do not speed up the decoding of the
+// tiles and rows of one frame.
+constexpr int kMaxThreads = 16;
+
 bool convertImage(const proto::desktop::VideoPacket& packet,
                   vpx_image_t* image,
                   DesktopFrame* frame)
 {
     QRect frame_rect = QRect(QPoint(), frame->size());
 
+    std::vector<QRect> rects;
+    if (!VideoUtil::dirtyRects(packet, &rects))
+    {
+        qWarning("The packed rectangles are malformed");
+        return false;
+    }
+
     quint8* y_data = image->planes[0];
     quint8* u_data = image->planes[1];
     quint8* v_data = image->planes[2];
@@ -36,10 +49,8 @@ bool convertImage(const proto::desktop::VideoPacket& packet,
         {
             int uv_stride = image->stride[1];
 
-            for (int i = 0; i < packet.dirty_rect_size(); ++i)
+            for (const QRect& rect : rects)
             {
-                QRect rect = VideoUtil::fromVideoRect(packet.dirty_rect(i));
-
                 if (!frame_rect.contains(rect))
                 {
                     qWarning("The rectangle is outside the screen area");
@@ -65,10 +76,8 @@ bool convertImage(const proto::desktop::VideoPacket& packet,
             int u_stride = image->stride[1];
             int v_stride = image->stride[2];
 
-            for (int i = 0; i < packet.dirty_rect_size(); ++i)
+            for (const QRect& rect : rects)
             {
-                QRect rect = VideoUtil::fromVideoRect(packet.dirty_rect(i));
-
                 if (!frame_rect.contains(rect))
                 {
                     qWarning("The rectangle is outside the screen area");
@@ -124,7 +133,8 @@ VideoDecoderVPX::VideoDecoderVPX(proto::desktop::VideoEncoding encoding)
 
     config.w = 0;
     config.h = 0;
-    config.threads = 2;
+    // Tiles of VP9 frames are decoded in parallel, one thread per core.
+    config.threads = qBound(1, QThread::idealThreadCount(), kMaxThreads);
 
     vpx_codec_iface_t* algo;
 
@@ -145,9 +155,108 @@ VideoDecoderVPX::VideoDecoderVPX(proto::desktop::VideoEncoding encoding)
 
     if (vpx_codec_dec_init(codec_.get(), algo, &config, 0) != VPX_CODEC_OK)
         qFatal("vpx_codec_dec_init failed");
+
+    if (encoding == proto::desktop::VIDEO_ENCODING_VP9 && config.threads > 1)
+    {
+        // The lossless stream of a large screen has a few tile columns, so the rows of the
+        // tiles are decoded in parallel too.
+        if (vpx_codec_control(codec_.get(), VP9D_SET_ROW_MT, 1) != VPX_CODEC_OK)
+            qWarning("Row based multi-threading of VP9 is not supported");
+    }
 }
 
 bool VideoDecoderVPX::decode(const proto::desktop::VideoPacket& packet, DesktopFrame* frame)
+{
+    vpx_image_t* image = decodeImage(packet, frame->size());
+    if (!image)
+        return false;
+
+    return convertImage(packet, image, frame);
+}
+
+bool VideoDecoderVPX::decodeYuv(const proto::desktop::VideoPacket& packet,
+                                std::unique_ptr<DesktopFrameYUV>* frame)
+{
+    vpx_image_t* image = decodeImage(packet, (*frame)->size());
+    if (!image)
+        return false;
+
+    DesktopFrameYUV::Layout layout;
+
+    switch (image->fmt)
+    {
+        case VPX_IMG_FMT_YV12:
+        case VPX_IMG_FMT_I420:
+            layout = DesktopFrameYUV::Layout::I420;
+            break;
+
+        case VPX_IMG_FMT_I444:
+            layout = DesktopFrameYUV::Layout::I444;
+            break;
+
+        default:
+            qWarning() << "Unsupported image format: " << image->fmt;
+            return false;
+    }
+
+    const QRect frame_rect(QPoint(), (*frame)->size());
+    QRegion region;
+
+    if ((*frame)->layout() != layout)
+    {
+        *frame = DesktopFrameYUV::create(frame_rect.size(), layout);
+        if (!*frame)
+            return false;
+
+        // The decoded image contains the whole screen.
+        region = frame_rect;
+    }
+    else
+    {
+        std::vector<QRect> rects;
+        if (!VideoUtil::dirtyRects(packet, &rects))
+        {
+            qWarning("The packed rectangles are malformed");
+            return false;
+        }
+
+        for (const QRect& rect : rects)
+        {
+            if (!frame_rect.contains(rect))
+            {
+                qWarning("The rectangle is outside the screen area");
+                return false;
+            }
+
+            region += rect;
+        }
+    }
+
+    DesktopFrameYUV* target = frame->get();
+
+    // The planes are copied without the conversion. The merged region does not copy the
+    // overlapping rectangles twice.
+    for (const auto& rect : region)
+    {
+        for (int plane = 0; plane < DesktopFrameYUV::kPlaneCount; ++plane)
+        {
+            const QRect plane_rect = target->planeRect(plane, rect);
+
+            const quint8* src = image->planes[plane] +
+                plane_rect.top() * image->stride[plane] + plane_rect.left();
+            quint8* dst = target->plane(plane) +
+                plane_rect.top() * target->stride(plane) + plane_rect.left();
+
+            libyuv::CopyPlane(src, image->stride[plane], dst, target->stride(plane),
+                              plane_rect.width(), plane_rect.height());
+        }
+    }
+
+    return true;
+}
+
+vpx_image_t* VideoDecoderVPX::decodeImage(const proto::desktop::VideoPacket& packet,
+                                          const QSize& size)
 {
     // Do the actual decoding.
     vpx_codec_err_t ret =
@@ -163,7 +272,7 @@ bool VideoDecoderVPX::decode(const proto::desktop::VideoPacket& packet, DesktopF
 
         qWarning() << "Decoding failed:" << (error ? error : "(NULL)") << "\n"
                    << "Details: " << (error_detail ? error_detail : "(NULL)");
-        return false;
+        return nullptr;
     }
 
     vpx_codec_iter_t iter = nullptr;
@@ -173,16 +282,16 @@ bool VideoDecoderVPX::decode(const proto::desktop::VideoPacket& packet, DesktopF
     if (!image)
     {
         qWarning("No video frame decoded");
-        return false;
+        return nullptr;
     }
 
-    if (QSize(image->d_w, image->d_h) != frame->size())
+    if (QSize(image->d_w, image->d_h) != size)
     {
         qWarning("Size of the encoded frame doesn't match size in the header");
-        return false;
+        return nullptr;
     }
 
-    return convertImage(packet, image, frame);
+    return image;
 }
 
 } // namespace aspia
@@ -30,10 +30,16 @@ public:
     static std::unique_ptr<VideoDecoderVPX> createVP9();
 
     bool decode(const proto::desktop::VideoPacket& packet, DesktopFrame* frame) override;
+    bool canDecodeYuv() const override { return true; }
+    bool decodeYuv(const proto::desktop::VideoPacket& packet,
+                   std::unique_ptr<DesktopFrameYUV>* frame) override;
 
 private:
     explicit VideoDecoderVPX(proto::desktop::VideoEncoding encoding);
 
+    // Returns the decoded image or nullptr. The image is valid until the next call.
+    vpx_image_t* decodeImage(const proto::desktop::VideoPacket& packet, const QSize& size);
+
     ScopedVpxCodec codec_;
 
     Q_DISABLE_COPY(VideoDecoderVPX)
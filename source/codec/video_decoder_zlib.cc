@@ -8,17 +8,184 @@
 #include "codec/video_decoder_zlib.h"
 
 #include <QDebug>
+#include <QThread>
 
+#include <atomic>
+#include <functional>
+
+#include "base/function_runnable.h"
 #include "codec/pixel_translator.h"
 #include "codec/video_util.h"
-#include "desktop_capture/desktop_frame_aligned.h"
+#include "desktop_capture/desktop_frame.h"
 
 namespace aspia {
 
+namespace {
+
+// The maximum number of threads of the parallel decoding.
+constexpr int kMaxThreads = 8;
+
+// The rows of the rectangle are decompressed by the strips of about this size. The strip is
+// translated while it is in the cache, and the decompressor fills many rows by one call.
+constexpr size_t kStripSize = 64 * 1024; // 64kB
+
+// Decompresses up to |size| bytes into |dst|. Returns the number of the written bytes.
+size_t decompressStrip(Decompressor* decompressor,
+                       const quint8* src,
+                       size_t src_size,
+                       size_t* used,
+                       quint8* dst,
+                       size_t size)
+{
+    size_t pos = 0;
+
+    // The decompressor can have the data of the strip after all input is consumed.
+    bool decompress_again = true;
+
+    while (decompress_again && pos < size)
+    {
+        size_t written = 0;
+        size_t consumed = 0;
+
+        decompress_again = decompressor->process(src + *used,
+                                                 src_size - *used,
+                                                 dst + pos,
+                                                 size - pos,
+                                                 &consumed,
+                                                 &written);
+        *used += consumed;
+        pos += written;
+
+        if (!consumed && !written)
+            break;
+    }
+
+    return pos;
+}
+
+// Decompresses the data of |rect| by the strips of rows into |buffer| and translates them to
+// |frame|. If |translator| is nullptr, the source has the format of |frame| and the rows are
+// decompressed straight into it. Returns true if the rectangle is completely filled.
+bool decompressRect(Decompressor* decompressor,
+                    const quint8* src,
+                    size_t src_size,
+                    size_t* used,
+                    PixelTranslator* translator,
+                    int src_bytes_per_pixel,
+                    std::vector<quint8>* buffer,
+                    DesktopFrame* frame,
+                    const QRect& rect)
+{
+    if (rect.isEmpty())
+        return true;
+
+    const size_t row_size = rect.width() * src_bytes_per_pixel;
+
+    if (!translator)
+    {
+        // The rows of the full width follow each other in the frame and are filled by one call.
+        const int strip_rows =
+            (static_cast<size_t>(frame->stride()) == row_size) ? rect.height() : 1;
+
+        for (int row_y = 0; row_y < rect.height(); row_y += strip_rows)
+        {
+            const size_t strip_size = strip_rows * row_size;
+
+            if (decompressStrip(decompressor, src, src_size, used,
+                                frame->frameDataAtPos(rect.x(), rect.y() + row_y),
+                                strip_size) != strip_size)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    const int strip_rows = static_cast<int>(qMax<size_t>(1, kStripSize / row_size));
+
+    if (buffer->size() < strip_rows * row_size)
+        buffer->resize(strip_rows * row_size);
+
+    int row_y = 0;
+
+    while (row_y < rect.height())
+    {
+        const int rows = qMin(strip_rows, rect.height() - row_y);
+        const size_t strip_pos = decompressStrip(decompressor, src, src_size, used,
+                                                 buffer->data(), rows * row_size);
+
+        // The complete rows of the unfinished strip are shown anyway.
+        const int complete_rows = static_cast<int>(strip_pos / row_size);
+
+        translator->translate(buffer->data(),
+                              static_cast<int>(row_size),
+                              frame->frameDataAtPos(rect.x(), rect.y() + row_y),
+                              frame->stride(),
+                              rect.width(),
+                              complete_rows);
+
+        if (complete_rows != rows)
+            return false;
+
+        row_y += rows;
+    }
+
+    return true;
+}
+
+// Consumes the end of the flushed data of the persistent stream. The data must not contain
+// more pixels.
+bool skipFlushedData(Decompressor* decompressor,
+                     const quint8* src,
+                     size_t src_size,
+                     size_t* used)
+{
+    quint8 buffer[16];
+
+    while (*used < src_size)
+    {
+        size_t written = 0;
+        size_t consumed = 0;
+
+        bool decompress_again = decompressor->process(src + *used,
+                                                      src_size - *used,
+                                                      buffer,
+                                                      sizeof(buffer),
+                                                      &consumed,
+                                                      &written);
+        *used += consumed;
+
+        if (written != 0)
+            return false;
+
+        if (!consumed || !decompress_again)
+            break;
+    }
+
+    return *used == src_size;
+}
+
+} // namespace
+
+VideoDecoderZLIB::VideoDecoderZLIB(proto::desktop::Compression compression,
+                                   std::unique_ptr<Decompressor> decompressor)
+    : compression_(compression),
+      decompressor_(std::move(decompressor))
+{
+    // Nothing
+}
+
 // static
-std::unique_ptr<VideoDecoderZLIB> VideoDecoderZLIB::create()
+std::unique_ptr<VideoDecoderZLIB> VideoDecoderZLIB::create(
+    proto::desktop::Compression compression)
 {
-    return std::unique_ptr<VideoDecoderZLIB>(new VideoDecoderZLIB());
+    std::unique_ptr<Decompressor> decompressor = Decompressor::create(compression);
+    if (!decompressor)
+        return nullptr;
+
+    return std::unique_ptr<VideoDecoderZLIB>(
+        new VideoDecoderZLIB(compression, std::move(decompressor)));
 }
 
 bool VideoDecoderZLIB::decode(const proto::desktop::VideoPacket& packet,
@@ -26,83 +193,173 @@ bool VideoDecoderZLIB::decode(const proto::desktop::VideoPacket& packet,
 {
     if (packet.has_format())
     {
-        source_frame_ = DesktopFrameAligned::create(
-            VideoUtil::fromVideoSize(packet.format().screen_size()),
-            VideoUtil::fromVideoPixelFormat(packet.format().pixel_format()));
+        source_size_ = VideoUtil::fromVideoSize(packet.format().screen_size());
+        source_format_ = VideoUtil::fromVideoPixelFormat(packet.format().pixel_format());
 
-        translator_ = PixelTranslator::create(source_frame_->format(), target_frame->format());
-    }
+        translator_ = PixelTranslator::create(source_format_, target_frame->format());
+        direct_decode_ = (source_format_ == target_frame->format());
+
+        // The persistent streams are restarted by the host with the format.
+        decompressor_->reset();
 
-    Q_ASSERT(source_frame_->size() == target_frame->size());
+        for (auto& decompressor : chunk_decompressors_)
+            decompressor->reset();
+    }
 
-    if (!source_frame_ || !translator_)
+    if (!translator_)
     {
         qWarning("A packet with image information was not received");
         return false;
     }
 
+    Q_ASSERT(source_size_ == target_frame->size());
+
+    if (packet.chunk_size() != 0)
+        return decodeChunks(packet, target_frame);
+
     const quint8* src = reinterpret_cast<const quint8*>(packet.data().data());
     const size_t src_size = packet.data().size();
     size_t used = 0;
 
-    QRect frame_rect = QRect(QPoint(), source_frame_->size());
+    QRect frame_rect = QRect(QPoint(), source_size_);
 
-    for (int i = 0; i < packet.dirty_rect_size(); ++i)
+    std::vector<QRect> rects;
+    if (!VideoUtil::dirtyRects(packet, &rects))
     {
-        QRect rect = VideoUtil::fromVideoRect(packet.dirty_rect(i));
+        qWarning("The packed rectangles are malformed");
+        return false;
+    }
 
+    for (const QRect& rect : rects)
+    {
         if (!frame_rect.contains(rect))
         {
             qWarning("The rectangle is outside the screen area");
             return false;
         }
 
-        quint8* dst = source_frame_->frameDataAtPos(rect.x(), rect.y());
-        const size_t row_size = rect.width() * source_frame_->format().bytesPerPixel();
+        decompressRect(decompressor_.get(), src, src_size, &used, sourceTranslator(),
+                       source_format_.bytesPerPixel(), &buffer_, target_frame, rect);
+    }
+
+    if (packet.persistent_stream())
+    {
+        if (!skipFlushedData(decompressor_.get(), src, src_size, &used))
+        {
+            qWarning("Unexpected data at the end of the packet");
+            return false;
+        }
+
+        return true;
+    }
+
+    decompressor_->reset();
+    return true;
+}
+
+bool VideoDecoderZLIB::decodeChunk(Decompressor* decompressor,
+                                   std::vector<quint8>* buffer,
+                                   const std::string& chunk,
+                                   bool persistent_stream,
+                                   const QRect& rect,
+                                   DesktopFrame* target_frame)
+{
+    if (!persistent_stream)
+        decompressor->reset();
 
-        // Consume all the data in the message.
-        bool decompress_again = true;
+    const quint8* src = reinterpret_cast<const quint8*>(chunk.data());
+    size_t used = 0;
 
-        int row_y = 0;
-        size_t row_pos = 0;
+    if (!decompressRect(decompressor, src, chunk.size(), &used, sourceTranslator(),
+                        source_format_.bytesPerPixel(), buffer, target_frame, rect))
+    {
+        return false;
+    }
 
-        while (decompress_again && used < src_size)
+    if (persistent_stream && !skipFlushedData(decompressor, src, chunk.size(), &used))
+        return false;
+
+    return true;
+}
+
+bool VideoDecoderZLIB::decodeChunks(const proto::desktop::VideoPacket& packet,
+                                    DesktopFrame* target_frame)
+{
+    std::vector<QRect> rects;
+    if (!VideoUtil::dirtyRects(packet, &rects))
+    {
+        qWarning("The packed rectangles are malformed");
+        return false;
+    }
+
+    if (static_cast<size_t>(packet.chunk_size()) != rects.size())
+    {
+        qWarning("The number of chunks does not match the number of rectangles");
+        return false;
+    }
+
+    const QRect frame_rect = QRect(QPoint(), source_size_);
+
+    for (const QRect& rect : rects)
+    {
+        if (!frame_rect.contains(rect))
         {
-            // If we have reached the end of the current rectangle, then
-            // proceed to the next one.
-            if (row_y > rect.height() - 1)
-                break;
-
-            size_t written = 0;
-            size_t consumed = 0;
-
-            decompress_again = decompressor_.process(src + used,
-                                                     src_size - used,
-                                                     dst + row_pos,
-                                                     row_size - row_pos,
-                                                     &consumed,
-                                                     &written);
-            used += consumed;
-            row_pos += written;
-
-            // If we completely unpacked the row in the rectangle
-            if (row_pos == row_size)
+            qWarning("The rectangle is outside the screen area");
+            return false;
+        }
+    }
+
+    if (chunk_decompressors_.empty())
+    {
+        threads_ = qBound(1, QThread::idealThreadCount(), kMaxThreads);
+
+        for (int i = 0; i < VideoUtil::kChunkStreamCount; ++i)
+            chunk_decompressors_.emplace_back(Decompressor::create(compression_));
+
+        chunk_buffers_.resize(chunk_decompressors_.size());
+
+        // The first chunks are decoded by the calling thread.
+        thread_pool_.setMaxThreadCount(qMax(1, threads_ - 1));
+    }
+
+    // The chunks of one stream are decompressed in order by the same thread.
+    const size_t streams = chunk_decompressors_.size();
+    const size_t workers = qMin(static_cast<size_t>(threads_), qMin(streams, rects.size()));
+    std::atomic<bool> succeeded(true);
+
+    auto decode_chunks = [&](size_t worker)
+    {
+        for (size_t stream = worker; stream < streams; stream += workers)
+        {
+            for (size_t i = stream; i < rects.size(); i += streams)
             {
-                ++row_y;
-                row_pos = 0;
-                dst += source_frame_->stride();
+                if (!decodeChunk(chunk_decompressors_[stream].get(),
+                                 &chunk_buffers_[stream],
+                                 packet.chunk(static_cast<int>(i)),
+                                 packet.persistent_stream(),
+                                 rects[i],
+                                 target_frame))
+                {
+                    succeeded = false;
+                }
             }
         }
+    };
+
+    for (size_t worker = 1; worker < workers; ++worker)
+        thread_pool_.start(new FunctionRunnable(std::bind(decode_chunks, worker)));
+
+    if (workers != 0)
+        decode_chunks(0);
 
-        translator_->translate(source_frame_->frameDataAtPos(rect.topLeft()),
-                               source_frame_->stride(),
-                               target_frame->frameDataAtPos(rect.topLeft()),
-                               target_frame->stride(),
-                               rect.width(),
-                               rect.height());
+    thread_pool_.waitForDone();
+
+    if (!succeeded)
+    {
+        qWarning("Failed to decompress the chunk");
+        return false;
     }
 
-    decompressor_.reset();
     return true;
 }
 
@@ -8,12 +8,18 @@
 #ifndef _ASPIA_CODEC__VIDEO_DECODER_ZLIB_H
 #define _ASPIA_CODEC__VIDEO_DECODER_ZLIB_H
 
-#include "codec/decompressor_zlib.h"
+#include <QRect>
+#include <QSize>
+#include <QThreadPool>
+
+#include <vector>
+
+#include "codec/decompressor.h"
 #include "codec/video_decoder.h"
+#include "desktop_capture/pixel_format.h"
 
 namespace aspia {
 
-class DesktopFrame;
 class PixelTranslator;
 
 class VideoDecoderZLIB : public VideoDecoder
@@ -21,16 +27,48 @@ class VideoDecoderZLIB : public VideoDecoder
 public:
     ~VideoDecoderZLIB() = default;
 
-    static std::unique_ptr<VideoDecoderZLIB> create();
+    // Returns nullptr if |compression| is not supported.
+    static std::unique_ptr<VideoDecoderZLIB> create(
+        proto::desktop::Compression compression = proto::desktop::COMPRESSION_ZLIB);
 
     bool decode(const proto::desktop::VideoPacket& packet, DesktopFrame* target_frame) override;
 
 private:
-    VideoDecoderZLIB() = default;
+    VideoDecoderZLIB(proto::desktop::Compression compression,
+                     std::unique_ptr<Decompressor> decompressor);
+
+    // Decompresses the chunks of the packet in parallel.
+    bool decodeChunks(const proto::desktop::VideoPacket& packet, DesktopFrame* target_frame);
+    bool decodeChunk(Decompressor* decompressor,
+                     std::vector<quint8>* buffer,
+                     const std::string& chunk,
+                     bool persistent_stream,
+                     const QRect& rect,
+                     DesktopFrame* target_frame);
+
+    // Returns nullptr if the rows are decompressed straight into the target frame.
+    PixelTranslator* sourceTranslator() const
+    {
+        return direct_decode_ ? nullptr : translator_.get();
+    }
+
+    const proto::desktop::Compression compression_;
+    std::unique_ptr<Decompressor> decompressor_;
+
+    // Decompressors of the chunk streams and their buffers of the strips.
+    std::vector<std::unique_ptr<Decompressor>> chunk_decompressors_;
+    std::vector<std::vector<quint8>> chunk_buffers_;
+    QThreadPool thread_pool_;
+    int threads_ = 1;
 
-    DecompressorZLIB decompressor_;
+    // The rectangles are decompressed by strips of rows into the buffer, and each strip is
+    // translated to the target frame while it is in the cache. The source of the format of the
+    // target frame is decompressed straight into it without the buffer.
+    std::vector<quint8> buffer_;
     std::unique_ptr<PixelTranslator> translator_;
-    std::unique_ptr<DesktopFrame> source_frame_;
+    bool direct_decode_ = false;
+    PixelFormat source_format_;
+    QSize source_size_;
 
     Q_DISABLE_COPY(VideoDecoderZLIB)
 };
@@ -8,6 +8,8 @@
 #ifndef _ASPIA_CODEC__VIDEO_ENCODER_H
 #define _ASPIA_CODEC__VIDEO_ENCODER_H
 
+#include <QRegion>
+
 #include <memory>
 
 #include "protocol/desktop_session.pb.h"
@@ -21,7 +23,54 @@ class VideoEncoder
 public:
     virtual ~VideoEncoder() = default;
 
-    virtual std::unique_ptr<proto::desktop::VideoPacket> encode(const DesktopFrame* frame) = 0;
+    // Encodes the frame into |packet|. The packet is cleared first, so the caller may pass
+    // the same packet again to keep its buffers. Returns false on error.
+    virtual bool encode(const DesktopFrame* frame, proto::desktop::VideoPacket* packet) = 0;
+
+    // Sets the estimated bandwidth of the connection in bytes per second. Encoders without
+    // the rate control ignore the value.
+    virtual void setBandwidth(qint64 /* bandwidth */) {}
+
+    // The range of setEffort(). Zero is the effort of the configuration.
+    static constexpr int kMinEffort = -4;
+    static constexpr int kMaxEffort = 2;
+
+    // Sets how much of the processors the encoder spends on the frames relative to its
+    // configuration. The negative values make the encoding faster with a larger or a worse
+    // result, the positive values use the idle processors for a better result. Encoders
+    // without the speed settings ignore the value.
+    virtual void setEffort(int /* effort */) {}
+
+    // Returns true if the encoder is able to improve the quality of the areas encoded
+    // earlier. In this case the frame without changes must be encoded after the screen has
+    // stopped changing.
+    virtual bool isTopOffPending() const { return false; }
+
+    // Returns true if the updated region of a frame may be encoded by several calls of
+    // encode() in independent packets.
+    virtual bool canSplitFrame() const { return false; }
+
+    // Sets the areas of the frame which the user probably looks at. The encoders with a region
+    // of interest spend more bits on them. Other encoders ignore the region.
+    virtual void setFocusRegion(const QRegion& /* region */) {}
+
+    // Measures the quality of every |interval|-th frame (0 - never) against the source and
+    // fills VideoPacket::psnr and VideoPacket::ssim of the measured frames. Encoders which
+    // are not able to measure the quality or are lossless ignore the value.
+    virtual void setQualitySampling(int /* interval */) {}
+
+    // The next frame is encoded without references to the previous frames and contains the
+    // format, so the client is able to start decoding from it. The caller must mark the whole
+    // frame as updated.
+    virtual void requestKeyFrame() = 0;
+
+    // The whole frame is refreshed gradually: the next frames encode the bands of the frame in
+    // turn without references to the previous frames, so the bitrate does not have the peak of
+    // a key frame. The caller does not mark the frame as updated. Returns false if the encoder
+    // is not able to do it, then the caller requests a key frame instead. The client must have
+    // received the previous frames, so the refresh does not replace the key frame for a new
+    // client.
+    virtual bool requestIntraRefresh() { return false; }
 };
 
 } // namespace aspia
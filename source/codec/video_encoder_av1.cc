@@ -0,0 +1,414 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/video_encoder_av1.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "codec/video_encoder_av1.h"
+
+#include <QDebug>
+#include <QThread>
+
+#include <libyuv/convert_from_argb.h>
+
+#include "codec/video_util.h"
+#include "desktop_capture/desktop_frame.h"
+
+namespace aspia {
+
+namespace {
+
+// The active map of libaom consists of the blocks of 16x16 pixels.
+constexpr int kMacroBlockSize = 16;
+
+// The fastest speed of the real-time mode which keeps the screen content tools.
+constexpr int kRealtimeSpeed = 9;
+
+// Limits of the number of threads and log2 of the number of tile columns.
+constexpr int kMaxThreads = 64;
+constexpr int kMaxTileColumns = 6;
+
+// The minimal width of the tile column which is worth encoding in a separate thread.
+constexpr int kMinTileWidth = 256;
+
+// Area of the screen (in pixels) for one encoder thread when it is chosen automatically.
+constexpr int kPixelsPerThread = 960 * 540;
+
+// Cyclic refresh of the adaptive quantization improves the static areas in the next frames.
+constexpr unsigned int kAqModeCyclicRefresh = 3;
+
+// Quantizer range (0..63) when the bitrate is not limited by the connection.
+constexpr unsigned int kMinQuantizer = 10;
+constexpr unsigned int kMaxQuantizer = 30;
+
+// The worst quantizer used when the bitrate is limited by the connection.
+constexpr unsigned int kWorstQuantizer = 56;
+
+// The minimal bitrate (in kbit/s) that the rate control sets.
+constexpr unsigned int kMinBitrate = 100;
+
+// Part of the estimated bandwidth that is used for the video.
+constexpr int kBandwidthUsagePercent = 80;
+
+// The screen is encoded only when it changes. The long pauses between the frames must not give
+// the whole bitrate of the pause to the next frame.
+constexpr aom_codec_pts_t kMaxFrameDuration = 100; // 100 ms
+
+int autoThreadCount(const QSize& size)
+{
+    const int cores = QThread::idealThreadCount();
+    if (cores <= 2)
+        return 1;
+
+    const int threads = qMax(2, size.width() * size.height() / kPixelsPerThread);
+
+    return qMin(threads, qMin(cores, kMaxThreads));
+}
+
+int autoTileColumns(const QSize& size, int threads)
+{
+    int tile_columns = 0;
+
+    while ((1 << tile_columns) < threads &&
+           (size.width() >> (tile_columns + 1)) >= kMinTileWidth &&
+           tile_columns < kMaxTileColumns)
+    {
+        ++tile_columns;
+    }
+
+    return tile_columns;
+}
+
+} // namespace
+
+// static
+std::unique_ptr<VideoEncoderAV1> VideoEncoderAV1::create(int threads)
+{
+    return std::unique_ptr<VideoEncoderAV1>(new VideoEncoderAV1(threads));
+}
+
+VideoEncoderAV1::VideoEncoderAV1(int threads)
+    : threads_(threads)
+{
+    memset(&active_map_, 0, sizeof(active_map_));
+    memset(&config_, 0, sizeof(config_));
+    memset(&image_, 0, sizeof(image_));
+}
+
+bool VideoEncoderAV1::createImage()
+{
+    memset(&image_, 0, sizeof(image_));
+
+    image_.d_w = image_.w = screen_size_.width();
+    image_.d_h = image_.h = screen_size_.height();
+    image_.fmt = AOM_IMG_FMT_I420;
+    image_.bit_depth = 8;
+    image_.x_chroma_shift = 1;
+    image_.y_chroma_shift = 1;
+
+    // libyuv's fast-path requires 16-byte aligned pointers and strides.
+    const int y_stride = ((image_.w - 1) & ~15) + 16;
+    const int uv_unaligned_stride = y_stride >> image_.x_chroma_shift;
+    const int uv_stride = ((uv_unaligned_stride - 1) & ~15) + 16;
+
+    // The planes are padded out to the next block, so the encoder does not over-read them.
+    const int y_rows = ((image_.h - 1) & ~(kMacroBlockSize - 1)) + kMacroBlockSize;
+    const int uv_rows = y_rows >> image_.y_chroma_shift;
+
+    const int buffer_size = y_stride * y_rows + (2 * uv_stride) * uv_rows;
+
+    // The previous image is returned into the pool before the new one is taken.
+    yuv_image_.reset();
+    yuv_image_ = BufferPool::instance()->allocate(buffer_size);
+    if (!yuv_image_)
+        return false;
+
+    // Reset image value to 128 so we just need to fill in the y plane.
+    memset(yuv_image_.get(), 128, buffer_size);
+
+    image_.planes[AOM_PLANE_Y] = yuv_image_.get();
+    image_.planes[AOM_PLANE_U] = image_.planes[AOM_PLANE_Y] + y_stride * y_rows;
+    image_.planes[AOM_PLANE_V] = image_.planes[AOM_PLANE_U] + uv_stride * uv_rows;
+
+    image_.stride[AOM_PLANE_Y] = y_stride;
+    image_.stride[AOM_PLANE_U] = image_.stride[AOM_PLANE_V] = uv_stride;
+    return true;
+}
+
+void VideoEncoderAV1::createActiveMap()
+{
+    active_map_.cols = (screen_size_.width() + kMacroBlockSize - 1) / kMacroBlockSize;
+    active_map_.rows = (screen_size_.height() + kMacroBlockSize - 1) / kMacroBlockSize;
+    active_map_size_ = active_map_.cols * active_map_.rows;
+    active_map_buffer_ = std::make_unique<quint8[]>(active_map_size_);
+
+    memset(active_map_buffer_.get(), 0, active_map_size_);
+    active_map_.active_map = active_map_buffer_.get();
+}
+
+bool VideoEncoderAV1::createCodec()
+{
+    codec_.reset(new aom_codec_ctx_t());
+
+    memset(&config_, 0, sizeof(config_));
+
+    aom_codec_iface_t* algo = aom_codec_av1_cx();
+
+    aom_codec_err_t ret = aom_codec_enc_config_default(algo, &config_, AOM_USAGE_REALTIME);
+    if (ret != AOM_CODEC_OK)
+    {
+        qWarning() << "aom_codec_enc_config_default failed: " << aom_codec_err_to_string(ret);
+        return false;
+    }
+
+    // Adjust default target bit-rate to account for actual desktop size.
+    config_.rc_target_bitrate = screen_size_.width() * screen_size_.height() *
+        config_.rc_target_bitrate / config_.g_w / config_.g_h;
+
+    default_bitrate_ = config_.rc_target_bitrate;
+
+    // Use millisecond granularity time base.
+    config_.g_timebase.num = 1;
+    config_.g_timebase.den = 1000;
+
+    config_.g_w = screen_size_.width();
+    config_.g_h = screen_size_.height();
+    config_.g_pass = AOM_RC_ONE_PASS;
+
+    // The main profile is used for the 8 bit I420 source frames.
+    config_.g_profile = 0;
+
+    // Start emitting packets immediately.
+    config_.g_lag_in_frames = 0;
+
+    // Since the transport layer is reliable, keyframes are encoded only for the first frame
+    // and on request.
+    config_.kf_mode = AOM_KF_DISABLED;
+
+    config_.g_threads = (threads_ > 0) ?
+        qMin(threads_, kMaxThreads) : autoThreadCount(screen_size_);
+
+    config_.rc_end_usage = AOM_CBR;
+    config_.rc_min_quantizer = kMinQuantizer;
+    config_.rc_max_quantizer = kMaxQuantizer;
+
+    ret = aom_codec_enc_init(codec_.get(), algo, &config_, 0);
+    if (ret != AOM_CODEC_OK)
+    {
+        qWarning() << "aom_codec_enc_init failed: " << aom_codec_err_to_string(ret);
+        // The context is not initialized, so it is not destroyed by the deleter.
+        delete codec_.release();
+        return false;
+    }
+
+    ret = aom_codec_control(codec_.get(), AOME_SET_CPUUSED, kRealtimeSpeed);
+    Q_ASSERT(ret == AOM_CODEC_OK);
+
+    // The screen content mode enables the palette mode and intra block copy, they are also
+    // enabled explicitly, because the encoder may disable them for the frames of the camera.
+    ret = aom_codec_control(codec_.get(), AV1E_SET_TUNE_CONTENT, AOM_CONTENT_SCREEN);
+    Q_ASSERT(ret == AOM_CODEC_OK);
+
+    ret = aom_codec_control(codec_.get(), AV1E_SET_ENABLE_PALETTE, 1);
+    Q_ASSERT(ret == AOM_CODEC_OK);
+
+    ret = aom_codec_control(codec_.get(), AV1E_SET_ENABLE_INTRABC, 1);
+    Q_ASSERT(ret == AOM_CODEC_OK);
+
+    ret = aom_codec_control(codec_.get(), AV1E_SET_AQ_MODE, kAqModeCyclicRefresh);
+    Q_ASSERT(ret == AOM_CODEC_OK);
+
+    // The temporal filtering and the noise estimation only cost time on the screen content.
+    ret = aom_codec_control(codec_.get(), AV1E_SET_NOISE_SENSITIVITY, 0);
+    Q_ASSERT(ret == AOM_CODEC_OK);
+
+    // The tile columns are encoded in parallel. Row based multi-threading allows to use more
+    // threads than the tile columns.
+    ret = aom_codec_control(codec_.get(), AV1E_SET_TILE_COLUMNS,
+                            autoTileColumns(screen_size_, config_.g_threads));
+    Q_ASSERT(ret == AOM_CODEC_OK);
+
+    ret = aom_codec_control(codec_.get(), AV1E_SET_ROW_MT, 1);
+    Q_ASSERT(ret == AOM_CODEC_OK);
+
+    clock_.start();
+    timestamp_ = 0;
+
+    // The codec may be created again after the bandwidth is known.
+    if (bandwidth_)
+        setBandwidth(bandwidth_);
+
+    return true;
+}
+
+void VideoEncoderAV1::setBandwidth(qint64 bandwidth)
+{
+    bandwidth_ = bandwidth;
+
+    if (!codec_ || !bandwidth)
+        return;
+
+    const quint32 available_bitrate = static_cast<quint32>(qMin<qint64>(
+        bandwidth * 8 / 1000 * kBandwidthUsagePercent / 100, default_bitrate_));
+
+    const quint32 target_bitrate = qMax(available_bitrate, kMinBitrate);
+
+    // When the bitrate is reduced, the quantizer range is extended proportionally, so that
+    // the encoder does not exceed the bitrate on complex frames.
+    const quint32 max_quantizer = kMaxQuantizer +
+        (kWorstQuantizer - kMaxQuantizer) * (default_bitrate_ - target_bitrate) /
+        default_bitrate_;
+
+    const quint32 min_quantizer = qMin(kMinQuantizer, max_quantizer / 2);
+
+    // Small changes are ignored to avoid reconfiguring the encoder for every frame.
+    const quint32 current_bitrate = config_.rc_target_bitrate;
+    if (config_.rc_max_quantizer == max_quantizer &&
+        target_bitrate > current_bitrate * 9 / 10 &&
+        target_bitrate < current_bitrate * 11 / 10)
+    {
+        return;
+    }
+
+    config_.rc_target_bitrate = target_bitrate;
+    config_.rc_min_quantizer = min_quantizer;
+    config_.rc_max_quantizer = max_quantizer;
+
+    aom_codec_err_t ret = aom_codec_enc_config_set(codec_.get(), &config_);
+    Q_ASSERT(ret == AOM_CODEC_OK);
+}
+
+void VideoEncoderAV1::requestKeyFrame()
+{
+    key_frame_pending_ = true;
+}
+
+void VideoEncoderAV1::convertRect(const DesktopFrame* frame, const QRect& rect)
+{
+    // The chroma is computed from 2x2 pixels, so the rectangles must start at even
+    // coordinates. The blocks always do.
+    Q_ASSERT(rect.x() % kMacroBlockSize == 0 && rect.y() % kMacroBlockSize == 0);
+
+    const int y_offset = image_.stride[AOM_PLANE_Y] * rect.y() + rect.x();
+    const int uv_offset = image_.stride[AOM_PLANE_U] * (rect.y() >> image_.y_chroma_shift) +
+        (rect.x() >> image_.x_chroma_shift);
+
+    libyuv::ARGBToI420(frame->frameDataAtPos(rect.topLeft()),
+                       frame->stride(),
+                       image_.planes[AOM_PLANE_Y] + y_offset, image_.stride[AOM_PLANE_Y],
+                       image_.planes[AOM_PLANE_U] + uv_offset, image_.stride[AOM_PLANE_U],
+                       image_.planes[AOM_PLANE_V] + uv_offset, image_.stride[AOM_PLANE_V],
+                       rect.width(),
+                       rect.height());
+}
+
+void VideoEncoderAV1::prepareImageAndActiveMap(const DesktopFrame* frame,
+                                               proto::desktop::VideoPacket* packet)
+{
+    memset(active_map_.active_map, 0, active_map_size_);
+
+    // The rectangles are aligned to the blocks, which are encoded entirely anyway.
+    const std::vector<QRect> rects =
+        VideoUtil::coalesceRegion(frame->updatedRegion(), frame->size(), kMacroBlockSize);
+
+    QRegion region;
+
+    for (const auto& rect : rects)
+    {
+        VideoUtil::toVideoRect(rect, packet->add_dirty_rect());
+
+        const int left = rect.left() / kMacroBlockSize;
+        const int top = rect.top() / kMacroBlockSize;
+        const int right = rect.right() / kMacroBlockSize;
+        const int bottom = rect.bottom() / kMacroBlockSize;
+
+        for (int y = top; y <= bottom; ++y)
+        {
+            quint8* map = active_map_.active_map + y * active_map_.cols;
+
+            for (int x = left; x <= right; ++x)
+                map[x] = 1;
+        }
+
+        region += rect;
+    }
+
+    // The merged region does not convert the overlapping rectangles twice.
+    for (const auto& rect : region)
+        convertRect(frame, rect);
+}
+
+bool VideoEncoderAV1::encode(const DesktopFrame* frame, proto::desktop::VideoPacket* packet)
+{
+    packet->Clear();
+
+    packet->set_encoding(proto::desktop::VIDEO_ENCODING_AV1);
+
+    if (screen_size_ != frame->size())
+    {
+        screen_size_ = frame->size();
+
+        if (!createImage())
+            return false;
+
+        createActiveMap();
+
+        if (!createCodec())
+        {
+            screen_size_ = QSize();
+            return false;
+        }
+
+        // The first frame of the codec is a key frame.
+        key_frame_pending_ = false;
+
+        VideoUtil::toVideoSize(screen_size_, packet->mutable_format()->mutable_screen_size());
+    }
+
+    aom_enc_frame_flags_t flags = 0;
+
+    if (key_frame_pending_)
+    {
+        key_frame_pending_ = false;
+        flags |= AOM_EFLAG_FORCE_KF;
+
+        VideoUtil::toVideoSize(screen_size_, packet->mutable_format()->mutable_screen_size());
+    }
+
+    for (const auto& move_rect : frame->moveRects())
+        VideoUtil::toVideoCopyRect(move_rect, packet->add_copy_rect());
+
+    prepareImageAndActiveMap(frame, packet);
+
+    aom_codec_err_t ret = aom_codec_control(codec_.get(), AOME_SET_ACTIVEMAP, &active_map_);
+    Q_ASSERT(ret == AOM_CODEC_OK);
+
+    const aom_codec_pts_t timestamp = qMax<aom_codec_pts_t>(clock_.elapsed(), timestamp_ + 1);
+    const aom_codec_pts_t duration = qMin(timestamp - timestamp_, kMaxFrameDuration);
+    timestamp_ = timestamp;
+
+    ret = aom_codec_encode(codec_.get(), &image_, timestamp, duration, flags);
+    if (ret != AOM_CODEC_OK)
+    {
+        qWarning() << "aom_codec_encode failed: " << aom_codec_error(codec_.get());
+        return false;
+    }
+
+    // Without the lag the frame is returned at once. It may consist of several packets.
+    aom_codec_iter_t iter = nullptr;
+    const aom_codec_cx_pkt_t* aom_packet;
+
+    while ((aom_packet = aom_codec_get_cx_data(codec_.get(), &iter)) != nullptr)
+    {
+        if (aom_packet->kind == AOM_CODEC_CX_FRAME_PKT)
+        {
+            packet->mutable_data()->append(static_cast<const char*>(aom_packet->data.frame.buf),
+                                           aom_packet->data.frame.sz);
+        }
+    }
+
+    return true;
+}
+
+} // namespace aspia
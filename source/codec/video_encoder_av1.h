@@ -0,0 +1,85 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/video_encoder_av1.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CODEC__VIDEO_ENCODER_AV1_H
+#define _ASPIA_CODEC__VIDEO_ENCODER_AV1_H
+
+#include <QElapsedTimer>
+#include <QSize>
+
+extern "C" {
+#include <aom/aom_encoder.h>
+#include <aom/aomcx.h>
+} // extern "C"
+
+#include "base/buffer_pool.h"
+#include "codec/scoped_aom_codec.h"
+#include "codec/video_encoder.h"
+
+namespace aspia {
+
+//
+// Real-time AV1 encoder based on libaom. The screen content tools of AV1 (palette mode and
+// intra block copy) are enabled, so the text and the flat UI take much less bits than with VP8.
+//
+class VideoEncoderAV1 : public VideoEncoder
+{
+public:
+    ~VideoEncoderAV1() = default;
+
+    // If |threads| is 0, then the number of threads is chosen automatically.
+    static std::unique_ptr<VideoEncoderAV1> create(int threads);
+
+    bool encode(const DesktopFrame* frame, proto::desktop::VideoPacket* packet) override;
+    void setBandwidth(qint64 bandwidth) override;
+    void requestKeyFrame() override;
+
+private:
+    explicit VideoEncoderAV1(int threads);
+
+    bool createImage();
+    void createActiveMap();
+    bool createCodec();
+    void prepareImageAndActiveMap(const DesktopFrame* frame, proto::desktop::VideoPacket* packet);
+    void convertRect(const DesktopFrame* frame, const QRect& rect);
+
+    // Requested number of threads (0 - automatic).
+    const int threads_;
+
+    // The current frame size.
+    QSize screen_size_;
+
+    ScopedAomCodec codec_ = nullptr;
+    aom_codec_enc_cfg_t config_;
+    aom_image_t image_;
+
+    // Bitrate (in kbit/s) for the current frame size without the limits of the connection.
+    quint32 default_bitrate_ = 0;
+    qint64 bandwidth_ = 0;
+
+    size_t active_map_size_ = 0;
+
+    aom_active_map_t active_map_;
+    std::unique_ptr<quint8[]> active_map_buffer_;
+
+    bool key_frame_pending_ = false;
+
+    // The rate control of libaom distributes the bitrate by the timestamps of the frames, so
+    // the real time of the capture is passed. The timestamps must increase.
+    QElapsedTimer clock_;
+    aom_codec_pts_t timestamp_ = 0;
+
+    // Buffer for storing the I420 image. It keeps the converted content of the blocks which
+    // have not changed since the frame size was changed.
+    BufferPool::Buffer yuv_image_;
+
+    Q_DISABLE_COPY(VideoEncoderAV1)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_CODEC__VIDEO_ENCODER_AV1_H
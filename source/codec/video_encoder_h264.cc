@@ -0,0 +1,902 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/video_encoder_h264.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "codec/video_encoder_h264.h"
+
+#include <QDebug>
+
+#include <codecapi.h>
+#include <mferror.h>
+
+#include <libyuv/convert_from_argb.h>
+
+#include "codec/video_util.h"
+#include "desktop_capture/desktop_frame.h"
+
+namespace aspia {
+
+namespace {
+
+// The encoded picture is aligned to the size of the macroblock.
+constexpr int kMacroBlockSize = 16;
+
+constexpr UINT32 kFrameRate = 30;
+
+// Duration of the frame in 100-nanosecond units.
+constexpr LONGLONG kFrameDuration = 10000000 / kFrameRate;
+
+// Bitrate (in bit/s) per pixel of the screen when the bandwidth is not limited. 1920x1080
+// gives about 8 Mbit/s.
+constexpr quint32 kDefaultBitsPerPixel = 4;
+
+// The minimal bitrate (in bit/s) that the rate control sets.
+constexpr quint32 kMinBitrate = 100 * 1000;
+
+// Part of the estimated bandwidth that is used for the video.
+constexpr int kBandwidthUsagePercent = 80;
+
+int alignUp(int value, int alignment)
+{
+    return ((value + alignment - 1) / alignment) * alignment;
+}
+
+HRESULT enumHardwareEncoders(IMFActivate*** activates, UINT32* count)
+{
+    MFT_REGISTER_TYPE_INFO input_type = { MFMediaType_Video, MFVideoFormat_NV12 };
+    MFT_REGISTER_TYPE_INFO output_type = { MFMediaType_Video, MFVideoFormat_H264 };
+
+    return MFTEnumEx(MFT_CATEGORY_VIDEO_ENCODER,
+                     MFT_ENUM_FLAG_HARDWARE | MFT_ENUM_FLAG_SORTANDFILTER,
+                     &input_type,
+                     &output_type,
+                     activates,
+                     count);
+}
+
+void releaseActivates(IMFActivate** activates, UINT32 count)
+{
+    for (UINT32 i = 0; i < count; ++i)
+        activates[i]->Release();
+
+    CoTaskMemFree(activates);
+}
+
+void setCodecValue(ICodecAPI* codec_api, const GUID& property, UINT32 value)
+{
+    VARIANT variant;
+
+    VariantInit(&variant);
+    variant.vt = VT_UI4;
+    variant.ulVal = value;
+
+    // Not all encoders support all the properties, so the errors are not fatal.
+    HRESULT hr = codec_api->SetValue(&property, &variant);
+    if (FAILED(hr))
+        qWarning("ICodecAPI::SetValue failed: 0x%08X", hr);
+}
+
+void setCodecBool(ICodecAPI* codec_api, const GUID& property, bool value)
+{
+    VARIANT variant;
+
+    VariantInit(&variant);
+    variant.vt = VT_BOOL;
+    variant.boolVal = value ? VARIANT_TRUE : VARIANT_FALSE;
+
+    HRESULT hr = codec_api->SetValue(&property, &variant);
+    if (FAILED(hr))
+        qWarning("ICodecAPI::SetValue failed: 0x%08X", hr);
+}
+
+} // namespace
+
+VideoEncoderH264::~VideoEncoderH264()
+{
+    // The objects of Media Foundation must be released before the shutdown.
+    device_manager_.Reset();
+    codec_api_.Reset();
+    event_generator_.Reset();
+    transform_.Reset();
+
+    if (media_foundation_started_)
+        MFShutdown();
+}
+
+// static
+bool VideoEncoderH264::isAvailable()
+{
+    HRESULT hr = MFStartup(MF_VERSION, MFSTARTUP_LITE);
+    if (FAILED(hr))
+        return false;
+
+    IMFActivate** activates = nullptr;
+    UINT32 count = 0;
+
+    hr = enumHardwareEncoders(&activates, &count);
+    if (SUCCEEDED(hr))
+        releaseActivates(activates, count);
+
+    MFShutdown();
+
+    return SUCCEEDED(hr) && count != 0;
+}
+
+// static
+std::unique_ptr<VideoEncoderH264> VideoEncoderH264::create()
+{
+    std::unique_ptr<VideoEncoderH264> encoder(new VideoEncoderH264());
+
+    HRESULT hr = MFStartup(MF_VERSION, MFSTARTUP_LITE);
+    if (FAILED(hr))
+    {
+        qWarning("MFStartup failed: 0x%08X", hr);
+        return nullptr;
+    }
+
+    encoder->media_foundation_started_ = true;
+
+    if (!encoder->createTransform())
+        return nullptr;
+
+    return encoder;
+}
+
+bool VideoEncoderH264::isTextureInputSupported() const
+{
+    Microsoft::WRL::ComPtr<IMFAttributes> attributes;
+    UINT32 d3d11_aware = FALSE;
+
+    return SUCCEEDED(transform_->GetAttributes(attributes.GetAddressOf())) &&
+           SUCCEEDED(attributes->GetUINT32(MF_SA_D3D11_AWARE, &d3d11_aware)) && d3d11_aware;
+}
+
+bool VideoEncoderH264::createTransform()
+{
+    codec_api_.Reset();
+    event_generator_.Reset();
+    transform_.Reset();
+
+    IMFActivate** activates = nullptr;
+    UINT32 count = 0;
+
+    HRESULT hr = enumHardwareEncoders(&activates, &count);
+    if (FAILED(hr))
+    {
+        qWarning("MFTEnumEx failed: 0x%08X", hr);
+        return false;
+    }
+
+    if (!count)
+    {
+        qWarning("Hardware H.264 encoder not found");
+        CoTaskMemFree(activates);
+        return false;
+    }
+
+    hr = activates[0]->ActivateObject(IID_PPV_ARGS(transform_.GetAddressOf()));
+    releaseActivates(activates, count);
+
+    if (FAILED(hr))
+    {
+        qWarning("ActivateObject failed: 0x%08X", hr);
+        return false;
+    }
+
+    Microsoft::WRL::ComPtr<IMFAttributes> attributes;
+
+    hr = transform_->GetAttributes(attributes.GetAddressOf());
+    if (FAILED(hr))
+    {
+        qWarning("GetAttributes failed: 0x%08X", hr);
+        return false;
+    }
+
+    UINT32 is_async = FALSE;
+
+    // Hardware encoders are asynchronous and must be unlocked before use.
+    if (FAILED(attributes->GetUINT32(MF_TRANSFORM_ASYNC, &is_async)) || !is_async)
+    {
+        qWarning("Synchronous encoders are not supported");
+        return false;
+    }
+
+    hr = attributes->SetUINT32(MF_TRANSFORM_ASYNC_UNLOCK, TRUE);
+    if (FAILED(hr))
+    {
+        qWarning("Unable to unlock the encoder: 0x%08X", hr);
+        return false;
+    }
+
+    hr = transform_.As(&event_generator_);
+    if (FAILED(hr))
+    {
+        qWarning("IMFMediaEventGenerator is not supported: 0x%08X", hr);
+        return false;
+    }
+
+    hr = transform_.As(&codec_api_);
+    if (FAILED(hr))
+    {
+        qWarning("ICodecAPI is not supported: 0x%08X", hr);
+        return false;
+    }
+
+    hr = transform_->GetStreamIDs(1, &input_stream_id_, 1, &output_stream_id_);
+    if (hr == E_NOTIMPL)
+    {
+        // The transform has a fixed number of streams with the identifiers starting from zero.
+        input_stream_id_ = 0;
+        output_stream_id_ = 0;
+    }
+    else if (FAILED(hr))
+    {
+        qWarning("GetStreamIDs failed: 0x%08X", hr);
+        return false;
+    }
+
+    need_input_count_ = 0;
+    return true;
+}
+
+bool VideoEncoderH264::configureTransform()
+{
+    picture_size_ = QSize(alignUp(screen_size_.width(), kMacroBlockSize),
+                          alignUp(screen_size_.height(), kMacroBlockSize));
+
+    const UINT32 width = picture_size_.width();
+    const UINT32 height = picture_size_.height();
+
+    const quint32 default_bitrate =
+        screen_size_.width() * screen_size_.height() * kDefaultBitsPerPixel;
+
+    if (!bitrate_ || bitrate_ > default_bitrate)
+        bitrate_ = default_bitrate;
+
+    // The device is set before the media types, because the encoder checks them for it.
+    if (device_ && !setDeviceManager())
+        return false;
+
+    // The rate control mode must be set before the media types.
+    setCodecValue(codec_api_.Get(),
+                  CODECAPI_AVEncCommonRateControlMode,
+                  eAVEncCommonRateControlMode_CBR);
+    setCodecValue(codec_api_.Get(), CODECAPI_AVEncCommonMeanBitRate, bitrate_);
+    setCodecBool(codec_api_.Get(), CODECAPI_AVLowLatencyMode, true);
+
+    Microsoft::WRL::ComPtr<IMFMediaType> output_type;
+
+    HRESULT hr = MFCreateMediaType(output_type.GetAddressOf());
+    if (SUCCEEDED(hr))
+        hr = output_type->SetGUID(MF_MT_MAJOR_TYPE, MFMediaType_Video);
+    if (SUCCEEDED(hr))
+        hr = output_type->SetGUID(MF_MT_SUBTYPE, MFVideoFormat_H264);
+    if (SUCCEEDED(hr))
+        hr = output_type->SetUINT32(MF_MT_AVG_BITRATE, bitrate_);
+    if (SUCCEEDED(hr))
+        hr = MFSetAttributeSize(output_type.Get(), MF_MT_FRAME_SIZE, width, height);
+    if (SUCCEEDED(hr))
+        hr = MFSetAttributeRatio(output_type.Get(), MF_MT_FRAME_RATE, kFrameRate, 1);
+    if (SUCCEEDED(hr))
+        hr = MFSetAttributeRatio(output_type.Get(), MF_MT_PIXEL_ASPECT_RATIO, 1, 1);
+    if (SUCCEEDED(hr))
+        hr = output_type->SetUINT32(MF_MT_INTERLACE_MODE, MFVideoInterlace_Progressive);
+    if (SUCCEEDED(hr))
+        hr = output_type->SetUINT32(MF_MT_MPEG2_PROFILE, eAVEncH264VProfile_Main);
+    if (SUCCEEDED(hr))
+        hr = transform_->SetOutputType(output_stream_id_, output_type.Get(), 0);
+
+    if (FAILED(hr))
+    {
+        qWarning("Unable to set the output type: 0x%08X", hr);
+        return false;
+    }
+
+    Microsoft::WRL::ComPtr<IMFMediaType> input_type;
+
+    hr = MFCreateMediaType(input_type.GetAddressOf());
+    if (SUCCEEDED(hr))
+        hr = input_type->SetGUID(MF_MT_MAJOR_TYPE, MFMediaType_Video);
+    if (SUCCEEDED(hr))
+        hr = input_type->SetGUID(MF_MT_SUBTYPE, MFVideoFormat_NV12);
+    if (SUCCEEDED(hr))
+        hr = MFSetAttributeSize(input_type.Get(), MF_MT_FRAME_SIZE, width, height);
+    if (SUCCEEDED(hr))
+        hr = MFSetAttributeRatio(input_type.Get(), MF_MT_FRAME_RATE, kFrameRate, 1);
+    if (SUCCEEDED(hr))
+        hr = input_type->SetUINT32(MF_MT_INTERLACE_MODE, MFVideoInterlace_Progressive);
+    if (SUCCEEDED(hr))
+        hr = transform_->SetInputType(input_stream_id_, input_type.Get(), 0);
+
+    if (FAILED(hr))
+    {
+        qWarning("Unable to set the input type: 0x%08X", hr);
+        return false;
+    }
+
+    hr = transform_->ProcessMessage(MFT_MESSAGE_NOTIFY_BEGIN_STREAMING, 0);
+    if (SUCCEEDED(hr))
+        hr = transform_->ProcessMessage(MFT_MESSAGE_NOTIFY_START_OF_STREAM, 0);
+
+    if (FAILED(hr))
+    {
+        qWarning("Unable to start the stream: 0x%08X", hr);
+        return false;
+    }
+
+    timestamp_ = 0;
+
+    if (device_)
+    {
+        nv12_image_.reset();
+        return createVideoProcessor();
+    }
+
+    y_stride_ = picture_size_.width();
+
+    const size_t y_size = y_stride_ * picture_size_.height();
+    const size_t buffer_size = y_size + y_size / 2;
+
+    nv12_image_.reset();
+    nv12_image_ = BufferPool::instance()->allocate(buffer_size);
+    if (!nv12_image_)
+        return false;
+
+    // Black image: zero luma and neutral chroma.
+    memset(nv12_image_.get(), 0, y_size);
+    memset(nv12_image_.get() + y_size, 128, y_size / 2);
+
+    return true;
+}
+
+bool VideoEncoderH264::setDeviceManager()
+{
+    HRESULT hr;
+
+    if (!device_manager_)
+    {
+        hr = MFCreateDXGIDeviceManager(&reset_token_, device_manager_.GetAddressOf());
+        if (FAILED(hr))
+        {
+            qWarning("MFCreateDXGIDeviceManager failed: 0x%08X", hr);
+            return false;
+        }
+    }
+
+    hr = device_manager_->ResetDevice(device_.Get(), reset_token_);
+    if (FAILED(hr))
+    {
+        qWarning("ResetDevice failed: 0x%08X", hr);
+        return false;
+    }
+
+    hr = transform_->ProcessMessage(MFT_MESSAGE_SET_D3D_MANAGER,
+                                    reinterpret_cast<ULONG_PTR>(device_manager_.Get()));
+    if (FAILED(hr))
+    {
+        qWarning("Unable to set the device manager: 0x%08X", hr);
+        return false;
+    }
+
+    return true;
+}
+
+bool VideoEncoderH264::createVideoProcessor()
+{
+    input_view_.Reset();
+    input_texture_.Reset();
+    video_processor_.Reset();
+    processor_enumerator_.Reset();
+
+    Microsoft::WRL::ComPtr<ID3D11DeviceContext> context;
+    device_->GetImmediateContext(context.GetAddressOf());
+
+    HRESULT hr = device_.As(&video_device_);
+    if (SUCCEEDED(hr))
+        hr = context.As(&video_context_);
+
+    if (FAILED(hr))
+    {
+        qWarning("The video processing is not supported: 0x%08X", hr);
+        return false;
+    }
+
+    D3D11_VIDEO_PROCESSOR_CONTENT_DESC content_desc;
+    memset(&content_desc, 0, sizeof(content_desc));
+
+    content_desc.InputFrameFormat = D3D11_VIDEO_FRAME_FORMAT_PROGRESSIVE;
+    content_desc.InputFrameRate   = { kFrameRate, 1 };
+    content_desc.InputWidth       = screen_size_.width();
+    content_desc.InputHeight      = screen_size_.height();
+    content_desc.OutputFrameRate  = { kFrameRate, 1 };
+    content_desc.OutputWidth      = picture_size_.width();
+    content_desc.OutputHeight     = picture_size_.height();
+    content_desc.Usage            = D3D11_VIDEO_USAGE_OPTIMAL_SPEED;
+
+    hr = video_device_->CreateVideoProcessorEnumerator(&content_desc,
+                                                       processor_enumerator_.GetAddressOf());
+    if (SUCCEEDED(hr))
+    {
+        hr = video_device_->CreateVideoProcessor(processor_enumerator_.Get(), 0,
+                                                 video_processor_.GetAddressOf());
+    }
+
+    if (FAILED(hr))
+    {
+        qWarning("Unable to create the video processor: 0x%08X", hr);
+        return false;
+    }
+
+    // The same conversion as for the frames in the memory: BT.601 with the limited range.
+    D3D11_VIDEO_PROCESSOR_COLOR_SPACE input_color_space;
+    memset(&input_color_space, 0, sizeof(input_color_space));
+
+    D3D11_VIDEO_PROCESSOR_COLOR_SPACE output_color_space;
+    memset(&output_color_space, 0, sizeof(output_color_space));
+    output_color_space.Nominal_Range = D3D11_VIDEO_PROCESSOR_NOMINAL_RANGE_16_235;
+
+    video_context_->VideoProcessorSetStreamColorSpace(video_processor_.Get(), 0,
+                                                      &input_color_space);
+    video_context_->VideoProcessorSetOutputColorSpace(video_processor_.Get(),
+                                                      &output_color_space);
+    video_context_->VideoProcessorSetStreamAutoProcessingMode(video_processor_.Get(), 0, FALSE);
+
+    // The screen is not scaled. The alignment of the picture to the macroblock is black.
+    const RECT screen_rect = { 0, 0, screen_size_.width(), screen_size_.height() };
+
+    video_context_->VideoProcessorSetStreamSourceRect(video_processor_.Get(), 0, TRUE,
+                                                      &screen_rect);
+    video_context_->VideoProcessorSetStreamDestRect(video_processor_.Get(), 0, TRUE,
+                                                    &screen_rect);
+
+    D3D11_VIDEO_COLOR black;
+    black.YCbCr = { 16.0f / 255.0f, 0.5f, 0.5f, 1.0f };
+
+    video_context_->VideoProcessorSetOutputBackgroundColor(video_processor_.Get(), TRUE, &black);
+    return true;
+}
+
+void VideoEncoderH264::convertRect(const DesktopFrame* frame, const QRect& rect)
+{
+    // The chroma of NV12 is subsampled 2x2, so the rectangle starts at even coordinates.
+    const int x = rect.x() & ~1;
+    const int y = rect.y() & ~1;
+    const int width = rect.x() + rect.width() - x;
+    const int height = rect.y() + rect.height() - y;
+
+    quint8* y_data = nv12_image_.get() + y_stride_ * y + x;
+    quint8* uv_data = nv12_image_.get() + y_stride_ * picture_size_.height() +
+        y_stride_ * (y / 2) + x;
+
+    libyuv::ARGBToNV12(frame->frameDataAtPos(x, y),
+                       frame->stride(),
+                       y_data, y_stride_,
+                       uv_data, y_stride_,
+                       width,
+                       height);
+}
+
+bool VideoEncoderH264::convertTexture(ID3D11Texture2D* texture, IMFMediaBuffer** buffer)
+{
+    D3D11_TEXTURE2D_DESC texture_desc;
+    memset(&texture_desc, 0, sizeof(texture_desc));
+
+    texture_desc.Width            = picture_size_.width();
+    texture_desc.Height           = picture_size_.height();
+    texture_desc.MipLevels        = 1;
+    texture_desc.ArraySize        = 1;
+    texture_desc.Format           = DXGI_FORMAT_NV12;
+    texture_desc.SampleDesc.Count = 1;
+    texture_desc.Usage            = D3D11_USAGE_DEFAULT;
+    texture_desc.BindFlags        = D3D11_BIND_RENDER_TARGET;
+
+    // The encoder may still read the texture of the previous sample, so each sample has its own
+    // texture like the buffers of the frames in the memory.
+    Microsoft::WRL::ComPtr<ID3D11Texture2D> nv12_texture;
+
+    HRESULT hr = device_->CreateTexture2D(&texture_desc, nullptr, nv12_texture.GetAddressOf());
+    if (FAILED(hr))
+    {
+        qWarning("CreateTexture2D failed: 0x%08X", hr);
+        return false;
+    }
+
+    if (input_texture_.Get() != texture)
+    {
+        D3D11_VIDEO_PROCESSOR_INPUT_VIEW_DESC input_desc;
+        memset(&input_desc, 0, sizeof(input_desc));
+        input_desc.ViewDimension = D3D11_VPIV_DIMENSION_TEXTURE2D;
+
+        hr = video_device_->CreateVideoProcessorInputView(texture,
+                                                          processor_enumerator_.Get(),
+                                                          &input_desc,
+                                                          input_view_.ReleaseAndGetAddressOf());
+        if (FAILED(hr))
+        {
+            qWarning("CreateVideoProcessorInputView failed: 0x%08X", hr);
+            input_texture_.Reset();
+            return false;
+        }
+
+        input_texture_ = texture;
+    }
+
+    D3D11_VIDEO_PROCESSOR_OUTPUT_VIEW_DESC output_desc;
+    memset(&output_desc, 0, sizeof(output_desc));
+    output_desc.ViewDimension = D3D11_VPOV_DIMENSION_TEXTURE2D;
+
+    Microsoft::WRL::ComPtr<ID3D11VideoProcessorOutputView> output_view;
+
+    hr = video_device_->CreateVideoProcessorOutputView(nv12_texture.Get(),
+                                                       processor_enumerator_.Get(),
+                                                       &output_desc,
+                                                       output_view.GetAddressOf());
+    if (FAILED(hr))
+    {
+        qWarning("CreateVideoProcessorOutputView failed: 0x%08X", hr);
+        return false;
+    }
+
+    D3D11_VIDEO_PROCESSOR_STREAM stream;
+    memset(&stream, 0, sizeof(stream));
+
+    stream.Enable = TRUE;
+    stream.pInputSurface = input_view_.Get();
+
+    // The conversion is queued to the GPU after the copies of the changed areas to the texture.
+    hr = video_context_->VideoProcessorBlt(video_processor_.Get(), output_view.Get(), 0, 1,
+                                           &stream);
+    if (FAILED(hr))
+    {
+        qWarning("VideoProcessorBlt failed: 0x%08X", hr);
+        return false;
+    }
+
+    hr = MFCreateDXGISurfaceBuffer(__uuidof(ID3D11Texture2D), nv12_texture.Get(), 0, FALSE,
+                                   buffer);
+    if (FAILED(hr))
+    {
+        qWarning("MFCreateDXGISurfaceBuffer failed: 0x%08X", hr);
+        return false;
+    }
+
+    Microsoft::WRL::ComPtr<IMF2DBuffer> buffer_2d;
+    DWORD length = 0;
+
+    hr = (*buffer)->QueryInterface(IID_PPV_ARGS(buffer_2d.GetAddressOf()));
+    if (SUCCEEDED(hr))
+        hr = buffer_2d->GetContiguousLength(&length);
+    if (SUCCEEDED(hr))
+        hr = (*buffer)->SetCurrentLength(length);
+
+    if (FAILED(hr))
+    {
+        qWarning("Unable to set the length of the buffer: 0x%08X", hr);
+        return false;
+    }
+
+    return true;
+}
+
+bool VideoEncoderH264::waitForEvent(MediaEventType* event_type)
+{
+    Microsoft::WRL::ComPtr<IMFMediaEvent> event;
+
+    HRESULT hr = event_generator_->GetEvent(0, event.GetAddressOf());
+    if (FAILED(hr))
+    {
+        qWarning("GetEvent failed: 0x%08X", hr);
+        return false;
+    }
+
+    HRESULT status = S_OK;
+
+    hr = event->GetStatus(&status);
+    if (FAILED(hr) || FAILED(status))
+    {
+        qWarning("The encoder reported an error: 0x%08X", FAILED(hr) ? hr : status);
+        return false;
+    }
+
+    hr = event->GetType(event_type);
+    if (FAILED(hr))
+    {
+        qWarning("GetType failed: 0x%08X", hr);
+        return false;
+    }
+
+    return true;
+}
+
+bool VideoEncoderH264::processInput(const DesktopFrame* frame)
+{
+    Microsoft::WRL::ComPtr<IMFMediaBuffer> buffer;
+
+    if (device_)
+    {
+        if (!convertTexture(frame->texture(), buffer.GetAddressOf()))
+            return false;
+    }
+    else
+    {
+        const DWORD buffer_size = y_stride_ * picture_size_.height() * 3 / 2;
+
+        HRESULT hr = MFCreateMemoryBuffer(buffer_size, buffer.GetAddressOf());
+        if (FAILED(hr))
+        {
+            qWarning("MFCreateMemoryBuffer failed: 0x%08X", hr);
+            return false;
+        }
+
+        BYTE* data = nullptr;
+
+        hr = buffer->Lock(&data, nullptr, nullptr);
+        if (FAILED(hr))
+        {
+            qWarning("IMFMediaBuffer::Lock failed: 0x%08X", hr);
+            return false;
+        }
+
+        memcpy(data, nv12_image_.get(), buffer_size);
+
+        buffer->Unlock();
+        buffer->SetCurrentLength(buffer_size);
+    }
+
+    Microsoft::WRL::ComPtr<IMFSample> sample;
+
+    HRESULT hr = MFCreateSample(sample.GetAddressOf());
+    if (SUCCEEDED(hr))
+        hr = sample->AddBuffer(buffer.Get());
+    if (SUCCEEDED(hr))
+        hr = sample->SetSampleTime(timestamp_);
+    if (SUCCEEDED(hr))
+        hr = sample->SetSampleDuration(kFrameDuration);
+
+    if (FAILED(hr))
+    {
+        qWarning("Unable to create the sample: 0x%08X", hr);
+        return false;
+    }
+
+    timestamp_ += kFrameDuration;
+
+    hr = transform_->ProcessInput(input_stream_id_, sample.Get(), 0);
+    if (FAILED(hr))
+    {
+        qWarning("ProcessInput failed: 0x%08X", hr);
+        return false;
+    }
+
+    return true;
+}
+
+bool VideoEncoderH264::processOutput(proto::desktop::VideoPacket* packet)
+{
+    MFT_OUTPUT_STREAM_INFO stream_info;
+    memset(&stream_info, 0, sizeof(stream_info));
+
+    HRESULT hr = transform_->GetOutputStreamInfo(output_stream_id_, &stream_info);
+    if (FAILED(hr))
+    {
+        qWarning("GetOutputStreamInfo failed: 0x%08X", hr);
+        return false;
+    }
+
+    const bool provides_samples = (stream_info.dwFlags &
+        (MFT_OUTPUT_STREAM_PROVIDES_SAMPLES | MFT_OUTPUT_STREAM_CAN_PROVIDE_SAMPLES)) != 0;
+
+    Microsoft::WRL::ComPtr<IMFSample> sample;
+
+    MFT_OUTPUT_DATA_BUFFER output;
+    memset(&output, 0, sizeof(output));
+    output.dwStreamID = output_stream_id_;
+
+    if (!provides_samples)
+    {
+        Microsoft::WRL::ComPtr<IMFMediaBuffer> buffer;
+
+        hr = MFCreateMemoryBuffer(stream_info.cbSize, buffer.GetAddressOf());
+        if (SUCCEEDED(hr))
+            hr = MFCreateSample(sample.GetAddressOf());
+        if (SUCCEEDED(hr))
+            hr = sample->AddBuffer(buffer.Get());
+
+        if (FAILED(hr))
+        {
+            qWarning("Unable to create the output sample: 0x%08X", hr);
+            return false;
+        }
+
+        output.pSample = sample.Get();
+    }
+
+    DWORD status = 0;
+
+    hr = transform_->ProcessOutput(0, 1, &output, &status);
+
+    if (output.pEvents)
+        output.pEvents->Release();
+
+    // The sample provided by the encoder is owned by the caller.
+    if (provides_samples && output.pSample)
+        sample.Attach(output.pSample);
+
+    if (hr == MF_E_TRANSFORM_STREAM_CHANGE)
+    {
+        Microsoft::WRL::ComPtr<IMFMediaType> output_type;
+
+        hr = transform_->GetOutputAvailableType(output_stream_id_, 0, output_type.GetAddressOf());
+        if (SUCCEEDED(hr))
+            hr = transform_->SetOutputType(output_stream_id_, output_type.Get(), 0);
+
+        if (FAILED(hr))
+        {
+            qWarning("Unable to change the output type: 0x%08X", hr);
+            return false;
+        }
+
+        return true;
+    }
+
+    if (FAILED(hr))
+    {
+        qWarning("ProcessOutput failed: 0x%08X", hr);
+        return false;
+    }
+
+    if (!sample)
+        return true;
+
+    Microsoft::WRL::ComPtr<IMFMediaBuffer> buffer;
+
+    hr = sample->ConvertToContiguousBuffer(buffer.GetAddressOf());
+    if (FAILED(hr))
+    {
+        qWarning("ConvertToContiguousBuffer failed: 0x%08X", hr);
+        return false;
+    }
+
+    BYTE* data = nullptr;
+    DWORD length = 0;
+
+    hr = buffer->Lock(&data, nullptr, &length);
+    if (FAILED(hr))
+    {
+        qWarning("IMFMediaBuffer::Lock failed: 0x%08X", hr);
+        return false;
+    }
+
+    packet->mutable_data()->append(reinterpret_cast<const char*>(data), length);
+    buffer->Unlock();
+
+    return true;
+}
+
+bool VideoEncoderH264::encode(const DesktopFrame* frame, proto::desktop::VideoPacket* packet)
+{
+    packet->Clear();
+
+    packet->set_encoding(proto::desktop::VIDEO_ENCODING_H264);
+
+    Microsoft::WRL::ComPtr<ID3D11Device> device;
+
+    if (frame->texture())
+        frame->texture()->GetDevice(device.GetAddressOf());
+
+    if (screen_size_ != frame->size() || device.Get() != device_.Get())
+    {
+        // The media types and the device can not be changed while streaming, so the encoder is
+        // created again.
+        if (!picture_size_.isEmpty() && !createTransform())
+            return false;
+
+        screen_size_ = frame->size();
+        device_ = std::move(device);
+
+        if (!configureTransform())
+            return false;
+
+        // The first frame of the stream is a key frame.
+        key_frame_pending_ = false;
+
+        VideoUtil::toVideoSize(screen_size_, packet->mutable_format()->mutable_screen_size());
+    }
+
+    if (key_frame_pending_)
+    {
+        key_frame_pending_ = false;
+
+        // The encoder may return the key frame with one of the next packets.
+        setCodecValue(codec_api_.Get(), CODECAPI_AVEncVideoForceKeyFrame, 1);
+
+        VideoUtil::toVideoSize(screen_size_, packet->mutable_format()->mutable_screen_size());
+    }
+
+    // The encoder always encodes the whole picture, so the moved areas are converted too. The
+    // texture is converted entirely on the GPU with the input.
+    for (const auto& move_rect : frame->moveRects())
+    {
+        if (!device_)
+            convertRect(frame, move_rect.target);
+
+        VideoUtil::toVideoCopyRect(move_rect, packet->add_copy_rect());
+    }
+
+    for (const auto& rect : frame->updatedRegion())
+    {
+        if (!device_)
+            convertRect(frame, rect);
+
+        VideoUtil::toVideoRect(rect, packet->add_dirty_rect());
+    }
+
+    bool input_sent = false;
+
+    while (true)
+    {
+        if (!input_sent && need_input_count_ > 0)
+        {
+            if (!processInput(frame))
+                return false;
+
+            --need_input_count_;
+            input_sent = true;
+            continue;
+        }
+
+        MediaEventType event_type = MEUnknown;
+
+        if (!waitForEvent(&event_type))
+            return false;
+
+        if (event_type == METransformNeedInput)
+        {
+            ++need_input_count_;
+
+            // The encoder requests more frames before the output. The packet is sent without
+            // the data and the picture comes with one of the next packets.
+            if (input_sent)
+                break;
+        }
+        else if (event_type == METransformHaveOutput)
+        {
+            if (!processOutput(packet))
+                return false;
+
+            if (input_sent && !packet->data().empty())
+                break;
+        }
+    }
+
+    return true;
+}
+
+void VideoEncoderH264::requestKeyFrame()
+{
+    key_frame_pending_ = true;
+}
+
+void VideoEncoderH264::setBandwidth(qint64 bandwidth)
+{
+    if (screen_size_.isEmpty() || !bandwidth)
+        return;
+
+    const quint32 default_bitrate =
+        screen_size_.width() * screen_size_.height() * kDefaultBitsPerPixel;
+
+    const quint32 target_bitrate = static_cast<quint32>(qBound<qint64>(
+        kMinBitrate, bandwidth * 8 * kBandwidthUsagePercent / 100, default_bitrate));
+
+    // Small changes are ignored to avoid reconfiguring the encoder for every frame.
+    if (target_bitrate > bitrate_ * 9 / 10 && target_bitrate < bitrate_ * 11 / 10)
+        return;
+
+    bitrate_ = target_bitrate;
+    setCodecValue(codec_api_.Get(), CODECAPI_AVEncCommonMeanBitRate, bitrate_);
+}
+
+} // namespace aspia
@@ -0,0 +1,107 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/video_encoder_h264.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CODEC__VIDEO_ENCODER_H264_H
+#define _ASPIA_CODEC__VIDEO_ENCODER_H264_H
+
+#include <QSize>
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <d3d11.h>
+#include <mfapi.h>
+#include <mftransform.h>
+#include <strmif.h>
+#include <wrl/client.h>
+
+#include "base/buffer_pool.h"
+#include "codec/video_encoder.h"
+
+namespace aspia {
+
+//
+// H.264 encoder based on the hardware encoders of Media Foundation. The GPU vendors (NVENC,
+// Quick Sync Video, AMF) provide them as asynchronous MFTs. The frames in the video memory
+// (DesktopFrameTexture) are converted to NV12 by the video processor of their device and passed
+// to the encoder without the copy to the memory.
+//
+class VideoEncoderH264 : public VideoEncoder
+{
+public:
+    ~VideoEncoderH264();
+
+    // Returns true if the hardware H.264 encoder is present in the system.
+    static bool isAvailable();
+
+    // Returns nullptr if the hardware H.264 encoder can not be created.
+    static std::unique_ptr<VideoEncoderH264> create();
+
+    // Returns true if the encoder takes the frames in the video memory.
+    bool isTextureInputSupported() const;
+
+    bool encode(const DesktopFrame* frame, proto::desktop::VideoPacket* packet) override;
+    void setBandwidth(qint64 bandwidth) override;
+    void requestKeyFrame() override;
+
+private:
+    VideoEncoderH264() = default;
+
+    bool createTransform();
+    bool configureTransform();
+    bool setDeviceManager();
+    bool createVideoProcessor();
+    void convertRect(const DesktopFrame* frame, const QRect& rect);
+    bool convertTexture(ID3D11Texture2D* texture, IMFMediaBuffer** buffer);
+    bool waitForEvent(MediaEventType* event_type);
+    bool processInput(const DesktopFrame* frame);
+    bool processOutput(proto::desktop::VideoPacket* packet);
+
+    bool media_foundation_started_ = false;
+
+    Microsoft::WRL::ComPtr<IMFTransform> transform_;
+    Microsoft::WRL::ComPtr<IMFMediaEventGenerator> event_generator_;
+    Microsoft::WRL::ComPtr<ICodecAPI> codec_api_;
+
+    DWORD input_stream_id_ = 0;
+    DWORD output_stream_id_ = 0;
+
+    // Number of METransformNeedInput events that have not been answered yet.
+    int need_input_count_ = 0;
+
+    // The current frame size and the size of the encoded picture (aligned to the macroblock).
+    QSize screen_size_;
+    QSize picture_size_;
+
+    bool key_frame_pending_ = false;
+
+    // Buffer for storing the NV12 image of the frames in the memory.
+    BufferPool::Buffer nv12_image_;
+    int y_stride_ = 0;
+
+    // The device of the frames in the video memory or nullptr if the frames are in the memory.
+    Microsoft::WRL::ComPtr<ID3D11Device> device_;
+    Microsoft::WRL::ComPtr<IMFDXGIDeviceManager> device_manager_;
+    UINT reset_token_ = 0;
+
+    Microsoft::WRL::ComPtr<ID3D11VideoDevice> video_device_;
+    Microsoft::WRL::ComPtr<ID3D11VideoContext> video_context_;
+    Microsoft::WRL::ComPtr<ID3D11VideoProcessorEnumerator> processor_enumerator_;
+    Microsoft::WRL::ComPtr<ID3D11VideoProcessor> video_processor_;
+
+    // The view of the last texture of the frames.
+    Microsoft::WRL::ComPtr<ID3D11Texture2D> input_texture_;
+    Microsoft::WRL::ComPtr<ID3D11VideoProcessorInputView> input_view_;
+
+    quint32 bitrate_ = 0;
+    LONGLONG timestamp_ = 0;
+
+    Q_DISABLE_COPY(VideoEncoderH264)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_CODEC__VIDEO_ENCODER_H264_H
@@ -0,0 +1,334 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/video_encoder_hybrid.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "codec/video_encoder_hybrid.h"
+
+#include <QDebug>
+
+#include "codec/video_util.h"
+#include "desktop_capture/desktop_frame.h"
+
+namespace aspia {
+
+namespace {
+
+// Size of the classified blocks.
+constexpr int kBlockSize = 32;
+
+// A block is considered as video if it has changed in this number of the last 16 frames.
+constexpr int kMinVideoChanges = 6;
+
+// Blocks with fewer colors are considered as text or UI.
+constexpr int kMaxTextColors = 48;
+
+// A lossy block is refined if it has not changed in the last frames of this mask.
+constexpr quint16 kStaticMask = 0x0003;
+
+// The frame which uses the buffer of another frame with its own updated region.
+class FrameView : public DesktopFrame
+{
+public:
+    explicit FrameView(const DesktopFrame* frame)
+        : DesktopFrame(frame->size(), frame->format(), frame->stride(), frame->frameData())
+    {
+        // Nothing
+    }
+
+private:
+    Q_DISABLE_COPY(FrameView)
+};
+
+int bitCount(quint16 value)
+{
+    int count = 0;
+
+    for (; value; value &= value - 1)
+        ++count;
+
+    return count;
+}
+
+// Returns true if the area has more than |max_colors| colors.
+bool hasManyColors(const DesktopFrame* frame, const QRect& rect, int max_colors)
+{
+    quint32 colors[kMaxTextColors + 1];
+    int count = 0;
+
+    const quint8* row = frame->frameDataAtPos(rect.topLeft());
+
+    for (int y = 0; y < rect.height(); ++y)
+    {
+        const quint32* pixel = reinterpret_cast<const quint32*>(row);
+
+        for (int x = 0; x < rect.width(); ++x)
+        {
+            const quint32 color = pixel[x];
+
+            // Most of the neighbor pixels have the same color.
+            if (count != 0 && colors[count - 1] == color)
+                continue;
+
+            int i = 0;
+
+            while (i < count && colors[i] != color)
+                ++i;
+
+            if (i == count)
+            {
+                if (count == max_colors)
+                    return true;
+
+                colors[count++] = color;
+            }
+        }
+
+        row += frame->stride();
+    }
+
+    return false;
+}
+
+} // namespace
+
+VideoEncoderHybrid::VideoEncoderHybrid(std::unique_ptr<VideoEncoder> lossless_encoder,
+                                       std::unique_ptr<VideoEncoder> lossy_encoder)
+    : lossless_encoder_(std::move(lossless_encoder)),
+      lossy_encoder_(std::move(lossy_encoder))
+{
+    // Nothing
+}
+
+// static
+std::unique_ptr<VideoEncoderHybrid> VideoEncoderHybrid::create(
+    std::unique_ptr<VideoEncoder> lossless_encoder,
+    std::unique_ptr<VideoEncoder> lossy_encoder)
+{
+    if (!lossless_encoder || !lossy_encoder)
+        return nullptr;
+
+    return std::unique_ptr<VideoEncoderHybrid>(
+        new VideoEncoderHybrid(std::move(lossless_encoder), std::move(lossy_encoder)));
+}
+
+void VideoEncoderHybrid::setBandwidth(qint64 bandwidth)
+{
+    lossy_encoder_->setBandwidth(bandwidth);
+}
+
+void VideoEncoderHybrid::setEffort(int effort)
+{
+    lossless_encoder_->setEffort(effort);
+    lossy_encoder_->setEffort(effort);
+}
+
+void VideoEncoderHybrid::setFocusRegion(const QRegion& region)
+{
+    lossy_encoder_->setFocusRegion(region);
+}
+
+void VideoEncoderHybrid::setQualitySampling(int interval)
+{
+    // The lossless layer is always equal to the source.
+    lossy_encoder_->setQualitySampling(interval);
+}
+
+void VideoEncoderHybrid::requestKeyFrame()
+{
+    lossless_encoder_->requestKeyFrame();
+    lossy_encoder_->requestKeyFrame();
+
+    // The classification of the blocks starts again with the format.
+    screen_size_ = QSize();
+}
+
+bool VideoEncoderHybrid::isTopOffPending() const
+{
+    return lossy_block_count_ != 0;
+}
+
+void VideoEncoderHybrid::resetBlocks(const QSize& size)
+{
+    blocks_x_ = (size.width() + kBlockSize - 1) / kBlockSize;
+    blocks_y_ = (size.height() + kBlockSize - 1) / kBlockSize;
+
+    const size_t block_count = blocks_x_ * blocks_y_;
+
+    change_history_ = std::make_unique<quint16[]>(block_count);
+    lossy_blocks_ = std::make_unique<bool[]>(block_count);
+
+    memset(change_history_.get(), 0, block_count * sizeof(quint16));
+    memset(lossy_blocks_.get(), 0, block_count * sizeof(bool));
+
+    lossy_block_count_ = 0;
+}
+
+QRect VideoEncoderHybrid::blockRect(int block_x, int block_y) const
+{
+    return QRect(block_x * kBlockSize, block_y * kBlockSize, kBlockSize, kBlockSize)
+        .intersected(QRect(QPoint(), screen_size_));
+}
+
+void VideoEncoderHybrid::classifyBlocks(const DesktopFrame* frame,
+                                        QRegion* lossless_region,
+                                        QRegion* lossy_region)
+{
+    const size_t block_count = blocks_x_ * blocks_y_;
+
+    // Mark the changed blocks in bit 0 of the history.
+    for (size_t i = 0; i < block_count; ++i)
+        change_history_[i] <<= 1;
+
+    for (const auto& rect : frame->updatedRegion())
+    {
+        const int left = rect.left() / kBlockSize;
+        const int top = rect.top() / kBlockSize;
+        const int right = (rect.left() + rect.width() - 1) / kBlockSize;
+        const int bottom = (rect.top() + rect.height() - 1) / kBlockSize;
+
+        for (int y = top; y <= bottom; ++y)
+        {
+            for (int x = left; x <= right; ++x)
+                change_history_[y * blocks_x_ + x] |= 1;
+        }
+    }
+
+    const bool top_off = frame->updatedRegion().isEmpty() && frame->moveRects().isEmpty();
+
+    for (int y = 0; y < blocks_y_; ++y)
+    {
+        for (int x = 0; x < blocks_x_; ++x)
+        {
+            const int index = y * blocks_x_ + x;
+            const quint16 history = change_history_[index];
+
+            if (history & 1)
+            {
+                const QRect rect = blockRect(x, y);
+
+                const bool is_video = bitCount(history) >= kMinVideoChanges &&
+                    hasManyColors(frame, rect, kMaxTextColors);
+
+                if (is_video)
+                {
+                    *lossy_region += rect;
+
+                    if (!lossy_blocks_[index])
+                    {
+                        lossy_blocks_[index] = true;
+                        ++lossy_block_count_;
+                    }
+                }
+                else
+                {
+                    *lossless_region += rect;
+
+                    if (lossy_blocks_[index])
+                    {
+                        lossy_blocks_[index] = false;
+                        --lossy_block_count_;
+                    }
+                }
+            }
+            else if (lossy_blocks_[index] && (top_off || !(history & kStaticMask)))
+            {
+                // The video has stopped in the block. The last picture is sent losslessly.
+                *lossless_region += blockRect(x, y);
+
+                lossy_blocks_[index] = false;
+                --lossy_block_count_;
+            }
+        }
+    }
+
+    // Only the changed parts of the blocks are sent.
+    *lossy_region &= frame->updatedRegion();
+
+    QRegion refined_region = *lossless_region - frame->updatedRegion();
+    *lossless_region &= frame->updatedRegion();
+    *lossless_region += refined_region;
+}
+
+bool VideoEncoderHybrid::encodeLayer(VideoEncoder* encoder,
+                                     const DesktopFrame* frame,
+                                     const QRegion& region,
+                                     proto::desktop::VideoPacket* packet)
+{
+    if (region.isEmpty())
+        return true;
+
+    FrameView layer_frame(frame);
+    *layer_frame.mutableUpdatedRegion() = region;
+
+    return encoder->encode(&layer_frame, packet->add_layer());
+}
+
+void VideoEncoderHybrid::markLossyRects(const proto::desktop::VideoPacket& layer)
+{
+    for (const auto& dirty_rect : layer.dirty_rect())
+    {
+        const QRect rect = VideoUtil::fromVideoRect(dirty_rect);
+        if (rect.isEmpty())
+            continue;
+
+        const int left = rect.left() / kBlockSize;
+        const int top = rect.top() / kBlockSize;
+        const int right = (rect.left() + rect.width() - 1) / kBlockSize;
+        const int bottom = (rect.top() + rect.height() - 1) / kBlockSize;
+
+        for (int y = top; y <= bottom; ++y)
+        {
+            for (int x = left; x <= right; ++x)
+            {
+                const int index = y * blocks_x_ + x;
+
+                if (!lossy_blocks_[index])
+                {
+                    lossy_blocks_[index] = true;
+                    ++lossy_block_count_;
+                }
+            }
+        }
+    }
+}
+
+bool VideoEncoderHybrid::encode(const DesktopFrame* frame, proto::desktop::VideoPacket* packet)
+{
+    packet->Clear();
+
+    packet->set_encoding(proto::desktop::VIDEO_ENCODING_HYBRID);
+
+    if (screen_size_ != frame->size())
+    {
+        screen_size_ = frame->size();
+        resetBlocks(screen_size_);
+
+        VideoUtil::toVideoSize(screen_size_, packet->mutable_format()->mutable_screen_size());
+    }
+
+    // The moves are applied by the client before all layers.
+    for (const auto& move_rect : frame->moveRects())
+        VideoUtil::toVideoCopyRect(move_rect, packet->add_copy_rect());
+
+    QRegion lossless_region;
+    QRegion lossy_region;
+
+    classifyBlocks(frame, &lossless_region, &lossy_region);
+
+    // The lossy layer is decoded first.
+    if (!encodeLayer(lossy_encoder_.get(), frame, lossy_region, packet))
+        return false;
+
+    if (packet->layer_size())
+        markLossyRects(packet->layer(0));
+
+    if (!encodeLayer(lossless_encoder_.get(), frame, lossless_region, packet))
+        return false;
+
+    return true;
+}
+
+} // namespace aspia
@@ -0,0 +1,78 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/video_encoder_hybrid.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CODEC__VIDEO_ENCODER_HYBRID_H
+#define _ASPIA_CODEC__VIDEO_ENCODER_HYBRID_H
+
+#include <QSize>
+
+#include "codec/video_encoder.h"
+
+namespace aspia {
+
+//
+// Splits the updated region into blocks and classifies them by the change frequency and
+// the number of colors. Text and UI blocks are sent through the lossless encoder, blocks
+// of video and photos through the lossy encoder. Each encoder produces a layer of the
+// VIDEO_ENCODING_HYBRID packet. The blocks sent with losses are sent losslessly when they
+// stop changing.
+//
+class VideoEncoderHybrid : public VideoEncoder
+{
+public:
+    ~VideoEncoderHybrid() = default;
+
+    // Returns nullptr if any of the encoders is nullptr.
+    static std::unique_ptr<VideoEncoderHybrid> create(
+        std::unique_ptr<VideoEncoder> lossless_encoder,
+        std::unique_ptr<VideoEncoder> lossy_encoder);
+
+    bool encode(const DesktopFrame* frame, proto::desktop::VideoPacket* packet) override;
+    void setBandwidth(qint64 bandwidth) override;
+    void setEffort(int effort) override;
+    bool isTopOffPending() const override;
+    void setFocusRegion(const QRegion& region) override;
+    void setQualitySampling(int interval) override;
+    void requestKeyFrame() override;
+
+private:
+    VideoEncoderHybrid(std::unique_ptr<VideoEncoder> lossless_encoder,
+                       std::unique_ptr<VideoEncoder> lossy_encoder);
+
+    void resetBlocks(const QSize& size);
+    QRect blockRect(int block_x, int block_y) const;
+    void classifyBlocks(const DesktopFrame* frame, QRegion* lossless_region, QRegion* lossy_region);
+    bool encodeLayer(VideoEncoder* encoder,
+                     const DesktopFrame* frame,
+                     const QRegion& region,
+                     proto::desktop::VideoPacket* packet);
+
+    // The lossy encoder may enlarge its rectangles. The blocks under them must be refined too.
+    void markLossyRects(const proto::desktop::VideoPacket& layer);
+
+    std::unique_ptr<VideoEncoder> lossless_encoder_;
+    std::unique_ptr<VideoEncoder> lossy_encoder_;
+
+    // The current frame size.
+    QSize screen_size_;
+
+    int blocks_x_ = 0;
+    int blocks_y_ = 0;
+
+    // Bit N is set if the block was changed N frames ago.
+    std::unique_ptr<quint16[]> change_history_;
+
+    // Blocks which were sent with losses and have not been refined yet.
+    std::unique_ptr<bool[]> lossy_blocks_;
+    int lossy_block_count_ = 0;
+
+    Q_DISABLE_COPY(VideoEncoderHybrid)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_CODEC__VIDEO_ENCODER_HYBRID_H
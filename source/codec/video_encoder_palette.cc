@@ -0,0 +1,314 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/video_encoder_palette.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "codec/video_encoder_palette.h"
+
+#include <QDebug>
+
+#include <algorithm>
+#include <cstring>
+
+#include "codec/compressor_zlib.h"
+#include "codec/video_util.h"
+#include "desktop_capture/desktop_frame.h"
+
+namespace aspia {
+
+namespace {
+
+constexpr quint8 kRunFlag = 0x80;
+
+void appendColor(quint32 color, std::string* output)
+{
+    char buffer[sizeof(color)];
+    memcpy(buffer, &color, sizeof(color));
+    output->append(buffer, sizeof(buffer));
+}
+
+// The run of one pixel is the index. The longer runs are the index with kRunFlag followed by
+// the length minus two in the groups of 7 bits, the lowest group first.
+void appendRun(quint8 index, int length, std::string* output)
+{
+    if (length == 1)
+    {
+        output->push_back(static_cast<char>(index));
+        return;
+    }
+
+    output->push_back(static_cast<char>(index | kRunFlag));
+
+    quint32 value = static_cast<quint32>(length - 2);
+
+    while (value >= 0x80)
+    {
+        output->push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+
+    output->push_back(static_cast<char>(value));
+}
+
+void appendSlot(int slot, std::string* output)
+{
+    output->push_back(static_cast<char>(slot & 0xFF));
+    output->push_back(static_cast<char>((slot >> 8) & 0xFF));
+}
+
+} // namespace
+
+VideoEncoderPalette::VideoEncoderPalette(std::unique_ptr<Compressor> compressor,
+                                         int compression_ratio,
+                                         std::unique_ptr<TileCache> tile_cache)
+    : compressor_(std::move(compressor)),
+      compression_ratio_(compression_ratio),
+      tile_cache_(std::move(tile_cache))
+{
+    palette_.reserve(kMaxPaletteSize);
+    pixels_.resize(kTileSize * kTileSize * sizeof(quint32));
+}
+
+// static
+std::unique_ptr<VideoEncoderPalette> VideoEncoderPalette::create(int compression_ratio,
+                                                                 int tile_cache_size)
+{
+    if (compression_ratio < Z_BEST_SPEED || compression_ratio > Z_BEST_COMPRESSION)
+    {
+        qWarning() << "Wrong compression ratio: " << compression_ratio;
+        return nullptr;
+    }
+
+    std::unique_ptr<TileCache> tile_cache;
+
+    if (tile_cache_size != 0)
+    {
+        if (!TileCache::isValidCacheSize(tile_cache_size))
+        {
+            qWarning() << "Wrong tile cache size: " << tile_cache_size;
+            return nullptr;
+        }
+
+        tile_cache = std::make_unique<TileCache>(tile_cache_size);
+    }
+
+    std::unique_ptr<Compressor> compressor =
+        Compressor::create(proto::desktop::COMPRESSION_ZLIB, compression_ratio);
+    if (!compressor)
+        return nullptr;
+
+    return std::unique_ptr<VideoEncoderPalette>(
+        new VideoEncoderPalette(std::move(compressor), compression_ratio, std::move(tile_cache)));
+}
+
+void VideoEncoderPalette::setEffort(int effort)
+{
+    // Each raw tile is a separate stream, so the ratio is changed between the tiles.
+    compressor_->setCompressRatio(
+        qBound(Z_BEST_SPEED, compression_ratio_ + effort, Z_BEST_COMPRESSION));
+}
+
+bool VideoEncoderPalette::encodePaletteTile(const QSize& size, std::string* chunk)
+{
+    palette_.clear();
+    runs_.clear();
+
+    quint8 run_index = 0;
+    quint32 run_color = 0;
+    int run_length = 0;
+
+    const quint32* pixels = reinterpret_cast<const quint32*>(pixels_.data());
+    const int count = size.width() * size.height();
+
+    // The runs continue on the next rows, so the rows of the tile are processed as one row.
+    for (int i = 0; i < count; ++i)
+    {
+        const quint32 color = pixels[i];
+
+        if (run_length && color == run_color)
+        {
+            ++run_length;
+            continue;
+        }
+
+        if (run_length)
+            appendRun(run_index, run_length, &runs_);
+
+        // The tiles of the flat UI have a few colors, so the linear search is fast.
+        auto it = std::find(palette_.begin(), palette_.end(), color);
+        if (it == palette_.end())
+        {
+            if (static_cast<int>(palette_.size()) == kMaxPaletteSize)
+                return false;
+
+            it = palette_.insert(palette_.end(), color);
+        }
+
+        run_index = static_cast<quint8>(it - palette_.begin());
+        run_color = color;
+        run_length = 1;
+    }
+
+    if (palette_.size() == 1)
+    {
+        chunk->push_back(static_cast<char>(TILE_TYPE_SOLID));
+        appendColor(palette_.front(), chunk);
+        return true;
+    }
+
+    appendRun(run_index, run_length, &runs_);
+
+    chunk->reserve(2 + palette_.size() * sizeof(quint32) + runs_.size());
+    chunk->push_back(static_cast<char>(TILE_TYPE_PALETTE));
+    chunk->push_back(static_cast<char>(palette_.size()));
+
+    for (quint32 color : palette_)
+        appendColor(color, chunk);
+
+    chunk->append(runs_);
+    return true;
+}
+
+void VideoEncoderPalette::encodeRawTile(const QSize& size, std::string* chunk)
+{
+    const size_t source_size = size.width() * size.height() * sizeof(quint32);
+
+    compressor_->reset();
+
+    // The pixels of the tile are compressed as a separate stream behind the type.
+    const size_t output_size = source_size + (source_size / 100 + 16);
+
+    chunk->resize(1 + output_size);
+    (*chunk)[0] = static_cast<char>(TILE_TYPE_RAW);
+
+    quint8* output = reinterpret_cast<quint8*>(&(*chunk)[0]) + 1;
+
+    size_t pos = 0;
+    size_t filled = 0;
+    bool compress_again = true;
+
+    while (compress_again && filled < output_size)
+    {
+        size_t consumed = 0;
+        size_t written = 0;
+
+        compress_again = compressor_->process(pixels_.data() + pos, source_size - pos,
+                                              output + filled, output_size - filled,
+                                              Compressor::CompressorFinish,
+                                              &consumed, &written);
+        pos += consumed;
+        filled += written;
+    }
+
+    chunk->resize(1 + filled);
+}
+
+void VideoEncoderPalette::encodeTile(const DesktopFrame* frame,
+                                     const QRect& tile,
+                                     std::string* chunk)
+{
+    const size_t row_size = tile.width() * sizeof(quint32);
+
+    for (int y = 0; y < tile.height(); ++y)
+    {
+        memcpy(pixels_.data() + y * row_size,
+               frame->frameDataAtPos(tile.left(), tile.top() + y),
+               row_size);
+    }
+
+    chunk->clear();
+
+    quint64 hash = 0;
+
+    if (tile_cache_)
+    {
+        hash = TileCache::hash(tile.size(), pixels_.data());
+
+        const int slot = tile_cache_->find(hash, tile.size(), pixels_.data());
+        if (slot != TileCache::kInvalidSlot)
+        {
+            chunk->push_back(static_cast<char>(TILE_TYPE_CACHED));
+            appendSlot(slot, chunk);
+            return;
+        }
+    }
+
+    if (!encodePaletteTile(tile.size(), chunk))
+        encodeRawTile(tile.size(), chunk);
+
+    // The solid tiles are smaller than the references.
+    if (!tile_cache_ || (*chunk)[0] == static_cast<char>(TILE_TYPE_SOLID))
+        return;
+
+    const int slot = tile_cache_->add(hash, tile.size(), pixels_.data());
+
+    std::string header;
+    header.push_back(static_cast<char>((*chunk)[0] | kCacheFlag));
+    appendSlot(slot, &header);
+
+    // The slot follows the type.
+    chunk->replace(0, 1, header);
+}
+
+void VideoEncoderPalette::requestKeyFrame()
+{
+    // The format is sent again, then the cache of the client is cleared.
+    screen_size_ = QSize();
+}
+
+bool VideoEncoderPalette::encode(const DesktopFrame* frame, proto::desktop::VideoPacket* packet)
+{
+    packet->Clear();
+
+    if (frame->format().bytesPerPixel() != sizeof(quint32))
+    {
+        qWarning("Unsupported pixel format");
+        return false;
+    }
+
+    packet->set_encoding(proto::desktop::VIDEO_ENCODING_PALETTE);
+
+    if (screen_size_ != frame->size())
+    {
+        screen_size_ = frame->size();
+
+        proto::desktop::VideoPacketFormat* format = packet->mutable_format();
+
+        VideoUtil::toVideoSize(screen_size_, format->mutable_screen_size());
+        VideoUtil::toVideoPixelFormat(frame->format(), format->mutable_pixel_format());
+
+        if (tile_cache_)
+        {
+            tile_cache_->clear();
+            format->set_tile_cache_size(tile_cache_->size());
+        }
+    }
+
+    for (const auto& move_rect : frame->moveRects())
+        VideoUtil::toVideoCopyRect(move_rect, packet->add_copy_rect());
+
+    // The rectangles are split by the grid of the tiles, so the same areas of the screen are
+    // split equally in the next frames.
+    for (const auto& rect : VideoUtil::coalesceRegion(frame->updatedRegion(), frame->size(), 1))
+    {
+        const int left = rect.left() - rect.left() % kTileSize;
+        const int top = rect.top() - rect.top() % kTileSize;
+
+        for (int y = top; y <= rect.bottom(); y += kTileSize)
+        {
+            for (int x = left; x <= rect.right(); x += kTileSize)
+            {
+                const QRect tile = rect.intersected(QRect(x, y, kTileSize, kTileSize));
+
+                VideoUtil::toVideoRect(tile, packet->add_dirty_rect());
+                encodeTile(frame, tile, packet->add_chunk());
+            }
+        }
+    }
+
+    return true;
+}
+
+} // namespace aspia
@@ -0,0 +1,95 @@
+//
+// PROJECT:         Aspia
+// FILE:            codec/video_encoder_palette.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CODEC__VIDEO_ENCODER_PALETTE_H
+#define _ASPIA_CODEC__VIDEO_ENCODER_PALETTE_H
+
+#include <QRect>
+#include <QSize>
+
+#include <vector>
+
+#include "codec/compressor.h"
+#include "codec/video_encoder.h"
+#include "desktop_capture/tile_cache.h"
+
+namespace aspia {
+
+//
+// Encodes the updated region losslessly by tiles of 64x64 pixels. The flat UI and text have
+// a few colors in a tile, so such a tile is sent as a palette and the runs of the indexes of
+// the palette. A tile of one color is sent as the color. The tiles with many colors (photos,
+// gradients) are sent as the pixels compressed with ZLIB. The data of each tile is stored as
+// a separate chunk of the video packet. If the client has the cache of the tiles, the tiles
+// which it has already received are sent as the references to the cache. The format of the
+// chunks is described in video_decoder_palette.cc.
+//
+class VideoEncoderPalette : public VideoEncoder
+{
+public:
+    ~VideoEncoderPalette() = default;
+
+    static const int kTileSize = 64;
+
+    // Maximum number of the colors of a palette tile.
+    static const int kMaxPaletteSize = 127;
+
+    enum TileType : quint8
+    {
+        TILE_TYPE_SOLID   = 0,
+        TILE_TYPE_PALETTE = 1,
+        TILE_TYPE_RAW     = 2,
+        TILE_TYPE_CACHED  = 3
+    };
+
+    // The tile is stored in the cache of the client after it is decoded.
+    static const quint8 kCacheFlag = 0x80;
+
+    // |compression_ratio| is used for the tiles with many colors. If |tile_cache_size| is not
+    // zero, then the client caches the specified number of the tiles.
+    static std::unique_ptr<VideoEncoderPalette> create(int compression_ratio,
+                                                       int tile_cache_size = 0);
+
+    bool encode(const DesktopFrame* frame, proto::desktop::VideoPacket* packet) override;
+    bool canSplitFrame() const override { return true; }
+    void setEffort(int effort) override;
+    void requestKeyFrame() override;
+
+private:
+    VideoEncoderPalette(std::unique_ptr<Compressor> compressor,
+                        int compression_ratio,
+                        std::unique_ptr<TileCache> tile_cache);
+
+    void encodeTile(const DesktopFrame* frame, const QRect& tile, std::string* chunk);
+
+    // The tile is read from |pixels_|. Returns false if the tile has more than kMaxPaletteSize
+    // colors.
+    bool encodePaletteTile(const QSize& size, std::string* chunk);
+    void encodeRawTile(const QSize& size, std::string* chunk);
+
+    // The current frame size.
+    QSize screen_size_;
+
+    std::unique_ptr<Compressor> compressor_;
+
+    // The ratio of the configuration. setEffort() changes the ratio of the raw tiles.
+    const int compression_ratio_;
+
+    // The tiles which the client has, it is cleared with the format.
+    std::unique_ptr<TileCache> tile_cache_;
+
+    // Buffers of the current tile which are kept between the tiles.
+    std::vector<quint32> palette_;
+    std::string runs_;
+    std::vector<quint8> pixels_;
+
+    Q_DISABLE_COPY(VideoEncoderPalette)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_CODEC__VIDEO_ENCODER_PALETTE_H
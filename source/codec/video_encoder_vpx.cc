@@ -10,6 +10,7 @@
 #include <QDebug>
 #include <QThread>
 
+#include <libyuv/compare.h>
 #include <libyuv/convert_from_argb.h>
 
 #include "codec/video_util.h"
@@ -26,10 +27,141 @@ constexpr int kMacroBlockSize = 16;
 // Magic encoder profile numbers for I444 input formats.
 constexpr int kVp9I444ProfileNumber = 1;
 
+// The minimal width of the tile column in VP9.
+constexpr int kVp9MinTileWidth = 256;
+
+// Limits of the number of threads and log2 of the number of tile columns of libvpx.
+constexpr int kMaxThreads = 64;
+constexpr int kVp9MaxTileColumns = 6;
+
+// Area of the screen (in pixels) for one encoder thread when it is chosen automatically.
+constexpr int kPixelsPerThread = 960 * 540;
+
+// The speeds of the configuration. The higher speeds use less of the processor.
+constexpr int kVp8CpuUsed = 16;
+constexpr int kVp9CpuUsed = 5;
+constexpr int kVp9LossyCpuUsed = 6;
+
+// The range of the speeds which setEffort() chooses and the step of VP8 for each level.
+constexpr int kVp8MinCpuUsed = 8;
+constexpr int kVp8CpuUsedStep = 4;
+constexpr int kVp9MinCpuUsed = 3;
+constexpr int kVp9MaxCpuUsed = 9;
+
 // Magic encoder constants for adaptive quantization strategy.
 constexpr int kVp9AqModeNone = 0;
+constexpr int kVp9AqModeCyclicRefresh = 3;
+
+// Quantizer range of VP8 and lossy VP9 when the bitrate is not limited by the connection.
+constexpr unsigned int kMinQuantizer = 20;
+constexpr unsigned int kMaxQuantizer = 30;
+
+// The worst quantizer used when the bitrate is limited by the connection.
+constexpr unsigned int kWorstQuantizer = 56;
+
+// The minimal bitrate (in kbit/s) that the rate control sets.
+constexpr unsigned int kMinBitrate = 100;
+
+// Part of the estimated bandwidth that is used for the video.
+constexpr int kBandwidthUsagePercent = 80;
+
+// A VP8 block encoded with losses is refined after this number of frames without changes.
+constexpr quint8 kRefineAge = 8;
+
+// Quantizer delta of the refined blocks.
+constexpr int kRefineDeltaQ = -40;
+
+// Part of the macro blocks which may be refined in a frame with changes. The rest is refined
+// in the next frames, so that the refinement does not take the bandwidth of the active areas.
+constexpr size_t kMaxRefineBlocksPercent = 10;
+
+// Quantizer deltas of the VP8 blocks in the focus region (segment 2) and of the other blocks
+// (segment 0) while the focus region is set. The bits taken from the background are spent
+// on the areas which the user looks at.
+constexpr int kFocusDeltaQ = -10;
+constexpr int kBackgroundDeltaQ = 6;
+
+// Part of the rows of macro blocks of VP9 which is refreshed in each frame by the gradual
+// refresh (at least one row).
+constexpr int kIntraRefreshBandPercent = 5;
+
+// libvpx applies the ROI map of VP9 only with this speed and above and without the cyclic
+// refresh AQ, so they are changed for the frames of the gradual refresh.
+constexpr int kVp9MinRoiCpuUsed = 5;
+
+// Segment 1 of the ROI map of VP9 is coded without references (INTRA_FRAME of libvpx). The
+// other segments do not restrict the references.
+constexpr int kIntraRefFrame = 0;
+constexpr int kAnyRefFrame = -1;
+
+// The number of temporal layers of VP9 which the encoder supports.
+constexpr int kMaxTemporalLayers = 2;
+
+// The frames of the enhancement layers do not update the references and the entropy context,
+// so the dropped frames do not affect the decoding of the next frames.
+constexpr vpx_enc_frame_flags_t kEnhancementLayerFlags =
+    VP8_EFLAG_NO_UPD_LAST | VP8_EFLAG_NO_UPD_GF | VP8_EFLAG_NO_UPD_ARF | VP8_EFLAG_NO_UPD_ENTROPY;
+
+// The border (in pixels) around the planes of the reconstructed frame. libvpx fills it after
+// copying the frame. It is the border of VP8 frames, VP9 accepts any even border.
+constexpr int kReferenceBorder = 32;
+
+// libyuv calculates SSIM in the windows of 8x8 pixels. Smaller areas are not measured.
+constexpr int kSsimWindowSize = 8;
+
+int autoThreadCount(const QSize& size)
+{
+    const int cores = QThread::idealThreadCount();
+
+    //
+    // Going to multiple threads on low end windows systems can really hurt performance.
+    // http://crbug.com/99179
+    //
+    if (cores <= 2)
+        return 1;
+
+    // Using 2 threads gives a great boost in performance for most systems with adequate
+    // processing power. Large screens use more threads.
+    const int threads = qMax(2, size.width() * size.height() / kPixelsPerThread);
+
+    return qMin(threads, qMin(cores, kMaxThreads));
+}
+
+int autoTileColumns(const QSize& size, int threads)
+{
+    // One tile column for each thread, but the tiles can not be narrower than the minimum.
+    int tile_columns = 0;
+
+    while ((1 << tile_columns) < threads &&
+           (size.width() >> (tile_columns + 1)) >= kVp9MinTileWidth)
+    {
+        ++tile_columns;
+    }
+
+    return tile_columns;
+}
 
-void setCommonCodecParameters(vpx_codec_enc_cfg_t* config, const QSize& size)
+// Allocates |buffer| of |capacity| bytes if it is not allocated or |reallocate| is true and
+// clears the first |size| bytes of it.
+void prepareMapBuffer(std::unique_ptr<quint8[]>* buffer,
+                      bool reallocate,
+                      size_t capacity,
+                      size_t size)
+{
+    if (reallocate || !*buffer)
+        *buffer = std::make_unique<quint8[]>(capacity);
+
+    memset(buffer->get(), 0, size);
+}
+
+void setDefaultBitrate(vpx_codec_enc_cfg_t* config, const QSize& size)
+{
+    // Adjust default target bit-rate to account for actual desktop size.
+    config->rc_target_bitrate = size.width() * size.height() *
+        config->rc_target_bitrate / config->g_w / config->g_h;
+}
+
+void setCommonCodecParameters(vpx_codec_enc_cfg_t* config, const QSize& size, int threads)
 {
     // Use millisecond granularity time base.
     config->g_timebase.num = 1;
@@ -42,45 +174,63 @@ void setCommonCodecParameters(vpx_codec_enc_cfg_t* config, const QSize& size)
     // Start emitting packets immediately.
     config->g_lag_in_frames = 0;
 
-    // Since the transport layer is reliable, keyframes should not be necessary.
-    // However, due to crbug.com/440223, decoding fails after 30,000 non-key
-    // frames, so take the hit of an "unnecessary" key-frame every 10,000 frames.
-    config->kf_min_dist = 10000;
-    config->kf_max_dist = 10000;
+    // Since the transport layer is reliable, keyframes are encoded only for the first frame
+    // and on request. The screen updater refreshes the screen periodically, which also avoids
+    // crbug.com/440223 (decoding fails after 30,000 non-key frames).
+    config->kf_mode = VPX_KF_DISABLED;
 
-    //
-    // Using 2 threads gives a great boost in performance for most systems with
-    // adequate processing power. NB: Going to multiple threads on low end
-    // windows systems can really hurt performance.
-    // http://crbug.com/99179
-    //
-    config->g_threads = (QThread::idealThreadCount() > 2) ? 2 : 1;
+    config->g_threads = (threads > 0) ? qMin(threads, kMaxThreads) : autoThreadCount(size);
 }
 
 } // namespace
 
 // static
-std::unique_ptr<VideoEncoderVPX> VideoEncoderVPX::createVP8()
+std::unique_ptr<VideoEncoderVPX> VideoEncoderVPX::createVP8(int threads, bool refine)
+{
+    return std::unique_ptr<VideoEncoderVPX>(
+        new VideoEncoderVPX(proto::desktop::VIDEO_ENCODING_VP8, threads, 0, 1, refine));
+}
+
+// static
+std::unique_ptr<VideoEncoderVPX> VideoEncoderVPX::createVP9(int threads,
+                                                            int tile_columns,
+                                                            int temporal_layers)
 {
     return std::unique_ptr<VideoEncoderVPX>(
-        new VideoEncoderVPX(proto::desktop::VIDEO_ENCODING_VP8));
+        new VideoEncoderVPX(proto::desktop::VIDEO_ENCODING_VP9,
+                            threads, tile_columns, temporal_layers, false));
 }
 
 // static
-std::unique_ptr<VideoEncoderVPX> VideoEncoderVPX::createVP9()
+std::unique_ptr<VideoEncoderVPX> VideoEncoderVPX::createVP9Lossy(int threads,
+                                                                 int tile_columns,
+                                                                 int temporal_layers)
 {
     return std::unique_ptr<VideoEncoderVPX>(
-        new VideoEncoderVPX(proto::desktop::VIDEO_ENCODING_VP9));
+        new VideoEncoderVPX(proto::desktop::VIDEO_ENCODING_VP9_LOSSY,
+                            threads, tile_columns, temporal_layers, false));
 }
 
-VideoEncoderVPX::VideoEncoderVPX(proto::desktop::VideoEncoding encoding)
-    : encoding_(encoding)
+VideoEncoderVPX::VideoEncoderVPX(proto::desktop::VideoEncoding encoding,
+                                 int threads,
+                                 int tile_columns,
+                                 int temporal_layers,
+                                 bool refine)
+    : encoding_(encoding),
+      threads_(threads),
+      tile_columns_(tile_columns),
+      temporal_layers_(qBound(1, temporal_layers, kMaxTemporalLayers)),
+      refine_(refine)
 {
     memset(&active_map_, 0, sizeof(active_map_));
+    memset(&roi_map_, 0, sizeof(roi_map_));
+    memset(&intra_map_, 0, sizeof(intra_map_));
+    memset(&config_, 0, sizeof(config_));
     memset(&image_, 0, sizeof(image_));
+    memset(&reference_image_, 0, sizeof(reference_image_));
 }
 
-void VideoEncoderVPX::createImage()
+bool VideoEncoderVPX::createImage()
 {
     memset(&image_, 0, sizeof(image_));
 
@@ -99,6 +249,12 @@ void VideoEncoderVPX::createImage()
         image_.x_chroma_shift = 0;
         image_.y_chroma_shift = 0;
     }
+    else if (encoding_ == proto::desktop::VIDEO_ENCODING_VP9_LOSSY)
+    {
+        image_.fmt = VPX_IMG_FMT_I420;
+        image_.x_chroma_shift = 1;
+        image_.y_chroma_shift = 1;
+    }
 
     //
     // libyuv's fast-path requires 16-byte aligned pointers and strides, so pad
@@ -122,7 +278,15 @@ void VideoEncoderVPX::createImage()
     // Allocate a YUV buffer large enough for the aligned data & padding.
     const int buffer_size = y_stride * y_rows + (2 * uv_stride) * uv_rows;
 
-    yuv_image_ = std::make_unique<quint8[]>(buffer_size);
+    // The buffer of the larger image is reused when the screen becomes smaller. Otherwise the
+    // previous image is returned into the pool before the new one is taken.
+    if (!yuv_image_ || yuv_image_.get_deleter().size() < static_cast<size_t>(buffer_size))
+    {
+        yuv_image_.reset();
+        yuv_image_ = BufferPool::instance()->allocate(buffer_size);
+        if (!yuv_image_)
+            return false;
+    }
 
     // Reset image value to 128 so we just need to fill in the y plane.
     memset(yuv_image_.get(), 128, buffer_size);
@@ -134,6 +298,7 @@ void VideoEncoderVPX::createImage()
 
     image_.stride[0] = y_stride;
     image_.stride[1] = image_.stride[2] = uv_stride;
+    return true;
 }
 
 void VideoEncoderVPX::createActiveMap()
@@ -141,47 +306,156 @@ void VideoEncoderVPX::createActiveMap()
     active_map_.cols = (screen_size_.width() + kMacroBlockSize - 1) / kMacroBlockSize;
     active_map_.rows = (screen_size_.height() + kMacroBlockSize - 1) / kMacroBlockSize;
     active_map_size_ = active_map_.cols * active_map_.rows;
-    active_map_buffer_ = std::make_unique<quint8[]>(active_map_size_);
 
-    memset(active_map_buffer_.get(), 0, active_map_size_);
+    // The maps are allocated again only if the screen becomes larger than ever before.
+    const bool reallocate = active_map_size_ > map_capacity_;
+    if (reallocate)
+        map_capacity_ = active_map_size_;
+
+    prepareMapBuffer(&active_map_buffer_, reallocate, map_capacity_, active_map_size_);
     active_map_.active_map = active_map_buffer_.get();
+
+    if (isLossy())
+        prepareMapBuffer(&top_off_map_buffer_, reallocate, map_capacity_, active_map_size_);
+    else
+        top_off_map_buffer_.reset();
+
+    if (encoding_ == proto::desktop::VIDEO_ENCODING_VP8)
+    {
+        prepareMapBuffer(&roi_map_buffer_, reallocate, map_capacity_, active_map_size_);
+
+        memset(&roi_map_, 0, sizeof(roi_map_));
+        roi_map_.rows = active_map_.rows;
+        roi_map_.cols = active_map_.cols;
+        roi_map_.delta_q[1] = kRefineDeltaQ;
+        roi_map_.delta_q[2] = kFocusDeltaQ;
+    }
+    else
+    {
+        roi_map_buffer_.reset();
+        prepareMapBuffer(&intra_map_buffer_, reallocate, map_capacity_, active_map_size_);
+
+        // The map is set again with each band, the refresh of the previous size is stopped.
+        intra_map_.rows = active_map_.rows;
+        intra_map_.cols = active_map_.cols;
+
+        for (int i = 0; i < 8; ++i)
+            intra_map_.ref_frame[i] = kAnyRefFrame;
+
+        intra_map_.ref_frame[1] = kIntraRefFrame;
+        intra_refresh_row_ = -1;
+    }
+
+    if (refine_ && roi_map_buffer_)
+        prepareMapBuffer(&block_age_buffer_, reallocate, map_capacity_, active_map_size_);
+    else
+        block_age_buffer_.reset();
+
+    if (temporal_layers_ > 1)
+        prepareMapBuffer(&layer_map_buffer_, reallocate, map_capacity_, active_map_size_);
+    else
+        layer_map_buffer_.reset();
+
+    refine_position_ = 0;
+    temporal_layer_ = 0;
+    top_off_pending_ = false;
+}
+
+bool VideoEncoderVPX::resizeCodec()
+{
+    // libvpx changes the size of the frames in place only if they are not larger than the
+    // frames for which the codec was created. The first frame of the new size is a key frame.
+    if (!codec_ || screen_size_.width() > codec_size_.width() ||
+        screen_size_.height() > codec_size_.height())
+    {
+        return false;
+    }
+
+    vpx_codec_iface_t* algo = (encoding_ == proto::desktop::VIDEO_ENCODING_VP8) ?
+        vpx_codec_vp8_cx() : vpx_codec_vp9_cx();
+
+    vpx_codec_enc_cfg_t default_config;
+
+    vpx_codec_err_t ret = vpx_codec_enc_config_default(algo, &default_config, 0);
+    Q_ASSERT(VPX_CODEC_OK == ret);
+
+    vpx_codec_enc_cfg_t config = config_;
+
+    config.g_w = screen_size_.width();
+    config.g_h = screen_size_.height();
+
+    // Lossless VP9 has no rate control. The limits of the connection are applied again below.
+    if (encoding_ == proto::desktop::VIDEO_ENCODING_VP8 || isLossy())
+    {
+        setDefaultBitrate(&default_config, screen_size_);
+        default_bitrate_ = default_config.rc_target_bitrate;
+
+        config.rc_target_bitrate = default_bitrate_;
+        config.rc_min_quantizer = kMinQuantizer;
+        config.rc_max_quantizer = kMaxQuantizer;
+    }
+
+    // The number of the threads is kept, libvpx does not change it after the initialization.
+    if (vpx_codec_enc_config_set(codec_.get(), &config) != VPX_CODEC_OK)
+    {
+        qWarning("Unable to change the frame size of the codec");
+        return false;
+    }
+
+    config_ = config;
+
+    if (encoding_ != proto::desktop::VIDEO_ENCODING_VP8)
+    {
+        if (tile_columns_ <= 0)
+            vp9_tile_columns_ = autoTileColumns(screen_size_, config_.g_threads);
+
+        ret = vpx_codec_control(codec_.get(), VP9E_SET_TILE_COLUMNS, tileColumns());
+        Q_ASSERT(VPX_CODEC_OK == ret);
+    }
+
+    if (bandwidth_)
+        setBandwidth(bandwidth_);
+
+    key_frame_pending_ = true;
+    return true;
 }
 
 void VideoEncoderVPX::createVp8Codec()
 {
     codec_.reset(new vpx_codec_ctx_t());
 
-    vpx_codec_enc_cfg_t config = { 0 };
+    memset(&config_, 0, sizeof(config_));
+    codec_size_ = screen_size_;
 
     // Configure the encoder.
     vpx_codec_iface_t* algo = vpx_codec_vp8_cx();
 
-    vpx_codec_err_t ret = vpx_codec_enc_config_default(algo, &config, 0);
+    vpx_codec_err_t ret = vpx_codec_enc_config_default(algo, &config_, 0);
     Q_ASSERT(VPX_CODEC_OK == ret);
 
-    // Adjust default target bit-rate to account for actual desktop size.
-    config.rc_target_bitrate = screen_size_.width() * screen_size_.height() *
-        config.rc_target_bitrate / config.g_w / config.g_h;
+    setDefaultBitrate(&config_, screen_size_);
 
-    setCommonCodecParameters(&config, screen_size_);
+    default_bitrate_ = config_.rc_target_bitrate;
+
+    setCommonCodecParameters(&config_, screen_size_, threads_);
 
     //
     // Value of 2 means using the real time profile. This is basically a
     // redundant option since we explicitly select real time mode when doing
     // encoding.
     //
-    config.g_profile = 2;
+    config_.g_profile = 2;
 
     // Clamping the quantizer constrains the worst-case quality and CPU usage.
-    config.rc_min_quantizer = 20;
-    config.rc_max_quantizer = 30;
+    config_.rc_min_quantizer = kMinQuantizer;
+    config_.rc_max_quantizer = kMaxQuantizer;
 
-    ret = vpx_codec_enc_init(codec_.get(), algo, &config, 0);
+    ret = vpx_codec_enc_init(codec_.get(), algo, &config_, 0);
     Q_ASSERT(VPX_CODEC_OK == ret);
 
-    // Value of 16 will have the smallest CPU load. This turns off subpixel
-    // motion search.
-    ret = vpx_codec_control(codec_.get(), VP8E_SET_CPUUSED, 16);
+    // Value of 16 of the configured effort will have the smallest CPU load. This turns off
+    // subpixel motion search.
+    ret = vpx_codec_control(codec_.get(), VP8E_SET_CPUUSED, cpuUsed());
     Q_ASSERT(VPX_CODEC_OK == ret);
 
     ret = vpx_codec_control(codec_.get(), VP8E_SET_SCREEN_CONTENT_MODE, 1);
@@ -193,38 +467,62 @@ void VideoEncoderVPX::createVp8Codec()
     //
     ret = vpx_codec_control(codec_.get(), VP8E_SET_NOISE_SENSITIVITY, 0);
     Q_ASSERT(VPX_CODEC_OK == ret);
+
+    // The codec may be created again after the bandwidth is known.
+    if (bandwidth_)
+        setBandwidth(bandwidth_);
 }
 
 void VideoEncoderVPX::createVp9Codec()
 {
     codec_.reset(new vpx_codec_ctx_t());
 
-    vpx_codec_enc_cfg_t config = { 0 };
+    memset(&config_, 0, sizeof(config_));
+    codec_size_ = screen_size_;
 
     // Configure the encoder.
     vpx_codec_iface_t* algo = vpx_codec_vp9_cx();
 
-    vpx_codec_err_t ret = vpx_codec_enc_config_default(algo, &config, 0);
+    vpx_codec_err_t ret = vpx_codec_enc_config_default(algo, &config_, 0);
     Q_ASSERT(VPX_CODEC_OK == ret);
 
-    setCommonCodecParameters(&config, screen_size_);
+    const bool lossy = isLossy();
+
+    if (lossy)
+    {
+        setDefaultBitrate(&config_, screen_size_);
+        default_bitrate_ = config_.rc_target_bitrate;
+    }
+
+    setCommonCodecParameters(&config_, screen_size_, threads_);
 
-    // Configure VP9 for I444 source frames.
-    config.g_profile = kVp9I444ProfileNumber;
+    if (lossy)
+    {
+        // Lossy VP9 uses I420 source frames (profile 0) and the same quantizer range as VP8.
+        config_.g_profile = 0;
+        config_.rc_min_quantizer = kMinQuantizer;
+        config_.rc_max_quantizer = kMaxQuantizer;
+        config_.rc_end_usage = VPX_CBR;
+    }
+    else
+    {
+        // Configure VP9 for I444 source frames.
+        config_.g_profile = kVp9I444ProfileNumber;
 
-    // Disable quantization entirely, putting the encoder in "lossless" mode.
-    config.rc_min_quantizer = 0;
-    config.rc_max_quantizer = 0;
-    config.rc_end_usage = VPX_VBR;
+        // Disable quantization entirely, putting the encoder in "lossless" mode.
+        config_.rc_min_quantizer = 0;
+        config_.rc_max_quantizer = 0;
+        config_.rc_end_usage = VPX_VBR;
+    }
 
-    ret = vpx_codec_enc_init(codec_.get(), algo, &config, 0);
+    ret = vpx_codec_enc_init(codec_.get(), algo, &config_, 0);
     Q_ASSERT(VPX_CODEC_OK == ret);
 
     //
     // Request the lowest-CPU usage that VP9 supports, which depends on whether
     // we are encoding lossy or lossless.
     //
-    ret = vpx_codec_control(codec_.get(), VP8E_SET_CPUUSED, 5);
+    ret = vpx_codec_control(codec_.get(), VP8E_SET_CPUUSED, cpuUsed());
     Q_ASSERT(VPX_CODEC_OK == ret);
 
     ret = vpx_codec_control(codec_.get(),
@@ -240,16 +538,123 @@ void VideoEncoderVPX::createVp9Codec()
     Q_ASSERT(VPX_CODEC_OK == ret);
 
     // Set cyclic refresh (aka "top-off") only for lossy encoding.
-    ret = vpx_codec_control(codec_.get(), VP9E_SET_AQ_MODE, kVp9AqModeNone);
+    ret = vpx_codec_control(codec_.get(), VP9E_SET_AQ_MODE,
+                            lossy ? kVp9AqModeCyclicRefresh : kVp9AqModeNone);
+    Q_ASSERT(VPX_CODEC_OK == ret);
+
+    // The tile columns are encoded in parallel. Row based multi-threading allows to use more
+    // threads than the tile columns.
+    vp9_tile_columns_ = (tile_columns_ > 0) ?
+        qMin(tile_columns_, kVp9MaxTileColumns) :
+        autoTileColumns(screen_size_, config_.g_threads);
+
+    ret = vpx_codec_control(codec_.get(), VP9E_SET_TILE_COLUMNS, tileColumns());
+    Q_ASSERT(VPX_CODEC_OK == ret);
+
+    ret = vpx_codec_control(codec_.get(), VP9E_SET_ROW_MT, 1);
     Q_ASSERT(VPX_CODEC_OK == ret);
+
+    // The codec may be created again after the bandwidth is known.
+    if (lossy && bandwidth_)
+        setBandwidth(bandwidth_);
+}
+
+void VideoEncoderVPX::setBandwidth(qint64 bandwidth)
+{
+    bandwidth_ = bandwidth;
+
+    // Lossless VP9 has no rate control.
+    if ((encoding_ != proto::desktop::VIDEO_ENCODING_VP8 && !isLossy()) || !codec_ || !bandwidth)
+        return;
+
+    const quint32 available_bitrate = static_cast<quint32>(qMin<qint64>(
+        bandwidth * 8 / 1000 * kBandwidthUsagePercent / 100, default_bitrate_));
+
+    const quint32 target_bitrate = qMax(available_bitrate, kMinBitrate);
+
+    // When the bitrate is reduced, the quantizer range is extended proportionally, so that
+    // the encoder does not exceed the bitrate on complex frames.
+    const quint32 max_quantizer = kMaxQuantizer +
+        (kWorstQuantizer - kMaxQuantizer) * (default_bitrate_ - target_bitrate) /
+        default_bitrate_;
+
+    const quint32 min_quantizer = qMin(kMinQuantizer, max_quantizer / 2);
+
+    // Small changes are ignored to avoid reconfiguring the encoder for every frame.
+    const quint32 current_bitrate = config_.rc_target_bitrate;
+    if (config_.rc_max_quantizer == max_quantizer &&
+        target_bitrate > current_bitrate * 9 / 10 &&
+        target_bitrate < current_bitrate * 11 / 10)
+    {
+        return;
+    }
+
+    config_.rc_target_bitrate = target_bitrate;
+    config_.rc_min_quantizer = min_quantizer;
+    config_.rc_max_quantizer = max_quantizer;
+
+    vpx_codec_err_t ret = vpx_codec_enc_config_set(codec_.get(), &config_);
+    Q_ASSERT(ret == VPX_CODEC_OK);
+}
+
+void VideoEncoderVPX::setEffort(int effort)
+{
+    if (effort == effort_)
+        return;
+
+    effort_ = effort;
+
+    // The codec is created with the effort when the size of the frames is known.
+    if (!codec_)
+        return;
+
+    vpx_codec_err_t ret = vpx_codec_control(codec_.get(), VP8E_SET_CPUUSED, cpuUsed());
+    Q_ASSERT(ret == VPX_CODEC_OK);
+
+    if (encoding_ != proto::desktop::VIDEO_ENCODING_VP8)
+    {
+        ret = vpx_codec_control(codec_.get(), VP9E_SET_TILE_COLUMNS, tileColumns());
+        Q_ASSERT(ret == VPX_CODEC_OK);
+    }
+}
+
+int VideoEncoderVPX::cpuUsed() const
+{
+    // VP8 already has the fastest speed, so only the positive effort changes it.
+    if (encoding_ == proto::desktop::VIDEO_ENCODING_VP8)
+        return qMax(kVp8MinCpuUsed, kVp8CpuUsed - qMax(0, effort_) * kVp8CpuUsedStep);
+
+    const int cpu_used = qBound(kVp9MinCpuUsed,
+                                (isLossy() ? kVp9LossyCpuUsed : kVp9CpuUsed) - effort_,
+                                kVp9MaxCpuUsed);
+
+    return intra_refresh_ ? qMax(cpu_used, kVp9MinRoiCpuUsed) : cpu_used;
+}
+
+int VideoEncoderVPX::tileColumns() const
+{
+    // The column is encoded by one thread, so the fewer columns take fewer processors at once.
+    return qMax(0, vp9_tile_columns_ + qMin(0, effort_ + 1));
+}
+
+bool VideoEncoderVPX::isTopOffPending() const
+{
+    // The bands of the refresh are encoded with the frames without changes too.
+    return top_off_pending_ || intra_refresh_row_ >= 0;
+}
+
+bool VideoEncoderVPX::isLossy() const
+{
+    return encoding_ == proto::desktop::VIDEO_ENCODING_VP9_LOSSY;
 }
 
 void VideoEncoderVPX::setActiveMap(const QRect& rect)
 {
-    int left   = rect.left() / kMacroBlockSize;
-    int top    = rect.top() / kMacroBlockSize;
-    int right  = (rect.right() - 1) / kMacroBlockSize;
-    int bottom = (rect.bottom() - 1) / kMacroBlockSize;
+    // The rectangle at the edge of the screen may end in the middle of a macroblock.
+    const int left = rect.left() / kMacroBlockSize;
+    const int top = rect.top() / kMacroBlockSize;
+    const int right = rect.right() / kMacroBlockSize;
+    const int bottom = rect.bottom() / kMacroBlockSize;
 
     quint8* map = active_map_.active_map + top * active_map_.cols;
 
@@ -264,73 +669,471 @@ void VideoEncoderVPX::setActiveMap(const QRect& rect)
     }
 }
 
+void VideoEncoderVPX::convertRect(const DesktopFrame* frame, const QRect& rect)
+{
+    // The chroma of the subsampled formats is computed from 2x2 pixels, so the rectangles
+    // must start at even coordinates. The macroblocks always do.
+    Q_ASSERT(rect.x() % kMacroBlockSize == 0 && rect.y() % kMacroBlockSize == 0);
+
+    const int y_offset = image_.stride[0] * rect.y() + rect.x();
+    const int uv_offset = image_.stride[1] * (rect.y() >> image_.y_chroma_shift) +
+        (rect.x() >> image_.x_chroma_shift);
+
+    switch (image_.fmt)
+    {
+        case VPX_IMG_FMT_YV12:
+        case VPX_IMG_FMT_I420:
+            libyuv::ARGBToI420(frame->frameDataAtPos(rect.topLeft()),
+                               frame->stride(),
+                               image_.planes[0] + y_offset, image_.stride[0],
+                               image_.planes[1] + uv_offset, image_.stride[1],
+                               image_.planes[2] + uv_offset, image_.stride[2],
+                               rect.width(),
+                               rect.height());
+            break;
+
+        case VPX_IMG_FMT_I444:
+            libyuv::ARGBToI444(frame->frameDataAtPos(rect.topLeft()),
+                               frame->stride(),
+                               image_.planes[0] + y_offset, image_.stride[0],
+                               image_.planes[1] + uv_offset, image_.stride[1],
+                               image_.planes[2] + uv_offset, image_.stride[2],
+                               rect.width(),
+                               rect.height());
+            break;
+
+        default:
+            qFatal("Unsupported image format: %d", image_.fmt);
+            break;
+    }
+}
+
 void VideoEncoderVPX::prepareImageAndActiveMap(const DesktopFrame* frame,
                                                proto::desktop::VideoPacket* packet)
 {
     memset(active_map_.active_map, 0, active_map_size_);
 
-    int y_stride = image_.stride[0];
-    int uv_stride = image_.stride[1];
-    quint8* y_data = image_.planes[0];
-    quint8* u_data = image_.planes[1];
-    quint8* v_data = image_.planes[2];
+    // The rectangles are aligned to the macroblocks, which are encoded entirely anyway.
+    const std::vector<QRect> rects =
+        VideoUtil::coalesceRegion(frame->updatedRegion(), frame->size(), kMacroBlockSize);
 
-    switch (image_.fmt)
+    for (const auto& rect : rects)
     {
-        case VPX_IMG_FMT_YV12:
+        VideoUtil::toVideoRect(rect, packet->add_dirty_rect());
+        setActiveMap(rect);
+    }
+
+    // The image is kept between the frames and only the changed macroblocks are converted.
+    // The region of the map consists of disjoint macroblock-aligned rectangles, so every
+    // block is converted exactly once even if the rectangles of the frame overlap.
+    for (const auto& rect : regionFromMap(active_map_.active_map))
+        convertRect(frame, rect);
+
+    if (top_off_map_buffer_)
+    {
+        // The changed blocks are encoded with losses and must be refined later.
+        for (size_t i = 0; i < active_map_size_; ++i)
+            top_off_map_buffer_[i] |= active_map_.active_map[i];
+
+        top_off_pending_ = true;
+    }
+}
+
+void VideoEncoderVPX::prepareTopOffActiveMap(proto::desktop::VideoPacket* packet)
+{
+    Q_ASSERT(top_off_map_buffer_);
+
+    memcpy(active_map_.active_map, top_off_map_buffer_.get(), active_map_size_);
+    memset(top_off_map_buffer_.get(), 0, active_map_size_);
+
+    top_off_pending_ = false;
+
+    // The image already contains the current content of the blocks, only the dirty
+    // rectangles of the packet are required.
+    for (const auto& rect : regionFromMap(active_map_.active_map))
+        VideoUtil::toVideoRect(rect, packet->add_dirty_rect());
+}
+
+bool VideoEncoderVPX::prepareRefineMap(bool all_blocks, proto::desktop::VideoPacket* packet)
+{
+    Q_ASSERT(block_age_buffer_ && roi_map_buffer_);
+
+    size_t budget = all_blocks ?
+        active_map_size_ : qMax<size_t>(1, active_map_size_ * kMaxRefineBlocksPercent / 100);
+
+    size_t next_position = refine_position_;
+    bool pending = false;
+
+    for (size_t i = 0; i < active_map_size_; ++i)
+    {
+        const size_t index = (refine_position_ + i) % active_map_size_;
+        quint8& age = block_age_buffer_[index];
+
+        // The changed blocks are encoded with losses now.
+        if (active_map_.active_map[index])
+        {
+            age = 1;
+            pending = true;
+            continue;
+        }
+
+        if (!age)
+            continue;
+
+        if (budget && (all_blocks || age > kRefineAge))
+        {
+            roi_map_buffer_[index] = 1;
+            active_map_.active_map[index] = 1;
+            age = 0;
+
+            --budget;
+            next_position = index + 1;
+            continue;
+        }
+
+        if (age < std::numeric_limits<quint8>::max())
+            ++age;
+
+        pending = true;
+    }
+
+    refine_position_ = next_position % active_map_size_;
+    top_off_pending_ = pending;
+
+    const QRegion region = regionFromMap(roi_map_buffer_.get());
+
+    // The image already contains the current content of the refined blocks.
+    for (const auto& rect : region)
+        VideoUtil::toVideoRect(rect, packet->add_dirty_rect());
+
+    return !region.isEmpty();
+}
+
+bool VideoEncoderVPX::prepareFocusMap()
+{
+    Q_ASSERT(roi_map_buffer_);
+
+    const QRegion focus_region = focus_region_.intersected(QRect(QPoint(), screen_size_));
+
+    for (const auto& rect : focus_region)
+    {
+        const int left = rect.left() / kMacroBlockSize;
+        const int top = rect.top() / kMacroBlockSize;
+        const int right = rect.right() / kMacroBlockSize;
+        const int bottom = rect.bottom() / kMacroBlockSize;
+
+        for (int y = top; y <= bottom; ++y)
         {
-            for (const auto& rect : frame->updatedRegion())
+            quint8* map = roi_map_buffer_.get() + y * active_map_.cols;
+
+            // The refined blocks keep their segment.
+            for (int x = left; x <= right; ++x)
             {
-                int y_offset = y_stride * rect.y() + rect.x();
-                int uv_offset = uv_stride * rect.y() / 2 + rect.x() / 2;
-
-                libyuv::ARGBToI420(frame->frameDataAtPos(rect.topLeft()),
-                                   frame->stride(),
-                                   y_data + y_offset, y_stride,
-                                   u_data + uv_offset, uv_stride,
-                                   v_data + uv_offset, uv_stride,
-                                   rect.width(),
-                                   rect.height());
-
-                VideoUtil::toVideoRect(rect, packet->add_dirty_rect());
-                setActiveMap(rect);
+                if (!map[x])
+                    map[x] = 2;
             }
         }
-        break;
+    }
 
-        case VPX_IMG_FMT_I444:
+    roi_map_.delta_q[0] = focus_region.isEmpty() ? 0 : kBackgroundDeltaQ;
+
+    return !focus_region.isEmpty();
+}
+
+int VideoEncoderVPX::prepareTemporalLayer(bool base_layer, proto::desktop::VideoPacket* packet)
+{
+    Q_ASSERT(layer_map_buffer_);
+
+    // The layers alternate. The key frames and the top-off frames are always in layer 0.
+    const int layer = base_layer ? 0 : (temporal_layer_ + 1) % temporal_layers_;
+    temporal_layer_ = layer;
+
+    if (layer != 0)
+    {
+        for (size_t i = 0; i < active_map_size_; ++i)
+            layer_map_buffer_[i] |= active_map_.active_map[i];
+
+        return layer;
+    }
+
+    bool has_changes = false;
+
+    for (size_t i = 0; i < active_map_size_; ++i)
+    {
+        // Only the blocks which are not encoded by this frame are added.
+        if (active_map_.active_map[i])
+            layer_map_buffer_[i] = 0;
+
+        has_changes |= layer_map_buffer_[i] != 0;
+    }
+
+    if (has_changes)
+    {
+        // The image already contains the current content of the blocks.
+        for (const auto& rect : regionFromMap(layer_map_buffer_.get()))
+            VideoUtil::toVideoRect(rect, packet->add_dirty_rect());
+
+        for (size_t i = 0; i < active_map_size_; ++i)
+            active_map_.active_map[i] |= layer_map_buffer_[i];
+
+        memset(layer_map_buffer_.get(), 0, active_map_size_);
+    }
+
+    return layer;
+}
+
+void VideoEncoderVPX::prepareIntraRefreshMap(proto::desktop::VideoPacket* packet)
+{
+    Q_ASSERT(intra_map_buffer_ && intra_refresh_row_ >= 0);
+
+    const int rows = static_cast<int>(active_map_.rows);
+    const int band_rows = qMax(1, rows * kIntraRefreshBandPercent / 100);
+    const int top = qMin(intra_refresh_row_, rows);
+    const int bottom = qMin(top + band_rows, rows);
+
+    const size_t offset = top * active_map_.cols;
+    const size_t size = (bottom - top) * active_map_.cols;
+
+    const QRegion changed_region = regionFromMap(active_map_.active_map);
+
+    memset(intra_map_buffer_.get(), 0, active_map_size_);
+    memset(intra_map_buffer_.get() + offset, 1, size);
+    memset(active_map_.active_map + offset, 1, size);
+
+    // The image already contains the current content of the band.
+    for (const auto& rect : regionFromMap(intra_map_buffer_.get()).subtracted(changed_region))
+        VideoUtil::toVideoRect(rect, packet->add_dirty_rect());
+
+    intra_refresh_row_ = (bottom < rows) ? bottom : -1;
+}
+
+void VideoEncoderVPX::setIntraRefresh(bool enable)
+{
+    intra_refresh_ = enable;
+    intra_map_.roi_map = enable ? intra_map_buffer_.get() : nullptr;
+
+    vpx_codec_err_t ret = vpx_codec_control(codec_.get(), VP9E_SET_ROI_MAP, &intra_map_);
+    Q_ASSERT(ret == VPX_CODEC_OK);
+
+    ret = vpx_codec_control(codec_.get(), VP8E_SET_CPUUSED, cpuUsed());
+    Q_ASSERT(ret == VPX_CODEC_OK);
+
+    if (isLossy())
+    {
+        ret = vpx_codec_control(codec_.get(), VP9E_SET_AQ_MODE,
+                                enable ? kVp9AqModeNone : kVp9AqModeCyclicRefresh);
+        Q_ASSERT(ret == VPX_CODEC_OK);
+    }
+}
+
+void VideoEncoderVPX::setFocusRegion(const QRegion& region)
+{
+    focus_region_ = region;
+}
+
+void VideoEncoderVPX::setQualitySampling(int interval)
+{
+    // The lossless frames are always equal to the source.
+    if (encoding_ != proto::desktop::VIDEO_ENCODING_VP8 && !isLossy())
+        return;
+
+    quality_interval_ = qMax(0, interval);
+    quality_frames_ = 0;
+}
+
+void VideoEncoderVPX::requestKeyFrame()
+{
+    key_frame_pending_ = true;
+}
+
+bool VideoEncoderVPX::requestIntraRefresh()
+{
+    // VP8 is not able to code the blocks of an inter frame without references.
+    if (encoding_ == proto::desktop::VIDEO_ENCODING_VP8)
+        return false;
+
+    // The first frame of the codec is a key frame.
+    if (codec_)
+        intra_refresh_row_ = 0;
+
+    return true;
+}
+
+QRegion VideoEncoderVPX::regionFromMap(const quint8* active_map) const
+{
+    const QRect screen_rect(QPoint(), screen_size_);
+    QRegion region;
+
+    for (int y = 0; y < static_cast<int>(active_map_.rows); ++y)
+    {
+        const quint8* map = active_map + y * active_map_.cols;
+
+        int x = 0;
+
+        while (x < static_cast<int>(active_map_.cols))
         {
-            for (const auto& rect : frame->updatedRegion())
+            if (!map[x])
             {
-                int yuv_offset = uv_stride * rect.y() + rect.x();
-
-                libyuv::ARGBToI444(frame->frameDataAtPos(rect.topLeft()),
-                                   frame->stride(),
-                                   y_data + yuv_offset, y_stride,
-                                   u_data + yuv_offset, uv_stride,
-                                   v_data + yuv_offset, uv_stride,
-                                   rect.width(),
-                                   rect.height());
-
-                VideoUtil::toVideoRect(rect, packet->add_dirty_rect());
-                setActiveMap(rect);
+                ++x;
+                continue;
             }
+
+            const int start = x;
+
+            while (x < static_cast<int>(active_map_.cols) && map[x])
+                ++x;
+
+            region += QRect(start * kMacroBlockSize, y * kMacroBlockSize,
+                            (x - start) * kMacroBlockSize, kMacroBlockSize)
+                .intersected(screen_rect);
         }
-        break;
+    }
 
-        default:
-            qFatal("Unsupported image format: %d", image_.fmt);
-            break;
+    return region;
+}
+
+bool VideoEncoderVPX::prepareReferenceImage()
+{
+    if (reference_buffer_ &&
+        reference_image_.d_w == image_.d_w && reference_image_.d_h == image_.d_h)
+    {
+        return true;
+    }
+
+    // libvpx copies the whole macroblocks and extends the borders of the copy from the visible
+    // size of the image.
+    const int width = ((image_.w - 1) & ~(kMacroBlockSize - 1)) + kMacroBlockSize;
+    const int height = ((image_.h - 1) & ~(kMacroBlockSize - 1)) + kMacroBlockSize;
+
+    const int y_stride = width + 2 * kReferenceBorder;
+    const int y_rows = height + 2 * kReferenceBorder;
+    const int uv_stride = y_stride >> image_.x_chroma_shift;
+    const int uv_rows = y_rows >> image_.y_chroma_shift;
+
+    const size_t buffer_size = y_stride * y_rows + 2 * uv_stride * uv_rows;
+
+    if (!reference_buffer_ || reference_buffer_.get_deleter().size() < buffer_size)
+    {
+        reference_buffer_.reset();
+        reference_buffer_ = BufferPool::instance()->allocate(buffer_size);
+        if (!reference_buffer_)
+            return false;
+    }
+
+    memset(&reference_image_, 0, sizeof(reference_image_));
+
+    reference_image_.fmt = image_.fmt;
+    reference_image_.x_chroma_shift = image_.x_chroma_shift;
+    reference_image_.y_chroma_shift = image_.y_chroma_shift;
+
+    // libvpx calculates the border from the difference of the stride and the width.
+    reference_image_.w = width;
+    reference_image_.h = height;
+    reference_image_.d_w = image_.d_w;
+    reference_image_.d_h = image_.d_h;
+
+    const int uv_border_offset = uv_stride * (kReferenceBorder >> image_.y_chroma_shift) +
+        (kReferenceBorder >> image_.x_chroma_shift);
+
+    quint8* u_plane = reference_buffer_.get() + y_stride * y_rows;
+
+    reference_image_.planes[0] =
+        reference_buffer_.get() + y_stride * kReferenceBorder + kReferenceBorder;
+    reference_image_.planes[1] = u_plane + uv_border_offset;
+    reference_image_.planes[2] = u_plane + uv_stride * uv_rows + uv_border_offset;
+
+    reference_image_.stride[0] = y_stride;
+    reference_image_.stride[1] = reference_image_.stride[2] = uv_stride;
+
+    updateMemoryCharge();
+    return true;
+}
+
+void VideoEncoderVPX::updateMemoryCharge()
+{
+    qint64 size = 0;
+
+    if (yuv_image_)
+        size += yuv_image_.get_deleter().size();
+
+    if (reference_buffer_)
+        size += reference_buffer_.get_deleter().size();
+
+    // All maps are allocated with the same capacity.
+    const std::unique_ptr<quint8[]>* maps[] = { &active_map_buffer_, &top_off_map_buffer_,
+                                                &layer_map_buffer_, &block_age_buffer_,
+                                                &roi_map_buffer_, &intra_map_buffer_ };
+    for (const auto* map : maps)
+    {
+        if (*map)
+            size += map_capacity_;
+    }
+
+    memory_charge_.reset(size);
+}
+
+void VideoEncoderVPX::measureQuality(proto::desktop::VideoPacket* packet)
+{
+    if (!prepareReferenceImage())
+        return;
+
+    // The last frame of the codec is the reconstruction of the frame which has just been
+    // encoded, as the client decodes it.
+    vpx_ref_frame_t reference;
+    reference.frame_type = VP8_LAST_FRAME;
+    reference.img = reference_image_;
+
+    if (vpx_codec_control(codec_.get(), VP8_COPY_REFERENCE, &reference) != VPX_CODEC_OK)
+    {
+        qWarning("Unable to copy the reconstructed frame");
+        return;
+    }
+
+    quint64 sse = 0;
+    quint64 pixels = 0;
+    double ssim = 0;
+    quint64 ssim_pixels = 0;
+
+    // Only the blocks encoded by the frame are measured, the rest is measured by the previous
+    // frames. The source is the image converted from the captured frame.
+    for (const auto& rect : regionFromMap(active_map_.active_map))
+    {
+        const quint8* source = image_.planes[0] + image_.stride[0] * rect.y() + rect.x();
+        const quint8* reconstruction =
+            reference.img.planes[0] + reference.img.stride[0] * rect.y() + rect.x();
+
+        const quint64 area = rect.width() * rect.height();
+
+        sse += libyuv::ComputeSumSquareErrorPlane(source, image_.stride[0],
+                                                  reconstruction, reference.img.stride[0],
+                                                  rect.width(), rect.height());
+        pixels += area;
+
+        if (rect.width() > kSsimWindowSize && rect.height() > kSsimWindowSize)
+        {
+            ssim += libyuv::CalcFrameSsim(source, image_.stride[0],
+                                          reconstruction, reference.img.stride[0],
+                                          rect.width(), rect.height()) * area;
+            ssim_pixels += area;
+        }
     }
+
+    if (!pixels)
+        return;
+
+    packet->set_psnr(static_cast<float>(libyuv::SumSquareErrorToPsnr(sse, pixels)));
+
+    if (ssim_pixels)
+        packet->set_ssim(static_cast<float>(ssim / ssim_pixels));
 }
 
-std::unique_ptr<proto::desktop::VideoPacket> VideoEncoderVPX::encode(const DesktopFrame* frame)
+bool VideoEncoderVPX::encode(const DesktopFrame* frame, proto::desktop::VideoPacket* packet)
 {
     Q_ASSERT(encoding_ == proto::desktop::VIDEO_ENCODING_VP8 ||
-             encoding_ == proto::desktop::VIDEO_ENCODING_VP9);
+             encoding_ == proto::desktop::VIDEO_ENCODING_VP9 ||
+             encoding_ == proto::desktop::VIDEO_ENCODING_VP9_LOSSY);
 
-    std::unique_ptr<proto::desktop::VideoPacket> packet =
-        std::make_unique<proto::desktop::VideoPacket>();
+    packet->Clear();
 
     packet->set_encoding(encoding_);
 
@@ -338,31 +1141,122 @@ std::unique_ptr<proto::desktop::VideoPacket> VideoEncoderVPX::encode(const Deskt
     {
         screen_size_ = frame->size();
 
-        createImage();
+        if (!createImage())
+            return false;
+
         createActiveMap();
+        updateMemoryCharge();
 
-        if (encoding_ == proto::desktop::VIDEO_ENCODING_VP8)
+        // The codec is created again only if the frames become larger than before.
+        if (!resizeCodec())
         {
-            createVp8Codec();
-        }
-        else if (encoding_ == proto::desktop::VIDEO_ENCODING_VP9)
-        {
-            createVp9Codec();
+            if (encoding_ == proto::desktop::VIDEO_ENCODING_VP8)
+            {
+                createVp8Codec();
+            }
+            else
+            {
+                createVp9Codec();
+            }
+
+            // The first frame of the codec is a key frame.
+            key_frame_pending_ = false;
         }
 
         VideoUtil::toVideoSize(screen_size_, packet->mutable_format()->mutable_screen_size());
     }
 
-    // Convert the updated capture data ready for encode.
-    // Update active map based on updated region.
-    prepareImageAndActiveMap(frame, packet.get());
+    vpx_enc_frame_flags_t flags = 0;
+
+    if (key_frame_pending_)
+    {
+        key_frame_pending_ = false;
+        flags |= VPX_EFLAG_FORCE_KF;
+
+        VideoUtil::toVideoSize(screen_size_, packet->mutable_format()->mutable_screen_size());
+
+        // The key frame refreshes the whole frame at once.
+        intra_refresh_row_ = -1;
+    }
+
+    if (intra_refresh_ && intra_refresh_row_ < 0)
+        setIntraRefresh(false);
+
+    for (const auto& move_rect : frame->moveRects())
+        VideoUtil::toVideoCopyRect(move_rect, packet->add_copy_rect());
+
+    // If the frame has no changes, then the blocks encoded with losses are encoded again
+    // in lossless mode ("top-off").
+    const bool top_off = top_off_pending_ &&
+        frame->updatedRegion().isEmpty() && frame->moveRects().isEmpty();
+
+    vpx_codec_err_t ret;
+    bool has_refined = false;
+
+    if (roi_map_buffer_)
+        memset(roi_map_buffer_.get(), 0, active_map_size_);
+
+    if (block_age_buffer_)
+    {
+        // After the screen has stopped changing, all blocks encoded with losses are refined.
+        if (top_off)
+            memset(active_map_.active_map, 0, active_map_size_);
+        else
+            prepareImageAndActiveMap(frame, packet);
+
+        has_refined = prepareRefineMap(top_off, packet);
+    }
+    else if (top_off)
+    {
+        prepareTopOffActiveMap(packet);
+
+        ret = vpx_codec_control(codec_.get(), VP9E_SET_LOSSLESS, 1);
+        Q_ASSERT(ret == VPX_CODEC_OK);
+    }
+    else
+    {
+        // Convert the updated capture data ready for encode.
+        // Update active map based on updated region.
+        prepareImageAndActiveMap(frame, packet);
+    }
+
+    // The bands of the refresh are not dropped with the enhancement layers.
+    const bool intra_refresh = intra_refresh_row_ >= 0;
+
+    if (intra_refresh)
+    {
+        prepareIntraRefreshMap(packet);
+        setIntraRefresh(true);
+    }
+
+    if (layer_map_buffer_)
+    {
+        const int layer = prepareTemporalLayer(
+            (flags & VPX_EFLAG_FORCE_KF) || top_off || intra_refresh, packet);
+
+        if (layer != 0)
+            flags |= kEnhancementLayerFlags;
+
+        packet->set_temporal_layer(layer);
+    }
+
+    if (roi_map_buffer_)
+    {
+        const bool has_focus = prepareFocusMap();
+
+        // Without the refined and focused blocks the segmentation is disabled.
+        roi_map_.roi_map = (has_refined || has_focus) ? roi_map_buffer_.get() : nullptr;
+
+        ret = vpx_codec_control(codec_.get(), VP8E_SET_ROI_MAP, &roi_map_);
+        Q_ASSERT(ret == VPX_CODEC_OK);
+    }
 
     // Apply active map to the encoder.
-    vpx_codec_err_t ret = vpx_codec_control(codec_.get(), VP8E_SET_ACTIVEMAP, &active_map_);
+    ret = vpx_codec_control(codec_.get(), VP8E_SET_ACTIVEMAP, &active_map_);
     Q_ASSERT(ret == VPX_CODEC_OK);
 
     // Do the actual encoding.
-    ret = vpx_codec_encode(codec_.get(), &image_, 0, 1, 0, VPX_DL_REALTIME);
+    ret = vpx_codec_encode(codec_.get(), &image_, 0, 1, flags, VPX_DL_REALTIME);
     Q_ASSERT(ret == VPX_CODEC_OK);
 
     // Read the encoded data.
@@ -379,7 +1273,21 @@ std::unique_ptr<proto::desktop::VideoPacket> VideoEncoderVPX::encode(const Deskt
         }
     }
 
-    return packet;
+    // The frames which do not update the last frame of the codec are not measured.
+    if (quality_interval_ && !(flags & VP8_EFLAG_NO_UPD_LAST) &&
+        ++quality_frames_ >= quality_interval_)
+    {
+        quality_frames_ = 0;
+        measureQuality(packet);
+    }
+
+    if (top_off && !block_age_buffer_)
+    {
+        ret = vpx_codec_control(codec_.get(), VP9E_SET_LOSSLESS, 0);
+        Q_ASSERT(ret == VPX_CODEC_OK);
+    }
+
+    return true;
 }
 
 } // namespace aspia
@@ -16,6 +16,8 @@ extern "C" {
 #include <vpx/vp8cx.h>
 } // extern "C"
 
+#include "base/buffer_pool.h"
+#include "base/memory_counters.h"
 #include "codec/scoped_vpx_codec.h"
 #include "codec/video_encoder.h"
 
@@ -26,36 +28,154 @@ class VideoEncoderVPX : public VideoEncoder
 public:
     ~VideoEncoderVPX() = default;
 
-    static std::unique_ptr<VideoEncoderVPX> createVP8();
-    static std::unique_ptr<VideoEncoderVPX> createVP9();
-
-    std::unique_ptr<proto::desktop::VideoPacket> encode(const DesktopFrame* frame) override;
+    // If |threads| or |tile_columns| is 0, then the value is chosen automatically.
+    // If |refine| is true, then the static blocks of VP8 encoded with losses are encoded again
+    // with a lower quantizer. The encoders whose frames are combined with other encoders must
+    // not refine the blocks, because their image may be outdated.
+    static std::unique_ptr<VideoEncoderVPX> createVP8(int threads, bool refine = true);
+
+    // If |temporal_layers| is 2, then every second frame is encoded in temporal layer 1. Such
+    // frames are not referenced by other frames and may be dropped for slow clients.
+    static std::unique_ptr<VideoEncoderVPX> createVP9(int threads,
+                                                      int tile_columns,
+                                                      int temporal_layers = 1);
+    static std::unique_ptr<VideoEncoderVPX> createVP9Lossy(int threads,
+                                                           int tile_columns,
+                                                           int temporal_layers = 1);
+
+    bool encode(const DesktopFrame* frame, proto::desktop::VideoPacket* packet) override;
+    void setBandwidth(qint64 bandwidth) override;
+    void setEffort(int effort) override;
+    bool isTopOffPending() const override;
+    void setFocusRegion(const QRegion& region) override;
+    void setQualitySampling(int interval) override;
+    void requestKeyFrame() override;
+    bool requestIntraRefresh() override;
 
 private:
-    VideoEncoderVPX(proto::desktop::VideoEncoding encoding);
+    VideoEncoderVPX(proto::desktop::VideoEncoding encoding,
+                    int threads,
+                    int tile_columns,
+                    int temporal_layers,
+                    bool refine);
 
-    void createImage();
+    bool createImage();
     void createActiveMap();
+
+    // Changes the frame size of the existing codec. Returns false if the codec must be
+    // created again.
+    bool resizeCodec();
     void createVp8Codec();
     void createVp9Codec();
     void prepareImageAndActiveMap(const DesktopFrame* frame, proto::desktop::VideoPacket* packet);
+    void prepareTopOffActiveMap(proto::desktop::VideoPacket* packet);
+    bool prepareRefineMap(bool all_blocks, proto::desktop::VideoPacket* packet);
+    bool prepareFocusMap();
+    int prepareTemporalLayer(bool base_layer, proto::desktop::VideoPacket* packet);
+    void prepareIntraRefreshMap(proto::desktop::VideoPacket* packet);
+    void setIntraRefresh(bool enable);
     void setActiveMap(const QRect& rect);
+    void convertRect(const DesktopFrame* frame, const QRect& rect);
+    QRegion regionFromMap(const quint8* active_map) const;
+    bool prepareReferenceImage();
+    void updateMemoryCharge();
+    void measureQuality(proto::desktop::VideoPacket* packet);
+    bool isLossy() const;
+
+    // The speed and log2 of the tile columns of VP9 for the current effort and the refresh.
+    int cpuUsed() const;
+    int tileColumns() const;
 
     const proto::desktop::VideoEncoding encoding_;
 
-    // The current frame size.
+    // Requested number of threads and log2 of the number of tile columns (0 - automatic).
+    const int threads_;
+    const int tile_columns_;
+    const int temporal_layers_;
+    const bool refine_;
+
+    // The current frame size and the size for which the codec was created.
     QSize screen_size_;
+    QSize codec_size_;
 
     ScopedVpxCodec codec_ = nullptr;
+    vpx_codec_enc_cfg_t config_;
     vpx_image_t image_;
 
+    // Bitrate (in kbit/s) for the current frame size without the limits of the connection.
+    quint32 default_bitrate_ = 0;
+    qint64 bandwidth_ = 0;
+
+    // See VideoEncoder::setEffort().
+    int effort_ = 0;
+
+    // Log2 of the tile columns of VP9 for the current frame size with the configured effort.
+    int vp9_tile_columns_ = 0;
+
     size_t active_map_size_ = 0;
 
+    // The size of the allocated map buffers. It is the size of the largest map since the
+    // encoder was created.
+    size_t map_capacity_ = 0;
+
     vpx_active_map_t active_map_;
     std::unique_ptr<quint8[]> active_map_buffer_;
 
-    // Buffer for storing the yuv image.
-    std::unique_ptr<quint8[]> yuv_image_;
+    // Macro blocks of lossy VP9 which have been encoded with losses since the last top-off.
+    std::unique_ptr<quint8[]> top_off_map_buffer_;
+    bool top_off_pending_ = false;
+
+    bool key_frame_pending_ = false;
+
+    // The gradual refresh of VP9 encodes the band of the rows of macro blocks from
+    // |intra_refresh_row_| in segment 1 of the ROI map which is coded without references.
+    // The row is -1 if there is no refresh. The codec is configured for the map while
+    // |intra_refresh_| is true.
+    std::unique_ptr<quint8[]> intra_map_buffer_;
+    vpx_roi_map_t intra_map_;
+    int intra_refresh_row_ = -1;
+    bool intra_refresh_ = false;
+
+    // Macro blocks changed in the frames of temporal layer 1 since the last frame of layer 0.
+    // The frame of layer 0 encodes them again, so the clients which receive only layer 0 get
+    // all changes.
+    std::unique_ptr<quint8[]> layer_map_buffer_;
+    int temporal_layer_ = 0;
+
+    // VP8 has no lossless mode. The blocks which have not changed for some frames since they
+    // were encoded with losses are encoded again with a lower quantizer in segment 1 of the
+    // ROI map. The age is the number of frames since the block was encoded with losses, zero
+    // if the block is refined.
+    std::unique_ptr<quint8[]> block_age_buffer_;
+    std::unique_ptr<quint8[]> roi_map_buffer_;
+    vpx_roi_map_t roi_map_;
+
+    // The blocks of VP8 in the focus region are encoded in segment 2 of the ROI map with
+    // a lower quantizer than the rest of the frame.
+    QRegion focus_region_;
+
+    // The refinement of the next frame starts from this block, so that all blocks are refined
+    // in turn when the number of the refined blocks per frame is limited.
+    size_t refine_position_ = 0;
+
+    // See VideoEncoder::setQualitySampling(). The frames are counted since the last measured
+    // frame.
+    int quality_interval_ = 0;
+    int quality_frames_ = 0;
+
+    // The reconstruction of the measured frame copied from the codec. libvpx extends the
+    // borders of the copied frame, so the planes are surrounded by the border.
+    vpx_image_t reference_image_;
+    BufferPool::Buffer reference_buffer_;
+
+    // Buffer for storing the yuv image. It is allocated when the frames become larger than
+    // the buffer and keeps the converted content of the macroblocks which have not changed
+    // since the frame size was changed.
+    BufferPool::Buffer yuv_image_;
+
+    // The image, the reconstructed frame and the maps. The internal frames of libvpx are not
+    // counted.
+    MemoryCounters::Charge memory_charge_{ MemoryCounters::EncoderMemory };
 
     Q_DISABLE_COPY(VideoEncoderVPX)
 };
@@ -8,7 +8,12 @@
 #include "codec/video_encoder_zlib.h"
 
 #include <QDebug>
+#include <QThread>
 
+#include <functional>
+
+#include "base/function_runnable.h"
+#include "codec/compressor_zlib.h"
 #include "codec/pixel_translator.h"
 #include "codec/video_util.h"
 #include "desktop_capture/desktop_frame.h"
@@ -17,32 +22,174 @@ namespace aspia {
 
 namespace {
 
-// Retrieves a pointer to the output buffer in |update| used for storing the
-// encoded rectangle data. Will resize the buffer to |size|.
-quint8* GetOutputBuffer(proto::desktop::VideoPacket* packet, size_t size)
+// The maximum number of threads of the parallel mode.
+constexpr int kMaxThreads = 8;
+
+// The maximum area (in pixels) of one tile of the parallel mode.
+constexpr int kMaxTilePixels = 256 * 256;
+
+// The rectangles are translated by the strips of rows of about this size. Each strip is
+// compressed while it is in the L2 cache, and the buffer of the strip is reused.
+constexpr size_t kStripSize = 128 * 1024; // 128kB
+
+// Compresses |size| bytes of |data| and writes the output to |output| from the position
+// |filled|. Without the flush all data is consumed and the compressor can keep a part of it.
+// With the flush the compressed data is written out completely.
+void compressPart(Compressor* compressor,
+                  const quint8* data,
+                  size_t size,
+                  Compressor::CompressorFlush flush,
+                  std::string* output,
+                  size_t* filled)
+{
+    size_t pos = 0;  // Number of bytes that was taken from the source buffer.
+
+    for (;;)
+    {
+        // The incompressible data can be larger than the estimate.
+        if (*filled == output->size())
+            output->resize(output->size() + output->size() / 2 + 16);
+
+        size_t consumed = 0;
+        size_t written = 0;
+
+        const bool compress_again = compressor->process(
+            data + pos, size - pos,
+            reinterpret_cast<quint8*>(&(*output)[0]) + *filled, output->size() - *filled,
+            flush, &consumed, &written);
+
+        pos += consumed;
+        *filled += written;
+
+        if (!compress_again)
+            break;
+
+        if (flush == Compressor::CompressorNoFlush && pos == size && *filled < output->size())
+            break;
+    }
+}
+
+// Translates |rect| of |frame| by the strips of rows into |buffer| and compresses each strip
+// right after its translation.
+void compressRect(Compressor* compressor,
+                  PixelTranslator* translator,
+                  const DesktopFrame* frame,
+                  const QRect& rect,
+                  int bytes_per_pixel,
+                  std::vector<quint8>* buffer,
+                  std::string* output,
+                  size_t* filled)
+{
+    const int stride = rect.width() * bytes_per_pixel;
+    if (!stride)
+        return;
+
+    const int strip_rows = static_cast<int>(qMax<size_t>(1, kStripSize / stride));
+
+    if (buffer->size() < static_cast<size_t>(strip_rows * stride))
+        buffer->resize(strip_rows * stride);
+
+    for (int y = 0; y < rect.height(); y += strip_rows)
+    {
+        const int rows = qMin(strip_rows, rect.height() - y);
+
+        translator->translate(frame->frameDataAtPos(rect.x(), rect.y() + y),
+                              frame->stride(),
+                              buffer->data(),
+                              stride,
+                              rect.width(),
+                              rows);
+
+        compressPart(compressor, buffer->data(), rows * stride,
+                     Compressor::CompressorNoFlush, output, filled);
+    }
+}
+
+// Starts the compressed data of |data_size| bytes. If |stream| is false, then the compressor
+// starts a new stream.
+void startCompression(Compressor* compressor, size_t data_size, bool stream, std::string* output)
+{
+    if (!stream)
+        compressor->reset();
+
+    output->resize(data_size + (data_size / 100 + 16));
+}
+
+// If |stream| is true, then the compressor continues the stream and the data ends with a sync
+// flush.
+void finishCompression(Compressor* compressor, bool stream, std::string* output, size_t filled)
+{
+    compressPart(compressor, nullptr, 0,
+                 stream ? Compressor::CompressorSyncFlush : Compressor::CompressorFinish,
+                 output, &filled);
+
+    output->resize(filled);
+}
+
+proto::desktop::VideoEncoding encodingForCompression(proto::desktop::Compression compression)
 {
-    packet->mutable_data()->resize(size);
-    return reinterpret_cast<quint8*>(packet->mutable_data()->data());
+    switch (compression)
+    {
+        case proto::desktop::COMPRESSION_LZ4:
+            return proto::desktop::VIDEO_ENCODING_LZ4;
+
+        case proto::desktop::COMPRESSION_ZSTD:
+            return proto::desktop::VIDEO_ENCODING_ZSTD;
+
+        default:
+            return proto::desktop::VIDEO_ENCODING_ZLIB;
+    }
 }
 
 } // namespace
 
 VideoEncoderZLIB::VideoEncoderZLIB(std::unique_ptr<PixelTranslator> translator,
                                    const PixelFormat& target_format,
-                                   int compression_ratio)
+                                   int compression_ratio,
+                                   proto::desktop::Compression compression,
+                                   bool parallel,
+                                   bool stream)
     : target_format_(target_format),
-      compressor_(compression_ratio),
+      encoding_(encodingForCompression(compression)),
+      stream_(stream),
+      compression_ratio_(compression_ratio),
+      current_ratio_(compression_ratio),
+      compressor_(Compressor::create(compression, compression_ratio)),
       translator_(std::move(translator))
 {
-    // Nothing
+    if (parallel)
+    {
+        threads_ = qBound(1, QThread::idealThreadCount(), kMaxThreads);
+        effort_threads_ = threads_;
+
+        for (int i = 0; i < VideoUtil::kChunkStreamCount; ++i)
+            tile_compressors_.emplace_back(Compressor::create(compression, compression_ratio));
+
+        tile_buffers_.resize(tile_compressors_.size());
+
+        // The first tiles are encoded by the calling thread.
+        thread_pool_.setMaxThreadCount(qMax(1, threads_ - 1));
+    }
 }
 
 // static
 std::unique_ptr<VideoEncoderZLIB> VideoEncoderZLIB::create(const PixelFormat& target_format,
-                                                           int compression_ratio)
+                                                           int compression_ratio,
+                                                           proto::desktop::Compression compression,
+                                                           bool parallel,
+                                                           bool stream)
 {
-    if (compression_ratio < Z_BEST_SPEED ||
-        compression_ratio > Z_BEST_COMPRESSION)
+    if (compression != proto::desktop::COMPRESSION_ZLIB &&
+        compression != proto::desktop::COMPRESSION_LZ4 &&
+        compression != proto::desktop::COMPRESSION_ZSTD)
+    {
+        qWarning() << "Unsupported compression: " << compression;
+        return nullptr;
+    }
+
+    // The same range of the ratio is used for Zstandard. LZ4 has no compression levels.
+    if (compression != proto::desktop::COMPRESSION_LZ4 &&
+        (compression_ratio < Z_BEST_SPEED || compression_ratio > Z_BEST_COMPRESSION))
     {
         qWarning() << "Wrong compression ratio: " << compression_ratio;
         return nullptr;
@@ -57,52 +204,132 @@ std::unique_ptr<VideoEncoderZLIB> VideoEncoderZLIB::create(const PixelFormat& ta
     }
 
     return std::unique_ptr<VideoEncoderZLIB>(
-        new VideoEncoderZLIB(std::move(translator), target_format, compression_ratio));
+        new VideoEncoderZLIB(std::move(translator),
+                             target_format,
+                             compression_ratio,
+                             compression,
+                             parallel,
+                             stream));
 }
 
-void VideoEncoderZLIB::compressPacket(proto::desktop::VideoPacket* packet, size_t source_data_size)
+void VideoEncoderZLIB::encodeTile(Compressor* compressor,
+                                  std::vector<quint8>* buffer,
+                                  const DesktopFrame* frame,
+                                  const QRect& tile,
+                                  std::string* chunk)
 {
-    compressor_.reset();
-
-    const size_t packet_size = source_data_size + (source_data_size / 100 + 16);
+    const int bytes_per_pixel = target_format_.bytesPerPixel();
+    size_t filled = 0;
 
-    quint8* compress_pos = GetOutputBuffer(packet, packet_size);
+    startCompression(compressor, tile.width() * tile.height() * bytes_per_pixel, stream_, chunk);
+    compressRect(compressor, translator_.get(), frame, tile, bytes_per_pixel, buffer, chunk,
+                 &filled);
+    finishCompression(compressor, stream_, chunk, filled);
+}
 
-    size_t filled = 0;  // Number of bytes in the destination buffer.
-    size_t pos = 0;  // Position in the current row in bytes.
-    bool compress_again = true;
+bool VideoEncoderZLIB::encodeTiles(const DesktopFrame* frame,
+                                   const std::vector<QRect>& rects,
+                                   proto::desktop::VideoPacket* packet)
+{
+    std::vector<QRect> tiles;
 
-    while (compress_again)
+    // The rectangles are split into horizontal bands of limited area.
+    for (const auto& rect : rects)
     {
-        // Number of bytes that was taken from the source buffer.
-        size_t consumed = 0;
+        const int band_height = qMax(1, kMaxTilePixels / rect.width());
 
-        // Number of bytes that were written to the destination buffer.
-        size_t written = 0;
+        for (int y = rect.top(); y < rect.top() + rect.height(); y += band_height)
+        {
+            const QRect tile(rect.left(), y, rect.width(),
+                             qMin(band_height, rect.top() + rect.height() - y));
 
-        compress_again = compressor_.process(
-            translate_buffer_.get() + pos, source_data_size - pos,
-            compress_pos + filled, packet_size - filled,
-            Compressor::CompressorFinish, &consumed, &written);
+            tiles.push_back(tile);
 
-        pos += consumed;
-        filled += written;
+            VideoUtil::toVideoRect(tile, packet->add_dirty_rect());
+            packet->add_chunk();
+        }
+    }
+
+    if (tiles.empty())
+        return true;
+
+    // The chunks of one stream are compressed in order by the same thread.
+    const size_t streams = tile_compressors_.size();
+    const size_t workers =
+        qMin(static_cast<size_t>(effort_threads_), qMin(streams, tiles.size()));
 
-        // If we have filled the message or we have reached the end of stream.
-        if (filled == packet_size || !compress_again)
+    auto encode_tiles = [&](size_t worker)
+    {
+        for (size_t stream = worker; stream < streams; stream += workers)
         {
-            packet->mutable_data()->resize(filled);
-            return;
+            for (size_t i = stream; i < tiles.size(); i += streams)
+            {
+                encodeTile(tile_compressors_[stream].get(),
+                           &tile_buffers_[stream],
+                           frame,
+                           tiles[i],
+                           packet->mutable_chunk(static_cast<int>(i)));
+            }
         }
-    }
+    };
+
+    for (size_t worker = 1; worker < workers; ++worker)
+        thread_pool_.start(new FunctionRunnable(std::bind(encode_tiles, worker)));
+
+    encode_tiles(0);
+
+    thread_pool_.waitForDone();
+    return true;
+}
+
+void VideoEncoderZLIB::setEffort(int effort)
+{
+    // With less effort the tiles are compressed by fewer threads, so the encoder does not take
+    // all processors at once.
+    effort_threads_ = (effort < 0) ? qMax(1, threads_ >> -effort) : threads_;
+
+    // LZ4 has no compression levels.
+    if (encoding_ == proto::desktop::VIDEO_ENCODING_LZ4)
+        return;
+
+    const int ratio = qBound(Z_BEST_SPEED, compression_ratio_ + effort, Z_BEST_COMPRESSION);
+    if (ratio == current_ratio_)
+        return;
+
+    current_ratio_ = ratio;
+
+    // The packets are flushed or finished, so the streams continue with the new ratio.
+    compressor_->setCompressRatio(ratio);
+
+    for (auto& compressor : tile_compressors_)
+        compressor->setCompressRatio(ratio);
+}
+
+void VideoEncoderZLIB::requestKeyFrame()
+{
+    // The format is sent again and the streams are restarted.
+    screen_size_ = QSize();
 }
 
-std::unique_ptr<proto::desktop::VideoPacket> VideoEncoderZLIB::encode(const DesktopFrame* frame)
+bool VideoEncoderZLIB::encode(const DesktopFrame* frame, proto::desktop::VideoPacket* packet)
 {
-    std::unique_ptr<proto::desktop::VideoPacket> packet =
-        std::make_unique<proto::desktop::VideoPacket>();
+    packet->Clear();
+
+    if (source_format_ != frame->format())
+    {
+        std::unique_ptr<PixelTranslator> translator =
+            PixelTranslator::create(frame->format(), target_format_);
+        if (!translator)
+        {
+            qWarning("Unsupported pixel format of the frame");
+            return false;
+        }
+
+        source_format_ = frame->format();
+        translator_ = std::move(translator);
+    }
 
-    packet->set_encoding(proto::desktop::VIDEO_ENCODING_ZLIB);
+    packet->set_encoding(encoding_);
 
     if (screen_size_ != frame->size())
     {
@@ -112,42 +339,60 @@ std::unique_ptr<proto::desktop::VideoPacket> VideoEncoderZLIB::encode(const Desk
 
         VideoUtil::toVideoSize(screen_size_, format->mutable_screen_size());
         VideoUtil::toVideoPixelFormat(target_format_, format->mutable_pixel_format());
+
+        // The client restarts the streams when it receives the format.
+        if (stream_)
+        {
+            compressor_->reset();
+
+            for (auto& compressor : tile_compressors_)
+                compressor->reset();
+        }
     }
 
-    size_t data_size = 0;
+    packet->set_persistent_stream(stream_);
 
-    for (const auto& rect : frame->updatedRegion())
+    for (const auto& move_rect : frame->moveRects())
+        VideoUtil::toVideoCopyRect(move_rect, packet->add_copy_rect());
+
+    // Fragmented updates are sent as a few larger rectangles.
+    const std::vector<QRect> rects =
+        VideoUtil::coalesceRegion(frame->updatedRegion(), frame->size(), 1);
+
+    if (!tile_compressors_.empty())
     {
-        data_size += rect.width() * rect.height() * target_format_.bytesPerPixel();
-        VideoUtil::toVideoRect(rect, packet->add_dirty_rect());
+        if (!encodeTiles(frame, rects, packet))
+            return false;
+
+        return true;
     }
 
-    if (translate_buffer_size_ < data_size)
+    size_t data_size = 0;
+
+    for (const auto& rect : rects)
     {
-        translate_buffer_.reset(static_cast<quint8*>(alignedAlloc(data_size, 16)));
-        translate_buffer_size_ = data_size;
+        data_size += rect.width() * rect.height() * target_format_.bytesPerPixel();
+        VideoUtil::toVideoRect(rect, packet->add_dirty_rect());
     }
 
-    quint8* translate_pos = translate_buffer_.get();
+    // The stream is not flushed without the data.
+    if (stream_ && !data_size)
+        return true;
 
-    for (const auto& rect : frame->updatedRegion())
-    {
-        const int stride = rect.width() * target_format_.bytesPerPixel();
+    std::string* output = packet->mutable_data();
+    size_t filled = 0;
 
-        translator_->translate(frame->frameDataAtPos(rect.topLeft()),
-                               frame->stride(),
-                               translate_pos,
-                               stride,
-                               rect.width(),
-                               rect.height());
+    // The rectangles follow each other in one compressed block.
+    startCompression(compressor_.get(), data_size, stream_, output);
 
-        translate_pos += rect.height() * stride;
+    for (const auto& rect : rects)
+    {
+        compressRect(compressor_.get(), translator_.get(), frame, rect,
+                     target_format_.bytesPerPixel(), &strip_buffer_, output, &filled);
     }
 
-    // Compress data with using ZLIB compressor.
-    compressPacket(packet.get(), data_size);
-
-    return packet;
+    finishCompression(compressor_.get(), stream_, output, filled);
+    return true;
 }
 
 } // namespace aspia
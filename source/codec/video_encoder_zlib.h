@@ -8,10 +8,13 @@
 #ifndef _ASPIA_CODEC__VIDEO_ENCODER_ZLIB_H
 #define _ASPIA_CODEC__VIDEO_ENCODER_ZLIB_H
 
+#include <QRect>
 #include <QSize>
+#include <QThreadPool>
 
-#include "base/aligned_memory.h"
-#include "codec/compressor_zlib.h"
+#include <vector>
+
+#include "codec/compressor.h"
 #include "codec/video_encoder.h"
 #include "desktop_capture/pixel_format.h"
 
@@ -19,21 +22,46 @@ namespace aspia {
 
 class PixelTranslator;
 
+//
+// Encodes the raw pixels of the client's format compressed with ZLIB, LZ4 or Zstandard.
+// If the parallel mode is enabled, then the updated region is split into tiles. Each tile is
+// translated and compressed by the thread pool and stored as a separate chunk of the video
+// packet.
+// If the stream mode is enabled, then the compression streams are not restarted for each
+// packet, so the data of the previous packets is used as the dictionary.
+//
 class VideoEncoderZLIB : public VideoEncoder
 {
 public:
     ~VideoEncoderZLIB() = default;
 
     static std::unique_ptr<VideoEncoderZLIB> create(const PixelFormat& target_format,
-                                                    int compression_ratio);
+                                                    int compression_ratio,
+                                                    proto::desktop::Compression compression,
+                                                    bool parallel,
+                                                    bool stream);
 
-    std::unique_ptr<proto::desktop::VideoPacket> encode(const DesktopFrame* frame) override;
+    bool encode(const DesktopFrame* frame, proto::desktop::VideoPacket* packet) override;
+    bool canSplitFrame() const override { return true; }
+    void setEffort(int effort) override;
+    void requestKeyFrame() override;
 
 private:
     VideoEncoderZLIB(std::unique_ptr<PixelTranslator> translator,
                      const PixelFormat& target_format,
-                     int compression_ratio);
-    void compressPacket(proto::desktop::VideoPacket* packet, size_t source_data_size);
+                     int compression_ratio,
+                     proto::desktop::Compression compression,
+                     bool parallel,
+                     bool stream);
+
+    bool encodeTiles(const DesktopFrame* frame,
+                     const std::vector<QRect>& rects,
+                     proto::desktop::VideoPacket* packet);
+    void encodeTile(Compressor* compressor,
+                    std::vector<quint8>* buffer,
+                    const DesktopFrame* frame,
+                    const QRect& tile,
+                    std::string* chunk);
 
     // The current frame size.
     QSize screen_size_;
@@ -41,11 +69,31 @@ private:
     // Client's pixel format
     PixelFormat target_format_;
 
-    CompressorZLIB compressor_;
+    const proto::desktop::VideoEncoding encoding_;
+    const bool stream_;
+
+    // The ratio of the configuration and the current one changed by setEffort().
+    const int compression_ratio_;
+    int current_ratio_;
+
+    std::unique_ptr<Compressor> compressor_;
+
+    // The translator from the format of the frames. The frames captured in the client's format
+    // are copied without the translation.
+    PixelFormat source_format_ = PixelFormat::ARGB();
     std::unique_ptr<PixelTranslator> translator_;
 
-    std::unique_ptr<quint8[], AlignedFreeDeleter> translate_buffer_;
-    size_t translate_buffer_size_ = 0;
+    // The strip of the rectangle which is translated and compressed. See kStripSize.
+    std::vector<quint8> strip_buffer_;
+
+    // Compressors of the chunk streams of the parallel mode and their strips.
+    std::vector<std::unique_ptr<Compressor>> tile_compressors_;
+    std::vector<std::vector<quint8>> tile_buffers_;
+    QThreadPool thread_pool_;
+    int threads_ = 1;
+
+    // The threads of the parallel mode which are used with the current effort.
+    int effort_threads_ = 1;
 
     Q_DISABLE_COPY(VideoEncoderZLIB)
 };
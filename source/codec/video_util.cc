@@ -9,6 +9,82 @@
 
 namespace aspia {
 
+namespace {
+
+// The cost of one rectangle in the packet (the rectangle itself, the chunk and the setup of the
+// encoder) expressed in pixels.
+const qint64 kRectCostPixels = 2048;
+
+// Regions with more rectangles are aligned coarsely first to limit the merge time.
+const int kMaxCoalesceRects = 128;
+const int kCoarseAlignment = 64;
+
+qint64 rectArea(const QRect& rect)
+{
+    return static_cast<qint64>(rect.width()) * rect.height();
+}
+
+QRect alignRect(const QRect& rect, int alignment)
+{
+    const int left = rect.left() - (rect.left() % alignment);
+    const int top = rect.top() - (rect.top() % alignment);
+    const int right = ((rect.x() + rect.width() + alignment - 1) / alignment) * alignment;
+    const int bottom = ((rect.y() + rect.height() + alignment - 1) / alignment) * alignment;
+
+    return QRect(left, top, right - left, bottom - top);
+}
+
+void appendVarint(std::string* buffer, quint32 value)
+{
+    while (value >= 0x80)
+    {
+        buffer->push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+
+    buffer->push_back(static_cast<char>(value));
+}
+
+bool readVarint(const quint8** pos, const quint8* end, quint32* value)
+{
+    *value = 0;
+
+    for (int shift = 0; shift < 32; shift += 7)
+    {
+        if (*pos == end)
+            return false;
+
+        const quint8 byte = *(*pos)++;
+
+        *value |= static_cast<quint32>(byte & 0x7F) << shift;
+        if (!(byte & 0x80))
+            return true;
+    }
+
+    return false;
+}
+
+void appendDelta(std::string* buffer, int value, int previous)
+{
+    const qint32 delta = static_cast<qint32>(static_cast<quint32>(value) -
+                                             static_cast<quint32>(previous));
+
+    appendVarint(buffer, (static_cast<quint32>(delta) << 1) ^ static_cast<quint32>(delta >> 31));
+}
+
+bool readDelta(const quint8** pos, const quint8* end, int previous, int* value)
+{
+    quint32 zigzag;
+    if (!readVarint(pos, end, &zigzag))
+        return false;
+
+    const quint32 delta = (zigzag >> 1) ^ (0 - (zigzag & 1));
+    *value = static_cast<int>(static_cast<quint32>(previous) + delta);
+    return true;
+}
+
+} // namespace
+
 QRect VideoUtil::fromVideoRect(const proto::desktop::Rect& rect)
 {
     return QRect(rect.x(), rect.y(), rect.width(), rect.height());
@@ -22,6 +98,95 @@ void VideoUtil::toVideoRect(const QRect& from, proto::desktop::Rect* to)
     to->set_height(from.height());
 }
 
+// static
+void VideoUtil::packDirtyRects(proto::desktop::VideoPacket* packet)
+{
+    for (int i = 0; i < packet->layer_size(); ++i)
+        packDirtyRects(packet->mutable_layer(i));
+
+    if (packet->dirty_rect_size() == 0)
+        return;
+
+    std::string* buffer = packet->mutable_packed_dirty_rect();
+    buffer->clear();
+
+    // Most of the rectangles take 4-6 bytes instead of 10-14 bytes of the messages.
+    buffer->reserve(packet->dirty_rect_size() * 6);
+
+    proto::desktop::Rect previous;
+
+    for (const auto& rect : packet->dirty_rect())
+    {
+        appendDelta(buffer, rect.x(), previous.x());
+        appendDelta(buffer, rect.y(), previous.y());
+        appendDelta(buffer, rect.width(), previous.width());
+        appendDelta(buffer, rect.height(), previous.height());
+
+        previous = rect;
+    }
+
+    packet->clear_dirty_rect();
+}
+
+// static
+bool VideoUtil::dirtyRects(const proto::desktop::VideoPacket& packet, std::vector<QRect>* rects)
+{
+    rects->clear();
+
+    if (packet.packed_dirty_rect().empty())
+    {
+        rects->reserve(packet.dirty_rect_size());
+
+        for (const auto& rect : packet.dirty_rect())
+            rects->push_back(fromVideoRect(rect));
+
+        return true;
+    }
+
+    const std::string& buffer = packet.packed_dirty_rect();
+
+    const quint8* pos = reinterpret_cast<const quint8*>(buffer.data());
+    const quint8* end = pos + buffer.size();
+
+    // Each rectangle takes at least 4 bytes.
+    rects->reserve(buffer.size() / 4);
+
+    int x = 0, y = 0, width = 0, height = 0;
+
+    while (pos != end)
+    {
+        if (!readDelta(&pos, end, x, &x) ||
+            !readDelta(&pos, end, y, &y) ||
+            !readDelta(&pos, end, width, &width) ||
+            !readDelta(&pos, end, height, &height))
+        {
+            rects->clear();
+            return false;
+        }
+
+        rects->emplace_back(x, y, width, height);
+    }
+
+    return true;
+}
+
+DesktopFrame::MoveRect VideoUtil::fromVideoCopyRect(const proto::desktop::CopyRect& rect)
+{
+    DesktopFrame::MoveRect move_rect;
+
+    move_rect.source = QPoint(rect.source_x(), rect.source_y());
+    move_rect.target = fromVideoRect(rect.target_rect());
+
+    return move_rect;
+}
+
+void VideoUtil::toVideoCopyRect(const DesktopFrame::MoveRect& from, proto::desktop::CopyRect* to)
+{
+    to->set_source_x(from.source.x());
+    to->set_source_y(from.source.y());
+    toVideoRect(from.target, to->mutable_target_rect());
+}
+
 QSize VideoUtil::fromVideoSize(const proto::desktop::Size& size)
 {
     return QSize(size.width(), size.height());
@@ -57,4 +222,80 @@ void VideoUtil::toVideoPixelFormat(const PixelFormat& from, proto::desktop::Pixe
     to->set_blue_shift(from.blueShift());
 }
 
+proto::desktop::Compression VideoUtil::compressionForEncoding(
+    proto::desktop::VideoEncoding encoding)
+{
+    switch (encoding)
+    {
+        case proto::desktop::VIDEO_ENCODING_LZ4:
+            return proto::desktop::COMPRESSION_LZ4;
+
+        case proto::desktop::VIDEO_ENCODING_ZSTD:
+            return proto::desktop::COMPRESSION_ZSTD;
+
+        default:
+            return proto::desktop::COMPRESSION_ZLIB;
+    }
+}
+
+// static
+std::vector<QRect> VideoUtil::coalesceRegion(const QRegion& region,
+                                             const QSize& screen_size,
+                                             int alignment)
+{
+    const QRect screen_rect(QPoint(), screen_size);
+
+    if (region.rectCount() > kMaxCoalesceRects)
+        alignment = qMax(alignment, kCoarseAlignment);
+
+    std::vector<QRect> rects;
+    rects.reserve(region.rectCount());
+
+    for (const auto& rect : region)
+    {
+        const QRect aligned_rect = alignRect(rect, alignment).intersected(screen_rect);
+
+        if (!aligned_rect.isEmpty())
+            rects.push_back(aligned_rect);
+    }
+
+    bool merged = true;
+
+    while (merged)
+    {
+        merged = false;
+
+        for (size_t i = 0; i < rects.size(); ++i)
+        {
+            size_t j = i + 1;
+
+            while (j < rects.size())
+            {
+                const QRect united = rects[i].united(rects[j]);
+                const qint64 overdraw = rectArea(united) - rectArea(rects[i]) - rectArea(rects[j]) +
+                    rectArea(rects[i].intersected(rects[j]));
+
+                // Overlapping rectangles are always united, so the result never overlaps.
+                if (rects[i].intersects(rects[j]) || overdraw <= kRectCostPixels)
+                {
+                    rects[i] = united;
+                    rects[j] = rects.back();
+                    rects.pop_back();
+
+                    merged = true;
+
+                    // The united rectangle must be checked against all rectangles again.
+                    j = i + 1;
+                }
+                else
+                {
+                    ++j;
+                }
+            }
+        }
+    }
+
+    return rects;
+}
+
 } // namespace aspia
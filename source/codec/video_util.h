@@ -9,7 +9,11 @@
 #define _ASPIA_CODEC__VIDEO_UTIL_H
 
 #include <QRect>
+#include <QRegion>
 
+#include <vector>
+
+#include "desktop_capture/desktop_frame.h"
 #include "desktop_capture/pixel_format.h"
 #include "protocol/desktop_session.pb.h"
 
@@ -18,15 +22,39 @@ namespace aspia {
 class VideoUtil
 {
 public:
+    // Number of the compression streams of the video packet chunks.
+    static const int kChunkStreamCount = 8;
+
     static QRect fromVideoRect(const proto::desktop::Rect& rect);
     static void toVideoRect(const QRect& from, proto::desktop::Rect* to);
 
+    // Moves the dirty rectangles of |packet| and of its layers to |packed_dirty_rect|.
+    static void packDirtyRects(proto::desktop::VideoPacket* packet);
+
+    // Returns the dirty rectangles of |packet| in any representation. Returns false if the
+    // packed rectangles are malformed.
+    static bool dirtyRects(const proto::desktop::VideoPacket& packet, std::vector<QRect>* rects);
+
+    static DesktopFrame::MoveRect fromVideoCopyRect(const proto::desktop::CopyRect& rect);
+    static void toVideoCopyRect(const DesktopFrame::MoveRect& from, proto::desktop::CopyRect* to);
+
     static QSize fromVideoSize(const proto::desktop::Size& size);
     static void toVideoSize(const QSize& from, proto::desktop::Size* to);
 
     static PixelFormat fromVideoPixelFormat(const proto::desktop::PixelFormat& format);
     static void toVideoPixelFormat(const PixelFormat& from, proto::desktop::PixelFormat* to);
 
+    // Returns the compression of the raw pixels of |encoding|. For the other encodings and
+    // for the cursor shapes of them ZLIB is returned.
+    static proto::desktop::Compression compressionForEncoding(
+        proto::desktop::VideoEncoding encoding);
+
+    // Converts |region| to a few non-overlapping rectangles aligned to |alignment| pixels.
+    // Nearby rectangles are united when the extra pixels are cheaper than one more rectangle.
+    static std::vector<QRect> coalesceRegion(const QRegion& region,
+                                             const QSize& screen_size,
+                                             int alignment);
+
 private:
     Q_DISABLE_COPY(VideoUtil)
 };
@@ -11,6 +11,7 @@
 #include <QMessageBox>
 
 #include "crypto/data_encryptor.h"
+#include "crypto/password_hash.h"
 #include "crypto/random.h"
 
 namespace aspia {
@@ -22,6 +23,12 @@ constexpr int kMinNameLength = 1;
 constexpr int kMinPasswordLength = 8;
 constexpr int kMaxCommentLength = 2048;
 
+bool isEncrypted(proto::address_book::EncryptionType encryption_type)
+{
+    return encryption_type == proto::address_book::ENCRYPTION_TYPE_XCHACHA20_POLY1305 ||
+           encryption_type == proto::address_book::ENCRYPTION_TYPE_XCHACHA20_POLY1305_ARGON2ID;
+}
+
 } // namespace
 
 AddressBookDialog::AddressBookDialog(QWidget* parent, proto::address_book::File* file,
@@ -39,6 +46,9 @@ AddressBookDialog::AddressBookDialog(QWidget* parent, proto::address_book::File*
                                  QVariant(proto::address_book::ENCRYPTION_TYPE_NONE));
     ui.combo_encryption->addItem(tr("XChaCha20 + Poly1305 (256-bit key)"),
                                  QVariant(proto::address_book::ENCRYPTION_TYPE_XCHACHA20_POLY1305));
+    ui.combo_encryption->addItem(
+        tr("XChaCha20 + Poly1305 (256-bit key, Argon2id)"),
+        QVariant(proto::address_book::ENCRYPTION_TYPE_XCHACHA20_POLY1305_ARGON2ID));
 
     ui.edit_name->setText(QString::fromStdString(data_->root_group().name()));
     ui.edit_comment->setPlainText(QString::fromStdString(data_->root_group().comment()));
@@ -47,7 +57,7 @@ AddressBookDialog::AddressBookDialog(QWidget* parent, proto::address_book::File*
     if (current != -1)
         ui.combo_encryption->setCurrentIndex(current);
 
-    if (file->encryption_type() == proto::address_book::ENCRYPTION_TYPE_XCHACHA20_POLY1305)
+    if (isEncrypted(file->encryption_type()))
     {
         if (!key_->isEmpty())
         {
@@ -152,6 +162,7 @@ void AddressBookDialog::buttonBoxClicked(QAbstractButton* button)
         {
             file_->mutable_hashing_salt()->clear();
             file_->set_hashing_rounds(0);
+            file_->set_hashing_memory(0);
 
             data_->mutable_salt1()->clear();
             data_->mutable_salt2()->clear();
@@ -159,6 +170,7 @@ void AddressBookDialog::buttonBoxClicked(QAbstractButton* button)
         break;
 
         case proto::address_book::ENCRYPTION_TYPE_XCHACHA20_POLY1305:
+        case proto::address_book::ENCRYPTION_TYPE_XCHACHA20_POLY1305_ARGON2ID:
         {
             if (password_changed_)
             {
@@ -182,13 +194,35 @@ void AddressBookDialog::buttonBoxClicked(QAbstractButton* button)
                 QByteArray hashing_salt =
                     Random::generateBuffer(ui.spinbox_password_salt->value());
 
-                // Save the salt and the number of hashing iterations.
-                file_->set_hashing_rounds(ui.spinbox_hashing_rounds->value());
                 *file_->mutable_hashing_salt() = hashing_salt.toStdString();
 
                 // Now generate a key for encryption/decryption.
-                *key_ = DataEncryptor::createKey(password.toUtf8(), hashing_salt,
-                                                 file_->hashing_rounds());
+                if (encryption_type ==
+                        proto::address_book::ENCRYPTION_TYPE_XCHACHA20_POLY1305_ARGON2ID)
+                {
+                    // The parameters are saved in the file, so they can be changed later.
+                    file_->set_hashing_rounds(PasswordHash::kDefaultOpsLimit);
+                    file_->set_hashing_memory(PasswordHash::kDefaultMemLimit);
+
+                    *key_ = DataEncryptor::createKey(password.toUtf8(), hashing_salt,
+                                                     file_->hashing_rounds(),
+                                                     file_->hashing_memory());
+                }
+                else
+                {
+                    // Save the number of hashing iterations.
+                    file_->set_hashing_rounds(ui.spinbox_hashing_rounds->value());
+                    file_->set_hashing_memory(0);
+
+                    *key_ = DataEncryptor::createKey(password.toUtf8(), hashing_salt,
+                                                     file_->hashing_rounds());
+                }
+
+                if (key_->isEmpty())
+                {
+                    showError(tr("Unable to create the encryption key."));
+                    return;
+                }
             }
 
             int salt_before_size = ui.spinbox_salt_before->value();
@@ -238,10 +272,22 @@ void AddressBookDialog::encryptionTypedChanged(int item_index)
         break;
 
         case proto::address_book::ENCRYPTION_TYPE_XCHACHA20_POLY1305:
+        case proto::address_book::ENCRYPTION_TYPE_XCHACHA20_POLY1305_ARGON2ID:
         {
+            // The key of other type is created from the password again.
+            if (!password_changed_ && encryption_type != file_->encryption_type())
+                setPasswordChanged();
+
             ui.edit_password->setEnabled(true);
             ui.edit_password_repeat->setEnabled(true);
 
+            // The number of iterations is chosen for SHA-256 only.
+            const bool is_argon2 =
+                encryption_type == proto::address_book::ENCRYPTION_TYPE_XCHACHA20_POLY1305_ARGON2ID;
+
+            ui.label_hashing_rounds->setVisible(!is_argon2);
+            ui.spinbox_hashing_rounds->setVisible(!is_argon2);
+
             // Enable Advanced tab.
             ui.tab_widget->setTabEnabled(1, true);
         }
@@ -7,9 +7,17 @@
 
 #include "console/address_book_tab.h"
 
+#include <QEventLoop>
 #include <QFileDialog>
 #include <QMenu>
 #include <QMessageBox>
+#include <QProgressDialog>
+#include <QSaveFile>
+#include <QSignalBlocker>
+#include <QThread>
+#include <QTimer>
+
+#include <atomic>
 
 #include "base/message_serialization.h"
 #include "client/computer_factory.h"
@@ -17,16 +25,152 @@
 #include "console/address_book_dialog.h"
 #include "console/computer_dialog.h"
 #include "console/computer_group_dialog.h"
-#include "console/computer_item.h"
+#include "console/computer_group_item.h"
+#include "console/computer_model.h"
+#include "console/computer_prober.h"
 #include "console/console_settings.h"
 #include "console/open_address_book_dialog.h"
 #include "crypto/data_encryptor.h"
+#include "crypto/password_hash.h"
 #include "crypto/secure_memory.h"
 
 namespace aspia {
 
 namespace {
 
+// The progress dialog is shown if the address book is opened longer.
+constexpr int kProgressDelay = 500;
+constexpr int kProgressInterval = 100;
+constexpr int kProgressMaximum = 100;
+
+// The statuses of the shown computers are checked again after this time.
+constexpr int kProbeInterval = 60000; // 60 seconds
+
+proto::address_book::Computer* findComputerInGroup(
+    proto::address_book::ComputerGroup* computer_group, qint64 create_time,
+    const std::string& address)
+{
+    for (int i = 0; i < computer_group->computer_size(); ++i)
+    {
+        proto::address_book::Computer* computer = computer_group->mutable_computer(i);
+
+        if (computer->create_time() == create_time && computer->address() == address)
+            return computer;
+    }
+
+    for (int i = 0; i < computer_group->computer_group_size(); ++i)
+    {
+        proto::address_book::Computer* computer = findComputerInGroup(
+            computer_group->mutable_computer_group(i), create_time, address);
+        if (computer)
+            return computer;
+    }
+
+    return nullptr;
+}
+
+bool isEncrypted(proto::address_book::EncryptionType encryption_type)
+{
+    return encryption_type == proto::address_book::ENCRYPTION_TYPE_XCHACHA20_POLY1305 ||
+           encryption_type == proto::address_book::ENCRYPTION_TYPE_XCHACHA20_POLY1305_ARGON2ID;
+}
+
+// Creates the key, decrypts and parses the address book in the background, so a large address
+// book or a slow key derivation does not freeze the window.
+class OpenTask : public QThread
+{
+public:
+    enum class Result { SUCCESS, CANCELED, DECRYPT_ERROR, PARSE_ERROR };
+
+    OpenTask(const proto::address_book::File* file,
+             proto::address_book::Data* data,
+             QByteArray* key,
+             QByteArray&& password)
+        : file_(file), data_(data), key_(key), password_(std::move(password))
+    {
+        // Nothing
+    }
+
+    ~OpenTask()
+    {
+        wait();
+        secureMemZero(&password_);
+    }
+
+    void cancel() { canceled_ = true; }
+
+    // Returns -1 while the key is created.
+    int progress() const { return progress_; }
+
+    Result result() const { return result_; }
+
+protected:
+    // QThread implementation.
+    void run() override
+    {
+        if (!isEncrypted(file_->encryption_type()))
+        {
+            result_ = data_->ParseFromString(file_->data()) ? Result::SUCCESS : Result::PARSE_ERROR;
+            return;
+        }
+
+        const QByteArray salt = QByteArray::fromStdString(file_->hashing_salt());
+
+        if (file_->encryption_type() ==
+                proto::address_book::ENCRYPTION_TYPE_XCHACHA20_POLY1305_ARGON2ID)
+        {
+            *key_ = DataEncryptor::createKey(
+                password_, salt, file_->hashing_rounds(), file_->hashing_memory());
+        }
+        else
+        {
+            *key_ = DataEncryptor::createKey(password_, salt, file_->hashing_rounds());
+        }
+
+        secureMemZero(&password_);
+
+        if (canceled_)
+        {
+            result_ = Result::CANCELED;
+            return;
+        }
+
+        const int source_size = static_cast<int>(file_->data().size());
+
+        QByteArray decrypted_data;
+
+        const bool decrypted = DataEncryptor::decrypt(
+            file_->data().c_str(), source_size, *key_, &decrypted_data,
+            [this, source_size](int decrypted_size)
+        {
+            progress_ = static_cast<int>(
+                static_cast<qint64>(decrypted_size) * kProgressMaximum / source_size);
+            return !canceled_;
+        });
+
+        if (!decrypted)
+        {
+            result_ = canceled_ ? Result::CANCELED : Result::DECRYPT_ERROR;
+            return;
+        }
+
+        result_ = parseMessage(decrypted_data, *data_) ? Result::SUCCESS : Result::PARSE_ERROR;
+        secureMemZero(&decrypted_data);
+    }
+
+private:
+    const proto::address_book::File* file_;
+    proto::address_book::Data* data_;
+    QByteArray* key_;
+    QByteArray password_;
+
+    std::atomic_bool canceled_{ false };
+    std::atomic_int progress_{ -1 };
+    Result result_ = Result::PARSE_ERROR;
+
+    Q_DISABLE_COPY(OpenTask)
+};
+
 void cleanupComputer(proto::address_book::Computer* computer)
 {
     if (!computer)
@@ -94,12 +238,30 @@ AddressBookTab::AddressBookTab(const QString& file_path,
 {
     ui.setupUi(this);
 
+    // The data is serialized again on each save.
+    secureMemZero(file_.mutable_data());
+    file_.clear_data();
+
     QList<int> sizes;
     sizes.push_back(200);
     sizes.push_back(width() - 200);
 
     ui.splitter->setSizes(sizes);
 
+    computer_model_ = new ComputerModel(this);
+    ui.tree_computer->setModel(computer_model_);
+
+    computer_prober_ = new ComputerProber(this);
+
+    connect(computer_prober_, &ComputerProber::probed,
+            computer_model_, &ComputerModel::setStatuses);
+
+    QTimer* probe_timer = new QTimer(this);
+    connect(probe_timer, &QTimer::timeout, this, &AddressBookTab::probeComputers);
+    probe_timer->start(kProbeInterval);
+
+    index_.setRootGroup(data_.mutable_root_group());
+
     ComputerGroupItem* group_item = new ComputerGroupItem(data_.mutable_root_group(), nullptr);
 
     ui.tree_group->addTopLevelItem(group_item);
@@ -142,14 +304,17 @@ AddressBookTab::AddressBookTab(const QString& file_path,
     connect(ui.tree_group, &ComputerGroupTree::itemDropped,
             this, &AddressBookTab::onGroupItemDropped);
 
-    connect(ui.tree_computer, &ComputerTree::itemClicked,
+    connect(ui.tree_computer, &ComputerTree::clicked,
             this, &AddressBookTab::onComputerItemClicked);
 
     connect(ui.tree_computer, &ComputerTree::customContextMenuRequested,
             this, &AddressBookTab::onComputerContextMenu);
 
-    connect(ui.tree_computer, &ComputerTree::itemDoubleClicked,
+    connect(ui.tree_computer, &ComputerTree::doubleClicked,
             this, &AddressBookTab::onComputerItemDoubleClicked);
+
+    connect(ui.edit_search, &QLineEdit::textChanged,
+            this, &AddressBookTab::onSearchTextChanged);
 }
 
 AddressBookTab::~AddressBookTab()
@@ -211,48 +376,31 @@ AddressBookTab* AddressBookTab::openFromFile(const QString& file_path, QWidget*
 
     proto::address_book::Data address_book_data;
     QByteArray key;
+    QByteArray password;
 
     switch (address_book_file.encryption_type())
     {
         case proto::address_book::ENCRYPTION_TYPE_NONE:
+            break;
+
+        case proto::address_book::ENCRYPTION_TYPE_XCHACHA20_POLY1305:
+        case proto::address_book::ENCRYPTION_TYPE_XCHACHA20_POLY1305_ARGON2ID:
         {
-            if (!address_book_data.ParseFromString(address_book_file.data()))
+            // The parameters of the file are checked before the memory is allocated for them.
+            if (address_book_file.encryption_type() ==
+                    proto::address_book::ENCRYPTION_TYPE_XCHACHA20_POLY1305_ARGON2ID &&
+                !PasswordHash::isValidLimits(address_book_file.hashing_rounds(),
+                                             address_book_file.hashing_memory()))
             {
                 showOpenError(parent, tr("The address book file is corrupted or has an unknown format."));
                 return nullptr;
             }
-        }
-        break;
 
-        case proto::address_book::ENCRYPTION_TYPE_XCHACHA20_POLY1305:
-        {
             OpenAddressBookDialog dialog(parent, address_book_file.encryption_type());
             if (dialog.exec() != QDialog::Accepted)
                 return nullptr;
 
-            key = DataEncryptor::createKey(
-                dialog.password().toUtf8(),
-                QByteArray::fromStdString(address_book_file.hashing_salt()),
-                address_book_file.hashing_rounds());
-
-            QByteArray decrypted_data;
-
-            if (!DataEncryptor::decrypt(address_book_file.data().c_str(),
-                                        address_book_file.data().size(),
-                                        key,
-                                        &decrypted_data))
-            {
-                showOpenError(parent, tr("Unable to decrypt the address book with the specified password."));
-                return nullptr;
-            }
-
-            if (!parseMessage(decrypted_data, address_book_data))
-            {
-                showOpenError(parent, tr("The address book file is corrupted or has an unknown format."));
-                return nullptr;
-            }
-
-            secureMemZero(&decrypted_data);
+            password = dialog.password().toUtf8();
         }
         break;
 
@@ -263,6 +411,55 @@ AddressBookTab* AddressBookTab::openFromFile(const QString& file_path, QWidget*
         }
     }
 
+    OpenTask task(&address_book_file, &address_book_data, &key, std::move(password));
+
+    QProgressDialog progress_dialog(tr("Opening the address book..."), tr("Cancel"), 0, 0, parent);
+    progress_dialog.setWindowModality(Qt::WindowModal);
+    progress_dialog.setMinimumDuration(kProgressDelay);
+
+    QEventLoop loop;
+    QTimer timer;
+
+    connect(&task, &QThread::finished, &loop, &QEventLoop::quit);
+    connect(&progress_dialog, &QProgressDialog::canceled, &loop, [&task]() { task.cancel(); });
+    connect(&timer, &QTimer::timeout, &loop, [&]()
+    {
+        // The range is unknown while the key is created.
+        const int progress = task.progress();
+        if (progress < 0)
+            return;
+
+        progress_dialog.setMaximum(kProgressMaximum);
+        progress_dialog.setValue(progress);
+    });
+
+    task.start();
+    timer.start(kProgressInterval);
+
+    // The UI is repainted while the file is opened.
+    loop.exec();
+
+    task.wait();
+    timer.stop();
+    progress_dialog.reset();
+
+    switch (task.result())
+    {
+        case OpenTask::Result::SUCCESS:
+            break;
+
+        case OpenTask::Result::CANCELED:
+            return nullptr;
+
+        case OpenTask::Result::DECRYPT_ERROR:
+            showOpenError(parent, tr("Unable to decrypt the address book with the specified password."));
+            return nullptr;
+
+        default:
+            showOpenError(parent, tr("The address book file is corrupted or has an unknown format."));
+            return nullptr;
+    }
+
     return new AddressBookTab(file_path,
                               std::move(address_book_file),
                               std::move(address_book_data),
@@ -277,11 +474,7 @@ QString AddressBookTab::addressBookName() const
 
 proto::address_book::Computer* AddressBookTab::currentComputer() const
 {
-    ComputerItem* current_item = dynamic_cast<ComputerItem*>(ui.tree_computer->currentItem());
-    if (!current_item)
-        return nullptr;
-
-    return current_item->computer();
+    return computer_model_->computer(ui.tree_computer->currentIndex());
 }
 
 proto::address_book::ComputerGroup* AddressBookTab::currentComputerGroup() const
@@ -294,6 +487,12 @@ proto::address_book::ComputerGroup* AddressBookTab::currentComputerGroup() const
     return current_item->computerGroup();
 }
 
+proto::address_book::Computer* AddressBookTab::findComputer(qint64 create_time,
+                                                            const std::string& address)
+{
+    return findComputerInGroup(data_.mutable_root_group(), create_time, address);
+}
+
 void AddressBookTab::save()
 {
     saveToFile(file_path_);
@@ -348,10 +547,14 @@ void AddressBookTab::addComputer()
     proto::address_book::Computer* computer_released = computer.release();
 
     parent_item->addChildComputer(computer_released);
-    if (ui.tree_group->currentItem() == parent_item)
-    {
-        ui.tree_computer->addTopLevelItem(new ComputerItem(computer_released, parent_item));
-    }
+    index_.addComputer(computer_released, parent_item->computerGroup());
+
+    if (computer_model_->computerGroup() == parent_item)
+        computer_model_->addComputer(computer_released);
+    else
+        updateSearchResults();
+
+    probeComputers();
 
     setChanged(true);
 }
@@ -398,18 +601,22 @@ void AddressBookTab::modifyComputerGroup()
 
 void AddressBookTab::modifyComputer()
 {
-    ComputerItem* current_item = dynamic_cast<ComputerItem*>(ui.tree_computer->currentItem());
-    if (!current_item)
+    const QModelIndex index = ui.tree_computer->currentIndex();
+
+    proto::address_book::Computer* computer = computer_model_->computer(index);
+    if (!computer)
         return;
 
     ComputerDialog dialog(this,
                           ComputerDialog::ModifyComputer,
-                          current_item->computer(),
-                          current_item->parentComputerGroupItem()->computerGroup());
+                          computer,
+                          computer_model_->parentComputerGroup(index));
     if (dialog.exec() != QDialog::Accepted)
         return;
 
-    current_item->updateItem();
+    index_.updateComputer(computer);
+    computer_model_->updateComputer(computer);
+    probeComputers();
     setChanged(true);
 }
 
@@ -434,21 +641,35 @@ void AddressBookTab::removeComputerGroup()
                               QMessageBox::Yes,
                               QMessageBox::No) == QMessageBox::Yes)
     {
+        const bool is_searching = !ui.edit_search->text().isEmpty();
+
+        // The computers of the group are not shown after it is deleted. The search results may
+        // contain them too.
+        if (computer_model_->computerGroup() == current_item || is_searching)
+            computer_model_->setComputerGroup(nullptr);
+
+        index_.invalidate();
+
         cleanupComputerGroup(current_item->computerGroup());
 
         if (parent_item->deleteChildComputerGroup(current_item))
             setChanged(true);
+
+        if (is_searching)
+            updateSearchResults();
     }
 }
 
 void AddressBookTab::removeComputer()
 {
-    ComputerItem* current_item = dynamic_cast<ComputerItem*>(ui.tree_computer->currentItem());
-    if (!current_item)
+    const QModelIndex index = ui.tree_computer->currentIndex();
+
+    proto::address_book::Computer* computer = computer_model_->computer(index);
+    if (!computer)
         return;
 
     QString message = tr("Are you sure you want to delete computer \"%1\"?")
-        .arg(QString::fromStdString(current_item->computer()->name()));
+        .arg(QString::fromStdString(computer->name()));
 
     if (QMessageBox::question(this,
                               tr("Confirmation"),
@@ -456,14 +677,22 @@ void AddressBookTab::removeComputer()
                               QMessageBox::Yes,
                               QMessageBox::No) == QMessageBox::Yes)
     {
-        ComputerGroupItem* parent_group = current_item->parentComputerGroupItem();
+        // The computer may be found in any group.
+        proto::address_book::ComputerGroup* parent_group =
+            computer_model_->parentComputerGroup(index);
 
-        cleanupComputer(current_item->computer());
+        computer_model_->removeComputer(computer);
+        index_.removeComputer(computer);
+        cleanupComputer(computer);
 
-        if (parent_group->deleteChildComputer(current_item->computer()))
+        for (int i = 0; i < parent_group->computer_size(); ++i)
         {
-            delete current_item;
-            setChanged(true);
+            if (parent_group->mutable_computer(i) == computer)
+            {
+                parent_group->mutable_computer()->DeleteSubrange(i, 1);
+                setChanged(true);
+                break;
+            }
         }
     }
 }
@@ -476,6 +705,14 @@ void AddressBookTab::onGroupItemClicked(QTreeWidgetItem* item, int /* column */)
 
     bool is_root = !current_item->parent();
     emit computerGroupActivated(true, is_root);
+
+    // The selected group is shown instead of the search results.
+    if (!ui.edit_search->text().isEmpty())
+    {
+        QSignalBlocker blocker(ui.edit_search);
+        ui.edit_search->clear();
+    }
+
     updateComputerList(current_item);
 }
 
@@ -509,6 +746,7 @@ void AddressBookTab::onGroupItemExpanded(QTreeWidgetItem* item)
     if (!current_item)
         return;
 
+    current_item->populateChildren();
     current_item->SetExpanded(true);
     setChanged(true);
 }
@@ -520,14 +758,20 @@ void AddressBookTab::onGroupItemDropped()
     if (!current_item)
         return;
 
-    updateComputerList(current_item);
+    // The groups of the moved computers are changed.
+    index_.invalidate();
+
+    if (ui.edit_search->text().isEmpty())
+        updateComputerList(current_item);
+    else
+        updateSearchResults();
+
     setChanged(true);
 }
 
-void AddressBookTab::onComputerItemClicked(QTreeWidgetItem* item, int /* column */)
+void AddressBookTab::onComputerItemClicked(const QModelIndex& index)
 {
-    ComputerItem* current_item = dynamic_cast<ComputerItem*>(item);
-    if (!current_item)
+    if (!computer_model_->computer(index))
         return;
 
     emit computerActivated(true);
@@ -535,23 +779,31 @@ void AddressBookTab::onComputerItemClicked(QTreeWidgetItem* item, int /* column
 
 void AddressBookTab::onComputerContextMenu(const QPoint& point)
 {
-    ComputerItem* current_item = dynamic_cast<ComputerItem*>(ui.tree_computer->itemAt(point));
-    if (current_item)
+    const QModelIndex index = ui.tree_computer->indexAt(point);
+
+    proto::address_book::Computer* computer = computer_model_->computer(index);
+    if (computer)
     {
-        ui.tree_computer->setCurrentItem(current_item);
-        onComputerItemClicked(current_item, 0);
+        ui.tree_computer->setCurrentIndex(index);
+        onComputerItemClicked(index);
     }
 
-    emit computerContextMenu(current_item, ui.tree_computer->mapToGlobal(point));
+    emit computerContextMenu(computer, ui.tree_computer->viewport()->mapToGlobal(point));
 }
 
-void AddressBookTab::onComputerItemDoubleClicked(QTreeWidgetItem* item, int column)
+void AddressBookTab::onComputerItemDoubleClicked(const QModelIndex& index)
 {
-    ComputerItem* current_item = dynamic_cast<ComputerItem*>(item);
-    if (!current_item)
+    proto::address_book::Computer* computer = computer_model_->computer(index);
+    if (!computer)
         return;
 
-    emit computerDoubleClicked(current_item->computer());
+    emit computerDoubleClicked(computer);
+}
+
+void AddressBookTab::onSearchTextChanged(const QString& /* text */)
+{
+    updateSearchResults();
+    emit computerActivated(currentComputer() != nullptr);
 }
 
 void AddressBookTab::showEvent(QShowEvent* event)
@@ -568,12 +820,7 @@ void AddressBookTab::showEvent(QShowEvent* event)
         emit computerGroupActivated(true, is_root);
     }
 
-    ComputerItem* current_computer = dynamic_cast<ComputerItem*>(ui.tree_computer->currentItem());
-
-    if (!current_computer)
-        emit computerActivated(false);
-    else
-        emit computerActivated(true);
+    emit computerActivated(currentComputer() != nullptr);
 
     QWidget::showEvent(event);
 }
@@ -587,6 +834,7 @@ void AddressBookTab::setChanged(bool value)
 void AddressBookTab::retranslateUi()
 {
     ui.retranslateUi(this);
+    computer_model_->retranslateUi();
 
     QTreeWidgetItem* current = ui.tree_group->currentItem();
     if (current)
@@ -595,17 +843,50 @@ void AddressBookTab::retranslateUi()
 
 void AddressBookTab::updateComputerList(ComputerGroupItem* computer_group)
 {
-    for (int i = ui.tree_computer->topLevelItemCount() - 1; i >= 0; --i)
+    computer_model_->setComputerGroup(computer_group);
+    probeComputers();
+}
+
+void AddressBookTab::updateSearchResults()
+{
+    const QString query = ui.edit_search->text();
+
+    if (!query.isEmpty())
     {
-        QTreeWidgetItem* item = ui.tree_computer->takeTopLevelItem(i);
-        delete item;
+        computer_model_->setSearchResults(index_.find(query));
+        probeComputers();
+        return;
     }
 
-    ui.tree_computer->addTopLevelItems(computer_group->ComputerList());
+    if (computer_model_->computerGroup())
+        return;
+
+    updateComputerList(dynamic_cast<ComputerGroupItem*>(ui.tree_group->currentItem()));
+}
+
+void AddressBookTab::probeComputers()
+{
+    // The cached statuses are reported without the connections.
+    computer_prober_->probe(computer_model_->hosts());
 }
 
 bool AddressBookTab::saveToFile(const QString& file_path)
 {
+    QString path = file_path;
+    if (path.isEmpty())
+    {
+        ConsoleSettings settings;
+
+        path = QFileDialog::getSaveFileName(this,
+                                            tr("Save Address Book"),
+                                            settings.lastDirectory(),
+                                            tr("Aspia Address Book (*.aab)"));
+        if (path.isEmpty())
+            return false;
+
+        settings.setLastDirectory(QFileInfo(path).absolutePath());
+    }
+
     QByteArray serialized_data = serializeMessage(data_);
 
     switch (file_.encryption_type())
@@ -615,6 +896,7 @@ bool AddressBookTab::saveToFile(const QString& file_path)
             break;
 
         case proto::address_book::ENCRYPTION_TYPE_XCHACHA20_POLY1305:
+        case proto::address_book::ENCRYPTION_TYPE_XCHACHA20_POLY1305_ARGON2ID:
         {
             QByteArray encrypted_data = DataEncryptor::encrypt(serialized_data, key_);
             file_.set_data(encrypted_data.constData(), encrypted_data.size());
@@ -629,35 +911,27 @@ bool AddressBookTab::saveToFile(const QString& file_path)
 
     secureMemZero(&serialized_data);
 
-    QString path = file_path;
-    if (path.isEmpty())
-    {
-        ConsoleSettings settings;
-
-        path = QFileDialog::getSaveFileName(this,
-                                            tr("Save Address Book"),
-                                            settings.lastDirectory(),
-                                            tr("Aspia Address Book (*.aab)"));
-        if (path.isEmpty())
-            return false;
+    QByteArray buffer = serializeMessage(file_);
 
-        settings.setLastDirectory(QFileInfo(path).absolutePath());
-    }
+    // The data is serialized again on each save.
+    secureMemZero(file_.mutable_data());
+    file_.clear_data();
 
-    QFile file(path);
+    // The new file is written next to the previous one and replaces it only after it is
+    // completely written, so the previous file stays valid if the writing fails.
+    QSaveFile file(path);
     if (!file.open(QIODevice::WriteOnly))
     {
+        secureMemZero(&buffer);
         showSaveError(this, tr("Unable to create or open address book file."));
         return false;
     }
 
-    QByteArray buffer = serializeMessage(file_);
-
-    qint64 bytes_written = file.write(buffer);
+    const qint64 bytes_written = file.write(buffer);
 
     secureMemZero(&buffer);
 
-    if (bytes_written != buffer.size())
+    if (bytes_written != buffer.size() || !file.commit())
     {
         showSaveError(this, tr("Unable to write address book file."));
         return false;
@@ -8,13 +8,15 @@
 #ifndef _ASPIA_CONSOLE__ADDRESS_BOOK_TAB_H
 #define _ASPIA_CONSOLE__ADDRESS_BOOK_TAB_H
 
+#include "console/computer_index.h"
 #include "console/console_tab.h"
 #include "protocol/address_book.pb.h"
 #include "ui_address_book_tab.h"
 
 namespace aspia {
 
-class ComputerItem;
+class ComputerModel;
+class ComputerProber;
 
 class AddressBookTab : public ConsoleTab
 {
@@ -30,6 +32,10 @@ public:
     QString addressBookPath() const { return file_path_; }
     proto::address_book::Computer* currentComputer() const;
     proto::address_book::ComputerGroup* currentComputerGroup() const;
+
+    // Returns the computer which was created at |create_time| and has |address| or nullptr.
+    proto::address_book::Computer* findComputer(qint64 create_time,
+                                                const std::string& address);
     void setChanged(bool changed);
     bool isChanged() const { return is_changed_; }
 
@@ -51,7 +57,7 @@ signals:
     void computerGroupActivated(bool activated, bool is_root);
     void computerActivated(bool activated);
     void computerGroupContextMenu(const QPoint& point, bool is_root);
-    void computerContextMenu(ComputerItem* comouter_item, const QPoint& point);
+    void computerContextMenu(proto::address_book::Computer* computer, const QPoint& point);
     void computerDoubleClicked(proto::address_book::Computer* computer);
 
 protected:
@@ -64,9 +70,10 @@ private slots:
     void onGroupItemCollapsed(QTreeWidgetItem* item);
     void onGroupItemExpanded(QTreeWidgetItem* item);
     void onGroupItemDropped();
-    void onComputerItemClicked(QTreeWidgetItem* item, int column);
+    void onComputerItemClicked(const QModelIndex& index);
     void onComputerContextMenu(const QPoint& point);
-    void onComputerItemDoubleClicked(QTreeWidgetItem* item, int column);
+    void onComputerItemDoubleClicked(const QModelIndex& index);
+    void onSearchTextChanged(const QString& text);
 
 private:
     AddressBookTab(const QString& file_path,
@@ -76,12 +83,21 @@ private:
                    QWidget* parent);
 
     void updateComputerList(ComputerGroupItem* computer_group);
+
+    // Shows the computers of the current group again if the search is cleared, or the new
+    // search results.
+    void updateSearchResults();
+
+    // Checks which of the shown computers are online.
+    void probeComputers();
     bool saveToFile(const QString& file_path);
 
     static void showOpenError(QWidget* parent, const QString& message);
     static void showSaveError(QWidget* parent, const QString& message);
 
     Ui::AddressBookTab ui;
+    ComputerModel* computer_model_;
+    ComputerProber* computer_prober_;
 
     QString file_path_;
     QByteArray key_;
@@ -89,6 +105,9 @@ private:
     proto::address_book::File file_;
     proto::address_book::Data data_;
 
+    // Must be destroyed before |data_|.
+    ComputerIndex index_;
+
     bool is_changed_ = false;
 
     Q_DISABLE_COPY(AddressBookTab)
@@ -9,9 +9,11 @@
 
 #include <QDateTime>
 #include <QMessageBox>
+#include <QRegularExpression>
 
 #include "client/ui/desktop_config_dialog.h"
 #include "client/client_session_desktop_manage.h"
+#include "client/computer_factory.h"
 #include "console/computer_group_item.h"
 #include "host/user.h"
 
@@ -54,6 +56,9 @@ ComputerDialog::ComputerDialog(QWidget* parent,
     ui.edit_parent_name->setText(QString::fromStdString(parent_computer_group->name()));
     ui.edit_name->setText(QString::fromStdString(computer_->name()));
     ui.edit_address->setText(QString::fromStdString(computer_->address()));
+
+    ui.edit_alternate_addresses->setText(
+        ComputerFactory::alternateAddresses(*computer_).join(QLatin1Char(' ')));
     ui.spinbox_port->setValue(computer_->port());
     ui.edit_username->setText(QString::fromStdString(computer_->username()));
     ui.edit_password->setText(QString::fromStdString(computer->password()));
@@ -191,9 +196,23 @@ void ComputerDialog::buttonBoxClicked(QAbstractButton* button)
         if (mode_ == CreateComputer)
             computer_->set_create_time(current_time);
 
+        const std::string address = ui.edit_address->text().toStdString();
+
+        // The profile of the previous sessions does not describe the link to the other host.
+        if (computer_->address() != address)
+            computer_->clear_streaming_profile();
+
         computer_->set_modify_time(current_time);
         computer_->set_name(name.toStdString());
-        computer_->set_address(ui.edit_address->text().toStdString());
+        computer_->set_address(address);
+
+        computer_->clear_alternate_addresses();
+        for (const auto& address : ui.edit_alternate_addresses->text().split(
+                 QRegularExpression(QStringLiteral("[\\s,;]+")), QString::SkipEmptyParts))
+        {
+            computer_->add_alternate_addresses(address.toStdString());
+        }
+
         computer_->set_port(ui.spinbox_port->value());
         computer_->set_username(username.toStdString());
         computer_->set_password(password.toStdString());
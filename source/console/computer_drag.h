@@ -23,10 +23,10 @@ public:
         // Nothing
     }
 
-    void setComputerItem(ComputerItem* computer_item)
+    void setComputer(proto::address_book::Computer* computer, ComputerGroupItem* group_item)
     {
         ComputerMimeData* mime_data = new ComputerMimeData();
-        mime_data->setComputerItem(computer_item);
+        mime_data->setComputer(computer, group_item);
         setMimeData(mime_data);
     }
 };
@@ -17,6 +17,21 @@ ComputerGroupItem::ComputerGroupItem(proto::address_book::ComputerGroup* compute
     setIcon(0, QIcon(QStringLiteral(":/icon/folder.png")));
     updateItem();
 
+    // The collapsed groups are only marked as having the children.
+    if (computer_group_->expanded())
+        populateChildren();
+    else if (computer_group_->computer_group_size())
+        setChildIndicatorPolicy(QTreeWidgetItem::ShowIndicator);
+}
+
+void ComputerGroupItem::populateChildren()
+{
+    if (populated_)
+        return;
+
+    populated_ = true;
+    setChildIndicatorPolicy(QTreeWidgetItem::DontShowIndicatorWhenChildless);
+
     for (int i = 0; i < computer_group_->computer_group_size(); ++i)
     {
         addChild(new ComputerGroupItem(computer_group_->mutable_computer_group(i), this));
@@ -26,6 +41,9 @@ ComputerGroupItem::ComputerGroupItem(proto::address_book::ComputerGroup* compute
 ComputerGroupItem* ComputerGroupItem::addChildComputerGroup(
     proto::address_book::ComputerGroup* computer_group)
 {
+    // The item of the new group is created with the items of the existing groups.
+    populateChildren();
+
     computer_group_->mutable_computer_group()->AddAllocated(computer_group);
 
     ComputerGroupItem* item = new ComputerGroupItem(computer_group, this);
@@ -123,14 +141,4 @@ void ComputerGroupItem::SetExpanded(bool expanded)
     computer_group_->set_expanded(expanded);
 }
 
-QList<QTreeWidgetItem*> ComputerGroupItem::ComputerList()
-{
-    QList<QTreeWidgetItem*> list;
-
-    for (int i = 0; i < computer_group_->computer_size(); ++i)
-        list.push_back(new ComputerItem(computer_group_->mutable_computer(i), this));
-
-    return list;
-}
-
 } // namespace aspia
@@ -8,11 +8,13 @@
 #ifndef _ASPIA_CONSOLE__COMPUTER_GROUP_ITEM_H
 #define _ASPIA_CONSOLE__COMPUTER_GROUP_ITEM_H
 
-#include "console/computer_item.h"
+#include <QTreeWidget>
+
 #include "protocol/address_book.pb.h"
 
 namespace aspia {
 
+// The items of the child groups are created when the group is expanded for the first time.
 class ComputerGroupItem : public QTreeWidgetItem
 {
 public:
@@ -29,9 +31,11 @@ public:
 
     void updateItem();
 
+    // Creates the items of the child groups if they are not created yet.
+    void populateChildren();
+
     bool IsExpanded() const;
     void SetExpanded(bool expanded);
-    QList<QTreeWidgetItem*> ComputerList();
 
     proto::address_book::ComputerGroup* computerGroup() { return computer_group_; }
 
@@ -39,6 +43,7 @@ private:
     friend class ComputerGroupTree;
 
     proto::address_book::ComputerGroup* computer_group_;
+    bool populated_ = false;
 
     Q_DISABLE_COPY(ComputerGroupItem)
 };
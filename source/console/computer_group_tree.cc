@@ -83,8 +83,8 @@ void ComputerGroupTree::dragMoveEvent(QDragMoveEvent* event)
                 dynamic_cast<const ComputerMimeData*>(mime_data);
             if (computer_mime_data)
             {
-                ComputerItem* computer_item = computer_mime_data->computerItem();
-                if (computer_item && computer_item->parentComputerGroupItem() != target_item)
+                if (computer_mime_data->computer() &&
+                    computer_mime_data->computerGroupItem() != target_item)
                 {
                     setCurrentItem(target_item);
                     event->acceptProposedAction();
@@ -143,19 +143,17 @@ void ComputerGroupTree::dropEvent(QDropEvent* event)
             dynamic_cast<const ComputerMimeData*>(event->mimeData());
         if (computer_mime_data)
         {
-            ComputerItem* computer_item = computer_mime_data->computerItem();
-
             ComputerGroupItem* target_group_item =
                 dynamic_cast<ComputerGroupItem*>(itemAt(event->pos()));
             ComputerGroupItem* source_group_item =
-                computer_item->parentComputerGroupItem();
+                computer_mime_data->computerGroupItem();
 
             if (target_group_item && source_group_item)
             {
                 setCurrentItem(source_group_item);
 
                 proto::address_book::Computer* computer =
-                    source_group_item->takeChildComputer(computer_item->computer());
+                    source_group_item->takeChildComputer(computer_mime_data->computer());
 
                 if (computer)
                 {
@@ -0,0 +1,226 @@
+//
+// PROJECT:         Aspia
+// FILE:            console/computer_index.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "console/computer_index.h"
+
+#include <QStringList>
+
+#include <algorithm>
+#include <iterator>
+
+#include "crypto/secure_memory.h"
+
+namespace aspia {
+
+namespace {
+
+constexpr int kTrigramLength = 3;
+
+// The index is built again when more entries are removed.
+constexpr size_t kMinRemovedEntries = 1024;
+
+QString indexText(const proto::address_book::Computer& computer)
+{
+    // The separator does not allow the trigrams across the fields.
+    return (QString::fromStdString(computer.name()) + QLatin1Char('\n') +
+            QString::fromStdString(computer.address()) + QLatin1Char('\n') +
+            QString::fromStdString(computer.comment())).toCaseFolded();
+}
+
+quint64 trigramKey(const QChar* text)
+{
+    return (static_cast<quint64>(text[0].unicode()) << 32) |
+           (static_cast<quint64>(text[1].unicode()) << 16) |
+           static_cast<quint64>(text[2].unicode());
+}
+
+std::vector<quint64> trigramKeys(const QString& text)
+{
+    std::vector<quint64> keys;
+
+    for (int i = 0; i + kTrigramLength <= text.length(); ++i)
+        keys.push_back(trigramKey(text.constData() + i));
+
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    return keys;
+}
+
+} // namespace
+
+ComputerIndex::~ComputerIndex()
+{
+    clear();
+}
+
+void ComputerIndex::setRootGroup(proto::address_book::ComputerGroup* root_group)
+{
+    root_group_ = root_group;
+    rebuild();
+}
+
+void ComputerIndex::addComputer(proto::address_book::Computer* computer,
+                                proto::address_book::ComputerGroup* computer_group)
+{
+    // The computer is added with the rebuilding.
+    if (!valid_)
+        return;
+
+    const quint32 id = static_cast<quint32>(entries_.size());
+
+    entries_.push_back(Entry{ computer, computer_group, indexText(*computer), false });
+    entry_ids_[computer] = id;
+
+    for (quint64 key : trigramKeys(entries_.back().text))
+        trigrams_[key].push_back(id);
+}
+
+void ComputerIndex::removeComputer(const proto::address_book::Computer* computer)
+{
+    if (!valid_)
+        return;
+
+    auto it = entry_ids_.find(computer);
+    if (it == entry_ids_.end())
+        return;
+
+    // The entry stays in the lists of the trigrams until the index is built again.
+    Entry& entry = entries_[it->second];
+
+    entry.removed = true;
+    secureMemZero(&entry.text);
+
+    entry_ids_.erase(it);
+
+    if (++removed_count_ >= kMinRemovedEntries && removed_count_ > entries_.size() / 2)
+        invalidate();
+}
+
+void ComputerIndex::updateComputer(proto::address_book::Computer* computer)
+{
+    if (!valid_)
+        return;
+
+    auto it = entry_ids_.find(computer);
+    if (it == entry_ids_.end())
+        return;
+
+    proto::address_book::ComputerGroup* computer_group = entries_[it->second].computer_group;
+
+    removeComputer(computer);
+    addComputer(computer, computer_group);
+}
+
+std::vector<ComputerIndex::Result> ComputerIndex::find(const QString& query)
+{
+    if (!valid_)
+        rebuild();
+
+    const QStringList words =
+        query.toCaseFolded().split(QLatin1Char(' '), QString::SkipEmptyParts);
+    if (words.isEmpty())
+        return std::vector<Result>();
+
+    // The candidates have all trigrams of the words. The words shorter than a trigram are only
+    // compared.
+    std::vector<quint32> candidates;
+    bool has_candidates = false;
+
+    for (const auto& word : words)
+    {
+        for (quint64 key : trigramKeys(word))
+        {
+            auto it = trigrams_.find(key);
+            if (it == trigrams_.end())
+                return std::vector<Result>();
+
+            if (!has_candidates)
+            {
+                candidates = it->second;
+                has_candidates = true;
+                continue;
+            }
+
+            std::vector<quint32> intersection;
+            std::set_intersection(candidates.begin(), candidates.end(),
+                                  it->second.begin(), it->second.end(),
+                                  std::back_inserter(intersection));
+            candidates.swap(intersection);
+
+            if (candidates.empty())
+                return std::vector<Result>();
+        }
+    }
+
+    auto matches = [&](const Entry& entry)
+    {
+        if (entry.removed)
+            return false;
+
+        for (const auto& word : words)
+        {
+            if (!entry.text.contains(word))
+                return false;
+        }
+
+        return true;
+    };
+
+    std::vector<Result> results;
+
+    if (has_candidates)
+    {
+        for (quint32 id : candidates)
+        {
+            const Entry& entry = entries_[id];
+            if (matches(entry))
+                results.push_back(Result{ entry.computer, entry.computer_group });
+        }
+    }
+    else
+    {
+        for (const auto& entry : entries_)
+        {
+            if (matches(entry))
+                results.push_back(Result{ entry.computer, entry.computer_group });
+        }
+    }
+
+    return results;
+}
+
+void ComputerIndex::rebuild()
+{
+    clear();
+
+    valid_ = true;
+
+    if (root_group_)
+        addGroup(root_group_);
+}
+
+void ComputerIndex::addGroup(proto::address_book::ComputerGroup* computer_group)
+{
+    for (int i = 0; i < computer_group->computer_size(); ++i)
+        addComputer(computer_group->mutable_computer(i), computer_group);
+
+    for (int i = 0; i < computer_group->computer_group_size(); ++i)
+        addGroup(computer_group->mutable_computer_group(i));
+}
+
+void ComputerIndex::clear()
+{
+    for (auto& entry : entries_)
+        secureMemZero(&entry.text);
+
+    entries_.clear();
+    trigrams_.clear();
+    entry_ids_.clear();
+    removed_count_ = 0;
+}
+
+} // namespace aspia
@@ -0,0 +1,81 @@
+//
+// PROJECT:         Aspia
+// FILE:            console/computer_index.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CONSOLE__COMPUTER_INDEX_H
+#define _ASPIA_CONSOLE__COMPUTER_INDEX_H
+
+#include <QString>
+
+#include <unordered_map>
+#include <vector>
+
+#include "protocol/address_book.pb.h"
+
+namespace aspia {
+
+//
+// The trigram index of the names, the addresses and the comments of all computers of the
+// address book. The search finds the computers which contain all words of the query. Only the
+// computers which have all trigrams of the words are compared, so the search does not depend on
+// the size of the address book.
+//
+class ComputerIndex
+{
+public:
+    struct Result
+    {
+        proto::address_book::Computer* computer;
+        proto::address_book::ComputerGroup* computer_group; // The group of the computer.
+    };
+
+    ComputerIndex() = default;
+    ~ComputerIndex();
+
+    // Indexes the computers of |root_group| and its child groups.
+    void setRootGroup(proto::address_book::ComputerGroup* root_group);
+
+    // The index is built again before the next search. Called when the computers are moved
+    // between the groups.
+    void invalidate() { valid_ = false; }
+
+    void addComputer(proto::address_book::Computer* computer,
+                     proto::address_book::ComputerGroup* computer_group);
+    void removeComputer(const proto::address_book::Computer* computer);
+    void updateComputer(proto::address_book::Computer* computer);
+
+    // Returns the computers which contain all words of |query|.
+    std::vector<Result> find(const QString& query);
+
+private:
+    struct Entry
+    {
+        proto::address_book::Computer* computer;
+        proto::address_book::ComputerGroup* computer_group;
+        QString text; // The case folded fields of the computer.
+        bool removed;
+    };
+
+    void rebuild();
+    void addGroup(proto::address_book::ComputerGroup* computer_group);
+    void clear();
+
+    proto::address_book::ComputerGroup* root_group_ = nullptr;
+    bool valid_ = false;
+
+    std::vector<Entry> entries_;
+    size_t removed_count_ = 0;
+
+    // The entries of each trigram in the ascending order.
+    std::unordered_map<quint64, std::vector<quint32>> trigrams_;
+    std::unordered_map<const proto::address_book::Computer*, quint32> entry_ids_;
+
+    Q_DISABLE_COPY(ComputerIndex)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_CONSOLE__COMPUTER_INDEX_H
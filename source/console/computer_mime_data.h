@@ -10,10 +10,12 @@
 
 #include <QMimeData>
 
-#include "console/computer_item.h"
+#include "protocol/address_book.pb.h"
 
 namespace aspia {
 
+class ComputerGroupItem;
+
 class ComputerMimeData : public QMimeData
 {
 public:
@@ -25,19 +27,27 @@ public:
         return QStringLiteral("application/computer");
     }
 
-    void setComputerItem(ComputerItem* computer_item)
+    void setComputer(proto::address_book::Computer* computer, ComputerGroupItem* group_item)
     {
-        computer_item_ = computer_item;
+        computer_ = computer;
+        group_item_ = group_item;
         setData(mimeType(), QByteArray());
     }
 
-    ComputerItem* computerItem() const
+    proto::address_book::Computer* computer() const
+    {
+        return computer_;
+    }
+
+    // The group which contains the computer.
+    ComputerGroupItem* computerGroupItem() const
     {
-        return computer_item_;
+        return group_item_;
     }
 
 private:
-    ComputerItem* computer_item_ = nullptr;
+    proto::address_book::Computer* computer_ = nullptr;
+    ComputerGroupItem* group_item_ = nullptr;
 };
 
 } // namespace aspia
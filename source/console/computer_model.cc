@@ -0,0 +1,372 @@
+//
+// PROJECT:         Aspia
+// FILE:            console/computer_model.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "console/computer_model.h"
+
+#include <QCollator>
+
+#include <algorithm>
+
+#include "console/computer_group_item.h"
+
+namespace aspia {
+
+ComputerModel::ComputerModel(QObject* parent)
+    : QAbstractItemModel(parent),
+      computer_icon_(QStringLiteral(":/icon/computer.png"))
+{
+    // Nothing
+}
+
+void ComputerModel::setComputerGroup(ComputerGroupItem* group_item)
+{
+    beginResetModel();
+
+    group_item_ = group_item;
+    computers_.clear();
+
+    if (group_item_)
+    {
+        proto::address_book::ComputerGroup* computer_group = group_item_->computerGroup();
+
+        computers_.reserve(computer_group->computer_size());
+
+        for (int i = 0; i < computer_group->computer_size(); ++i)
+            computers_.push_back({ computer_group->mutable_computer(i), computer_group });
+
+        sortComputers();
+    }
+
+    endResetModel();
+}
+
+void ComputerModel::setSearchResults(const std::vector<ComputerIndex::Result>& results)
+{
+    beginResetModel();
+
+    group_item_ = nullptr;
+    computers_ = results;
+    sortComputers();
+
+    endResetModel();
+}
+
+proto::address_book::Computer* ComputerModel::computer(const QModelIndex& index) const
+{
+    if (!index.isValid() || index.row() >= static_cast<int>(computers_.size()))
+        return nullptr;
+
+    return computers_[index.row()].computer;
+}
+
+proto::address_book::ComputerGroup* ComputerModel::parentComputerGroup(
+    const QModelIndex& index) const
+{
+    if (!index.isValid() || index.row() >= static_cast<int>(computers_.size()))
+        return nullptr;
+
+    return computers_[index.row()].computer_group;
+}
+
+QModelIndex ComputerModel::indexOf(const proto::address_book::Computer* computer) const
+{
+    auto it = std::find_if(computers_.begin(), computers_.end(),
+                           [computer](const ComputerIndex::Result& result)
+    {
+        return result.computer == computer;
+    });
+
+    if (it == computers_.end())
+        return QModelIndex();
+
+    return createIndex(static_cast<int>(it - computers_.begin()), NameColumn);
+}
+
+QModelIndex ComputerModel::addComputer(proto::address_book::Computer* computer)
+{
+    // The new computer is added to the end until the list is sorted again.
+    const int row = static_cast<int>(computers_.size());
+
+    beginInsertRows(QModelIndex(), row, row);
+    computers_.push_back({ computer, group_item_->computerGroup() });
+    endInsertRows();
+
+    return createIndex(row, NameColumn);
+}
+
+void ComputerModel::removeComputer(const proto::address_book::Computer* computer)
+{
+    const QModelIndex index = indexOf(computer);
+    if (!index.isValid())
+        return;
+
+    beginRemoveRows(QModelIndex(), index.row(), index.row());
+    computers_.erase(computers_.begin() + index.row());
+    endRemoveRows();
+}
+
+void ComputerModel::updateComputer(const proto::address_book::Computer* computer)
+{
+    const QModelIndex index = indexOf(computer);
+    if (!index.isValid())
+        return;
+
+    emit dataChanged(index, this->index(index.row(), ColumnCount - 1));
+}
+
+QVector<ComputerProber::Host> ComputerModel::hosts() const
+{
+    QVector<ComputerProber::Host> hosts;
+    hosts.reserve(static_cast<int>(computers_.size()));
+
+    for (const auto& computer : computers_)
+    {
+        hosts.push_back(ComputerProber::Host{
+            QString::fromStdString(computer.computer->address()),
+            static_cast<quint16>(computer.computer->port()) });
+    }
+
+    return hosts;
+}
+
+void ComputerModel::setStatuses(const QVector<ComputerProber::Result>& results)
+{
+    for (const auto& result : results)
+    {
+        statuses_.insert(ComputerProber::hostKey(result.host.address, result.host.port),
+                         result.status);
+    }
+
+    if (computers_.empty())
+        return;
+
+    // One update of the column is cheaper than the search of the rows of each result.
+    emit dataChanged(index(0, StatusColumn),
+                     index(static_cast<int>(computers_.size()) - 1, StatusColumn));
+}
+
+void ComputerModel::retranslateUi()
+{
+    emit headerDataChanged(Qt::Horizontal, 0, ColumnCount - 1);
+
+    // The statuses are translated too.
+    if (!computers_.empty())
+    {
+        emit dataChanged(index(0, StatusColumn),
+                         index(static_cast<int>(computers_.size()) - 1, StatusColumn));
+    }
+}
+
+QModelIndex ComputerModel::index(int row, int column, const QModelIndex& parent) const
+{
+    if (parent.isValid() || row < 0 || row >= static_cast<int>(computers_.size()) ||
+        column < 0 || column >= ColumnCount)
+    {
+        return QModelIndex();
+    }
+
+    return createIndex(row, column);
+}
+
+QModelIndex ComputerModel::parent(const QModelIndex& /* child */) const
+{
+    // The list does not have the nested items.
+    return QModelIndex();
+}
+
+int ComputerModel::rowCount(const QModelIndex& parent) const
+{
+    if (parent.isValid())
+        return 0;
+
+    return static_cast<int>(computers_.size());
+}
+
+int ComputerModel::columnCount(const QModelIndex& /* parent */) const
+{
+    return ColumnCount;
+}
+
+QVariant ComputerModel::data(const QModelIndex& index, int role) const
+{
+    const proto::address_book::Computer* computer = this->computer(index);
+    if (!computer)
+        return QVariant();
+
+    if (role == Qt::DecorationRole)
+    {
+        if (index.column() == NameColumn)
+            return computer_icon_;
+
+        return QVariant();
+    }
+
+    if (role != Qt::DisplayRole)
+        return QVariant();
+
+    switch (index.column())
+    {
+        case NameColumn:
+            return QString::fromStdString(computer->name());
+
+        case AddressColumn:
+            return QString::fromStdString(computer->address());
+
+        case PortColumn:
+            return QString::number(computer->port());
+
+        case StatusColumn:
+            return statusText(computer);
+
+        default:
+            return QVariant();
+    }
+}
+
+QVariant ComputerModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (orientation != Qt::Horizontal || role != Qt::DisplayRole)
+        return QVariant();
+
+    switch (section)
+    {
+        case NameColumn:
+            return tr("Computer Name");
+
+        case AddressColumn:
+            return tr("Address");
+
+        case PortColumn:
+            return tr("Port");
+
+        case StatusColumn:
+            return tr("Status");
+
+        default:
+            return QVariant();
+    }
+}
+
+Qt::ItemFlags ComputerModel::flags(const QModelIndex& index) const
+{
+    if (!index.isValid())
+        return Qt::NoItemFlags;
+
+    return Qt::ItemIsEnabled | Qt::ItemIsSelectable | Qt::ItemIsDragEnabled;
+}
+
+void ComputerModel::sort(int column, Qt::SortOrder order)
+{
+    sort_column_ = column;
+    sort_order_ = order;
+
+    emit layoutAboutToBeChanged();
+
+    const QModelIndexList old_indexes = persistentIndexList();
+
+    std::vector<proto::address_book::Computer*> old_computers;
+    for (const auto& index : old_indexes)
+        old_computers.push_back(computer(index));
+
+    sortComputers();
+
+    QModelIndexList new_indexes;
+    for (int i = 0; i < old_indexes.size(); ++i)
+    {
+        const QModelIndex index = indexOf(old_computers[i]);
+        new_indexes.push_back(index.isValid() ?
+            createIndex(index.row(), old_indexes[i].column()) : QModelIndex());
+    }
+
+    changePersistentIndexList(old_indexes, new_indexes);
+
+    emit layoutChanged();
+}
+
+void ComputerModel::sortComputers()
+{
+    if (sort_column_ < 0 || sort_column_ >= ColumnCount)
+        return;
+
+    // The keys are converted once instead of each comparison.
+    struct SortItem
+    {
+        QString key;
+        quint32 port;
+        ComputerIndex::Result computer;
+    };
+
+    std::vector<SortItem> items;
+    items.reserve(computers_.size());
+
+    for (const auto& computer : computers_)
+    {
+        QString key;
+
+        if (sort_column_ == NameColumn)
+            key = QString::fromStdString(computer.computer->name());
+        else if (sort_column_ == AddressColumn)
+            key = QString::fromStdString(computer.computer->address());
+        else if (sort_column_ == StatusColumn)
+            key = statusText(computer.computer);
+
+        items.push_back(SortItem{ std::move(key), computer.computer->port(), computer });
+    }
+
+    QCollator collator;
+    collator.setCaseSensitivity(Qt::CaseInsensitive);
+    collator.setNumericMode(true);
+
+    auto less = [&](const SortItem& first, const SortItem& second)
+    {
+        if (sort_column_ == PortColumn)
+            return first.port < second.port;
+
+        return collator.compare(first.key, second.key) < 0;
+    };
+
+    if (sort_order_ == Qt::AscendingOrder)
+    {
+        std::stable_sort(items.begin(), items.end(), less);
+    }
+    else
+    {
+        std::stable_sort(items.begin(), items.end(),
+                         [&](const SortItem& first, const SortItem& second)
+        {
+            return less(second, first);
+        });
+    }
+
+    for (size_t i = 0; i < items.size(); ++i)
+        computers_[i] = items[i].computer;
+}
+
+ComputerProber::Status ComputerModel::status(const proto::address_book::Computer* computer) const
+{
+    return statuses_.value(
+        ComputerProber::hostKey(QString::fromStdString(computer->address()),
+                                static_cast<quint16>(computer->port())),
+        ComputerProber::Status::UNKNOWN);
+}
+
+QString ComputerModel::statusText(const proto::address_book::Computer* computer) const
+{
+    switch (status(computer))
+    {
+        case ComputerProber::Status::ONLINE:
+            return tr("Online");
+
+        case ComputerProber::Status::OFFLINE:
+            return tr("Offline");
+
+        default:
+            return QString();
+    }
+}
+
+} // namespace aspia
@@ -0,0 +1,111 @@
+//
+// PROJECT:         Aspia
+// FILE:            console/computer_model.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CONSOLE__COMPUTER_MODEL_H
+#define _ASPIA_CONSOLE__COMPUTER_MODEL_H
+
+#include <QAbstractItemModel>
+#include <QHash>
+#include <QIcon>
+
+#include <vector>
+
+#include "console/computer_index.h"
+#include "console/computer_prober.h"
+#include "protocol/address_book.pb.h"
+
+namespace aspia {
+
+class ComputerGroupItem;
+
+//
+// The list of the computers of one group or of the search results. The model refers to the
+// computers of the address book and does not create the items for them, so the view requests
+// only the rows which are visible and the group with many computers is opened immediately.
+//
+class ComputerModel : public QAbstractItemModel
+{
+    Q_OBJECT
+
+public:
+    enum Column
+    {
+        NameColumn,
+        AddressColumn,
+        PortColumn,
+        StatusColumn,
+        ColumnCount
+    };
+
+    explicit ComputerModel(QObject* parent = nullptr);
+    ~ComputerModel() = default;
+
+    // Shows the computers of |group_item|. If |group_item| is nullptr, the list is cleared.
+    void setComputerGroup(ComputerGroupItem* group_item);
+
+    // Shows the found computers of any groups.
+    void setSearchResults(const std::vector<ComputerIndex::Result>& results);
+
+    // Returns nullptr if the search results are shown.
+    ComputerGroupItem* computerGroup() const { return group_item_; }
+
+    proto::address_book::Computer* computer(const QModelIndex& index) const;
+
+    // Returns the group which contains the computer of |index|.
+    proto::address_book::ComputerGroup* parentComputerGroup(const QModelIndex& index) const;
+    QModelIndex indexOf(const proto::address_book::Computer* computer) const;
+
+    // Must be called after the computer is added to or before it is removed from the group.
+    QModelIndex addComputer(proto::address_book::Computer* computer);
+    void removeComputer(const proto::address_book::Computer* computer);
+
+    // Must be called after the computer is modified.
+    void updateComputer(const proto::address_book::Computer* computer);
+
+    // Returns the hosts of the shown computers.
+    QVector<ComputerProber::Host> hosts() const;
+
+    // Updates the status column of the computers of |results|.
+    void setStatuses(const QVector<ComputerProber::Result>& results);
+
+    void retranslateUi();
+
+    // QAbstractItemModel implementation.
+    QModelIndex index(int row, int column,
+                      const QModelIndex& parent = QModelIndex()) const override;
+    QModelIndex parent(const QModelIndex& child) const override;
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation,
+                        int role = Qt::DisplayRole) const override;
+    Qt::ItemFlags flags(const QModelIndex& index) const override;
+    void sort(int column, Qt::SortOrder order = Qt::AscendingOrder) override;
+
+private:
+    void sortComputers();
+    ComputerProber::Status status(const proto::address_book::Computer* computer) const;
+    QString statusText(const proto::address_book::Computer* computer) const;
+
+    ComputerGroupItem* group_item_ = nullptr;
+    std::vector<ComputerIndex::Result> computers_;
+
+    // The statuses of the hosts of all computers which were shown.
+    QHash<QString, ComputerProber::Status> statuses_;
+
+    // The sorting is applied again when the group is changed.
+    int sort_column_ = -1;
+    Qt::SortOrder sort_order_ = Qt::AscendingOrder;
+
+    const QIcon computer_icon_;
+
+    Q_DISABLE_COPY(ComputerModel)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_CONSOLE__COMPUTER_MODEL_H
@@ -0,0 +1,229 @@
+//
+// PROJECT:         Aspia
+// FILE:            console/computer_prober.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "console/computer_prober.h"
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QSet>
+#include <QTcpSocket>
+#include <QThread>
+#include <QTimer>
+
+#include <deque>
+
+namespace aspia {
+
+namespace {
+
+// Number of the connections which are established at the same time.
+constexpr int kMaxConnections = 512;
+
+// The host which does not accept the connection in this time is offline.
+constexpr int kConnectTimeout = 2000; // 2 seconds
+
+// The result is used again during this time.
+constexpr qint64 kCacheTime = 30000; // 30 seconds
+
+// The results are collected during this time before they are reported.
+constexpr int kReportInterval = 200;
+
+} // namespace
+
+// The worker lives in the thread of the prober. Its methods are called only in that thread.
+class ComputerProber::Worker : public QObject
+{
+public:
+    explicit Worker(ComputerProber* prober)
+        : prober_(prober),
+          report_timer_(new QTimer(this))
+    {
+        report_timer_->setSingleShot(true);
+        report_timer_->setInterval(kReportInterval);
+
+        connect(report_timer_, &QTimer::timeout, this, &Worker::report);
+
+        clock_.start();
+    }
+
+    ~Worker() = default;
+
+    void probe(const QVector<Host>& hosts)
+    {
+        const qint64 now = clock_.elapsed();
+
+        for (const auto& host : hosts)
+        {
+            const QString key = hostKey(host.address, host.port);
+
+            auto cached = cache_.constFind(key);
+            if (cached != cache_.constEnd() && now - cached->time < kCacheTime)
+            {
+                addResult(host, cached->status);
+                continue;
+            }
+
+            if (pending_.contains(key))
+                continue;
+
+            pending_.insert(key);
+            queue_.push_back(host);
+        }
+
+        startNext();
+    }
+
+    void clearCache()
+    {
+        cache_.clear();
+    }
+
+private:
+    struct CacheEntry
+    {
+        Status status;
+        qint64 time;
+    };
+
+    void startNext()
+    {
+        while (active_count_ < kMaxConnections && !queue_.empty())
+        {
+            const Host host = queue_.front();
+            queue_.pop_front();
+
+            QTcpSocket* socket = new QTcpSocket(this);
+            QTimer* timer = new QTimer(socket);
+
+            auto finish = [this, socket, timer, host](Status status)
+            {
+                // The socket reports only the first of the results.
+                socket->disconnect(this);
+                timer->stop();
+
+                socket->abort();
+                socket->deleteLater();
+
+                --active_count_;
+
+                const QString key = hostKey(host.address, host.port);
+
+                pending_.remove(key);
+                cache_.insert(key, CacheEntry{ status, clock_.elapsed() });
+
+                addResult(host, status);
+                startNext();
+            };
+
+            connect(socket, &QTcpSocket::connected, this, [finish]()
+            {
+                finish(Status::ONLINE);
+            });
+
+            connect(socket, QOverload<QAbstractSocket::SocketError>::of(&QTcpSocket::error),
+                    this, [finish](QAbstractSocket::SocketError /* error */)
+            {
+                finish(Status::OFFLINE);
+            });
+
+            timer->setSingleShot(true);
+
+            connect(timer, &QTimer::timeout, this, [finish]()
+            {
+                finish(Status::OFFLINE);
+            });
+
+            ++active_count_;
+
+            timer->start(kConnectTimeout);
+            socket->connectToHost(host.address, host.port);
+        }
+    }
+
+    void addResult(const Host& host, Status status)
+    {
+        results_.push_back(Result{ host, status });
+
+        if (!report_timer_->isActive())
+            report_timer_->start();
+    }
+
+    void report()
+    {
+        if (results_.isEmpty())
+            return;
+
+        // The signal is delivered to the thread of the receiver.
+        emit prober_->probed(results_);
+        results_.clear();
+    }
+
+    ComputerProber* prober_;
+    QTimer* report_timer_;
+    QElapsedTimer clock_;
+
+    std::deque<Host> queue_;
+    QSet<QString> pending_; // The hosts which are queued or connected to.
+    int active_count_ = 0;
+
+    QHash<QString, CacheEntry> cache_;
+    QVector<Result> results_;
+
+    Q_DISABLE_COPY(Worker)
+};
+
+ComputerProber::ComputerProber(QObject* parent)
+    : QObject(parent),
+      thread_(std::make_unique<QThread>())
+{
+    qRegisterMetaType<QVector<ComputerProber::Result>>();
+
+    worker_ = new Worker(this);
+    worker_->moveToThread(thread_.get());
+
+    // The worker and its sockets are deleted in their thread.
+    connect(thread_.get(), &QThread::finished, worker_, &QObject::deleteLater);
+
+    thread_->start();
+}
+
+ComputerProber::~ComputerProber()
+{
+    thread_->quit();
+    thread_->wait();
+}
+
+void ComputerProber::probe(const QVector<Host>& hosts)
+{
+    if (hosts.isEmpty())
+        return;
+
+    Worker* worker = worker_;
+
+    QTimer::singleShot(0, worker_, [worker, hosts]()
+    {
+        worker->probe(hosts);
+    });
+}
+
+void ComputerProber::clearCache()
+{
+    Worker* worker = worker_;
+
+    QTimer::singleShot(0, worker_, [worker]()
+    {
+        worker->clearCache();
+    });
+}
+
+// static
+QString ComputerProber::hostKey(const QString& address, quint16 port)
+{
+    return address.toLower() + QLatin1Char(':') + QString::number(port);
+}
+
+} // namespace aspia
@@ -0,0 +1,75 @@
+//
+// PROJECT:         Aspia
+// FILE:            console/computer_prober.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CONSOLE__COMPUTER_PROBER_H
+#define _ASPIA_CONSOLE__COMPUTER_PROBER_H
+
+#include <QObject>
+#include <QString>
+#include <QVector>
+
+#include <memory>
+
+class QThread;
+
+namespace aspia {
+
+//
+// Checks whether the computers accept the connections on their ports. The connections are made
+// in a separate thread, many at a time, and are closed as soon as they are established, so even
+// the large address books are checked within seconds. The results are cached for a while, so
+// the computers which are shown again are not connected to again.
+//
+class ComputerProber : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum class Status { UNKNOWN, ONLINE, OFFLINE };
+
+    struct Host
+    {
+        QString address;
+        quint16 port;
+    };
+
+    struct Result
+    {
+        Host host;
+        Status status;
+    };
+
+    explicit ComputerProber(QObject* parent = nullptr);
+    ~ComputerProber();
+
+    // Checks |hosts|. The cached results are reported without the connection. The hosts which
+    // are already being checked are not checked twice.
+    void probe(const QVector<Host>& hosts);
+
+    // Removes the cached results, so the hosts are connected to again.
+    void clearCache();
+
+    static QString hostKey(const QString& address, quint16 port);
+
+signals:
+    // The results are reported in batches to avoid the updating of the view for each host.
+    void probed(const QVector<ComputerProber::Result>& results);
+
+private:
+    class Worker;
+
+    std::unique_ptr<QThread> thread_;
+    Worker* worker_;
+
+    Q_DISABLE_COPY(ComputerProber)
+};
+
+} // namespace aspia
+
+Q_DECLARE_METATYPE(aspia::ComputerProber::Result);
+
+#endif // _ASPIA_CONSOLE__COMPUTER_PROBER_H
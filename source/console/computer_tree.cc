@@ -11,12 +11,12 @@
 #include <QMouseEvent>
 
 #include "console/computer_drag.h"
-#include "console/computer_item.h"
+#include "console/computer_model.h"
 
 namespace aspia {
 
 ComputerTree::ComputerTree(QWidget* parent)
-    : QTreeWidget(parent)
+    : QTreeView(parent)
 {
     // Nothing
 }
@@ -26,7 +26,7 @@ void ComputerTree::mousePressEvent(QMouseEvent* event)
     if (event->button() == Qt::LeftButton)
         start_pos_ = event->pos();
 
-    QTreeWidget::mousePressEvent(event);
+    QTreeView::mousePressEvent(event);
 }
 
 void ComputerTree::mouseMoveEvent(QMouseEvent* event)
@@ -42,7 +42,7 @@ void ComputerTree::mouseMoveEvent(QMouseEvent* event)
         }
     }
 
-    QTreeWidget::mouseMoveEvent(event);
+    QTreeView::mouseMoveEvent(event);
 }
 
 void ComputerTree::dragEnterEvent(QDragEnterEvent* /* event */)
@@ -63,14 +63,21 @@ void ComputerTree::dropEvent(QDropEvent* /* event */)
 
 void ComputerTree::startDrag(Qt::DropActions supported_actions)
 {
-    ComputerItem* computer_item = reinterpret_cast<ComputerItem*>(itemAt(start_pos_));
-    if (computer_item)
+    ComputerModel* computer_model = dynamic_cast<ComputerModel*>(model());
+    if (!computer_model)
+        return;
+
+    const QModelIndex index = indexAt(start_pos_);
+
+    // The found computers of different groups can not be moved.
+    proto::address_book::Computer* computer = computer_model->computer(index);
+    if (computer && computer_model->computerGroup())
     {
         ComputerDrag* drag = new ComputerDrag(this);
 
-        drag->setComputerItem(computer_item);
+        drag->setComputer(computer, computer_model->computerGroup());
 
-        QIcon icon = computer_item->icon(0);
+        QIcon icon(QStringLiteral(":/icon/computer.png"));
         drag->setPixmap(icon.pixmap(icon.actualSize(QSize(16, 16))));
 
         drag->exec(supported_actions);
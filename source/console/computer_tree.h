@@ -8,11 +8,11 @@
 #ifndef _ASPIA_CONSOLE__COMPUTER_TREE_H
 #define _ASPIA_CONSOLE__COMPUTER_TREE_H
 
-#include <QTreeWidget>
+#include <QTreeView>
 
 namespace aspia {
 
-class ComputerTree : public QTreeWidget
+class ComputerTree : public QTreeView
 {
     Q_OBJECT
 
@@ -21,7 +21,7 @@ public:
     ~ComputerTree() = default;
 
 protected:
-    // QTreeWidget implementation.
+    // QTreeView implementation.
     void mousePressEvent(QMouseEvent* event) override;
     void mouseMoveEvent(QMouseEvent* event) override;
     void dragEnterEvent(QDragEnterEvent* event) override;
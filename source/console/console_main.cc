@@ -11,6 +11,8 @@
 #include <QFileInfo>
 
 #include "base/file_logger.h"
+#include "base/trace_logger.h"
+#include "console/console_settings.h"
 #include "console/console_window.h"
 #include "version.h"
 
@@ -28,6 +30,10 @@ int consoleMain(int argc, char *argv[])
     application.setApplicationVersion(QStringLiteral(ASPIA_VERSION_STRING));
     application.setAttribute(Qt::AA_DisableWindowContextHelpButton, true);
 
+    TraceLogger tracer;
+    if (ConsoleSettings().isTracingEnabled())
+        tracer.startTracing(QFileInfo(argv[0]).fileName());
+
     QCommandLineParser parser;
     parser.setApplicationDescription(QStringLiteral("Aspia Console"));
     parser.addHelpOption();
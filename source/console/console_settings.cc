@@ -95,4 +95,19 @@ void ConsoleSettings::setSessionType(proto::auth::SessionType session_type)
     settings_.setValue(QStringLiteral("SessionType"), session_type);
 }
 
+QStringList ConsoleSettings::openedAddressBooks() const
+{
+    return settings_.value(QStringLiteral("OpenedAddressBooks")).toStringList();
+}
+
+void ConsoleSettings::setOpenedAddressBooks(const QStringList& file_list)
+{
+    settings_.setValue(QStringLiteral("OpenedAddressBooks"), file_list);
+}
+
+bool ConsoleSettings::isTracingEnabled() const
+{
+    return settings_.value(QStringLiteral("TracingEnabled"), false).toBool();
+}
+
 } // namespace aspia
@@ -9,6 +9,7 @@
 #define _ASPIA_CONSOLE__CONSOLE_SETTINGS_H
 
 #include <QSettings>
+#include <QStringList>
 
 #include "protocol/authorization.pb.h"
 
@@ -42,6 +43,14 @@ public:
     proto::auth::SessionType sessionType();
     void setSessionType(proto::auth::SessionType session_type);
 
+    // The files of the address books which were open when the console was closed.
+    QStringList openedAddressBooks() const;
+    void setOpenedAddressBooks(const QStringList& file_list);
+
+    // If enabled, then the client sessions write the spans of the desktop pipeline into the
+    // trace file in the logging directory.
+    bool isTracingEnabled() const;
+
 private:
     QSettings settings_;
 
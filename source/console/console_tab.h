@@ -17,7 +17,7 @@ class ConsoleTab : public QWidget
     Q_OBJECT
 
 public:
-    enum Type { AddressBook };
+    enum Type { AddressBook, PendingAddressBook };
 
     ConsoleTab(Type type, QWidget* parent);
     virtual ~ConsoleTab() = default;
@@ -10,15 +10,21 @@
 #include <QDateTime>
 #include <QDesktopServices>
 #include <QFileDialog>
+#include <QFileInfo>
+#include <QInputDialog>
 #include <QMessageBox>
+#include <QTimer>
 #include <QTranslator>
 
 #include "client/ui/client_dialog.h"
+#include "client/ui/desktop_wall_window.h"
+#include "client/ui/file_multi_upload_window.h"
 #include "client/client.h"
 #include "client/computer_factory.h"
 #include "console/about_dialog.h"
 #include "console/address_book_tab.h"
 #include "console/console_settings.h"
+#include "console/pending_address_book_tab.h"
 
 namespace aspia {
 
@@ -43,6 +49,38 @@ private:
     Q_DISABLE_COPY(LanguageAction)
 };
 
+void addGroupComputers(const proto::address_book::ComputerGroup& group,
+                       proto::auth::SessionType session_type,
+                       QVector<ConnectData>* computers)
+{
+    for (const auto& computer : group.computer())
+    {
+        ConnectData connect_data;
+
+        connect_data.setComputerName(QString::fromStdString(computer.name()));
+        connect_data.setAddress(QString::fromStdString(computer.address()));
+        connect_data.setAlternateAddresses(ComputerFactory::alternateAddresses(computer));
+        connect_data.setPort(computer.port());
+        connect_data.setUserName(QString::fromStdString(computer.username()));
+        connect_data.setPassword(QString::fromStdString(computer.password()));
+        connect_data.setSessionType(session_type);
+
+        // Used when the full session is opened from the monitoring wall.
+        if (session_type == proto::auth::SESSION_TYPE_DESKTOP_VIEW)
+        {
+            if (computer.session_config().has_desktop_view())
+                connect_data.setDesktopConfig(computer.session_config().desktop_view());
+            else
+                connect_data.setDesktopConfig(ComputerFactory::defaultDesktopViewConfig());
+        }
+
+        computers->push_back(std::move(connect_data));
+    }
+
+    for (const auto& child_group : group.computer_group())
+        addGroupComputers(child_group, session_type, computers);
+}
+
 } // namespace
 
 ConsoleWindow::ConsoleWindow(const QString& file_path, QWidget* parent)
@@ -112,6 +150,12 @@ ConsoleWindow::ConsoleWindow(const QString& file_path, QWidget* parent)
     connect(ui.action_system_info_connect, &QAction::triggered,
             this, &ConsoleWindow::onSystemInfoConnect);
 
+    connect(ui.action_monitoring_wall, &QAction::triggered,
+            this, &ConsoleWindow::onMonitoringWall);
+
+    connect(ui.action_upload_file_to_group, &QAction::triggered,
+            this, &ConsoleWindow::onUploadFileToGroup);
+
     connect(ui.action_toolbar, &QAction::toggled, ui.tool_bar, &QToolBar::setVisible);
     connect(ui.action_statusbar, &QAction::toggled, ui.status_bar, &QStatusBar::setVisible);
 
@@ -149,8 +193,21 @@ ConsoleWindow::ConsoleWindow(const QString& file_path, QWidget* parent)
             break;
     }
 
+    // The address books of the previous run are read when their tabs are selected.
+    for (const auto& opened_file_path : settings.openedAddressBooks())
+    {
+        if (findAddressBookTab(opened_file_path) == -1)
+            addPendingTab(opened_file_path);
+    }
+
     if (!file_path.isEmpty())
-        addAddressBookTab(AddressBookTab::openFromFile(file_path, ui.tab_widget));
+    {
+        int index = findAddressBookTab(file_path);
+        if (index != -1)
+            ui.tab_widget->setCurrentIndex(index);
+        else
+            addAddressBookTab(AddressBookTab::openFromFile(file_path, ui.tab_widget));
+    }
 }
 
 void ConsoleWindow::onNewAddressBook()
@@ -172,26 +229,16 @@ void ConsoleWindow::onOpenAddressBook()
 
     settings.setLastDirectory(QFileInfo(file_path).absolutePath());
 
-    for (int i = 0; i < ui.tab_widget->count(); ++i)
+    int index = findAddressBookTab(file_path);
+    if (index != -1)
     {
-        AddressBookTab* tab = dynamic_cast<AddressBookTab*>(ui.tab_widget->widget(i));
-        if (tab)
-        {
-#if defined(Q_OS_WIN)
-            if (file_path.compare(tab->addressBookPath(), Qt::CaseInsensitive) == 0)
-#else
-            if (file_path.compare(tab->addressBookPath(), Qt::CaseSensitive) == 0)
-#endif // defined(Q_OS_WIN)
-            {
-                QMessageBox::information(this,
-                                         tr("Information"),
-                                         tr("Address Book \"%1\" is already open.").arg(file_path),
-                                         QMessageBox::Ok);
+        QMessageBox::information(this,
+                                 tr("Information"),
+                                 tr("Address Book \"%1\" is already open.").arg(file_path),
+                                 QMessageBox::Ok);
 
-                ui.tab_widget->setCurrentIndex(i);
-                return;
-            }
-        }
+        ui.tab_widget->setCurrentIndex(index);
+        return;
     }
 
     addAddressBookTab(AddressBookTab::openFromFile(file_path, ui.tab_widget));
@@ -296,7 +343,7 @@ void ConsoleWindow::onDesktopManageConnect()
             computer->set_connect_time(QDateTime::currentSecsSinceEpoch());
             computer->set_session_type(proto::auth::SESSION_TYPE_DESKTOP_MANAGE);
 
-            connectToComputer(*computer);
+            connectToComputer(*computer, tab);
         }
     }
 }
@@ -312,7 +359,7 @@ void ConsoleWindow::onDesktopViewConnect()
             computer->set_connect_time(QDateTime::currentSecsSinceEpoch());
             computer->set_session_type(proto::auth::SESSION_TYPE_DESKTOP_VIEW);
 
-            connectToComputer(*computer);
+            connectToComputer(*computer, tab);
         }
     }
 }
@@ -328,7 +375,7 @@ void ConsoleWindow::onFileTransferConnect()
             computer->set_connect_time(QDateTime::currentSecsSinceEpoch());
             computer->set_session_type(proto::auth::SESSION_TYPE_FILE_TRANSFER);
 
-            connectToComputer(*computer);
+            connectToComputer(*computer, tab);
         }
     }
 }
@@ -344,11 +391,103 @@ void ConsoleWindow::onSystemInfoConnect()
             computer->set_connect_time(QDateTime::currentSecsSinceEpoch());
             computer->set_session_type(proto::auth::SESSION_TYPE_SYSTEM_INFO);
 
-            connectToComputer(*computer);
+            connectToComputer(*computer, tab);
         }
     }
 }
 
+void ConsoleWindow::onMonitoringWall()
+{
+    AddressBookTab* tab = currentAddressBookTab();
+    if (!tab)
+        return;
+
+    proto::address_book::ComputerGroup* computer_group = tab->currentComputerGroup();
+    if (!computer_group)
+        return;
+
+    QVector<ConnectData> computers;
+    addGroupComputers(*computer_group, proto::auth::SESSION_TYPE_DESKTOP_VIEW, &computers);
+
+    if (computers.isEmpty())
+    {
+        QMessageBox::information(this,
+                                 tr("Monitoring Wall"),
+                                 tr("There are no computers in the group."),
+                                 QMessageBox::Ok);
+        return;
+    }
+
+    QString title = QString::fromStdString(computer_group->name());
+    if (title.isEmpty())
+        title = tab->addressBookName();
+
+    DesktopWallWindow* window = new DesktopWallWindow(title, computers);
+    window->setAttribute(Qt::WA_DeleteOnClose);
+
+    connect(window, &DesktopWallWindow::computerDoubleClicked,
+            this, [this](const ConnectData& connect_data)
+    {
+        Client* client = new Client(connect_data, this);
+        connect(client, &Client::clientTerminated, this, &ConsoleWindow::onClientTerminated);
+        client_list_.push_back(client);
+    });
+
+    window->show();
+    window->activateWindow();
+}
+
+void ConsoleWindow::onUploadFileToGroup()
+{
+    AddressBookTab* tab = currentAddressBookTab();
+    if (!tab)
+        return;
+
+    proto::address_book::ComputerGroup* computer_group = tab->currentComputerGroup();
+    if (!computer_group)
+        return;
+
+    QVector<ConnectData> computers;
+    addGroupComputers(*computer_group, proto::auth::SESSION_TYPE_FILE_TRANSFER, &computers);
+
+    if (computers.isEmpty())
+    {
+        QMessageBox::information(this,
+                                 tr("Upload File"),
+                                 tr("There are no computers in the group."),
+                                 QMessageBox::Ok);
+        return;
+    }
+
+    const QString source_path = QFileDialog::getOpenFileName(this, tr("Upload File"));
+    if (source_path.isEmpty())
+        return;
+
+    const QString target_directory = QInputDialog::getText(
+        this, tr("Upload File"), tr("Folder on the computers:"));
+    if (target_directory.isEmpty())
+        return;
+
+    const int ret = QMessageBox::question(this,
+                                          tr("Upload File"),
+                                          tr("Replace the existing files?"),
+                                          QMessageBox::Yes | QMessageBox::No |
+                                              QMessageBox::Cancel);
+    if (ret == QMessageBox::Cancel)
+        return;
+
+    QString target_path = target_directory;
+    if (!target_path.endsWith(QLatin1Char('/')) && !target_path.endsWith(QLatin1Char('\\')))
+        target_path += QLatin1Char('/');
+    target_path += QFileInfo(source_path).fileName();
+
+    FileMultiUploadWindow* window = new FileMultiUploadWindow(
+        source_path, target_path, ret == QMessageBox::Yes, computers);
+    window->setAttribute(Qt::WA_DeleteOnClose);
+    window->show();
+    window->activateWindow();
+}
+
 void ConsoleWindow::onCurrentTabChanged(int index)
 {
     if (index == -1)
@@ -361,7 +500,17 @@ void ConsoleWindow::onCurrentTabChanged(int index)
 
     AddressBookTab* tab = dynamic_cast<AddressBookTab*>(ui.tab_widget->widget(index));
     if (!tab)
+    {
+        ui.action_save->setEnabled(false);
+        ui.action_add_computer_group->setEnabled(false);
+        ui.action_add_computer->setEnabled(false);
+        ui.status_bar->clear();
+
+        // The tab is replaced after the change of the current tab is handled.
+        if (dynamic_cast<PendingAddressBookTab*>(ui.tab_widget->widget(index)))
+            QTimer::singleShot(0, this, &ConsoleWindow::openPendingTab);
         return;
+    }
 
     ui.action_save->setEnabled(tab->isChanged());
 
@@ -377,11 +526,12 @@ void ConsoleWindow::onCloseTab(int index)
     if (index == -1)
         return;
 
-    AddressBookTab* tab = dynamic_cast<AddressBookTab*>(ui.tab_widget->widget(index));
-    if (!tab)
+    QWidget* widget = ui.tab_widget->widget(index);
+    if (!dynamic_cast<ConsoleTab*>(widget))
         return;
 
-    if (tab->isChanged())
+    AddressBookTab* tab = dynamic_cast<AddressBookTab*>(widget);
+    if (tab && tab->isChanged())
     {
         int ret = QMessageBox(QMessageBox::Question,
                               tr("Confirmation"),
@@ -404,7 +554,7 @@ void ConsoleWindow::onCloseTab(int index)
     }
 
     ui.tab_widget->removeTab(index);
-    delete tab;
+    delete widget;
 
     if (!ui.tab_widget->count())
     {
@@ -492,15 +642,19 @@ void ConsoleWindow::onComputerGroupContextMenu(const QPoint& point, bool is_root
     menu.addSeparator();
     menu.addAction(ui.action_add_computer_group);
     menu.addAction(ui.action_add_computer);
+    menu.addSeparator();
+    menu.addAction(ui.action_monitoring_wall);
+    menu.addAction(ui.action_upload_file_to_group);
 
     menu.exec(point);
 }
 
-void ConsoleWindow::onComputerContextMenu(ComputerItem* computer_item, const QPoint& point)
+void ConsoleWindow::onComputerContextMenu(proto::address_book::Computer* computer,
+                                          const QPoint& point)
 {
     QMenu menu;
 
-    if (computer_item)
+    if (computer)
     {
         menu.addAction(ui.action_desktop_manage_connect);
         menu.addAction(ui.action_desktop_view_connect);
@@ -539,7 +693,7 @@ void ConsoleWindow::onComputerDoubleClicked(proto::address_book::Computer* compu
         return;
     }
 
-    connectToComputer(*computer);
+    connectToComputer(*computer, currentAddressBookTab());
 }
 
 void ConsoleWindow::onLanguageChanged(QAction* action)
@@ -557,6 +711,11 @@ void ConsoleWindow::onLanguageChanged(QAction* action)
             AddressBookTab* tab = dynamic_cast<AddressBookTab*>(ui.tab_widget->widget(i));
             if (tab)
                 tab->retranslateUi();
+
+            PendingAddressBookTab* pending_tab =
+                dynamic_cast<PendingAddressBookTab*>(ui.tab_widget->widget(i));
+            if (pending_tab)
+                pending_tab->retranslateUi();
         }
 
         ConsoleSettings().setLocale(new_locale);
@@ -591,7 +750,22 @@ void ConsoleWindow::closeEvent(QCloseEvent* event)
         }
     }
 
+    QStringList opened_address_books;
+
+    for (int i = 0; i < ui.tab_widget->count(); ++i)
+    {
+        AddressBookTab* tab = dynamic_cast<AddressBookTab*>(ui.tab_widget->widget(i));
+        if (tab && !tab->addressBookPath().isEmpty())
+            opened_address_books.append(tab->addressBookPath());
+
+        PendingAddressBookTab* pending_tab =
+            dynamic_cast<PendingAddressBookTab*>(ui.tab_widget->widget(i));
+        if (pending_tab)
+            opened_address_books.append(pending_tab->addressBookPath());
+    }
+
     ConsoleSettings settings;
+    settings.setOpenedAddressBooks(opened_address_books);
     settings.setToolBarEnabled(ui.action_toolbar->isChecked());
     settings.setStatusBarEnabled(ui.action_statusbar->isChecked());
     settings.setWindowGeometry(saveGeometry());
@@ -628,7 +802,7 @@ void ConsoleWindow::createLanguageMenu(const QString& current_locale)
     }
 }
 
-void ConsoleWindow::addAddressBookTab(AddressBookTab* new_tab)
+void ConsoleWindow::addAddressBookTab(AddressBookTab* new_tab, int index)
 {
     if (!new_tab)
         return;
@@ -646,9 +820,10 @@ void ConsoleWindow::addAddressBookTab(AddressBookTab* new_tab)
     connect(new_tab, &AddressBookTab::computerDoubleClicked,
             this, &ConsoleWindow::onComputerDoubleClicked);
 
-    int index = ui.tab_widget->addTab(new_tab,
-                                      QIcon(QStringLiteral(":/icon/address-book.png")),
-                                      new_tab->addressBookName());
+    index = ui.tab_widget->insertTab(index,
+                                     new_tab,
+                                     QIcon(QStringLiteral(":/icon/address-book.png")),
+                                     new_tab->addressBookName());
 
     ui.action_address_book_properties->setEnabled(true);
     ui.action_save_as->setEnabled(true);
@@ -657,6 +832,51 @@ void ConsoleWindow::addAddressBookTab(AddressBookTab* new_tab)
     ui.tab_widget->setCurrentIndex(index);
 }
 
+void ConsoleWindow::addPendingTab(const QString& file_path)
+{
+    PendingAddressBookTab* new_tab = new PendingAddressBookTab(file_path, ui.tab_widget);
+
+    connect(new_tab, &PendingAddressBookTab::openRequested,
+            this, &ConsoleWindow::openPendingTab);
+
+    ui.tab_widget->addTab(new_tab,
+                          QIcon(QStringLiteral(":/icon/address-book.png")),
+                          new_tab->addressBookName());
+
+    ui.action_close->setEnabled(true);
+}
+
+int ConsoleWindow::findAddressBookTab(const QString& file_path) const
+{
+    for (int i = 0; i < ui.tab_widget->count(); ++i)
+    {
+        QString tab_path;
+
+        AddressBookTab* tab = dynamic_cast<AddressBookTab*>(ui.tab_widget->widget(i));
+        if (tab)
+            tab_path = tab->addressBookPath();
+
+        PendingAddressBookTab* pending_tab =
+            dynamic_cast<PendingAddressBookTab*>(ui.tab_widget->widget(i));
+        if (pending_tab)
+            tab_path = pending_tab->addressBookPath();
+
+        if (tab_path.isEmpty())
+            continue;
+
+#if defined(Q_OS_WIN)
+        if (file_path.compare(tab_path, Qt::CaseInsensitive) == 0)
+#else
+        if (file_path.compare(tab_path, Qt::CaseSensitive) == 0)
+#endif // defined(Q_OS_WIN)
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
 AddressBookTab* ConsoleWindow::currentAddressBookTab()
 {
     int current_tab = ui.tab_widget->currentIndex();
@@ -666,12 +886,14 @@ AddressBookTab* ConsoleWindow::currentAddressBookTab()
     return dynamic_cast<AddressBookTab*>(ui.tab_widget->widget(current_tab));
 }
 
-void ConsoleWindow::connectToComputer(const proto::address_book::Computer& computer)
+void ConsoleWindow::connectToComputer(const proto::address_book::Computer& computer,
+                                      AddressBookTab* tab)
 {
     ConnectData connect_data;
 
     connect_data.setComputerName(QString::fromStdString(computer.name()));
     connect_data.setAddress(QString::fromStdString(computer.address()));
+    connect_data.setAlternateAddresses(ComputerFactory::alternateAddresses(computer));
     connect_data.setPort(computer.port());
     connect_data.setUserName(QString::fromStdString(computer.username()));
     connect_data.setPassword(QString::fromStdString(computer.password()));
@@ -701,13 +923,84 @@ void ConsoleWindow::connectToComputer(const proto::address_book::Computer& compu
             break;
     }
 
+    if (computer.session_type() == proto::auth::SESSION_TYPE_DESKTOP_MANAGE ||
+        computer.session_type() == proto::auth::SESSION_TYPE_DESKTOP_VIEW)
+    {
+        proto::desktop::Config desktop_config = connect_data.desktopConfig();
+        ComputerFactory::applyStreamingProfile(computer, &desktop_config);
+
+        connect_data.setDesktopConfig(desktop_config);
+        connect_data.setStreamingProfile(computer.streaming_profile());
+    }
+
     Client* client = new Client(connect_data, this);
     connect(client, &Client::clientTerminated, this, &ConsoleWindow::onClientTerminated);
     client_list_.push_back(client);
+
+    if (tab)
+        client_computers_.insert(client, { tab, computer.create_time(), computer.address() });
+}
+
+void ConsoleWindow::saveStreamingProfile(const Client* client)
+{
+    auto it = client_computers_.find(client);
+    if (it == client_computers_.end())
+        return;
+
+    const ClientComputer client_computer = it.value();
+    client_computers_.erase(it);
+
+    const proto::address_book::StreamingProfile& profile =
+        client->connectData().streamingProfile();
+
+    // The session did not use the automatic encoding or the address book is closed.
+    if (!profile.update_time() || client_computer.tab.isNull())
+        return;
+
+    // The computer may be changed or removed during the session.
+    proto::address_book::Computer* computer = client_computer.tab->findComputer(
+        client_computer.create_time, client_computer.address);
+    if (!computer)
+        return;
+
+    // As the time of the connection, the profile is saved with the other changes of the
+    // address book.
+    computer->mutable_streaming_profile()->CopyFrom(profile);
+}
+
+void ConsoleWindow::openPendingTab()
+{
+    if (opening_tab_)
+        return;
+
+    PendingAddressBookTab* pending_tab =
+        dynamic_cast<PendingAddressBookTab*>(ui.tab_widget->currentWidget());
+    if (!pending_tab)
+        return;
+
+    opening_tab_ = true;
+
+    // The key is created and the file is decrypted in the background while the window is
+    // repainted. If the opening is canceled or fails, then the tab remains pending.
+    AddressBookTab* tab =
+        AddressBookTab::openFromFile(pending_tab->addressBookPath(), ui.tab_widget);
+    if (tab)
+    {
+        int index = ui.tab_widget->indexOf(pending_tab);
+
+        ui.tab_widget->removeTab(index);
+        delete pending_tab;
+
+        addAddressBookTab(tab, index);
+    }
+
+    opening_tab_ = false;
 }
 
 void ConsoleWindow::onClientTerminated(Client* client)
 {
+    saveStreamingProfile(client);
+
     for (auto it = client_list_.begin(); it != client_list_.end(); ++it)
     {
         if (client == *it)
@@ -8,6 +8,9 @@
 #ifndef _ASPIA_CONSOLE__CONSOLE_WINDOW_H
 #define _ASPIA_CONSOLE__CONSOLE_WINDOW_H
 
+#include <QHash>
+#include <QPointer>
+
 #include "base/locale_loader.h"
 #include "protocol/address_book.pb.h"
 #include "ui_console_window.h"
@@ -15,8 +18,8 @@
 namespace aspia {
 
 class AddressBookTab;
-class ComputerItem;
 class Client;
+class PendingAddressBookTab;
 
 class ConsoleWindow : public QMainWindow
 {
@@ -46,6 +49,8 @@ public slots:
     void onDesktopViewConnect();
     void onFileTransferConnect();
     void onSystemInfoConnect();
+    void onMonitoringWall();
+    void onUploadFileToGroup();
 
     void onCurrentTabChanged(int index);
     void onCloseTab(int index);
@@ -54,7 +59,7 @@ public slots:
     void onComputerGroupActivated(bool activated, bool is_root);
     void onComputerActivated(bool activated);
     void onComputerGroupContextMenu(const QPoint& point, bool is_root);
-    void onComputerContextMenu(ComputerItem* computer_item, const QPoint& point);
+    void onComputerContextMenu(proto::address_book::Computer* computer, const QPoint& point);
     void onComputerDoubleClicked(proto::address_book::Computer* computer);
     void onLanguageChanged(QAction* action);
 
@@ -65,16 +70,43 @@ protected:
 private slots:
     void onClientTerminated(Client* client);
 
+    // Opens the address book of the current tab if it is pending.
+    void openPendingTab();
+
 private:
     void createLanguageMenu(const QString& current_locale);
-    void addAddressBookTab(AddressBookTab* tab);
+    void addAddressBookTab(AddressBookTab* tab, int index = -1);
+    void addPendingTab(const QString& file_path);
+
+    // Returns the index of the tab of the address book |file_path| or -1.
+    int findAddressBookTab(const QString& file_path) const;
     AddressBookTab* currentAddressBookTab();
-    void connectToComputer(const proto::address_book::Computer& computer);
+
+    // |tab| is the address book of |computer| or nullptr if the computer is not in an address
+    // book.
+    void connectToComputer(const proto::address_book::Computer& computer,
+                           AddressBookTab* tab = nullptr);
+
+    // Saves the streaming profile of the terminated client to its computer.
+    void saveStreamingProfile(const Client* client);
 
     Ui::ConsoleWindow ui;
     LocaleLoader locale_loader_;
     QList<Client*> client_list_;
 
+    // The computers of the address books to which the clients are connected.
+    struct ClientComputer
+    {
+        QPointer<AddressBookTab> tab;
+        qint64 create_time;
+        std::string address;
+    };
+
+    QHash<const Client*, ClientComputer> client_computers_;
+
+    // The pending tab is being replaced by the opened address book.
+    bool opening_tab_ = false;
+
     Q_DISABLE_COPY(ConsoleWindow)
 };
 
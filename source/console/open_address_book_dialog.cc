@@ -32,6 +32,10 @@ OpenAddressBookDialog::OpenAddressBookDialog(
             ui.edit_encryption_type->setText(tr("XChaCha20 + Poly1305 (256-bit key)"));
             break;
 
+        case proto::address_book::ENCRYPTION_TYPE_XCHACHA20_POLY1305_ARGON2ID:
+            ui.edit_encryption_type->setText(tr("XChaCha20 + Poly1305 (256-bit key, Argon2id)"));
+            break;
+
         default:
             qFatal("Unknown encryption type: %d", encryption_type);
             break;
@@ -0,0 +1,49 @@
+//
+// PROJECT:         Aspia
+// FILE:            console/pending_address_book_tab.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "console/pending_address_book_tab.h"
+
+#include <QFileInfo>
+#include <QLabel>
+#include <QPushButton>
+#include <QVBoxLayout>
+
+namespace aspia {
+
+PendingAddressBookTab::PendingAddressBookTab(const QString& file_path, QWidget* parent)
+    : ConsoleTab(ConsoleTab::PendingAddressBook, parent),
+      file_path_(file_path)
+{
+    label_ = new QLabel(this);
+    label_->setAlignment(Qt::AlignCenter);
+    label_->setWordWrap(true);
+
+    button_open_ = new QPushButton(this);
+
+    QVBoxLayout* layout = new QVBoxLayout(this);
+    layout->addStretch();
+    layout->addWidget(label_);
+    layout->addWidget(button_open_, 0, Qt::AlignHCenter);
+    layout->addStretch();
+
+    connect(button_open_, &QPushButton::clicked, this, &PendingAddressBookTab::openRequested);
+
+    retranslateUi();
+}
+
+QString PendingAddressBookTab::addressBookName() const
+{
+    return QFileInfo(file_path_).completeBaseName();
+}
+
+void PendingAddressBookTab::retranslateUi()
+{
+    label_->setText(tr("Address book \"%1\" is not opened yet.").arg(file_path_));
+    button_open_->setText(tr("Open"));
+}
+
+} // namespace aspia
@@ -0,0 +1,51 @@
+//
+// PROJECT:         Aspia
+// FILE:            console/pending_address_book_tab.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CONSOLE__PENDING_ADDRESS_BOOK_TAB_H
+#define _ASPIA_CONSOLE__PENDING_ADDRESS_BOOK_TAB_H
+
+#include "console/console_tab.h"
+
+class QLabel;
+class QPushButton;
+
+namespace aspia {
+
+//
+// Takes the place of the address book which was open in the previous run of the console. The
+// file is not read until the tab is selected, so the startup does not depend on the number and
+// the size of the address books. The window replaces the tab with the opened address book.
+//
+class PendingAddressBookTab : public ConsoleTab
+{
+    Q_OBJECT
+
+public:
+    PendingAddressBookTab(const QString& file_path, QWidget* parent);
+    ~PendingAddressBookTab() = default;
+
+    QString addressBookName() const;
+    QString addressBookPath() const { return file_path_; }
+
+    void retranslateUi();
+
+signals:
+    // The address book is opened again after it has been canceled or has failed.
+    void openRequested();
+
+private:
+    QString file_path_;
+
+    QLabel* label_;
+    QPushButton* button_open_;
+
+    Q_DISABLE_COPY(PendingAddressBookTab)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_CONSOLE__PENDING_ADDRESS_BOOK_TAB_H
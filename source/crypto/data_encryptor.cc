@@ -9,6 +9,8 @@
 
 #include <QCryptographicHash>
 
+#include "crypto/secure_memory.h"
+
 extern "C" {
 #define SODIUM_STATIC
 
@@ -22,6 +24,10 @@ namespace aspia {
 namespace {
 
 const size_t kChunkSize = 4096;
+const size_t kEncryptedChunkSize = kChunkSize + crypto_secretstream_xchacha20poly1305_ABYTES;
+
+// The progress is reported after each this number of the decrypted bytes.
+const size_t kProgressInterval = 256 * 1024;
 
 } // namespace
 
@@ -45,23 +51,70 @@ QByteArray DataEncryptor::createKey(const QByteArray& password,
     return data;
 }
 
+// static
+QByteArray DataEncryptor::createKey(const QByteArray& password,
+                                    const QByteArray& salt,
+                                    quint32 ops_limit,
+                                    quint32 mem_limit)
+{
+    if (sodium_init() == -1)
+    {
+        qWarning("sodium_init failed");
+        return QByteArray();
+    }
+
+    // Argon2id uses the salt of the fixed size.
+    quint8 hashed_salt[crypto_pwhash_SALTBYTES];
+
+    crypto_generichash(hashed_salt, sizeof(hashed_salt),
+                       reinterpret_cast<const quint8*>(salt.constData()), salt.size(),
+                       nullptr, 0);
+
+    QByteArray key;
+    key.resize(crypto_secretstream_xchacha20poly1305_KEYBYTES);
+
+    const int result = crypto_pwhash(reinterpret_cast<quint8*>(key.data()),
+                                     key.size(),
+                                     password.constData(),
+                                     password.size(),
+                                     hashed_salt,
+                                     ops_limit,
+                                     mem_limit,
+                                     crypto_pwhash_ALG_ARGON2ID13);
+    if (result != 0)
+    {
+        qWarning("crypto_pwhash failed");
+        secureMemZero(&key);
+        return QByteArray();
+    }
+
+    return key;
+}
+
 // static
 QByteArray DataEncryptor::encrypt(const QByteArray& source_data, const QByteArray& key)
 {
     Q_ASSERT(key.size() == crypto_secretstream_xchacha20poly1305_KEYBYTES);
 
+    // The last chunk is always smaller than |kChunkSize| and may be empty.
+    const size_t chunk_count = source_data.size() / kChunkSize + 1;
+
+    // The buffer is allocated once and the chunks are encrypted into it.
     QByteArray encrypted_data;
-    encrypted_data.resize(crypto_secretstream_xchacha20poly1305_HEADERBYTES);
+    encrypted_data.resize(static_cast<int>(
+        crypto_secretstream_xchacha20poly1305_HEADERBYTES + source_data.size() +
+        chunk_count * crypto_secretstream_xchacha20poly1305_ABYTES));
 
     crypto_secretstream_xchacha20poly1305_state state;
 
+    quint8* output_buffer = reinterpret_cast<quint8*>(encrypted_data.data());
+
     crypto_secretstream_xchacha20poly1305_init_push(
-        &state,
-        reinterpret_cast<quint8*>(encrypted_data.data()),
-        reinterpret_cast<const quint8*>(key.constData()));
+        &state, output_buffer, reinterpret_cast<const quint8*>(key.constData()));
 
     const quint8* input_buffer = reinterpret_cast<const quint8*>(source_data.constData());
     size_t input_pos = 0;
+    size_t output_pos = crypto_secretstream_xchacha20poly1305_HEADERBYTES;
 
     bool end_of_buffer = false;
 
@@ -76,24 +129,20 @@ QByteArray DataEncryptor::encrypt(const QByteArray& source_data, const QByteArra
             end_of_buffer = true;
         }
 
-        quint8 output_buffer[kChunkSize + crypto_secretstream_xchacha20poly1305_ABYTES];
         quint64 output_length;
 
         crypto_secretstream_xchacha20poly1305_push(&state,
-                                                   output_buffer, &output_length,
+                                                   output_buffer + output_pos, &output_length,
                                                    input_buffer + input_pos, consumed,
                                                    nullptr, 0,
                                                    tag);
 
-        size_t old_size = encrypted_data.size();
-
-        encrypted_data.resize(old_size + static_cast<size_t>(output_length));
-        memcpy(encrypted_data.data() + old_size, output_buffer, static_cast<size_t>(output_length));
-
         input_pos += consumed;
+        output_pos += static_cast<size_t>(output_length);
 
     } while (!end_of_buffer);
 
+    Q_ASSERT(output_pos == static_cast<size_t>(encrypted_data.size()));
     return encrypted_data;
 }
 
@@ -108,6 +157,13 @@ bool DataEncryptor::decrypt(const QByteArray& source_data,
 // static
 bool DataEncryptor::decrypt(const char* source_data, int source_size, const QByteArray& key,
                             QByteArray* decrypted_data)
+{
+    return decrypt(source_data, source_size, key, decrypted_data, ProgressCallback());
+}
+
+// static
+bool DataEncryptor::decrypt(const char* source_data, int source_size, const QByteArray& key,
+                            QByteArray* decrypted_data, const ProgressCallback& progress_callback)
 {
     if (!source_data || source_size < crypto_secretstream_xchacha20poly1305_HEADERBYTES ||
         !decrypted_data)
@@ -122,8 +178,6 @@ bool DataEncryptor::decrypt(const char* source_data, int source_size, const QByt
         return false;
     }
 
-    decrypted_data->clear();
-
     crypto_secretstream_xchacha20poly1305_state state;
 
     if (crypto_secretstream_xchacha20poly1305_init_pull(
@@ -139,43 +193,76 @@ bool DataEncryptor::decrypt(const char* source_data, int source_size, const QByt
     size_t input_size = source_size - crypto_secretstream_xchacha20poly1305_HEADERBYTES;
     size_t input_pos = 0;
 
+    // Each chunk has the authentication tag, so the size of the decrypted data is known. The
+    // buffer is allocated once and the chunks are decrypted into it, so no copies of the
+    // decrypted data are left in the freed memory.
+    const size_t chunk_count = (input_size + kEncryptedChunkSize - 1) / kEncryptedChunkSize;
+    if (!chunk_count || input_size < chunk_count * crypto_secretstream_xchacha20poly1305_ABYTES)
+    {
+        qWarning("Invalid source size");
+        return false;
+    }
+
+    secureMemZero(decrypted_data);
+    decrypted_data->resize(static_cast<int>(
+        input_size - chunk_count * crypto_secretstream_xchacha20poly1305_ABYTES));
+
+    quint8* output_buffer = reinterpret_cast<quint8*>(decrypted_data->data());
+    size_t output_pos = 0;
+    size_t next_progress = kProgressInterval;
+
     bool end_of_buffer = false;
 
     do
     {
-        size_t consumed = std::min(input_size - input_pos,
-                                   kChunkSize + crypto_secretstream_xchacha20poly1305_ABYTES);
+        if (input_pos == input_size)
+        {
+            qWarning("Unexpected end of buffer");
+            secureMemZero(decrypted_data);
+            return false;
+        }
+
+        size_t consumed = std::min(input_size - input_pos, kEncryptedChunkSize);
 
-        quint8 output_buffer[kChunkSize];
         quint64 output_length;
         quint8 tag;
 
-        if (crypto_secretstream_xchacha20poly1305_pull(&state, output_buffer, &output_length, &tag,
-                                                       input_buffer + input_pos, consumed, nullptr,
-                                                       0) != 0)
+        if (crypto_secretstream_xchacha20poly1305_pull(&state,
+                                                       output_buffer + output_pos, &output_length,
+                                                       &tag,
+                                                       input_buffer + input_pos, consumed,
+                                                       nullptr, 0) != 0)
         {
             qWarning("crypto_secretstream_xchacha20poly1305_pull failed");
+            secureMemZero(decrypted_data);
             return false;
         }
 
         input_pos += consumed;
+        output_pos += static_cast<size_t>(output_length);
 
         if (tag == crypto_secretstream_xchacha20poly1305_TAG_FINAL)
         {
             if (input_pos != input_size)
             {
                 qWarning("Unexpected end of buffer");
+                secureMemZero(decrypted_data);
                 return false;
             }
 
             end_of_buffer = true;
         }
 
-        size_t old_size = decrypted_data->size();
+        if (progress_callback && (output_pos >= next_progress || end_of_buffer))
+        {
+            if (!progress_callback(static_cast<int>(input_pos)))
+            {
+                secureMemZero(decrypted_data);
+                return false;
+            }
 
-        decrypted_data->resize(old_size + static_cast<size_t>(output_length));
-        memcpy(decrypted_data->data() + old_size, output_buffer,
-               static_cast<size_t>(output_length));
+            next_progress = output_pos + kProgressInterval;
+        }
 
     } while (!end_of_buffer);
 
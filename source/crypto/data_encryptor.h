@@ -10,6 +10,8 @@
 
 #include <QByteArray>
 
+#include <functional>
+
 namespace aspia {
 
 class DataEncryptor
@@ -20,6 +22,13 @@ public:
                                 const QByteArray& salt,
                                 int rounds);
 
+    // Creates a key from the password by Argon2id. |salt| may be of any size. Returns an empty
+    // array on error.
+    static QByteArray createKey(const QByteArray& password,
+                                const QByteArray& salt,
+                                quint32 ops_limit,
+                                quint32 mem_limit);
+
     static QByteArray encrypt(const QByteArray& source_data, const QByteArray& key);
 
     static bool decrypt(const QByteArray& source_data,
@@ -31,6 +40,16 @@ public:
                         const QByteArray& key,
                         QByteArray* decrypted_data);
 
+    // Called with the number of the decrypted bytes of the source. The decryption is canceled
+    // if it returns false.
+    using ProgressCallback = std::function<bool(int decrypted_size)>;
+
+    static bool decrypt(const char* source_data,
+                        int source_size,
+                        const QByteArray& key,
+                        QByteArray* decrypted_data,
+                        const ProgressCallback& progress_callback);
+
 private:
     Q_DISABLE_COPY(DataEncryptor)
 };
@@ -7,6 +7,8 @@
 
 #include "crypto/encryptor.h"
 
+#include <QtEndian>
+
 #include "base/message_serialization.h"
 #include "protocol/key_exchange.pb.h"
 
@@ -20,6 +22,79 @@ extern "C" {
 
 namespace aspia {
 
+namespace {
+
+static_assert(Encryptor::kEncryptionOverhead == crypto_secretbox_MACBYTES &&
+              Encryptor::kEncryptionOverhead == crypto_aead_xchacha20poly1305_ietf_ABYTES &&
+              Encryptor::kEncryptionOverhead == crypto_aead_aes256gcm_ABYTES,
+              "Wrong encryption overhead");
+
+// The nonces of the hello messages have the size of the largest nonce. The ciphers with
+// shorter nonces use the first bytes.
+static_assert(crypto_secretbox_NONCEBYTES == crypto_aead_xchacha20poly1305_ietf_NPUBBYTES &&
+              crypto_secretbox_NONCEBYTES > crypto_aead_aes256gcm_NPUBBYTES,
+              "Wrong nonce size");
+
+static_assert(crypto_kx_SESSIONKEYBYTES == crypto_secretbox_KEYBYTES &&
+              crypto_kx_SESSIONKEYBYTES == crypto_aead_xchacha20poly1305_ietf_KEYBYTES &&
+              crypto_kx_SESSIONKEYBYTES == crypto_aead_aes256gcm_KEYBYTES,
+              "Wrong key size");
+
+// The limits of the chunk size of the peer.
+constexpr quint32 kMinChunkSize = 4096;
+constexpr quint32 kMaxChunkSize = 16 * 1024 * 1024;
+
+// The bit of the highest byte of the nonce which marks the last chunk of the message. The
+// marked nonce differs from the nonces of the counter by half of its range, which the channel
+// never uses.
+constexpr quint8 kLastChunkBit = 0x80;
+
+// The context of the keys of the datagrams. Both peers derive the key of each direction from
+// the key of the stream in the same direction.
+constexpr char kDatagramKeyContext[] = "aspia datagram";
+
+constexpr quint32 cipherBit(proto::HelloMessage::Cipher cipher)
+{
+    return 1U << cipher;
+}
+
+std::vector<quint8> datagramKey(const std::vector<quint8>& stream_key)
+{
+    std::vector<quint8> key;
+    key.resize(crypto_aead_xchacha20poly1305_ietf_KEYBYTES);
+
+    if (crypto_generichash(key.data(), key.size(),
+                           reinterpret_cast<const quint8*>(kDatagramKeyContext),
+                           sizeof(kDatagramKeyContext) - 1,
+                           stream_key.data(), stream_key.size()) != 0)
+    {
+        qWarning("crypto_generichash failed");
+        return std::vector<quint8>();
+    }
+
+    return key;
+}
+
+void datagramNonce(quint64 number, quint8* nonce)
+{
+    memset(nonce, 0, crypto_aead_xchacha20poly1305_ietf_NPUBBYTES);
+    qToLittleEndian(number, nonce);
+}
+
+quint32 supportedCiphers()
+{
+    quint32 ciphers = cipherBit(proto::HelloMessage::CIPHER_XSALSA20_POLY1305) |
+                      cipherBit(proto::HelloMessage::CIPHER_XCHACHA20_POLY1305);
+
+    // AES-GCM is implemented in libsodium only with AES-NI and PCLMULQDQ.
+    if (crypto_aead_aes256gcm_is_available())
+        ciphers |= cipherBit(proto::HelloMessage::CIPHER_AES256_GCM);
+
+    return ciphers;
+}
+
+} // namespace
+
 Encryptor::Encryptor(Mode mode)
     : mode_(mode)
 {
@@ -59,6 +134,15 @@ Encryptor::~Encryptor()
         decrypt_key_.clear();
     }
 
+    for (std::vector<quint8>* key : { &datagram_encrypt_key_, &datagram_decrypt_key_ })
+    {
+        if (!key->empty())
+        {
+            sodium_memzero(key->data(), key->size());
+            key->clear();
+        }
+    }
+
     if (!encrypt_nonce_.empty())
     {
         sodium_memzero(encrypt_nonce_.data(), encrypt_nonce_.size());
@@ -91,6 +175,26 @@ bool Encryptor::readHelloMessage(const QByteArray& message_buffer)
     decrypt_nonce_.resize(crypto_secretbox_NONCEBYTES);
     memcpy(decrypt_nonce_.data(), message.nonce().data(), crypto_secretbox_NONCEBYTES);
 
+    // Both peers select the same cipher from the ciphers which they have in common.
+    const quint32 ciphers = supportedCiphers() & message.ciphers();
+
+    if (ciphers & cipherBit(proto::HelloMessage::CIPHER_AES256_GCM))
+        cipher_ = Cipher::AES256_GCM;
+    else if (ciphers & cipherBit(proto::HelloMessage::CIPHER_XCHACHA20_POLY1305))
+        cipher_ = Cipher::XCHACHA20_POLY1305;
+    else
+        cipher_ = Cipher::XSALSA20_POLY1305;
+
+    // The previous versions do not split the messages and do not set the chunk size.
+    if (message.chunk_size())
+    {
+        if (message.chunk_size() < kMinChunkSize || message.chunk_size() > kMaxChunkSize)
+            return false;
+
+        encrypt_chunk_size_ = kChunkSize;
+        decrypt_chunk_size_ = message.chunk_size();
+    }
+
     std::vector<quint8> decrypt_key;
     decrypt_key.resize(crypto_kx_SESSIONKEYBYTES);
 
@@ -138,10 +242,13 @@ bool Encryptor::readHelloMessage(const QByteArray& message_buffer)
         local_secret_key_.clear();
     }
 
+    datagram_decrypt_key_ = datagramKey(decrypt_key);
+    datagram_encrypt_key_ = datagramKey(encrypt_key);
+
     decrypt_key_ = std::move(decrypt_key);
     encrypt_key_ = std::move(encrypt_key);
 
-    return true;
+    return !datagram_decrypt_key_.empty() && !datagram_encrypt_key_.empty();
 }
 
 QByteArray Encryptor::helloMessage()
@@ -158,6 +265,8 @@ QByteArray Encryptor::helloMessage()
 
     message.set_public_key(local_public_key_.data(), local_public_key_.size());
     message.set_nonce(encrypt_nonce_.data(), encrypt_nonce_.size());
+    message.set_ciphers(supportedCiphers());
+    message.set_chunk_size(kChunkSize);
 
     QByteArray message_buffer = serializeMessage(message);
 
@@ -176,56 +285,341 @@ QByteArray Encryptor::helloMessage()
     return message_buffer;
 }
 
-QByteArray Encryptor::encrypt(const QByteArray& source_buffer)
+size_t Encryptor::encryptionOverhead(size_t message_size) const
+{
+    size_t count = 1;
+
+    if (encrypt_chunk_size_ && message_size > encrypt_chunk_size_)
+        count = (message_size + encrypt_chunk_size_ - 1) / encrypt_chunk_size_;
+
+    return count * kEncryptionOverhead;
+}
+
+bool Encryptor::encryptInPlace(quint8* buffer, size_t message_size)
+{
+    std::unique_ptr<Chunks> chunks = encryptChunks(buffer, message_size);
+
+    for (int i = 0; i < chunks->count(); ++i)
+    {
+        if (!chunks->process(i))
+            return false;
+    }
+
+    return true;
+}
+
+bool Encryptor::encryptInPlace(quint8* message, size_t message_size, quint8* mac)
 {
     Q_ASSERT(local_public_key_.empty());
     Q_ASSERT(local_secret_key_.empty());
     Q_ASSERT(encrypt_nonce_.size() == crypto_secretbox_NONCEBYTES);
     Q_ASSERT(!encrypt_key_.empty());
 
-    sodium_increment(encrypt_nonce_.data(), crypto_secretbox_NONCEBYTES);
+    sodium_increment(encrypt_nonce_.data(), nonceSize(cipher_));
+
+    return encryptChunk(cipher_, encrypt_key_.data(), encrypt_nonce_.data(),
+                        message, message_size, mac);
+}
 
-    QByteArray encrypted_buffer;
-    encrypted_buffer.resize(source_buffer.size() + crypto_secretbox_MACBYTES);
+bool Encryptor::decryptInPlace(quint8* buffer, size_t buffer_size, size_t* message_size)
+{
+    std::unique_ptr<Chunks> chunks = decryptChunks(buffer, buffer_size);
+    if (!chunks)
+        return false;
 
-    // Encrypt message.
-    if (crypto_secretbox_easy(reinterpret_cast<quint8*>(encrypted_buffer.data()),
-                              reinterpret_cast<const quint8*>(source_buffer.data()),
-                              source_buffer.size(),
-                              encrypt_nonce_.data(),
-                              encrypt_key_.data()) != 0)
+    for (int i = 0; i < chunks->count(); ++i)
     {
-        qWarning("crypto_secretbox_easy failed");
-        return QByteArray();
+        if (!chunks->process(i))
+            return false;
     }
 
-    return encrypted_buffer;
+    chunks->finish();
+
+    *message_size = chunks->messageSize();
+    return true;
 }
 
-QByteArray Encryptor::decrypt(const QByteArray& source_buffer)
+bool Encryptor::decryptInPlace(quint8* message, size_t message_size, const quint8* mac)
 {
     Q_ASSERT(local_public_key_.empty());
     Q_ASSERT(local_secret_key_.empty());
     Q_ASSERT(decrypt_nonce_.size() == crypto_secretbox_NONCEBYTES);
     Q_ASSERT(!decrypt_key_.empty());
 
-    sodium_increment(decrypt_nonce_.data(), crypto_secretbox_NONCEBYTES);
+    sodium_increment(decrypt_nonce_.data(), nonceSize(cipher_));
+
+    return decryptChunk(cipher_, decrypt_key_.data(), decrypt_nonce_.data(),
+                        message, message_size, mac);
+}
+
+std::unique_ptr<Encryptor::Chunks> Encryptor::encryptChunks(quint8* buffer, size_t message_size)
+{
+    Q_ASSERT(local_public_key_.empty());
+    Q_ASSERT(local_secret_key_.empty());
+    Q_ASSERT(encrypt_nonce_.size() == crypto_secretbox_NONCEBYTES);
+    Q_ASSERT(!encrypt_key_.empty());
+
+    return createChunks(true, buffer, message_size, encrypt_chunk_size_);
+}
+
+std::unique_ptr<Encryptor::Chunks> Encryptor::decryptChunks(quint8* buffer, size_t buffer_size)
+{
+    Q_ASSERT(local_public_key_.empty());
+    Q_ASSERT(local_secret_key_.empty());
+    Q_ASSERT(decrypt_nonce_.size() == crypto_secretbox_NONCEBYTES);
+    Q_ASSERT(!decrypt_key_.empty());
 
-    QByteArray decrypted_buffer;
-    decrypted_buffer.resize(source_buffer.size() - crypto_secretbox_MACBYTES);
+    size_t count = 1;
 
-    // Decrypt message.
-    if (crypto_secretbox_open_easy(reinterpret_cast<quint8*>(decrypted_buffer.data()),
-                                   reinterpret_cast<const quint8*>(source_buffer.data()),
-                                   source_buffer.size(),
-                                   decrypt_nonce_.data(),
-                                   decrypt_key_.data()) != 0)
+    // Each chunk except the last one has kEncryptionOverhead + chunk size bytes.
+    if (decrypt_chunk_size_)
     {
-        qWarning("crypto_secretbox_open_easy failed");
-        return QByteArray();
+        const size_t encrypted_chunk_size = decrypt_chunk_size_ + kEncryptionOverhead;
+        count = (buffer_size + encrypted_chunk_size - 1) / encrypted_chunk_size;
+    }
+
+    if (!count || buffer_size < count * kEncryptionOverhead)
+        return nullptr;
+
+    return createChunks(false, buffer, buffer_size - count * kEncryptionOverhead,
+                        decrypt_chunk_size_);
+}
+
+bool Encryptor::encryptDatagram(quint64 number, quint8* message, size_t message_size,
+                                quint8* mac) const
+{
+    Q_ASSERT(!datagram_encrypt_key_.empty());
+
+    quint8 nonce[crypto_aead_xchacha20poly1305_ietf_NPUBBYTES];
+    datagramNonce(number, nonce);
+
+    return encryptChunk(Cipher::XCHACHA20_POLY1305, datagram_encrypt_key_.data(), nonce,
+                        message, message_size, mac);
+}
+
+bool Encryptor::decryptDatagram(quint64 number, quint8* message, size_t message_size,
+                                const quint8* mac) const
+{
+    Q_ASSERT(!datagram_decrypt_key_.empty());
+
+    quint8 nonce[crypto_aead_xchacha20poly1305_ietf_NPUBBYTES];
+    datagramNonce(number, nonce);
+
+    // The forged datagrams are expected, so the failure is not logged.
+    return crypto_aead_xchacha20poly1305_ietf_decrypt_detached(message,
+                                                               nullptr,
+                                                               message,
+                                                               message_size,
+                                                               mac,
+                                                               nullptr,
+                                                               0,
+                                                               nonce,
+                                                               datagram_decrypt_key_.data()) == 0;
+}
+
+std::unique_ptr<Encryptor::Chunks> Encryptor::createChunks(bool encrypt,
+                                                           quint8* buffer,
+                                                           size_t message_size,
+                                                           size_t chunk_size)
+{
+    std::unique_ptr<Chunks> chunks(new Chunks());
+
+    chunks->encrypt_ = encrypt;
+    chunks->cipher_ = cipher_;
+    chunks->buffer_ = buffer;
+    chunks->message_size_ = message_size;
+    chunks->chunk_size_ = message_size;
+    chunks->count_ = 1;
+
+    // The previous versions do not split the messages and do not mark the last chunk.
+    chunks->mark_last_ = chunk_size != 0;
+
+    if (chunk_size && message_size > chunk_size)
+    {
+        chunks->chunk_size_ = chunk_size;
+        chunks->count_ = static_cast<int>((message_size + chunk_size - 1) / chunk_size);
+    }
+
+    if (encrypt)
+    {
+        chunks->key_ = encrypt_key_;
+        chunks->nonce_ = reserveNonces(&encrypt_nonce_, chunks->count_);
+    }
+    else
+    {
+        chunks->key_ = decrypt_key_;
+        chunks->nonce_ = reserveNonces(&decrypt_nonce_, chunks->count_);
     }
 
-    return decrypted_buffer;
+    return chunks;
+}
+
+std::vector<quint8> Encryptor::reserveNonces(std::vector<quint8>* nonce, int count) const
+{
+    const size_t nonce_size = nonceSize(cipher_);
+
+    // The previous versions increment the nonce before each message, so the first chunk uses
+    // the next nonce.
+    sodium_increment(nonce->data(), nonce_size);
+
+    std::vector<quint8> first_nonce = *nonce;
+
+    quint8 step[crypto_secretbox_NONCEBYTES] = { 0 };
+    qToLittleEndian(static_cast<quint32>(count - 1), step);
+
+    sodium_add(nonce->data(), step, nonce_size);
+    sodium_memzero(step, sizeof(step));
+
+    return first_nonce;
+}
+
+// static
+size_t Encryptor::nonceSize(Cipher cipher)
+{
+    if (cipher == Cipher::AES256_GCM)
+        return crypto_aead_aes256gcm_NPUBBYTES;
+
+    return crypto_secretbox_NONCEBYTES;
+}
+
+// static
+bool Encryptor::encryptChunk(Cipher cipher, const quint8* key, const quint8* nonce,
+                             quint8* message, size_t message_size, quint8* mac)
+{
+    int result;
+
+    switch (cipher)
+    {
+        case Cipher::AES256_GCM:
+            result = crypto_aead_aes256gcm_encrypt_detached(message,
+                                                            mac,
+                                                            nullptr,
+                                                            message,
+                                                            message_size,
+                                                            nullptr,
+                                                            0,
+                                                            nullptr,
+                                                            nonce,
+                                                            key);
+            break;
+
+        case Cipher::XCHACHA20_POLY1305:
+            result = crypto_aead_xchacha20poly1305_ietf_encrypt_detached(message,
+                                                                         mac,
+                                                                         nullptr,
+                                                                         message,
+                                                                         message_size,
+                                                                         nullptr,
+                                                                         0,
+                                                                         nullptr,
+                                                                         nonce,
+                                                                         key);
+            break;
+
+        default:
+            result = crypto_secretbox_detached(message, mac, message, message_size, nonce, key);
+            break;
+    }
+
+    if (result != 0)
+    {
+        qWarning("Message encryption failed");
+        return false;
+    }
+
+    return true;
+}
+
+// static
+bool Encryptor::decryptChunk(Cipher cipher, const quint8* key, const quint8* nonce,
+                             quint8* message, size_t message_size, const quint8* mac)
+{
+    int result;
+
+    switch (cipher)
+    {
+        case Cipher::AES256_GCM:
+            result = crypto_aead_aes256gcm_decrypt_detached(message,
+                                                            nullptr,
+                                                            message,
+                                                            message_size,
+                                                            mac,
+                                                            nullptr,
+                                                            0,
+                                                            nonce,
+                                                            key);
+            break;
+
+        case Cipher::XCHACHA20_POLY1305:
+            result = crypto_aead_xchacha20poly1305_ietf_decrypt_detached(message,
+                                                                         nullptr,
+                                                                         message,
+                                                                         message_size,
+                                                                         mac,
+                                                                         nullptr,
+                                                                         0,
+                                                                         nonce,
+                                                                         key);
+            break;
+
+        default:
+            result = crypto_secretbox_open_detached(message, message, mac, message_size,
+                                                    nonce, key);
+            break;
+    }
+
+    if (result != 0)
+    {
+        qWarning("Message decryption failed");
+        return false;
+    }
+
+    return true;
+}
+
+Encryptor::Chunks::~Chunks()
+{
+    sodium_memzero(key_.data(), key_.size());
+    sodium_memzero(nonce_.data(), nonce_.size());
+}
+
+bool Encryptor::Chunks::process(int index) const
+{
+    Q_ASSERT(index >= 0 && index < count_);
+
+    // Chunk |index| uses the first nonce of the message incremented by |index|.
+    quint8 nonce[crypto_secretbox_NONCEBYTES];
+    quint8 step[crypto_secretbox_NONCEBYTES] = { 0 };
+
+    memcpy(nonce, nonce_.data(), sizeof(nonce));
+    qToLittleEndian(static_cast<quint32>(index), step);
+    sodium_add(nonce, step, nonceSize(cipher_));
+
+    // The message with the first chunks only fails the authentication of its last chunk.
+    if (mark_last_ && index == count_ - 1)
+        nonce[nonceSize(cipher_) - 1] ^= kLastChunkBit;
+
+    const size_t offset = index * chunk_size_;
+    const size_t size = qMin(chunk_size_, message_size_ - offset);
+
+    quint8* mac = buffer_ + index * kEncryptionOverhead;
+    quint8* message = buffer_ + count_ * kEncryptionOverhead + offset;
+
+    bool result;
+
+    if (encrypt_)
+        result = encryptChunk(cipher_, key_.data(), nonce, message, size, mac);
+    else
+        result = decryptChunk(cipher_, key_.data(), nonce, message, size, mac);
+
+    sodium_memzero(nonce, sizeof(nonce));
+    return result;
+}
+
+void Encryptor::Chunks::finish()
+{
+    Q_ASSERT(!encrypt_);
+    memmove(buffer_, buffer_ + count_ * kEncryptionOverhead, message_size_);
 }
 
 } // namespace aspia
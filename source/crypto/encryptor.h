@@ -10,11 +10,14 @@
 
 #include <QByteArray>
 
+#include <memory>
 #include <vector>
 
 namespace aspia {
 
-// Implements encryption of messages with using xsalsa20 + poly1305 algorithms.
+// Implements encryption of messages. The keys are exchanged with the hello messages, which
+// also select the cipher: AES-256-GCM if both peers have the hardware support for it,
+// XChaCha20-Poly1305 otherwise, or XSalsa20-Poly1305 with the previous versions.
 class Encryptor
 {
 public:
@@ -24,17 +27,124 @@ public:
         ClientMode
     };
 
+    enum class Cipher
+    {
+        XSALSA20_POLY1305,
+        XCHACHA20_POLY1305,
+        AES256_GCM
+    };
+
+    // Number of bytes which the encryption adds to each chunk of the message (the authentication
+    // tag).
+    static const int kEncryptionOverhead = 16;
+
+    // If the peer supports it, then the messages larger than kChunkSize are split into chunks
+    // which are authenticated independently. The tags of all chunks precede the ciphertext of
+    // the message.
+    static const int kChunkSize = 64 * 1024; // 64kB
+
+    // The chunks of one message. Each chunk has its own nonce, so the chunks can be encrypted or
+    // decrypted by different threads at the same time. If the messages are split, then the
+    // nonce of the last chunk is marked, so the message which is truncated to its first chunks
+    // is not decrypted.
+    class Chunks
+    {
+    public:
+        ~Chunks();
+
+        int count() const { return count_; }
+        size_t messageSize() const { return message_size_; }
+
+        // Encrypts or decrypts the chunk |index|.
+        bool process(int index) const;
+
+        // Moves the decrypted message to the start of the buffer. Must be called after all
+        // chunks are decrypted.
+        void finish();
+
+    private:
+        friend class Encryptor;
+
+        Chunks() = default;
+
+        bool encrypt_;
+        Cipher cipher_;
+        std::vector<quint8> key_;
+        std::vector<quint8> nonce_;
+
+        quint8* buffer_;
+        size_t message_size_;
+        size_t chunk_size_;
+        int count_;
+        bool mark_last_;
+
+        Q_DISABLE_COPY(Chunks)
+    };
+
     explicit Encryptor(Mode mode);
     ~Encryptor();
 
     bool readHelloMessage(const QByteArray& message_buffer);
     QByteArray helloMessage();
 
-    QByteArray encrypt(const QByteArray& source_buffer);
-    QByteArray decrypt(const QByteArray& source_buffer);
+    // Returns the number of bytes which the encryption adds to the message of |message_size|
+    // bytes.
+    size_t encryptionOverhead(size_t message_size) const;
+
+    // Encrypts the message of |message_size| bytes located at |buffer| +
+    // encryptionOverhead(|message_size|). The encrypted message replaces it starting from
+    // |buffer|, so the data is not copied.
+    bool encryptInPlace(quint8* buffer, size_t message_size);
+
+    // Encrypts the message of |message_size| bytes at |message| in place and writes the
+    // authentication tag of kEncryptionOverhead bytes to |mac|. The message is not split.
+    bool encryptInPlace(quint8* message, size_t message_size, quint8* mac);
+
+    // Decrypts the encrypted message of |buffer_size| bytes at |buffer|. The decrypted message
+    // replaces it starting from |buffer|.
+    bool decryptInPlace(quint8* buffer, size_t buffer_size, size_t* message_size);
+
+    // Decrypts the message of |message_size| bytes at |message| in place. |mac| is the
+    // authentication tag of kEncryptionOverhead bytes. The message is not split.
+    bool decryptInPlace(quint8* message, size_t message_size, const quint8* mac);
+
+    // The same as encryptInPlace() and decryptInPlace(), but the chunks are processed by the
+    // caller. The nonces of the message are reserved, so the next messages may be encrypted
+    // or decrypted before the chunks are processed. Returns nullptr if the size of the
+    // encrypted message is wrong.
+    std::unique_ptr<Chunks> encryptChunks(quint8* buffer, size_t message_size);
+    std::unique_ptr<Chunks> decryptChunks(quint8* buffer, size_t buffer_size);
+
+    // Encrypts and decrypts the datagrams which are sent beside the stream of the messages (see
+    // DatagramPath). The datagrams may be lost or reordered, so the nonce of each of them is
+    // its |number| rather than the counter of the stream. The numbers of the datagrams must not
+    // be repeated. The keys are derived from the keys of the stream, XChaCha20-Poly1305 is used
+    // with any cipher of the stream.
+    bool encryptDatagram(quint64 number, quint8* message, size_t message_size,
+                         quint8* mac) const;
+    bool decryptDatagram(quint64 number, quint8* message, size_t message_size,
+                         const quint8* mac) const;
 
 private:
+    static size_t nonceSize(Cipher cipher);
+
+    static bool encryptChunk(Cipher cipher, const quint8* key, const quint8* nonce,
+                             quint8* message, size_t message_size, quint8* mac);
+    static bool decryptChunk(Cipher cipher, const quint8* key, const quint8* nonce,
+                             quint8* message, size_t message_size, const quint8* mac);
+
+    // Returns the first nonce of the message of |count| chunks and advances |nonce| past it.
+    std::vector<quint8> reserveNonces(std::vector<quint8>* nonce, int count) const;
+
+    std::unique_ptr<Chunks> createChunks(bool encrypt, quint8* buffer, size_t message_size,
+                                         size_t chunk_size);
+
     const Mode mode_;
+    Cipher cipher_ = Cipher::XSALSA20_POLY1305;
+
+    // Zero if the messages are not split.
+    size_t encrypt_chunk_size_ = 0;
+    size_t decrypt_chunk_size_ = 0;
 
     std::vector<quint8> local_public_key_;
     std::vector<quint8> local_secret_key_;
@@ -42,6 +152,9 @@ private:
     std::vector<quint8> encrypt_key_;
     std::vector<quint8> decrypt_key_;
 
+    std::vector<quint8> datagram_encrypt_key_;
+    std::vector<quint8> datagram_decrypt_key_;
+
     std::vector<quint8> encrypt_nonce_;
     std::vector<quint8> decrypt_nonce_;
 
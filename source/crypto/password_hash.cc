@@ -0,0 +1,145 @@
+//
+// PROJECT:         Aspia
+// FILE:            crypto/password_hash.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "crypto/password_hash.h"
+
+#include <QCryptographicHash>
+
+#include "crypto/random.h"
+#include "crypto/secure_memory.h"
+
+extern "C" {
+#define SODIUM_STATIC
+
+#pragma warning(push, 3)
+#include <sodium.h>
+#pragma warning(pop)
+} // extern "C"
+
+namespace aspia {
+
+namespace {
+
+const quint32 kLegacyHashingRounds = 100000;
+
+// The client does not accept the parameters which would take too long or too much memory.
+const quint32 kMaxOpsLimit = 16;
+const quint32 kMaxMemLimit = 1024 * 1024 * 1024; // 1GB
+
+static_assert(PasswordHash::kSaltSize == crypto_pwhash_SALTBYTES, "Wrong salt size");
+static_assert(PasswordHash::kHashSize <= crypto_generichash_KEYBYTES_MAX, "Wrong hash size");
+
+} // namespace
+
+// static
+bool PasswordHash::isValidLimits(quint32 ops_limit, quint32 mem_limit)
+{
+    return ops_limit >= crypto_pwhash_OPSLIMIT_MIN && ops_limit <= kMaxOpsLimit &&
+           mem_limit >= crypto_pwhash_MEMLIMIT_MIN && mem_limit <= kMaxMemLimit;
+}
+
+// static
+QByteArray PasswordHash::createSalt()
+{
+    return Random::generateBuffer(kSaltSize);
+}
+
+// static
+QByteArray PasswordHash::create(const QString& password,
+                                const QByteArray& salt,
+                                quint32 ops_limit,
+                                quint32 mem_limit)
+{
+    if (salt.size() != kSaltSize || !isValidLimits(ops_limit, mem_limit))
+        return QByteArray();
+
+    // The hash may be computed before the encryptor of the channel initializes the library.
+    if (sodium_init() == -1)
+    {
+        qWarning("sodium_init failed");
+        return QByteArray();
+    }
+
+    QByteArray password_utf8 = password.toUtf8();
+
+    QByteArray password_hash;
+    password_hash.resize(kHashSize);
+
+    const int result = crypto_pwhash(reinterpret_cast<quint8*>(password_hash.data()),
+                                     password_hash.size(),
+                                     password_utf8.constData(),
+                                     password_utf8.size(),
+                                     reinterpret_cast<const quint8*>(salt.constData()),
+                                     ops_limit,
+                                     mem_limit,
+                                     crypto_pwhash_ALG_ARGON2ID13);
+
+    secureMemZero(&password_utf8);
+
+    if (result != 0)
+    {
+        qWarning("crypto_pwhash failed");
+        secureMemZero(&password_hash);
+        return QByteArray();
+    }
+
+    return password_hash;
+}
+
+// static
+QByteArray PasswordHash::createSessionKey(const QByteArray& password_hash,
+                                          const QByteArray& nonce)
+{
+    if (password_hash.size() != kHashSize)
+        return QByteArray();
+
+    QByteArray session_key;
+    session_key.resize(kHashSize);
+
+    crypto_generichash(reinterpret_cast<quint8*>(session_key.data()),
+                       session_key.size(),
+                       reinterpret_cast<const quint8*>(nonce.constData()),
+                       nonce.size(),
+                       reinterpret_cast<const quint8*>(password_hash.constData()),
+                       password_hash.size());
+
+    return session_key;
+}
+
+// static
+QByteArray PasswordHash::createLegacy(const QString& password)
+{
+    QByteArray data = password.toUtf8();
+
+    for (quint32 i = 0; i < kLegacyHashingRounds; ++i)
+    {
+        data = QCryptographicHash::hash(data, QCryptographicHash::Sha512);
+    }
+
+    return data;
+}
+
+// static
+QByteArray PasswordHash::createLegacySessionKey(const QByteArray& password_hash,
+                                                const QByteArray& nonce)
+{
+    QByteArray data = password_hash;
+
+    for (quint32 i = 0; i < kLegacyHashingRounds; ++i)
+    {
+        QCryptographicHash hash(QCryptographicHash::Sha512);
+
+        hash.addData(data);
+        hash.addData(nonce);
+
+        data = hash.result();
+    }
+
+    return data;
+}
+
+} // namespace aspia
@@ -0,0 +1,58 @@
+//
+// PROJECT:         Aspia
+// FILE:            crypto/password_hash.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_CRYPTO__PASSWORD_HASH_H
+#define _ASPIA_CRYPTO__PASSWORD_HASH_H
+
+#include <QByteArray>
+#include <QString>
+
+namespace aspia {
+
+//
+// The hash of the password is stored by the host and is computed by the client from the
+// password. It is computed by Argon2id, which makes the guessing of the password slow. The
+// session key which proves the knowledge of the hash for the nonce of the host is a keyed
+// BLAKE2b hash, so the slow hashing is not repeated for each connection.
+//
+class PasswordHash
+{
+public:
+    static const int kHashSize = 64;
+    static const int kSaltSize = 16;
+
+    // The parameters of Argon2id for the new passwords. It takes about 100 ms.
+    static const quint32 kDefaultOpsLimit = 2;
+    static const quint32 kDefaultMemLimit = 64 * 1024 * 1024; // 64MB
+
+    // Returns true if the parameters received from the host can be used by the client.
+    static bool isValidLimits(quint32 ops_limit, quint32 mem_limit);
+
+    static QByteArray createSalt();
+
+    // Returns an empty array on error.
+    static QByteArray create(const QString& password,
+                             const QByteArray& salt,
+                             quint32 ops_limit,
+                             quint32 mem_limit);
+
+    static QByteArray createSessionKey(const QByteArray& password_hash, const QByteArray& nonce);
+
+    // The hashes of the previous versions, which hash the password and the session key by
+    // 100000 rounds of SHA-512. They are used for the users whose passwords have not been
+    // changed since then and for the clients of the previous versions.
+    static QByteArray createLegacy(const QString& password);
+    static QByteArray createLegacySessionKey(const QByteArray& password_hash,
+                                             const QByteArray& nonce);
+
+private:
+    Q_DISABLE_COPY(PasswordHash)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_CRYPTO__PASSWORD_HASH_H
@@ -7,26 +7,87 @@
 
 #include "desktop_capture/capture_scheduler.h"
 
+#include <algorithm>
+
 namespace aspia {
 
+namespace {
+
+// The screen is considered active for this time after the last change or input.
+constexpr std::chrono::milliseconds kActiveTimeout(1000);
+
+// The capture interval of the idle screen.
+constexpr std::chrono::milliseconds kIdleInterval(500);
+constexpr std::chrono::milliseconds kPowerSavingIdleInterval(2000);
+
+// During the idle time the interval is multiplied by kIdleGrowthNumerator / kIdleGrowthDenominator
+// after each capture.
+constexpr int kIdleGrowthNumerator = 3;
+constexpr int kIdleGrowthDenominator = 2;
+
+// When the encoder is saturated, the interval is not less than the encode time multiplied by
+// this value.
+constexpr int kSaturatedEncodeFactor = 2;
+
+} // namespace
+
 void CaptureScheduler::beginCapture()
 {
-    begin_time_ = std::chrono::high_resolution_clock::now();
+    begin_time_ = Clock::now();
+}
+
+void CaptureScheduler::endCapture(bool screen_changed)
+{
+    if (screen_changed)
+        last_activity_time_ = Clock::now();
+}
+
+void CaptureScheduler::markActivity()
+{
+    last_activity_time_ = Clock::now();
+}
+
+void CaptureScheduler::setEncoderLoad(const std::chrono::milliseconds& encode_time,
+                                      bool saturated)
+{
+    encode_time_ = encode_time;
+    saturated_ = saturated;
 }
 
 std::chrono::milliseconds CaptureScheduler::nextCaptureDelay(
-    const std::chrono::milliseconds& max_delay) const
+    const std::chrono::milliseconds& interval)
 {
-    std::chrono::time_point<std::chrono::high_resolution_clock> end_time =
-        std::chrono::high_resolution_clock::now();
+    const Clock::time_point end_time = Clock::now();
+
+    std::chrono::milliseconds target = interval;
+
+    // The encoder drops the frames it is not able to take, the capture is slowed down to the
+    // speed of the encoder.
+    if (saturated_)
+        target = std::max(target, encode_time_ * kSaturatedEncodeFactor);
+
+    if (end_time - last_activity_time_ < kActiveTimeout)
+    {
+        // The activity returns the requested rate immediately.
+        idle_interval_ = target;
+    }
+    else
+    {
+        const std::chrono::milliseconds idle_interval =
+            power_saving_ ? kPowerSavingIdleInterval : kIdleInterval;
+
+        idle_interval_ = std::max(idle_interval_, target);
+        idle_interval_ = std::min(idle_interval_ * kIdleGrowthNumerator / kIdleGrowthDenominator,
+                                  std::max(idle_interval, target));
+    }
 
     std::chrono::milliseconds diff_time =
         std::chrono::duration_cast<std::chrono::milliseconds>(end_time - begin_time_);
 
-    if (diff_time > max_delay)
-        diff_time = max_delay;
+    if (diff_time > idle_interval_)
+        diff_time = idle_interval_;
 
-    return max_delay - diff_time;
+    return idle_interval_ - diff_time;
 }
 
 } // namespace aspia
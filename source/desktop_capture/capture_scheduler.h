@@ -12,6 +12,12 @@
 
 namespace aspia {
 
+//
+// The screen is captured with the requested interval while it changes or the user is active.
+// When the screen is idle, the interval is gradually increased up to kIdleInterval. If the
+// encoder does not keep up, then the interval is increased so that the captures are not wasted.
+// In the power saving mode the idle interval grows further.
+//
 class CaptureScheduler
 {
 public:
@@ -19,10 +25,35 @@ public:
     ~CaptureScheduler() = default;
 
     void beginCapture();
-    std::chrono::milliseconds nextCaptureDelay(const std::chrono::milliseconds& max_delay) const;
+
+    // Must be called after the capture. |screen_changed| is true if the captured frame has
+    // changes.
+    void endCapture(bool screen_changed);
+
+    // Must be called on the user input. The capture interval returns to the requested one.
+    void markActivity();
+
+    // Sets the smoothed time of the encoding of a frame. If |saturated| is true, then the
+    // encoder or the network does not accept new frames.
+    void setEncoderLoad(const std::chrono::milliseconds& encode_time, bool saturated);
+
+    // The computer runs on the battery (see PowerMonitor).
+    void setPowerSaving(bool power_saving) { power_saving_ = power_saving; }
+
+    std::chrono::milliseconds nextCaptureDelay(const std::chrono::milliseconds& interval);
 
 private:
-    std::chrono::time_point<std::chrono::high_resolution_clock> begin_time_;
+    typedef std::chrono::high_resolution_clock Clock;
+
+    Clock::time_point begin_time_;
+    Clock::time_point last_activity_time_;
+
+    // Current capture interval increased during the idle time.
+    std::chrono::milliseconds idle_interval_{ 0 };
+
+    std::chrono::milliseconds encode_time_{ 0 };
+    bool saturated_ = false;
+    bool power_saving_ = false;
 
     Q_DISABLE_COPY(CaptureScheduler)
 };
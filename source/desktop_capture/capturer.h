@@ -8,8 +8,11 @@
 #ifndef _ASPIA_DESKTOP_CAPTURE__CAPTURER_H
 #define _ASPIA_DESKTOP_CAPTURE__CAPTURER_H
 
+#include <QString>
+
+#include <vector>
+
 #include "desktop_capture/desktop_frame.h"
-#include "desktop_capture/mouse_cursor.h"
 
 namespace aspia {
 
@@ -18,8 +21,46 @@ class Capturer
 public:
     virtual ~Capturer() = default;
 
+    typedef qint64 ScreenId;
+
+    // The whole virtual desktop.
+    static const ScreenId kFullDesktopScreenId = -1;
+
+    // The ids of the top-level windows have this bit set, the lower 32 bits are the handle of
+    // the window. The area of the window on the screen is captured.
+    static const ScreenId kWindowScreenIdFlag = 0x100000000LL;
+
+    static bool isWindowScreen(ScreenId screen_id)
+    {
+        return screen_id > 0 && (screen_id & kWindowScreenIdFlag) != 0;
+    }
+
+    struct Screen
+    {
+        ScreenId id;
+        QString title;
+    };
+
+    typedef std::vector<Screen> ScreenList;
+
     virtual const DesktopFrame* captureImage() = 0;
-    virtual std::unique_ptr<MouseCursor> captureCursor() = 0;
+
+    // Areas of the captured screen which the user probably looks at: around the cursor and the
+    // foreground window. In the coordinates of the frame.
+    virtual QRegion focusRegion() const = 0;
+
+    // If enabled, then the moved areas of the screen are reported in DesktopFrame::moveRects()
+    // instead of the updated region.
+    void enableMoveDetection(bool enable) { move_detection_enabled_ = enable; }
+
+    // Only the selected screen is captured. If the screen is disconnected or the window is
+    // closed or minimized, then the whole desktop is captured.
+    void selectScreen(ScreenId screen_id) { current_screen_id_ = screen_id; }
+    ScreenId currentScreen() const { return current_screen_id_; }
+
+protected:
+    bool move_detection_enabled_ = false;
+    ScreenId current_screen_id_ = kFullDesktopScreenId;
 };
 
 } // namespace aspia
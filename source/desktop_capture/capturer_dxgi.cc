@@ -0,0 +1,540 @@
+//
+// PROJECT:         Aspia
+// FILE:            desktop_capture/capturer_dxgi.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "desktop_capture/capturer_dxgi.h"
+
+#include <QDebug>
+
+#include <d3d10.h>
+
+#include "desktop_capture/win/screen_capture_utils.h"
+
+namespace aspia {
+
+namespace {
+
+constexpr int kBytesPerPixel = 4;
+
+// Timeout for the first frame after the duplication is created. The first frame contains the
+// whole desktop image and it is not always ready at the moment of the call.
+constexpr UINT kFullFrameTimeout = 100; // ms
+
+// Size of the area around the cursor which is encoded with a better quality.
+constexpr int kCursorFocusSize = 256;
+
+QRect fromRECT(const RECT& rect)
+{
+    return QRect(rect.left, rect.top, rect.right - rect.left, rect.bottom - rect.top);
+}
+
+} // namespace
+
+CapturerDXGI::CapturerDXGI() = default;
+
+// static
+std::unique_ptr<CapturerDXGI> CapturerDXGI::create()
+{
+    std::unique_ptr<CapturerDXGI> capturer(new CapturerDXGI());
+
+    if (!capturer->prepareCaptureResources())
+        return nullptr;
+
+    return capturer;
+}
+
+bool CapturerDXGI::prepareCaptureResources()
+{
+    // Switch to the desktop receiving user input if different from the
+    // current one.
+    Desktop input_desktop(Desktop::inputDesktop());
+
+    if (input_desktop.isValid() && !desktop_.isSame(input_desktop))
+    {
+        // The duplication is bound to the desktop of the thread. It must be created again
+        // after the switch.
+        releaseResources();
+        desktop_.setThreadDesktop(std::move(input_desktop));
+    }
+
+    QRect screen_rect = screenRect(current_screen_id_);
+    if (screen_rect.isEmpty())
+    {
+        // The selected screen is disconnected.
+        current_screen_id_ = kFullDesktopScreenId;
+        screen_rect = screenRect(current_screen_id_);
+    }
+
+    // If the display bounds have changed then recreate the duplication.
+    if (screen_rect != desktop_rect_)
+        releaseResources();
+
+    if (outputs_.empty())
+    {
+        if (!initialize(screen_rect))
+        {
+            releaseResources();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool CapturerDXGI::initialize(const QRect& screen_rect)
+{
+    Microsoft::WRL::ComPtr<IDXGIFactory1> factory;
+
+    HRESULT hr = CreateDXGIFactory1(IID_PPV_ARGS(factory.GetAddressOf()));
+    if (FAILED(hr))
+    {
+        qWarning("CreateDXGIFactory1 failed: 0x%08X", hr);
+        return false;
+    }
+
+    for (UINT adapter_index = 0;; ++adapter_index)
+    {
+        Microsoft::WRL::ComPtr<IDXGIAdapter1> adapter;
+
+        hr = factory->EnumAdapters1(adapter_index, adapter.GetAddressOf());
+        if (hr == DXGI_ERROR_NOT_FOUND)
+            break;
+
+        if (FAILED(hr))
+        {
+            qWarning("EnumAdapters1 failed: 0x%08X", hr);
+            return false;
+        }
+
+        Microsoft::WRL::ComPtr<ID3D11Device> device;
+        Microsoft::WRL::ComPtr<ID3D11DeviceContext> context;
+
+        hr = D3D11CreateDevice(adapter.Get(),
+                               D3D_DRIVER_TYPE_UNKNOWN,
+                               nullptr,
+                               D3D11_CREATE_DEVICE_BGRA_SUPPORT,
+                               nullptr,
+                               0,
+                               D3D11_SDK_VERSION,
+                               device.GetAddressOf(),
+                               nullptr,
+                               context.GetAddressOf());
+        if (FAILED(hr))
+        {
+            qWarning("D3D11CreateDevice failed: 0x%08X", hr);
+            continue;
+        }
+
+        for (UINT output_index = 0;; ++output_index)
+        {
+            Microsoft::WRL::ComPtr<IDXGIOutput> output;
+
+            hr = adapter->EnumOutputs(output_index, output.GetAddressOf());
+            if (hr == DXGI_ERROR_NOT_FOUND)
+                break;
+
+            if (FAILED(hr))
+            {
+                qWarning("EnumOutputs failed: 0x%08X", hr);
+                return false;
+            }
+
+            DXGI_OUTPUT_DESC output_desc;
+
+            hr = output->GetDesc(&output_desc);
+            if (FAILED(hr))
+            {
+                qWarning("GetDesc failed: 0x%08X", hr);
+                return false;
+            }
+
+            if (!output_desc.AttachedToDesktop)
+                continue;
+
+            // Only the outputs of the selected screen are duplicated.
+            if (!fromRECT(output_desc.DesktopCoordinates).intersects(screen_rect))
+                continue;
+
+            if (output_desc.Rotation != DXGI_MODE_ROTATION_IDENTITY &&
+                output_desc.Rotation != DXGI_MODE_ROTATION_UNSPECIFIED)
+            {
+                qWarning("Rotated outputs are not supported");
+                return false;
+            }
+
+            // IDXGIOutput1 is not available before Windows 8.
+            Microsoft::WRL::ComPtr<IDXGIOutput1> output1;
+
+            hr = output.As(&output1);
+            if (FAILED(hr))
+            {
+                qWarning("IDXGIOutput1 is not supported: 0x%08X", hr);
+                return false;
+            }
+
+            Output item;
+
+            item.device = device;
+            item.context = context;
+            item.rect = fromRECT(output_desc.DesktopCoordinates).translated(-screen_rect.topLeft());
+
+            hr = output1->DuplicateOutput(device.Get(), item.duplication.GetAddressOf());
+            if (FAILED(hr))
+            {
+                qWarning("DuplicateOutput failed: 0x%08X", hr);
+                return false;
+            }
+
+            outputs_.push_back(std::move(item));
+        }
+    }
+
+    if (outputs_.empty())
+    {
+        qWarning("No outputs for duplication");
+        return false;
+    }
+
+    // The texture of the frame is filled by the device of the outputs, so they must be on the
+    // same adapter.
+    bool texture_frames = texture_frames_enabled_;
+
+    for (const auto& output : outputs_)
+    {
+        if (output.device != outputs_.front().device)
+            texture_frames = false;
+    }
+
+    if (texture_frames)
+    {
+        // The consumers of the frame use the device from their threads.
+        Microsoft::WRL::ComPtr<ID3D10Multithread> multithread;
+
+        hr = outputs_.front().device.As(&multithread);
+        if (FAILED(hr))
+        {
+            qWarning("ID3D10Multithread is not supported: 0x%08X", hr);
+            return false;
+        }
+
+        multithread->SetMultithreadProtected(TRUE);
+
+        frame_ = DesktopFrameTexture::create(outputs_.front().device.Get(), screen_rect.size());
+        if (!frame_)
+            return false;
+    }
+    else
+    {
+        for (auto& output : outputs_)
+        {
+            D3D11_TEXTURE2D_DESC texture_desc;
+            memset(&texture_desc, 0, sizeof(texture_desc));
+
+            texture_desc.Width              = output.rect.width();
+            texture_desc.Height             = output.rect.height();
+            texture_desc.MipLevels          = 1;
+            texture_desc.ArraySize          = 1;
+            texture_desc.Format             = DXGI_FORMAT_B8G8R8A8_UNORM;
+            texture_desc.SampleDesc.Count   = 1;
+            texture_desc.Usage              = D3D11_USAGE_STAGING;
+            texture_desc.CPUAccessFlags     = D3D11_CPU_ACCESS_READ;
+
+            hr = output.device->CreateTexture2D(&texture_desc, nullptr,
+                                                output.staging_texture.GetAddressOf());
+            if (FAILED(hr))
+            {
+                qWarning("CreateTexture2D failed: 0x%08X", hr);
+                return false;
+            }
+        }
+
+        frame_ = DesktopFrameAligned::create(screen_rect.size(), PixelFormat::ARGB());
+        if (!frame_)
+            return false;
+
+        // The areas of the virtual screen which are not covered by any output stay black.
+        memset(frame_->frameData(), 0, frame_->stride() * frame_->size().height());
+    }
+
+    desktop_rect_ = screen_rect;
+    return true;
+}
+
+void CapturerDXGI::enableTextureFrames(bool enable)
+{
+    if (enable == texture_frames_enabled_)
+        return;
+
+    texture_frames_enabled_ = enable;
+
+    // The frame and the staging textures are created again with the next capture.
+    releaseResources();
+}
+
+void CapturerDXGI::releaseResources()
+{
+    outputs_.clear();
+    frame_.reset();
+    desktop_rect_ = QRect();
+}
+
+const DesktopFrame* CapturerDXGI::captureImage()
+{
+    // If access to the duplication is lost (a desktop switch, a mode change or a full-screen
+    // application), then the resources are created again and the capture is repeated once.
+    for (int attempt = 0; attempt < 2; ++attempt)
+    {
+        if (!prepareCaptureResources())
+            return nullptr;
+
+        *frame_->mutableUpdatedRegion() = QRegion();
+        frame_->mutableMoveRects()->clear();
+
+        bool succeeded = true;
+
+        for (auto& output : outputs_)
+        {
+            if (!captureOutput(&output))
+            {
+                succeeded = false;
+                break;
+            }
+        }
+
+        if (succeeded)
+            return frame_.get();
+
+        releaseResources();
+    }
+
+    return nullptr;
+}
+
+bool CapturerDXGI::captureOutput(Output* output)
+{
+    DXGI_OUTDUPL_FRAME_INFO frame_info;
+    Microsoft::WRL::ComPtr<IDXGIResource> resource;
+
+    const UINT timeout = output->full_frame_required ? kFullFrameTimeout : 0;
+
+    HRESULT hr = output->duplication->AcquireNextFrame(timeout,
+                                                        &frame_info,
+                                                        resource.GetAddressOf());
+    if (hr == DXGI_ERROR_WAIT_TIMEOUT)
+    {
+        // The output has not been changed since the previous frame.
+        return true;
+    }
+
+    if (FAILED(hr))
+    {
+        qWarning("AcquireNextFrame failed: 0x%08X", hr);
+        return false;
+    }
+
+    bool result = processFrame(output, frame_info, resource.Get());
+
+    output->duplication->ReleaseFrame();
+    return result;
+}
+
+bool CapturerDXGI::processFrame(Output* output,
+                                const DXGI_OUTDUPL_FRAME_INFO& frame_info,
+                                IDXGIResource* resource)
+{
+    // If only the mouse pointer was updated, then there is nothing to copy.
+    if (!output->full_frame_required && frame_info.LastPresentTime.QuadPart == 0)
+        return true;
+
+    Microsoft::WRL::ComPtr<ID3D11Texture2D> texture;
+
+    HRESULT hr = resource->QueryInterface(IID_PPV_ARGS(texture.GetAddressOf()));
+    if (FAILED(hr))
+    {
+        qWarning("QueryInterface for ID3D11Texture2D failed: 0x%08X", hr);
+        return false;
+    }
+
+    const QRect output_rect(QPoint(), output->rect.size());
+    QVector<QRect> rects;
+
+    // Number of the rectangles at the beginning of |rects| which are reported as moves and
+    // must not be added to the updated region.
+    int moved_rects_count = 0;
+
+    if (output->full_frame_required)
+    {
+        rects.push_back(output_rect);
+    }
+    else if (frame_info.TotalMetadataBufferSize != 0)
+    {
+        if (output->metadata.size() < frame_info.TotalMetadataBufferSize)
+            output->metadata.resize(frame_info.TotalMetadataBufferSize);
+
+        const UINT metadata_size = static_cast<UINT>(output->metadata.size());
+        UINT move_rects_size = 0;
+
+        hr = output->duplication->GetFrameMoveRects(
+            metadata_size,
+            reinterpret_cast<DXGI_OUTDUPL_MOVE_RECT*>(output->metadata.data()),
+            &move_rects_size);
+        if (FAILED(hr))
+        {
+            qWarning("GetFrameMoveRects failed: 0x%08X", hr);
+            return false;
+        }
+
+        UINT dirty_rects_size = 0;
+
+        hr = output->duplication->GetFrameDirtyRects(
+            metadata_size - move_rects_size,
+            reinterpret_cast<RECT*>(output->metadata.data() + move_rects_size),
+            &dirty_rects_size);
+        if (FAILED(hr))
+        {
+            qWarning("GetFrameDirtyRects failed: 0x%08X", hr);
+            return false;
+        }
+
+        const DXGI_OUTDUPL_MOVE_RECT* move_rects =
+            reinterpret_cast<const DXGI_OUTDUPL_MOVE_RECT*>(output->metadata.data());
+        const size_t move_rects_count = move_rects_size / sizeof(DXGI_OUTDUPL_MOVE_RECT);
+
+        // The moves must be applied in order. If one of them can not be reported, then the
+        // following are sent as the dirty rectangles too.
+        bool report_moves = move_detection_enabled_;
+
+        // The desktop texture already contains the moved pixels, so only the destination
+        // rectangle of the move needs to be copied.
+        for (size_t i = 0; i < move_rects_count; ++i)
+        {
+            const QRect target = fromRECT(move_rects[i].DestinationRect);
+            const QPoint source(move_rects[i].SourcePoint.x, move_rects[i].SourcePoint.y);
+
+            if (!output_rect.contains(target) ||
+                !output_rect.contains(QRect(source, target.size())))
+            {
+                report_moves = false;
+            }
+
+            if (report_moves)
+            {
+                DesktopFrame::MoveRect move_rect;
+
+                move_rect.source = source + output->rect.topLeft();
+                move_rect.target = target.translated(output->rect.topLeft());
+
+                frame_->mutableMoveRects()->push_back(move_rect);
+
+                // The pixels are copied, but the rectangle is not added to the updated region.
+                rects.insert(moved_rects_count++, target);
+                continue;
+            }
+
+            rects.push_back(target);
+        }
+
+        const RECT* dirty_rects =
+            reinterpret_cast<const RECT*>(output->metadata.data() + move_rects_size);
+        const size_t dirty_rects_count = dirty_rects_size / sizeof(RECT);
+
+        for (size_t i = 0; i < dirty_rects_count; ++i)
+            rects.push_back(fromRECT(dirty_rects[i]));
+    }
+
+    if (rects.isEmpty())
+        return true;
+
+    DesktopFrameTexture* texture_frame = frame_->texture() ?
+        static_cast<DesktopFrameTexture*>(frame_.get()) : nullptr;
+
+    // Copy only the changed areas from the desktop texture to the staging texture or, if the
+    // frame is in the video memory, to the texture of the frame.
+    for (auto& rect : rects)
+    {
+        rect = rect.intersected(output_rect);
+        if (rect.isEmpty())
+            continue;
+
+        if (texture_frame)
+        {
+            texture_frame->copyTextureRect(texture.Get(), rect,
+                                           rect.topLeft() + output->rect.topLeft());
+            continue;
+        }
+
+        D3D11_BOX box;
+
+        box.left   = rect.x();
+        box.top    = rect.y();
+        box.right  = rect.x() + rect.width();
+        box.bottom = rect.y() + rect.height();
+        box.front  = 0;
+        box.back   = 1;
+
+        output->context->CopySubresourceRegion(output->staging_texture.Get(), 0,
+                                               rect.x(), rect.y(), 0,
+                                               texture.Get(), 0,
+                                               &box);
+    }
+
+    QRegion* updated_region = frame_->mutableUpdatedRegion();
+
+    if (texture_frame)
+    {
+        for (int i = moved_rects_count; i < rects.size(); ++i)
+            *updated_region += rects[i].translated(output->rect.topLeft());
+
+        output->full_frame_required = false;
+        return true;
+    }
+
+    D3D11_MAPPED_SUBRESOURCE mapped;
+
+    hr = output->context->Map(output->staging_texture.Get(), 0, D3D11_MAP_READ, 0, &mapped);
+    if (FAILED(hr))
+    {
+        qWarning("Map failed: 0x%08X", hr);
+        return false;
+    }
+
+    for (int i = 0; i < rects.size(); ++i)
+    {
+        const QRect& rect = rects[i];
+        if (rect.isEmpty())
+            continue;
+
+        const QRect frame_rect = rect.translated(output->rect.topLeft());
+        const int row_size = rect.width() * kBytesPerPixel;
+
+        const quint8* src = reinterpret_cast<const quint8*>(mapped.pData) +
+            mapped.RowPitch * rect.y() + rect.x() * kBytesPerPixel;
+        quint8* dst = frame_->frameDataAtPos(frame_rect.topLeft());
+
+        for (int y = 0; y < rect.height(); ++y)
+        {
+            memcpy(dst, src, row_size);
+
+            src += mapped.RowPitch;
+            dst += frame_->stride();
+        }
+
+        if (i >= moved_rects_count)
+            *updated_region += frame_rect;
+    }
+
+    output->context->Unmap(output->staging_texture.Get(), 0);
+    output->full_frame_required = false;
+
+    return true;
+}
+
+QRegion CapturerDXGI::focusRegion() const
+{
+    return screenFocusRegion(desktop_rect_, kCursorFocusSize);
+}
+
+} // namespace aspia
@@ -0,0 +1,91 @@
+//
+// PROJECT:         Aspia
+// FILE:            desktop_capture/capturer_dxgi.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_DESKTOP_CAPTURE__CAPTURER_DXGI_H
+#define _ASPIA_DESKTOP_CAPTURE__CAPTURER_DXGI_H
+
+#include "desktop_capture/capturer.h"
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <d3d11.h>
+#include <dxgi1_2.h>
+#include <wrl/client.h>
+
+#include <vector>
+
+#include "desktop_capture/desktop_frame_aligned.h"
+#include "desktop_capture/desktop_frame_texture.h"
+#include "desktop_capture/win/scoped_thread_desktop.h"
+
+namespace aspia {
+
+//
+// Capturer based on the Desktop Duplication API (Windows 8 and later).
+// The updated region of the frame is filled from the dirty and move rectangles
+// reported by the operating system, so a full-frame diff is not required.
+//
+class CapturerDXGI : public Capturer
+{
+public:
+    ~CapturerDXGI() = default;
+
+    // Returns nullptr if the Desktop Duplication API is not available.
+    static std::unique_ptr<CapturerDXGI> create();
+
+    const DesktopFrame* captureImage() override;
+    QRegion focusRegion() const override;
+
+    // If enabled, then the frames are DesktopFrameTexture and their pixels are not copied to
+    // the memory. If the outputs of the screen are on different adapters, then the frames are
+    // in the memory anyway.
+    void enableTextureFrames(bool enable);
+
+private:
+    struct Output
+    {
+        Microsoft::WRL::ComPtr<ID3D11Device> device;
+        Microsoft::WRL::ComPtr<ID3D11DeviceContext> context;
+        Microsoft::WRL::ComPtr<IDXGIOutputDuplication> duplication;
+
+        // Not created if the frame is in the video memory.
+        Microsoft::WRL::ComPtr<ID3D11Texture2D> staging_texture;
+
+        // Output rectangle relative to the top-left corner of the virtual screen.
+        QRect rect;
+
+        // Buffer for the move and dirty rectangles of the frame.
+        std::vector<quint8> metadata;
+
+        // If true, then the next frame is copied entirely.
+        bool full_frame_required = true;
+    };
+
+    CapturerDXGI();
+
+    bool prepareCaptureResources();
+    bool initialize(const QRect& screen_rect);
+    void releaseResources();
+    bool captureOutput(Output* output);
+    bool processFrame(Output* output,
+                      const DXGI_OUTDUPL_FRAME_INFO& frame_info,
+                      IDXGIResource* resource);
+
+    ScopedThreadDesktop desktop_;
+    QRect desktop_rect_;
+
+    std::vector<Output> outputs_;
+    std::unique_ptr<DesktopFrame> frame_;
+
+    bool texture_frames_enabled_ = false;
+
+    Q_DISABLE_COPY(CapturerDXGI)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_DESKTOP_CAPTURE__CAPTURER_DXGI_H
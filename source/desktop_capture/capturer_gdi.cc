@@ -10,295 +10,150 @@
 #include <QDebug>
 #include <dwmapi.h>
 
+#include "base/trace_logger.h"
+#include "desktop_capture/win/screen_capture_utils.h"
+
 namespace aspia {
 
 namespace {
 
-constexpr quint32 RGBA(quint32 r, quint32 g, quint32 b, quint32 a)
-{
-    return (((a << 24) & 0xFF000000) | ((b << 16) & 0xFF0000) | ((g << 8) & 0xFF00) | (r & 0xFF));
-}
+// The whole screen is copied at least this often. Between the full copies only the areas near
+// the recent changes, the cursor and the foreground window are copied.
+constexpr std::chrono::milliseconds kFullBlitInterval(250);
 
-constexpr int kBytesPerPixel = 4;
+// The input desktop and the bounds of the screen are checked this often. The switches to the
+// secure desktop and the display changes are rare, and each check costs several system calls.
+constexpr std::chrono::milliseconds kResourceCheckInterval(200);
 
-// Pixel colors used when generating cursor outlines.
-constexpr quint32 kPixelRgbaBlack       = RGBA(0,    0,    0,    0xFF);
-constexpr quint32 kPixelRgbaWhite       = RGBA(0xFF, 0xFF, 0xFF, 0xFF);
-constexpr quint32 kPixelRgbaTransparent = RGBA(0,    0,    0,    0);
+// Margin around the changes of the previous frame which is copied too.
+const int kHintMargin = 32;
 
-constexpr quint32 kPixelRgbWhite = RGB(0xFF, 0xFF, 0xFF);
+// Size of the area around the cursor which is copied.
+const int kCursorHintSize = 128;
 
-// Scans a 32bpp bitmap looking for any pixels with non-zero alpha component.
-// Returns true if non-zero alpha is found. |stride| is expressed in pixels.
-bool hasAlphaChannel(const quint32* data, int width, int height)
-{
-    const RGBQUAD* plane = reinterpret_cast<const RGBQUAD*>(data);
+// Size of the area around the cursor which is encoded with a better quality.
+const int kCursorFocusSize = 256;
 
-    for (int y = 0; y < height; ++y)
-    {
-        for (int x = 0; x < width; ++x)
-        {
-            if (plane->rgbReserved != 0)
-                return true;
+// If the hinted area is larger than 1/kMaxHintRatio of the screen, then the whole screen is
+// copied.
+const int kMaxHintRatio = 2;
 
-            ++plane;
-        }
-    }
+void copyFrameRect(const DesktopFrame* source, DesktopFrame* target, const QRect& rect)
+{
+    const int row_size = rect.width() * source->format().bytesPerPixel();
 
-    return false;
-}
+    const quint8* src = source->frameDataAtPos(rect.topLeft());
+    quint8* dst = target->frameDataAtPos(rect.topLeft());
 
-// Expands the cursor shape to add a white outline for visibility against
-// dark backgrounds.
-void addCursorOutline(int width, int height, quint32* data)
-{
-    for (int y = 0; y < height; ++y)
+    for (int y = 0; y < rect.height(); ++y)
     {
-        for (int x = 0; x < width; ++x)
-        {
-            // If this is a transparent pixel (bgr == 0 and alpha = 0), check
-            // the neighbor pixels to see if this should be changed to an
-            // outline pixel.
-            if (*data == kPixelRgbaTransparent)
-            {
-                // Change to white pixel if any neighbors (top, bottom, left,
-                // right) are black.
-                if ((y > 0 && data[-width] == kPixelRgbaBlack) ||
-                    (y < height - 1 && data[width] == kPixelRgbaBlack) ||
-                    (x > 0 && data[-1] == kPixelRgbaBlack) ||
-                    (x < width - 1 && data[1] == kPixelRgbaBlack))
-                {
-                    *data = kPixelRgbaWhite;
-                }
-            }
+        memcpy(dst, src, row_size);
 
-            ++data;
-        }
+        src += source->stride();
+        dst += target->stride();
     }
 }
 
-// Premultiplies RGB components of the pixel data in the given image by
-// the corresponding alpha components.
-void alphaMul(quint32* data, int width, int height)
+qint64 regionArea(const QRegion& region)
 {
-    static_assert(sizeof(quint32) == kBytesPerPixel,
-                  "size of uint32 should be the number of bytes per pixel");
+    qint64 area = 0;
 
-    for (quint32* data_end = data + width * height; data != data_end; ++data)
-    {
-        RGBQUAD* from = reinterpret_cast<RGBQUAD*>(data);
-        RGBQUAD* to = reinterpret_cast<RGBQUAD*>(data);
+    for (const auto& rect : region)
+        area += static_cast<qint64>(rect.width()) * rect.height();
 
-        to->rgbBlue  = (static_cast<quint16>(from->rgbBlue)  * from->rgbReserved) / 0xFF;
-        to->rgbGreen = (static_cast<quint16>(from->rgbGreen) * from->rgbReserved) / 0xFF;
-        to->rgbRed   = (static_cast<quint16>(from->rgbRed)   * from->rgbReserved) / 0xFF;
-    }
+    return area;
 }
 
-// Converts an HCURSOR into a |MouseCursor| instance.
-std::unique_ptr<MouseCursor> createMouseCursorFromHCursor(HDC dc, HCURSOR cursor)
-{
-    ICONINFO icon_info = { 0 };
-
-    if (!GetIconInfo(cursor, &icon_info))
-    {
-        qWarning("GetIconInfo failed");
-        return nullptr;
-    }
-
-    // Make sure the bitmaps will be freed.
-    ScopedHBITMAP scoped_mask(icon_info.hbmMask);
-    ScopedHBITMAP scoped_color(icon_info.hbmColor);
+} // namespace
 
-    bool is_color = (icon_info.hbmColor != nullptr);
+CapturerGDI::CapturerGDI() = default;
 
-    // Get |scoped_mask| dimensions.
-    BITMAP bitmap_info;
+// static
+std::unique_ptr<CapturerGDI> CapturerGDI::create()
+{
+    return std::unique_ptr<CapturerGDI>(new CapturerGDI());
+}
 
-    if (!GetObjectW(scoped_mask, sizeof(bitmap_info), &bitmap_info))
-    {
-        qWarning("GetObjectW failed");
-        return nullptr;
-    }
+// static
+bool CapturerGDI::isSupportedPixelFormat(const PixelFormat& format)
+{
+    // The masks of the DIB sections of 16 bits are limited to RGB555 and RGB565. The colours of
+    // 8-bit formats are set by the colour table.
+    return format == PixelFormat::ARGB() || format == PixelFormat::RGB565() ||
+           format.bitsPerPixel() == 8;
+}
 
-    int width = bitmap_info.bmWidth;
-    int height = bitmap_info.bmHeight;
-
-    std::unique_ptr<quint32[]> mask_data = std::make_unique<quint32[]>(width * height);
-
-    // Get pixel data from |scoped_mask| converting it to 32bpp along the way.
-    // GetDIBits() sets the alpha component of every pixel to 0.
-    BITMAPV5HEADER bmi = { 0 };
-
-    bmi.bV5Size        = sizeof(bmi);
-    bmi.bV5Width       = width;
-    bmi.bV5Height      = -height; // request a top-down bitmap.
-    bmi.bV5Planes      = 1;
-    bmi.bV5BitCount    = kBytesPerPixel * 8;
-    bmi.bV5Compression = BI_RGB;
-    bmi.bV5AlphaMask   = 0xFF000000;
-    bmi.bV5CSType      = LCS_WINDOWS_COLOR_SPACE;
-    bmi.bV5Intent      = LCS_GM_BUSINESS;
-
-    if (!GetDIBits(dc,
-                   scoped_mask,
-                   0,
-                   height,
-                   mask_data.get(),
-                   reinterpret_cast<BITMAPINFO*>(&bmi),
-                   DIB_RGB_COLORS))
-    {
-        qWarning("GetDIBits failed");
-        return nullptr;
-    }
+void CapturerGDI::setPixelFormat(const PixelFormat& format)
+{
+    Q_ASSERT(isSupportedPixelFormat(format));
 
-    uint32_t* mask_plane = mask_data.get();
+    if (format == pixel_format_)
+        return;
 
-    std::unique_ptr<quint8[]> image;
-    size_t image_size;
+    pixel_format_ = format;
 
-    bool has_alpha = false;
+    // The frames are created again with the next capture.
+    desktop_dc_.reset();
+    memory_dc_.reset();
 
-    if (is_color)
-    {
-        image_size = width * height * kBytesPerPixel;
-        image = std::make_unique<quint8[]>(image_size);
-
-        // Get the pixels from the color bitmap.
-        if (!GetDIBits(dc,
-                       scoped_color,
-                       0,
-                       height,
-                       image.get(),
-                       reinterpret_cast<BITMAPINFO*>(&bmi),
-                       DIB_RGB_COLORS))
-        {
-            qWarning("GetDIBits failed");
-            return nullptr;
-        }
+    for (int i = 0; i < kNumFrames; ++i)
+        frame_[i].reset();
+}
 
-        // GetDIBits() does not provide any indication whether the bitmap has
-        // alpha channel, so we use HasAlphaChannel() below to find it out.
-        has_alpha = hasAlphaChannel(reinterpret_cast<const quint32*>(image.get()), width, height);
-    }
-    else
-    {
-        // For non-color cursors, the mask contains both an AND and an XOR mask
-        // and the height includes both. Thus, the width is correct, but we
-        // need to divide by 2 to get the correct mask height.
-        height /= 2;
+bool CapturerGDI::prepareCaptureResources()
+{
+    const Clock::time_point now = Clock::now();
 
-        image_size = width * height * kBytesPerPixel;
-        image = std::make_unique<quint8[]>(image_size);
+    // The failed copy from the screen usually means that the input desktop is switched, then
+    // the next frame checks the resources at once.
+    const bool check_required = !desktop_dc_ || resource_check_required_ ||
+        current_screen_id_ != checked_screen_id_ ||
+        now - last_resource_check_time_ >= kResourceCheckInterval;
 
-        // The XOR mask becomes the color bitmap.
-        memcpy(image.get(), mask_plane + (width * height), image_size);
-    }
+    // The selected window may be moved at any moment, so its bounds are checked every frame.
+    if (!check_required && !isWindowScreen(current_screen_id_))
+        return true;
 
-    //
-    // Reconstruct transparency from the mask if the color image does not has
-    // alpha channel.
-    //
-    if (!has_alpha)
+    if (check_required)
     {
-        bool add_outline = false;
-        quint32* dst = reinterpret_cast<quint32*>(image.get());
-        quint32* mask = mask_plane;
+        last_resource_check_time_ = now;
+        resource_check_required_ = false;
 
-        for (int y = 0; y < height; ++y)
-        {
-            for (int x = 0; x < width; ++x)
-            {
-                // The two bitmaps combine as follows:
-                //  mask  color   Windows Result   Our result    RGB   Alpha
-                //   0     00      Black            Black         00    ff
-                //   0     ff      White            White         ff    ff
-                //   1     00      Screen           Transparent   00    00
-                //   1     ff      Reverse-screen   Black         00    ff
-                //
-                // Since we don't support XOR cursors, we replace the "Reverse
-                // Screen" with black. In this case, we also add an outline
-                // around the cursor so that it is visible against a dark
-                // background.
-                if (*mask == kPixelRgbWhite)
-                {
-                    if (*dst != 0)
-                    {
-                        add_outline = true;
-                        *dst = kPixelRgbaBlack;
-                    }
-                    else
-                    {
-                        *dst = kPixelRgbaTransparent;
-                    }
-                }
-                else
-                {
-                    *dst = kPixelRgbaBlack ^ *dst;
-                }
-
-                ++dst;
-                ++mask;
-            }
-        }
+        // Switch to the desktop receiving user input if different from the
+        // current one.
+        Desktop input_desktop(Desktop::inputDesktop());
 
-        if (add_outline)
+        if (input_desktop.isValid() && !desktop_.isSame(input_desktop))
         {
-            addCursorOutline(width, height, reinterpret_cast<quint32*>(image.get()));
+            // Release GDI resources otherwise SetThreadDesktop will fail. The frames do not
+            // belong to the desktop and are kept.
+            desktop_dc_.reset();
+            memory_dc_.reset();
+
+            // If SetThreadDesktop() fails, the thread is still assigned a desktop.
+            // So we can continue capture screen bits, just from the wrong desktop.
+            desktop_.setThreadDesktop(std::move(input_desktop));
         }
     }
 
-    // Pre-multiply the resulting pixels since MouseCursor uses premultiplied
-    // images.
-    alphaMul(reinterpret_cast<quint32*>(image.get()), width, height);
-
-    return MouseCursor::create(std::move(image),
-                               QSize(width, height),
-                               QPoint(icon_info.xHotspot, icon_info.yHotspot));
-}
-
-bool isSameCursorShape(const CURSORINFO& left, const CURSORINFO& right)
-{
-    // If the cursors are not showing, we do not care the hCursor handle.
-    return left.flags == right.flags && (left.flags != CURSOR_SHOWING ||
-                                         left.hCursor == right.hCursor);
-}
-
-} // namespace
-
-CapturerGDI::CapturerGDI()
-{
-    memset(&prev_cursor_info_, 0, sizeof(prev_cursor_info_));
-}
-
-// static
-std::unique_ptr<CapturerGDI> CapturerGDI::create()
-{
-    return std::unique_ptr<CapturerGDI>(new CapturerGDI());
-}
+    QRect screen_rect = screenRect(current_screen_id_);
+    if (screen_rect.isEmpty())
+    {
+        // The selected screen is disconnected.
+        current_screen_id_ = kFullDesktopScreenId;
+        screen_rect = screenRect(current_screen_id_);
+    }
 
-bool CapturerGDI::prepareCaptureResources()
-{
-    // Switch to the desktop receiving user input if different from the
-    // current one.
-    Desktop input_desktop(Desktop::inputDesktop());
+    checked_screen_id_ = current_screen_id_;
 
-    if (input_desktop.isValid() && !desktop_.isSame(input_desktop))
+    // The moved window is copied from the new position to the same frames. The whole frame is
+    // copied, so the differ finds the changes.
+    if (screen_rect.size() == desktop_dc_rect_.size() && screen_rect != desktop_dc_rect_)
     {
-        // Release GDI resources otherwise SetThreadDesktop will fail.
-        desktop_dc_.reset();
-        memory_dc_.reset();
-
-        // If SetThreadDesktop() fails, the thread is still assigned a desktop.
-        // So we can continue capture screen bits, just from the wrong desktop.
-        desktop_.setThreadDesktop(std::move(input_desktop));
+        desktop_dc_rect_ = screen_rect;
+        last_full_blit_time_ = Clock::time_point();
     }
 
-    QRect screen_rect(GetSystemMetrics(SM_XVIRTUALSCREEN),
-                      GetSystemMetrics(SM_YVIRTUALSCREEN),
-                      GetSystemMetrics(SM_CXVIRTUALSCREEN),
-                      GetSystemMetrics(SM_CYVIRTUALSCREEN));
-
     // If the display bounds have changed then recreate GDI resources.
     if (screen_rect != desktop_dc_rect_)
     {
@@ -328,16 +183,33 @@ bool CapturerGDI::prepareCaptureResources()
 
         desktop_dc_rect_ = screen_rect;
 
-        for (int i = 0; i < kNumFrames; ++i)
+        // The content of the screen is unknown after the switch of the desktop, so the whole
+        // screen is copied. The differ finds the changes.
+        last_full_blit_time_ = Clock::time_point();
+
+        // The DIB sections do not depend on the desktop, so the switches to the secure desktop
+        // and back do not create the frames and the differ again.
+        if (!frame_[0] || frame_[0]->size() != screen_rect.size())
         {
-            frame_[i] = DesktopFrameDIB::create(screen_rect.size(),
-                                                PixelFormat::ARGB(),
-                                                memory_dc_);
-            if (!frame_[i])
-                return false;
-        }
+            for (int i = 0; i < kNumFrames; ++i)
+            {
+                frame_[i] = DesktopFrameDIB::create(screen_rect.size(),
+                                                    pixel_format_,
+                                                    memory_dc_);
+                if (!frame_[i])
+                    return false;
+            }
+
+            const int bytes_per_pixel = pixel_format_.bytesPerPixel();
+            const int bytes_per_row = frame_[0]->stride();
+
+            differ_ = std::make_unique<Differ>(screen_rect.size(), bytes_per_pixel, bytes_per_row);
+            scroll_detector_ = std::make_unique<ScrollDetector>(
+                screen_rect.size(), bytes_per_pixel, bytes_per_row);
 
-        differ_ = std::make_unique<Differ>(screen_rect.size());
+            // The new frames have nothing in common with the previous ones.
+            full_frame_required_ = true;
+        }
     }
 
     return true;
@@ -355,62 +227,104 @@ const DesktopFrame* CapturerGDI::captureImage()
     DesktopFrameDIB* prev_frame = frame_[prev_frame_id].get();
     DesktopFrameDIB* curr_frame = frame_[curr_frame_id_].get();
 
+    const QRect frame_rect(QPoint(), curr_frame->size());
+    QRegion blit_region(frame_rect);
+
+    const Clock::time_point now = Clock::now();
+
+    if (!full_frame_required_ && now - last_full_blit_time_ < kFullBlitInterval)
+    {
+        QRegion hint_region = hintRegion(prev_frame);
+
+        if (regionArea(hint_region) * kMaxHintRatio < regionArea(blit_region))
+        {
+            // The buffer contains the frame before the previous one. The changes of the
+            // previous frame bring it up to date, so only the hinted areas are copied from
+            // the screen.
+            for (const auto& move_rect : prev_frame->moveRects())
+                copyFrameRect(prev_frame, curr_frame, move_rect.target);
+
+            for (const auto& rect : prev_frame->updatedRegion())
+                copyFrameRect(prev_frame, curr_frame, rect);
+
+            blit_region = hint_region;
+        }
+    }
+
+    if (blit_region == QRegion(frame_rect))
+        last_full_blit_time_ = now;
+
     HGDIOBJ old_bitmap = SelectObject(memory_dc_, curr_frame->bitmap());
     if (old_bitmap)
     {
-        BitBlt(memory_dc_,
-               0, 0,
-               curr_frame->size().width(),
-               curr_frame->size().height(),
-               *desktop_dc_,
-               desktop_dc_rect_.x(),
-               desktop_dc_rect_.y(),
-               CAPTUREBLT | SRCCOPY);
+        ScopedTrace trace("blit");
+
+        for (const auto& rect : blit_region)
+        {
+            if (!BitBlt(memory_dc_,
+                        rect.x(), rect.y(),
+                        rect.width(),
+                        rect.height(),
+                        *desktop_dc_,
+                        desktop_dc_rect_.x() + rect.x(),
+                        desktop_dc_rect_.y() + rect.y(),
+                        CAPTUREBLT | SRCCOPY))
+            {
+                resource_check_required_ = true;
+            }
+        }
 
         SelectObject(memory_dc_, old_bitmap);
     }
 
-    differ_->calcDirtyRegion(prev_frame->frameData(),
-                             curr_frame->frameData(),
-                             curr_frame->mutableUpdatedRegion());
+    curr_frame->mutableMoveRects()->clear();
+
+    if (full_frame_required_)
+    {
+        *curr_frame->mutableUpdatedRegion() = QRect(QPoint(), curr_frame->size());
+        full_frame_required_ = false;
+    }
+    else
+    {
+        differ_->calcDirtyRegion(prev_frame->frameData(),
+                                 curr_frame->frameData(),
+                                 curr_frame->mutableUpdatedRegion());
+
+        if (move_detection_enabled_)
+        {
+            scroll_detector_->detect(prev_frame->frameData(),
+                                     curr_frame->frameData(),
+                                     curr_frame->mutableUpdatedRegion(),
+                                     curr_frame->mutableMoveRects());
+        }
+    }
 
     curr_frame_id_ = prev_frame_id;
 
     return curr_frame;
 }
 
-std::unique_ptr<MouseCursor> CapturerGDI::captureCursor()
+QRegion CapturerGDI::hintRegion(const DesktopFrame* prev_frame) const
 {
-    CURSORINFO cursor_info = { 0 };
+    const QRect frame_rect(QPoint(), prev_frame->size());
+    const QMargins margins(kHintMargin, kHintMargin, kHintMargin, kHintMargin);
 
-    // Note: cursor_info.hCursor does not need to be freed.
-    cursor_info.cbSize = sizeof(cursor_info);
-    if (GetCursorInfo(&cursor_info))
-    {
-        if (!isSameCursorShape(cursor_info, prev_cursor_info_))
-        {
-            if (cursor_info.flags == 0)
-            {
-                // Host machine does not have a hardware mouse attached, we
-                // will send a default one instead.
-                // Note, Windows automatically caches cursor resource, so we
-                // do not need to cache the result of LoadCursor.
-                cursor_info.hCursor = LoadCursorW(nullptr, IDC_ARROW);
-            }
+    QRegion region;
 
-            std::unique_ptr<MouseCursor> mouse_cursor =
-                createMouseCursorFromHCursor(*desktop_dc_, cursor_info.hCursor);
+    for (const auto& move_rect : prev_frame->moveRects())
+        region += move_rect.target.marginsAdded(margins);
 
-            if (mouse_cursor)
-            {
-                prev_cursor_info_ = cursor_info;
-            }
+    for (const auto& rect : prev_frame->updatedRegion())
+        region += rect.marginsAdded(margins);
 
-            return mouse_cursor;
-        }
-    }
+    region += screenFocusRegion(desktop_dc_rect_, kCursorHintSize);
 
-    return nullptr;
+    return region.intersected(frame_rect);
+}
+
+QRegion CapturerGDI::focusRegion() const
+{
+    return screenFocusRegion(desktop_dc_rect_, kCursorFocusSize);
 }
 
 } // namespace aspia
@@ -10,9 +10,12 @@
 
 #include "desktop_capture/capturer.h"
 
+#include <chrono>
+
 #include "base/win/scoped_hdc.h"
 #include "desktop_capture/desktop_frame_dib.h"
 #include "desktop_capture/differ.h"
+#include "desktop_capture/scroll_detector.h"
 #include "desktop_capture/win/scoped_thread_desktop.h"
 
 namespace aspia {
@@ -25,18 +28,33 @@ public:
     static std::unique_ptr<CapturerGDI> create();
 
     const DesktopFrame* captureImage() override;
-    std::unique_ptr<MouseCursor> captureCursor() override;
+    QRegion focusRegion() const override;
+
+    // Returns true if the frames can be captured in |format|: ARGB, RGB565 or an 8-bit format.
+    static bool isSupportedPixelFormat(const PixelFormat& format);
+
+    // The frames are captured in ARGB by default. The encoders of the low colour depths take
+    // the frames in their format without the translation, and the differ reads less memory.
+    void setPixelFormat(const PixelFormat& format);
 
 private:
     typedef HRESULT(WINAPI * DwmEnableCompositionFunc)(UINT);
 
+    typedef std::chrono::steady_clock Clock;
+
     CapturerGDI();
     bool prepareCaptureResources();
 
+    // Returns the areas of the screen which have probably changed since the previous frame.
+    QRegion hintRegion(const DesktopFrame* prev_frame) const;
+
     ScopedThreadDesktop desktop_;
     QRect desktop_dc_rect_;
 
+    PixelFormat pixel_format_ = PixelFormat::ARGB();
+
     std::unique_ptr<Differ> differ_;
+    std::unique_ptr<ScrollDetector> scroll_detector_;
     std::unique_ptr<ScopedGetDC> desktop_dc_;
     ScopedCreateDC memory_dc_;
 
@@ -45,7 +63,15 @@ private:
 
     std::unique_ptr<DesktopFrameDIB> frame_[kNumFrames];
 
-    CURSORINFO prev_cursor_info_;
+    // If true, then the next frame is reported as changed entirely.
+    bool full_frame_required_ = true;
+
+    Clock::time_point last_full_blit_time_;
+
+    // The input desktop and the bounds of the screen are not checked for every frame.
+    Clock::time_point last_resource_check_time_;
+    ScreenId checked_screen_id_ = kFullDesktopScreenId;
+    bool resource_check_required_ = false;
 
     Q_DISABLE_COPY(CapturerGDI)
 };
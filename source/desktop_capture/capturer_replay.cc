@@ -0,0 +1,303 @@
+//
+// PROJECT:         Aspia
+// FILE:            desktop_capture/capturer_replay.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "desktop_capture/capturer_replay.h"
+
+#include <QDebug>
+
+#include <thread>
+#include <vector>
+
+#include "desktop_capture/frame_recorder.h"
+
+namespace aspia {
+
+namespace {
+
+constexpr int kMaxCursorSize = 256;
+
+} // namespace
+
+CapturerReplay::CapturerReplay(std::unique_ptr<QFile> file, Speed speed)
+    : file_(std::move(file)),
+      stream_(file_.get()),
+      speed_(speed)
+{
+    stream_.setVersion(QDataStream::Qt_5_0);
+    stream_.setByteOrder(QDataStream::LittleEndian);
+}
+
+// static
+std::unique_ptr<CapturerReplay> CapturerReplay::create(const QString& file_path, Speed speed)
+{
+    std::unique_ptr<QFile> file = std::make_unique<QFile>(file_path);
+
+    if (!file->open(QFile::ReadOnly))
+    {
+        qWarning() << "Unable to open the recording" << file_path << ":" << file->errorString();
+        return nullptr;
+    }
+
+    std::unique_ptr<CapturerReplay> capturer(new CapturerReplay(std::move(file), speed));
+
+    quint32 magic = 0;
+    quint32 version = 0;
+
+    capturer->stream_ >> magic >> version;
+
+    if (magic != FrameRecorder::kMagic || version != FrameRecorder::kVersion)
+    {
+        qWarning() << "The file" << file_path << "is not a recording of a supported version";
+        return nullptr;
+    }
+
+    capturer->start_position_ = capturer->file_->pos();
+    capturer->start_time_ = Clock::now();
+
+    qInfo() << "Replaying the screen from" << file_path;
+    return capturer;
+}
+
+const DesktopFrame* CapturerReplay::captureImage()
+{
+    // A recording without frames is not started again.
+    bool restarted = false;
+
+    while (true)
+    {
+        if (stream_.atEnd())
+        {
+            if (restarted || !restart())
+            {
+                qWarning("The recording does not contain frames");
+                return nullptr;
+            }
+
+            restarted = true;
+        }
+
+        quint8 type = 0;
+        qint64 time = 0;
+
+        stream_ >> type >> time;
+
+        if (stream_.status() != QDataStream::Ok)
+        {
+            qWarning("The recording is truncated");
+            return nullptr;
+        }
+
+        if (type == FrameRecorder::CursorRecord)
+        {
+            if (!readCursor())
+                return nullptr;
+
+            continue;
+        }
+
+        if (type != FrameRecorder::FrameRecord)
+        {
+            qWarning() << "Unknown record type:" << type;
+            return nullptr;
+        }
+
+        if (!readFrame())
+            return nullptr;
+
+        if (speed_ == Speed::ORIGINAL)
+            std::this_thread::sleep_until(start_time_ + std::chrono::milliseconds(time));
+
+        return frame_.get();
+    }
+}
+
+QRegion CapturerReplay::focusRegion() const
+{
+    // The windows are not recorded.
+    return QRegion();
+}
+
+bool CapturerReplay::takeCursor(QPoint* position, std::unique_ptr<MouseCursor>* cursor)
+{
+    if (!cursor_changed_)
+        return false;
+
+    *position = cursor_position_;
+
+    if (cursor_)
+        *cursor = std::move(cursor_);
+
+    cursor_changed_ = false;
+    return true;
+}
+
+bool CapturerReplay::restart()
+{
+    if (!file_->seek(start_position_))
+        return false;
+
+    stream_.resetStatus();
+    start_time_ = Clock::now();
+    return !stream_.atEnd();
+}
+
+bool CapturerReplay::readFrame()
+{
+    bool key = false;
+    QSize size;
+    quint32 move_count = 0;
+
+    stream_ >> key >> size >> move_count;
+
+    if (stream_.status() != QDataStream::Ok || size.isEmpty())
+    {
+        qWarning("Invalid frame of the recording");
+        return false;
+    }
+
+    if (!key && (!frame_ || frame_->size() != size))
+    {
+        qWarning("The frame of the recording refers to a missing frame");
+        return false;
+    }
+
+    if (key)
+    {
+        if (!frame_ || frame_->size() != size)
+        {
+            frame_ = DesktopFrameAligned::create(size, PixelFormat::ARGB());
+            if (!frame_)
+                return false;
+        }
+
+        memset(frame_->frameData(), 0, frame_->stride() * size.height());
+    }
+
+    const QRect frame_rect(QPoint(), size);
+
+    frame_->mutableMoveRects()->clear();
+
+    for (quint32 i = 0; i < move_count; ++i)
+    {
+        DesktopFrame::MoveRect move_rect;
+
+        stream_ >> move_rect.source >> move_rect.target;
+
+        if (!frame_rect.contains(move_rect.target) ||
+            !frame_rect.contains(QRect(move_rect.source, move_rect.target.size())))
+        {
+            qWarning("Invalid moved area of the recording");
+            return false;
+        }
+
+        frame_->copyRect(move_rect.source, move_rect.target);
+        frame_->mutableMoveRects()->push_back(move_rect);
+    }
+
+    quint32 rect_count = 0;
+    stream_ >> rect_count;
+
+    std::vector<QRect> rects;
+    int delta_size = 0;
+
+    for (quint32 i = 0; i < rect_count && stream_.status() == QDataStream::Ok; ++i)
+    {
+        QRect rect;
+        stream_ >> rect;
+
+        if (!frame_rect.contains(rect))
+        {
+            qWarning("Invalid updated area of the recording");
+            return false;
+        }
+
+        rects.push_back(rect);
+        delta_size += rect.width() * rect.height() * 4;
+    }
+
+    QByteArray compressed;
+    stream_ >> compressed;
+
+    if (stream_.status() != QDataStream::Ok)
+    {
+        qWarning("The recording is truncated");
+        return false;
+    }
+
+    delta_buffer_.resize(delta_size);
+
+    if (delta_size && !FrameRecorder::decompress(
+            compressed, reinterpret_cast<quint8*>(delta_buffer_.data()), delta_size))
+    {
+        return false;
+    }
+
+    const quint8* delta = reinterpret_cast<const quint8*>(delta_buffer_.constData());
+    QRegion* updated_region = frame_->mutableUpdatedRegion();
+
+    *updated_region = QRegion();
+
+    for (const auto& rect : rects)
+    {
+        for (int y = rect.top(); y <= rect.bottom(); ++y)
+        {
+            quint8* row = frame_->frameDataAtPos(rect.left(), y);
+
+            for (int x = 0; x < rect.width() * 4; ++x)
+                row[x] ^= delta[x];
+
+            delta += rect.width() * 4;
+        }
+
+        *updated_region += rect;
+    }
+
+    return true;
+}
+
+bool CapturerReplay::readCursor()
+{
+    QPoint position;
+    bool has_shape = false;
+
+    stream_ >> position >> has_shape;
+
+    if (has_shape)
+    {
+        QSize size;
+        QPoint hotspot;
+        QByteArray compressed;
+
+        stream_ >> size >> hotspot >> compressed;
+
+        if (size.isEmpty() || size.width() > kMaxCursorSize || size.height() > kMaxCursorSize)
+        {
+            qWarning("Invalid cursor of the recording");
+            return false;
+        }
+
+        const size_t data_size = size.width() * size.height() * sizeof(quint32);
+        std::unique_ptr<quint8[]> data = std::make_unique<quint8[]>(data_size);
+
+        if (!FrameRecorder::decompress(compressed, data.get(), data_size))
+            return false;
+
+        cursor_ = MouseCursor::create(std::move(data), size, hotspot);
+    }
+
+    if (stream_.status() != QDataStream::Ok)
+    {
+        qWarning("The recording is truncated");
+        return false;
+    }
+
+    cursor_position_ = position;
+    cursor_changed_ = true;
+    return true;
+}
+
+} // namespace aspia
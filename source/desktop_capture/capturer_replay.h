@@ -0,0 +1,78 @@
+//
+// PROJECT:         Aspia
+// FILE:            desktop_capture/capturer_replay.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_DESKTOP_CAPTURE__CAPTURER_REPLAY_H
+#define _ASPIA_DESKTOP_CAPTURE__CAPTURER_REPLAY_H
+
+#include <QDataStream>
+#include <QFile>
+
+#include <chrono>
+#include <memory>
+
+#include "desktop_capture/capturer.h"
+#include "desktop_capture/desktop_frame_aligned.h"
+#include "desktop_capture/mouse_cursor.h"
+
+namespace aspia {
+
+//
+// Replays the recording of FrameRecorder instead of capturing the screen. Each call of
+// captureImage() returns the next recorded frame with its updated region and moved areas.
+// After the last frame the recording is started again from the first one.
+//
+class CapturerReplay : public Capturer
+{
+public:
+    ~CapturerReplay() = default;
+
+    enum class Speed
+    {
+        ORIGINAL, // The frames are returned at the time at which they were recorded.
+        MAXIMUM   // The frames are returned at once.
+    };
+
+    // Returns nullptr if the file can not be opened or is not a recording.
+    static std::unique_ptr<CapturerReplay> create(const QString& file_path, Speed speed);
+
+    const DesktopFrame* captureImage() override;
+    QRegion focusRegion() const override;
+
+    // Returns the cursor recorded up to the last returned frame. |cursor| is set only if the
+    // shape has changed. Returns false if the cursor is not changed since the previous call.
+    bool takeCursor(QPoint* position, std::unique_ptr<MouseCursor>* cursor);
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    CapturerReplay(std::unique_ptr<QFile> file, Speed speed);
+
+    bool restart();
+    bool readFrame();
+    bool readCursor();
+
+    std::unique_ptr<QFile> file_;
+    QDataStream stream_;
+    const Speed speed_;
+
+    // The position of the first record.
+    qint64 start_position_ = 0;
+    Clock::time_point start_time_;
+
+    std::unique_ptr<DesktopFrameAligned> frame_;
+    QByteArray delta_buffer_;
+
+    QPoint cursor_position_;
+    std::unique_ptr<MouseCursor> cursor_;
+    bool cursor_changed_ = false;
+
+    Q_DISABLE_COPY(CapturerReplay)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_DESKTOP_CAPTURE__CAPTURER_REPLAY_H
@@ -0,0 +1,102 @@
+//
+// PROJECT:         Aspia
+// FILE:            desktop_capture/cursor_capturer.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "desktop_capture/cursor_capturer.h"
+
+#include "base/win/scoped_hdc.h"
+#include "desktop_capture/win/cursor.h"
+
+namespace aspia {
+
+namespace {
+
+constexpr size_t kMaxCachedCursors = 16;
+
+} // namespace
+
+CursorCapturer::CursorCapturer()
+{
+    memset(&prev_cursor_info_, 0, sizeof(prev_cursor_info_));
+}
+
+bool CursorCapturer::captureCursor(QPoint* position, std::unique_ptr<MouseCursor>* shape)
+{
+    shape->reset();
+
+    // Switch to the desktop receiving user input if different from the current one.
+    Desktop input_desktop(Desktop::inputDesktop());
+
+    if (input_desktop.isValid() && !desktop_.isSame(input_desktop))
+    {
+        // The cursor handles belong to the desktop.
+        cursor_cache_.clear();
+        desktop_.setThreadDesktop(std::move(input_desktop));
+    }
+
+    CURSORINFO cursor_info = { 0 };
+
+    // Note: cursor_info.hCursor does not need to be freed.
+    cursor_info.cbSize = sizeof(cursor_info);
+    if (!GetCursorInfo(&cursor_info))
+        return false;
+
+    position->setX(cursor_info.ptScreenPos.x);
+    position->setY(cursor_info.ptScreenPos.y);
+
+    if (isSameCursorShape(cursor_info, prev_cursor_info_))
+        return true;
+
+    if (cursor_info.flags == 0)
+    {
+        // Host machine does not have a hardware mouse attached, we will send a default one
+        // instead. Note, Windows automatically caches cursor resource, so we do not need to
+        // cache the result of LoadCursor.
+        cursor_info.hCursor = LoadCursorW(nullptr, IDC_ARROW);
+    }
+
+    *shape = cursorFromHandle(cursor_info.hCursor);
+
+    if (*shape)
+        prev_cursor_info_ = cursor_info;
+
+    return true;
+}
+
+std::unique_ptr<MouseCursor> CursorCapturer::cursorFromHandle(HCURSOR cursor)
+{
+    for (auto it = cursor_cache_.begin(); it != cursor_cache_.end(); ++it)
+    {
+        if (it->handle != cursor)
+            continue;
+
+        std::unique_ptr<MouseCursor> mouse_cursor = it->cursor->clone();
+
+        if (it != cursor_cache_.begin())
+        {
+            CachedCursor cached_cursor = std::move(*it);
+            cursor_cache_.erase(it);
+            cursor_cache_.push_front(std::move(cached_cursor));
+        }
+
+        return mouse_cursor;
+    }
+
+    ScopedGetDC desktop_dc(nullptr);
+
+    std::unique_ptr<MouseCursor> mouse_cursor = mouseCursorFromHCursor(desktop_dc, cursor);
+    if (!mouse_cursor)
+        return nullptr;
+
+    cursor_cache_.push_front({ cursor, mouse_cursor->clone() });
+
+    if (cursor_cache_.size() > kMaxCachedCursors)
+        cursor_cache_.pop_back();
+
+    return mouse_cursor;
+}
+
+} // namespace aspia
@@ -0,0 +1,59 @@
+//
+// PROJECT:         Aspia
+// FILE:            desktop_capture/cursor_capturer.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_DESKTOP_CAPTURE__CURSOR_CAPTURER_H
+#define _ASPIA_DESKTOP_CAPTURE__CURSOR_CAPTURER_H
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#include <QPoint>
+
+#include <deque>
+
+#include "desktop_capture/mouse_cursor.h"
+#include "desktop_capture/win/scoped_thread_desktop.h"
+
+namespace aspia {
+
+//
+// Captures the shape and the position of the cursor. The capture is cheap and does not depend
+// on the screen capturer, so the cursor is polled in its own thread more often than the screen.
+//
+class CursorCapturer
+{
+public:
+    CursorCapturer();
+    ~CursorCapturer() = default;
+
+    // Returns false if the cursor is not available. |position| receives the position of the
+    // cursor in the coordinates of the virtual screen. |shape| receives the shape of the cursor
+    // if it has changed since the previous call, otherwise it is reset.
+    bool captureCursor(QPoint* position, std::unique_ptr<MouseCursor>* shape);
+
+private:
+    std::unique_ptr<MouseCursor> cursorFromHandle(HCURSOR cursor);
+
+    ScopedThreadDesktop desktop_;
+    CURSORINFO prev_cursor_info_;
+
+    struct CachedCursor
+    {
+        HCURSOR handle;
+        std::unique_ptr<MouseCursor> cursor;
+    };
+
+    // The recently converted cursors, the last used first. The animated and the frequently
+    // switched cursors are converted only once.
+    std::deque<CachedCursor> cursor_cache_;
+
+    Q_DISABLE_COPY(CursorCapturer)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_DESKTOP_CAPTURE__CURSOR_CAPTURER_H
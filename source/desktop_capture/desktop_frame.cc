@@ -16,7 +16,9 @@ DesktopFrame::DesktopFrame(const QSize& size,
     : size_(size),
       format_(format),
       stride_(stride),
-      data_(data)
+      data_(data),
+      memory_charge_(MemoryCounters::FrameMemory,
+                     data ? static_cast<qint64>(stride) * size.height() : 0)
 {
     // Nothing
 }
@@ -36,4 +38,31 @@ quint8* DesktopFrame::frameDataAtPos(int x, int y) const
     return frameDataAtPos(QPoint(x, y));
 }
 
+void DesktopFrame::copyRect(const QPoint& source, const QRect& target)
+{
+    const int row_size = target.width() * format_.bytesPerPixel();
+    int stride = stride_;
+
+    quint8* src = frameDataAtPos(source);
+    quint8* dst = frameDataAtPos(target.topLeft());
+
+    // If the target is below the source, then the rows are copied from the bottom to the top
+    // to avoid overwriting the source rows that have not been copied yet.
+    if (target.y() > source.y())
+    {
+        src += stride * (target.height() - 1);
+        dst += stride * (target.height() - 1);
+        stride = -stride;
+    }
+
+    for (int y = 0; y < target.height(); ++y)
+    {
+        // memmove is used because the source and target rows may overlap horizontally.
+        memmove(dst, src, row_size);
+
+        src += stride;
+        dst += stride;
+    }
+}
+
 } // namespace aspia
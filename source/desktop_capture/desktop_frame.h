@@ -11,9 +11,13 @@
 #include <QRegion>
 #include <QPoint>
 #include <QSize>
+#include <QVector>
 
+#include "base/memory_counters.h"
 #include "desktop_capture/pixel_format.h"
 
+struct ID3D11Texture2D;
+
 namespace aspia {
 
 class DesktopFrame
@@ -21,6 +25,14 @@ class DesktopFrame
 public:
     virtual ~DesktopFrame() = default;
 
+    // The area |target| of the frame which contains the pixels located at the position
+    // |source| in the previous frame.
+    struct MoveRect
+    {
+        QPoint source;
+        QRect target;
+    };
+
     quint8* frameDataAtPos(const QPoint& pos) const;
     quint8* frameDataAtPos(int x, int y) const;
     quint8* frameData() const { return data_; }
@@ -29,9 +41,22 @@ public:
     int stride() const { return stride_; }
     bool contains(int x, int y) const;
 
+    // The frames which keep the pixels in the video memory return the texture. Their memory
+    // has no pixels then.
+    virtual ID3D11Texture2D* texture() const { return nullptr; }
+
     const QRegion& updatedRegion() const { return updated_region_; }
     QRegion* mutableUpdatedRegion() { return &updated_region_; }
 
+    // Moved areas of the frame. They are not included in the updated region and must be
+    // applied in order before the updated region.
+    const QVector<MoveRect>& moveRects() const { return move_rects_; }
+    QVector<MoveRect>* mutableMoveRects() { return &move_rects_; }
+
+    // Copies the pixels of the area |target| from the position |source| of the same frame.
+    // The source and target areas may overlap.
+    void copyRect(const QPoint& source, const QRect& target);
+
 protected:
     DesktopFrame(const QSize& size, const PixelFormat& format, int stride, quint8* data);
 
@@ -46,6 +71,10 @@ private:
     const int stride_;
 
     QRegion updated_region_;
+    QVector<MoveRect> move_rects_;
+
+    // The pixels in the memory of the process. The frames in the video memory have no pixels.
+    MemoryCounters::Charge memory_charge_;
 
     Q_DISABLE_COPY(DesktopFrame)
 };
@@ -7,20 +7,23 @@
 
 #include "desktop_capture/desktop_frame_aligned.h"
 
+#include "base/buffer_pool.h"
+
 namespace aspia {
 
 DesktopFrameAligned::DesktopFrameAligned(const QSize& size,
                                          const PixelFormat& format,
                                          int stride,
                                          quint8* data)
-    : DesktopFrame(size, format, stride, data)
+    : DesktopFrame(size, format, stride, data),
+      buffer_size_(stride * size.height())
 {
     // Nothing
 }
 
 DesktopFrameAligned::~DesktopFrameAligned()
 {
-    qFreeAligned(data_);
+    BufferPool::instance()->release(data_, buffer_size_);
 }
 
 // static
@@ -29,7 +32,7 @@ std::unique_ptr<DesktopFrameAligned> DesktopFrameAligned::create(
 {
     int bytes_per_row = size.width() * format.bytesPerPixel();
 
-    quint8* data = reinterpret_cast<quint8*>(qMallocAligned(bytes_per_row * size.height(), 16));
+    quint8* data = BufferPool::instance()->acquire(bytes_per_row * size.height());
     if (!data)
         return nullptr;
 
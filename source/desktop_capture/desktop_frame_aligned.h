@@ -14,6 +14,7 @@
 
 namespace aspia {
 
+// The frame with the buffer from BufferPool.
 class DesktopFrameAligned : public DesktopFrame
 {
 public:
@@ -26,7 +27,9 @@ private:
     DesktopFrameAligned(const QSize& size,
                       const PixelFormat& format,
                       int stride,
-                      quint8* data);
+                        quint8* data);
+
+    const size_t buffer_size_;
 
     Q_DISABLE_COPY(DesktopFrameAligned)
 };
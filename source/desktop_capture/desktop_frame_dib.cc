@@ -26,7 +26,8 @@ DesktopFrameDIB::create(const QSize& size,
                         const PixelFormat& format,
                         HDC hdc)
 {
-    int bytes_per_row = size.width() * format.bytesPerPixel();
+    // The rows of the DIB sections are aligned to 4 bytes.
+    const int bytes_per_row = ((size.width() * format.bitsPerPixel() + 31) / 32) * 4;
 
     struct BitmapInfo
     {
@@ -9,12 +9,21 @@
 
 #include <QPixmap>
 
+#include "base/buffer_pool.h"
+
 namespace aspia {
 
 namespace {
 
 constexpr int kBytesPerPixel = 4;
 
+// Cleanup function of the images which use the buffers of BufferPool.
+void releaseImageBuffer(void* info)
+{
+    std::unique_ptr<BufferPool::Buffer> buffer(static_cast<BufferPool::Buffer*>(info));
+}
+
+
 } // namespace
 
 DesktopFrameQImage::DesktopFrameQImage(QImage&& img)
@@ -30,8 +39,20 @@ DesktopFrameQImage::DesktopFrameQImage(QImage&& img)
 // static
 std::unique_ptr<DesktopFrameQImage> DesktopFrameQImage::create(const QSize& size)
 {
-    return std::unique_ptr<DesktopFrameQImage>(
-        new DesktopFrameQImage(QImage(size.width(), size.height(), QImage::Format_RGB32)));
+    const int stride = size.width() * kBytesPerPixel;
+
+    std::unique_ptr<BufferPool::Buffer> buffer = std::make_unique<BufferPool::Buffer>(
+        BufferPool::instance()->allocate(stride * size.height()));
+    if (!*buffer)
+        return nullptr;
+
+    quint8* data = buffer->get();
+
+    // The image owns the buffer and returns it into the pool when it is destroyed.
+    QImage image(data, size.width(), size.height(), stride, QImage::Format_RGB32,
+                 releaseImageBuffer, buffer.release());
+
+    return std::unique_ptr<DesktopFrameQImage>(new DesktopFrameQImage(std::move(image)));
 }
 
 // static
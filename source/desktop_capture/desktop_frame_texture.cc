@@ -0,0 +1,92 @@
+//
+// PROJECT:         Aspia
+// FILE:            desktop_capture/desktop_frame_texture.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "desktop_capture/desktop_frame_texture.h"
+
+#include <QDebug>
+
+namespace aspia {
+
+DesktopFrameTexture::DesktopFrameTexture(const QSize& size,
+                                         Microsoft::WRL::ComPtr<ID3D11Device> device,
+                                         Microsoft::WRL::ComPtr<ID3D11DeviceContext> context,
+                                         Microsoft::WRL::ComPtr<ID3D11Texture2D> texture)
+    : DesktopFrame(size, PixelFormat::ARGB(), 0, nullptr),
+      device_(std::move(device)),
+      context_(std::move(context)),
+      texture_(std::move(texture))
+{
+    // Nothing
+}
+
+// static
+std::unique_ptr<DesktopFrameTexture> DesktopFrameTexture::create(ID3D11Device* device,
+                                                                 const QSize& size)
+{
+    D3D11_TEXTURE2D_DESC texture_desc;
+    memset(&texture_desc, 0, sizeof(texture_desc));
+
+    texture_desc.Width            = size.width();
+    texture_desc.Height           = size.height();
+    texture_desc.MipLevels        = 1;
+    texture_desc.ArraySize        = 1;
+    texture_desc.Format           = DXGI_FORMAT_B8G8R8A8_UNORM;
+    texture_desc.SampleDesc.Count = 1;
+    texture_desc.Usage            = D3D11_USAGE_DEFAULT;
+
+    // The video processor of the encoder reads the texture as the input surface.
+    texture_desc.BindFlags = D3D11_BIND_RENDER_TARGET | D3D11_BIND_SHADER_RESOURCE;
+
+    Microsoft::WRL::ComPtr<ID3D11Texture2D> texture;
+
+    HRESULT hr = device->CreateTexture2D(&texture_desc, nullptr, texture.GetAddressOf());
+    if (FAILED(hr))
+    {
+        qWarning("CreateTexture2D failed: 0x%08X", hr);
+        return nullptr;
+    }
+
+    Microsoft::WRL::ComPtr<ID3D11RenderTargetView> render_target;
+
+    hr = device->CreateRenderTargetView(texture.Get(), nullptr, render_target.GetAddressOf());
+    if (FAILED(hr))
+    {
+        qWarning("CreateRenderTargetView failed: 0x%08X", hr);
+        return nullptr;
+    }
+
+    Microsoft::WRL::ComPtr<ID3D11DeviceContext> context;
+    device->GetImmediateContext(context.GetAddressOf());
+
+    // The areas of the virtual screen which are not covered by any output stay black.
+    const FLOAT black[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+    context->ClearRenderTargetView(render_target.Get(), black);
+
+    return std::unique_ptr<DesktopFrameTexture>(
+        new DesktopFrameTexture(size, device, std::move(context), std::move(texture)));
+}
+
+void DesktopFrameTexture::copyTextureRect(ID3D11Texture2D* source,
+                                          const QRect& source_rect,
+                                          const QPoint& target_pos)
+{
+    D3D11_BOX box;
+
+    box.left   = source_rect.x();
+    box.top    = source_rect.y();
+    box.right  = source_rect.x() + source_rect.width();
+    box.bottom = source_rect.y() + source_rect.height();
+    box.front  = 0;
+    box.back   = 1;
+
+    context_->CopySubresourceRegion(texture_.Get(), 0,
+                                    target_pos.x(), target_pos.y(), 0,
+                                    source, 0,
+                                    &box);
+}
+
+} // namespace aspia
@@ -0,0 +1,59 @@
+//
+// PROJECT:         Aspia
+// FILE:            desktop_capture/desktop_frame_texture.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_DESKTOP_CAPTURE__DESKTOP_FRAME_TEXTURE_H
+#define _ASPIA_DESKTOP_CAPTURE__DESKTOP_FRAME_TEXTURE_H
+
+#include <memory>
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <d3d11.h>
+#include <wrl/client.h>
+
+#include "desktop_capture/desktop_frame.h"
+
+namespace aspia {
+
+//
+// The frame which keeps the pixels in a BGRA texture of Direct3D 11. The frame has no pixels in
+// the memory, so it is passed only to the consumers which read the texture. The device of the
+// texture must be protected for the use from several threads.
+//
+class DesktopFrameTexture : public DesktopFrame
+{
+public:
+    ~DesktopFrameTexture() = default;
+
+    // The texture is black after the creation.
+    static std::unique_ptr<DesktopFrameTexture> create(ID3D11Device* device, const QSize& size);
+
+    ID3D11Texture2D* texture() const override { return texture_.Get(); }
+    ID3D11Device* device() const { return device_.Get(); }
+
+    // Copies the area |source_rect| of the texture |source| of the same device to the position
+    // |target_pos|. The copy is queued to the GPU.
+    void copyTextureRect(ID3D11Texture2D* source,
+                         const QRect& source_rect,
+                         const QPoint& target_pos);
+
+private:
+    DesktopFrameTexture(const QSize& size,
+                        Microsoft::WRL::ComPtr<ID3D11Device> device,
+                        Microsoft::WRL::ComPtr<ID3D11DeviceContext> context,
+                        Microsoft::WRL::ComPtr<ID3D11Texture2D> texture);
+
+    Microsoft::WRL::ComPtr<ID3D11Device> device_;
+    Microsoft::WRL::ComPtr<ID3D11DeviceContext> context_;
+    Microsoft::WRL::ComPtr<ID3D11Texture2D> texture_;
+
+    Q_DISABLE_COPY(DesktopFrameTexture)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_DESKTOP_CAPTURE__DESKTOP_FRAME_TEXTURE_H
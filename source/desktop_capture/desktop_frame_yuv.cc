@@ -0,0 +1,144 @@
+//
+// PROJECT:         Aspia
+// FILE:            desktop_capture/desktop_frame_yuv.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "desktop_capture/desktop_frame_yuv.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace aspia {
+
+namespace {
+
+void copyPlaneRows(const quint8* src, quint8* dst, int stride, int row_size, int rows)
+{
+    for (int y = 0; y < rows; ++y)
+    {
+        memcpy(dst, src, row_size);
+
+        src += stride;
+        dst += stride;
+    }
+}
+
+} // namespace
+
+DesktopFrameYUV::DesktopFrameYUV(const QSize& size, Layout layout, BufferPool::Buffer buffer)
+    : size_(size),
+      layout_(layout),
+      buffer_(std::move(buffer))
+{
+    quint8* data = buffer_.get();
+
+    for (int i = 0; i < kPlaneCount; ++i)
+    {
+        const QSize plane_size = planeSize(i);
+
+        planes_[i] = data;
+        data += plane_size.width() * plane_size.height();
+    }
+}
+
+// static
+std::unique_ptr<DesktopFrameYUV> DesktopFrameYUV::create(const QSize& size, Layout layout)
+{
+    if (size.isEmpty())
+        return nullptr;
+
+    const size_t y_size = static_cast<size_t>(size.width()) * size.height();
+    size_t uv_size = y_size;
+
+    if (layout == Layout::I420)
+        uv_size = static_cast<size_t>((size.width() + 1) / 2) * ((size.height() + 1) / 2);
+
+    BufferPool::Buffer buffer = BufferPool::instance()->allocate(y_size + uv_size * 2);
+    if (!buffer)
+        return nullptr;
+
+    return std::unique_ptr<DesktopFrameYUV>(
+        new DesktopFrameYUV(size, layout, std::move(buffer)));
+}
+
+QSize DesktopFrameYUV::planeSize(int plane) const
+{
+    if (plane == 0 || layout_ == Layout::I444)
+        return size_;
+
+    return QSize((size_.width() + 1) / 2, (size_.height() + 1) / 2);
+}
+
+QRect DesktopFrameYUV::planeRect(int plane, const QRect& rect) const
+{
+    if (plane == 0 || layout_ == Layout::I444)
+        return rect;
+
+    // The chroma sample covers 2x2 pixels, so the rectangle is expanded to even coordinates.
+    const int left = rect.left() / 2;
+    const int top = rect.top() / 2;
+    const int right = (rect.left() + rect.width() + 1) / 2;
+    const int bottom = (rect.top() + rect.height() + 1) / 2;
+
+    return QRect(left, top, right - left, bottom - top);
+}
+
+void DesktopFrameYUV::copyFrom(const DesktopFrameYUV& other, const QRect& rect)
+{
+    Q_ASSERT(other.size() == size_ && other.layout() == layout_);
+
+    for (int i = 0; i < kPlaneCount; ++i)
+    {
+        const QRect plane_rect = planeRect(i, rect);
+        const int offset = plane_rect.top() * stride(i) + plane_rect.left();
+
+        copyPlaneRows(other.plane(i) + offset, plane(i) + offset,
+                      stride(i), plane_rect.width(), plane_rect.height());
+    }
+}
+
+void DesktopFrameYUV::copyRect(const QPoint& source, const QRect& target)
+{
+    for (int i = 0; i < kPlaneCount; ++i)
+    {
+        const QRect plane_target = planeRect(i, target);
+        const QPoint plane_source = planeRect(i, QRect(source, QSize(1, 1))).topLeft();
+        const QSize plane_size = planeSize(i);
+
+        // The expanded rectangle may exceed the plane when the source is near its edge.
+        const int width = std::min(plane_target.width(),
+                                   plane_size.width() - std::max(plane_source.x(),
+                                                                 plane_target.x()));
+        const int height = std::min(plane_target.height(),
+                                    plane_size.height() - std::max(plane_source.y(),
+                                                                   plane_target.y()));
+        if (width <= 0 || height <= 0)
+            continue;
+
+        int plane_stride = stride(i);
+
+        const quint8* src = plane(i) + plane_source.y() * plane_stride + plane_source.x();
+        quint8* dst = plane(i) + plane_target.y() * plane_stride + plane_target.x();
+
+        // If the target is below the source, then the rows are copied from the bottom to the
+        // top to avoid overwriting the source rows that have not been copied yet.
+        if (plane_target.y() > plane_source.y())
+        {
+            src += plane_stride * (height - 1);
+            dst += plane_stride * (height - 1);
+            plane_stride = -plane_stride;
+        }
+
+        for (int y = 0; y < height; ++y)
+        {
+            memmove(dst, src, width);
+
+            src += plane_stride;
+            dst += plane_stride;
+        }
+    }
+}
+
+} // namespace aspia
@@ -0,0 +1,67 @@
+//
+// PROJECT:         Aspia
+// FILE:            desktop_capture/desktop_frame_yuv.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_DESKTOP_CAPTURE__DESKTOP_FRAME_YUV_H
+#define _ASPIA_DESKTOP_CAPTURE__DESKTOP_FRAME_YUV_H
+
+#include <QRect>
+
+#include "base/buffer_pool.h"
+
+namespace aspia {
+
+//
+// Frame in the planar YUV format (BT.601, limited range) with the buffer from BufferPool.
+// The rows of the planes follow each other without padding, so the changed rows of a plane
+// are a contiguous block of memory.
+//
+class DesktopFrameYUV
+{
+public:
+    enum class Layout
+    {
+        I420, // The chroma planes have a half of the width and the height.
+        I444  // The chroma planes have the size of the frame.
+    };
+
+    static const int kPlaneCount = 3;
+
+    ~DesktopFrameYUV() = default;
+
+    static std::unique_ptr<DesktopFrameYUV> create(const QSize& size, Layout layout);
+
+    const QSize& size() const { return size_; }
+    Layout layout() const { return layout_; }
+
+    QSize planeSize(int plane) const;
+    int stride(int plane) const { return planeSize(plane).width(); }
+    quint8* plane(int plane) const { return planes_[plane]; }
+
+    // Returns the area of |plane| which contains the pixels of |rect|.
+    QRect planeRect(int plane, const QRect& rect) const;
+
+    // Copies the area |rect| from |other| frame of the same size and layout.
+    void copyFrom(const DesktopFrameYUV& other, const QRect& rect);
+
+    // Moves the pixels like DesktopFrame::copyRect(). If the chroma is subsampled, then the
+    // chroma of the odd coordinates is rounded.
+    void copyRect(const QPoint& source, const QRect& target);
+
+private:
+    DesktopFrameYUV(const QSize& size, Layout layout, BufferPool::Buffer buffer);
+
+    const QSize size_;
+    const Layout layout_;
+    BufferPool::Buffer buffer_;
+    quint8* planes_[kPlaneCount];
+
+    Q_DISABLE_COPY(DesktopFrameYUV)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_DESKTOP_CAPTURE__DESKTOP_FRAME_YUV_H
@@ -0,0 +1,58 @@
+//
+// PROJECT:         Aspia
+// FILE:            desktop_capture/diff_block_avx512.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "desktop_capture/diff_block_avx512.h"
+
+#if defined(Q_PROCESSOR_X86)
+
+#if defined(Q_CC_MSVC)
+#include <intrin.h>
+#else
+#include <immintrin.h>
+#endif
+
+namespace aspia {
+
+quint8 diffFullBlock_32x32_AVX512(const quint8* image1, const quint8* image2, int bytes_per_row)
+{
+    for (int i = 0; i < 32; ++i)
+    {
+        const __m512i v1 = _mm512_loadu_si512(image1);
+        const __m512i v2 = _mm512_loadu_si512(image2);
+        const __m512i v3 = _mm512_loadu_si512(image1 + 64);
+        const __m512i v4 = _mm512_loadu_si512(image2 + 64);
+
+        if (_mm512_cmpneq_epi8_mask(v1, v2) | _mm512_cmpneq_epi8_mask(v3, v4))
+            return 1U;
+
+        image1 += bytes_per_row;
+        image2 += bytes_per_row;
+    }
+
+    return 0U;
+}
+
+quint8 diffFullBlock_16x16_AVX512(const quint8* image1, const quint8* image2, int bytes_per_row)
+{
+    for (int i = 0; i < 16; ++i)
+    {
+        const __m512i v1 = _mm512_loadu_si512(image1);
+        const __m512i v2 = _mm512_loadu_si512(image2);
+
+        if (_mm512_cmpneq_epi8_mask(v1, v2))
+            return 1U;
+
+        image1 += bytes_per_row;
+        image2 += bytes_per_row;
+    }
+
+    return 0U;
+}
+
+} // namespace aspia
+
+#endif // defined(Q_PROCESSOR_X86)
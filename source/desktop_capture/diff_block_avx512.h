@@ -0,0 +1,21 @@
+//
+// PROJECT:         Aspia
+// FILE:            desktop_capture/diff_block_avx512.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_DESKTOP_CAPTURE__DIFF_BLOCK_AVX512_H
+#define _ASPIA_DESKTOP_CAPTURE__DIFF_BLOCK_AVX512_H
+
+namespace aspia {
+
+// A row of the 8x8 block fits into one AVX2 register, so there is no AVX-512 version of it.
+
+quint8 diffFullBlock_32x32_AVX512(const quint8* image1, const quint8* image2, int bytes_per_row);
+
+quint8 diffFullBlock_16x16_AVX512(const quint8* image1, const quint8* image2, int bytes_per_row);
+
+} // namespace aspia
+
+#endif // _ASPIA_DESKTOP_CAPTURE__DIFF_BLOCK_AVX512_H
@@ -0,0 +1,37 @@
+//
+// PROJECT:         Aspia
+// FILE:            desktop_capture/diff_block_c.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_DESKTOP_CAPTURE__DIFF_BLOCK_C_H
+#define _ASPIA_DESKTOP_CAPTURE__DIFF_BLOCK_C_H
+
+#include <QtGlobal>
+
+#include <cstring>
+
+namespace aspia {
+
+// The portable version of the kernels. The pixels are 4 bytes, as for the vector kernels.
+template <int kBlockSize>
+quint8 diffFullBlock_C(const quint8* image1, const quint8* image2, int bytes_per_row)
+{
+    for (int y = 0; y < kBlockSize; ++y)
+    {
+        if (memcmp(image1, image2, kBlockSize * 4) != 0)
+        {
+            return 1U;
+        }
+
+        image1 += bytes_per_row;
+        image2 += bytes_per_row;
+    }
+
+    return 0U;
+}
+
+} // namespace aspia
+
+#endif // _ASPIA_DESKTOP_CAPTURE__DIFF_BLOCK_C_H
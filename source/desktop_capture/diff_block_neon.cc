@@ -0,0 +1,66 @@
+//
+// PROJECT:         Aspia
+// FILE:            desktop_capture/diff_block_neon.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "desktop_capture/diff_block_neon.h"
+
+#if defined(Q_PROCESSOR_ARM)
+
+#if defined(Q_CC_MSVC) && defined(Q_PROCESSOR_ARM_64)
+#include <arm64_neon.h>
+#else
+#include <arm_neon.h>
+#endif
+
+namespace aspia {
+
+namespace {
+
+// Compares |kVectors| of 16 bytes in each of |kRows| rows.
+template <int kRows, int kVectors>
+quint8 diffFullBlock(const quint8* image1, const quint8* image2, int bytes_per_row)
+{
+    for (int i = 0; i < kRows; ++i)
+    {
+        uint8x16_t acc = vdupq_n_u8(0);
+
+        for (int j = 0; j < kVectors; ++j)
+        {
+            acc = vorrq_u8(acc, veorq_u8(vld1q_u8(image1 + j * 16), vld1q_u8(image2 + j * 16)));
+        }
+
+        const uint64x2_t acc64 = vreinterpretq_u64_u8(acc);
+
+        if (vgetq_lane_u64(acc64, 0) | vgetq_lane_u64(acc64, 1))
+            return 1U;
+
+        image1 += bytes_per_row;
+        image2 += bytes_per_row;
+    }
+
+    return 0U;
+}
+
+} // namespace
+
+quint8 diffFullBlock_32x32_NEON(const quint8* image1, const quint8* image2, int bytes_per_row)
+{
+    return diffFullBlock<32, 8>(image1, image2, bytes_per_row);
+}
+
+quint8 diffFullBlock_16x16_NEON(const quint8* image1, const quint8* image2, int bytes_per_row)
+{
+    return diffFullBlock<16, 4>(image1, image2, bytes_per_row);
+}
+
+quint8 diffFullBlock_8x8_NEON(const quint8* image1, const quint8* image2, int bytes_per_row)
+{
+    return diffFullBlock<8, 2>(image1, image2, bytes_per_row);
+}
+
+} // namespace aspia
+
+#endif // defined(Q_PROCESSOR_ARM)
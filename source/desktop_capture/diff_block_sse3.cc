@@ -7,6 +7,8 @@
 
 #include "desktop_capture/diff_block_sse3.h"
 
+#if defined(Q_PROCESSOR_X86)
+
 #if defined(Q_CC_MSVC)
 #include <intrin.h>
 #else
@@ -134,3 +136,5 @@ quint8 diffFullBlock_8x8_SSE3(const quint8* image1, const quint8* image2, int by
 }
 
 } // namespace aspia
+
+#endif // defined(Q_PROCESSOR_X86)
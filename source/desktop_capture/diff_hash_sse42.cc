@@ -0,0 +1,72 @@
+//
+// PROJECT:         Aspia
+// FILE:            desktop_capture/diff_hash_sse42.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "desktop_capture/diff_hash_sse42.h"
+
+#if defined(Q_PROCESSOR_X86)
+
+#if defined(Q_CC_MSVC)
+#include <intrin.h>
+#else
+#include <nmmintrin.h>
+#endif
+
+#include <cstring>
+
+namespace aspia {
+
+quint64 hashStripe_SSE42(const quint8* image, int size)
+{
+    // Two independent chains hide the latency of the crc32 instruction and give 64 bits of hash.
+    quint32 crc1 = 0xFFFFFFFF;
+    quint32 crc2 = 0x12345678;
+
+#if defined(Q_PROCESSOR_X86_64)
+    while (size >= 16)
+    {
+        quint64 value1;
+        quint64 value2;
+
+        memcpy(&value1, image, sizeof(value1));
+        memcpy(&value2, image + 8, sizeof(value2));
+
+        crc1 = static_cast<quint32>(_mm_crc32_u64(crc1, value1));
+        crc2 = static_cast<quint32>(_mm_crc32_u64(crc2, value2));
+
+        image += 16;
+        size -= 16;
+    }
+#endif // defined(Q_PROCESSOR_X86_64)
+
+    while (size >= 8)
+    {
+        quint32 value1;
+        quint32 value2;
+
+        memcpy(&value1, image, sizeof(value1));
+        memcpy(&value2, image + 4, sizeof(value2));
+
+        crc1 = _mm_crc32_u32(crc1, value1);
+        crc2 = _mm_crc32_u32(crc2, value2);
+
+        image += 8;
+        size -= 8;
+    }
+
+    if (size >= 4)
+    {
+        quint32 value;
+        memcpy(&value, image, sizeof(value));
+        crc1 = _mm_crc32_u32(crc1, value);
+    }
+
+    return (static_cast<quint64>(crc1) << 32) | crc2;
+}
+
+} // namespace aspia
+
+#endif // defined(Q_PROCESSOR_X86)
@@ -0,0 +1,18 @@
+//
+// PROJECT:         Aspia
+// FILE:            desktop_capture/diff_hash_sse42.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_DESKTOP_CAPTURE__DIFF_HASH_SSE42_H
+#define _ASPIA_DESKTOP_CAPTURE__DIFF_HASH_SSE42_H
+
+namespace aspia {
+
+// Calculates CRC32C of two interleaved streams of the image data. |size| must be a multiple of 4.
+quint64 hashStripe_SSE42(const quint8* image, int size);
+
+} // namespace aspia
+
+#endif // _ASPIA_DESKTOP_CAPTURE__DIFF_HASH_SSE42_H
@@ -7,36 +7,37 @@
 
 #include "desktop_capture/differ.h"
 
+#include <QThread>
+
+#include <functional>
+
+#include "base/cpu_dispatch.h"
+#include "base/function_runnable.h"
+#include "base/trace_logger.h"
 #include "desktop_capture/diff_block_avx2.h"
+#include "desktop_capture/diff_block_avx512.h"
+#include "desktop_capture/diff_block_c.h"
+#include "desktop_capture/diff_block_neon.h"
 #include "desktop_capture/diff_block_sse2.h"
 #include "desktop_capture/diff_block_sse3.h"
-
-#include <libyuv/cpu_id.h>
+#include "desktop_capture/diff_hash_sse42.h"
 
 namespace aspia {
 
 namespace {
 
-const int kBytesPerPixel = 4;
-const int kBlockWidth = 8;
-const int kBlockHeight = 8;
-const int kBytesPerBlock = kBytesPerPixel * kBlockWidth;
+// The kernels are written for the pixels of kKernelBytesPerPixel bytes.
+const int kKernelBytesPerPixel = 4;
 
-quint8 diffFullBlock_C(const quint8* image1, const quint8* image2, int bytes_per_row)
-{
-    for (int y = 0; y < kBlockHeight; ++y)
-    {
-        if (memcmp(image1, image2, kBytesPerBlock) != 0)
-        {
-            return 1U;
-        }
+// The smallest kernel compares the rows of 8 pixels.
+const int kMinKernelSize = 8;
 
-        image1 += bytes_per_row;
-        image2 += bytes_per_row;
-    }
+// Screens with fewer pixels are processed by one thread.
+const int kMinParallelPixels = 1920 * 1080;
 
-    return 0U;
-}
+// The minimum height of a band in pixels and the maximum number of bands.
+const int kMinBandHeight = 128;
+const int kMaxBands = 4;
 
 //
 // Check for diffs in upper-left portion of the block. The size of the portion
@@ -64,81 +65,158 @@ quint8 diffPartialBlock(const quint8* prev_image,
 
 } // namespace
 
-Differ::Differ(const QSize& size)
+// static
+int Differ::blockSizeForScreen(const QSize& size)
+{
+    const int pixels = size.width() * size.height();
+
+    if (pixels >= 3840 * 2160)
+        return 32;
+
+    // Machines with few cores can not split the work into bands.
+    if (pixels >= 2560 * 1440)
+        return (QThread::idealThreadCount() >= 4) ? 16 : 32;
+
+    if (pixels > 1920 * 1200)
+        return 16;
+
+    return 8;
+}
+
+Differ::Differ(const QSize& size, int bytes_per_pixel, int bytes_per_row, int block_size)
     : screen_rect_(QPoint(), size),
-      bytes_per_row_(size.width() * kBytesPerPixel),
-      diff_width_(((size.width() + kBlockWidth - 1) / kBlockWidth) + 1),
-      diff_height_(((size.height() + kBlockHeight - 1) / kBlockHeight) + 1),
-      full_blocks_x_(size.width() / kBlockWidth),
-      full_blocks_y_(size.height() / kBlockHeight)
+      bytes_per_pixel_(bytes_per_pixel),
+      bytes_per_row_(bytes_per_row),
+      block_size_(qMax(block_size ? block_size : blockSizeForScreen(size),
+                       kMinKernelSize * kKernelBytesPerPixel / bytes_per_pixel)),
+      bytes_per_block_(block_size_ * bytes_per_pixel),
+      full_blocks_x_(size.width() / block_size_),
+      full_blocks_y_(size.height() / block_size_),
+      diff_width_(((size.width() + block_size_ - 1) / block_size_) + 1),
+      diff_height_(((size.height() + block_size_ - 1) / block_size_) + 1),
+      memory_charge_(MemoryCounters::DifferMemory, diff_width_ * diff_height_)
 {
+    Q_ASSERT(block_size_ == 8 || block_size_ == 16 || block_size_ == 32);
+    Q_ASSERT(bytes_per_pixel == 1 || bytes_per_pixel == 2 || bytes_per_pixel == 4);
+
+    // The row of the block is the row of the kernel of the same length in bytes.
+    const int kernel_size = bytes_per_block_ / kKernelBytesPerPixel;
+
+    kernel_calls_ = block_size_ / kernel_size;
+    kernel_stride_ = bytes_per_row_ * kernel_size;
+
     const int diff_info_size = diff_width_ * diff_height_;
 
     diff_info_ = std::make_unique<quint8[]>(diff_info_size);
     memset(diff_info_.get(), 0, diff_info_size);
 
     // Calc size of partial blocks which may be present on right and bottom edge.
-    partial_column_width_ = size.width() - (full_blocks_x_ * kBlockWidth);
-    partial_row_height_ = size.height() - (full_blocks_y_ * kBlockHeight);
+    partial_column_width_ = size.width() - (full_blocks_x_ * block_size_);
+    partial_row_height_ = size.height() - (full_blocks_y_ * block_size_);
 
     // Offset from the start of one block-row to the next.
-    block_stride_y_ = bytes_per_row_ * kBlockHeight;
+    block_stride_y_ = bytes_per_row_ * block_size_;
 
-    if (libyuv::TestCpuFlag(libyuv::kCpuHasAVX2))
+    if (kernel_size == 8)
     {
-        qInfo("AVX2 differ loaded");
-
-        if constexpr (kBlockWidth == 8 && kBlockHeight == 8)
-            diff_full_block_func_ = diffFullBlock_8x8_AVX2;
-        else if constexpr (kBlockWidth == 16 && kBlockHeight == 16)
-            diff_full_block_func_ = diffFullBlock_16x16_AVX2;
-        else if constexpr (kBlockWidth == 32 && kBlockHeight == 32)
-            diff_full_block_func_ = diffFullBlock_32x32_AVX2;
+        diff_full_block_func_ = CpuDispatch::select<DiffFullBlockFunc>("diff_block_8x8",
+        {
+#if defined(Q_PROCESSOR_X86)
+            { CpuDispatch::AVX2, diffFullBlock_8x8_AVX2 },
+            { CpuDispatch::SSSE3, diffFullBlock_8x8_SSE3 },
+            { CpuDispatch::SSE2, diffFullBlock_8x8_SSE2 },
+#elif defined(Q_PROCESSOR_ARM)
+            { CpuDispatch::NEON, diffFullBlock_8x8_NEON },
+#endif
+            { CpuDispatch::C, diffFullBlock_C<8> }
+        });
     }
-    else if (libyuv::TestCpuFlag(libyuv::kCpuHasSSSE3))
+    else if (kernel_size == 16)
     {
-        qInfo("SSE3 differ loaded");
-
-        if constexpr (kBlockWidth == 8 && kBlockHeight == 8)
-            diff_full_block_func_ = diffFullBlock_8x8_SSE3;
-        else if constexpr (kBlockWidth == 16 && kBlockHeight == 16)
-            diff_full_block_func_ = diffFullBlock_16x16_SSE3;
-        else if constexpr (kBlockWidth == 32 && kBlockHeight == 32)
-            diff_full_block_func_ = diffFullBlock_32x32_SSE3;
+        diff_full_block_func_ = CpuDispatch::select<DiffFullBlockFunc>("diff_block_16x16",
+        {
+#if defined(Q_PROCESSOR_X86)
+            { CpuDispatch::AVX512, diffFullBlock_16x16_AVX512 },
+            { CpuDispatch::AVX2, diffFullBlock_16x16_AVX2 },
+            { CpuDispatch::SSSE3, diffFullBlock_16x16_SSE3 },
+            { CpuDispatch::SSE2, diffFullBlock_16x16_SSE2 },
+#elif defined(Q_PROCESSOR_ARM)
+            { CpuDispatch::NEON, diffFullBlock_16x16_NEON },
+#endif
+            { CpuDispatch::C, diffFullBlock_C<16> }
+        });
     }
-    else if (libyuv::TestCpuFlag(libyuv::kCpuHasSSE2))
+    else
     {
-        qInfo("SSE2 differ loaded");
-
-        if constexpr (kBlockWidth == 8 && kBlockHeight == 8)
-            diff_full_block_func_ = diffFullBlock_8x8_SSE2;
-        else if constexpr (kBlockWidth == 16 && kBlockHeight == 16)
-            diff_full_block_func_ = diffFullBlock_16x16_SSE2;
-        else if constexpr (kBlockWidth == 32 && kBlockHeight == 32)
-            diff_full_block_func_ = diffFullBlock_32x32_SSE2;
+        diff_full_block_func_ = CpuDispatch::select<DiffFullBlockFunc>("diff_block_32x32",
+        {
+#if defined(Q_PROCESSOR_X86)
+            { CpuDispatch::AVX512, diffFullBlock_32x32_AVX512 },
+            { CpuDispatch::AVX2, diffFullBlock_32x32_AVX2 },
+            { CpuDispatch::SSSE3, diffFullBlock_32x32_SSE3 },
+            { CpuDispatch::SSE2, diffFullBlock_32x32_SSE2 },
+#elif defined(Q_PROCESSOR_ARM)
+            { CpuDispatch::NEON, diffFullBlock_32x32_NEON },
+#endif
+            { CpuDispatch::C, diffFullBlock_C<32> }
+        });
     }
-    else
+
+    // Without the crc32 instruction hashing is not much cheaper than comparing the blocks.
+    hash_stripe_func_ = CpuDispatch::select<HashStripeFunc>("diff_hash_stripe",
     {
-        qInfo("C differ loaded");
-        diff_full_block_func_ = diffFullBlock_C;
+#if defined(Q_PROCESSOR_X86)
+        { CpuDispatch::SSE42, hashStripe_SSE42 },
+#endif
+        { CpuDispatch::C, nullptr }
+    });
+
+    if (hash_stripe_func_)
+        row_hash_ = std::make_unique<quint64[]>(diff_height_);
+
+    if (size.width() * size.height() >= kMinParallelPixels)
+    {
+        const int block_rows = diff_height_ - 1;
+        const int min_band_rows = kMinBandHeight / block_size_;
+
+        bands_ = qBound(1, qMin(QThread::idealThreadCount(), kMaxBands), block_rows / min_band_rows);
     }
+
+    band_regions_.resize(bands_);
+
+    if (bands_ > 1)
+        thread_pool_.setMaxThreadCount(bands_ - 1);
 }
 
 //
 // Identify all of the blocks that contain changed pixels.
 //
-void Differ::markDirtyBlocks(const quint8* prev_image, const quint8* curr_image)
+void Differ::markDirtyBlocks(const quint8* prev_image,
+                             const quint8* curr_image,
+                             int first_row,
+                             int last_row)
 {
-    const quint8* prev_block_row_start = prev_image;
-    const quint8* curr_block_row_start = curr_image;
+    const quint8* prev_block_row_start = prev_image + first_row * block_stride_y_;
+    const quint8* curr_block_row_start = curr_image + first_row * block_stride_y_;
 
     // Offset from the start of one diff_info row to the next.
     const int diff_stride = diff_width_;
 
-    quint8* is_diff_row_start = diff_info_.get();
+    quint8* is_diff_row_start = diff_info_.get() + first_row * diff_stride;
 
-    for (int y = 0; y < full_blocks_y_; ++y)
+    for (int y = first_row; y < qMin(last_row, full_blocks_y_); ++y)
     {
+        if (isRowUnchanged(y, curr_block_row_start, block_size_))
+        {
+            memset(is_diff_row_start, 0, diff_stride);
+
+            prev_block_row_start += block_stride_y_;
+            curr_block_row_start += block_stride_y_;
+
+            is_diff_row_start += diff_stride;
+            continue;
+        }
+
         const quint8* prev_block = prev_block_row_start;
         const quint8* curr_block = curr_block_row_start;
 
@@ -148,10 +226,10 @@ void Differ::markDirtyBlocks(const quint8* prev_image, const quint8* curr_image)
         {
             // Mark this block as being modified so that it gets
             // incorporated into a dirty rect.
-            *is_different = diff_full_block_func_(prev_block, curr_block, bytes_per_row_);
+            *is_different = diffFullBlock(prev_block, curr_block);
 
-            prev_block += kBytesPerBlock;
-            curr_block += kBytesPerBlock;
+            prev_block += bytes_per_block_;
+            curr_block += bytes_per_block_;
 
             ++is_different;
         }
@@ -163,8 +241,8 @@ void Differ::markDirtyBlocks(const quint8* prev_image, const quint8* curr_image)
             *is_different = diffPartialBlock(prev_block,
                                              curr_block,
                                              bytes_per_row_,
-                                             kBytesPerBlock,
-                                             kBlockHeight);
+                                             bytes_per_block_,
+                                             block_size_);
         }
 
         // Update pointers for next row.
@@ -177,8 +255,14 @@ void Differ::markDirtyBlocks(const quint8* prev_image, const quint8* curr_image)
     // If the screen height is not a multiple of the block size, then this
     // handles the last partial row. This situation is far more common than
     // the 'partial column' case.
-    if (partial_row_height_ != 0)
+    if (partial_row_height_ != 0 && last_row > full_blocks_y_)
     {
+        if (isRowUnchanged(full_blocks_y_, curr_block_row_start, partial_row_height_))
+        {
+            memset(is_diff_row_start, 0, diff_stride);
+            return;
+        }
+
         const quint8* prev_block = prev_block_row_start;
         const quint8* curr_block = curr_block_row_start;
 
@@ -189,11 +273,11 @@ void Differ::markDirtyBlocks(const quint8* prev_image, const quint8* curr_image)
             *is_different = diffPartialBlock(prev_block,
                                              curr_block,
                                              bytes_per_row_,
-                                             kBytesPerBlock,
+                                             bytes_per_block_,
                                              partial_row_height_);
 
-            prev_block += kBytesPerBlock;
-            curr_block += kBytesPerBlock;
+            prev_block += bytes_per_block_;
+            curr_block += bytes_per_block_;
             ++is_different;
         }
 
@@ -203,23 +287,51 @@ void Differ::markDirtyBlocks(const quint8* prev_image, const quint8* curr_image)
                 diffPartialBlock(prev_block,
                                  curr_block,
                                  bytes_per_row_,
-                                 partial_column_width_ * kBytesPerPixel,
+                                 partial_column_width_ * bytes_per_pixel_,
                                  partial_row_height_);
         }
     }
 }
 
+quint8 Differ::diffFullBlock(const quint8* prev_block, const quint8* curr_block) const
+{
+    for (int i = 0; i < kernel_calls_; ++i)
+    {
+        if (diff_full_block_func_(prev_block, curr_block, bytes_per_row_))
+            return 1U;
+
+        prev_block += kernel_stride_;
+        curr_block += kernel_stride_;
+    }
+
+    return 0U;
+}
+
+bool Differ::isRowUnchanged(int row, const quint8* curr_row_start, int height)
+{
+    if (!hash_stripe_func_)
+        return false;
+
+    // The rows of the frame follow each other without gaps, so the row of blocks is hashed as
+    // one piece of memory.
+    const quint64 hash = hash_stripe_func_(curr_row_start, bytes_per_row_ * height);
+    const bool unchanged = row_hash_valid_ && row_hash_[row] == hash;
+
+    row_hash_[row] = hash;
+    return unchanged;
+}
+
 //
 // After the dirty blocks have been identified, this routine merges adjacent
 // blocks into a region.
 // The goal is to minimize the region that covers the dirty blocks.
 //
-void Differ::mergeBlocks(QRegion* dirty_region)
+void Differ::mergeBlocks(QRegion* dirty_region, int first_row, int last_row)
 {
-    quint8* is_diff_row_start = diff_info_.get();
     const int diff_stride = diff_width_;
+    quint8* is_diff_row_start = diff_info_.get() + first_row * diff_stride;
 
-    for (int y = 0; y < diff_height_; ++y)
+    for (int y = first_row; y < last_row; ++y)
     {
         quint8* is_different = is_diff_row_start;
 
@@ -249,20 +361,22 @@ void Differ::mergeBlocks(QRegion* dirty_region)
 
                 // Group with blocks below.
                 // The entire width of blocks that we matched above much match
-                // for each row that we add.
+                // for each row that we add. The rows of other bands are not used.
                 quint8* bottom = is_different;
-                bool found_new_row;
+                bool found_new_row = true;
 
-                do
+                while (found_new_row && y + height < last_row)
                 {
-                    found_new_row = true;
                     bottom += diff_stride;
                     right = bottom;
 
                     for (int x2 = 0; x2 < width; ++x2)
                     {
                         if (*right++ == 0)
+                        {
                             found_new_row = false;
+                            break;
+                        }
                     }
 
                     if (found_new_row)
@@ -278,10 +392,10 @@ void Differ::mergeBlocks(QRegion* dirty_region)
                             *right++ = 0;
                         }
                     }
-                } while (found_new_row);
+                }
 
-                QRect dirty_rect(x * kBlockWidth, y * kBlockHeight,
-                                 width * kBlockWidth, height * kBlockHeight);
+                QRect dirty_rect(x * block_size_, y * block_size_,
+                                 width * block_size_, height * block_size_);
 
                 // Add rect to region.
                 *dirty_region += dirty_rect.intersected(screen_rect_);
@@ -300,16 +414,42 @@ void Differ::calcDirtyRegion(const quint8* prev_image,
                              const quint8* curr_image,
                              QRegion* dirty_region)
 {
+    ScopedTrace trace("diff");
+
     *dirty_region = QRegion();
 
-    // Identify all the blocks that contain changed pixels.
-    markDirtyBlocks(prev_image, curr_image);
+    const int block_rows = diff_height_ - 1;
+
+    auto process_band = [&](int band)
+    {
+        const int first_row = block_rows * band / bands_;
+        const int last_row = block_rows * (band + 1) / bands_;
+
+        QRegion* band_region = &band_regions_[band];
+        *band_region = QRegion();
+
+        // Identify all the blocks that contain changed pixels.
+        markDirtyBlocks(prev_image, curr_image, first_row, last_row);
+
+        //
+        // Now that we've identified the blocks that have changed, merge adjacent
+        // blocks to minimize the number of rects that we return.
+        //
+        mergeBlocks(band_region, first_row, last_row);
+    };
+
+    for (int band = 1; band < bands_; ++band)
+        thread_pool_.start(new FunctionRunnable(std::bind(process_band, band)));
+
+    process_band(0);
+
+    thread_pool_.waitForDone();
+
+    // The capturer always passes the previous current frame as the previous frame.
+    row_hash_valid_ = true;
 
-    //
-    // Now that we've identified the blocks that have changed, merge adjacent
-    // blocks to minimize the number of rects that we return.
-    //
-    mergeBlocks(dirty_region);
+    for (const auto& band_region : band_regions_)
+        *dirty_region += band_region;
 }
 
 } // namespace aspia
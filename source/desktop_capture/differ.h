@@ -9,29 +9,58 @@
 #define _ASPIA_DESKTOP_CAPTURE__DIFFER_H
 
 #include <QRegion>
+#include <QThreadPool>
+
 #include <memory>
+#include <vector>
+
+#include "base/memory_counters.h"
 
 namespace aspia {
 
-// Class to search for changed regions of the screen.
+// Class to search for changed regions of the screen. Large screens are split into horizontal
+// bands of blocks which are processed in parallel. The rows of blocks whose hash matches the hash
+// of the previous frame are skipped without reading the previous frame.
 class Differ
 {
 public:
-    explicit Differ(const QSize& size);
+    // |block_size| may be 8, 16 or 32. If it is 0, then the size is selected by blockSizeForScreen.
+    // The rows of the images are |bytes_per_row| apart. The blocks of the pixels of 2 and 1 bytes
+    // are at least 16 and 32 pixels wide, so that the rows of the blocks are not shorter than
+    // the rows of the kernels.
+    Differ(const QSize& size, int bytes_per_pixel, int bytes_per_row, int block_size = 0);
     ~Differ() = default;
 
+    // Bigger blocks are cheaper to compare on large screens but give a larger updated region.
+    static int blockSizeForScreen(const QSize& size);
+
+    int blockSize() const { return block_size_; }
+
     void calcDirtyRegion(const quint8* prev_image,
                          const quint8* curr_image,
                          QRegion* changed_region);
 
 private:
-    void markDirtyBlocks(const quint8* prev_image, const quint8* curr_image);
-    void mergeBlocks(QRegion* dirty_region);
+    // The rows are the rows of blocks. The row |full_blocks_y_| is the partial row.
+    void markDirtyBlocks(const quint8* prev_image,
+                         const quint8* curr_image,
+                         int first_row,
+                         int last_row);
+    void mergeBlocks(QRegion* dirty_region, int first_row, int last_row);
+
+    quint8 diffFullBlock(const quint8* prev_block, const quint8* curr_block) const;
+
+    // Returns true if the row of blocks has the same hash as in the previous frame.
+    bool isRowUnchanged(int row, const quint8* curr_row_start, int height);
 
     const QRect screen_rect_;
 
+    const int bytes_per_pixel_;
     const int bytes_per_row_;
 
+    const int block_size_;
+    const int bytes_per_block_;
+
     const int full_blocks_x_;
     const int full_blocks_y_;
 
@@ -44,10 +73,28 @@ private:
     const int diff_height_;
 
     std::unique_ptr<quint8[]> diff_info_;
+    MemoryCounters::Charge memory_charge_;
 
     typedef quint8(*DiffFullBlockFunc)(const quint8*, const quint8*, int);
     DiffFullBlockFunc diff_full_block_func_;
 
+    // The kernels compare the squares of 4-byte pixels. The blocks of the smaller pixels are
+    // compared by several calls of the kernel one below another.
+    int kernel_calls_ = 1;
+    int kernel_stride_ = 0;
+
+    typedef quint64(*HashStripeFunc)(const quint8*, int);
+    HashStripeFunc hash_stripe_func_ = nullptr;
+
+    // Hashes of the rows of blocks of the previous frame.
+    std::unique_ptr<quint64[]> row_hash_;
+    bool row_hash_valid_ = false;
+
+    // Number of the bands of the parallel mode and the regions found in them.
+    int bands_ = 1;
+    std::vector<QRegion> band_regions_;
+    QThreadPool thread_pool_;
+
     Q_DISABLE_COPY(Differ)
 };
 
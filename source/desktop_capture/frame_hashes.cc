@@ -0,0 +1,133 @@
+//
+// PROJECT:         Aspia
+// FILE:            desktop_capture/frame_hashes.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "desktop_capture/frame_hashes.h"
+
+#include <cstring>
+
+#include "desktop_capture/desktop_frame.h"
+
+namespace aspia {
+
+namespace {
+
+// FNV-1a by the pixels, as in TileCache.
+constexpr quint64 kHashOffset = 14695981039346656037ULL;
+constexpr quint64 kHashPrime = 1099511628211ULL;
+
+constexpr int kBytesPerPixel = 4;
+constexpr quint32 kColorMask = 0x00FFFFFF;
+
+bool isHashable(const DesktopFrame* frame)
+{
+    return frame && frame->frameData() && frame->format().bytesPerPixel() == kBytesPerPixel &&
+           !frame->size().isEmpty();
+}
+
+} // namespace
+
+// static
+std::vector<quint64> FrameHashes::compute(const DesktopFrame* frame)
+{
+    std::vector<quint64> hashes;
+
+    if (!isHashable(frame))
+        return hashes;
+
+    const QSize& size = frame->size();
+
+    hashes.reserve(tileCount(size));
+
+    for (int y = 0; y < size.height(); y += kTileSize)
+    {
+        for (int x = 0; x < size.width(); x += kTileSize)
+        {
+            const QRect rect(x, y,
+                             qMin(kTileSize, size.width() - x),
+                             qMin(kTileSize, size.height() - y));
+
+            hashes.push_back(tileHash(frame, rect));
+        }
+    }
+
+    return hashes;
+}
+
+// static
+QRegion FrameHashes::changedRegion(const DesktopFrame* frame, const std::vector<quint64>& hashes)
+{
+    const QSize& size = frame->size();
+    const QRect frame_rect(QPoint(), size);
+
+    if (!isHashable(frame) || hashes.size() != static_cast<size_t>(tileCount(size)))
+        return frame_rect;
+
+    QRegion region;
+    size_t index = 0;
+
+    for (int y = 0; y < size.height(); y += kTileSize)
+    {
+        // The changed tiles of the row are joined, so the region has fewer rectangles.
+        QRect row_rect;
+
+        for (int x = 0; x < size.width(); x += kTileSize)
+        {
+            const QRect rect(x, y,
+                             qMin(kTileSize, size.width() - x),
+                             qMin(kTileSize, size.height() - y));
+
+            if (tileHash(frame, rect) == hashes[index++])
+            {
+                if (!row_rect.isEmpty())
+                    region += row_rect;
+
+                row_rect = QRect();
+            }
+            else
+            {
+                row_rect = row_rect.isEmpty() ? rect : row_rect.united(rect);
+            }
+        }
+
+        if (!row_rect.isEmpty())
+            region += row_rect;
+    }
+
+    return region;
+}
+
+// static
+quint64 FrameHashes::tileHash(const DesktopFrame* frame, const QRect& rect)
+{
+    quint64 hash = kHashOffset;
+
+    const quint8* row = frame->frameDataAtPos(rect.topLeft());
+
+    for (int y = 0; y < rect.height(); ++y)
+    {
+        for (int x = 0; x < rect.width(); ++x)
+        {
+            quint32 pixel;
+            memcpy(&pixel, row + x * kBytesPerPixel, sizeof(pixel));
+
+            hash = (hash ^ (pixel & kColorMask)) * kHashPrime;
+        }
+
+        row += frame->stride();
+    }
+
+    return hash;
+}
+
+// static
+int FrameHashes::tileCount(const QSize& size)
+{
+    return ((size.width() + kTileSize - 1) / kTileSize) *
+           ((size.height() + kTileSize - 1) / kTileSize);
+}
+
+} // namespace aspia
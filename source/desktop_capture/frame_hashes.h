@@ -0,0 +1,44 @@
+//
+// PROJECT:         Aspia
+// FILE:            desktop_capture/frame_hashes.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_DESKTOP_CAPTURE__FRAME_HASHES_H
+#define _ASPIA_DESKTOP_CAPTURE__FRAME_HASHES_H
+
+#include <QRegion>
+
+#include <vector>
+
+namespace aspia {
+
+class DesktopFrame;
+
+//
+// The hashes of the tiles of the frame (32 bits per pixel) by rows from the top left corner.
+// The client keeps its frame after the connection is lost and sends the hashes when the session
+// is resumed, so the host sends only the tiles which differ from its capture. The alpha channel
+// is not hashed, because the capturers and the decoders fill it differently.
+//
+class FrameHashes
+{
+public:
+    static const int kTileSize = 64;
+
+    // Returns an empty list if the frame does not have 32 bits per pixel.
+    static std::vector<quint64> compute(const DesktopFrame* frame);
+
+    // Returns the tiles of |frame| whose hashes differ from |hashes| of a frame of the same
+    // size. The whole frame is returned if the hashes do not match its size and format.
+    static QRegion changedRegion(const DesktopFrame* frame, const std::vector<quint64>& hashes);
+
+private:
+    static quint64 tileHash(const DesktopFrame* frame, const QRect& rect);
+    static int tileCount(const QSize& size);
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_DESKTOP_CAPTURE__FRAME_HASHES_H
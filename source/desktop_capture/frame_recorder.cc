@@ -0,0 +1,164 @@
+//
+// PROJECT:         Aspia
+// FILE:            desktop_capture/frame_recorder.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "desktop_capture/frame_recorder.h"
+
+#include <QDebug>
+
+#include <zstd.h>
+
+#include "desktop_capture/mouse_cursor.h"
+
+namespace aspia {
+
+namespace {
+
+constexpr int kCompressionLevel = 3;
+
+} // namespace
+
+FrameRecorder::FrameRecorder(std::unique_ptr<QFile> file)
+    : file_(std::move(file)),
+      stream_(file_.get())
+{
+    stream_.setVersion(QDataStream::Qt_5_0);
+    stream_.setByteOrder(QDataStream::LittleEndian);
+
+    stream_ << kMagic << kVersion;
+    timer_.start();
+}
+
+// static
+std::unique_ptr<FrameRecorder> FrameRecorder::create(const QString& file_path)
+{
+    std::unique_ptr<QFile> file = std::make_unique<QFile>(file_path);
+
+    if (!file->open(QFile::WriteOnly | QFile::Truncate))
+    {
+        qWarning() << "Unable to create the recording" << file_path << ":" << file->errorString();
+        return nullptr;
+    }
+
+    qInfo() << "Recording the screen to" << file_path;
+    return std::unique_ptr<FrameRecorder>(new FrameRecorder(std::move(file)));
+}
+
+void FrameRecorder::recordFrame(const DesktopFrame* frame)
+{
+    if (frame->format().bytesPerPixel() != 4)
+        return;
+
+    std::scoped_lock<std::mutex> lock(lock_);
+
+    const QSize& size = frame->size();
+    const bool key = !prev_frame_ || prev_frame_->size() != size;
+
+    if (key)
+    {
+        prev_frame_ = DesktopFrameAligned::create(size, frame->format());
+        if (!prev_frame_)
+            return;
+
+        memset(prev_frame_->frameData(), 0, prev_frame_->stride() * size.height());
+    }
+
+    stream_ << quint8(FrameRecord) << qint64(timer_.elapsed()) << key << size;
+
+    if (key)
+    {
+        stream_ << quint32(0);
+    }
+    else
+    {
+        stream_ << quint32(frame->moveRects().size());
+
+        for (const auto& move_rect : frame->moveRects())
+        {
+            stream_ << move_rect.source << move_rect.target;
+            prev_frame_->copyRect(move_rect.source, move_rect.target);
+        }
+    }
+
+    const QRegion region = key ? QRegion(QRect(QPoint(), size)) : frame->updatedRegion();
+
+    stream_ << quint32(region.rectCount());
+
+    int delta_size = 0;
+    for (const auto& rect : region)
+    {
+        stream_ << rect;
+        delta_size += rect.width() * rect.height() * 4;
+    }
+
+    delta_buffer_.resize(delta_size);
+    quint8* delta = reinterpret_cast<quint8*>(delta_buffer_.data());
+
+    for (const auto& rect : region)
+    {
+        for (int y = rect.top(); y <= rect.bottom(); ++y)
+        {
+            const quint8* curr_row = frame->frameDataAtPos(rect.left(), y);
+            quint8* prev_row = prev_frame_->frameDataAtPos(rect.left(), y);
+
+            for (int x = 0; x < rect.width() * 4; ++x)
+                delta[x] = curr_row[x] ^ prev_row[x];
+
+            memcpy(prev_row, curr_row, rect.width() * 4);
+            delta += rect.width() * 4;
+        }
+    }
+
+    stream_ << compress(reinterpret_cast<const quint8*>(delta_buffer_.constData()),
+                        delta_buffer_.size());
+}
+
+void FrameRecorder::recordCursor(const QPoint& position, const MouseCursor* cursor)
+{
+    std::scoped_lock<std::mutex> lock(lock_);
+
+    stream_ << quint8(CursorRecord) << qint64(timer_.elapsed()) << position << (cursor != nullptr);
+
+    if (cursor)
+    {
+        stream_ << cursor->size() << cursor->hotSpot()
+                << compress(cursor->data(), cursor->stride() * cursor->size().height());
+    }
+}
+
+// static
+QByteArray FrameRecorder::compress(const quint8* data, size_t size)
+{
+    QByteArray buffer;
+    buffer.resize(static_cast<int>(ZSTD_compressBound(size)));
+
+    const size_t result = ZSTD_compress(buffer.data(), buffer.size(), data, size,
+                                        kCompressionLevel);
+    if (ZSTD_isError(result))
+    {
+        qWarning() << "ZSTD_compress failed:" << ZSTD_getErrorName(result);
+        return QByteArray();
+    }
+
+    buffer.resize(static_cast<int>(result));
+    return buffer;
+}
+
+// static
+bool FrameRecorder::decompress(const QByteArray& source, quint8* data, size_t size)
+{
+    const size_t result = ZSTD_decompress(data, size, source.constData(), source.size());
+
+    if (ZSTD_isError(result) || result != size)
+    {
+        qWarning("Invalid compressed data of the recording");
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace aspia
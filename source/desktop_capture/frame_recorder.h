@@ -0,0 +1,83 @@
+//
+// PROJECT:         Aspia
+// FILE:            desktop_capture/frame_recorder.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_DESKTOP_CAPTURE__FRAME_RECORDER_H
+#define _ASPIA_DESKTOP_CAPTURE__FRAME_RECORDER_H
+
+#include <QDataStream>
+#include <QElapsedTimer>
+#include <QFile>
+
+#include <memory>
+#include <mutex>
+
+#include "desktop_capture/desktop_frame_aligned.h"
+
+namespace aspia {
+
+class MouseCursor;
+
+//
+// Writes the captured frames and the cursor shapes to a file which is replayed by
+// CapturerReplay. Only the updated areas of a frame are written. They are XORed with the
+// previous frame, so the unchanged pixels of the areas become zero, and compressed with
+// Zstandard. The records contain the time since the start of the recording.
+//
+// The file starts with kMagic and kVersion. Each record starts with its type and time:
+//   FrameRecord:  bool key, QSize size, quint32 count, count x (QPoint source, QRect target),
+//                 quint32 count, count x QRect, QByteArray compressed pixels.
+//   CursorRecord: QPoint position, bool has_shape, [QSize size, QPoint hotspot,
+//                 QByteArray compressed pixels].
+// The pixels of a key frame are XORed with a black frame.
+//
+class FrameRecorder
+{
+public:
+    ~FrameRecorder() = default;
+
+    static const quint32 kMagic = 0x52505341; // "ASPR"
+    static const quint32 kVersion = 1;
+
+    enum RecordType : quint8
+    {
+        FrameRecord = 1,
+        CursorRecord = 2
+    };
+
+    // Returns nullptr if the file can not be created.
+    static std::unique_ptr<FrameRecorder> create(const QString& file_path);
+
+    // Records the moved areas and the updated region of |frame|. The methods may be called
+    // from different threads.
+    void recordFrame(const DesktopFrame* frame);
+
+    // If |cursor| is nullptr, then only the position is changed.
+    void recordCursor(const QPoint& position, const MouseCursor* cursor);
+
+    // Helpers for the compression of the pixels. |size| is the expected size of the data.
+    static QByteArray compress(const quint8* data, size_t size);
+    static bool decompress(const QByteArray& source, quint8* data, size_t size);
+
+private:
+    explicit FrameRecorder(std::unique_ptr<QFile> file);
+
+    std::mutex lock_;
+
+    std::unique_ptr<QFile> file_;
+    QDataStream stream_;
+    QElapsedTimer timer_;
+
+    // The frame as it is seen by the replay.
+    std::unique_ptr<DesktopFrameAligned> prev_frame_;
+    QByteArray delta_buffer_;
+
+    Q_DISABLE_COPY(FrameRecorder)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_DESKTOP_CAPTURE__FRAME_RECORDER_H
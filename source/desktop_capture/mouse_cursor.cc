@@ -9,6 +9,25 @@
 
 namespace aspia {
 
+namespace {
+
+// FNV-1a.
+constexpr quint64 kHashOffset = 14695981039346656037ULL;
+constexpr quint64 kHashPrime = 1099511628211ULL;
+
+quint64 hashBytes(quint64 hash, const quint8* data, size_t size)
+{
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash ^= data[i];
+        hash *= kHashPrime;
+    }
+
+    return hash;
+}
+
+} // namespace
+
 // static
 std::unique_ptr<MouseCursor>
 MouseCursor::create(std::unique_ptr<quint8[]> data,
@@ -25,7 +44,13 @@ MouseCursor::MouseCursor(std::unique_ptr<quint8[]> data,
       size_(size),
       hotspot_(hotspot)
 {
-    // Nothing
+    const qint32 header[4] = { size_.width(), size_.height(), hotspot_.x(), hotspot_.y() };
+
+    quint64 hash = hashBytes(kHashOffset, reinterpret_cast<const quint8*>(header), sizeof(header));
+    hash = hashBytes(hash, data_.get(), stride() * size_.height());
+
+    // Zero marks the empty slots of the cache.
+    hash_ = hash ? hash : 1;
 }
 
 int MouseCursor::stride() const
@@ -33,9 +58,20 @@ int MouseCursor::stride() const
     return size_.width() * sizeof(quint32);
 }
 
-bool MouseCursor::isEqual(const MouseCursor& other)
+std::unique_ptr<MouseCursor> MouseCursor::clone() const
+{
+    const size_t data_size = stride() * size_.height();
+
+    std::unique_ptr<quint8[]> data = std::make_unique<quint8[]>(data_size);
+    memcpy(data.get(), data_.get(), data_size);
+
+    return create(std::move(data), size_, hotspot_);
+}
+
+bool MouseCursor::isEqual(const MouseCursor& other) const
 {
-    if (size_ == other.size_ &&
+    if (hash_ == other.hash_ &&
+        size_ == other.size_ &&
         hotspot_ == other.hotspot_ &&
         memcmp(data_.get(), other.data_.get(), stride() * size_.height()) == 0)
     {
@@ -30,7 +30,12 @@ public:
 
     int stride() const;
 
-    bool isEqual(const MouseCursor& other);
+    std::unique_ptr<MouseCursor> clone() const;
+
+    // Hash of the image, the size and the hotspot. Never zero.
+    quint64 hash() const { return hash_; }
+
+    bool isEqual(const MouseCursor& other) const;
 
 private:
     MouseCursor(std::unique_ptr<quint8[]> data,
@@ -40,6 +45,7 @@ private:
     std::unique_ptr<quint8[]> const data_;
     const QSize size_;
     const QPoint hotspot_;
+    quint64 hash_;
 };
 
 } // namespace aspia
@@ -14,71 +14,107 @@ namespace aspia {
 namespace {
 
 constexpr size_t kMinCacheSize = 2;
-constexpr size_t kMaxCacheSize = 31;
+constexpr size_t kMaxCacheSize = 1024;
 
 } // namespace
 
 MouseCursorCache::MouseCursorCache(size_t cache_size) :
+    slots_(cache_size),
     cache_size_(cache_size)
 {
     // Nothing
 }
 
-size_t MouseCursorCache::find(const MouseCursor* mouse_cursor)
+size_t MouseCursorCache::find(const MouseCursor* mouse_cursor) const
 {
     Q_ASSERT(mouse_cursor);
 
-    size_t size = cache_.size();
+    auto it = index_.find(mouse_cursor->hash());
+    if (it == index_.end())
+        return kInvalidIndex;
 
-    for (size_t index = 0; index < size; ++index)
-    {
-        // If the cursor is found in the cache.
-        if (cache_.at(index)->isEqual(*mouse_cursor))
-        {
-            // Return its index.
-            return index;
-        }
-    }
+    const Slot& slot = slots_[it->second];
+
+    // The restored slots have only the hash.
+    if (slot.cursor && !slot.cursor->isEqual(*mouse_cursor))
+        return kInvalidIndex;
 
-    return kInvalidIndex;
+    return it->second;
 }
 
 size_t MouseCursorCache::add(std::unique_ptr<MouseCursor> mouse_cursor)
 {
     Q_ASSERT(mouse_cursor);
 
-    // Add the cursor to the end of the list.
-    cache_.emplace_back(std::move(mouse_cursor));
+    const size_t index = next_slot_;
+    Slot& slot = slots_[index];
 
-    // If the current cache size exceeds the maximum cache size.
-    if (cache_.size() > cache_size_)
-    {
-        // Delete the first element in the cache (the oldest one).
-        cache_.pop_front();
-    }
+    // The oldest cursor is replaced.
+    auto it = index_.find(slot.hash);
+    if (it != index_.end() && it->second == index)
+        index_.erase(it);
+
+    slot.hash = mouse_cursor->hash();
+    slot.cursor = std::move(mouse_cursor);
 
-    return cache_.size() - 1;
+    index_[slot.hash] = index;
+    next_slot_ = (next_slot_ + 1) % cache_size_;
+
+    return index;
 }
 
 std::shared_ptr<MouseCursor> MouseCursorCache::Get(size_t index)
 {
-    if (index > kMaxCacheSize)
+    if (index >= slots_.size() || !slots_[index].cursor)
     {
         qDebug() << "Invalid cache index: " << index;
         return nullptr;
     }
 
-    return cache_.at(index);
+    return slots_[index].cursor;
 }
 
 bool MouseCursorCache::isEmpty() const
 {
-    return cache_.empty();
+    return index_.empty();
 }
 
 void MouseCursorCache::clear()
 {
-    cache_.clear();
+    slots_.assign(cache_size_, Slot());
+    index_.clear();
+    next_slot_ = 0;
+}
+
+std::vector<quint64> MouseCursorCache::hashes() const
+{
+    std::vector<quint64> hashes;
+    hashes.reserve(slots_.size());
+
+    for (const auto& slot : slots_)
+        hashes.push_back(slot.hash);
+
+    return hashes;
+}
+
+bool MouseCursorCache::restore(const std::vector<quint64>& hashes, size_t next_slot)
+{
+    if (hashes.size() != cache_size_ || next_slot >= cache_size_)
+        return false;
+
+    clear();
+
+    for (size_t index = 0; index < hashes.size(); ++index)
+    {
+        if (!hashes[index])
+            continue;
+
+        slots_[index].hash = hashes[index];
+        index_[hashes[index]] = index;
+    }
+
+    next_slot_ = next_slot;
+    return true;
 }
 
 // static
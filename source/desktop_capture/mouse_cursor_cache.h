@@ -8,12 +8,18 @@
 #ifndef _ASPIA_DESKTOP_CAPTURE__MOUSE_CURSOR_CACHE_H
 #define _ASPIA_DESKTOP_CAPTURE__MOUSE_CURSOR_CACHE_H
 
-#include <deque>
+#include <unordered_map>
+#include <vector>
 
 #include "desktop_capture/mouse_cursor.h"
 
 namespace aspia {
 
+//
+// The cursors are stored in slots. The new cursor replaces the oldest one, so the host and the
+// client which add the same cursors have the same slots. The cursors are indexed by their
+// hashes.
+//
 class MouseCursorCache
 {
 public:
@@ -25,8 +31,8 @@ public:
     // Looks for a matching cursor in the cache.
     // If the cursor is already in the cache, the cursor index in the cache is
     // returned.
-    // If the cursor is not in the cache, -1 is returned.
-    size_t find(const MouseCursor* mouse_cursor);
+    // If the cursor is not in the cache, kInvalidIndex is returned.
+    size_t find(const MouseCursor* mouse_cursor) const;
 
     // Adds the cursor to the cache and returns the index of the added element.
     size_t add(std::unique_ptr<MouseCursor> mouse_cursor);
@@ -43,10 +49,31 @@ public:
     // The current size of the cache.
     size_t size() const { return cache_size_; }
 
+    // Hashes of the cursors in the order of the slots. The empty slots have zero hashes.
+    std::vector<quint64> hashes() const;
+
+    // The slot of the next added cursor.
+    size_t nextSlot() const { return next_slot_; }
+
+    // Fills the slots with the cursors known by the other side. Only the hashes of the cursors
+    // are known, so they are found by the hash only. Returns false if the slots do not match
+    // the cache size.
+    bool restore(const std::vector<quint64>& hashes, size_t next_slot);
+
     static bool isValidCacheSize(size_t size);
 
 private:
-    std::deque<std::shared_ptr<MouseCursor>> cache_;
+    struct Slot
+    {
+        quint64 hash = 0;
+
+        // Null if the slot is restored from the hash.
+        std::shared_ptr<MouseCursor> cursor;
+    };
+
+    std::vector<Slot> slots_;
+    std::unordered_map<quint64, size_t> index_;
+    size_t next_slot_ = 0;
     const size_t cache_size_;
 };
 
@@ -0,0 +1,180 @@
+//
+// PROJECT:         Aspia
+// FILE:            desktop_capture/scroll_detector.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "desktop_capture/scroll_detector.h"
+
+#include <libyuv/compare.h>
+
+#include <unordered_map>
+#include <vector>
+
+namespace aspia {
+
+namespace {
+
+// Rectangles smaller than these values are not checked for scrolling. Sending them as dirty
+// rectangles is cheap enough.
+const int kMinRectWidth = 64;
+const int kMinRectHeight = 64;
+
+// Minimum height of the scrolled area.
+const int kMinScrollHeight = 32;
+
+const quint32 kHashSeed = 5381;
+
+} // namespace
+
+ScrollDetector::ScrollDetector(const QSize& size, int bytes_per_pixel, int bytes_per_row)
+    : size_(size),
+      bytes_per_pixel_(bytes_per_pixel),
+      bytes_per_row_(bytes_per_row),
+      prev_hashes_(std::make_unique<quint32[]>(size.height())),
+      curr_hashes_(std::make_unique<quint32[]>(size.height()))
+{
+    // Nothing
+}
+
+void ScrollDetector::calcRowHashes(const quint8* image, const QRect& rect, quint32* hashes) const
+{
+    const quint8* row = image + rect.y() * bytes_per_row_ + rect.x() * bytes_per_pixel_;
+    const int row_size = rect.width() * bytes_per_pixel_;
+
+    for (int y = 0; y < rect.height(); ++y)
+    {
+        hashes[y] = libyuv::HashDjb2(row, row_size, kHashSeed);
+        row += bytes_per_row_;
+    }
+}
+
+int ScrollDetector::findOffset(const QRect& rect) const
+{
+    const int height = rect.height();
+
+    // Rows that occur in the previous image more than once (for example, rows of a solid
+    // background) give no information about the offset and are marked with -1.
+    std::unordered_map<quint32, int> prev_rows;
+    prev_rows.reserve(height);
+
+    for (int y = 0; y < height; ++y)
+    {
+        auto result = prev_rows.emplace(prev_hashes_[y], y);
+        if (!result.second)
+            result.first->second = -1;
+    }
+
+    // Each row of the current image that is found at another position in the previous image
+    // votes for the offset between these positions.
+    std::vector<int> votes(height * 2, 0);
+
+    for (int y = 0; y < height; ++y)
+    {
+        if (curr_hashes_[y] == prev_hashes_[y])
+            continue;
+
+        auto prev_row = prev_rows.find(curr_hashes_[y]);
+        if (prev_row == prev_rows.end() || prev_row->second == -1)
+            continue;
+
+        ++votes[prev_row->second - y + height];
+    }
+
+    int best_offset = 0;
+    int best_votes = 0;
+
+    for (int i = 0; i < height * 2; ++i)
+    {
+        if (votes[i] > best_votes)
+        {
+            best_votes = votes[i];
+            best_offset = i - height;
+        }
+    }
+
+    if (best_votes < kMinScrollHeight / 2)
+        return 0;
+
+    return best_offset;
+}
+
+void ScrollDetector::detect(const quint8* prev_image,
+                            const quint8* curr_image,
+                            QRegion* updated_region,
+                            QVector<DesktopFrame::MoveRect>* move_rects)
+{
+    QRect rect;
+
+    for (const auto& updated_rect : *updated_region)
+    {
+        if (updated_rect.width() * updated_rect.height() > rect.width() * rect.height())
+            rect = updated_rect;
+    }
+
+    rect = rect.intersected(QRect(QPoint(), size_));
+
+    if (rect.width() < kMinRectWidth || rect.height() < kMinRectHeight)
+        return;
+
+    calcRowHashes(prev_image, rect, prev_hashes_.get());
+    calcRowHashes(curr_image, rect, curr_hashes_.get());
+
+    // The row |y| of the current image is equal to the row |y + offset| of the previous image.
+    const int offset = findOffset(rect);
+    if (!offset)
+        return;
+
+    const int row_size = rect.width() * bytes_per_pixel_;
+    const int first_row = qMax(0, -offset);
+    const int last_row = qMin(rect.height(), rect.height() - offset);
+
+    const quint8* prev_row_base = prev_image + rect.x() * bytes_per_pixel_;
+    const quint8* curr_row_base = curr_image + rect.x() * bytes_per_pixel_;
+
+    int best_start = 0;
+    int best_length = 0;
+    int start = first_row;
+
+    // Search for the highest continuous band of the matching rows. The hashes may collide,
+    // so the rows are also compared directly.
+    for (int y = first_row; y <= last_row; ++y)
+    {
+        bool is_equal = false;
+
+        if (y < last_row && curr_hashes_[y] == prev_hashes_[y + offset])
+        {
+            const quint8* prev_row =
+                prev_row_base + (rect.y() + y + offset) * bytes_per_row_;
+            const quint8* curr_row =
+                curr_row_base + (rect.y() + y) * bytes_per_row_;
+
+            is_equal = memcmp(prev_row, curr_row, row_size) == 0;
+        }
+
+        if (is_equal)
+            continue;
+
+        if (y - start > best_length)
+        {
+            best_start = start;
+            best_length = y - start;
+        }
+
+        start = y + 1;
+    }
+
+    if (best_length < kMinScrollHeight)
+        return;
+
+    DesktopFrame::MoveRect move_rect;
+
+    move_rect.target = QRect(rect.x(), rect.y() + best_start, rect.width(), best_length);
+    move_rect.source = QPoint(rect.x(), rect.y() + best_start + offset);
+
+    *updated_region -= move_rect.target;
+    move_rects->push_back(move_rect);
+}
+
+} // namespace aspia
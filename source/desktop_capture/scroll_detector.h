@@ -0,0 +1,49 @@
+//
+// PROJECT:         Aspia
+// FILE:            desktop_capture/scroll_detector.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_DESKTOP_CAPTURE__SCROLL_DETECTOR_H
+#define _ASPIA_DESKTOP_CAPTURE__SCROLL_DETECTOR_H
+
+#include <memory>
+
+#include "desktop_capture/desktop_frame.h"
+
+namespace aspia {
+
+// Class to search for vertically scrolled areas in the changed region of the screen.
+// The search is made by comparing the hashes of the rows of the previous and current images.
+class ScrollDetector
+{
+public:
+    // The rows of the images are |bytes_per_row| apart.
+    ScrollDetector(const QSize& size, int bytes_per_pixel, int bytes_per_row);
+    ~ScrollDetector() = default;
+
+    // Searches for a scrolled area in the largest rectangle of |updated_region|. If the area
+    // is found, then it is excluded from |updated_region| and added to |move_rects|.
+    void detect(const quint8* prev_image,
+                const quint8* curr_image,
+                QRegion* updated_region,
+                QVector<DesktopFrame::MoveRect>* move_rects);
+
+private:
+    void calcRowHashes(const quint8* image, const QRect& rect, quint32* hashes) const;
+    int findOffset(const QRect& rect) const;
+
+    const QSize size_;
+    const int bytes_per_pixel_;
+    const int bytes_per_row_;
+
+    std::unique_ptr<quint32[]> prev_hashes_;
+    std::unique_ptr<quint32[]> curr_hashes_;
+
+    Q_DISABLE_COPY(ScrollDetector)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_DESKTOP_CAPTURE__SCROLL_DETECTOR_H
@@ -0,0 +1,154 @@
+//
+// PROJECT:         Aspia
+// FILE:            desktop_capture/tile_cache.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "desktop_capture/tile_cache.h"
+
+#include <QDebug>
+
+#include <cstring>
+
+namespace aspia {
+
+namespace {
+
+constexpr int kMinCacheSize = 2;
+constexpr int kMaxCacheSize = 1024; // 16 MB of the tiles of 64x64 pixels.
+
+// FNV-1a by the pixels instead of the bytes.
+constexpr quint64 kHashOffset = 14695981039346656037ULL;
+constexpr quint64 kHashPrime = 1099511628211ULL;
+
+constexpr int kBytesPerPixel = 4;
+
+} // namespace
+
+TileCache::TileCache(int cache_size)
+    : slots_(cache_size),
+      cache_size_(cache_size)
+{
+    clear();
+}
+
+// static
+quint64 TileCache::hash(const QSize& size, const quint8* pixels)
+{
+    quint64 hash = kHashOffset;
+
+    hash = (hash ^ static_cast<quint64>(size.width())) * kHashPrime;
+    hash = (hash ^ static_cast<quint64>(size.height())) * kHashPrime;
+
+    const int count = size.width() * size.height();
+
+    for (int i = 0; i < count; ++i)
+    {
+        quint32 pixel;
+        memcpy(&pixel, pixels + i * kBytesPerPixel, sizeof(pixel));
+
+        hash = (hash ^ pixel) * kHashPrime;
+    }
+
+    return hash;
+}
+
+int TileCache::find(quint64 hash, const QSize& size, const quint8* pixels)
+{
+    auto it = index_.find(hash);
+    if (it == index_.end())
+        return kInvalidSlot;
+
+    const int slot = it->second;
+    const Slot& entry = slots_[slot];
+
+    if (entry.size != size ||
+        memcmp(entry.pixels.data(), pixels, entry.pixels.size()) != 0)
+    {
+        return kInvalidSlot;
+    }
+
+    order_.splice(order_.begin(), order_, positions_[slot]);
+    return slot;
+}
+
+int TileCache::add(quint64 hash, const QSize& size, const quint8* pixels)
+{
+    const int slot = order_.back();
+    Slot& entry = slots_[slot];
+
+    // The least recently used tile is replaced.
+    auto it = index_.find(entry.hash);
+    if (it != index_.end() && it->second == slot)
+        index_.erase(it);
+
+    storeSlot(slot, size, pixels, size.width() * kBytesPerPixel);
+    entry.hash = hash;
+
+    index_[hash] = slot;
+    order_.splice(order_.begin(), order_, positions_[slot]);
+
+    return slot;
+}
+
+bool TileCache::store(int slot, const QSize& size, const quint8* pixels, int stride)
+{
+    if (slot < 0 || slot >= cache_size_)
+    {
+        qDebug() << "Invalid cache slot: " << slot;
+        return false;
+    }
+
+    storeSlot(slot, size, pixels, stride);
+    return true;
+}
+
+const quint8* TileCache::pixels(int slot, const QSize& size) const
+{
+    if (slot < 0 || slot >= cache_size_ || slots_[slot].size != size)
+    {
+        qDebug() << "Invalid cache slot: " << slot;
+        return nullptr;
+    }
+
+    return slots_[slot].pixels.data();
+}
+
+void TileCache::clear()
+{
+    slots_.assign(cache_size_, Slot());
+    memory_charge_.reset(0);
+    index_.clear();
+    order_.clear();
+    positions_.clear();
+
+    for (int slot = 0; slot < cache_size_; ++slot)
+        positions_.push_back(order_.insert(order_.end(), slot));
+}
+
+void TileCache::storeSlot(int slot, const QSize& size, const quint8* pixels, int stride)
+{
+    Slot& entry = slots_[slot];
+    const size_t row_size = size.width() * kBytesPerPixel;
+
+    entry.size = size;
+
+    memory_charge_.add(static_cast<qint64>(row_size * size.height()) -
+                       static_cast<qint64>(entry.pixels.size()));
+    entry.pixels.resize(row_size * size.height());
+
+    for (int y = 0; y < size.height(); ++y)
+        memcpy(entry.pixels.data() + y * row_size, pixels + y * stride, row_size);
+}
+
+// static
+bool TileCache::isValidCacheSize(int size)
+{
+    if (size < kMinCacheSize || size > kMaxCacheSize)
+        return false;
+
+    return true;
+}
+
+} // namespace aspia
@@ -0,0 +1,87 @@
+//
+// PROJECT:         Aspia
+// FILE:            desktop_capture/tile_cache.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_DESKTOP_CAPTURE__TILE_CACHE_H
+#define _ASPIA_DESKTOP_CAPTURE__TILE_CACHE_H
+
+#include <QSize>
+
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+#include "base/memory_counters.h"
+
+namespace aspia {
+
+//
+// The tiles of the screen (32 bits per pixel) which have been sent to the client, so the same
+// tiles are sent again as the references to the slots. The host chooses the slot of each new
+// tile (the least recently used one) and sends it with the tile, so the client only stores the
+// tiles in the specified slots. The host keeps the pixels too and compares them on each hit,
+// so the collisions of the hashes do not damage the image.
+//
+class TileCache
+{
+public:
+    explicit TileCache(int cache_size);
+    ~TileCache() = default;
+
+    static const int kInvalidSlot = -1;
+
+    static quint64 hash(const QSize& size, const quint8* pixels);
+
+    // Looks for the tile with the contiguous |pixels| and marks it as recently used. Returns
+    // kInvalidSlot if the tile is not in the cache.
+    int find(quint64 hash, const QSize& size, const quint8* pixels);
+
+    // Adds the tile instead of the least recently used one and returns its slot.
+    int add(quint64 hash, const QSize& size, const quint8* pixels);
+
+    // Stores the tile in |slot| (used by the client). Returns false if |slot| is invalid.
+    bool store(int slot, const QSize& size, const quint8* pixels, int stride);
+
+    // Returns the contiguous pixels of the tile in |slot| or nullptr if the slot does not
+    // contain a tile of |size|.
+    const quint8* pixels(int slot, const QSize& size) const;
+
+    // Clears the cache.
+    void clear();
+
+    // The current size of the cache.
+    int size() const { return cache_size_; }
+
+    static bool isValidCacheSize(int size);
+
+private:
+    struct Slot
+    {
+        quint64 hash = 0;
+        QSize size;
+        std::vector<quint8> pixels;
+    };
+
+    void storeSlot(int slot, const QSize& size, const quint8* pixels, int stride);
+
+    std::vector<Slot> slots_;
+    std::unordered_map<quint64, int> index_;
+
+    // The slots of the host from the most recently used one.
+    std::list<int> order_;
+    std::vector<std::list<int>::iterator> positions_;
+
+    const int cache_size_;
+
+    // The pixels of the slots.
+    MemoryCounters::Charge memory_charge_{ MemoryCounters::CacheMemory };
+
+    Q_DISABLE_COPY(TileCache)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_DESKTOP_CAPTURE__TILE_CACHE_H
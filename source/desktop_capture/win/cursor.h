@@ -0,0 +1,26 @@
+//
+// PROJECT:         Aspia
+// FILE:            desktop_capture/win/cursor.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_DESKTOP_CAPTURE__WIN__CURSOR_H
+#define _ASPIA_DESKTOP_CAPTURE__WIN__CURSOR_H
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#include "desktop_capture/mouse_cursor.h"
+
+namespace aspia {
+
+// Converts an HCURSOR into a |MouseCursor| instance.
+std::unique_ptr<MouseCursor> mouseCursorFromHCursor(HDC dc, HCURSOR cursor);
+
+// Returns true if both cursor infos describe the same cursor shape.
+bool isSameCursorShape(const CURSORINFO& left, const CURSORINFO& right);
+
+} // namespace aspia
+
+#endif // _ASPIA_DESKTOP_CAPTURE__WIN__CURSOR_H
@@ -0,0 +1,182 @@
+//
+// PROJECT:         Aspia
+// FILE:            desktop_capture/win/cursor_sse2.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "desktop_capture/win/cursor_sse2.h"
+
+#if defined(Q_PROCESSOR_X86)
+
+#if defined(Q_CC_MSVC)
+#include <intrin.h>
+#else
+#include <emmintrin.h>
+#endif
+
+namespace aspia {
+
+namespace {
+
+constexpr quint32 kPixelRgbaBlack = 0xFF000000;
+constexpr quint32 kPixelRgbaWhite = 0xFFFFFFFF;
+constexpr quint32 kPixelRgbaTransparent = 0;
+
+quint32 alphaMulPixel(quint32 pixel)
+{
+    const quint32 alpha = pixel >> 24;
+
+    const quint32 blue  = ((pixel & 0xFF) * alpha) / 0xFF;
+    const quint32 green = (((pixel >> 8) & 0xFF) * alpha) / 0xFF;
+    const quint32 red   = (((pixel >> 16) & 0xFF) * alpha) / 0xFF;
+
+    return (alpha << 24) | (red << 16) | (green << 8) | blue;
+}
+
+// Multiplies the 16-bit channels of two pixels by the alpha. x / 255 is calculated as
+// ((x + 1) * 257) >> 16, which is exact for x <= 255 * 255.
+__m128i alphaMulPixels(__m128i pixels)
+{
+    // Broadcast the alpha to the color channels. The alpha channel is multiplied by 255.
+    __m128i alpha = _mm_shufflelo_epi16(pixels, _MM_SHUFFLE(3, 3, 3, 3));
+    alpha = _mm_shufflehi_epi16(alpha, _MM_SHUFFLE(3, 3, 3, 3));
+    alpha = _mm_or_si128(alpha, _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0));
+
+    __m128i value = _mm_mullo_epi16(pixels, alpha);
+    value = _mm_add_epi16(value, _mm_set1_epi16(1));
+
+    return _mm_mulhi_epu16(value, _mm_set1_epi16(257));
+}
+
+} // namespace
+
+bool hasAlphaChannel_SSE2(const quint32* data, int count)
+{
+    const __m128i alpha_mask = _mm_set1_epi32(static_cast<int>(0xFF000000));
+    int i = 0;
+
+    // 16 pixels are checked per iteration.
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i* src = reinterpret_cast<const __m128i*>(data + i);
+
+        __m128i acc = _mm_or_si128(_mm_loadu_si128(src + 0), _mm_loadu_si128(src + 1));
+        acc = _mm_or_si128(acc, _mm_loadu_si128(src + 2));
+        acc = _mm_or_si128(acc, _mm_loadu_si128(src + 3));
+        acc = _mm_and_si128(acc, alpha_mask);
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(acc, _mm_setzero_si128())) != 0xFFFF)
+            return true;
+    }
+
+    for (; i < count; ++i)
+    {
+        if (data[i] & 0xFF000000)
+            return true;
+    }
+
+    return false;
+}
+
+void addCursorOutline_SSE2(int width, int height, quint32* data)
+{
+    const __m128i black = _mm_set1_epi32(static_cast<int>(kPixelRgbaBlack));
+    const __m128i white = _mm_set1_epi32(static_cast<int>(kPixelRgbaWhite));
+    const __m128i transparent = _mm_setzero_si128();
+
+    // Only the transparent pixels are changed and only to white, so the black neighbours are
+    // the same regardless of the order in which the pixels are processed.
+    for (int y = 0; y < height; ++y)
+    {
+        quint32* row = data + y * width;
+        const bool has_top = y > 0;
+        const bool has_bottom = y < height - 1;
+
+        auto processPixel = [&](int x)
+        {
+            quint32* pixel = row + x;
+
+            if (*pixel != kPixelRgbaTransparent)
+                return;
+
+            if ((has_top && pixel[-width] == kPixelRgbaBlack) ||
+                (has_bottom && pixel[width] == kPixelRgbaBlack) ||
+                (x > 0 && pixel[-1] == kPixelRgbaBlack) ||
+                (x < width - 1 && pixel[1] == kPixelRgbaBlack))
+            {
+                *pixel = kPixelRgbaWhite;
+            }
+        };
+
+        int x = 0;
+
+        // The first and the last pixels of the row do not have one of the side neighbours and
+        // are processed below.
+        if (width > 2)
+        {
+            for (x = 1; x + 4 <= width - 1; x += 4)
+            {
+                __m128i* dst = reinterpret_cast<__m128i*>(row + x);
+                const __m128i pixels = _mm_loadu_si128(dst);
+
+                const __m128i is_transparent = _mm_cmpeq_epi32(pixels, transparent);
+                if (_mm_movemask_epi8(is_transparent) == 0)
+                    continue;
+
+                __m128i near_black = _mm_or_si128(
+                    _mm_cmpeq_epi32(_mm_loadu_si128(
+                        reinterpret_cast<const __m128i*>(row + x - 1)), black),
+                    _mm_cmpeq_epi32(_mm_loadu_si128(
+                        reinterpret_cast<const __m128i*>(row + x + 1)), black));
+
+                if (has_top)
+                {
+                    near_black = _mm_or_si128(near_black, _mm_cmpeq_epi32(_mm_loadu_si128(
+                        reinterpret_cast<const __m128i*>(row + x - width)), black));
+                }
+
+                if (has_bottom)
+                {
+                    near_black = _mm_or_si128(near_black, _mm_cmpeq_epi32(_mm_loadu_si128(
+                        reinterpret_cast<const __m128i*>(row + x + width)), black));
+                }
+
+                const __m128i outline = _mm_and_si128(is_transparent, near_black);
+
+                _mm_storeu_si128(dst, _mm_or_si128(_mm_andnot_si128(outline, pixels),
+                                                   _mm_and_si128(outline, white)));
+            }
+
+            processPixel(0);
+        }
+
+
+        for (; x < width; ++x)
+            processPixel(x);
+    }
+}
+
+void alphaMul_SSE2(quint32* data, int count)
+{
+    const __m128i zero = _mm_setzero_si128();
+    int i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i* dst = reinterpret_cast<__m128i*>(data + i);
+        const __m128i pixels = _mm_loadu_si128(dst);
+
+        const __m128i lo = alphaMulPixels(_mm_unpacklo_epi8(pixels, zero));
+        const __m128i hi = alphaMulPixels(_mm_unpackhi_epi8(pixels, zero));
+
+        _mm_storeu_si128(dst, _mm_packus_epi16(lo, hi));
+    }
+
+    for (; i < count; ++i)
+        data[i] = alphaMulPixel(data[i]);
+}
+
+} // namespace aspia
+
+#endif // defined(Q_PROCESSOR_X86)
@@ -0,0 +1,24 @@
+//
+// PROJECT:         Aspia
+// FILE:            desktop_capture/win/cursor_sse2.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_DESKTOP_CAPTURE__WIN__CURSOR_SSE2_H
+#define _ASPIA_DESKTOP_CAPTURE__WIN__CURSOR_SSE2_H
+
+namespace aspia {
+
+// Returns true if any of |count| pixels has a non-zero alpha component.
+bool hasAlphaChannel_SSE2(const quint32* data, int count);
+
+// Changes the transparent pixels which have black neighbours to white.
+void addCursorOutline_SSE2(int width, int height, quint32* data);
+
+// Premultiplies RGB components of |count| pixels by the alpha component.
+void alphaMul_SSE2(quint32* data, int count);
+
+} // namespace aspia
+
+#endif // _ASPIA_DESKTOP_CAPTURE__WIN__CURSOR_SSE2_H
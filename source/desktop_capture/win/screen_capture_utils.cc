@@ -0,0 +1,211 @@
+//
+// PROJECT:         Aspia
+// FILE:            desktop_capture/win/screen_capture_utils.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "desktop_capture/win/screen_capture_utils.h"
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <dwmapi.h>
+
+namespace aspia {
+
+namespace {
+
+bool displayDevice(DWORD device_index, DISPLAY_DEVICEW* device)
+{
+    memset(device, 0, sizeof(DISPLAY_DEVICEW));
+    device->cb = sizeof(DISPLAY_DEVICEW);
+
+    if (!EnumDisplayDevicesW(nullptr, device_index, device, 0))
+        return false;
+
+    return (device->StateFlags & DISPLAY_DEVICE_ACTIVE) != 0;
+}
+
+// The handles of the windows have 32 significant bits on 64 bit Windows too.
+HWND windowFromScreenId(Capturer::ScreenId screen_id)
+{
+    return reinterpret_cast<HWND>(static_cast<quintptr>(screen_id & 0xFFFFFFFF));
+}
+
+Capturer::ScreenId screenIdFromWindow(HWND window)
+{
+    return Capturer::kWindowScreenIdFlag |
+        static_cast<quint32>(reinterpret_cast<quintptr>(window));
+}
+
+bool isCapturableWindow(HWND window)
+{
+    if (!IsWindowVisible(window) || IsIconic(window))
+        return false;
+
+    // The tool windows are not shown in the taskbar.
+    if (GetWindowLongPtrW(window, GWL_EXSTYLE) & WS_EX_TOOLWINDOW)
+        return false;
+
+    // The suspended UWP applications are visible, but cloaked.
+    DWORD cloaked = 0;
+    if (SUCCEEDED(DwmGetWindowAttribute(window, DWMWA_CLOAKED, &cloaked, sizeof(cloaked))) &&
+        cloaked)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+QRect windowRect(HWND window)
+{
+    if (!IsWindow(window) || !isCapturableWindow(window))
+        return QRect();
+
+    // The extended frame bounds do not include the invisible resize borders of Windows 10.
+    RECT rect;
+    if (FAILED(DwmGetWindowAttribute(window, DWMWA_EXTENDED_FRAME_BOUNDS, &rect, sizeof(rect))))
+    {
+        if (!GetWindowRect(window, &rect))
+            return QRect();
+    }
+
+    const QRect desktop_rect(GetSystemMetrics(SM_XVIRTUALSCREEN),
+                             GetSystemMetrics(SM_YVIRTUALSCREEN),
+                             GetSystemMetrics(SM_CXVIRTUALSCREEN),
+                             GetSystemMetrics(SM_CYVIRTUALSCREEN));
+
+    return QRect(rect.left, rect.top, rect.right - rect.left, rect.bottom - rect.top)
+        .intersected(desktop_rect);
+}
+
+BOOL CALLBACK enumWindowsProc(HWND window, LPARAM lparam)
+{
+    Capturer::ScreenList* windows = reinterpret_cast<Capturer::ScreenList*>(lparam);
+
+    if (windowRect(window).isEmpty())
+        return TRUE;
+
+    wchar_t title[256];
+
+    if (!GetWindowTextW(window, title, _countof(title)))
+        return TRUE;
+
+    Capturer::Screen screen;
+
+    screen.id = screenIdFromWindow(window);
+    screen.title = QString::fromWCharArray(title);
+
+    windows->push_back(screen);
+    return TRUE;
+}
+
+} // namespace
+
+bool screenList(Capturer::ScreenList* screens)
+{
+    Q_ASSERT(screens);
+
+    screens->clear();
+
+    for (DWORD device_index = 0;; ++device_index)
+    {
+        DISPLAY_DEVICEW device;
+
+        memset(&device, 0, sizeof(device));
+        device.cb = sizeof(device);
+
+        // The end of the list of the devices.
+        if (!EnumDisplayDevicesW(nullptr, device_index, &device, 0))
+            break;
+
+        if (!(device.StateFlags & DISPLAY_DEVICE_ACTIVE))
+            continue;
+
+        Capturer::Screen screen;
+
+        screen.id = device_index;
+
+        // The device names have the form "\\.\DISPLAY1".
+        screen.title = QString::fromWCharArray(device.DeviceName);
+        screen.title.remove(QStringLiteral("\\\\.\\"));
+
+        screens->push_back(screen);
+    }
+
+    return !screens->empty();
+}
+
+bool windowList(Capturer::ScreenList* windows)
+{
+    Q_ASSERT(windows);
+
+    windows->clear();
+
+    return EnumWindows(enumWindowsProc, reinterpret_cast<LPARAM>(windows)) != FALSE;
+}
+
+QRect screenRect(Capturer::ScreenId screen_id)
+{
+    if (screen_id == Capturer::kFullDesktopScreenId)
+    {
+        return QRect(GetSystemMetrics(SM_XVIRTUALSCREEN),
+                     GetSystemMetrics(SM_YVIRTUALSCREEN),
+                     GetSystemMetrics(SM_CXVIRTUALSCREEN),
+                     GetSystemMetrics(SM_CYVIRTUALSCREEN));
+    }
+
+    if (screen_id < 0)
+        return QRect();
+
+    if (Capturer::isWindowScreen(screen_id))
+        return windowRect(windowFromScreenId(screen_id));
+
+    DISPLAY_DEVICEW device;
+
+    if (!displayDevice(static_cast<DWORD>(screen_id), &device))
+        return QRect();
+
+    DEVMODEW device_mode;
+
+    memset(&device_mode, 0, sizeof(device_mode));
+    device_mode.dmSize = sizeof(device_mode);
+
+    if (!EnumDisplaySettingsExW(device.DeviceName, ENUM_CURRENT_SETTINGS, &device_mode, 0))
+        return QRect();
+
+    return QRect(device_mode.dmPosition.x,
+                 device_mode.dmPosition.y,
+                 device_mode.dmPelsWidth,
+                 device_mode.dmPelsHeight);
+}
+
+QRegion screenFocusRegion(const QRect& screen_rect, int cursor_size)
+{
+    QRegion region;
+
+    POINT cursor_pos;
+    if (GetCursorPos(&cursor_pos))
+    {
+        region += QRect(cursor_pos.x - screen_rect.x() - cursor_size / 2,
+                        cursor_pos.y - screen_rect.y() - cursor_size / 2,
+                        cursor_size,
+                        cursor_size);
+    }
+
+    HWND foreground_window = GetForegroundWindow();
+    RECT window_rect;
+
+    if (foreground_window && GetWindowRect(foreground_window, &window_rect))
+    {
+        region += QRect(window_rect.left - screen_rect.x(),
+                        window_rect.top - screen_rect.y(),
+                        window_rect.right - window_rect.left,
+                        window_rect.bottom - window_rect.top);
+    }
+
+    return region.intersected(QRect(QPoint(), screen_rect.size()));
+}
+
+} // namespace aspia
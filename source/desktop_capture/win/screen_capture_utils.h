@@ -0,0 +1,34 @@
+//
+// PROJECT:         Aspia
+// FILE:            desktop_capture/win/screen_capture_utils.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_DESKTOP_CAPTURE__WIN__SCREEN_CAPTURE_UTILS_H
+#define _ASPIA_DESKTOP_CAPTURE__WIN__SCREEN_CAPTURE_UTILS_H
+
+#include <QRegion>
+
+#include "desktop_capture/capturer.h"
+
+namespace aspia {
+
+// Returns the active screens. The id of a screen is the index of its display device.
+bool screenList(Capturer::ScreenList* screens);
+
+// Returns the visible top-level windows with titles in the Z order. The ids of the windows are
+// marked with Capturer::kWindowScreenIdFlag.
+bool windowList(Capturer::ScreenList* windows);
+
+// Returns the rectangle of the screen in the coordinates of the primary screen or an empty
+// rectangle if the screen does not exist. The rectangle of a window is clipped to the desktop.
+QRect screenRect(Capturer::ScreenId screen_id);
+
+// Returns the square of |cursor_size| around the cursor and the rectangle of the foreground
+// window relative to the top-left corner of |screen_rect| and clipped to the screen.
+QRegion screenFocusRegion(const QRect& screen_rect, int cursor_size);
+
+} // namespace aspia
+
+#endif // _ASPIA_DESKTOP_CAPTURE__WIN__SCREEN_CAPTURE_UTILS_H
@@ -0,0 +1,129 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/cpu_governor.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "host/cpu_governor.h"
+
+#include <QDebug>
+
+#include <qt_windows.h>
+
+#include "base/errno_logging.h"
+#include "codec/video_encoder.h"
+
+namespace aspia {
+
+namespace {
+
+// The load is measured over this interval.
+constexpr std::chrono::seconds kSampleInterval(1);
+
+// The load of the host (in percent) at which the users need the processors.
+constexpr quint64 kBusyHostLoad = 90;
+
+// The load of the host below which the idle processors are used for the better quality.
+constexpr quint64 kIdleHostLoad = 50;
+
+// The number of the samples with the headroom after which the effort is raised.
+constexpr int kIdleSamples = 3;
+
+quint64 fileTimeToUInt64(const FILETIME& file_time)
+{
+    return (static_cast<quint64>(file_time.dwHighDateTime) << 32) | file_time.dwLowDateTime;
+}
+
+} // namespace
+
+CpuGovernor::CpuGovernor(int budget)
+    : budget_(qBound(1, budget, 100))
+{
+    // Nothing
+}
+
+bool CpuGovernor::update(const std::chrono::milliseconds& encode_time,
+                         const std::chrono::milliseconds& interval)
+{
+    const Clock::time_point now = Clock::now();
+
+    if (sampled_ && now - sample_time_ < kSampleInterval)
+        return false;
+
+    FILETIME idle_time;
+    FILETIME kernel_time;
+    FILETIME user_time;
+
+    // The kernel time of the system includes the idle time.
+    if (!GetSystemTimes(&idle_time, &kernel_time, &user_time))
+    {
+        qWarningErrno("GetSystemTimes failed");
+        return false;
+    }
+
+    const quint64 system_idle_time = fileTimeToUInt64(idle_time);
+    const quint64 system_total_time = fileTimeToUInt64(kernel_time) + fileTimeToUInt64(user_time);
+
+    FILETIME creation_time;
+    FILETIME exit_time;
+
+    if (!GetProcessTimes(GetCurrentProcess(), &creation_time, &exit_time,
+                         &kernel_time, &user_time))
+    {
+        qWarningErrno("GetProcessTimes failed");
+        return false;
+    }
+
+    const quint64 process_time = fileTimeToUInt64(kernel_time) + fileTimeToUInt64(user_time);
+
+    const bool first_sample = !sampled_;
+
+    const quint64 total_delta = system_total_time - system_total_time_;
+    const quint64 idle_delta = qMin(system_idle_time - system_idle_time_, total_delta);
+    const quint64 process_delta = qMin(process_time - process_time_, total_delta);
+
+    sample_time_ = now;
+    sampled_ = true;
+    system_idle_time_ = system_idle_time;
+    system_total_time_ = system_total_time;
+    process_time_ = process_time;
+
+    if (first_sample || !total_delta)
+        return false;
+
+    // The times of all processors are summed, so the loads are the parts of the whole host.
+    const quint64 host_load = (total_delta - idle_delta) * 100 / total_delta;
+    const quint64 process_load = process_delta * 100 / total_delta;
+    const quint64 budget = static_cast<quint64>(budget_);
+
+    const int previous_effort = effort_;
+
+    if (process_load > budget || (host_load >= kBusyHostLoad && process_load * 2 > budget))
+    {
+        idle_samples_ = 0;
+        effort_ = qMax(VideoEncoder::kMinEffort, effort_ - 1);
+    }
+    else if (host_load < kIdleHostLoad && process_load * 3 < budget * 2 &&
+             encode_time * 2 < interval)
+    {
+        if (++idle_samples_ >= kIdleSamples)
+        {
+            idle_samples_ = 0;
+            effort_ = qMin(VideoEncoder::kMaxEffort, effort_ + 1);
+        }
+    }
+    else
+    {
+        idle_samples_ = 0;
+    }
+
+    if (effort_ == previous_effort)
+        return false;
+
+    qDebug() << "Encoder effort:" << effort_ << "host load:" << host_load
+             << "process load:" << process_load;
+    return true;
+}
+
+} // namespace aspia
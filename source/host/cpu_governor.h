@@ -0,0 +1,62 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/cpu_governor.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_HOST__CPU_GOVERNOR_H
+#define _ASPIA_HOST__CPU_GOVERNOR_H
+
+#include <QtGlobal>
+
+#include <chrono>
+
+namespace aspia {
+
+//
+// Chooses the effort of the encoder (see VideoEncoder::setEffort) by the load of the
+// processors. The effort is lowered while the process uses more than its budget or while the
+// host is busy and the process takes a noticeable part of it. The effort is raised while the
+// host is mostly idle, the process is well within its budget and the encoder keeps up with
+// the frames. The effort is raised only after several such samples, so it does not oscillate.
+//
+class CpuGovernor
+{
+public:
+    // |budget| is the part of all processors of the host (in percent) which the process may
+    // use.
+    explicit CpuGovernor(int budget);
+    ~CpuGovernor() = default;
+
+    // Must be called periodically. |encode_time| is the smoothed time of the encoding of
+    // a frame and |interval| is the interval of the captures. Returns true if the effort is
+    // changed.
+    bool update(const std::chrono::milliseconds& encode_time,
+                const std::chrono::milliseconds& interval);
+
+    int effort() const { return effort_; }
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    const int budget_;
+    int effort_ = 0;
+
+    Clock::time_point sample_time_;
+    bool sampled_ = false;
+
+    // The times of the previous sample in the units of FILETIME.
+    quint64 system_idle_time_ = 0;
+    quint64 system_total_time_ = 0;
+    quint64 process_time_ = 0;
+
+    // The number of the last samples with the headroom.
+    int idle_samples_ = 0;
+
+    Q_DISABLE_COPY(CpuGovernor)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_HOST__CPU_GOVERNOR_H
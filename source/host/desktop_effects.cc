@@ -0,0 +1,203 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/desktop_effects.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "host/desktop_effects.h"
+
+#include <QDebug>
+
+#include <qt_windows.h>
+
+#include "base/errno_logging.h"
+
+namespace aspia {
+
+namespace {
+
+// The values are changed only for the current logon session.
+constexpr UINT kChangeFlags = SPIF_SENDCHANGE;
+
+struct Parameter
+{
+    const char* name;
+    UINT get_action;
+    UINT set_action;
+
+    // The new value is passed in uiParam instead of pvParam.
+    bool ui_param;
+};
+
+const Parameter kParameters[] =
+{
+    { "SPI_SETUIEFFECTS", SPI_GETUIEFFECTS, SPI_SETUIEFFECTS, false },
+    { "SPI_SETCLIENTAREAANIMATION", SPI_GETCLIENTAREAANIMATION, SPI_SETCLIENTAREAANIMATION, false },
+    { "SPI_SETFONTSMOOTHING", SPI_GETFONTSMOOTHING, SPI_SETFONTSMOOTHING, true },
+    { "SPI_SETDRAGFULLWINDOWS", SPI_GETDRAGFULLWINDOWS, SPI_SETDRAGFULLWINDOWS, true }
+};
+
+bool parameterValue(const Parameter& parameter, bool* value)
+{
+    BOOL result = FALSE;
+
+    if (!SystemParametersInfoW(parameter.get_action, 0, &result, 0))
+        return false;
+
+    *value = result != FALSE;
+    return true;
+}
+
+bool setParameterValue(const Parameter& parameter, bool value)
+{
+    const BOOL new_value = value ? TRUE : FALSE;
+
+    BOOL result;
+    if (parameter.ui_param)
+    {
+        result = SystemParametersInfoW(parameter.set_action, new_value, nullptr, kChangeFlags);
+    }
+    else
+    {
+        result = SystemParametersInfoW(parameter.set_action, 0,
+                                       reinterpret_cast<PVOID>(static_cast<UINT_PTR>(new_value)),
+                                       kChangeFlags);
+    }
+
+    if (!result)
+    {
+        qWarningErrno("%s failed", parameter.name);
+        return false;
+    }
+
+    return true;
+}
+
+bool minimizeAnimation(bool* enabled)
+{
+    ANIMATIONINFO info;
+    info.cbSize = sizeof(info);
+
+    if (!SystemParametersInfoW(SPI_GETANIMATION, sizeof(info), &info, 0))
+        return false;
+
+    *enabled = info.iMinAnimate != 0;
+    return true;
+}
+
+bool setMinimizeAnimation(bool enabled)
+{
+    ANIMATIONINFO info;
+    info.cbSize = sizeof(info);
+    info.iMinAnimate = enabled ? 1 : 0;
+
+    if (!SystemParametersInfoW(SPI_SETANIMATION, sizeof(info), &info, kChangeFlags))
+    {
+        qWarningErrno("SPI_SETANIMATION failed");
+        return false;
+    }
+
+    return true;
+}
+
+bool wallpaper(QString* path)
+{
+    wchar_t buffer[MAX_PATH] = { 0 };
+
+    if (!SystemParametersInfoW(SPI_GETDESKWALLPAPER, MAX_PATH, buffer, 0))
+        return false;
+
+    *path = QString::fromWCharArray(buffer);
+    return true;
+}
+
+bool setWallpaper(const QString& path)
+{
+    std::wstring buffer = path.toStdWString();
+
+    if (!SystemParametersInfoW(SPI_SETDESKWALLPAPER, 0, buffer.data(), kChangeFlags))
+    {
+        qWarningErrno("SPI_SETDESKWALLPAPER failed");
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace
+
+DesktopEffects::DesktopEffects() = default;
+
+DesktopEffects::~DesktopEffects()
+{
+    restore();
+}
+
+// static
+std::shared_ptr<DesktopEffects> DesktopEffects::acquire()
+{
+    // The sessions of the process share the object, so the effects are restored only after
+    // the last of them.
+    static std::weak_ptr<DesktopEffects> instance;
+
+    std::shared_ptr<DesktopEffects> effects = instance.lock();
+    if (!effects)
+    {
+        effects.reset(new DesktopEffects());
+        effects->disable();
+        instance = effects;
+    }
+
+    return effects;
+}
+
+void DesktopEffects::disable()
+{
+    for (size_t i = 0; i < _countof(kParameters); ++i)
+    {
+        bool enabled;
+
+        if (parameterValue(kParameters[i], &enabled) && enabled &&
+            setParameterValue(kParameters[i], false))
+        {
+            disabled_parameters_ |= 1U << i;
+        }
+    }
+
+    bool enabled;
+    if (minimizeAnimation(&enabled) && enabled)
+        animation_disabled_ = setMinimizeAnimation(false);
+
+    // The empty path removes the wallpaper. The color of the desktop is shown instead.
+    if (wallpaper(&wallpaper_) && !wallpaper_.isEmpty())
+        wallpaper_disabled_ = setWallpaper(QString());
+
+    qInfo("Desktop effects are disabled");
+}
+
+void DesktopEffects::restore()
+{
+    for (size_t i = 0; i < _countof(kParameters); ++i)
+    {
+        bool enabled;
+
+        if ((disabled_parameters_ & (1U << i)) &&
+            parameterValue(kParameters[i], &enabled) && !enabled)
+        {
+            setParameterValue(kParameters[i], true);
+        }
+    }
+
+    bool enabled;
+    if (animation_disabled_ && minimizeAnimation(&enabled) && !enabled)
+        setMinimizeAnimation(true);
+
+    QString current_wallpaper;
+    if (wallpaper_disabled_ && wallpaper(&current_wallpaper) && current_wallpaper.isEmpty())
+        setWallpaper(wallpaper_);
+
+    qInfo("Desktop effects are restored");
+}
+
+} // namespace aspia
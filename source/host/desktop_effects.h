@@ -0,0 +1,53 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/desktop_effects.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_HOST__DESKTOP_EFFECTS_H
+#define _ASPIA_HOST__DESKTOP_EFFECTS_H
+
+#include <QString>
+
+#include <memory>
+
+namespace aspia {
+
+//
+// Disables the wallpaper, the animations and the fading of the windows and the menus, the font
+// smoothing and the dragging of the windows with their contents while the desktop sessions
+// with FEATURE_REDUCED_EFFECTS are active. These effects change many pixels which the differ
+// and the encoders have to process. The changes are not written to the profile of the user,
+// so the effects are restored by the next logon if the process is terminated. When restoring,
+// the parameters which are changed by someone else in the meantime are kept.
+//
+class DesktopEffects
+{
+public:
+    ~DesktopEffects();
+
+    // Returns the disabled effects of the process and disables them if they are not disabled
+    // yet. The effects are restored with the last reference. Must be called in the main thread.
+    static std::shared_ptr<DesktopEffects> acquire();
+
+private:
+    DesktopEffects();
+
+    void disable();
+    void restore();
+
+    // The bits of the parameters of kParameters which are disabled by the object.
+    quint32 disabled_parameters_ = 0;
+
+    bool animation_disabled_ = false;
+
+    bool wallpaper_disabled_ = false;
+    QString wallpaper_;
+
+    Q_DISABLE_COPY(DesktopEffects)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_HOST__DESKTOP_EFFECTS_H
@@ -0,0 +1,403 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/file_archive_depacketizer.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "host/file_archive_depacketizer.h"
+
+#include <QDebug>
+#include <QFileInfo>
+#include <QtEndian>
+
+#include "host/file_archive_packetizer.h"
+#include "host/file_platform_util.h"
+
+namespace aspia {
+
+namespace {
+
+// The largest uncompressed packet.
+constexpr quint32 kMaxDataSize = 4 * 1024 * 1024; // 4MB
+
+std::unique_ptr<Decompressor> createDecompressor(
+    proto::file_transfer::PacketCompression compression)
+{
+    switch (compression)
+    {
+        case proto::file_transfer::PACKET_COMPRESSION_LZ4:
+            return Decompressor::create(proto::desktop::COMPRESSION_LZ4);
+
+        case proto::file_transfer::PACKET_COMPRESSION_ZSTD:
+            return Decompressor::create(proto::desktop::COMPRESSION_ZSTD);
+
+        default:
+            return nullptr;
+    }
+}
+
+// The paths of the archive must not point outside of its directory.
+bool isValidPath(const QString& path)
+{
+    if (path.isEmpty() || QDir::isAbsolutePath(path) || path.contains(QLatin1Char(':')))
+        return false;
+
+    const QString clean_path = QDir::cleanPath(path);
+
+    return clean_path != QLatin1String("..") && !clean_path.startsWith(QLatin1String("../"));
+}
+
+} // namespace
+
+FileArchiveDepacketizer::FileArchiveDepacketizer(const QDir& root, bool overwrite)
+    : root_(root),
+      overwrite_(overwrite)
+{
+    crypto_generichash_init(&hash_state_, nullptr, 0, crypto_generichash_BYTES);
+}
+
+FileArchiveDepacketizer::~FileArchiveDepacketizer()
+{
+    // The file which is not received completely is removed.
+    if (file_.isOpen())
+    {
+        file_.close();
+        file_.remove();
+    }
+}
+
+// static
+std::unique_ptr<FileArchiveDepacketizer> FileArchiveDepacketizer::create(
+    const QString& directory_path, bool overwrite)
+{
+    QDir root(directory_path);
+
+    if (!root.exists() && !root.mkpath(QStringLiteral(".")))
+    {
+        qDebug() << "Unable to create directory: " << directory_path;
+        return nullptr;
+    }
+
+    if (sodium_init() == -1)
+    {
+        qWarning("sodium_init failed");
+        return nullptr;
+    }
+
+    return std::unique_ptr<FileArchiveDepacketizer>(
+        new FileArchiveDepacketizer(QDir(root.absolutePath()), overwrite));
+}
+
+bool FileArchiveDepacketizer::writeNextPacket(const proto::file_transfer::Packet& packet,
+                                              proto::file_transfer::Reply* reply)
+{
+    if (packet.flags() & proto::file_transfer::Packet::FLAG_FIRST_PACKET)
+    {
+        archive_size_ = packet.file_size();
+        left_size_ = archive_size_;
+    }
+
+    if (archive_size_ < 0)
+    {
+        qDebug("Unexpected archive packet");
+        return false;
+    }
+
+    std::string decompressed;
+    const std::string* data = &packet.data();
+
+    if (packet.compression() != proto::file_transfer::PACKET_COMPRESSION_NONE)
+    {
+        if (!decompressPacket(packet, &decompressed))
+        {
+            qDebug("Unable to decompress archive packet");
+            return false;
+        }
+
+        data = &decompressed;
+    }
+
+    const qint64 data_size = static_cast<qint64>(data->size());
+    if (data_size > left_size_)
+    {
+        qDebug("Archive is larger than expected");
+        return false;
+    }
+
+    left_size_ -= data_size;
+
+    crypto_generichash_update(&hash_state_, reinterpret_cast<const quint8*>(data->data()),
+                              data->size());
+
+    if (!writeData(data->data(), data->size(), reply))
+        return false;
+
+    if (!(packet.flags() & proto::file_transfer::Packet::FLAG_LAST_PACKET))
+        return true;
+
+    if (left_size_ || state_ != State::HEADER || !header_.empty())
+    {
+        qDebug("Unexpected end of archive");
+        return false;
+    }
+
+    std::string hash(crypto_generichash_BYTES, 0);
+
+    crypto_generichash_final(&hash_state_, reinterpret_cast<quint8*>(&hash[0]), hash.size());
+
+    if (hash != packet.file_hash())
+    {
+        qDebug("Archive hash mismatch");
+        return false;
+    }
+
+    finishArchive();
+    return true;
+}
+
+bool FileArchiveDepacketizer::decompressPacket(const proto::file_transfer::Packet& packet,
+                                               std::string* data)
+{
+    const quint32 data_size = packet.data_size();
+
+    if (!data_size || data_size > kMaxDataSize)
+        return false;
+
+    if (!decompressor_ || compression_ != packet.compression())
+    {
+        // The stream can not be continued by another compression.
+        if (packet.solid())
+            return false;
+
+        decompressor_ = createDecompressor(packet.compression());
+        compression_ = packet.compression();
+
+        if (!decompressor_)
+            return false;
+    }
+    else if (!packet.solid())
+    {
+        decompressor_->reset();
+    }
+
+    // The extra byte of the output lets the decompressor consume the end of the flushed
+    // block after all data of the packet is written.
+    data->resize(data_size + 1);
+
+    const quint8* input_data = reinterpret_cast<const quint8*>(packet.data().data());
+    const size_t input_size = packet.data().size();
+    quint8* output_data = reinterpret_cast<quint8*>(&(*data)[0]);
+
+    size_t input_pos = 0;
+    size_t output_pos = 0;
+
+    while (output_pos < data_size || input_pos < input_size)
+    {
+        size_t consumed = 0;
+        size_t written = 0;
+
+        const bool more = decompressor_->process(input_data + input_pos, input_size - input_pos,
+                                                 output_data + output_pos,
+                                                 data_size + 1 - output_pos,
+                                                 &consumed, &written);
+        input_pos += consumed;
+        output_pos += written;
+
+        if (!more || (!consumed && !written) || output_pos > data_size)
+            break;
+    }
+
+    data->resize(data_size);
+
+    return output_pos == data_size && input_pos == input_size;
+}
+
+bool FileArchiveDepacketizer::writeData(const char* data,
+                                        size_t size,
+                                        proto::file_transfer::Reply* reply)
+{
+    while (size)
+    {
+        switch (state_)
+        {
+            case State::HEADER:
+            {
+                if (!readHeader(&data, &size))
+                    return false;
+            }
+            break;
+
+            case State::FILE_DATA:
+            {
+                const size_t part = static_cast<size_t>(qMin<qint64>(file_left_, size));
+
+                if (!skip_file_ && file_.write(data, part) != static_cast<qint64>(part))
+                {
+                    qDebug() << "Unable to write file: " << file_path_;
+                    skip_file_ = true;
+                }
+
+                data += part;
+                size -= part;
+                file_left_ -= part;
+
+                if (!file_left_)
+                    state_ = State::FILE_STATUS;
+            }
+            break;
+
+            case State::FILE_STATUS:
+            {
+                finishFile(static_cast<quint8>(*data) != FileArchivePacketizer::kFileSucceeded,
+                           reply);
+
+                ++data;
+                --size;
+
+                state_ = State::HEADER;
+            }
+            break;
+        }
+    }
+
+    return true;
+}
+
+bool FileArchiveDepacketizer::readHeader(const char** data, size_t* size)
+{
+    constexpr size_t kFixedSize = FileArchivePacketizer::kEntryHeaderSize;
+
+    // The header can be divided between the packets. The size of the path is at the end of the
+    // fixed part.
+    size_t header_size = kFixedSize;
+    if (header_.size() >= kFixedSize)
+        header_size += qFromLittleEndian<quint16>(header_.data() + kFixedSize - 2);
+
+    const size_t part = qMin(*size, header_size - header_.size());
+
+    header_.append(*data, part);
+    *data += part;
+    *size -= part;
+
+    if (header_.size() < header_size)
+        return true;
+
+    if (header_size == kFixedSize)
+    {
+        // The path is read by the next call.
+        if (!qFromLittleEndian<quint16>(header_.data() + kFixedSize - 2))
+        {
+            qDebug("Empty path in archive");
+            return false;
+        }
+
+        return true;
+    }
+
+    const char* header = header_.data();
+
+    const quint8 type = static_cast<quint8>(header[0]);
+    const qint64 modification_time = qFromLittleEndian<qint64>(header + 1);
+    const quint32 permissions = qFromLittleEndian<quint32>(header + 9);
+    const qint64 file_size = static_cast<qint64>(qFromLittleEndian<quint64>(header + 13));
+
+    relative_path_ = header_.substr(kFixedSize);
+    header_.clear();
+
+    const QString relative_path = QString::fromStdString(relative_path_);
+
+    if (!isValidPath(relative_path) || file_size < 0)
+    {
+        qDebug() << "Invalid archive entry: " << relative_path;
+        return false;
+    }
+
+    const QString path = root_.absoluteFilePath(relative_path);
+
+    if (type == FileArchivePacketizer::kDirectoryEntry)
+    {
+        if (file_size)
+            return false;
+
+        if (!QFileInfo(path).isDir())
+        {
+            // The items of the directory fail if it is not created.
+            if (root_.mkpath(relative_path))
+                directories_.push_back({ path, modification_time });
+            else
+                qDebug() << "Unable to create directory: " << path;
+        }
+
+        return true;
+    }
+
+    if (type != FileArchivePacketizer::kFileEntry)
+    {
+        qDebug() << "Unknown type of archive entry: " << type;
+        return false;
+    }
+
+    file_path_ = path;
+    file_left_ = file_size;
+    modification_time_ = modification_time;
+    permissions_ = permissions;
+    skip_file_ = false;
+    file_existed_ = false;
+
+    if (!overwrite_ && QFileInfo::exists(file_path_))
+    {
+        skip_file_ = true;
+        file_existed_ = true;
+    }
+    else
+    {
+        file_.setFileName(file_path_);
+
+        if (!file_.open(QFile::WriteOnly | QFile::Truncate))
+        {
+            qDebug() << "Unable to create file: " << file_path_;
+            skip_file_ = true;
+        }
+    }
+
+    state_ = file_left_ ? State::FILE_DATA : State::FILE_STATUS;
+    return true;
+}
+
+void FileArchiveDepacketizer::finishFile(bool read_failed, proto::file_transfer::Reply* reply)
+{
+    if (file_.isOpen())
+    {
+        file_.close();
+
+        if (read_failed || skip_file_)
+        {
+            file_.remove();
+        }
+        else
+        {
+            // The permissions are set after the time, because the read-only file can not be
+            // changed.
+            FilePlatformUtil::setModificationTime(file_path_, modification_time_);
+            QFile::setPermissions(file_path_, QFile::Permissions(permissions_));
+        }
+    }
+
+    if (file_existed_)
+        reply->add_existing_files(relative_path_);
+    else if (read_failed || skip_file_)
+        reply->add_failed_files(relative_path_);
+}
+
+void FileArchiveDepacketizer::finishArchive()
+{
+    // The writing of the items changes the times of the directories, so the innermost
+    // directories are the first.
+    for (auto it = directories_.crbegin(); it != directories_.crend(); ++it)
+        FilePlatformUtil::setModificationTime(it->path, it->modification_time);
+
+    directories_.clear();
+}
+
+} // namespace aspia
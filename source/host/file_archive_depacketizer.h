@@ -0,0 +1,96 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/file_archive_depacketizer.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_HOST__FILE_ARCHIVE_DEPACKETIZER_H
+#define _ASPIA_HOST__FILE_ARCHIVE_DEPACKETIZER_H
+
+#include <QDir>
+#include <QFile>
+
+#include <memory>
+#include <vector>
+
+#include <sodium.h>
+
+#include "codec/decompressor.h"
+#include "protocol/file_transfer_session.pb.h"
+
+namespace aspia {
+
+//
+// Extracts the archive of FileArchivePacketizer to the directory as its packets are received.
+// The files and the directories get the modification times and the permissions of the source.
+// The files which are not written are reported in the replies of the packets, so the sender
+// can transfer them separately and ask the user about them.
+//
+class FileArchiveDepacketizer
+{
+public:
+    ~FileArchiveDepacketizer();
+
+    // The directory is created if it does not exist. If |overwrite| is false, then the
+    // existing files are not replaced.
+    static std::unique_ptr<FileArchiveDepacketizer> create(const QString& directory_path,
+                                                           bool overwrite);
+
+    // Writes the contents of the packet. The files which are not written are added to
+    // |reply|. Returns false if the archive is not valid or the directory could not be written.
+    bool writeNextPacket(const proto::file_transfer::Packet& packet,
+                         proto::file_transfer::Reply* reply);
+
+private:
+    enum class State { HEADER, FILE_DATA, FILE_STATUS };
+
+    FileArchiveDepacketizer(const QDir& root, bool overwrite);
+
+    bool decompressPacket(const proto::file_transfer::Packet& packet, std::string* data);
+    bool writeData(const char* data, size_t size, proto::file_transfer::Reply* reply);
+    bool readHeader(const char** data, size_t* size);
+    void finishFile(bool read_failed, proto::file_transfer::Reply* reply);
+    void finishArchive();
+
+    const QDir root_;
+    const bool overwrite_;
+
+    State state_ = State::HEADER;
+    std::string header_;
+
+    // The current file. It is not written if |skip_file_| is true.
+    QString file_path_;
+    std::string relative_path_;
+    QFile file_;
+    qint64 file_left_ = 0;
+    qint64 modification_time_ = 0;
+    quint32 permissions_ = 0;
+    bool skip_file_ = false;
+    bool file_existed_ = false;
+
+    // The modification times of the created directories are set after their items are
+    // written.
+    struct Directory
+    {
+        QString path;
+        qint64 modification_time;
+    };
+
+    std::vector<Directory> directories_;
+
+    crypto_generichash_state hash_state_;
+
+    std::unique_ptr<Decompressor> decompressor_;
+    proto::file_transfer::PacketCompression compression_ =
+        proto::file_transfer::PACKET_COMPRESSION_NONE;
+
+    qint64 archive_size_ = -1;
+    qint64 left_size_ = 0;
+
+    Q_DISABLE_COPY(FileArchiveDepacketizer)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_HOST__FILE_ARCHIVE_DEPACKETIZER_H
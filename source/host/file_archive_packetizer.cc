@@ -0,0 +1,339 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/file_archive_packetizer.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "host/file_archive_packetizer.h"
+
+#include <QDateTime>
+#include <QDebug>
+#include <QDirIterator>
+#include <QFileInfo>
+#include <QtEndian>
+
+#include <cstring>
+
+#include "host/file_packetizer.h"
+
+namespace aspia {
+
+namespace {
+
+// The files are read by blocks of this size.
+constexpr qint64 kReadBlockSize = 1024 * 1024; // 1MB
+
+constexpr int kZstdCompressRatio = 3;
+
+// The compressed data must be smaller by at least 1/kMinCompressionGain of the original,
+// otherwise the packet is sent uncompressed and the next packet starts a new stream.
+constexpr size_t kMinCompressionGain = 16;
+
+// The maximum number of packets which are not compressed after the packets which do not
+// shrink.
+constexpr int kMaxSkipInterval = 64;
+
+std::unique_ptr<Compressor> createCompressor(proto::file_transfer::PacketCompression compression)
+{
+    switch (compression)
+    {
+        case proto::file_transfer::PACKET_COMPRESSION_LZ4:
+            return Compressor::create(proto::desktop::COMPRESSION_LZ4, 0);
+
+        case proto::file_transfer::PACKET_COMPRESSION_ZSTD:
+            return Compressor::create(proto::desktop::COMPRESSION_ZSTD, kZstdCompressRatio);
+
+        default:
+            return nullptr;
+    }
+}
+
+// Compresses |input| and flushes the stream, so the receiver decompresses all data of the
+// packet. Returns false if the compressed data does not fit into |output_size|.
+bool compressStream(Compressor* compressor,
+                    const std::string& input,
+                    size_t output_size,
+                    std::string* output)
+{
+    output->resize(output_size);
+
+    const quint8* input_data = reinterpret_cast<const quint8*>(input.data());
+    quint8* output_data = reinterpret_cast<quint8*>(const_cast<char*>(output->data()));
+
+    size_t input_pos = 0;
+    size_t output_pos = 0;
+
+    for (;;)
+    {
+        size_t consumed = 0;
+        size_t written = 0;
+
+        const bool more = compressor->process(input_data + input_pos, input.size() - input_pos,
+                                              output_data + output_pos, output_size - output_pos,
+                                              Compressor::CompressorSyncFlush,
+                                              &consumed, &written);
+        input_pos += consumed;
+        output_pos += written;
+
+        if (!more)
+            break;
+
+        if (output_pos == output_size)
+            return false;
+    }
+
+    if (input_pos != input.size())
+        return false;
+
+    output->resize(output_pos);
+    return true;
+}
+
+template <typename T>
+void appendNumber(std::string* output, T value)
+{
+    const T little_endian = qToLittleEndian(value);
+    output->append(reinterpret_cast<const char*>(&little_endian), sizeof(little_endian));
+}
+
+} // namespace
+
+FileArchivePacketizer::FileArchivePacketizer(const QDir& root,
+                                             std::vector<Entry>&& entries,
+                                             qint64 archive_size)
+    : root_(root),
+      entries_(std::move(entries)),
+      archive_size_(archive_size),
+      left_size_(archive_size)
+{
+    crypto_generichash_init(&hash_state_, nullptr, 0, crypto_generichash_BYTES);
+}
+
+// static
+std::unique_ptr<FileArchivePacketizer> FileArchivePacketizer::create(
+    const QString& directory_path)
+{
+    const QFileInfo directory_info(directory_path);
+    if (!directory_info.isDir())
+        return nullptr;
+
+    if (sodium_init() == -1)
+    {
+        qWarning("sodium_init failed");
+        return nullptr;
+    }
+
+    const QDir root(directory_info.absoluteFilePath());
+
+    std::vector<Entry> entries;
+    qint64 archive_size = 0;
+
+    QDirIterator it(root.absolutePath(),
+                    QDir::AllEntries | QDir::NoSymLinks | QDir::System | QDir::Hidden |
+                    QDir::NoDotAndDotDot,
+                    QDirIterator::Subdirectories);
+
+    while (it.hasNext())
+    {
+        it.next();
+
+        const QFileInfo info = it.fileInfo();
+
+        Entry entry;
+
+        entry.path = root.relativeFilePath(info.absoluteFilePath()).toStdString();
+        if (entry.path.size() > kMaxPathSize)
+        {
+            qWarning() << "Too long path: " << info.absoluteFilePath();
+            continue;
+        }
+
+        entry.modification_time = info.lastModified().toMSecsSinceEpoch();
+        entry.permissions = static_cast<quint32>(info.permissions());
+        entry.is_directory = info.isDir();
+
+        archive_size += kEntryHeaderSize + entry.path.size();
+
+        if (!entry.is_directory)
+        {
+            // The file is followed by the byte of its status.
+            entry.size = info.size();
+            archive_size += entry.size + 1;
+        }
+
+        entries.push_back(std::move(entry));
+    }
+
+    return std::unique_ptr<FileArchivePacketizer>(
+        new FileArchivePacketizer(root, std::move(entries), archive_size));
+}
+
+std::unique_ptr<proto::file_transfer::Packet> FileArchivePacketizer::readNextPacket(
+    qint64 packet_size, proto::file_transfer::PacketCompression compression)
+{
+    std::unique_ptr<proto::file_transfer::Packet> packet =
+        std::make_unique<proto::file_transfer::Packet>();
+
+    packet->set_flags(proto::file_transfer::Packet::FLAG_PACKET);
+
+    const size_t data_size = static_cast<size_t>(qMin(
+        left_size_, qBound(FilePacketizer::kMinPacketSize, packet_size,
+                           FilePacketizer::kMaxPacketSize)));
+
+    fillInput(data_size);
+
+    if (input_.size() < data_size)
+    {
+        qDebug("Unexpected end of the archive");
+        return nullptr;
+    }
+
+    packet->mutable_data()->assign(input_, 0, data_size);
+    input_.erase(0, data_size);
+    left_size_ -= data_size;
+
+    crypto_generichash_update(&hash_state_,
+                              reinterpret_cast<const quint8*>(packet->data().data()),
+                              data_size);
+
+    if (first_packet_)
+    {
+        first_packet_ = false;
+
+        packet->set_flags(packet->flags() | proto::file_transfer::Packet::FLAG_FIRST_PACKET);
+        packet->set_file_size(archive_size_);
+    }
+
+    if (!left_size_)
+    {
+        packet->set_flags(packet->flags() | proto::file_transfer::Packet::FLAG_LAST_PACKET);
+
+        std::string hash(crypto_generichash_BYTES, 0);
+
+        crypto_generichash_final(&hash_state_, reinterpret_cast<quint8*>(&hash[0]),
+                                 hash.size());
+
+        packet->set_file_hash(hash);
+    }
+
+    if (compression != proto::file_transfer::PACKET_COMPRESSION_NONE && !packet->data().empty())
+        compressPacket(packet.get(), compression);
+
+    return packet;
+}
+
+void FileArchivePacketizer::fillInput(size_t size)
+{
+    while (input_.size() < size && entry_index_ < entries_.size())
+    {
+        const Entry& entry = entries_[entry_index_];
+
+        if (!entry_started_)
+        {
+            appendHeader(entry);
+
+            if (entry.is_directory)
+            {
+                ++entry_index_;
+                continue;
+            }
+
+            entry_started_ = true;
+
+            file_.setFileName(root_.absoluteFilePath(QString::fromStdString(entry.path)));
+            file_failed_ = !file_.open(QFile::ReadOnly);
+            file_left_ = entry.size;
+            continue;
+        }
+
+        if (file_left_)
+        {
+            const qint64 read_size =
+                qMin(file_left_, qMin<qint64>(size - input_.size(), kReadBlockSize));
+            const size_t input_size = input_.size();
+
+            input_.resize(input_size + read_size);
+
+            // The file which is changed after the making of the list is sent with the size of
+            // the list. If it is shorter, then it is failed.
+            if (!file_failed_ && file_.read(&input_[input_size], read_size) != read_size)
+            {
+                qDebug() << "Unable to read file: " << file_.fileName();
+                file_failed_ = true;
+            }
+
+            if (file_failed_)
+                memset(&input_[input_size], 0, read_size);
+
+            file_left_ -= read_size;
+            continue;
+        }
+
+        input_.push_back(static_cast<char>(file_failed_ ? kFileReadFailed : kFileSucceeded));
+
+        file_.close();
+        entry_started_ = false;
+        ++entry_index_;
+    }
+}
+
+void FileArchivePacketizer::appendHeader(const Entry& entry)
+{
+    input_.push_back(static_cast<char>(entry.is_directory ? kDirectoryEntry : kFileEntry));
+
+    appendNumber<qint64>(&input_, entry.modification_time);
+    appendNumber<quint32>(&input_, entry.permissions);
+    appendNumber<quint64>(&input_, static_cast<quint64>(entry.size));
+    appendNumber<quint16>(&input_, static_cast<quint16>(entry.path.size()));
+
+    input_.append(entry.path);
+}
+
+void FileArchivePacketizer::compressPacket(proto::file_transfer::Packet* packet,
+                                           proto::file_transfer::PacketCompression compression)
+{
+    if (skipped_packets_)
+    {
+        --skipped_packets_;
+        return;
+    }
+
+    if (!compressor_ || compression_ != compression)
+    {
+        compressor_ = createCompressor(compression);
+        compression_ = compression;
+        stream_started_ = false;
+
+        if (!compressor_)
+            return;
+    }
+
+    if (!stream_started_)
+        compressor_->reset();
+
+    const std::string& data = packet->data();
+    const size_t max_size = data.size() - data.size() / kMinCompressionGain;
+
+    std::string compressed;
+
+    if (!max_size || !compressStream(compressor_.get(), data, max_size, &compressed))
+    {
+        // The receiver does not have the data of the stream, so it is started again.
+        stream_started_ = false;
+        skip_interval_ = qBound(1, skip_interval_ * 2, kMaxSkipInterval);
+        skipped_packets_ = skip_interval_;
+        return;
+    }
+
+    skip_interval_ = 0;
+
+    packet->set_solid(stream_started_);
+    stream_started_ = true;
+
+    packet->set_data_size(static_cast<quint32>(data.size()));
+    packet->set_compression(compression);
+    packet->mutable_data()->swap(compressed);
+}
+
+} // namespace aspia
@@ -0,0 +1,112 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/file_archive_packetizer.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_HOST__FILE_ARCHIVE_PACKETIZER_H
+#define _ASPIA_HOST__FILE_ARCHIVE_PACKETIZER_H
+
+#include <QDir>
+#include <QFile>
+
+#include <memory>
+#include <vector>
+
+#include <sodium.h>
+
+#include "codec/compressor.h"
+#include "protocol/file_transfer_session.pb.h"
+
+namespace aspia {
+
+//
+// Sends the directory with all its items as one file, so the many small files are transferred
+// by the packets of the usual size and are compressed together. The packets are compressed
+// as one stream while they shrink.
+//
+// The archive is a sequence of the entries. All numbers are little-endian. The header of the
+// entry contains:
+//   quint8  type (kDirectoryEntry or kFileEntry)
+//   qint64  modification time in milliseconds since the epoch
+//   quint32 permissions (QFileDevice::Permissions)
+//   quint64 size of the file (0 for the directories)
+//   quint16 size of the path
+//   the path relative to the directory in UTF-8 with the separators '/'
+// The header of the file is followed by its data and by one byte of kFileSucceeded or
+// kFileReadFailed. If the file could not be read, then the rest of its data is zeros.
+//
+// Each directory is before its items. The list of the items is made when the archive is
+// created, so the size of the archive is known from the first packet.
+//
+class FileArchivePacketizer
+{
+public:
+    ~FileArchivePacketizer() = default;
+
+    // Returns nullptr if |directory_path| is not a directory.
+    static std::unique_ptr<FileArchivePacketizer> create(const QString& directory_path);
+
+    // Creates a packet of the archive. See FilePacketizer::readNextPacket.
+    std::unique_ptr<proto::file_transfer::Packet> readNextPacket(
+        qint64 packet_size, proto::file_transfer::PacketCompression compression);
+
+    static constexpr quint8 kDirectoryEntry = 1;
+    static constexpr quint8 kFileEntry = 2;
+
+    static constexpr quint8 kFileSucceeded = 0;
+    static constexpr quint8 kFileReadFailed = 1;
+
+    static constexpr size_t kEntryHeaderSize = 23;
+    static constexpr size_t kMaxPathSize = 32767;
+
+private:
+    struct Entry
+    {
+        std::string path;
+        qint64 modification_time = 0;
+        quint32 permissions = 0;
+        qint64 size = 0;
+        bool is_directory = false;
+    };
+
+    FileArchivePacketizer(const QDir& root, std::vector<Entry>&& entries, qint64 archive_size);
+
+    void fillInput(size_t size);
+    void appendHeader(const Entry& entry);
+    void compressPacket(proto::file_transfer::Packet* packet,
+                        proto::file_transfer::PacketCompression compression);
+
+    const QDir root_;
+    const std::vector<Entry> entries_;
+    const qint64 archive_size_;
+
+    // The entry which is added to |input_|. The file is opened when its header is added.
+    size_t entry_index_ = 0;
+    bool entry_started_ = false;
+    QFile file_;
+    qint64 file_left_ = 0;
+    bool file_failed_ = false;
+
+    std::string input_;
+    qint64 left_size_ = 0;
+    bool first_packet_ = true;
+
+    crypto_generichash_state hash_state_;
+
+    // The compression stream is continued by the next packet while the packets shrink.
+    std::unique_ptr<Compressor> compressor_;
+    proto::file_transfer::PacketCompression compression_ =
+        proto::file_transfer::PACKET_COMPRESSION_NONE;
+    bool stream_started_ = false;
+
+    int skip_interval_ = 0;
+    int skipped_packets_ = 0;
+
+    Q_DISABLE_COPY(FileArchivePacketizer)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_HOST__FILE_ARCHIVE_PACKETIZER_H
@@ -0,0 +1,34 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/file_block_hash.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "host/file_block_hash.h"
+
+#include <QCryptographicHash>
+
+namespace aspia {
+
+namespace {
+
+constexpr qint64 kBlockSize = 64 * 1024; // 64kB
+
+} // namespace
+
+QByteArray fileBlockHash(QFile* file, qint64 position)
+{
+    const qint64 block_size = qMin(position, kBlockSize);
+
+    if (!file->seek(position - block_size))
+        return QByteArray();
+
+    const QByteArray block = file->read(block_size);
+    if (block.size() != block_size)
+        return QByteArray();
+
+    return QCryptographicHash::hash(block, QCryptographicHash::Sha256);
+}
+
+} // namespace aspia
@@ -0,0 +1,24 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/file_block_hash.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_HOST__FILE_BLOCK_HASH_H
+#define _ASPIA_HOST__FILE_BLOCK_HASH_H
+
+#include <QByteArray>
+#include <QFile>
+
+namespace aspia {
+
+// Calculates the hash of the block of |file| which ends at |position|. The block is smaller
+// at the beginning of the file. The source and the target of an interrupted transfer compare
+// the hashes to check that the target contains the beginning of the same file.
+// The position of |file| is changed. Returns an empty array on error.
+QByteArray fileBlockHash(QFile* file, qint64 position);
+
+} // namespace aspia
+
+#endif // _ASPIA_HOST__FILE_BLOCK_HASH_H
@@ -0,0 +1,157 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/file_delta.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "host/file_delta.h"
+
+#include <QCryptographicHash>
+
+namespace aspia {
+
+namespace {
+
+// The size of the block is the smallest power of two for which the file has no more than
+// kMaxBlockCount blocks. So the signature of the largest files fits into one message.
+constexpr qint64 kMinBlockSize = 4096; // 4kB
+constexpr qint64 kMaxBlockSize = 4 * 1024 * 1024; // 4MB
+constexpr qint64 kMaxBlockCount = 128 * 1024;
+
+constexpr int kWeakHashSize = sizeof(quint32);
+constexpr int kStrongHashSize = 16; // MD5
+
+constexpr int kFilterBits = 20;
+
+QByteArray strongHash(const char* block, qint64 size)
+{
+    return QCryptographicHash::hash(QByteArray::fromRawData(block, static_cast<int>(size)),
+                                    QCryptographicHash::Md5);
+}
+
+size_t filterIndex(quint32 checksum)
+{
+    return (checksum * 2654435761U) >> (32 - kFilterBits);
+}
+
+} // namespace
+
+void RollingChecksum::reset(const char* block, qint64 size)
+{
+    a_ = 0;
+    b_ = 0;
+    size_ = size;
+
+    for (qint64 i = 0; i < size; ++i)
+    {
+        a_ += static_cast<quint8>(block[i]) + kCharOffset;
+        b_ += a_;
+    }
+}
+
+bool createFileSignature(QFile* file, proto::file_transfer::FileSignature* signature)
+{
+    const qint64 file_size = file->size();
+
+    qint64 block_size = kMinBlockSize;
+
+    while (file_size / block_size > kMaxBlockCount && block_size < kMaxBlockSize)
+        block_size *= 2;
+
+    const qint64 block_count = file_size / block_size;
+
+    if (!file->seek(0))
+        return false;
+
+    std::string weak_hashes;
+    std::string strong_hashes;
+
+    weak_hashes.reserve(block_count * kWeakHashSize);
+    strong_hashes.reserve(block_count * kStrongHashSize);
+
+    QByteArray block(static_cast<int>(block_size), Qt::Uninitialized);
+    RollingChecksum checksum;
+
+    for (qint64 i = 0; i < block_count; ++i)
+    {
+        if (file->read(block.data(), block_size) != block_size)
+            return false;
+
+        checksum.reset(block.constData(), block_size);
+
+        const quint32 weak_hash = checksum.value();
+        weak_hashes.append(reinterpret_cast<const char*>(&weak_hash), kWeakHashSize);
+        strong_hashes.append(strongHash(block.constData(), block_size).toStdString());
+    }
+
+    signature->set_block_size(static_cast<quint32>(block_size));
+    signature->set_weak_hashes(std::move(weak_hashes));
+    signature->set_strong_hashes(std::move(strong_hashes));
+    return true;
+}
+
+// static
+std::unique_ptr<FileBlockIndex> FileBlockIndex::create(
+    const proto::file_transfer::FileSignature& signature)
+{
+    const qint64 block_size = signature.block_size();
+
+    if (block_size < kMinBlockSize || block_size > kMaxBlockSize)
+        return nullptr;
+
+    const size_t block_count = signature.weak_hashes().size() / kWeakHashSize;
+
+    if (!block_count || block_count > kMaxBlockCount ||
+        signature.weak_hashes().size() != block_count * kWeakHashSize ||
+        signature.strong_hashes().size() != block_count * kStrongHashSize)
+    {
+        return nullptr;
+    }
+
+    return std::unique_ptr<FileBlockIndex>(new FileBlockIndex(signature));
+}
+
+FileBlockIndex::FileBlockIndex(const proto::file_transfer::FileSignature& signature)
+    : block_size_(signature.block_size()),
+      strong_hashes_(signature.strong_hashes()),
+      filter_(size_t(1) << kFilterBits)
+{
+    const std::string& weak_hashes = signature.weak_hashes();
+    const qint64 block_count = weak_hashes.size() / kWeakHashSize;
+
+    blocks_.reserve(block_count);
+
+    for (qint64 i = 0; i < block_count; ++i)
+    {
+        quint32 weak_hash;
+        memcpy(&weak_hash, weak_hashes.data() + i * kWeakHashSize, kWeakHashSize);
+
+        filter_[filterIndex(weak_hash)] = true;
+        blocks_.emplace(weak_hash, i);
+    }
+}
+
+qint64 FileBlockIndex::find(quint32 checksum, const char* block) const
+{
+    if (!filter_[filterIndex(checksum)])
+        return -1;
+
+    const auto range = blocks_.equal_range(checksum);
+    if (range.first == range.second)
+        return -1;
+
+    const QByteArray hash = strongHash(block, block_size_);
+
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        const char* block_hash = strong_hashes_.data() + it->second * kStrongHashSize;
+
+        if (memcmp(block_hash, hash.constData(), kStrongHashSize) == 0)
+            return it->second;
+    }
+
+    return -1;
+}
+
+} // namespace aspia
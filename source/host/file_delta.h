@@ -0,0 +1,89 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/file_delta.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_HOST__FILE_DELTA_H
+#define _ASPIA_HOST__FILE_DELTA_H
+
+#include <QFile>
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "protocol/file_transfer_session.pb.h"
+
+namespace aspia {
+
+//
+// The existing file of the target is replaced by sending only the data which it does not
+// contain (the algorithm of rsync). The target sends the signature of its file: the weak
+// rolling checksums and the strong hashes of its blocks. The source looks for the blocks at
+// each position of its file and sends the references to the found blocks instead of their
+// data.
+//
+
+// The checksum of a block which can be moved forward by one byte cheaply.
+class RollingChecksum
+{
+public:
+    RollingChecksum() = default;
+
+    void reset(const char* block, qint64 size);
+
+    // Moves the block forward by one byte. |out| is the first byte of the block, |in| is the
+    // byte after the block.
+    void roll(char out, char in)
+    {
+        const quint32 out_value = static_cast<quint8>(out) + kCharOffset;
+
+        a_ += static_cast<quint8>(in) - static_cast<quint8>(out);
+        b_ += a_ - static_cast<quint32>(size_) * out_value;
+    }
+
+    quint32 value() const { return (a_ & 0xFFFF) | (b_ << 16); }
+
+private:
+    static const quint32 kCharOffset = 31;
+
+    quint32 a_ = 0;
+    quint32 b_ = 0;
+    qint64 size_ = 0;
+};
+
+// Calculates the signature of the whole blocks of |file|. Returns false on error.
+bool createFileSignature(QFile* file, proto::file_transfer::FileSignature* signature);
+
+// Finds the blocks of the signature by their checksums.
+class FileBlockIndex
+{
+public:
+    // Returns nullptr if the signature is not valid.
+    static std::unique_ptr<FileBlockIndex> create(
+        const proto::file_transfer::FileSignature& signature);
+
+    qint64 blockSize() const { return block_size_; }
+
+    // Returns the index of the block which has the same data as |block| or -1.
+    qint64 find(quint32 checksum, const char* block) const;
+
+private:
+    explicit FileBlockIndex(const proto::file_transfer::FileSignature& signature);
+
+    const qint64 block_size_;
+    const std::string strong_hashes_;
+
+    // Most of the positions of the file do not match any block. They are rejected by the
+    // filter without the lookup in |blocks_|.
+    std::vector<bool> filter_;
+    std::unordered_multimap<quint32, qint64> blocks_;
+
+    Q_DISABLE_COPY(FileBlockIndex)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_HOST__FILE_DELTA_H
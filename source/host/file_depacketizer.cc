@@ -8,65 +8,639 @@
 #include "host/file_depacketizer.h"
 
 #include <QDebug>
+#include <QThread>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+#include <sodium.h>
+
+#include "host/file_block_hash.h"
+#include "host/file_delta.h"
+#include "host/file_platform_util.h"
 
 namespace aspia {
 
-FileDepacketizer::FileDepacketizer(QPointer<QFile>& file)
+namespace {
+
+// The receiving of the packets is paused when this amount of data is not written yet.
+constexpr qint64 kWriteBehindSize = 8 * 1024 * 1024; // 8MB
+
+// The largest uncompressed packet.
+constexpr quint32 kMaxDataSize = 4 * 1024 * 1024; // 4MB
+
+// The blocks of the existing file are copied by parts of this size.
+constexpr qint64 kCopyBufferSize = 1024 * 1024; // 1MB
+
+// The zero ranges are hashed by parts of this size.
+constexpr qint64 kZeroBufferSize = 64 * 1024; // 64kB
+
+// The new file of the mode DELTA is written next to the existing file.
+const char kDeltaFileSuffix[] = ".delta";
+
+std::unique_ptr<Decompressor> createDecompressor(
+    proto::file_transfer::PacketCompression compression)
 {
-    file_.swap(file);
+    switch (compression)
+    {
+        case proto::file_transfer::PACKET_COMPRESSION_LZ4:
+            return Decompressor::create(proto::desktop::COMPRESSION_LZ4);
+
+        case proto::file_transfer::PACKET_COMPRESSION_ZSTD:
+            return Decompressor::create(proto::desktop::COMPRESSION_ZSTD);
+
+        default:
+            return nullptr;
+    }
 }
 
-// static
-std::unique_ptr<FileDepacketizer> FileDepacketizer::create(
-    const QString& file_path, bool overwrite)
+} // namespace
+
+class FileDepacketizer::Writer : public QThread
 {
-    QFile::OpenMode mode = QFile::WriteOnly;
+public:
+    Writer() = default;
+    ~Writer();
+
+    bool open(const QString& file_path, Mode mode);
+
+    // The following methods can be called only while no data is queued.
+    bool partialFile(proto::file_transfer::PartialFile* partial_file);
+    bool fileSignature(proto::file_transfer::FileSignature* signature);
+
+    // Removes the data after |offset| and continues the writing from it.
+    bool seek(qint64 offset);
+
+    // Queues the data for writing. Waits while too much data is not written yet. Returns false
+    // if the writing of the previous data has failed.
+    bool write(const char* data, qint64 size);
+
+    // Queues the copying of the blocks of the existing file. Returns false if the blocks are
+    // not in the signature or the writing has failed.
+    bool copy(qint64 block_index, qint64 block_count);
+
+    // Queues |size| zeros. They are written by the resizing of the file, so they become a hole
+    // if the file system supports the sparse files.
+    bool zero(qint64 size);
+
+    // Waits until all queued data is written. If |file_hash| is not empty, then the written
+    // data must have this hash. In the mode DELTA the new file replaces the existing file.
+    // Returns false if the writing has failed or the hash does not match.
+    bool flush(const std::string& file_hash);
+
+protected:
+    // QThread implementation.
+    void run() override;
+
+private:
+    struct Block
+    {
+        qint64 size() const { return data.size() + copy_size + zero_size; }
+
+        // Either the data, the part of |basis_file_| or the zeros are written.
+        QByteArray data;
+        qint64 copy_offset = 0;
+        qint64 copy_size = 0;
+        qint64 zero_size = 0;
+    };
+
+    bool writeBlock(const Block& block);
+    bool writeZeros(qint64 size);
+    bool queueBlock(Block&& block);
+    void updateHash(const char* data, qint64 size);
+
+    QFile file_;
+
+    // The existing file and the temporary file of the mode DELTA.
+    QFile basis_file_;
+    QString file_path_;
+    QString delta_path_;
+    qint64 block_size_ = 0;
+    qint64 block_count_ = 0;
+    bool replaced_ = false;
+    bool sparse_ = false;
+
+    // The data is hashed by the thread as it is written.
+    crypto_generichash_state hash_state_;
+
+    std::mutex lock_;
+    std::condition_variable condition_;
+    bool terminate_ = false;
+    bool error_ = false;
 
-    if (overwrite)
-        mode |= QFile::Truncate;
+    // The first block is removed when it is written.
+    std::deque<Block> blocks_;
+    qint64 queued_size_ = 0;
+
+    Q_DISABLE_COPY(Writer)
+};
+
+FileDepacketizer::Writer::~Writer()
+{
+    {
+        std::scoped_lock<std::mutex> lock(lock_);
+        terminate_ = true;
+        condition_.notify_all();
+    }
+
+    wait();
+
+    // The transfer is not completed. The existing file is kept.
+    if (!delta_path_.isEmpty() && !replaced_)
+    {
+        file_.close();
+        QFile::remove(delta_path_);
+    }
+}
+
+bool FileDepacketizer::Writer::open(const QString& file_path, Mode mode)
+{
+    file_path_ = file_path;
+
+    if (sodium_init() == -1)
+    {
+        qWarning("sodium_init failed");
+        return false;
+    }
+
+    crypto_generichash_init(&hash_state_, nullptr, 0, crypto_generichash_BYTES);
+
+    switch (mode)
+    {
+        case Mode::CREATE:
+            file_.setFileName(file_path);
+            return file_.open(QFile::WriteOnly);
+
+        case Mode::OVERWRITE:
+            file_.setFileName(file_path);
+            return file_.open(QFile::WriteOnly | QFile::Truncate);
+
+        case Mode::RESUME:
+            // The written part of the file is read to check it.
+            file_.setFileName(file_path);
+            return file_.open(QFile::ReadWrite);
+
+        case Mode::DELTA:
+        {
+            // If the existing file can not be read, then the new file is written completely.
+            basis_file_.setFileName(file_path);
+            basis_file_.open(QFile::ReadOnly);
+
+            delta_path_ = file_path + QLatin1String(kDeltaFileSuffix);
+
+            file_.setFileName(delta_path_);
+            if (!file_.open(QFile::WriteOnly | QFile::Truncate))
+            {
+                delta_path_.clear();
+                return false;
+            }
+
+            return true;
+        }
+
+        default:
+            return false;
+    }
+}
+
+bool FileDepacketizer::Writer::partialFile(proto::file_transfer::PartialFile* partial_file)
+{
+    const qint64 size = file_.size();
 
-    QPointer<QFile> file = new QFile(file_path);
+    const QByteArray hash = fileBlockHash(&file_, size);
+    if (hash.isEmpty())
+        return false;
+
+    partial_file->set_size(size);
+    partial_file->set_last_block_hash(hash.toStdString());
+    return true;
+}
+
+bool FileDepacketizer::Writer::fileSignature(proto::file_transfer::FileSignature* signature)
+{
+    if (!basis_file_.isOpen() || !createFileSignature(&basis_file_, signature))
+        return false;
+
+    block_size_ = signature->block_size();
+    block_count_ = basis_file_.size() / block_size_;
+    return true;
+}
+
+bool FileDepacketizer::Writer::seek(qint64 offset)
+{
+    if (offset > file_.size())
+        return false;
+
+    return file_.resize(offset) && file_.seek(offset);
+}
+
+bool FileDepacketizer::Writer::write(const char* data, qint64 size)
+{
+    Block block;
+    block.data = QByteArray(data, static_cast<int>(size));
+
+    return queueBlock(std::move(block));
+}
+
+bool FileDepacketizer::Writer::copy(qint64 block_index, qint64 block_count)
+{
+    if (block_index < 0 || block_count <= 0 || block_index + block_count > block_count_)
+        return false;
+
+    Block block;
+    block.copy_offset = block_index * block_size_;
+    block.copy_size = block_count * block_size_;
+
+    return queueBlock(std::move(block));
+}
+
+bool FileDepacketizer::Writer::zero(qint64 size)
+{
+    if (size <= 0)
+        return false;
+
+    Block block;
+    block.zero_size = size;
+
+    return queueBlock(std::move(block));
+}
+
+bool FileDepacketizer::Writer::queueBlock(Block&& block)
+{
+    std::unique_lock<std::mutex> lock(lock_);
+
+    // The copied blocks are also counted, so the receiving of the packets is paused while the
+    // disk is busy.
+    while (queued_size_ >= kWriteBehindSize && !error_)
+        condition_.wait(lock);
+
+    if (error_)
+        return false;
+
+    if (!block.size())
+        return true;
+
+    queued_size_ += block.size();
+    blocks_.emplace_back(std::move(block));
+
+    condition_.notify_all();
+    return true;
+}
+
+bool FileDepacketizer::Writer::flush(const std::string& file_hash)
+{
+    std::unique_lock<std::mutex> lock(lock_);
+
+    while (queued_size_ && !error_)
+        condition_.wait(lock);
+
+    if (error_)
+        return false;
+
+    if (!file_hash.empty())
+    {
+        std::string hash(crypto_generichash_BYTES, 0);
+
+        crypto_generichash_final(&hash_state_, reinterpret_cast<quint8*>(&hash[0]),
+                                 hash.size());
+
+        // In the mode DELTA the existing file is kept.
+        if (hash != file_hash)
+        {
+            qDebug("Hash of file does not match");
+            return false;
+        }
+    }
+
+    // The thread does not touch the file while the queue is empty.
+    if (!file_.flush())
+        return false;
+
+    file_.close();
+
+    if (delta_path_.isEmpty())
+        return true;
+
+    basis_file_.close();
+
+    if (QFile::exists(file_path_) && !QFile::remove(file_path_))
+        return false;
+
+    if (!QFile::rename(delta_path_, file_path_))
+        return false;
 
-    if (!file->open(mode))
+    replaced_ = true;
+    return true;
+}
+
+bool FileDepacketizer::Writer::writeBlock(const Block& block)
+{
+    if (block.zero_size)
+    {
+        // The file is marked once. If the file system does not support it, then the resizing
+        // writes the zeros.
+        if (!sparse_)
+        {
+            FilePlatformUtil::setSparseFile(&file_);
+            sparse_ = true;
+        }
+
+        return writeZeros(block.zero_size);
+    }
+
+    // The blocks are written one after another, so the position of the file is not changed.
+    if (!block.copy_size)
+    {
+        updateHash(block.data.constData(), block.data.size());
+        return file_.write(block.data) == block.data.size();
+    }
+
+    if (!basis_file_.seek(block.copy_offset))
+        return false;
+
+    QByteArray buffer(static_cast<int>(qMin(block.copy_size, kCopyBufferSize)),
+                      Qt::Uninitialized);
+
+    for (qint64 left_size = block.copy_size; left_size > 0;)
+    {
+        const qint64 size = qMin(left_size, kCopyBufferSize);
+
+        if (basis_file_.read(buffer.data(), size) != size)
+            return false;
+
+        if (file_.write(buffer.constData(), size) != size)
+            return false;
+
+        updateHash(buffer.constData(), size);
+        left_size -= size;
+    }
+
+    return true;
+}
+
+bool FileDepacketizer::Writer::writeZeros(qint64 size)
+{
+    static const char kZeros[kZeroBufferSize] = { 0 };
+
+    for (qint64 left_size = size; left_size > 0; left_size -= kZeroBufferSize)
+        updateHash(kZeros, qMin(left_size, kZeroBufferSize));
+
+    // The data is always written at the end of the file.
+    const qint64 end = file_.pos() + size;
+    return file_.resize(end) && file_.seek(end);
+}
+
+void FileDepacketizer::Writer::updateHash(const char* data, qint64 size)
+{
+    crypto_generichash_update(&hash_state_, reinterpret_cast<const quint8*>(data), size);
+}
+
+void FileDepacketizer::Writer::run()
+{
+    std::unique_lock<std::mutex> lock(lock_);
+
+    for (;;)
+    {
+        while (!terminate_ && blocks_.empty())
+            condition_.wait(lock);
+
+        if (terminate_)
+            return;
+
+        const Block block = blocks_.front();
+
+        lock.unlock();
+
+        const bool success = writeBlock(block);
+
+        lock.lock();
+
+        blocks_.pop_front();
+        queued_size_ -= block.size();
+
+        if (!success)
+            error_ = true;
+
+        condition_.notify_all();
+
+        if (error_)
+            return;
+    }
+}
+
+FileDepacketizer::FileDepacketizer(std::unique_ptr<Writer> writer, Mode mode)
+    : writer_(std::move(writer)),
+      mode_(mode)
+{
+    writer_->start(QThread::LowPriority);
+}
+
+FileDepacketizer::~FileDepacketizer() = default;
+
+// static
+std::unique_ptr<FileDepacketizer> FileDepacketizer::create(const QString& file_path, Mode mode)
+{
+    std::unique_ptr<Writer> writer = std::make_unique<Writer>();
+
+    if (!writer->open(file_path, mode))
         return nullptr;
 
-    return std::unique_ptr<FileDepacketizer>(new FileDepacketizer(file));
+    return std::unique_ptr<FileDepacketizer>(new FileDepacketizer(std::move(writer), mode));
 }
 
-bool FileDepacketizer::writeNextPacket(const proto::file_transfer::Packet& packet)
+bool FileDepacketizer::partialFile(proto::file_transfer::PartialFile* partial_file)
 {
-    Q_ASSERT(!file_.isNull() && file_->isOpen());
+    if (mode_ != Mode::RESUME || file_size_)
+        return false;
+
+    return writer_->partialFile(partial_file);
+}
+
+bool FileDepacketizer::fileSignature(proto::file_transfer::FileSignature* signature)
+{
+    if (mode_ != Mode::DELTA || file_size_)
+        return false;
 
+    return writer_->fileSignature(signature);
+}
+
+bool FileDepacketizer::writeNextPacket(const proto::file_transfer::Packet& packet)
+{
     // The first packet must have the full file size.
     if (packet.flags() & proto::file_transfer::Packet::FLAG_FIRST_PACKET)
     {
+        const qint64 offset = static_cast<qint64>(packet.offset());
+
+        // The source starts from the beginning if the written part does not match.
+        if (mode_ == Mode::RESUME)
+        {
+            if (!writer_->seek(offset))
+            {
+                qDebug("Unable to resume file");
+                return false;
+            }
+        }
+        else if (offset)
+        {
+            qDebug("Unexpected offset of packet");
+            return false;
+        }
+
         file_size_ = packet.file_size();
-        left_size_ = file_size_;
+        left_size_ = file_size_ - offset;
     }
 
-    const size_t packet_size = packet.data().size();
-
-    if (!file_->seek(file_size_ - left_size_))
+    // The zeros are sent only instead of the plain data.
+    if (packet.zero_ranges_size() && packet.block_copies_size())
     {
-        qDebug("seek failed");
+        qDebug("Unexpected zero ranges in packet");
         return false;
     }
 
-    if (file_->write(packet.data().data(), packet_size) != packet_size)
+    const std::string* data = &packet.data();
+    std::string decompressed;
+
+    if (packet.compression() != proto::file_transfer::PACKET_COMPRESSION_NONE)
+    {
+        if (!decompressPacket(packet, &decompressed))
+        {
+            qDebug("Unable to decompress packet");
+            return false;
+        }
+
+        data = &decompressed;
+    }
+
+    if (!writePacketData(packet, *data))
     {
         qDebug("Unable to write file");
         return false;
     }
 
-    left_size_ -= packet_size;
+    left_size_ -= data->size() + packet.copied_size() + packet.zero_size();
 
     if (packet.flags() & proto::file_transfer::Packet::FLAG_LAST_PACKET)
     {
         file_size_ = 0;
-        file_->close();
+
+        if (!writer_->flush(packet.file_hash()))
+        {
+            qDebug("Unable to write file");
+            return false;
+        }
     }
 
     return true;
 }
 
+bool FileDepacketizer::writePacketData(const proto::file_transfer::Packet& packet,
+                                       const std::string& data)
+{
+    if (packet.zero_ranges_size())
+        return writeSparseData(packet, data);
+
+    size_t data_pos = 0;
+
+    for (const auto& copy : packet.block_copies())
+    {
+        const size_t data_offset = copy.data_offset();
+
+        if (data_offset < data_pos || data_offset > data.size())
+            return false;
+
+        if (!writer_->write(data.data() + data_pos, data_offset - data_pos))
+            return false;
+
+        if (!writer_->copy(copy.block_index(), copy.block_count()))
+            return false;
+
+        data_pos = data_offset;
+    }
+
+    return writer_->write(data.data() + data_pos, data.size() - data_pos);
+}
+
+bool FileDepacketizer::writeSparseData(const proto::file_transfer::Packet& packet,
+                                       const std::string& data)
+{
+    const quint64 zero_size = packet.zero_size();
+
+    if (static_cast<qint64>(zero_size) > left_size_)
+        return false;
+
+    size_t data_pos = 0;
+    quint64 total_size = 0;
+
+    for (const auto& range : packet.zero_ranges())
+    {
+        const size_t data_offset = range.data_offset();
+
+        if (data_offset < data_pos || data_offset > data.size())
+            return false;
+
+        total_size += range.size();
+        if (total_size > zero_size)
+            return false;
+
+        if (!writer_->write(data.data() + data_pos, data_offset - data_pos))
+            return false;
+
+        if (!writer_->zero(static_cast<qint64>(range.size())))
+            return false;
+
+        data_pos = data_offset;
+    }
+
+    if (total_size != zero_size)
+        return false;
+
+    return writer_->write(data.data() + data_pos, data.size() - data_pos);
+}
+
+bool FileDepacketizer::decompressPacket(const proto::file_transfer::Packet& packet,
+                                        std::string* data)
+{
+    const quint32 data_size = packet.data_size();
+
+    if (!data_size || data_size > kMaxDataSize)
+        return false;
+
+    if (!decompressor_ || compression_ != packet.compression())
+    {
+        decompressor_ = createDecompressor(packet.compression());
+        compression_ = packet.compression();
+
+        if (!decompressor_)
+            return false;
+    }
+
+    decompressor_->reset();
+    data->resize(data_size);
+
+    const quint8* input_data = reinterpret_cast<const quint8*>(packet.data().data());
+    const size_t input_size = packet.data().size();
+    quint8* output_data = reinterpret_cast<quint8*>(const_cast<char*>(data->data()));
+
+    size_t input_pos = 0;
+    size_t output_pos = 0;
+
+    while (output_pos < data_size)
+    {
+        size_t consumed = 0;
+        size_t written = 0;
+
+        const bool more = decompressor_->process(input_data + input_pos, input_size - input_pos,
+                                                 output_data + output_pos, data_size - output_pos,
+                                                 &consumed, &written);
+        input_pos += consumed;
+        output_pos += written;
+
+        if (!more || (!consumed && !written))
+            break;
+    }
+
+    return output_pos == data_size && input_pos == input_size;
+}
+
 } // namespace aspia
@@ -9,27 +9,70 @@
 #define _ASPIA_HOST__FILE_DEPACKETIZER_H
 
 #include <QFile>
-#include <QPointer>
 #include <memory>
 
+#include "codec/decompressor.h"
 #include "protocol/file_transfer_session.pb.h"
 
 namespace aspia {
 
+//
+// The packets are written to the file sequentially by a separate thread, so the writing of
+// the disk overlaps the receiving of the next packets. An error of the writing is reported
+// for one of the next packets. The last packet is reported when all data is written and its
+// hash matches the hash of the source file.
+//
 class FileDepacketizer
 {
 public:
-    ~FileDepacketizer() = default;
+    ~FileDepacketizer();
+
+    enum class Mode
+    {
+        // The file must not exist.
+        CREATE,
+
+        // The existing file is truncated.
+        OVERWRITE,
+
+        // The existing file is opened without the truncation and the first packet is written
+        // at its offset.
+        RESUME,
+
+        // The new file is written to a temporary file and replaces the existing file after the
+        // last packet. The packets can refer to the blocks of the existing file.
+        DELTA
+    };
 
-    static std::unique_ptr<FileDepacketizer> create(const QString& file_path, bool overwrite);
+    static std::unique_ptr<FileDepacketizer> create(const QString& file_path, Mode mode);
+
+    // Returns the part of the file which is already written. Only in the mode RESUME before
+    // the first packet.
+    bool partialFile(proto::file_transfer::PartialFile* partial_file);
+
+    // Returns the signature of the existing file. Only in the mode DELTA before the first
+    // packet. Returns false if the file does not exist or can not be read.
+    bool fileSignature(proto::file_transfer::FileSignature* signature);
 
     // Reads the packet and writes its contents to a file.
     bool writeNextPacket(const proto::file_transfer::Packet& packet);
 
 private:
-    FileDepacketizer(QPointer<QFile>& file_stream);
+    class Writer;
+
+    FileDepacketizer(std::unique_ptr<Writer> writer, Mode mode);
+
+    bool writePacketData(const proto::file_transfer::Packet& packet, const std::string& data);
+    bool writeSparseData(const proto::file_transfer::Packet& packet, const std::string& data);
+    bool decompressPacket(const proto::file_transfer::Packet& packet, std::string* data);
+
+    std::unique_ptr<Writer> writer_;
+
+    std::unique_ptr<Decompressor> decompressor_;
+    proto::file_transfer::PacketCompression compression_ =
+        proto::file_transfer::PACKET_COMPRESSION_NONE;
 
-    QPointer<QFile> file_;
+    const Mode mode_;
 
     qint64 file_size_ = 0;
     qint64 left_size_ = 0;
@@ -7,14 +7,119 @@
 
 #include "host/file_packetizer.h"
 
+#include <QDir>
+#include <QStorageInfo>
+#include <QThread>
+
+#if defined(Q_PROCESSOR_X86)
+#if defined(Q_CC_MSVC)
+#include <intrin.h>
+#else
+#include <emmintrin.h>
+#endif
+#endif
+
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+
+#include <sodium.h>
+
+#include "base/cpu_dispatch.h"
+#include "host/file_block_hash.h"
+#include "host/file_platform_util.h"
+
 namespace aspia {
 
 namespace {
 
-// When transferring a file is divided into parts and each part is
-// transmitted separately.
-// This parameter specifies the size of the part.
-constexpr qint64 kPacketPartSize = 16 * 1024; // 16 kB
+// The file is read by blocks of this size.
+constexpr qint64 kReadBlockSize = 1024 * 1024; // 1MB
+
+// The reading is paused when this amount of data is read and not taken by the packets yet.
+// It must be larger than the largest packet.
+constexpr qint64 kReadAheadSize = 8 * 1024 * 1024; // 8MB
+
+// The large files of the local disks are mapped into the memory by blocks of this size. The
+// packets are copied from the mapping, so the data is not copied by the reading. The pages
+// of the blocks are read from the disk by the hashing of the thread ahead of the packets.
+constexpr qint64 kMinMappedFileSize = 32 * 1024 * 1024; // 32MB
+constexpr qint64 kMapBlockSize = 4 * 1024 * 1024; // 4MB
+
+constexpr int kZstdCompressRatio = 3;
+
+// The compressed data must be smaller by at least 1/kMinCompressionGain of the original,
+// otherwise the packet is sent uncompressed.
+constexpr size_t kMinCompressionGain = 16;
+
+// The blocks of the existing file of the target which are referenced by one packet. The
+// packets of the unchanged parts of the file are small, but they are not answered before
+// the copying.
+constexpr qint64 kMaxCopiedSize = 32 * 1024 * 1024; // 32MB
+
+// The data of the sparse files is checked for zeros by blocks of this size (the cluster of
+// NTFS). The zeros of one packet span up to kMaxZeroSize of the file, so the large holes are
+// skipped by a few packets.
+constexpr qint64 kZeroBlockSize = 4096;
+constexpr qint64 kSparseReadSize = 64 * 1024; // 64kB
+constexpr qint64 kMaxZeroSize = 64 * 1024 * 1024; // 64MB
+
+// The maximum number of packets which are not compressed after the packets which do not
+// shrink. Already compressed files (archives, media) do not waste the CPU.
+constexpr int kMaxSkipInterval = 64;
+
+typedef bool(*IsZeroBlockFunc)(const char*);
+
+#if defined(Q_PROCESSOR_X86)
+bool isZeroBlock_SSE2(const char* block)
+{
+    const __m128i* data = reinterpret_cast<const __m128i*>(block);
+    const __m128i zero = _mm_setzero_si128();
+
+    // The blocks with the data usually differ from zeros at the beginning.
+    for (size_t i = 0; i < kZeroBlockSize / sizeof(__m128i); i += 4)
+    {
+        __m128i acc = _mm_or_si128(_mm_loadu_si128(data + i), _mm_loadu_si128(data + i + 1));
+        acc = _mm_or_si128(acc, _mm_loadu_si128(data + i + 2));
+        acc = _mm_or_si128(acc, _mm_loadu_si128(data + i + 3));
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(acc, zero)) != 0xFFFF)
+            return false;
+    }
+
+    return true;
+}
+#endif // defined(Q_PROCESSOR_X86)
+
+bool isZeroBlock_C(const char* block)
+{
+    for (size_t i = 0; i < kZeroBlockSize; i += sizeof(quint64))
+    {
+        quint64 value;
+        memcpy(&value, block + i, sizeof(value));
+
+        if (value)
+            return false;
+    }
+
+    return true;
+}
+
+// Returns true if kZeroBlockSize bytes of |block| are zeros.
+bool isZeroBlock(const char* block)
+{
+    static const IsZeroBlockFunc is_zero_block_func =
+        CpuDispatch::select<IsZeroBlockFunc>("file_zero_block",
+        {
+#if defined(Q_PROCESSOR_X86)
+            { CpuDispatch::SSE2, isZeroBlock_SSE2 },
+#endif // defined(Q_PROCESSOR_X86)
+            { CpuDispatch::C, isZeroBlock_C }
+        });
+
+    return is_zero_block_func(block);
+}
 
 char* GetOutputBuffer(proto::file_transfer::Packet* packet, size_t size)
 {
@@ -22,29 +127,433 @@ char* GetOutputBuffer(proto::file_transfer::Packet* packet, size_t size)
     return const_cast<char*>(packet->mutable_data()->data());
 }
 
+std::unique_ptr<Compressor> createCompressor(proto::file_transfer::PacketCompression compression)
+{
+    switch (compression)
+    {
+        case proto::file_transfer::PACKET_COMPRESSION_LZ4:
+            return Compressor::create(proto::desktop::COMPRESSION_LZ4, 0);
+
+        case proto::file_transfer::PACKET_COMPRESSION_ZSTD:
+            return Compressor::create(proto::desktop::COMPRESSION_ZSTD, kZstdCompressRatio);
+
+        default:
+            return nullptr;
+    }
+}
+
+// Returns false if the compressed data does not fit into |output_size|.
+bool compressData(Compressor* compressor,
+                  const std::string& input,
+                  size_t output_size,
+                  std::string* output)
+{
+    compressor->reset();
+    output->resize(output_size);
+
+    const quint8* input_data = reinterpret_cast<const quint8*>(input.data());
+    quint8* output_data = reinterpret_cast<quint8*>(const_cast<char*>(output->data()));
+
+    size_t input_pos = 0;
+    size_t output_pos = 0;
+
+    for (;;)
+    {
+        size_t consumed = 0;
+        size_t written = 0;
+
+        const bool more = compressor->process(input_data + input_pos, input.size() - input_pos,
+                                              output_data + output_pos, output_size - output_pos,
+                                              Compressor::CompressorFinish,
+                                              &consumed, &written);
+        input_pos += consumed;
+        output_pos += written;
+
+        if (!more)
+            break;
+
+        if (output_pos == output_size)
+            return false;
+    }
+
+    if (input_pos != input.size())
+        return false;
+
+    output->resize(output_pos);
+    return true;
+}
+
 } // namespace
 
-FilePacketizer::FilePacketizer(QPointer<QFile>& file)
+class FilePacketizer::Reader : public QThread
+{
+public:
+    Reader() = default;
+    ~Reader();
+
+    bool open(const QString& file_path);
+    qint64 fileSize() const { return file_size_; }
+
+    // Copies the next |size| bytes of the file to |buffer|. Waits until the data is read.
+    // Returns false if the file could not be read.
+    bool read(char* buffer, qint64 size);
+
+    // Discards the data which is read ahead and continues the reading from |offset|.
+    // Returns false if the file could not be read.
+    bool restart(qint64 offset);
+
+    // Calculates the hash of the block before |position|. See fileBlockHash().
+    QByteArray blockHash(qint64 position);
+
+    // Waits until the file is read to the end and returns the hash of the data from the
+    // offset of the last restart. Returns an empty array if the file could not be read.
+    QByteArray fileHash();
+
+protected:
+    // QThread implementation.
+    void run() override;
+
+private:
+    struct Block
+    {
+        const char* data() const
+        {
+            return mapped ? reinterpret_cast<const char*>(mapped) : buffer.constData();
+        }
+
+        // Either the data is read into |buffer| or |size| bytes are mapped at |mapped|.
+        QByteArray buffer;
+        uchar* mapped = nullptr;
+        qint64 size = 0;
+    };
+
+    bool readBlock(qint64 position, qint64 size, Block* block);
+    void releaseBlock(Block* block);
+
+    QFile file_;
+    qint64 file_size_ = 0;
+    qint64 offset_ = 0;
+
+    // The data is hashed by the thread as it is read, so the hash does not need a second
+    // reading of the file.
+    crypto_generichash_state hash_state_;
+    QByteArray hash_;
+
+    // The mappings of QFile are not thread-safe, so the blocks are mapped and unmapped with
+    // |lock_|.
+    bool mapped_ = false;
+
+    std::mutex lock_;
+    std::condition_variable condition_;
+    bool terminate_ = false;
+    bool error_ = false;
+
+    // The blocks which are read ahead. |block_offset_| bytes of the first block are taken
+    // already, |queued_size_| bytes of the blocks are not.
+    std::deque<Block> blocks_;
+    qint64 block_offset_ = 0;
+    qint64 queued_size_ = 0;
+
+    Q_DISABLE_COPY(Reader)
+};
+
+FilePacketizer::Reader::~Reader()
+{
+    {
+        std::scoped_lock<std::mutex> lock(lock_);
+        terminate_ = true;
+        condition_.notify_all();
+    }
+
+    wait();
+
+    for (auto& block : blocks_)
+        releaseBlock(&block);
+}
+
+bool FilePacketizer::Reader::open(const QString& file_path)
+{
+    file_.setFileName(file_path);
+
+    if (!file_.open(QFile::ReadOnly))
+        return false;
+
+    file_size_ = file_.size();
+
+    if (sodium_init() == -1)
+    {
+        qWarning("sodium_init failed");
+        return false;
+    }
+
+    crypto_generichash_init(&hash_state_, nullptr, 0, crypto_generichash_BYTES);
+
+    // An error of the reading of a mapped page is an exception. The files of the network and
+    // removable drives are read as usual.
+    if (file_size_ >= kMinMappedFileSize)
+    {
+        const QString root_path = QDir::toNativeSeparators(QStorageInfo(file_path).rootPath());
+
+        mapped_ = FilePlatformUtil::driveType(root_path) ==
+            proto::file_transfer::DriveList::Item::TYPE_FIXED;
+    }
+
+    return true;
+}
+
+bool FilePacketizer::Reader::read(char* buffer, qint64 size)
+{
+    std::unique_lock<std::mutex> lock(lock_);
+
+    while (queued_size_ < size && !error_)
+        condition_.wait(lock);
+
+    if (queued_size_ < size)
+        return false;
+
+    while (size > 0)
+    {
+        Block& block = blocks_.front();
+        const qint64 count = qMin(size, block.size - block_offset_);
+
+        memcpy(buffer, block.data() + block_offset_, count);
+
+        buffer += count;
+        size -= count;
+        block_offset_ += count;
+        queued_size_ -= count;
+
+        if (block_offset_ == block.size)
+        {
+            releaseBlock(&block);
+            blocks_.pop_front();
+            block_offset_ = 0;
+        }
+    }
+
+    condition_.notify_all();
+    return true;
+}
+
+bool FilePacketizer::Reader::restart(qint64 offset)
+{
+    {
+        std::scoped_lock<std::mutex> lock(lock_);
+        terminate_ = true;
+        condition_.notify_all();
+    }
+
+    wait();
+
+    // The thread has stopped, so the file and the queue are not used by it.
+    terminate_ = false;
+    error_ = false;
+
+    for (auto& block : blocks_)
+        releaseBlock(&block);
+
+    blocks_.clear();
+    block_offset_ = 0;
+    queued_size_ = 0;
+
+    crypto_generichash_init(&hash_state_, nullptr, 0, crypto_generichash_BYTES);
+    hash_.clear();
+
+    if (!file_.isOpen() && !file_.open(QFile::ReadOnly))
+        return false;
+
+    if (!file_.seek(offset))
+        return false;
+
+    offset_ = offset;
+    start(QThread::LowPriority);
+    return true;
+}
+
+QByteArray FilePacketizer::Reader::blockHash(qint64 position)
+{
+    // The file is opened again, so the reading ahead is not interrupted.
+    QFile file(file_.fileName());
+
+    if (!file.open(QFile::ReadOnly))
+        return QByteArray();
+
+    return fileBlockHash(&file, position);
+}
+
+QByteArray FilePacketizer::Reader::fileHash()
+{
+    std::unique_lock<std::mutex> lock(lock_);
+
+    while (hash_.isEmpty() && !error_)
+        condition_.wait(lock);
+
+    return hash_;
+}
+
+bool FilePacketizer::Reader::readBlock(qint64 position, qint64 size, Block* block)
+{
+    block->size = size;
+
+    if (!mapped_)
+    {
+        // The blocks are read one after another, so the position of the file is not changed.
+        block->buffer = QByteArray(static_cast<int>(size), Qt::Uninitialized);
+        return file_.read(block->buffer.data(), size) == size;
+    }
+
+    {
+        std::scoped_lock<std::mutex> lock(lock_);
+        block->mapped = file_.map(position, size);
+    }
+
+    return block->mapped != nullptr;
+}
+
+void FilePacketizer::Reader::releaseBlock(Block* block)
 {
-    file_.swap(file);
-    file_size_ = file_->size();
+    if (block->mapped)
+    {
+        file_.unmap(block->mapped);
+        block->mapped = nullptr;
+    }
+}
+
+void FilePacketizer::Reader::run()
+{
+    qint64 position = offset_;
+    qint64 left_size = file_size_ - offset_;
+
+    while (left_size > 0)
+    {
+        {
+            std::unique_lock<std::mutex> lock(lock_);
+
+            while (!terminate_ && queued_size_ >= kReadAheadSize)
+                condition_.wait(lock);
+
+            if (terminate_)
+                return;
+        }
+
+        const qint64 block_size = qMin(left_size, mapped_ ? kMapBlockSize : kReadBlockSize);
+
+        Block block;
+        const bool success = readBlock(position, block_size, &block);
+
+        if (success)
+        {
+            crypto_generichash_update(&hash_state_,
+                                      reinterpret_cast<const quint8*>(block.data()),
+                                      block.size);
+        }
+
+        std::scoped_lock<std::mutex> lock(lock_);
+
+        if (!success)
+        {
+            error_ = true;
+            condition_.notify_all();
+            return;
+        }
+
+        blocks_.emplace_back(std::move(block));
+        queued_size_ += block_size;
+        condition_.notify_all();
+
+        position += block_size;
+        left_size -= block_size;
+    }
+
+    {
+        QByteArray hash(crypto_generichash_BYTES, Qt::Uninitialized);
+
+        crypto_generichash_final(&hash_state_, reinterpret_cast<quint8*>(hash.data()),
+                                 hash.size());
+
+        std::scoped_lock<std::mutex> lock(lock_);
+        hash_ = hash;
+        condition_.notify_all();
+    }
+
+    // The mapped blocks are released when the file is closed.
+    if (!mapped_)
+        file_.close();
+}
+
+FilePacketizer::FilePacketizer(std::unique_ptr<Reader> reader)
+    : reader_(std::move(reader))
+{
+    file_size_ = reader_->fileSize();
     left_size_ = file_size_;
+
+    reader_->start(QThread::LowPriority);
 }
 
+FilePacketizer::~FilePacketizer() = default;
+
 std::unique_ptr<FilePacketizer> FilePacketizer::create(const QString& file_path)
 {
-    QPointer<QFile> file = new QFile(file_path);
+    std::unique_ptr<Reader> reader = std::make_unique<Reader>();
 
-    if (!file->open(QFile::ReadOnly))
+    if (!reader->open(file_path))
         return nullptr;
 
-    return std::unique_ptr<FilePacketizer>(new FilePacketizer(file));
+    return std::unique_ptr<FilePacketizer>(new FilePacketizer(std::move(reader)));
 }
 
-std::unique_ptr<proto::file_transfer::Packet> FilePacketizer::readNextPacket()
+bool FilePacketizer::setSignature(const proto::file_transfer::FileSignature& signature)
 {
-    Q_ASSERT(!file_.isNull() && file_->isOpen());
+    if (!first_packet_)
+        return false;
 
+    block_index_ = FileBlockIndex::create(signature);
+    return block_index_ != nullptr;
+}
+
+bool FilePacketizer::resume(const proto::file_transfer::PartialFile& partial_file)
+{
+    const qint64 offset = static_cast<qint64>(partial_file.size());
+
+    if (!first_packet_ || !offset || offset > file_size_)
+        return true;
+
+    const QByteArray hash = reader_->blockHash(offset);
+    if (hash.isEmpty())
+        return false;
+
+    // The target contains another file. It is written again from the beginning.
+    if (hash.toStdString() != partial_file.last_block_hash())
+        return true;
+
+    if (!reader_->restart(offset))
+        return false;
+
+    offset_ = offset;
+    left_size_ = file_size_ - offset;
+    return true;
+}
+
+bool FilePacketizer::skip(qint64 offset)
+{
+    if (!first_packet_ || offset < 0 || offset > file_size_)
+        return false;
+
+    if (offset && !reader_->restart(offset))
+        return false;
+
+    // The target has received the data before |offset| from another source, so the hash of
+    // the file would not match.
+    first_packet_ = false;
+    file_hash_ = false;
+    offset_ = offset;
+    left_size_ = file_size_ - offset;
+    return true;
+}
+
+std::unique_ptr<proto::file_transfer::Packet> FilePacketizer::readNextPacket(
+    qint64 packet_size, proto::file_transfer::PacketCompression compression)
+{
     // Create a new file packet.
     std::unique_ptr<proto::file_transfer::Packet> packet =
         std::make_unique<proto::file_transfer::Packet>();
@@ -52,45 +561,276 @@ std::unique_ptr<proto::file_transfer::Packet> FilePacketizer::readNextPacket()
     // All file packets must have the flag.
     packet->set_flags(proto::file_transfer::Packet::FLAG_PACKET);
 
-    qint64 packet_buffer_size = kPacketPartSize;
-
-    if (left_size_ < kPacketPartSize)
-        packet_buffer_size = static_cast<size_t>(left_size_);
+    // When transferring a file is divided into parts and each part is transmitted separately.
+    // The size of the part is chosen by the receiver from the speed of the transfer.
+    qint64 packet_buffer_size = qBound(kMinPacketSize, packet_size, kMaxPacketSize);
 
-    char* packet_buffer = GetOutputBuffer(packet.get(), packet_buffer_size);
-
-    // Moving to a new position in file.
-    if (!file_->seek(file_size_ - left_size_))
+    if (block_index_)
     {
-        qDebug("Unable to seek file");
-        return nullptr;
+        if (!readDeltaData(packet.get(), packet_buffer_size))
+        {
+            qDebug("Unable to read file");
+            return nullptr;
+        }
     }
-
-    if (file_->read(packet_buffer, packet_buffer_size) != packet_buffer_size)
+    else if (zero_ranges_)
     {
-        qDebug("Unable to read file");
-        return nullptr;
+        if (!readSparseData(packet.get(), packet_buffer_size))
+        {
+            qDebug("Unable to read file");
+            return nullptr;
+        }
+    }
+    else
+    {
+        if (left_size_ < packet_buffer_size)
+            packet_buffer_size = left_size_;
+
+        char* packet_buffer = GetOutputBuffer(packet.get(), packet_buffer_size);
+
+        if (!reader_->read(packet_buffer, packet_buffer_size))
+        {
+            qDebug("Unable to read file");
+            return nullptr;
+        }
+
+        left_size_ -= packet_buffer_size;
     }
 
-    if (left_size_ == file_size_)
+    if (first_packet_)
     {
+        first_packet_ = false;
+
         packet->set_flags(packet->flags() | proto::file_transfer::Packet::FLAG_FIRST_PACKET);
 
         // Set file path and size in first packet.
         packet->set_file_size(file_size_);
+        packet->set_offset(offset_);
     }
 
-    left_size_ -= packet_buffer_size;
-
-    if (!left_size_)
+    if (!left_size_ && input_pos_ == input_.size())
     {
         file_size_ = 0;
-        file_->close();
-
         packet->set_flags(packet->flags() | proto::file_transfer::Packet::FLAG_LAST_PACKET);
+
+        if (file_hash_)
+        {
+            const QByteArray hash = reader_->fileHash();
+            if (hash.isEmpty())
+            {
+                qDebug("Unable to read file");
+                return nullptr;
+            }
+
+            packet->set_file_hash(hash.toStdString());
+        }
     }
 
+    if (compression != proto::file_transfer::PACKET_COMPRESSION_NONE && !packet->data().empty())
+        compressPacket(packet.get(), compression);
+
     return packet;
 }
 
+bool FilePacketizer::readDeltaData(proto::file_transfer::Packet* packet, qint64 data_size)
+{
+    const qint64 block_size = block_index_->blockSize();
+
+    std::string* data = packet->mutable_data();
+    data->reserve(data_size);
+
+    qint64 copied_size = 0;
+
+    // The checksum is calculated again only after a found block.
+    RollingChecksum checksum;
+    bool checksum_valid = false;
+
+    while (static_cast<qint64>(data->size()) < data_size && copied_size < kMaxCopiedSize)
+    {
+        // One byte after the block is needed to move the checksum.
+        if (!fillInput(block_size + 1))
+            return false;
+
+        const qint64 input_size = input_.size() - input_pos_;
+        const char* block = input_.data() + input_pos_;
+
+        // The end of the file which is shorter than a block is sent as is.
+        if (input_size < block_size)
+        {
+            const qint64 size = qMin(input_size, data_size - static_cast<qint64>(data->size()));
+
+            data->append(block, size);
+            input_pos_ += size;
+            break;
+        }
+
+        if (!checksum_valid)
+        {
+            checksum.reset(block, block_size);
+            checksum_valid = true;
+        }
+
+        const qint64 block_index = block_index_->find(checksum.value(), block);
+        if (block_index != -1)
+        {
+            const int count = packet->block_copies_size();
+            proto::file_transfer::BlockCopy* last_copy =
+                count ? packet->mutable_block_copies(count - 1) : nullptr;
+
+            // The blocks which follow each other in both files are copied together.
+            if (last_copy && last_copy->data_offset() == data->size() &&
+                static_cast<qint64>(last_copy->block_index() + last_copy->block_count()) ==
+                    block_index)
+            {
+                last_copy->set_block_count(last_copy->block_count() + 1);
+            }
+            else
+            {
+                proto::file_transfer::BlockCopy* copy = packet->add_block_copies();
+
+                copy->set_data_offset(static_cast<quint32>(data->size()));
+                copy->set_block_index(block_index);
+                copy->set_block_count(1);
+            }
+
+            copied_size += block_size;
+            input_pos_ += block_size;
+            checksum_valid = false;
+            continue;
+        }
+
+        data->push_back(block[0]);
+
+        if (input_size > block_size)
+            checksum.roll(block[0], block[block_size]);
+        else
+            checksum_valid = false;
+
+        ++input_pos_;
+    }
+
+    packet->set_copied_size(copied_size);
+    return true;
+}
+
+bool FilePacketizer::readSparseData(proto::file_transfer::Packet* packet, qint64 data_size)
+{
+    std::string* data = packet->mutable_data();
+    data->reserve(data_size);
+
+    qint64 zero_size = 0;
+
+    while (static_cast<qint64>(data->size()) < data_size && left_size_ > 0 &&
+           zero_size < kMaxZeroSize)
+    {
+        // The data does not exceed |data_size| even if the block has no zeros.
+        const qint64 read_size = qMin(qMin(left_size_, kSparseReadSize),
+                                      data_size - static_cast<qint64>(data->size()));
+
+        sparse_input_.resize(read_size);
+
+        if (!reader_->read(&sparse_input_[0], read_size))
+            return false;
+
+        left_size_ -= read_size;
+
+        for (qint64 offset = 0; offset < read_size; offset += kZeroBlockSize)
+        {
+            const char* block = sparse_input_.data() + offset;
+            const qint64 block_size = qMin(kZeroBlockSize, read_size - offset);
+
+            // The partial blocks at the end of the file are sent as is.
+            if (block_size < kZeroBlockSize || !isZeroBlock(block))
+            {
+                data->append(block, block_size);
+                continue;
+            }
+
+            const int count = packet->zero_ranges_size();
+            proto::file_transfer::ZeroRange* last_range =
+                count ? packet->mutable_zero_ranges(count - 1) : nullptr;
+
+            // The blocks of zeros which follow each other are one range.
+            if (last_range && last_range->data_offset() == data->size())
+            {
+                last_range->set_size(last_range->size() + block_size);
+            }
+            else
+            {
+                proto::file_transfer::ZeroRange* range = packet->add_zero_ranges();
+
+                range->set_data_offset(static_cast<quint32>(data->size()));
+                range->set_size(block_size);
+            }
+
+            zero_size += block_size;
+        }
+    }
+
+    packet->set_zero_size(zero_size);
+    return true;
+}
+
+bool FilePacketizer::fillInput(qint64 size)
+{
+    // The data before the current position is removed rarely, so the moving is cheap.
+    if (input_pos_ >= static_cast<size_t>(kReadBlockSize))
+    {
+        input_.erase(0, input_pos_);
+        input_pos_ = 0;
+    }
+
+    while (static_cast<qint64>(input_.size() - input_pos_) < size && left_size_ > 0)
+    {
+        const qint64 read_size = qMin(left_size_, kReadBlockSize);
+        const size_t input_size = input_.size();
+
+        input_.resize(input_size + read_size);
+
+        if (!reader_->read(&input_[input_size], read_size))
+            return false;
+
+        left_size_ -= read_size;
+    }
+
+    return true;
+}
+
+void FilePacketizer::compressPacket(proto::file_transfer::Packet* packet,
+                                    proto::file_transfer::PacketCompression compression)
+{
+    if (skipped_packets_)
+    {
+        --skipped_packets_;
+        return;
+    }
+
+    if (!compressor_ || compression_ != compression)
+    {
+        compressor_ = createCompressor(compression);
+        compression_ = compression;
+
+        if (!compressor_)
+            return;
+    }
+
+    const std::string& data = packet->data();
+    const size_t max_size = data.size() - data.size() / kMinCompressionGain;
+
+    std::string compressed;
+
+    if (!max_size || !compressData(compressor_.get(), data, max_size, &compressed))
+    {
+        skip_interval_ = qBound(1, skip_interval_ * 2, kMaxSkipInterval);
+        skipped_packets_ = skip_interval_;
+        return;
+    }
+
+    skip_interval_ = 0;
+
+    packet->set_data_size(static_cast<quint32>(data.size()));
+    packet->set_compression(compression);
+    packet->mutable_data()->swap(compressed);
+}
+
 } // namespace aspia
@@ -9,33 +9,94 @@
 #define _ASPIA_HOST__FILE_PACKETIZER_H
 
 #include <QFile>
-#include <QPointer>
 #include <memory>
 
+#include "codec/compressor.h"
+#include "host/file_delta.h"
 #include "protocol/file_transfer_session.pb.h"
 
 namespace aspia {
 
+//
+// The file is read sequentially by a separate thread ahead of the requests of the packets,
+// so the reading of the disk overlaps the sending of the previous packets. The large files of
+// the local disks are mapped into the memory instead of the reading. The thread also hashes
+// the data, and the last packet contains the hash of the file.
+//
 class FilePacketizer
 {
 public:
-    ~FilePacketizer() = default;
+    ~FilePacketizer();
 
     // Creates an instance of the class.
     // Parameter |file_path| contains the full path to the file.
     // If the specified file can not be opened for reading, then returns nullptr.
     static std::unique_ptr<FilePacketizer> create(const QString& file_path);
 
-    // Creates a packet for transferring.
-    std::unique_ptr<proto::file_transfer::Packet> readNextPacket();
+    // Continues the interrupted transfer of the file from the end of |partial_file| if the
+    // target has the same data. Must be called before the first packet. Returns false if the
+    // file could not be read.
+    bool resume(const proto::file_transfer::PartialFile& partial_file);
+
+    // The packets refer to the blocks of the existing file of the target which are found in
+    // the file. Must be called before the first packet. Returns false if the signature is not
+    // valid, then the file is sent completely.
+    bool setSignature(const proto::file_transfer::FileSignature& signature);
+
+    // The blocks of zeros are sent as the zero ranges instead of the data. Used if the target
+    // accepts them. It is ignored for the packets with the blocks of the signature.
+    void setZeroRanges(bool enable) { zero_ranges_ = enable; }
+
+    // Continues the reading from |offset| without the first packet. It is used when the
+    // packets before |offset| are sent by another packetizer of the same file. The last packet
+    // does not contain the hash of the file. Must be called before the first packet. Returns
+    // false if the file could not be read.
+    bool skip(qint64 offset);
+
+    // Creates a packet for transferring. |packet_size| is the size of the data of the packet.
+    // It is limited by kMinPacketSize and kMaxPacketSize. The last packet can be smaller.
+    // The data is compressed by |compression| if it shrinks.
+    std::unique_ptr<proto::file_transfer::Packet> readNextPacket(
+        qint64 packet_size, proto::file_transfer::PacketCompression compression);
+
+    static constexpr qint64 kMinPacketSize = 16 * 1024; // 16kB
+    static constexpr qint64 kMaxPacketSize = 4 * 1024 * 1024; // 4MB
 
 private:
-    FilePacketizer(QPointer<QFile>& file);
+    class Reader;
+
+    explicit FilePacketizer(std::unique_ptr<Reader> reader);
+
+    bool readDeltaData(proto::file_transfer::Packet* packet, qint64 data_size);
+    bool readSparseData(proto::file_transfer::Packet* packet, qint64 data_size);
+    bool fillInput(qint64 size);
+    void compressPacket(proto::file_transfer::Packet* packet,
+                        proto::file_transfer::PacketCompression compression);
+
+    std::unique_ptr<Reader> reader_;
+
+    // The data which is read from the file and not sent yet starts at |input_pos_|.
+    std::unique_ptr<FileBlockIndex> block_index_;
+    std::string input_;
+    size_t input_pos_ = 0;
+
+    bool zero_ranges_ = false;
+    std::string sparse_input_;
+
+    std::unique_ptr<Compressor> compressor_;
+    proto::file_transfer::PacketCompression compression_ =
+        proto::file_transfer::PACKET_COMPRESSION_NONE;
 
-    QPointer<QFile> file_;
+    // After a packet which does not shrink the compression is not tried for
+    // |skipped_packets_| packets. The interval grows while the data does not shrink.
+    int skip_interval_ = 0;
+    int skipped_packets_ = 0;
 
     qint64 file_size_ = 0;
     qint64 left_size_ = 0;
+    qint64 offset_ = 0;
+    bool first_packet_ = true;
+    bool file_hash_ = true;
 
     Q_DISABLE_COPY(FilePacketizer)
 };
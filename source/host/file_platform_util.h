@@ -8,6 +8,7 @@
 #ifndef _ASPIA_HOST__FILE_PLATFORM_UTIL_H
 #define _ASPIA_HOST__FILE_PLATFORM_UTIL_H
 
+#include <QFile>
 #include <QIcon>
 #include <QPair>
 #include <QString>
@@ -29,6 +30,14 @@ public:
     static QIcon driveIcon(proto::file_transfer::DriveList::Item::Type type);
     static proto::file_transfer::DriveList::Item::Type driveType(const QString& drive_path);
 
+    // Marks the open file as sparse, so the parts of the file which are skipped by the resizing
+    // do not take the disk space. Returns false if the file system does not support it.
+    static bool setSparseFile(QFile* file);
+
+    // Sets the modification time of the file or of the directory in milliseconds since the
+    // epoch.
+    static bool setModificationTime(const QString& path, qint64 modification_time);
+
 private:
     Q_DISABLE_COPY(FilePlatformUtil)
 };
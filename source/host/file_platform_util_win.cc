@@ -11,9 +11,13 @@
 #error This file is only for MS Windows
 #endif
 
+#include <QDir>
 #include <QtWin>
+#include <io.h>
 #include <shellapi.h>
+#include <winioctl.h>
 
+#include "base/win/scoped_object.h"
 #include "base/win/scoped_user_object.h"
 
 namespace aspia {
@@ -137,4 +141,44 @@ proto::file_transfer::DriveList::Item::Type FilePlatformUtil::driveType(const QS
     }
 }
 
+// static
+bool FilePlatformUtil::setSparseFile(QFile* file)
+{
+    HANDLE handle = reinterpret_cast<HANDLE>(_get_osfhandle(file->handle()));
+    if (handle == INVALID_HANDLE_VALUE)
+        return false;
+
+    DWORD bytes_returned;
+
+    return !!DeviceIoControl(handle, FSCTL_SET_SPARSE, nullptr, 0, nullptr, 0,
+                             &bytes_returned, nullptr);
+}
+
+// static
+bool FilePlatformUtil::setModificationTime(const QString& path, qint64 modification_time)
+{
+    // The directories are opened only with FILE_FLAG_BACKUP_SEMANTICS.
+    ScopedHandle file(CreateFileW(qUtf16Printable(QDir::toNativeSeparators(path)),
+                                  FILE_WRITE_ATTRIBUTES,
+                                  FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                  nullptr,
+                                  OPEN_EXISTING,
+                                  FILE_FLAG_BACKUP_SEMANTICS,
+                                  nullptr));
+    if (!file.isValid())
+        return false;
+
+    // FILETIME is the number of 100ns intervals since January 1, 1601.
+    constexpr qint64 kEpochDifference = 11644473600000; // Milliseconds.
+
+    ULARGE_INTEGER time;
+    time.QuadPart = static_cast<ULONGLONG>(modification_time + kEpochDifference) * 10000;
+
+    FILETIME file_time;
+    file_time.dwLowDateTime = time.LowPart;
+    file_time.dwHighDateTime = time.HighPart;
+
+    return !!SetFileTime(file, nullptr, nullptr, &file_time);
+}
+
 } // namespace aspia
@@ -7,6 +7,8 @@
 
 #include "host/file_request.h"
 
+#include "client/connect_data.h"
+
 namespace aspia {
 
 FileRequest::FileRequest(QObject* sender,
@@ -53,6 +55,49 @@ FileRequest* FileRequest::fileListRequest(QObject* sender,
     return new FileRequest(sender, std::move(request), reply_slot);
 }
 
+// static
+FileRequest* FileRequest::fileListRequest(QObject* sender,
+                                          const QString& path,
+                                          int max_items,
+                                          quint64 continuation_id,
+                                          bool recursive,
+                                          const char* reply_slot)
+{
+    proto::file_transfer::Request request;
+    request.mutable_file_list_request()->set_path(path.toStdString());
+    request.mutable_file_list_request()->set_max_items(max_items);
+    request.mutable_file_list_request()->set_continuation_id(continuation_id);
+    request.mutable_file_list_request()->set_recursive(recursive);
+    return new FileRequest(sender, std::move(request), reply_slot);
+}
+
+// static
+FileRequest* FileRequest::fileListRevalidationRequest(QObject* sender,
+                                                      const QString& path,
+                                                      int max_items,
+                                                      qint64 modification_time,
+                                                      const char* reply_slot)
+{
+    proto::file_transfer::Request request;
+    request.mutable_file_list_request()->set_path(path.toStdString());
+    request.mutable_file_list_request()->set_max_items(max_items);
+    request.mutable_file_list_request()->set_modification_time(modification_time);
+    return new FileRequest(sender, std::move(request), reply_slot);
+}
+
+// static
+FileRequest* FileRequest::fileListPrefetchRequest(QObject* sender,
+                                                  const QString& path,
+                                                  int max_items,
+                                                  const char* reply_slot)
+{
+    proto::file_transfer::Request request;
+    request.mutable_file_list_request()->set_path(path.toStdString());
+    request.mutable_file_list_request()->set_max_items(max_items);
+    request.mutable_file_list_request()->set_single_part(true);
+    return new FileRequest(sender, std::move(request), reply_slot);
+}
+
 // static
 FileRequest* FileRequest::createDirectoryRequest(QObject* sender,
                                                  const QString& path,
@@ -78,20 +123,36 @@ FileRequest* FileRequest::renameRequest(QObject* sender,
 // static
 FileRequest* FileRequest::removeRequest(QObject* sender,
                                         const QString& path,
+                                        bool recursive,
                                         const char* reply_slot)
 {
     proto::file_transfer::Request request;
     request.mutable_remove_request()->set_path(path.toStdString());
+    request.mutable_remove_request()->set_recursive(recursive);
+    return new FileRequest(sender, std::move(request), reply_slot);
+}
+
+// static
+FileRequest* FileRequest::downloadRequest(QObject* sender,
+                                          const QString& file_path,
+                                          const char* reply_slot)
+{
+    proto::file_transfer::Request request;
+    request.mutable_download_request()->set_path(file_path.toStdString());
     return new FileRequest(sender, std::move(request), reply_slot);
 }
 
 // static
 FileRequest* FileRequest::downloadRequest(QObject* sender,
                                           const QString& file_path,
+                                          qint64 packet_size,
+                                          proto::file_transfer::PacketCompression compression,
                                           const char* reply_slot)
 {
     proto::file_transfer::Request request;
     request.mutable_download_request()->set_path(file_path.toStdString());
+    request.mutable_download_request()->set_packet_size(static_cast<quint32>(packet_size));
+    request.mutable_download_request()->set_compression(compression);
     return new FileRequest(sender, std::move(request), reply_slot);
 }
 
@@ -99,19 +160,91 @@ FileRequest* FileRequest::downloadRequest(QObject* sender,
 FileRequest* FileRequest::uploadRequest(QObject* sender,
                                         const QString& file_path,
                                         bool overwrite,
+                                        bool resume,
+                                        bool delta,
                                         const char* reply_slot)
 {
     proto::file_transfer::Request request;
     request.mutable_upload_request()->set_path(file_path.toStdString());
     request.mutable_upload_request()->set_overwrite(overwrite);
+    request.mutable_upload_request()->set_resume(resume);
+    request.mutable_upload_request()->set_delta(delta);
     return new FileRequest(sender, std::move(request), reply_slot);
 }
 
 // static
-FileRequest* FileRequest::packetRequest(QObject* sender, const char* reply_slot)
+FileRequest* FileRequest::uploadRequest(QObject* sender,
+                                        const QString& file_path,
+                                        bool overwrite,
+                                        const proto::file_transfer::Packet& packet,
+                                        const char* reply_slot)
+{
+    proto::file_transfer::Request request;
+    request.mutable_upload_request()->set_path(file_path.toStdString());
+    request.mutable_upload_request()->set_overwrite(overwrite);
+    request.mutable_upload_request()->mutable_packet()->CopyFrom(packet);
+    return new FileRequest(sender, std::move(request), reply_slot);
+}
+
+// static
+FileRequest* FileRequest::archiveDownloadRequest(QObject* sender,
+                                                 const QString& path,
+                                                 const char* reply_slot)
+{
+    proto::file_transfer::Request request;
+    request.mutable_download_request()->set_path(path.toStdString());
+    request.mutable_download_request()->set_archive(true);
+    return new FileRequest(sender, std::move(request), reply_slot);
+}
+
+// static
+FileRequest* FileRequest::archiveUploadRequest(QObject* sender,
+                                               const QString& path,
+                                               bool overwrite,
+                                               const char* reply_slot)
+{
+    proto::file_transfer::Request request;
+    request.mutable_upload_request()->set_path(path.toStdString());
+    request.mutable_upload_request()->set_overwrite(overwrite);
+    request.mutable_upload_request()->set_archive(true);
+    return new FileRequest(sender, std::move(request), reply_slot);
+}
+
+// static
+FileRequest* FileRequest::packetRequest(QObject* sender,
+                                        qint64 packet_size,
+                                        proto::file_transfer::PacketCompression compression,
+                                        bool zero_ranges,
+                                        const char* reply_slot)
+{
+    proto::file_transfer::Request request;
+    request.mutable_packet_request()->set_dummy(1);
+    request.mutable_packet_request()->set_packet_size(static_cast<quint32>(packet_size));
+    request.mutable_packet_request()->set_compression(compression);
+    request.mutable_packet_request()->set_zero_ranges(zero_ranges);
+    return new FileRequest(sender, std::move(request), reply_slot);
+}
+
+// static
+FileRequest* FileRequest::packetRequest(QObject* sender,
+                                        qint64 packet_size,
+                                        proto::file_transfer::PacketCompression compression,
+                                        bool zero_ranges,
+                                        const proto::file_transfer::PartialFile& partial_file,
+                                        const proto::file_transfer::FileSignature& signature,
+                                        const char* reply_slot)
 {
     proto::file_transfer::Request request;
     request.mutable_packet_request()->set_dummy(1);
+    request.mutable_packet_request()->set_packet_size(static_cast<quint32>(packet_size));
+    request.mutable_packet_request()->set_compression(compression);
+    request.mutable_packet_request()->set_zero_ranges(zero_ranges);
+
+    if (partial_file.size())
+        request.mutable_packet_request()->mutable_partial_file()->CopyFrom(partial_file);
+
+    if (signature.block_size())
+        request.mutable_packet_request()->mutable_signature()->CopyFrom(signature);
     return new FileRequest(sender, std::move(request), reply_slot);
 }
 
@@ -125,4 +258,26 @@ FileRequest* FileRequest::packet(QObject* sender,
     return new FileRequest(sender, std::move(request), reply_slot);
 }
 
+// static
+FileRequest* FileRequest::remoteCopyRequest(QObject* sender,
+                                            const QString& file_path,
+                                            const ConnectData& target,
+                                            const QString& target_path,
+                                            bool overwrite,
+                                            const char* reply_slot)
+{
+    proto::file_transfer::Request request;
+
+    proto::file_transfer::RemoteCopyRequest* copy_request = request.mutable_remote_copy_request();
+    copy_request->set_path(file_path.toStdString());
+    copy_request->set_target_address(target.address().toStdString());
+    copy_request->set_target_port(target.port());
+    copy_request->set_target_user_name(target.userName().toStdString());
+    copy_request->set_target_password(target.password().toStdString());
+    copy_request->set_target_path(target_path.toStdString());
+    copy_request->set_overwrite(overwrite);
+
+    return new FileRequest(sender, std::move(request), reply_slot);
+}
+
 } // namespace aspia
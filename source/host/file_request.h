@@ -15,6 +15,12 @@
 
 namespace aspia {
 
+// The replies are passed to the senders of the requests by the queued calls.
+Q_DECLARE_METATYPE(proto::file_transfer::Request);
+Q_DECLARE_METATYPE(proto::file_transfer::Reply);
+
+class ConnectData;
+
 class FileRequest : public QObject
 {
     Q_OBJECT
@@ -29,6 +35,30 @@ public:
                                         const QString& path,
                                         const char* reply_slot);
 
+    // The reply contains no more than |max_items| items. If |continuation_id| is not 0, then
+    // the list of the previous reply is continued. If |recursive| is true, then the list
+    // contains the items of the subdirectories.
+    static FileRequest* fileListRequest(QObject* sender,
+                                        const QString& path,
+                                        int max_items,
+                                        quint64 continuation_id,
+                                        bool recursive,
+                                        const char* reply_slot);
+
+    // The first part of the list of |path| which the sender has with |modification_time|.
+    // If the directory is not modified, then the reply contains no items.
+    static FileRequest* fileListRevalidationRequest(QObject* sender,
+                                                    const QString& path,
+                                                    int max_items,
+                                                    qint64 modification_time,
+                                                    const char* reply_slot);
+
+    // The list of |path| which is not continued after |max_items| items.
+    static FileRequest* fileListPrefetchRequest(QObject* sender,
+                                                const QString& path,
+                                                int max_items,
+                                                const char* reply_slot);
+
     static FileRequest* createDirectoryRequest(QObject* sender,
                                                const QString& path,
                                                const char* reply_slot);
@@ -38,25 +68,81 @@ public:
                                       const QString& new_name,
                                       const char* reply_slot);
 
+    // If |recursive| is true, then the directory is removed with all its items.
     static FileRequest* removeRequest(QObject* sender,
                                       const QString& path,
+                                      bool recursive,
                                       const char* reply_slot);
 
     static FileRequest* downloadRequest(QObject* sender,
                                         const QString& file_path,
                                         const char* reply_slot);
 
+    // The reply contains the first packet of the file of |packet_size|.
+    static FileRequest* downloadRequest(QObject* sender,
+                                        const QString& file_path,
+                                        qint64 packet_size,
+                                        proto::file_transfer::PacketCompression compression,
+                                        const char* reply_slot);
+
+    // If |resume| is true, then the reply contains the part of the file which is already
+    // written. If |delta| is true, then the reply contains the signature of the overwritten
+    // file.
     static FileRequest* uploadRequest(QObject* sender,
                                       const QString& file_path,
                                       bool overwrite,
+                                      bool resume,
+                                      bool delta,
                                       const char* reply_slot);
 
-    static FileRequest* packetRequest(QObject* sender, const char* reply_slot);
+    // The file is created and |packet| is written to it.
+    static FileRequest* uploadRequest(QObject* sender,
+                                      const QString& file_path,
+                                      bool overwrite,
+                                      const proto::file_transfer::Packet& packet,
+                                      const char* reply_slot);
+
+    // The directory |path| is sent as the archive by the next packets.
+    static FileRequest* archiveDownloadRequest(QObject* sender,
+                                               const QString& path,
+                                               const char* reply_slot);
+
+    // The archive is extracted to the directory |path|. If |overwrite| is false, then the
+    // existing files are not replaced.
+    static FileRequest* archiveUploadRequest(QObject* sender,
+                                             const QString& path,
+                                             bool overwrite,
+                                             const char* reply_slot);
+
+    // If |zero_ranges| is true, then the blocks of zeros are sent as the zero ranges.
+    static FileRequest* packetRequest(QObject* sender,
+                                      qint64 packet_size,
+                                      proto::file_transfer::PacketCompression compression,
+                                      bool zero_ranges,
+                                      const char* reply_slot);
+
+    // The first packet request of the resumed or the overwritten file. The empty messages are
+    // not sent.
+    static FileRequest* packetRequest(QObject* sender,
+                                      qint64 packet_size,
+                                      proto::file_transfer::PacketCompression compression,
+                                      bool zero_ranges,
+                                      const proto::file_transfer::PartialFile& partial_file,
+                                      const proto::file_transfer::FileSignature& signature,
+                                      const char* reply_slot);
 
     static FileRequest* packet(QObject* sender,
                                const proto::file_transfer::Packet& packet,
                                const char* reply_slot);
 
+    // The host copies |file_path| to |target_path| of the host of |target| by itself.
+    static FileRequest* remoteCopyRequest(QObject* sender,
+                                          const QString& file_path,
+                                          const ConnectData& target,
+                                          const QString& target_path,
+                                          bool overwrite,
+                                          const char* reply_slot);
+
 private slots:
     void senderDestroyed();
 
@@ -16,6 +16,16 @@
 
 namespace aspia {
 
+namespace {
+
+// The maximum number of the lists which are received by parts at the same time.
+constexpr size_t kMaxFileLists = 8;
+
+// The size of the parts of the recursive lists.
+constexpr int kMaxFileListPart = 10000;
+
+} // namespace
+
 FileWorker::FileWorker(QObject* parent)
     : QObject(parent)
 {
@@ -54,7 +64,7 @@ proto::file_transfer::Reply FileWorker::doRequest(const proto::file_transfer::Re
     }
     else if (request.has_packet_request())
     {
-        return doPacketRequest();
+        return doPacketRequest(request.packet_request());
     }
     else if (request.has_packet())
     {
@@ -119,6 +129,40 @@ proto::file_transfer::Reply FileWorker::doFileListRequest(
 {
     proto::file_transfer::Reply reply;
 
+    const QDir::Filters filters = QDir::Files | QDir::AllDirs | QDir::NoDotAndDotDot |
+                                  QDir::System | QDir::Hidden;
+
+    // The first part contains the modification time of the directory, so the receiver can
+    // keep the list and check later whether it is still valid.
+    qint64 modification_time = 0;
+
+    if (!request.continuation_id())
+    {
+        const QFileInfo directory_info(QString::fromStdString(request.path()));
+
+        if (directory_info.isDir())
+            modification_time = directory_info.lastModified().toMSecsSinceEpoch();
+
+        // The receiver shows the list which it already has.
+        if (modification_time && request.modification_time() == modification_time)
+        {
+            reply.mutable_file_list()->set_modification_time(modification_time);
+            reply.mutable_file_list()->set_not_modified(true);
+            reply.set_status(proto::file_transfer::STATUS_SUCCESS);
+            return reply;
+        }
+    }
+
+    if (request.max_items() || request.recursive())
+    {
+        reply = doFileListPart(request, filters);
+
+        if (reply.status() == proto::file_transfer::STATUS_SUCCESS)
+            reply.mutable_file_list()->set_modification_time(modification_time);
+
+        return reply;
+    }
+
     QDir directory(QString::fromStdString(request.path()));
     if (!directory.exists())
     {
@@ -126,8 +170,7 @@ proto::file_transfer::Reply FileWorker::doFileListRequest(
         return reply;
     }
 
-    directory.setFilter(QDir::Files | QDir::AllDirs | QDir::NoDotAndDotDot |
-                        QDir::System | QDir::Hidden);
+    directory.setFilter(filters);
     directory.setSorting(QDir::Name | QDir::DirsFirst);
 
     QFileInfoList info_list = directory.entryInfoList();
@@ -142,6 +185,88 @@ proto::file_transfer::Reply FileWorker::doFileListRequest(
         item->set_is_directory(info.isDir());
     }
 
+    reply.mutable_file_list()->set_modification_time(modification_time);
+    reply.set_status(proto::file_transfer::STATUS_SUCCESS);
+    return reply;
+}
+
+proto::file_transfer::Reply FileWorker::doFileListPart(
+    const proto::file_transfer::FileListRequest& request, QDir::Filters filters)
+{
+    proto::file_transfer::Reply reply;
+
+    quint64 list_id = request.continuation_id();
+
+    if (!list_id)
+    {
+        const QString path = QString::fromStdString(request.path());
+
+        if (!QDir(path).exists())
+        {
+            reply.set_status(proto::file_transfer::STATUS_PATH_NOT_FOUND);
+            return reply;
+        }
+
+        // The directory is read as the items are requested, so the huge directories are not
+        // read and sorted completely before the first part.
+        FileList list;
+        list.root.setPath(path);
+        list.recursive = request.recursive();
+        list.iterator = std::make_unique<QDirIterator>(
+            path, filters,
+            list.recursive ? QDirIterator::Subdirectories : QDirIterator::NoIteratorFlags);
+
+        list_id = ++last_file_list_id_;
+        file_lists_.emplace(list_id, std::move(list));
+
+        if (file_lists_.size() > kMaxFileLists)
+            file_lists_.erase(file_lists_.begin());
+    }
+
+    auto it = file_lists_.find(list_id);
+    if (it == file_lists_.end())
+    {
+        reply.set_status(proto::file_transfer::STATUS_INVALID_REQUEST);
+        return reply;
+    }
+
+    FileList& list = it->second;
+    proto::file_transfer::FileList* file_list = reply.mutable_file_list();
+
+    const int max_items = request.max_items() ? request.max_items() : kMaxFileListPart;
+
+    while (file_list->item_size() < max_items && list.iterator->hasNext())
+    {
+        list.iterator->next();
+
+        const QFileInfo info = list.iterator->fileInfo();
+        proto::file_transfer::FileList::Item* item = file_list->add_item();
+
+        if (list.recursive)
+            item->set_name(list.root.relativeFilePath(info.filePath()).toStdString());
+        else
+            item->set_name(info.fileName().toStdString());
+
+        item->set_size(info.size());
+        item->set_modification_time(info.lastModified().toSecsSinceEpoch());
+        item->set_is_directory(info.isDir());
+    }
+
+    if (!list.iterator->hasNext())
+    {
+        file_lists_.erase(it);
+    }
+    else if (request.single_part())
+    {
+        // The rest of the list is not requested.
+        file_list->set_truncated(true);
+        file_lists_.erase(it);
+    }
+    else
+    {
+        file_list->set_continuation_id(list_id);
+    }
+
     reply.set_status(proto::file_transfer::STATUS_SUCCESS);
     return reply;
 }
@@ -234,7 +359,15 @@ proto::file_transfer::Reply FileWorker::doRemoveRequest(
         return reply;
     }
 
-    if (file_info.isDir())
+    if (file_info.isDir() && request.recursive())
+    {
+        if (!removeDirectory(path))
+        {
+            reply.set_status(proto::file_transfer::STATUS_ACCESS_DENIED);
+            return reply;
+        }
+    }
+    else if (file_info.isDir())
     {
         if (!QDir().rmdir(path))
         {
@@ -257,30 +390,108 @@ proto::file_transfer::Reply FileWorker::doRemoveRequest(
     return reply;
 }
 
+// static
+bool FileWorker::removeDirectory(const QString& path)
+{
+    bool success = true;
+
+    // The directories are removed after their items, so in the reverse order.
+    QStringList directories;
+    directories.append(path);
+
+    QDirIterator it(path, QDir::Files | QDir::AllDirs | QDir::NoDotAndDotDot |
+                    QDir::System | QDir::Hidden, QDirIterator::Subdirectories);
+
+    while (it.hasNext())
+    {
+        const QString item_path = it.next();
+
+        if (it.fileInfo().isDir())
+        {
+            // The links to the directories are removed without their items.
+            if (it.fileInfo().isSymLink())
+            {
+                if (!QDir().rmdir(item_path))
+                    success = false;
+            }
+            else
+            {
+                directories.append(item_path);
+            }
+
+            continue;
+        }
+
+        QFile file(item_path);
+        file.setPermissions(QFile::ReadOther | QFile::WriteOther);
+
+        if (!file.remove())
+            success = false;
+    }
+
+    for (int i = directories.size() - 1; i >= 0; --i)
+    {
+        if (!QDir().rmdir(directories[i]))
+            success = false;
+    }
+
+    return success;
+}
+
 proto::file_transfer::Reply FileWorker::doDownloadRequest(
     const proto::file_transfer::DownloadRequest& request)
 {
+    if (request.archive())
+        return doArchiveDownloadRequest(request);
+
     proto::file_transfer::Reply reply;
 
+    archive_packetizer_.reset();
+
     packetizer_ = FilePacketizer::create(QString::fromStdString(request.path()));
     if (!packetizer_)
+    {
         reply.set_status(proto::file_transfer::STATUS_FILE_OPEN_ERROR);
-    else
-        reply.set_status(proto::file_transfer::STATUS_SUCCESS);
+        return reply;
+    }
+
+    if (request.packet_size())
+    {
+        // The first packet is sent with the reply. A small file is transferred completely.
+        std::unique_ptr<proto::file_transfer::Packet> packet =
+            packetizer_->readNextPacket(request.packet_size(), request.compression());
+        if (!packet)
+        {
+            packetizer_.reset();
+            reply.set_status(proto::file_transfer::STATUS_FILE_READ_ERROR);
+            return reply;
+        }
+
+        if (packet->flags() & proto::file_transfer::Packet::FLAG_LAST_PACKET)
+            packetizer_.reset();
+
+        reply.set_allocated_packet(packet.release());
+    }
 
+    reply.set_status(proto::file_transfer::STATUS_SUCCESS);
     return reply;
 }
 
 proto::file_transfer::Reply FileWorker::doUploadRequest(
     const proto::file_transfer::UploadRequest& request)
 {
+    if (request.archive())
+        return doArchiveUploadRequest(request);
+
     proto::file_transfer::Reply reply;
 
+    archive_depacketizer_.reset();
+
     QString file_path = QString::fromStdString(request.path());
 
     do
     {
-        if (!request.overwrite())
+        if (!request.overwrite() && !request.resume())
         {
             if (QFile(file_path).exists())
             {
@@ -289,24 +500,118 @@ proto::file_transfer::Reply FileWorker::doUploadRequest(
             }
         }
 
-        depacketizer_ = FileDepacketizer::create(file_path, request.overwrite());
+        FileDepacketizer::Mode mode = FileDepacketizer::Mode::CREATE;
+
+        if (request.resume())
+            mode = FileDepacketizer::Mode::RESUME;
+        else if (request.overwrite() && request.delta())
+            mode = FileDepacketizer::Mode::DELTA;
+        else if (request.overwrite())
+            mode = FileDepacketizer::Mode::OVERWRITE;
+
+        depacketizer_ = FileDepacketizer::create(file_path, mode);
         if (!depacketizer_)
         {
             reply.set_status(proto::file_transfer::STATUS_FILE_CREATE_ERROR);
             break;
         }
 
+        // Without the signature the file is sent completely.
+        if (mode == FileDepacketizer::Mode::DELTA)
+        {
+            if (!depacketizer_->fileSignature(reply.mutable_signature()))
+                reply.clear_signature();
+        }
+
+        if (request.resume())
+        {
+            if (!depacketizer_->partialFile(reply.mutable_partial_file()))
+            {
+                depacketizer_.reset();
+                reply.set_status(proto::file_transfer::STATUS_FILE_OPEN_ERROR);
+                break;
+            }
+        }
+
+        if (request.has_packet())
+        {
+            reply = doPacket(request.packet());
+            break;
+        }
+
         reply.set_status(proto::file_transfer::STATUS_SUCCESS);
     }
     while (false);
 
+    // The next packets of the file can contain the zero ranges.
+    if (depacketizer_)
+        reply.set_zero_ranges(true);
+
     return reply;
 }
 
-proto::file_transfer::Reply FileWorker::doPacketRequest()
+proto::file_transfer::Reply FileWorker::doArchiveDownloadRequest(
+    const proto::file_transfer::DownloadRequest& request)
 {
     proto::file_transfer::Reply reply;
 
+    packetizer_.reset();
+
+    archive_packetizer_ = FileArchivePacketizer::create(QString::fromStdString(request.path()));
+    if (!archive_packetizer_)
+    {
+        reply.set_status(proto::file_transfer::STATUS_FILE_OPEN_ERROR);
+        return reply;
+    }
+
+    reply.set_status(proto::file_transfer::STATUS_SUCCESS);
+    return reply;
+}
+
+proto::file_transfer::Reply FileWorker::doArchiveUploadRequest(
+    const proto::file_transfer::UploadRequest& request)
+{
+    proto::file_transfer::Reply reply;
+
+    depacketizer_.reset();
+
+    archive_depacketizer_ = FileArchiveDepacketizer::create(
+        QString::fromStdString(request.path()), request.overwrite());
+    if (!archive_depacketizer_)
+    {
+        reply.set_status(proto::file_transfer::STATUS_FILE_CREATE_ERROR);
+        return reply;
+    }
+
+    reply.set_status(proto::file_transfer::STATUS_SUCCESS);
+    return reply;
+}
+
+proto::file_transfer::Reply FileWorker::doPacketRequest(
+    const proto::file_transfer::PacketRequest& request)
+{
+    proto::file_transfer::Reply reply;
+
+    if (archive_packetizer_)
+    {
+        // The archive is always sent completely.
+        std::unique_ptr<proto::file_transfer::Packet> packet =
+            archive_packetizer_->readNextPacket(request.packet_size(), request.compression());
+        if (!packet)
+        {
+            archive_packetizer_.reset();
+            reply.set_status(proto::file_transfer::STATUS_FILE_READ_ERROR);
+            return reply;
+        }
+
+        if (packet->flags() & proto::file_transfer::Packet::FLAG_LAST_PACKET)
+            archive_packetizer_.reset();
+
+        reply.set_status(proto::file_transfer::STATUS_SUCCESS);
+        reply.set_allocated_packet(packet.release());
+        return reply;
+    }
+
     if (!packetizer_)
     {
         // Set the unknown status of the request. The connection will be closed.
@@ -315,8 +620,25 @@ proto::file_transfer::Reply FileWorker::doPacketRequest()
     }
     else
     {
-        std::unique_ptr<proto::file_transfer::Packet> packet =
-            packetizer_->readNextPacket();
+        std::unique_ptr<proto::file_transfer::Packet> packet;
+
+        bool success = true;
+
+        if (request.has_partial_file())
+        {
+            success = packetizer_->resume(request.partial_file());
+        }
+        else if (request.has_signature())
+        {
+            // With an invalid signature the file is sent completely.
+            packetizer_->setSignature(request.signature());
+        }
+
+        packetizer_->setZeroRanges(request.zero_ranges());
+
+        if (success)
+            packet = packetizer_->readNextPacket(request.packet_size(), request.compression());
+
         if (!packet)
         {
             reply.set_status(proto::file_transfer::STATUS_FILE_READ_ERROR);
@@ -338,6 +660,19 @@ proto::file_transfer::Reply FileWorker::doPacket(const proto::file_transfer::Pac
 {
     proto::file_transfer::Reply reply;
 
+    if (archive_depacketizer_)
+    {
+        if (!archive_depacketizer_->writeNextPacket(packet, &reply))
+            reply.set_status(proto::file_transfer::STATUS_FILE_WRITE_ERROR);
+        else
+            reply.set_status(proto::file_transfer::STATUS_SUCCESS);
+
+        if (packet.flags() & proto::file_transfer::Packet::FLAG_LAST_PACKET)
+            archive_depacketizer_.reset();
+
+        return reply;
+    }
+
     if (!depacketizer_)
     {
         // Set the unknown status of the request. The connection will be closed.
@@ -8,6 +8,12 @@
 #ifndef _ASPIA_HOST__FILE_WORKER_H
 #define _ASPIA_HOST__FILE_WORKER_H
 
+#include <QDirIterator>
+
+#include <map>
+
+#include "host/file_archive_depacketizer.h"
+#include "host/file_archive_packetizer.h"
 #include "host/file_depacketizer.h"
 #include "host/file_packetizer.h"
 #include "host/file_request.h"
@@ -32,6 +38,8 @@ private:
     proto::file_transfer::Reply doDriveListRequest();
     proto::file_transfer::Reply doFileListRequest(
         const proto::file_transfer::FileListRequest& request);
+    proto::file_transfer::Reply doFileListPart(
+        const proto::file_transfer::FileListRequest& request, QDir::Filters filters);
     proto::file_transfer::Reply doCreateDirectoryRequest(
         const proto::file_transfer::CreateDirectoryRequest& request);
     proto::file_transfer::Reply doRenameRequest(
@@ -42,12 +50,37 @@ private:
         const proto::file_transfer::DownloadRequest& request);
     proto::file_transfer::Reply doUploadRequest(
         const proto::file_transfer::UploadRequest& request);
-    proto::file_transfer::Reply doPacketRequest();
+    proto::file_transfer::Reply doArchiveDownloadRequest(
+        const proto::file_transfer::DownloadRequest& request);
+    proto::file_transfer::Reply doArchiveUploadRequest(
+        const proto::file_transfer::UploadRequest& request);
+    proto::file_transfer::Reply doPacketRequest(
+        const proto::file_transfer::PacketRequest& request);
     proto::file_transfer::Reply doPacket(const proto::file_transfer::Packet& packet);
 
+    // Removes the directory and all its items. Returns false if any item is not removed.
+    static bool removeDirectory(const QString& path);
+
     std::unique_ptr<FileDepacketizer> depacketizer_;
     std::unique_ptr<FilePacketizer> packetizer_;
 
+    // The directory which is transferred as one file instead of |packetizer_| or
+    // |depacketizer_|.
+    std::unique_ptr<FileArchiveDepacketizer> archive_depacketizer_;
+    std::unique_ptr<FileArchivePacketizer> archive_packetizer_;
+
+    // The directories which are listed by parts. The oldest lists are dropped if there are too
+    // many of them.
+    struct FileList
+    {
+        QDir root;
+        bool recursive = false;
+        std::unique_ptr<QDirIterator> iterator;
+    };
+
+    std::map<quint64, FileList> file_lists_;
+    quint64 last_file_list_id_ = 0;
+
     Q_DISABLE_COPY(FileWorker)
 };
 
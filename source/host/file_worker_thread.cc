@@ -0,0 +1,94 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/file_worker_thread.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "host/file_worker_thread.h"
+
+#include "base/message_serialization.h"
+#include "host/file_worker.h"
+
+namespace aspia {
+
+FileWorkerThread::FileWorkerThread(QObject* parent)
+    : QThread(parent)
+{
+    // Nothing
+}
+
+FileWorkerThread::~FileWorkerThread()
+{
+    {
+        std::scoped_lock<std::mutex> lock(lock_);
+        terminate_ = true;
+        condition_.notify_all();
+    }
+
+    wait();
+}
+
+void FileWorkerThread::addRequest(quint64 request_id,
+                                  const proto::file_transfer::Request& request)
+{
+    std::scoped_lock<std::mutex> lock(lock_);
+
+    tasks_.push_back(Task{ request_id, request });
+    condition_.notify_all();
+}
+
+std::vector<quint64> FileWorkerThread::cancelFileLists()
+{
+    std::vector<quint64> canceled;
+
+    std::scoped_lock<std::mutex> lock(lock_);
+
+    for (auto it = tasks_.begin(); it != tasks_.end();)
+    {
+        if (it->request.has_file_list_request() && !it->request.file_list_request().recursive())
+        {
+            canceled.push_back(it->request_id);
+            it = tasks_.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    return canceled;
+}
+
+void FileWorkerThread::run()
+{
+    // The worker is used only by this thread.
+    FileWorker worker;
+
+    std::unique_lock<std::mutex> lock(lock_);
+
+    for (;;)
+    {
+        while (!terminate_ && tasks_.empty())
+            condition_.wait(lock);
+
+        if (terminate_)
+            return;
+
+        Task task = std::move(tasks_.front());
+        tasks_.pop_front();
+
+        lock.unlock();
+
+        proto::file_transfer::Reply reply = worker.doRequest(task.request);
+
+        // The identifier of the sender of the request.
+        reply.set_request_id(task.request.request_id());
+
+        emit replyReady(task.request_id, serializeMessage(reply));
+
+        lock.lock();
+    }
+}
+
+} // namespace aspia
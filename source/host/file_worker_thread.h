@@ -0,0 +1,67 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/file_worker_thread.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_HOST__FILE_WORKER_THREAD_H
+#define _ASPIA_HOST__FILE_WORKER_THREAD_H
+
+#include <QThread>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#include "protocol/file_transfer_session.pb.h"
+
+namespace aspia {
+
+//
+// Executes the requests of one lane of the file transfer session by its own FileWorker in
+// the order of the requests. The lists of the directories and the transfers of the files are
+// executed by separate lanes, so a slow directory does not stall the packets of a transfer.
+//
+class FileWorkerThread : public QThread
+{
+    Q_OBJECT
+
+public:
+    explicit FileWorkerThread(QObject* parent = nullptr);
+    ~FileWorkerThread();
+
+    // Queues |request|. The reply is sent by replyReady with the same |request_id|. The
+    // serialized reply has the identifier of |request|.
+    void addRequest(quint64 request_id, const proto::file_transfer::Request& request);
+
+    // Removes the queued requests of the lists of the directories which are not recursive and
+    // returns their identifiers. The request which is executed now is not interrupted.
+    std::vector<quint64> cancelFileLists();
+
+signals:
+    void replyReady(quint64 request_id, const QByteArray& reply);
+
+protected:
+    // QThread implementation.
+    void run() override;
+
+private:
+    struct Task
+    {
+        quint64 request_id;
+        proto::file_transfer::Request request;
+    };
+
+    std::mutex lock_;
+    std::condition_variable condition_;
+    bool terminate_ = false;
+    std::deque<Task> tasks_;
+
+    Q_DISABLE_COPY(FileWorkerThread)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_HOST__FILE_WORKER_THREAD_H
@@ -0,0 +1,141 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/host_metrics.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "host/host_metrics.h"
+
+#include <QDebug>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+
+#include "host/win/host.h"
+
+namespace aspia {
+
+namespace {
+
+// Returns the rate per second of the change of the counter.
+double rate(qint64 value, qint64 prev_value, qint64 interval_ms)
+{
+    return static_cast<double>(value - prev_value) * 1000.0 / static_cast<double>(interval_ms);
+}
+
+} // namespace
+
+HostMetrics::HostMetrics(const QString& file_path)
+    : file_path_(file_path)
+{
+    interval_timer_.start();
+}
+
+bool HostMetrics::write(const QList<QPointer<Host>>& session_list, int pending_connections)
+{
+    const qint64 interval = qMax(interval_timer_.restart(), qint64(1));
+    const QDateTime now = QDateTime::currentDateTime();
+
+    QHash<QString, Sample> samples;
+    QJsonArray sessions;
+
+    qint64 total_bytes_read = 0;
+    qint64 total_bytes_written = 0;
+
+    for (const auto& session : session_list)
+    {
+        if (session.isNull())
+            continue;
+
+        Sample sample;
+        sample.counters = session->networkCounters();
+        sample.relayed_messages = session->relayedMessages();
+
+        // The new sessions are counted from zero.
+        const Sample prev_sample = prev_samples_.value(session->uuid(), Sample());
+
+        const NetworkChannel::Counters& counters = sample.counters;
+        const NetworkChannel::Counters& prev_counters = prev_sample.counters;
+
+        QJsonObject object;
+
+        object.insert(QStringLiteral("uuid"), session->uuid());
+        object.insert(QStringLiteral("session_type"), QString::fromStdString(
+            proto::auth::SessionType_Name(session->sessionType())));
+        object.insert(QStringLiteral("user_name"), session->userName());
+        object.insert(QStringLiteral("remote_address"), session->remoteAddress());
+        object.insert(QStringLiteral("uptime"), session->startTime().secsTo(now));
+
+        object.insert(QStringLiteral("bytes_read"), counters.bytes_read);
+        object.insert(QStringLiteral("bytes_written"), counters.bytes_written);
+        object.insert(QStringLiteral("bytes_read_per_second"),
+                      rate(counters.bytes_read, prev_counters.bytes_read, interval));
+        object.insert(QStringLiteral("bytes_written_per_second"),
+                      rate(counters.bytes_written, prev_counters.bytes_written, interval));
+        object.insert(QStringLiteral("messages_read_per_second"),
+                      rate(counters.messages_read, prev_counters.messages_read, interval));
+        object.insert(QStringLiteral("messages_written_per_second"),
+                      rate(counters.messages_written, prev_counters.messages_written, interval));
+
+        // The messages of the session process are the video packets in the desktop sessions.
+        object.insert(QStringLiteral("relayed_messages_per_second"),
+                      rate(sample.relayed_messages, prev_sample.relayed_messages, interval));
+
+        // Share of the time of one CPU spent for the encryption in percents.
+        object.insert(QStringLiteral("crypto_load"),
+                      rate(counters.crypto_time, prev_counters.crypto_time, interval) / 10000.0);
+        object.insert(QStringLiteral("queued_messages"), counters.queued_messages);
+        object.insert(QStringLiteral("queued_bytes"), counters.queued_bytes);
+
+        // The memory of the session process in bytes. The write queue of the network channel
+        // is in the memory of the service.
+        const proto::host::MemoryUsage& memory_usage = session->memoryUsage();
+
+        QJsonObject memory;
+        memory.insert(QStringLiteral("process"), memory_usage.process());
+        memory.insert(QStringLiteral("frames"), memory_usage.frames());
+        memory.insert(QStringLiteral("differ"), memory_usage.differ());
+        memory.insert(QStringLiteral("encoder"), memory_usage.encoder());
+        memory.insert(QStringLiteral("queues"), memory_usage.queues());
+        memory.insert(QStringLiteral("caches"), memory_usage.caches());
+        memory.insert(QStringLiteral("degradation"), memory_usage.degradation());
+
+        object.insert(QStringLiteral("memory"), memory);
+
+        sessions.append(object);
+
+        total_bytes_read += counters.bytes_read - prev_counters.bytes_read;
+        total_bytes_written += counters.bytes_written - prev_counters.bytes_written;
+
+        samples.insert(session->uuid(), sample);
+    }
+
+    prev_samples_ = std::move(samples);
+
+    QJsonObject root;
+
+    root.insert(QStringLiteral("time"), now.toString(Qt::ISODate));
+    root.insert(QStringLiteral("interval"), static_cast<double>(interval) / 1000.0);
+    root.insert(QStringLiteral("active_sessions"), sessions.size());
+    root.insert(QStringLiteral("pending_connections"), pending_connections);
+    root.insert(QStringLiteral("bytes_read_per_second"), rate(total_bytes_read, 0, interval));
+    root.insert(QStringLiteral("bytes_written_per_second"),
+                rate(total_bytes_written, 0, interval));
+    root.insert(QStringLiteral("sessions"), sessions);
+
+    QSaveFile file(file_path_);
+
+    if (!file.open(QSaveFile::WriteOnly))
+    {
+        qWarning() << "Unable to write the metrics file" << file_path_ << ":"
+                   << file.errorString();
+        return false;
+    }
+
+    file.write(QJsonDocument(root).toJson());
+    return file.commit();
+}
+
+} // namespace aspia
@@ -0,0 +1,52 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/host_metrics.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_HOST__HOST_METRICS_H
+#define _ASPIA_HOST__HOST_METRICS_H
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QPointer>
+
+#include "network/network_channel.h"
+
+namespace aspia {
+
+class Host;
+
+//
+// Writes the counters of the running sessions into a JSON file. The file is replaced as a
+// whole, so the monitoring tools always read the complete counters. The rates are calculated
+// for the interval since the previous write.
+//
+class HostMetrics
+{
+public:
+    explicit HostMetrics(const QString& file_path);
+    ~HostMetrics() = default;
+
+    bool write(const QList<QPointer<Host>>& session_list, int pending_connections);
+
+private:
+    struct Sample
+    {
+        NetworkChannel::Counters counters;
+        qint64 relayed_messages = 0;
+    };
+
+    const QString file_path_;
+
+    // The counters of the previous write by the uuids of the sessions.
+    QHash<QString, Sample> prev_samples_;
+    QElapsedTimer interval_timer_;
+
+    Q_DISABLE_COPY(HostMetrics)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_HOST__HOST_METRICS_H
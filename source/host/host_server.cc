@@ -9,14 +9,23 @@
 
 #include <QCoreApplication>
 #include <QDebug>
+#include <QRunnable>
 #include <QUuid>
 
 #include "base/message_serialization.h"
+#include "base/win/scoped_com_initializer.h"
 #include "host/win/host.h"
+#include "host/host_metrics.h"
+#include "host/win/host_process_group.h"
+#include "host/win/host_process_pool.h"
+#include "host/win/host_settings_watcher.h"
+#include "host/host_settings.h"
 #include "host/host_user_authorizer.h"
 #include "ipc/ipc_server.h"
 #include "network/firewall_manager.h"
 #include "network/network_channel.h"
+#include "network/relay_protocol.h"
+#include "network/token_bucket.h"
 #include "protocol/notifier.pb.h"
 
 namespace aspia {
@@ -24,8 +33,60 @@ namespace aspia {
 namespace {
 
 const char kFirewallRuleName[] = "Aspia Host Service";
+const char kFirewallUdpRuleName[] = "Aspia Host Service (UDP)";
 const char kNotifierFileName[] = "aspia_host_notifier.exe";
 
+constexpr std::chrono::seconds kMetricsInterval(10);
+
+// Adds the rule of the firewall while the server is started. The policy of the firewall may be
+// slow to access, so the server does not wait for it.
+class FirewallTask : public QRunnable
+{
+public:
+    // The rule of the datagrams is added if |udp_description| is not empty.
+    FirewallTask(const QString& description, int port, const QString& udp_description)
+        : description_(description),
+          port_(port),
+          udp_description_(udp_description)
+    {
+        // Nothing
+    }
+
+    // QRunnable implementation.
+    void run() override
+    {
+        ScopedCOMInitializer com_initializer(ScopedCOMInitializer::kMTA);
+        if (!com_initializer.isSucceeded())
+            return;
+
+        FirewallManager firewall(QCoreApplication::applicationFilePath());
+        if (!firewall.isValid())
+            return;
+
+        // The rule is left by the previous start if the service has not been stopped normally.
+        if (firewall.hasTcpRule(kFirewallRuleName, port_))
+            qInfo("Rule is already added to the firewall");
+        else if (firewall.addTcpRule(kFirewallRuleName, description_, port_))
+            qInfo("Rule is added to the firewall");
+
+        // The ports of the datagrams are selected for each connection.
+        if (udp_description_.isEmpty())
+            return;
+
+        if (firewall.hasUdpRule(kFirewallUdpRuleName))
+            qInfo("Rule of the datagrams is already added to the firewall");
+        else if (firewall.addUdpRule(kFirewallUdpRuleName, udp_description_))
+            qInfo("Rule of the datagrams is added to the firewall");
+    }
+
+private:
+    const QString description_;
+    const int port_;
+    const QString udp_description_;
+
+    Q_DISABLE_COPY(FirewallTask)
+};
+
 const char* sessionTypeToString(proto::auth::SessionType session_type)
 {
     switch (session_type)
@@ -76,6 +137,61 @@ HostServer::HostServer(QObject* parent)
 HostServer::~HostServer()
 {
     stop();
+
+    // The channels of the sessions are deleted in the I/O threads, so the sessions are deleted
+    // before the threads are stopped.
+    for (auto session : session_list_)
+        delete session;
+}
+
+void HostServer::setProcessPoolEnabled(bool enable)
+{
+    process_pool_enabled_ = enable;
+}
+
+void HostServer::setSharedProcessEnabled(bool enable)
+{
+    shared_process_enabled_ = enable;
+}
+
+void HostServer::setIocpEnabled(bool enable)
+{
+    iocp_enabled_ = enable;
+}
+
+void HostServer::setDatagramsEnabled(bool enable)
+{
+    datagrams_enabled_ = enable;
+}
+
+void HostServer::setConnectionLimits(int max_pending_connections, int max_sessions)
+{
+    max_pending_connections_ = max_pending_connections;
+    max_sessions_ = max_sessions;
+}
+
+void HostServer::setBandwidthLimits(int session_limit, int host_limit)
+{
+    session_bandwidth_limit_ = session_limit;
+
+    if (host_limit > 0)
+        host_bandwidth_limit_ = std::make_shared<TokenBucket>(TokenBucket::kbpsToRate(host_limit));
+    else
+        host_bandwidth_limit_.reset();
+}
+
+void HostServer::setMetricsFile(const QString& file_path)
+{
+    metrics_file_ = file_path;
+}
+
+void HostServer::setRelays(const QStringList& relays,
+                           const QString& host_id,
+                           const QString& secret)
+{
+    relays_ = relays;
+    relay_host_id_ = host_id;
+    relay_secret_ = secret;
 }
 
 bool HostServer::start(int port, const QList<User>& user_list)
@@ -88,24 +204,22 @@ bool HostServer::start(int port, const QList<User>& user_list)
         return false;
     }
 
-    user_list_ = user_list;
-    if (user_list_.isEmpty())
+    user_index_ = HostUserAuthorizer::createUserIndex(user_list);
+    if (user_index_.isEmpty())
     {
         qWarning("Empty user list");
     }
 
-    FirewallManager firewall(QCoreApplication::applicationFilePath());
-    if (firewall.isValid())
-    {
-        if (firewall.addTcpRule(kFirewallRuleName,
-                                tr("Allow incoming TCP connections"),
-                                port))
-        {
-            qInfo("Rule is added to the firewall");
-        }
-    }
+    unknown_user_key_ = HostSettings().unknownUserKey();
+
+    firewall_pool_.start(new FirewallTask(
+        tr("Allow incoming TCP connections"), port,
+        datagrams_enabled_ ? tr("Allow incoming UDP datagrams of the video") : QString()));
 
     network_server_ = new NetworkServer(this);
+    network_server_->setMaxPendingChannels(max_pending_connections_);
+    network_server_->setIocpEnabled(iocp_enabled_);
+    network_server_->setDatagramsEnabled(datagrams_enabled_);
 
     connect(network_server_, &NetworkServer::newChannelReady,
             this, &HostServer::onNewConnection);
@@ -113,6 +227,50 @@ bool HostServer::start(int port, const QList<User>& user_list)
     if (!network_server_->start(port))
         return false;
 
+    if (!relay_host_id_.isEmpty())
+    {
+        const QByteArray relay_host_key = HostSettings().relayHostKey();
+
+        for (const QString& relay : relays_)
+        {
+            QString address;
+            int relay_port;
+
+            if (!RelayProtocol::parseAddress(relay, &address, &relay_port))
+            {
+                qWarning() << "Invalid address of the relay:" << relay;
+                continue;
+            }
+
+            network_server_->addRelay(address, relay_port, relay_host_id_, relay_secret_,
+                                      relay_host_key);
+        }
+    }
+
+    settings_watcher_ = new HostSettingsWatcher(this);
+
+    connect(settings_watcher_, &HostSettingsWatcher::settingsChanged,
+            this, &HostServer::onSettingsChanged);
+
+    // The users are read only at the start if the settings can not be watched.
+    if (!settings_watcher_->start())
+        delete settings_watcher_;
+
+    if (process_pool_enabled_)
+    {
+        process_pool_ = new HostProcessPool(this);
+        process_pool_->start(WTSGetActiveConsoleSessionId());
+    }
+
+    if (shared_process_enabled_)
+        process_group_ = new HostProcessGroup(this);
+
+    if (!metrics_file_.isEmpty())
+    {
+        metrics_ = std::make_unique<HostMetrics>(metrics_file_);
+        metrics_timer_id_ = startTimer(kMetricsInterval);
+    }
+
     qInfo() << "Server is started on port" << port;
     return true;
 }
@@ -125,6 +283,17 @@ void HostServer::stop()
         session->stop();
 
     stopNotifier();
+    delete process_pool_;
+    delete process_group_;
+    delete settings_watcher_;
+
+    if (metrics_timer_id_)
+    {
+        killTimer(metrics_timer_id_);
+        metrics_timer_id_ = 0;
+    }
+
+    metrics_.reset();
 
     if (!network_server_.isNull())
     {
@@ -132,11 +301,18 @@ void HostServer::stop()
         delete network_server_;
     }
 
-    user_list_.clear();
+    user_index_.clear();
+
+    // The rule is not deleted before it is added.
+    firewall_pool_.clear();
+    firewall_pool_.waitForDone();
 
     FirewallManager firewall(QCoreApplication::applicationFilePath());
     if (firewall.isValid())
+    {
         firewall.deleteRuleByName(kFirewallRuleName);
+        firewall.deleteRuleByName(kFirewallUdpRuleName);
+    }
 
     qInfo("Server is stopped");
 }
@@ -149,6 +325,9 @@ void HostServer::setSessionChanged(quint32 event, quint32 session_id)
     {
         case WTS_CONSOLE_CONNECT:
         {
+            if (!process_pool_.isNull())
+                process_pool_->start(session_id);
+
             if (!session_list_.isEmpty())
                 startNotifier();
         }
@@ -163,11 +342,18 @@ void HostServer::setSessionChanged(quint32 event, quint32 session_id)
             }
 
             stopNotifier();
+
+            if (!process_pool_.isNull())
+                process_pool_->stop();
         }
         break;
 
         case WTS_SESSION_LOGON:
         {
+            // The file transfer process is started for the logged on user.
+            if (!process_pool_.isNull() && session_id == WTSGetActiveConsoleSessionId())
+                process_pool_->start(session_id);
+
             if (session_id == WTSGetActiveConsoleSessionId() && !session_list_.isEmpty())
                 startNotifier();
         }
@@ -192,6 +378,15 @@ void HostServer::timerEvent(QTimerEvent* event)
         return;
     }
 
+    if (metrics_timer_id_ != 0 && event->timerId() == metrics_timer_id_)
+    {
+        const int pending_connections =
+            network_server_.isNull() ? 0 : network_server_->pendingChannelCount();
+
+        metrics_->write(session_list_, pending_connections);
+        return;
+    }
+
     QObject::timerEvent(event);
 }
 
@@ -207,8 +402,24 @@ void HostServer::onNewConnection()
 
         HostUserAuthorizer* authorizer = new HostUserAuthorizer(this);
 
+        QList<HostUserAuthorizer::ResumableSession> resumable_sessions;
+
+        for (const auto& session : session_list_)
+        {
+            if (!session->resumeTicket().isEmpty())
+            {
+                resumable_sessions.push_back(
+                    { session->resumeTicket(), session->userName(), session->sessionType() });
+            }
+        }
+
         authorizer->setNetworkChannel(channel);
-        authorizer->setUserList(user_list_);
+        authorizer->setUserIndex(user_index_);
+        authorizer->setUnknownUserKey(unknown_user_key_);
+        authorizer->setThreadPool(&authorization_pool_);
+        authorizer->setResumableSessions(resumable_sessions);
+        authorizer->setNewSessionsAllowed(
+            max_sessions_ <= 0 || session_list_.size() < max_sessions_);
 
         connect(authorizer, &HostUserAuthorizer::finished,
                 this, &HostServer::onAuthorizationFinished);
@@ -228,12 +439,37 @@ void HostServer::onAuthorizationFinished(HostUserAuthorizer* authorizer)
     if (authorizer->status() != proto::auth::STATUS_SUCCESS)
         return;
 
+    if (!authorizer->resumedTicket().isEmpty())
+    {
+        resumeSession(authorizer);
+        return;
+    }
+
+    // The sessions may be started by the connections which were authorized at the same time.
+    // The resumed sessions replace their connections, so they are not limited.
+    if (max_sessions_ > 0 && session_list_.size() >= max_sessions_)
+    {
+        qWarning() << "Too many sessions:" << session_list_.size()
+                   << ". The new session is rejected";
+
+        NetworkChannel* channel = authorizer->networkChannel();
+
+        connect(channel, &NetworkChannel::disconnected, channel, &NetworkChannel::deleteLater);
+        channel->stop();
+        return;
+    }
+
     QScopedPointer<Host> host(new Host(this));
 
     host->setNetworkChannel(authorizer->networkChannel());
+    limitBandwidth(authorizer->networkChannel());
+    io_threads_.moveChannel(authorizer->networkChannel());
     host->setSessionType(authorizer->sessionType());
     host->setUserName(authorizer->userName());
     host->setUuid(QUuid::createUuid().toString());
+    host->setResumeTicket(authorizer->resumeTicket());
+    host->setProcessPool(process_pool_);
+    host->setProcessGroup(process_group_);
 
     connect(this, &HostServer::sessionChanged, host.data(), &Host::sessionChanged);
     connect(host.data(), &Host::finished, this, &HostServer::onHostFinished, Qt::QueuedConnection);
@@ -249,9 +485,50 @@ void HostServer::onAuthorizationFinished(HostUserAuthorizer* authorizer)
             sessionToNotifier(*host);
 
         session_list_.push_back(host.take());
+        qInfo() << "Running sessions:" << session_list_.size();
     }
 }
 
+void HostServer::resumeSession(HostUserAuthorizer* authorizer)
+{
+    NetworkChannel* channel = authorizer->networkChannel();
+
+    for (const auto& session : session_list_)
+    {
+        if (session->resumeTicket() != authorizer->resumedTicket())
+            continue;
+
+        qInfo() << "Resuming" << sessionTypeToString(session->sessionType())
+                << "session for" << session->userName();
+
+        if (session->resume(channel, authorizer->resumeTicket()))
+        {
+            limitBandwidth(channel);
+            io_threads_.moveChannel(channel);
+            return;
+        }
+
+        break;
+    }
+
+    // The session may have finished during the authorization of the client.
+    qWarning("The session can not be resumed");
+
+    connect(channel, &NetworkChannel::disconnected, channel, &NetworkChannel::deleteLater);
+    channel->stop();
+}
+
+void HostServer::limitBandwidth(NetworkChannel* channel)
+{
+    if (session_bandwidth_limit_ > 0)
+    {
+        channel->addBandwidthLimit(
+            std::make_shared<TokenBucket>(TokenBucket::kbpsToRate(session_bandwidth_limit_)));
+    }
+
+    channel->addBandwidthLimit(host_bandwidth_limit_);
+}
+
 void HostServer::onHostFinished(Host* host)
 {
     qInfo() << sessionTypeToString(host->sessionType())
@@ -329,6 +606,15 @@ void HostServer::onNotifierProcessError(HostProcess::ErrorCode error_code)
     }
 }
 
+void HostServer::onSettingsChanged()
+{
+    HostSettings settings;
+
+    // The running sessions are not affected.
+    user_index_ = HostUserAuthorizer::createUserIndex(settings.userList());
+    qInfo() << "The user list is changed. Users:" << user_index_.size();
+}
+
 void HostServer::restartNotifier()
 {
     if (notifier_state_ == NotifierState::Stopped)
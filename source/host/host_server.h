@@ -8,15 +8,26 @@
 #ifndef _ASPIA_HOST__HOST_SERVER_H
 #define _ASPIA_HOST__HOST_SERVER_H
 
+#include <QStringList>
+#include <QThreadPool>
+
+#include <memory>
+
 #include "host/win/host_process.h"
+#include "host/host_user_authorizer.h"
 #include "host/user.h"
 #include "ipc/ipc_channel.h"
+#include "network/network_io_threads.h"
 #include "network/network_server.h"
 
 namespace aspia {
 
 class Host;
-class HostUserAuthorizer;
+class HostMetrics;
+class HostProcessGroup;
+class HostProcessPool;
+class HostSettingsWatcher;
+class TokenBucket;
 
 class HostServer : public QObject
 {
@@ -26,6 +37,23 @@ public:
     HostServer(QObject* parent = nullptr);
     ~HostServer();
 
+    // Must be called before the start. The processes of the pool run in the console session.
+    void setProcessPoolEnabled(bool enable);
+    void setSharedProcessEnabled(bool enable);
+    void setIocpEnabled(bool enable);
+    void setDatagramsEnabled(bool enable);
+    void setConnectionLimits(int max_pending_connections, int max_sessions);
+
+    // Must be called before the start. The limits are in kbit/s, zero if disabled.
+    void setBandwidthLimits(int session_limit, int host_limit);
+
+    // If |file_path| is not empty, then the counters of the sessions are written into the file
+    // while the server is started.
+    void setMetricsFile(const QString& file_path);
+
+    // Must be called before the start. The server is registered on the relays as |host_id|.
+    void setRelays(const QStringList& relays, const QString& host_id, const QString& secret);
+
     bool start(int port, const QList<User>& user_list);
     void stop();
     void setSessionChanged(quint32 event, quint32 session_id);
@@ -45,6 +73,7 @@ private slots:
     void onIpcNewConnection(IpcChannel* channel);
     void onIpcMessageReceived(const QByteArray& buffer);
     void onNotifierProcessError(HostProcess::ErrorCode error_code);
+    void onSettingsChanged();
     void restartNotifier();
 
 private:
@@ -55,6 +84,12 @@ private:
         Started
     };
 
+    // Passes the connection of |authorizer| to the running session which the client resumes.
+    void resumeSession(HostUserAuthorizer* authorizer);
+
+    // Adds the limits of the host and of the session to the channel of the session.
+    void limitBandwidth(NetworkChannel* channel);
+
     void startNotifier();
     void stopNotifier();
     void sessionToNotifier(const Host& host);
@@ -72,14 +107,51 @@ private:
     // The channel is used to communicate with the notifier process.
     QPointer<IpcChannel> ipc_channel_;
 
-    // Contains a list of users for authorization.
-    QList<User> user_list_;
+    int max_pending_connections_ = NetworkServer::kDefaultMaxPendingChannels;
+    bool iocp_enabled_ = false;
+    bool datagrams_enabled_ = false;
+    int max_sessions_ = 0;
+
+    // The bucket of the host is shared by the channels of all sessions.
+    int session_bandwidth_limit_ = 0;
+    std::shared_ptr<TokenBucket> host_bandwidth_limit_;
+
+    // Keeps the started session processes if enabled.
+    bool process_pool_enabled_ = false;
+    QPointer<HostProcessPool> process_pool_;
+
+    // Runs the sessions in the shared processes if enabled.
+    bool shared_process_enabled_ = false;
+    QPointer<HostProcessGroup> process_group_;
+
+    // Contains the users for authorization. The index is built again when the settings are
+    // changed, so the new connections use the new list without the restart of the service.
+    HostUserAuthorizer::UserIndex user_index_;
+    QByteArray unknown_user_key_;
+    QPointer<HostSettingsWatcher> settings_watcher_;
+
+    // Verifies the session keys of the connections which are being authorized.
+    QThreadPool authorization_pool_;
+
+    // Adds the rule of the firewall.
+    QThreadPool firewall_pool_;
+
+    // Serve the network channels of the running sessions.
+    NetworkIoThreads io_threads_;
 
     // Contains a list of connected sessions.
     QList<QPointer<Host>> session_list_;
 
     int restart_timer_id_ = 0;
 
+    QStringList relays_;
+    QString relay_host_id_;
+    QString relay_secret_;
+
+    QString metrics_file_;
+    std::unique_ptr<HostMetrics> metrics_;
+    int metrics_timer_id_ = 0;
+
     Q_DISABLE_COPY(HostServer)
 };
 
@@ -7,15 +7,24 @@
 
 #include "host/host_session.h"
 
-#include <QCoreApplication>
+#include <QTimerEvent>
 
+#include "base/memory_counters.h"
+#include "base/message_serialization.h"
 #include "host/host_session_desktop.h"
 #include "host/host_session_file_transfer.h"
 #include "host/host_session_system_info.h"
 #include "ipc/ipc_channel.h"
+#include "protocol/host_session.pb.h"
 
 namespace aspia {
 
+namespace {
+
+constexpr int kStatisticsInterval = 5000; // 5 seconds
+
+} // namespace
+
 HostSession::HostSession(const QString& channel_id)
     : channel_id_(channel_id)
 {
@@ -64,6 +73,16 @@ void HostSession::start()
     connect(ipc_channel_, &IpcChannel::messageWritten, this, &HostSession::messageWritten);
     connect(ipc_channel_, &IpcChannel::messageReceived, this, &HostSession::messageReceived);
 
+    connect(ipc_channel_, &IpcChannel::writeQueueFull, this, [this]()
+    {
+        setWriteBlocked(true);
+    });
+
+    connect(ipc_channel_, &IpcChannel::writeQueueDrained, this, [this]()
+    {
+        setWriteBlocked(false);
+    });
+
     connect(this, &HostSession::readMessage, ipc_channel_, &IpcChannel::readMessage);
     connect(this, &HostSession::writeMessage, ipc_channel_, &IpcChannel::writeMessage);
     connect(this, &HostSession::errorOccurred, this, &HostSession::stop);
@@ -71,15 +90,45 @@ void HostSession::start()
     ipc_channel_->connectToServer(channel_id_);
 }
 
+void HostSession::timerEvent(QTimerEvent* event)
+{
+    if (event->timerId() == statistics_timer_id_)
+    {
+        sendStatistics();
+        return;
+    }
+
+    QObject::timerEvent(event);
+}
+
 void HostSession::ipcChannelConnected()
 {
     startSession();
+
+    sendStatistics();
+    statistics_timer_id_ = startTimer(kStatisticsInterval);
+}
+
+void HostSession::sendStatistics()
+{
+    proto::host::SessionStatistics statistics;
+    proto::host::MemoryUsage* memory_usage = statistics.mutable_memory_usage();
+
+    memory_usage->set_process(MemoryCounters::processMemory());
+    memory_usage->set_frames(MemoryCounters::value(MemoryCounters::FrameMemory));
+    memory_usage->set_differ(MemoryCounters::value(MemoryCounters::DifferMemory));
+    memory_usage->set_encoder(MemoryCounters::value(MemoryCounters::EncoderMemory));
+    memory_usage->set_queues(MemoryCounters::value(MemoryCounters::QueueMemory));
+    memory_usage->set_caches(MemoryCounters::value(MemoryCounters::CacheMemory));
+    memory_usage->set_degradation(memoryDegradation());
+
+    emit writeMessage(-1, serializeMessage(statistics), LowPriority, StatisticsMessage);
 }
 
 void HostSession::stop()
 {
     stopSession();
-    QCoreApplication::quit();
+    emit finished();
 }
 
 } // namespace aspia
@@ -11,6 +11,9 @@
 #include <QByteArray>
 #include <QPointer>
 
+#include "base/message_class.h"
+#include "base/message_priority.h"
+
 namespace aspia {
 
 class IpcChannel;
@@ -31,23 +34,43 @@ public slots:
     virtual void messageWritten(int message_id) = 0;
 
 signals:
-    void writeMessage(int message_id, const QByteArray& buffer);
+    void writeMessage(int message_id,
+                      const QByteArray& buffer,
+                      MessagePriority priority = NormalPriority,
+                      MessageClass message_class = GenericMessage);
     void readMessage();
     void errorOccurred();
 
+    // The session is stopped. The process ends if it has no other sessions.
+    void finished();
+
 protected:
     explicit HostSession(const QString& channel_id);
 
     virtual void startSession() = 0;
     virtual void stopSession() = 0;
 
+    // The level of the degradation of the session by the memory budget.
+    virtual int memoryDegradation() const { return 0; }
+
+    // The write queue of the channel to the host has exceeded its high watermark or has been
+    // drained. The session should not produce more messages while it is blocked.
+    virtual void setWriteBlocked(bool /* blocked */) {}
+
+    // QObject implementation.
+    void timerEvent(QTimerEvent* event) override;
+
 private slots:
     void ipcChannelConnected();
     void stop();
 
 private:
+    // Sends the memory usage of the process to the host. The host keeps it for the metrics.
+    void sendStatistics();
+
     QString channel_id_;
     QPointer<IpcChannel> ipc_channel_;
+    int statistics_timer_id_ = 0;
 
     Q_DISABLE_COPY(HostSession)
 };
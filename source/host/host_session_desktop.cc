@@ -9,8 +9,12 @@
 
 #include "base/clipboard.h"
 #include "base/message_serialization.h"
+#include "codec/video_encoder_h264.h"
+#include "codec/video_util.h"
+#include "host/desktop_effects.h"
+#include "host/host_settings.h"
 #include "host/input_injector.h"
-#include "host/screen_updater.h"
+#include "host/session_recorder.h"
 
 namespace aspia {
 
@@ -19,13 +23,49 @@ namespace {
 const quint32 kSupportedVideoEncodings =
     proto::desktop::VIDEO_ENCODING_ZLIB |
     proto::desktop::VIDEO_ENCODING_VP8 |
-    proto::desktop::VIDEO_ENCODING_VP9;
+    proto::desktop::VIDEO_ENCODING_VP9 |
+    proto::desktop::VIDEO_ENCODING_VP9_LOSSY |
+    proto::desktop::VIDEO_ENCODING_AV1 |
+    proto::desktop::VIDEO_ENCODING_LZ4 |
+    proto::desktop::VIDEO_ENCODING_ZSTD |
+    proto::desktop::VIDEO_ENCODING_HYBRID |
+    proto::desktop::VIDEO_ENCODING_PALETTE;
 
 const quint32 kSupportedFeaturesDesktopManage =
     proto::desktop::FEATURE_CURSOR_SHAPE |
-    proto::desktop::FEATURE_CLIPBOARD;
-
-const quint32 kSupportedFeaturesDesktopView = 0;
+    proto::desktop::FEATURE_CLIPBOARD |
+    proto::desktop::FEATURE_COPY_RECT |
+    proto::desktop::FEATURE_VIDEO_ACK |
+    proto::desktop::FEATURE_ZLIB_CHUNKS |
+    proto::desktop::FEATURE_ZLIB_STREAM |
+    proto::desktop::FEATURE_SCREEN_LIST |
+    proto::desktop::FEATURE_CURSOR_POSITION |
+    proto::desktop::FEATURE_CURSOR_CACHE |
+    proto::desktop::FEATURE_INPUT_EVENTS |
+    proto::desktop::FEATURE_CLIPBOARD_CHUNKS |
+    proto::desktop::FEATURE_CLIPBOARD_COMPRESSION |
+    proto::desktop::FEATURE_SCALING |
+    proto::desktop::FEATURE_VISIBILITY |
+    proto::desktop::FEATURE_PACKED_RECTS |
+    proto::desktop::FEATURE_RESYNC |
+    proto::desktop::FEATURE_LATENCY_PROBE |
+    proto::desktop::FEATURE_REDUCED_EFFECTS |
+    proto::desktop::FEATURE_VISIBLE_AREA;
+
+const quint32 kSupportedFeaturesDesktopView =
+    proto::desktop::FEATURE_CURSOR_SHAPE |
+    proto::desktop::FEATURE_COPY_RECT |
+    proto::desktop::FEATURE_VIDEO_ACK |
+    proto::desktop::FEATURE_ZLIB_CHUNKS |
+    proto::desktop::FEATURE_ZLIB_STREAM |
+    proto::desktop::FEATURE_SCREEN_LIST |
+    proto::desktop::FEATURE_CURSOR_POSITION |
+    proto::desktop::FEATURE_CURSOR_CACHE |
+    proto::desktop::FEATURE_SCALING |
+    proto::desktop::FEATURE_VISIBILITY |
+    proto::desktop::FEATURE_PACKED_RECTS |
+    proto::desktop::FEATURE_RESYNC |
+    proto::desktop::FEATURE_VISIBLE_AREA;
 
 enum MessageId { ScreenUpdateMessage };
 
@@ -48,26 +88,70 @@ HostSessionDesktop::HostSessionDesktop(proto::auth::SessionType session_type,
     }
 }
 
-void HostSessionDesktop::startSession()
+HostSessionDesktop::~HostSessionDesktop()
 {
-    proto::desktop::HostToClient message;
+    releaseScreenUpdater();
+}
 
-    message.mutable_config_request()->set_video_encodings(kSupportedVideoEncodings);
+// static
+proto::desktop::ConfigRequest HostSessionDesktop::configRequest(
+    proto::auth::SessionType session_type)
+{
+    proto::desktop::ConfigRequest config_request;
+
+    config_request.set_video_encodings(kSupportedVideoEncodings);
 
-    if (session_type_ == proto::auth::SESSION_TYPE_DESKTOP_MANAGE)
-        message.mutable_config_request()->set_features(kSupportedFeaturesDesktopManage);
+    if (session_type == proto::auth::SESSION_TYPE_DESKTOP_MANAGE)
+        config_request.set_features(kSupportedFeaturesDesktopManage);
     else
-        message.mutable_config_request()->set_features(kSupportedFeaturesDesktopView);
+        config_request.set_features(kSupportedFeaturesDesktopView);
+
+    return config_request;
+}
+
+void HostSessionDesktop::startSession()
+{
+    // The capturers are measured while the config of the client is being received.
+    ScreenUpdater::prepare();
+
+    proto::desktop::HostToClient message;
+    message.mutable_config_request()->CopyFrom(configRequest(session_type_));
+
+    // H.264 is offered only if the hardware encoder is present. Older clients do not know
+    // this encoding and keep using VP8, VP9 or ZLIB.
+    if (VideoEncoderH264::isAvailable())
+    {
+        message.mutable_config_request()->set_video_encodings(
+            message.config_request().video_encodings() | proto::desktop::VIDEO_ENCODING_H264);
+    }
 
     emit writeMessage(-1, serializeMessage(message));
     emit readMessage();
+
+    const QString record_directory = HostSettings().sessionRecordDirectory();
+    if (!record_directory.isEmpty())
+        recorder_ = SessionRecorder::create(record_directory);
 }
 
 void HostSessionDesktop::stopSession()
 {
-    delete screen_updater_;
+    releaseScreenUpdater();
     delete clipboard_;
     input_injector_.reset();
+    recorder_.reset();
+}
+
+int HostSessionDesktop::memoryDegradation() const
+{
+    return screen_updater_ ? screen_updater_->memoryDegradation() : 0;
+}
+
+void HostSessionDesktop::setWriteBlocked(bool blocked)
+{
+    write_blocked_ = blocked;
+
+    if (screen_updater_)
+        screen_updater_->setSubscriberBlocked(this, blocked);
 }
 
 void HostSessionDesktop::customEvent(QEvent* event)
@@ -79,13 +163,28 @@ void HostSessionDesktop::customEvent(QEvent* event)
             ScreenUpdater::UpdateEvent* update_event =
                 reinterpret_cast<ScreenUpdater::UpdateEvent*>(event);
 
-            Q_ASSERT(update_event->video_packet || update_event->cursor_shape);
+            ScreenUpdater::Update update;
+
+            while (update_event->takeUpdate(&update))
+                writeUpdate(update);
+        }
+        break;
+
+        case ScreenUpdater::ScreenListEvent::kType:
+        {
+            ScreenUpdater::ScreenListEvent* screen_list_event =
+                reinterpret_cast<ScreenUpdater::ScreenListEvent*>(event);
 
-            proto::desktop::HostToClient message;
-            message.set_allocated_video_packet(update_event->video_packet.release());
-            message.set_allocated_cursor_shape(update_event->cursor_shape.release());
+            current_screen_id_ = screen_list_event->screen_list.current_screen();
+            screen_origin_ = screen_list_event->screen_origin;
 
-            emit writeMessage(ScreenUpdateMessage, serializeMessage(message));
+            if (features_ & proto::desktop::FEATURE_SCREEN_LIST)
+            {
+                proto::desktop::HostToClient message;
+                message.mutable_screen_list()->Swap(&screen_list_event->screen_list);
+
+                emit writeMessage(-1, serializeMessage(message));
+            }
         }
         break;
 
@@ -113,6 +212,20 @@ void HostSessionDesktop::messageReceived(const QByteArray& buffer)
         readClipboardEvent(message.clipboard_event());
     else if (message.has_config())
         readConfig(message.config());
+    else if (message.has_video_ack())
+        readVideoAck(message.video_ack());
+    else if (message.has_screen())
+        readScreen(message.screen());
+    else if (message.has_refresh_request())
+        readRefreshRequest(message.refresh_request());
+    else if (message.has_input_events())
+        readInputEvents(message.input_events());
+    else if (message.has_ping())
+        readPing(message.ping());
+    else if (message.has_visibility())
+        readVisibility(message.visibility());
+    else if (message.has_visible_area())
+        readVisibleArea(message.visible_area());
     else
     {
         qDebug("Unhandled message from client");
@@ -127,8 +240,8 @@ void HostSessionDesktop::messageWritten(int message_id)
     {
         case ScreenUpdateMessage:
         {
-            if (!screen_updater_.isNull())
-                screen_updater_->update();
+            if (screen_updater_)
+                screen_updater_->update(this);
         }
         break;
 
@@ -145,7 +258,10 @@ void HostSessionDesktop::clipboardEvent(const proto::desktop::ClipboardEvent& ev
     proto::desktop::HostToClient message;
     message.mutable_clipboard_event()->CopyFrom(event);
 
-    emit writeMessage(-1, serializeMessage(message));
+    // The clipboard data is sent after the video.
+    emit writeMessage(-1, serializeMessage(message),
+                      event.data().empty() ? NormalPriority : LowPriority,
+                      ClipboardMessage);
 }
 
 void HostSessionDesktop::readPointerEvent(const proto::desktop::PointerEvent& event)
@@ -160,7 +276,27 @@ void HostSessionDesktop::readPointerEvent(const proto::desktop::PointerEvent& ev
     if (input_injector_.isNull())
         input_injector_.reset(new InputInjector(this));
 
-    input_injector_->injectPointerEvent(event);
+    proto::desktop::PointerEvent translated_event(event);
+    translatePointerEvent(&translated_event);
+
+    input_injector_->injectPointerEvent(translated_event);
+
+    if (screen_updater_)
+    {
+        screen_updater_->inputInjected();
+        addLatencyProbe(event.probe_time());
+    }
+}
+
+void HostSessionDesktop::translatePointerEvent(proto::desktop::PointerEvent* event)
+{
+    QPoint point(event->x(), event->y());
+
+    if (screen_updater_)
+        point = screen_updater_->toScreenPoint(point);
+
+    event->set_x(point.x() + screen_origin_.x());
+    event->set_y(point.y() + screen_origin_.y());
 }
 
 void HostSessionDesktop::readKeyEvent(const proto::desktop::KeyEvent& event)
@@ -176,6 +312,54 @@ void HostSessionDesktop::readKeyEvent(const proto::desktop::KeyEvent& event)
         input_injector_.reset(new InputInjector(this));
 
     input_injector_->injectKeyEvent(event);
+
+    if (screen_updater_)
+    {
+        screen_updater_->inputInjected();
+        addLatencyProbe(event.probe_time());
+    }
+}
+
+void HostSessionDesktop::readInputEvents(const proto::desktop::InputEvents& events)
+{
+    if (session_type_ != proto::auth::SESSION_TYPE_DESKTOP_MANAGE)
+    {
+        qWarning("Attempt to inject input events to desktop view session");
+        emit errorOccurred();
+        return;
+    }
+
+    if (input_injector_.isNull())
+        input_injector_.reset(new InputInjector(this));
+
+    proto::desktop::InputEvents translated_events(events);
+
+    for (auto& event : *translated_events.mutable_event())
+    {
+        if (!event.has_pointer_event())
+            continue;
+
+        translatePointerEvent(event.mutable_pointer_event());
+    }
+
+    input_injector_->injectInputEvents(translated_events);
+
+    if (screen_updater_)
+    {
+        screen_updater_->inputInjected();
+
+        for (const auto& event : translated_events.event())
+        {
+            addLatencyProbe(event.has_pointer_event() ?
+                event.pointer_event().probe_time() : event.key_event().probe_time());
+        }
+    }
+}
+
+void HostSessionDesktop::addLatencyProbe(qint64 probe_time)
+{
+    if (probe_time && (features_ & proto::desktop::FEATURE_LATENCY_PROBE))
+        screen_updater_->addLatencyProbe(this, probe_time);
 }
 
 void HostSessionDesktop::readClipboardEvent(const proto::desktop::ClipboardEvent& clipboard_event)
@@ -197,9 +381,115 @@ void HostSessionDesktop::readClipboardEvent(const proto::desktop::ClipboardEvent
     clipboard_->injectClipboardEvent(clipboard_event);
 }
 
+void HostSessionDesktop::readVideoAck(const proto::desktop::VideoAck& video_ack)
+{
+    if (screen_updater_)
+        screen_updater_->acknowledgeFrame(this, video_ack);
+}
+
+void HostSessionDesktop::readScreen(const proto::desktop::Screen& screen)
+{
+    if (screen_updater_)
+        screen_updater_->selectScreen(screen.id());
+}
+
+void HostSessionDesktop::readRefreshRequest(const proto::desktop::RefreshRequest& request)
+{
+    if (!screen_updater_)
+        return;
+
+    // The frames sent before the request are not waited for.
+    if (request.frames_lost())
+        screen_updater_->dropUnackedFrames(this);
+
+    screen_updater_->refreshScreen();
+}
+
+void HostSessionDesktop::readPing(const proto::desktop::Ping& ping)
+{
+    proto::desktop::HostToClient message;
+    message.mutable_ping()->CopyFrom(ping);
+
+    emit writeMessage(-1, serializeMessage(message));
+}
+
+void HostSessionDesktop::writeUpdate(const ScreenUpdater::Update& update)
+{
+    Q_ASSERT(!update.message.isEmpty());
+
+    // Only the written frames are reported to the screen updater.
+    const int message_id = (update.video && update.frame_end) ? ScreenUpdateMessage : -1;
+
+    // The cursor is not delayed by the video packets.
+    const MessagePriority priority = update.video ? NormalPriority : HighPriority;
+    const MessageClass message_class = update.video ? VideoMessage : CursorMessage;
+
+    // The message is already serialized by the screen updater.
+    emit writeMessage(message_id, update.message, priority, message_class);
+
+    // The packets are shared by all subscribers, so the probe follows the frame.
+    if (update.probe_time)
+    {
+        proto::desktop::HostToClient message;
+
+        proto::desktop::LatencyProbe* latency_probe = message.mutable_latency_probe();
+        latency_probe->set_time(update.probe_time);
+        latency_probe->set_host_delay(static_cast<quint32>(qMax<qint64>(0, update.probe_delay)));
+
+        emit writeMessage(-1, serializeMessage(message), priority, message_class);
+    }
+
+    if (recorder_)
+        recordUpdate(update);
+}
+
+void HostSessionDesktop::recordUpdate(const ScreenUpdater::Update& update)
+{
+    if (update.video)
+        recorder_->recordVideo(update.message, update.key_frame);
+    else
+        recorder_->recordCursor(update.message, update.cursor_reset);
+
+    // The key frames are the points of the seeking in the recording. The cursor cache is
+    // started again with them, so the cursor is restored from the nearest reset.
+    if (screen_updater_ && recorder_->isKeyFrameNeeded())
+    {
+        screen_updater_->refreshCursor();
+        screen_updater_->refreshScreen();
+    }
+}
+
+void HostSessionDesktop::readVisibility(const proto::desktop::Visibility& visibility)
+{
+    client_hidden_ = visibility.hidden();
+
+    // The recording of the session needs the stream.
+    if (screen_updater_ && !recorder_ && (features_ & proto::desktop::FEATURE_VISIBILITY))
+        screen_updater_->setSubscriberVisible(this, !client_hidden_);
+}
+
+void HostSessionDesktop::readVisibleArea(const proto::desktop::VisibleArea& visible_area)
+{
+    client_visible_area_ = VideoUtil::fromVideoRect(visible_area.rect());
+
+    // The recording of the session needs the whole screen in each frame.
+    if (screen_updater_ && !recorder_ && (features_ & proto::desktop::FEATURE_VISIBLE_AREA))
+        screen_updater_->setSubscriberVisibleArea(this, client_visible_area_);
+}
+
+void HostSessionDesktop::releaseScreenUpdater()
+{
+    if (!screen_updater_)
+        return;
+
+    // The updater is destroyed with the last subscriber.
+    screen_updater_->removeSubscriber(this);
+    screen_updater_.reset();
+}
+
 void HostSessionDesktop::readConfig(const proto::desktop::Config& config)
 {
-    delete screen_updater_;
+    releaseScreenUpdater();
     delete clipboard_;
 
     if (config.features() & proto::desktop::FEATURE_CLIPBOARD)
@@ -212,12 +502,60 @@ void HostSessionDesktop::readConfig(const proto::desktop::Config& config)
         }
 
         clipboard_ = new Clipboard(this);
+        clipboard_->setFeatures(config.features());
 
         connect(clipboard_, &Clipboard::clipboardEvent,
                 this, &HostSessionDesktop::clipboardEvent);
     }
 
-    screen_updater_ = new ScreenUpdater(config, this);
+    features_ = config.features();
+
+    if (features_ & proto::desktop::FEATURE_REDUCED_EFFECTS)
+    {
+        if (session_type_ != proto::auth::SESSION_TYPE_DESKTOP_MANAGE)
+        {
+            qWarning("Attempt to disable desktop effects in desktop view session");
+            emit errorOccurred();
+            return;
+        }
+
+        // The effects are disabled before the first capture of the updater.
+        if (!desktop_effects_)
+            desktop_effects_ = DesktopEffects::acquire();
+    }
+    else
+    {
+        desktop_effects_.reset();
+    }
+
+    // The recording is started from the whole screen.
+    proto::desktop::Config stream_config(config);
+    if (recorder_)
+        stream_config.clear_frame_hashes();
+
+    screen_updater_ = ScreenUpdater::acquire(stream_config);
+    screen_updater_->addSubscriber(this);
+
+    // The first subscriber of the updater may restore the cursor cache of the client, which
+    // is not in the recording.
+    if (recorder_)
+        screen_updater_->refreshCursor();
+
+    if (current_screen_id_ != -1)
+        screen_updater_->selectScreen(current_screen_id_);
+
+    // The window may be hidden while the config is changed.
+    if (client_hidden_ && !recorder_ && (features_ & proto::desktop::FEATURE_VISIBILITY))
+        screen_updater_->setSubscriberVisible(this, false);
+
+    if (!client_visible_area_.isEmpty() && !recorder_ &&
+        (features_ & proto::desktop::FEATURE_VISIBLE_AREA))
+    {
+        screen_updater_->setSubscriberVisibleArea(this, client_visible_area_);
+    }
+
+    if (write_blocked_)
+        screen_updater_->setSubscriberBlocked(this, true);
 }
 
 } // namespace aspia
@@ -8,15 +8,22 @@
 #ifndef _ASPIA_HOST__HOST_SESSION_DESKTOP_H
 #define _ASPIA_HOST__HOST_SESSION_DESKTOP_H
 
+#include <QPoint>
+#include <QRect>
+
+#include <memory>
+
 #include "host/host_session.h"
+#include "host/screen_updater.h"
 #include "protocol/authorization.pb.h"
 #include "protocol/desktop_session.pb.h"
 
 namespace aspia {
 
 class Clipboard;
+class DesktopEffects;
 class InputInjector;
-class ScreenUpdater;
+class SessionRecorder;
 
 class HostSessionDesktop : public HostSession
 {
@@ -24,7 +31,11 @@ class HostSessionDesktop : public HostSession
 
 public:
     HostSessionDesktop(proto::auth::SessionType session_type, const QString& channel_id);
-    ~HostSessionDesktop() = default;
+    ~HostSessionDesktop();
+
+    // The encodings and the features of the session without the encodings which depend on
+    // the hardware. The request is sent to the client with the result of the authorization.
+    static proto::desktop::ConfigRequest configRequest(proto::auth::SessionType session_type);
 
 public slots:
     // HostSession implementation.
@@ -35,6 +46,8 @@ protected:
     // HostSession implementation.
     void startSession() override;
     void stopSession() override;
+    int memoryDegradation() const override;
+    void setWriteBlocked(bool blocked) override;
     void customEvent(QEvent* event) override;
 
 private slots:
@@ -42,16 +55,58 @@ private slots:
 
 private:
     void readPointerEvent(const proto::desktop::PointerEvent& event);
+
+    // Maps the pointer of the client from the sent frames to the virtual screen.
+    void translatePointerEvent(proto::desktop::PointerEvent* event);
     void readKeyEvent(const proto::desktop::KeyEvent& event);
+    void readInputEvents(const proto::desktop::InputEvents& events);
+
+    // Registers the probe of the injected event with the screen updater.
+    void addLatencyProbe(qint64 probe_time);
     void readClipboardEvent(const proto::desktop::ClipboardEvent& event);
     void readConfig(const proto::desktop::Config& config);
+    void readVideoAck(const proto::desktop::VideoAck& video_ack);
+    void readScreen(const proto::desktop::Screen& screen);
+    void readRefreshRequest(const proto::desktop::RefreshRequest& request);
+    void readPing(const proto::desktop::Ping& ping);
+    void readVisibility(const proto::desktop::Visibility& visibility);
+    void readVisibleArea(const proto::desktop::VisibleArea& visible_area);
+    void writeUpdate(const ScreenUpdater::Update& update);
+    void recordUpdate(const ScreenUpdater::Update& update);
+    void releaseScreenUpdater();
 
     const proto::auth::SessionType session_type_;
 
-    QPointer<ScreenUpdater> screen_updater_;
+    // The updater is shared with the other sessions of the process which have the same
+    // stream parameters.
+    std::shared_ptr<ScreenUpdater> screen_updater_;
     QPointer<Clipboard> clipboard_;
     QScopedPointer<InputInjector> input_injector_;
 
+    // Held while the client requests FEATURE_REDUCED_EFFECTS. Shared with the other sessions.
+    std::shared_ptr<DesktopEffects> desktop_effects_;
+
+    // Records the messages of the screen updater if the recording is enabled.
+    std::unique_ptr<SessionRecorder> recorder_;
+
+    quint32 features_ = 0;
+
+    // The window of the client is minimized or hidden.
+    bool client_hidden_ = false;
+
+    // The part of the frames which the window of the client shows, or empty for the whole
+    // frame.
+    QRect client_visible_area_;
+
+    // The write queue of the IPC channel is full. The updater does not encode new frames.
+    bool write_blocked_ = false;
+
+    // The captured screen. The selection is kept when the config is changed.
+    qint64 current_screen_id_ = -1;
+
+    // The pointer coordinates of the client are relative to this point.
+    QPoint screen_origin_;
+
     Q_DISABLE_COPY(HostSessionDesktop)
 };
 
@@ -10,6 +10,8 @@
 
 #include <QObject>
 
+#include "base/message_class.h"
+#include "base/message_priority.h"
 #include "protocol/authorization.pb.h"
 
 namespace aspia {
@@ -26,7 +28,10 @@ public:
     virtual void startSession() = 0;
 
 signals:
-    void writeMessage(int message_id, const QByteArray& buffer);
+    void writeMessage(int message_id,
+                      const QByteArray& buffer,
+                      MessagePriority priority = NormalPriority,
+                      MessageClass message_class = GenericMessage);
     void readMessage();
     void errorOccurred();
 
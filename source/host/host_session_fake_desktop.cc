@@ -10,6 +10,9 @@
 #include <QPainter>
 
 #include "base/message_serialization.h"
+#include "codec/video_encoder_av1.h"
+#include "codec/video_encoder_hybrid.h"
+#include "codec/video_encoder_palette.h"
 #include "codec/video_encoder_vpx.h"
 #include "codec/video_encoder_zlib.h"
 #include "codec/video_util.h"
@@ -22,7 +25,13 @@ namespace {
 const quint32 kSupportedVideoEncodings =
     proto::desktop::VIDEO_ENCODING_ZLIB |
     proto::desktop::VIDEO_ENCODING_VP8 |
-    proto::desktop::VIDEO_ENCODING_VP9;
+    proto::desktop::VIDEO_ENCODING_VP9 |
+    proto::desktop::VIDEO_ENCODING_VP9_LOSSY |
+    proto::desktop::VIDEO_ENCODING_AV1 |
+    proto::desktop::VIDEO_ENCODING_LZ4 |
+    proto::desktop::VIDEO_ENCODING_ZSTD |
+    proto::desktop::VIDEO_ENCODING_HYBRID |
+    proto::desktop::VIDEO_ENCODING_PALETTE;
 
 const quint32 kSupportedFeatures = 0;
 
@@ -55,7 +64,11 @@ void HostSessionFakeDesktop::onMessageReceived(const QByteArray& buffer)
         return;
     }
 
-    if (message.has_config())
+    // The config which the client sends with the request of the authorization may have an
+    // encoding which is not offered here. The client sends another config after the request
+    // of this session.
+    if (message.has_config() &&
+        (message.config().video_encoding() & kSupportedVideoEncodings))
     {
         std::unique_ptr<VideoEncoder> video_encoder = createEncoder(message.config());
         if (!video_encoder)
@@ -73,8 +86,10 @@ void HostSessionFakeDesktop::onMessageReceived(const QByteArray& buffer)
             return;
         }
 
-        std::unique_ptr<proto::desktop::VideoPacket> packet = video_encoder->encode(frame.get());
-        if (!packet)
+        std::unique_ptr<proto::desktop::VideoPacket> packet =
+            std::make_unique<proto::desktop::VideoPacket>();
+
+        if (!video_encoder->encode(frame.get(), packet.get()))
         {
             qWarning("Unable to encode video frame");
             emit errorOccurred();
@@ -102,14 +117,41 @@ std::unique_ptr<VideoEncoder> HostSessionFakeDesktop::createEncoder(
     switch (config.video_encoding())
     {
         case proto::desktop::VIDEO_ENCODING_VP8:
-            return VideoEncoderVPX::createVP8();
+            return VideoEncoderVPX::createVP8(config.encoder_threads());
 
         case proto::desktop::VIDEO_ENCODING_VP9:
-            return VideoEncoderVPX::createVP9();
+            return VideoEncoderVPX::createVP9(config.encoder_threads(),
+                                              config.encoder_tile_columns());
+
+        case proto::desktop::VIDEO_ENCODING_VP9_LOSSY:
+            return VideoEncoderVPX::createVP9Lossy(config.encoder_threads(),
+                                                   config.encoder_tile_columns());
+
+        case proto::desktop::VIDEO_ENCODING_AV1:
+            return VideoEncoderAV1::create(config.encoder_threads());
 
         case proto::desktop::VIDEO_ENCODING_ZLIB:
+        case proto::desktop::VIDEO_ENCODING_LZ4:
+        case proto::desktop::VIDEO_ENCODING_ZSTD:
             return VideoEncoderZLIB::create(
-                VideoUtil::fromVideoPixelFormat(config.pixel_format()), config.compress_ratio());
+                VideoUtil::fromVideoPixelFormat(config.pixel_format()),
+                config.compress_ratio(),
+                VideoUtil::compressionForEncoding(config.video_encoding()),
+                (config.features() & proto::desktop::FEATURE_ZLIB_CHUNKS) != 0,
+                (config.features() & proto::desktop::FEATURE_ZLIB_STREAM) != 0);
+
+        case proto::desktop::VIDEO_ENCODING_HYBRID:
+            return VideoEncoderHybrid::create(
+                VideoEncoderZLIB::create(
+                    VideoUtil::fromVideoPixelFormat(config.pixel_format()),
+                    config.compress_ratio(),
+                    proto::desktop::COMPRESSION_ZLIB,
+                    (config.features() & proto::desktop::FEATURE_ZLIB_CHUNKS) != 0,
+                    (config.features() & proto::desktop::FEATURE_ZLIB_STREAM) != 0),
+                VideoEncoderVPX::createVP8(config.encoder_threads(), false));
+
+        case proto::desktop::VIDEO_ENCODING_PALETTE:
+            return VideoEncoderPalette::create(config.compress_ratio());
 
         default:
             qWarning() << "Unsupported video encoding: " << config.video_encoding();
@@ -8,7 +8,8 @@
 #include "host/host_session_file_transfer.h"
 
 #include "base/message_serialization.h"
-#include "host/file_worker.h"
+#include "client/file_multi_uploader.h"
+#include "host/file_worker_thread.h"
 
 namespace aspia {
 
@@ -16,6 +17,31 @@ namespace {
 
 enum MessageId { ReplyMessageId };
 
+// The reading of the requests is paused while this number of the requests is executed or
+// their replies are not written yet.
+constexpr int kMaxPendingRequests = 64;
+
+bool isDirectoryRequest(const proto::file_transfer::Request& request)
+{
+    return request.has_drive_list_request() ||
+           request.has_file_list_request() ||
+           request.has_create_directory_request() ||
+           request.has_rename_request() ||
+           request.has_remove_request();
+}
+
+// The new list of a directory of the file manager makes the previous lists unnecessary.
+bool isNextFileList(const proto::file_transfer::Request& request)
+{
+    if (!request.has_file_list_request())
+        return false;
+
+    const proto::file_transfer::FileListRequest& list_request = request.file_list_request();
+
+    return !list_request.recursive() && !list_request.continuation_id() &&
+           !list_request.single_part();
+}
+
 } // namespace
 
 HostSessionFileTransfer::HostSessionFileTransfer(const QString& channel_id)
@@ -26,18 +52,34 @@ HostSessionFileTransfer::HostSessionFileTransfer(const QString& channel_id)
 
 void HostSessionFileTransfer::startSession()
 {
-    worker_ = new FileWorker(this);
-    emit readMessage();
+    directory_worker_ = new FileWorkerThread(this);
+    file_worker_ = new FileWorkerThread(this);
+
+    connect(directory_worker_, &FileWorkerThread::replyReady,
+            this, &HostSessionFileTransfer::onReplyReady);
+    connect(file_worker_, &FileWorkerThread::replyReady,
+            this, &HostSessionFileTransfer::onReplyReady);
+
+    directory_worker_->start();
+    file_worker_->start();
+
+    readRequest();
 }
 
 void HostSessionFileTransfer::stopSession()
 {
-    delete worker_;
+    // The threads finish the requests which are executed now.
+    delete directory_worker_;
+    delete file_worker_;
+
+    pending_requests_.clear();
 }
 
 void HostSessionFileTransfer::messageReceived(const QByteArray& buffer)
 {
-    if (worker_.isNull())
+    reading_ = false;
+
+    if (directory_worker_.isNull() || file_worker_.isNull())
         return;
 
     proto::file_transfer::Request request;
@@ -48,12 +90,153 @@ void HostSessionFileTransfer::messageReceived(const QByteArray& buffer)
         return;
     }
 
-    emit writeMessage(ReplyMessageId, serializeMessage(worker_->doRequest(request)));
+    const quint64 request_id = ++last_request_id_;
+
+    PendingRequest& pending_request = pending_requests_[request_id];
+    pending_request.client_request_id = request.request_id();
+
+    executeRequest(request_id, request);
+    readRequest();
 }
 
 void HostSessionFileTransfer::messageWritten(int message_id)
 {
     Q_ASSERT(message_id == ReplyMessageId);
+
+    --unwritten_replies_;
+    readRequest();
+}
+
+void HostSessionFileTransfer::onReplyReady(quint64 request_id, const QByteArray& reply)
+{
+    auto it = pending_requests_.find(request_id);
+    if (it == pending_requests_.end())
+        return;
+
+    it->second.reply = reply;
+    it->second.ready = true;
+
+    sendReplies();
+    readRequest();
+}
+
+void HostSessionFileTransfer::executeRequest(quint64 request_id,
+                                             const proto::file_transfer::Request& request)
+{
+    if (request.has_remote_copy_request())
+    {
+        executeRemoteCopy(request_id, request.remote_copy_request());
+        return;
+    }
+
+    if (!isDirectoryRequest(request))
+    {
+        file_worker_->addRequest(request_id, request);
+        return;
+    }
+
+    if (isNextFileList(request))
+    {
+        for (const auto canceled_id : directory_worker_->cancelFileLists())
+        {
+            proto::file_transfer::Reply reply;
+            reply.set_status(proto::file_transfer::STATUS_CANCELED);
+            setReply(canceled_id, &reply);
+        }
+
+        sendReplies();
+    }
+
+    directory_worker_->addRequest(request_id, request);
+}
+
+void HostSessionFileTransfer::executeRemoteCopy(
+    quint64 request_id, const proto::file_transfer::RemoteCopyRequest& request)
+{
+    ConnectData target;
+    target.setAddress(QString::fromStdString(request.target_address()));
+    target.setPort(request.target_port());
+    target.setUserName(QString::fromStdString(request.target_user_name()));
+    target.setPassword(QString::fromStdString(request.target_password()));
+
+    // The host uploads the file to the other host as the client does, so the other host
+    // does not need to support anything new.
+    FileMultiUploader* uploader =
+        new FileMultiUploader(QString::fromStdString(request.path()),
+                              QString::fromStdString(request.target_path()),
+                              request.overwrite(),
+                              QVector<ConnectData>() << target,
+                              this);
+
+    connect(uploader, &FileMultiUploader::finished, this, [=]()
+    {
+        proto::file_transfer::Reply reply;
+
+        if (uploader->isSucceeded(0))
+        {
+            reply.set_status(proto::file_transfer::STATUS_SUCCESS);
+        }
+        else
+        {
+            reply.set_status(proto::file_transfer::STATUS_FILE_WRITE_ERROR);
+            reply.set_error_string(uploader->statusString(0).toStdString());
+        }
+
+        uploader->deleteLater();
+
+        setReply(request_id, &reply);
+        sendReplies();
+        readRequest();
+    });
+
+    uploader->start();
+}
+
+void HostSessionFileTransfer::setReply(quint64 request_id, proto::file_transfer::Reply* reply)
+{
+    auto it = pending_requests_.find(request_id);
+    if (it == pending_requests_.end())
+        return;
+
+    reply->set_request_id(it->second.client_request_id);
+
+    it->second.reply = serializeMessage(*reply);
+    it->second.ready = true;
+}
+
+void HostSessionFileTransfer::sendReplies()
+{
+    bool ordered_pending = false;
+
+    for (auto it = pending_requests_.begin(); it != pending_requests_.end();)
+    {
+        PendingRequest& pending_request = it->second;
+
+        // The replies to the requests without the identifier are sent in the order of the
+        // requests.
+        if (!pending_request.ready || (pending_request.ordered() && ordered_pending))
+        {
+            ordered_pending = ordered_pending || pending_request.ordered();
+            ++it;
+            continue;
+        }
+
+        ++unwritten_replies_;
+        emit writeMessage(ReplyMessageId, pending_request.reply, LowPriority, FileMessage);
+
+        it = pending_requests_.erase(it);
+    }
+}
+
+void HostSessionFileTransfer::readRequest()
+{
+    if (reading_)
+        return;
+
+    if (static_cast<int>(pending_requests_.size()) + unwritten_replies_ >= kMaxPendingRequests)
+        return;
+
+    reading_ = true;
     emit readMessage();
 }
 
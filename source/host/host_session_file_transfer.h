@@ -8,11 +8,14 @@
 #ifndef _ASPIA_HOST__HOST_SESSION_FILE_TRANSFER_H
 #define _ASPIA_HOST__HOST_SESSION_FILE_TRANSFER_H
 
+#include <map>
+
 #include "host/host_session.h"
+#include "protocol/file_transfer_session.pb.h"
 
 namespace aspia {
 
-class FileWorker;
+class FileWorkerThread;
 
 class HostSessionFileTransfer : public HostSession
 {
@@ -31,8 +34,38 @@ protected:
     void startSession() override;
     void stopSession() override;
 
+private slots:
+    void onReplyReady(quint64 request_id, const QByteArray& reply);
+
 private:
-    QPointer<FileWorker> worker_;
+    void executeRequest(quint64 request_id, const proto::file_transfer::Request& request);
+    void executeRemoteCopy(quint64 request_id,
+                           const proto::file_transfer::RemoteCopyRequest& request);
+    void setReply(quint64 request_id, proto::file_transfer::Reply* reply);
+    void sendReplies();
+    void readRequest();
+
+    // The lists of the directories and the other changes of the directories are executed by
+    // |directory_worker_|, the transfers of the files by |file_worker_|.
+    QPointer<FileWorkerThread> directory_worker_;
+    QPointer<FileWorkerThread> file_worker_;
+
+    // The requests which are executed now by the identifiers of the session. The replies to
+    // the requests without the identifier of the client are kept until the replies to the
+    // previous requests are sent.
+    struct PendingRequest
+    {
+        bool ordered() const { return !client_request_id; }
+
+        quint64 client_request_id = 0;
+        bool ready = false;
+        QByteArray reply;
+    };
+
+    std::map<quint64, PendingRequest> pending_requests_;
+    quint64 last_request_id_ = 0;
+    int unwritten_replies_ = 0;
+    bool reading_ = false;
 
     Q_DISABLE_COPY(HostSessionFileTransfer)
 };
@@ -0,0 +1,69 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/host_session_group.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "host/host_session_group.h"
+
+#include <QCoreApplication>
+#include <QDebug>
+
+#include "base/message_serialization.h"
+#include "host/host_session.h"
+#include "ipc/ipc_channel.h"
+#include "protocol/host_session.pb.h"
+
+namespace aspia {
+
+HostSessionGroup::HostSessionGroup(const QString& channel_id, QObject* parent)
+    : QObject(parent),
+      channel_id_(channel_id)
+{
+    // Nothing
+}
+
+void HostSessionGroup::start()
+{
+    ipc_channel_ = IpcChannel::createClient(this);
+
+    connect(ipc_channel_, &IpcChannel::connected, ipc_channel_, &IpcChannel::readMessage);
+    connect(ipc_channel_, &IpcChannel::disconnected, this, &HostSessionGroup::stop);
+    connect(ipc_channel_, &IpcChannel::errorOccurred, this, &HostSessionGroup::stop);
+    connect(ipc_channel_, &IpcChannel::messageReceived,
+            this, &HostSessionGroup::onMessageReceived);
+
+    ipc_channel_->connectToServer(channel_id_);
+}
+
+void HostSessionGroup::onMessageReceived(const QByteArray& buffer)
+{
+    proto::host::StartSession message;
+
+    if (!parseMessage(buffer, message))
+    {
+        qWarning("Invalid message from the service");
+        stop();
+        return;
+    }
+
+    HostSession* session = HostSession::create(QString::fromStdString(message.session_type()),
+                                               QString::fromStdString(message.channel_id()));
+    if (session)
+    {
+        // The other sessions of the process continue to work.
+        session->setParent(this);
+        connect(session, &HostSession::finished, session, &HostSession::deleteLater);
+        session->start();
+    }
+
+    ipc_channel_->readMessage();
+}
+
+void HostSessionGroup::stop()
+{
+    QCoreApplication::quit();
+}
+
+} // namespace aspia
@@ -0,0 +1,45 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/host_session_group.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_HOST__HOST_SESSION_GROUP_H
+#define _ASPIA_HOST__HOST_SESSION_GROUP_H
+
+#include <QPointer>
+
+namespace aspia {
+
+class IpcChannel;
+
+//
+// Runs the sessions of the shared session process. The service sends the sessions to start by
+// the control channel and each session connects to its own IPC channel. The process ends when
+// the control channel is disconnected.
+//
+class HostSessionGroup : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit HostSessionGroup(const QString& channel_id, QObject* parent = nullptr);
+    ~HostSessionGroup() = default;
+
+    void start();
+
+private slots:
+    void onMessageReceived(const QByteArray& buffer);
+    void stop();
+
+private:
+    QString channel_id_;
+    QPointer<IpcChannel> ipc_channel_;
+
+    Q_DISABLE_COPY(HostSessionGroup)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_HOST__HOST_SESSION_GROUP_H
@@ -7,8 +7,11 @@
 
 #include "host/host_session_system_info.h"
 
+#include <QSet>
+
 #include "base/message_serialization.h"
-#include "protocol/system_info_session.pb.h"
+#include "codec/compressor.h"
+#include "host/system_info_cache.h"
 
 namespace aspia {
 
@@ -16,6 +19,10 @@ namespace {
 
 enum MessageId { ReplyMessageId };
 
+// The smaller data is sent uncompressed.
+constexpr int kMinCompressSize = 256;
+constexpr int kCompressionRatio = 6;
+
 } // namespace
 
 HostSessionSystemInfo::HostSessionSystemInfo(const QString& channel_id)
@@ -24,8 +31,13 @@ HostSessionSystemInfo::HostSessionSystemInfo(const QString& channel_id)
     // Nothing
 }
 
+HostSessionSystemInfo::~HostSessionSystemInfo() = default;
+
 void HostSessionSystemInfo::messageReceived(const QByteArray& buffer)
 {
+    if (cache_.isNull())
+        return;
+
     proto::system_info::Request request;
 
     if (!parseMessage(buffer, request))
@@ -34,23 +46,150 @@ void HostSessionSystemInfo::messageReceived(const QByteArray& buffer)
         return;
     }
 
-    // TODO
+    compress_ = false;
+
+    if (request.has_category_list_request())
+    {
+        proto::system_info::Reply reply;
+
+        for (const auto& uuid : cache_->categoryList())
+            reply.mutable_category_list()->add_uuid(uuid.toStdString());
+
+        ++pending_replies_;
+        emit writeMessage(ReplyMessageId, serializeMessage(reply));
+    }
+    else if (request.has_category_request())
+    {
+        // The reply is sent when the category is collected.
+        ++pending_replies_;
+        cache_->request(QString::fromStdString(request.category_request().uuid()));
+    }
+    else if (request.has_category_batch_request())
+    {
+        const proto::system_info::CategoryBatchRequest& batch_request =
+            request.category_batch_request();
+
+        if (batch_request.compress())
+        {
+            if (!compressor_ || compression_ != batch_request.compression())
+            {
+                compression_ = batch_request.compression();
+                compressor_ = Compressor::create(compression_, kCompressionRatio);
+            }
+
+            compress_ = compressor_ != nullptr;
+        }
+
+        // Each category is replied once.
+        QSet<QString> uuids;
+
+        for (const auto& uuid : batch_request.uuid())
+            uuids.insert(QString::fromStdString(uuid));
+
+        if (uuids.isEmpty())
+        {
+            emit readMessage();
+            return;
+        }
+
+        // All categories are counted before the cached ones are replied.
+        pending_replies_ += uuids.size();
+
+        for (const auto& uuid : uuids)
+            cache_->request(uuid);
+    }
+    else
+    {
+        emit errorOccurred();
+    }
 }
 
 void HostSessionSystemInfo::messageWritten(int message_id)
 {
     Q_ASSERT(message_id == ReplyMessageId);
-    emit readMessage();
+
+    if (--pending_replies_ <= 0)
+    {
+        pending_replies_ = 0;
+        emit readMessage();
+    }
 }
 
 void HostSessionSystemInfo::startSession()
 {
-    // TODO
+    cache_ = new SystemInfoCache(this);
+
+    connect(cache_, &SystemInfoCache::categoryReady,
+            this, &HostSessionSystemInfo::categoryReady);
+
+    // The categories are collected while the client shows the list of them, so they are
+    // replied at once.
+    cache_->prefetch(cache_->categoryList());
+
+    emit readMessage();
 }
 
 void HostSessionSystemInfo::stopSession()
 {
-    // TODO
+    delete cache_;
+}
+
+void HostSessionSystemInfo::categoryReady(const QString& uuid, const QByteArray& data)
+{
+    proto::system_info::Reply reply;
+
+    proto::system_info::Category* category = reply.mutable_category();
+    category->set_uuid(uuid.toStdString());
+    setData(data, category);
+
+    emit writeMessage(ReplyMessageId, serializeMessage(reply), LowPriority);
+}
+
+void HostSessionSystemInfo::setData(const QByteArray& data,
+                                    proto::system_info::Category* category)
+{
+    if (!compress_ || data.size() < kMinCompressSize)
+    {
+        category->set_data(data.constData(), data.size());
+        return;
+    }
+
+    compressor_->reset();
+
+    // The compressed data is sent only if it is smaller.
+    std::string* compressed = category->mutable_data();
+    compressed->resize(data.size());
+
+    const quint8* input = reinterpret_cast<const quint8*>(data.constData());
+    quint8* output = reinterpret_cast<quint8*>(compressed->data());
+    const size_t size = data.size();
+
+    size_t used = 0;
+    size_t filled = 0;
+    bool compress_again = true;
+
+    while (compress_again && filled < size)
+    {
+        size_t consumed = 0;
+        size_t written = 0;
+
+        compress_again = compressor_->process(input + used, size - used,
+                                              output + filled, size - filled,
+                                              Compressor::CompressorFinish,
+                                              &consumed, &written);
+        used += consumed;
+        filled += written;
+    }
+
+    if (compress_again || used != size || filled >= size)
+    {
+        category->set_data(data.constData(), data.size());
+        return;
+    }
+
+    compressed->resize(filled);
+    category->set_compression(compression_);
+    category->set_uncompressed_size(static_cast<quint32>(size));
 }
 
 } // namespace aspia
@@ -8,17 +8,26 @@
 #ifndef _ASPIA_HOST__HOST_SESSION_SYSTEM_INFO_H
 #define _ASPIA_HOST__HOST_SESSION_SYSTEM_INFO_H
 
+#include <QPointer>
+
+#include <memory>
+
 #include "host/host_session.h"
+#include "protocol/desktop_session.pb.h"
+#include "protocol/system_info_session.pb.h"
 
 namespace aspia {
 
+class Compressor;
+class SystemInfoCache;
+
 class HostSessionSystemInfo : public HostSession
 {
     Q_OBJECT
 
 public:
     explicit HostSessionSystemInfo(const QString& channel_id);
-    ~HostSessionSystemInfo() = default;
+    ~HostSessionSystemInfo();
 
 public slots:
     // HostSession implementation.
@@ -29,7 +38,22 @@ protected:
     void startSession() override;
     void stopSession() override;
 
+private slots:
+    void categoryReady(const QString& uuid, const QByteArray& data);
+
 private:
+    void setData(const QByteArray& data, proto::system_info::Category* category);
+
+    QPointer<SystemInfoCache> cache_;
+
+    // The next request is read when all replies of the current one are written.
+    int pending_replies_ = 0;
+
+    // The compression requested by the current batch request.
+    bool compress_ = false;
+    proto::desktop::Compression compression_ = proto::desktop::COMPRESSION_ZSTD;
+    std::unique_ptr<Compressor> compressor_;
+
     Q_DISABLE_COPY(HostSessionSystemInfo)
 };
 
@@ -9,8 +9,18 @@
 
 #include <QDebug>
 
+#include "crypto/random.h"
+#include "network/network_server.h"
+
 namespace aspia {
 
+namespace {
+
+const int kUnknownUserKeySize = 32;
+const int kRelayHostKeySize = 32;
+
+} // namespace
+
 HostSettings::HostSettings()
     : settings_(QSettings::SystemScope, QStringLiteral("Aspia"), QStringLiteral("Host"))
 {
@@ -52,6 +62,201 @@ bool HostSettings::setTcpPort(int port)
     return true;
 }
 
+bool HostSettings::isProcessPoolEnabled() const
+{
+    return settings_.value(QStringLiteral("ProcessPool"), false).toBool();
+}
+
+bool HostSettings::setProcessPoolEnabled(bool enable)
+{
+    if (!settings_.isWritable())
+        return false;
+
+    settings_.setValue(QStringLiteral("ProcessPool"), enable);
+    return true;
+}
+
+bool HostSettings::isSharedProcessEnabled() const
+{
+    return settings_.value(QStringLiteral("SharedProcess"), true).toBool();
+}
+
+bool HostSettings::setSharedProcessEnabled(bool enable)
+{
+    if (!settings_.isWritable())
+        return false;
+
+    settings_.setValue(QStringLiteral("SharedProcess"), enable);
+    return true;
+}
+
+bool HostSettings::isIocpEnabled() const
+{
+    return settings_.value(QStringLiteral("Iocp"), false).toBool();
+}
+
+bool HostSettings::setIocpEnabled(bool enable)
+{
+    if (!settings_.isWritable())
+        return false;
+
+    settings_.setValue(QStringLiteral("Iocp"), enable);
+    return true;
+}
+
+bool HostSettings::isDatagramsEnabled() const
+{
+    return settings_.value(QStringLiteral("Datagrams"), false).toBool();
+}
+
+bool HostSettings::setDatagramsEnabled(bool enable)
+{
+    if (!settings_.isWritable())
+        return false;
+
+    settings_.setValue(QStringLiteral("Datagrams"), enable);
+    return true;
+}
+
+int HostSettings::maxPendingConnections() const
+{
+    return settings_.value(QStringLiteral("MaxPendingConnections"),
+                           NetworkServer::kDefaultMaxPendingChannels).toInt();
+}
+
+int HostSettings::maxSessions() const
+{
+    return settings_.value(QStringLiteral("MaxSessions"), 0).toInt();
+}
+
+QString HostSettings::screenRecordFile() const
+{
+    return settings_.value(QStringLiteral("ScreenRecordFile")).toString();
+}
+
+QString HostSettings::screenReplayFile() const
+{
+    return settings_.value(QStringLiteral("ScreenReplayFile")).toString();
+}
+
+QString HostSettings::sessionRecordDirectory() const
+{
+    return settings_.value(QStringLiteral("SessionRecordDirectory")).toString();
+}
+
+QString HostSettings::capturerType() const
+{
+    return settings_.value(QStringLiteral("Capturer"), QStringLiteral("auto")).toString();
+}
+
+bool HostSettings::isTracingEnabled() const
+{
+    return settings_.value(QStringLiteral("TracingEnabled"), false).toBool();
+}
+
+QString HostSettings::metricsFile() const
+{
+    return settings_.value(QStringLiteral("MetricsFile")).toString();
+}
+
+int HostSettings::cpuBudget() const
+{
+    return settings_.value(QStringLiteral("CpuBudget"), 0).toInt();
+}
+
+int HostSettings::memoryBudget() const
+{
+    return settings_.value(QStringLiteral("MemoryBudget"), 0).toInt();
+}
+
+bool HostSettings::isPowerSavingEnabled() const
+{
+    return settings_.value(QStringLiteral("PowerSaving"), true).toBool();
+}
+
+bool HostSettings::isSliceEncodingEnabled() const
+{
+    return settings_.value(QStringLiteral("SliceEncoding"), true).toBool();
+}
+
+QString HostSettings::disabledInstructionSets() const
+{
+    return settings_.value(QStringLiteral("DisabledInstructionSets")).toString();
+}
+
+int HostSettings::sessionBandwidthLimit() const
+{
+    return settings_.value(QStringLiteral("SessionBandwidthLimit"), 0).toInt();
+}
+
+int HostSettings::hostBandwidthLimit() const
+{
+    return settings_.value(QStringLiteral("HostBandwidthLimit"), 0).toInt();
+}
+
+QStringList HostSettings::relayList() const
+{
+    return settings_.value(QStringLiteral("Relays")).toStringList();
+}
+
+QString HostSettings::relayHostId() const
+{
+    return settings_.value(QStringLiteral("RelayHostId")).toString();
+}
+
+QString HostSettings::relaySecret() const
+{
+    return settings_.value(QStringLiteral("RelaySecret")).toString();
+}
+
+QByteArray HostSettings::relayHostKey() const
+{
+    QByteArray key = settings_.value(QStringLiteral("RelayHostKey")).toByteArray();
+    if (key.size() == kRelayHostKeySize)
+        return key;
+
+    key = Random::generateBuffer(kRelayHostKeySize);
+
+    // If the settings are read-only, then the key is valid until the service is stopped.
+    if (settings_.isWritable())
+        settings_.setValue(QStringLiteral("RelayHostKey"), key);
+
+    return key;
+}
+
+QByteArray HostSettings::unknownUserKey() const
+{
+    QByteArray key = settings_.value(QStringLiteral("UnknownUserKey")).toByteArray();
+    if (key.size() == kUnknownUserKeySize)
+        return key;
+
+    key = Random::generateBuffer(kUnknownUserKeySize);
+
+    // If the settings are read-only, then the key is valid until the service is stopped.
+    if (settings_.isWritable())
+        settings_.setValue(QStringLiteral("UnknownUserKey"), key);
+
+    return key;
+}
+
+QString HostSettings::threadPriority(const QString& role, const QString& default_priority) const
+{
+    return settings_.value(QStringLiteral("Threads/%1/Priority").arg(role),
+                           default_priority).toString();
+}
+
+QString HostSettings::threadTask(const QString& role, const QString& default_task) const
+{
+    return settings_.value(QStringLiteral("Threads/%1/Task").arg(role), default_task).toString();
+}
+
+quint64 HostSettings::threadAffinityMask(const QString& role) const
+{
+    // The mask can be written in hexadecimal with the prefix "0x".
+    return settings_.value(QStringLiteral("Threads/%1/AffinityMask").arg(role))
+        .toString().toULongLong(nullptr, 0);
+}
+
 QList<User> HostSettings::userList() const
 {
     QList<User> user_list;
@@ -78,6 +283,16 @@ QList<User> HostSettings::userList() const
             return QList<User>();
         }
 
+        // The users of the previous versions have no salt.
+        if (!user.setPasswordHashing(
+                settings_.value(QStringLiteral("PasswordSalt")).toByteArray(),
+                settings_.value(QStringLiteral("PasswordOpsLimit")).toUInt(),
+                settings_.value(QStringLiteral("PasswordMemLimit")).toUInt()))
+        {
+            qDebug() << "Invalid password hashing parameters. The list of users is corrupted";
+            return QList<User>();
+        }
+
         user.setFlags(settings_.value(QStringLiteral("Flags")).toUInt());
         user.setSessions(settings_.value(QStringLiteral("Sessions")).toUInt());
 
@@ -104,6 +319,14 @@ bool HostSettings::setUserList(const QList<User>& user_list)
 
         settings_.setValue(QStringLiteral("UserName"), user.name());
         settings_.setValue(QStringLiteral("PasswordHash"), user.passwordHash());
+
+        if (!user.passwordSalt().isEmpty())
+        {
+            settings_.setValue(QStringLiteral("PasswordSalt"), user.passwordSalt());
+            settings_.setValue(QStringLiteral("PasswordOpsLimit"), user.opsLimit());
+            settings_.setValue(QStringLiteral("PasswordMemLimit"), user.memLimit());
+        }
+
         settings_.setValue(QStringLiteral("Flags"), user.flags());
         settings_.setValue(QStringLiteral("Sessions"), user.sessions());
     }
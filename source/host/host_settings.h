@@ -9,6 +9,7 @@
 #define _ASPIA_HOST__HOST_SETTINGS_H
 
 #include <QSettings>
+#include <QStringList>
 
 #include "host/user.h"
 
@@ -29,6 +30,99 @@ public:
     int tcpPort() const;
     bool setTcpPort(int port);
 
+    // If enabled, then the session processes are started before the connections.
+    bool isProcessPoolEnabled() const;
+    bool setProcessPoolEnabled(bool enable);
+
+    // If enabled, then the sessions of one account in a user session run in one process.
+    bool isSharedProcessEnabled() const;
+    bool setSharedProcessEnabled(bool enable);
+
+    // If enabled, then the connections are served by the completion port instead of the
+    // event loop of the service.
+    bool isIocpEnabled() const;
+    bool setIocpEnabled(bool enable);
+
+    // If enabled, then the video is sent by the datagrams to the clients which support them
+    // on the direct connections (see DatagramPath).
+    bool isDatagramsEnabled() const;
+    bool setDatagramsEnabled(bool enable);
+
+    // The limit of the connections in the key exchange.
+    int maxPendingConnections() const;
+
+    // The limit of the running sessions. Zero if there is no limit.
+    int maxSessions() const;
+
+    // The files for the recording and the replay of the screen by the desktop sessions. Empty
+    // if disabled.
+    QString screenRecordFile() const;
+    QString screenReplayFile() const;
+
+    // The directory into which the desktop sessions are recorded as they are sent to the
+    // clients. Empty if disabled.
+    QString sessionRecordDirectory() const;
+
+    // The capturer of the screen: "dxgi", "gdi" or "auto". With "auto" the faster capturer
+    // is chosen by measuring both of them when the first session of the process starts.
+    QString capturerType() const;
+
+    // If enabled, then the host processes write the spans of the desktop pipeline into the
+    // trace files in the logging directory.
+    bool isTracingEnabled() const;
+
+    // The file into which the service periodically writes the counters of the sessions. Empty
+    // if disabled.
+    QString metricsFile() const;
+
+    // The part of all processors (in percent) which the desktop session process may use. The
+    // effort and the frame rate of the encoder are adapted to the load. Zero if disabled.
+    int cpuBudget() const;
+
+    // The private memory (in megabytes) which the desktop session process may use. Above it
+    // the cached buffers are freed and the frames are scaled down. Zero if disabled.
+    int memoryBudget() const;
+
+    // If enabled, then the desktop sessions capture and encode less while the computer runs
+    // on the battery or the battery saver is on. Enabled by default.
+    bool isPowerSavingEnabled() const;
+
+    // If enabled, then the large updates of the tile encodings are encoded and sent in slices
+    // of rows, so the client shows the top of the screen while the rest is being encoded.
+    // Enabled by default.
+    bool isSliceEncodingEnabled() const;
+
+    // The instruction sets which the vector kernels of the host processes do not use, for
+    // example "avx512,avx2" or "all", for comparing the implementations. Empty by default.
+    QString disabledInstructionSets() const;
+
+    // The limits (in kbit/s) of the data which the host sends to each session and to all
+    // sessions together. The encoders of the sessions adapt to them too. Zero if disabled.
+    int sessionBandwidthLimit() const;
+    int hostBandwidthLimit() const;
+
+    // The relays on which the host is registered, "address" or "address:port". The clients
+    // connect to "host_id@relay_address". The relays are not used if the identifier is empty.
+    QStringList relayList() const;
+    QString relayHostId() const;
+    QString relaySecret() const;
+
+    // The key which proves to the relays that the host owns its identifier. It is created
+    // when it is read for the first time.
+    QByteArray relayHostKey() const;
+
+    // The secret key of the salts which are sent for the unknown user names. It is created
+    // when it is read for the first time, so the salts do not change after the restart.
+    QByteArray unknownUserKey() const;
+
+    // The scheduling of the threads of the desktop pipeline. |role| is "Capture", "Encode",
+    // "Network" or "Input". The priority is one of the names of ScopedThreadRole, the MMCSS
+    // task is empty if the thread is not registered and the affinity mask is zero for all
+    // processors.
+    QString threadPriority(const QString& role, const QString& default_priority) const;
+    QString threadTask(const QString& role, const QString& default_task) const;
+    quint64 threadAffinityMask(const QString& role) const;
+
     QList<User> userList() const;
     bool setUserList(const QList<User>& user_list);
 
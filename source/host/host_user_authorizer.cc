@@ -7,20 +7,36 @@
 
 #include "host/host_user_authorizer.h"
 
-#include <QCryptographicHash>
+#include <QCoreApplication>
+#include <QtEndian>
+#include <QRunnable>
+#include <QThreadPool>
 #include <QTimerEvent>
 
+#include <algorithm>
+#include <mutex>
+
 #include "base/message_serialization.h"
+#include "crypto/password_hash.h"
 #include "crypto/random.h"
 #include "crypto/secure_memory.h"
+#include "host/host_session_desktop.h"
 #include "network/network_channel.h"
 
+extern "C" {
+#define SODIUM_STATIC
+
+#pragma warning(push, 3)
+#include <sodium.h>
+#pragma warning(pop)
+} // extern "C"
+
 namespace aspia {
 
 namespace {
 
-const quint32 kKeyHashingRounds = 100000;
 const quint32 kNonceSize = 16;
+const quint32 kResumeTicketSize = 32;
 
 enum MessageId { ServerChallenge, LogonResult };
 
@@ -29,25 +45,154 @@ QByteArray generateNonce()
     return Random::generateBuffer(kNonceSize);
 }
 
-QByteArray createSessionKey(const QByteArray& password_hash, const QByteArray& nonce)
+// The desktop sessions keep the state of the screen on the host, which is expensive to create
+// again after a short loss of the connection.
+bool isResumableSession(proto::auth::SessionType session_type)
 {
-    QByteArray data = password_hash;
+    return session_type == proto::auth::SESSION_TYPE_DESKTOP_MANAGE ||
+           session_type == proto::auth::SESSION_TYPE_DESKTOP_VIEW;
+}
 
-    for (quint32 i = 0; i < kKeyHashingRounds; ++i)
-    {
-        QCryptographicHash hash(QCryptographicHash::Sha512);
+bool isSameChallenge(const proto::auth::ServerChallenge& first,
+                     const proto::auth::ServerChallenge& second)
+{
+    return first.password_hashing() == second.password_hashing() &&
+           first.password_salt() == second.password_salt() &&
+           first.ops_limit() == second.ops_limit() &&
+           first.mem_limit() == second.mem_limit();
+}
+
+// The parameters of the hash which are sent for the users which do not exist. They are the same
+// for each connection, and the hashing and the limits are taken from an existing user chosen by
+// the name, so the challenge does not show whether the user exists.
+proto::auth::ServerChallenge unknownUserChallenge(const QString& user_name,
+                                                  const QByteArray& key,
+                                                  const HostUserAuthorizer::UserIndex& user_index)
+{
+    QByteArray user_name_utf8 = user_name.toLower().toUtf8();
+
+    // The salt and the index of the user.
+    quint8 hash[PasswordHash::kSaltSize + sizeof(quint32)];
+
+    crypto_generichash(hash,
+                       sizeof(hash),
+                       reinterpret_cast<const quint8*>(user_name_utf8.constData()),
+                       user_name_utf8.size(),
+                       reinterpret_cast<const quint8*>(key.constData()),
+                       key.size());
 
-        hash.addData(data);
-        hash.addData(nonce);
+    // The order of the hash table is different in each process.
+    QStringList user_names = user_index.keys();
+    std::sort(user_names.begin(), user_names.end());
 
-        data = hash.result();
+    const quint32 index = qFromLittleEndian<quint32>(hash + PasswordHash::kSaltSize);
+    const User& user = user_index[user_names[index % user_names.size()]];
+
+    proto::auth::ServerChallenge server_challenge;
+
+    // The users of the previous versions have no salt.
+    if (!user.passwordSalt().isEmpty())
+    {
+        server_challenge.set_password_hashing(proto::auth::PASSWORD_HASHING_ARGON2ID);
+        server_challenge.set_password_salt(hash, PasswordHash::kSaltSize);
+        server_challenge.set_ops_limit(user.opsLimit());
+        server_challenge.set_mem_limit(user.memLimit());
     }
 
-    return data;
+    sodium_memzero(hash, sizeof(hash));
+    secureMemZero(&user_name_utf8);
+    return server_challenge;
 }
 
+class VerificationEvent : public QEvent
+{
+public:
+    static const int kType = QEvent::User + 1;
+
+    explicit VerificationEvent(bool is_valid_session_key)
+        : QEvent(static_cast<QEvent::Type>(kType)),
+          is_valid_session_key(is_valid_session_key)
+    {
+        // Nothing
+    }
+
+    const bool is_valid_session_key;
+
+private:
+    Q_DISABLE_COPY(VerificationEvent)
+};
+
 } // namespace
 
+// The state of the verification is shared with the task of the thread pool. The authorizer
+// may be destroyed before the task is finished.
+struct HostUserAuthorizer::Verification
+{
+    ~Verification()
+    {
+        secureMemZero(&password_hash);
+        secureMemZero(&nonce);
+        secureMemZero(&session_key);
+    }
+
+    std::mutex lock;
+    HostUserAuthorizer* receiver = nullptr;
+
+    proto::auth::PasswordHashing password_hashing;
+    QByteArray password_hash;
+    QByteArray nonce;
+    QByteArray session_key;
+};
+
+class HostUserAuthorizer::VerificationTask : public QRunnable
+{
+public:
+    explicit VerificationTask(std::shared_ptr<Verification> verification)
+        : verification_(std::move(verification))
+    {
+        // Nothing
+    }
+
+    // QRunnable implementation.
+    void run() override
+    {
+        QByteArray expected_session_key;
+
+        if (verification_->password_hashing == proto::auth::PASSWORD_HASHING_ARGON2ID)
+        {
+            expected_session_key = PasswordHash::createSessionKey(
+                verification_->password_hash, verification_->nonce);
+        }
+        else
+        {
+            expected_session_key = PasswordHash::createLegacySessionKey(
+                verification_->password_hash, verification_->nonce);
+        }
+
+        const QByteArray& session_key = verification_->session_key;
+
+        const bool is_valid_session_key = !expected_session_key.isEmpty() &&
+            expected_session_key.size() == session_key.size() &&
+            sodium_memcmp(expected_session_key.constData(), session_key.constData(),
+                          session_key.size()) == 0;
+
+        secureMemZero(&expected_session_key);
+
+        std::scoped_lock<std::mutex> lock(verification_->lock);
+
+        if (verification_->receiver)
+        {
+            QCoreApplication::postEvent(verification_->receiver,
+                                        new VerificationEvent(is_valid_session_key));
+        }
+    }
+
+private:
+    const std::shared_ptr<Verification> verification_;
+
+    Q_DISABLE_COPY(VerificationTask)
+};
+
 HostUserAuthorizer::HostUserAuthorizer(QObject* parent)
     : QObject(parent)
 {
@@ -56,15 +201,51 @@ HostUserAuthorizer::HostUserAuthorizer(QObject* parent)
 
 HostUserAuthorizer::~HostUserAuthorizer()
 {
+    if (verification_)
+    {
+        std::scoped_lock<std::mutex> lock(verification_->lock);
+        verification_->receiver = nullptr;
+    }
+
     stop();
 
     secureMemZero(&user_name_);
+    secureMemZero(&logon_user_name_);
     secureMemZero(&nonce_);
+    secureMemZero(&resume_ticket_);
+    secureMemZero(&resumed_ticket_);
+    secureMemZero(&unknown_user_key_);
+}
+
+// static
+HostUserAuthorizer::UserIndex HostUserAuthorizer::createUserIndex(const QList<User>& user_list)
+{
+    UserIndex user_index;
+
+    for (const auto& user : user_list)
+        user_index.insert(user.name().toLower(), user);
+
+    return user_index;
+}
+
+void HostUserAuthorizer::setUserIndex(const UserIndex& user_index)
+{
+    user_index_ = user_index;
 }
 
-void HostUserAuthorizer::setUserList(const QList<User>& user_list)
+void HostUserAuthorizer::setUnknownUserKey(const QByteArray& unknown_user_key)
 {
-    user_list_ = user_list;
+    unknown_user_key_ = unknown_user_key;
+}
+
+void HostUserAuthorizer::setResumableSessions(const QList<ResumableSession>& sessions)
+{
+    resumable_sessions_ = sessions;
+}
+
+void HostUserAuthorizer::setNewSessionsAllowed(bool allowed)
+{
+    new_sessions_allowed_ = allowed;
 }
 
 void HostUserAuthorizer::setNetworkChannel(NetworkChannel* network_channel)
@@ -72,6 +253,11 @@ void HostUserAuthorizer::setNetworkChannel(NetworkChannel* network_channel)
     network_channel_ = network_channel;
 }
 
+void HostUserAuthorizer::setThreadPool(QThreadPool* thread_pool)
+{
+    thread_pool_ = thread_pool;
+}
+
 void HostUserAuthorizer::start()
 {
     if (state_ != NotStarted)
@@ -80,9 +266,10 @@ void HostUserAuthorizer::start()
         return;
     }
 
-    if (user_list_.isEmpty() || network_channel_.isNull())
+    if (user_index_.isEmpty() || unknown_user_key_.isEmpty() || network_channel_.isNull() ||
+        !thread_pool_)
     {
-        qWarning("Empty user list or invalid network channel");
+        qWarning("Empty user list or key, invalid network channel or thread pool");
         stop();
         return;
     }
@@ -148,6 +335,22 @@ void HostUserAuthorizer::timerEvent(QTimerEvent* event)
     stop();
 }
 
+void HostUserAuthorizer::customEvent(QEvent* event)
+{
+    if (event->type() != VerificationEvent::kType)
+        return;
+
+    verification_.reset();
+
+    if (state_ == Finished)
+        return;
+
+    status_ = finishBasicAuthorization(
+        static_cast<VerificationEvent*>(event)->is_valid_session_key);
+
+    writeLogonResult(status_);
+}
+
 void HostUserAuthorizer::messageWritten(int message_id)
 {
     if (state_ == Finished)
@@ -202,7 +405,15 @@ void HostUserAuthorizer::messageReceived(const QByteArray& buffer)
         }
         else if (message.has_client_challenge())
         {
-            readClientChallenge(message.client_challenge());
+            if (skip_client_challenge_)
+            {
+                skip_client_challenge_ = false;
+                emit readMessage();
+            }
+            else
+            {
+                readClientChallenge(message.client_challenge());
+            }
 
             secureMemZero(message.mutable_client_challenge()->mutable_username());
             secureMemZero(message.mutable_client_challenge()->mutable_session_key());
@@ -227,6 +438,21 @@ void HostUserAuthorizer::readLogonRequest(const proto::auth::LogonRequest& logon
 
     method_ = logon_request.method();
 
+    if (!logon_request.resume_ticket().empty())
+    {
+        status_ = doResumeAuthorization(QByteArray::fromStdString(logon_request.resume_ticket()));
+        writeLogonResult(status_);
+        return;
+    }
+
+    if (!new_sessions_allowed_)
+    {
+        qWarning("The limit of the sessions is reached");
+        status_ = proto::auth::STATUS_ACCESS_DENIED;
+        writeLogonResult(status_);
+        return;
+    }
+
     nonce_ = generateNonce();
     if (nonce_.isEmpty())
     {
@@ -235,7 +461,51 @@ void HostUserAuthorizer::readLogonRequest(const proto::auth::LogonRequest& logon
         return;
     }
 
-    writeServerChallenge(nonce_);
+    proto::auth::ServerChallenge server_challenge;
+
+    // The clients of the previous versions do not send the user name and use the legacy hashes.
+    logon_user_name_ = QString::fromStdString(logon_request.username());
+    if (!logon_user_name_.isEmpty())
+    {
+        const User* user = findUser(logon_user_name_);
+
+        if (!user)
+        {
+            server_challenge =
+                unknownUserChallenge(logon_user_name_, unknown_user_key_, user_index_);
+        }
+        else if (!user->passwordSalt().isEmpty())
+        {
+            const QByteArray& salt = user->passwordSalt();
+
+            server_challenge.set_password_hashing(proto::auth::PASSWORD_HASHING_ARGON2ID);
+            server_challenge.set_password_salt(salt.constData(), salt.size());
+            server_challenge.set_ops_limit(user->opsLimit());
+            server_challenge.set_mem_limit(user->memLimit());
+        }
+    }
+
+    server_challenge.set_nonce(nonce_.constData(), nonce_.size());
+    password_hashing_ = server_challenge.password_hashing();
+
+    // The client which knows the parameters of the hash sends the session key for the nonce of
+    // the channel without waiting for the challenge.
+    if (logon_request.has_expected_challenge())
+    {
+        const QByteArray channel_nonce = network_channel_->challengeNonce();
+
+        if (!channel_nonce.isEmpty() &&
+            isSameChallenge(logon_request.expected_challenge(), server_challenge))
+        {
+            nonce_ = channel_nonce;
+            emit readMessage();
+            return;
+        }
+
+        skip_client_challenge_ = true;
+    }
+
+    writeServerChallenge(server_challenge);
 }
 
 void HostUserAuthorizer::readClientChallenge(const proto::auth::ClientChallenge& client_challenge)
@@ -251,16 +521,20 @@ void HostUserAuthorizer::readClientChallenge(const proto::auth::ClientChallenge&
     user_name_ = QString::fromStdString(client_challenge.username());
     session_type_ = client_challenge.session_type();
 
-    status_ = doBasicAuthorization(user_name_, session_key, session_type_);
-
+    status_ = doBasicAuthorization(user_name_, session_key);
     secureMemZero(&session_key);
+
+    // The result is written when the session key is verified.
+    if (status_ == proto::auth::STATUS_UNKNOWN)
+        return;
+
     writeLogonResult(status_);
 }
 
-void HostUserAuthorizer::writeServerChallenge(const QByteArray& nonce)
+void HostUserAuthorizer::writeServerChallenge(const proto::auth::ServerChallenge& server_challenge)
 {
     proto::auth::HostToClient message;
-    message.mutable_server_challenge()->set_nonce(nonce.constData(), nonce.size());
+    message.mutable_server_challenge()->CopyFrom(server_challenge);
     emit writeMessage(ServerChallenge, serializeMessage(message));
 }
 
@@ -268,11 +542,29 @@ void HostUserAuthorizer::writeLogonResult(proto::auth::Status status)
 {
     proto::auth::HostToClient message;
     message.mutable_logon_result()->set_status(status);
+
+    if (status == proto::auth::STATUS_SUCCESS && isResumableSession(session_type_))
+    {
+        resume_ticket_ = Random::generateBuffer(kResumeTicketSize);
+
+        message.mutable_logon_result()->set_resume_ticket(
+            resume_ticket_.constData(), resume_ticket_.size());
+    }
+
+    // The client sends the config while the session is being started.
+    if (status == proto::auth::STATUS_SUCCESS && resumed_ticket_.isEmpty() &&
+        (session_type_ == proto::auth::SESSION_TYPE_DESKTOP_MANAGE ||
+         session_type_ == proto::auth::SESSION_TYPE_DESKTOP_VIEW))
+    {
+        message.mutable_logon_result()->set_config_request(
+            HostSessionDesktop::configRequest(session_type_).SerializeAsString());
+    }
+
     emit writeMessage(LogonResult, serializeMessage(message));
 }
 
-proto::auth::Status HostUserAuthorizer::doBasicAuthorization(
-    const QString& user_name, const QByteArray& session_key, proto::auth::SessionType session_type)
+proto::auth::Status HostUserAuthorizer::doBasicAuthorization(const QString& user_name,
+                                                             const QByteArray& session_key)
 {
     if (!User::isValidName(user_name))
     {
@@ -286,35 +578,118 @@ proto::auth::Status HostUserAuthorizer::doBasicAuthorization(
         return proto::auth::STATUS_ACCESS_DENIED;
     }
 
-    for (const auto& user : user_list_)
+    QByteArray password_hash;
+
+    const User* user = findUser(user_name);
+    if (!user)
     {
-        if (user.name().compare(user_name, Qt::CaseInsensitive) == 0)
-        {
-            if (createSessionKey(user.passwordHash(), nonce_) != session_key)
-            {
-                qWarning() << "Wrong password for user " << user_name;
-                return proto::auth::STATUS_ACCESS_DENIED;
-            }
+        // The session key is verified with a random hash, so the time of the answer does not
+        // show that the user does not exist.
+        qWarning() << "User not found: " << user_name;
+        password_hash = Random::generateBuffer(PasswordHash::kHashSize);
+    }
+    else if (password_hashing_ == proto::auth::PASSWORD_HASHING_ARGON2ID)
+    {
+        // The salt was sent for the user of the logon request.
+        if (user_name.compare(logon_user_name_, Qt::CaseInsensitive) != 0)
+            return finishBasicAuthorization(false);
 
-            if (!(user.flags() & User::FLAG_ENABLED))
-            {
-                qWarning() << "User " << user_name << " is disabled";
-                return proto::auth::STATUS_ACCESS_DENIED;
-            }
+        password_hash = user->passwordHash();
+    }
+    else if (!user->passwordSalt().isEmpty())
+    {
+        return finishBasicAuthorization(false);
+    }
+    else
+    {
+        password_hash = user->passwordHash();
+    }
 
-            if (!(user.sessions() & session_type))
-            {
-                qWarning() << "Session type " << session_type
-                           << " is disabled for user " << user_name;
-                return proto::auth::STATUS_ACCESS_DENIED;
-            }
+    std::shared_ptr<Verification> verification = std::make_shared<Verification>();
+
+    verification->receiver = this;
+    verification->password_hashing = password_hashing_;
+    verification->password_hash = password_hash;
+
+    secureMemZero(&password_hash);
+    verification->nonce = nonce_;
+    verification->session_key = session_key;
 
-            return proto::auth::STATUS_SUCCESS;
+    // The hashes of the previous versions take a noticeable time, so the other connections
+    // are not blocked by them.
+    verification_ = verification;
+    thread_pool_->start(new VerificationTask(std::move(verification)));
+
+    return proto::auth::STATUS_UNKNOWN;
+}
+
+proto::auth::Status HostUserAuthorizer::finishBasicAuthorization(bool is_valid_session_key)
+{
+    if (!is_valid_session_key)
+    {
+        qWarning() << "Wrong password for user " << user_name_;
+        return proto::auth::STATUS_ACCESS_DENIED;
+    }
+
+    // The users which do not exist are verified with the random hashes.
+    const User* user = findUser(user_name_);
+    if (!user)
+        return proto::auth::STATUS_ACCESS_DENIED;
+
+    if (!(user->flags() & User::FLAG_ENABLED))
+    {
+        qWarning() << "User " << user_name_ << " is disabled";
+        return proto::auth::STATUS_ACCESS_DENIED;
+    }
+
+    if (!(user->sessions() & session_type_))
+    {
+        qWarning() << "Session type " << session_type_
+                   << " is disabled for user " << user_name_;
+        return proto::auth::STATUS_ACCESS_DENIED;
+    }
+
+    return proto::auth::STATUS_SUCCESS;
+}
+
+proto::auth::Status HostUserAuthorizer::doResumeAuthorization(const QByteArray& resume_ticket)
+{
+    for (const auto& session : resumable_sessions_)
+    {
+        if (session.resume_ticket.size() != resume_ticket.size() ||
+            sodium_memcmp(session.resume_ticket.constData(), resume_ticket.constData(),
+                          resume_ticket.size()) != 0)
+        {
+            continue;
         }
+
+        // The user may be changed since the session was started.
+        const User* user = findUser(session.user_name);
+        if (!user || !(user->flags() & User::FLAG_ENABLED) ||
+            !(user->sessions() & session.session_type))
+        {
+            qWarning() << "Session can not be resumed for user " << session.user_name;
+            return proto::auth::STATUS_ACCESS_DENIED;
+        }
+
+        user_name_ = session.user_name;
+        session_type_ = session.session_type;
+        resumed_ticket_ = resume_ticket;
+
+        return proto::auth::STATUS_SUCCESS;
     }
 
-    qWarning() << "User not found: " << user_name;
+    qWarning("Unknown resume ticket");
     return proto::auth::STATUS_ACCESS_DENIED;
 }
 
+const User* HostUserAuthorizer::findUser(const QString& user_name) const
+{
+    auto user = user_index_.constFind(user_name.toLower());
+    if (user == user_index_.constEnd())
+        return nullptr;
+
+    return &user.value();
+}
+
 } // namespace aspia
@@ -8,14 +8,20 @@
 #ifndef _ASPIA_HOST__HOST_USER_AUTHORIZER_H
 #define _ASPIA_HOST__HOST_USER_AUTHORIZER_H
 
+#include <QHash>
 #include <QPointer>
 
+#include <memory>
+
+#include "base/message_class.h"
+#include "base/message_priority.h"
 #include "host/user.h"
 #include "protocol/authorization.pb.h"
 
 namespace aspia {
 
 class NetworkChannel;
+class QThreadPool;
 
 class HostUserAuthorizer : public QObject
 {
@@ -27,26 +33,63 @@ public:
     HostUserAuthorizer(QObject* parent = nullptr);
     ~HostUserAuthorizer();
 
-    void setUserList(const QList<User>& user_list);
+    // The running session which the client may resume by the ticket of its connection.
+    struct ResumableSession
+    {
+        QByteArray resume_ticket;
+        QString user_name;
+        proto::auth::SessionType session_type;
+    };
+
+    // The users by the names in lower case. The index is built once by the server and is
+    // shared by the authorizers of all connections.
+    using UserIndex = QHash<QString, User>;
+    static UserIndex createUserIndex(const QList<User>& user_list);
+
+    void setUserIndex(const UserIndex& user_index);
+
+    // The secret key from which the salts of the users who do not exist are created.
+    void setUnknownUserKey(const QByteArray& unknown_user_key);
+
+    void setResumableSessions(const QList<ResumableSession>& sessions);
+
+    // If the limit of the sessions is reached, then only the running sessions may be resumed.
+    void setNewSessionsAllowed(bool allowed);
     void setNetworkChannel(NetworkChannel* network_channel);
 
+    // The session keys are verified by |thread_pool|, so the slow hashes of the previous
+    // versions do not block the other connections.
+    void setThreadPool(QThreadPool* thread_pool);
+
     NetworkChannel* networkChannel() { return network_channel_; }
     proto::auth::Status status() const { return status_; }
     proto::auth::SessionType sessionType() const { return session_type_; }
     QString userName() const { return user_name_; }
 
+    // The ticket issued to the client for the resumption of the session. Empty if the session
+    // can not be resumed.
+    const QByteArray& resumeTicket() const { return resume_ticket_; }
+
+    // The ticket of the session which is resumed by the client. Empty if a new session must be
+    // started.
+    const QByteArray& resumedTicket() const { return resumed_ticket_; }
+
 public slots:
     void start();
     void stop();
 
 signals:
     void finished(HostUserAuthorizer* authorizer);
-    void writeMessage(int message_id, const QByteArray& buffer);
+    void writeMessage(int message_id,
+                      const QByteArray& buffer,
+                      MessagePriority priority = NormalPriority,
+                      MessageClass message_class = GenericMessage);
     void readMessage();
 
 protected:
     // QObject implementation.
     void timerEvent(QTimerEvent* event) override;
+    void customEvent(QEvent* event) override;
 
 private slots:
     void messageWritten(int message_id);
@@ -55,23 +98,42 @@ private slots:
 private:
     void readLogonRequest(const proto::auth::LogonRequest& logon_request);
     void readClientChallenge(const proto::auth::ClientChallenge& client_challenge);
-    void writeServerChallenge(const QByteArray& nonce);
+    void writeServerChallenge(const proto::auth::ServerChallenge& server_challenge);
     void writeLogonResult(proto::auth::Status status);
 
+    // Returns STATUS_UNKNOWN if the session key is being verified by the thread pool.
     proto::auth::Status doBasicAuthorization(const QString& user_name,
-                                             const QByteArray& session_key,
-                                             proto::auth::SessionType session_type);
+                                             const QByteArray& session_key);
+    proto::auth::Status finishBasicAuthorization(bool is_valid_session_key);
+    proto::auth::Status doResumeAuthorization(const QByteArray& resume_ticket);
+    const User* findUser(const QString& user_name) const;
 
     State state_ = NotStarted;
 
-    QList<User> user_list_;
+    struct Verification;
+    class VerificationTask;
+
+    UserIndex user_index_;
+    QByteArray unknown_user_key_;
+    QList<ResumableSession> resumable_sessions_;
     QPointer<NetworkChannel> network_channel_;
+    QThreadPool* thread_pool_ = nullptr;
+    std::shared_ptr<Verification> verification_;
 
     QString user_name_;
+    QString logon_user_name_;
     QByteArray nonce_;
+    QByteArray resume_ticket_;
+    QByteArray resumed_ticket_;
     int timer_id_ = 0;
+    bool new_sessions_allowed_ = true;
+
+    // The client challenge which follows the logon request was created for the parameters
+    // which are not valid anymore.
+    bool skip_client_challenge_ = false;
 
     proto::auth::Method method_ = proto::auth::METHOD_UNKNOWN;
+    proto::auth::PasswordHashing password_hashing_ = proto::auth::PASSWORD_HASHING_SHA512;
     proto::auth::SessionType session_type_ = proto::auth::SESSION_TYPE_UNKNOWN;
     proto::auth::Status status_ = proto::auth::STATUS_ACCESS_DENIED;
 
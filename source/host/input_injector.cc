@@ -10,7 +10,10 @@
 #include <QRect>
 #include <QSettings>
 
+#include <algorithm>
+#include <iterator>
 #include <set>
+#include <vector>
 
 #define WIN32_LEAN_AND_MEAN
 #include <windows.h>
@@ -19,6 +22,7 @@
 #include "base/errno_logging.h"
 #include "base/keycode_converter.h"
 #include "desktop_capture/win/scoped_thread_desktop.h"
+#include "host/win/scoped_thread_role.h"
 
 namespace aspia {
 
@@ -35,7 +39,7 @@ const quint32 kUsbCodeRightCtrl = 0x0700e4;
 const quint32 kUsbCodeLeftAlt = 0x0700e2;
 const quint32 kUsbCodeRightAlt = 0x0700e6;
 
-void sendKeyboardScancode(WORD scancode, DWORD flags)
+INPUT keyboardScancodeInput(WORD scancode, DWORD flags)
 {
     INPUT input;
     memset(&input, 0, sizeof(input));
@@ -52,12 +56,10 @@ void sendKeyboardScancode(WORD scancode, DWORD flags)
             input.ki.dwFlags |= KEYEVENTF_EXTENDEDKEY;
     }
 
-    // Do the keyboard event.
-    if (!SendInput(1, &input, sizeof(input)))
-        qWarningErrno("SendInput failed");
+    return input;
 }
 
-void sendKeyboardVirtualKey(WORD key_code, DWORD flags)
+INPUT keyboardVirtualKeyInput(WORD key_code, DWORD flags)
 {
     INPUT input;
     memset(&input, 0, sizeof(input));
@@ -67,20 +69,37 @@ void sendKeyboardVirtualKey(WORD key_code, DWORD flags)
     input.ki.dwFlags = flags;
     input.ki.wScan   = static_cast<WORD>(MapVirtualKeyW(key_code, MAPVK_VK_TO_VSC));
 
+    return input;
+}
+
+void sendKeyboardScancode(WORD scancode, DWORD flags)
+{
+    INPUT input = keyboardScancodeInput(scancode, flags);
+
     // Do the keyboard event.
     if (!SendInput(1, &input, sizeof(input)))
         qWarningErrno("SendInput failed");
 }
 
+//
+// The events taken from the queue at once are collected and injected by one SendInput call,
+// so that a burst of input is not injected event by event.
+//
 class InputInjectorImpl
 {
 public:
     InputInjectorImpl() = default;
     ~InputInjectorImpl();
 
+    // Must be called before the events of the batch.
+    void beginBatch();
+
     void injectPointerEvent(const proto::desktop::PointerEvent& event);
     void injectKeyEvent(const proto::desktop::KeyEvent& event);
 
+    // Injects the collected events.
+    void flush();
+
 private:
     void switchToInputDesktop();
     bool isCtrlAndAltPressed();
@@ -90,6 +109,14 @@ private:
     QPoint prev_mouse_pos_;
     quint32 prev_mouse_button_mask_ = 0;
 
+    std::vector<INPUT> batch_;
+    QRect screen_rect_;
+
+    // The lock states after the collected events. GetKeyState() does not know about the events
+    // which are not injected yet.
+    bool caps_lock_ = false;
+    bool num_lock_ = false;
+
     Q_DISABLE_COPY(InputInjectorImpl)
 };
 
@@ -106,20 +133,41 @@ InputInjectorImpl::~InputInjectorImpl()
     }
 }
 
-void InputInjectorImpl::injectPointerEvent(const proto::desktop::PointerEvent& event)
+void InputInjectorImpl::beginBatch()
 {
     switchToInputDesktop();
 
-    QRect screen_rect = QRect(GetSystemMetrics(SM_XVIRTUALSCREEN),
-                              GetSystemMetrics(SM_YVIRTUALSCREEN),
-                              GetSystemMetrics(SM_CXVIRTUALSCREEN),
-                              GetSystemMetrics(SM_CYVIRTUALSCREEN));
-    if (!screen_rect.contains(event.x(), event.y()))
+    screen_rect_ = QRect(GetSystemMetrics(SM_XVIRTUALSCREEN),
+                         GetSystemMetrics(SM_YVIRTUALSCREEN),
+                         GetSystemMetrics(SM_CXVIRTUALSCREEN),
+                         GetSystemMetrics(SM_CYVIRTUALSCREEN));
+
+    caps_lock_ = GetKeyState(VK_CAPITAL) != 0;
+    num_lock_ = GetKeyState(VK_NUMLOCK) != 0;
+}
+
+void InputInjectorImpl::flush()
+{
+    if (batch_.empty())
+        return;
+
+    const UINT count = static_cast<UINT>(batch_.size());
+
+    // Fewer events are inserted if the input is blocked by UIPI or by another thread.
+    if (SendInput(count, batch_.data(), sizeof(INPUT)) != count)
+        qWarningErrno("SendInput failed");
+
+    batch_.clear();
+}
+
+void InputInjectorImpl::injectPointerEvent(const proto::desktop::PointerEvent& event)
+{
+    if (!screen_rect_.contains(event.x(), event.y()))
         return;
 
     // Translate the coordinates of the cursor into the coordinates of the virtual screen.
-    QPoint pos(((event.x() - screen_rect.x()) * 65535) / (screen_rect.width() - 1),
-        ((event.y() - screen_rect.y()) * 65535) / (screen_rect.height() - 1));
+    QPoint pos(((event.x() - screen_rect_.x()) * 65535) / (screen_rect_.width() - 1),
+        ((event.y() - screen_rect_.y()) * 65535) / (screen_rect_.height() - 1));
 
     DWORD flags = MOUSEEVENTF_ABSOLUTE | MOUSEEVENTF_VIRTUALDESK;
     DWORD wheel_movement = 0;
@@ -176,9 +224,7 @@ void InputInjectorImpl::injectPointerEvent(const proto::desktop::PointerEvent& e
     input.mi.mouseData = wheel_movement;
     input.mi.dwFlags   = flags;
 
-    // Do the mouse event.
-    if (!SendInput(1, &input, sizeof(input)))
-        qWarningErrno("SendInput failed");
+    batch_.push_back(input);
 
     prev_mouse_button_mask_ = mask;
 }
@@ -196,6 +242,9 @@ void InputInjectorImpl::injectKeyEvent(const proto::desktop::KeyEvent& event)
             static const int kNone = 0;
             static const int kApplications = 2;
 
+            // The previous events must reach the system before the SAS.
+            flush();
+
             int old_state = settings.value(kSoftwareSASGeneration, kNone).toInt();
             if (old_state < kApplications)
                 settings.setValue(kSoftwareSASGeneration, kApplications);
@@ -214,24 +263,22 @@ void InputInjectorImpl::injectKeyEvent(const proto::desktop::KeyEvent& event)
     if (scancode == KeycodeConverter::invalidNativeKeycode())
         return;
 
-    switchToInputDesktop();
-
-    bool prev_state = GetKeyState(VK_CAPITAL) != 0;
     bool curr_state = (event.flags() & proto::desktop::KeyEvent::CAPSLOCK) != 0;
 
-    if (prev_state != curr_state)
+    if (caps_lock_ != curr_state)
     {
-        sendKeyboardVirtualKey(VK_CAPITAL, 0);
-        sendKeyboardVirtualKey(VK_CAPITAL, KEYEVENTF_KEYUP);
+        batch_.push_back(keyboardVirtualKeyInput(VK_CAPITAL, 0));
+        batch_.push_back(keyboardVirtualKeyInput(VK_CAPITAL, KEYEVENTF_KEYUP));
+        caps_lock_ = curr_state;
     }
 
-    prev_state = GetKeyState(VK_NUMLOCK) != 0;
     curr_state = (event.flags() & proto::desktop::KeyEvent::NUMLOCK) != 0;
 
-    if (prev_state != curr_state)
+    if (num_lock_ != curr_state)
     {
-        sendKeyboardVirtualKey(VK_NUMLOCK, 0);
-        sendKeyboardVirtualKey(VK_NUMLOCK, KEYEVENTF_KEYUP);
+        batch_.push_back(keyboardVirtualKeyInput(VK_NUMLOCK, 0));
+        batch_.push_back(keyboardVirtualKeyInput(VK_NUMLOCK, KEYEVENTF_KEYUP));
+        num_lock_ = curr_state;
     }
 
     DWORD flags = KEYEVENTF_SCANCODE;
@@ -239,7 +286,7 @@ void InputInjectorImpl::injectKeyEvent(const proto::desktop::KeyEvent& event)
     if (!(event.flags() & proto::desktop::KeyEvent::PRESSED))
         flags |= KEYEVENTF_KEYUP;
 
-    sendKeyboardScancode(static_cast<WORD>(scancode), flags);
+    batch_.push_back(keyboardScancodeInput(static_cast<WORD>(scancode), flags));
 }
 
 void InputInjectorImpl::switchToInputDesktop()
@@ -273,74 +320,152 @@ bool InputInjectorImpl::isCtrlAndAltPressed()
     return ctrl_pressed && alt_pressed;
 }
 
+// The injection thread is blocked only by the secure desktop or by the hooks of the other
+// processes. The events which arrive in the meantime are kept up to this number.
+constexpr size_t kInputQueueSize = 4096;
+
 } // namespace
 
 InputInjector::InputInjector(QObject* parent)
-    : QThread(parent)
+    : QThread(parent),
+      input_queue_(kInputQueueSize)
 {
     start(QThread::HighPriority);
 }
 
 InputInjector::~InputInjector()
 {
-    {
-        std::scoped_lock<std::mutex> lock(input_queue_lock_);
-        terminate_ = true;
-        input_event_.notify_one();
-    }
+    terminate_.store(true);
+    wakeup_.wake();
 
     wait();
 }
 
 void InputInjector::injectPointerEvent(const proto::desktop::PointerEvent& event)
 {
-    std::scoped_lock<std::mutex> lock(input_queue_lock_);
-    incoming_input_queue_.emplace(event);
-    input_event_.notify_one();
+    addEvent(event);
+    commitEvents();
 }
 
 void InputInjector::injectKeyEvent(const proto::desktop::KeyEvent& event)
 {
-    std::scoped_lock<std::mutex> lock(input_queue_lock_);
-    incoming_input_queue_.emplace(event);
-    input_event_.notify_one();
+    addEvent(event);
+    commitEvents();
+}
+
+void InputInjector::injectInputEvents(const proto::desktop::InputEvents& events)
+{
+    // The whole message is taken by the injection thread at once.
+    for (const auto& event : events.event())
+    {
+        if (event.has_pointer_event())
+            addEvent(event.pointer_event());
+        else if (event.has_key_event())
+            addEvent(event.key_event());
+    }
+
+    commitEvents();
+}
+
+void InputInjector::addEvent(InputEvent&& event)
+{
+    // The events are injected in the order in which they are added.
+    if (staged_overflow_.empty() && overflow_events_.load() == 0 &&
+        input_queue_.stage(std::move(event)))
+    {
+        return;
+    }
+
+    staged_overflow_.push_back(std::move(event));
+}
+
+void InputInjector::commitEvents()
+{
+    // The events of the queue are added before the overflow ones.
+    input_queue_.commit();
+
+    if (!staged_overflow_.empty())
+    {
+        qWarning("The input queue is full, %d events wait in the overflow list",
+                 static_cast<int>(staged_overflow_.size()));
+
+        std::scoped_lock<std::mutex> lock(overflow_lock_);
+
+        std::move(staged_overflow_.begin(), staged_overflow_.end(),
+                  std::back_inserter(overflow_));
+        overflow_events_.store(static_cast<int>(overflow_.size()));
+        staged_overflow_.clear();
+    }
+
+    wakeup_.wake();
+}
+
+bool InputInjector::takeOverflowEvents(std::vector<InputEvent>* events)
+{
+    std::scoped_lock<std::mutex> lock(overflow_lock_);
+
+    // The events which are committed to the queue before the overflow ones are taken first.
+    if (overflow_.empty() || !input_queue_.empty())
+        return false;
+
+    events->swap(overflow_);
+    overflow_events_.store(0);
+    return true;
 }
 
 void InputInjector::run()
 {
+    ScopedThreadRole thread_role(ScopedThreadRole::Role::INPUT);
     InputInjectorImpl impl;
 
-    while (true)
-    {
-        std::queue<InputEvent> work_input_queue;
+    InputEvent input_event;
+    std::vector<InputEvent> overflow_events;
 
+    auto inject_event = [&impl](const InputEvent& event)
+    {
+        if (std::holds_alternative<proto::desktop::KeyEvent>(event))
         {
-            std::unique_lock<std::mutex> lock(input_queue_lock_);
+            impl.injectKeyEvent(std::get<proto::desktop::KeyEvent>(event));
+        }
+        else if (std::holds_alternative<proto::desktop::PointerEvent>(event))
+        {
+            impl.injectPointerEvent(std::get<proto::desktop::PointerEvent>(event));
+        }
+    };
 
-            while (incoming_input_queue_.empty() && !terminate_)
-                input_event_.wait(lock);
+    while (true)
+    {
+        wakeup_.wait([this]()
+        {
+            return !input_queue_.empty() || overflow_events_.load() || terminate_.load();
+        });
 
-            if (terminate_)
-                return;
+        if (terminate_.load())
+            return;
 
-            work_input_queue.swap(incoming_input_queue_);
-        }
+        impl.beginBatch();
 
-        while (!work_input_queue.empty())
+        // The events which are committed while the batch is collected join it.
+        for (;;)
         {
-            const InputEvent& input_event = work_input_queue.front();
+            while (input_queue_.tryPop(&input_event))
+                inject_event(input_event);
 
-            if (std::holds_alternative<proto::desktop::KeyEvent>(input_event))
+            if (!takeOverflowEvents(&overflow_events))
             {
-                impl.injectKeyEvent(std::get<proto::desktop::KeyEvent>(input_event));
-            }
-            else if (std::holds_alternative<proto::desktop::PointerEvent>(input_event))
-            {
-                impl.injectPointerEvent(std::get<proto::desktop::PointerEvent>(input_event));
+                if (input_queue_.empty())
+                    break;
+
+                continue;
             }
 
-            work_input_queue.pop();
+            for (const auto& event : overflow_events)
+                inject_event(event);
+
+            overflow_events.clear();
         }
+
+        impl.flush();
     }
 }
 
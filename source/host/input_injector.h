@@ -10,11 +10,13 @@
 
 #include <QThread>
 
-#include <condition_variable>
-#include <queue>
+#include <atomic>
 #include <mutex>
 #include <variant>
+#include <vector>
 
+#include "base/spsc_queue.h"
+#include "base/thread_wakeup.h"
 #include "protocol/desktop_session.pb.h"
 
 namespace aspia {
@@ -30,6 +32,9 @@ public:
     void injectPointerEvent(const proto::desktop::PointerEvent& event);
     void injectKeyEvent(const proto::desktop::KeyEvent& event);
 
+    // The events of the message are injected in order by one call of SendInput.
+    void injectInputEvents(const proto::desktop::InputEvents& events);
+
 protected:
     // QThread implementation.
     void run() override;
@@ -37,10 +42,26 @@ protected:
 private:
     using InputEvent = std::variant<proto::desktop::PointerEvent, proto::desktop::KeyEvent>;
 
-    std::condition_variable input_event_;
-    std::mutex input_queue_lock_;
-    std::queue<InputEvent> incoming_input_queue_;
-    bool terminate_ = false;
+    // The events are passed by the lock-free queue from the thread of the session. The events
+    // of one message become visible to the injection thread together.
+    void addEvent(InputEvent&& event);
+    void commitEvents();
+
+    // Called by the injection thread. Takes the events of the overflow list if the queue is
+    // empty. Returns false if there are no such events.
+    bool takeOverflowEvents(std::vector<InputEvent>* events);
+
+    SpscQueue<InputEvent> input_queue_;
+    ThreadWakeup wakeup_;
+    std::atomic<bool> terminate_ { false };
+
+    // The events which do not fit into the queue are never dropped, because a lost release of
+    // a key or a button leaves it pressed. They wait in the overflow list, and the next events
+    // follow them there until the injection thread takes the list.
+    std::vector<InputEvent> staged_overflow_;
+    std::mutex overflow_lock_;
+    std::vector<InputEvent> overflow_;
+    std::atomic<int> overflow_events_ { 0 };
 
     Q_DISABLE_COPY(InputInjector)
 };
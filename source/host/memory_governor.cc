@@ -0,0 +1,99 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/memory_governor.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "host/memory_governor.h"
+
+#include <QDebug>
+
+#include "base/buffer_pool.h"
+#include "base/memory_counters.h"
+
+namespace aspia {
+
+namespace {
+
+// The memory is measured with this interval.
+constexpr std::chrono::seconds kSampleInterval(2);
+
+// The number of the samples with the headroom after which the level is lowered.
+constexpr int kIdleSamples = 5;
+
+// The part of the budget (in percent) which the process may use after the level is lowered.
+constexpr qint64 kIdleBudgetPercent = 75;
+
+} // namespace
+
+MemoryGovernor::MemoryGovernor(qint64 budget)
+    : budget_(qMax(budget, qint64(1)))
+{
+    // Nothing
+}
+
+// static
+int MemoryGovernor::frameDivisor(int level)
+{
+    return (level <= 1) ? 1 : (1 << (qMin(level, kMaxLevel) - 1));
+}
+
+bool MemoryGovernor::update()
+{
+    const Clock::time_point now = Clock::now();
+
+    if (sampled_ && now - sample_time_ < kSampleInterval)
+        return false;
+
+    sample_time_ = now;
+    sampled_ = true;
+
+    const qint64 memory = MemoryCounters::processMemory();
+    if (memory < 0)
+        return false;
+
+    const int previous_level = level_;
+
+    if (memory > budget_)
+    {
+        idle_samples_ = 0;
+
+        // The cached buffers are freed on each sample above the budget, the frames of another
+        // size may have been returned into the pool since the previous one.
+        BufferPool::instance()->clear();
+        level_ = qMin(kMaxLevel, level_ + 1);
+    }
+    else if (level_ > 0)
+    {
+        // The frames of the previous level are 4 times larger.
+        const qint64 frames = MemoryCounters::value(MemoryCounters::FrameMemory);
+        const qint64 expected_memory = (frameDivisor(level_) > 1) ? memory + frames * 3 : memory;
+
+        if (expected_memory * 100 < budget_ * kIdleBudgetPercent)
+        {
+            if (++idle_samples_ >= kIdleSamples)
+            {
+                idle_samples_ = 0;
+                --level_;
+            }
+        }
+        else
+        {
+            idle_samples_ = 0;
+        }
+    }
+
+    if (level_ == previous_level)
+        return false;
+
+    qInfo() << "Memory degradation level:" << level_ << "process:" << memory
+            << "frames:" << MemoryCounters::value(MemoryCounters::FrameMemory)
+            << "differ:" << MemoryCounters::value(MemoryCounters::DifferMemory)
+            << "encoder:" << MemoryCounters::value(MemoryCounters::EncoderMemory)
+            << "queues:" << MemoryCounters::value(MemoryCounters::QueueMemory)
+            << "caches:" << MemoryCounters::value(MemoryCounters::CacheMemory);
+    return true;
+}
+
+} // namespace aspia
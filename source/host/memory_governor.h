@@ -0,0 +1,58 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/memory_governor.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_HOST__MEMORY_GOVERNOR_H
+#define _ASPIA_HOST__MEMORY_GOVERNOR_H
+
+#include <QtGlobal>
+
+#include <chrono>
+
+namespace aspia {
+
+//
+// Keeps the private memory of the session process within its budget. While the process uses
+// more than the budget, the level of the degradation is raised: the cached buffers are freed
+// first, then each level halves the size of the frames. The level is lowered only after
+// several samples in which the process would stay well within the budget with the larger
+// frames, so it does not oscillate.
+//
+class MemoryGovernor
+{
+public:
+    static const int kMaxLevel = 3;
+
+    // |budget| is the private memory (in bytes) which the process may use.
+    explicit MemoryGovernor(qint64 budget);
+    ~MemoryGovernor() = default;
+
+    // Must be called periodically. Returns true if the level is changed.
+    bool update();
+
+    int level() const { return level_; }
+
+    // Returns the divisor of the width and the height of the frames for |level|.
+    static int frameDivisor(int level);
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    const qint64 budget_;
+    int level_ = 0;
+
+    Clock::time_point sample_time_;
+    bool sampled_ = false;
+
+    // The number of the last samples with the headroom.
+    int idle_samples_ = 0;
+
+    Q_DISABLE_COPY(MemoryGovernor)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_HOST__MEMORY_GOVERNOR_H
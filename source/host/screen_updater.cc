@@ -9,62 +9,1774 @@
 
 #include <QCoreApplication>
 #include <QDebug>
+#include <QRunnable>
+#include <QThreadPool>
 
+#include <libyuv/scale_argb.h>
+
+#include <map>
+
+#include "base/message_serialization.h"
+#include "base/power_monitor.h"
+#include "base/trace_logger.h"
+#include "base/win/scoped_com_initializer.h"
 #include "codec/cursor_encoder.h"
+#include "codec/video_encoder_av1.h"
+#include "codec/video_encoder_h264.h"
+#include "codec/video_encoder_hybrid.h"
+#include "codec/video_encoder_palette.h"
 #include "codec/video_encoder_vpx.h"
 #include "codec/video_encoder_zlib.h"
 #include "codec/video_util.h"
+#include "desktop_capture/capturer_dxgi.h"
 #include "desktop_capture/capturer_gdi.h"
+#include "desktop_capture/capturer_replay.h"
 #include "desktop_capture/capture_scheduler.h"
+#include "desktop_capture/cursor_capturer.h"
+#include "desktop_capture/desktop_frame_aligned.h"
+#include "desktop_capture/desktop_frame_texture.h"
+#include "desktop_capture/frame_hashes.h"
+#include "desktop_capture/frame_recorder.h"
+#include "desktop_capture/win/screen_capture_utils.h"
+#include "host/cpu_governor.h"
+#include "host/memory_governor.h"
+#include "host/host_settings.h"
+#include "host/win/scoped_thread_role.h"
+#include "network/token_bucket.h"
+
+namespace aspia {
+
+namespace {
+
+// The capture interval is not increased above this value, so that the screen remains
+// responsive even on very slow links.
+constexpr std::chrono::milliseconds kMaxUpdateInterval(1000);
+
+// The highest effort of the encoder in the power saving mode. The frames are also encoded half
+// as often with it (see updateInterval).
+constexpr int kPowerSavingEffort = -2;
+
+// Time after the last change of the screen when the encoder refines the quality of the static
+// areas.
+constexpr std::chrono::milliseconds kTopOffDelay(500);
+
+// Time after the input when the screen is captured. The applications need some time to respond
+// to the input.
+constexpr std::chrono::milliseconds kInputCaptureDelay(8);
+
+// After the input the screen is captured kInputBurstCaptures times with an interval no longer
+// than kInputBurstInterval, so that the response to a click or a key press is sent without
+// waiting for the regular captures.
+constexpr int kInputBurstCaptures = 10;
+constexpr std::chrono::milliseconds kInputBurstInterval(16);
+
+// Interval of the cursor capture. The cursor is sent in small messages which are not delayed by
+// the video, so it is polled faster than the screen.
+constexpr std::chrono::milliseconds kCursorCaptureInterval(16);
+
+// The whole screen is encoded again after this time if the screen has not changed for
+// kRefreshIdleTime, and not later than after kMaxRefreshInterval in any case. The key frames
+// are sent when the link is idle, and the decoders are not left with errors for a long time.
+// The encoders which support it refresh the screen gradually instead of a key frame.
+constexpr std::chrono::minutes kRefreshInterval(2);
+constexpr std::chrono::minutes kMaxRefreshInterval(5);
+constexpr std::chrono::seconds kRefreshIdleTime(2);
+
+// Number of temporal layers of VP9. The client which receives and decodes the frames slower than
+// kSlowClientFactor times the update interval gets only the frames of layer 0.
+constexpr int kTemporalLayers = 2;
+constexpr int kSlowClientFactor = 2;
+
+// Frames of the encoders which support it are split into packets of no more than this number
+// of pixels, so that huge frames do not exceed the message size limit and the client applies
+// them in parts.
+constexpr int kMaxPacketPixels = 1024 * 1024;
+
+// The packets of the slice encoding, a quarter of the full HD screen. A slice still has a tile
+// for each thread of the parallel ZLIB mode. The slices continue the same compression streams,
+// so the smaller packets cost only their headers.
+constexpr int kSlicePixels = 512 * 1024;
+
+// The first frame of this number of pixels or more is preceded by the preview if the encoding
+// is lossless. The preview is not sent if it is larger than kMaxPreviewSize.
+constexpr int kMinPreviewPixels = 2 * 1024 * 1024;
+constexpr size_t kMaxPreviewSize = 4 * 1024 * 1024; // 4MB
+
+// The viewports of the client which are smaller are not accepted for the scaling.
+constexpr int kMinViewportSize = 64;
+
+// The capturers are measured by the first frame, which is copied entirely, and this number of
+// the next frames.
+constexpr int kCalibrationCaptures = 4;
+
+// Weight of the previous value in the smoothed RTT and decode time (1/8 for the new sample).
+constexpr int kSmoothingFactor = 8;
+
+// The quality of every 30th frame of the lossy encoders is measured. It costs a copy of the
+// reconstructed frame and the comparison of the encoded blocks.
+constexpr int kQualitySampleInterval = 30;
+
+// The probes of the input which does not change the screen are dropped when they are older than
+// the timeout of the client or when there are too many of them.
+constexpr std::chrono::seconds kLatencyProbeTimeout(2);
+constexpr size_t kMaxLatencyProbes = 16;
+
+// The updates which may wait for the thread of a subscriber without the allocations.
+constexpr size_t kUpdateQueueSize = 256;
+
+std::chrono::milliseconds smooth(std::chrono::milliseconds value,
+                                 std::chrono::milliseconds sample)
+{
+    if (value.count() == 0)
+        return sample;
+
+    return (value * (kSmoothingFactor - 1) + sample) / kSmoothingFactor;
+}
+
+// Returns the device of the frame in the video memory or nullptr if the frame is in the memory.
+ID3D11Device* frameDevice(const DesktopFrame* frame)
+{
+    if (!frame->texture())
+        return nullptr;
+
+    return static_cast<const DesktopFrameTexture*>(frame)->device();
+}
+
+// Creates the frame in the same memory as |source|.
+std::unique_ptr<DesktopFrame> createFrame(const DesktopFrame* source, const QSize& size)
+{
+    if (source->texture())
+        return DesktopFrameTexture::create(frameDevice(source), size);
+
+    return DesktopFrameAligned::create(size, source->format());
+}
+
+void copyFrameRect(const DesktopFrame* source, DesktopFrame* target, const QRect& rect)
+{
+    // The frames of the same device are copied by the GPU.
+    if (source->texture())
+    {
+        static_cast<DesktopFrameTexture*>(target)->copyTextureRect(
+            source->texture(), rect, rect.topLeft());
+        return;
+    }
+
+    const int row_size = rect.width() * source->format().bytesPerPixel();
+
+    const quint8* src = source->frameDataAtPos(rect.topLeft());
+    quint8* dst = target->frameDataAtPos(rect.topLeft());
+
+    for (int y = 0; y < rect.height(); ++y)
+    {
+        memcpy(dst, src, row_size);
+
+        src += source->stride();
+        dst += target->stride();
+    }
+}
+
+// Copies the changed areas of |source| to |target|.
+void copyFrameChanges(const DesktopFrame* source, DesktopFrame* target)
+{
+    for (const auto& move_rect : source->moveRects())
+        copyFrameRect(source, target, move_rect.target);
+
+    for (const auto& rect : source->updatedRegion())
+        copyFrameRect(source, target, rect);
+}
+
+// Maps |rect| of the screen to the frame scaled from |screen_size| to |frame_size|. The
+// rectangle is extended by a pixel, because the filter takes the neighbouring pixels.
+QRect scaleRect(const QRect& rect, const QSize& screen_size, const QSize& frame_size)
+{
+    const int left = rect.left() * frame_size.width() / screen_size.width() - 1;
+    const int top = rect.top() * frame_size.height() / screen_size.height() - 1;
+    const int right = ((rect.right() + 1) * frame_size.width() + screen_size.width() - 1) /
+        screen_size.width() + 1;
+    const int bottom = ((rect.bottom() + 1) * frame_size.height() + screen_size.height() - 1) /
+        screen_size.height() + 1;
+
+    return QRect(left, top, right - left, bottom - top).intersected(QRect(QPoint(), frame_size));
+}
+
+QRegion scaleRegion(const QRegion& region, const QSize& screen_size, const QSize& frame_size)
+{
+    QRegion scaled_region;
+
+    for (const auto& rect : region)
+        scaled_region += scaleRect(rect, screen_size, frame_size);
+
+    return scaled_region;
+}
+
+// Scales the area |rect| of |target| from the whole |source|.
+void scaleFrameRect(const DesktopFrame* source, DesktopFrame* target, const QRect& rect)
+{
+    libyuv::ARGBScaleClip(source->frameData(), source->stride(),
+                          source->size().width(), source->size().height(),
+                          target->frameData(), target->stride(),
+                          target->size().width(), target->size().height(),
+                          rect.x(), rect.y(), rect.width(), rect.height(),
+                          libyuv::kFilterBox);
+}
+
+// Splits the region into parts of no more than |max_pixels| pixels. Large rectangles are split
+// into bands of rows. The parts follow from the top of the screen.
+std::vector<QRegion> splitRegion(const QRegion& region, int max_pixels)
+{
+    std::vector<QRegion> parts;
+    QRegion part;
+    int part_pixels = 0;
+
+    for (const auto& rect : region)
+    {
+        int top = rect.top();
+
+        while (top <= rect.bottom())
+        {
+            const int rows = std::min(std::max(1, (max_pixels - part_pixels) / rect.width()),
+                                      rect.bottom() - top + 1);
+
+            if (part_pixels && part_pixels + rows * rect.width() > max_pixels)
+            {
+                parts.push_back(part);
+                part = QRegion();
+                part_pixels = 0;
+                continue;
+            }
+
+            part += QRect(rect.left(), top, rect.width(), rows);
+            part_pixels += rows * rect.width();
+            top += rows;
+        }
+    }
+
+    if (!part.isEmpty() || parts.empty())
+        parts.push_back(part);
+
+    return parts;
+}
+
+// The key frames of the lossless encodings take seconds on the slow links. The first frame of
+// each size is sent as the preview of the whole screen in 8 bit colors at once, and the
+// encoder refines it by the packets of the usual encoding.
+bool hasPreview(const proto::desktop::Config& config)
+{
+    switch (config.video_encoding())
+    {
+        case proto::desktop::VIDEO_ENCODING_ZLIB:
+        case proto::desktop::VIDEO_ENCODING_LZ4:
+        case proto::desktop::VIDEO_ENCODING_ZSTD:
+            return VideoUtil::fromVideoPixelFormat(config.pixel_format()).bytesPerPixel() > 1;
+
+        case proto::desktop::VIDEO_ENCODING_VP9:
+        case proto::desktop::VIDEO_ENCODING_PALETTE:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+// The client of the resumed session keeps its frame. The tiles of these encodings do not refer
+// to the previous frames, so the first frame may contain only the tiles which differ from it.
+bool hasResync(const proto::desktop::Config& config)
+{
+    if (!(config.features() & proto::desktop::FEATURE_RESYNC) ||
+        config.frame_hashes().tile_size() != FrameHashes::kTileSize)
+    {
+        return false;
+    }
+
+    switch (config.video_encoding())
+    {
+        case proto::desktop::VIDEO_ENCODING_ZLIB:
+        case proto::desktop::VIDEO_ENCODING_LZ4:
+        case proto::desktop::VIDEO_ENCODING_ZSTD:
+            // The frame of the client in a lower colour depth never matches the capture.
+            return VideoUtil::fromVideoPixelFormat(config.pixel_format()).bytesPerPixel() == 4;
+
+        case proto::desktop::VIDEO_ENCODING_PALETTE:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+// Returns the format of the frames of the GDI capturer. The encodings of the raw pixels take
+// the frames of a low colour depth in the client's format if nothing else reads the pixels.
+PixelFormat gdiPixelFormat(const proto::desktop::Config& config, bool recording)
+{
+    switch (config.video_encoding())
+    {
+        case proto::desktop::VIDEO_ENCODING_ZLIB:
+        case proto::desktop::VIDEO_ENCODING_LZ4:
+        case proto::desktop::VIDEO_ENCODING_ZSTD:
+            break;
+
+        default:
+            return PixelFormat::ARGB();
+    }
+
+    const PixelFormat format = VideoUtil::fromVideoPixelFormat(config.pixel_format());
+
+    // The recorder and the scaling take the frames in ARGB.
+    if (recording || (config.features() & proto::desktop::FEATURE_SCALING) ||
+        !CapturerGDI::isSupportedPixelFormat(format))
+    {
+        return PixelFormat::ARGB();
+    }
+
+    return format;
+}
+
+// Returns the parameters of the config which affect the encoded stream.
+std::string streamKey(const proto::desktop::Config& config)
+{
+    proto::desktop::Config key(config);
+
+    key.set_features(key.features() &
+                     ~(proto::desktop::FEATURE_CLIPBOARD | proto::desktop::FEATURE_VISIBILITY |
+                       proto::desktop::FEATURE_RESYNC | proto::desktop::FEATURE_LATENCY_PROBE |
+                       proto::desktop::FEATURE_REDUCED_EFFECTS |
+                       proto::desktop::FEATURE_VISIBLE_AREA));
+    key.clear_cursor_cache();
+    key.clear_cursor_cache_next();
+    key.clear_frame_hashes();
+
+    return key.SerializeAsString();
+}
+
+// Returns the time (in microseconds) of the captures of the capturer or -1 if it does not
+// work.
+template <class CapturerType>
+qint64 measureCapturer()
+{
+    std::unique_ptr<Capturer> capturer = CapturerType::create();
+    if (!capturer)
+        return -1;
+
+    const QSize desktop_size = screenRect(Capturer::kFullDesktopScreenId).size();
+    const auto start_time = std::chrono::steady_clock::now();
+
+    for (int i = 0; i <= kCalibrationCaptures; ++i)
+    {
+        const DesktopFrame* frame = capturer->captureImage();
+        if (!frame || frame->size() != desktop_size)
+            return -1;
+    }
+
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start_time).count();
+}
+
+// The speed of the capturers depends on the GPU driver. In the virtual machines DXGI may be
+// slower than GDI. The capturers are measured once per process and the result is kept until
+// the bounds of the desktop change.
+bool isDxgiCapturerFaster()
+{
+    static std::mutex lock;
+    static QRect measured_rect;
+    static bool dxgi_faster = true;
+
+    std::scoped_lock<std::mutex> scoped_lock(lock);
+
+    const QRect desktop_rect = screenRect(Capturer::kFullDesktopScreenId);
+    if (desktop_rect == measured_rect)
+        return dxgi_faster;
+
+    const qint64 dxgi_time = measureCapturer<CapturerDXGI>();
+    const qint64 gdi_time = measureCapturer<CapturerGDI>();
+
+    measured_rect = desktop_rect;
+    dxgi_faster = dxgi_time >= 0 && (gdi_time < 0 || dxgi_time <= gdi_time);
+
+    qInfo() << "Capture time of" << kCalibrationCaptures + 1 << "frames: DXGI"
+            << dxgi_time << "us, GDI" << gdi_time << "us. The"
+            << (dxgi_faster ? "DXGI" : "GDI") << "capturer is used";
+
+    return dxgi_faster;
+}
+
+class CalibrationTask : public QRunnable
+{
+public:
+    CalibrationTask() = default;
+
+    // QRunnable implementation.
+    void run() override
+    {
+        ScopedCOMInitializer com_initializer(ScopedCOMInitializer::kMTA);
+        isDxgiCapturerFaster();
+    }
+
+private:
+    Q_DISABLE_COPY(CalibrationTask)
+};
+
+} // namespace
+
+ScreenUpdater::UpdateEvent::UpdateEvent(std::shared_ptr<UpdateQueue> queue)
+    : QEvent(static_cast<QEvent::Type>(kType)),
+      queue_(std::move(queue))
+{
+    // Nothing
+}
+
+ScreenUpdater::UpdateEvent::UpdateEvent(std::shared_ptr<UpdateQueue> queue, Update&& update)
+    : QEvent(static_cast<QEvent::Type>(kType)),
+      queue_(std::move(queue)),
+      update_(std::move(update)),
+      started_(true)
+{
+    // Nothing
+}
+
+bool ScreenUpdater::UpdateEvent::takeUpdate(Update* update)
+{
+    // The updates which are queued after this point post the next event.
+    if (!started_)
+    {
+        started_ = true;
+        queue_->wakeup_pending.exchange(false);
+    }
+
+    if (queue_->queue.tryPop(update))
+        return true;
+
+    if (!update_)
+        return false;
+
+    *update = std::move(*update_);
+    update_.reset();
+
+    // The producer uses the queue again after the last of such events.
+    --queue_->overflow_events;
+    return true;
+}
+
+ScreenUpdater::ScreenUpdater(const proto::desktop::Config& config)
+    : config_(config)
+{
+    HostSettings settings;
+
+    for (int limit : { static_cast<int>(config.bandwidth_limit()),
+                       settings.sessionBandwidthLimit(),
+                       settings.hostBandwidthLimit() })
+    {
+        const qint64 rate = TokenBucket::kbpsToRate(limit);
+
+        if (rate > 0 && (!bandwidth_limit_ || rate < bandwidth_limit_))
+            bandwidth_limit_ = rate;
+    }
+
+    max_packet_pixels_ = settings.isSliceEncodingEnabled() ? kSlicePixels : kMaxPacketPixels;
+    initial_bandwidth_ = TokenBucket::kbpsToRate(static_cast<int>(config.initial_bandwidth()));
+
+    start(QThread::HighPriority);
+}
+
+ScreenUpdater::~ScreenUpdater()
+{
+    {
+        std::scoped_lock<std::mutex> lock(lock_);
+        terminate_ = true;
+    }
+
+    capture_condition_.notify_one();
+    encode_condition_.notify_one();
+    cursor_condition_.notify_one();
+
+    wait();
+}
+
+// static
+std::shared_ptr<ScreenUpdater> ScreenUpdater::acquire(const proto::desktop::Config& config)
+{
+    // The updaters are created and released by the sessions in the main thread.
+    static std::map<std::string, std::weak_ptr<ScreenUpdater>> updaters;
+
+    const std::string key = streamKey(config);
+
+    std::shared_ptr<ScreenUpdater> updater = updaters[key].lock();
+    if (!updater)
+    {
+        updater = std::make_shared<ScreenUpdater>(config);
+        updaters[key] = updater;
+    }
+
+    // The entries of the destroyed updaters are removed.
+    for (auto it = updaters.begin(); it != updaters.end();)
+    {
+        if (it->second.expired())
+            it = updaters.erase(it);
+        else
+            ++it;
+    }
+
+    return updater;
+}
+
+// static
+void ScreenUpdater::prepare()
+{
+    HostSettings settings;
+
+    // The capturers are measured only if the capturer is chosen automatically.
+    const QString capturer_type = settings.capturerType();
+    if (!settings.screenReplayFile().isEmpty() ||
+        capturer_type == QLatin1String("dxgi") || capturer_type == QLatin1String("gdi"))
+    {
+        return;
+    }
+
+    QThreadPool::globalInstance()->start(new CalibrationTask());
+}
+
+void ScreenUpdater::addSubscriber(QObject* subscriber)
+{
+    {
+        std::scoped_lock<std::mutex> lock(lock_);
+
+        if (findSubscriber(subscriber))
+            return;
+
+        // The cursor cache of the first subscriber may be restored from its previous session.
+        if (!subscribers_.empty())
+            cursor_reset_pending_ = true;
+
+        subscribers_.push_back(std::make_unique<Subscriber>(subscriber));
+        subscribers_.back()->updates = std::make_shared<UpdateQueue>(kUpdateQueueSize);
+        screen_list_pending_ = true;
+    }
+
+    // The new subscriber starts decoding from a key frame. The capture may be paused for the
+    // hidden windows of the other subscribers.
+    refreshScreen();
+    capture_condition_.notify_one();
+    cursor_condition_.notify_one();
+}
+
+void ScreenUpdater::removeSubscriber(QObject* subscriber)
+{
+    {
+        std::scoped_lock<std::mutex> lock(lock_);
+
+        subscribers_.erase(std::remove_if(subscribers_.begin(), subscribers_.end(),
+            [subscriber](const std::unique_ptr<Subscriber>& item)
+        {
+            return item->receiver == subscriber;
+        }), subscribers_.end());
+    }
+
+    // The encoder may wait for the slots of the removed subscriber.
+    encode_condition_.notify_one();
+}
+
+void ScreenUpdater::update(QObject* subscriber)
+{
+    // The slots are freed by the acknowledgements from the client.
+    if (isVideoAckEnabled())
+        return;
+
+    std::scoped_lock<std::mutex> lock(lock_);
+
+    Subscriber* item = findSubscriber(subscriber);
+    if (!item)
+        return;
+
+    if (item->frames_in_flight > 0)
+        --item->frames_in_flight;
+
+    encode_condition_.notify_one();
+}
+
+void ScreenUpdater::acknowledgeFrame(QObject* subscriber,
+                                     const proto::desktop::VideoAck& video_ack)
+{
+    if (!isVideoAckEnabled())
+        return;
+
+    std::scoped_lock<std::mutex> lock(lock_);
+
+    Subscriber* item = findSubscriber(subscriber);
+    if (!item)
+        return;
+
+    std::deque<UnackedFrame>& unacked_frames = item->unacked_frames;
+
+    auto frame = unacked_frames.begin();
+
+    while (frame != unacked_frames.end() && frame->frame_id != video_ack.frame_id())
+        ++frame;
+
+    if (frame == unacked_frames.end())
+    {
+        qWarning() << "Acknowledgement for unknown frame: " << video_ack.frame_id();
+        return;
+    }
+
+    const std::chrono::milliseconds decode_time(video_ack.decode_time());
+    const std::chrono::milliseconds round_trip_time =
+        std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - frame->send_time);
+
+    item->decode_time = smooth(item->decode_time, decode_time);
+    item->rtt = smooth(item->rtt, round_trip_time);
+
+    item->bandwidth_estimator.addSample(frame->size, round_trip_time - decode_time);
+
+    // The packets are decoded in order, so all previous packets are acknowledged too.
+    const int acked_count = static_cast<int>(std::distance(unacked_frames.begin(), frame)) + 1;
+
+    unacked_frames.erase(unacked_frames.begin(), frame + 1);
+    item->frames_in_flight = std::max(0, item->frames_in_flight - acked_count);
+
+    encode_condition_.notify_one();
+}
+
+void ScreenUpdater::dropUnackedFrames(QObject* subscriber)
+{
+    if (!isVideoAckEnabled())
+        return;
+
+    {
+        std::scoped_lock<std::mutex> lock(lock_);
+
+        Subscriber* item = findSubscriber(subscriber);
+        if (!item)
+            return;
+
+        item->unacked_frames.clear();
+        item->frames_in_flight = 0;
+    }
+
+    encode_condition_.notify_one();
+}
+
+void ScreenUpdater::selectScreen(qint64 screen_id)
+{
+    {
+        std::scoped_lock<std::mutex> lock(lock_);
+
+        screen_selection_pending_ = true;
+        selected_screen_id_ = screen_id;
+    }
+
+    capture_condition_.notify_one();
+}
+
+void ScreenUpdater::setSubscriberVisible(QObject* subscriber, bool visible)
+{
+    {
+        std::scoped_lock<std::mutex> lock(lock_);
+
+        Subscriber* item = findSubscriber(subscriber);
+        if (!item)
+            return;
+
+        const bool was_paused = isPaused();
+        item->hidden = !visible;
+
+        if (!was_paused || isPaused())
+            return;
+    }
+
+    // The changes since the pause are not known, so the window starts from a key frame. The
+    // capture does not wait for the end of the pause interval.
+    refreshScreen();
+    capture_condition_.notify_one();
+    cursor_condition_.notify_one();
+}
+
+void ScreenUpdater::setSubscriberVisibleArea(QObject* subscriber, const QRect& area)
+{
+    {
+        std::scoped_lock<std::mutex> lock(lock_);
+
+        Subscriber* item = findSubscriber(subscriber);
+        if (!item || item->visible_area == area)
+            return;
+
+        item->visible_area = area;
+    }
+
+    // The changes which have become visible are encoded without waiting for the idle link.
+    encode_condition_.notify_one();
+}
+
+void ScreenUpdater::setSubscriberBlocked(QObject* subscriber, bool blocked)
+{
+    {
+        std::scoped_lock<std::mutex> lock(lock_);
+
+        Subscriber* item = findSubscriber(subscriber);
+        if (!item || item->blocked == blocked)
+            return;
+
+        item->blocked = blocked;
+
+        if (blocked)
+            return;
+    }
+
+    // The encoder may wait for the slots of the subscriber.
+    encode_condition_.notify_one();
+}
+
+void ScreenUpdater::inputInjected()
+{
+    {
+        std::scoped_lock<std::mutex> lock(lock_);
+
+        input_pending_ = true;
+        input_time_ = Clock::now();
+    }
+
+    capture_condition_.notify_one();
+}
+
+void ScreenUpdater::addLatencyProbe(QObject* subscriber, qint64 probe_time)
+{
+    std::scoped_lock<std::mutex> lock(lock_);
+
+    Subscriber* entry = findSubscriber(subscriber);
+    if (!entry)
+        return;
+
+    const Clock::time_point now = Clock::now();
+    auto& probes = entry->latency_probes;
+
+    // The probes of the events which do not change the screen are never answered.
+    while (!probes.empty() && (probes.size() >= kMaxLatencyProbes ||
+                               now - probes.front().inject_time > kLatencyProbeTimeout))
+    {
+        probes.pop_front();
+    }
+
+    probes.push_back({ probe_time, now });
+}
+
+bool ScreenUpdater::isVideoAckEnabled() const
+{
+    return (config_.features() & proto::desktop::FEATURE_VIDEO_ACK) != 0;
+}
+
+ScreenUpdater::Subscriber* ScreenUpdater::findSubscriber(QObject* receiver)
+{
+    for (const auto& subscriber : subscribers_)
+    {
+        if (subscriber->receiver == receiver)
+            return subscriber.get();
+    }
+
+    return nullptr;
+}
+
+bool ScreenUpdater::isPaused() const
+{
+    for (const auto& subscriber : subscribers_)
+    {
+        if (!subscriber->hidden)
+            return false;
+    }
+
+    return !subscribers_.empty();
+}
+
+bool ScreenUpdater::hasFreeSlots() const
+{
+    // The changes are merged in the pending frame while the windows of the subscribers are
+    // hidden.
+    if (isPaused())
+        return false;
+
+    // The frames are encoded at the rate of the slowest subscriber. The slow subscribers do not
+    // receive the frames of temporal layer 1, so they are less behind. The full write queue of
+    // a subscriber stops the encoding as well.
+    for (const auto& subscriber : subscribers_)
+    {
+        if (subscriber->frames_in_flight >= kMaxFramesInFlight || subscriber->blocked)
+            return false;
+    }
+
+    return !subscribers_.empty();
+}
+
+bool ScreenUpdater::isIdle() const
+{
+    for (const auto& subscriber : subscribers_)
+    {
+        if (subscriber->frames_in_flight != 0)
+            return false;
+    }
+
+    return true;
+}
+
+QRegion ScreenUpdater::visibleArea() const
+{
+    QRegion area;
+
+    for (const auto& subscriber : subscribers_)
+    {
+        // The subscriber shows the whole frame.
+        if (subscriber->visible_area.isEmpty())
+            return QRegion();
+
+        area += subscriber->visible_area;
+    }
+
+    return area;
+}
+
+bool ScreenUpdater::hasVisibleChanges(bool crop) const
+{
+    if (!pending_frame_->moveRects().isEmpty())
+        return true;
+
+    const QRegion& updated_region = pending_frame_->updatedRegion();
+    if (updated_region.isEmpty())
+        return false;
+
+    if (!crop || refresh_pending_)
+        return true;
+
+    const QRegion visible_area = visibleArea();
+    return visible_area.isEmpty() || updated_region.intersects(visible_area);
+}
+
+qint64 ScreenUpdater::bandwidth() const
+{
+    qint64 bandwidth = 0;
+
+    // The encoder is limited by the slowest link.
+    for (const auto& subscriber : subscribers_)
+    {
+        const qint64 value = subscriber->bandwidth_estimator.bandwidth();
+
+        if (value && (!bandwidth || value < bandwidth))
+            bandwidth = value;
+    }
+
+    // The bandwidth of the previous session is used until the new one is estimated.
+    if (!bandwidth)
+        bandwidth = initial_bandwidth_;
+
+    // The channel would queue the frames above the limit.
+    if (bandwidth_limit_ && (!bandwidth || bandwidth > bandwidth_limit_))
+        bandwidth = bandwidth_limit_;
+
+    return bandwidth;
+}
+
+bool ScreenUpdater::dropEnhancementLayer(const Subscriber& subscriber) const
+{
+    const std::chrono::milliseconds client_interval =
+        std::max(subscriber.decode_time, subscriber.rtt / kMaxFramesInFlight);
+
+    return client_interval >
+        std::chrono::milliseconds(config_.update_interval()) * kSlowClientFactor;
+}
+
+int ScreenUpdater::encoderEffort() const
+{
+    return power_saving_ ? std::min(effort_, kPowerSavingEffort) : effort_;
+}
+
+std::chrono::milliseconds ScreenUpdater::updateInterval() const
+{
+    std::chrono::milliseconds interval(config_.update_interval());
+
+    // With less effort of the encoder the frames are also encoded less often.
+    const int effort = encoderEffort();
+    if (effort < 0)
+        interval = interval * (2 - effort) / 2;
+
+    // Frames captured faster than the clients are able to receive and decode them are merged
+    // in the pending frame anyway. The capture interval is adapted to avoid useless work.
+    for (const auto& subscriber : subscribers_)
+    {
+        interval = std::max(interval, subscriber->decode_time);
+        interval = std::max(interval, subscriber->rtt / kMaxFramesInFlight);
+    }
+
+    return std::min(interval, std::max(kMaxUpdateInterval,
+                                       std::chrono::milliseconds(config_.update_interval())));
+}
+
+void ScreenUpdater::refreshCursor()
+{
+    std::scoped_lock<std::mutex> lock(lock_);
+
+    // The cursor thread creates the encoder again with its next capture.
+    cursor_reset_pending_ = true;
+}
+
+void ScreenUpdater::refreshScreen()
+{
+    {
+        std::scoped_lock<std::mutex> lock(lock_);
+
+        refresh_pending_ = true;
+
+        if (pending_frame_)
+        {
+            // The pending frame contains the whole image, so the encoder takes all of it.
+            pending_frame_->mutableMoveRects()->clear();
+            *pending_frame_->mutableUpdatedRegion() = QRect(QPoint(), pending_frame_->size());
+        }
+    }
+
+    encode_condition_.notify_one();
+}
+
+void ScreenUpdater::refreshScreenGradually()
+{
+    {
+        std::scoped_lock<std::mutex> lock(lock_);
+        intra_refresh_pending_ = true;
+    }
+
+    encode_condition_.notify_one();
+}
+
+QPoint ScreenUpdater::toScreenPoint(const QPoint& point)
+{
+    std::scoped_lock<std::mutex> lock(lock_);
+
+    if (!pending_frame_ || pending_frame_->size() == screen_size_)
+        return point;
+
+    const QSize& frame_size = pending_frame_->size();
+
+    // The centers of the pixels are mapped.
+    return QPoint((point.x() * 2 + 1) * screen_size_.width() / (frame_size.width() * 2),
+                  (point.y() * 2 + 1) * screen_size_.height() / (frame_size.height() * 2));
+}
+
+QSize ScreenUpdater::scaledSize(const QSize& screen_size) const
+{
+    if (!(config_.features() & proto::desktop::FEATURE_SCALING))
+        return screen_size;
+
+    QSize viewport = VideoUtil::fromVideoSize(config_.viewport());
+
+    if (viewport.width() < kMinViewportSize || viewport.height() < kMinViewportSize)
+        viewport = screen_size;
+
+    // Over the memory budget the frames are scaled down further.
+    const int divisor = MemoryGovernor::frameDivisor(memory_degradation_);
+    if (divisor > 1)
+    {
+        viewport = viewport.boundedTo(
+            QSize(qMax(kMinViewportSize, screen_size.width() / divisor),
+                  qMax(kMinViewportSize, screen_size.height() / divisor)));
+    }
+
+    // The screen is not scaled up.
+    if (viewport.width() >= screen_size.width() && viewport.height() >= screen_size.height())
+        return screen_size;
+
+    // The aspect ratio is kept.
+    const qint64 width_by_height = static_cast<qint64>(screen_size.width()) * viewport.height();
+    const qint64 height_by_width = static_cast<qint64>(screen_size.height()) * viewport.width();
+
+    if (width_by_height > height_by_width)
+    {
+        return QSize(viewport.width(),
+                     qMax(1, static_cast<int>(height_by_width / screen_size.width())));
+    }
+
+    return QSize(qMax(1, static_cast<int>(width_by_height / screen_size.height())),
+                 viewport.height());
+}
+
+void ScreenUpdater::queueFrame(const DesktopFrame* frame,
+                               const QRegion& focus_region,
+                               quint32 trace_id,
+                               qint64 capture_time)
+{
+    // The pixels of the frames in the video memory are not scaled. The scaling disables them.
+    const QSize frame_size = frame->texture() ? frame->size() : scaledSize(frame->size());
+    const bool scaled = frame_size != frame->size();
+
+    std::scoped_lock<std::mutex> lock(lock_);
+
+    focus_region_ = scaled ? scaleRegion(focus_region, frame->size(), frame_size) : focus_region;
+
+    // The latency of the merged frames is counted from the oldest change.
+    if (!pending_frame_ || (pending_frame_->updatedRegion().isEmpty() &&
+                            pending_frame_->moveRects().isEmpty()))
+    {
+        pending_trace_id_ = trace_id;
+        pending_capture_time_ = capture_time;
+    }
+
+    pending_update_time_ = Clock::now();
+
+    if (!pending_frame_ || pending_frame_->size() != frame_size || screen_size_ != frame->size() ||
+        frameDevice(pending_frame_.get()) != frameDevice(frame))
+    {
+        // The buffer of the previous frame is returned into the pool first.
+        pending_frame_.reset();
+        pending_frame_ = createFrame(frame, frame_size);
+        if (!pending_frame_)
+            return;
+
+        screen_size_ = frame->size();
+
+        const QRect frame_rect(QPoint(), frame_size);
+
+        if (scaled)
+            scaleFrameRect(frame, pending_frame_.get(), frame_rect);
+        else
+            copyFrameRect(frame, pending_frame_.get(), frame_rect);
+
+        pending_frame_->mutableMoveRects()->clear();
+        *pending_frame_->mutableUpdatedRegion() = frame_rect;
+    }
+    else if (scaled)
+    {
+        // The moves are not exact in the scaled frame, so they are sent as the updated areas.
+        QRegion changes = frame->updatedRegion();
+
+        for (const auto& move_rect : frame->moveRects())
+            changes += move_rect.target;
+
+        const QRegion scaled_changes = scaleRegion(changes, frame->size(), frame_size);
+
+        for (const auto& rect : scaled_changes)
+            scaleFrameRect(frame, pending_frame_.get(), rect);
+
+        *pending_frame_->mutableUpdatedRegion() += scaled_changes;
+    }
+    else
+    {
+        QRegion* pending_region = pending_frame_->mutableUpdatedRegion();
+
+        // The moves are applied before the updated region. If the pending frame already has
+        // the updated region, then the moves of the new frame are sent as the updated areas.
+        if (pending_region->isEmpty())
+        {
+            *pending_frame_->mutableMoveRects() += frame->moveRects();
+        }
+        else
+        {
+            for (const auto& move_rect : frame->moveRects())
+                *pending_region += move_rect.target;
+        }
+
+        *pending_region += frame->updatedRegion();
+
+        copyFrameChanges(frame, pending_frame_.get());
+    }
+
+    encode_condition_.notify_one();
+}
+
+void ScreenUpdater::runEncoder(std::unique_ptr<VideoEncoder> video_encoder)
+{
+    // The hardware encoders of Media Foundation are COM objects.
+    ScopedCOMInitializer com_initializer(ScopedCOMInitializer::kMTA);
+    ScopedThreadRole thread_role(ScopedThreadRole::Role::ENCODE);
+
+    std::unique_ptr<DesktopFrame> encode_frame;
+    proto::desktop::HostToClient message;
+    QRegion focus_region;
+    qint64 bandwidth = 0;
+    int effort = 0;
+    int encoder_effort = 0;
+
+    // All clients decode ZLIB. The packets of the encoder contain the format after the preview,
+    // so the clients switch back to the encoding of the config.
+    std::unique_ptr<VideoEncoder> preview_encoder;
+    if (hasPreview(config_))
+    {
+        preview_encoder = VideoEncoderZLIB::create(
+            PixelFormat::RGB332(), 1, proto::desktop::COMPRESSION_ZLIB, false, false);
+    }
+
+    // The hashes of the client which has started the stream are used only by the first frame.
+    std::vector<quint64> resync_hashes;
+    QSize resync_size;
+    if (hasResync(config_))
+    {
+        resync_hashes.assign(config_.frame_hashes().hash().begin(),
+                             config_.frame_hashes().hash().end());
+        resync_size = VideoUtil::fromVideoSize(config_.frame_hashes().screen_size());
+    }
+
+    // The tile encodings encode only the updated region, so the changes outside of the visible
+    // areas of the subscribers can wait.
+    const bool crop = video_encoder->canSplitFrame();
+
+    while (true)
+    {
+        quint32 trace_id = 0;
+        qint64 capture_time = 0;
+        Clock::time_point update_time;
+
+        const bool top_off_pending = encode_frame && video_encoder->isTopOffPending();
+        const Clock::time_point top_off_time = Clock::now() + kTopOffDelay;
+        bool top_off = false;
+        bool refresh = false;
+        bool intra_refresh = false;
+        bool preview = false;
+        bool single_subscriber = false;
+
+        {
+            std::unique_lock<std::mutex> lock(lock_);
+
+            while (!terminate_)
+            {
+                if (hasFreeSlots() && pending_frame_)
+                {
+                    if (hasVisibleChanges(crop))
+                        break;
+
+                    // The changes outside of the visible areas are encoded while no frames
+                    // are in flight.
+                    if (!pending_frame_->updatedRegion().isEmpty() && isIdle())
+                        break;
+
+                    if (top_off_pending && Clock::now() >= top_off_time)
+                    {
+                        top_off = true;
+                        break;
+                    }
+
+                    // The refresh starts without waiting for the changes.
+                    if (intra_refresh_pending_ && encode_frame)
+                    {
+                        top_off = true;
+                        break;
+                    }
+                }
+
+                if (top_off_pending && Clock::now() < top_off_time)
+                    encode_condition_.wait_until(lock, top_off_time);
+                else
+                    encode_condition_.wait(lock);
+            }
+
+            if (terminate_)
+                return;
+
+            effort = encoderEffort();
+
+            if (top_off)
+            {
+                // The frame without changes is encoded to refine the static areas.
+                *encode_frame->mutableUpdatedRegion() = QRegion();
+                encode_frame->mutableMoveRects()->clear();
+            }
+            else
+            {
+                if (!encode_frame || encode_frame->size() != pending_frame_->size() ||
+                    frameDevice(encode_frame.get()) != frameDevice(pending_frame_.get()))
+                {
+                    encode_frame.reset();
+                    encode_frame = createFrame(pending_frame_.get(), pending_frame_->size());
+                    if (!encode_frame)
+                    {
+                        postError();
+                        return;
+                    }
+
+                    const QSize& size = encode_frame->size();
+                    preview = preview_encoder && size.width() * size.height() >= kMinPreviewPixels;
+                }
+
+                // Take the pending changes.
+                copyFrameChanges(pending_frame_.get(), encode_frame.get());
+
+                *encode_frame->mutableUpdatedRegion() = pending_frame_->updatedRegion();
+                *encode_frame->mutableMoveRects() = pending_frame_->moveRects();
+
+                *pending_frame_->mutableUpdatedRegion() = QRegion();
+                pending_frame_->mutableMoveRects()->clear();
+
+                trace_id = pending_trace_id_;
+                capture_time = pending_capture_time_;
+                update_time = pending_update_time_;
+
+                bandwidth = this->bandwidth();
+                focus_region = focus_region_;
+
+                refresh = refresh_pending_;
+                refresh_pending_ = false;
+
+                single_subscriber = subscribers_.size() == 1;
+
+                // The preview and the refresh send the whole frame.
+                const QRegion visible_area =
+                    (crop && !refresh && !preview) ? visibleArea() : QRegion();
+
+                if (!visible_area.isEmpty())
+                {
+                    const QRegion updated_region = encode_frame->updatedRegion();
+                    QRegion visible_changes = updated_region.intersected(visible_area);
+
+                    // The idle link takes the other changes by one slice at a time.
+                    if (visible_changes.isEmpty() && encode_frame->moveRects().isEmpty())
+                        visible_changes = splitRegion(updated_region, kSlicePixels).front();
+
+                    // The pixels of the rest are in the encode frame already and are copied
+                    // again with the next changes.
+                    *encode_frame->mutableUpdatedRegion() = visible_changes;
+                    *pending_frame_->mutableUpdatedRegion() =
+                        updated_region.subtracted(visible_changes);
+                }
+            }
+
+            intra_refresh = intra_refresh_pending_;
+            intra_refresh_pending_ = false;
+        }
+
+        if (refresh && !resync_hashes.empty())
+        {
+            // The other subscribers which have joined meanwhile do not have the frame.
+            if (single_subscriber && encode_frame->size() == resync_size)
+            {
+                *encode_frame->mutableUpdatedRegion() =
+                    FrameHashes::changedRegion(encode_frame.get(), resync_hashes);
+                encode_frame->mutableMoveRects()->clear();
+
+                // The new encoder sends the format with the changed tiles, and the client
+                // keeps the rest of its frame.
+                preview = false;
+            }
+
+            resync_hashes.clear();
+        }
+
+        if (refresh)
+        {
+            video_encoder->requestKeyFrame();
+        }
+        else if (intra_refresh && !video_encoder->requestIntraRefresh())
+        {
+            *encode_frame->mutableUpdatedRegion() = QRect(QPoint(), encode_frame->size());
+            encode_frame->mutableMoveRects()->clear();
+
+            video_encoder->requestKeyFrame();
+        }
+
+        if (bandwidth)
+            video_encoder->setBandwidth(bandwidth);
+
+        if (effort != encoder_effort)
+        {
+            video_encoder->setEffort(effort);
+            encoder_effort = effort;
+        }
+
+        video_encoder->setFocusRegion(focus_region);
+
+        const Clock::time_point encode_start_time = Clock::now();
+
+        if (preview)
+        {
+            // The preview and the key frame of the encoder contain the whole frame.
+            *encode_frame->mutableUpdatedRegion() = QRect(QPoint(), encode_frame->size());
+            encode_frame->mutableMoveRects()->clear();
+
+            proto::desktop::VideoPacket* video_packet = message.mutable_video_packet();
+
+            {
+                ScopedTrace trace("preview", trace_id);
+
+                preview_encoder->requestKeyFrame();
+
+                if (!preview_encoder->encode(encode_frame.get(), video_packet))
+                {
+                    postError();
+                    return;
+                }
+            }
+
+            // The preview of a noisy screen is not received faster than the frame itself.
+            if (video_packet->ByteSizeLong() <= kMaxPreviewSize)
+            {
+                video_packet->set_trace_id(trace_id);
+                video_packet->set_capture_time(capture_time);
 
-namespace aspia {
+                postVideoPacket(&message, false, update_time);
+                video_encoder->requestKeyFrame();
+            }
+        }
+
+        std::vector<QRegion> parts;
+
+        if (video_encoder->canSplitFrame())
+            parts = splitRegion(encode_frame->updatedRegion(), max_packet_pixels_);
+
+        const int part_count = parts.empty() ? 1 : static_cast<int>(parts.size());
+
+        for (int i = 0; i < part_count; ++i)
+        {
+            const bool frame_end = (i == part_count - 1);
+
+            if (part_count > 1)
+            {
+                *encode_frame->mutableUpdatedRegion() = parts[i];
+
+                // The moves are applied by the first packet of the frame.
+                if (i == 1)
+                    encode_frame->mutableMoveRects()->clear();
+            }
+
+            // The packet is reused with its allocated buffers.
+            proto::desktop::VideoPacket* video_packet = message.mutable_video_packet();
+            const Clock::time_point packet_start_time = Clock::now();
+
+            {
+                ScopedTrace trace("encode", trace_id);
+
+                if (!video_encoder->encode(encode_frame.get(), video_packet))
+                {
+                    postError();
+                    return;
+                }
+            }
+
+            video_packet->set_encode_time(static_cast<quint32>(
+                std::chrono::duration_cast<std::chrono::microseconds>(
+                    Clock::now() - packet_start_time).count()));
+            video_packet->set_trace_id(trace_id);
+            video_packet->set_capture_time(capture_time);
+
+            postVideoPacket(&message, frame_end, update_time);
+        }
+
+        const std::chrono::milliseconds encode_time =
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                Clock::now() - encode_start_time);
+
+        std::scoped_lock<std::mutex> lock(lock_);
+        encode_time_ = smooth(encode_time_, encode_time);
+    }
+}
 
-ScreenUpdater::ScreenUpdater(const proto::desktop::Config& config, QObject* parent)
-    : QThread(parent),
-      config_(config)
+void ScreenUpdater::postVideoPacket(proto::desktop::HostToClient* message,
+                                    bool frame_end,
+                                    Clock::time_point update_time)
 {
-    start(QThread::HighPriority);
+    proto::desktop::VideoPacket* video_packet = message->mutable_video_packet();
+
+    // Only the last packet of the frame is acknowledged. The identifiers are changed only by
+    // the encoder thread.
+    const bool acknowledged = frame_end && isVideoAckEnabled();
+    if (acknowledged)
+        video_packet->set_frame_id(++last_frame_id_);
+
+    // The rectangles of the hybrid layers are packed too.
+    if (config_.features() & proto::desktop::FEATURE_PACKED_RECTS)
+        VideoUtil::packDirtyRects(video_packet);
+
+    QByteArray buffer;
+
+    {
+        ScopedTrace trace("serialize", video_packet->trace_id());
+
+        // The message is serialized once for all subscribers.
+        buffer = serializeMessage(*message);
+    }
+    const Clock::time_point send_time = Clock::now();
+
+    frame_bytes_ += buffer.size();
+
+    const qint64 frame_bytes = frame_bytes_;
+    if (frame_end)
+        frame_bytes_ = 0;
+
+    // The moved areas are copied by the client, so such packets are always sent.
+    const bool droppable =
+        video_packet->temporal_layer() != 0 && video_packet->copy_rect_size() == 0;
+
+    std::scoped_lock<std::mutex> lock(lock_);
+
+    for (const auto& subscriber : subscribers_)
+    {
+        // The changes of the frame are encoded again by the next frame of layer 0.
+        if (droppable && dropEnhancementLayer(*subscriber))
+            continue;
+
+        if (frame_end)
+        {
+            ++subscriber->frames_in_flight;
+
+            if (acknowledged)
+            {
+                UnackedFrame frame;
+                frame.frame_id = last_frame_id_;
+                frame.size = frame_bytes;
+                frame.send_time = send_time;
+
+                subscriber->unacked_frames.push_back(frame);
+            }
+        }
+
+        Update update;
+        update.message = buffer;
+        update.video = true;
+        update.frame_end = frame_end;
+        update.key_frame = video_packet->has_format();
+
+        // The frame answers the latest probe which was added before its capture.
+        auto& probes = subscriber->latency_probes;
+        while (frame_end && !probes.empty() && probes.front().inject_time <= update_time)
+        {
+            update.probe_time = probes.front().time;
+            update.probe_delay =
+                std::chrono::duration_cast<std::chrono::microseconds>(
+                    send_time - probes.front().inject_time).count();
+
+            probes.pop_front();
+        }
+
+        queueUpdate(subscriber.get(), std::move(update));
+    }
 }
 
-ScreenUpdater::~ScreenUpdater()
+void ScreenUpdater::postUpdate(const QByteArray& message, bool cursor_reset)
 {
-    terminate_ = true;
-    update();
-    wait();
+    std::scoped_lock<std::mutex> lock(lock_);
+
+    for (const auto& subscriber : subscribers_)
+    {
+        Update update;
+        update.message = message;
+        update.cursor_reset = cursor_reset;
+
+        queueUpdate(subscriber.get(), std::move(update));
+    }
+}
+
+void ScreenUpdater::queueUpdate(Subscriber* subscriber, Update&& update)
+{
+    UpdateQueue* updates = subscriber->updates.get();
+
+    if (updates->overflow_events.load() == 0 && updates->queue.tryPush(std::move(update)))
+    {
+        if (!updates->wakeup_pending.exchange(true))
+            QCoreApplication::postEvent(subscriber->receiver, new UpdateEvent(subscriber->updates));
+        return;
+    }
+
+    // The subscriber takes the queued updates before the update of the event.
+    ++updates->overflow_events;
+    QCoreApplication::postEvent(subscriber->receiver,
+                                new UpdateEvent(subscriber->updates, std::move(update)));
+}
+
+void ScreenUpdater::postError()
+{
+    std::scoped_lock<std::mutex> lock(lock_);
+
+    for (const auto& subscriber : subscribers_)
+        QCoreApplication::postEvent(subscriber->receiver, new ErrorEvent());
+}
+
+std::unique_ptr<CursorEncoder> ScreenUpdater::createCursorEncoder(bool restore_cache) const
+{
+    if (!(config_.features() & proto::desktop::FEATURE_CURSOR_SHAPE))
+        return nullptr;
+
+    const bool large_cache = (config_.features() & proto::desktop::FEATURE_CURSOR_CACHE) != 0;
+
+    std::unique_ptr<CursorEncoder> cursor_encoder = std::make_unique<CursorEncoder>(
+        VideoUtil::compressionForEncoding(config_.video_encoding()), large_cache);
+
+    if (restore_cache && large_cache && config_.cursor_cache_size() != 0)
+    {
+        const std::vector<quint64> hashes(config_.cursor_cache().begin(),
+                                          config_.cursor_cache().end());
+
+        // If the cache of the client does not match, then it is reset by the first cursor.
+        if (!cursor_encoder->restoreClientCache(hashes, config_.cursor_cache_next()))
+            qInfo("Cursor cache of the client is not used");
+    }
+
+    return cursor_encoder;
+}
+
+void ScreenUpdater::runCursorCapture()
+{
+    ScopedThreadRole thread_role(ScopedThreadRole::Role::CAPTURE);
+
+    const bool send_position = (config_.features() & proto::desktop::FEATURE_CURSOR_POSITION) != 0;
+
+    std::unique_ptr<CursorEncoder> cursor_encoder = createCursorEncoder(true);
+    std::unique_ptr<CursorCapturer> cursor_capturer = std::make_unique<CursorCapturer>();
+    QPoint prev_position(-1, -1);
+    QPoint prev_recorded_position(-1, -1);
+
+    proto::desktop::HostToClient message;
+
+    while (true)
+    {
+        QPoint screen_origin;
+        QSize screen_size;
+        QSize frame_size;
+        bool cursor_reset = false;
+
+        {
+            std::unique_lock<std::mutex> lock(lock_);
+
+            // The cursor is not captured for the hidden windows unless it is recorded.
+            if (isPaused() && !recorder_)
+            {
+                cursor_condition_.wait(lock, [this]()
+                {
+                    return terminate_ || !isPaused();
+                });
+            }
+            else
+            {
+                cursor_condition_.wait_for(lock, kCursorCaptureInterval, [this]()
+                {
+                    return terminate_;
+                });
+            }
+
+            if (terminate_)
+                return;
+
+            screen_origin = screen_origin_;
+
+            if (pending_frame_)
+            {
+                screen_size = screen_size_;
+                frame_size = pending_frame_->size();
+            }
+
+            cursor_reset = cursor_reset_pending_;
+            cursor_reset_pending_ = false;
+        }
+
+        if (cursor_reset)
+        {
+            // The new subscriber does not have the cache of the others. The cache is started
+            // again for all subscribers and the current cursor is sent.
+            cursor_encoder = createCursorEncoder(false);
+            cursor_capturer = std::make_unique<CursorCapturer>();
+            prev_position = QPoint(-1, -1);
+        }
+
+        QPoint position;
+        std::unique_ptr<MouseCursor> mouse_cursor;
+
+        if (!cursor_capturer->captureCursor(&position, &mouse_cursor))
+            continue;
+
+        if (recorder_ && (mouse_cursor || position - screen_origin != prev_recorded_position))
+        {
+            prev_recorded_position = position - screen_origin;
+            recorder_->recordCursor(prev_recorded_position, mouse_cursor.get());
+        }
+
+        if (cursor_encoder && mouse_cursor)
+        {
+            std::unique_ptr<proto::desktop::CursorShape> cursor_shape =
+                cursor_encoder->encode(std::move(mouse_cursor));
+
+            if (cursor_shape)
+                message.set_allocated_cursor_shape(cursor_shape.release());
+        }
+
+        position -= screen_origin;
+
+        // The position is sent in the coordinates of the scaled frames.
+        if (frame_size != screen_size)
+        {
+            position = QPoint(position.x() * frame_size.width() / screen_size.width(),
+                              position.y() * frame_size.height() / screen_size.height());
+        }
+
+        if (send_position && position != prev_position)
+        {
+            proto::desktop::CursorPosition* cursor_position = message.mutable_cursor_position();
+            cursor_position->set_x(position.x());
+            cursor_position->set_y(position.y());
+
+            prev_position = position;
+        }
+
+        // The cursor is sent without waiting for the encoder.
+        if (message.has_cursor_shape() || message.has_cursor_position())
+        {
+            const bool cursor_reset = (message.cursor_shape().flags() &
+                                       proto::desktop::CursorShape::RESET_CACHE) != 0;
+
+            postUpdate(serializeMessage(message), cursor_reset);
+            message.Clear();
+        }
+    }
 }
 
-void ScreenUpdater::update()
+QPoint ScreenUpdater::postScreenList(const Capturer* capturer)
 {
-    std::scoped_lock<std::mutex> lock(update_lock_);
-    update_required_ = true;
-    update_condition_.notify_one();
+    Capturer::ScreenList screens;
+
+    if (!screenList(&screens))
+        qWarning("Unable to get the list of screens");
+
+    proto::desktop::ScreenList screen_list;
+
+    proto::desktop::Screen* full_desktop = screen_list.add_screen();
+    full_desktop->set_id(Capturer::kFullDesktopScreenId);
+    full_desktop->set_title("Full Desktop");
+
+    for (const auto& screen : screens)
+    {
+        proto::desktop::Screen* item = screen_list.add_screen();
+        item->set_id(screen.id);
+        item->set_title(screen.title.toStdString());
+    }
+
+    Capturer::ScreenList windows;
+
+    if (!windowList(&windows))
+        qWarning("Unable to get the list of windows");
+
+    for (const auto& window : windows)
+    {
+        proto::desktop::Screen* item = screen_list.add_screen();
+        item->set_id(window.id);
+        item->set_title(window.title.toStdString());
+        item->set_window(true);
+    }
+
+    screen_list.set_current_screen(capturer->currentScreen());
+
+    const QPoint screen_origin = screenRect(capturer->currentScreen()).topLeft();
+
+    std::scoped_lock<std::mutex> lock(lock_);
+
+    screen_origin_ = screen_origin;
+
+    for (const auto& subscriber : subscribers_)
+    {
+        ScreenListEvent* screen_list_event = new ScreenListEvent();
+        screen_list_event->screen_list = screen_list;
+        screen_list_event->screen_origin = screen_origin;
+        QCoreApplication::postEvent(subscriber->receiver, screen_list_event);
+    }
+
+    return screen_origin;
 }
 
 void ScreenUpdater::run()
 {
-    std::unique_ptr<Capturer> capturer = CapturerGDI::create();
+    ScopedCOMInitializer com_initializer(ScopedCOMInitializer::kMTA);
+    ScopedThreadRole thread_role(ScopedThreadRole::Role::CAPTURE);
+
+    HostSettings settings;
+
+    // The recording of the screen is replayed instead of the capture if it is set.
+    const QString replay_file = settings.screenReplayFile();
+    const QString record_file = settings.screenRecordFile();
+
+    std::unique_ptr<Capturer> capturer;
+    bool is_dxgi_capturer = false;
+
+    if (!replay_file.isEmpty())
+    {
+        capturer = CapturerReplay::create(replay_file, CapturerReplay::Speed::ORIGINAL);
+    }
+    else
+    {
+        const QString capturer_type = settings.capturerType();
+
+        // The Desktop Duplication API is available since Windows 8. On earlier versions or if
+        // the duplication can not be created, the GDI capturer is used.
+        if (capturer_type == QLatin1String("dxgi") ||
+            (capturer_type != QLatin1String("gdi") && isDxgiCapturerFaster()))
+        {
+            capturer = CapturerDXGI::create();
+            is_dxgi_capturer = true;
+
+            if (!capturer)
+                qInfo("DXGI capturer is not available. GDI capturer is used");
+        }
+
+        if (!capturer)
+        {
+            capturer = CapturerGDI::create();
+            is_dxgi_capturer = false;
+        }
+    }
+
     if (!capturer)
     {
-        QCoreApplication::postEvent(parent(), new ErrorEvent());
+        postError();
         return;
     }
 
     std::unique_ptr<VideoEncoder> video_encoder;
+    bool texture_input_supported = false;
+
+    // The speed of the client is known only from the acknowledgements.
+    const int temporal_layers = isVideoAckEnabled() ? kTemporalLayers : 1;
 
     switch (config_.video_encoding())
     {
         case proto::desktop::VIDEO_ENCODING_VP8:
-            video_encoder = VideoEncoderVPX::createVP8();
+            video_encoder = VideoEncoderVPX::createVP8(config_.encoder_threads());
             break;
 
         case proto::desktop::VIDEO_ENCODING_VP9:
-            video_encoder = VideoEncoderVPX::createVP9();
+            video_encoder = VideoEncoderVPX::createVP9(config_.encoder_threads(),
+                                                       config_.encoder_tile_columns(),
+                                                       temporal_layers);
+            break;
+
+        case proto::desktop::VIDEO_ENCODING_VP9_LOSSY:
+            video_encoder = VideoEncoderVPX::createVP9Lossy(config_.encoder_threads(),
+                                                            config_.encoder_tile_columns(),
+                                                            temporal_layers);
+            break;
+
+        case proto::desktop::VIDEO_ENCODING_H264:
+        {
+            std::unique_ptr<VideoEncoderH264> h264_encoder = VideoEncoderH264::create();
+
+            texture_input_supported = h264_encoder && h264_encoder->isTextureInputSupported();
+            video_encoder = std::move(h264_encoder);
+        }
+        break;
+
+        case proto::desktop::VIDEO_ENCODING_AV1:
+            video_encoder = VideoEncoderAV1::create(config_.encoder_threads());
             break;
 
         case proto::desktop::VIDEO_ENCODING_ZLIB:
+        case proto::desktop::VIDEO_ENCODING_LZ4:
+        case proto::desktop::VIDEO_ENCODING_ZSTD:
             video_encoder = VideoEncoderZLIB::create(
                 VideoUtil::fromVideoPixelFormat(config_.pixel_format()),
-                                                config_.compress_ratio());
+                config_.compress_ratio(),
+                VideoUtil::compressionForEncoding(config_.video_encoding()),
+                (config_.features() & proto::desktop::FEATURE_ZLIB_CHUNKS) != 0,
+                (config_.features() & proto::desktop::FEATURE_ZLIB_STREAM) != 0);
+            break;
+
+        case proto::desktop::VIDEO_ENCODING_HYBRID:
+            video_encoder = VideoEncoderHybrid::create(
+                VideoEncoderZLIB::create(
+                    VideoUtil::fromVideoPixelFormat(config_.pixel_format()),
+                    config_.compress_ratio(),
+                    proto::desktop::COMPRESSION_ZLIB,
+                    (config_.features() & proto::desktop::FEATURE_ZLIB_CHUNKS) != 0,
+                    (config_.features() & proto::desktop::FEATURE_ZLIB_STREAM) != 0),
+                VideoEncoderVPX::createVP8(config_.encoder_threads(), false));
+            break;
+
+        case proto::desktop::VIDEO_ENCODING_PALETTE:
+            video_encoder = VideoEncoderPalette::create(config_.compress_ratio(),
+                                                        config_.tile_cache_size());
             break;
 
         default:
@@ -74,65 +1786,255 @@ void ScreenUpdater::run()
 
     if (!video_encoder)
     {
-        QCoreApplication::postEvent(parent(), new ErrorEvent());
+        postError();
         return;
     }
 
-    std::unique_ptr<CursorEncoder> cursor_encoder;
+    video_encoder->setQualitySampling(kQualitySampleInterval);
+
+    const bool move_detection_enabled =
+        (config_.features() & proto::desktop::FEATURE_COPY_RECT) != 0;
+
+    capturer->enableMoveDetection(move_detection_enabled);
+
+    if (!record_file.isEmpty())
+        recorder_ = FrameRecorder::create(record_file);
+
+    // The frames of the duplication stay in the video memory up to the encoder if nothing else
+    // reads their pixels: the recorder and the scaling need them in the memory.
+    if (is_dxgi_capturer && texture_input_supported && !recorder_ &&
+        !(config_.features() & proto::desktop::FEATURE_SCALING))
+    {
+        static_cast<CapturerDXGI*>(capturer.get())->enableTextureFrames(true);
+    }
+
+    const PixelFormat gdi_pixel_format = gdiPixelFormat(config_, recorder_ != nullptr);
+
+    if (replay_file.isEmpty() && !is_dxgi_capturer)
+        static_cast<CapturerGDI*>(capturer.get())->setPixelFormat(gdi_pixel_format);
+
+    encode_thread_ = std::thread(&ScreenUpdater::runEncoder, this, std::move(video_encoder));
 
-    if (config_.features() & proto::desktop::FEATURE_CURSOR_SHAPE)
-        cursor_encoder = std::make_unique<CursorEncoder>();
+    if (config_.features() & (proto::desktop::FEATURE_CURSOR_SHAPE |
+                              proto::desktop::FEATURE_CURSOR_POSITION))
+    {
+        cursor_thread_ = std::thread(&ScreenUpdater::runCursorCapture, this);
+    }
 
     CaptureScheduler scheduler;
+    int input_burst_captures = 0;
+
+    // The effort of the encoder is governed only if the budget is set.
+    std::unique_ptr<CpuGovernor> governor;
+    if (settings.cpuBudget() > 0)
+        governor = std::make_unique<CpuGovernor>(settings.cpuBudget());
+
+    std::unique_ptr<MemoryGovernor> memory_governor;
+    if (settings.memoryBudget() > 0)
+    {
+        memory_governor =
+            std::make_unique<MemoryGovernor>(qint64(settings.memoryBudget()) * 1024 * 1024);
+    }
+
+    std::unique_ptr<PowerMonitor> power_monitor;
+    if (settings.isPowerSavingEnabled())
+        power_monitor = std::make_unique<PowerMonitor>();
+
+    Clock::time_point refresh_time = Clock::now();
+    Clock::time_point change_time = refresh_time;
 
-    while (!terminate_)
+    // The captures are numbered only for the traces.
+    quint32 last_trace_id = 0;
+
+    // The screen which the subscribers know. The capturer falls back to the whole desktop if the
+    // screen is disconnected and the captured window may be moved, then the list is sent again.
+    Capturer::ScreenId posted_screen_id = capturer->currentScreen();
+    QPoint posted_origin;
+
+    while (true)
     {
+        bool select_screen = false;
+        bool send_screen_list = false;
+        qint64 screen_id = Capturer::kFullDesktopScreenId;
+
+        {
+            std::scoped_lock<std::mutex> lock(lock_);
+
+            select_screen = screen_selection_pending_;
+            send_screen_list = screen_list_pending_;
+            screen_id = selected_screen_id_;
+
+            screen_selection_pending_ = false;
+            screen_list_pending_ = false;
+        }
+
+        if (select_screen)
+        {
+            if (screenRect(screen_id).isEmpty())
+            {
+                qWarning() << "Attempt to select a nonexistent screen: " << screen_id;
+            }
+            else
+            {
+                capturer->selectScreen(screen_id);
+            }
+        }
+
+        if (select_screen || send_screen_list)
+        {
+            posted_origin = postScreenList(capturer.get());
+            posted_screen_id = capturer->currentScreen();
+        }
+
         scheduler.beginCapture();
 
+        const bool tracing = TraceLogger::isEnabled();
+        const quint32 trace_id = tracing ? ++last_trace_id : 0;
+        const qint64 capture_time = tracing ? TraceLogger::currentTime() : 0;
+
         const DesktopFrame* screen_frame = capturer->captureImage();
-        if (screen_frame)
+
+        if (tracing)
+            TraceLogger::addSpan("capture", capture_time, TraceLogger::currentTime(), trace_id);
+
+        if (!screen_frame && is_dxgi_capturer)
         {
-            std::unique_ptr<proto::desktop::VideoPacket> video_packet;
-            std::unique_ptr<proto::desktop::CursorShape> cursor_shape;
+            qWarning("DXGI capturer failed. Switching to GDI capturer");
+
+            const Capturer::ScreenId current_screen = capturer->currentScreen();
+
+            capturer = CapturerGDI::create();
+            is_dxgi_capturer = false;
 
-            if (!screen_frame->updatedRegion().isEmpty())
-                video_packet = video_encoder->encode(screen_frame);
+            if (!capturer)
+            {
+                postError();
+                break;
+            }
+
+            static_cast<CapturerGDI*>(capturer.get())->setPixelFormat(gdi_pixel_format);
+            capturer->enableMoveDetection(move_detection_enabled);
+            capturer->selectScreen(current_screen);
+            screen_frame = capturer->captureImage();
+        }
+
+        if (screen_frame)
+        {
+            const Capturer::ScreenId current_screen = capturer->currentScreen();
 
-            if (cursor_encoder)
+            if (current_screen != posted_screen_id ||
+                (Capturer::isWindowScreen(current_screen) &&
+                 screenRect(current_screen).topLeft() != posted_origin))
             {
-                std::unique_ptr<MouseCursor> mouse_cursor = capturer->captureCursor();
-                if (mouse_cursor)
-                    cursor_shape = cursor_encoder->encode(std::move(mouse_cursor));
+                posted_origin = postScreenList(capturer.get());
+                posted_screen_id = current_screen;
             }
 
-            if (video_packet || cursor_shape)
+            const bool screen_changed = !screen_frame->updatedRegion().isEmpty() ||
+                                        !screen_frame->moveRects().isEmpty();
+            if (screen_changed)
             {
-                UpdateEvent* update_event = new UpdateEvent();
+                if (recorder_)
+                    recorder_->recordFrame(screen_frame);
 
-                update_event->video_packet = std::move(video_packet);
-                update_event->cursor_shape = std::move(cursor_shape);
+                queueFrame(screen_frame, capturer->focusRegion(), trace_id, capture_time);
+            }
+
+            scheduler.endCapture(screen_changed);
 
-                std::unique_lock<std::mutex> lock(update_lock_);
-                update_required_ = false;
+            const Clock::time_point now = Clock::now();
 
-                QCoreApplication::postEvent(parent(), update_event);
+            if (screen_changed)
+                change_time = now;
 
-                while (!update_required_ && !terminate_)
-                    update_condition_.wait(lock);
+            if (now - refresh_time >= kMaxRefreshInterval ||
+                (now - refresh_time >= kRefreshInterval && now - change_time >= kRefreshIdleTime))
+            {
+                refreshScreenGradually();
+                refresh_time = now;
             }
         }
 
-        std::unique_lock<std::mutex> lock(update_lock_);
-        update_required_ = false;
+        std::unique_lock<std::mutex> lock(lock_);
+
+        // If all slots are taken, then the new frames are merged in the pending frame until the
+        // client or the encoder frees a slot.
+        scheduler.setEncoderLoad(encode_time_, !hasFreeSlots());
 
-        while (!update_required_ && !terminate_)
+        // The encoder takes the effort with the next frame.
+        if (governor && governor->update(encode_time_, updateInterval()))
+            effort_ = governor->effort();
+
+        // The size of the frames is changed with the next captured frame.
+        if (memory_governor && memory_governor->update())
+            memory_degradation_ = memory_governor->level();
+
+        // The rate of the captures, the effort and the idle interval are lowered together.
+        if (power_monitor && power_monitor->update())
         {
-            std::chrono::milliseconds delay =
-                scheduler.nextCaptureDelay(std::chrono::milliseconds(config_.update_interval()));
+            power_saving_ = power_monitor->isPowerSaving();
+            scheduler.setPowerSaving(power_saving_);
+        }
 
-            if (update_condition_.wait_for(lock, delay) == std::cv_status::timeout)
-                break;
+        std::chrono::milliseconds delay = scheduler.nextCaptureDelay(updateInterval());
+
+        const bool input_burst = input_burst_captures > 0;
+        if (input_burst)
+        {
+            --input_burst_captures;
+            delay = std::min(delay, kInputBurstInterval);
+        }
+
+        // The selection of a screen is applied without waiting for the next capture. The input
+        // during the burst extends the burst and does not interrupt the wait.
+        auto resume_capture = [this, input_burst]()
+        {
+            return terminate_ || screen_selection_pending_ || screen_list_pending_ ||
+                (input_pending_ && !input_burst);
+        };
+
+        // While the windows of all subscribers are hidden, the screen is captured only for the
+        // recorder. The capture is resumed when a window is shown.
+        if (isPaused() && !recorder_)
+        {
+            capture_condition_.wait(lock, [this, &resume_capture]()
+            {
+                return resume_capture() || !isPaused();
+            });
         }
+        else
+        {
+            capture_condition_.wait_for(lock, delay, resume_capture);
+        }
+
+        if (terminate_)
+            break;
+
+        if (input_pending_)
+        {
+            input_pending_ = false;
+            input_burst_captures = kInputBurstCaptures;
+            scheduler.markActivity();
+
+            const Clock::time_point capture_time = input_time_ + kInputCaptureDelay;
+
+            lock.unlock();
+            std::this_thread::sleep_until(capture_time);
+        }
+    }
+
+    {
+        std::scoped_lock<std::mutex> lock(lock_);
+        terminate_ = true;
+    }
+
+    encode_condition_.notify_one();
+    encode_thread_.join();
+
+    if (cursor_thread_.joinable())
+    {
+        cursor_condition_.notify_one();
+        cursor_thread_.join();
     }
 }
 
@@ -8,43 +8,197 @@
 #ifndef _ASPIA_HOST__SCREEN_UPDATER_H
 #define _ASPIA_HOST__SCREEN_UPDATER_H
 
+#include <QByteArray>
 #include <QEvent>
+#include <QPoint>
+#include <QRect>
+#include <QRegion>
+#include <QSize>
 #include <QThread>
 
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <deque>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
 
+#include "base/spsc_queue.h"
+#include "desktop_capture/desktop_frame.h"
+#include "network/bandwidth_estimator.h"
 #include "protocol/desktop_session.pb.h"
 
 namespace aspia {
 
+class Capturer;
+class CursorEncoder;
+class FrameRecorder;
+class VideoEncoder;
+
+//
+// The screen is captured and encoded in separate threads. The capture thread accumulates the
+// changes in the pending frame until the encoder takes them. The encoder is started only if
+// every subscriber has fewer than kMaxFramesInFlight frames waiting to be written, so new
+// changes replace the frames that have not been encoded yet.
+//
+// The sessions of the process with the same stream parameters share one updater. The messages
+// are serialized once and the same buffer is posted to all subscribers.
+//
 class ScreenUpdater : public QThread
 {
     Q_OBJECT
 
 public:
-    ScreenUpdater(const proto::desktop::Config& config, QObject* parent);
+    explicit ScreenUpdater(const proto::desktop::Config& config);
     ~ScreenUpdater();
 
-    void update();
+    // Returns the updater of the process for |config| and creates it if necessary. The configs
+    // which differ only in the fields that do not affect the stream (the cursor cache of the
+    // client and the clipboard) share the updater. The updater is destroyed with the last
+    // reference.
+    static std::shared_ptr<ScreenUpdater> acquire(const proto::desktop::Config& config);
+
+    // Starts the measurement of the capturers in the background, so the first updater of the
+    // process does not wait for it after the config of the client is received.
+    static void prepare();
+
+    // The events are posted to all subscribers. A new subscriber gets the screen list and the
+    // whole screen from a key frame. The cursor cache is started again for all subscribers.
+    // The subscriber must be removed before it is destroyed.
+    void addSubscriber(QObject* subscriber);
+    void removeSubscriber(QObject* subscriber);
+
+    // Must be called when the video packet of an Update has been written. If the client
+    // acknowledges the video packets, then the call is ignored.
+    void update(QObject* subscriber);
+
+    // Must be called when the client has decoded the video packet.
+    void acknowledgeFrame(QObject* subscriber, const proto::desktop::VideoAck& video_ack);
+
+    // Must be called when the client reports that the video packets are lost, so they are
+    // never acknowledged.
+    void dropUnackedFrames(QObject* subscriber);
+
+    // Selects the captured screen. The result is reported by a ScreenListEvent.
+    void selectScreen(qint64 screen_id);
+
+    // The screen is not encoded while the windows of all subscribers are hidden, and it is not
+    // captured unless it is recorded. When a window is shown, the whole screen is encoded
+    // again.
+    void setSubscriberVisible(QObject* subscriber, bool visible);
+
+    // The tile encodings send the changes of the visible areas of the subscribers first. The
+    // other changes wait in the pending frame and are sent by slices while no frames are in
+    // flight. The area is in the coordinates of the sent frames, an empty area means the whole
+    // frame.
+    void setSubscriberVisibleArea(QObject* subscriber, const QRect& area);
+
+    // The frames are not encoded while the write queue of a subscriber is full. The changes
+    // are merged in the pending frame, which is encoded when the queue is drained.
+    void setSubscriberBlocked(QObject* subscriber, bool blocked);
+
+    // The level of the degradation by the memory budget of the process (see MemoryGovernor).
+    // The frames are scaled down only for the clients which support the scaling.
+    int memoryDegradation() const { return memory_degradation_; }
+
+    // Must be called when the input of the client is injected. The screen is captured shortly
+    // after the input without waiting for the next scheduled capture.
+    void inputInjected();
+
+    // Must be called after inputInjected() for the events with the probe time. The time is
+    // returned in the Update of the last packet of the first frame which is captured
+    // after the call.
+    void addLatencyProbe(QObject* subscriber, qint64 probe_time);
+
+    // Encodes the whole screen again. The encoders which refer to the previous frames start
+    // from a key frame, so the client is able to recover after an error.
+    void refreshScreen();
+
+    // Refreshes the whole screen in the next frames without the peak of a key frame if the
+    // encoder supports it, otherwise the same as refreshScreen(). The client must have the
+    // previous frames.
+    void refreshScreenGradually();
+
+    // Starts the cursor cache of the subscribers again and sends the current cursor.
+    void refreshCursor();
+
+    // Maps the point of the sent frames to the captured screen. The frames are scaled down if
+    // the client has requested FEATURE_SCALING.
+    QPoint toScreenPoint(const QPoint& point);
+
+    struct Update
+    {
+        // Serialized HostToClient message. The buffer is shared by the subscribers.
+        QByteArray message;
+
+        // True if the message contains a video packet. The cursor messages are not delayed by
+        // the video.
+        bool video = false;
+
+        // False if the video packet is not the last packet of the frame.
+        bool frame_end = true;
+
+        // True if the video packet starts a key frame (it contains the format).
+        bool key_frame = false;
+
+        // True if the cursor shape resets the cursor cache of the client.
+        bool cursor_reset = false;
+
+        // The time of the probe which the frame answers, or zero, and the time (in
+        // microseconds) since the probe was added.
+        qint64 probe_time = 0;
+        qint64 probe_delay = 0;
+    };
+
+private:
+    struct UpdateQueue;
 
+public:
+    // The updates are passed to the thread of the subscriber by a lock-free queue. The event
+    // wakes the subscriber only if it has taken all the previous updates. While the queue is
+    // full, the updates are carried by the events themselves and the queue is not used until
+    // the subscriber takes them, so the order is kept.
     class UpdateEvent : public QEvent
     {
     public:
         static const int kType = QEvent::User + 1;
 
-        UpdateEvent()
+        explicit UpdateEvent(std::shared_ptr<UpdateQueue> queue);
+        UpdateEvent(std::shared_ptr<UpdateQueue> queue, Update&& update);
+
+        // Returns the next update in order. Called by the subscriber until it returns false.
+        bool takeUpdate(Update* update);
+
+    private:
+        std::shared_ptr<UpdateQueue> queue_;
+        std::optional<Update> update_;
+        bool started_ = false;
+
+        Q_DISABLE_COPY(UpdateEvent)
+    };
+
+    // Sent when the capture is started and when the captured screen is changed.
+    class ScreenListEvent : public QEvent
+    {
+    public:
+        static const int kType = QEvent::User + 3;
+
+        ScreenListEvent()
             : QEvent(static_cast<QEvent::Type>(kType))
         {
             // Nothing
         }
 
-        std::unique_ptr<aspia::proto::desktop::VideoPacket> video_packet;
-        std::unique_ptr<aspia::proto::desktop::CursorShape> cursor_shape;
+        aspia::proto::desktop::ScreenList screen_list;
+
+        // Top-left corner of the captured screen in the coordinates of the primary screen.
+        QPoint screen_origin;
 
     private:
-        Q_DISABLE_COPY(UpdateEvent)
+        Q_DISABLE_COPY(ScreenListEvent)
     };
 
     class ErrorEvent : public QEvent
@@ -67,13 +221,208 @@ protected:
     void run() override;
 
 private:
-    std::condition_variable update_condition_;
-    std::mutex update_lock_;
-    bool update_required_ = false;
+    static const int kMaxFramesInFlight = 2;
+
+    typedef std::chrono::steady_clock Clock;
+
+    struct UnackedFrame
+    {
+        quint32 frame_id;
+        qint64 size;
+        Clock::time_point send_time;
+    };
+
+    struct LatencyProbe
+    {
+        qint64 time;
+        Clock::time_point inject_time;
+    };
+
+    struct UpdateQueue
+    {
+        explicit UpdateQueue(size_t size)
+            : queue(size)
+        {
+            // Nothing
+        }
+
+        SpscQueue<Update> queue;
+
+        // An event which takes the updates is posted to the subscriber.
+        std::atomic<bool> wakeup_pending { false };
+
+        // The events which carry the updates and which are not taken yet.
+        std::atomic<int> overflow_events { 0 };
+    };
+
+    struct Subscriber
+    {
+        explicit Subscriber(QObject* receiver)
+            : receiver(receiver)
+        {
+            // Nothing
+        }
+
+        QObject* const receiver;
+        int frames_in_flight = 0;
+
+        // Video packets waiting for VideoAck.
+        std::deque<UnackedFrame> unacked_frames;
+
+        BandwidthEstimator bandwidth_estimator;
+
+        // Smoothed time of the delivery and decoding of the video packets by the client.
+        std::chrono::milliseconds rtt{ 0 };
+        std::chrono::milliseconds decode_time{ 0 };
+
+        // The window of the client is minimized or hidden.
+        bool hidden = false;
+
+        // The part of the frames which the window of the client shows, or empty for the whole
+        // frame.
+        QRect visible_area;
+
+        // The write queue of the subscriber is above its high watermark.
+        bool blocked = false;
+
+        // The probes of the injected input which are not answered by a frame yet.
+        std::deque<LatencyProbe> latency_probes;
+
+        std::shared_ptr<UpdateQueue> updates;
+    };
+
+    bool isVideoAckEnabled() const;
+
+    // The following methods must be called with |lock_| held.
+    Subscriber* findSubscriber(QObject* receiver);
+    bool isPaused() const;
+    bool hasFreeSlots() const;
+    bool isIdle() const;
+
+    // Returns the union of the visible areas of the subscribers, or an empty region if a
+    // subscriber shows the whole frame.
+    QRegion visibleArea() const;
+
+    // Returns true if the pending frame has the moves or the changes which are visible to a
+    // subscriber. If |crop| is false, then all changes are visible.
+    bool hasVisibleChanges(bool crop) const;
+    qint64 bandwidth() const;
+    std::chrono::milliseconds updateInterval() const;
+
+    // The effort of CpuGovernor limited in the power saving mode.
+    int encoderEffort() const;
+
+    // Returns true if the frames of temporal layer 1 must not be sent to the subscriber.
+    bool dropEnhancementLayer(const Subscriber& subscriber) const;
+
+    void queueFrame(const DesktopFrame* frame,
+                    const QRegion& focus_region,
+                    quint32 trace_id,
+                    qint64 capture_time);
+    void runEncoder(std::unique_ptr<VideoEncoder> video_encoder);
+    void runCursorCapture();
+    std::unique_ptr<CursorEncoder> createCursorEncoder(bool restore_cache) const;
+
+    // Returns the size of the sent frames for the captured size.
+    QSize scaledSize(const QSize& screen_size) const;
+    // Must be called with |lock_| held, which serializes the producers of the queue.
+    void queueUpdate(Subscriber* subscriber, Update&& update);
+
+    void postVideoPacket(proto::desktop::HostToClient* message,
+                         bool frame_end,
+                         Clock::time_point update_time);
+    void postUpdate(const QByteArray& message, bool cursor_reset);
+    // Returns the origin of the current screen which is sent to the subscribers.
+    QPoint postScreenList(const Capturer* capturer);
+    void postError();
+
+    std::thread encode_thread_;
+
+    // The cursor is captured in its own thread more often than the screen.
+    std::thread cursor_thread_;
+
+    std::mutex lock_;
+    std::condition_variable capture_condition_;
+    std::condition_variable encode_condition_;
+    std::condition_variable cursor_condition_;
     bool terminate_ = false;
 
+    std::vector<std::unique_ptr<Subscriber>> subscribers_;
+
+    // A subscriber has been added. The screen list is posted again and the cursor encoder
+    // starts with an empty cache.
+    bool screen_list_pending_ = false;
+    bool cursor_reset_pending_ = false;
+
+    // The screen requested by selectScreen() which has not been applied to the capturer yet.
+    bool screen_selection_pending_ = false;
+    qint64 selected_screen_id_ = -1;
+
+    // Top-left corner of the captured screen in the coordinates of the virtual screen.
+    QPoint screen_origin_;
+
+    // The input injected since the last capture.
+    bool input_pending_ = false;
+    Clock::time_point input_time_;
+
+    // The encoder must start from a key frame.
+    bool refresh_pending_ = false;
+
+    // The encoder refreshes the screen gradually with the next frames.
+    bool intra_refresh_pending_ = false;
+
+    // The identifiers of the frames are common for all subscribers.
+    quint32 last_frame_id_ = 0;
+
+    // Smoothed time of the encoding of a frame.
+    std::chrono::milliseconds encode_time_{ 0 };
+
+    // The effort of the encoder chosen by CpuGovernor. See VideoEncoder::setEffort().
+    int effort_ = 0;
+
+    // The computer runs on the battery (see PowerMonitor).
+    bool power_saving_ = false;
+
+    // The level of the degradation chosen by MemoryGovernor.
+    std::atomic_int memory_degradation_{ 0 };
+
+    // Size of the packets of the current frame. Used only by the encoder thread.
+    qint64 frame_bytes_ = 0;
+
+    // Copy of the last captured image. Its updated region and move rectangles contain the
+    // changes which have not been encoded yet. If the screen is scaled, then the pending frame
+    // has the scaled size. If the captured frames are in the video memory, then the pending
+    // frame is there too.
+    std::unique_ptr<DesktopFrame> pending_frame_;
+
+    // Size of the captured screen of the pending frame.
+    QSize screen_size_;
+
+    // The first capture of the changes of the pending frame if tracing is enabled.
+    quint32 pending_trace_id_ = 0;
+    qint64 pending_capture_time_ = 0;
+
+    // The last capture of the changes of the pending frame.
+    Clock::time_point pending_update_time_;
+
+    // Areas around the cursor and the foreground window at the capture of the pending frame.
+    QRegion focus_region_;
+
     proto::desktop::Config config_;
 
+    // The smallest of the limits of the client and the host in bytes per second or 0.
+    qint64 bandwidth_limit_ = 0;
+
+    // The largest packet of the encodings which split the frames. Each packet is sent as soon
+    // as it is encoded.
+    int max_packet_pixels_;
+
+    // The bandwidth of the previous session of the client in bytes per second or 0.
+    qint64 initial_bandwidth_ = 0;
+
+    // Records the captured frames and the cursor if it is enabled in the settings.
+    std::unique_ptr<FrameRecorder> recorder_;
+
     Q_DISABLE_COPY(ScreenUpdater)
 };
 
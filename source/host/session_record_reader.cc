@@ -0,0 +1,265 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/session_record_reader.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "host/session_record_reader.h"
+
+#include <QDebug>
+
+#include <algorithm>
+
+#include "base/message_serialization.h"
+#include "protocol/desktop_session.pb.h"
+
+namespace aspia {
+
+namespace {
+
+// The size of the trailer: qint64 offset of the index and quint32 magic.
+constexpr qint64 kTrailerSize = 12;
+
+// The key frames and the resets of the cursor cache are found in the same way as by the
+// recorder.
+bool isKeyFrame(const QByteArray& buffer)
+{
+    proto::desktop::HostToClient message;
+
+    if (!parseMessage(buffer, message))
+        return false;
+
+    return message.video_packet().has_format();
+}
+
+bool isCursorReset(const QByteArray& buffer)
+{
+    proto::desktop::HostToClient message;
+
+    if (!parseMessage(buffer, message))
+        return false;
+
+    return (message.cursor_shape().flags() & proto::desktop::CursorShape::RESET_CACHE) != 0;
+}
+
+} // namespace
+
+SessionRecordReader::SessionRecordReader(std::unique_ptr<QFile> file, qint64 start_time)
+    : file_(std::move(file)),
+      stream_(file_.get()),
+      start_time_(start_time)
+{
+    stream_.setVersion(QDataStream::Qt_5_0);
+    stream_.setByteOrder(QDataStream::LittleEndian);
+}
+
+// static
+std::unique_ptr<SessionRecordReader> SessionRecordReader::open(const QString& file_path)
+{
+    std::unique_ptr<QFile> file = std::make_unique<QFile>(file_path);
+
+    if (!file->open(QFile::ReadOnly))
+    {
+        qWarning() << "Unable to open the recording" << file_path << ":" << file->errorString();
+        return nullptr;
+    }
+
+    QDataStream stream(file.get());
+    stream.setVersion(QDataStream::Qt_5_0);
+    stream.setByteOrder(QDataStream::LittleEndian);
+
+    quint32 magic;
+    quint32 version;
+    qint64 start_time;
+
+    stream >> magic >> version >> start_time;
+
+    if (stream.status() != QDataStream::Ok ||
+        magic != SessionRecorder::kMagic || version != SessionRecorder::kVersion)
+    {
+        qWarning() << "Unsupported recording" << file_path;
+        return nullptr;
+    }
+
+    const qint64 records_offset = file->pos();
+
+    std::unique_ptr<SessionRecordReader> reader(
+        new SessionRecordReader(std::move(file), start_time));
+
+    reader->records_offset_ = records_offset;
+
+    if (!reader->readIndex())
+    {
+        qInfo() << "Index of the recording is not found, reading all records";
+        reader->buildIndex();
+    }
+
+    if (!reader->seek(0))
+        return nullptr;
+
+    return reader;
+}
+
+bool SessionRecordReader::seek(qint64 time)
+{
+    if (index_.empty())
+        return false;
+
+    // The first key frame is used for the time before it.
+    auto entry = std::upper_bound(index_.cbegin(), index_.cend(), time,
+                                  [](qint64 time, const SessionRecorder::IndexEntry& entry)
+    {
+        return time < entry.time;
+    });
+
+    if (entry != index_.cbegin())
+        --entry;
+
+    key_offset_ = entry->key_offset;
+
+    stream_.resetStatus();
+    return file_->seek(qMin(entry->cursor_offset, entry->key_offset));
+}
+
+bool SessionRecordReader::readRecord(Record* record)
+{
+    while (file_->pos() < records_end_)
+    {
+        const bool before_key_frame = file_->pos() < key_offset_;
+
+        if (!readRecordAt(record))
+            return false;
+
+        // The frames before the key frame are not decoded.
+        if (!before_key_frame || record->type == SessionRecorder::CursorRecord)
+            return true;
+    }
+
+    return false;
+}
+
+bool SessionRecordReader::readIndex()
+{
+    const qint64 file_size = file_->size();
+    if (file_size < records_offset_ + kTrailerSize)
+        return false;
+
+    file_->seek(file_size - kTrailerSize);
+
+    qint64 index_offset;
+    quint32 magic;
+
+    stream_ >> index_offset >> magic;
+
+    if (stream_.status() != QDataStream::Ok || magic != SessionRecorder::kMagic ||
+        index_offset < records_offset_ || index_offset > file_size - kTrailerSize)
+    {
+        stream_.resetStatus();
+        return false;
+    }
+
+    file_->seek(index_offset);
+
+    quint8 type;
+    quint32 count;
+
+    stream_ >> type >> count;
+
+    if (stream_.status() != QDataStream::Ok || type != SessionRecorder::IndexRecord)
+    {
+        stream_.resetStatus();
+        return false;
+    }
+
+    std::vector<SessionRecorder::IndexEntry> index;
+
+    for (quint32 i = 0; i < count; ++i)
+    {
+        SessionRecorder::IndexEntry entry;
+
+        stream_ >> entry.time >> entry.key_offset >> entry.cursor_offset;
+
+        if (stream_.status() != QDataStream::Ok ||
+            entry.key_offset < records_offset_ || entry.key_offset >= index_offset ||
+            entry.cursor_offset < records_offset_ || entry.cursor_offset >= index_offset)
+        {
+            stream_.resetStatus();
+            return false;
+        }
+
+        index.push_back(entry);
+    }
+
+    index_ = std::move(index);
+    records_end_ = index_offset;
+
+    // The duration is the time of the last record before the index.
+    file_->seek(index_.empty() ? records_offset_ : index_.back().key_offset);
+    key_offset_ = 0;
+
+    Record record;
+    while (file_->pos() < records_end_ && readRecordAt(&record))
+        duration_ = record.time;
+
+    return true;
+}
+
+void SessionRecordReader::buildIndex()
+{
+    index_.clear();
+    records_end_ = file_->size();
+    duration_ = 0;
+
+    file_->seek(records_offset_);
+    stream_.resetStatus();
+
+    qint64 cursor_offset = -1;
+
+    Record record;
+
+    // The interrupted recording ends with an incomplete record.
+    for (;;)
+    {
+        const qint64 offset = file_->pos();
+
+        if (offset >= records_end_ || !readRecordAt(&record))
+        {
+            records_end_ = offset;
+            break;
+        }
+
+        duration_ = record.time;
+
+        if (record.type == SessionRecorder::CursorRecord)
+        {
+            if (isCursorReset(record.message))
+                cursor_offset = offset;
+        }
+        else if (isKeyFrame(record.message))
+        {
+            const qint64 entry_cursor_offset = (cursor_offset != -1) ? cursor_offset : offset;
+            index_.push_back({ record.time, offset, entry_cursor_offset });
+        }
+    }
+
+    stream_.resetStatus();
+}
+
+bool SessionRecordReader::readRecordAt(Record* record)
+{
+    quint8 type;
+
+    stream_ >> type >> record->time >> record->message;
+
+    if (stream_.status() != QDataStream::Ok ||
+        (type != SessionRecorder::VideoRecord && type != SessionRecorder::CursorRecord))
+    {
+        return false;
+    }
+
+    record->type = static_cast<SessionRecorder::RecordType>(type);
+    return true;
+}
+
+} // namespace aspia
@@ -0,0 +1,86 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/session_record_reader.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_HOST__SESSION_RECORD_READER_H
+#define _ASPIA_HOST__SESSION_RECORD_READER_H
+
+#include <QDataStream>
+#include <QFile>
+
+#include <memory>
+#include <vector>
+
+#include "host/session_recorder.h"
+
+namespace aspia {
+
+//
+// Reads the recordings of SessionRecorder. The messages are decoded as the messages of the
+// host by the desktop client. If the recording was not closed, then the index is built by
+// reading all records.
+//
+class SessionRecordReader
+{
+public:
+    ~SessionRecordReader() = default;
+
+    struct Record
+    {
+        SessionRecorder::RecordType type = SessionRecorder::VideoRecord;
+
+        // Time since the start of the recording in milliseconds.
+        qint64 time = 0;
+
+        // Serialized HostToClient message.
+        QByteArray message;
+    };
+
+    // Returns nullptr if the file is not a recording.
+    static std::unique_ptr<SessionRecordReader> open(const QString& file_path);
+
+    // The start of the recording in milliseconds since the epoch in UTC.
+    qint64 startTime() const { return start_time_; }
+
+    // The time of the last record.
+    qint64 duration() const { return duration_; }
+
+    // Moves to the last key frame at or before |time|. The next records are the cursor records
+    // which restore the cursor cache and then all records from the key frame, so the client
+    // must decode them from an empty frame and an empty cursor cache.
+    bool seek(qint64 time);
+
+    // Reads the next record. Returns false at the end of the recording or on error.
+    bool readRecord(Record* record);
+
+private:
+    SessionRecordReader(std::unique_ptr<QFile> file, qint64 start_time);
+
+    bool readIndex();
+    void buildIndex();
+    bool readRecordAt(Record* record);
+
+    std::unique_ptr<QFile> file_;
+    QDataStream stream_;
+
+    const qint64 start_time_;
+    qint64 duration_ = 0;
+
+    // The offset of the first record and the offset of the end of the records.
+    qint64 records_offset_ = 0;
+    qint64 records_end_ = 0;
+
+    std::vector<SessionRecorder::IndexEntry> index_;
+
+    // Before this offset only the cursor records are returned after the seeking.
+    qint64 key_offset_ = 0;
+
+    Q_DISABLE_COPY(SessionRecordReader)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_HOST__SESSION_RECORD_READER_H
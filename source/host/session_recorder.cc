@@ -0,0 +1,125 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/session_recorder.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "host/session_recorder.h"
+
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QDebug>
+#include <QDir>
+
+namespace aspia {
+
+namespace {
+
+// The period of the key frames which are the points of the seeking.
+constexpr qint64 kKeyFrameInterval = 60 * 1000; // 60 seconds
+
+} // namespace
+
+SessionRecorder::SessionRecorder(std::unique_ptr<QFile> file)
+    : file_(std::move(file)),
+      stream_(file_.get())
+{
+    stream_.setVersion(QDataStream::Qt_5_0);
+    stream_.setByteOrder(QDataStream::LittleEndian);
+
+    stream_ << kMagic << kVersion << qint64(QDateTime::currentMSecsSinceEpoch());
+    timer_.start();
+}
+
+SessionRecorder::~SessionRecorder()
+{
+    const qint64 index_offset = file_->pos();
+
+    stream_ << quint8(IndexRecord) << quint32(index_.size());
+
+    for (const auto& entry : index_)
+        stream_ << entry.time << entry.key_offset << entry.cursor_offset;
+
+    stream_ << index_offset << kMagic;
+
+    if (stream_.status() != QDataStream::Ok)
+        qWarning() << "Unable to write the recording" << file_->fileName();
+}
+
+// static
+std::unique_ptr<SessionRecorder> SessionRecorder::create(const QString& directory_path)
+{
+    QDir directory(directory_path);
+
+    if (!directory.exists() && !directory.mkpath(QStringLiteral(".")))
+    {
+        qWarning() << "Unable to create the directory of the recordings" << directory_path;
+        return nullptr;
+    }
+
+    // The process serves one session, so its identifier makes the name unique.
+    const QString file_name = QStringLiteral("%1-%2.aspia-session")
+        .arg(QDateTime::currentDateTime().toString(QStringLiteral("yyyyMMdd-HHmmss")))
+        .arg(QCoreApplication::applicationPid());
+
+    std::unique_ptr<QFile> file = std::make_unique<QFile>(directory.absoluteFilePath(file_name));
+
+    if (!file->open(QFile::WriteOnly | QFile::Truncate))
+    {
+        qWarning() << "Unable to create the recording" << file->fileName() << ":"
+                   << file->errorString();
+        return nullptr;
+    }
+
+    qInfo() << "Recording the session to" << file->fileName();
+    return std::unique_ptr<SessionRecorder>(new SessionRecorder(std::move(file)));
+}
+
+void SessionRecorder::recordVideo(const QByteArray& message, bool key_frame)
+{
+    if (key_frame)
+    {
+        const qint64 time = timer_.elapsed();
+        const qint64 offset = file_->pos();
+
+        // Without the reset the cursor is restored from the key frame.
+        index_.push_back({ time, offset, cursor_offset_ != -1 ? cursor_offset_ : offset });
+
+        video_started_ = true;
+        key_frame_time_ = time;
+    }
+
+    // The packets before the first key frame can not be decoded.
+    if (video_started_)
+        writeRecord(VideoRecord, message);
+}
+
+void SessionRecorder::recordCursor(const QByteArray& message, bool cursor_reset)
+{
+    if (cursor_reset)
+        cursor_offset_ = file_->pos();
+
+    // The cursors before the first reset may refer to the cache of the previous sessions.
+    if (cursor_offset_ != -1)
+        writeRecord(CursorRecord, message);
+}
+
+bool SessionRecorder::isKeyFrameNeeded()
+{
+    const qint64 time = timer_.elapsed();
+
+    // The key frame is requested again if it is not received in the period.
+    if (time - key_frame_time_ < kKeyFrameInterval)
+        return false;
+
+    key_frame_time_ = time;
+    return true;
+}
+
+void SessionRecorder::writeRecord(RecordType type, const QByteArray& message)
+{
+    stream_ << quint8(type) << qint64(timer_.elapsed()) << message;
+}
+
+} // namespace aspia
@@ -0,0 +1,97 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/session_recorder.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_HOST__SESSION_RECORDER_H
+#define _ASPIA_HOST__SESSION_RECORDER_H
+
+#include <QDataStream>
+#include <QElapsedTimer>
+#include <QFile>
+
+#include <memory>
+#include <vector>
+
+namespace aspia {
+
+//
+// Writes the messages of the desktop session as they are sent to the client, so the recording
+// does not capture or encode the screen again. The messages are the serialized HostToClient
+// messages with the video packets and with the cursor. The file is played by
+// SessionRecordReader.
+//
+// The file starts with kMagic, kVersion and the start time (qint64 milliseconds since the
+// epoch in UTC). Each record contains:
+//   quint8 type (VideoRecord or CursorRecord), qint64 time since the start in milliseconds,
+//   QByteArray message.
+// The recording starts with a key frame. The key frames are requested periodically, the
+// cursor cache of the client is reset with them. When the recording is closed, the index is
+// written as an IndexRecord:
+//   quint8 IndexRecord, quint32 count, count x (qint64 time, qint64 key frame offset,
+//   qint64 cursor offset),
+// followed by qint64 offset of the index record and kMagic. The cursor offset is the offset
+// of the last reset of the cursor cache before the key frame. The cursor records from it
+// restore the cursor cache.
+//
+class SessionRecorder
+{
+public:
+    ~SessionRecorder();
+
+    static const quint32 kMagic = 0x53505341; // "ASPS"
+    static const quint32 kVersion = 1;
+
+    enum RecordType : quint8
+    {
+        VideoRecord = 1,
+        CursorRecord = 2,
+        IndexRecord = 3
+    };
+
+    struct IndexEntry
+    {
+        qint64 time;
+        qint64 key_offset;
+        qint64 cursor_offset;
+    };
+
+    // Creates the file of the recording in |directory_path|. Returns nullptr if the file can
+    // not be created.
+    static std::unique_ptr<SessionRecorder> create(const QString& directory_path);
+
+    // Records the serialized message. |key_frame| is true if the message starts a key frame
+    // and |cursor_reset| is true if the message resets the cursor cache.
+    void recordVideo(const QByteArray& message, bool key_frame);
+    void recordCursor(const QByteArray& message, bool cursor_reset);
+
+    // Returns true if a key frame and a reset of the cursor cache must be requested. Returns
+    // true once for each period of the key frames.
+    bool isKeyFrameNeeded();
+
+private:
+    explicit SessionRecorder(std::unique_ptr<QFile> file);
+
+    void writeRecord(RecordType type, const QByteArray& message);
+
+    std::unique_ptr<QFile> file_;
+    QDataStream stream_;
+    QElapsedTimer timer_;
+
+    // The video is written from the first key frame, the cursor from the first reset.
+    bool video_started_ = false;
+    qint64 cursor_offset_ = -1;
+
+    // The time of the last key frame or the last request of it.
+    qint64 key_frame_time_ = 0;
+
+    std::vector<IndexEntry> index_;
+
+    Q_DISABLE_COPY(SessionRecorder)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_HOST__SESSION_RECORDER_H
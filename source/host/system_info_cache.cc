@@ -0,0 +1,171 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/system_info_cache.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "host/system_info_cache.h"
+
+#include <QDebug>
+#include <QThread>
+
+#include "system_info/category.h"
+
+namespace aspia {
+
+namespace {
+
+// The collected data is replied again during this time.
+constexpr qint64 kCacheTime = 60000; // 60 seconds
+
+} // namespace
+
+class SystemInfoCache::Thread : public QThread
+{
+public:
+    explicit Thread(SystemInfoCache* cache)
+        : cache_(cache)
+    {
+        // Nothing
+    }
+
+protected:
+    // QThread implementation.
+    void run() override { cache_->run(); }
+
+private:
+    SystemInfoCache* cache_;
+
+    Q_DISABLE_COPY(Thread)
+};
+
+SystemInfoCache::SystemInfoCache(QObject* parent)
+    : QObject(parent),
+      categories_(Category::createAll())
+{
+    clock_.start();
+
+    connect(this, &SystemInfoCache::collected,
+            this, &SystemInfoCache::onCollected,
+            Qt::QueuedConnection);
+
+    thread_ = std::make_unique<Thread>(this);
+    thread_->start(QThread::LowPriority);
+}
+
+SystemInfoCache::~SystemInfoCache()
+{
+    {
+        QMutexLocker locker(&queue_lock_);
+        terminating_ = true;
+        queue_event_.wakeAll();
+    }
+
+    // The category which is being collected is finished.
+    thread_->wait();
+}
+
+QStringList SystemInfoCache::categoryList() const
+{
+    QStringList list;
+
+    for (const auto& category : categories_)
+        list.push_back(QString::fromLatin1(category->uuid()));
+
+    return list;
+}
+
+void SystemInfoCache::prefetch(const QStringList& uuids)
+{
+    for (const auto& uuid : uuids)
+    {
+        if (!isCached(uuid))
+            collect(uuid);
+    }
+}
+
+void SystemInfoCache::request(const QString& uuid)
+{
+    if (!category(uuid))
+    {
+        qWarning() << "Unknown category:" << uuid;
+        emit categoryReady(uuid, QByteArray());
+        return;
+    }
+
+    if (isCached(uuid))
+    {
+        emit categoryReady(uuid, cache_[uuid].data);
+        return;
+    }
+
+    requested_.insert(uuid);
+    collect(uuid);
+}
+
+void SystemInfoCache::onCollected(const QString& uuid, const QByteArray& data)
+{
+    pending_.remove(uuid);
+    cache_.insert(uuid, CacheEntry{ data, clock_.elapsed() });
+
+    if (requested_.remove(uuid))
+        emit categoryReady(uuid, data);
+}
+
+Category* SystemInfoCache::category(const QString& uuid) const
+{
+    for (const auto& category : categories_)
+    {
+        if (uuid == QLatin1String(category->uuid()))
+            return category.get();
+    }
+
+    return nullptr;
+}
+
+bool SystemInfoCache::isCached(const QString& uuid) const
+{
+    auto it = cache_.constFind(uuid);
+    return it != cache_.constEnd() && clock_.elapsed() - it->time < kCacheTime;
+}
+
+void SystemInfoCache::collect(const QString& uuid)
+{
+    if (!category(uuid) || pending_.contains(uuid))
+        return;
+
+    pending_.insert(uuid);
+
+    QMutexLocker locker(&queue_lock_);
+    queue_.push_back(uuid);
+    queue_event_.wakeAll();
+}
+
+void SystemInfoCache::run()
+{
+    for (;;)
+    {
+        QString uuid;
+
+        {
+            QMutexLocker locker(&queue_lock_);
+
+            while (queue_.empty() && !terminating_)
+                queue_event_.wait(&queue_lock_);
+
+            if (terminating_)
+                return;
+
+            uuid = queue_.front();
+            queue_.pop_front();
+        }
+
+        // The list of the categories is not changed after the construction.
+        const std::string data = category(uuid)->collect();
+
+        emit collected(uuid, QByteArray::fromStdString(data));
+    }
+}
+
+} // namespace aspia
@@ -0,0 +1,99 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/system_info_cache.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_HOST__SYSTEM_INFO_CACHE_H
+#define _ASPIA_HOST__SYSTEM_INFO_CACHE_H
+
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QMutex>
+#include <QObject>
+#include <QSet>
+#include <QStringList>
+#include <QWaitCondition>
+
+#include <deque>
+#include <memory>
+#include <vector>
+
+class QThread;
+
+namespace aspia {
+
+class Category;
+
+//
+// Collects the categories of the system information in a background thread and keeps the
+// collected data for a while, so the repeated requests are replied at once. The categories may
+// be collected before they are requested.
+//
+class SystemInfoCache : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit SystemInfoCache(QObject* parent = nullptr);
+    ~SystemInfoCache();
+
+    QStringList categoryList() const;
+
+    // Collects |uuids| in the background if they are not cached.
+    void prefetch(const QStringList& uuids);
+
+    // categoryReady() is emitted when the category is collected, or at once if it is cached. For
+    // an unknown category the data is empty.
+    void request(const QString& uuid);
+
+signals:
+    void categoryReady(const QString& uuid, const QByteArray& data);
+
+    // Emitted by the collecting thread.
+    void collected(const QString& uuid, const QByteArray& data);
+
+private slots:
+    void onCollected(const QString& uuid, const QByteArray& data);
+
+private:
+    class Thread;
+
+    Category* category(const QString& uuid) const;
+    bool isCached(const QString& uuid) const;
+    void collect(const QString& uuid);
+
+    // Called in the collecting thread.
+    void run();
+
+    struct CacheEntry
+    {
+        QByteArray data;
+        qint64 time;
+    };
+
+    std::vector<std::unique_ptr<Category>> categories_;
+
+    QHash<QString, CacheEntry> cache_;
+    QElapsedTimer clock_;
+
+    // The categories which are being collected and the categories which are waited for.
+    QSet<QString> pending_;
+    QSet<QString> requested_;
+
+    // The queue of the collecting thread.
+    QMutex queue_lock_;
+    QWaitCondition queue_event_;
+    std::deque<QString> queue_;
+    bool terminating_ = false;
+
+    std::unique_ptr<QThread> thread_;
+
+    Q_DISABLE_COPY(SystemInfoCache)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_HOST__SYSTEM_INFO_CACHE_H
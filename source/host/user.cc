@@ -7,8 +7,7 @@
 
 #include "host/user.h"
 
-#include <QCryptographicHash>
-
+#include "crypto/password_hash.h"
 #include "crypto/secure_memory.h"
 
 namespace aspia {
@@ -41,20 +40,6 @@ bool isValidPasswordHash(const QByteArray& password_hash)
     return true;
 }
 
-QByteArray createPasswordHash(const QString& password)
-{
-    static const int kIterCount = 100000;
-
-    QByteArray data = password.toUtf8();
-
-    for (int i = 0; i < kIterCount; ++i)
-    {
-        data = QCryptographicHash::hash(data, QCryptographicHash::Sha512);
-    }
-
-    return data;
-}
-
 } // namespace
 
 User::~User()
@@ -105,7 +90,20 @@ bool User::setPassword(const QString& value)
     if (!isValidPassword(value))
         return false;
 
-    password_hash_ = createPasswordHash(value);
+    QByteArray salt = PasswordHash::createSalt();
+    QByteArray password_hash = PasswordHash::create(
+        value, salt, PasswordHash::kDefaultOpsLimit, PasswordHash::kDefaultMemLimit);
+    if (password_hash.isEmpty())
+        return false;
+
+    secureMemZero(&password_hash_);
+
+    password_hash_ = password_hash;
+    password_salt_ = salt;
+    ops_limit_ = PasswordHash::kDefaultOpsLimit;
+    mem_limit_ = PasswordHash::kDefaultMemLimit;
+
+    secureMemZero(&password_hash);
     return true;
 }
 
@@ -118,6 +116,21 @@ bool User::setPasswordHash(const QByteArray& value)
     return true;
 }
 
+bool User::setPasswordHashing(const QByteArray& salt, quint32 ops_limit, quint32 mem_limit)
+{
+    if (!salt.isEmpty() &&
+        (salt.size() != PasswordHash::kSaltSize ||
+         !PasswordHash::isValidLimits(ops_limit, mem_limit)))
+    {
+        return false;
+    }
+
+    password_salt_ = salt;
+    ops_limit_ = ops_limit;
+    mem_limit_ = mem_limit;
+    return true;
+}
+
 void User::setFlags(quint32 value)
 {
     flags_ = value;
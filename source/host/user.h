@@ -30,10 +30,18 @@ public:
     bool setName(const QString& value);
     const QString& name() const { return name_; }
 
+    // Computes the hash of the password by Argon2id with a new salt.
     bool setPassword(const QString& value);
     bool setPasswordHash(const QByteArray& value);
     const QByteArray& passwordHash() const { return password_hash_; }
 
+    // The parameters of the Argon2id hash. If the salt is empty, then the hash is created by the
+    // previous versions (PasswordHash::createLegacy).
+    bool setPasswordHashing(const QByteArray& salt, quint32 ops_limit, quint32 mem_limit);
+    const QByteArray& passwordSalt() const { return password_salt_; }
+    quint32 opsLimit() const { return ops_limit_; }
+    quint32 memLimit() const { return mem_limit_; }
+
     void setFlags(quint32 value);
     quint32 flags() const { return flags_; }
 
@@ -43,6 +51,9 @@ public:
 private:
     QString name_;
     QByteArray password_hash_;
+    QByteArray password_salt_;
+    quint32 ops_limit_ = 0;
+    quint32 mem_limit_ = 0;
     quint32 flags_ = 0;
     quint32 sessions_ = 0;
 };
@@ -12,7 +12,10 @@
 
 #include <QCoreApplication>
 
+#include "base/message_serialization.h"
 #include "host/win/host_process.h"
+#include "host/win/host_process_group.h"
+#include "host/win/host_process_pool.h"
 #include "host/host_session_fake.h"
 #include "ipc/ipc_channel.h"
 #include "ipc/ipc_server.h"
@@ -24,6 +27,15 @@ namespace {
 
 enum MessageId { IpcMessageId, NetworkMessageId };
 
+// The number of messages which are read from one channel before the other channel has written
+// them. The next message is relayed while the previous ones are still being written, so the
+// relay does not add a round trip of each message to the latency. The reading also waits while
+// the write queue of the other channel is full, so the large messages do not pile up in it.
+constexpr int kMaxRelayedMessages = 16;
+
+// The time during which the client may resume the session after the loss of the connection.
+constexpr std::chrono::seconds kSuspendTimeout{ 60 };
+
 } // namespace
 
 Host::Host(QObject* parent)
@@ -35,6 +47,7 @@ Host::Host(QObject* parent)
 Host::~Host()
 {
     stop();
+    releaseNetworkChannel();
 }
 
 void Host::setNetworkChannel(NetworkChannel* network_channel)
@@ -52,7 +65,7 @@ void Host::setNetworkChannel(NetworkChannel* network_channel)
     }
 
     network_channel_ = network_channel;
-    network_channel_->setParent(this);
+    remote_address_ = network_channel_->peerAddress();
 }
 
 void Host::setSessionType(proto::auth::SessionType session_type)
@@ -88,9 +101,25 @@ void Host::setUuid(const QString& uuid)
     uuid_ = uuid;
 }
 
-QString Host::remoteAddress() const
+void Host::setResumeTicket(const QByteArray& resume_ticket)
+{
+    if (state_ != StoppedState)
+    {
+        qWarning("An attempt to set a resume ticket in an already running host.");
+        return;
+    }
+
+    resume_ticket_ = resume_ticket;
+}
+
+void Host::setProcessPool(HostProcessPool* process_pool)
 {
-    return network_channel_->peerAddress();
+    process_pool_ = process_pool;
+}
+
+void Host::setProcessGroup(HostProcessGroup* process_group)
+{
+    process_group_ = process_group;
 }
 
 bool Host::start()
@@ -101,6 +130,8 @@ bool Host::start()
         return false;
     }
 
+    start_time_ = QDateTime::currentDateTime();
+
     switch (session_type_)
     {
         case proto::auth::SESSION_TYPE_DESKTOP_MANAGE:
@@ -137,7 +168,7 @@ bool Host::start()
     qInfo("Starting the host");
     state_ = StartingState;
 
-    connect(network_channel_, &NetworkChannel::disconnected, this, &Host::stop);
+    connectNetworkChannel();
 
     attach_timer_id_ = startTimer(std::chrono::minutes(1));
     if (!attach_timer_id_)
@@ -150,6 +181,64 @@ bool Host::start()
     return true;
 }
 
+bool Host::resume(NetworkChannel* network_channel, const QByteArray& resume_ticket)
+{
+    if (state_ != AttachedState || !network_channel)
+    {
+        qWarning("The host can not be resumed");
+        return false;
+    }
+
+    qInfo("Resuming the host");
+
+    if (suspend_timer_id_)
+    {
+        killTimer(suspend_timer_id_);
+        suspend_timer_id_ = 0;
+    }
+
+    // The host may not have noticed the loss of the previous connection yet.
+    releaseNetworkChannel();
+
+    network_channel_ = network_channel;
+    remote_address_ = network_channel_->peerAddress();
+    resume_ticket_ = resume_ticket;
+
+    connectNetworkChannel();
+    connect(network_channel_, &NetworkChannel::messageWritten, this, &Host::networkMessageWritten);
+    connect(network_channel_, &NetworkChannel::messageReceived, this, &Host::networkMessageReceived);
+
+    // The messages written to the previous connection are not reported anymore. The message
+    // which is being read from the session process is relayed to the new connection.
+    network_reading_ = false;
+    network_relayed_ = 0;
+
+    readIpcMessage();
+    readNetworkMessage();
+    return true;
+}
+
+NetworkChannel::Counters Host::networkCounters() const
+{
+    NetworkChannel::Counters counters = released_counters_;
+
+    // The counters of the channel are atomic, so they are read from the thread of the host.
+    if (!network_channel_.isNull())
+    {
+        const NetworkChannel::Counters current = network_channel_->counters();
+
+        counters.bytes_read += current.bytes_read;
+        counters.bytes_written += current.bytes_written;
+        counters.messages_read += current.messages_read;
+        counters.messages_written += current.messages_written;
+        counters.crypto_time += current.crypto_time;
+        counters.queued_messages = current.queued_messages;
+        counters.queued_bytes = current.queued_bytes;
+    }
+
+    return counters;
+}
+
 void Host::stop()
 {
     if (state_ == StoppedState || state_ == StoppingState)
@@ -158,8 +247,7 @@ void Host::stop()
     qInfo("Stopping host");
     state_ = StoppingState;
 
-    if (network_channel_->channelState() != NetworkChannel::NotConnected)
-        network_channel_->stop();
+    emit networkStopRequested();
 
     dettachSession();
 
@@ -169,6 +257,12 @@ void Host::stop()
         attach_timer_id_ = 0;
     }
 
+    if (suspend_timer_id_)
+    {
+        killTimer(suspend_timer_id_);
+        suspend_timer_id_ = 0;
+    }
+
     state_ = StoppedState;
 
     qInfo("Host is stopped");
@@ -204,94 +298,135 @@ void Host::timerEvent(QTimerEvent* event)
         qWarning("Timeout of session attachment");
         stop();
     }
+    else if (event->timerId() == suspend_timer_id_)
+    {
+        qWarning("Timeout of session resumption");
+        stop();
+    }
+}
+
+void Host::networkDisconnected()
+{
+    // The signals of the channel are queued, so the previous channel may still report after
+    // the session is resumed.
+    if (sender() != network_channel_.data())
+        return;
+
+    // The session process of the desktop session keeps running for a while, so the client
+    // is able to resume the session without starting it again.
+    if (resume_ticket_.isEmpty() || state_ != AttachedState)
+    {
+        stop();
+        return;
+    }
+
+    if (suspend_timer_id_)
+        return;
+
+    suspend_timer_id_ = startTimer(kSuspendTimeout);
+    if (!suspend_timer_id_)
+    {
+        qWarning("Could not start the timer");
+        stop();
+        return;
+    }
+
+    qInfo("Network connection is lost. The host is suspended");
 }
 
 void Host::networkMessageWritten(int message_id)
 {
     Q_ASSERT(message_id == NetworkMessageId);
 
-    if (!ipc_channel_.isNull())
-        ipc_channel_->readMessage();
+    if (sender() != network_channel_.data())
+        return;
+
+    // The messages of the previous session process can still be written after the attachment.
+    if (network_relayed_ > 0)
+        --network_relayed_;
+
+    readIpcMessage();
 }
 
-void Host::networkMessageReceived(const QByteArray& buffer)
+void Host::networkMessageReceived(const QByteArray& buffer,
+                                  MessagePriority priority,
+                                  MessageClass message_class)
 {
-    if (!ipc_channel_.isNull())
-        ipc_channel_->writeMessage(IpcMessageId, buffer);
+    if (sender() != network_channel_.data())
+        return;
+
+    network_reading_ = false;
+
+    if (ipc_channel_.isNull())
+        return;
+
+    // The message is relayed with the header of the network channel without parsing it.
+    ++ipc_relayed_;
+    ipc_channel_->writeMessage(IpcMessageId, buffer, priority, message_class);
+
+    readNetworkMessage();
 }
 
 void Host::ipcMessageWritten(int message_id)
 {
     Q_ASSERT(message_id == IpcMessageId);
-    network_channel_->readMessage();
-}
+    Q_ASSERT(ipc_relayed_ > 0);
 
-void Host::ipcMessageReceived(const QByteArray& buffer)
-{
-    network_channel_->writeMessage(NetworkMessageId, buffer);
+    --ipc_relayed_;
+    readNetworkMessage();
 }
 
-void Host::ipcServerStarted(const QString& channel_id)
+void Host::ipcMessageReceived(const QByteArray& buffer,
+                              MessagePriority priority,
+                              MessageClass message_class)
 {
-    Q_ASSERT(state_ == StartingState);
-    Q_ASSERT(session_process_.isNull());
+    ipc_reading_ = false;
 
-    session_process_ = new HostProcess(this);
-
-    session_process_->setSessionId(session_id_);
-    session_process_->setProgram(
-        QCoreApplication::applicationDirPath() + QLatin1String("/aspia_host.exe"));
-
-    QStringList arguments;
-
-    arguments << QStringLiteral("--channel_id") << channel_id;
-    arguments << QStringLiteral("--session_type");
-
-    switch (session_type_)
+    if (message_class == StatisticsMessage)
     {
-        case proto::auth::SESSION_TYPE_DESKTOP_MANAGE:
-            session_process_->setAccount(HostProcess::Account::System);
-            arguments << QStringLiteral("desktop_manage");
-            break;
+        // The previous statistics are kept if the message is invalid.
+        proto::host::SessionStatistics statistics;
+        if (parseMessage(buffer, statistics))
+            statistics_ = std::move(statistics);
 
-        case proto::auth::SESSION_TYPE_DESKTOP_VIEW:
-            session_process_->setAccount(HostProcess::Account::System);
-            arguments << QStringLiteral("desktop_view");
-            break;
+        readIpcMessage();
+        return;
+    }
 
-        case proto::auth::SESSION_TYPE_FILE_TRANSFER:
-            session_process_->setAccount(HostProcess::Account::User);
-            arguments << QStringLiteral("file_transfer");
-            break;
+    // The message can not be delivered to the client until the session is resumed.
+    if (suspend_timer_id_)
+        return;
 
-        case proto::auth::SESSION_TYPE_SYSTEM_INFO:
-            session_process_->setAccount(HostProcess::Account::System);
-            arguments << QStringLiteral("system_info");
-            break;
+    ++network_relayed_;
+    ++relayed_messages_;
+    emit networkWriteRequested(NetworkMessageId, buffer, priority, message_class);
 
-        default:
-            qFatal("Unknown session type: %d", session_type_);
-            break;
-    }
+    readIpcMessage();
+}
 
-    session_process_->setArguments(arguments);
+void Host::ipcServerStarted(const QString& channel_id)
+{
+    Q_ASSERT(state_ == StartingState);
+    Q_ASSERT(session_process_.isNull());
 
-    connect(session_process_, &HostProcess::errorOccurred, [this](HostProcess::ErrorCode error_code)
+    if (!process_group_.isNull())
     {
-        if (session_type_ == proto::auth::SESSION_TYPE_FILE_TRANSFER &&
-            error_code == HostProcess::NoLoggedOnUser)
+        session_process_ = process_group_->startSession(session_type_, session_id_, channel_id);
+        if (!session_process_.isNull())
         {
-            if (!startFakeSession())
-                stop();
+            session_process_shared_ = true;
+            connectSessionProcess();
+            return;
         }
-        else
-        {
-            stop();
-        }
-    });
+    }
 
-    connect(session_process_, &HostProcess::finished, this, &Host::dettachSession);
+    session_process_ = new HostProcess(this);
+    session_process_->setSessionId(session_id_);
+
+    if (!HostProcessPool::setupProcess(session_process_, session_type_, channel_id))
+        qFatal("Unknown session type: %d", session_type_);
 
+    connectSessionProcess();
     session_process_->start();
 }
 
@@ -313,14 +448,21 @@ void Host::ipcNewConnection(IpcChannel* channel)
     connect(ipc_channel_, &IpcChannel::messageReceived, this, &Host::ipcMessageReceived);
     connect(ipc_channel_, &IpcChannel::messageWritten, this, &Host::ipcMessageWritten);
 
+    connect(ipc_channel_, &IpcChannel::writeQueueDrained, this, &Host::readNetworkMessage);
+
     connect(network_channel_, &NetworkChannel::messageWritten, this, &Host::networkMessageWritten);
     connect(network_channel_, &NetworkChannel::messageReceived, this, &Host::networkMessageReceived);
 
     qInfo() << "Host process is attached for session" << session_id_;
     state_ = AttachedState;
 
-    ipc_channel_->readMessage();
-    network_channel_->readMessage();
+    ipc_reading_ = false;
+    ipc_relayed_ = 0;
+    network_reading_ = false;
+    network_relayed_ = 0;
+
+    readIpcMessage();
+    readNetworkMessage();
 }
 
 void Host::attachSession(quint32 session_id)
@@ -330,6 +472,21 @@ void Host::attachSession(quint32 session_id)
     state_ = StartingState;
     session_id_ = session_id;
 
+    if (!process_pool_.isNull())
+    {
+        IpcChannel* ipc_channel = nullptr;
+
+        session_process_ = process_pool_->takeProcess(session_type_, session_id, &ipc_channel);
+        if (!session_process_.isNull())
+        {
+            session_process_->setParent(this);
+            connectSessionProcess();
+
+            ipcNewConnection(ipc_channel);
+            return;
+        }
+    }
+
     IpcServer* ipc_server = new IpcServer(this);
 
     connect(ipc_server, &IpcServer::started, this, &Host::ipcServerStarted);
@@ -356,7 +513,16 @@ void Host::dettachSession()
     if (!ipc_channel_.isNull() && ipc_channel_->channelState() == IpcChannel::Connected)
         ipc_channel_->stop();
 
-    if (!session_process_.isNull())
+    if (session_process_shared_)
+    {
+        // The session of the process is stopped by the disconnection of its channel.
+        if (!process_group_.isNull())
+            process_group_->releaseProcess(session_process_, this);
+
+        session_process_ = nullptr;
+        session_process_shared_ = false;
+    }
+    else if (!session_process_.isNull())
     {
         session_process_->kill();
         delete session_process_;
@@ -382,6 +548,93 @@ void Host::dettachSession()
     }
 }
 
+void Host::readIpcMessage()
+{
+    if (ipc_reading_ || network_relayed_ >= kMaxRelayedMessages || network_queue_full_ ||
+        ipc_channel_.isNull() || suspend_timer_id_)
+    {
+        return;
+    }
+
+    ipc_reading_ = true;
+    ipc_channel_->readMessage();
+}
+
+void Host::readNetworkMessage()
+{
+    if (network_reading_ || ipc_relayed_ >= kMaxRelayedMessages)
+        return;
+
+    if (!ipc_channel_.isNull() && ipc_channel_->isWriteQueueFull())
+        return;
+
+    network_reading_ = true;
+    emit networkReadRequested();
+}
+
+void Host::connectSessionProcess()
+{
+    connect(session_process_, &HostProcess::errorOccurred,
+            this, [this](HostProcess::ErrorCode error_code)
+    {
+        if (session_type_ == proto::auth::SESSION_TYPE_FILE_TRANSFER &&
+            error_code == HostProcess::NoLoggedOnUser)
+        {
+            if (!startFakeSession())
+                stop();
+        }
+        else
+        {
+            stop();
+        }
+    });
+
+    connect(session_process_, &HostProcess::finished, this, &Host::dettachSession);
+}
+
+void Host::connectNetworkChannel()
+{
+    connect(network_channel_, &NetworkChannel::disconnected, this, &Host::networkDisconnected);
+
+    connect(this, &Host::networkWriteRequested, network_channel_, &NetworkChannel::writeMessage);
+    connect(this, &Host::networkReadRequested, network_channel_, &NetworkChannel::readMessage);
+    connect(this, &Host::networkStopRequested, network_channel_, &NetworkChannel::stop);
+
+    // The channel may be in another thread, so its state is tracked by the signals.
+    network_queue_full_ = false;
+
+    connect(network_channel_, &NetworkChannel::writeQueueFull, this, [this]()
+    {
+        network_queue_full_ = true;
+    });
+
+    connect(network_channel_, &NetworkChannel::writeQueueDrained, this, [this]()
+    {
+        network_queue_full_ = false;
+        readIpcMessage();
+    });
+}
+
+void Host::releaseNetworkChannel()
+{
+    if (network_channel_.isNull())
+        return;
+
+    // The channel is stopped before the deletion, because the requests to it are delivered in
+    // the order in which they are sent.
+    emit networkStopRequested();
+
+    disconnect(network_channel_, nullptr, this, nullptr);
+    disconnect(this, nullptr, network_channel_, nullptr);
+
+    released_counters_ = networkCounters();
+    released_counters_.queued_messages = 0;
+    released_counters_.queued_bytes = 0;
+
+    network_channel_->deleteLater();
+    network_channel_ = nullptr;
+}
+
 bool Host::startFakeSession()
 {
     qInfo("Starting a fake session");
@@ -8,17 +8,23 @@
 #ifndef _ASPIA_HOST__WIN__HOST_H
 #define _ASPIA_HOST__WIN__HOST_H
 
+#include <QDateTime>
 #include <QPointer>
 
+#include "base/message_class.h"
+#include "base/message_priority.h"
+#include "network/network_channel.h"
 #include "protocol/authorization.pb.h"
+#include "protocol/host_session.pb.h"
 
 namespace aspia {
 
 class HostProcess;
+class HostProcessGroup;
+class HostProcessPool;
 class HostSessionFake;
 class IpcChannel;
 class IpcServer;
-class NetworkChannel;
 
 class Host : public QObject
 {
@@ -38,6 +44,8 @@ public:
     Host(QObject* parent = nullptr);
     ~Host();
 
+    // The host becomes the owner of the channel. The channel may be moved to another thread
+    // after it is set, so it is called only through the queued signals.
     NetworkChannel* networkChannel() const { return network_channel_; }
     void setNetworkChannel(NetworkChannel* network_channel);
 
@@ -50,10 +58,38 @@ public:
     QString uuid() const { return uuid_; }
     void setUuid(const QString& uuid);
 
-    QString remoteAddress() const;
+    // The ticket by which the client may resume the session after a loss of the connection.
+    // If it is empty, then the host is stopped when the connection is lost.
+    const QByteArray& resumeTicket() const { return resume_ticket_; }
+    void setResumeTicket(const QByteArray& resume_ticket);
+
+    // If the pool is set, then the session process is taken from it when possible.
+    void setProcessPool(HostProcessPool* process_pool);
+
+    // If the group is set, then the session is started in the shared process of its account in
+    // the user session when the session process is not taken from the pool.
+    void setProcessGroup(HostProcessGroup* process_group);
+
+    QString remoteAddress() const { return remote_address_; }
+
+    // The counters of the network channels of the session including the previous connections.
+    NetworkChannel::Counters networkCounters() const;
+
+    // Number of the messages of the session process relayed to the client.
+    qint64 relayedMessages() const { return relayed_messages_; }
+
+    // The last memory usage reported by the session process.
+    const proto::host::MemoryUsage& memoryUsage() const { return statistics_.memory_usage(); }
+
+    const QDateTime& startTime() const { return start_time_; }
 
     bool start();
 
+    // Continues the session with the new connection of the client. The session process is not
+    // restarted. The messages which were in flight on the previous connection are lost. Returns
+    // false if the session can not be resumed.
+    bool resume(NetworkChannel* network_channel, const QByteArray& resume_ticket);
+
 public slots:
     void stop();
     void sessionChanged(quint32 event, quint32 session_id);
@@ -61,36 +97,89 @@ public slots:
 signals:
     void finished(Host* host);
 
+    // Connected to the network channel.
+    void networkWriteRequested(int message_id,
+                               const QByteArray& buffer,
+                               MessagePriority priority,
+                               MessageClass message_class);
+    void networkReadRequested();
+    void networkStopRequested();
+
 protected:
     // QObject implementation.
     void timerEvent(QTimerEvent* event) override;
 
 private slots:
+    void networkDisconnected();
     void networkMessageWritten(int message_id);
-    void networkMessageReceived(const QByteArray& buffer);
+    void networkMessageReceived(const QByteArray& buffer,
+                                MessagePriority priority,
+                                MessageClass message_class);
     void ipcMessageWritten(int message_id);
-    void ipcMessageReceived(const QByteArray& buffer);
+    void ipcMessageReceived(const QByteArray& buffer,
+                            MessagePriority priority,
+                            MessageClass message_class);
     void ipcServerStarted(const QString& channel_id);
     void ipcNewConnection(IpcChannel* channel);
     void attachSession(quint32 session_id);
     void dettachSession();
 
 private:
+    // Start reading the next message if fewer than the limit of the messages read from
+    // the channel are waiting to be written to the other one and its write queue is not full.
+    void readIpcMessage();
+    void readNetworkMessage();
+
     bool startFakeSession();
+    void connectSessionProcess();
+
+    void connectNetworkChannel();
+    void releaseNetworkChannel();
 
     static const quint32 kInvalidSessionId = 0xFFFFFFFF;
 
     proto::auth::SessionType session_type_ = proto::auth::SESSION_TYPE_UNKNOWN;
     QString user_name_;
     QString uuid_;
+    QString remote_address_;
+    QDateTime start_time_;
 
     quint32 session_id_ = kInvalidSessionId;
     int attach_timer_id_ = 0;
+
+    // While the timer is started, the connection is lost and the host waits for the client to
+    // resume the session. The messages of the session process are not read at that time.
+    QByteArray resume_ticket_;
+    int suspend_timer_id_ = 0;
     State state_ = StoppedState;
 
+    // The messages are relayed between the channels without waiting for each other.
+    // |network_relayed_| is the number of messages of the session process which are being
+    // written to the network, |ipc_relayed_| is the number of messages of the client which are
+    // being written to the session process.
+    bool ipc_reading_ = false;
+    int ipc_relayed_ = 0;
+    bool network_reading_ = false;
+    int network_relayed_ = 0;
+
+    // The write queue of the network channel is above its high watermark.
+    bool network_queue_full_ = false;
+
+    // The counters of the previous connections of the resumed session.
+    NetworkChannel::Counters released_counters_;
+    qint64 relayed_messages_ = 0;
+
+    // The statistics of the session process. They are not relayed to the client.
+    proto::host::SessionStatistics statistics_;
+
     QPointer<NetworkChannel> network_channel_;
     QPointer<IpcChannel> ipc_channel_;
     QPointer<HostProcess> session_process_;
+    QPointer<HostProcessPool> process_pool_;
+    QPointer<HostProcessGroup> process_group_;
+
+    // The process runs the other sessions too, so it is released instead of the kill.
+    bool session_process_shared_ = false;
     QPointer<HostSessionFake> fake_session_;
 
     Q_DISABLE_COPY(Host)
@@ -15,8 +15,12 @@
 #include <QFileInfo>
 #include <QGuiApplication>
 
+#include "base/cpu_dispatch.h"
 #include "base/file_logger.h"
+#include "base/trace_logger.h"
 #include "host/host_session.h"
+#include "host/host_session_group.h"
+#include "host/host_settings.h"
 #include "version.h"
 
 namespace aspia {
@@ -26,6 +30,15 @@ int hostMain(int argc, char *argv[])
     FileLogger logger;
     logger.startLogging(QFileInfo(argv[0]).fileName());
 
+    HostSettings settings;
+
+    TraceLogger tracer;
+    if (settings.isTracingEnabled())
+        tracer.startTracing(QFileInfo(argv[0]).fileName());
+
+    // The kernels are selected after it.
+    CpuDispatch::setOverride(settings.disabledInstructionSets());
+
     // At the end of the user's session, the program ends later than the others.
     SetProcessShutdownParameters(0, SHUTDOWN_NORETRY);
 
@@ -42,9 +55,15 @@ int hostMain(int argc, char *argv[])
                                            QString(),
                                            QStringLiteral("session_type"));
 
+    // The shared process runs the sessions which the service sends by the control channel.
+    QCommandLineOption control_channel_id_option(QStringLiteral("control_channel_id"),
+                                                 QString(),
+                                                 QStringLiteral("control_channel_id"));
+
     QCommandLineParser parser;
     parser.addOption(channel_id_option);
     parser.addOption(session_type_option);
+    parser.addOption(control_channel_id_option);
 
     if (!parser.parse(application.arguments()))
     {
@@ -52,6 +71,14 @@ int hostMain(int argc, char *argv[])
         return 1;
     }
 
+    if (parser.isSet(control_channel_id_option))
+    {
+        HostSessionGroup group(parser.value(control_channel_id_option));
+        group.start();
+
+        return application.exec();
+    }
+
     QString channel_id = parser.value(channel_id_option);
     QString session_type = parser.value(session_type_option);
 
@@ -59,6 +86,7 @@ int hostMain(int argc, char *argv[])
     if (session.isNull())
         return 1;
 
+    QObject::connect(session, &HostSession::finished, &application, &QGuiApplication::quit);
     session->start();
 
     return application.exec();
@@ -0,0 +1,261 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/win/host_process_group.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "host/win/host_process_group.h"
+
+#include <QCoreApplication>
+#include <QDebug>
+#include <QTimerEvent>
+
+#include "base/message_serialization.h"
+#include "host/win/host_process_pool.h"
+#include "ipc/ipc_channel.h"
+#include "ipc/ipc_server.h"
+#include "protocol/host_session.pb.h"
+
+namespace aspia {
+
+namespace {
+
+// The process without the sessions waits for the next one during this time.
+constexpr std::chrono::minutes kIdleTimeout{ 1 };
+
+} // namespace
+
+HostProcessGroup::HostProcessGroup(QObject* parent)
+    : QObject(parent)
+{
+    // Nothing
+}
+
+HostProcessGroup::~HostProcessGroup()
+{
+    stop();
+}
+
+HostProcess* HostProcessGroup::startSession(proto::auth::SessionType session_type,
+                                            quint32 session_id,
+                                            const QString& channel_id)
+{
+    QString name;
+    HostProcess::Account account;
+
+    if (!HostProcessPool::sessionParameters(session_type, &name, &account))
+    {
+        qWarning("Unknown session type: %d", session_type);
+        return nullptr;
+    }
+
+    Entry* entry = nullptr;
+
+    for (const auto& it : entries_)
+    {
+        if (it->session_id == session_id && it->account == account && !it->process.isNull())
+        {
+            entry = it.get();
+            break;
+        }
+    }
+
+    if (!entry)
+        entry = startProcess(session_id, account);
+
+    if (entry->idle_timer_id)
+    {
+        killTimer(entry->idle_timer_id);
+        entry->idle_timer_id = 0;
+    }
+
+    ++entry->session_count;
+
+    proto::host::StartSession message;
+    message.set_session_type(name.toStdString());
+    message.set_channel_id(channel_id.toStdString());
+
+    if (!entry->ipc_channel.isNull())
+        entry->ipc_channel->writeMessage(-1, serializeMessage(message));
+    else
+        entry->pending_messages.push_back(serializeMessage(message));
+
+    qInfo() << "Session" << session_type << "is started in the shared process of session"
+            << session_id << "with" << entry->session_count << "sessions";
+
+    return entry->process;
+}
+
+void HostProcessGroup::releaseProcess(HostProcess* process, QObject* receiver)
+{
+    if (!process)
+        return;
+
+    disconnect(process, nullptr, receiver, nullptr);
+
+    Entry* entry = findEntry(process);
+    if (!entry || entry->session_count <= 0)
+        return;
+
+    if (--entry->session_count == 0)
+        entry->idle_timer_id = startTimer(kIdleTimeout);
+}
+
+void HostProcessGroup::stop()
+{
+    while (!entries_.empty())
+        removeEntry(entries_.back().get());
+}
+
+void HostProcessGroup::timerEvent(QTimerEvent* event)
+{
+    for (const auto& entry : entries_)
+    {
+        if (entry->idle_timer_id == event->timerId())
+        {
+            qInfo() << "Shared process of session" << entry->session_id << "is idle";
+            removeEntry(entry.get());
+            return;
+        }
+    }
+
+    QObject::timerEvent(event);
+}
+
+HostProcessGroup::Entry* HostProcessGroup::startProcess(quint32 session_id,
+                                                        HostProcess::Account account)
+{
+    IpcServer* ipc_server = new IpcServer(this);
+
+    // The process is created before the start, so the sessions may connect to its signals.
+    HostProcess* process = new HostProcess(this);
+    process->setSessionId(session_id);
+    process->setAccount(account);
+    process->setProgram(
+        QCoreApplication::applicationDirPath() + QLatin1String("/aspia_host.exe"));
+
+    std::unique_ptr<Entry> entry = std::make_unique<Entry>();
+    entry->session_id = session_id;
+    entry->account = account;
+    entry->ipc_server = ipc_server;
+    entry->process = process;
+
+    connect(ipc_server, &IpcServer::started, this, [process](const QString& channel_id)
+    {
+        QStringList arguments;
+        arguments << QStringLiteral("--control_channel_id") << channel_id;
+
+        process->setArguments(arguments);
+        process->start();
+    });
+
+    connect(ipc_server, &IpcServer::newConnection, this, [this, ipc_server](IpcChannel* channel)
+    {
+        Entry* entry = findEntry(ipc_server);
+        if (!entry)
+        {
+            channel->deleteLater();
+            return;
+        }
+
+        // The process does not send messages, so the channel is not read.
+        channel->setParent(this);
+        entry->ipc_channel = channel;
+
+        connect(channel, &IpcChannel::disconnected, this, [this, channel]()
+        {
+            removeEntry(findEntry(channel));
+        });
+
+        for (const QByteArray& message : entry->pending_messages)
+            channel->writeMessage(-1, message);
+
+        entry->pending_messages.clear();
+    });
+
+    // The sessions of the process get the same signals and are stopped.
+    connect(ipc_server, &IpcServer::errorOccurred, this, [this, ipc_server]()
+    {
+        removeEntry(findEntry(ipc_server));
+    });
+
+    connect(process, &HostProcess::errorOccurred,
+            this, [this, process](HostProcess::ErrorCode /* error_code */)
+    {
+        removeEntry(findEntry(process));
+    });
+
+    connect(process, &HostProcess::finished, this, [this, process]()
+    {
+        removeEntry(findEntry(process));
+    });
+
+    connect(ipc_server, &IpcServer::finished, ipc_server, &IpcServer::deleteLater);
+
+    entries_.push_back(std::move(entry));
+    ipc_server->start();
+
+    return entries_.back().get();
+}
+
+void HostProcessGroup::removeEntry(Entry* entry)
+{
+    if (!entry)
+        return;
+
+    if (entry->idle_timer_id)
+        killTimer(entry->idle_timer_id);
+
+    // The entry may be removed by a signal of its objects, so they are deleted later.
+    if (!entry->ipc_server.isNull())
+    {
+        disconnect(entry->ipc_server, nullptr, this, nullptr);
+        entry->ipc_server->stop();
+    }
+
+    if (!entry->ipc_channel.isNull())
+    {
+        disconnect(entry->ipc_channel, nullptr, this, nullptr);
+
+        if (entry->ipc_channel->channelState() == IpcChannel::Connected)
+            entry->ipc_channel->stop();
+
+        entry->ipc_channel->deleteLater();
+    }
+
+    if (!entry->process.isNull())
+    {
+        disconnect(entry->process, nullptr, this, nullptr);
+        entry->process->kill();
+        entry->process->deleteLater();
+    }
+
+    for (auto it = entries_.begin(); it != entries_.end(); ++it)
+    {
+        if (it->get() == entry)
+        {
+            entries_.erase(it);
+            break;
+        }
+    }
+}
+
+HostProcessGroup::Entry* HostProcessGroup::findEntry(QObject* object)
+{
+    if (!object)
+        return nullptr;
+
+    for (const auto& entry : entries_)
+    {
+        if (entry->ipc_server.data() == object || entry->process.data() == object ||
+            entry->ipc_channel.data() == object)
+        {
+            return entry.get();
+        }
+    }
+
+    return nullptr;
+}
+
+} // namespace aspia
@@ -0,0 +1,86 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/win/host_process_group.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_HOST__WIN__HOST_PROCESS_GROUP_H
+#define _ASPIA_HOST__WIN__HOST_PROCESS_GROUP_H
+
+#include <QByteArray>
+#include <QPointer>
+
+#include <memory>
+#include <vector>
+
+#include "host/win/host_process.h"
+#include "protocol/authorization.pb.h"
+
+namespace aspia {
+
+class IpcChannel;
+class IpcServer;
+
+//
+// Runs the sessions of one account in one user session in one shared session process. The
+// service starts each session by the control channel of the process and the session connects to
+// its own IPC channel, so the next session starts without loading the process. The desktop and
+// the system info sessions are run under the system account and the file transfer sessions under
+// the account of the user, so there are at most two processes in each user session. The process
+// is stopped after a timeout when it has no sessions.
+//
+class HostProcessGroup : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit HostProcessGroup(QObject* parent = nullptr);
+    ~HostProcessGroup();
+
+    // Starts the session of |session_type| which connects to |channel_id| in the process of the
+    // session |session_id|. The process is started if it is not running. Returns the process or
+    // nullptr if the session type is unknown. The caller connects to the signals of the process
+    // with itself as the context and calls releaseProcess() when the session ends.
+    HostProcess* startSession(proto::auth::SessionType session_type,
+                              quint32 session_id,
+                              const QString& channel_id);
+
+    // Removes the session from the process. The signals of the process are disconnected from
+    // |receiver|.
+    void releaseProcess(HostProcess* process, QObject* receiver);
+
+    void stop();
+
+protected:
+    // QObject implementation.
+    void timerEvent(QTimerEvent* event) override;
+
+private:
+    struct Entry
+    {
+        quint32 session_id;
+        HostProcess::Account account;
+        QPointer<IpcServer> ipc_server;
+        QPointer<HostProcess> process;
+        QPointer<IpcChannel> ipc_channel;
+
+        // The messages which are sent when the process connects to the control channel.
+        std::vector<QByteArray> pending_messages;
+
+        int session_count = 0;
+        int idle_timer_id = 0;
+    };
+
+    Entry* startProcess(quint32 session_id, HostProcess::Account account);
+    void removeEntry(Entry* entry);
+    Entry* findEntry(QObject* object);
+
+    std::vector<std::unique_ptr<Entry>> entries_;
+
+    Q_DISABLE_COPY(HostProcessGroup)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_HOST__WIN__HOST_PROCESS_GROUP_H
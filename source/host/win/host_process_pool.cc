@@ -0,0 +1,293 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/win/host_process_pool.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "host/win/host_process_pool.h"
+
+#include <QCoreApplication>
+#include <QDebug>
+
+#include "host/win/host_process.h"
+#include "ipc/ipc_channel.h"
+#include "ipc/ipc_server.h"
+
+namespace aspia {
+
+namespace {
+
+const proto::auth::SessionType kPooledSessionTypes[] =
+{
+    proto::auth::SESSION_TYPE_DESKTOP_MANAGE,
+    proto::auth::SESSION_TYPE_DESKTOP_VIEW,
+    proto::auth::SESSION_TYPE_FILE_TRANSFER,
+    proto::auth::SESSION_TYPE_SYSTEM_INFO
+};
+
+} // namespace
+
+HostProcessPool::HostProcessPool(QObject* parent)
+    : QObject(parent)
+{
+    // Nothing
+}
+
+HostProcessPool::~HostProcessPool()
+{
+    stop();
+}
+
+// static
+bool HostProcessPool::sessionParameters(proto::auth::SessionType session_type,
+                                        QString* name,
+                                        HostProcess::Account* account)
+{
+    switch (session_type)
+    {
+        case proto::auth::SESSION_TYPE_DESKTOP_MANAGE:
+            *account = HostProcess::Account::System;
+            *name = QStringLiteral("desktop_manage");
+            return true;
+
+        case proto::auth::SESSION_TYPE_DESKTOP_VIEW:
+            *account = HostProcess::Account::System;
+            *name = QStringLiteral("desktop_view");
+            return true;
+
+        case proto::auth::SESSION_TYPE_FILE_TRANSFER:
+            *account = HostProcess::Account::User;
+            *name = QStringLiteral("file_transfer");
+            return true;
+
+        case proto::auth::SESSION_TYPE_SYSTEM_INFO:
+            *account = HostProcess::Account::System;
+            *name = QStringLiteral("system_info");
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+// static
+bool HostProcessPool::setupProcess(HostProcess* process,
+                                   proto::auth::SessionType session_type,
+                                   const QString& channel_id)
+{
+    QString name;
+    HostProcess::Account account;
+
+    if (!sessionParameters(session_type, &name, &account))
+    {
+        qWarning("Unknown session type: %d", session_type);
+        return false;
+    }
+
+    QStringList arguments;
+
+    arguments << QStringLiteral("--channel_id") << channel_id;
+    arguments << QStringLiteral("--session_type") << name;
+
+    process->setAccount(account);
+    process->setProgram(
+        QCoreApplication::applicationDirPath() + QLatin1String("/aspia_host.exe"));
+    process->setArguments(arguments);
+    return true;
+}
+
+void HostProcessPool::start(quint32 session_id)
+{
+    if (session_id != session_id_)
+    {
+        stop();
+        session_id_ = session_id;
+    }
+
+    // The processes which could not be started earlier are started again. For example, the
+    // file transfer requires a logged on user.
+    for (proto::auth::SessionType session_type : kPooledSessionTypes)
+    {
+        bool found = false;
+
+        for (const auto& entry : entries_)
+        {
+            if (entry->session_type == session_type)
+            {
+                found = true;
+                break;
+            }
+        }
+
+        if (!found)
+            startProcess(session_type);
+    }
+}
+
+void HostProcessPool::stop()
+{
+    while (!entries_.empty())
+        removeEntry(entries_.back().get());
+
+    session_id_ = kInvalidSessionId;
+}
+
+HostProcess* HostProcessPool::takeProcess(proto::auth::SessionType session_type,
+                                          quint32 session_id,
+                                          IpcChannel** ipc_channel)
+{
+    if (session_id != session_id_)
+        return nullptr;
+
+    for (auto it = entries_.begin(); it != entries_.end(); ++it)
+    {
+        Entry* entry = it->get();
+
+        if (entry->session_type != session_type || entry->process.isNull() ||
+            entry->ipc_channel.isNull())
+        {
+            continue;
+        }
+
+        HostProcess* process = entry->process;
+        *ipc_channel = entry->ipc_channel;
+
+        disconnect(process, nullptr, this, nullptr);
+        disconnect(*ipc_channel, nullptr, this, nullptr);
+
+        entries_.erase(it);
+
+        qInfo() << "Session process is taken from the pool for session type" << session_type;
+
+        // The next session of the type does not wait either.
+        startProcess(session_type);
+        return process;
+    }
+
+    return nullptr;
+}
+
+void HostProcessPool::startProcess(proto::auth::SessionType session_type)
+{
+    IpcServer* ipc_server = new IpcServer(this);
+
+    std::unique_ptr<Entry> entry = std::make_unique<Entry>();
+    entry->session_type = session_type;
+    entry->ipc_server = ipc_server;
+
+    connect(ipc_server, &IpcServer::started, this, [this, ipc_server](const QString& channel_id)
+    {
+        Entry* entry = findEntry(ipc_server);
+        if (!entry)
+            return;
+
+        HostProcess* process = new HostProcess(this);
+
+        process->setSessionId(session_id_);
+        setupProcess(process, entry->session_type, channel_id);
+
+        entry->process = process;
+
+        // The failed processes are started again with the next call of start().
+        connect(process, &HostProcess::errorOccurred,
+                this, [this, process](HostProcess::ErrorCode /* error_code */)
+        {
+            removeEntry(findEntry(process));
+        });
+
+        connect(process, &HostProcess::finished, this, [this, process]()
+        {
+            removeEntry(findEntry(process));
+        });
+
+        process->start();
+    });
+
+    connect(ipc_server, &IpcServer::newConnection, this, [this, ipc_server](IpcChannel* channel)
+    {
+        Entry* entry = findEntry(ipc_server);
+        if (!entry)
+        {
+            channel->deleteLater();
+            return;
+        }
+
+        // The messages of the process are not read until it is taken.
+        channel->setParent(this);
+        entry->ipc_channel = channel;
+
+        connect(channel, &IpcChannel::disconnected, this, [this, channel]()
+        {
+            removeEntry(findEntry(channel));
+        });
+    });
+
+    connect(ipc_server, &IpcServer::errorOccurred, this, [this, ipc_server]()
+    {
+        removeEntry(findEntry(ipc_server));
+    });
+
+    connect(ipc_server, &IpcServer::finished, ipc_server, &IpcServer::deleteLater);
+
+    entries_.push_back(std::move(entry));
+    ipc_server->start();
+}
+
+void HostProcessPool::removeEntry(Entry* entry)
+{
+    if (!entry)
+        return;
+
+    // The entry may be removed by a signal of its objects, so they are deleted later.
+    if (!entry->ipc_server.isNull())
+    {
+        disconnect(entry->ipc_server, nullptr, this, nullptr);
+        entry->ipc_server->stop();
+    }
+
+    if (!entry->ipc_channel.isNull())
+    {
+        disconnect(entry->ipc_channel, nullptr, this, nullptr);
+
+        if (entry->ipc_channel->channelState() == IpcChannel::Connected)
+            entry->ipc_channel->stop();
+
+        entry->ipc_channel->deleteLater();
+    }
+
+    if (!entry->process.isNull())
+    {
+        disconnect(entry->process, nullptr, this, nullptr);
+        entry->process->kill();
+        entry->process->deleteLater();
+    }
+
+    for (auto it = entries_.begin(); it != entries_.end(); ++it)
+    {
+        if (it->get() == entry)
+        {
+            entries_.erase(it);
+            break;
+        }
+    }
+}
+
+HostProcessPool::Entry* HostProcessPool::findEntry(QObject* object)
+{
+    if (!object)
+        return nullptr;
+
+    for (const auto& entry : entries_)
+    {
+        if (entry->ipc_server.data() == object || entry->process.data() == object ||
+            entry->ipc_channel.data() == object)
+        {
+            return entry.get();
+        }
+    }
+
+    return nullptr;
+}
+
+} // namespace aspia
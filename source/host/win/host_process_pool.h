@@ -0,0 +1,85 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/win/host_process_pool.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_HOST__WIN__HOST_PROCESS_POOL_H
+#define _ASPIA_HOST__WIN__HOST_PROCESS_POOL_H
+
+#include <QPointer>
+
+#include <memory>
+#include <vector>
+
+#include "host/win/host_process.h"
+#include "protocol/authorization.pb.h"
+
+namespace aspia {
+
+class IpcChannel;
+class IpcServer;
+
+//
+// Keeps one started session process of each session type in the console session. The process
+// is connected to its IPC channel and waits for the host, so the session is started without
+// loading the process and without the IPC handshake. A new process is started in place of the
+// taken one.
+//
+class HostProcessPool : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit HostProcessPool(QObject* parent = nullptr);
+    ~HostProcessPool();
+
+    // Returns the name of |session_type| for the session process and the account under which
+    // the process of the session runs. Returns false if the session type is unknown.
+    static bool sessionParameters(proto::auth::SessionType session_type,
+                                  QString* name,
+                                  HostProcess::Account* account);
+
+    // Sets the program and the account of the session process of |session_type|. Returns false
+    // if the session type is unknown.
+    static bool setupProcess(HostProcess* process,
+                             proto::auth::SessionType session_type,
+                             const QString& channel_id);
+
+    // Starts the processes in the session |session_id|. The processes of the previous session
+    // are stopped.
+    void start(quint32 session_id);
+    void stop();
+
+    // Takes the process of |session_type| which is connected to |*ipc_channel|. Returns nullptr
+    // if there is no ready process in the session |session_id|. The caller becomes the parent
+    // of the process and the channel.
+    HostProcess* takeProcess(proto::auth::SessionType session_type,
+                             quint32 session_id,
+                             IpcChannel** ipc_channel);
+
+private:
+    struct Entry
+    {
+        proto::auth::SessionType session_type;
+        QPointer<IpcServer> ipc_server;
+        QPointer<HostProcess> process;
+        QPointer<IpcChannel> ipc_channel;
+    };
+
+    void startProcess(proto::auth::SessionType session_type);
+    void removeEntry(Entry* entry);
+    Entry* findEntry(QObject* object);
+
+    static const quint32 kInvalidSessionId = 0xFFFFFFFF;
+
+    quint32 session_id_ = kInvalidSessionId;
+    std::vector<std::unique_ptr<Entry>> entries_;
+
+    Q_DISABLE_COPY(HostProcessPool)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_HOST__WIN__HOST_PROCESS_POOL_H
@@ -63,6 +63,9 @@ void HostService::start()
 
     SetPriorityClass(GetCurrentProcess(), HIGH_PRIORITY_CLASS);
 
+    // The channels of all connections are served by the main thread of the service.
+    thread_role_.reset(new ScopedThreadRole(ScopedThreadRole::Role::NETWORK));
+
     QGuiApplication* app = application();
 
     app->setOrganizationName(QStringLiteral("Aspia"));
@@ -85,6 +88,14 @@ void HostService::start()
     locale_loader_->installTranslators(settings.locale());
 
     server_ = new HostServer();
+    server_->setProcessPoolEnabled(settings.isProcessPoolEnabled());
+    server_->setSharedProcessEnabled(settings.isSharedProcessEnabled());
+    server_->setIocpEnabled(settings.isIocpEnabled());
+    server_->setDatagramsEnabled(settings.isDatagramsEnabled());
+    server_->setConnectionLimits(settings.maxPendingConnections(), settings.maxSessions());
+    server_->setBandwidthLimits(settings.sessionBandwidthLimit(), settings.hostBandwidthLimit());
+    server_->setMetricsFile(settings.metricsFile());
+    server_->setRelays(settings.relayList(), settings.relayHostId(), settings.relaySecret());
     if (!server_->start(settings.tcpPort(), settings.userList()))
     {
         delete server_;
@@ -101,6 +112,7 @@ void HostService::stop()
 
     delete server_;
     com_initializer_.reset();
+    thread_role_.reset();
 
     qInfo("Service is stopped");
 }
@@ -14,6 +14,7 @@
 #include "base/win/scoped_com_initializer.h"
 #include "base/locale_loader.h"
 #include "base/service.h"
+#include "host/win/scoped_thread_role.h"
 
 namespace aspia {
 
@@ -33,6 +34,7 @@ protected:
 private:
     QScopedPointer<ScopedCOMInitializer> com_initializer_;
     QScopedPointer<LocaleLoader> locale_loader_;
+    QScopedPointer<ScopedThreadRole> thread_role_;
     QPointer<HostServer> server_;
 
     Q_DISABLE_COPY(HostService)
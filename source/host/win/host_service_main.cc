@@ -10,6 +10,8 @@
 #include <QFileInfo>
 
 #include "base/file_logger.h"
+#include "base/trace_logger.h"
+#include "host/host_settings.h"
 #include "host/win/host_service.h"
 
 namespace aspia {
@@ -19,6 +21,10 @@ int hostServiceMain(int argc, char *argv[])
     FileLogger logger;
     logger.startLogging(QFileInfo(argv[0]).fileName());
 
+    TraceLogger tracer;
+    if (HostSettings().isTracingEnabled())
+        tracer.startTracing(QFileInfo(argv[0]).fileName());
+
     return HostService().exec(argc, argv);
 }
 
@@ -0,0 +1,101 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/win/host_settings_watcher.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "host/win/host_settings_watcher.h"
+
+#include <QDebug>
+#include <QTimerEvent>
+#include <QWinEventNotifier>
+
+#include "base/errno_logging.h"
+
+namespace aspia {
+
+namespace {
+
+// The key of QSettings::SystemScope for the organization "Aspia" and the application "Host".
+const wchar_t kSettingsKey[] = L"SOFTWARE\\Aspia\\Host";
+
+// The time without changes after which the settings are read again.
+constexpr std::chrono::seconds kSettleTime{ 1 };
+
+} // namespace
+
+HostSettingsWatcher::HostSettingsWatcher(QObject* parent)
+    : QObject(parent)
+{
+    // Nothing
+}
+
+HostSettingsWatcher::~HostSettingsWatcher()
+{
+    delete notifier_;
+}
+
+bool HostSettingsWatcher::start()
+{
+    // The key does not exist until the settings are written for the first time.
+    LONG result = key_.create(HKEY_LOCAL_MACHINE, kSettingsKey, KEY_NOTIFY);
+    if (result != ERROR_SUCCESS)
+    {
+        qWarning() << "Unable to open the settings key: " << result;
+        return false;
+    }
+
+    event_.reset(CreateEventW(nullptr, FALSE, FALSE, nullptr));
+    if (!event_.isValid())
+    {
+        qWarningErrno("CreateEventW failed");
+        return false;
+    }
+
+    if (!watchChanges())
+        return false;
+
+    notifier_ = new QWinEventNotifier(event_.get());
+    connect(notifier_, &QWinEventNotifier::activated, this, &HostSettingsWatcher::onKeyChanged);
+    notifier_->setEnabled(true);
+
+    return true;
+}
+
+void HostSettingsWatcher::timerEvent(QTimerEvent* event)
+{
+    if (event->timerId() != timer_id_)
+        return;
+
+    killTimer(timer_id_);
+    timer_id_ = 0;
+
+    emit settingsChanged();
+}
+
+bool HostSettingsWatcher::watchChanges()
+{
+    LONG result = key_.watchChanges(event_.get());
+    if (result != ERROR_SUCCESS)
+    {
+        qWarning() << "Unable to watch the settings key: " << result;
+        return false;
+    }
+
+    return true;
+}
+
+void HostSettingsWatcher::onKeyChanged()
+{
+    // The notification is signaled only once.
+    if (!watchChanges())
+        notifier_->deleteLater();
+
+    if (timer_id_)
+        killTimer(timer_id_);
+
+    timer_id_ = startTimer(kSettleTime);
+}
+
+} // namespace aspia
@@ -0,0 +1,56 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/win/host_settings_watcher.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_HOST__WIN__HOST_SETTINGS_WATCHER_H
+#define _ASPIA_HOST__WIN__HOST_SETTINGS_WATCHER_H
+
+#include <QObject>
+#include <QPointer>
+
+#include "base/win/registry.h"
+#include "base/win/scoped_object.h"
+
+class QWinEventNotifier;
+
+namespace aspia {
+
+//
+// Watches the registry key of HostSettings. The settings are written by the configuration
+// dialog value by value, so the signal is emitted when no changes are made for a while.
+//
+class HostSettingsWatcher : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit HostSettingsWatcher(QObject* parent = nullptr);
+    ~HostSettingsWatcher();
+
+    bool start();
+
+signals:
+    void settingsChanged();
+
+protected:
+    // QObject implementation.
+    void timerEvent(QTimerEvent* event) override;
+
+private:
+    bool watchChanges();
+    void onKeyChanged();
+
+    RegistryKey key_;
+    ScopedHandle event_;
+    QPointer<QWinEventNotifier> notifier_;
+    int timer_id_ = 0;
+
+    Q_DISABLE_COPY(HostSettingsWatcher)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_HOST__WIN__HOST_SETTINGS_WATCHER_H
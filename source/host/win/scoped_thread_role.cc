@@ -0,0 +1,149 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/win/scoped_thread_role.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "host/win/scoped_thread_role.h"
+
+#include <QDebug>
+
+#include <avrt.h>
+
+#include "base/errno_logging.h"
+#include "host/host_settings.h"
+
+namespace aspia {
+
+namespace {
+
+struct RoleInfo
+{
+    const char* name;
+    const char* default_priority;
+    const char* default_task;
+};
+
+RoleInfo roleInfo(ScopedThreadRole::Role role)
+{
+    switch (role)
+    {
+        case ScopedThreadRole::Role::CAPTURE:
+            return { "Capture", "highest", "Capture" };
+
+        case ScopedThreadRole::Role::ENCODE:
+            return { "Encode", "above_normal", "Capture" };
+
+        case ScopedThreadRole::Role::INPUT:
+            return { "Input", "highest", "Playback" };
+
+        default:
+            return { "Network", "normal", "" };
+    }
+}
+
+bool priorityFromName(const QString& name, int* priority)
+{
+    static const struct
+    {
+        const char* name;
+        int priority;
+    } kPriorities[] =
+    {
+        { "idle",          THREAD_PRIORITY_IDLE          },
+        { "lowest",        THREAD_PRIORITY_LOWEST        },
+        { "below_normal",  THREAD_PRIORITY_BELOW_NORMAL  },
+        { "normal",        THREAD_PRIORITY_NORMAL        },
+        { "above_normal",  THREAD_PRIORITY_ABOVE_NORMAL  },
+        { "highest",       THREAD_PRIORITY_HIGHEST       },
+        { "time_critical", THREAD_PRIORITY_TIME_CRITICAL }
+    };
+
+    for (const auto& item : kPriorities)
+    {
+        if (name.compare(QLatin1String(item.name), Qt::CaseInsensitive) == 0)
+        {
+            *priority = item.priority;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} // namespace
+
+ScopedThreadRole::ScopedThreadRole(Role role)
+    : thread_(GetCurrentThread()),
+      previous_priority_(GetThreadPriority(thread_))
+{
+    const RoleInfo info = roleInfo(role);
+    const QString name = QLatin1String(info.name);
+
+    HostSettings settings;
+
+    const QString priority_name =
+        settings.threadPriority(name, QLatin1String(info.default_priority));
+
+    int priority;
+    if (!priorityFromName(priority_name, &priority))
+    {
+        qWarning() << "Unknown priority of thread" << name << ":" << priority_name;
+    }
+    else if (!SetThreadPriority(thread_, priority))
+    {
+        qWarningErrno("SetThreadPriority failed");
+    }
+
+    const QString task = settings.threadTask(name, QLatin1String(info.default_task));
+    if (!task.isEmpty())
+    {
+        DWORD task_index = 0;
+
+        // MMCSS raises the priority of the thread over the normal threads of the desktop while
+        // it is not idle. It does not work if the service "MMCSS" is disabled.
+        task_handle_ = AvSetMmThreadCharacteristicsW(
+            reinterpret_cast<const wchar_t*>(task.utf16()), &task_index);
+        if (!task_handle_)
+            qWarningErrno("AvSetMmThreadCharacteristicsW failed");
+    }
+
+    const quint64 affinity_mask = settings.threadAffinityMask(name);
+    if (affinity_mask)
+    {
+        DWORD_PTR process_mask = 0;
+        DWORD_PTR system_mask = 0;
+
+        if (!GetProcessAffinityMask(GetCurrentProcess(), &process_mask, &system_mask))
+        {
+            qWarningErrno("GetProcessAffinityMask failed");
+            return;
+        }
+
+        // The thread can not run on the processors which are not in the mask of the process.
+        const DWORD_PTR thread_mask = static_cast<DWORD_PTR>(affinity_mask) & process_mask;
+        if (!thread_mask)
+        {
+            qWarning() << "Affinity mask of thread" << name << "has no processors of process";
+            return;
+        }
+
+        previous_affinity_mask_ = SetThreadAffinityMask(thread_, thread_mask);
+        if (!previous_affinity_mask_)
+            qWarningErrno("SetThreadAffinityMask failed");
+    }
+}
+
+ScopedThreadRole::~ScopedThreadRole()
+{
+    if (previous_affinity_mask_)
+        SetThreadAffinityMask(thread_, previous_affinity_mask_);
+
+    if (task_handle_)
+        AvRevertMmThreadCharacteristics(task_handle_);
+
+    SetThreadPriority(thread_, previous_priority_);
+}
+
+} // namespace aspia
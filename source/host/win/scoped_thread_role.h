@@ -0,0 +1,58 @@
+//
+// PROJECT:         Aspia
+// FILE:            host/win/scoped_thread_role.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_HOST__WIN__SCOPED_THREAD_ROLE_H
+#define _ASPIA_HOST__WIN__SCOPED_THREAD_ROLE_H
+
+#include <QtGlobal>
+
+#if !defined(Q_OS_WIN)
+#error This file for MS Windows only
+#endif // defined(Q_OS_WIN)
+
+#include <qt_windows.h>
+
+namespace aspia {
+
+//
+// Sets the scheduling of the current thread by its role in the desktop pipeline and restores
+// it when destroyed. The priority, the MMCSS task and the affinity are read from
+// HostSettings, so the threads of the pipeline are not preempted by the other processes of the
+// desktop when the processors are busy.
+//
+// The priority is one of "idle", "lowest", "below_normal", "normal", "above_normal", "highest"
+// or "time_critical". The MMCSS task is one of the tasks of the registry key
+// "HKLM\SOFTWARE\Microsoft\Windows NT\CurrentVersion\Multimedia\SystemProfile\Tasks".
+//
+class ScopedThreadRole
+{
+public:
+    enum class Role
+    {
+        CAPTURE, // The capture of the screen and the cursor.
+        ENCODE,  // The encoding of the frames.
+        NETWORK, // The channels of the connections.
+        INPUT    // The injection of the input.
+    };
+
+    explicit ScopedThreadRole(Role role);
+    ~ScopedThreadRole();
+
+private:
+    HANDLE thread_;
+    int previous_priority_;
+    DWORD_PTR previous_affinity_mask_ = 0;
+
+    // The handle of the MMCSS registration or nullptr if the thread is not registered.
+    HANDLE task_handle_ = nullptr;
+
+    Q_DISABLE_COPY(ScopedThreadRole)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_HOST__WIN__SCOPED_THREAD_ROLE_H
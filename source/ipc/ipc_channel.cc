@@ -8,6 +8,14 @@
 #include "ipc/ipc_channel.h"
 
 #include <QDebug>
+#include <QTimer>
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#include "base/trace_logger.h"
+#include "base/win/scoped_object.h"
+#include "ipc/ipc_shared_buffer.h"
 
 namespace aspia {
 
@@ -15,6 +23,36 @@ namespace {
 
 constexpr quint32 kMaxMessageSize = 16 * 1024 * 1024; // 16MB
 
+// The smaller messages are cheaper to pass through the pipe.
+constexpr int kMinSharedMessageSize = 64 * 1024; // 64KB
+
+// The queued messages are passed to the socket together while fewer bytes wait to be written
+// to the pipe, so the small messages do not wait for the previous ones to be written.
+constexpr qint64 kMaxSubmittedSize = 1024 * 1024; // 1MB
+
+// The producers are asked to wait while more data is queued than the high watermark, and to
+// continue when it is written down to the low one.
+constexpr qint64 kWriteQueueHighWatermark = 16 * 1024 * 1024; // 16MB
+constexpr qint64 kWriteQueueLowWatermark = 4 * 1024 * 1024; // 4MB
+
+// The complete messages which are in the buffer of the socket are read in one turn of the event
+// loop while their receivers request the next ones. Then the reading is continued in the next
+// turn, so a burst of messages does not delay other events.
+constexpr int kMaxReadBatchMessages = 64;
+constexpr int kMaxReadBatchSize = 1024 * 1024; // 1MB
+
+// The received messages may be kept by the receivers for a while (the host relays them to the
+// network channel). The buffers of such messages are reused when the receivers release them.
+constexpr size_t kMaxReadBuffers = 4;
+constexpr int kMaxReadBufferSize = 4 * 1024 * 1024; // 4MB
+
+// The body of SetupMessage. The handles are valid in the process of the client.
+struct SetupMessageBody
+{
+    quint64 client_write_buffer;
+    quint64 client_read_buffer;
+};
+
 } // namespace
 
 IpcChannel::IpcChannel(QLocalSocket* socket, QObject* parent)
@@ -43,6 +81,8 @@ IpcChannel::IpcChannel(QLocalSocket* socket, QObject* parent)
             Qt::QueuedConnection);
 }
 
+IpcChannel::~IpcChannel() = default;
+
 // static
 IpcChannel* IpcChannel::createClient(QObject* parent)
 {
@@ -72,17 +112,109 @@ void IpcChannel::readMessage()
     Q_ASSERT(!read_required_);
 
     read_required_ = true;
+
+    // The receivers request the next message from their handlers of messageReceived. It is read
+    // by the loop of onReadyRead, so the handlers are not nested.
+    if (receiving_)
+        return;
+
     onReadyRead();
 }
 
-void IpcChannel::writeMessage(int message_id, const QByteArray& buffer)
+void IpcChannel::writeMessage(int message_id,
+                              const QByteArray& buffer,
+                              MessagePriority priority,
+                              MessageClass message_class)
+{
+    write_queue_.push_back(WriteTask{ message_id, priority, message_class, buffer, 0, 0 });
+    write_queue_charge_.add(buffer.size());
+    scheduleWrite();
+
+    if (!write_queue_full_ && write_queue_charge_.size() > kWriteQueueHighWatermark)
+    {
+        write_queue_full_ = true;
+        emit writeQueueFull();
+    }
+}
+
+void IpcChannel::startSharedBuffers()
+{
+    ULONG process_id = 0;
+
+    if (!GetNamedPipeClientProcessId(reinterpret_cast<HANDLE>(socket_->socketDescriptor()),
+                                     &process_id))
+    {
+        qWarning("Unable to get the process of the IPC client. Shared memory is not used");
+        return;
+    }
+
+    ScopedHandle process(OpenProcess(PROCESS_DUP_HANDLE, FALSE, process_id));
+    if (!process.isValid())
+    {
+        qWarning("Unable to open the process of the IPC client. Shared memory is not used");
+        return;
+    }
+
+    std::unique_ptr<IpcSharedBuffer> read_buffer = IpcSharedBuffer::create();
+    std::unique_ptr<IpcSharedBuffer> write_buffer = IpcSharedBuffer::create();
+    if (!read_buffer || !write_buffer)
+        return;
+
+    // The buffer which is read by the server is written by the client and vice versa.
+    SetupMessageBody body;
+    body.client_write_buffer =
+        reinterpret_cast<quint64>(read_buffer->duplicateHandle(process.get()));
+    body.client_read_buffer =
+        reinterpret_cast<quint64>(write_buffer->duplicateHandle(process.get()));
+
+    if (!body.client_write_buffer || !body.client_read_buffer)
+    {
+        // The handle of the other direction stays open in the client otherwise.
+        for (quint64 handle : { body.client_write_buffer, body.client_read_buffer })
+        {
+            if (handle)
+            {
+                IpcSharedBuffer::closeDuplicatedHandle(process.get(),
+                                                       reinterpret_cast<HANDLE>(handle));
+            }
+        }
+        return;
+    }
+
+    shared_read_buffer_ = std::move(read_buffer);
+    shared_write_buffer_ = std::move(write_buffer);
+
+    // The setup message is the first message of the channel, so the client opens the buffers
+    // before it receives the positions of the messages.
+    Q_ASSERT(write_queue_.empty());
+
+    write_queue_.push_back(
+        WriteTask{ -1, HighPriority, GenericMessage,
+                   QByteArray(reinterpret_cast<const char*>(&body), sizeof(body)),
+                   SetupMessage, 0 });
+    write_queue_charge_.add(sizeof(body));
+    scheduleWrite();
+}
+
+bool IpcChannel::readSetupMessage()
 {
-    bool schedule_write = write_queue_.empty();
+    if (read_buffer_.size() != sizeof(SetupMessageBody) || shared_read_buffer_)
+        return false;
+
+    SetupMessageBody body;
+    memcpy(&body, read_buffer_.constData(), sizeof(body));
+
+    shared_write_buffer_ =
+        IpcSharedBuffer::open(reinterpret_cast<HANDLE>(body.client_write_buffer));
+    shared_read_buffer_ =
+        IpcSharedBuffer::open(reinterpret_cast<HANDLE>(body.client_read_buffer));
 
-    write_queue_.emplace(message_id, buffer);
+    // Without the buffer for writing the messages are sent through the pipe. The buffer for
+    // reading is required, because the server already writes into it.
+    if (!shared_write_buffer_)
+        qWarning("Unable to open the shared buffer. The messages are sent through the pipe");
 
-    if (schedule_write)
-        scheduleWrite();
+    return shared_read_buffer_ != nullptr;
 }
 
 void IpcChannel::onError(QLocalSocket::LocalSocketError /* socket_error */)
@@ -93,79 +225,152 @@ void IpcChannel::onError(QLocalSocket::LocalSocketError /* socket_error */)
 
 void IpcChannel::onBytesWritten(qint64 bytes)
 {
-    const QByteArray& write_buffer = write_queue_.front().second;
-
     written_ += bytes;
 
-    if (written_ < sizeof(MessageSizeType))
-    {
-        socket_->write(reinterpret_cast<const char*>(&write_size_) + written_,
-                       sizeof(MessageSizeType) - written_);
-    }
-    else if (written_ < sizeof(MessageSizeType) + write_buffer.size())
+    while (submit_index_ && written_ >= write_queue_.front().size)
     {
-        socket_->write(write_buffer.data() + (written_ - sizeof(MessageSizeType)),
-                       write_buffer.size() - (written_ - sizeof(MessageSizeType)));
-    }
-    else
-    {
-        int message_id = write_queue_.front().first;
+        const int message_id = write_queue_.front().message_id;
+        const qint64 size = write_queue_.front().size;
+
+        write_queue_charge_.add(-write_queue_.front().buffer.size());
+        write_queue_.pop_front();
+        --submit_index_;
+
+        written_ -= size;
+        submitted_ -= size;
 
         if (message_id != -1)
             emit messageWritten(message_id);
+    }
 
-        write_queue_.pop();
-        written_ = 0;
+    scheduleWrite();
 
-        if (!write_queue_.empty())
-            scheduleWrite();
+    if (write_queue_full_ && write_queue_charge_.size() <= kWriteQueueLowWatermark)
+    {
+        write_queue_full_ = false;
+        emit writeQueueDrained();
     }
 }
 
 void IpcChannel::onReadyRead()
 {
-    if (!read_required_)
+    if (!read_required_ || receiving_)
         return;
 
+    int batch_messages = 0;
+    int batch_size = 0;
+
     qint64 current;
 
     for (;;)
     {
-        if (!read_size_received_)
+        if (!read_header_received_)
         {
-            current = socket_->read(reinterpret_cast<char*>(&read_size_) + read_,
-                                    sizeof(MessageSizeType) - read_);
-            if (current + read_ == sizeof(MessageSizeType))
+            current = socket_->read(reinterpret_cast<char*>(&read_header_) + read_,
+                                    sizeof(MessageHeader) - read_);
+            if (current + read_ == sizeof(MessageHeader))
             {
-                read_size_received_ = true;
+                read_header_received_ = true;
+
+                if (!read_header_.size || read_header_.size > kMaxMessageSize)
+                {
+                    qWarning() << "Wrong message size: " << read_header_.size;
+                    socket_->abort();
+                    return;
+                }
+
+                if (read_header_.priority > LowPriority)
+                {
+                    qWarning() << "Wrong message priority: " << read_header_.priority;
+                    socket_->abort();
+                    return;
+                }
 
-                if (!read_size_ || read_size_ > kMaxMessageSize)
+                if (read_header_.message_class > LastMessageClass)
                 {
-                    qWarning() << "Wrong message size: " << read_size_;
+                    qWarning() << "Wrong message class: " << read_header_.message_class;
                     socket_->abort();
                     return;
                 }
 
-                if (read_buffer_.capacity() < static_cast<int>(read_size_))
-                    read_buffer_.reserve(read_size_);
+                if ((read_header_.flags & ~(SharedMessage | SetupMessage)) ||
+                    ((read_header_.flags & SharedMessage) && !shared_read_buffer_))
+                {
+                    qWarning() << "Wrong message flags: " << read_header_.flags;
+                    socket_->abort();
+                    return;
+                }
+
+                // The shared message is represented in the pipe by its position.
+                const quint32 body_size = (read_header_.flags & SharedMessage) ?
+                    sizeof(quint64) : read_header_.size;
 
-                read_buffer_.resize(read_size_);
+                // The shared message is copied to the buffer later.
+                prepareReadBuffer(static_cast<int>(read_header_.size));
+                read_buffer_.resize(body_size);
                 read_ = 0;
                 continue;
             }
         }
-        else if (read_ < read_size_)
+        else if (read_ < read_buffer_.size())
         {
-            current = socket_->read(read_buffer_.data() + read_, read_size_ - read_);
+            current = socket_->read(read_buffer_.data() + read_, read_buffer_.size() - read_);
         }
         else
         {
-            read_required_ = false;
-            read_size_received_ = false;
+            read_header_received_ = false;
             read_ = 0;
 
-            emit messageReceived(read_buffer_);
-            break;
+            if (read_header_.flags & SetupMessage)
+            {
+                if (!readSetupMessage())
+                {
+                    qWarning("Wrong setup message");
+                    socket_->abort();
+                    return;
+                }
+
+                // The message of the owner is not read yet.
+                continue;
+            }
+
+            if (read_header_.flags & SharedMessage)
+            {
+                ScopedTrace trace("ipc_read");
+
+                quint64 position;
+                memcpy(&position, read_buffer_.constData(), sizeof(position));
+
+                if (!shared_read_buffer_->read(
+                        position, static_cast<int>(read_header_.size), &read_buffer_))
+                {
+                    qWarning() << "Wrong position of the shared message: " << position;
+                    socket_->abort();
+                    return;
+                }
+            }
+
+            read_required_ = false;
+            batch_size += read_buffer_.size();
+
+            receiving_ = true;
+            emit messageReceived(read_buffer_,
+                                 static_cast<MessagePriority>(read_header_.priority),
+                                 static_cast<MessageClass>(read_header_.message_class));
+            receiving_ = false;
+
+            // The receivers do not request the next message or the channel is stopped.
+            if (!read_required_ || !socket_ || socket_->state() != QLocalSocket::ConnectedState)
+                break;
+
+            if (++batch_messages >= kMaxReadBatchMessages || batch_size >= kMaxReadBatchSize)
+            {
+                // The data which is already received does not cause readyRead again.
+                QTimer::singleShot(0, this, &IpcChannel::onReadyRead);
+                break;
+            }
+
+            continue;
         }
 
         if (current == 0)
@@ -175,19 +380,93 @@ void IpcChannel::onReadyRead()
     }
 }
 
+void IpcChannel::prepareReadBuffer(int size)
+{
+    // The buffer which is kept by the receivers is replaced instead of detaching it, because
+    // the detaching copies the previous message.
+    if (!read_buffer_.isNull() && !read_buffer_.isDetached())
+    {
+        if (read_buffers_.size() < kMaxReadBuffers &&
+            read_buffer_.capacity() <= kMaxReadBufferSize)
+        {
+            read_buffers_.emplace_back(std::move(read_buffer_));
+        }
+
+        read_buffer_ = QByteArray();
+
+        for (auto it = read_buffers_.begin(); it != read_buffers_.end(); ++it)
+        {
+            if (it->isDetached())
+            {
+                read_buffer_ = std::move(*it);
+                read_buffers_.erase(it);
+                break;
+            }
+        }
+    }
+
+    if (read_buffer_.capacity() < size)
+        read_buffer_.reserve(size);
+
+    read_buffer_.resize(size);
+}
+
 void IpcChannel::scheduleWrite()
 {
-    const QByteArray& write_buffer = write_queue_.front().second;
+    // The headers and the bodies of the messages are written by one call, so the pipe gets
+    // them by one write operation.
+    QByteArray batch;
+
+    const qint64 begin_time = TraceLogger::isEnabled() ? TraceLogger::currentTime() : -1;
 
-    write_size_ = write_buffer.size();
-    if (!write_size_ || write_size_ > kMaxMessageSize)
+    while (submit_index_ < write_queue_.size() && submitted_ < kMaxSubmittedSize)
     {
-        qWarning() << "Wrong message size: " << write_size_;
-        socket_->abort();
-        return;
+        WriteTask& task = write_queue_[submit_index_];
+
+        MessageHeader header;
+        header.size = task.buffer.size();
+        header.priority = task.priority;
+        header.message_class = task.message_class;
+        header.flags = task.flags;
+
+        if (!header.size || header.size > kMaxMessageSize)
+        {
+            qWarning() << "Wrong message size: " << header.size;
+            socket_->abort();
+            return;
+        }
+
+        quint64 position;
+
+        // If the ring is full, then the message is sent through the pipe.
+        if (shared_write_buffer_ && task.buffer.size() >= kMinSharedMessageSize &&
+            shared_write_buffer_->write(task.buffer, &position))
+        {
+            header.flags |= SharedMessage;
+
+            // The message is in the shared memory. Only its position is written to the pipe.
+            task.buffer = QByteArray(reinterpret_cast<const char*>(&position), sizeof(position));
+        }
+
+        task.size = sizeof(MessageHeader) + task.buffer.size();
+
+        batch.append(reinterpret_cast<const char*>(&header), sizeof(MessageHeader));
+        batch.append(task.buffer);
+
+        // The data is copied to the batch, the buffer is not needed anymore.
+        task.buffer = QByteArray();
+
+        submitted_ += task.size;
+        ++submit_index_;
     }
 
-    socket_->write(reinterpret_cast<const char*>(&write_size_), sizeof(MessageSizeType));
+    if (!batch.isEmpty())
+    {
+        socket_->write(batch);
+
+        if (begin_time != -1)
+            TraceLogger::addSpan("ipc_write", begin_time, TraceLogger::currentTime(), 0);
+    }
 }
 
 } // namespace aspia
@@ -12,12 +12,19 @@
 #include <QLocalSocket>
 #include <QPointer>
 
-#include <queue>
+#include <deque>
+#include <memory>
 #include <utility>
+#include <vector>
+
+#include "base/memory_counters.h"
+#include "base/message_class.h"
+#include "base/message_priority.h"
 
 namespace aspia {
 
 class IpcServer;
+class IpcSharedBuffer;
 
 class IpcChannel : public QObject
 {
@@ -30,13 +37,17 @@ public:
         Connected
     };
 
-    ~IpcChannel() = default;
+    ~IpcChannel();
 
     static IpcChannel* createClient(QObject* parent = nullptr);
 
     void connectToServer(const QString& channel_name);
     State channelState() const { return state_; }
 
+    // True after |writeQueueFull| until |writeQueueDrained|. The messages are still queued while
+    // the queue is full, but the producers should wait for the signal before writing more.
+    bool isWriteQueueFull() const { return write_queue_full_; }
+
 public slots:
     void stop();
 
@@ -45,15 +56,23 @@ public slots:
     void readMessage();
 
     // Sends a message. If the |message_id| is not -1, then after the message is sent,
-    // the signal |messageWritten| is called.
-    void writeMessage(int message_id, const QByteArray& buffer);
+    // the signal |messageWritten| is called. The priority and |message_class| are passed to
+    // the other side with the message.
+    void writeMessage(int message_id,
+                      const QByteArray& buffer,
+                      MessagePriority priority = NormalPriority,
+                      MessageClass message_class = GenericMessage);
 
 signals:
     void connected();
     void disconnected();
     void errorOccurred();
     void messageWritten(int message_id);
-    void messageReceived(const QByteArray& buffer);
+    void writeQueueFull();
+    void writeQueueDrained();
+    void messageReceived(const QByteArray& buffer,
+                         MessagePriority priority,
+                         MessageClass message_class);
 
 private slots:
     void onError(QLocalSocket::LocalSocketError socket_error);
@@ -65,21 +84,74 @@ private:
 
     IpcChannel(QLocalSocket* socket, QObject* parent);
 
+    // Called by the server side. Creates the shared buffers of both directions and passes
+    // them to the client process.
+    void startSharedBuffers();
+    bool readSetupMessage();
+
     void scheduleWrite();
 
-    using MessageSizeType = quint32;
+    // Resizes |read_buffer_| to |size| bytes for the next message. The released buffer of
+    // |read_buffers_| is used if the receivers keep the previous message.
+    void prepareReadBuffer(int size);
+
+    enum MessageFlags
+    {
+        // The message is in the shared buffer. The pipe carries its position.
+        SharedMessage = 1,
+
+        // The handles of the shared buffers. The message is not passed to the owner.
+        SetupMessage = 2
+    };
+
+    struct MessageHeader
+    {
+        quint32 size;
+        quint32 priority;
+        quint32 message_class;
+        quint32 flags;
+    };
+
+    struct WriteTask
+    {
+        int message_id;
+        MessagePriority priority;
+        MessageClass message_class;
+        QByteArray buffer;
+        quint32 flags;
+
+        // The size of the message in the pipe with the header. Set when the message is passed
+        // to the socket.
+        qint64 size;
+    };
 
     QPointer<QLocalSocket> socket_;
     State state_ = NotConnected;
 
-    std::queue<std::pair<int, QByteArray>> write_queue_;
-    MessageSizeType write_size_ = 0;
+    // The first |submit_index_| messages of the queue are passed to the socket and
+    // |submitted_| bytes of them are not written yet. |written_| bytes of the first message
+    // are written.
+    std::deque<WriteTask> write_queue_;
+    MemoryCounters::Charge write_queue_charge_{ MemoryCounters::QueueMemory };
+    bool write_queue_full_ = false;
+    size_t submit_index_ = 0;
+    qint64 submitted_ = 0;
     qint64 written_ = 0;
 
+    // The large messages are passed through the shared memory if it is available.
+    std::unique_ptr<IpcSharedBuffer> shared_write_buffer_;
+    std::unique_ptr<IpcSharedBuffer> shared_read_buffer_;
+
     bool read_required_ = false;
-    bool read_size_received_ = false;
+    bool read_header_received_ = false;
+
+    // True while the received message is passed to the receivers.
+    bool receiving_ = false;
     QByteArray read_buffer_;
-    MessageSizeType read_size_ = 0;
+    MessageHeader read_header_;
+
+    // Buffers of the received messages which are kept by the receivers.
+    std::vector<QByteArray> read_buffers_;
     qint64 read_ = 0;
 
     Q_DISABLE_COPY(IpcChannel)
@@ -84,7 +84,11 @@ void IpcServer::onNewConnection()
     if (server_->hasPendingConnections())
     {
         QLocalSocket* socket = server_->nextPendingConnection();
-        emit newConnection(new IpcChannel(socket, nullptr));
+
+        IpcChannel* channel = new IpcChannel(socket, nullptr);
+        channel->startSharedBuffers();
+
+        emit newConnection(channel);
         emit finished();
     }
 }
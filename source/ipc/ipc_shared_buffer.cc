@@ -0,0 +1,152 @@
+//
+// PROJECT:         Aspia
+// FILE:            ipc/ipc_shared_buffer.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "ipc/ipc_shared_buffer.h"
+
+#include <atomic>
+#include <new>
+
+#include "base/errno_logging.h"
+
+namespace aspia {
+
+namespace {
+
+// The size of the ring. The largest message of the channel (16MB) fits into it.
+constexpr quint64 kDataSize = 32 * 1024 * 1024; // 32MB
+
+// The header is followed by the data of the ring.
+constexpr quint64 kHeaderSize = 64;
+
+constexpr quint64 kMappingSize = kHeaderSize + kDataSize;
+
+} // namespace
+
+struct IpcSharedBuffer::Header
+{
+    // The position up to which the reader has released the space. The positions increase
+    // monotonically, the offset in the ring is the position modulo the size of the ring.
+    std::atomic<quint64> read_position;
+};
+
+IpcSharedBuffer::IpcSharedBuffer(ScopedHandle mapping, quint8* memory)
+    : mapping_(std::move(mapping)),
+      memory_(memory),
+      header_(reinterpret_cast<Header*>(memory)),
+      data_(memory + kHeaderSize)
+{
+    static_assert(sizeof(Header) <= kHeaderSize);
+}
+
+IpcSharedBuffer::~IpcSharedBuffer()
+{
+    UnmapViewOfFile(memory_);
+}
+
+// static
+std::unique_ptr<IpcSharedBuffer> IpcSharedBuffer::create()
+{
+    ScopedHandle mapping(CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+                                            static_cast<DWORD>(kMappingSize >> 32),
+                                            static_cast<DWORD>(kMappingSize),
+                                            nullptr));
+    if (!mapping.isValid())
+    {
+        qWarningErrno("CreateFileMappingW failed");
+        return nullptr;
+    }
+
+    void* memory = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, kMappingSize);
+    if (!memory)
+    {
+        qWarningErrno("MapViewOfFile failed");
+        return nullptr;
+    }
+
+    new (memory) Header{ 0 };
+
+    return std::unique_ptr<IpcSharedBuffer>(
+        new IpcSharedBuffer(std::move(mapping), reinterpret_cast<quint8*>(memory)));
+}
+
+// static
+std::unique_ptr<IpcSharedBuffer> IpcSharedBuffer::open(HANDLE handle)
+{
+    ScopedHandle mapping(handle);
+
+    void* memory = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, kMappingSize);
+    if (!memory)
+    {
+        qWarningErrno("MapViewOfFile failed");
+        return nullptr;
+    }
+
+    return std::unique_ptr<IpcSharedBuffer>(
+        new IpcSharedBuffer(std::move(mapping), reinterpret_cast<quint8*>(memory)));
+}
+
+HANDLE IpcSharedBuffer::duplicateHandle(HANDLE process) const
+{
+    HANDLE target = nullptr;
+
+    if (!DuplicateHandle(GetCurrentProcess(), mapping_.get(), process, &target,
+                         FILE_MAP_READ | FILE_MAP_WRITE, FALSE, 0))
+    {
+        qWarningErrno("DuplicateHandle failed");
+        return nullptr;
+    }
+
+    return target;
+}
+
+// static
+void IpcSharedBuffer::closeDuplicatedHandle(HANDLE process, HANDLE handle)
+{
+    if (!DuplicateHandle(process, handle, nullptr, nullptr, 0, FALSE, DUPLICATE_CLOSE_SOURCE))
+        qWarningErrno("DuplicateHandle failed");
+}
+
+bool IpcSharedBuffer::write(const QByteArray& buffer, quint64* position)
+{
+    const quint64 size = static_cast<quint64>(buffer.size());
+    if (!size || size > kDataSize)
+        return false;
+
+    quint64 start = write_position_;
+    const quint64 offset = start % kDataSize;
+
+    // The message is never split. The rest of the ring is skipped and is released by the
+    // reader together with the message.
+    if (offset + size > kDataSize)
+        start += kDataSize - offset;
+
+    const quint64 read_position = header_->read_position.load(std::memory_order_acquire);
+    if (start + size - read_position > kDataSize)
+        return false;
+
+    memcpy(data_ + (start % kDataSize), buffer.constData(), size);
+
+    write_position_ = start + size;
+    *position = start;
+    return true;
+}
+
+bool IpcSharedBuffer::read(quint64 position, int size, QByteArray* buffer)
+{
+    const quint64 offset = position % kDataSize;
+
+    if (size <= 0 || offset + static_cast<quint64>(size) > kDataSize)
+        return false;
+
+    buffer->resize(size);
+    memcpy(buffer->data(), data_ + offset, size);
+
+    header_->read_position.store(position + size, std::memory_order_release);
+    return true;
+}
+
+} // namespace aspia
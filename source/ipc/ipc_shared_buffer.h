@@ -0,0 +1,68 @@
+//
+// PROJECT:         Aspia
+// FILE:            ipc/ipc_shared_buffer.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_IPC__IPC_SHARED_BUFFER_H
+#define _ASPIA_IPC__IPC_SHARED_BUFFER_H
+
+#include <QByteArray>
+
+#include <memory>
+
+#include "base/win/scoped_object.h"
+
+namespace aspia {
+
+//
+// Ring buffer in the shared memory for the large messages of IpcChannel. The buffer has one
+// writer process and one reader process. The messages are read in the order in which they
+// are written, and the pipe of the channel carries only their positions. The reader releases
+// the space of the message after copying it out.
+//
+class IpcSharedBuffer
+{
+public:
+    ~IpcSharedBuffer();
+
+    // Creates a new buffer.
+    static std::unique_ptr<IpcSharedBuffer> create();
+
+    // Opens the buffer by the handle duplicated from the process which created it.
+    static std::unique_ptr<IpcSharedBuffer> open(HANDLE handle);
+
+    // Duplicates the handle of the buffer into |process|. Returns nullptr on error.
+    HANDLE duplicateHandle(HANDLE process) const;
+
+    // Closes |handle| which is duplicated into |process| and is not passed to it.
+    static void closeDuplicatedHandle(HANDLE process, HANDLE handle);
+
+    // Copies |buffer| into the ring. If there is not enough free space, then false is returned
+    // and the message must be sent through the pipe.
+    bool write(const QByteArray& buffer, quint64* position);
+
+    // Copies the message of |size| bytes at |position| into |buffer| and releases its space.
+    // Returns false if the position is not valid.
+    bool read(quint64 position, int size, QByteArray* buffer);
+
+private:
+    struct Header;
+
+    IpcSharedBuffer(ScopedHandle mapping, quint8* memory);
+
+    ScopedHandle mapping_;
+    quint8* memory_;
+    Header* header_;
+    quint8* data_;
+
+    // Used only by the writer.
+    quint64 write_position_ = 0;
+
+    Q_DISABLE_COPY(IpcSharedBuffer)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_IPC__IPC_SHARED_BUFFER_H
@@ -0,0 +1,72 @@
+//
+// PROJECT:         Aspia
+// FILE:            network/bandwidth_estimator.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "network/bandwidth_estimator.h"
+
+#include <algorithm>
+
+namespace aspia {
+
+namespace {
+
+// Number of the last messages used for the estimate.
+constexpr size_t kMaxSamples = 16;
+
+// Number of the last messages used for the minimal round trip time.
+constexpr size_t kMaxRttHistory = 256;
+
+// The estimate is not calculated until this amount of data is delivered.
+constexpr qint64 kMinEstimateSize = 64 * 1024;
+
+// The transmission time of one message is not less than this value. It limits the estimate
+// for small messages, whose delivery time is within the measurement error.
+constexpr std::chrono::milliseconds kMinTransmissionTime(1);
+
+} // namespace
+
+void BandwidthEstimator::addSample(qint64 size, std::chrono::milliseconds round_trip_time)
+{
+    if (round_trip_time.count() < 0)
+        round_trip_time = std::chrono::milliseconds::zero();
+
+    samples_.push_back({ size, round_trip_time });
+    if (samples_.size() > kMaxSamples)
+        samples_.pop_front();
+
+    rtt_history_.push_back(round_trip_time);
+    if (rtt_history_.size() > kMaxRttHistory)
+        rtt_history_.pop_front();
+}
+
+std::chrono::milliseconds BandwidthEstimator::minRoundTripTime() const
+{
+    if (rtt_history_.empty())
+        return std::chrono::milliseconds::zero();
+
+    return *std::min_element(rtt_history_.begin(), rtt_history_.end());
+}
+
+qint64 BandwidthEstimator::bandwidth() const
+{
+    const std::chrono::milliseconds min_rtt = minRoundTripTime();
+
+    qint64 total_size = 0;
+    std::chrono::milliseconds total_time(0);
+
+    for (const auto& sample : samples_)
+    {
+        total_size += sample.size;
+        total_time += std::max(sample.rtt - min_rtt, kMinTransmissionTime);
+    }
+
+    if (total_size < kMinEstimateSize)
+        return 0;
+
+    return total_size * 1000 / total_time.count();
+}
+
+} // namespace aspia
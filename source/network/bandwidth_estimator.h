@@ -0,0 +1,59 @@
+//
+// PROJECT:         Aspia
+// FILE:            network/bandwidth_estimator.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_NETWORK__BANDWIDTH_ESTIMATOR_H
+#define _ASPIA_NETWORK__BANDWIDTH_ESTIMATOR_H
+
+#include <QtGlobal>
+
+#include <chrono>
+#include <deque>
+
+namespace aspia {
+
+//
+// Estimates the bandwidth of the connection by the delivery times of the messages.
+// The time of the delivery above the minimal round trip time is considered as the time of
+// the transmission of the message. While the link is not congested this gives the capacity
+// of the link even if it is not fully used. When the queues grow, the estimate decreases.
+//
+class BandwidthEstimator
+{
+public:
+    BandwidthEstimator() = default;
+    ~BandwidthEstimator() = default;
+
+    // Adds the delivered message of |size| bytes. |round_trip_time| is the time between
+    // sending the message and receiving the acknowledgement minus the processing time of
+    // the peer.
+    void addSample(qint64 size, std::chrono::milliseconds round_trip_time);
+
+    // Returns the estimated bandwidth in bytes per second or 0 if it is not known yet.
+    qint64 bandwidth() const;
+
+    // Returns the minimal round trip time of the recent messages.
+    std::chrono::milliseconds minRoundTripTime() const;
+
+private:
+    struct Sample
+    {
+        qint64 size;
+        std::chrono::milliseconds rtt;
+    };
+
+    std::deque<Sample> samples_;
+
+    // The history is longer than |samples_|, so that the minimum is not raised by the queues
+    // that exist for a short time. It is still limited, because the route may change.
+    std::deque<std::chrono::milliseconds> rtt_history_;
+
+    Q_DISABLE_COPY(BandwidthEstimator)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_NETWORK__BANDWIDTH_ESTIMATOR_H
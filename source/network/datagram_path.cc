@@ -0,0 +1,1022 @@
+//
+// PROJECT:         Aspia
+// FILE:            network/datagram_path.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "network/datagram_path.h"
+
+#include <QTimerEvent>
+#include <QUdpSocket>
+#include <QtEndian>
+
+#include <algorithm>
+
+#include "crypto/encryptor.h"
+#include "network/token_bucket.h"
+
+namespace aspia {
+
+namespace {
+
+// The datagrams are not fragmented by the paths with the minimal MTU of IPv6 and the tunnels.
+constexpr int kMaxDatagramSize = 1200;
+
+// Each datagram starts with its number (the nonce) and the authentication tag.
+constexpr int kNumberSize = 8;
+constexpr int kDatagramHeaderSize = kNumberSize + Encryptor::kEncryptionOverhead;
+constexpr int kMaxPayloadSize = kMaxDatagramSize - kDatagramHeaderSize;
+
+// The type, the number of the message, the fragment, the number of the fragments, the class,
+// the priority and the round trip time of the sender.
+constexpr int kDataHeaderSize = 1 + 4 + 2 + 2 + 1 + 1 + 2;
+constexpr int kMaxFragmentSize = kMaxPayloadSize - kDataHeaderSize;
+
+// The type, the next expected message, the largest number of the received datagrams and the
+// time for which the receiver has held it, in microseconds.
+constexpr int kStatusSize = 1 + 4 + 8 + 4;
+
+// Each range of the lost fragments has the number of the message, the first fragment and the
+// number of the fragments. The zero number means all fragments of the message.
+constexpr int kNackRangeSize = 4 + 2 + 2;
+
+constexpr int kMaxMessageSize = 16 * 1024 * 1024; // 16MB
+static_assert(kMaxMessageSize / kMaxFragmentSize < 65535, "Too many fragments");
+
+// The sent messages are kept until they are acknowledged. The messages which are sent
+// completely are released before if the limit is exceeded, and the receiver skips them when it
+// requests them.
+constexpr qint64 kMaxSendBufferSize = 16 * 1024 * 1024; // 16MB
+
+// The receiver skips the oldest messages if more of them are received partially.
+constexpr quint32 kMaxPendingMessages = 256;
+constexpr qint64 kMaxReceiveBufferSize = 32 * 1024 * 1024; // 32MB
+
+// The lost fragments are requested again for this time, then the message is skipped. A later
+// video frame is more useful than this one.
+constexpr std::chrono::seconds kMaxRecoveryTime{ 1 };
+
+// The fragments are requested again after the round trip time, but not more often.
+constexpr std::chrono::milliseconds kMinNackInterval{ 20 };
+
+constexpr std::chrono::milliseconds kTickInterval{ 10 };
+constexpr std::chrono::milliseconds kStatusInterval{ 100 };
+
+// The sender fails if the first datagram of the receiver is not received in |kStartTimeout|,
+// or if no datagram (the receiver sends its status each kStatusInterval) or no acknowledgement
+// of the sent messages is received in |kPathTimeout|.
+constexpr std::chrono::seconds kStartTimeout{ 10 };
+constexpr std::chrono::seconds kPathTimeout{ 3 };
+
+// The rate of the sender in bytes per second. The datagrams are sent by the bursts of no more
+// than kMaxBurstSize.
+constexpr double kInitialPacingRate = 4 * 1024 * 1024;
+constexpr double kMinPacingRate = 128 * 1024;
+constexpr double kMaxPacingRate = 128 * 1024 * 1024;
+constexpr double kMaxBurstSize = 16 * kMaxDatagramSize;
+
+// The last sent fragment is sent again if the acknowledgement is not received in the timeout.
+constexpr std::chrono::milliseconds kMinProbeTimeout{ 30 };
+constexpr std::chrono::seconds kMaxProbeTimeout{ 1 };
+constexpr std::chrono::milliseconds kInitialProbeTimeout{ 200 };
+
+// The times of the recent datagrams of the sender for the round trip time.
+constexpr size_t kMaxSendTimes = 4096;
+
+double secondsBetween(std::chrono::steady_clock::time_point from,
+                      std::chrono::steady_clock::time_point to)
+{
+    return std::chrono::duration<double>(to - from).count();
+}
+
+} // namespace
+
+DatagramPath::DatagramPath(Role role, const Encryptor* encryptor, QObject* parent)
+    : QObject(parent),
+      role_(role),
+      encryptor_(encryptor),
+      socket_(new QUdpSocket(this)),
+      pacing_rate_(kInitialPacingRate),
+      budget_(kMaxBurstSize)
+{
+    Q_ASSERT(encryptor_);
+
+    connect(socket_, &QUdpSocket::readyRead, this, &DatagramPath::onReadyRead);
+}
+
+DatagramPath::~DatagramPath() = default;
+
+bool DatagramPath::bind(const QHostAddress& address)
+{
+    Q_ASSERT(role_ == Sender);
+
+    if (!socket_->bind(address, 0))
+    {
+        qWarning() << "Unable to bind the datagram socket:" << socket_->errorString();
+        return false;
+    }
+
+    tick_timer_id_ = startTimer(kTickInterval);
+    return true;
+}
+
+int DatagramPath::localPort() const
+{
+    return socket_->localPort();
+}
+
+bool DatagramPath::connectToPeer(const QHostAddress& address, int port)
+{
+    Q_ASSERT(role_ == Receiver);
+
+    if (port <= 0 || port > 65535)
+        return false;
+
+    const QHostAddress any_address = (address.protocol() == QAbstractSocket::IPv6Protocol) ?
+        QHostAddress(QHostAddress::AnyIPv6) : QHostAddress(QHostAddress::AnyIPv4);
+
+    if (!socket_->bind(any_address, 0))
+    {
+        qWarning() << "Unable to bind the datagram socket:" << socket_->errorString();
+        return false;
+    }
+
+    peer_address_ = address;
+    peer_port_ = static_cast<quint16>(port);
+    tick_timer_id_ = startTimer(kTickInterval);
+
+    // The first status opens the path through the NAT and the firewall of the client.
+    sendStatus();
+    return true;
+}
+
+void DatagramPath::addBandwidthLimit(std::shared_ptr<TokenBucket> bucket)
+{
+    if (bucket)
+        bandwidth_limits_.emplace_back(std::move(bucket));
+}
+
+bool DatagramPath::writeMessage(int message_id,
+                                const QByteArray& buffer,
+                                MessagePriority priority,
+                                MessageClass message_class)
+{
+    Q_ASSERT(role_ == Sender);
+
+    if (stopped_ || buffer.isEmpty() || buffer.size() > kMaxMessageSize)
+        return false;
+
+    SentMessage message;
+    message.number = next_message_++;
+    message.message_id = message_id;
+    message.priority = priority;
+    message.message_class = message_class;
+    message.buffer = buffer;
+    message.count = (buffer.size() + kMaxFragmentSize - 1) / kMaxFragmentSize;
+
+    sent_bytes_ += buffer.size();
+    sent_messages_.emplace_back(std::move(message));
+
+    releaseMessages();
+    sendMessages();
+    return true;
+}
+
+bool DatagramPath::takeMessage(QByteArray* buffer,
+                               MessagePriority* priority,
+                               MessageClass* message_class)
+{
+    Q_ASSERT(!ready_messages_.empty());
+
+    ReadyMessage& message = ready_messages_.front();
+
+    buffer->swap(message.buffer);
+    *priority = message.priority;
+    *message_class = message.message_class;
+
+    ready_messages_.pop_front();
+    return !buffer->isNull();
+}
+
+void DatagramPath::stop()
+{
+    if (stopped_)
+        return;
+
+    if (role_ == Receiver && !received_messages_.empty())
+        skipMessages(received_messages_.rbegin()->first + 1);
+
+    stopped_ = true;
+
+    for (int* timer_id : { &tick_timer_id_, &pacing_timer_id_ })
+    {
+        if (*timer_id)
+        {
+            killTimer(*timer_id);
+            *timer_id = 0;
+        }
+    }
+
+    socket_->close();
+
+    sent_messages_.clear();
+    retransmits_.clear();
+    send_index_ = 0;
+    sent_bytes_ = 0;
+}
+
+void DatagramPath::timerEvent(QTimerEvent* event)
+{
+    if (event->timerId() == pacing_timer_id_)
+    {
+        killTimer(pacing_timer_id_);
+        pacing_timer_id_ = 0;
+
+        sendMessages();
+    }
+    else if (event->timerId() == tick_timer_id_)
+    {
+        if (role_ == Sender)
+            checkSender(Clock::now());
+        else
+            checkReceiver(Clock::now());
+    }
+}
+
+void DatagramPath::onReadyRead()
+{
+    quint8 datagram[kMaxDatagramSize];
+
+    while (!stopped_ && socket_->hasPendingDatagrams())
+    {
+        QHostAddress address;
+        quint16 port;
+
+        // The larger datagrams are truncated and are not authenticated.
+        const qint64 size = socket_->readDatagram(
+            reinterpret_cast<char*>(datagram), sizeof(datagram), &address, &port);
+        if (size < 0)
+            break;
+
+        emit bytesRead(size);
+
+        if (role_ == Receiver &&
+            (port != peer_port_ ||
+             !address.isEqual(peer_address_, QHostAddress::ConvertV4MappedToIPv4)))
+        {
+            continue;
+        }
+
+        processDatagram(datagram, static_cast<int>(size), address, port);
+    }
+}
+
+bool DatagramPath::sendDatagram(const quint8* payload, int size)
+{
+    Q_ASSERT(size > 0 && size <= kMaxPayloadSize);
+
+    if (stopped_ || !peer_port_)
+        return false;
+
+    quint8 datagram[kMaxDatagramSize];
+
+    // The number is used even if the datagram is not sent, so the nonce is not repeated with
+    // another payload.
+    const quint64 number = send_number_++;
+
+    qToLittleEndian(number, datagram);
+    memcpy(datagram + kDatagramHeaderSize, payload, size);
+
+    if (!encryptor_->encryptDatagram(number, datagram + kDatagramHeaderSize, size,
+                                     datagram + kNumberSize))
+    {
+        return false;
+    }
+
+    const qint64 result = socket_->writeDatagram(reinterpret_cast<const char*>(datagram),
+                                                 kDatagramHeaderSize + size,
+                                                 peer_address_, peer_port_);
+    if (result <= 0)
+        return false;
+
+    for (const auto& bucket : bandwidth_limits_)
+        bucket->consume(result);
+
+    if (role_ == Sender)
+    {
+        send_times_.emplace_back(number, Clock::now());
+        if (send_times_.size() > kMaxSendTimes)
+            send_times_.pop_front();
+    }
+
+    emit bytesWritten(result);
+    return true;
+}
+
+void DatagramPath::processDatagram(quint8* datagram, int size, const QHostAddress& address,
+                                   quint16 port)
+{
+    if (size <= kDatagramHeaderSize)
+        return;
+
+    const quint64 number = qFromLittleEndian<quint64>(datagram);
+    quint8* payload = datagram + kDatagramHeaderSize;
+    const int payload_size = size - kDatagramHeaderSize;
+
+    if (!encryptor_->decryptDatagram(number, payload, payload_size, datagram + kNumberSize))
+        return;
+
+    const bool newest = number > largest_number_;
+    if (!acceptNumber(number))
+        return;
+
+    const Clock::time_point now = Clock::now();
+
+    receive_time_ = now;
+    if (newest)
+        largest_time_ = now;
+
+    if (role_ == Sender)
+    {
+        // The datagrams are sent to the current address of the receiver.
+        if (newest)
+        {
+            peer_address_ = address;
+            peer_port_ = port;
+        }
+
+        if (!ready_)
+        {
+            qInfo() << "Datagrams from" << address.toString() << "are received";
+
+            ready_ = true;
+            budget_time_ = now;
+            probe_time_ = now;
+            increase_time_ = now;
+            decrease_time_ = now;
+        }
+
+        if (payload[0] == StatusDatagram)
+            readStatus(payload + 1, payload_size - 1);
+        else if (payload[0] == NackDatagram)
+            readNack(payload + 1, payload_size - 1);
+    }
+    else
+    {
+        if (payload[0] == DataDatagram)
+            readData(payload + 1, payload_size - 1);
+        else if (payload[0] == GoneDatagram)
+            readGone(payload + 1, payload_size - 1);
+    }
+}
+
+bool DatagramPath::acceptNumber(quint64 number)
+{
+    if (!number)
+        return false;
+
+    if (number > largest_number_)
+    {
+        const quint64 shift = number - largest_number_;
+
+        received_mask_ = (shift >= 64) ? 0 : (received_mask_ << shift);
+        received_mask_ |= 1;
+        largest_number_ = number;
+        return true;
+    }
+
+    const quint64 offset = largest_number_ - number;
+    if (offset >= 64)
+        return false;
+
+    const quint64 bit = 1ULL << offset;
+    if (received_mask_ & bit)
+        return false;
+
+    received_mask_ |= bit;
+    return true;
+}
+
+void DatagramPath::fail()
+{
+    stop();
+    emit failed();
+}
+
+void DatagramPath::sendMessages()
+{
+    if (!ready_ || stopped_ || pacing_timer_id_)
+        return;
+
+    const Clock::time_point now = Clock::now();
+
+    budget_ = std::min(budget_ + pacing_rate_ * secondsBetween(budget_time_, now),
+                       kMaxBurstSize);
+    budget_time_ = now;
+
+    std::vector<int> written_messages;
+
+    for (;;)
+    {
+        const bool retransmit = !retransmits_.empty();
+        const SentMessage* message;
+        int fragment;
+
+        if (retransmit)
+        {
+            message = findMessage(retransmits_.begin()->first);
+            fragment = retransmits_.begin()->second;
+
+            if (!message)
+            {
+                retransmits_.erase(retransmits_.begin());
+                continue;
+            }
+        }
+        else if (send_index_ < sent_messages_.size())
+        {
+            message = &sent_messages_[send_index_];
+            fragment = message->next_fragment;
+        }
+        else
+        {
+            break;
+        }
+
+        std::chrono::microseconds delay(0);
+
+        if (budget_ < kMaxDatagramSize)
+        {
+            // More data is sent than the rate allows, so the rate may be higher.
+            pacing_limited_ = true;
+            delay = std::chrono::microseconds(
+                static_cast<qint64>((kMaxDatagramSize - budget_) * 1000000 / pacing_rate_));
+        }
+
+        for (const auto& bucket : bandwidth_limits_)
+        {
+            if (bucket->available() < kMaxDatagramSize)
+            {
+                delay = std::max<std::chrono::microseconds>(
+                    delay, bucket->delay(kMaxDatagramSize));
+            }
+        }
+
+        if (delay.count() > 0)
+        {
+            pacing_timer_id_ = startTimer(
+                std::max(std::chrono::duration_cast<std::chrono::milliseconds>(delay),
+                         std::chrono::milliseconds(1)),
+                Qt::PreciseTimer);
+            break;
+        }
+
+        const int size = sendFragment(*message, fragment);
+        if (!size)
+        {
+            // The buffer of the socket is full.
+            pacing_timer_id_ = startTimer(std::chrono::milliseconds(1), Qt::PreciseTimer);
+            break;
+        }
+
+        budget_ -= size;
+
+        if (retransmit)
+        {
+            retransmits_.erase(retransmits_.begin());
+            continue;
+        }
+
+        probe_time_ = now;
+
+        SentMessage& sent_message = sent_messages_[send_index_];
+        if (++sent_message.next_fragment == sent_message.count)
+        {
+            sent_message.sent_time = now;
+            ++send_index_;
+
+            if (sent_message.message_id != -1)
+                written_messages.push_back(sent_message.message_id);
+        }
+    }
+
+    // The handlers may write new messages, so they are called after the queue is updated.
+    for (int message_id : written_messages)
+        emit messageWritten(message_id);
+}
+
+int DatagramPath::sendFragment(const SentMessage& message, int fragment)
+{
+    const int offset = fragment * kMaxFragmentSize;
+    const int size = std::min(kMaxFragmentSize, message.buffer.size() - offset);
+
+    const qint64 rtt = std::chrono::duration_cast<std::chrono::milliseconds>(
+        smoothed_rtt_).count();
+
+    quint8 payload[kMaxPayloadSize];
+
+    payload[0] = DataDatagram;
+    qToLittleEndian<quint32>(message.number, payload + 1);
+    qToLittleEndian<quint16>(static_cast<quint16>(fragment), payload + 5);
+    qToLittleEndian<quint16>(static_cast<quint16>(message.count), payload + 7);
+    payload[9] = static_cast<quint8>(message.message_class);
+    payload[10] = static_cast<quint8>(message.priority);
+    qToLittleEndian<quint16>(static_cast<quint16>(std::min<qint64>(rtt, 65535)), payload + 11);
+    memcpy(payload + kDataHeaderSize, message.buffer.constData() + offset, size);
+
+    if (!sendDatagram(payload, kDataHeaderSize + size))
+        return 0;
+
+    return kDatagramHeaderSize + kDataHeaderSize + size;
+}
+
+void DatagramPath::readStatus(const quint8* data, int size)
+{
+    if (size != kStatusSize - 1)
+        return;
+
+    const quint32 expected_message = qFromLittleEndian<quint32>(data);
+    const quint64 largest_number = qFromLittleEndian<quint64>(data + 4);
+    const std::chrono::microseconds delay(qFromLittleEndian<quint32>(data + 12));
+
+    const Clock::time_point now = Clock::now();
+
+    while (!send_times_.empty() && send_times_.front().first < largest_number)
+        send_times_.pop_front();
+
+    if (!send_times_.empty() && send_times_.front().first == largest_number)
+    {
+        const std::chrono::microseconds sample = std::max(
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                now - send_times_.front().second) - delay,
+            std::chrono::microseconds(0));
+
+        send_times_.pop_front();
+
+        if (!smoothed_rtt_.count())
+        {
+            smoothed_rtt_ = sample;
+            rtt_variance_ = sample / 2;
+        }
+        else
+        {
+            const std::chrono::microseconds error = (smoothed_rtt_ > sample) ?
+                smoothed_rtt_ - sample : sample - smoothed_rtt_;
+
+            rtt_variance_ = (rtt_variance_ * 3 + error) / 4;
+            smoothed_rtt_ = (smoothed_rtt_ * 7 + sample) / 8;
+        }
+    }
+
+    // The receiver may acknowledge only the messages which are sent.
+    if (expected_message <= first_message_ || expected_message > next_message_)
+        return;
+
+    std::vector<int> written_messages;
+
+    while (!sent_messages_.empty() && sent_messages_.front().number < expected_message)
+    {
+        const SentMessage& message = sent_messages_.front();
+
+        if (send_index_)
+        {
+            --send_index_;
+        }
+        else if (message.message_id != -1)
+        {
+            // The receiver has skipped the message which is not sent completely.
+            written_messages.push_back(message.message_id);
+        }
+
+        sent_bytes_ -= message.buffer.size();
+        sent_messages_.pop_front();
+    }
+
+    first_message_ = expected_message;
+    retransmits_.erase(retransmits_.begin(),
+                       retransmits_.lower_bound(std::make_pair(expected_message, 0)));
+
+    probe_time_ = now;
+    probe_count_ = 0;
+
+    const Clock::duration interval =
+        std::max<Clock::duration>(smoothed_rtt_, std::chrono::milliseconds(20));
+
+    if (pacing_limited_ && now - increase_time_ >= interval && now - decrease_time_ >= interval)
+    {
+        pacing_rate_ = std::min(pacing_rate_ * 9 / 8, kMaxPacingRate);
+        pacing_limited_ = false;
+        increase_time_ = now;
+    }
+
+    for (int message_id : written_messages)
+        emit messageWritten(message_id);
+
+    sendMessages();
+}
+
+void DatagramPath::readNack(const quint8* data, int size)
+{
+    if (size <= 0 || size % kNackRangeSize)
+        return;
+
+    bool lost = false;
+    bool gone = false;
+
+    for (int offset = 0; offset < size; offset += kNackRangeSize)
+    {
+        const quint32 number = qFromLittleEndian<quint32>(data + offset);
+        const int first = qFromLittleEndian<quint16>(data + offset + 4);
+        const int count = qFromLittleEndian<quint16>(data + offset + 6);
+
+        if (number < first_message_)
+        {
+            gone = true;
+            continue;
+        }
+
+        const SentMessage* message = findMessage(number);
+        if (!message)
+            continue;
+
+        const int sent = (number - first_message_ < send_index_) ?
+            message->count : message->next_fragment;
+
+        const int begin = count ? first : 0;
+        const int end = std::min(count ? first + count : sent, sent);
+
+        for (int fragment = begin; fragment < end; ++fragment)
+        {
+            if (retransmits_.emplace(number, fragment).second)
+                lost = true;
+        }
+    }
+
+    if (gone)
+        sendGone();
+
+    if (lost)
+    {
+        const Clock::time_point now = Clock::now();
+
+        // The rate is reduced once for the losses of one round trip.
+        if (now - decrease_time_ >= smoothed_rtt_)
+        {
+            pacing_rate_ = std::max(pacing_rate_ * 7 / 10, kMinPacingRate);
+            decrease_time_ = now;
+        }
+    }
+
+    sendMessages();
+}
+
+void DatagramPath::sendGone()
+{
+    quint8 payload[1 + 4];
+
+    payload[0] = GoneDatagram;
+    qToLittleEndian<quint32>(first_message_, payload + 1);
+
+    sendDatagram(payload, sizeof(payload));
+}
+
+void DatagramPath::checkSender(Clock::time_point now)
+{
+    if (!ready_)
+    {
+        if (now - start_time_ >= kStartTimeout)
+        {
+            qWarning("No datagrams are received from the client");
+            fail();
+        }
+        return;
+    }
+
+    if (now - receive_time_ >= kPathTimeout ||
+        (send_index_ && now - sent_messages_.front().sent_time >= kPathTimeout))
+    {
+        qWarning("The datagrams are not acknowledged");
+        fail();
+        return;
+    }
+
+    // The receiver requests the lost fragments when it receives the next ones, so the loss of
+    // the last fragments is found by the timeout.
+    const std::chrono::microseconds probe_timeout = std::min<std::chrono::microseconds>(
+        retransmitTimeout() * (1 << std::min(probe_count_, 8)), kMaxProbeTimeout);
+
+    if (send_index_ && send_index_ == sent_messages_.size() && retransmits_.empty() &&
+        now - probe_time_ >= probe_timeout)
+    {
+        const SentMessage& message = sent_messages_.back();
+
+        retransmits_.emplace(message.number, message.count - 1);
+        probe_time_ = now;
+        ++probe_count_;
+
+        sendMessages();
+    }
+}
+
+void DatagramPath::releaseMessages()
+{
+    while (sent_bytes_ > kMaxSendBufferSize && send_index_)
+    {
+        sent_bytes_ -= sent_messages_.front().buffer.size();
+        sent_messages_.pop_front();
+
+        ++first_message_;
+        --send_index_;
+    }
+}
+
+const DatagramPath::SentMessage* DatagramPath::findMessage(quint32 number) const
+{
+    if (number < first_message_ || number - first_message_ >= sent_messages_.size())
+        return nullptr;
+
+    return &sent_messages_[number - first_message_];
+}
+
+std::chrono::microseconds DatagramPath::retransmitTimeout() const
+{
+    if (!smoothed_rtt_.count())
+        return kInitialProbeTimeout;
+
+    return std::max<std::chrono::microseconds>(smoothed_rtt_ + rtt_variance_ * 4,
+                                               kMinProbeTimeout);
+}
+
+void DatagramPath::readData(const quint8* data, int size)
+{
+    const int data_size = size - (kDataHeaderSize - 1);
+    if (data_size <= 0 || data_size > kMaxFragmentSize)
+        return;
+
+    const quint32 number = qFromLittleEndian<quint32>(data);
+    const int fragment = qFromLittleEndian<quint16>(data + 4);
+    const int count = qFromLittleEndian<quint16>(data + 6);
+    const quint8 message_class = data[8];
+    const quint8 priority = data[9];
+
+    if (!count || fragment >= count || priority > LowPriority ||
+        (count - 1) * kMaxFragmentSize + data_size > kMaxMessageSize ||
+        (fragment != count - 1 && data_size != kMaxFragmentSize))
+    {
+        return;
+    }
+
+    peer_rtt_ = std::chrono::milliseconds(qFromLittleEndian<quint16>(data + 10));
+
+    // The fragment of the message which is passed or skipped. The status tells the sender
+    // that it is not needed.
+    if (number < expected_message_)
+    {
+        sendStatus();
+        return;
+    }
+
+    if (number - expected_message_ >= kMaxPendingMessages)
+        skipMessages(number - kMaxPendingMessages + 1);
+
+    // The classes of the next versions are received as the generic messages.
+    const MessageClass received_class = (message_class <= LastMessageClass) ?
+        static_cast<MessageClass>(message_class) : GenericMessage;
+
+    const Clock::time_point now = Clock::now();
+
+    // The messages between the received ones are lost or are late. They are requested when
+    // their time comes.
+    quint32 next = received_messages_.empty() ?
+        expected_message_ : received_messages_.rbegin()->first + 1;
+
+    for (; next <= number; ++next)
+    {
+        ReceivedMessage& message = received_messages_[next];
+
+        message.message_class = received_class;
+        message.first_time = now;
+        message.nack_time = now;
+    }
+
+    ReceivedMessage& message = received_messages_[number];
+
+    if (!message.count)
+    {
+        message.count = count;
+        message.priority = static_cast<MessagePriority>(priority);
+        message.message_class = received_class;
+        message.fragments.assign(count, false);
+        message.buffer.resize(count * kMaxFragmentSize);
+
+        received_bytes_ += message.buffer.size();
+    }
+    else if (message.count != count)
+    {
+        return;
+    }
+
+    if (message.fragments[fragment])
+        return;
+
+    memcpy(message.buffer.data() + fragment * kMaxFragmentSize,
+           data + kDataHeaderSize - 1, data_size);
+
+    message.fragments[fragment] = true;
+    ++message.received;
+    message.last_fragment = std::max(message.last_fragment, fragment);
+
+    if (fragment == count - 1)
+        message.last_size = data_size;
+
+    last_class_ = received_class;
+
+    while (received_bytes_ > kMaxReceiveBufferSize && received_messages_.size() > 1)
+        skipMessages(expected_message_ + 1);
+
+    deliverMessages();
+}
+
+void DatagramPath::readGone(const quint8* data, int size)
+{
+    if (size != 4)
+        return;
+
+    const quint32 number = qFromLittleEndian<quint32>(data);
+    if (number <= gone_message_)
+        return;
+
+    gone_message_ = number;
+    skipMessages(number);
+}
+
+void DatagramPath::deliverMessages(bool notify)
+{
+    bool delivered = false;
+
+    while (!received_messages_.empty())
+    {
+        auto it = received_messages_.begin();
+        Q_ASSERT(it->first == expected_message_);
+
+        ReceivedMessage& message = it->second;
+        if (!message.count || message.received < message.count)
+            break;
+
+        received_bytes_ -= message.buffer.size();
+        message.buffer.resize((message.count - 1) * kMaxFragmentSize + message.last_size);
+
+        ready_messages_.push_back(
+            { std::move(message.buffer), message.priority, message.message_class });
+
+        received_messages_.erase(it);
+        ++expected_message_;
+        delivered = true;
+    }
+
+    if (delivered)
+        sendStatus();
+
+    if (delivered || notify)
+        emit messageReady();
+}
+
+void DatagramPath::skipMessages(quint32 number)
+{
+    if (number <= expected_message_)
+        return;
+
+    MessageClass message_class = last_class_;
+
+    while (expected_message_ < number)
+    {
+        auto it = received_messages_.find(expected_message_);
+        if (it != received_messages_.end())
+        {
+            message_class = it->second.message_class;
+            received_bytes_ -= it->second.buffer.size();
+            received_messages_.erase(it);
+        }
+
+        ++expected_message_;
+    }
+
+    qInfo() << "Datagram messages are skipped up to" << number;
+
+    // The skipped messages are reported once.
+    if (ready_messages_.empty() || !ready_messages_.back().buffer.isNull())
+        ready_messages_.push_back({ QByteArray(), NormalPriority, message_class });
+
+    sendStatus();
+    deliverMessages(true);
+}
+
+void DatagramPath::sendStatus()
+{
+    const Clock::time_point now = Clock::now();
+
+    const qint64 delay = (largest_number_ == 0) ? 0 :
+        std::chrono::duration_cast<std::chrono::microseconds>(now - largest_time_).count();
+
+    quint8 payload[kStatusSize];
+
+    payload[0] = StatusDatagram;
+    qToLittleEndian<quint32>(expected_message_, payload + 1);
+    qToLittleEndian<quint64>(largest_number_, payload + 5);
+    qToLittleEndian<quint32>(static_cast<quint32>(std::min<qint64>(delay, 0xFFFFFFFF)),
+                             payload + 13);
+
+    status_time_ = now;
+    sendDatagram(payload, sizeof(payload));
+}
+
+void DatagramPath::sendNacks(Clock::time_point now)
+{
+    const Clock::duration interval =
+        std::max<Clock::duration>(peer_rtt_ * 5 / 4 + std::chrono::milliseconds(10),
+                                  kMinNackInterval);
+
+    const quint32 last_message = received_messages_.rbegin()->first;
+
+    quint8 payload[kMaxPayloadSize];
+    int size = 1;
+
+    payload[0] = NackDatagram;
+
+    auto add_range = [&](quint32 number, int first, int count)
+    {
+        if (size + kNackRangeSize > kMaxPayloadSize)
+        {
+            sendDatagram(payload, size);
+            size = 1;
+        }
+
+        qToLittleEndian<quint32>(number, payload + size);
+        qToLittleEndian<quint16>(static_cast<quint16>(first), payload + size + 4);
+        qToLittleEndian<quint16>(static_cast<quint16>(count), payload + size + 6);
+        size += kNackRangeSize;
+    };
+
+    for (auto it = received_messages_.begin(); it != received_messages_.end(); ++it)
+    {
+        ReceivedMessage& message = it->second;
+
+        if (now - message.nack_time < interval)
+            continue;
+
+        message.nack_time = now;
+
+        // No fragment of the message is received.
+        if (!message.count)
+        {
+            add_range(it->first, 0, 0);
+            continue;
+        }
+
+        // The fragments after the last received one are lost only if the next message is
+        // received. Otherwise the sender probes them.
+        const int end = (it->first < last_message) ? message.count : message.last_fragment;
+
+        for (int fragment = 0; fragment < end;)
+        {
+            if (message.fragments[fragment])
+            {
+                ++fragment;
+                continue;
+            }
+
+            const int first = fragment;
+
+            while (fragment < end && !message.fragments[fragment])
+                ++fragment;
+
+            add_range(it->first, first, fragment - first);
+        }
+    }
+
+    if (size > 1)
+        sendDatagram(payload, size);
+}
+
+void DatagramPath::checkReceiver(Clock::time_point now)
+{
+    // The message which is not received in time is skipped with the messages which have not
+    // been received before it.
+    while (!received_messages_.empty())
+    {
+        const ReceivedMessage& message = received_messages_.begin()->second;
+        if (now - message.first_time < kMaxRecoveryTime)
+            break;
+
+        skipMessages(expected_message_ + 1);
+    }
+
+    if (!received_messages_.empty())
+        sendNacks(now);
+
+    if (now - status_time_ >= kStatusInterval)
+        sendStatus();
+}
+
+} // namespace aspia
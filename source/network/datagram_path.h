@@ -0,0 +1,263 @@
+//
+// PROJECT:         Aspia
+// FILE:            network/datagram_path.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_NETWORK__DATAGRAM_PATH_H
+#define _ASPIA_NETWORK__DATAGRAM_PATH_H
+
+#include <QByteArray>
+#include <QHostAddress>
+#include <QObject>
+
+#include <chrono>
+#include <deque>
+#include <map>
+#include <memory>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "base/message_class.h"
+#include "base/message_priority.h"
+
+class QUdpSocket;
+
+namespace aspia {
+
+class Encryptor;
+class TokenBucket;
+
+//
+// Sends the messages of the channel by the datagrams beside its connection, so a lost part of
+// a message delays only this message rather than all the next data of the stream. The host
+// sends the messages, and the client requests the lost parts again while the message may still
+// be useful. Then the message is skipped, and the receivers are told about it in its place, so
+// they ask for the next data which does not depend on it (for the video, a key frame). The
+// messages are passed to the receivers in the order in which they are sent.
+//
+// The datagrams are encrypted by the keys of the channel (see Encryptor::encryptDatagram).
+// The host accepts the datagrams of the client from any address, so the path survives the
+// change of the address by the NAT, and sends its datagrams to the address of the last valid
+// datagram of the client. The client sends the acknowledgements regularly, and the path of
+// the host fails if they are not received.
+//
+class DatagramPath : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum Role
+    {
+        Sender,
+        Receiver
+    };
+
+    // |encryptor| is the encryptor of the channel after the key exchange. It must outlive the
+    // path.
+    DatagramPath(Role role, const Encryptor* encryptor, QObject* parent);
+    ~DatagramPath();
+
+    // The sender binds to |address| and waits for the first datagram of the receiver.
+    bool bind(const QHostAddress& address);
+    int localPort() const;
+
+    // The receiver sends its datagrams to |address| at |port|.
+    bool connectToPeer(const QHostAddress& address, int port);
+
+    // The sender has received a datagram from the receiver, so its datagrams may pass.
+    bool isReady() const { return ready_; }
+
+    void addBandwidthLimit(std::shared_ptr<TokenBucket> bucket);
+
+    // Queues the message of the sender. Returns false if the message is too large for the
+    // datagrams. If |message_id| is not -1, then messageWritten() is emitted when the message
+    // is sent (not when it is received).
+    bool writeMessage(int message_id,
+                      const QByteArray& buffer,
+                      MessagePriority priority,
+                      MessageClass message_class);
+
+    // The messages which the receiver has received completely, in the order of the sender.
+    // Returns false instead of the message if the messages before the next one are lost. The
+    // messages skipped at once are reported once, with the class of the last of them.
+    bool hasMessage() const { return !ready_messages_.empty(); }
+    bool takeMessage(QByteArray* buffer, MessagePriority* priority, MessageClass* message_class);
+
+    // Closes the socket. The messages of the receiver which are not received completely are
+    // lost, and the messages which are received are still passed.
+    void stop();
+    bool isStopped() const { return stopped_; }
+
+signals:
+    void messageReady();
+    void messageWritten(int message_id);
+
+    // The datagrams of the sender do not pass.
+    void failed();
+
+    void bytesRead(qint64 bytes);
+    void bytesWritten(qint64 bytes);
+
+protected:
+    void timerEvent(QTimerEvent* event) override;
+
+private slots:
+    void onReadyRead();
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    enum DatagramType
+    {
+        DataDatagram = 1,
+        GoneDatagram = 2,
+        StatusDatagram = 3,
+        NackDatagram = 4
+    };
+
+    struct SentMessage
+    {
+        quint32 number;
+        int message_id;
+        MessagePriority priority;
+        MessageClass message_class;
+        QByteArray buffer;
+        int count;
+
+        // The next fragment which is sent for the first time.
+        int next_fragment = 0;
+        Clock::time_point sent_time;
+    };
+
+    struct ReceivedMessage
+    {
+        MessagePriority priority = NormalPriority;
+        MessageClass message_class = GenericMessage;
+
+        // Zero until the first fragment of the message is received.
+        int count = 0;
+        int received = 0;
+        int last_fragment = -1;
+        int last_size = 0;
+        std::vector<bool> fragments;
+        QByteArray buffer;
+
+        Clock::time_point first_time;
+        Clock::time_point nack_time;
+    };
+
+    // The buffer is null if the messages before the next one are lost.
+    struct ReadyMessage
+    {
+        QByteArray buffer;
+        MessagePriority priority;
+        MessageClass message_class;
+    };
+
+    // Encrypts the payload and sends the datagram. Returns false if the socket does not accept
+    // it now.
+    bool sendDatagram(const quint8* payload, int size);
+    void processDatagram(quint8* datagram, int size, const QHostAddress& address,
+                         quint16 port);
+    bool acceptNumber(quint64 number);
+    void fail();
+
+    // The sender.
+    void sendMessages();
+    // Returns the size of the sent datagram or 0.
+    int sendFragment(const SentMessage& message, int fragment);
+    void readStatus(const quint8* data, int size);
+    void readNack(const quint8* data, int size);
+    void sendGone();
+    void checkSender(Clock::time_point now);
+    void releaseMessages();
+    const SentMessage* findMessage(quint32 number) const;
+    std::chrono::microseconds retransmitTimeout() const;
+
+    // The receiver.
+    void readData(const quint8* data, int size);
+    void readGone(const quint8* data, int size);
+
+    // Passes the next complete messages to the receivers. They are notified if a message is
+    // passed or |notify| is set.
+    void deliverMessages(bool notify = false);
+
+    // Skips the messages before |number|.
+    void skipMessages(quint32 number);
+    void sendStatus();
+    void sendNacks(Clock::time_point now);
+    void checkReceiver(Clock::time_point now);
+
+    const Role role_;
+    const Encryptor* encryptor_;
+    QUdpSocket* socket_;
+
+    QHostAddress peer_address_;
+    quint16 peer_port_ = 0;
+    bool ready_ = false;
+    bool stopped_ = false;
+
+    const Clock::time_point start_time_ = Clock::now();
+    Clock::time_point receive_time_;
+    int tick_timer_id_ = 0;
+
+    // The number of the next datagram. The numbers are the nonces, so they are not repeated.
+    quint64 send_number_ = 1;
+
+    // The numbers of the datagrams of the peer which are received, to discard the replayed
+    // ones.
+    quint64 largest_number_ = 0;
+    quint64 received_mask_ = 0;
+    Clock::time_point largest_time_;
+
+    std::vector<std::shared_ptr<TokenBucket>> bandwidth_limits_;
+
+    // The messages of the sender which are not acknowledged. The first one has the number
+    // |first_message_|, and the next one is |send_index_|.
+    std::deque<SentMessage> sent_messages_;
+    quint32 first_message_ = 0;
+    quint32 next_message_ = 0;
+    size_t send_index_ = 0;
+    qint64 sent_bytes_ = 0;
+
+    // The fragments which the receiver has requested again, by the message and the fragment.
+    std::set<std::pair<quint32, int>> retransmits_;
+
+    // The recent datagrams of the sender for the round trip time.
+    std::deque<std::pair<quint64, Clock::time_point>> send_times_;
+    std::chrono::microseconds smoothed_rtt_{ 0 };
+    std::chrono::microseconds rtt_variance_{ 0 };
+
+    // The rate of the sender. It grows while the datagrams are delivered and the sender has
+    // more data than the rate allows, and falls when the receiver reports the lost datagrams.
+    double pacing_rate_;
+    double budget_;
+    bool pacing_limited_ = false;
+    Clock::time_point budget_time_;
+    Clock::time_point increase_time_;
+    Clock::time_point decrease_time_;
+    int pacing_timer_id_ = 0;
+
+    // The last fragment is sent again if the acknowledgement is not received in time.
+    Clock::time_point probe_time_;
+    int probe_count_ = 0;
+
+    // The messages of the receiver by their numbers, starting from |expected_message_|.
+    std::map<quint32, ReceivedMessage> received_messages_;
+    std::deque<ReadyMessage> ready_messages_;
+    quint32 expected_message_ = 0;
+    quint32 gone_message_ = 0;
+    qint64 received_bytes_ = 0;
+    MessageClass last_class_ = GenericMessage;
+    std::chrono::milliseconds peer_rtt_{ 0 };
+    Clock::time_point status_time_;
+
+    Q_DISABLE_COPY(DatagramPath)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_NETWORK__DATAGRAM_PATH_H
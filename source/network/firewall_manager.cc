@@ -88,6 +88,58 @@ bool FirewallManager::hasAnyRule()
     return !rules.isEmpty();
 }
 
+bool FirewallManager::hasTcpRule(const QString& rule_name, int port)
+{
+    QVector<Microsoft::WRL::ComPtr<INetFwRule>> rules;
+    allRules(&rules);
+
+    const QString local_ports = QString::number(port);
+
+    for (const auto& rule : rules)
+    {
+        _bstr_t bstr_rule_name;
+        _bstr_t bstr_local_ports;
+        long protocol;
+        NET_FW_RULE_DIRECTION direction;
+        VARIANT_BOOL enabled;
+        NET_FW_ACTION action;
+        long profiles;
+
+        if (FAILED(rule->get_Name(bstr_rule_name.GetAddress())) ||
+            FAILED(rule->get_LocalPorts(bstr_local_ports.GetAddress())) ||
+            FAILED(rule->get_Protocol(&protocol)) ||
+            FAILED(rule->get_Direction(&direction)) ||
+            FAILED(rule->get_Enabled(&enabled)) ||
+            FAILED(rule->get_Action(&action)) ||
+            FAILED(rule->get_Profiles(&profiles)))
+        {
+            continue;
+        }
+
+        if (!bstr_rule_name || !bstr_local_ports)
+            continue;
+
+        QString name = QString::fromUtf16(reinterpret_cast<const ushort*>(
+            static_cast<const wchar_t*>(bstr_rule_name)));
+
+        QString ports = QString::fromUtf16(reinterpret_cast<const ushort*>(
+            static_cast<const wchar_t*>(bstr_local_ports)));
+
+        if (name.compare(rule_name, Qt::CaseInsensitive) == 0 &&
+            ports == local_ports &&
+            protocol == NET_FW_IP_PROTOCOL_TCP &&
+            direction == NET_FW_RULE_DIR_IN &&
+            enabled != VARIANT_FALSE &&
+            action == NET_FW_ACTION_ALLOW &&
+            profiles == NET_FW_PROFILE2_ALL)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 bool FirewallManager::addTcpRule(const QString& rule_name,
                                  const QString& description,
                                  int port)
@@ -126,6 +178,90 @@ bool FirewallManager::addTcpRule(const QString& rule_name,
     return true;
 }
 
+bool FirewallManager::hasUdpRule(const QString& rule_name)
+{
+    QVector<Microsoft::WRL::ComPtr<INetFwRule>> rules;
+    allRules(&rules);
+
+    for (const auto& rule : rules)
+    {
+        _bstr_t bstr_rule_name;
+        _bstr_t bstr_local_ports;
+        long protocol;
+        NET_FW_RULE_DIRECTION direction;
+        VARIANT_BOOL enabled;
+        NET_FW_ACTION action;
+        long profiles;
+
+        if (FAILED(rule->get_Name(bstr_rule_name.GetAddress())) ||
+            FAILED(rule->get_LocalPorts(bstr_local_ports.GetAddress())) ||
+            FAILED(rule->get_Protocol(&protocol)) ||
+            FAILED(rule->get_Direction(&direction)) ||
+            FAILED(rule->get_Enabled(&enabled)) ||
+            FAILED(rule->get_Action(&action)) ||
+            FAILED(rule->get_Profiles(&profiles)))
+        {
+            continue;
+        }
+
+        if (!bstr_rule_name || !bstr_local_ports)
+            continue;
+
+        QString name = QString::fromUtf16(reinterpret_cast<const ushort*>(
+            static_cast<const wchar_t*>(bstr_rule_name)));
+
+        QString ports = QString::fromUtf16(reinterpret_cast<const ushort*>(
+            static_cast<const wchar_t*>(bstr_local_ports)));
+
+        // The rule without the ports has all of them.
+        if (name.compare(rule_name, Qt::CaseInsensitive) == 0 &&
+            ports == QLatin1String("*") &&
+            protocol == NET_FW_IP_PROTOCOL_UDP &&
+            direction == NET_FW_RULE_DIR_IN &&
+            enabled != VARIANT_FALSE &&
+            action == NET_FW_ACTION_ALLOW &&
+            profiles == NET_FW_PROFILE2_ALL)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool FirewallManager::addUdpRule(const QString& rule_name, const QString& description)
+{
+    // See addTcpRule().
+    deleteRuleByName(rule_name);
+
+    Microsoft::WRL::ComPtr<INetFwRule> rule;
+
+    HRESULT hr = CoCreateInstance(CLSID_NetFwRule, nullptr, CLSCTX_ALL, IID_PPV_ARGS(&rule));
+    if (FAILED(hr))
+    {
+        qWarning() << "CoCreateInstance failed: " << errnoToString(hr);
+        return false;
+    }
+
+    rule->put_Name(_bstr_t(qUtf16Printable(rule_name)));
+    rule->put_Description(_bstr_t(qUtf16Printable(description)));
+    rule->put_ApplicationName(_bstr_t(qUtf16Printable(application_path_)));
+    rule->put_Protocol(NET_FW_IP_PROTOCOL_UDP);
+    rule->put_Direction(NET_FW_RULE_DIR_IN);
+    rule->put_Enabled(VARIANT_TRUE);
+    rule->put_Profiles(NET_FW_PROFILE2_ALL);
+    rule->put_Action(NET_FW_ACTION_ALLOW);
+
+    hr = firewall_rules_->Add(rule.Get());
+    if (FAILED(hr))
+    {
+        qWarning() << "Add failed: " << errnoToString(hr);
+        return false;
+    }
+
+    return true;
+}
+
 void FirewallManager::deleteRuleByName(const QString& rule_name)
 {
     QVector<Microsoft::WRL::ComPtr<INetFwRule>> rules;
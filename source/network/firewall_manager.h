@@ -30,12 +30,20 @@ public:
     // Returns true if there is any rule for the application.
     bool hasAnyRule();
 
+    // Returns true if the rule with the name |rule_name| already allows inbound connections to
+    // the application on TCP port |port|. Does not need elevation.
+    bool hasTcpRule(const QString& rule_name, int port);
+
     // Adds a firewall rule allowing inbound connections to the application on
     // TCP port |port|. Replaces the rule if it already exists. Needs elevation.
     bool addTcpRule(const QString& rule_name,
                     const QString& description,
                     int port);
 
+    // The same for the inbound datagrams of the application on any UDP port.
+    bool hasUdpRule(const QString& rule_name);
+    bool addUdpRule(const QString& rule_name, const QString& description);
+
     // Deletes all rules with specified name. Needs elevation.
     void deleteRuleByName(const QString& rule_name);
 
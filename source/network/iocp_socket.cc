@@ -0,0 +1,626 @@
+//
+// PROJECT:         Aspia
+// FILE:            network/iocp_socket.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "network/iocp_socket.h"
+
+#include <QCoreApplication>
+#include <QDebug>
+#include <QEvent>
+#include <QThread>
+#include <QVariant>
+
+#include <winsock2.h>
+#include <ws2tcpip.h>
+
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "base/errno_logging.h"
+
+namespace aspia {
+
+namespace {
+
+// The size of the buffer of one read.
+const size_t kReadBufferSize = 64 * 1024;
+
+// The reads are not started while the socket has more received data which is not read yet.
+const qint64 kMaxReadAhead = 1024 * 1024;
+
+const size_t kMinWriteBufferSize = 64 * 1024;
+
+const int kMaxThreadCount = 16;
+
+using CompletionHandler = void(*)(void* overlapped, quint32 transferred, quint32 error_code);
+
+//
+// The completion port of the process. The threads are started with the first socket and run
+// until the process exits. The completion key of a socket is its completion handler.
+//
+class CompletionPort
+{
+public:
+    static CompletionPort* instance()
+    {
+        static CompletionPort completion_port;
+        return &completion_port;
+    }
+
+    bool associate(SOCKET socket, CompletionHandler handler)
+    {
+        if (!port_)
+            return false;
+
+        if (!CreateIoCompletionPort(reinterpret_cast<HANDLE>(socket), port_,
+                                    reinterpret_cast<ULONG_PTR>(handler), 0))
+        {
+            qWarningErrno("CreateIoCompletionPort failed");
+            return false;
+        }
+
+        return true;
+    }
+
+private:
+    CompletionPort()
+    {
+        const int thread_count = qBound(1, QThread::idealThreadCount(), kMaxThreadCount);
+
+        port_ = CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, thread_count);
+        if (!port_)
+        {
+            qWarningErrno("CreateIoCompletionPort failed");
+            return;
+        }
+
+        for (int i = 0; i < thread_count; ++i)
+            threads_.emplace_back(&CompletionPort::run, this);
+
+        qInfo() << "Completion port started with" << thread_count << "threads";
+    }
+
+    ~CompletionPort()
+    {
+        if (!port_)
+            return;
+
+        // The packet without OVERLAPPED stops one thread.
+        for (size_t i = 0; i < threads_.size(); ++i)
+            PostQueuedCompletionStatus(port_, 0, 0, nullptr);
+
+        for (auto& thread : threads_)
+            thread.join();
+
+        CloseHandle(port_);
+    }
+
+    void run()
+    {
+        for (;;)
+        {
+            DWORD transferred = 0;
+            ULONG_PTR key = 0;
+            OVERLAPPED* overlapped = nullptr;
+
+            BOOL ret = GetQueuedCompletionStatus(port_, &transferred, &key, &overlapped, INFINITE);
+            if (!overlapped)
+            {
+                if (!ret)
+                    qWarningErrno("GetQueuedCompletionStatus failed");
+                break;
+            }
+
+            // The failed operations are completed with the error of the operation.
+            const DWORD error_code = ret ? ERROR_SUCCESS : GetLastError();
+
+            reinterpret_cast<CompletionHandler>(key)(overlapped, transferred, error_code);
+        }
+    }
+
+    HANDLE port_ = nullptr;
+    std::vector<std::thread> threads_;
+
+    Q_DISABLE_COPY(CompletionPort)
+};
+
+QAbstractSocket::SocketError socketError(DWORD error_code)
+{
+    switch (error_code)
+    {
+        // The completion port reports the reset connection as ERROR_NETNAME_DELETED.
+        case ERROR_NETNAME_DELETED:
+        case ERROR_CONNECTION_ABORTED:
+        case WSAECONNRESET:
+        case WSAECONNABORTED:
+        case WSAESHUTDOWN:
+            return QAbstractSocket::RemoteHostClosedError;
+
+        case WSAENOBUFS:
+            return QAbstractSocket::SocketResourceError;
+
+        default:
+            return QAbstractSocket::NetworkError;
+    }
+}
+
+} // namespace
+
+struct IocpSocket::Core
+{
+    std::mutex lock;
+
+    // The receiver of the completions. Null after the socket is deleted.
+    IocpSocket* socket = nullptr;
+};
+
+struct IocpSocket::Operation
+{
+    enum class Type { Read, Write };
+
+    Operation(Type type, std::shared_ptr<Core> core)
+        : type(type),
+          core(std::move(core))
+    {
+        memset(&overlapped, 0, sizeof(overlapped));
+    }
+
+    OVERLAPPED overlapped;
+    const Type type;
+    const std::shared_ptr<Core> core;
+
+    BufferPool::Buffer buffer;
+    size_t size = 0; // The size of the buffer for the read or of the data for the write.
+    size_t offset = 0; // The number of the bytes which are already sent.
+
+    DWORD transferred = 0;
+    DWORD error_code = ERROR_SUCCESS;
+};
+
+// Posted to the socket when the operation is completed. The operation is deleted with the event
+// if the socket is deleted before it receives the event.
+class IocpSocket::CompletionEvent : public QEvent
+{
+public:
+    static const int kType = QEvent::User;
+
+    explicit CompletionEvent(std::unique_ptr<Operation> operation)
+        : QEvent(static_cast<QEvent::Type>(kType)),
+          operation(std::move(operation))
+    {
+        // Nothing
+    }
+
+    std::unique_ptr<Operation> operation;
+
+private:
+    Q_DISABLE_COPY(CompletionEvent)
+};
+
+IocpSocket::IocpSocket(qintptr descriptor, QObject* parent)
+    : QTcpSocket(parent),
+      descriptor_(descriptor),
+      core_(std::make_shared<Core>())
+{
+    core_->socket = this;
+
+    const SOCKET socket = static_cast<SOCKET>(descriptor_);
+
+    sockaddr_storage address;
+    int address_length = sizeof(address);
+
+    if (getpeername(socket, reinterpret_cast<sockaddr*>(&address), &address_length) == 0)
+    {
+        QHostAddress peer_address(reinterpret_cast<sockaddr*>(&address));
+
+        setPeerAddress(peer_address);
+        setPeerPort(address.ss_family == AF_INET6 ?
+            ntohs(reinterpret_cast<sockaddr_in6*>(&address)->sin6_port) :
+            ntohs(reinterpret_cast<sockaddr_in*>(&address)->sin_port));
+    }
+
+    address_length = sizeof(address);
+
+    if (getsockname(socket, reinterpret_cast<sockaddr*>(&address), &address_length) == 0)
+    {
+        setLocalAddress(QHostAddress(reinterpret_cast<sockaddr*>(&address)));
+        setLocalPort(address.ss_family == AF_INET6 ?
+            ntohs(reinterpret_cast<sockaddr_in6*>(&address)->sin6_port) :
+            ntohs(reinterpret_cast<sockaddr_in*>(&address)->sin_port));
+    }
+
+    // The data is not buffered by QIODevice, because the received data is already in the
+    // buffers of the reads.
+    QIODevice::open(QIODevice::ReadWrite | QIODevice::Unbuffered);
+    setSocketState(ConnectedState);
+
+    startRead();
+}
+
+IocpSocket::~IocpSocket()
+{
+    {
+        std::lock_guard<std::mutex> lock(core_->lock);
+        core_->socket = nullptr;
+    }
+
+    if (descriptor_ != -1)
+        closesocket(static_cast<SOCKET>(descriptor_));
+
+    // QAbstractSocket does not abort the socket it does not own.
+    setSocketState(UnconnectedState);
+}
+
+// static
+IocpSocket* IocpSocket::create(qintptr descriptor, QObject* parent)
+{
+    if (!CompletionPort::instance()->associate(static_cast<SOCKET>(descriptor),
+                                               &IocpSocket::onCompletion))
+    {
+        closesocket(static_cast<SOCKET>(descriptor));
+        return nullptr;
+    }
+
+    return new IocpSocket(descriptor, parent);
+}
+
+qint64 IocpSocket::bytesAvailable() const
+{
+    return read_available_ + QIODevice::bytesAvailable();
+}
+
+qint64 IocpSocket::bytesToWrite() const
+{
+    return write_in_progress_ + static_cast<qint64>(write_size_);
+}
+
+void IocpSocket::close()
+{
+    closeDescriptor();
+
+    read_queue_.clear();
+    read_available_ = 0;
+
+    QIODevice::close();
+}
+
+void IocpSocket::disconnectFromHost()
+{
+    if (state() != ConnectedState)
+        return;
+
+    setSocketState(ClosingState);
+    emit stateChanged(ClosingState);
+
+    // The socket is closed when the data in progress is written. The written data is already
+    // in the buffers of the system and is sent after the descriptor is closed.
+    if (!write_pending_)
+        closeDescriptor();
+}
+
+bool IocpSocket::waitForDisconnected(int /* msecs */)
+{
+    // The completions are received by the event loop, so the data which is not written yet
+    // is dropped.
+    if (state() != UnconnectedState)
+        closeDescriptor();
+
+    return true;
+}
+
+void IocpSocket::setSocketOption(QAbstractSocket::SocketOption option, const QVariant& value)
+{
+    if (descriptor_ == -1)
+        return;
+
+    const BOOL enable = value.toInt() != 0;
+
+    switch (option)
+    {
+        case LowDelayOption:
+            setsockopt(static_cast<SOCKET>(descriptor_), IPPROTO_TCP, TCP_NODELAY,
+                       reinterpret_cast<const char*>(&enable), sizeof(enable));
+            break;
+
+        case KeepAliveOption:
+            setsockopt(static_cast<SOCKET>(descriptor_), SOL_SOCKET, SO_KEEPALIVE,
+                       reinterpret_cast<const char*>(&enable), sizeof(enable));
+            break;
+
+        default:
+            qWarning() << "Unsupported socket option:" << option;
+            break;
+    }
+}
+
+qint64 IocpSocket::readData(char* data, qint64 max_size)
+{
+    if (read_queue_.empty())
+        return state() == UnconnectedState ? -1 : 0;
+
+    qint64 read = 0;
+
+    while (read < max_size && !read_queue_.empty())
+    {
+        ReadBlock& block = read_queue_.front();
+
+        const size_t count = static_cast<size_t>(
+            qMin<qint64>(max_size - read, block.size - block.offset));
+
+        memcpy(data + read, block.buffer.get() + block.offset, count);
+
+        block.offset += count;
+        read += count;
+
+        if (block.offset == block.size)
+            read_queue_.pop_front();
+    }
+
+    read_available_ -= read;
+
+    // The reads are stopped while the receiver does not read the data.
+    startRead();
+    return read;
+}
+
+qint64 IocpSocket::writeData(const char* data, qint64 size)
+{
+    if (state() != ConnectedState)
+    {
+        setErrorString(tr("The socket is not connected"));
+        return -1;
+    }
+
+    const size_t required_size = write_size_ + static_cast<size_t>(size);
+
+    if (required_size > write_capacity_)
+    {
+        const size_t capacity = qMax(qMax(required_size, write_capacity_ * 2),
+                                     kMinWriteBufferSize);
+
+        BufferPool::Buffer buffer = BufferPool::instance()->allocate(capacity);
+        if (!buffer)
+        {
+            setErrorString(tr("Not enough memory"));
+            return -1;
+        }
+
+        if (write_size_)
+            memcpy(buffer.get(), write_buffer_.get(), write_size_);
+
+        write_buffer_ = std::move(buffer);
+        write_capacity_ = capacity;
+    }
+
+    memcpy(write_buffer_.get() + write_size_, data, static_cast<size_t>(size));
+    write_size_ = required_size;
+
+    startWrite();
+    return size;
+}
+
+void IocpSocket::customEvent(QEvent* event)
+{
+    if (event->type() != CompletionEvent::kType)
+    {
+        QTcpSocket::customEvent(event);
+        return;
+    }
+
+    std::unique_ptr<Operation> operation =
+        std::move(static_cast<CompletionEvent*>(event)->operation);
+
+    if (operation->type == Operation::Type::Read)
+        onReadCompleted(std::move(operation));
+    else
+        onWriteCompleted(std::move(operation));
+}
+
+// static
+void IocpSocket::onCompletion(void* overlapped, quint32 transferred, quint32 error_code)
+{
+    std::unique_ptr<Operation> operation(
+        CONTAINING_RECORD(static_cast<OVERLAPPED*>(overlapped), Operation, overlapped));
+
+    operation->transferred = transferred;
+    operation->error_code = error_code;
+
+    std::shared_ptr<Core> core = operation->core;
+
+    // The socket is not deleted while the event is posted. The events which are not received
+    // yet are deleted with the socket.
+    std::lock_guard<std::mutex> lock(core->lock);
+
+    if (core->socket)
+        QCoreApplication::postEvent(core->socket, new CompletionEvent(std::move(operation)));
+}
+
+void IocpSocket::startRead()
+{
+    if (read_pending_ || state() != ConnectedState || read_available_ >= kMaxReadAhead)
+        return;
+
+    std::unique_ptr<Operation> operation =
+        std::make_unique<Operation>(Operation::Type::Read, core_);
+
+    operation->buffer = BufferPool::instance()->allocate(kReadBufferSize);
+    operation->size = kReadBufferSize;
+
+    if (!operation->buffer)
+    {
+        onOperationFailed(WSAENOBUFS);
+        return;
+    }
+
+    WSABUF buffer;
+    buffer.buf = reinterpret_cast<char*>(operation->buffer.get());
+    buffer.len = static_cast<ULONG>(operation->size);
+
+    DWORD flags = 0;
+
+    // The operation is completed by the completion port even if it is completed at once.
+    if (WSARecv(static_cast<SOCKET>(descriptor_), &buffer, 1, nullptr, &flags,
+                &operation->overlapped, nullptr) == SOCKET_ERROR)
+    {
+        const DWORD error_code = WSAGetLastError();
+        if (error_code != WSA_IO_PENDING)
+        {
+            onOperationFailed(error_code);
+            return;
+        }
+    }
+
+    operation.release();
+    read_pending_ = true;
+}
+
+void IocpSocket::startWrite()
+{
+    if (write_pending_ || !write_size_ || state() == UnconnectedState)
+        return;
+
+    std::unique_ptr<Operation> operation =
+        std::make_unique<Operation>(Operation::Type::Write, core_);
+
+    operation->buffer = std::move(write_buffer_);
+    operation->size = write_size_;
+
+    write_in_progress_ = static_cast<qint64>(write_size_);
+    write_capacity_ = 0;
+    write_size_ = 0;
+
+    if (sendOperation(operation.get()))
+        operation.release();
+}
+
+bool IocpSocket::sendOperation(Operation* operation)
+{
+    WSABUF buffer;
+    buffer.buf = reinterpret_cast<char*>(operation->buffer.get() + operation->offset);
+    buffer.len = static_cast<ULONG>(operation->size - operation->offset);
+
+    memset(&operation->overlapped, 0, sizeof(operation->overlapped));
+
+    if (WSASend(static_cast<SOCKET>(descriptor_), &buffer, 1, nullptr, 0,
+                &operation->overlapped, nullptr) == SOCKET_ERROR)
+    {
+        const DWORD error_code = WSAGetLastError();
+        if (error_code != WSA_IO_PENDING)
+        {
+            onOperationFailed(error_code);
+            return false;
+        }
+    }
+
+    write_pending_ = true;
+    return true;
+}
+
+void IocpSocket::onReadCompleted(std::unique_ptr<Operation> operation)
+{
+    read_pending_ = false;
+
+    // The operations of the closed descriptor are aborted.
+    if (state() == UnconnectedState)
+        return;
+
+    if (operation->error_code != ERROR_SUCCESS)
+    {
+        onOperationFailed(operation->error_code);
+        return;
+    }
+
+    if (!operation->transferred)
+    {
+        // The connection is closed by the peer.
+        onOperationFailed(WSAECONNRESET);
+        return;
+    }
+
+    read_available_ += operation->transferred;
+    read_queue_.push_back({ std::move(operation->buffer), operation->transferred, 0 });
+
+    startRead();
+
+    emit readyRead();
+}
+
+void IocpSocket::onWriteCompleted(std::unique_ptr<Operation> operation)
+{
+    write_pending_ = false;
+
+    if (state() == UnconnectedState)
+        return;
+
+    if (operation->error_code != ERROR_SUCCESS)
+    {
+        onOperationFailed(operation->error_code);
+        return;
+    }
+
+    const qint64 written = operation->transferred;
+
+    operation->offset += operation->transferred;
+    write_in_progress_ -= written;
+
+    if (operation->offset < operation->size)
+    {
+        // The rest of the data is sent before the data written after it.
+        if (sendOperation(operation.get()))
+            operation.release();
+    }
+    else if (state() == ClosingState && !write_size_)
+    {
+        closeDescriptor();
+        return;
+    }
+    else
+    {
+        startWrite();
+    }
+
+    if (written)
+        emit bytesWritten(written);
+}
+
+void IocpSocket::onOperationFailed(quint32 error_code)
+{
+    QAbstractSocket::SocketError socket_error = socketError(error_code);
+
+    setSocketError(socket_error);
+    setErrorString(socket_error == RemoteHostClosedError ?
+                       tr("The remote host closed the connection") :
+                       errnoToString(error_code));
+
+    // As QAbstractSocket, the error is emitted before the socket is disconnected.
+    emit error(socket_error);
+
+    closeDescriptor();
+}
+
+void IocpSocket::closeDescriptor()
+{
+    if (descriptor_ == -1)
+        return;
+
+    // The operations in progress are completed with ERROR_OPERATION_ABORTED.
+    closesocket(static_cast<SOCKET>(descriptor_));
+    descriptor_ = -1;
+
+    // The received data stays readable until the socket is closed.
+    write_buffer_.reset();
+    write_capacity_ = 0;
+    write_size_ = 0;
+    write_in_progress_ = 0;
+
+    setSocketState(UnconnectedState);
+
+    emit stateChanged(UnconnectedState);
+    emit disconnected();
+}
+
+} // namespace aspia
@@ -0,0 +1,107 @@
+//
+// PROJECT:         Aspia
+// FILE:            network/iocp_socket.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_NETWORK__IOCP_SOCKET_H
+#define _ASPIA_NETWORK__IOCP_SOCKET_H
+
+#include <QTcpSocket>
+
+#include <deque>
+#include <memory>
+
+#include "base/buffer_pool.h"
+
+namespace aspia {
+
+//
+// The accepted connection which is served by the I/O completion port of the process instead
+// of the socket notifiers of the event loop. The reads and the writes are completed by the pool
+// of the threads (one for each core) into the buffers of BufferPool, and the thread of the
+// socket receives one event for each completed operation. The data which is written while the
+// previous write is in progress is sent by the next write at once, so bytesWritten() is
+// emitted for each completed write and not for each call of write(). The socket has the
+// interface of QTcpSocket, so NetworkChannel uses it as any other socket, but it can not
+// connect to a host.
+//
+class IocpSocket : public QTcpSocket
+{
+    Q_OBJECT
+
+public:
+    ~IocpSocket();
+
+    // Takes the ownership of |descriptor| of the accepted connection. Returns nullptr if the
+    // descriptor can not be associated with the completion port. The descriptor is closed then.
+    static IocpSocket* create(qintptr descriptor, QObject* parent = nullptr);
+
+    // QAbstractSocket implementation.
+    qint64 bytesAvailable() const override;
+    qint64 bytesToWrite() const override;
+    void close() override;
+    void disconnectFromHost() override;
+    bool waitForDisconnected(int msecs = 30000) override;
+    void setSocketOption(QAbstractSocket::SocketOption option, const QVariant& value) override;
+
+protected:
+    // QIODevice implementation.
+    qint64 readData(char* data, qint64 max_size) override;
+    qint64 writeData(const char* data, qint64 size) override;
+
+    // QObject implementation.
+    void customEvent(QEvent* event) override;
+
+private:
+    struct Core;
+    struct Operation;
+    class CompletionEvent;
+
+    IocpSocket(qintptr descriptor, QObject* parent);
+
+    // Called by the threads of the completion port.
+    static void onCompletion(void* overlapped, quint32 transferred, quint32 error_code);
+
+    void startRead();
+    void startWrite();
+    bool sendOperation(Operation* operation);
+    void onReadCompleted(std::unique_ptr<Operation> operation);
+    void onWriteCompleted(std::unique_ptr<Operation> operation);
+    void onOperationFailed(quint32 error_code);
+    void closeDescriptor();
+
+    qintptr descriptor_;
+
+    // Shared with the operations in progress, which may be completed after the socket is
+    // deleted.
+    std::shared_ptr<Core> core_;
+
+    struct ReadBlock
+    {
+        BufferPool::Buffer buffer;
+        size_t size; // The number of the received bytes.
+        size_t offset; // The number of the bytes which are already read.
+    };
+
+    // The received data which is not read yet.
+    std::deque<ReadBlock> read_queue_;
+    qint64 read_available_ = 0;
+    bool read_pending_ = false;
+
+    // The data which is written after the write in progress is started.
+    BufferPool::Buffer write_buffer_;
+    size_t write_capacity_ = 0;
+    size_t write_size_ = 0;
+
+    // The number of the bytes of the write in progress which are not sent yet.
+    qint64 write_in_progress_ = 0;
+    bool write_pending_ = false;
+
+    Q_DISABLE_COPY(IocpSocket)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_NETWORK__IOCP_SOCKET_H
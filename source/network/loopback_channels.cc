@@ -0,0 +1,78 @@
+//
+// PROJECT:         Aspia
+// FILE:            network/loopback_channels.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "network/loopback_channels.h"
+
+#include <QDebug>
+#include <QEventLoop>
+#include <QTimer>
+
+#include "network/network_channel.h"
+#include "network/network_server.h"
+
+namespace aspia {
+
+namespace {
+
+constexpr int kConnectTimeout = 10000;
+
+} // namespace
+
+QCommandLineOption loopbackPortOption(int default_port)
+{
+    return QCommandLineOption(QStringLiteral("port"),
+                              QStringLiteral("Port of the loopback connection."),
+                              QStringLiteral("port"),
+                              QString::number(default_port));
+}
+
+bool connectLoopbackChannels(NetworkServer* server, int port,
+                             NetworkChannel** host, NetworkChannel** client)
+{
+    if (!server->start(port))
+    {
+        qWarning() << "Unable to listen on port" << port;
+        return false;
+    }
+
+    NetworkChannel* channel = NetworkChannel::createClient(server);
+
+    QEventLoop loop;
+    bool client_connected = false;
+
+    auto quit_if_ready = [&]()
+    {
+        if (client_connected && server->hasReadyChannels())
+            loop.quit();
+    };
+
+    QObject::connect(channel, &NetworkChannel::connected, &loop, [&]()
+    {
+        client_connected = true;
+        quit_if_ready();
+    });
+    QObject::connect(server, &NetworkServer::newChannelReady, &loop, quit_if_ready);
+    QObject::connect(channel, &NetworkChannel::errorOccurred, &loop, &QEventLoop::quit);
+
+    QTimer::singleShot(kConnectTimeout, &loop, &QEventLoop::quit);
+
+    channel->connectToHost(QStringLiteral("127.0.0.1"), port);
+    loop.exec();
+
+    if (!client_connected || !server->hasReadyChannels())
+    {
+        qWarning("Unable to establish the encrypted channel");
+        return false;
+    }
+
+    *host = server->nextReadyChannel();
+    (*host)->setParent(server);
+    *client = channel;
+    return true;
+}
+
+} // namespace aspia
@@ -0,0 +1,30 @@
+//
+// PROJECT:         Aspia
+// FILE:            network/loopback_channels.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_NETWORK__LOOPBACK_CHANNELS_H
+#define _ASPIA_NETWORK__LOOPBACK_CHANNELS_H
+
+#include <QCommandLineOption>
+
+namespace aspia {
+
+class NetworkChannel;
+class NetworkServer;
+
+// The encrypted channels of the benchmarks on the loopback connection.
+
+// The option of the port of the loopback connection.
+QCommandLineOption loopbackPortOption(int default_port);
+
+// Starts |server| on |port| and connects a client channel to it. On success |host| is the
+// channel of the server and |client| is the client channel. Both are owned by |server|.
+bool connectLoopbackChannels(NetworkServer* server, int port,
+                             NetworkChannel** host, NetworkChannel** client);
+
+} // namespace aspia
+
+#endif // _ASPIA_NETWORK__LOOPBACK_CHANNELS_H
@@ -0,0 +1,294 @@
+//
+// PROJECT:         Aspia
+// FILE:            network/network_bench_main.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "network/network_bench_main.h"
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QEventLoop>
+#include <QTextStream>
+#include <QTimer>
+
+#include <cstring>
+#include <vector>
+
+#include "base/process_stats.h"
+#include "network/loopback_channels.h"
+#include "network/network_channel.h"
+#include "network/network_server.h"
+#include "version.h"
+
+namespace aspia {
+
+namespace {
+
+constexpr int kDefaultPort = 28050;
+constexpr int kDefaultWindow = 16;
+constexpr int kDefaultDuration = 3;
+
+// The send time is written to the beginning of each message.
+constexpr int kMinMessageSize = sizeof(qint64);
+
+const int kDefaultSizes[] = { 64, 1024, 16 * 1024, 256 * 1024, 1024 * 1024 };
+
+struct BenchConfig
+{
+    int message_size;
+    int rate;     // Messages per second, 0 if the messages are sent as fast as possible.
+    int window;   // Maximum number of the messages sent and not yet received.
+    int duration; // In milliseconds.
+};
+
+struct Statistics
+{
+    qint64 messages = 0;
+    qint64 bytes = 0;
+    qint64 elapsed_time = 0; // In nanoseconds.
+    qint64 cpu_time = 0;     // In nanoseconds, the both sides of the channel.
+    qint64 crypto_time = 0;  // In microseconds, the both sides of the channel.
+
+    std::vector<qint64> latencies; // In nanoseconds.
+};
+
+// Sends the messages from |sender| to |receiver| during |config.duration| and waits for the
+// messages which are sent but not yet received.
+bool runBenchmark(const BenchConfig& config,
+                  NetworkChannel* sender,
+                  NetworkChannel* receiver,
+                  Statistics* stats)
+{
+    QByteArray payload(qMax(config.message_size, kMinMessageSize), 'x');
+
+    QEventLoop loop;
+    QElapsedTimer timer;
+
+    qint64 sent = 0;
+    qint64 received = 0;
+    bool stopping = false;
+    bool failed = false;
+
+    auto send_messages = [&]()
+    {
+        while (!stopping && sent - received < config.window)
+        {
+            // With the fixed rate the messages are not sent ahead of the schedule.
+            if (config.rate && sent >= timer.nsecsElapsed() * config.rate / 1000000000)
+                break;
+
+            const qint64 send_time = timer.nsecsElapsed();
+            memcpy(payload.data(), &send_time, sizeof(send_time));
+
+            sender->writeMessage(-1, payload);
+            ++sent;
+        }
+    };
+
+    QObject::connect(receiver, &NetworkChannel::messageReceived, &loop,
+                     [&](const QByteArray& buffer)
+    {
+        if (buffer.size() != payload.size())
+        {
+            qWarning("Invalid size of the received message");
+            failed = true;
+            loop.quit();
+            return;
+        }
+
+        qint64 send_time;
+        memcpy(&send_time, buffer.constData(), sizeof(send_time));
+
+        stats->latencies.push_back(timer.nsecsElapsed() - send_time);
+        ++received;
+
+        if (stopping && received == sent)
+        {
+            loop.quit();
+            return;
+        }
+
+        receiver->readMessage();
+        send_messages();
+    });
+
+    auto stop_on_error = [&]()
+    {
+        failed = true;
+        loop.quit();
+    };
+
+    QObject::connect(sender, &NetworkChannel::disconnected, &loop, stop_on_error);
+    QObject::connect(receiver, &NetworkChannel::disconnected, &loop, stop_on_error);
+
+    QTimer::singleShot(config.duration, &loop, [&]()
+    {
+        stopping = true;
+        if (received == sent)
+            loop.quit();
+    });
+
+    // The messages of the fixed rate are also sent by the timer when the window is not full.
+    QTimer rate_timer;
+    if (config.rate)
+    {
+        QObject::connect(&rate_timer, &QTimer::timeout, &loop, send_messages);
+        rate_timer.setTimerType(Qt::PreciseTimer);
+        rate_timer.start(1);
+    }
+
+    const NetworkChannel::Counters sender_counters = sender->counters();
+    const NetworkChannel::Counters receiver_counters = receiver->counters();
+    const qint64 cpu_time = processCpuTime();
+
+    stats->latencies.reserve(1024 * 1024);
+    timer.start();
+
+    receiver->readMessage();
+    send_messages();
+    loop.exec();
+
+    stats->elapsed_time = timer.nsecsElapsed();
+    stats->cpu_time = processCpuTime() - cpu_time;
+    stats->crypto_time =
+        sender->counters().crypto_time - sender_counters.crypto_time +
+        receiver->counters().crypto_time - receiver_counters.crypto_time;
+    stats->messages = received;
+    stats->bytes = received * payload.size();
+
+    return !failed;
+}
+
+void printHeader(QTextStream& out)
+{
+    out << qSetFieldWidth(10) << right << "size" << "rate" << "window"
+        << qSetFieldWidth(12) << "messages" << "msg/s" << "mb/s"
+        << qSetFieldWidth(10) << "p50_ms" << "p99_ms" << "cpu_ns/b" << "crypto_%"
+        << qSetFieldWidth(0) << endl;
+}
+
+void printResult(QTextStream& out, const BenchConfig& config, Statistics& stats)
+{
+    const double seconds = qMax(stats.elapsed_time, qint64(1)) / 1000000000.0;
+    const double bytes = qMax(stats.bytes, qint64(1));
+
+    const double crypto_percent =
+        stats.cpu_time > 0 ? stats.crypto_time * 1000.0 * 100.0 / stats.cpu_time : 0;
+
+    // No latencies are measured if no messages are received.
+    const double p50_ms = qMax(percentile(stats.latencies, 50), qint64(0)) / 1000000.0;
+    const double p99_ms = qMax(percentile(stats.latencies, 99), qint64(0)) / 1000000.0;
+
+    out << qSetFieldWidth(10) << right << config.message_size;
+
+    if (config.rate)
+        out << config.rate;
+    else
+        out << "max";
+
+    out << config.window
+        << qSetFieldWidth(12) << stats.messages
+        << fixed << qSetRealNumberPrecision(1)
+        << stats.messages / seconds << stats.bytes / seconds / (1024.0 * 1024.0)
+        << qSetFieldWidth(10) << qSetRealNumberPrecision(3) << p50_ms << p99_ms
+        << qSetRealNumberPrecision(2) << stats.cpu_time / bytes
+        << qSetRealNumberPrecision(1) << crypto_percent
+        << qSetFieldWidth(0) << endl;
+}
+
+} // namespace
+
+int networkBenchMain(int argc, char *argv[])
+{
+    QCoreApplication application(argc, argv);
+    application.setOrganizationName(QStringLiteral("Aspia"));
+    application.setApplicationName(QStringLiteral("Network Bench"));
+    application.setApplicationVersion(QStringLiteral(ASPIA_VERSION_STRING));
+
+    const QCommandLineOption port_option = loopbackPortOption(kDefaultPort);
+    QCommandLineOption size_option(QStringLiteral("size"),
+                                   QStringLiteral("Size of the messages in bytes."),
+                                   QStringLiteral("size"));
+    QCommandLineOption rate_option(QStringLiteral("rate"),
+                                   QStringLiteral("Messages per second, 0 to send the messages "
+                                                  "as fast as possible."),
+                                   QStringLiteral("rate"),
+                                   QStringLiteral("0"));
+    QCommandLineOption window_option(QStringLiteral("window"),
+                                     QStringLiteral("Maximum number of the messages in flight."),
+                                     QStringLiteral("window"),
+                                     QString::number(kDefaultWindow));
+    QCommandLineOption duration_option(QStringLiteral("duration"),
+                                       QStringLiteral("Duration of each measurement in seconds."),
+                                       QStringLiteral("duration"),
+                                       QString::number(kDefaultDuration));
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(
+        QStringLiteral("Measures the throughput and the latency of the encrypted network "
+                       "channel on the loopback connection. The CPU time includes the both "
+                       "sides of the channel. Without the size the typical sizes of the "
+                       "messages are measured."));
+    parser.addHelpOption();
+    parser.addOption(port_option);
+    parser.addOption(size_option);
+    parser.addOption(rate_option);
+    parser.addOption(window_option);
+    parser.addOption(duration_option);
+    parser.process(application);
+
+    BenchConfig config;
+    config.rate = parser.value(rate_option).toInt();
+    config.window = parser.value(window_option).toInt();
+    config.duration = parser.value(duration_option).toInt() * 1000;
+
+    if (config.rate < 0 || config.window <= 0 || config.duration <= 0)
+    {
+        qWarning("Invalid rate, window or duration");
+        return 1;
+    }
+
+    std::vector<int> sizes;
+    if (parser.isSet(size_option))
+        sizes.push_back(parser.value(size_option).toInt());
+    else
+        sizes.assign(std::begin(kDefaultSizes), std::end(kDefaultSizes));
+
+    NetworkServer server;
+    NetworkChannel* sender = nullptr;
+    NetworkChannel* receiver = nullptr;
+
+    if (!connectLoopbackChannels(&server, parser.value(port_option).toInt(), &sender, &receiver))
+        return 1;
+
+    QTextStream out(stdout);
+    printHeader(out);
+
+    for (int size : sizes)
+    {
+        if (size < kMinMessageSize)
+        {
+            qWarning() << "The size of the messages must be at least" << kMinMessageSize;
+            return 1;
+        }
+
+        config.message_size = size;
+
+        Statistics stats;
+        if (!runBenchmark(config, sender, receiver, &stats))
+        {
+            qWarning() << "The measurement of the size" << size << "failed";
+            return 1;
+        }
+
+        printResult(out, config, stats);
+    }
+
+    return 0;
+}
+
+} // namespace aspia
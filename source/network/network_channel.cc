@@ -7,24 +7,178 @@
 
 #include "network/network_channel.h"
 
+#include <QCoreApplication>
+#include <QHash>
 #include <QHostAddress>
+#include <QHostInfo>
+#include <QMutex>
+#include <QThread>
+#include <QTimer>
 #include <QTimerEvent>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <utility>
+#include <vector>
+
+#include "base/function_runnable.h"
+#include "base/message_serialization.h"
+#include "base/trace_logger.h"
 #include "crypto/encryptor.h"
+#include "crypto/random.h"
+#include "network/relay_protocol.h"
+#include "network/token_bucket.h"
+#include "protocol/key_exchange.pb.h"
+#include "protocol/relay.pb.h"
 
 namespace aspia {
 
 namespace {
 
 constexpr quint32 kMaxMessageSize = 16 * 1024 * 1024; // 16MB
-constexpr qint64 kMaxWriteSize = 1200;
 
-QByteArray createWriteBuffer(const QByteArray& message_buffer)
+// The same size as the nonce of ServerChallenge.
+constexpr int kChallengeNonceSize = 16;
+
+// Maximum size of the data passed to the socket but not written yet. The socket coalesces the
+// queued messages into large writes, and a new message waits for no more than this amount of
+// data of the previous ones.
+constexpr qint64 kMaxSubmittedSize = 256 * 1024;
+
+// The buffers of the written messages are reused for the next messages. Only a few messages
+// are in flight at once because of kMaxSubmittedSize, so a few buffers are enough.
+constexpr size_t kMaxFreeBuffers = 4;
+constexpr int kMaxFreeBufferSize = 4 * 1024 * 1024; // 4MB
+
+// The producers are asked to wait while more data is queued than the high watermark, and to
+// continue when it is written down to the low one. The gap keeps the socket busy meanwhile.
+constexpr qint64 kWriteQueueHighWatermark = 8 * 1024 * 1024; // 8MB
+constexpr qint64 kWriteQueueLowWatermark = 2 * 1024 * 1024; // 2MB
+
+// The shaped channels wait until the buckets allow writing at least this amount of the data.
+constexpr qint64 kMinShapedWriteSize = 1400;
+
+// The received messages may be kept by the receivers for a while (the host relays them to the
+// IPC channel, which keeps them in its write queue). The buffers of such messages are reused
+// when the receivers release them.
+constexpr size_t kMaxReadBuffers = 4;
+
+// The complete messages which are in the buffer of the socket are read in one turn of the event
+// loop while their receivers request the next ones. Then the reading is continued in the next
+// turn, so a burst of messages does not delay other events.
+constexpr int kMaxReadBatchMessages = 64;
+constexpr int kMaxReadBatchSize = 1024 * 1024; // 1MB
+
+// The messages of this size and larger are encrypted and decrypted by the threads of the pool,
+// so a large message does not block the event loop of the channel. Its chunks are processed
+// in parallel.
+constexpr int kMinCryptoJobSize = 256 * 1024; // 256kB
+
+// The maximum number of the threads which process the chunks of one message.
+constexpr int kMaxCryptoThreads = 4;
+
+// The small messages which are written in one turn of the event loop are encrypted together as
+// one record if both peers support the batches, so each of them does not cost an authentication
+// tag, a frame header and a write to the socket. The batch is sealed at the end of the turn, when
+// it reaches kMaxBatchSize or when a message which is not batched is written.
+constexpr int kMaxBatchedMessageSize = 1024;
+constexpr int kMaxBatchSize = 16 * 1024;
+
+// The size, the class and the priority of each message of the batch precede its data.
+constexpr int kBatchHeaderSize = 4 + 2;
+
+// The large messages of the priorities below HighPriority are sent by the parts of this size if
+// both peers support it, so the input and the cursor wait for one part of a large frame at
+// most. The parts are still large enough to be encrypted by the pool.
+constexpr int kMaxFragmentSize = 256 * 1024; // 256kB
+
+// Precedes the size of the messages of the channel. The zero size is not valid, so the previous
+// versions do not receive it.
+constexpr quint8 kControlMarker[] = { 0x80, 0x00 };
+
+// The candidates of the direct connection which are tried by the client.
+constexpr int kMaxPathCandidates = 8;
+constexpr std::chrono::seconds kPathCheckTimeout{ 5 };
+constexpr int kPathTokenSize = 32;
+
+// The next connection attempt of the client is started after this delay if the previous ones
+// have not succeeded or failed yet, so the stale addresses do not delay the connection for the
+// timeout of TCP. The connection fails if no attempt succeeds within kConnectTimeout.
+constexpr std::chrono::milliseconds kConnectAttemptDelay{ 250 };
+constexpr std::chrono::seconds kConnectTimeout{ 20 };
+
+// The relayed channels of the host by their path tokens. The channels may be served by
+// different threads.
+QMutex path_mutex;
+QHash<QByteArray, NetworkChannel*> path_channels;
+
+// Posted to the channel when all chunks of the message are processed.
+class CryptoEvent : public QEvent
 {
-    quint32 message_size = message_buffer.size();
+public:
+    static const int kType = QEvent::User;
 
-    quint8 buffer[4];
-    size_t length = 1;
+    explicit CryptoEvent(bool encrypt)
+        : QEvent(static_cast<QEvent::Type>(kType)),
+          encrypt(encrypt)
+    {
+        // Nothing
+    }
+
+    const bool encrypt;
+
+private:
+    Q_DISABLE_COPY(CryptoEvent)
+};
+
+// Posted to the relayed channel when its direct connection is accepted. The socket is deleted
+// with the event if the channel is deleted before it receives the event.
+class PathEvent : public QEvent
+{
+public:
+    static const int kType = QEvent::User + 1;
+
+    explicit PathEvent(QTcpSocket* socket)
+        : QEvent(static_cast<QEvent::Type>(kType)),
+          socket(socket)
+    {
+        // Nothing
+    }
+
+    ~PathEvent()
+    {
+        delete socket;
+    }
+
+    QTcpSocket* socket;
+
+private:
+    Q_DISABLE_COPY(PathEvent)
+};
+
+// Posted to the channel when the first message is added to the batch. The event is received
+// after the other events of the turn, which may add more messages.
+class BatchEvent : public QEvent
+{
+public:
+    static const int kType = QEvent::User + 2;
+
+    BatchEvent()
+        : QEvent(static_cast<QEvent::Type>(kType))
+    {
+        // Nothing
+    }
+
+private:
+    Q_DISABLE_COPY(BatchEvent)
+};
+
+// Writes the variable-length size of the message into |buffer| (up to 4 bytes) and returns
+// the number of written bytes.
+int writeMessageSize(quint32 message_size, quint8* buffer)
+{
+    int length = 1;
 
     buffer[0] = message_size & 0x7F;
     if (message_size > 0x7F) // 127 bytes
@@ -45,6 +199,39 @@ QByteArray createWriteBuffer(const QByteArray& message_buffer)
         }
     }
 
+    return length;
+}
+
+// Reads the size written by writeMessageSize() from |buffer| of |size| bytes. Returns the
+// number of the read bytes or 0 if the size is not complete.
+int readMessageSize(const quint8* buffer, int size, quint32* message_size)
+{
+    *message_size = 0;
+
+    for (int i = 0; i < qMin(size, 4); ++i)
+    {
+        if (i == 3)
+        {
+            *message_size += static_cast<quint32>(buffer[i]) << 21;
+            return 4;
+        }
+
+        *message_size += static_cast<quint32>(buffer[i] & 0x7F) << (i * 7);
+
+        if (!(buffer[i] & 0x80))
+            return i + 1;
+    }
+
+    return 0;
+}
+
+QByteArray createWriteBuffer(const QByteArray& message_buffer)
+{
+    quint32 message_size = message_buffer.size();
+
+    quint8 buffer[4];
+    int length = writeMessageSize(message_size, buffer);
+
     QByteArray write_buffer;
     write_buffer.resize(length + message_size);
 
@@ -54,28 +241,78 @@ QByteArray createWriteBuffer(const QByteArray& message_buffer)
     return write_buffer;
 }
 
+QString relayStatusToString(proto::relay::Reply::Status status)
+{
+    switch (status)
+    {
+        case proto::relay::Reply::STATUS_ACCESS_DENIED:
+            return NetworkChannel::tr("The relay denied access to the host.");
+
+        case proto::relay::Reply::STATUS_HOST_NOT_FOUND:
+            return NetworkChannel::tr("The host is not registered on the relay.");
+
+        case proto::relay::Reply::STATUS_HOST_TIMEOUT:
+            return NetworkChannel::tr("The host did not respond to the relay.");
+
+        case proto::relay::Reply::STATUS_BUSY:
+            return NetworkChannel::tr("The relay has too many connections to the host.");
+
+        default:
+            return NetworkChannel::tr("The relay rejected the connection.");
+    }
+}
+
+qint64 microsecondsSince(std::chrono::steady_clock::time_point time)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - time).count();
+}
+
 } // namespace
 
+struct NetworkChannel::CryptoJob
+{
+    explicit CryptoJob(std::unique_ptr<Encryptor::Chunks> chunks)
+        : chunks(std::move(chunks))
+    {
+        // Nothing
+    }
+
+    std::unique_ptr<Encryptor::Chunks> chunks;
+    const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    const qint64 begin_time = TraceLogger::isEnabled() ? TraceLogger::currentTime() : -1;
+    std::atomic_int next_chunk{ 0 };
+    std::atomic_int running_tasks{ 0 };
+    std::atomic_bool failed{ false };
+};
+
 NetworkChannel::NetworkChannel(ChannelType channel_type, QTcpSocket* socket, QObject* parent)
     : QObject(parent), channel_type_(channel_type), socket_(socket)
 {
     Q_ASSERT(!socket_.isNull());
 
-    socket_->setParent(this);
+    // The channel may be called through the queued connections from another thread.
+    qRegisterMetaType<MessagePriority>("MessagePriority");
+    qRegisterMetaType<MessageClass>("MessageClass");
 
-    if (channel_type_ == ClientChannel)
-        connect(socket_, &QTcpSocket::connected, this, &NetworkChannel::onConnected);
+    crypto_pool_.setMaxThreadCount(qBound(1, QThread::idealThreadCount(), kMaxCryptoThreads));
 
-    connect(socket_, &QTcpSocket::bytesWritten, this, &NetworkChannel::onBytesWritten);
-    connect(socket_, &QTcpSocket::readyRead, this, &NetworkChannel::onReadyRead);
+    socket_->setParent(this);
+    connectSocket();
+}
 
-    connect(socket_, &QTcpSocket::disconnected,
-            this, &NetworkChannel::onDisconnected,
-            Qt::QueuedConnection);
+NetworkChannel::~NetworkChannel()
+{
+    if (!path_token_.isEmpty())
+    {
+        QMutexLocker locker(&path_mutex);
 
-    connect(socket_, QOverload<QTcpSocket::SocketError>::of(&QTcpSocket::error),
-            this, &NetworkChannel::onError,
-            Qt::QueuedConnection);
+        if (path_channels.value(path_token_) == this)
+            path_channels.remove(path_token_);
+    }
+
+    // The tasks of the pool process the buffers of the channel.
+    crypto_pool_.waitForDone();
 }
 
 // static
@@ -85,6 +322,11 @@ NetworkChannel* NetworkChannel::createClient(QObject* parent)
 }
 
 void NetworkChannel::connectToHost(const QString& address, int port)
+{
+    connectToHost(QStringList(address), port);
+}
+
+void NetworkChannel::connectToHost(const QStringList& addresses, int port)
 {
     if (channel_type_ == ServerChannel)
     {
@@ -92,11 +334,69 @@ void NetworkChannel::connectToHost(const QString& address, int port)
         return;
     }
 
-    socket_->connectToHost(address, port);
+    if (connecting_)
+    {
+        qWarning("The channel is already connecting.");
+        return;
+    }
+
+    connecting_ = true;
+    connect_port_ = port;
+    connect_timer_id_ = startTimer(kConnectTimeout);
+
+    for (const QString& address : addresses)
+    {
+        QString host = address.trimmed();
+        QString relay_host_id;
+
+        const int separator = host.indexOf(RelayProtocol::kHostIdSeparator);
+        if (separator != -1)
+        {
+            relay_host_id = host.left(separator);
+            host = host.mid(separator + 1);
+        }
+
+        if (host.isEmpty())
+            continue;
+
+        QHostAddress host_address;
+        if (host_address.setAddress(host))
+        {
+            addConnectEndpoints({ host_address }, relay_host_id);
+            continue;
+        }
+
+        ++pending_lookups_;
+
+        QHostInfo::lookupHost(host, this, [this, relay_host_id](const QHostInfo& host_info)
+        {
+            --pending_lookups_;
+
+            if (!connecting_)
+                return;
+
+            if (host_info.error() != QHostInfo::NoError)
+                connect_error_ = host_info.errorString();
+
+            addConnectEndpoints(host_info.addresses(), relay_host_id);
+
+            if (connect_queue_.empty() && connect_attempts_.empty() && !pending_lookups_)
+                failConnectAttempts();
+        });
+    }
+
+    if (connect_queue_.empty() && connect_attempts_.empty() && !pending_lookups_)
+    {
+        connect_error_ = tr("The address of the host is empty");
+        failConnectAttempts();
+    }
 }
 
 QString NetworkChannel::peerAddress() const
 {
+    if (socket_.isNull())
+        return QString();
+
     QHostAddress address = socket_->peerAddress();
 
     bool ok = false;
@@ -107,15 +407,50 @@ QString NetworkChannel::peerAddress() const
     return address.toString();
 }
 
+void NetworkChannel::addBandwidthLimit(std::shared_ptr<TokenBucket> bucket)
+{
+    if (!bucket)
+        return;
+
+    if (!datagram_path_.isNull())
+        datagram_path_->addBandwidthLimit(bucket);
+
+    bandwidth_limits_.emplace_back(std::move(bucket));
+}
+
+NetworkChannel::Counters NetworkChannel::counters() const
+{
+    Counters counters;
+
+    counters.bytes_read = bytes_read_;
+    counters.bytes_written = bytes_written_;
+    counters.messages_read = messages_read_;
+    counters.messages_written = messages_written_;
+    counters.crypto_time = crypto_time_;
+    counters.queued_messages = queued_messages_;
+    counters.queued_bytes = queued_bytes_;
+
+    return counters;
+}
+
 void NetworkChannel::readMessage()
 {
     Q_ASSERT(!read_required_);
 
     read_required_ = true;
+
+    // The receivers request the next message from their handlers of messageReceived. It is read
+    // by the loop of onReadyRead, so the handlers are not nested.
+    if (receiving_)
+        return;
+
     onReadyRead();
 }
 
-void NetworkChannel::writeMessage(int message_id, const QByteArray& buffer)
+void NetworkChannel::writeMessage(int message_id,
+                                  const QByteArray& buffer,
+                                  MessagePriority priority,
+                                  MessageClass message_class)
 {
     if (!encryptor_)
     {
@@ -123,13 +458,184 @@ void NetworkChannel::writeMessage(int message_id, const QByteArray& buffer)
         return;
     }
 
-    write(message_id, encryptor_->encrypt(buffer));
+    if (isDatagramWrite(message_class) &&
+        datagram_path_->writeMessage(message_id, buffer, priority, message_class))
+    {
+        ++messages_written_;
+        return;
+    }
+
+    // The receivers of messageWritten() are notified for each message, so such messages are
+    // not batched.
+    if (batch_frames_ && message_id == -1 && !buffer.isEmpty() &&
+        buffer.size() <= kMaxBatchedMessageSize)
+    {
+        addToWriteBatch(buffer, priority, message_class);
+        return;
+    }
+
+    // The messages are sent in the order in which they are written.
+    flushWriteBatch();
+
+    int offset = 0;
+
+    // The messages of a higher priority are sent between the parts. The receivers of
+    // messageWritten() are notified when the last part is written.
+    if (fragment_frames_ && priority != HighPriority)
+    {
+        while (buffer.size() - offset > kMaxFragmentSize)
+        {
+            writeRecord(-1, buffer.constData() + offset, kMaxFragmentSize, priority,
+                        message_class, FragmentFrame, message_class == VideoMessage);
+            offset += kMaxFragmentSize;
+        }
+    }
+
+    writeRecord(message_id, buffer.constData() + offset, buffer.size() - offset, priority,
+                message_class, 0, message_class == VideoMessage);
+}
+
+void NetworkChannel::writeRecord(int message_id,
+                                 const char* buffer,
+                                 int size,
+                                 MessagePriority priority,
+                                 MessageClass message_class,
+                                 quint8 flags,
+                                 bool video)
+{
+    const size_t encryption_overhead = encryptor_->encryptionOverhead(size);
+    const quint32 message_size = size + static_cast<quint32>(encryption_overhead);
+
+    if (!size || message_size > kMaxMessageSize)
+    {
+        stop();
+        return;
+    }
+
+    quint8 size_buffer[4];
+    const int size_length = writeMessageSize(message_size, size_buffer);
+
+    const int header_size = size_length + (typed_frames_ ? kFrameHeaderSize : 0);
+
+    QByteArray write_buffer = takeFreeBuffer();
+    write_buffer.resize(header_size + message_size);
+
+    quint8* data = reinterpret_cast<quint8*>(write_buffer.data());
+
+    // The message is copied once behind the headers and the authentication tags and is
+    // encrypted in place when it is passed to the socket.
+    memcpy(data, size_buffer, size_length);
+    writeFrameHeader(data, size_length, priority, message_class, flags);
+    memcpy(data + header_size + encryption_overhead, buffer, size);
+
+    enqueueWrite(message_id, priority, std::move(write_buffer), header_size, size, false, video);
+}
+
+void NetworkChannel::addToWriteBatch(const QByteArray& buffer,
+                                     MessagePriority priority,
+                                     MessageClass message_class)
+{
+    // A batch is sent with one priority, so the messages of another priority are not delayed
+    // or sped up by it.
+    if (write_batch_count_ &&
+        (write_batch_priority_ != priority ||
+         write_batch_.size() + kBatchHeaderSize + buffer.size() > kMaxBatchSize))
+    {
+        flushWriteBatch();
+    }
+
+    if (!write_batch_count_)
+    {
+        // The reserved capacity is kept when the buffer is cleared.
+        if (write_batch_.capacity() < kMaxBatchSize)
+            write_batch_.reserve(kMaxBatchSize);
+
+        write_batch_priority_ = priority;
+        write_batch_class_ = message_class;
+
+        if (!write_batch_pending_)
+        {
+            write_batch_pending_ = true;
+            QCoreApplication::postEvent(this, new BatchEvent());
+        }
+    }
+    else if (write_batch_class_ != message_class)
+    {
+        write_batch_class_ = GenericMessage;
+    }
+
+    quint8 header[kBatchHeaderSize];
+    const int size_length = writeMessageSize(buffer.size(), header);
+
+    header[size_length] = static_cast<quint8>(message_class);
+    header[size_length + 1] = static_cast<quint8>(priority);
+
+    write_batch_.append(reinterpret_cast<const char*>(header), size_length + 2);
+    write_batch_.append(buffer);
+    ++write_batch_count_;
+
+    if (message_class == VideoMessage)
+        write_batch_video_ = true;
+}
+
+void NetworkChannel::flushWriteBatch()
+{
+    if (!write_batch_count_)
+        return;
+
+    if (channel_state_ == Encrypted)
+    {
+        if (write_batch_count_ == 1)
+        {
+            // The single message is sent without the header of the batch.
+            quint32 size;
+            const int size_length = readMessageSize(
+                reinterpret_cast<const quint8*>(write_batch_.constData()),
+                write_batch_.size(), &size);
+
+            writeRecord(-1, write_batch_.constData() + size_length + 2, static_cast<int>(size),
+                        write_batch_priority_, write_batch_class_, 0, write_batch_video_);
+        }
+        else
+        {
+            writeRecord(-1, write_batch_.constData(), write_batch_.size(),
+                        write_batch_priority_, write_batch_class_, BatchFrame,
+                        write_batch_video_);
+        }
+    }
+
+    // The buffer keeps its memory for the next batch.
+    write_batch_.resize(0);
+    write_batch_count_ = 0;
+    write_batch_video_ = false;
 }
 
 void NetworkChannel::stop()
 {
     channel_state_ = NotConnected;
 
+    write_batch_.clear();
+    write_batch_count_ = 0;
+    write_batch_video_ = false;
+    read_batch_.clear();
+    read_batch_offset_ = 0;
+
+    for (QByteArray& fragments : read_fragments_)
+        fragments.clear();
+
+    if (connecting_)
+        stopConnectAttempts();
+
+    clearPathCandidates();
+    stopDatagrams();
+
+    if (!path_socket_.isNull())
+        path_socket_->abort();
+
+    // The socket of the joined connection is passed to the relayed channel.
+    if (socket_.isNull())
+        return;
+
     if (socket_->state() != QTcpSocket::UnconnectedState)
     {
         socket_->abort();
@@ -143,14 +649,59 @@ void NetworkChannel::timerEvent(QTimerEvent* event)
 {
     if (event->timerId() == pinger_timer_id_)
     {
-        bool schedule_write = write_queue_.empty();
-
         // Pinger sends 1 byte equal to zero.
-        write_queue_.emplace(-1, QByteArray(1, 0));
+        enqueueWrite(-1, NormalPriority, QByteArray(1, 0));
+    }
+    else if (event->timerId() == path_timer_id_)
+    {
+        // The candidates which are not connected yet are not reachable.
+        clearPathCandidates();
+    }
+    else if (event->timerId() == attempt_timer_id_)
+    {
+        startConnectAttempt();
+    }
+    else if (event->timerId() == connect_timer_id_)
+    {
+        connect_error_ = tr("Connection timed out");
+        failConnectAttempts();
+    }
+    else if (event->timerId() == shaper_timer_id_)
+    {
+        killTimer(shaper_timer_id_);
+        shaper_timer_id_ = 0;
+
+        scheduleWrite();
+    }
+}
+
+void NetworkChannel::customEvent(QEvent* event)
+{
+    if (event->type() == PathEvent::kType)
+    {
+        PathEvent* path_event = static_cast<PathEvent*>(event);
+
+        QTcpSocket* socket = path_event->socket;
+        path_event->socket = nullptr;
+
+        onPathJoined(socket);
+        return;
+    }
 
-        if (schedule_write)
-            scheduleWrite();
+    if (event->type() == BatchEvent::kType)
+    {
+        write_batch_pending_ = false;
+        flushWriteBatch();
+        return;
     }
+
+    if (event->type() != CryptoEvent::kType)
+        return;
+
+    if (static_cast<CryptoEvent*>(event)->encrypt)
+        onMessageEncrypted();
+    else
+        onMessageDecrypted();
 }
 
 void NetworkChannel::onConnected()
@@ -167,18 +718,34 @@ void NetworkChannel::onConnected()
         // Start reading hello message.
         readMessage();
     }
+    else if (!relay_host_id_.isEmpty())
+    {
+        channel_state_ = Relaying;
+
+        proto::relay::Request request;
+        request.set_type(proto::relay::Request::TYPE_CONNECT);
+        request.set_host_id(relay_host_id_.toStdString());
+
+        write(-1, serializeMessage(request));
+
+        // Read the reply of the relay. The key exchange is started after it.
+        readMessage();
+    }
     else
     {
         Q_ASSERT(channel_type_ == ClientChannel);
         encryptor_.reset(new Encryptor(Encryptor::ClientMode));
 
         // Write hello message to server.
-        write(-1, encryptor_->helloMessage());
+        write(-1, helloMessage());
     }
 }
 
 void NetworkChannel::onDisconnected()
 {
+    if (isPathEvent(sender()))
+        return;
+
     if (pinger_timer_id_)
     {
         killTimer(pinger_timer_id_);
@@ -190,53 +757,180 @@ void NetworkChannel::onDisconnected()
 
 void NetworkChannel::onError(QAbstractSocket::SocketError /* error */)
 {
-    emit errorOccurred(socket_->errorString());
+    QTcpSocket* socket = qobject_cast<QTcpSocket*>(sender());
+
+    if (!socket || isPathEvent(socket))
+        return;
+
+    emit errorOccurred(socket->errorString());
 }
 
 void NetworkChannel::onBytesWritten(qint64 bytes)
 {
-    written_ += bytes;
+    submitted_ -= bytes;
+    bytes_written_ += bytes;
 
-    const QByteArray& write_buffer = write_queue_.front().second;
+    std::vector<int> written_messages;
+    bool path_switched = false;
 
-    if (written_ < write_buffer.size())
+    while (bytes > 0 && !write_queue_.empty())
     {
-        qint64 bytes_to_write = qMin(write_buffer.size() - written_, kMaxWriteSize);
-        socket_->write(write_buffer.constData() + written_, bytes_to_write);
+        const qint64 message_size = write_queue_.front().buffer.size();
+        const qint64 count = qMin(bytes, message_size - written_);
+
+        written_ += count;
+        bytes -= count;
+
+        if (written_ < message_size)
+            break;
+
+        written_messages.push_back(write_queue_.front().message_id);
+        queued_bytes_ -= message_size;
+
+        if (write_queue_.front().video)
+            --queued_video_records_;
+
+        // All data of the previous connection is written.
+        if (write_queue_.front().switch_path)
+            path_switched = true;
+
+        if (free_buffers_.size() < kMaxFreeBuffers &&
+            write_queue_.front().buffer.capacity() <= kMaxFreeBufferSize)
+        {
+            free_buffers_.emplace_back(std::move(write_queue_.front().buffer));
+        }
+
+        write_queue_.pop_front();
+        written_ = 0;
+
+        Q_ASSERT(submit_index_ > 0);
+        --submit_index_;
     }
-    else
+
+    messages_written_ += written_messages.size();
+    queued_messages_ = write_queue_.size();
+
+    if (path_switched)
     {
-        onMessageWritten(write_queue_.front().first);
+        write_switched_ = true;
+        switch_submitted_ = false;
 
-        write_queue_.pop();
-        written_ = 0;
+        connect(path_socket_, &QTcpSocket::bytesWritten, this, &NetworkChannel::onBytesWritten);
+        finishPathSwitch();
+    }
+
+    scheduleWrite();
+
+    // The handlers may write new messages, so they are called after the queue is updated.
+    for (int message_id : written_messages)
+        onMessageWritten(message_id);
 
-        if (!write_queue_.empty())
-            scheduleWrite();
+    if (write_queue_full_ && queued_bytes_ <= kWriteQueueLowWatermark)
+    {
+        write_queue_full_ = false;
+        emit writeQueueDrained();
     }
 }
 
 void NetworkChannel::onReadyRead()
 {
-    if (!read_required_)
+    if (!read_required_ || receiving_)
         return;
 
+    int batch_messages = 0;
+    int batch_size = 0;
+
     qint64 current;
 
     for (;;)
     {
-        if (!read_size_received_)
+        // The messages of the received batch are passed before the next record is read.
+        if (read_batch_offset_ < read_batch_.size())
         {
-            quint8 byte;
+            read_required_ = false;
 
-            current = socket_->read(reinterpret_cast<char*>(&byte), sizeof(byte));
-            if (current == sizeof(byte))
+            receiving_ = true;
+            const bool valid = readBatchedMessage();
+            receiving_ = false;
+
+            if (!valid)
             {
-                switch (read_)
-                {
-                    case 0:
-                    {
-                        // If the first byte is zero, then message ping is received.
+                stop();
+                return;
+            }
+
+            if (!read_required_ || channel_state_ == NotConnected)
+                break;
+
+            if (++batch_messages >= kMaxReadBatchMessages)
+            {
+                QTimer::singleShot(0, this, &NetworkChannel::onReadyRead);
+                break;
+            }
+
+            continue;
+        }
+
+        // The messages of the datagrams are passed between the records of the connection.
+        if (!datagram_path_.isNull() && datagram_path_->hasMessage())
+        {
+            QByteArray message;
+            MessagePriority priority;
+            MessageClass message_class;
+
+            const bool received =
+                datagram_path_->takeMessage(&message, &priority, &message_class);
+
+            // The path which is stopped by the host is deleted when its messages are passed.
+            if (datagram_path_->isStopped() && !datagram_path_->hasMessage())
+                stopDatagrams();
+
+            receiving_ = true;
+
+            if (received)
+            {
+                read_required_ = false;
+                ++messages_read_;
+
+                emit messageReceived(message, priority, message_class);
+            }
+            else
+            {
+                // The receivers still wait for their message.
+                emit messageLost(message_class);
+            }
+
+            receiving_ = false;
+
+            if (!read_required_ || channel_state_ == NotConnected)
+                break;
+
+            if (++batch_messages >= kMaxReadBatchMessages)
+            {
+                QTimer::singleShot(0, this, &NetworkChannel::onReadyRead);
+                break;
+            }
+
+            continue;
+        }
+
+        // The connection of the channel is changed by the last message of the previous one.
+        QTcpSocket* socket = readSocket();
+        if (!socket)
+            break;
+
+        if (!read_size_received_)
+        {
+            quint8 byte;
+
+            current = socket->read(reinterpret_cast<char*>(&byte), sizeof(byte));
+            if (current == sizeof(byte))
+            {
+                switch (read_)
+                {
+                    case 0:
+                    {
+                        // If the first byte is zero, then message ping is received.
                         // This message is ignored.
                         if (byte == 0)
                             continue;
@@ -260,6 +954,14 @@ void NetworkChannel::onReadyRead()
 
                 if (!(byte & 0x80) || read_ == 3)
                 {
+                    if (read_ == 1 && !read_size_ && channel_state_ == Encrypted)
+                    {
+                        // kControlMarker is followed by the size of the message of the channel.
+                        control_message_ = true;
+                        read_ = 0;
+                        continue;
+                    }
+
                     read_size_received_ = true;
 
                     if (!read_size_ || read_size_ > kMaxMessageSize)
@@ -269,19 +971,42 @@ void NetworkChannel::onReadyRead()
                         return;
                     }
 
-                    if (read_buffer_.capacity() < read_size_)
-                        read_buffer_.reserve(read_size_);
-
-                    read_buffer_.resize(read_size_);
+                    prepareReadBuffer(read_size_);
                     read_size_ = 0;
                     read_ = 0;
+
+                    // The messages of the key exchange have no header.
+                    const bool typed_frame = typed_frames_ && channel_state_ == Encrypted;
+
+                    read_header_size_ = typed_frame ? 0 : kFrameHeaderSize;
+                    read_priority_ = NormalPriority;
+                    read_class_ = GenericMessage;
+                    read_batch_frame_ = false;
+                    read_fragment_frame_ = false;
                     continue;
                 }
             }
         }
+        else if (read_header_size_ < kFrameHeaderSize)
+        {
+            current = socket->read(reinterpret_cast<char*>(read_header_) + read_header_size_,
+                                   kFrameHeaderSize - read_header_size_);
+            if (current <= 0)
+                break;
+
+            read_header_size_ += current;
+
+            if (read_header_size_ == kFrameHeaderSize && !readFrameHeader())
+            {
+                stop();
+                return;
+            }
+
+            continue;
+        }
         else if (read_ < read_buffer_.size())
         {
-            current = socket_->read(read_buffer_.data() + read_, read_buffer_.size() - read_);
+            current = socket->read(read_buffer_.data() + read_, read_buffer_.size() - read_);
         }
         else
         {
@@ -289,8 +1014,25 @@ void NetworkChannel::onReadyRead()
             read_size_received_ = false;
             read_ = 0;
 
-            onMessageReceived(read_buffer_);
-            break;
+            batch_size += read_buffer_.size();
+
+            receiving_ = true;
+            onMessageReceived();
+            receiving_ = false;
+
+            // The receivers do not request the next message, the message is being decrypted by
+            // the pool or the channel is stopped.
+            if (!read_required_ || channel_state_ == NotConnected)
+                break;
+
+            if (++batch_messages >= kMaxReadBatchMessages || batch_size >= kMaxReadBatchSize)
+            {
+                // The data which is already received does not cause readyRead again.
+                QTimer::singleShot(0, this, &NetworkChannel::onReadyRead);
+                break;
+            }
+
+            continue;
         }
 
         if (current == 0)
@@ -320,6 +1062,13 @@ void NetworkChannel::onMessageWritten(int message_id)
                 channel_state_ = Encrypted;
                 pinger_timer_id_ = startTimer(std::chrono::seconds(30));
 
+                // The channel may be moved to another thread by the receivers of connected().
+                if (peer_path_switch_ && !path_addresses_.isEmpty())
+                    sendPathCandidates();
+
+                if (datagrams_)
+                    startDatagrams();
+
                 emit connected();
             }
             else
@@ -337,25 +1086,150 @@ void NetworkChannel::onMessageWritten(int message_id)
     }
 }
 
-void NetworkChannel::onMessageReceived(const QByteArray& buffer)
+void NetworkChannel::onMessageReceived()
 {
+    bytes_read_ += read_buffer_.size();
+
     switch (channel_state_)
     {
         case Encrypted:
         {
+            ++messages_read_;
+
             if (!encryptor_)
             {
                 qWarning("Uninitialized encryptor");
                 return;
             }
 
-            emit messageReceived(encryptor_->decrypt(buffer));
+            // The message is decrypted in the read buffer and is passed to the receivers
+            // without copying. If they keep it, the next message is read to another buffer.
+            quint8* data = reinterpret_cast<quint8*>(read_buffer_.data());
+
+            if (read_buffer_.size() >= kMinCryptoJobSize)
+            {
+                // The messages of the channel and the batches are small.
+                if (control_message_ || read_batch_frame_)
+                {
+                    stop();
+                    return;
+                }
+
+                std::unique_ptr<Encryptor::Chunks> chunks =
+                    encryptor_->decryptChunks(data, read_buffer_.size());
+                if (!chunks)
+                {
+                    stop();
+                    return;
+                }
+
+                // The next message is not read until the receivers get this one.
+                decrypt_job_ = std::make_unique<CryptoJob>(std::move(chunks));
+                startCryptoJob(decrypt_job_.get(), false);
+                return;
+            }
+
+            size_t message_size;
+
+            {
+                ScopedTrace trace("decrypt");
+                const std::chrono::steady_clock::time_point start_time =
+                    std::chrono::steady_clock::now();
+
+                if (!encryptor_->decryptInPlace(data, read_buffer_.size(), &message_size))
+                {
+                    stop();
+                    return;
+                }
+
+                crypto_time_ += microsecondsSince(start_time);
+            }
+
+            read_buffer_.resize(static_cast<int>(message_size));
+
+            if (read_batch_frame_)
+            {
+                // The messages of the batch are counted when they are passed.
+                --messages_read_;
+                read_batch_frame_ = false;
+
+                read_batch_.swap(read_buffer_);
+                read_batch_offset_ = 0;
+
+                // The receivers still wait for their message, which is the first one of the
+                // batch.
+                read_required_ = true;
+                return;
+            }
+
+            if (control_message_)
+            {
+                --messages_read_;
+                control_message_ = false;
+
+                // The receivers still wait for their message.
+                read_required_ = true;
+                onControlMessage();
+                return;
+            }
+
+            passMessage();
+        }
+        break;
+
+        case Relaying:
+        {
+            proto::relay::Reply reply;
+
+            if (!parseMessage(read_buffer_, reply) ||
+                reply.status() != proto::relay::Reply::STATUS_SUCCESS)
+            {
+                emit errorOccurred(relayStatusToString(reply.status()));
+                stop();
+                return;
+            }
+
+            // The next bytes are forwarded from the host.
+            relay_host_id_.clear();
+            onConnected();
         }
         break;
 
         case Connected:
         {
-            if (!encryptor_->readHelloMessage(buffer))
+            proto::HelloMessage hello;
+
+            if (!parseMessage(read_buffer_, hello))
+            {
+                stop();
+                return;
+            }
+
+            if (channel_type_ == ServerChannel)
+            {
+                // The connection continues the relayed channel of the client.
+                if (!hello.path_token().empty())
+                {
+                    joinPath(hello.path_token());
+                    return;
+                }
+
+                peer_path_switch_ = hello.path_switch();
+            }
+
+            // The hello message of the server is written without the header in any case.
+            typed_frames_ = hello.typed_frames();
+
+            // The flags of the batch and of the part are in the frame header.
+            batch_frames_ = typed_frames_ && hello.batch_frames();
+            fragment_frames_ = typed_frames_ && hello.fragment_frames();
+
+            datagrams_ = datagrams_enabled_ && hello.datagrams();
+
+            if (channel_type_ == ClientChannel)
+                challenge_nonce_ = QByteArray::fromStdString(hello.challenge_nonce());
+
+            if (!encryptor_->readHelloMessage(read_buffer_))
             {
                 stop();
                 return;
@@ -363,7 +1237,7 @@ void NetworkChannel::onMessageReceived(const QByteArray& buffer)
 
             if (channel_type_ == ServerChannel)
             {
-                write(-1, encryptor_->helloMessage());
+                write(-1, helloMessage());
             }
             else
             {
@@ -391,18 +1265,989 @@ void NetworkChannel::write(int message_id, const QByteArray& buffer)
         return;
     }
 
-    bool schedule_write = write_queue_.empty();
+    enqueueWrite(message_id, HighPriority, createWriteBuffer(buffer));
+}
+
+void NetworkChannel::addConnectEndpoints(const QList<QHostAddress>& addresses,
+                                         const QString& relay_host_id)
+{
+    std::deque<ConnectEndpoint> ipv6_endpoints;
+    std::deque<ConnectEndpoint> ipv4_endpoints;
+
+    auto add_endpoint = [&](ConnectEndpoint&& endpoint)
+    {
+        if (endpoint.address.protocol() == QAbstractSocket::IPv6Protocol)
+            ipv6_endpoints.emplace_back(std::move(endpoint));
+        else
+            ipv4_endpoints.emplace_back(std::move(endpoint));
+    };
+
+    while (!connect_queue_.empty())
+    {
+        add_endpoint(std::move(connect_queue_.front()));
+        connect_queue_.pop_front();
+    }
+
+    for (const QHostAddress& address : addresses)
+    {
+        // The names may have the same addresses.
+        const QString key = relay_host_id + RelayProtocol::kHostIdSeparator + address.toString();
+        if (connect_endpoints_.contains(key))
+            continue;
+
+        connect_endpoints_.insert(key);
+        add_endpoint({ address, relay_host_id });
+    }
+
+    // IPv6 is tried first unless the previous attempt was IPv6.
+    bool ipv6_next = last_attempt_protocol_ != QAbstractSocket::IPv6Protocol;
+
+    while (!ipv6_endpoints.empty() || !ipv4_endpoints.empty())
+    {
+        std::deque<ConnectEndpoint>* endpoints = ipv6_next ? &ipv6_endpoints : &ipv4_endpoints;
+        if (endpoints->empty())
+            endpoints = ipv6_next ? &ipv4_endpoints : &ipv6_endpoints;
+
+        connect_queue_.emplace_back(std::move(endpoints->front()));
+        endpoints->pop_front();
+
+        ipv6_next = !ipv6_next;
+    }
+
+    // The first attempt is started at once, the next ones by the timer.
+    if (!attempt_timer_id_ && connect_attempts_.empty())
+        startConnectAttempt();
+}
+
+void NetworkChannel::startConnectAttempt()
+{
+    if (attempt_timer_id_)
+    {
+        killTimer(attempt_timer_id_);
+        attempt_timer_id_ = 0;
+    }
+
+    if (connect_queue_.empty())
+        return;
+
+    const ConnectEndpoint endpoint = std::move(connect_queue_.front());
+    connect_queue_.pop_front();
+
+    last_attempt_protocol_ = endpoint.address.protocol();
+
+    QTcpSocket* socket = new QTcpSocket(this);
+    const QString relay_host_id = endpoint.relay_host_id;
+
+    connect(socket, &QTcpSocket::connected, this,
+            [this, socket, relay_host_id]() { onAttemptConnected(socket, relay_host_id); });
+
+    connect(socket, QOverload<QTcpSocket::SocketError>::of(&QTcpSocket::error), this,
+            [this, socket]() { onAttemptFailed(socket); }, Qt::QueuedConnection);
+
+    connect_attempts_.emplace_back(socket);
+    socket->connectToHost(endpoint.address, connect_port_);
+
+    if (!connect_queue_.empty())
+        attempt_timer_id_ = startTimer(kConnectAttemptDelay);
+}
+
+void NetworkChannel::onAttemptConnected(QTcpSocket* socket, const QString& relay_host_id)
+{
+    if (!connecting_)
+        return;
+
+    connect_attempts_.erase(
+        std::remove(connect_attempts_.begin(), connect_attempts_.end(), socket),
+        connect_attempts_.end());
+
+    stopConnectAttempts();
+
+    // The socket of the constructor is not connected.
+    socket->disconnect(this);
+    delete socket_;
+
+    socket_ = socket;
+    relay_host_id_ = relay_host_id;
+
+    connectSocket();
+    onConnected();
+}
+
+void NetworkChannel::onAttemptFailed(QTcpSocket* socket)
+{
+    if (!connecting_)
+        return;
+
+    auto attempt = std::find(connect_attempts_.begin(), connect_attempts_.end(), socket);
+    if (attempt == connect_attempts_.end())
+        return;
+
+    connect_attempts_.erase(attempt);
+    connect_error_ = socket->errorString();
+    socket->deleteLater();
+
+    if (!connect_queue_.empty())
+    {
+        startConnectAttempt();
+        return;
+    }
+
+    if (connect_attempts_.empty() && !pending_lookups_)
+        failConnectAttempts();
+}
+
+void NetworkChannel::failConnectAttempts()
+{
+    stopConnectAttempts();
+    emit errorOccurred(connect_error_);
+}
+
+void NetworkChannel::stopConnectAttempts()
+{
+    connecting_ = false;
+
+    for (const auto& socket : connect_attempts_)
+    {
+        if (socket.isNull())
+            continue;
+
+        socket->disconnect(this);
+        socket->abort();
+        socket->deleteLater();
+    }
 
-    write_queue_.emplace(message_id, createWriteBuffer(buffer));
+    connect_attempts_.clear();
+    connect_queue_.clear();
 
-    if (schedule_write)
-        scheduleWrite();
+    for (int* timer_id : { &attempt_timer_id_, &connect_timer_id_ })
+    {
+        if (*timer_id)
+        {
+            killTimer(*timer_id);
+            *timer_id = 0;
+        }
+    }
 }
 
-void NetworkChannel::scheduleWrite()
+void NetworkChannel::connectSocket()
+{
+    connect(socket_, &QTcpSocket::bytesWritten, this, &NetworkChannel::onBytesWritten);
+    connect(socket_, &QTcpSocket::readyRead, this, &NetworkChannel::onReadyRead);
+
+    connect(socket_, &QTcpSocket::disconnected,
+            this, &NetworkChannel::onDisconnected,
+            Qt::QueuedConnection);
+
+    connect(socket_, QOverload<QTcpSocket::SocketError>::of(&QTcpSocket::error),
+            this, &NetworkChannel::onError,
+            Qt::QueuedConnection);
+}
+
+QByteArray NetworkChannel::helloMessage()
+{
+    // The serialized messages are merged when they are parsed, so the field of the channel is
+    // appended to the hello message of the encryptor.
+    proto::HelloMessage message;
+    message.set_path_switch(true);
+    message.set_typed_frames(true);
+    message.set_batch_frames(true);
+    message.set_fragment_frames(true);
+    message.set_datagrams(datagrams_enabled_);
+
+    if (channel_type_ == ServerChannel)
+    {
+        challenge_nonce_ = Random::generateBuffer(kChallengeNonceSize);
+        message.set_challenge_nonce(challenge_nonce_.constData(), challenge_nonce_.size());
+    }
+
+    QByteArray buffer = encryptor_->helloMessage();
+    buffer.append(serializeMessage(message));
+    return buffer;
+}
+
+void NetworkChannel::writeFrameHeader(quint8* data,
+                                      int size_length,
+                                      MessagePriority priority,
+                                      MessageClass message_class,
+                                      quint8 flags) const
+{
+    if (!typed_frames_)
+        return;
+
+    quint8* header = data + size_length;
+
+    header[0] = static_cast<quint8>(message_class);
+    header[1] = static_cast<quint8>(priority);
+    header[2] = flags;
+}
+
+bool NetworkChannel::readFrameHeader()
+{
+    const quint8 message_class = read_header_[0];
+    const quint8 priority = read_header_[1];
+    const quint8 flags = read_header_[2];
+
+    if (priority > LowPriority)
+    {
+        qWarning() << "Wrong message priority: " << static_cast<int>(priority);
+        return false;
+    }
+
+    // The flag repeats the marker, which precedes the size.
+    const bool control_frame = (flags & ControlFrame) != 0;
+    const bool batch_frame = (flags & BatchFrame) != 0;
+    const bool fragment_frame = (flags & FragmentFrame) != 0;
+
+    // The message of the priority whose parts are being received may only be its next part.
+    const bool fragments_pending = !read_fragments_[priority].isEmpty();
+
+    if ((flags & ~(ControlFrame | BatchFrame | FragmentFrame)) ||
+        control_frame != control_message_ ||
+        (batch_frame && (control_frame || !batch_frames_)) ||
+        (fragment_frame && (control_frame || batch_frame || !fragment_frames_)) ||
+        (fragments_pending && (control_frame || batch_frame)))
+    {
+        qWarning() << "Wrong message flags: " << static_cast<int>(flags);
+        return false;
+    }
+
+    read_batch_frame_ = batch_frame;
+    read_fragment_frame_ = fragment_frame;
+
+    read_priority_ = static_cast<MessagePriority>(priority);
+
+    // The classes of the next versions are received as the generic messages.
+    read_class_ = (message_class <= LastMessageClass) ?
+        static_cast<MessageClass>(message_class) : GenericMessage;
+
+    return true;
+}
+
+bool NetworkChannel::readBatchedMessage()
+{
+    const quint8* data =
+        reinterpret_cast<const quint8*>(read_batch_.constData()) + read_batch_offset_;
+    const int available = read_batch_.size() - read_batch_offset_;
+
+    quint32 size;
+    const int size_length = readMessageSize(data, available, &size);
+
+    if (!size_length || !size || size > static_cast<quint32>(kMaxBatchSize) ||
+        static_cast<int>(size) > available - size_length - 2)
+    {
+        qWarning("Wrong batched message");
+        return false;
+    }
+
+    const quint8 message_class = data[size_length];
+    const quint8 priority = data[size_length + 1];
+
+    if (priority > LowPriority)
+    {
+        qWarning() << "Wrong message priority: " << static_cast<int>(priority);
+        return false;
+    }
+
+    const QByteArray message(reinterpret_cast<const char*>(data) + size_length + 2,
+                             static_cast<int>(size));
+
+    read_batch_offset_ += size_length + 2 + static_cast<int>(size);
+    if (read_batch_offset_ == read_batch_.size())
+    {
+        read_batch_.clear();
+        read_batch_offset_ = 0;
+    }
+
+    ++messages_read_;
+
+    emit messageReceived(message,
+                         static_cast<MessagePriority>(priority),
+                         (message_class <= LastMessageClass) ?
+                             static_cast<MessageClass>(message_class) : GenericMessage);
+    return true;
+}
+
+void NetworkChannel::writeControlMessage(const QByteArray& buffer, bool switch_path)
 {
-    const QByteArray& write_buffer = write_queue_.front().second;
-    socket_->write(write_buffer.constData(), write_buffer.size());
+    // The message which switches the path is the last one on the previous connection.
+    flushWriteBatch();
+
+    const size_t encryption_overhead = encryptor_->encryptionOverhead(buffer.size());
+    const quint32 message_size = buffer.size() + static_cast<quint32>(encryption_overhead);
+
+    quint8 size_buffer[4];
+    const int size_length = writeMessageSize(message_size, size_buffer);
+    const int marker_size = sizeof(kControlMarker) + size_length;
+    const int header_size = marker_size + (typed_frames_ ? kFrameHeaderSize : 0);
+
+    QByteArray write_buffer = takeFreeBuffer();
+    write_buffer.resize(header_size + message_size);
+
+    quint8* data = reinterpret_cast<quint8*>(write_buffer.data());
+
+    memcpy(data, kControlMarker, sizeof(kControlMarker));
+    memcpy(data + sizeof(kControlMarker), size_buffer, size_length);
+    writeFrameHeader(data, marker_size, HighPriority, GenericMessage, ControlFrame);
+    memcpy(data + header_size + encryption_overhead, buffer.constData(), buffer.size());
+
+    enqueueWrite(-1, HighPriority, std::move(write_buffer), header_size, buffer.size(),
+                 switch_path);
+}
+
+void NetworkChannel::onControlMessage()
+{
+    proto::PathMessage message;
+
+    if (!parseMessage(read_buffer_, message))
+    {
+        stop();
+        return;
+    }
+
+    if (message.switch_path())
+    {
+        // The host switches after the connection is joined, and the client after the host.
+        if (path_socket_.isNull() || (channel_type_ == ServerChannel && !switch_sent_))
+        {
+            qWarning("Unexpected switch of the connection");
+            stop();
+            return;
+        }
+
+        read_switched_ = true;
+
+        if (!switch_sent_)
+            startPathSwitch();
+
+        finishPathSwitch();
+        return;
+    }
+
+    if (channel_type_ == ClientChannel && message.datagram_port())
+    {
+        startDatagramReceiver(message.datagram_port());
+        return;
+    }
+
+    if (channel_type_ == ClientChannel && message.datagram_stop())
+    {
+        qInfo("The host sends the video by the connection");
+
+        // The messages which are received completely are still passed.
+        if (!datagram_path_.isNull())
+        {
+            datagram_path_->stop();
+
+            if (!datagram_path_->hasMessage())
+                stopDatagrams();
+        }
+        return;
+    }
+
+    if (channel_type_ == ClientChannel && !message.token().empty())
+    {
+        QStringList addresses;
+
+        for (int i = 0; i < message.addresses_size() && i < kMaxPathCandidates; ++i)
+            addresses.append(QString::fromStdString(message.addresses(i)));
+
+        startPathCheck(addresses, message.port(), QByteArray::fromStdString(message.token()));
+    }
+}
+
+void NetworkChannel::setPathCandidates(const QStringList& addresses, int port)
+{
+    path_addresses_ = addresses;
+    path_port_ = port;
+}
+
+void NetworkChannel::sendPathCandidates()
+{
+    path_token_ = Random::generateBuffer(kPathTokenSize);
+
+    {
+        QMutexLocker locker(&path_mutex);
+        path_channels.insert(path_token_, this);
+    }
+
+    proto::PathMessage message;
+
+    for (const QString& address : path_addresses_)
+        message.add_addresses(address.toStdString());
+
+    message.set_port(path_port_);
+    message.set_token(path_token_.toStdString());
+
+    writeControlMessage(serializeMessage(message), false);
+}
+
+void NetworkChannel::startPathCheck(const QStringList& addresses,
+                                    int port,
+                                    const QByteArray& token)
+{
+    if (path_check_started_ || port <= 0 || port > 65535)
+        return;
+
+    path_check_started_ = true;
+
+    for (const QString& address : addresses)
+    {
+        QTcpSocket* socket = new QTcpSocket(this);
+
+        connect(socket, &QTcpSocket::connected, this,
+                [this, socket, token]() { onPathConnected(socket, token); });
+
+        connect(socket, QOverload<QTcpSocket::SocketError>::of(&QTcpSocket::error),
+                socket, &QTcpSocket::deleteLater, Qt::QueuedConnection);
+
+        path_candidates_.emplace_back(socket);
+        socket->connectToHost(address, port);
+    }
+
+    path_timer_id_ = startTimer(kPathCheckTimeout);
+}
+
+void NetworkChannel::onPathConnected(QTcpSocket* socket, const QByteArray& token)
+{
+    if (!path_socket_.isNull() || channel_state_ != Encrypted)
+        return;
+
+    qInfo() << "Direct connection to" << socket->peerAddress().toString() << "is opened";
+
+    socket->disconnect();
+    path_socket_ = socket;
+    clearPathCandidates();
+
+    proto::HelloMessage hello;
+    hello.set_path_token(token.toStdString());
+
+    path_socket_->setSocketOption(QTcpSocket::LowDelayOption, 1);
+    path_socket_->write(createWriteBuffer(serializeMessage(hello)));
+
+    // The channel is switched when the host confirms the connection by its switch.
+    connectPathSocket();
+}
+
+void NetworkChannel::joinPath(const std::string& token)
+{
+    QMutexLocker locker(&path_mutex);
+
+    NetworkChannel* channel = path_channels.take(QByteArray::fromStdString(token));
+    if (!channel)
+    {
+        locker.unlock();
+
+        qWarning("Unknown path token");
+        stop();
+        return;
+    }
+
+    // The channel is not deleted while the mutex is locked.
+    QTcpSocket* socket = socket_;
+
+    socket->disconnect(this);
+    socket->setParent(nullptr);
+    socket->moveToThread(channel->thread());
+    socket_ = nullptr;
+
+    QCoreApplication::postEvent(channel, new PathEvent(socket));
+    locker.unlock();
+
+    channel_state_ = NotConnected;
+
+    // The server deletes this channel.
+    emit disconnected();
+}
+
+void NetworkChannel::onPathJoined(QTcpSocket* socket)
+{
+    if (!path_socket_.isNull() || channel_state_ != Encrypted)
+    {
+        socket->abort();
+        delete socket;
+        return;
+    }
+
+    qInfo() << "Direct connection from" << socket->peerAddress().toString() << "is joined";
+
+    socket->setParent(this);
+    path_socket_ = socket;
+
+    path_socket_->setSocketOption(QTcpSocket::LowDelayOption, 1);
+    connectPathSocket();
+
+    startPathSwitch();
+}
+
+void NetworkChannel::connectPathSocket()
+{
+    connect(path_socket_, &QTcpSocket::readyRead, this, &NetworkChannel::onReadyRead);
+
+    connect(path_socket_, &QTcpSocket::disconnected,
+            this, &NetworkChannel::onDisconnected,
+            Qt::QueuedConnection);
+
+    connect(path_socket_, QOverload<QTcpSocket::SocketError>::of(&QTcpSocket::error),
+            this, &NetworkChannel::onError,
+            Qt::QueuedConnection);
+}
+
+void NetworkChannel::startPathSwitch()
+{
+    switch_sent_ = true;
+
+    proto::PathMessage message;
+    message.set_switch_path(true);
+
+    writeControlMessage(serializeMessage(message), true);
+}
+
+void NetworkChannel::finishPathSwitch()
+{
+    if (!read_switched_ || !write_switched_)
+        return;
+
+    QTcpSocket* previous_socket = socket_;
+
+    previous_socket->disconnect(this);
+    connect(previous_socket, &QTcpSocket::disconnected,
+            previous_socket, &QTcpSocket::deleteLater);
+
+    previous_socket->disconnectFromHost();
+    if (previous_socket->state() == QTcpSocket::UnconnectedState)
+        previous_socket->deleteLater();
+
+    socket_ = path_socket_;
+    path_socket_ = nullptr;
+    read_switched_ = false;
+    write_switched_ = false;
+
+    qInfo() << "Channel is moved to the direct connection with" << peerAddress();
+}
+
+void NetworkChannel::clearPathCandidates()
+{
+    if (path_timer_id_)
+    {
+        killTimer(path_timer_id_);
+        path_timer_id_ = 0;
+    }
+
+    for (const auto& socket : path_candidates_)
+    {
+        if (!socket.isNull() && socket != path_socket_)
+        {
+            socket->abort();
+            socket->deleteLater();
+        }
+    }
+
+    path_candidates_.clear();
+}
+
+void NetworkChannel::startDatagrams()
+{
+    QHostAddress address = socket_->localAddress();
+
+    // The connections of IPv4 are accepted by the socket of both protocols with the mapped
+    // addresses.
+    bool ok = false;
+    const QHostAddress ipv4_address(address.toIPv4Address(&ok));
+    if (ok)
+        address = ipv4_address;
+
+    DatagramPath* path = new DatagramPath(DatagramPath::Sender, encryptor_.get(), this);
+    if (!path->bind(address))
+    {
+        delete path;
+        return;
+    }
+
+    for (const auto& bucket : bandwidth_limits_)
+        path->addBandwidthLimit(bucket);
+
+    connect(path, &DatagramPath::messageWritten, this, &NetworkChannel::onMessageWritten);
+    connect(path, &DatagramPath::failed, this, &NetworkChannel::onDatagramsFailed);
+
+    connect(path, &DatagramPath::bytesRead, this, [this](qint64 bytes) { bytes_read_ += bytes; });
+    connect(path, &DatagramPath::bytesWritten,
+            this, [this](qint64 bytes) { bytes_written_ += bytes; });
+
+    datagram_path_ = path;
+
+    proto::PathMessage message;
+    message.set_datagram_port(path->localPort());
+
+    writeControlMessage(serializeMessage(message), false);
+}
+
+void NetworkChannel::startDatagramReceiver(int port)
+{
+    if (!datagrams_ || !datagram_path_.isNull() || socket_.isNull())
+        return;
+
+    DatagramPath* path = new DatagramPath(DatagramPath::Receiver, encryptor_.get(), this);
+
+    connect(path, &DatagramPath::messageReady, this, &NetworkChannel::onReadyRead);
+
+    connect(path, &DatagramPath::bytesRead, this, [this](qint64 bytes) { bytes_read_ += bytes; });
+    connect(path, &DatagramPath::bytesWritten,
+            this, [this](qint64 bytes) { bytes_written_ += bytes; });
+
+    if (!path->connectToPeer(socket_->peerAddress(), port))
+    {
+        delete path;
+        return;
+    }
+
+    qInfo() << "Datagrams are sent to" << peerAddress() << "at port" << port;
+    datagram_path_ = path;
+}
+
+void NetworkChannel::stopDatagrams()
+{
+    if (datagram_path_.isNull())
+        return;
+
+    // The path may be stopped by its own signal.
+    datagram_path_->disconnect(this);
+    datagram_path_->stop();
+    datagram_path_->deleteLater();
+    datagram_path_ = nullptr;
+}
+
+void NetworkChannel::onDatagramsFailed()
+{
+    qWarning("The datagrams do not pass. The video is sent by the connection");
+
+    stopDatagrams();
+
+    // The client reports the lost messages and stops its path.
+    proto::PathMessage message;
+    message.set_datagram_stop(true);
+
+    writeControlMessage(serializeMessage(message), false);
+}
+
+bool NetworkChannel::isDatagramWrite(MessageClass message_class) const
+{
+    return message_class == VideoMessage && !datagram_path_.isNull() &&
+           datagram_path_->isReady() && !queued_video_records_ && !write_batch_video_;
+}
+
+bool NetworkChannel::isPathEvent(QObject* source)
+{
+    if (!path_socket_.isNull() && source == path_socket_.data())
+    {
+        // The connection which is not confirmed by the host is not used.
+        if (!read_switched_ && !write_switched_ && !switch_sent_)
+        {
+            qInfo("Direct connection is closed before the switch");
+
+            path_socket_->deleteLater();
+            path_socket_ = nullptr;
+            return true;
+        }
+
+        return false;
+    }
+
+    // The events of the previous connection after the switch, or the closing of it by the peer
+    // which has already switched.
+    return source != socket_.data() || read_switched_ || write_switched_;
+}
+
+void NetworkChannel::enqueueWrite(int message_id,
+                                  MessagePriority priority,
+                                  QByteArray&& write_buffer,
+                                  int encrypt_offset,
+                                  int message_size,
+                                  bool switch_path,
+                                  bool video)
+{
+    // The message which has been partially passed to the socket or is being encrypted stays in
+    // its place.
+    size_t index = submit_index_ + ((submit_offset_ || encrypt_job_) ? 1 : 0);
+
+    while (index < write_queue_.size() && write_queue_[index].priority <= priority)
+        ++index;
+
+    queued_bytes_ += write_buffer.size();
+
+    if (video)
+        ++queued_video_records_;
+
+    write_queue_.insert(write_queue_.begin() + index,
+                        WriteTask{ message_id, priority, std::move(write_buffer),
+                                   encrypt_offset, message_size, switch_path, video });
+    queued_messages_ = write_queue_.size();
+    scheduleWrite();
+
+    if (!write_queue_full_ && queued_bytes_ > kWriteQueueHighWatermark)
+    {
+        write_queue_full_ = true;
+        emit writeQueueFull();
+    }
+}
+
+void NetworkChannel::startCryptoJob(CryptoJob* job, bool encrypt)
+{
+    const int tasks = qMin(job->chunks->count(), crypto_pool_.maxThreadCount());
+    job->running_tasks = tasks;
+
+    for (int i = 0; i < tasks; ++i)
+    {
+        crypto_pool_.start(new FunctionRunnable([this, job, encrypt]()
+        {
+            const int count = job->chunks->count();
+
+            for (int chunk = job->next_chunk++; chunk < count; chunk = job->next_chunk++)
+            {
+                if (!job->chunks->process(chunk))
+                    job->failed = true;
+            }
+
+            // The last task finishes the job. The destructor of the channel waits for the tasks,
+            // so the channel exists here.
+            if (--job->running_tasks == 0)
+            {
+                if (!encrypt && !job->failed)
+                    job->chunks->finish();
+
+                QCoreApplication::postEvent(this, new CryptoEvent(encrypt));
+            }
+        }));
+    }
+}
+
+void NetworkChannel::onMessageEncrypted()
+{
+    std::unique_ptr<CryptoJob> job = std::move(encrypt_job_);
+    Q_ASSERT(job);
+
+    crypto_time_ += microsecondsSince(job->start_time);
+
+    if (job->begin_time != -1)
+        TraceLogger::addSpan("encrypt", job->begin_time, TraceLogger::currentTime(), 0);
+
+    if (job->failed)
+    {
+        stop();
+        return;
+    }
+
+    write_queue_[submit_index_].encrypt_offset = -1;
+    scheduleWrite();
+}
+
+void NetworkChannel::onMessageDecrypted()
+{
+    std::unique_ptr<CryptoJob> job = std::move(decrypt_job_);
+    Q_ASSERT(job);
+
+    crypto_time_ += microsecondsSince(job->start_time);
+
+    if (job->begin_time != -1)
+        TraceLogger::addSpan("decrypt", job->begin_time, TraceLogger::currentTime(), 0);
+
+    if (job->failed)
+    {
+        stop();
+        return;
+    }
+
+    read_buffer_.resize(static_cast<int>(job->chunks->messageSize()));
+
+    const bool fragment_frame = read_fragment_frame_;
+    passMessage();
+
+    // The reading is continued for the next part of the message.
+    if (fragment_frame && channel_state_ == Encrypted)
+        onReadyRead();
+}
+
+void NetworkChannel::passMessage()
+{
+    QByteArray& fragments = read_fragments_[read_priority_];
+
+    if (!read_fragment_frame_ && fragments.isEmpty())
+    {
+        emit messageReceived(read_buffer_, read_priority_, read_class_);
+        return;
+    }
+
+    if (fragments.size() + read_buffer_.size() > static_cast<int>(kMaxMessageSize))
+    {
+        qWarning("Too large message");
+        stop();
+        return;
+    }
+
+    // The part is copied, so the read buffer is reused for the next one.
+    fragments.append(read_buffer_.constData(), read_buffer_.size());
+
+    if (read_fragment_frame_)
+    {
+        // The parts are counted as one message.
+        --messages_read_;
+        read_fragment_frame_ = false;
+
+        // The receivers still wait for their message.
+        read_required_ = true;
+        return;
+    }
+
+    QByteArray message;
+    message.swap(fragments);
+
+    emit messageReceived(message, read_priority_, read_class_);
+}
+
+void NetworkChannel::prepareReadBuffer(int size)
+{
+    // The buffer which is kept by the receivers is replaced instead of detaching it, because
+    // the detaching copies the previous message.
+    if (!read_buffer_.isNull() && !read_buffer_.isDetached())
+    {
+        if (read_buffers_.size() < kMaxReadBuffers &&
+            read_buffer_.capacity() <= kMaxFreeBufferSize)
+        {
+            read_buffers_.emplace_back(std::move(read_buffer_));
+        }
+
+        read_buffer_ = QByteArray();
+
+        for (auto it = read_buffers_.begin(); it != read_buffers_.end(); ++it)
+        {
+            if (it->isDetached())
+            {
+                read_buffer_ = std::move(*it);
+                read_buffers_.erase(it);
+                break;
+            }
+        }
+    }
+
+    if (read_buffer_.capacity() < size)
+        read_buffer_.reserve(size);
+
+    read_buffer_.resize(size);
+}
+
+QByteArray NetworkChannel::takeFreeBuffer()
+{
+    if (free_buffers_.empty())
+        return QByteArray();
+
+    QByteArray buffer = std::move(free_buffers_.back());
+    free_buffers_.pop_back();
+    return buffer;
+}
+
+void NetworkChannel::scheduleWrite()
+{
+    // The messages are sent in order, so the next messages wait for the encrypted one.
+    if (encrypt_job_)
+        return;
+
+    // The next messages are sent to the new connection after the data of the previous one is
+    // written.
+    while (!switch_submitted_ && submitted_ < kMaxSubmittedSize &&
+           submit_index_ < write_queue_.size())
+    {
+        WriteTask& task = write_queue_[submit_index_];
+
+        // Each message is encrypted with the next nonces, so the messages are encrypted in the
+        // order in which they are sent rather than in the order of the queue.
+        if (!submit_offset_ && task.encrypt_offset != -1)
+        {
+            quint8* data = reinterpret_cast<quint8*>(task.buffer.data()) + task.encrypt_offset;
+            const size_t message_size = task.message_size;
+
+            if (task.buffer.size() - task.encrypt_offset >= kMinCryptoJobSize)
+            {
+                encrypt_job_ = std::make_unique<CryptoJob>(
+                    encryptor_->encryptChunks(data, message_size));
+                startCryptoJob(encrypt_job_.get(), true);
+                return;
+            }
+
+            {
+                ScopedTrace trace("encrypt");
+                const std::chrono::steady_clock::time_point start_time =
+                    std::chrono::steady_clock::now();
+
+                if (!encryptor_->encryptInPlace(data, message_size))
+                {
+                    stop();
+                    return;
+                }
+
+                crypto_time_ += microsecondsSince(start_time);
+            }
+
+            task.encrypt_offset = -1;
+        }
+
+        const QByteArray& write_buffer = task.buffer;
+
+        const qint64 count = shapeWrite(
+            qMin(write_buffer.size() - submit_offset_, kMaxSubmittedSize - submitted_));
+        if (!count)
+            return;
+
+        qint64 result;
+
+        {
+            ScopedTrace trace("socket_write");
+            result = writeSocket()->write(write_buffer.constData() + submit_offset_, count);
+        }
+
+        if (result <= 0)
+            return;
+
+        for (const auto& bucket : bandwidth_limits_)
+            bucket->consume(result);
+
+        submitted_ += result;
+        submit_offset_ += result;
+
+        if (submit_offset_ == write_buffer.size())
+        {
+            ++submit_index_;
+            submit_offset_ = 0;
+
+            if (task.switch_path)
+                switch_submitted_ = true;
+        }
+    }
+}
+
+qint64 NetworkChannel::shapeWrite(qint64 count)
+{
+    if (bandwidth_limits_.empty())
+        return count;
+
+    if (shaper_timer_id_)
+        return 0;
+
+    // The data is not written by the parts smaller than a segment.
+    const qint64 min_count = qMin(count, kMinShapedWriteSize);
+    qint64 allowed = count;
+
+    for (const auto& bucket : bandwidth_limits_)
+        allowed = qMin(allowed, bucket->available());
+
+    if (allowed >= min_count)
+        return allowed;
+
+    std::chrono::milliseconds delay(1);
+
+    for (const auto& bucket : bandwidth_limits_)
+        delay = qMax(delay, bucket->delay(min_count));
+
+    shaper_timer_id_ = startTimer(delay, Qt::PreciseTimer);
+    return 0;
 }
 
 } // namespace aspia
@@ -8,16 +8,28 @@
 #ifndef _ASPIA_NETWORK__NETWORK_CHANNEL_H
 #define _ASPIA_NETWORK__NETWORK_CHANNEL_H
 
+#include <QHostAddress>
 #include <QPointer>
+#include <QSet>
+#include <QStringList>
 #include <QTcpSocket>
+#include <QThreadPool>
 
-#include <queue>
-#include <utility>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/message_class.h"
+#include "base/message_priority.h"
+#include "network/datagram_path.h"
 
 namespace aspia {
 
 class Encryptor;
 class NetworkServer;
+class TokenBucket;
 
 class NetworkChannel : public QObject
 {
@@ -34,41 +46,111 @@ public:
     enum ChannelState
     {
         NotConnected,
+        Relaying,
         Connected,
         Encrypted
     };
     Q_ENUM(ChannelState);
 
-    ~NetworkChannel() = default;
+    // The totals of the channel. They are updated by the thread of the channel and may be read
+    // by any thread.
+    struct Counters
+    {
+        qint64 bytes_read = 0;
+        qint64 bytes_written = 0;
+        qint64 messages_read = 0;
+        qint64 messages_written = 0;
+
+        // Time in microseconds spent for the encryption and the decryption of the messages.
+        qint64 crypto_time = 0;
+
+        // Number and size of the messages waiting to be written.
+        qint64 queued_messages = 0;
+        qint64 queued_bytes = 0;
+    };
+
+    ~NetworkChannel();
 
     static NetworkChannel* createClient(QObject* parent = nullptr);
 
+    // If |address| is "host_id@relay_address", then the channel connects to the host through
+    // the relay at |port|. The relay forwards the encrypted stream of the channel.
     void connectToHost(const QString& address, int port);
 
+    // The same for the alternate addresses of the host. All addresses of the names are tried:
+    // the attempts are started one after another with a short delay, alternating IPv6 and
+    // IPv4, or at once when the previous attempt fails. The first connection which succeeds
+    // is used, and the others are aborted.
+    void connectToHost(const QStringList& addresses, int port);
+
     ChannelState channelState() const { return channel_state_; }
+
+    // True if |readMessage| has been called and the message has not been received yet.
+    bool isReadPending() const { return read_required_; }
+
+    // True after |writeQueueFull| until |writeQueueDrained|. The messages are still queued while
+    // the queue is full, but the producers should wait for the signal before writing more.
+    bool isWriteQueueFull() const { return write_queue_full_; }
     QString peerAddress() const;
 
+    Counters counters() const;
+
+    // The nonce of the authorization which the host sends with its hello message. Empty if
+    // the host does not send it or the key exchange is not completed.
+    QByteArray challengeNonce() const { return challenge_nonce_; }
+
+    // The data of the channel is written only while all the buckets have the tokens for it.
+    // A bucket may be shared by several channels. Must be called in the thread of the channel
+    // or before the channel is moved to its thread.
+    void addBandwidthLimit(std::shared_ptr<TokenBucket> bucket);
+
+    // If the peer also enables it, then the host sends the video messages by the datagrams
+    // (see DatagramPath) while they pass. The other messages and the video messages which do
+    // not pass are sent by the connection. Must be called before the key exchange.
+    void setDatagramsEnabled(bool enable) { datagrams_enabled_ = enable; }
+
 signals:
     void connected();
     void disconnected();
     void errorOccurred(const QString& message);
-    void messageReceived(const QByteArray& buffer);
+    // |priority| and |message_class| are sent by the peer with the message. They are
+    // NormalPriority and GenericMessage if the peer does not send them.
+    void messageReceived(const QByteArray& buffer,
+                         MessagePriority priority,
+                         MessageClass message_class);
     void messageWritten(int message_id);
 
+    // The messages of |message_class| which the host has sent by the datagrams are lost. The
+    // signal is received between the messages in place of the lost ones.
+    void messageLost(MessageClass message_class);
+
+    // The queued messages have exceeded the high watermark or have been written down to the
+    // low one.
+    void writeQueueFull();
+    void writeQueueDrained();
+
 public slots:
     // Starts reading the message. When the message is received, the signal |messageReceived| is
     // called. You do not need to re-call |readMessage| until this signal is called.
     void readMessage();
 
     // Sends a message. If the |message_id| is not -1, then after the message is sent,
-    // the signal |messageWritten| is called.
-    void writeMessage(int message_id, const QByteArray& buffer);
+    // the signal |messageWritten| is called. The message is sent before the queued messages
+    // with a lower priority which have not started to be sent. If the peer supports it, the
+    // large messages below HighPriority are sent by parts, and the messages of a higher
+    // priority are sent between them.
+    // The priority and |message_class| are passed to the other side with the message.
+    void writeMessage(int message_id,
+                      const QByteArray& buffer,
+                      MessagePriority priority = NormalPriority,
+                      MessageClass message_class = GenericMessage);
 
     // Stops the channel.
     void stop();
 
 protected:
     void timerEvent(QTimerEvent* event) override;
+    void customEvent(QEvent* event) override;
 
 private slots:
     void onConnected();
@@ -77,35 +159,302 @@ private slots:
     void onBytesWritten(qint64 bytes);
     void onReadyRead();
     void onMessageWritten(int message_id);
-    void onMessageReceived(const QByteArray& buffer);
+    void onMessageReceived();
+    void onDatagramsFailed();
 
 private:
     friend class NetworkServer;
 
+    struct CryptoJob;
+
     NetworkChannel(ChannelType channel_type, QTcpSocket* socket, QObject* parent);
 
+    struct ConnectEndpoint
+    {
+        QHostAddress address;
+        QString relay_host_id;
+    };
+
+    // Adds the endpoints to the queue of the connection attempts. The queue is ordered again
+    // so that the families of the addresses alternate.
+    void addConnectEndpoints(const QList<QHostAddress>& addresses,
+                             const QString& relay_host_id);
+    void startConnectAttempt();
+    void onAttemptConnected(QTcpSocket* socket, const QString& relay_host_id);
+    void onAttemptFailed(QTcpSocket* socket);
+    void failConnectAttempts();
+    void stopConnectAttempts();
+
+    // Connects the signals of |socket_| to the channel.
+    void connectSocket();
+
+    QByteArray helloMessage();
     void write(int message_id, const QByteArray& buffer);
+
+    // Encrypts |size| bytes of |buffer| as one record and queues it. |video| is set if the
+    // record contains a video message.
+    void writeRecord(int message_id,
+                     const char* buffer,
+                     int size,
+                     MessagePriority priority,
+                     MessageClass message_class,
+                     quint8 flags,
+                     bool video);
+
+    // The small messages are sealed in one record by flushWriteBatch() (see BatchFrame).
+    void addToWriteBatch(const QByteArray& buffer,
+                         MessagePriority priority,
+                         MessageClass message_class);
+    void flushWriteBatch();
+
+    // Passes the next message of |read_batch_| to the receivers. Returns false if the batch is
+    // not valid.
+    bool readBatchedMessage();
+
+    // Passes the decrypted |read_buffer_| to the receivers. The parts of a large message (see
+    // FragmentFrame) are joined before the message is passed.
+    void passMessage();
+
+    // If the peers support the typed frames, then the size of each encrypted message is
+    // followed by the header of kFrameHeaderSize bytes: the class, the priority and the flags
+    // of the message. The header is not encrypted, so it is only a hint for the scheduling.
+    // Does nothing if the typed frames are not used.
+    void writeFrameHeader(quint8* data,
+                          int size_length,
+                          MessagePriority priority,
+                          MessageClass message_class,
+                          quint8 flags) const;
+    bool readFrameHeader();
+
+    enum FrameFlags
+    {
+        // The message of the channel which follows kControlMarker.
+        ControlFrame = 1,
+
+        // The record contains several messages, each of them is preceded by its size, class
+        // and priority. Sent only if both peers send |batch_frames| in the hello message.
+        BatchFrame = 2,
+
+        // The record is a part of a large message. The next records of the same priority
+        // continue it, and the first one without the flag is its last part. The records of the
+        // higher priorities may be sent between the parts. Sent only if both peers send
+        // |fragment_frames| in the hello message.
+        FragmentFrame = 4
+    };
+
+    static const int kFrameHeaderSize = 3;
+
+    // The messages of the channel (PathMessage) which are not passed to the receivers. The
+    // message with |switch_path| is the last message on the previous connection.
+    void writeControlMessage(const QByteArray& buffer, bool switch_path);
+    void onControlMessage();
+
+    // The relayed channel of the host sends |addresses| to the client after the key exchange.
+    // The client connects to them, and the first connection which succeeds is joined to the
+    // channel. The peers send their messages to the new connection after the last message on
+    // the previous one, so the encryptor continues with the next nonces. The client switches
+    // only after the host has switched, so the connection to a wrong host is not used.
+    void setPathCandidates(const QStringList& addresses, int port);
+    void sendPathCandidates();
+    void startPathCheck(const QStringList& addresses, int port, const QByteArray& token);
+    void onPathConnected(QTcpSocket* socket, const QByteArray& token);
+    void joinPath(const std::string& token);
+    void onPathJoined(QTcpSocket* socket);
+    void connectPathSocket();
+    void startPathSwitch();
+    void finishPathSwitch();
+    void clearPathCandidates();
+
+    // Returns true if the event of |source| does not stop the channel.
+    bool isPathEvent(QObject* source);
+
+    // The host starts the datagrams after the key exchange, and the client when it receives
+    // the port of the host.
+    void startDatagrams();
+    void startDatagramReceiver(int port);
+    void stopDatagrams();
+
+    // The video messages are sent by the datagrams only after the video records which are
+    // queued on the connection, so they are received in order.
+    bool isDatagramWrite(MessageClass message_class) const;
+
+    QTcpSocket* readSocket() const { return read_switched_ ? path_socket_ : socket_; }
+    QTcpSocket* writeSocket() const { return write_switched_ ? path_socket_ : socket_; }
+
+    // If |encrypt_offset| is not -1, then the message of |message_size| bytes at this offset is
+    // encrypted before it is passed to the socket.
+    void enqueueWrite(int message_id,
+                      MessagePriority priority,
+                      QByteArray&& write_buffer,
+                      int encrypt_offset = -1,
+                      int message_size = 0,
+                      bool switch_path = false,
+                      bool video = false);
+    QByteArray takeFreeBuffer();
+
+    // Resizes |read_buffer_| to |size| bytes for the next message. The released buffer of
+    // |read_buffers_| is used if the receivers keep the previous message.
+    void prepareReadBuffer(int size);
     void scheduleWrite();
 
+    // Returns the part of |count| bytes which the buckets allow to write now. If nothing is
+    // allowed, then scheduleWrite() is called again when the buckets are refilled.
+    qint64 shapeWrite(qint64 count);
+
+    // Processes the chunks of the message by the threads of |crypto_pool_|. When the chunks
+    // are processed, onMessageEncrypted() or onMessageDecrypted() is called.
+    void startCryptoJob(CryptoJob* job, bool encrypt);
+    void onMessageEncrypted();
+    void onMessageDecrypted();
+
     using MessageSizeType = quint32;
 
     const ChannelType channel_type_;
     ChannelState channel_state_ = NotConnected;
     QPointer<QTcpSocket> socket_;
 
+    // The host which is requested from the relay before the key exchange.
+    QString relay_host_id_;
+
+    // The connection attempts of the client. |socket_| is replaced by the first one which
+    // succeeds.
+    bool connecting_ = false;
+    int connect_port_ = 0;
+    int pending_lookups_ = 0;
+    std::deque<ConnectEndpoint> connect_queue_;
+    QSet<QString> connect_endpoints_;
+    std::vector<QPointer<QTcpSocket>> connect_attempts_;
+    QAbstractSocket::NetworkLayerProtocol last_attempt_protocol_ =
+        QAbstractSocket::UnknownNetworkLayerProtocol;
+    int attempt_timer_id_ = 0;
+    int connect_timer_id_ = 0;
+    QString connect_error_;
+
     std::unique_ptr<Encryptor> encryptor_;
 
-    std::queue<std::pair<int, QByteArray>> write_queue_;
+    // Messages which have not been written completely. The data is passed to the socket from
+    // the position |submit_index_|:|submit_offset_| while fewer than kMaxSubmittedSize bytes
+    // wait in the buffer of the socket.
+    struct WriteTask
+    {
+        int message_id;
+        MessagePriority priority;
+        QByteArray buffer;
+
+        // Offset of the message which is not encrypted yet or -1.
+        int encrypt_offset;
+        int message_size;
+
+        // The next messages are sent to |path_socket_|.
+        bool switch_path;
+
+        bool video;
+    };
+
+    std::deque<WriteTask> write_queue_;
+    size_t submit_index_ = 0;
+    qint64 submit_offset_ = 0;
+    qint64 submitted_ = 0;
+
+    // Number of written bytes of the first message of the queue.
     qint64 written_ = 0;
 
+    // Buffers of the written messages which are reused by writeMessage().
+    std::vector<QByteArray> free_buffers_;
+
+    std::vector<std::shared_ptr<TokenBucket>> bandwidth_limits_;
+    int shaper_timer_id_ = 0;
+
     bool read_required_ = false;
     bool read_size_received_ = false;
+
+    // True while the received message is passed to the receivers.
+    bool receiving_ = false;
     QByteArray read_buffer_;
+
+    // Buffers of the received messages which are kept by the receivers.
+    std::vector<QByteArray> read_buffers_;
     int read_size_ = 0;
     qint64 read_ = 0;
 
+    // Both peers send the typed frame headers.
+    bool typed_frames_ = false;
+
+    // Both peers seal the small messages together.
+    bool batch_frames_ = false;
+
+    // Both peers send the large messages by parts.
+    bool fragment_frames_ = false;
+
+    // The small messages which are sealed at the end of the turn of the event loop.
+    QByteArray write_batch_;
+    int write_batch_count_ = 0;
+    MessagePriority write_batch_priority_ = NormalPriority;
+    MessageClass write_batch_class_ = GenericMessage;
+    bool write_batch_pending_ = false;
+    bool write_batch_video_ = false;
+
+    // The received batch and the position of its next message.
+    QByteArray read_batch_;
+    int read_batch_offset_ = 0;
+    bool read_batch_frame_ = false;
+
+    // The received parts of the large messages of each priority.
+    QByteArray read_fragments_[LowPriority + 1];
+    bool read_fragment_frame_ = false;
+
+    QByteArray challenge_nonce_;
+
+    quint8 read_header_[kFrameHeaderSize];
+    int read_header_size_ = kFrameHeaderSize;
+    MessagePriority read_priority_ = NormalPriority;
+    MessageClass read_class_ = GenericMessage;
+
     int pinger_timer_id_ = 0;
 
+    // The next received message is the message of the channel.
+    bool control_message_ = false;
+
+    // The connection to which the channel is being moved. The host offers its addresses only
+    // if the hello message of the client has |path_switch|.
+    QStringList path_addresses_;
+    int path_port_ = 0;
+    QByteArray path_token_;
+    bool peer_path_switch_ = false;
+
+    std::vector<QPointer<QTcpSocket>> path_candidates_;
+    int path_timer_id_ = 0;
+    bool path_check_started_ = false;
+
+    QPointer<QTcpSocket> path_socket_;
+    bool read_switched_ = false;
+    bool write_switched_ = false;
+    bool switch_sent_ = false;
+    bool switch_submitted_ = false;
+
+    // Both peers enable the datagrams. The host enables them only on the direct connections.
+    bool datagrams_enabled_ = false;
+    bool datagrams_ = false;
+    QPointer<DatagramPath> datagram_path_;
+
+    // The records of the video messages in |write_queue_|.
+    int queued_video_records_ = 0;
+
+    // The large messages which are encrypted or decrypted by the pool. Only one message of each
+    // direction is processed at a time.
+    QThreadPool crypto_pool_;
+    std::unique_ptr<CryptoJob> encrypt_job_;
+    std::unique_ptr<CryptoJob> decrypt_job_;
+
+    std::atomic<qint64> bytes_read_{ 0 };
+    std::atomic<qint64> bytes_written_{ 0 };
+    std::atomic<qint64> messages_read_{ 0 };
+    std::atomic<qint64> messages_written_{ 0 };
+    std::atomic<qint64> crypto_time_{ 0 };
+    std::atomic<qint64> queued_messages_{ 0 };
+    std::atomic<qint64> queued_bytes_{ 0 };
+    bool write_queue_full_ = false;
+
     Q_DISABLE_COPY(NetworkChannel)
 };
 
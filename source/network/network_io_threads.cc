@@ -0,0 +1,71 @@
+//
+// PROJECT:         Aspia
+// FILE:            network/network_io_threads.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "network/network_io_threads.h"
+
+#include <QDebug>
+#include <QThread>
+
+#include "network/network_channel.h"
+
+namespace aspia {
+
+namespace {
+
+constexpr int kMaxThreadCount = 4;
+
+} // namespace
+
+NetworkIoThreads::NetworkIoThreads(QObject* parent)
+    : QObject(parent),
+      threads_(qBound(1, QThread::idealThreadCount(), kMaxThreadCount))
+{
+    for (auto& thread : threads_)
+    {
+        thread.thread = std::make_unique<QThread>();
+        thread.thread->start();
+    }
+}
+
+NetworkIoThreads::~NetworkIoThreads()
+{
+    // The channels for which deleteLater() has been called are deleted when the thread is
+    // finished.
+    for (auto& thread : threads_)
+    {
+        thread.thread->quit();
+        thread.thread->wait();
+    }
+}
+
+void NetworkIoThreads::moveChannel(NetworkChannel* channel)
+{
+    Q_ASSERT(channel);
+
+    // The objects with a parent can not be moved to another thread.
+    channel->setParent(nullptr);
+
+    size_t index = 0;
+
+    for (size_t i = 1; i < threads_.size(); ++i)
+    {
+        if (threads_[i].channel_count < threads_[index].channel_count)
+            index = i;
+    }
+
+    ++threads_[index].channel_count;
+
+    // The signal is emitted in the thread of the channel and is delivered with the queue.
+    connect(channel, &QObject::destroyed, this, [this, index]()
+    {
+        --threads_[index].channel_count;
+    });
+
+    channel->moveToThread(threads_[index].thread.get());
+}
+
+} // namespace aspia
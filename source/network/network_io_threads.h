@@ -0,0 +1,56 @@
+//
+// PROJECT:         Aspia
+// FILE:            network/network_io_threads.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_NETWORK__NETWORK_IO_THREADS_H
+#define _ASPIA_NETWORK__NETWORK_IO_THREADS_H
+
+#include <QObject>
+
+#include <memory>
+#include <vector>
+
+class QThread;
+
+namespace aspia {
+
+class NetworkChannel;
+
+//
+// Threads in which the network channels of the sessions are served, so the reading and
+// the writing of a busy session do not delay the other sessions and the main thread. A channel
+// is moved to the thread which serves the fewest channels. The moved channel must be used only
+// through the queued signals and slots.
+//
+// The channels moved to the threads are deleted by deleteLater(). The channels which are still
+// waiting for the deletion are deleted when the threads are stopped in the destructor.
+//
+class NetworkIoThreads : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit NetworkIoThreads(QObject* parent = nullptr);
+    ~NetworkIoThreads();
+
+    // Moves |channel| to one of the threads. The channel is detached from its parent.
+    void moveChannel(NetworkChannel* channel);
+
+private:
+    struct Thread
+    {
+        std::unique_ptr<QThread> thread;
+        int channel_count = 0;
+    };
+
+    std::vector<Thread> threads_;
+
+    Q_DISABLE_COPY(NetworkIoThreads)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_NETWORK__NETWORK_IO_THREADS_H
@@ -8,17 +8,70 @@
 #include "network/network_server.h"
 
 #include <QDebug>
+#include <QNetworkInterface>
+#include <QTcpSocket>
+#include <QTimerEvent>
 
+#include "network/iocp_socket.h"
 #include "network/network_channel.h"
+#include "network/relay_agent.h"
 
 namespace aspia {
 
+namespace {
+
+// The time for the key exchange of a new connection.
+constexpr std::chrono::seconds kHandshakeTimeout{ 15 };
+
+// The interval of the check of the pending connections.
+constexpr std::chrono::seconds kTimeoutCheckInterval{ 1 };
+
+// Serves the accepted connections by the completion port instead of the event loop.
+class IocpTcpServer : public QTcpServer
+{
+public:
+    explicit IocpTcpServer(QObject* parent)
+        : QTcpServer(parent)
+    {
+        // Nothing
+    }
+
+protected:
+    // QTcpServer implementation.
+    void incomingConnection(qintptr descriptor) override
+    {
+        IocpSocket* socket = IocpSocket::create(descriptor, this);
+        if (socket)
+            addPendingConnection(socket);
+    }
+
+private:
+    Q_DISABLE_COPY(IocpTcpServer)
+};
+
+} // namespace
+
 NetworkServer::NetworkServer(QObject* parent)
     : QObject(parent)
 {
     // Nothing
 }
 
+void NetworkServer::setMaxPendingChannels(int max_pending_channels)
+{
+    max_pending_channels_ = max_pending_channels;
+}
+
+void NetworkServer::setIocpEnabled(bool enable)
+{
+    iocp_enabled_ = enable;
+}
+
+void NetworkServer::setDatagramsEnabled(bool enable)
+{
+    datagrams_enabled_ = enable;
+}
+
 bool NetworkServer::start(int port)
 {
     if (!tcp_server_.isNull())
@@ -27,7 +80,12 @@ bool NetworkServer::start(int port)
         return false;
     }
 
-    tcp_server_ = new QTcpServer(this);
+    if (iocp_enabled_)
+        tcp_server_ = new IocpTcpServer(this);
+    else
+        tcp_server_ = new QTcpServer(this);
+
+    tcp_server_->setMaxPendingConnections(max_pending_channels_);
 
     connect(tcp_server_, &QTcpServer::newConnection, this, &NetworkServer::onNewConnection);
     connect(tcp_server_, &QTcpServer::acceptError,
@@ -56,7 +114,7 @@ void NetworkServer::stop()
 
     for (auto it = pending_channels_.constBegin(); it != pending_channels_.constEnd(); ++it)
     {
-        NetworkChannel* network_channel = *it;
+        NetworkChannel* network_channel = it->channel;
 
         if (network_channel)
             network_channel->stop();
@@ -70,13 +128,44 @@ void NetworkServer::stop()
             network_channel->stop();
     }
 
+    for (auto it = relay_agents_.constBegin(); it != relay_agents_.constEnd(); ++it)
+        delete *it;
+
+    relay_agents_.clear();
     pending_channels_.clear();
     ready_channels_.clear();
 
+    if (timeout_timer_id_)
+    {
+        killTimer(timeout_timer_id_);
+        timeout_timer_id_ = 0;
+    }
+
     tcp_server_->close();
     delete tcp_server_;
 }
 
+void NetworkServer::addRelay(const QString& address, int port, const QString& host_id,
+                             const QString& secret, const QByteArray& host_key)
+{
+    if (tcp_server_.isNull())
+    {
+        qWarning("Server is not started");
+        return;
+    }
+
+    RelayAgent* relay_agent = new RelayAgent(address, port, host_id, secret, host_key, this);
+
+    connect(relay_agent, &RelayAgent::newConnection, this,
+            [this, relay_agent](QTcpSocket* socket)
+    {
+        addPendingSocket(socket, true, pathAddresses(relay_agent));
+    });
+
+    relay_agents_.push_back(relay_agent);
+    relay_agent->start();
+}
+
 bool NetworkServer::hasReadyChannels() const
 {
     return !ready_channels_.isEmpty();
@@ -92,31 +181,116 @@ NetworkChannel* NetworkServer::nextReadyChannel()
     return network_channel;
 }
 
+void NetworkServer::timerEvent(QTimerEvent* event)
+{
+    if (event->timerId() != timeout_timer_id_)
+    {
+        QObject::timerEvent(event);
+        return;
+    }
+
+    for (const auto& pending_channel : pending_channels_)
+    {
+        if (!pending_channel.channel.isNull() &&
+            pending_channel.start_time.hasExpired(
+                std::chrono::milliseconds(kHandshakeTimeout).count()))
+        {
+            qWarning() << "Key exchange timeout for" << pending_channel.channel->peerAddress();
+
+            // The channel is removed from the list when it is disconnected.
+            pending_channel.channel->stop();
+        }
+    }
+
+    if (pending_channels_.isEmpty())
+    {
+        killTimer(timeout_timer_id_);
+        timeout_timer_id_ = 0;
+    }
+}
+
 void NetworkServer::onNewConnection()
 {
-    QTcpSocket* socket = tcp_server_->nextPendingConnection();
-    if (!socket)
+    while (QTcpSocket* socket = tcp_server_->nextPendingConnection())
+        addPendingSocket(socket);
+}
+
+void NetworkServer::addPendingSocket(QTcpSocket* socket,
+                                     bool relayed,
+                                     const QStringList& path_addresses)
+{
+    if (pending_channels_.size() >= max_pending_channels_)
+    {
+        qWarning() << "Too many connections in the key exchange:" << pending_channels_.size()
+                   << ". Connection from" << socket->peerAddress().toString()
+                   << "is rejected";
+
+        socket->abort();
+        socket->deleteLater();
         return;
+    }
 
     NetworkChannel* network_channel =
         new NetworkChannel(NetworkChannel::ServerChannel, socket, this);
 
+    if (!path_addresses.isEmpty())
+        network_channel->setPathCandidates(path_addresses, tcp_server_->serverPort());
+
+    // The datagrams of the client do not pass the relay.
+    if (!relayed)
+        network_channel->setDatagramsEnabled(datagrams_enabled_);
+
     connect(network_channel, &NetworkChannel::connected,
             this, &NetworkServer::onChannelReady);
 
-    pending_channels_.push_back(network_channel);
+    connect(network_channel, &NetworkChannel::disconnected,
+            this, &NetworkServer::onChannelDisconnected);
+
+    PendingChannel pending_channel;
+    pending_channel.channel = network_channel;
+    pending_channel.start_time.start();
+
+    pending_channels_.push_back(pending_channel);
+
+    qInfo() << "Connections in the key exchange:" << pending_channels_.size();
+
+    if (!timeout_timer_id_)
+        timeout_timer_id_ = startTimer(kTimeoutCheckInterval);
 
     // Start connection (key exchange).
     network_channel->onConnected();
 }
 
+QStringList NetworkServer::pathAddresses(const RelayAgent* relay_agent) const
+{
+    QStringList addresses;
+
+    // The public address is reachable if the port is forwarded to the host.
+    const QString public_address = relay_agent->publicAddress();
+    if (!public_address.isEmpty())
+        addresses.append(public_address);
+
+    for (const QHostAddress& address : QNetworkInterface::allAddresses())
+    {
+        // The link-local IPv6 addresses are not usable without the interface of the client.
+        if (address.isLoopback() || !address.scopeId().isEmpty())
+            continue;
+
+        const QString text = address.toString();
+        if (!addresses.contains(text))
+            addresses.append(text);
+    }
+
+    return addresses;
+}
+
 void NetworkServer::onChannelReady()
 {
     auto it = pending_channels_.begin();
 
     while (it != pending_channels_.end())
     {
-        NetworkChannel* network_channel = *it;
+        NetworkChannel* network_channel = it->channel;
 
         if (!network_channel)
         {
@@ -126,6 +300,11 @@ void NetworkServer::onChannelReady()
         {
             it = pending_channels_.erase(it);
 
+            disconnect(network_channel, &NetworkChannel::connected,
+                       this, &NetworkServer::onChannelReady);
+            disconnect(network_channel, &NetworkChannel::disconnected,
+                       this, &NetworkServer::onChannelDisconnected);
+
             ready_channels_.push_back(network_channel);
             emit newChannelReady();
         }
@@ -136,4 +315,31 @@ void NetworkServer::onChannelReady()
     }
 }
 
+void NetworkServer::onChannelDisconnected()
+{
+    NetworkChannel* disconnected_channel = qobject_cast<NetworkChannel*>(sender());
+
+    // The channels which are disconnected during the key exchange are not used by anyone.
+    auto it = pending_channels_.begin();
+
+    while (it != pending_channels_.end())
+    {
+        NetworkChannel* network_channel = it->channel;
+
+        if (!network_channel)
+        {
+            it = pending_channels_.erase(it);
+        }
+        else if (network_channel == disconnected_channel)
+        {
+            it = pending_channels_.erase(it);
+            network_channel->deleteLater();
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
 } // namespace aspia
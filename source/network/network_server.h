@@ -8,14 +8,23 @@
 #ifndef _ASPIA_NETWORK__NETWORK_SERVER_H
 #define _ASPIA_NETWORK__NETWORK_SERVER_H
 
+#include <QElapsedTimer>
 #include <QPointer>
 #include <QList>
+#include <QStringList>
 #include <QTcpServer>
 
 namespace aspia {
 
 class NetworkChannel;
+class RelayAgent;
 
+//
+// Accepts the connections and performs the key exchange. The number of the connections in
+// the key exchange is limited, and the connections above the limit are closed at once without
+// any work, so a storm of connections does not slow down the established sessions. The key
+// exchange which is not completed within kHandshakeTimeout is aborted.
+//
 class NetworkServer : public QObject
 {
     Q_OBJECT
@@ -24,25 +33,71 @@ public:
     explicit NetworkServer(QObject* parent = nullptr);
     ~NetworkServer() = default;
 
+    static const int kDefaultMaxPendingChannels = 32;
+
+    // Must be called before the start.
+    void setMaxPendingChannels(int max_pending_channels);
+
+    // Must be called before the start. If enabled, then the accepted connections are served by
+    // the completion port of the process (see IocpSocket).
+    void setIocpEnabled(bool enable);
+
+    // Must be called before the start. If enabled, then the channels of the direct
+    // connections send the video by the datagrams to the clients which support them.
+    void setDatagramsEnabled(bool enable);
+
     bool start(int port);
     void stop();
 
+    // Registers the server on the relay as |host_id|. The clients which connect to |host_id|
+    // through the relay are accepted as the direct connections. |host_key| proves to the relay
+    // that the server owns |host_id|. Must be called after the start.
+    void addRelay(const QString& address, int port, const QString& host_id,
+                  const QString& secret, const QByteArray& host_key);
+
     bool hasReadyChannels() const;
     NetworkChannel* nextReadyChannel();
 
+    // The number of the connections in the key exchange.
+    int pendingChannelCount() const { return pending_channels_.size(); }
+
 signals:
     void newChannelReady();
 
+protected:
+    // QObject implementation.
+    void timerEvent(QTimerEvent* event) override;
+
 private slots:
     void onNewConnection();
     void onChannelReady();
+    void onChannelDisconnected();
 
 private:
+    // |path_addresses| are the addresses of the host which are offered to the client of the
+    // relayed connection for the direct connection.
+    void addPendingSocket(QTcpSocket* socket,
+                          bool relayed = false,
+                          const QStringList& path_addresses = QStringList());
+    QStringList pathAddresses(const RelayAgent* relay_agent) const;
+
+    struct PendingChannel
+    {
+        QPointer<NetworkChannel> channel;
+        QElapsedTimer start_time;
+    };
+
     QPointer<QTcpServer> tcp_server_;
+    int max_pending_channels_ = kDefaultMaxPendingChannels;
+    bool iocp_enabled_ = false;
+    bool datagrams_enabled_ = false;
 
     // Contains a list of channels that are already connected, but the key exchange
     // is not yet complete.
-    QList<QPointer<NetworkChannel>> pending_channels_;
+    QList<PendingChannel> pending_channels_;
+    int timeout_timer_id_ = 0;
+
+    QList<QPointer<RelayAgent>> relay_agents_;
 
     // Contains a list of channels that are ready for use.
     QList<QPointer<NetworkChannel>> ready_channels_;
@@ -0,0 +1,255 @@
+//
+// PROJECT:         Aspia
+// FILE:            network/relay_agent.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "network/relay_agent.h"
+
+#include <QDebug>
+#include <QTimerEvent>
+
+#include "base/message_serialization.h"
+#include "network/relay_protocol.h"
+#include "protocol/relay.pb.h"
+
+namespace aspia {
+
+namespace {
+
+constexpr std::chrono::seconds kReconnectInterval{ 5 };
+
+// The relay does not read the registration connection, so the pings only let the host notice
+// the lost connection.
+constexpr std::chrono::seconds kPingInterval{ 30 };
+
+const char* statusToString(proto::relay::Reply::Status status)
+{
+    switch (status)
+    {
+        case proto::relay::Reply::STATUS_SUCCESS:
+            return "Success";
+
+        case proto::relay::Reply::STATUS_INVALID:
+            return "Invalid Request";
+
+        case proto::relay::Reply::STATUS_ACCESS_DENIED:
+            return "Access Denied";
+
+        case proto::relay::Reply::STATUS_HOST_NOT_FOUND:
+            return "Host Not Found";
+
+        case proto::relay::Reply::STATUS_HOST_TIMEOUT:
+            return "Host Timeout";
+
+        case proto::relay::Reply::STATUS_BUSY:
+            return "Busy";
+
+        default:
+            return "Unknown";
+    }
+}
+
+} // namespace
+
+RelayAgent::RelayAgent(const QString& address,
+                       int port,
+                       const QString& host_id,
+                       const QString& secret,
+                       const QByteArray& host_key,
+                       QObject* parent)
+    : QObject(parent),
+      address_(address),
+      port_(port),
+      host_id_(host_id),
+      secret_(secret),
+      host_key_(host_key)
+{
+    // Nothing
+}
+
+void RelayAgent::start()
+{
+    connectToRelay();
+}
+
+void RelayAgent::timerEvent(QTimerEvent* event)
+{
+    if (event->timerId() == reconnect_timer_id_)
+    {
+        killTimer(reconnect_timer_id_);
+        reconnect_timer_id_ = 0;
+
+        connectToRelay();
+    }
+    else if (event->timerId() == ping_timer_id_)
+    {
+        if (!register_socket_.isNull())
+            register_socket_->write(QByteArray(1, 0));
+    }
+    else
+    {
+        QObject::timerEvent(event);
+    }
+}
+
+void RelayAgent::connectToRelay()
+{
+    Q_ASSERT(register_socket_.isNull());
+
+    registered_ = false;
+    register_socket_ = new QTcpSocket(this);
+
+    connect(register_socket_, &QTcpSocket::connected, this, &RelayAgent::onRegisterConnected);
+    connect(register_socket_, &QTcpSocket::readyRead, this, &RelayAgent::onRegisterReadyRead);
+
+    // The failed connection is not disconnected, so the errors restart it too.
+    connect(register_socket_, &QTcpSocket::disconnected,
+            this, &RelayAgent::onRegisterDisconnected,
+            Qt::QueuedConnection);
+
+    connect(register_socket_, QOverload<QTcpSocket::SocketError>::of(&QTcpSocket::error),
+            this, &RelayAgent::onRegisterDisconnected,
+            Qt::QueuedConnection);
+
+    register_socket_->connectToHost(address_, port_);
+}
+
+void RelayAgent::onRegisterConnected()
+{
+    register_socket_->setSocketOption(QTcpSocket::KeepAliveOption, 1);
+
+    proto::relay::Request request;
+    request.set_type(proto::relay::Request::TYPE_REGISTER);
+    request.set_host_id(host_id_.toStdString());
+    request.set_secret(secret_.toStdString());
+    request.set_host_key(host_key_.constData(), host_key_.size());
+
+    RelayProtocol::writeMessage(register_socket_, serializeMessage(request));
+}
+
+void RelayAgent::onRegisterReadyRead()
+{
+    QByteArray buffer;
+
+    for (;;)
+    {
+        const RelayProtocol::ReadResult result =
+            RelayProtocol::readMessage(register_socket_, &buffer);
+
+        if (result == RelayProtocol::ReadResult::PENDING)
+            return;
+
+        if (result == RelayProtocol::ReadResult::INVALID)
+        {
+            qWarning() << "Invalid message from relay" << address_;
+            register_socket_->abort();
+            return;
+        }
+
+        if (!registered_)
+        {
+            proto::relay::Reply reply;
+
+            if (!parseMessage(buffer, reply) ||
+                reply.status() != proto::relay::Reply::STATUS_SUCCESS)
+            {
+                qWarning() << "Registration on relay" << address_ << "failed:"
+                           << statusToString(reply.status());
+                register_socket_->abort();
+                return;
+            }
+
+            qInfo() << "Host is registered on relay" << address_ << "as" << host_id_;
+
+            registered_ = true;
+            public_address_ = QString::fromStdString(reply.address());
+            ping_timer_id_ = startTimer(kPingInterval);
+            continue;
+        }
+
+        proto::relay::Incoming incoming;
+
+        if (!parseMessage(buffer, incoming) || !incoming.token())
+        {
+            register_socket_->abort();
+            return;
+        }
+
+        acceptClient(incoming.token());
+    }
+}
+
+void RelayAgent::onRegisterDisconnected()
+{
+    // Both the error and the disconnection are received for the lost connection.
+    if (register_socket_.isNull() || reconnect_timer_id_)
+        return;
+
+    qInfo() << "Connection to relay" << address_ << "is lost:" << register_socket_->errorString();
+
+    if (ping_timer_id_)
+    {
+        killTimer(ping_timer_id_);
+        ping_timer_id_ = 0;
+    }
+
+    register_socket_->abort();
+    register_socket_->deleteLater();
+    register_socket_ = nullptr;
+
+    reconnect_timer_id_ = startTimer(kReconnectInterval);
+}
+
+void RelayAgent::acceptClient(quint64 token)
+{
+    QTcpSocket* socket = new QTcpSocket(this);
+
+    connect(socket, &QTcpSocket::connected, socket, [socket, token]()
+    {
+        proto::relay::Request request;
+        request.set_type(proto::relay::Request::TYPE_ACCEPT);
+        request.set_token(token);
+
+        RelayProtocol::writeMessage(socket, serializeMessage(request));
+    });
+
+    connect(socket, &QTcpSocket::readyRead, this, [this, socket]() { onAcceptReadyRead(socket); });
+
+    // The relay closes the connection if the client is gone.
+    connect(socket, QOverload<QTcpSocket::SocketError>::of(&QTcpSocket::error),
+            socket, &QTcpSocket::deleteLater, Qt::QueuedConnection);
+
+    socket->connectToHost(address_, port_);
+}
+
+void RelayAgent::onAcceptReadyRead(QTcpSocket* socket)
+{
+    QByteArray buffer;
+
+    const RelayProtocol::ReadResult result = RelayProtocol::readMessage(socket, &buffer);
+    if (result == RelayProtocol::ReadResult::PENDING)
+        return;
+
+    proto::relay::Reply reply;
+
+    if (result == RelayProtocol::ReadResult::INVALID || !parseMessage(buffer, reply) ||
+        reply.status() != proto::relay::Reply::STATUS_SUCCESS)
+    {
+        qWarning() << "Unable to accept client on relay" << address_ << ":"
+                   << statusToString(reply.status());
+        socket->abort();
+        socket->deleteLater();
+        return;
+    }
+
+    // The hello message of the client may be received after the reply and is read by the
+    // channel.
+    socket->disconnect();
+    socket->setParent(nullptr);
+
+    emit newConnection(socket);
+}
+
+} // namespace aspia
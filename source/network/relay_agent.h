@@ -0,0 +1,74 @@
+//
+// PROJECT:         Aspia
+// FILE:            network/relay_agent.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_NETWORK__RELAY_AGENT_H
+#define _ASPIA_NETWORK__RELAY_AGENT_H
+
+#include <QPointer>
+#include <QTcpSocket>
+
+namespace aspia {
+
+//
+// Registers the host on the relay and accepts the clients which connect to the host through
+// the relay. The registration is restored after kReconnectInterval if the connection to the
+// relay is lost. The sockets of the clients are passed to NetworkServer, which performs the
+// key exchange as for the direct connections.
+//
+class RelayAgent : public QObject
+{
+    Q_OBJECT
+
+public:
+    RelayAgent(const QString& address,
+               int port,
+               const QString& host_id,
+               const QString& secret,
+               const QByteArray& host_key,
+               QObject* parent = nullptr);
+    ~RelayAgent() = default;
+
+    void start();
+
+    // The address of the host as the relay sees it. Empty until the host is registered.
+    QString publicAddress() const { return public_address_; }
+
+signals:
+    // |socket| is connected to the client through the relay and has no parent.
+    void newConnection(QTcpSocket* socket);
+
+protected:
+    // QObject implementation.
+    void timerEvent(QTimerEvent* event) override;
+
+private:
+    void connectToRelay();
+    void onRegisterConnected();
+    void onRegisterReadyRead();
+    void onRegisterDisconnected();
+    void acceptClient(quint64 token);
+    void onAcceptReadyRead(QTcpSocket* socket);
+
+    const QString address_;
+    const int port_;
+    const QString host_id_;
+    const QString secret_;
+    const QByteArray host_key_;
+
+    QPointer<QTcpSocket> register_socket_;
+    bool registered_ = false;
+    QString public_address_;
+
+    int reconnect_timer_id_ = 0;
+    int ping_timer_id_ = 0;
+
+    Q_DISABLE_COPY(RelayAgent)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_NETWORK__RELAY_AGENT_H
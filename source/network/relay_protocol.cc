@@ -0,0 +1,109 @@
+//
+// PROJECT:         Aspia
+// FILE:            network/relay_protocol.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "network/relay_protocol.h"
+
+namespace aspia {
+
+namespace {
+
+// The messages are smaller than kMaxMessageSize, so the size takes up to 2 bytes.
+constexpr int kMaxSizeLength = 2;
+
+} // namespace
+
+const QChar RelayProtocol::kHostIdSeparator = QLatin1Char('@');
+
+// static
+bool RelayProtocol::writeMessage(QIODevice* device, const QByteArray& message)
+{
+    const int size = message.size();
+
+    if (!size || size > kMaxMessageSize)
+        return false;
+
+    QByteArray buffer;
+
+    if (size > 0x7F)
+    {
+        buffer.append(static_cast<char>((size & 0x7F) | 0x80));
+        buffer.append(static_cast<char>(size >> 7));
+    }
+    else
+    {
+        buffer.append(static_cast<char>(size));
+    }
+
+    buffer.append(message);
+
+    return device->write(buffer) == buffer.size();
+}
+
+// static
+RelayProtocol::ReadResult RelayProtocol::readMessage(QIODevice* device, QByteArray* message)
+{
+    const QByteArray header = device->peek(kMaxSizeLength);
+    if (header.isEmpty())
+        return ReadResult::PENDING;
+
+    const quint8 first = static_cast<quint8>(header[0]);
+    int size = first & 0x7F;
+    int size_length = 1;
+
+    if (first & 0x80)
+    {
+        if (header.size() < kMaxSizeLength)
+            return ReadResult::PENDING;
+
+        const quint8 second = static_cast<quint8>(header[1]);
+        if (second & 0x80)
+            return ReadResult::INVALID;
+
+        size += second << 7;
+        size_length = kMaxSizeLength;
+    }
+
+    if (!size || size > kMaxMessageSize)
+        return ReadResult::INVALID;
+
+    if (device->bytesAvailable() < size_length + size)
+        return ReadResult::PENDING;
+
+    device->read(size_length);
+    *message = device->read(size);
+
+    return message->size() == size ? ReadResult::COMPLETE : ReadResult::INVALID;
+}
+
+// static
+bool RelayProtocol::parseAddress(const QString& text, QString* address, int* port)
+{
+    *address = text.trimmed();
+    *port = kDefaultRelayTcpPort;
+
+    // The IPv6 addresses with the port are enclosed in the brackets.
+    const int separator = address->lastIndexOf(QLatin1Char(':'));
+    if (separator == -1 || (address->indexOf(QLatin1Char(':')) != separator &&
+                            !address->startsWith(QLatin1Char('['))))
+    {
+        return !address->isEmpty();
+    }
+
+    bool ok = false;
+    *port = address->midRef(separator + 1).toInt(&ok);
+    if (!ok || *port <= 0 || *port > 65535)
+        return false;
+
+    address->truncate(separator);
+
+    if (address->startsWith(QLatin1Char('[')) && address->endsWith(QLatin1Char(']')))
+        *address = address->mid(1, address->size() - 2);
+
+    return !address->isEmpty();
+}
+
+} // namespace aspia
@@ -0,0 +1,47 @@
+//
+// PROJECT:         Aspia
+// FILE:            network/relay_protocol.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_NETWORK__RELAY_PROTOCOL_H
+#define _ASPIA_NETWORK__RELAY_PROTOCOL_H
+
+#include <QByteArray>
+#include <QIODevice>
+#include <QString>
+
+namespace aspia {
+
+//
+// The messages of protocol/relay.proto which precede the forwarded stream. They are framed
+// as the unencrypted messages of NetworkChannel, and the bytes after the message are left in
+// the device, so the stream continues from them.
+//
+class RelayProtocol
+{
+public:
+    enum class ReadResult { COMPLETE, PENDING, INVALID };
+
+    static const int kMaxMessageSize = 1024;
+
+    // Separates the identifier of the host from the address of the relay in the addresses of
+    // the clients: "host_id@relay_address".
+    static const QChar kHostIdSeparator;
+
+    static bool writeMessage(QIODevice* device, const QByteArray& message);
+
+    // Reads the message if all its bytes are received.
+    static ReadResult readMessage(QIODevice* device, QByteArray* message);
+
+    // Splits "address" or "address:port" of the relay. Returns false if the port is invalid.
+    static bool parseAddress(const QString& text, QString* address, int* port);
+
+private:
+    Q_DISABLE_COPY(RelayProtocol)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_NETWORK__RELAY_PROTOCOL_H
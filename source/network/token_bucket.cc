@@ -0,0 +1,80 @@
+//
+// PROJECT:         Aspia
+// FILE:            network/token_bucket.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "network/token_bucket.h"
+
+namespace aspia {
+
+namespace {
+
+// The bucket always holds at least one TCP segment, so the slow links are not split into
+// the tiny writes.
+constexpr qint64 kMinBurst = 1500;
+
+} // namespace
+
+TokenBucket::TokenBucket(qint64 rate, qint64 burst)
+    : rate_(qMax<qint64>(rate, 1)),
+      burst_(qMax(burst ? burst : rate_ * kDefaultBurstTime.count() / 1000, kMinBurst)),
+      tokens_(burst_),
+      refill_time_(Clock::now())
+{
+    // Nothing
+}
+
+qint64 TokenBucket::available()
+{
+    std::scoped_lock<std::mutex> lock(lock_);
+    refill();
+    return qMax<qint64>(tokens_, 0);
+}
+
+void TokenBucket::consume(qint64 size)
+{
+    std::scoped_lock<std::mutex> lock(lock_);
+    refill();
+    tokens_ -= size;
+}
+
+std::chrono::milliseconds TokenBucket::delay(qint64 size)
+{
+    std::scoped_lock<std::mutex> lock(lock_);
+    refill();
+
+    const qint64 missing = qMin(size, burst_) - tokens_;
+    if (missing <= 0)
+        return std::chrono::milliseconds(0);
+
+    // Rounded up, so the data is available when the time expires.
+    return std::chrono::milliseconds((missing * 1000 + rate_ - 1) / rate_);
+}
+
+void TokenBucket::refill()
+{
+    const Clock::time_point now = Clock::now();
+    const qint64 elapsed =
+        std::chrono::duration_cast<std::chrono::microseconds>(now - refill_time_).count();
+
+    // The bucket is full after the idle time (the product below would overflow).
+    if (elapsed >= (burst_ - tokens_) * 1000000 / rate_ + 1000000)
+    {
+        tokens_ = burst_;
+        refill_time_ = now;
+        return;
+    }
+
+    const qint64 tokens = elapsed * rate_ / 1000000;
+    if (tokens <= 0)
+        return;
+
+    tokens_ = qMin(tokens_ + tokens, burst_);
+
+    // The remainder of the time is kept, so the slow rates are not lost by the rounding.
+    refill_time_ += std::chrono::microseconds(tokens * 1000000 / rate_);
+}
+
+} // namespace aspia
@@ -0,0 +1,67 @@
+//
+// PROJECT:         Aspia
+// FILE:            network/token_bucket.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_NETWORK__TOKEN_BUCKET_H
+#define _ASPIA_NETWORK__TOKEN_BUCKET_H
+
+#include <QtGlobal>
+
+#include <chrono>
+#include <mutex>
+
+namespace aspia {
+
+//
+// Limits the rate of the data. The bucket is filled with |rate| bytes per second up to |burst|
+// bytes, and the sent data is taken from it. The bucket may be shared by the channels of the
+// different threads, so the channels may take a little more than is available together; the
+// debt is paid before the next data is allowed.
+//
+class TokenBucket
+{
+public:
+    // |rate| is in bytes per second. If |burst| is 0, then the bucket holds the data of
+    // kDefaultBurstTime.
+    explicit TokenBucket(qint64 rate, qint64 burst = 0);
+    ~TokenBucket() = default;
+
+    static constexpr std::chrono::milliseconds kDefaultBurstTime{ 100 };
+
+    qint64 rate() const { return rate_; }
+
+    // Converts the rate in kbit/s into bytes per second.
+    static qint64 kbpsToRate(int kbps) { return static_cast<qint64>(kbps) * 1000 / 8; }
+
+    // Returns the number of bytes which may be sent now.
+    qint64 available();
+
+    // Takes |size| sent bytes from the bucket.
+    void consume(qint64 size);
+
+    // Returns the time after which |size| bytes are available (at most the time of the
+    // burst).
+    std::chrono::milliseconds delay(qint64 size);
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    // Must be called with |lock_| held.
+    void refill();
+
+    const qint64 rate_;
+    const qint64 burst_;
+
+    std::mutex lock_;
+    qint64 tokens_;
+    Clock::time_point refill_time_;
+
+    Q_DISABLE_COPY(TokenBucket)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_NETWORK__TOKEN_BUCKET_H
@@ -5,140 +5,133 @@
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/port.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/io/zero_copy_stream_impl_lite.h>
-// This is a temporary google only hack
-#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-#include "third_party/protobuf/version.h"
-#endif
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-namespace protobuf_address_5fbook_2eproto {
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_address_5fbook_2eproto ::google::protobuf::internal::SCCInfo<1> scc_info_Computer;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_address_5fbook_2eproto ::google::protobuf::internal::SCCInfo<1> scc_info_ComputerGroup;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_address_5fbook_2eproto ::google::protobuf::internal::SCCInfo<1> scc_info_SessionConfig;
-}  // namespace protobuf_address_5fbook_2eproto
-namespace protobuf_desktop_5fsession_2eproto {
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_desktop_5fsession_2eproto ::google::protobuf::internal::SCCInfo<1> scc_info_Config;
-}  // namespace protobuf_desktop_5fsession_2eproto
 namespace aspia {
 namespace proto {
 namespace address_book {
-class SessionConfigDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<SessionConfig>
-      _instance;
-} _SessionConfig_default_instance_;
-class ComputerDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<Computer>
-      _instance;
-} _Computer_default_instance_;
-class ComputerGroupDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<ComputerGroup>
-      _instance;
-} _ComputerGroup_default_instance_;
-class DataDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<Data>
-      _instance;
-} _Data_default_instance_;
-class FileDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<File>
-      _instance;
-} _File_default_instance_;
+PROTOBUF_CONSTEXPR SessionConfig::SessionConfig(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.desktop_manage_)*/nullptr
+  , /*decltype(_impl_.desktop_view_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SessionConfigDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SessionConfigDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SessionConfigDefaultTypeInternal() {}
+  union {
+    SessionConfig _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SessionConfigDefaultTypeInternal _SessionConfig_default_instance_;
+PROTOBUF_CONSTEXPR StreamingProfile::StreamingProfile(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.pixel_format_)*/nullptr
+  , /*decltype(_impl_.update_time_)*/int64_t{0}
+  , /*decltype(_impl_.video_encoding_)*/0
+  , /*decltype(_impl_.compress_ratio_)*/0u
+  , /*decltype(_impl_.min_round_trip_time_)*/int64_t{0}
+  , /*decltype(_impl_.bitrate_)*/0u
+  , /*decltype(_impl_.upgrade_samples_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StreamingProfileDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StreamingProfileDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StreamingProfileDefaultTypeInternal() {}
+  union {
+    StreamingProfile _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StreamingProfileDefaultTypeInternal _StreamingProfile_default_instance_;
+PROTOBUF_CONSTEXPR Computer::Computer(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.alternate_addresses_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.comment_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.address_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.password_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.session_config_)*/nullptr
+  , /*decltype(_impl_.streaming_profile_)*/nullptr
+  , /*decltype(_impl_.create_time_)*/int64_t{0}
+  , /*decltype(_impl_.modify_time_)*/int64_t{0}
+  , /*decltype(_impl_.connect_time_)*/int64_t{0}
+  , /*decltype(_impl_.port_)*/0u
+  , /*decltype(_impl_.session_type_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ComputerDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ComputerDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ComputerDefaultTypeInternal() {}
+  union {
+    Computer _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ComputerDefaultTypeInternal _Computer_default_instance_;
+PROTOBUF_CONSTEXPR ComputerGroup::ComputerGroup(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.computer_)*/{}
+  , /*decltype(_impl_.computer_group_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.comment_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.create_time_)*/int64_t{0}
+  , /*decltype(_impl_.modify_time_)*/int64_t{0}
+  , /*decltype(_impl_.expanded_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ComputerGroupDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ComputerGroupDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ComputerGroupDefaultTypeInternal() {}
+  union {
+    ComputerGroup _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ComputerGroupDefaultTypeInternal _ComputerGroup_default_instance_;
+PROTOBUF_CONSTEXPR Data::Data(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.salt1_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.salt2_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.root_group_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DataDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DataDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DataDefaultTypeInternal() {}
+  union {
+    Data _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DataDefaultTypeInternal _Data_default_instance_;
+PROTOBUF_CONSTEXPR File::File(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.hashing_salt_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.encryption_type_)*/0
+  , /*decltype(_impl_.hashing_rounds_)*/0
+  , /*decltype(_impl_.hashing_memory_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct FileDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FileDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FileDefaultTypeInternal() {}
+  union {
+    File _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FileDefaultTypeInternal _File_default_instance_;
 }  // namespace address_book
 }  // namespace proto
 }  // namespace aspia
-namespace protobuf_address_5fbook_2eproto {
-static void InitDefaultsSessionConfig() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::address_book::_SessionConfig_default_instance_;
-    new (ptr) ::aspia::proto::address_book::SessionConfig();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::address_book::SessionConfig::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<1> scc_info_SessionConfig =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsSessionConfig}, {
-      &protobuf_desktop_5fsession_2eproto::scc_info_Config.base,}};
-
-static void InitDefaultsComputer() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::address_book::_Computer_default_instance_;
-    new (ptr) ::aspia::proto::address_book::Computer();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::address_book::Computer::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<1> scc_info_Computer =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsComputer}, {
-      &protobuf_address_5fbook_2eproto::scc_info_SessionConfig.base,}};
-
-static void InitDefaultsComputerGroup() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::address_book::_ComputerGroup_default_instance_;
-    new (ptr) ::aspia::proto::address_book::ComputerGroup();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::address_book::ComputerGroup::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<1> scc_info_ComputerGroup =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsComputerGroup}, {
-      &protobuf_address_5fbook_2eproto::scc_info_Computer.base,}};
-
-static void InitDefaultsData() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::address_book::_Data_default_instance_;
-    new (ptr) ::aspia::proto::address_book::Data();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::address_book::Data::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<1> scc_info_Data =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsData}, {
-      &protobuf_address_5fbook_2eproto::scc_info_ComputerGroup.base,}};
-
-static void InitDefaultsFile() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::address_book::_File_default_instance_;
-    new (ptr) ::aspia::proto::address_book::File();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::address_book::File::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_File =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsFile}, {}};
-
-void InitDefaults() {
-  ::google::protobuf::internal::InitSCC(&scc_info_SessionConfig.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_Computer.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_ComputerGroup.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_Data.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_File.base);
-}
-
-}  // namespace protobuf_address_5fbook_2eproto
 namespace aspia {
 namespace proto {
 namespace address_book {
@@ -147,230 +140,285 @@ bool EncryptionType_IsValid(int value) {
     case 0:
     case 1:
     case 2:
+    case 3:
       return true;
     default:
       return false;
   }
 }
 
+static ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> EncryptionType_strings[4] = {};
+
+static const char EncryptionType_names[] =
+  "ENCRYPTION_TYPE_NONE"
+  "ENCRYPTION_TYPE_UNKNOWN"
+  "ENCRYPTION_TYPE_XCHACHA20_POLY1305"
+  "ENCRYPTION_TYPE_XCHACHA20_POLY1305_ARGON2ID";
+
+static const ::PROTOBUF_NAMESPACE_ID::internal::EnumEntry EncryptionType_entries[] = {
+  { {EncryptionType_names + 0, 20}, 1 },
+  { {EncryptionType_names + 20, 23}, 0 },
+  { {EncryptionType_names + 43, 34}, 2 },
+  { {EncryptionType_names + 77, 43}, 3 },
+};
+
+static const int EncryptionType_entries_by_number[] = {
+  1, // 0 -> ENCRYPTION_TYPE_UNKNOWN
+  0, // 1 -> ENCRYPTION_TYPE_NONE
+  2, // 2 -> ENCRYPTION_TYPE_XCHACHA20_POLY1305
+  3, // 3 -> ENCRYPTION_TYPE_XCHACHA20_POLY1305_ARGON2ID
+};
+
+const std::string& EncryptionType_Name(
+    EncryptionType value) {
+  static const bool dummy =
+      ::PROTOBUF_NAMESPACE_ID::internal::InitializeEnumStrings(
+          EncryptionType_entries,
+          EncryptionType_entries_by_number,
+          4, EncryptionType_strings);
+  (void) dummy;
+  int idx = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumName(
+      EncryptionType_entries,
+      EncryptionType_entries_by_number,
+      4, value);
+  return idx == -1 ? ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString() :
+                     EncryptionType_strings[idx].get();
+}
+bool EncryptionType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, EncryptionType* value) {
+  int int_value;
+  bool success = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumValue(
+      EncryptionType_entries, 4, name, &int_value);
+  if (success) {
+    *value = static_cast<EncryptionType>(int_value);
+  }
+  return success;
+}
 
 // ===================================================================
 
-void SessionConfig::InitAsDefaultInstance() {
-  ::aspia::proto::address_book::_SessionConfig_default_instance_._instance.get_mutable()->desktop_manage_ = const_cast< ::aspia::proto::desktop::Config*>(
-      ::aspia::proto::desktop::Config::internal_default_instance());
-  ::aspia::proto::address_book::_SessionConfig_default_instance_._instance.get_mutable()->desktop_view_ = const_cast< ::aspia::proto::desktop::Config*>(
-      ::aspia::proto::desktop::Config::internal_default_instance());
+class SessionConfig::_Internal {
+ public:
+  static const ::aspia::proto::desktop::Config& desktop_manage(const SessionConfig* msg);
+  static const ::aspia::proto::desktop::Config& desktop_view(const SessionConfig* msg);
+};
+
+const ::aspia::proto::desktop::Config&
+SessionConfig::_Internal::desktop_manage(const SessionConfig* msg) {
+  return *msg->_impl_.desktop_manage_;
+}
+const ::aspia::proto::desktop::Config&
+SessionConfig::_Internal::desktop_view(const SessionConfig* msg) {
+  return *msg->_impl_.desktop_view_;
 }
 void SessionConfig::clear_desktop_manage() {
-  if (GetArenaNoVirtual() == NULL && desktop_manage_ != NULL) {
-    delete desktop_manage_;
+  if (GetArenaForAllocation() == nullptr && _impl_.desktop_manage_ != nullptr) {
+    delete _impl_.desktop_manage_;
   }
-  desktop_manage_ = NULL;
+  _impl_.desktop_manage_ = nullptr;
 }
 void SessionConfig::clear_desktop_view() {
-  if (GetArenaNoVirtual() == NULL && desktop_view_ != NULL) {
-    delete desktop_view_;
+  if (GetArenaForAllocation() == nullptr && _impl_.desktop_view_ != nullptr) {
+    delete _impl_.desktop_view_;
   }
-  desktop_view_ = NULL;
+  _impl_.desktop_view_ = nullptr;
 }
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int SessionConfig::kDesktopManageFieldNumber;
-const int SessionConfig::kDesktopViewFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-SessionConfig::SessionConfig()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_address_5fbook_2eproto::scc_info_SessionConfig.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.address_book.SessionConfig)
+SessionConfig::SessionConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.address_book.SessionConfig)
 }
 SessionConfig::SessionConfig(const SessionConfig& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.has_desktop_manage()) {
-    desktop_manage_ = new ::aspia::proto::desktop::Config(*from.desktop_manage_);
-  } else {
-    desktop_manage_ = NULL;
-  }
-  if (from.has_desktop_view()) {
-    desktop_view_ = new ::aspia::proto::desktop::Config(*from.desktop_view_);
-  } else {
-    desktop_view_ = NULL;
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  SessionConfig* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.desktop_manage_){nullptr}
+    , decltype(_impl_.desktop_view_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  if (from._internal_has_desktop_manage()) {
+    _this->_impl_.desktop_manage_ = new ::aspia::proto::desktop::Config(*from._impl_.desktop_manage_);
+  }
+  if (from._internal_has_desktop_view()) {
+    _this->_impl_.desktop_view_ = new ::aspia::proto::desktop::Config(*from._impl_.desktop_view_);
   }
   // @@protoc_insertion_point(copy_constructor:aspia.proto.address_book.SessionConfig)
 }
 
-void SessionConfig::SharedCtor() {
-  ::memset(&desktop_manage_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&desktop_view_) -
-      reinterpret_cast<char*>(&desktop_manage_)) + sizeof(desktop_view_));
+inline void SessionConfig::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.desktop_manage_){nullptr}
+    , decltype(_impl_.desktop_view_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 SessionConfig::~SessionConfig() {
   // @@protoc_insertion_point(destructor:aspia.proto.address_book.SessionConfig)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void SessionConfig::SharedDtor() {
-  if (this != internal_default_instance()) delete desktop_manage_;
-  if (this != internal_default_instance()) delete desktop_view_;
+inline void SessionConfig::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.desktop_manage_;
+  if (this != internal_default_instance()) delete _impl_.desktop_view_;
 }
 
 void SessionConfig::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const SessionConfig& SessionConfig::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_address_5fbook_2eproto::scc_info_SessionConfig.base);
-  return *internal_default_instance();
-}
-
 
 void SessionConfig::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.address_book.SessionConfig)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaNoVirtual() == NULL && desktop_manage_ != NULL) {
-    delete desktop_manage_;
-  }
-  desktop_manage_ = NULL;
-  if (GetArenaNoVirtual() == NULL && desktop_view_ != NULL) {
-    delete desktop_view_;
-  }
-  desktop_view_ = NULL;
-  _internal_metadata_.Clear();
-}
-
-bool SessionConfig::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.address_book.SessionConfig)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  if (GetArenaForAllocation() == nullptr && _impl_.desktop_manage_ != nullptr) {
+    delete _impl_.desktop_manage_;
+  }
+  _impl_.desktop_manage_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.desktop_view_ != nullptr) {
+    delete _impl_.desktop_view_;
+  }
+  _impl_.desktop_view_ = nullptr;
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* SessionConfig::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // .aspia.proto.desktop.Config desktop_manage = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_desktop_manage()));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_desktop_manage(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .aspia.proto.desktop.Config desktop_view = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_desktop_view()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_desktop_view(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.address_book.SessionConfig)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.address_book.SessionConfig)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void SessionConfig::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.address_book.SessionConfig)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* SessionConfig::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.address_book.SessionConfig)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .aspia.proto.desktop.Config desktop_manage = 1;
-  if (this->has_desktop_manage()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      1, this->_internal_desktop_manage(), output);
+  if (this->_internal_has_desktop_manage()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::desktop_manage(this),
+        _Internal::desktop_manage(this).GetCachedSize(), target, stream);
   }
 
   // .aspia.proto.desktop.Config desktop_view = 2;
-  if (this->has_desktop_view()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      2, this->_internal_desktop_view(), output);
+  if (this->_internal_has_desktop_view()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::desktop_view(this),
+        _Internal::desktop_view(this).GetCachedSize(), target, stream);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.address_book.SessionConfig)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.address_book.SessionConfig)
+  return target;
 }
 
 size_t SessionConfig::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.address_book.SessionConfig)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // .aspia.proto.desktop.Config desktop_manage = 1;
-  if (this->has_desktop_manage()) {
+  if (this->_internal_has_desktop_manage()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *desktop_manage_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.desktop_manage_);
   }
 
   // .aspia.proto.desktop.Config desktop_view = 2;
-  if (this->has_desktop_view()) {
+  if (this->_internal_has_desktop_view()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *desktop_view_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.desktop_view_);
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void SessionConfig::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const SessionConfig*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const SessionConfig*>(
+      &from));
 }
 
 void SessionConfig::MergeFrom(const SessionConfig& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.address_book.SessionConfig)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  SessionConfig* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.address_book.SessionConfig)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.has_desktop_manage()) {
-    mutable_desktop_manage()->::aspia::proto::desktop::Config::MergeFrom(from.desktop_manage());
+  if (from._internal_has_desktop_manage()) {
+    _this->_internal_mutable_desktop_manage()->::aspia::proto::desktop::Config::MergeFrom(
+        from._internal_desktop_manage());
   }
-  if (from.has_desktop_view()) {
-    mutable_desktop_view()->::aspia::proto::desktop::Config::MergeFrom(from.desktop_view());
+  if (from._internal_has_desktop_view()) {
+    _this->_internal_mutable_desktop_view()->::aspia::proto::desktop::Config::MergeFrom(
+        from._internal_desktop_view());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void SessionConfig::CopyFrom(const SessionConfig& from) {
@@ -384,568 +432,990 @@ bool SessionConfig::IsInitialized() const {
   return true;
 }
 
-void SessionConfig::Swap(SessionConfig* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void SessionConfig::InternalSwap(SessionConfig* other) {
   using std::swap;
-  swap(desktop_manage_, other->desktop_manage_);
-  swap(desktop_view_, other->desktop_view_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SessionConfig, _impl_.desktop_view_)
+      + sizeof(SessionConfig::_impl_.desktop_view_)
+      - PROTOBUF_FIELD_OFFSET(SessionConfig, _impl_.desktop_manage_)>(
+          reinterpret_cast<char*>(&_impl_.desktop_manage_),
+          reinterpret_cast<char*>(&other->_impl_.desktop_manage_));
 }
 
-::std::string SessionConfig::GetTypeName() const {
+std::string SessionConfig::GetTypeName() const {
   return "aspia.proto.address_book.SessionConfig";
 }
 
 
 // ===================================================================
 
-void Computer::InitAsDefaultInstance() {
-  ::aspia::proto::address_book::_Computer_default_instance_._instance.get_mutable()->session_config_ = const_cast< ::aspia::proto::address_book::SessionConfig*>(
-      ::aspia::proto::address_book::SessionConfig::internal_default_instance());
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Computer::kCreateTimeFieldNumber;
-const int Computer::kModifyTimeFieldNumber;
-const int Computer::kConnectTimeFieldNumber;
-const int Computer::kNameFieldNumber;
-const int Computer::kCommentFieldNumber;
-const int Computer::kAddressFieldNumber;
-const int Computer::kPortFieldNumber;
-const int Computer::kUsernameFieldNumber;
-const int Computer::kPasswordFieldNumber;
-const int Computer::kSessionTypeFieldNumber;
-const int Computer::kSessionConfigFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-Computer::Computer()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_address_5fbook_2eproto::scc_info_Computer.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.address_book.Computer)
+class StreamingProfile::_Internal {
+ public:
+  static const ::aspia::proto::desktop::PixelFormat& pixel_format(const StreamingProfile* msg);
+};
+
+const ::aspia::proto::desktop::PixelFormat&
+StreamingProfile::_Internal::pixel_format(const StreamingProfile* msg) {
+  return *msg->_impl_.pixel_format_;
+}
+void StreamingProfile::clear_pixel_format() {
+  if (GetArenaForAllocation() == nullptr && _impl_.pixel_format_ != nullptr) {
+    delete _impl_.pixel_format_;
+  }
+  _impl_.pixel_format_ = nullptr;
+}
+StreamingProfile::StreamingProfile(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.address_book.StreamingProfile)
+}
+StreamingProfile::StreamingProfile(const StreamingProfile& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  StreamingProfile* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.pixel_format_){nullptr}
+    , decltype(_impl_.update_time_){}
+    , decltype(_impl_.video_encoding_){}
+    , decltype(_impl_.compress_ratio_){}
+    , decltype(_impl_.min_round_trip_time_){}
+    , decltype(_impl_.bitrate_){}
+    , decltype(_impl_.upgrade_samples_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  if (from._internal_has_pixel_format()) {
+    _this->_impl_.pixel_format_ = new ::aspia::proto::desktop::PixelFormat(*from._impl_.pixel_format_);
+  }
+  ::memcpy(&_impl_.update_time_, &from._impl_.update_time_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.upgrade_samples_) -
+    reinterpret_cast<char*>(&_impl_.update_time_)) + sizeof(_impl_.upgrade_samples_));
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.address_book.StreamingProfile)
+}
+
+inline void StreamingProfile::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.pixel_format_){nullptr}
+    , decltype(_impl_.update_time_){int64_t{0}}
+    , decltype(_impl_.video_encoding_){0}
+    , decltype(_impl_.compress_ratio_){0u}
+    , decltype(_impl_.min_round_trip_time_){int64_t{0}}
+    , decltype(_impl_.bitrate_){0u}
+    , decltype(_impl_.upgrade_samples_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+StreamingProfile::~StreamingProfile() {
+  // @@protoc_insertion_point(destructor:aspia.proto.address_book.StreamingProfile)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StreamingProfile::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.pixel_format_;
+}
+
+void StreamingProfile::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StreamingProfile::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.address_book.StreamingProfile)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.pixel_format_ != nullptr) {
+    delete _impl_.pixel_format_;
+  }
+  _impl_.pixel_format_ = nullptr;
+  ::memset(&_impl_.update_time_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.upgrade_samples_) -
+      reinterpret_cast<char*>(&_impl_.update_time_)) + sizeof(_impl_.upgrade_samples_));
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* StreamingProfile::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int64 update_time = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.update_time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .aspia.proto.desktop.VideoEncoding video_encoding = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_video_encoding(static_cast<::aspia::proto::desktop::VideoEncoding>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .aspia.proto.desktop.PixelFormat pixel_format = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_pixel_format(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 compress_ratio = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.compress_ratio_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 bitrate = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.bitrate_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 min_round_trip_time = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.min_round_trip_time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 upgrade_samples = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.upgrade_samples_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StreamingProfile::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.address_book.StreamingProfile)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int64 update_time = 1;
+  if (this->_internal_update_time() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_update_time(), target);
+  }
+
+  // .aspia.proto.desktop.VideoEncoding video_encoding = 2;
+  if (this->_internal_video_encoding() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_video_encoding(), target);
+  }
+
+  // .aspia.proto.desktop.PixelFormat pixel_format = 3;
+  if (this->_internal_has_pixel_format()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::pixel_format(this),
+        _Internal::pixel_format(this).GetCachedSize(), target, stream);
+  }
+
+  // uint32 compress_ratio = 4;
+  if (this->_internal_compress_ratio() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_compress_ratio(), target);
+  }
+
+  // uint32 bitrate = 5;
+  if (this->_internal_bitrate() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_bitrate(), target);
+  }
+
+  // int64 min_round_trip_time = 6;
+  if (this->_internal_min_round_trip_time() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(6, this->_internal_min_round_trip_time(), target);
+  }
+
+  // int32 upgrade_samples = 7;
+  if (this->_internal_upgrade_samples() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_upgrade_samples(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.address_book.StreamingProfile)
+  return target;
+}
+
+size_t StreamingProfile::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.address_book.StreamingProfile)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .aspia.proto.desktop.PixelFormat pixel_format = 3;
+  if (this->_internal_has_pixel_format()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.pixel_format_);
+  }
+
+  // int64 update_time = 1;
+  if (this->_internal_update_time() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_update_time());
+  }
+
+  // .aspia.proto.desktop.VideoEncoding video_encoding = 2;
+  if (this->_internal_video_encoding() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_video_encoding());
+  }
+
+  // uint32 compress_ratio = 4;
+  if (this->_internal_compress_ratio() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_compress_ratio());
+  }
+
+  // int64 min_round_trip_time = 6;
+  if (this->_internal_min_round_trip_time() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_min_round_trip_time());
+  }
+
+  // uint32 bitrate = 5;
+  if (this->_internal_bitrate() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_bitrate());
+  }
+
+  // int32 upgrade_samples = 7;
+  if (this->_internal_upgrade_samples() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_upgrade_samples());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void StreamingProfile::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const StreamingProfile*>(
+      &from));
+}
+
+void StreamingProfile::MergeFrom(const StreamingProfile& from) {
+  StreamingProfile* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.address_book.StreamingProfile)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_pixel_format()) {
+    _this->_internal_mutable_pixel_format()->::aspia::proto::desktop::PixelFormat::MergeFrom(
+        from._internal_pixel_format());
+  }
+  if (from._internal_update_time() != 0) {
+    _this->_internal_set_update_time(from._internal_update_time());
+  }
+  if (from._internal_video_encoding() != 0) {
+    _this->_internal_set_video_encoding(from._internal_video_encoding());
+  }
+  if (from._internal_compress_ratio() != 0) {
+    _this->_internal_set_compress_ratio(from._internal_compress_ratio());
+  }
+  if (from._internal_min_round_trip_time() != 0) {
+    _this->_internal_set_min_round_trip_time(from._internal_min_round_trip_time());
+  }
+  if (from._internal_bitrate() != 0) {
+    _this->_internal_set_bitrate(from._internal_bitrate());
+  }
+  if (from._internal_upgrade_samples() != 0) {
+    _this->_internal_set_upgrade_samples(from._internal_upgrade_samples());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void StreamingProfile::CopyFrom(const StreamingProfile& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.address_book.StreamingProfile)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StreamingProfile::IsInitialized() const {
+  return true;
+}
+
+void StreamingProfile::InternalSwap(StreamingProfile* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StreamingProfile, _impl_.upgrade_samples_)
+      + sizeof(StreamingProfile::_impl_.upgrade_samples_)
+      - PROTOBUF_FIELD_OFFSET(StreamingProfile, _impl_.pixel_format_)>(
+          reinterpret_cast<char*>(&_impl_.pixel_format_),
+          reinterpret_cast<char*>(&other->_impl_.pixel_format_));
+}
+
+std::string StreamingProfile::GetTypeName() const {
+  return "aspia.proto.address_book.StreamingProfile";
+}
+
+
+// ===================================================================
+
+class Computer::_Internal {
+ public:
+  static const ::aspia::proto::address_book::SessionConfig& session_config(const Computer* msg);
+  static const ::aspia::proto::address_book::StreamingProfile& streaming_profile(const Computer* msg);
+};
+
+const ::aspia::proto::address_book::SessionConfig&
+Computer::_Internal::session_config(const Computer* msg) {
+  return *msg->_impl_.session_config_;
+}
+const ::aspia::proto::address_book::StreamingProfile&
+Computer::_Internal::streaming_profile(const Computer* msg) {
+  return *msg->_impl_.streaming_profile_;
+}
+Computer::Computer(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.address_book.Computer)
 }
 Computer::Computer(const Computer& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.name().size() > 0) {
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
-  }
-  comment_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.comment().size() > 0) {
-    comment_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.comment_);
-  }
-  address_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.address().size() > 0) {
-    address_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.address_);
-  }
-  username_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.username().size() > 0) {
-    username_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.username_);
-  }
-  password_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.password().size() > 0) {
-    password_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.password_);
-  }
-  if (from.has_session_config()) {
-    session_config_ = new ::aspia::proto::address_book::SessionConfig(*from.session_config_);
-  } else {
-    session_config_ = NULL;
-  }
-  ::memcpy(&create_time_, &from.create_time_,
-    static_cast<size_t>(reinterpret_cast<char*>(&session_type_) -
-    reinterpret_cast<char*>(&create_time_)) + sizeof(session_type_));
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  Computer* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.alternate_addresses_){from._impl_.alternate_addresses_}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.comment_){}
+    , decltype(_impl_.address_){}
+    , decltype(_impl_.username_){}
+    , decltype(_impl_.password_){}
+    , decltype(_impl_.session_config_){nullptr}
+    , decltype(_impl_.streaming_profile_){nullptr}
+    , decltype(_impl_.create_time_){}
+    , decltype(_impl_.modify_time_){}
+    , decltype(_impl_.connect_time_){}
+    , decltype(_impl_.port_){}
+    , decltype(_impl_.session_type_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.comment_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.comment_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_comment().empty()) {
+    _this->_impl_.comment_.Set(from._internal_comment(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.address_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.address_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_address().empty()) {
+    _this->_impl_.address_.Set(from._internal_address(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_username().empty()) {
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.password_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.password_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_password().empty()) {
+    _this->_impl_.password_.Set(from._internal_password(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_session_config()) {
+    _this->_impl_.session_config_ = new ::aspia::proto::address_book::SessionConfig(*from._impl_.session_config_);
+  }
+  if (from._internal_has_streaming_profile()) {
+    _this->_impl_.streaming_profile_ = new ::aspia::proto::address_book::StreamingProfile(*from._impl_.streaming_profile_);
+  }
+  ::memcpy(&_impl_.create_time_, &from._impl_.create_time_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.session_type_) -
+    reinterpret_cast<char*>(&_impl_.create_time_)) + sizeof(_impl_.session_type_));
   // @@protoc_insertion_point(copy_constructor:aspia.proto.address_book.Computer)
 }
 
-void Computer::SharedCtor() {
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  comment_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  address_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  username_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  password_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&session_config_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&session_type_) -
-      reinterpret_cast<char*>(&session_config_)) + sizeof(session_type_));
+inline void Computer::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.alternate_addresses_){arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.comment_){}
+    , decltype(_impl_.address_){}
+    , decltype(_impl_.username_){}
+    , decltype(_impl_.password_){}
+    , decltype(_impl_.session_config_){nullptr}
+    , decltype(_impl_.streaming_profile_){nullptr}
+    , decltype(_impl_.create_time_){int64_t{0}}
+    , decltype(_impl_.modify_time_){int64_t{0}}
+    , decltype(_impl_.connect_time_){int64_t{0}}
+    , decltype(_impl_.port_){0u}
+    , decltype(_impl_.session_type_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.comment_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.comment_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.address_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.address_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.password_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.password_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Computer::~Computer() {
   // @@protoc_insertion_point(destructor:aspia.proto.address_book.Computer)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Computer::SharedDtor() {
-  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  comment_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  address_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  username_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  password_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete session_config_;
+inline void Computer::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.alternate_addresses_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
+  _impl_.comment_.Destroy();
+  _impl_.address_.Destroy();
+  _impl_.username_.Destroy();
+  _impl_.password_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.session_config_;
+  if (this != internal_default_instance()) delete _impl_.streaming_profile_;
 }
 
 void Computer::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Computer& Computer::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_address_5fbook_2eproto::scc_info_Computer.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void Computer::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.address_book.Computer)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  comment_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  address_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  username_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  password_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (GetArenaNoVirtual() == NULL && session_config_ != NULL) {
-    delete session_config_;
-  }
-  session_config_ = NULL;
-  ::memset(&create_time_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&session_type_) -
-      reinterpret_cast<char*>(&create_time_)) + sizeof(session_type_));
-  _internal_metadata_.Clear();
-}
-
-bool Computer::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.address_book.Computer)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(16383u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.alternate_addresses_.Clear();
+  _impl_.name_.ClearToEmpty();
+  _impl_.comment_.ClearToEmpty();
+  _impl_.address_.ClearToEmpty();
+  _impl_.username_.ClearToEmpty();
+  _impl_.password_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.session_config_ != nullptr) {
+    delete _impl_.session_config_;
+  }
+  _impl_.session_config_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.streaming_profile_ != nullptr) {
+    delete _impl_.streaming_profile_;
+  }
+  _impl_.streaming_profile_ = nullptr;
+  ::memset(&_impl_.create_time_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.session_type_) -
+      reinterpret_cast<char*>(&_impl_.create_time_)) + sizeof(_impl_.session_type_));
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* Computer::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // int64 create_time = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &create_time_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.create_time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // int64 modify_time = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &modify_time_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.modify_time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // int64 connect_time = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &connect_time_)));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.connect_time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string name = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->name().data(), static_cast<int>(this->name().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "aspia.proto.address_book.Computer.name"));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string comment = 5;
-      case 5: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(42u /* 42 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_comment()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->comment().data(), static_cast<int>(this->comment().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "aspia.proto.address_book.Computer.comment"));
-        } else {
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_comment();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string address = 6;
-      case 6: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(50u /* 50 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_address()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->address().data(), static_cast<int>(this->address().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "aspia.proto.address_book.Computer.address"));
-        } else {
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_address();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint32 port = 7;
-      case 7: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(56u /* 56 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &port_)));
-        } else {
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.port_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string username = 8;
-      case 8: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(66u /* 66 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_username()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->username().data(), static_cast<int>(this->username().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "aspia.proto.address_book.Computer.username"));
-        } else {
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          auto str = _internal_mutable_username();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string password = 9;
-      case 9: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(74u /* 74 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_password()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->password().data(), static_cast<int>(this->password().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "aspia.proto.address_book.Computer.password"));
-        } else {
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          auto str = _internal_mutable_password();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .aspia.proto.auth.SessionType session_type = 16;
-      case 16: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(128u /* 128 & 0xFF */)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_session_type(static_cast< ::aspia::proto::auth::SessionType >(value));
-        } else {
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 128)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_session_type(static_cast<::aspia::proto::auth::SessionType>(val));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .aspia.proto.address_book.SessionConfig session_config = 17;
-      case 17: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(138u /* 138 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_session_config()));
-        } else {
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 138)) {
+          ptr = ctx->ParseMessage(_internal_mutable_session_config(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string alternate_addresses = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 146)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            auto str = _internal_add_alternate_addresses();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, nullptr));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<146>(ptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+        continue;
+      // .aspia.proto.address_book.StreamingProfile streaming_profile = 19;
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 154)) {
+          ptr = ctx->ParseMessage(_internal_mutable_streaming_profile(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.address_book.Computer)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.address_book.Computer)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void Computer::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.address_book.Computer)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* Computer::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.address_book.Computer)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // int64 create_time = 1;
-  if (this->create_time() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(1, this->create_time(), output);
+  if (this->_internal_create_time() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_create_time(), target);
   }
 
   // int64 modify_time = 2;
-  if (this->modify_time() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(2, this->modify_time(), output);
+  if (this->_internal_modify_time() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_modify_time(), target);
   }
 
   // int64 connect_time = 3;
-  if (this->connect_time() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(3, this->connect_time(), output);
+  if (this->_internal_connect_time() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_connect_time(), target);
   }
 
   // string name = 4;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), static_cast<int>(this->name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "aspia.proto.address_book.Computer.name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      4, this->name(), output);
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_name(), target);
   }
 
   // string comment = 5;
-  if (this->comment().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->comment().data(), static_cast<int>(this->comment().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_comment().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_comment().data(), static_cast<int>(this->_internal_comment().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "aspia.proto.address_book.Computer.comment");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      5, this->comment(), output);
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_comment(), target);
   }
 
   // string address = 6;
-  if (this->address().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->address().data(), static_cast<int>(this->address().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_address().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_address().data(), static_cast<int>(this->_internal_address().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "aspia.proto.address_book.Computer.address");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      6, this->address(), output);
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_address(), target);
   }
 
   // uint32 port = 7;
-  if (this->port() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(7, this->port(), output);
+  if (this->_internal_port() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_port(), target);
   }
 
   // string username = 8;
-  if (this->username().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->username().data(), static_cast<int>(this->username().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_username().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "aspia.proto.address_book.Computer.username");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      8, this->username(), output);
+    target = stream->WriteStringMaybeAliased(
+        8, this->_internal_username(), target);
   }
 
   // string password = 9;
-  if (this->password().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->password().data(), static_cast<int>(this->password().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_password().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_password().data(), static_cast<int>(this->_internal_password().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "aspia.proto.address_book.Computer.password");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      9, this->password(), output);
+    target = stream->WriteStringMaybeAliased(
+        9, this->_internal_password(), target);
   }
 
   // .aspia.proto.auth.SessionType session_type = 16;
-  if (this->session_type() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      16, this->session_type(), output);
+  if (this->_internal_session_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      16, this->_internal_session_type(), target);
   }
 
   // .aspia.proto.address_book.SessionConfig session_config = 17;
-  if (this->has_session_config()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      17, this->_internal_session_config(), output);
+  if (this->_internal_has_session_config()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(17, _Internal::session_config(this),
+        _Internal::session_config(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated string alternate_addresses = 18;
+  for (int i = 0, n = this->_internal_alternate_addresses_size(); i < n; i++) {
+    const auto& s = this->_internal_alternate_addresses(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "aspia.proto.address_book.Computer.alternate_addresses");
+    target = stream->WriteString(18, s, target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.address_book.Computer)
+  // .aspia.proto.address_book.StreamingProfile streaming_profile = 19;
+  if (this->_internal_has_streaming_profile()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(19, _Internal::streaming_profile(this),
+        _Internal::streaming_profile(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.address_book.Computer)
+  return target;
 }
 
 size_t Computer::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.address_book.Computer)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string alternate_addresses = 18;
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.alternate_addresses_.size());
+  for (int i = 0, n = _impl_.alternate_addresses_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.alternate_addresses_.Get(i));
+  }
 
   // string name = 4;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->name());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
 
   // string comment = 5;
-  if (this->comment().size() > 0) {
+  if (!this->_internal_comment().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->comment());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_comment());
   }
 
   // string address = 6;
-  if (this->address().size() > 0) {
+  if (!this->_internal_address().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->address());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_address());
   }
 
   // string username = 8;
-  if (this->username().size() > 0) {
+  if (!this->_internal_username().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->username());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_username());
   }
 
   // string password = 9;
-  if (this->password().size() > 0) {
+  if (!this->_internal_password().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->password());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_password());
   }
 
   // .aspia.proto.address_book.SessionConfig session_config = 17;
-  if (this->has_session_config()) {
+  if (this->_internal_has_session_config()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.session_config_);
+  }
+
+  // .aspia.proto.address_book.StreamingProfile streaming_profile = 19;
+  if (this->_internal_has_streaming_profile()) {
     total_size += 2 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *session_config_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.streaming_profile_);
   }
 
   // int64 create_time = 1;
-  if (this->create_time() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int64Size(
-        this->create_time());
+  if (this->_internal_create_time() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_create_time());
   }
 
   // int64 modify_time = 2;
-  if (this->modify_time() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int64Size(
-        this->modify_time());
+  if (this->_internal_modify_time() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_modify_time());
   }
 
   // int64 connect_time = 3;
-  if (this->connect_time() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int64Size(
-        this->connect_time());
+  if (this->_internal_connect_time() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_connect_time());
   }
 
   // uint32 port = 7;
-  if (this->port() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->port());
+  if (this->_internal_port() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_port());
   }
 
   // .aspia.proto.auth.SessionType session_type = 16;
-  if (this->session_type() != 0) {
+  if (this->_internal_session_type() != 0) {
     total_size += 2 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->session_type());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_session_type());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void Computer::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const Computer*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const Computer*>(
+      &from));
 }
 
 void Computer::MergeFrom(const Computer& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.address_book.Computer)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  Computer* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.address_book.Computer)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.name().size() > 0) {
-
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+  _this->_impl_.alternate_addresses_.MergeFrom(from._impl_.alternate_addresses_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
-  if (from.comment().size() > 0) {
-
-    comment_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.comment_);
+  if (!from._internal_comment().empty()) {
+    _this->_internal_set_comment(from._internal_comment());
   }
-  if (from.address().size() > 0) {
-
-    address_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.address_);
+  if (!from._internal_address().empty()) {
+    _this->_internal_set_address(from._internal_address());
   }
-  if (from.username().size() > 0) {
-
-    username_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.username_);
+  if (!from._internal_username().empty()) {
+    _this->_internal_set_username(from._internal_username());
   }
-  if (from.password().size() > 0) {
-
-    password_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.password_);
+  if (!from._internal_password().empty()) {
+    _this->_internal_set_password(from._internal_password());
+  }
+  if (from._internal_has_session_config()) {
+    _this->_internal_mutable_session_config()->::aspia::proto::address_book::SessionConfig::MergeFrom(
+        from._internal_session_config());
   }
-  if (from.has_session_config()) {
-    mutable_session_config()->::aspia::proto::address_book::SessionConfig::MergeFrom(from.session_config());
+  if (from._internal_has_streaming_profile()) {
+    _this->_internal_mutable_streaming_profile()->::aspia::proto::address_book::StreamingProfile::MergeFrom(
+        from._internal_streaming_profile());
   }
-  if (from.create_time() != 0) {
-    set_create_time(from.create_time());
+  if (from._internal_create_time() != 0) {
+    _this->_internal_set_create_time(from._internal_create_time());
   }
-  if (from.modify_time() != 0) {
-    set_modify_time(from.modify_time());
+  if (from._internal_modify_time() != 0) {
+    _this->_internal_set_modify_time(from._internal_modify_time());
   }
-  if (from.connect_time() != 0) {
-    set_connect_time(from.connect_time());
+  if (from._internal_connect_time() != 0) {
+    _this->_internal_set_connect_time(from._internal_connect_time());
   }
-  if (from.port() != 0) {
-    set_port(from.port());
+  if (from._internal_port() != 0) {
+    _this->_internal_set_port(from._internal_port());
   }
-  if (from.session_type() != 0) {
-    set_session_type(from.session_type());
+  if (from._internal_session_type() != 0) {
+    _this->_internal_set_session_type(from._internal_session_type());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void Computer::CopyFrom(const Computer& from) {
@@ -959,415 +1429,411 @@ bool Computer::IsInitialized() const {
   return true;
 }
 
-void Computer::Swap(Computer* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void Computer::InternalSwap(Computer* other) {
   using std::swap;
-  name_.Swap(&other->name_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  comment_.Swap(&other->comment_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  address_.Swap(&other->address_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  username_.Swap(&other->username_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  password_.Swap(&other->password_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(session_config_, other->session_config_);
-  swap(create_time_, other->create_time_);
-  swap(modify_time_, other->modify_time_);
-  swap(connect_time_, other->connect_time_);
-  swap(port_, other->port_);
-  swap(session_type_, other->session_type_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-}
-
-::std::string Computer::GetTypeName() const {
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.alternate_addresses_.InternalSwap(&other->_impl_.alternate_addresses_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.comment_, lhs_arena,
+      &other->_impl_.comment_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.address_, lhs_arena,
+      &other->_impl_.address_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.password_, lhs_arena,
+      &other->_impl_.password_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Computer, _impl_.session_type_)
+      + sizeof(Computer::_impl_.session_type_)
+      - PROTOBUF_FIELD_OFFSET(Computer, _impl_.session_config_)>(
+          reinterpret_cast<char*>(&_impl_.session_config_),
+          reinterpret_cast<char*>(&other->_impl_.session_config_));
+}
+
+std::string Computer::GetTypeName() const {
   return "aspia.proto.address_book.Computer";
 }
 
 
 // ===================================================================
 
-void ComputerGroup::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int ComputerGroup::kCreateTimeFieldNumber;
-const int ComputerGroup::kModifyTimeFieldNumber;
-const int ComputerGroup::kComputerFieldNumber;
-const int ComputerGroup::kComputerGroupFieldNumber;
-const int ComputerGroup::kNameFieldNumber;
-const int ComputerGroup::kCommentFieldNumber;
-const int ComputerGroup::kExpandedFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-ComputerGroup::ComputerGroup()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_address_5fbook_2eproto::scc_info_ComputerGroup.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.address_book.ComputerGroup)
+class ComputerGroup::_Internal {
+ public:
+};
+
+ComputerGroup::ComputerGroup(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.address_book.ComputerGroup)
 }
 ComputerGroup::ComputerGroup(const ComputerGroup& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL),
-      computer_(from.computer_),
-      computer_group_(from.computer_group_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.name().size() > 0) {
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
-  }
-  comment_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.comment().size() > 0) {
-    comment_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.comment_);
-  }
-  ::memcpy(&create_time_, &from.create_time_,
-    static_cast<size_t>(reinterpret_cast<char*>(&expanded_) -
-    reinterpret_cast<char*>(&create_time_)) + sizeof(expanded_));
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  ComputerGroup* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.computer_){from._impl_.computer_}
+    , decltype(_impl_.computer_group_){from._impl_.computer_group_}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.comment_){}
+    , decltype(_impl_.create_time_){}
+    , decltype(_impl_.modify_time_){}
+    , decltype(_impl_.expanded_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.comment_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.comment_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_comment().empty()) {
+    _this->_impl_.comment_.Set(from._internal_comment(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.create_time_, &from._impl_.create_time_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.expanded_) -
+    reinterpret_cast<char*>(&_impl_.create_time_)) + sizeof(_impl_.expanded_));
   // @@protoc_insertion_point(copy_constructor:aspia.proto.address_book.ComputerGroup)
 }
 
-void ComputerGroup::SharedCtor() {
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  comment_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&create_time_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&expanded_) -
-      reinterpret_cast<char*>(&create_time_)) + sizeof(expanded_));
+inline void ComputerGroup::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.computer_){arena}
+    , decltype(_impl_.computer_group_){arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.comment_){}
+    , decltype(_impl_.create_time_){int64_t{0}}
+    , decltype(_impl_.modify_time_){int64_t{0}}
+    , decltype(_impl_.expanded_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.comment_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.comment_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 ComputerGroup::~ComputerGroup() {
   // @@protoc_insertion_point(destructor:aspia.proto.address_book.ComputerGroup)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void ComputerGroup::SharedDtor() {
-  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  comment_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void ComputerGroup::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.computer_.~RepeatedPtrField();
+  _impl_.computer_group_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
+  _impl_.comment_.Destroy();
 }
 
 void ComputerGroup::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const ComputerGroup& ComputerGroup::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_address_5fbook_2eproto::scc_info_ComputerGroup.base);
-  return *internal_default_instance();
-}
-
 
 void ComputerGroup::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.address_book.ComputerGroup)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  computer_.Clear();
-  computer_group_.Clear();
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  comment_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&create_time_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&expanded_) -
-      reinterpret_cast<char*>(&create_time_)) + sizeof(expanded_));
-  _internal_metadata_.Clear();
-}
-
-bool ComputerGroup::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.address_book.ComputerGroup)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.computer_.Clear();
+  _impl_.computer_group_.Clear();
+  _impl_.name_.ClearToEmpty();
+  _impl_.comment_.ClearToEmpty();
+  ::memset(&_impl_.create_time_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.expanded_) -
+      reinterpret_cast<char*>(&_impl_.create_time_)) + sizeof(_impl_.expanded_));
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* ComputerGroup::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // int64 create_time = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &create_time_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.create_time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // int64 modify_time = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &modify_time_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.modify_time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // repeated .aspia.proto.address_book.Computer computer = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-                input, add_computer()));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_computer(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // repeated .aspia.proto.address_book.ComputerGroup computer_group = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-                input, add_computer_group()));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_computer_group(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string name = 5;
-      case 5: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(42u /* 42 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->name().data(), static_cast<int>(this->name().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "aspia.proto.address_book.ComputerGroup.name"));
-        } else {
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string comment = 6;
-      case 6: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(50u /* 50 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_comment()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->comment().data(), static_cast<int>(this->comment().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "aspia.proto.address_book.ComputerGroup.comment"));
-        } else {
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_comment();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // bool expanded = 7;
-      case 7: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(56u /* 56 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &expanded_)));
-        } else {
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.expanded_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.address_book.ComputerGroup)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.address_book.ComputerGroup)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void ComputerGroup::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.address_book.ComputerGroup)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* ComputerGroup::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.address_book.ComputerGroup)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // int64 create_time = 1;
-  if (this->create_time() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(1, this->create_time(), output);
+  if (this->_internal_create_time() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_create_time(), target);
   }
 
   // int64 modify_time = 2;
-  if (this->modify_time() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(2, this->modify_time(), output);
+  if (this->_internal_modify_time() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_modify_time(), target);
   }
 
   // repeated .aspia.proto.address_book.Computer computer = 3;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->computer_size()); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      3,
-      this->computer(static_cast<int>(i)),
-      output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_computer_size()); i < n; i++) {
+    const auto& repfield = this->_internal_computer(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // repeated .aspia.proto.address_book.ComputerGroup computer_group = 4;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->computer_group_size()); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      4,
-      this->computer_group(static_cast<int>(i)),
-      output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_computer_group_size()); i < n; i++) {
+    const auto& repfield = this->_internal_computer_group(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // string name = 5;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), static_cast<int>(this->name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "aspia.proto.address_book.ComputerGroup.name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      5, this->name(), output);
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_name(), target);
   }
 
   // string comment = 6;
-  if (this->comment().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->comment().data(), static_cast<int>(this->comment().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_comment().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_comment().data(), static_cast<int>(this->_internal_comment().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "aspia.proto.address_book.ComputerGroup.comment");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      6, this->comment(), output);
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_comment(), target);
   }
 
   // bool expanded = 7;
-  if (this->expanded() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(7, this->expanded(), output);
+  if (this->_internal_expanded() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_expanded(), target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.address_book.ComputerGroup)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.address_book.ComputerGroup)
+  return target;
 }
 
 size_t ComputerGroup::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.address_book.ComputerGroup)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // repeated .aspia.proto.address_book.Computer computer = 3;
-  {
-    unsigned int count = static_cast<unsigned int>(this->computer_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          this->computer(static_cast<int>(i)));
-    }
+  total_size += 1UL * this->_internal_computer_size();
+  for (const auto& msg : this->_impl_.computer_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // repeated .aspia.proto.address_book.ComputerGroup computer_group = 4;
-  {
-    unsigned int count = static_cast<unsigned int>(this->computer_group_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          this->computer_group(static_cast<int>(i)));
-    }
+  total_size += 1UL * this->_internal_computer_group_size();
+  for (const auto& msg : this->_impl_.computer_group_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // string name = 5;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->name());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
 
   // string comment = 6;
-  if (this->comment().size() > 0) {
+  if (!this->_internal_comment().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->comment());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_comment());
   }
 
   // int64 create_time = 1;
-  if (this->create_time() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int64Size(
-        this->create_time());
+  if (this->_internal_create_time() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_create_time());
   }
 
   // int64 modify_time = 2;
-  if (this->modify_time() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int64Size(
-        this->modify_time());
+  if (this->_internal_modify_time() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_modify_time());
   }
 
   // bool expanded = 7;
-  if (this->expanded() != 0) {
+  if (this->_internal_expanded() != 0) {
     total_size += 1 + 1;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void ComputerGroup::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const ComputerGroup*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const ComputerGroup*>(
+      &from));
 }
 
 void ComputerGroup::MergeFrom(const ComputerGroup& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.address_book.ComputerGroup)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  ComputerGroup* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.address_book.ComputerGroup)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  computer_.MergeFrom(from.computer_);
-  computer_group_.MergeFrom(from.computer_group_);
-  if (from.name().size() > 0) {
-
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+  _this->_impl_.computer_.MergeFrom(from._impl_.computer_);
+  _this->_impl_.computer_group_.MergeFrom(from._impl_.computer_group_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
-  if (from.comment().size() > 0) {
-
-    comment_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.comment_);
+  if (!from._internal_comment().empty()) {
+    _this->_internal_set_comment(from._internal_comment());
   }
-  if (from.create_time() != 0) {
-    set_create_time(from.create_time());
+  if (from._internal_create_time() != 0) {
+    _this->_internal_set_create_time(from._internal_create_time());
   }
-  if (from.modify_time() != 0) {
-    set_modify_time(from.modify_time());
+  if (from._internal_modify_time() != 0) {
+    _this->_internal_set_modify_time(from._internal_modify_time());
   }
-  if (from.expanded() != 0) {
-    set_expanded(from.expanded());
+  if (from._internal_expanded() != 0) {
+    _this->_internal_set_expanded(from._internal_expanded());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void ComputerGroup::CopyFrom(const ComputerGroup& from) {
@@ -1381,265 +1847,287 @@ bool ComputerGroup::IsInitialized() const {
   return true;
 }
 
-void ComputerGroup::Swap(ComputerGroup* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void ComputerGroup::InternalSwap(ComputerGroup* other) {
   using std::swap;
-  CastToBase(&computer_)->InternalSwap(CastToBase(&other->computer_));
-  CastToBase(&computer_group_)->InternalSwap(CastToBase(&other->computer_group_));
-  name_.Swap(&other->name_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  comment_.Swap(&other->comment_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(create_time_, other->create_time_);
-  swap(modify_time_, other->modify_time_);
-  swap(expanded_, other->expanded_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-}
-
-::std::string ComputerGroup::GetTypeName() const {
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.computer_.InternalSwap(&other->_impl_.computer_);
+  _impl_.computer_group_.InternalSwap(&other->_impl_.computer_group_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.comment_, lhs_arena,
+      &other->_impl_.comment_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ComputerGroup, _impl_.expanded_)
+      + sizeof(ComputerGroup::_impl_.expanded_)
+      - PROTOBUF_FIELD_OFFSET(ComputerGroup, _impl_.create_time_)>(
+          reinterpret_cast<char*>(&_impl_.create_time_),
+          reinterpret_cast<char*>(&other->_impl_.create_time_));
+}
+
+std::string ComputerGroup::GetTypeName() const {
   return "aspia.proto.address_book.ComputerGroup";
 }
 
 
 // ===================================================================
 
-void Data::InitAsDefaultInstance() {
-  ::aspia::proto::address_book::_Data_default_instance_._instance.get_mutable()->root_group_ = const_cast< ::aspia::proto::address_book::ComputerGroup*>(
-      ::aspia::proto::address_book::ComputerGroup::internal_default_instance());
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Data::kSalt1FieldNumber;
-const int Data::kRootGroupFieldNumber;
-const int Data::kSalt2FieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class Data::_Internal {
+ public:
+  static const ::aspia::proto::address_book::ComputerGroup& root_group(const Data* msg);
+};
 
-Data::Data()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_address_5fbook_2eproto::scc_info_Data.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.address_book.Data)
+const ::aspia::proto::address_book::ComputerGroup&
+Data::_Internal::root_group(const Data* msg) {
+  return *msg->_impl_.root_group_;
+}
+Data::Data(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.address_book.Data)
 }
 Data::Data(const Data& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  salt1_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.salt1().size() > 0) {
-    salt1_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.salt1_);
-  }
-  salt2_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.salt2().size() > 0) {
-    salt2_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.salt2_);
-  }
-  if (from.has_root_group()) {
-    root_group_ = new ::aspia::proto::address_book::ComputerGroup(*from.root_group_);
-  } else {
-    root_group_ = NULL;
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  Data* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.salt1_){}
+    , decltype(_impl_.salt2_){}
+    , decltype(_impl_.root_group_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.salt1_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.salt1_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_salt1().empty()) {
+    _this->_impl_.salt1_.Set(from._internal_salt1(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.salt2_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.salt2_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_salt2().empty()) {
+    _this->_impl_.salt2_.Set(from._internal_salt2(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_root_group()) {
+    _this->_impl_.root_group_ = new ::aspia::proto::address_book::ComputerGroup(*from._impl_.root_group_);
   }
   // @@protoc_insertion_point(copy_constructor:aspia.proto.address_book.Data)
 }
 
-void Data::SharedCtor() {
-  salt1_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  salt2_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  root_group_ = NULL;
+inline void Data::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.salt1_){}
+    , decltype(_impl_.salt2_){}
+    , decltype(_impl_.root_group_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.salt1_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.salt1_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.salt2_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.salt2_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Data::~Data() {
   // @@protoc_insertion_point(destructor:aspia.proto.address_book.Data)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Data::SharedDtor() {
-  salt1_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  salt2_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete root_group_;
+inline void Data::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.salt1_.Destroy();
+  _impl_.salt2_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.root_group_;
 }
 
 void Data::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Data& Data::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_address_5fbook_2eproto::scc_info_Data.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void Data::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.address_book.Data)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  salt1_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  salt2_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (GetArenaNoVirtual() == NULL && root_group_ != NULL) {
-    delete root_group_;
-  }
-  root_group_ = NULL;
-  _internal_metadata_.Clear();
-}
-
-bool Data::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.address_book.Data)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.salt1_.ClearToEmpty();
+  _impl_.salt2_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.root_group_ != nullptr) {
+    delete _impl_.root_group_;
+  }
+  _impl_.root_group_ = nullptr;
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* Data::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // bytes salt1 = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_salt1()));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_salt1();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .aspia.proto.address_book.ComputerGroup root_group = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_root_group()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_root_group(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // bytes salt2 = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_salt2()));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_salt2();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.address_book.Data)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.address_book.Data)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void Data::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.address_book.Data)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* Data::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.address_book.Data)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // bytes salt1 = 1;
-  if (this->salt1().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      1, this->salt1(), output);
+  if (!this->_internal_salt1().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_salt1(), target);
   }
 
   // .aspia.proto.address_book.ComputerGroup root_group = 2;
-  if (this->has_root_group()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      2, this->_internal_root_group(), output);
+  if (this->_internal_has_root_group()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::root_group(this),
+        _Internal::root_group(this).GetCachedSize(), target, stream);
   }
 
   // bytes salt2 = 3;
-  if (this->salt2().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      3, this->salt2(), output);
+  if (!this->_internal_salt2().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_salt2(), target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.address_book.Data)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.address_book.Data)
+  return target;
 }
 
 size_t Data::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.address_book.Data)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // bytes salt1 = 1;
-  if (this->salt1().size() > 0) {
+  if (!this->_internal_salt1().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->salt1());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_salt1());
   }
 
   // bytes salt2 = 3;
-  if (this->salt2().size() > 0) {
+  if (!this->_internal_salt2().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->salt2());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_salt2());
   }
 
   // .aspia.proto.address_book.ComputerGroup root_group = 2;
-  if (this->has_root_group()) {
+  if (this->_internal_has_root_group()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *root_group_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.root_group_);
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void Data::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const Data*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const Data*>(
+      &from));
 }
 
 void Data::MergeFrom(const Data& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.address_book.Data)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  Data* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.address_book.Data)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.salt1().size() > 0) {
-
-    salt1_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.salt1_);
+  if (!from._internal_salt1().empty()) {
+    _this->_internal_set_salt1(from._internal_salt1());
   }
-  if (from.salt2().size() > 0) {
-
-    salt2_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.salt2_);
+  if (!from._internal_salt2().empty()) {
+    _this->_internal_set_salt2(from._internal_salt2());
   }
-  if (from.has_root_group()) {
-    mutable_root_group()->::aspia::proto::address_book::ComputerGroup::MergeFrom(from.root_group());
+  if (from._internal_has_root_group()) {
+    _this->_internal_mutable_root_group()->::aspia::proto::address_book::ComputerGroup::MergeFrom(
+        from._internal_root_group());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void Data::CopyFrom(const Data& from) {
@@ -1653,289 +2141,320 @@ bool Data::IsInitialized() const {
   return true;
 }
 
-void Data::Swap(Data* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void Data::InternalSwap(Data* other) {
   using std::swap;
-  salt1_.Swap(&other->salt1_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  salt2_.Swap(&other->salt2_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(root_group_, other->root_group_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-}
-
-::std::string Data::GetTypeName() const {
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.salt1_, lhs_arena,
+      &other->_impl_.salt1_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.salt2_, lhs_arena,
+      &other->_impl_.salt2_, rhs_arena
+  );
+  swap(_impl_.root_group_, other->_impl_.root_group_);
+}
+
+std::string Data::GetTypeName() const {
   return "aspia.proto.address_book.Data";
 }
 
 
 // ===================================================================
 
-void File::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int File::kEncryptionTypeFieldNumber;
-const int File::kHashingRoundsFieldNumber;
-const int File::kHashingSaltFieldNumber;
-const int File::kDataFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class File::_Internal {
+ public:
+};
 
-File::File()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_address_5fbook_2eproto::scc_info_File.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.address_book.File)
+File::File(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.address_book.File)
 }
 File::File(const File& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  hashing_salt_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.hashing_salt().size() > 0) {
-    hashing_salt_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.hashing_salt_);
-  }
-  data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.data().size() > 0) {
-    data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.data_);
-  }
-  ::memcpy(&encryption_type_, &from.encryption_type_,
-    static_cast<size_t>(reinterpret_cast<char*>(&hashing_rounds_) -
-    reinterpret_cast<char*>(&encryption_type_)) + sizeof(hashing_rounds_));
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  File* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.hashing_salt_){}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.encryption_type_){}
+    , decltype(_impl_.hashing_rounds_){}
+    , decltype(_impl_.hashing_memory_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.hashing_salt_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.hashing_salt_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_hashing_salt().empty()) {
+    _this->_impl_.hashing_salt_.Set(from._internal_hashing_salt(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_data().empty()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.encryption_type_, &from._impl_.encryption_type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.hashing_memory_) -
+    reinterpret_cast<char*>(&_impl_.encryption_type_)) + sizeof(_impl_.hashing_memory_));
   // @@protoc_insertion_point(copy_constructor:aspia.proto.address_book.File)
 }
 
-void File::SharedCtor() {
-  hashing_salt_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&encryption_type_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&hashing_rounds_) -
-      reinterpret_cast<char*>(&encryption_type_)) + sizeof(hashing_rounds_));
+inline void File::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.hashing_salt_){}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.encryption_type_){0}
+    , decltype(_impl_.hashing_rounds_){0}
+    , decltype(_impl_.hashing_memory_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.hashing_salt_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.hashing_salt_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 File::~File() {
   // @@protoc_insertion_point(destructor:aspia.proto.address_book.File)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void File::SharedDtor() {
-  hashing_salt_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  data_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void File::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.hashing_salt_.Destroy();
+  _impl_.data_.Destroy();
 }
 
 void File::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const File& File::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_address_5fbook_2eproto::scc_info_File.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void File::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.address_book.File)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  hashing_salt_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&encryption_type_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&hashing_rounds_) -
-      reinterpret_cast<char*>(&encryption_type_)) + sizeof(hashing_rounds_));
-  _internal_metadata_.Clear();
-}
-
-bool File::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.address_book.File)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.hashing_salt_.ClearToEmpty();
+  _impl_.data_.ClearToEmpty();
+  ::memset(&_impl_.encryption_type_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.hashing_memory_) -
+      reinterpret_cast<char*>(&_impl_.encryption_type_)) + sizeof(_impl_.hashing_memory_));
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* File::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // .aspia.proto.address_book.EncryptionType encryption_type = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_encryption_type(static_cast< ::aspia::proto::address_book::EncryptionType >(value));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_encryption_type(static_cast<::aspia::proto::address_book::EncryptionType>(val));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // int32 hashing_rounds = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &hashing_rounds_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.hashing_rounds_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // bytes hashing_salt = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_hashing_salt()));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_hashing_salt();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
+      // uint32 hashing_memory = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.hashing_memory_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // bytes data = 9;
-      case 9: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(74u /* 74 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_data()));
-        } else {
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.address_book.File)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.address_book.File)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void File::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.address_book.File)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* File::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.address_book.File)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .aspia.proto.address_book.EncryptionType encryption_type = 1;
-  if (this->encryption_type() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->encryption_type(), output);
+  if (this->_internal_encryption_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_encryption_type(), target);
   }
 
   // int32 hashing_rounds = 2;
-  if (this->hashing_rounds() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->hashing_rounds(), output);
+  if (this->_internal_hashing_rounds() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_hashing_rounds(), target);
   }
 
   // bytes hashing_salt = 3;
-  if (this->hashing_salt().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      3, this->hashing_salt(), output);
+  if (!this->_internal_hashing_salt().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_hashing_salt(), target);
+  }
+
+  // uint32 hashing_memory = 4;
+  if (this->_internal_hashing_memory() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_hashing_memory(), target);
   }
 
   // bytes data = 9;
-  if (this->data().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      9, this->data(), output);
+  if (!this->_internal_data().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        9, this->_internal_data(), target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.address_book.File)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.address_book.File)
+  return target;
 }
 
 size_t File::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.address_book.File)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // bytes hashing_salt = 3;
-  if (this->hashing_salt().size() > 0) {
+  if (!this->_internal_hashing_salt().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->hashing_salt());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_hashing_salt());
   }
 
   // bytes data = 9;
-  if (this->data().size() > 0) {
+  if (!this->_internal_data().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->data());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
   }
 
   // .aspia.proto.address_book.EncryptionType encryption_type = 1;
-  if (this->encryption_type() != 0) {
+  if (this->_internal_encryption_type() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->encryption_type());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_encryption_type());
   }
 
   // int32 hashing_rounds = 2;
-  if (this->hashing_rounds() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->hashing_rounds());
+  if (this->_internal_hashing_rounds() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_hashing_rounds());
+  }
+
+  // uint32 hashing_memory = 4;
+  if (this->_internal_hashing_memory() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_hashing_memory());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void File::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const File*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const File*>(
+      &from));
 }
 
 void File::MergeFrom(const File& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.address_book.File)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  File* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.address_book.File)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.hashing_salt().size() > 0) {
-
-    hashing_salt_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.hashing_salt_);
+  if (!from._internal_hashing_salt().empty()) {
+    _this->_internal_set_hashing_salt(from._internal_hashing_salt());
   }
-  if (from.data().size() > 0) {
-
-    data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.data_);
+  if (!from._internal_data().empty()) {
+    _this->_internal_set_data(from._internal_data());
+  }
+  if (from._internal_encryption_type() != 0) {
+    _this->_internal_set_encryption_type(from._internal_encryption_type());
   }
-  if (from.encryption_type() != 0) {
-    set_encryption_type(from.encryption_type());
+  if (from._internal_hashing_rounds() != 0) {
+    _this->_internal_set_hashing_rounds(from._internal_hashing_rounds());
   }
-  if (from.hashing_rounds() != 0) {
-    set_hashing_rounds(from.hashing_rounds());
+  if (from._internal_hashing_memory() != 0) {
+    _this->_internal_set_hashing_memory(from._internal_hashing_memory());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void File::CopyFrom(const File& from) {
@@ -1949,22 +2468,28 @@ bool File::IsInitialized() const {
   return true;
 }
 
-void File::Swap(File* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void File::InternalSwap(File* other) {
   using std::swap;
-  hashing_salt_.Swap(&other->hashing_salt_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  data_.Swap(&other->data_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(encryption_type_, other->encryption_type_);
-  swap(hashing_rounds_, other->hashing_rounds_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-}
-
-::std::string File::GetTypeName() const {
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.hashing_salt_, lhs_arena,
+      &other->_impl_.hashing_salt_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(File, _impl_.hashing_memory_)
+      + sizeof(File::_impl_.hashing_memory_)
+      - PROTOBUF_FIELD_OFFSET(File, _impl_.encryption_type_)>(
+          reinterpret_cast<char*>(&_impl_.encryption_type_),
+          reinterpret_cast<char*>(&other->_impl_.encryption_type_));
+}
+
+std::string File::GetTypeName() const {
   return "aspia.proto.address_book.File";
 }
 
@@ -1973,24 +2498,32 @@ void File::InternalSwap(File* other) {
 }  // namespace address_book
 }  // namespace proto
 }  // namespace aspia
-namespace google {
-namespace protobuf {
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::address_book::SessionConfig* Arena::CreateMaybeMessage< ::aspia::proto::address_book::SessionConfig >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::address_book::SessionConfig >(arena);
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::aspia::proto::address_book::SessionConfig*
+Arena::CreateMaybeMessage< ::aspia::proto::address_book::SessionConfig >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::address_book::SessionConfig >(arena);
+}
+template<> PROTOBUF_NOINLINE ::aspia::proto::address_book::StreamingProfile*
+Arena::CreateMaybeMessage< ::aspia::proto::address_book::StreamingProfile >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::address_book::StreamingProfile >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::address_book::Computer* Arena::CreateMaybeMessage< ::aspia::proto::address_book::Computer >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::address_book::Computer >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::address_book::Computer*
+Arena::CreateMaybeMessage< ::aspia::proto::address_book::Computer >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::address_book::Computer >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::address_book::ComputerGroup* Arena::CreateMaybeMessage< ::aspia::proto::address_book::ComputerGroup >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::address_book::ComputerGroup >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::address_book::ComputerGroup*
+Arena::CreateMaybeMessage< ::aspia::proto::address_book::ComputerGroup >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::address_book::ComputerGroup >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::address_book::Data* Arena::CreateMaybeMessage< ::aspia::proto::address_book::Data >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::address_book::Data >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::address_book::Data*
+Arena::CreateMaybeMessage< ::aspia::proto::address_book::Data >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::address_book::Data >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::address_book::File* Arena::CreateMaybeMessage< ::aspia::proto::address_book::File >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::address_book::File >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::address_book::File*
+Arena::CreateMaybeMessage< ::aspia::proto::address_book::File >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::address_book::File >(arena);
 }
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -1,30 +1,29 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: address_book.proto
 
-#ifndef PROTOBUF_INCLUDED_address_5fbook_2eproto
-#define PROTOBUF_INCLUDED_address_5fbook_2eproto
+#ifndef GOOGLE_PROTOBUF_INCLUDED_address_5fbook_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_address_5fbook_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3006000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3006000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/message_lite.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
@@ -33,96 +32,113 @@
 #include "authorization.pb.h"
 #include "desktop_session.pb.h"
 // @@protoc_insertion_point(includes)
-#define PROTOBUF_INTERNAL_EXPORT_protobuf_address_5fbook_2eproto 
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_address_5fbook_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
 
-namespace protobuf_address_5fbook_2eproto {
 // Internal implementation detail -- do not use these members.
-struct TableStruct {
-  static const ::google::protobuf::internal::ParseTableField entries[];
-  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
-  static const ::google::protobuf::internal::ParseTable schema[5];
-  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
-  static const ::google::protobuf::internal::SerializationTable serialization_table[];
-  static const ::google::protobuf::uint32 offsets[];
+struct TableStruct_address_5fbook_2eproto {
+  static const uint32_t offsets[];
 };
-}  // namespace protobuf_address_5fbook_2eproto
 namespace aspia {
 namespace proto {
 namespace address_book {
 class Computer;
-class ComputerDefaultTypeInternal;
+struct ComputerDefaultTypeInternal;
 extern ComputerDefaultTypeInternal _Computer_default_instance_;
 class ComputerGroup;
-class ComputerGroupDefaultTypeInternal;
+struct ComputerGroupDefaultTypeInternal;
 extern ComputerGroupDefaultTypeInternal _ComputerGroup_default_instance_;
 class Data;
-class DataDefaultTypeInternal;
+struct DataDefaultTypeInternal;
 extern DataDefaultTypeInternal _Data_default_instance_;
 class File;
-class FileDefaultTypeInternal;
+struct FileDefaultTypeInternal;
 extern FileDefaultTypeInternal _File_default_instance_;
 class SessionConfig;
-class SessionConfigDefaultTypeInternal;
+struct SessionConfigDefaultTypeInternal;
 extern SessionConfigDefaultTypeInternal _SessionConfig_default_instance_;
+class StreamingProfile;
+struct StreamingProfileDefaultTypeInternal;
+extern StreamingProfileDefaultTypeInternal _StreamingProfile_default_instance_;
 }  // namespace address_book
 }  // namespace proto
 }  // namespace aspia
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 template<> ::aspia::proto::address_book::Computer* Arena::CreateMaybeMessage<::aspia::proto::address_book::Computer>(Arena*);
 template<> ::aspia::proto::address_book::ComputerGroup* Arena::CreateMaybeMessage<::aspia::proto::address_book::ComputerGroup>(Arena*);
 template<> ::aspia::proto::address_book::Data* Arena::CreateMaybeMessage<::aspia::proto::address_book::Data>(Arena*);
 template<> ::aspia::proto::address_book::File* Arena::CreateMaybeMessage<::aspia::proto::address_book::File>(Arena*);
 template<> ::aspia::proto::address_book::SessionConfig* Arena::CreateMaybeMessage<::aspia::proto::address_book::SessionConfig>(Arena*);
-}  // namespace protobuf
-}  // namespace google
+template<> ::aspia::proto::address_book::StreamingProfile* Arena::CreateMaybeMessage<::aspia::proto::address_book::StreamingProfile>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
 namespace aspia {
 namespace proto {
 namespace address_book {
 
-enum EncryptionType {
+enum EncryptionType : int {
   ENCRYPTION_TYPE_UNKNOWN = 0,
   ENCRYPTION_TYPE_NONE = 1,
   ENCRYPTION_TYPE_XCHACHA20_POLY1305 = 2,
-  EncryptionType_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  EncryptionType_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  ENCRYPTION_TYPE_XCHACHA20_POLY1305_ARGON2ID = 3,
+  EncryptionType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  EncryptionType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool EncryptionType_IsValid(int value);
-const EncryptionType EncryptionType_MIN = ENCRYPTION_TYPE_UNKNOWN;
-const EncryptionType EncryptionType_MAX = ENCRYPTION_TYPE_XCHACHA20_POLY1305;
-const int EncryptionType_ARRAYSIZE = EncryptionType_MAX + 1;
-
+constexpr EncryptionType EncryptionType_MIN = ENCRYPTION_TYPE_UNKNOWN;
+constexpr EncryptionType EncryptionType_MAX = ENCRYPTION_TYPE_XCHACHA20_POLY1305_ARGON2ID;
+constexpr int EncryptionType_ARRAYSIZE = EncryptionType_MAX + 1;
+
+const std::string& EncryptionType_Name(EncryptionType value);
+template<typename T>
+inline const std::string& EncryptionType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, EncryptionType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function EncryptionType_Name.");
+  return EncryptionType_Name(static_cast<EncryptionType>(enum_t_value));
+}
+bool EncryptionType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, EncryptionType* value);
 // ===================================================================
 
-class SessionConfig : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.address_book.SessionConfig) */ {
+class SessionConfig final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.address_book.SessionConfig) */ {
  public:
-  SessionConfig();
-  virtual ~SessionConfig();
+  inline SessionConfig() : SessionConfig(nullptr) {}
+  ~SessionConfig() override;
+  explicit PROTOBUF_CONSTEXPR SessionConfig(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SessionConfig(const SessionConfig& from);
-
-  inline SessionConfig& operator=(const SessionConfig& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   SessionConfig(SessionConfig&& from) noexcept
     : SessionConfig() {
     *this = ::std::move(from);
   }
 
+  inline SessionConfig& operator=(const SessionConfig& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline SessionConfig& operator=(SessionConfig&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const SessionConfig& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const SessionConfig& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const SessionConfig* internal_default_instance() {
     return reinterpret_cast<const SessionConfig*>(
                &_SessionConfig_default_instance_);
@@ -130,750 +146,1225 @@ class SessionConfig : public ::google::protobuf::MessageLite /* @@protoc_inserti
   static constexpr int kIndexInFileMessages =
     0;
 
-  void Swap(SessionConfig* other);
   friend void swap(SessionConfig& a, SessionConfig& b) {
     a.Swap(&b);
   }
+  inline void Swap(SessionConfig* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SessionConfig* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline SessionConfig* New() const final {
-    return CreateMaybeMessage<SessionConfig>(NULL);
-  }
-
-  SessionConfig* New(::google::protobuf::Arena* arena) const final {
+  SessionConfig* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<SessionConfig>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const SessionConfig& from);
   void MergeFrom(const SessionConfig& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(SessionConfig* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.address_book.SessionConfig";
   }
+  protected:
+  explicit SessionConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kDesktopManageFieldNumber = 1,
+    kDesktopViewFieldNumber = 2,
+  };
   // .aspia.proto.desktop.Config desktop_manage = 1;
   bool has_desktop_manage() const;
-  void clear_desktop_manage();
-  static const int kDesktopManageFieldNumber = 1;
   private:
-  const ::aspia::proto::desktop::Config& _internal_desktop_manage() const;
+  bool _internal_has_desktop_manage() const;
   public:
+  void clear_desktop_manage();
   const ::aspia::proto::desktop::Config& desktop_manage() const;
-  ::aspia::proto::desktop::Config* release_desktop_manage();
+  PROTOBUF_NODISCARD ::aspia::proto::desktop::Config* release_desktop_manage();
   ::aspia::proto::desktop::Config* mutable_desktop_manage();
   void set_allocated_desktop_manage(::aspia::proto::desktop::Config* desktop_manage);
+  private:
+  const ::aspia::proto::desktop::Config& _internal_desktop_manage() const;
+  ::aspia::proto::desktop::Config* _internal_mutable_desktop_manage();
+  public:
+  void unsafe_arena_set_allocated_desktop_manage(
+      ::aspia::proto::desktop::Config* desktop_manage);
+  ::aspia::proto::desktop::Config* unsafe_arena_release_desktop_manage();
 
   // .aspia.proto.desktop.Config desktop_view = 2;
   bool has_desktop_view() const;
-  void clear_desktop_view();
-  static const int kDesktopViewFieldNumber = 2;
   private:
-  const ::aspia::proto::desktop::Config& _internal_desktop_view() const;
+  bool _internal_has_desktop_view() const;
   public:
+  void clear_desktop_view();
   const ::aspia::proto::desktop::Config& desktop_view() const;
-  ::aspia::proto::desktop::Config* release_desktop_view();
+  PROTOBUF_NODISCARD ::aspia::proto::desktop::Config* release_desktop_view();
   ::aspia::proto::desktop::Config* mutable_desktop_view();
   void set_allocated_desktop_view(::aspia::proto::desktop::Config* desktop_view);
+  private:
+  const ::aspia::proto::desktop::Config& _internal_desktop_view() const;
+  ::aspia::proto::desktop::Config* _internal_mutable_desktop_view();
+  public:
+  void unsafe_arena_set_allocated_desktop_view(
+      ::aspia::proto::desktop::Config* desktop_view);
+  ::aspia::proto::desktop::Config* unsafe_arena_release_desktop_view();
 
   // @@protoc_insertion_point(class_scope:aspia.proto.address_book.SessionConfig)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::aspia::proto::desktop::Config* desktop_manage_;
-  ::aspia::proto::desktop::Config* desktop_view_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_address_5fbook_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::aspia::proto::desktop::Config* desktop_manage_;
+    ::aspia::proto::desktop::Config* desktop_view_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_address_5fbook_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Computer : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.address_book.Computer) */ {
+class StreamingProfile final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.address_book.StreamingProfile) */ {
  public:
-  Computer();
-  virtual ~Computer();
+  inline StreamingProfile() : StreamingProfile(nullptr) {}
+  ~StreamingProfile() override;
+  explicit PROTOBUF_CONSTEXPR StreamingProfile(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Computer(const Computer& from);
+  StreamingProfile(const StreamingProfile& from);
+  StreamingProfile(StreamingProfile&& from) noexcept
+    : StreamingProfile() {
+    *this = ::std::move(from);
+  }
 
-  inline Computer& operator=(const Computer& from) {
+  inline StreamingProfile& operator=(const StreamingProfile& from) {
     CopyFrom(from);
     return *this;
   }
-  #if LANG_CXX11
+  inline StreamingProfile& operator=(StreamingProfile&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const StreamingProfile& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StreamingProfile* internal_default_instance() {
+    return reinterpret_cast<const StreamingProfile*>(
+               &_StreamingProfile_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(StreamingProfile& a, StreamingProfile& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StreamingProfile* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StreamingProfile* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StreamingProfile* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StreamingProfile>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const StreamingProfile& from);
+  void MergeFrom(const StreamingProfile& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(StreamingProfile* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.address_book.StreamingProfile";
+  }
+  protected:
+  explicit StreamingProfile(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPixelFormatFieldNumber = 3,
+    kUpdateTimeFieldNumber = 1,
+    kVideoEncodingFieldNumber = 2,
+    kCompressRatioFieldNumber = 4,
+    kMinRoundTripTimeFieldNumber = 6,
+    kBitrateFieldNumber = 5,
+    kUpgradeSamplesFieldNumber = 7,
+  };
+  // .aspia.proto.desktop.PixelFormat pixel_format = 3;
+  bool has_pixel_format() const;
+  private:
+  bool _internal_has_pixel_format() const;
+  public:
+  void clear_pixel_format();
+  const ::aspia::proto::desktop::PixelFormat& pixel_format() const;
+  PROTOBUF_NODISCARD ::aspia::proto::desktop::PixelFormat* release_pixel_format();
+  ::aspia::proto::desktop::PixelFormat* mutable_pixel_format();
+  void set_allocated_pixel_format(::aspia::proto::desktop::PixelFormat* pixel_format);
+  private:
+  const ::aspia::proto::desktop::PixelFormat& _internal_pixel_format() const;
+  ::aspia::proto::desktop::PixelFormat* _internal_mutable_pixel_format();
+  public:
+  void unsafe_arena_set_allocated_pixel_format(
+      ::aspia::proto::desktop::PixelFormat* pixel_format);
+  ::aspia::proto::desktop::PixelFormat* unsafe_arena_release_pixel_format();
+
+  // int64 update_time = 1;
+  void clear_update_time();
+  int64_t update_time() const;
+  void set_update_time(int64_t value);
+  private:
+  int64_t _internal_update_time() const;
+  void _internal_set_update_time(int64_t value);
+  public:
+
+  // .aspia.proto.desktop.VideoEncoding video_encoding = 2;
+  void clear_video_encoding();
+  ::aspia::proto::desktop::VideoEncoding video_encoding() const;
+  void set_video_encoding(::aspia::proto::desktop::VideoEncoding value);
+  private:
+  ::aspia::proto::desktop::VideoEncoding _internal_video_encoding() const;
+  void _internal_set_video_encoding(::aspia::proto::desktop::VideoEncoding value);
+  public:
+
+  // uint32 compress_ratio = 4;
+  void clear_compress_ratio();
+  uint32_t compress_ratio() const;
+  void set_compress_ratio(uint32_t value);
+  private:
+  uint32_t _internal_compress_ratio() const;
+  void _internal_set_compress_ratio(uint32_t value);
+  public:
+
+  // int64 min_round_trip_time = 6;
+  void clear_min_round_trip_time();
+  int64_t min_round_trip_time() const;
+  void set_min_round_trip_time(int64_t value);
+  private:
+  int64_t _internal_min_round_trip_time() const;
+  void _internal_set_min_round_trip_time(int64_t value);
+  public:
+
+  // uint32 bitrate = 5;
+  void clear_bitrate();
+  uint32_t bitrate() const;
+  void set_bitrate(uint32_t value);
+  private:
+  uint32_t _internal_bitrate() const;
+  void _internal_set_bitrate(uint32_t value);
+  public:
+
+  // int32 upgrade_samples = 7;
+  void clear_upgrade_samples();
+  int32_t upgrade_samples() const;
+  void set_upgrade_samples(int32_t value);
+  private:
+  int32_t _internal_upgrade_samples() const;
+  void _internal_set_upgrade_samples(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.address_book.StreamingProfile)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::aspia::proto::desktop::PixelFormat* pixel_format_;
+    int64_t update_time_;
+    int video_encoding_;
+    uint32_t compress_ratio_;
+    int64_t min_round_trip_time_;
+    uint32_t bitrate_;
+    int32_t upgrade_samples_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_address_5fbook_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Computer final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.address_book.Computer) */ {
+ public:
+  inline Computer() : Computer(nullptr) {}
+  ~Computer() override;
+  explicit PROTOBUF_CONSTEXPR Computer(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Computer(const Computer& from);
   Computer(Computer&& from) noexcept
     : Computer() {
     *this = ::std::move(from);
   }
 
+  inline Computer& operator=(const Computer& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline Computer& operator=(Computer&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const Computer& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const Computer& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const Computer* internal_default_instance() {
     return reinterpret_cast<const Computer*>(
                &_Computer_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    1;
+    2;
 
-  void Swap(Computer* other);
   friend void swap(Computer& a, Computer& b) {
     a.Swap(&b);
   }
+  inline void Swap(Computer* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Computer* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Computer* New() const final {
-    return CreateMaybeMessage<Computer>(NULL);
-  }
-
-  Computer* New(::google::protobuf::Arena* arena) const final {
+  Computer* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Computer>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const Computer& from);
   void MergeFrom(const Computer& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(Computer* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.address_book.Computer";
   }
+  protected:
+  explicit Computer(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kAlternateAddressesFieldNumber = 18,
+    kNameFieldNumber = 4,
+    kCommentFieldNumber = 5,
+    kAddressFieldNumber = 6,
+    kUsernameFieldNumber = 8,
+    kPasswordFieldNumber = 9,
+    kSessionConfigFieldNumber = 17,
+    kStreamingProfileFieldNumber = 19,
+    kCreateTimeFieldNumber = 1,
+    kModifyTimeFieldNumber = 2,
+    kConnectTimeFieldNumber = 3,
+    kPortFieldNumber = 7,
+    kSessionTypeFieldNumber = 16,
+  };
+  // repeated string alternate_addresses = 18;
+  int alternate_addresses_size() const;
+  private:
+  int _internal_alternate_addresses_size() const;
+  public:
+  void clear_alternate_addresses();
+  const std::string& alternate_addresses(int index) const;
+  std::string* mutable_alternate_addresses(int index);
+  void set_alternate_addresses(int index, const std::string& value);
+  void set_alternate_addresses(int index, std::string&& value);
+  void set_alternate_addresses(int index, const char* value);
+  void set_alternate_addresses(int index, const char* value, size_t size);
+  std::string* add_alternate_addresses();
+  void add_alternate_addresses(const std::string& value);
+  void add_alternate_addresses(std::string&& value);
+  void add_alternate_addresses(const char* value);
+  void add_alternate_addresses(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& alternate_addresses() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_alternate_addresses();
+  private:
+  const std::string& _internal_alternate_addresses(int index) const;
+  std::string* _internal_add_alternate_addresses();
+  public:
+
   // string name = 4;
   void clear_name();
-  static const int kNameFieldNumber = 4;
-  const ::std::string& name() const;
-  void set_name(const ::std::string& value);
-  #if LANG_CXX11
-  void set_name(::std::string&& value);
-  #endif
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
-  ::std::string* mutable_name();
-  ::std::string* release_name();
-  void set_allocated_name(::std::string* name);
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
 
   // string comment = 5;
   void clear_comment();
-  static const int kCommentFieldNumber = 5;
-  const ::std::string& comment() const;
-  void set_comment(const ::std::string& value);
-  #if LANG_CXX11
-  void set_comment(::std::string&& value);
-  #endif
-  void set_comment(const char* value);
-  void set_comment(const char* value, size_t size);
-  ::std::string* mutable_comment();
-  ::std::string* release_comment();
-  void set_allocated_comment(::std::string* comment);
+  const std::string& comment() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_comment(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_comment();
+  PROTOBUF_NODISCARD std::string* release_comment();
+  void set_allocated_comment(std::string* comment);
+  private:
+  const std::string& _internal_comment() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_comment(const std::string& value);
+  std::string* _internal_mutable_comment();
+  public:
 
   // string address = 6;
   void clear_address();
-  static const int kAddressFieldNumber = 6;
-  const ::std::string& address() const;
-  void set_address(const ::std::string& value);
-  #if LANG_CXX11
-  void set_address(::std::string&& value);
-  #endif
-  void set_address(const char* value);
-  void set_address(const char* value, size_t size);
-  ::std::string* mutable_address();
-  ::std::string* release_address();
-  void set_allocated_address(::std::string* address);
+  const std::string& address() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_address(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_address();
+  PROTOBUF_NODISCARD std::string* release_address();
+  void set_allocated_address(std::string* address);
+  private:
+  const std::string& _internal_address() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_address(const std::string& value);
+  std::string* _internal_mutable_address();
+  public:
 
   // string username = 8;
   void clear_username();
-  static const int kUsernameFieldNumber = 8;
-  const ::std::string& username() const;
-  void set_username(const ::std::string& value);
-  #if LANG_CXX11
-  void set_username(::std::string&& value);
-  #endif
-  void set_username(const char* value);
-  void set_username(const char* value, size_t size);
-  ::std::string* mutable_username();
-  ::std::string* release_username();
-  void set_allocated_username(::std::string* username);
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
 
   // string password = 9;
   void clear_password();
-  static const int kPasswordFieldNumber = 9;
-  const ::std::string& password() const;
-  void set_password(const ::std::string& value);
-  #if LANG_CXX11
-  void set_password(::std::string&& value);
-  #endif
-  void set_password(const char* value);
-  void set_password(const char* value, size_t size);
-  ::std::string* mutable_password();
-  ::std::string* release_password();
-  void set_allocated_password(::std::string* password);
+  const std::string& password() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_password(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_password();
+  PROTOBUF_NODISCARD std::string* release_password();
+  void set_allocated_password(std::string* password);
+  private:
+  const std::string& _internal_password() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_password(const std::string& value);
+  std::string* _internal_mutable_password();
+  public:
 
   // .aspia.proto.address_book.SessionConfig session_config = 17;
   bool has_session_config() const;
-  void clear_session_config();
-  static const int kSessionConfigFieldNumber = 17;
   private:
-  const ::aspia::proto::address_book::SessionConfig& _internal_session_config() const;
+  bool _internal_has_session_config() const;
   public:
+  void clear_session_config();
   const ::aspia::proto::address_book::SessionConfig& session_config() const;
-  ::aspia::proto::address_book::SessionConfig* release_session_config();
+  PROTOBUF_NODISCARD ::aspia::proto::address_book::SessionConfig* release_session_config();
   ::aspia::proto::address_book::SessionConfig* mutable_session_config();
   void set_allocated_session_config(::aspia::proto::address_book::SessionConfig* session_config);
+  private:
+  const ::aspia::proto::address_book::SessionConfig& _internal_session_config() const;
+  ::aspia::proto::address_book::SessionConfig* _internal_mutable_session_config();
+  public:
+  void unsafe_arena_set_allocated_session_config(
+      ::aspia::proto::address_book::SessionConfig* session_config);
+  ::aspia::proto::address_book::SessionConfig* unsafe_arena_release_session_config();
+
+  // .aspia.proto.address_book.StreamingProfile streaming_profile = 19;
+  bool has_streaming_profile() const;
+  private:
+  bool _internal_has_streaming_profile() const;
+  public:
+  void clear_streaming_profile();
+  const ::aspia::proto::address_book::StreamingProfile& streaming_profile() const;
+  PROTOBUF_NODISCARD ::aspia::proto::address_book::StreamingProfile* release_streaming_profile();
+  ::aspia::proto::address_book::StreamingProfile* mutable_streaming_profile();
+  void set_allocated_streaming_profile(::aspia::proto::address_book::StreamingProfile* streaming_profile);
+  private:
+  const ::aspia::proto::address_book::StreamingProfile& _internal_streaming_profile() const;
+  ::aspia::proto::address_book::StreamingProfile* _internal_mutable_streaming_profile();
+  public:
+  void unsafe_arena_set_allocated_streaming_profile(
+      ::aspia::proto::address_book::StreamingProfile* streaming_profile);
+  ::aspia::proto::address_book::StreamingProfile* unsafe_arena_release_streaming_profile();
 
   // int64 create_time = 1;
   void clear_create_time();
-  static const int kCreateTimeFieldNumber = 1;
-  ::google::protobuf::int64 create_time() const;
-  void set_create_time(::google::protobuf::int64 value);
+  int64_t create_time() const;
+  void set_create_time(int64_t value);
+  private:
+  int64_t _internal_create_time() const;
+  void _internal_set_create_time(int64_t value);
+  public:
 
   // int64 modify_time = 2;
   void clear_modify_time();
-  static const int kModifyTimeFieldNumber = 2;
-  ::google::protobuf::int64 modify_time() const;
-  void set_modify_time(::google::protobuf::int64 value);
+  int64_t modify_time() const;
+  void set_modify_time(int64_t value);
+  private:
+  int64_t _internal_modify_time() const;
+  void _internal_set_modify_time(int64_t value);
+  public:
 
   // int64 connect_time = 3;
   void clear_connect_time();
-  static const int kConnectTimeFieldNumber = 3;
-  ::google::protobuf::int64 connect_time() const;
-  void set_connect_time(::google::protobuf::int64 value);
+  int64_t connect_time() const;
+  void set_connect_time(int64_t value);
+  private:
+  int64_t _internal_connect_time() const;
+  void _internal_set_connect_time(int64_t value);
+  public:
 
   // uint32 port = 7;
   void clear_port();
-  static const int kPortFieldNumber = 7;
-  ::google::protobuf::uint32 port() const;
-  void set_port(::google::protobuf::uint32 value);
+  uint32_t port() const;
+  void set_port(uint32_t value);
+  private:
+  uint32_t _internal_port() const;
+  void _internal_set_port(uint32_t value);
+  public:
 
   // .aspia.proto.auth.SessionType session_type = 16;
   void clear_session_type();
-  static const int kSessionTypeFieldNumber = 16;
   ::aspia::proto::auth::SessionType session_type() const;
   void set_session_type(::aspia::proto::auth::SessionType value);
+  private:
+  ::aspia::proto::auth::SessionType _internal_session_type() const;
+  void _internal_set_session_type(::aspia::proto::auth::SessionType value);
+  public:
 
   // @@protoc_insertion_point(class_scope:aspia.proto.address_book.Computer)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr name_;
-  ::google::protobuf::internal::ArenaStringPtr comment_;
-  ::google::protobuf::internal::ArenaStringPtr address_;
-  ::google::protobuf::internal::ArenaStringPtr username_;
-  ::google::protobuf::internal::ArenaStringPtr password_;
-  ::aspia::proto::address_book::SessionConfig* session_config_;
-  ::google::protobuf::int64 create_time_;
-  ::google::protobuf::int64 modify_time_;
-  ::google::protobuf::int64 connect_time_;
-  ::google::protobuf::uint32 port_;
-  int session_type_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_address_5fbook_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> alternate_addresses_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr comment_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr address_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr password_;
+    ::aspia::proto::address_book::SessionConfig* session_config_;
+    ::aspia::proto::address_book::StreamingProfile* streaming_profile_;
+    int64_t create_time_;
+    int64_t modify_time_;
+    int64_t connect_time_;
+    uint32_t port_;
+    int session_type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_address_5fbook_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ComputerGroup : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.address_book.ComputerGroup) */ {
+class ComputerGroup final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.address_book.ComputerGroup) */ {
  public:
-  ComputerGroup();
-  virtual ~ComputerGroup();
+  inline ComputerGroup() : ComputerGroup(nullptr) {}
+  ~ComputerGroup() override;
+  explicit PROTOBUF_CONSTEXPR ComputerGroup(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ComputerGroup(const ComputerGroup& from);
-
-  inline ComputerGroup& operator=(const ComputerGroup& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   ComputerGroup(ComputerGroup&& from) noexcept
     : ComputerGroup() {
     *this = ::std::move(from);
   }
 
+  inline ComputerGroup& operator=(const ComputerGroup& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline ComputerGroup& operator=(ComputerGroup&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ComputerGroup& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ComputerGroup& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const ComputerGroup* internal_default_instance() {
     return reinterpret_cast<const ComputerGroup*>(
                &_ComputerGroup_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    2;
+    3;
 
-  void Swap(ComputerGroup* other);
   friend void swap(ComputerGroup& a, ComputerGroup& b) {
     a.Swap(&b);
   }
+  inline void Swap(ComputerGroup* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ComputerGroup* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline ComputerGroup* New() const final {
-    return CreateMaybeMessage<ComputerGroup>(NULL);
-  }
-
-  ComputerGroup* New(::google::protobuf::Arena* arena) const final {
+  ComputerGroup* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ComputerGroup>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const ComputerGroup& from);
   void MergeFrom(const ComputerGroup& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(ComputerGroup* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.address_book.ComputerGroup";
   }
+  protected:
+  explicit ComputerGroup(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kComputerFieldNumber = 3,
+    kComputerGroupFieldNumber = 4,
+    kNameFieldNumber = 5,
+    kCommentFieldNumber = 6,
+    kCreateTimeFieldNumber = 1,
+    kModifyTimeFieldNumber = 2,
+    kExpandedFieldNumber = 7,
+  };
   // repeated .aspia.proto.address_book.Computer computer = 3;
   int computer_size() const;
+  private:
+  int _internal_computer_size() const;
+  public:
   void clear_computer();
-  static const int kComputerFieldNumber = 3;
   ::aspia::proto::address_book::Computer* mutable_computer(int index);
-  ::google::protobuf::RepeatedPtrField< ::aspia::proto::address_book::Computer >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::address_book::Computer >*
       mutable_computer();
+  private:
+  const ::aspia::proto::address_book::Computer& _internal_computer(int index) const;
+  ::aspia::proto::address_book::Computer* _internal_add_computer();
+  public:
   const ::aspia::proto::address_book::Computer& computer(int index) const;
   ::aspia::proto::address_book::Computer* add_computer();
-  const ::google::protobuf::RepeatedPtrField< ::aspia::proto::address_book::Computer >&
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::address_book::Computer >&
       computer() const;
 
   // repeated .aspia.proto.address_book.ComputerGroup computer_group = 4;
   int computer_group_size() const;
+  private:
+  int _internal_computer_group_size() const;
+  public:
   void clear_computer_group();
-  static const int kComputerGroupFieldNumber = 4;
   ::aspia::proto::address_book::ComputerGroup* mutable_computer_group(int index);
-  ::google::protobuf::RepeatedPtrField< ::aspia::proto::address_book::ComputerGroup >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::address_book::ComputerGroup >*
       mutable_computer_group();
+  private:
+  const ::aspia::proto::address_book::ComputerGroup& _internal_computer_group(int index) const;
+  ::aspia::proto::address_book::ComputerGroup* _internal_add_computer_group();
+  public:
   const ::aspia::proto::address_book::ComputerGroup& computer_group(int index) const;
   ::aspia::proto::address_book::ComputerGroup* add_computer_group();
-  const ::google::protobuf::RepeatedPtrField< ::aspia::proto::address_book::ComputerGroup >&
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::address_book::ComputerGroup >&
       computer_group() const;
 
   // string name = 5;
   void clear_name();
-  static const int kNameFieldNumber = 5;
-  const ::std::string& name() const;
-  void set_name(const ::std::string& value);
-  #if LANG_CXX11
-  void set_name(::std::string&& value);
-  #endif
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
-  ::std::string* mutable_name();
-  ::std::string* release_name();
-  void set_allocated_name(::std::string* name);
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
 
   // string comment = 6;
   void clear_comment();
-  static const int kCommentFieldNumber = 6;
-  const ::std::string& comment() const;
-  void set_comment(const ::std::string& value);
-  #if LANG_CXX11
-  void set_comment(::std::string&& value);
-  #endif
-  void set_comment(const char* value);
-  void set_comment(const char* value, size_t size);
-  ::std::string* mutable_comment();
-  ::std::string* release_comment();
-  void set_allocated_comment(::std::string* comment);
+  const std::string& comment() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_comment(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_comment();
+  PROTOBUF_NODISCARD std::string* release_comment();
+  void set_allocated_comment(std::string* comment);
+  private:
+  const std::string& _internal_comment() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_comment(const std::string& value);
+  std::string* _internal_mutable_comment();
+  public:
 
   // int64 create_time = 1;
   void clear_create_time();
-  static const int kCreateTimeFieldNumber = 1;
-  ::google::protobuf::int64 create_time() const;
-  void set_create_time(::google::protobuf::int64 value);
+  int64_t create_time() const;
+  void set_create_time(int64_t value);
+  private:
+  int64_t _internal_create_time() const;
+  void _internal_set_create_time(int64_t value);
+  public:
 
   // int64 modify_time = 2;
   void clear_modify_time();
-  static const int kModifyTimeFieldNumber = 2;
-  ::google::protobuf::int64 modify_time() const;
-  void set_modify_time(::google::protobuf::int64 value);
+  int64_t modify_time() const;
+  void set_modify_time(int64_t value);
+  private:
+  int64_t _internal_modify_time() const;
+  void _internal_set_modify_time(int64_t value);
+  public:
 
   // bool expanded = 7;
   void clear_expanded();
-  static const int kExpandedFieldNumber = 7;
   bool expanded() const;
   void set_expanded(bool value);
+  private:
+  bool _internal_expanded() const;
+  void _internal_set_expanded(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:aspia.proto.address_book.ComputerGroup)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::RepeatedPtrField< ::aspia::proto::address_book::Computer > computer_;
-  ::google::protobuf::RepeatedPtrField< ::aspia::proto::address_book::ComputerGroup > computer_group_;
-  ::google::protobuf::internal::ArenaStringPtr name_;
-  ::google::protobuf::internal::ArenaStringPtr comment_;
-  ::google::protobuf::int64 create_time_;
-  ::google::protobuf::int64 modify_time_;
-  bool expanded_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_address_5fbook_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::address_book::Computer > computer_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::address_book::ComputerGroup > computer_group_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr comment_;
+    int64_t create_time_;
+    int64_t modify_time_;
+    bool expanded_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_address_5fbook_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Data : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.address_book.Data) */ {
+class Data final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.address_book.Data) */ {
  public:
-  Data();
-  virtual ~Data();
+  inline Data() : Data(nullptr) {}
+  ~Data() override;
+  explicit PROTOBUF_CONSTEXPR Data(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Data(const Data& from);
-
-  inline Data& operator=(const Data& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   Data(Data&& from) noexcept
     : Data() {
     *this = ::std::move(from);
   }
 
+  inline Data& operator=(const Data& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline Data& operator=(Data&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const Data& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const Data& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const Data* internal_default_instance() {
     return reinterpret_cast<const Data*>(
                &_Data_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    3;
+    4;
 
-  void Swap(Data* other);
   friend void swap(Data& a, Data& b) {
     a.Swap(&b);
   }
+  inline void Swap(Data* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Data* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Data* New() const final {
-    return CreateMaybeMessage<Data>(NULL);
-  }
-
-  Data* New(::google::protobuf::Arena* arena) const final {
+  Data* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Data>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const Data& from);
   void MergeFrom(const Data& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(Data* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.address_book.Data";
   }
+  protected:
+  explicit Data(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kSalt1FieldNumber = 1,
+    kSalt2FieldNumber = 3,
+    kRootGroupFieldNumber = 2,
+  };
   // bytes salt1 = 1;
   void clear_salt1();
-  static const int kSalt1FieldNumber = 1;
-  const ::std::string& salt1() const;
-  void set_salt1(const ::std::string& value);
-  #if LANG_CXX11
-  void set_salt1(::std::string&& value);
-  #endif
-  void set_salt1(const char* value);
-  void set_salt1(const void* value, size_t size);
-  ::std::string* mutable_salt1();
-  ::std::string* release_salt1();
-  void set_allocated_salt1(::std::string* salt1);
+  const std::string& salt1() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_salt1(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_salt1();
+  PROTOBUF_NODISCARD std::string* release_salt1();
+  void set_allocated_salt1(std::string* salt1);
+  private:
+  const std::string& _internal_salt1() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_salt1(const std::string& value);
+  std::string* _internal_mutable_salt1();
+  public:
 
   // bytes salt2 = 3;
   void clear_salt2();
-  static const int kSalt2FieldNumber = 3;
-  const ::std::string& salt2() const;
-  void set_salt2(const ::std::string& value);
-  #if LANG_CXX11
-  void set_salt2(::std::string&& value);
-  #endif
-  void set_salt2(const char* value);
-  void set_salt2(const void* value, size_t size);
-  ::std::string* mutable_salt2();
-  ::std::string* release_salt2();
-  void set_allocated_salt2(::std::string* salt2);
+  const std::string& salt2() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_salt2(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_salt2();
+  PROTOBUF_NODISCARD std::string* release_salt2();
+  void set_allocated_salt2(std::string* salt2);
+  private:
+  const std::string& _internal_salt2() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_salt2(const std::string& value);
+  std::string* _internal_mutable_salt2();
+  public:
 
   // .aspia.proto.address_book.ComputerGroup root_group = 2;
   bool has_root_group() const;
-  void clear_root_group();
-  static const int kRootGroupFieldNumber = 2;
   private:
-  const ::aspia::proto::address_book::ComputerGroup& _internal_root_group() const;
+  bool _internal_has_root_group() const;
   public:
+  void clear_root_group();
   const ::aspia::proto::address_book::ComputerGroup& root_group() const;
-  ::aspia::proto::address_book::ComputerGroup* release_root_group();
+  PROTOBUF_NODISCARD ::aspia::proto::address_book::ComputerGroup* release_root_group();
   ::aspia::proto::address_book::ComputerGroup* mutable_root_group();
   void set_allocated_root_group(::aspia::proto::address_book::ComputerGroup* root_group);
+  private:
+  const ::aspia::proto::address_book::ComputerGroup& _internal_root_group() const;
+  ::aspia::proto::address_book::ComputerGroup* _internal_mutable_root_group();
+  public:
+  void unsafe_arena_set_allocated_root_group(
+      ::aspia::proto::address_book::ComputerGroup* root_group);
+  ::aspia::proto::address_book::ComputerGroup* unsafe_arena_release_root_group();
 
   // @@protoc_insertion_point(class_scope:aspia.proto.address_book.Data)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr salt1_;
-  ::google::protobuf::internal::ArenaStringPtr salt2_;
-  ::aspia::proto::address_book::ComputerGroup* root_group_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_address_5fbook_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr salt1_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr salt2_;
+    ::aspia::proto::address_book::ComputerGroup* root_group_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_address_5fbook_2eproto;
 };
 // -------------------------------------------------------------------
 
-class File : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.address_book.File) */ {
+class File final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.address_book.File) */ {
  public:
-  File();
-  virtual ~File();
+  inline File() : File(nullptr) {}
+  ~File() override;
+  explicit PROTOBUF_CONSTEXPR File(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   File(const File& from);
-
-  inline File& operator=(const File& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   File(File&& from) noexcept
     : File() {
     *this = ::std::move(from);
   }
 
+  inline File& operator=(const File& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline File& operator=(File&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const File& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const File& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const File* internal_default_instance() {
     return reinterpret_cast<const File*>(
                &_File_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    4;
+    5;
 
-  void Swap(File* other);
   friend void swap(File& a, File& b) {
     a.Swap(&b);
   }
+  inline void Swap(File* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(File* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline File* New() const final {
-    return CreateMaybeMessage<File>(NULL);
-  }
-
-  File* New(::google::protobuf::Arena* arena) const final {
+  File* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<File>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const File& from);
   void MergeFrom(const File& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(File* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.address_book.File";
   }
+  protected:
+  explicit File(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kHashingSaltFieldNumber = 3,
+    kDataFieldNumber = 9,
+    kEncryptionTypeFieldNumber = 1,
+    kHashingRoundsFieldNumber = 2,
+    kHashingMemoryFieldNumber = 4,
+  };
   // bytes hashing_salt = 3;
   void clear_hashing_salt();
-  static const int kHashingSaltFieldNumber = 3;
-  const ::std::string& hashing_salt() const;
-  void set_hashing_salt(const ::std::string& value);
-  #if LANG_CXX11
-  void set_hashing_salt(::std::string&& value);
-  #endif
-  void set_hashing_salt(const char* value);
-  void set_hashing_salt(const void* value, size_t size);
-  ::std::string* mutable_hashing_salt();
-  ::std::string* release_hashing_salt();
-  void set_allocated_hashing_salt(::std::string* hashing_salt);
+  const std::string& hashing_salt() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_hashing_salt(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_hashing_salt();
+  PROTOBUF_NODISCARD std::string* release_hashing_salt();
+  void set_allocated_hashing_salt(std::string* hashing_salt);
+  private:
+  const std::string& _internal_hashing_salt() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_hashing_salt(const std::string& value);
+  std::string* _internal_mutable_hashing_salt();
+  public:
 
   // bytes data = 9;
   void clear_data();
-  static const int kDataFieldNumber = 9;
-  const ::std::string& data() const;
-  void set_data(const ::std::string& value);
-  #if LANG_CXX11
-  void set_data(::std::string&& value);
-  #endif
-  void set_data(const char* value);
-  void set_data(const void* value, size_t size);
-  ::std::string* mutable_data();
-  ::std::string* release_data();
-  void set_allocated_data(::std::string* data);
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
 
   // .aspia.proto.address_book.EncryptionType encryption_type = 1;
   void clear_encryption_type();
-  static const int kEncryptionTypeFieldNumber = 1;
   ::aspia::proto::address_book::EncryptionType encryption_type() const;
   void set_encryption_type(::aspia::proto::address_book::EncryptionType value);
+  private:
+  ::aspia::proto::address_book::EncryptionType _internal_encryption_type() const;
+  void _internal_set_encryption_type(::aspia::proto::address_book::EncryptionType value);
+  public:
 
   // int32 hashing_rounds = 2;
   void clear_hashing_rounds();
-  static const int kHashingRoundsFieldNumber = 2;
-  ::google::protobuf::int32 hashing_rounds() const;
-  void set_hashing_rounds(::google::protobuf::int32 value);
+  int32_t hashing_rounds() const;
+  void set_hashing_rounds(int32_t value);
+  private:
+  int32_t _internal_hashing_rounds() const;
+  void _internal_set_hashing_rounds(int32_t value);
+  public:
+
+  // uint32 hashing_memory = 4;
+  void clear_hashing_memory();
+  uint32_t hashing_memory() const;
+  void set_hashing_memory(uint32_t value);
+  private:
+  uint32_t _internal_hashing_memory() const;
+  void _internal_set_hashing_memory(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:aspia.proto.address_book.File)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr hashing_salt_;
-  ::google::protobuf::internal::ArenaStringPtr data_;
-  int encryption_type_;
-  ::google::protobuf::int32 hashing_rounds_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_address_5fbook_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr hashing_salt_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    int encryption_type_;
+    int32_t hashing_rounds_;
+    uint32_t hashing_memory_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_address_5fbook_2eproto;
 };
 // ===================================================================
 
@@ -887,99 +1378,382 @@ class File : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(
 // SessionConfig
 
 // .aspia.proto.desktop.Config desktop_manage = 1;
+inline bool SessionConfig::_internal_has_desktop_manage() const {
+  return this != internal_default_instance() && _impl_.desktop_manage_ != nullptr;
+}
 inline bool SessionConfig::has_desktop_manage() const {
-  return this != internal_default_instance() && desktop_manage_ != NULL;
+  return _internal_has_desktop_manage();
 }
 inline const ::aspia::proto::desktop::Config& SessionConfig::_internal_desktop_manage() const {
-  return *desktop_manage_;
+  const ::aspia::proto::desktop::Config* p = _impl_.desktop_manage_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::desktop::Config&>(
+      ::aspia::proto::desktop::_Config_default_instance_);
 }
 inline const ::aspia::proto::desktop::Config& SessionConfig::desktop_manage() const {
-  const ::aspia::proto::desktop::Config* p = desktop_manage_;
   // @@protoc_insertion_point(field_get:aspia.proto.address_book.SessionConfig.desktop_manage)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::desktop::Config*>(
-      &::aspia::proto::desktop::_Config_default_instance_);
+  return _internal_desktop_manage();
+}
+inline void SessionConfig::unsafe_arena_set_allocated_desktop_manage(
+    ::aspia::proto::desktop::Config* desktop_manage) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.desktop_manage_);
+  }
+  _impl_.desktop_manage_ = desktop_manage;
+  if (desktop_manage) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.address_book.SessionConfig.desktop_manage)
 }
 inline ::aspia::proto::desktop::Config* SessionConfig::release_desktop_manage() {
+  
+  ::aspia::proto::desktop::Config* temp = _impl_.desktop_manage_;
+  _impl_.desktop_manage_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::desktop::Config* SessionConfig::unsafe_arena_release_desktop_manage() {
   // @@protoc_insertion_point(field_release:aspia.proto.address_book.SessionConfig.desktop_manage)
   
-  ::aspia::proto::desktop::Config* temp = desktop_manage_;
-  desktop_manage_ = NULL;
+  ::aspia::proto::desktop::Config* temp = _impl_.desktop_manage_;
+  _impl_.desktop_manage_ = nullptr;
+  return temp;
+}
+inline ::aspia::proto::desktop::Config* SessionConfig::_internal_mutable_desktop_manage() {
+  
+  if (_impl_.desktop_manage_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::desktop::Config>(GetArenaForAllocation());
+    _impl_.desktop_manage_ = p;
+  }
+  return _impl_.desktop_manage_;
+}
+inline ::aspia::proto::desktop::Config* SessionConfig::mutable_desktop_manage() {
+  ::aspia::proto::desktop::Config* _msg = _internal_mutable_desktop_manage();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.address_book.SessionConfig.desktop_manage)
+  return _msg;
+}
+inline void SessionConfig::set_allocated_desktop_manage(::aspia::proto::desktop::Config* desktop_manage) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.desktop_manage_);
+  }
+  if (desktop_manage) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(desktop_manage));
+    if (message_arena != submessage_arena) {
+      desktop_manage = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, desktop_manage, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.desktop_manage_ = desktop_manage;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.address_book.SessionConfig.desktop_manage)
+}
+
+// .aspia.proto.desktop.Config desktop_view = 2;
+inline bool SessionConfig::_internal_has_desktop_view() const {
+  return this != internal_default_instance() && _impl_.desktop_view_ != nullptr;
+}
+inline bool SessionConfig::has_desktop_view() const {
+  return _internal_has_desktop_view();
+}
+inline const ::aspia::proto::desktop::Config& SessionConfig::_internal_desktop_view() const {
+  const ::aspia::proto::desktop::Config* p = _impl_.desktop_view_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::desktop::Config&>(
+      ::aspia::proto::desktop::_Config_default_instance_);
+}
+inline const ::aspia::proto::desktop::Config& SessionConfig::desktop_view() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.address_book.SessionConfig.desktop_view)
+  return _internal_desktop_view();
+}
+inline void SessionConfig::unsafe_arena_set_allocated_desktop_view(
+    ::aspia::proto::desktop::Config* desktop_view) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.desktop_view_);
+  }
+  _impl_.desktop_view_ = desktop_view;
+  if (desktop_view) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.address_book.SessionConfig.desktop_view)
+}
+inline ::aspia::proto::desktop::Config* SessionConfig::release_desktop_view() {
+  
+  ::aspia::proto::desktop::Config* temp = _impl_.desktop_view_;
+  _impl_.desktop_view_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::desktop::Config* SessionConfig::unsafe_arena_release_desktop_view() {
+  // @@protoc_insertion_point(field_release:aspia.proto.address_book.SessionConfig.desktop_view)
+  
+  ::aspia::proto::desktop::Config* temp = _impl_.desktop_view_;
+  _impl_.desktop_view_ = nullptr;
+  return temp;
+}
+inline ::aspia::proto::desktop::Config* SessionConfig::_internal_mutable_desktop_view() {
+  
+  if (_impl_.desktop_view_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::desktop::Config>(GetArenaForAllocation());
+    _impl_.desktop_view_ = p;
+  }
+  return _impl_.desktop_view_;
+}
+inline ::aspia::proto::desktop::Config* SessionConfig::mutable_desktop_view() {
+  ::aspia::proto::desktop::Config* _msg = _internal_mutable_desktop_view();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.address_book.SessionConfig.desktop_view)
+  return _msg;
+}
+inline void SessionConfig::set_allocated_desktop_view(::aspia::proto::desktop::Config* desktop_view) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.desktop_view_);
+  }
+  if (desktop_view) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(desktop_view));
+    if (message_arena != submessage_arena) {
+      desktop_view = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, desktop_view, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.desktop_view_ = desktop_view;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.address_book.SessionConfig.desktop_view)
+}
+
+// -------------------------------------------------------------------
+
+// StreamingProfile
+
+// int64 update_time = 1;
+inline void StreamingProfile::clear_update_time() {
+  _impl_.update_time_ = int64_t{0};
+}
+inline int64_t StreamingProfile::_internal_update_time() const {
+  return _impl_.update_time_;
+}
+inline int64_t StreamingProfile::update_time() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.address_book.StreamingProfile.update_time)
+  return _internal_update_time();
+}
+inline void StreamingProfile::_internal_set_update_time(int64_t value) {
+  
+  _impl_.update_time_ = value;
+}
+inline void StreamingProfile::set_update_time(int64_t value) {
+  _internal_set_update_time(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.address_book.StreamingProfile.update_time)
+}
+
+// .aspia.proto.desktop.VideoEncoding video_encoding = 2;
+inline void StreamingProfile::clear_video_encoding() {
+  _impl_.video_encoding_ = 0;
+}
+inline ::aspia::proto::desktop::VideoEncoding StreamingProfile::_internal_video_encoding() const {
+  return static_cast< ::aspia::proto::desktop::VideoEncoding >(_impl_.video_encoding_);
+}
+inline ::aspia::proto::desktop::VideoEncoding StreamingProfile::video_encoding() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.address_book.StreamingProfile.video_encoding)
+  return _internal_video_encoding();
+}
+inline void StreamingProfile::_internal_set_video_encoding(::aspia::proto::desktop::VideoEncoding value) {
+  
+  _impl_.video_encoding_ = value;
+}
+inline void StreamingProfile::set_video_encoding(::aspia::proto::desktop::VideoEncoding value) {
+  _internal_set_video_encoding(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.address_book.StreamingProfile.video_encoding)
+}
+
+// .aspia.proto.desktop.PixelFormat pixel_format = 3;
+inline bool StreamingProfile::_internal_has_pixel_format() const {
+  return this != internal_default_instance() && _impl_.pixel_format_ != nullptr;
+}
+inline bool StreamingProfile::has_pixel_format() const {
+  return _internal_has_pixel_format();
+}
+inline const ::aspia::proto::desktop::PixelFormat& StreamingProfile::_internal_pixel_format() const {
+  const ::aspia::proto::desktop::PixelFormat* p = _impl_.pixel_format_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::desktop::PixelFormat&>(
+      ::aspia::proto::desktop::_PixelFormat_default_instance_);
+}
+inline const ::aspia::proto::desktop::PixelFormat& StreamingProfile::pixel_format() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.address_book.StreamingProfile.pixel_format)
+  return _internal_pixel_format();
+}
+inline void StreamingProfile::unsafe_arena_set_allocated_pixel_format(
+    ::aspia::proto::desktop::PixelFormat* pixel_format) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pixel_format_);
+  }
+  _impl_.pixel_format_ = pixel_format;
+  if (pixel_format) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.address_book.StreamingProfile.pixel_format)
+}
+inline ::aspia::proto::desktop::PixelFormat* StreamingProfile::release_pixel_format() {
+  
+  ::aspia::proto::desktop::PixelFormat* temp = _impl_.pixel_format_;
+  _impl_.pixel_format_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::desktop::PixelFormat* StreamingProfile::unsafe_arena_release_pixel_format() {
+  // @@protoc_insertion_point(field_release:aspia.proto.address_book.StreamingProfile.pixel_format)
+  
+  ::aspia::proto::desktop::PixelFormat* temp = _impl_.pixel_format_;
+  _impl_.pixel_format_ = nullptr;
   return temp;
 }
-inline ::aspia::proto::desktop::Config* SessionConfig::mutable_desktop_manage() {
+inline ::aspia::proto::desktop::PixelFormat* StreamingProfile::_internal_mutable_pixel_format() {
   
-  if (desktop_manage_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::desktop::Config>(GetArenaNoVirtual());
-    desktop_manage_ = p;
+  if (_impl_.pixel_format_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::desktop::PixelFormat>(GetArenaForAllocation());
+    _impl_.pixel_format_ = p;
   }
-  // @@protoc_insertion_point(field_mutable:aspia.proto.address_book.SessionConfig.desktop_manage)
-  return desktop_manage_;
+  return _impl_.pixel_format_;
 }
-inline void SessionConfig::set_allocated_desktop_manage(::aspia::proto::desktop::Config* desktop_manage) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete reinterpret_cast< ::google::protobuf::MessageLite*>(desktop_manage_);
+inline ::aspia::proto::desktop::PixelFormat* StreamingProfile::mutable_pixel_format() {
+  ::aspia::proto::desktop::PixelFormat* _msg = _internal_mutable_pixel_format();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.address_book.StreamingProfile.pixel_format)
+  return _msg;
+}
+inline void StreamingProfile::set_allocated_pixel_format(::aspia::proto::desktop::PixelFormat* pixel_format) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pixel_format_);
   }
-  if (desktop_manage) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+  if (pixel_format) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(pixel_format));
     if (message_arena != submessage_arena) {
-      desktop_manage = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, desktop_manage, submessage_arena);
+      pixel_format = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, pixel_format, submessage_arena);
     }
     
   } else {
     
   }
-  desktop_manage_ = desktop_manage;
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.address_book.SessionConfig.desktop_manage)
+  _impl_.pixel_format_ = pixel_format;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.address_book.StreamingProfile.pixel_format)
 }
 
-// .aspia.proto.desktop.Config desktop_view = 2;
-inline bool SessionConfig::has_desktop_view() const {
-  return this != internal_default_instance() && desktop_view_ != NULL;
+// uint32 compress_ratio = 4;
+inline void StreamingProfile::clear_compress_ratio() {
+  _impl_.compress_ratio_ = 0u;
 }
-inline const ::aspia::proto::desktop::Config& SessionConfig::_internal_desktop_view() const {
-  return *desktop_view_;
+inline uint32_t StreamingProfile::_internal_compress_ratio() const {
+  return _impl_.compress_ratio_;
 }
-inline const ::aspia::proto::desktop::Config& SessionConfig::desktop_view() const {
-  const ::aspia::proto::desktop::Config* p = desktop_view_;
-  // @@protoc_insertion_point(field_get:aspia.proto.address_book.SessionConfig.desktop_view)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::desktop::Config*>(
-      &::aspia::proto::desktop::_Config_default_instance_);
+inline uint32_t StreamingProfile::compress_ratio() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.address_book.StreamingProfile.compress_ratio)
+  return _internal_compress_ratio();
 }
-inline ::aspia::proto::desktop::Config* SessionConfig::release_desktop_view() {
-  // @@protoc_insertion_point(field_release:aspia.proto.address_book.SessionConfig.desktop_view)
+inline void StreamingProfile::_internal_set_compress_ratio(uint32_t value) {
   
-  ::aspia::proto::desktop::Config* temp = desktop_view_;
-  desktop_view_ = NULL;
-  return temp;
+  _impl_.compress_ratio_ = value;
 }
-inline ::aspia::proto::desktop::Config* SessionConfig::mutable_desktop_view() {
+inline void StreamingProfile::set_compress_ratio(uint32_t value) {
+  _internal_set_compress_ratio(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.address_book.StreamingProfile.compress_ratio)
+}
+
+// uint32 bitrate = 5;
+inline void StreamingProfile::clear_bitrate() {
+  _impl_.bitrate_ = 0u;
+}
+inline uint32_t StreamingProfile::_internal_bitrate() const {
+  return _impl_.bitrate_;
+}
+inline uint32_t StreamingProfile::bitrate() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.address_book.StreamingProfile.bitrate)
+  return _internal_bitrate();
+}
+inline void StreamingProfile::_internal_set_bitrate(uint32_t value) {
   
-  if (desktop_view_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::desktop::Config>(GetArenaNoVirtual());
-    desktop_view_ = p;
-  }
-  // @@protoc_insertion_point(field_mutable:aspia.proto.address_book.SessionConfig.desktop_view)
-  return desktop_view_;
+  _impl_.bitrate_ = value;
 }
-inline void SessionConfig::set_allocated_desktop_view(::aspia::proto::desktop::Config* desktop_view) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete reinterpret_cast< ::google::protobuf::MessageLite*>(desktop_view_);
-  }
-  if (desktop_view) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
-    if (message_arena != submessage_arena) {
-      desktop_view = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, desktop_view, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  desktop_view_ = desktop_view;
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.address_book.SessionConfig.desktop_view)
+inline void StreamingProfile::set_bitrate(uint32_t value) {
+  _internal_set_bitrate(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.address_book.StreamingProfile.bitrate)
+}
+
+// int64 min_round_trip_time = 6;
+inline void StreamingProfile::clear_min_round_trip_time() {
+  _impl_.min_round_trip_time_ = int64_t{0};
+}
+inline int64_t StreamingProfile::_internal_min_round_trip_time() const {
+  return _impl_.min_round_trip_time_;
+}
+inline int64_t StreamingProfile::min_round_trip_time() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.address_book.StreamingProfile.min_round_trip_time)
+  return _internal_min_round_trip_time();
+}
+inline void StreamingProfile::_internal_set_min_round_trip_time(int64_t value) {
+  
+  _impl_.min_round_trip_time_ = value;
+}
+inline void StreamingProfile::set_min_round_trip_time(int64_t value) {
+  _internal_set_min_round_trip_time(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.address_book.StreamingProfile.min_round_trip_time)
+}
+
+// int32 upgrade_samples = 7;
+inline void StreamingProfile::clear_upgrade_samples() {
+  _impl_.upgrade_samples_ = 0;
+}
+inline int32_t StreamingProfile::_internal_upgrade_samples() const {
+  return _impl_.upgrade_samples_;
+}
+inline int32_t StreamingProfile::upgrade_samples() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.address_book.StreamingProfile.upgrade_samples)
+  return _internal_upgrade_samples();
+}
+inline void StreamingProfile::_internal_set_upgrade_samples(int32_t value) {
+  
+  _impl_.upgrade_samples_ = value;
+}
+inline void StreamingProfile::set_upgrade_samples(int32_t value) {
+  _internal_set_upgrade_samples(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.address_book.StreamingProfile.upgrade_samples)
 }
 
 // -------------------------------------------------------------------
@@ -988,602 +1762,850 @@ inline void SessionConfig::set_allocated_desktop_view(::aspia::proto::desktop::C
 
 // int64 create_time = 1;
 inline void Computer::clear_create_time() {
-  create_time_ = GOOGLE_LONGLONG(0);
+  _impl_.create_time_ = int64_t{0};
 }
-inline ::google::protobuf::int64 Computer::create_time() const {
+inline int64_t Computer::_internal_create_time() const {
+  return _impl_.create_time_;
+}
+inline int64_t Computer::create_time() const {
   // @@protoc_insertion_point(field_get:aspia.proto.address_book.Computer.create_time)
-  return create_time_;
+  return _internal_create_time();
 }
-inline void Computer::set_create_time(::google::protobuf::int64 value) {
+inline void Computer::_internal_set_create_time(int64_t value) {
   
-  create_time_ = value;
+  _impl_.create_time_ = value;
+}
+inline void Computer::set_create_time(int64_t value) {
+  _internal_set_create_time(value);
   // @@protoc_insertion_point(field_set:aspia.proto.address_book.Computer.create_time)
 }
 
 // int64 modify_time = 2;
 inline void Computer::clear_modify_time() {
-  modify_time_ = GOOGLE_LONGLONG(0);
+  _impl_.modify_time_ = int64_t{0};
 }
-inline ::google::protobuf::int64 Computer::modify_time() const {
+inline int64_t Computer::_internal_modify_time() const {
+  return _impl_.modify_time_;
+}
+inline int64_t Computer::modify_time() const {
   // @@protoc_insertion_point(field_get:aspia.proto.address_book.Computer.modify_time)
-  return modify_time_;
+  return _internal_modify_time();
 }
-inline void Computer::set_modify_time(::google::protobuf::int64 value) {
+inline void Computer::_internal_set_modify_time(int64_t value) {
   
-  modify_time_ = value;
+  _impl_.modify_time_ = value;
+}
+inline void Computer::set_modify_time(int64_t value) {
+  _internal_set_modify_time(value);
   // @@protoc_insertion_point(field_set:aspia.proto.address_book.Computer.modify_time)
 }
 
 // int64 connect_time = 3;
 inline void Computer::clear_connect_time() {
-  connect_time_ = GOOGLE_LONGLONG(0);
+  _impl_.connect_time_ = int64_t{0};
 }
-inline ::google::protobuf::int64 Computer::connect_time() const {
+inline int64_t Computer::_internal_connect_time() const {
+  return _impl_.connect_time_;
+}
+inline int64_t Computer::connect_time() const {
   // @@protoc_insertion_point(field_get:aspia.proto.address_book.Computer.connect_time)
-  return connect_time_;
+  return _internal_connect_time();
 }
-inline void Computer::set_connect_time(::google::protobuf::int64 value) {
+inline void Computer::_internal_set_connect_time(int64_t value) {
   
-  connect_time_ = value;
+  _impl_.connect_time_ = value;
+}
+inline void Computer::set_connect_time(int64_t value) {
+  _internal_set_connect_time(value);
   // @@protoc_insertion_point(field_set:aspia.proto.address_book.Computer.connect_time)
 }
 
 // string name = 4;
 inline void Computer::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.name_.ClearToEmpty();
 }
-inline const ::std::string& Computer::name() const {
+inline const std::string& Computer::name() const {
   // @@protoc_insertion_point(field_get:aspia.proto.address_book.Computer.name)
-  return name_.GetNoArena();
+  return _internal_name();
 }
-inline void Computer::set_name(const ::std::string& value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Computer::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:aspia.proto.address_book.Computer.name)
 }
-#if LANG_CXX11
-inline void Computer::set_name(::std::string&& value) {
-  
-  name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.address_book.Computer.name)
+inline std::string* Computer::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.address_book.Computer.name)
+  return _s;
 }
-#endif
-inline void Computer::set_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.address_book.Computer.name)
+inline const std::string& Computer::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline void Computer::set_name(const char* value, size_t size) {
+inline void Computer::_internal_set_name(const std::string& value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.address_book.Computer.name)
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* Computer::mutable_name() {
+inline std::string* Computer::_internal_mutable_name() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.address_book.Computer.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* Computer::release_name() {
+inline std::string* Computer::release_name() {
   // @@protoc_insertion_point(field_release:aspia.proto.address_book.Computer.name)
-  
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Release();
 }
-inline void Computer::set_allocated_name(::std::string* name) {
-  if (name != NULL) {
+inline void Computer::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.address_book.Computer.name)
 }
 
 // string comment = 5;
 inline void Computer::clear_comment() {
-  comment_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.comment_.ClearToEmpty();
 }
-inline const ::std::string& Computer::comment() const {
+inline const std::string& Computer::comment() const {
   // @@protoc_insertion_point(field_get:aspia.proto.address_book.Computer.comment)
-  return comment_.GetNoArena();
+  return _internal_comment();
 }
-inline void Computer::set_comment(const ::std::string& value) {
-  
-  comment_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Computer::set_comment(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.comment_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:aspia.proto.address_book.Computer.comment)
 }
-#if LANG_CXX11
-inline void Computer::set_comment(::std::string&& value) {
-  
-  comment_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.address_book.Computer.comment)
+inline std::string* Computer::mutable_comment() {
+  std::string* _s = _internal_mutable_comment();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.address_book.Computer.comment)
+  return _s;
 }
-#endif
-inline void Computer::set_comment(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  comment_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.address_book.Computer.comment)
+inline const std::string& Computer::_internal_comment() const {
+  return _impl_.comment_.Get();
 }
-inline void Computer::set_comment(const char* value, size_t size) {
+inline void Computer::_internal_set_comment(const std::string& value) {
   
-  comment_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.address_book.Computer.comment)
+  _impl_.comment_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* Computer::mutable_comment() {
+inline std::string* Computer::_internal_mutable_comment() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.address_book.Computer.comment)
-  return comment_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.comment_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* Computer::release_comment() {
+inline std::string* Computer::release_comment() {
   // @@protoc_insertion_point(field_release:aspia.proto.address_book.Computer.comment)
-  
-  return comment_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.comment_.Release();
 }
-inline void Computer::set_allocated_comment(::std::string* comment) {
-  if (comment != NULL) {
+inline void Computer::set_allocated_comment(std::string* comment) {
+  if (comment != nullptr) {
     
   } else {
     
   }
-  comment_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), comment);
+  _impl_.comment_.SetAllocated(comment, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.comment_.IsDefault()) {
+    _impl_.comment_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.address_book.Computer.comment)
 }
 
 // string address = 6;
 inline void Computer::clear_address() {
-  address_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.address_.ClearToEmpty();
 }
-inline const ::std::string& Computer::address() const {
+inline const std::string& Computer::address() const {
   // @@protoc_insertion_point(field_get:aspia.proto.address_book.Computer.address)
-  return address_.GetNoArena();
+  return _internal_address();
 }
-inline void Computer::set_address(const ::std::string& value) {
-  
-  address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Computer::set_address(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.address_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:aspia.proto.address_book.Computer.address)
 }
-#if LANG_CXX11
-inline void Computer::set_address(::std::string&& value) {
-  
-  address_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.address_book.Computer.address)
+inline std::string* Computer::mutable_address() {
+  std::string* _s = _internal_mutable_address();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.address_book.Computer.address)
+  return _s;
 }
-#endif
-inline void Computer::set_address(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.address_book.Computer.address)
+inline const std::string& Computer::_internal_address() const {
+  return _impl_.address_.Get();
 }
-inline void Computer::set_address(const char* value, size_t size) {
+inline void Computer::_internal_set_address(const std::string& value) {
   
-  address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.address_book.Computer.address)
+  _impl_.address_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* Computer::mutable_address() {
+inline std::string* Computer::_internal_mutable_address() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.address_book.Computer.address)
-  return address_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.address_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* Computer::release_address() {
+inline std::string* Computer::release_address() {
   // @@protoc_insertion_point(field_release:aspia.proto.address_book.Computer.address)
-  
-  return address_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.address_.Release();
 }
-inline void Computer::set_allocated_address(::std::string* address) {
-  if (address != NULL) {
+inline void Computer::set_allocated_address(std::string* address) {
+  if (address != nullptr) {
     
   } else {
     
   }
-  address_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), address);
+  _impl_.address_.SetAllocated(address, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.address_.IsDefault()) {
+    _impl_.address_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.address_book.Computer.address)
 }
 
 // uint32 port = 7;
 inline void Computer::clear_port() {
-  port_ = 0u;
+  _impl_.port_ = 0u;
 }
-inline ::google::protobuf::uint32 Computer::port() const {
+inline uint32_t Computer::_internal_port() const {
+  return _impl_.port_;
+}
+inline uint32_t Computer::port() const {
   // @@protoc_insertion_point(field_get:aspia.proto.address_book.Computer.port)
-  return port_;
+  return _internal_port();
 }
-inline void Computer::set_port(::google::protobuf::uint32 value) {
+inline void Computer::_internal_set_port(uint32_t value) {
   
-  port_ = value;
+  _impl_.port_ = value;
+}
+inline void Computer::set_port(uint32_t value) {
+  _internal_set_port(value);
   // @@protoc_insertion_point(field_set:aspia.proto.address_book.Computer.port)
 }
 
 // string username = 8;
 inline void Computer::clear_username() {
-  username_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.username_.ClearToEmpty();
 }
-inline const ::std::string& Computer::username() const {
+inline const std::string& Computer::username() const {
   // @@protoc_insertion_point(field_get:aspia.proto.address_book.Computer.username)
-  return username_.GetNoArena();
+  return _internal_username();
 }
-inline void Computer::set_username(const ::std::string& value) {
-  
-  username_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Computer::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:aspia.proto.address_book.Computer.username)
 }
-#if LANG_CXX11
-inline void Computer::set_username(::std::string&& value) {
-  
-  username_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.address_book.Computer.username)
+inline std::string* Computer::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.address_book.Computer.username)
+  return _s;
 }
-#endif
-inline void Computer::set_username(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  username_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.address_book.Computer.username)
+inline const std::string& Computer::_internal_username() const {
+  return _impl_.username_.Get();
 }
-inline void Computer::set_username(const char* value, size_t size) {
+inline void Computer::_internal_set_username(const std::string& value) {
   
-  username_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.address_book.Computer.username)
+  _impl_.username_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* Computer::mutable_username() {
+inline std::string* Computer::_internal_mutable_username() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.address_book.Computer.username)
-  return username_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.username_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* Computer::release_username() {
+inline std::string* Computer::release_username() {
   // @@protoc_insertion_point(field_release:aspia.proto.address_book.Computer.username)
-  
-  return username_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.username_.Release();
 }
-inline void Computer::set_allocated_username(::std::string* username) {
-  if (username != NULL) {
+inline void Computer::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
     
   } else {
     
   }
-  username_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), username);
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.address_book.Computer.username)
 }
 
 // string password = 9;
 inline void Computer::clear_password() {
-  password_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.password_.ClearToEmpty();
 }
-inline const ::std::string& Computer::password() const {
+inline const std::string& Computer::password() const {
   // @@protoc_insertion_point(field_get:aspia.proto.address_book.Computer.password)
-  return password_.GetNoArena();
+  return _internal_password();
 }
-inline void Computer::set_password(const ::std::string& value) {
-  
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Computer::set_password(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.password_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:aspia.proto.address_book.Computer.password)
 }
-#if LANG_CXX11
-inline void Computer::set_password(::std::string&& value) {
-  
-  password_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.address_book.Computer.password)
+inline std::string* Computer::mutable_password() {
+  std::string* _s = _internal_mutable_password();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.address_book.Computer.password)
+  return _s;
 }
-#endif
-inline void Computer::set_password(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.address_book.Computer.password)
+inline const std::string& Computer::_internal_password() const {
+  return _impl_.password_.Get();
 }
-inline void Computer::set_password(const char* value, size_t size) {
+inline void Computer::_internal_set_password(const std::string& value) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.address_book.Computer.password)
+  _impl_.password_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* Computer::mutable_password() {
+inline std::string* Computer::_internal_mutable_password() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.address_book.Computer.password)
-  return password_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.password_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* Computer::release_password() {
+inline std::string* Computer::release_password() {
   // @@protoc_insertion_point(field_release:aspia.proto.address_book.Computer.password)
-  
-  return password_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.password_.Release();
 }
-inline void Computer::set_allocated_password(::std::string* password) {
-  if (password != NULL) {
+inline void Computer::set_allocated_password(std::string* password) {
+  if (password != nullptr) {
     
   } else {
     
   }
-  password_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), password);
+  _impl_.password_.SetAllocated(password, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.password_.IsDefault()) {
+    _impl_.password_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.address_book.Computer.password)
 }
 
 // .aspia.proto.auth.SessionType session_type = 16;
 inline void Computer::clear_session_type() {
-  session_type_ = 0;
+  _impl_.session_type_ = 0;
+}
+inline ::aspia::proto::auth::SessionType Computer::_internal_session_type() const {
+  return static_cast< ::aspia::proto::auth::SessionType >(_impl_.session_type_);
 }
 inline ::aspia::proto::auth::SessionType Computer::session_type() const {
   // @@protoc_insertion_point(field_get:aspia.proto.address_book.Computer.session_type)
-  return static_cast< ::aspia::proto::auth::SessionType >(session_type_);
+  return _internal_session_type();
 }
-inline void Computer::set_session_type(::aspia::proto::auth::SessionType value) {
+inline void Computer::_internal_set_session_type(::aspia::proto::auth::SessionType value) {
   
-  session_type_ = value;
+  _impl_.session_type_ = value;
+}
+inline void Computer::set_session_type(::aspia::proto::auth::SessionType value) {
+  _internal_set_session_type(value);
   // @@protoc_insertion_point(field_set:aspia.proto.address_book.Computer.session_type)
 }
 
 // .aspia.proto.address_book.SessionConfig session_config = 17;
+inline bool Computer::_internal_has_session_config() const {
+  return this != internal_default_instance() && _impl_.session_config_ != nullptr;
+}
 inline bool Computer::has_session_config() const {
-  return this != internal_default_instance() && session_config_ != NULL;
+  return _internal_has_session_config();
 }
 inline void Computer::clear_session_config() {
-  if (GetArenaNoVirtual() == NULL && session_config_ != NULL) {
-    delete session_config_;
+  if (GetArenaForAllocation() == nullptr && _impl_.session_config_ != nullptr) {
+    delete _impl_.session_config_;
   }
-  session_config_ = NULL;
+  _impl_.session_config_ = nullptr;
 }
 inline const ::aspia::proto::address_book::SessionConfig& Computer::_internal_session_config() const {
-  return *session_config_;
+  const ::aspia::proto::address_book::SessionConfig* p = _impl_.session_config_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::address_book::SessionConfig&>(
+      ::aspia::proto::address_book::_SessionConfig_default_instance_);
 }
 inline const ::aspia::proto::address_book::SessionConfig& Computer::session_config() const {
-  const ::aspia::proto::address_book::SessionConfig* p = session_config_;
   // @@protoc_insertion_point(field_get:aspia.proto.address_book.Computer.session_config)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::address_book::SessionConfig*>(
-      &::aspia::proto::address_book::_SessionConfig_default_instance_);
+  return _internal_session_config();
+}
+inline void Computer::unsafe_arena_set_allocated_session_config(
+    ::aspia::proto::address_book::SessionConfig* session_config) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.session_config_);
+  }
+  _impl_.session_config_ = session_config;
+  if (session_config) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.address_book.Computer.session_config)
 }
 inline ::aspia::proto::address_book::SessionConfig* Computer::release_session_config() {
+  
+  ::aspia::proto::address_book::SessionConfig* temp = _impl_.session_config_;
+  _impl_.session_config_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::address_book::SessionConfig* Computer::unsafe_arena_release_session_config() {
   // @@protoc_insertion_point(field_release:aspia.proto.address_book.Computer.session_config)
   
-  ::aspia::proto::address_book::SessionConfig* temp = session_config_;
-  session_config_ = NULL;
+  ::aspia::proto::address_book::SessionConfig* temp = _impl_.session_config_;
+  _impl_.session_config_ = nullptr;
   return temp;
 }
-inline ::aspia::proto::address_book::SessionConfig* Computer::mutable_session_config() {
+inline ::aspia::proto::address_book::SessionConfig* Computer::_internal_mutable_session_config() {
   
-  if (session_config_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::address_book::SessionConfig>(GetArenaNoVirtual());
-    session_config_ = p;
+  if (_impl_.session_config_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::address_book::SessionConfig>(GetArenaForAllocation());
+    _impl_.session_config_ = p;
   }
+  return _impl_.session_config_;
+}
+inline ::aspia::proto::address_book::SessionConfig* Computer::mutable_session_config() {
+  ::aspia::proto::address_book::SessionConfig* _msg = _internal_mutable_session_config();
   // @@protoc_insertion_point(field_mutable:aspia.proto.address_book.Computer.session_config)
-  return session_config_;
+  return _msg;
 }
 inline void Computer::set_allocated_session_config(::aspia::proto::address_book::SessionConfig* session_config) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete session_config_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.session_config_;
   }
   if (session_config) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(session_config);
     if (message_arena != submessage_arena) {
-      session_config = ::google::protobuf::internal::GetOwnedMessage(
+      session_config = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, session_config, submessage_arena);
     }
     
   } else {
     
   }
-  session_config_ = session_config;
+  _impl_.session_config_ = session_config;
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.address_book.Computer.session_config)
 }
 
+// repeated string alternate_addresses = 18;
+inline int Computer::_internal_alternate_addresses_size() const {
+  return _impl_.alternate_addresses_.size();
+}
+inline int Computer::alternate_addresses_size() const {
+  return _internal_alternate_addresses_size();
+}
+inline void Computer::clear_alternate_addresses() {
+  _impl_.alternate_addresses_.Clear();
+}
+inline std::string* Computer::add_alternate_addresses() {
+  std::string* _s = _internal_add_alternate_addresses();
+  // @@protoc_insertion_point(field_add_mutable:aspia.proto.address_book.Computer.alternate_addresses)
+  return _s;
+}
+inline const std::string& Computer::_internal_alternate_addresses(int index) const {
+  return _impl_.alternate_addresses_.Get(index);
+}
+inline const std::string& Computer::alternate_addresses(int index) const {
+  // @@protoc_insertion_point(field_get:aspia.proto.address_book.Computer.alternate_addresses)
+  return _internal_alternate_addresses(index);
+}
+inline std::string* Computer::mutable_alternate_addresses(int index) {
+  // @@protoc_insertion_point(field_mutable:aspia.proto.address_book.Computer.alternate_addresses)
+  return _impl_.alternate_addresses_.Mutable(index);
+}
+inline void Computer::set_alternate_addresses(int index, const std::string& value) {
+  _impl_.alternate_addresses_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.address_book.Computer.alternate_addresses)
+}
+inline void Computer::set_alternate_addresses(int index, std::string&& value) {
+  _impl_.alternate_addresses_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:aspia.proto.address_book.Computer.alternate_addresses)
+}
+inline void Computer::set_alternate_addresses(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.alternate_addresses_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:aspia.proto.address_book.Computer.alternate_addresses)
+}
+inline void Computer::set_alternate_addresses(int index, const char* value, size_t size) {
+  _impl_.alternate_addresses_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:aspia.proto.address_book.Computer.alternate_addresses)
+}
+inline std::string* Computer::_internal_add_alternate_addresses() {
+  return _impl_.alternate_addresses_.Add();
+}
+inline void Computer::add_alternate_addresses(const std::string& value) {
+  _impl_.alternate_addresses_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:aspia.proto.address_book.Computer.alternate_addresses)
+}
+inline void Computer::add_alternate_addresses(std::string&& value) {
+  _impl_.alternate_addresses_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:aspia.proto.address_book.Computer.alternate_addresses)
+}
+inline void Computer::add_alternate_addresses(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.alternate_addresses_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:aspia.proto.address_book.Computer.alternate_addresses)
+}
+inline void Computer::add_alternate_addresses(const char* value, size_t size) {
+  _impl_.alternate_addresses_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:aspia.proto.address_book.Computer.alternate_addresses)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+Computer::alternate_addresses() const {
+  // @@protoc_insertion_point(field_list:aspia.proto.address_book.Computer.alternate_addresses)
+  return _impl_.alternate_addresses_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+Computer::mutable_alternate_addresses() {
+  // @@protoc_insertion_point(field_mutable_list:aspia.proto.address_book.Computer.alternate_addresses)
+  return &_impl_.alternate_addresses_;
+}
+
+// .aspia.proto.address_book.StreamingProfile streaming_profile = 19;
+inline bool Computer::_internal_has_streaming_profile() const {
+  return this != internal_default_instance() && _impl_.streaming_profile_ != nullptr;
+}
+inline bool Computer::has_streaming_profile() const {
+  return _internal_has_streaming_profile();
+}
+inline void Computer::clear_streaming_profile() {
+  if (GetArenaForAllocation() == nullptr && _impl_.streaming_profile_ != nullptr) {
+    delete _impl_.streaming_profile_;
+  }
+  _impl_.streaming_profile_ = nullptr;
+}
+inline const ::aspia::proto::address_book::StreamingProfile& Computer::_internal_streaming_profile() const {
+  const ::aspia::proto::address_book::StreamingProfile* p = _impl_.streaming_profile_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::address_book::StreamingProfile&>(
+      ::aspia::proto::address_book::_StreamingProfile_default_instance_);
+}
+inline const ::aspia::proto::address_book::StreamingProfile& Computer::streaming_profile() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.address_book.Computer.streaming_profile)
+  return _internal_streaming_profile();
+}
+inline void Computer::unsafe_arena_set_allocated_streaming_profile(
+    ::aspia::proto::address_book::StreamingProfile* streaming_profile) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.streaming_profile_);
+  }
+  _impl_.streaming_profile_ = streaming_profile;
+  if (streaming_profile) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.address_book.Computer.streaming_profile)
+}
+inline ::aspia::proto::address_book::StreamingProfile* Computer::release_streaming_profile() {
+  
+  ::aspia::proto::address_book::StreamingProfile* temp = _impl_.streaming_profile_;
+  _impl_.streaming_profile_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::address_book::StreamingProfile* Computer::unsafe_arena_release_streaming_profile() {
+  // @@protoc_insertion_point(field_release:aspia.proto.address_book.Computer.streaming_profile)
+  
+  ::aspia::proto::address_book::StreamingProfile* temp = _impl_.streaming_profile_;
+  _impl_.streaming_profile_ = nullptr;
+  return temp;
+}
+inline ::aspia::proto::address_book::StreamingProfile* Computer::_internal_mutable_streaming_profile() {
+  
+  if (_impl_.streaming_profile_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::address_book::StreamingProfile>(GetArenaForAllocation());
+    _impl_.streaming_profile_ = p;
+  }
+  return _impl_.streaming_profile_;
+}
+inline ::aspia::proto::address_book::StreamingProfile* Computer::mutable_streaming_profile() {
+  ::aspia::proto::address_book::StreamingProfile* _msg = _internal_mutable_streaming_profile();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.address_book.Computer.streaming_profile)
+  return _msg;
+}
+inline void Computer::set_allocated_streaming_profile(::aspia::proto::address_book::StreamingProfile* streaming_profile) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.streaming_profile_;
+  }
+  if (streaming_profile) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(streaming_profile);
+    if (message_arena != submessage_arena) {
+      streaming_profile = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, streaming_profile, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.streaming_profile_ = streaming_profile;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.address_book.Computer.streaming_profile)
+}
+
 // -------------------------------------------------------------------
 
 // ComputerGroup
 
 // int64 create_time = 1;
 inline void ComputerGroup::clear_create_time() {
-  create_time_ = GOOGLE_LONGLONG(0);
+  _impl_.create_time_ = int64_t{0};
+}
+inline int64_t ComputerGroup::_internal_create_time() const {
+  return _impl_.create_time_;
 }
-inline ::google::protobuf::int64 ComputerGroup::create_time() const {
+inline int64_t ComputerGroup::create_time() const {
   // @@protoc_insertion_point(field_get:aspia.proto.address_book.ComputerGroup.create_time)
-  return create_time_;
+  return _internal_create_time();
 }
-inline void ComputerGroup::set_create_time(::google::protobuf::int64 value) {
+inline void ComputerGroup::_internal_set_create_time(int64_t value) {
   
-  create_time_ = value;
+  _impl_.create_time_ = value;
+}
+inline void ComputerGroup::set_create_time(int64_t value) {
+  _internal_set_create_time(value);
   // @@protoc_insertion_point(field_set:aspia.proto.address_book.ComputerGroup.create_time)
 }
 
 // int64 modify_time = 2;
 inline void ComputerGroup::clear_modify_time() {
-  modify_time_ = GOOGLE_LONGLONG(0);
+  _impl_.modify_time_ = int64_t{0};
+}
+inline int64_t ComputerGroup::_internal_modify_time() const {
+  return _impl_.modify_time_;
 }
-inline ::google::protobuf::int64 ComputerGroup::modify_time() const {
+inline int64_t ComputerGroup::modify_time() const {
   // @@protoc_insertion_point(field_get:aspia.proto.address_book.ComputerGroup.modify_time)
-  return modify_time_;
+  return _internal_modify_time();
 }
-inline void ComputerGroup::set_modify_time(::google::protobuf::int64 value) {
+inline void ComputerGroup::_internal_set_modify_time(int64_t value) {
   
-  modify_time_ = value;
+  _impl_.modify_time_ = value;
+}
+inline void ComputerGroup::set_modify_time(int64_t value) {
+  _internal_set_modify_time(value);
   // @@protoc_insertion_point(field_set:aspia.proto.address_book.ComputerGroup.modify_time)
 }
 
 // repeated .aspia.proto.address_book.Computer computer = 3;
+inline int ComputerGroup::_internal_computer_size() const {
+  return _impl_.computer_.size();
+}
 inline int ComputerGroup::computer_size() const {
-  return computer_.size();
+  return _internal_computer_size();
 }
 inline void ComputerGroup::clear_computer() {
-  computer_.Clear();
+  _impl_.computer_.Clear();
 }
 inline ::aspia::proto::address_book::Computer* ComputerGroup::mutable_computer(int index) {
   // @@protoc_insertion_point(field_mutable:aspia.proto.address_book.ComputerGroup.computer)
-  return computer_.Mutable(index);
+  return _impl_.computer_.Mutable(index);
 }
-inline ::google::protobuf::RepeatedPtrField< ::aspia::proto::address_book::Computer >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::address_book::Computer >*
 ComputerGroup::mutable_computer() {
   // @@protoc_insertion_point(field_mutable_list:aspia.proto.address_book.ComputerGroup.computer)
-  return &computer_;
+  return &_impl_.computer_;
+}
+inline const ::aspia::proto::address_book::Computer& ComputerGroup::_internal_computer(int index) const {
+  return _impl_.computer_.Get(index);
 }
 inline const ::aspia::proto::address_book::Computer& ComputerGroup::computer(int index) const {
   // @@protoc_insertion_point(field_get:aspia.proto.address_book.ComputerGroup.computer)
-  return computer_.Get(index);
+  return _internal_computer(index);
+}
+inline ::aspia::proto::address_book::Computer* ComputerGroup::_internal_add_computer() {
+  return _impl_.computer_.Add();
 }
 inline ::aspia::proto::address_book::Computer* ComputerGroup::add_computer() {
+  ::aspia::proto::address_book::Computer* _add = _internal_add_computer();
   // @@protoc_insertion_point(field_add:aspia.proto.address_book.ComputerGroup.computer)
-  return computer_.Add();
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::aspia::proto::address_book::Computer >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::address_book::Computer >&
 ComputerGroup::computer() const {
   // @@protoc_insertion_point(field_list:aspia.proto.address_book.ComputerGroup.computer)
-  return computer_;
+  return _impl_.computer_;
 }
 
 // repeated .aspia.proto.address_book.ComputerGroup computer_group = 4;
+inline int ComputerGroup::_internal_computer_group_size() const {
+  return _impl_.computer_group_.size();
+}
 inline int ComputerGroup::computer_group_size() const {
-  return computer_group_.size();
+  return _internal_computer_group_size();
 }
 inline void ComputerGroup::clear_computer_group() {
-  computer_group_.Clear();
+  _impl_.computer_group_.Clear();
 }
 inline ::aspia::proto::address_book::ComputerGroup* ComputerGroup::mutable_computer_group(int index) {
   // @@protoc_insertion_point(field_mutable:aspia.proto.address_book.ComputerGroup.computer_group)
-  return computer_group_.Mutable(index);
+  return _impl_.computer_group_.Mutable(index);
 }
-inline ::google::protobuf::RepeatedPtrField< ::aspia::proto::address_book::ComputerGroup >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::address_book::ComputerGroup >*
 ComputerGroup::mutable_computer_group() {
   // @@protoc_insertion_point(field_mutable_list:aspia.proto.address_book.ComputerGroup.computer_group)
-  return &computer_group_;
+  return &_impl_.computer_group_;
+}
+inline const ::aspia::proto::address_book::ComputerGroup& ComputerGroup::_internal_computer_group(int index) const {
+  return _impl_.computer_group_.Get(index);
 }
 inline const ::aspia::proto::address_book::ComputerGroup& ComputerGroup::computer_group(int index) const {
   // @@protoc_insertion_point(field_get:aspia.proto.address_book.ComputerGroup.computer_group)
-  return computer_group_.Get(index);
+  return _internal_computer_group(index);
+}
+inline ::aspia::proto::address_book::ComputerGroup* ComputerGroup::_internal_add_computer_group() {
+  return _impl_.computer_group_.Add();
 }
 inline ::aspia::proto::address_book::ComputerGroup* ComputerGroup::add_computer_group() {
+  ::aspia::proto::address_book::ComputerGroup* _add = _internal_add_computer_group();
   // @@protoc_insertion_point(field_add:aspia.proto.address_book.ComputerGroup.computer_group)
-  return computer_group_.Add();
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::aspia::proto::address_book::ComputerGroup >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::address_book::ComputerGroup >&
 ComputerGroup::computer_group() const {
   // @@protoc_insertion_point(field_list:aspia.proto.address_book.ComputerGroup.computer_group)
-  return computer_group_;
+  return _impl_.computer_group_;
 }
 
 // string name = 5;
 inline void ComputerGroup::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.name_.ClearToEmpty();
 }
-inline const ::std::string& ComputerGroup::name() const {
+inline const std::string& ComputerGroup::name() const {
   // @@protoc_insertion_point(field_get:aspia.proto.address_book.ComputerGroup.name)
-  return name_.GetNoArena();
+  return _internal_name();
 }
-inline void ComputerGroup::set_name(const ::std::string& value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ComputerGroup::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:aspia.proto.address_book.ComputerGroup.name)
 }
-#if LANG_CXX11
-inline void ComputerGroup::set_name(::std::string&& value) {
-  
-  name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.address_book.ComputerGroup.name)
+inline std::string* ComputerGroup::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.address_book.ComputerGroup.name)
+  return _s;
 }
-#endif
-inline void ComputerGroup::set_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.address_book.ComputerGroup.name)
+inline const std::string& ComputerGroup::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline void ComputerGroup::set_name(const char* value, size_t size) {
+inline void ComputerGroup::_internal_set_name(const std::string& value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.address_book.ComputerGroup.name)
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* ComputerGroup::mutable_name() {
+inline std::string* ComputerGroup::_internal_mutable_name() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.address_book.ComputerGroup.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* ComputerGroup::release_name() {
+inline std::string* ComputerGroup::release_name() {
   // @@protoc_insertion_point(field_release:aspia.proto.address_book.ComputerGroup.name)
-  
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Release();
 }
-inline void ComputerGroup::set_allocated_name(::std::string* name) {
-  if (name != NULL) {
+inline void ComputerGroup::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.address_book.ComputerGroup.name)
 }
 
 // string comment = 6;
 inline void ComputerGroup::clear_comment() {
-  comment_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.comment_.ClearToEmpty();
 }
-inline const ::std::string& ComputerGroup::comment() const {
+inline const std::string& ComputerGroup::comment() const {
   // @@protoc_insertion_point(field_get:aspia.proto.address_book.ComputerGroup.comment)
-  return comment_.GetNoArena();
+  return _internal_comment();
 }
-inline void ComputerGroup::set_comment(const ::std::string& value) {
-  
-  comment_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ComputerGroup::set_comment(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.comment_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:aspia.proto.address_book.ComputerGroup.comment)
 }
-#if LANG_CXX11
-inline void ComputerGroup::set_comment(::std::string&& value) {
-  
-  comment_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.address_book.ComputerGroup.comment)
+inline std::string* ComputerGroup::mutable_comment() {
+  std::string* _s = _internal_mutable_comment();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.address_book.ComputerGroup.comment)
+  return _s;
 }
-#endif
-inline void ComputerGroup::set_comment(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  comment_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.address_book.ComputerGroup.comment)
+inline const std::string& ComputerGroup::_internal_comment() const {
+  return _impl_.comment_.Get();
 }
-inline void ComputerGroup::set_comment(const char* value, size_t size) {
+inline void ComputerGroup::_internal_set_comment(const std::string& value) {
   
-  comment_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.address_book.ComputerGroup.comment)
+  _impl_.comment_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* ComputerGroup::mutable_comment() {
+inline std::string* ComputerGroup::_internal_mutable_comment() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.address_book.ComputerGroup.comment)
-  return comment_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.comment_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* ComputerGroup::release_comment() {
+inline std::string* ComputerGroup::release_comment() {
   // @@protoc_insertion_point(field_release:aspia.proto.address_book.ComputerGroup.comment)
-  
-  return comment_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.comment_.Release();
 }
-inline void ComputerGroup::set_allocated_comment(::std::string* comment) {
-  if (comment != NULL) {
+inline void ComputerGroup::set_allocated_comment(std::string* comment) {
+  if (comment != nullptr) {
     
   } else {
     
   }
-  comment_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), comment);
+  _impl_.comment_.SetAllocated(comment, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.comment_.IsDefault()) {
+    _impl_.comment_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.address_book.ComputerGroup.comment)
 }
 
 // bool expanded = 7;
 inline void ComputerGroup::clear_expanded() {
-  expanded_ = false;
+  _impl_.expanded_ = false;
+}
+inline bool ComputerGroup::_internal_expanded() const {
+  return _impl_.expanded_;
 }
 inline bool ComputerGroup::expanded() const {
   // @@protoc_insertion_point(field_get:aspia.proto.address_book.ComputerGroup.expanded)
-  return expanded_;
+  return _internal_expanded();
 }
-inline void ComputerGroup::set_expanded(bool value) {
+inline void ComputerGroup::_internal_set_expanded(bool value) {
   
-  expanded_ = value;
+  _impl_.expanded_ = value;
+}
+inline void ComputerGroup::set_expanded(bool value) {
+  _internal_set_expanded(value);
   // @@protoc_insertion_point(field_set:aspia.proto.address_book.ComputerGroup.expanded)
 }
 
@@ -1593,161 +2615,191 @@ inline void ComputerGroup::set_expanded(bool value) {
 
 // bytes salt1 = 1;
 inline void Data::clear_salt1() {
-  salt1_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.salt1_.ClearToEmpty();
 }
-inline const ::std::string& Data::salt1() const {
+inline const std::string& Data::salt1() const {
   // @@protoc_insertion_point(field_get:aspia.proto.address_book.Data.salt1)
-  return salt1_.GetNoArena();
+  return _internal_salt1();
 }
-inline void Data::set_salt1(const ::std::string& value) {
-  
-  salt1_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Data::set_salt1(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.salt1_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:aspia.proto.address_book.Data.salt1)
 }
-#if LANG_CXX11
-inline void Data::set_salt1(::std::string&& value) {
-  
-  salt1_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.address_book.Data.salt1)
+inline std::string* Data::mutable_salt1() {
+  std::string* _s = _internal_mutable_salt1();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.address_book.Data.salt1)
+  return _s;
 }
-#endif
-inline void Data::set_salt1(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  salt1_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.address_book.Data.salt1)
+inline const std::string& Data::_internal_salt1() const {
+  return _impl_.salt1_.Get();
 }
-inline void Data::set_salt1(const void* value, size_t size) {
+inline void Data::_internal_set_salt1(const std::string& value) {
   
-  salt1_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.address_book.Data.salt1)
+  _impl_.salt1_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* Data::mutable_salt1() {
+inline std::string* Data::_internal_mutable_salt1() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.address_book.Data.salt1)
-  return salt1_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.salt1_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* Data::release_salt1() {
+inline std::string* Data::release_salt1() {
   // @@protoc_insertion_point(field_release:aspia.proto.address_book.Data.salt1)
-  
-  return salt1_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.salt1_.Release();
 }
-inline void Data::set_allocated_salt1(::std::string* salt1) {
-  if (salt1 != NULL) {
+inline void Data::set_allocated_salt1(std::string* salt1) {
+  if (salt1 != nullptr) {
     
   } else {
     
   }
-  salt1_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), salt1);
+  _impl_.salt1_.SetAllocated(salt1, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.salt1_.IsDefault()) {
+    _impl_.salt1_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.address_book.Data.salt1)
 }
 
 // .aspia.proto.address_book.ComputerGroup root_group = 2;
+inline bool Data::_internal_has_root_group() const {
+  return this != internal_default_instance() && _impl_.root_group_ != nullptr;
+}
 inline bool Data::has_root_group() const {
-  return this != internal_default_instance() && root_group_ != NULL;
+  return _internal_has_root_group();
 }
 inline void Data::clear_root_group() {
-  if (GetArenaNoVirtual() == NULL && root_group_ != NULL) {
-    delete root_group_;
+  if (GetArenaForAllocation() == nullptr && _impl_.root_group_ != nullptr) {
+    delete _impl_.root_group_;
   }
-  root_group_ = NULL;
+  _impl_.root_group_ = nullptr;
 }
 inline const ::aspia::proto::address_book::ComputerGroup& Data::_internal_root_group() const {
-  return *root_group_;
+  const ::aspia::proto::address_book::ComputerGroup* p = _impl_.root_group_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::address_book::ComputerGroup&>(
+      ::aspia::proto::address_book::_ComputerGroup_default_instance_);
 }
 inline const ::aspia::proto::address_book::ComputerGroup& Data::root_group() const {
-  const ::aspia::proto::address_book::ComputerGroup* p = root_group_;
   // @@protoc_insertion_point(field_get:aspia.proto.address_book.Data.root_group)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::address_book::ComputerGroup*>(
-      &::aspia::proto::address_book::_ComputerGroup_default_instance_);
+  return _internal_root_group();
+}
+inline void Data::unsafe_arena_set_allocated_root_group(
+    ::aspia::proto::address_book::ComputerGroup* root_group) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.root_group_);
+  }
+  _impl_.root_group_ = root_group;
+  if (root_group) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.address_book.Data.root_group)
 }
 inline ::aspia::proto::address_book::ComputerGroup* Data::release_root_group() {
+  
+  ::aspia::proto::address_book::ComputerGroup* temp = _impl_.root_group_;
+  _impl_.root_group_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::address_book::ComputerGroup* Data::unsafe_arena_release_root_group() {
   // @@protoc_insertion_point(field_release:aspia.proto.address_book.Data.root_group)
   
-  ::aspia::proto::address_book::ComputerGroup* temp = root_group_;
-  root_group_ = NULL;
+  ::aspia::proto::address_book::ComputerGroup* temp = _impl_.root_group_;
+  _impl_.root_group_ = nullptr;
   return temp;
 }
-inline ::aspia::proto::address_book::ComputerGroup* Data::mutable_root_group() {
+inline ::aspia::proto::address_book::ComputerGroup* Data::_internal_mutable_root_group() {
   
-  if (root_group_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::address_book::ComputerGroup>(GetArenaNoVirtual());
-    root_group_ = p;
+  if (_impl_.root_group_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::address_book::ComputerGroup>(GetArenaForAllocation());
+    _impl_.root_group_ = p;
   }
+  return _impl_.root_group_;
+}
+inline ::aspia::proto::address_book::ComputerGroup* Data::mutable_root_group() {
+  ::aspia::proto::address_book::ComputerGroup* _msg = _internal_mutable_root_group();
   // @@protoc_insertion_point(field_mutable:aspia.proto.address_book.Data.root_group)
-  return root_group_;
+  return _msg;
 }
 inline void Data::set_allocated_root_group(::aspia::proto::address_book::ComputerGroup* root_group) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete root_group_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.root_group_;
   }
   if (root_group) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(root_group);
     if (message_arena != submessage_arena) {
-      root_group = ::google::protobuf::internal::GetOwnedMessage(
+      root_group = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, root_group, submessage_arena);
     }
     
   } else {
     
   }
-  root_group_ = root_group;
+  _impl_.root_group_ = root_group;
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.address_book.Data.root_group)
 }
 
 // bytes salt2 = 3;
 inline void Data::clear_salt2() {
-  salt2_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.salt2_.ClearToEmpty();
 }
-inline const ::std::string& Data::salt2() const {
+inline const std::string& Data::salt2() const {
   // @@protoc_insertion_point(field_get:aspia.proto.address_book.Data.salt2)
-  return salt2_.GetNoArena();
+  return _internal_salt2();
 }
-inline void Data::set_salt2(const ::std::string& value) {
-  
-  salt2_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Data::set_salt2(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.salt2_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:aspia.proto.address_book.Data.salt2)
 }
-#if LANG_CXX11
-inline void Data::set_salt2(::std::string&& value) {
-  
-  salt2_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.address_book.Data.salt2)
+inline std::string* Data::mutable_salt2() {
+  std::string* _s = _internal_mutable_salt2();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.address_book.Data.salt2)
+  return _s;
 }
-#endif
-inline void Data::set_salt2(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  salt2_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.address_book.Data.salt2)
+inline const std::string& Data::_internal_salt2() const {
+  return _impl_.salt2_.Get();
 }
-inline void Data::set_salt2(const void* value, size_t size) {
+inline void Data::_internal_set_salt2(const std::string& value) {
   
-  salt2_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.address_book.Data.salt2)
+  _impl_.salt2_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* Data::mutable_salt2() {
+inline std::string* Data::_internal_mutable_salt2() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.address_book.Data.salt2)
-  return salt2_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.salt2_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* Data::release_salt2() {
+inline std::string* Data::release_salt2() {
   // @@protoc_insertion_point(field_release:aspia.proto.address_book.Data.salt2)
-  
-  return salt2_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.salt2_.Release();
 }
-inline void Data::set_allocated_salt2(::std::string* salt2) {
-  if (salt2 != NULL) {
+inline void Data::set_allocated_salt2(std::string* salt2) {
+  if (salt2 != nullptr) {
     
   } else {
     
   }
-  salt2_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), salt2);
+  _impl_.salt2_.SetAllocated(salt2, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.salt2_.IsDefault()) {
+    _impl_.salt2_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.address_book.Data.salt2)
 }
 
@@ -1757,135 +2809,161 @@ inline void Data::set_allocated_salt2(::std::string* salt2) {
 
 // .aspia.proto.address_book.EncryptionType encryption_type = 1;
 inline void File::clear_encryption_type() {
-  encryption_type_ = 0;
+  _impl_.encryption_type_ = 0;
+}
+inline ::aspia::proto::address_book::EncryptionType File::_internal_encryption_type() const {
+  return static_cast< ::aspia::proto::address_book::EncryptionType >(_impl_.encryption_type_);
 }
 inline ::aspia::proto::address_book::EncryptionType File::encryption_type() const {
   // @@protoc_insertion_point(field_get:aspia.proto.address_book.File.encryption_type)
-  return static_cast< ::aspia::proto::address_book::EncryptionType >(encryption_type_);
+  return _internal_encryption_type();
 }
-inline void File::set_encryption_type(::aspia::proto::address_book::EncryptionType value) {
+inline void File::_internal_set_encryption_type(::aspia::proto::address_book::EncryptionType value) {
   
-  encryption_type_ = value;
+  _impl_.encryption_type_ = value;
+}
+inline void File::set_encryption_type(::aspia::proto::address_book::EncryptionType value) {
+  _internal_set_encryption_type(value);
   // @@protoc_insertion_point(field_set:aspia.proto.address_book.File.encryption_type)
 }
 
 // int32 hashing_rounds = 2;
 inline void File::clear_hashing_rounds() {
-  hashing_rounds_ = 0;
+  _impl_.hashing_rounds_ = 0;
+}
+inline int32_t File::_internal_hashing_rounds() const {
+  return _impl_.hashing_rounds_;
 }
-inline ::google::protobuf::int32 File::hashing_rounds() const {
+inline int32_t File::hashing_rounds() const {
   // @@protoc_insertion_point(field_get:aspia.proto.address_book.File.hashing_rounds)
-  return hashing_rounds_;
+  return _internal_hashing_rounds();
 }
-inline void File::set_hashing_rounds(::google::protobuf::int32 value) {
+inline void File::_internal_set_hashing_rounds(int32_t value) {
   
-  hashing_rounds_ = value;
+  _impl_.hashing_rounds_ = value;
+}
+inline void File::set_hashing_rounds(int32_t value) {
+  _internal_set_hashing_rounds(value);
   // @@protoc_insertion_point(field_set:aspia.proto.address_book.File.hashing_rounds)
 }
 
 // bytes hashing_salt = 3;
 inline void File::clear_hashing_salt() {
-  hashing_salt_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.hashing_salt_.ClearToEmpty();
 }
-inline const ::std::string& File::hashing_salt() const {
+inline const std::string& File::hashing_salt() const {
   // @@protoc_insertion_point(field_get:aspia.proto.address_book.File.hashing_salt)
-  return hashing_salt_.GetNoArena();
+  return _internal_hashing_salt();
 }
-inline void File::set_hashing_salt(const ::std::string& value) {
-  
-  hashing_salt_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void File::set_hashing_salt(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.hashing_salt_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:aspia.proto.address_book.File.hashing_salt)
 }
-#if LANG_CXX11
-inline void File::set_hashing_salt(::std::string&& value) {
-  
-  hashing_salt_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.address_book.File.hashing_salt)
+inline std::string* File::mutable_hashing_salt() {
+  std::string* _s = _internal_mutable_hashing_salt();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.address_book.File.hashing_salt)
+  return _s;
 }
-#endif
-inline void File::set_hashing_salt(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  hashing_salt_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.address_book.File.hashing_salt)
+inline const std::string& File::_internal_hashing_salt() const {
+  return _impl_.hashing_salt_.Get();
 }
-inline void File::set_hashing_salt(const void* value, size_t size) {
+inline void File::_internal_set_hashing_salt(const std::string& value) {
   
-  hashing_salt_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.address_book.File.hashing_salt)
+  _impl_.hashing_salt_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* File::mutable_hashing_salt() {
+inline std::string* File::_internal_mutable_hashing_salt() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.address_book.File.hashing_salt)
-  return hashing_salt_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.hashing_salt_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* File::release_hashing_salt() {
+inline std::string* File::release_hashing_salt() {
   // @@protoc_insertion_point(field_release:aspia.proto.address_book.File.hashing_salt)
-  
-  return hashing_salt_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.hashing_salt_.Release();
 }
-inline void File::set_allocated_hashing_salt(::std::string* hashing_salt) {
-  if (hashing_salt != NULL) {
+inline void File::set_allocated_hashing_salt(std::string* hashing_salt) {
+  if (hashing_salt != nullptr) {
     
   } else {
     
   }
-  hashing_salt_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), hashing_salt);
+  _impl_.hashing_salt_.SetAllocated(hashing_salt, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.hashing_salt_.IsDefault()) {
+    _impl_.hashing_salt_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.address_book.File.hashing_salt)
 }
 
+// uint32 hashing_memory = 4;
+inline void File::clear_hashing_memory() {
+  _impl_.hashing_memory_ = 0u;
+}
+inline uint32_t File::_internal_hashing_memory() const {
+  return _impl_.hashing_memory_;
+}
+inline uint32_t File::hashing_memory() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.address_book.File.hashing_memory)
+  return _internal_hashing_memory();
+}
+inline void File::_internal_set_hashing_memory(uint32_t value) {
+  
+  _impl_.hashing_memory_ = value;
+}
+inline void File::set_hashing_memory(uint32_t value) {
+  _internal_set_hashing_memory(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.address_book.File.hashing_memory)
+}
+
 // bytes data = 9;
 inline void File::clear_data() {
-  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.data_.ClearToEmpty();
 }
-inline const ::std::string& File::data() const {
+inline const std::string& File::data() const {
   // @@protoc_insertion_point(field_get:aspia.proto.address_book.File.data)
-  return data_.GetNoArena();
+  return _internal_data();
 }
-inline void File::set_data(const ::std::string& value) {
-  
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void File::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:aspia.proto.address_book.File.data)
 }
-#if LANG_CXX11
-inline void File::set_data(::std::string&& value) {
-  
-  data_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.address_book.File.data)
+inline std::string* File::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.address_book.File.data)
+  return _s;
 }
-#endif
-inline void File::set_data(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.address_book.File.data)
+inline const std::string& File::_internal_data() const {
+  return _impl_.data_.Get();
 }
-inline void File::set_data(const void* value, size_t size) {
+inline void File::_internal_set_data(const std::string& value) {
   
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.address_book.File.data)
+  _impl_.data_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* File::mutable_data() {
+inline std::string* File::_internal_mutable_data() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.address_book.File.data)
-  return data_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.data_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* File::release_data() {
+inline std::string* File::release_data() {
   // @@protoc_insertion_point(field_release:aspia.proto.address_book.File.data)
-  
-  return data_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.data_.Release();
 }
-inline void File::set_allocated_data(::std::string* data) {
-  if (data != NULL) {
+inline void File::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
     
   } else {
     
   }
-  data_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), data);
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.address_book.File.data)
 }
 
@@ -1900,6 +2978,8 @@ inline void File::set_allocated_data(::std::string* data) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -1907,14 +2987,13 @@ inline void File::set_allocated_data(::std::string* data) {
 }  // namespace proto
 }  // namespace aspia
 
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 
 template <> struct is_proto_enum< ::aspia::proto::address_book::EncryptionType> : ::std::true_type {};
 
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_INCLUDED_address_5fbook_2eproto
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_address_5fbook_2eproto
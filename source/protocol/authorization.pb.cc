@@ -5,158 +5,115 @@
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/port.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/io/zero_copy_stream_impl_lite.h>
-// This is a temporary google only hack
-#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-#include "third_party/protobuf/version.h"
-#endif
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-namespace protobuf_authorization_2eproto {
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_authorization_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_ClientChallenge;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_authorization_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_LogonRequest;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_authorization_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_LogonResult;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_authorization_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_ServerChallenge;
-}  // namespace protobuf_authorization_2eproto
 namespace aspia {
 namespace proto {
 namespace auth {
-class LogonRequestDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<LogonRequest>
-      _instance;
-} _LogonRequest_default_instance_;
-class ServerChallengeDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<ServerChallenge>
-      _instance;
-} _ServerChallenge_default_instance_;
-class ClientChallengeDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<ClientChallenge>
-      _instance;
-} _ClientChallenge_default_instance_;
-class LogonResultDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<LogonResult>
-      _instance;
-} _LogonResult_default_instance_;
-class ClientToHostDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<ClientToHost>
-      _instance;
-} _ClientToHost_default_instance_;
-class HostToClientDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<HostToClient>
-      _instance;
-} _HostToClient_default_instance_;
+PROTOBUF_CONSTEXPR LogonRequest::LogonRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.resume_ticket_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.expected_challenge_)*/nullptr
+  , /*decltype(_impl_.method_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LogonRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LogonRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LogonRequestDefaultTypeInternal() {}
+  union {
+    LogonRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LogonRequestDefaultTypeInternal _LogonRequest_default_instance_;
+PROTOBUF_CONSTEXPR ServerChallenge::ServerChallenge(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.nonce_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.password_salt_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.password_hashing_)*/0
+  , /*decltype(_impl_.ops_limit_)*/0u
+  , /*decltype(_impl_.mem_limit_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ServerChallengeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServerChallengeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServerChallengeDefaultTypeInternal() {}
+  union {
+    ServerChallenge _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServerChallengeDefaultTypeInternal _ServerChallenge_default_instance_;
+PROTOBUF_CONSTEXPR ClientChallenge::ClientChallenge(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.session_key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.session_type_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ClientChallengeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ClientChallengeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ClientChallengeDefaultTypeInternal() {}
+  union {
+    ClientChallenge _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ClientChallengeDefaultTypeInternal _ClientChallenge_default_instance_;
+PROTOBUF_CONSTEXPR LogonResult::LogonResult(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.resume_ticket_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.config_request_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.status_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LogonResultDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LogonResultDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LogonResultDefaultTypeInternal() {}
+  union {
+    LogonResult _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LogonResultDefaultTypeInternal _LogonResult_default_instance_;
+PROTOBUF_CONSTEXPR ClientToHost::ClientToHost(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.logon_request_)*/nullptr
+  , /*decltype(_impl_.client_challenge_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ClientToHostDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ClientToHostDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ClientToHostDefaultTypeInternal() {}
+  union {
+    ClientToHost _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ClientToHostDefaultTypeInternal _ClientToHost_default_instance_;
+PROTOBUF_CONSTEXPR HostToClient::HostToClient(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.server_challenge_)*/nullptr
+  , /*decltype(_impl_.logon_result_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct HostToClientDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HostToClientDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HostToClientDefaultTypeInternal() {}
+  union {
+    HostToClient _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HostToClientDefaultTypeInternal _HostToClient_default_instance_;
 }  // namespace auth
 }  // namespace proto
 }  // namespace aspia
-namespace protobuf_authorization_2eproto {
-static void InitDefaultsLogonRequest() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::auth::_LogonRequest_default_instance_;
-    new (ptr) ::aspia::proto::auth::LogonRequest();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::auth::LogonRequest::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_LogonRequest =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsLogonRequest}, {}};
-
-static void InitDefaultsServerChallenge() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::auth::_ServerChallenge_default_instance_;
-    new (ptr) ::aspia::proto::auth::ServerChallenge();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::auth::ServerChallenge::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_ServerChallenge =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsServerChallenge}, {}};
-
-static void InitDefaultsClientChallenge() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::auth::_ClientChallenge_default_instance_;
-    new (ptr) ::aspia::proto::auth::ClientChallenge();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::auth::ClientChallenge::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_ClientChallenge =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsClientChallenge}, {}};
-
-static void InitDefaultsLogonResult() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::auth::_LogonResult_default_instance_;
-    new (ptr) ::aspia::proto::auth::LogonResult();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::auth::LogonResult::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_LogonResult =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsLogonResult}, {}};
-
-static void InitDefaultsClientToHost() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::auth::_ClientToHost_default_instance_;
-    new (ptr) ::aspia::proto::auth::ClientToHost();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::auth::ClientToHost::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<2> scc_info_ClientToHost =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 2, InitDefaultsClientToHost}, {
-      &protobuf_authorization_2eproto::scc_info_LogonRequest.base,
-      &protobuf_authorization_2eproto::scc_info_ClientChallenge.base,}};
-
-static void InitDefaultsHostToClient() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::auth::_HostToClient_default_instance_;
-    new (ptr) ::aspia::proto::auth::HostToClient();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::auth::HostToClient::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<2> scc_info_HostToClient =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 2, InitDefaultsHostToClient}, {
-      &protobuf_authorization_2eproto::scc_info_ServerChallenge.base,
-      &protobuf_authorization_2eproto::scc_info_LogonResult.base,}};
-
-void InitDefaults() {
-  ::google::protobuf::internal::InitSCC(&scc_info_LogonRequest.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_ServerChallenge.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_ClientChallenge.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_LogonResult.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_ClientToHost.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_HostToClient.base);
-}
-
-}  // namespace protobuf_authorization_2eproto
 namespace aspia {
 namespace proto {
 namespace auth {
@@ -170,6 +127,47 @@ bool Method_IsValid(int value) {
   }
 }
 
+static ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> Method_strings[2] = {};
+
+static const char Method_names[] =
+  "METHOD_BASIC"
+  "METHOD_UNKNOWN";
+
+static const ::PROTOBUF_NAMESPACE_ID::internal::EnumEntry Method_entries[] = {
+  { {Method_names + 0, 12}, 1 },
+  { {Method_names + 12, 14}, 0 },
+};
+
+static const int Method_entries_by_number[] = {
+  1, // 0 -> METHOD_UNKNOWN
+  0, // 1 -> METHOD_BASIC
+};
+
+const std::string& Method_Name(
+    Method value) {
+  static const bool dummy =
+      ::PROTOBUF_NAMESPACE_ID::internal::InitializeEnumStrings(
+          Method_entries,
+          Method_entries_by_number,
+          2, Method_strings);
+  (void) dummy;
+  int idx = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumName(
+      Method_entries,
+      Method_entries_by_number,
+      2, value);
+  return idx == -1 ? ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString() :
+                     Method_strings[idx].get();
+}
+bool Method_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Method* value) {
+  int int_value;
+  bool success = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumValue(
+      Method_entries, 2, name, &int_value);
+  if (success) {
+    *value = static_cast<Method>(int_value);
+  }
+  return success;
+}
 bool SessionType_IsValid(int value) {
   switch (value) {
     case 0:
@@ -183,6 +181,107 @@ bool SessionType_IsValid(int value) {
   }
 }
 
+static ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> SessionType_strings[5] = {};
+
+static const char SessionType_names[] =
+  "SESSION_TYPE_DESKTOP_MANAGE"
+  "SESSION_TYPE_DESKTOP_VIEW"
+  "SESSION_TYPE_FILE_TRANSFER"
+  "SESSION_TYPE_SYSTEM_INFO"
+  "SESSION_TYPE_UNKNOWN";
+
+static const ::PROTOBUF_NAMESPACE_ID::internal::EnumEntry SessionType_entries[] = {
+  { {SessionType_names + 0, 27}, 1 },
+  { {SessionType_names + 27, 25}, 2 },
+  { {SessionType_names + 52, 26}, 4 },
+  { {SessionType_names + 78, 24}, 8 },
+  { {SessionType_names + 102, 20}, 0 },
+};
+
+static const int SessionType_entries_by_number[] = {
+  4, // 0 -> SESSION_TYPE_UNKNOWN
+  0, // 1 -> SESSION_TYPE_DESKTOP_MANAGE
+  1, // 2 -> SESSION_TYPE_DESKTOP_VIEW
+  2, // 4 -> SESSION_TYPE_FILE_TRANSFER
+  3, // 8 -> SESSION_TYPE_SYSTEM_INFO
+};
+
+const std::string& SessionType_Name(
+    SessionType value) {
+  static const bool dummy =
+      ::PROTOBUF_NAMESPACE_ID::internal::InitializeEnumStrings(
+          SessionType_entries,
+          SessionType_entries_by_number,
+          5, SessionType_strings);
+  (void) dummy;
+  int idx = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumName(
+      SessionType_entries,
+      SessionType_entries_by_number,
+      5, value);
+  return idx == -1 ? ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString() :
+                     SessionType_strings[idx].get();
+}
+bool SessionType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, SessionType* value) {
+  int int_value;
+  bool success = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumValue(
+      SessionType_entries, 5, name, &int_value);
+  if (success) {
+    *value = static_cast<SessionType>(int_value);
+  }
+  return success;
+}
+bool PasswordHashing_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> PasswordHashing_strings[2] = {};
+
+static const char PasswordHashing_names[] =
+  "PASSWORD_HASHING_ARGON2ID"
+  "PASSWORD_HASHING_SHA512";
+
+static const ::PROTOBUF_NAMESPACE_ID::internal::EnumEntry PasswordHashing_entries[] = {
+  { {PasswordHashing_names + 0, 25}, 1 },
+  { {PasswordHashing_names + 25, 23}, 0 },
+};
+
+static const int PasswordHashing_entries_by_number[] = {
+  1, // 0 -> PASSWORD_HASHING_SHA512
+  0, // 1 -> PASSWORD_HASHING_ARGON2ID
+};
+
+const std::string& PasswordHashing_Name(
+    PasswordHashing value) {
+  static const bool dummy =
+      ::PROTOBUF_NAMESPACE_ID::internal::InitializeEnumStrings(
+          PasswordHashing_entries,
+          PasswordHashing_entries_by_number,
+          2, PasswordHashing_strings);
+  (void) dummy;
+  int idx = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumName(
+      PasswordHashing_entries,
+      PasswordHashing_entries_by_number,
+      2, value);
+  return idx == -1 ? ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString() :
+                     PasswordHashing_strings[idx].get();
+}
+bool PasswordHashing_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, PasswordHashing* value) {
+  int int_value;
+  bool success = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumValue(
+      PasswordHashing_entries, 2, name, &int_value);
+  if (success) {
+    *value = static_cast<PasswordHashing>(int_value);
+  }
+  return success;
+}
 bool Status_IsValid(int value) {
   switch (value) {
     case 0:
@@ -195,161 +294,341 @@ bool Status_IsValid(int value) {
   }
 }
 
+static ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> Status_strings[4] = {};
+
+static const char Status_names[] =
+  "STATUS_ACCESS_DENIED"
+  "STATUS_CANCELED"
+  "STATUS_SUCCESS"
+  "STATUS_UNKNOWN";
+
+static const ::PROTOBUF_NAMESPACE_ID::internal::EnumEntry Status_entries[] = {
+  { {Status_names + 0, 20}, 2 },
+  { {Status_names + 20, 15}, 3 },
+  { {Status_names + 35, 14}, 1 },
+  { {Status_names + 49, 14}, 0 },
+};
+
+static const int Status_entries_by_number[] = {
+  3, // 0 -> STATUS_UNKNOWN
+  2, // 1 -> STATUS_SUCCESS
+  0, // 2 -> STATUS_ACCESS_DENIED
+  1, // 3 -> STATUS_CANCELED
+};
+
+const std::string& Status_Name(
+    Status value) {
+  static const bool dummy =
+      ::PROTOBUF_NAMESPACE_ID::internal::InitializeEnumStrings(
+          Status_entries,
+          Status_entries_by_number,
+          4, Status_strings);
+  (void) dummy;
+  int idx = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumName(
+      Status_entries,
+      Status_entries_by_number,
+      4, value);
+  return idx == -1 ? ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString() :
+                     Status_strings[idx].get();
+}
+bool Status_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Status* value) {
+  int int_value;
+  bool success = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumValue(
+      Status_entries, 4, name, &int_value);
+  if (success) {
+    *value = static_cast<Status>(int_value);
+  }
+  return success;
+}
 
 // ===================================================================
 
-void LogonRequest::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int LogonRequest::kMethodFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class LogonRequest::_Internal {
+ public:
+  static const ::aspia::proto::auth::ServerChallenge& expected_challenge(const LogonRequest* msg);
+};
 
-LogonRequest::LogonRequest()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_authorization_2eproto::scc_info_LogonRequest.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.auth.LogonRequest)
+const ::aspia::proto::auth::ServerChallenge&
+LogonRequest::_Internal::expected_challenge(const LogonRequest* msg) {
+  return *msg->_impl_.expected_challenge_;
+}
+LogonRequest::LogonRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.auth.LogonRequest)
 }
 LogonRequest::LogonRequest(const LogonRequest& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  method_ = from.method_;
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  LogonRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.resume_ticket_){}
+    , decltype(_impl_.expected_challenge_){nullptr}
+    , decltype(_impl_.method_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_username().empty()) {
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.resume_ticket_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.resume_ticket_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_resume_ticket().empty()) {
+    _this->_impl_.resume_ticket_.Set(from._internal_resume_ticket(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_expected_challenge()) {
+    _this->_impl_.expected_challenge_ = new ::aspia::proto::auth::ServerChallenge(*from._impl_.expected_challenge_);
+  }
+  _this->_impl_.method_ = from._impl_.method_;
   // @@protoc_insertion_point(copy_constructor:aspia.proto.auth.LogonRequest)
 }
 
-void LogonRequest::SharedCtor() {
-  method_ = 0;
+inline void LogonRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.resume_ticket_){}
+    , decltype(_impl_.expected_challenge_){nullptr}
+    , decltype(_impl_.method_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.resume_ticket_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.resume_ticket_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 LogonRequest::~LogonRequest() {
   // @@protoc_insertion_point(destructor:aspia.proto.auth.LogonRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void LogonRequest::SharedDtor() {
+inline void LogonRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.username_.Destroy();
+  _impl_.resume_ticket_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.expected_challenge_;
 }
 
 void LogonRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const LogonRequest& LogonRequest::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_authorization_2eproto::scc_info_LogonRequest.base);
-  return *internal_default_instance();
-}
-
 
 void LogonRequest::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.auth.LogonRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  method_ = 0;
-  _internal_metadata_.Clear();
-}
-
-bool LogonRequest::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.auth.LogonRequest)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.username_.ClearToEmpty();
+  _impl_.resume_ticket_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.expected_challenge_ != nullptr) {
+    delete _impl_.expected_challenge_;
+  }
+  _impl_.expected_challenge_ = nullptr;
+  _impl_.method_ = 0;
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* LogonRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // .aspia.proto.auth.Method method = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_method(static_cast< ::aspia::proto::auth::Method >(value));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_method(static_cast<::aspia::proto::auth::Method>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // string username = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_username();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes resume_ticket = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_resume_ticket();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+        continue;
+      // .aspia.proto.auth.ServerChallenge expected_challenge = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_expected_challenge(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.auth.LogonRequest)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.auth.LogonRequest)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void LogonRequest::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.auth.LogonRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* LogonRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.auth.LogonRequest)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .aspia.proto.auth.Method method = 1;
-  if (this->method() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->method(), output);
+  if (this->_internal_method() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_method(), target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.auth.LogonRequest)
+  // string username = 2;
+  if (!this->_internal_username().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "aspia.proto.auth.LogonRequest.username");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_username(), target);
+  }
+
+  // bytes resume_ticket = 3;
+  if (!this->_internal_resume_ticket().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_resume_ticket(), target);
+  }
+
+  // .aspia.proto.auth.ServerChallenge expected_challenge = 4;
+  if (this->_internal_has_expected_challenge()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::expected_challenge(this),
+        _Internal::expected_challenge(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.auth.LogonRequest)
+  return target;
 }
 
 size_t LogonRequest::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.auth.LogonRequest)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string username = 2;
+  if (!this->_internal_username().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_username());
+  }
+
+  // bytes resume_ticket = 3;
+  if (!this->_internal_resume_ticket().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_resume_ticket());
+  }
+
+  // .aspia.proto.auth.ServerChallenge expected_challenge = 4;
+  if (this->_internal_has_expected_challenge()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.expected_challenge_);
+  }
 
   // .aspia.proto.auth.Method method = 1;
-  if (this->method() != 0) {
+  if (this->_internal_method() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->method());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_method());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void LogonRequest::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const LogonRequest*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const LogonRequest*>(
+      &from));
 }
 
 void LogonRequest::MergeFrom(const LogonRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.auth.LogonRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  LogonRequest* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.auth.LogonRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.method() != 0) {
-    set_method(from.method());
+  if (!from._internal_username().empty()) {
+    _this->_internal_set_username(from._internal_username());
+  }
+  if (!from._internal_resume_ticket().empty()) {
+    _this->_internal_set_resume_ticket(from._internal_resume_ticket());
+  }
+  if (from._internal_has_expected_challenge()) {
+    _this->_internal_mutable_expected_challenge()->::aspia::proto::auth::ServerChallenge::MergeFrom(
+        from._internal_expected_challenge());
   }
+  if (from._internal_method() != 0) {
+    _this->_internal_set_method(from._internal_method());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void LogonRequest::CopyFrom(const LogonRequest& from) {
@@ -363,178 +642,325 @@ bool LogonRequest::IsInitialized() const {
   return true;
 }
 
-void LogonRequest::Swap(LogonRequest* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void LogonRequest::InternalSwap(LogonRequest* other) {
   using std::swap;
-  swap(method_, other->method_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-}
-
-::std::string LogonRequest::GetTypeName() const {
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.resume_ticket_, lhs_arena,
+      &other->_impl_.resume_ticket_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LogonRequest, _impl_.method_)
+      + sizeof(LogonRequest::_impl_.method_)
+      - PROTOBUF_FIELD_OFFSET(LogonRequest, _impl_.expected_challenge_)>(
+          reinterpret_cast<char*>(&_impl_.expected_challenge_),
+          reinterpret_cast<char*>(&other->_impl_.expected_challenge_));
+}
+
+std::string LogonRequest::GetTypeName() const {
   return "aspia.proto.auth.LogonRequest";
 }
 
 
 // ===================================================================
 
-void ServerChallenge::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int ServerChallenge::kNonceFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class ServerChallenge::_Internal {
+ public:
+};
 
-ServerChallenge::ServerChallenge()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_authorization_2eproto::scc_info_ServerChallenge.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.auth.ServerChallenge)
+ServerChallenge::ServerChallenge(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.auth.ServerChallenge)
 }
 ServerChallenge::ServerChallenge(const ServerChallenge& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  nonce_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.nonce().size() > 0) {
-    nonce_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.nonce_);
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  ServerChallenge* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.nonce_){}
+    , decltype(_impl_.password_salt_){}
+    , decltype(_impl_.password_hashing_){}
+    , decltype(_impl_.ops_limit_){}
+    , decltype(_impl_.mem_limit_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.nonce_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.nonce_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_nonce().empty()) {
+    _this->_impl_.nonce_.Set(from._internal_nonce(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.password_salt_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.password_salt_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_password_salt().empty()) {
+    _this->_impl_.password_salt_.Set(from._internal_password_salt(), 
+      _this->GetArenaForAllocation());
   }
+  ::memcpy(&_impl_.password_hashing_, &from._impl_.password_hashing_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.mem_limit_) -
+    reinterpret_cast<char*>(&_impl_.password_hashing_)) + sizeof(_impl_.mem_limit_));
   // @@protoc_insertion_point(copy_constructor:aspia.proto.auth.ServerChallenge)
 }
 
-void ServerChallenge::SharedCtor() {
-  nonce_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void ServerChallenge::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.nonce_){}
+    , decltype(_impl_.password_salt_){}
+    , decltype(_impl_.password_hashing_){0}
+    , decltype(_impl_.ops_limit_){0u}
+    , decltype(_impl_.mem_limit_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.nonce_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.nonce_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.password_salt_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.password_salt_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 ServerChallenge::~ServerChallenge() {
   // @@protoc_insertion_point(destructor:aspia.proto.auth.ServerChallenge)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void ServerChallenge::SharedDtor() {
-  nonce_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void ServerChallenge::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.nonce_.Destroy();
+  _impl_.password_salt_.Destroy();
 }
 
 void ServerChallenge::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ServerChallenge& ServerChallenge::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_authorization_2eproto::scc_info_ServerChallenge.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void ServerChallenge::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.auth.ServerChallenge)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  nonce_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  _internal_metadata_.Clear();
-}
-
-bool ServerChallenge::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.auth.ServerChallenge)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.nonce_.ClearToEmpty();
+  _impl_.password_salt_.ClearToEmpty();
+  ::memset(&_impl_.password_hashing_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.mem_limit_) -
+      reinterpret_cast<char*>(&_impl_.password_hashing_)) + sizeof(_impl_.mem_limit_));
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* ServerChallenge::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // bytes nonce = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_nonce()));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_nonce();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .aspia.proto.auth.PasswordHashing password_hashing = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_password_hashing(static_cast<::aspia::proto::auth::PasswordHashing>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes password_salt = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_password_salt();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 ops_limit = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.ops_limit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+        continue;
+      // uint32 mem_limit = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.mem_limit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.auth.ServerChallenge)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.auth.ServerChallenge)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void ServerChallenge::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.auth.ServerChallenge)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* ServerChallenge::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.auth.ServerChallenge)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // bytes nonce = 1;
-  if (this->nonce().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      1, this->nonce(), output);
+  if (!this->_internal_nonce().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_nonce(), target);
+  }
+
+  // .aspia.proto.auth.PasswordHashing password_hashing = 2;
+  if (this->_internal_password_hashing() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_password_hashing(), target);
+  }
+
+  // bytes password_salt = 3;
+  if (!this->_internal_password_salt().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_password_salt(), target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.auth.ServerChallenge)
+  // uint32 ops_limit = 4;
+  if (this->_internal_ops_limit() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_ops_limit(), target);
+  }
+
+  // uint32 mem_limit = 5;
+  if (this->_internal_mem_limit() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_mem_limit(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.auth.ServerChallenge)
+  return target;
 }
 
 size_t ServerChallenge::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.auth.ServerChallenge)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // bytes nonce = 1;
-  if (this->nonce().size() > 0) {
+  if (!this->_internal_nonce().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->nonce());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_nonce());
+  }
+
+  // bytes password_salt = 3;
+  if (!this->_internal_password_salt().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_password_salt());
+  }
+
+  // .aspia.proto.auth.PasswordHashing password_hashing = 2;
+  if (this->_internal_password_hashing() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_password_hashing());
+  }
+
+  // uint32 ops_limit = 4;
+  if (this->_internal_ops_limit() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_ops_limit());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  // uint32 mem_limit = 5;
+  if (this->_internal_mem_limit() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_mem_limit());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void ServerChallenge::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const ServerChallenge*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const ServerChallenge*>(
+      &from));
 }
 
 void ServerChallenge::MergeFrom(const ServerChallenge& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.auth.ServerChallenge)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  ServerChallenge* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.auth.ServerChallenge)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.nonce().size() > 0) {
-
-    nonce_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.nonce_);
+  if (!from._internal_nonce().empty()) {
+    _this->_internal_set_nonce(from._internal_nonce());
+  }
+  if (!from._internal_password_salt().empty()) {
+    _this->_internal_set_password_salt(from._internal_password_salt());
+  }
+  if (from._internal_password_hashing() != 0) {
+    _this->_internal_set_password_hashing(from._internal_password_hashing());
+  }
+  if (from._internal_ops_limit() != 0) {
+    _this->_internal_set_ops_limit(from._internal_ops_limit());
+  }
+  if (from._internal_mem_limit() != 0) {
+    _this->_internal_set_mem_limit(from._internal_mem_limit());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void ServerChallenge::CopyFrom(const ServerChallenge& from) {
@@ -548,258 +974,278 @@ bool ServerChallenge::IsInitialized() const {
   return true;
 }
 
-void ServerChallenge::Swap(ServerChallenge* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void ServerChallenge::InternalSwap(ServerChallenge* other) {
   using std::swap;
-  nonce_.Swap(&other->nonce_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-}
-
-::std::string ServerChallenge::GetTypeName() const {
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.nonce_, lhs_arena,
+      &other->_impl_.nonce_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.password_salt_, lhs_arena,
+      &other->_impl_.password_salt_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ServerChallenge, _impl_.mem_limit_)
+      + sizeof(ServerChallenge::_impl_.mem_limit_)
+      - PROTOBUF_FIELD_OFFSET(ServerChallenge, _impl_.password_hashing_)>(
+          reinterpret_cast<char*>(&_impl_.password_hashing_),
+          reinterpret_cast<char*>(&other->_impl_.password_hashing_));
+}
+
+std::string ServerChallenge::GetTypeName() const {
   return "aspia.proto.auth.ServerChallenge";
 }
 
 
 // ===================================================================
 
-void ClientChallenge::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int ClientChallenge::kSessionTypeFieldNumber;
-const int ClientChallenge::kUsernameFieldNumber;
-const int ClientChallenge::kSessionKeyFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class ClientChallenge::_Internal {
+ public:
+};
 
-ClientChallenge::ClientChallenge()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_authorization_2eproto::scc_info_ClientChallenge.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.auth.ClientChallenge)
+ClientChallenge::ClientChallenge(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.auth.ClientChallenge)
 }
 ClientChallenge::ClientChallenge(const ClientChallenge& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  username_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.username().size() > 0) {
-    username_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.username_);
-  }
-  session_key_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.session_key().size() > 0) {
-    session_key_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.session_key_);
-  }
-  session_type_ = from.session_type_;
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  ClientChallenge* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.session_key_){}
+    , decltype(_impl_.session_type_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_username().empty()) {
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.session_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_session_key().empty()) {
+    _this->_impl_.session_key_.Set(from._internal_session_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.session_type_ = from._impl_.session_type_;
   // @@protoc_insertion_point(copy_constructor:aspia.proto.auth.ClientChallenge)
 }
 
-void ClientChallenge::SharedCtor() {
-  username_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  session_key_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  session_type_ = 0;
+inline void ClientChallenge::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.session_key_){}
+    , decltype(_impl_.session_type_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.session_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 ClientChallenge::~ClientChallenge() {
   // @@protoc_insertion_point(destructor:aspia.proto.auth.ClientChallenge)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void ClientChallenge::SharedDtor() {
-  username_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  session_key_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void ClientChallenge::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.username_.Destroy();
+  _impl_.session_key_.Destroy();
 }
 
 void ClientChallenge::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ClientChallenge& ClientChallenge::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_authorization_2eproto::scc_info_ClientChallenge.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void ClientChallenge::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.auth.ClientChallenge)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  username_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  session_key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  session_type_ = 0;
-  _internal_metadata_.Clear();
-}
-
-bool ClientChallenge::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.auth.ClientChallenge)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.username_.ClearToEmpty();
+  _impl_.session_key_.ClearToEmpty();
+  _impl_.session_type_ = 0;
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* ClientChallenge::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // .aspia.proto.auth.SessionType session_type = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_session_type(static_cast< ::aspia::proto::auth::SessionType >(value));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_session_type(static_cast<::aspia::proto::auth::SessionType>(val));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string username = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_username()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->username().data(), static_cast<int>(this->username().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "aspia.proto.auth.ClientChallenge.username"));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_username();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // bytes session_key = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_session_key()));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_session_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.auth.ClientChallenge)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.auth.ClientChallenge)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void ClientChallenge::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.auth.ClientChallenge)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* ClientChallenge::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.auth.ClientChallenge)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .aspia.proto.auth.SessionType session_type = 1;
-  if (this->session_type() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->session_type(), output);
+  if (this->_internal_session_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_session_type(), target);
   }
 
   // string username = 2;
-  if (this->username().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->username().data(), static_cast<int>(this->username().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_username().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "aspia.proto.auth.ClientChallenge.username");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->username(), output);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_username(), target);
   }
 
   // bytes session_key = 3;
-  if (this->session_key().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      3, this->session_key(), output);
+  if (!this->_internal_session_key().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_session_key(), target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.auth.ClientChallenge)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.auth.ClientChallenge)
+  return target;
 }
 
 size_t ClientChallenge::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.auth.ClientChallenge)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // string username = 2;
-  if (this->username().size() > 0) {
+  if (!this->_internal_username().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->username());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_username());
   }
 
   // bytes session_key = 3;
-  if (this->session_key().size() > 0) {
+  if (!this->_internal_session_key().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->session_key());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_session_key());
   }
 
   // .aspia.proto.auth.SessionType session_type = 1;
-  if (this->session_type() != 0) {
+  if (this->_internal_session_type() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->session_type());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_session_type());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void ClientChallenge::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const ClientChallenge*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const ClientChallenge*>(
+      &from));
 }
 
 void ClientChallenge::MergeFrom(const ClientChallenge& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.auth.ClientChallenge)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  ClientChallenge* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.auth.ClientChallenge)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.username().size() > 0) {
-
-    username_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.username_);
+  if (!from._internal_username().empty()) {
+    _this->_internal_set_username(from._internal_username());
   }
-  if (from.session_key().size() > 0) {
-
-    session_key_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.session_key_);
+  if (!from._internal_session_key().empty()) {
+    _this->_internal_set_session_key(from._internal_session_key());
   }
-  if (from.session_type() != 0) {
-    set_session_type(from.session_type());
+  if (from._internal_session_type() != 0) {
+    _this->_internal_set_session_type(from._internal_session_type());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void ClientChallenge::CopyFrom(const ClientChallenge& from) {
@@ -813,179 +1259,268 @@ bool ClientChallenge::IsInitialized() const {
   return true;
 }
 
-void ClientChallenge::Swap(ClientChallenge* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void ClientChallenge::InternalSwap(ClientChallenge* other) {
   using std::swap;
-  username_.Swap(&other->username_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  session_key_.Swap(&other->session_key_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(session_type_, other->session_type_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-}
-
-::std::string ClientChallenge::GetTypeName() const {
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.session_key_, lhs_arena,
+      &other->_impl_.session_key_, rhs_arena
+  );
+  swap(_impl_.session_type_, other->_impl_.session_type_);
+}
+
+std::string ClientChallenge::GetTypeName() const {
   return "aspia.proto.auth.ClientChallenge";
 }
 
 
 // ===================================================================
 
-void LogonResult::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int LogonResult::kStatusFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class LogonResult::_Internal {
+ public:
+};
 
-LogonResult::LogonResult()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_authorization_2eproto::scc_info_LogonResult.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.auth.LogonResult)
+LogonResult::LogonResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.auth.LogonResult)
 }
 LogonResult::LogonResult(const LogonResult& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  status_ = from.status_;
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  LogonResult* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.resume_ticket_){}
+    , decltype(_impl_.config_request_){}
+    , decltype(_impl_.status_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.resume_ticket_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.resume_ticket_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_resume_ticket().empty()) {
+    _this->_impl_.resume_ticket_.Set(from._internal_resume_ticket(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.config_request_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.config_request_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_config_request().empty()) {
+    _this->_impl_.config_request_.Set(from._internal_config_request(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.status_ = from._impl_.status_;
   // @@protoc_insertion_point(copy_constructor:aspia.proto.auth.LogonResult)
 }
 
-void LogonResult::SharedCtor() {
-  status_ = 0;
+inline void LogonResult::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.resume_ticket_){}
+    , decltype(_impl_.config_request_){}
+    , decltype(_impl_.status_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.resume_ticket_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.resume_ticket_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.config_request_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.config_request_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 LogonResult::~LogonResult() {
   // @@protoc_insertion_point(destructor:aspia.proto.auth.LogonResult)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void LogonResult::SharedDtor() {
+inline void LogonResult::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.resume_ticket_.Destroy();
+  _impl_.config_request_.Destroy();
 }
 
 void LogonResult::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const LogonResult& LogonResult::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_authorization_2eproto::scc_info_LogonResult.base);
-  return *internal_default_instance();
-}
-
 
 void LogonResult::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.auth.LogonResult)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  status_ = 0;
-  _internal_metadata_.Clear();
-}
-
-bool LogonResult::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.auth.LogonResult)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.resume_ticket_.ClearToEmpty();
+  _impl_.config_request_.ClearToEmpty();
+  _impl_.status_ = 0;
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* LogonResult::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // .aspia.proto.auth.Status status = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_status(static_cast< ::aspia::proto::auth::Status >(value));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_status(static_cast<::aspia::proto::auth::Status>(val));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+        continue;
+      // bytes resume_ticket = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_resume_ticket();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes config_request = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_config_request();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.auth.LogonResult)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.auth.LogonResult)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void LogonResult::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.auth.LogonResult)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* LogonResult::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.auth.LogonResult)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .aspia.proto.auth.Status status = 1;
-  if (this->status() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->status(), output);
+  if (this->_internal_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_status(), target);
+  }
+
+  // bytes resume_ticket = 2;
+  if (!this->_internal_resume_ticket().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_resume_ticket(), target);
+  }
+
+  // bytes config_request = 3;
+  if (!this->_internal_config_request().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_config_request(), target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.auth.LogonResult)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.auth.LogonResult)
+  return target;
 }
 
 size_t LogonResult::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.auth.LogonResult)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes resume_ticket = 2;
+  if (!this->_internal_resume_ticket().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_resume_ticket());
+  }
+
+  // bytes config_request = 3;
+  if (!this->_internal_config_request().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_config_request());
+  }
 
   // .aspia.proto.auth.Status status = 1;
-  if (this->status() != 0) {
+  if (this->_internal_status() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->status());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void LogonResult::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const LogonResult*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const LogonResult*>(
+      &from));
 }
 
 void LogonResult::MergeFrom(const LogonResult& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.auth.LogonResult)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  LogonResult* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.auth.LogonResult)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.status() != 0) {
-    set_status(from.status());
+  if (!from._internal_resume_ticket().empty()) {
+    _this->_internal_set_resume_ticket(from._internal_resume_ticket());
   }
+  if (!from._internal_config_request().empty()) {
+    _this->_internal_set_config_request(from._internal_config_request());
+  }
+  if (from._internal_status() != 0) {
+    _this->_internal_set_status(from._internal_status());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void LogonResult::CopyFrom(const LogonResult& from) {
@@ -999,226 +1534,239 @@ bool LogonResult::IsInitialized() const {
   return true;
 }
 
-void LogonResult::Swap(LogonResult* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void LogonResult::InternalSwap(LogonResult* other) {
   using std::swap;
-  swap(status_, other->status_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-}
-
-::std::string LogonResult::GetTypeName() const {
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.resume_ticket_, lhs_arena,
+      &other->_impl_.resume_ticket_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.config_request_, lhs_arena,
+      &other->_impl_.config_request_, rhs_arena
+  );
+  swap(_impl_.status_, other->_impl_.status_);
+}
+
+std::string LogonResult::GetTypeName() const {
   return "aspia.proto.auth.LogonResult";
 }
 
 
 // ===================================================================
 
-void ClientToHost::InitAsDefaultInstance() {
-  ::aspia::proto::auth::_ClientToHost_default_instance_._instance.get_mutable()->logon_request_ = const_cast< ::aspia::proto::auth::LogonRequest*>(
-      ::aspia::proto::auth::LogonRequest::internal_default_instance());
-  ::aspia::proto::auth::_ClientToHost_default_instance_._instance.get_mutable()->client_challenge_ = const_cast< ::aspia::proto::auth::ClientChallenge*>(
-      ::aspia::proto::auth::ClientChallenge::internal_default_instance());
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int ClientToHost::kLogonRequestFieldNumber;
-const int ClientToHost::kClientChallengeFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class ClientToHost::_Internal {
+ public:
+  static const ::aspia::proto::auth::LogonRequest& logon_request(const ClientToHost* msg);
+  static const ::aspia::proto::auth::ClientChallenge& client_challenge(const ClientToHost* msg);
+};
 
-ClientToHost::ClientToHost()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_authorization_2eproto::scc_info_ClientToHost.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.auth.ClientToHost)
+const ::aspia::proto::auth::LogonRequest&
+ClientToHost::_Internal::logon_request(const ClientToHost* msg) {
+  return *msg->_impl_.logon_request_;
+}
+const ::aspia::proto::auth::ClientChallenge&
+ClientToHost::_Internal::client_challenge(const ClientToHost* msg) {
+  return *msg->_impl_.client_challenge_;
+}
+ClientToHost::ClientToHost(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.auth.ClientToHost)
 }
 ClientToHost::ClientToHost(const ClientToHost& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.has_logon_request()) {
-    logon_request_ = new ::aspia::proto::auth::LogonRequest(*from.logon_request_);
-  } else {
-    logon_request_ = NULL;
-  }
-  if (from.has_client_challenge()) {
-    client_challenge_ = new ::aspia::proto::auth::ClientChallenge(*from.client_challenge_);
-  } else {
-    client_challenge_ = NULL;
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  ClientToHost* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.logon_request_){nullptr}
+    , decltype(_impl_.client_challenge_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  if (from._internal_has_logon_request()) {
+    _this->_impl_.logon_request_ = new ::aspia::proto::auth::LogonRequest(*from._impl_.logon_request_);
+  }
+  if (from._internal_has_client_challenge()) {
+    _this->_impl_.client_challenge_ = new ::aspia::proto::auth::ClientChallenge(*from._impl_.client_challenge_);
   }
   // @@protoc_insertion_point(copy_constructor:aspia.proto.auth.ClientToHost)
 }
 
-void ClientToHost::SharedCtor() {
-  ::memset(&logon_request_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&client_challenge_) -
-      reinterpret_cast<char*>(&logon_request_)) + sizeof(client_challenge_));
+inline void ClientToHost::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.logon_request_){nullptr}
+    , decltype(_impl_.client_challenge_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 ClientToHost::~ClientToHost() {
   // @@protoc_insertion_point(destructor:aspia.proto.auth.ClientToHost)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void ClientToHost::SharedDtor() {
-  if (this != internal_default_instance()) delete logon_request_;
-  if (this != internal_default_instance()) delete client_challenge_;
+inline void ClientToHost::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.logon_request_;
+  if (this != internal_default_instance()) delete _impl_.client_challenge_;
 }
 
 void ClientToHost::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ClientToHost& ClientToHost::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_authorization_2eproto::scc_info_ClientToHost.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void ClientToHost::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.auth.ClientToHost)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaNoVirtual() == NULL && logon_request_ != NULL) {
-    delete logon_request_;
-  }
-  logon_request_ = NULL;
-  if (GetArenaNoVirtual() == NULL && client_challenge_ != NULL) {
-    delete client_challenge_;
-  }
-  client_challenge_ = NULL;
-  _internal_metadata_.Clear();
-}
-
-bool ClientToHost::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.auth.ClientToHost)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  if (GetArenaForAllocation() == nullptr && _impl_.logon_request_ != nullptr) {
+    delete _impl_.logon_request_;
+  }
+  _impl_.logon_request_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.client_challenge_ != nullptr) {
+    delete _impl_.client_challenge_;
+  }
+  _impl_.client_challenge_ = nullptr;
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* ClientToHost::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // .aspia.proto.auth.LogonRequest logon_request = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_logon_request()));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_logon_request(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .aspia.proto.auth.ClientChallenge client_challenge = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_client_challenge()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_client_challenge(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.auth.ClientToHost)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.auth.ClientToHost)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void ClientToHost::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.auth.ClientToHost)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* ClientToHost::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.auth.ClientToHost)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .aspia.proto.auth.LogonRequest logon_request = 1;
-  if (this->has_logon_request()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      1, this->_internal_logon_request(), output);
+  if (this->_internal_has_logon_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::logon_request(this),
+        _Internal::logon_request(this).GetCachedSize(), target, stream);
   }
 
   // .aspia.proto.auth.ClientChallenge client_challenge = 2;
-  if (this->has_client_challenge()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      2, this->_internal_client_challenge(), output);
+  if (this->_internal_has_client_challenge()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::client_challenge(this),
+        _Internal::client_challenge(this).GetCachedSize(), target, stream);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.auth.ClientToHost)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.auth.ClientToHost)
+  return target;
 }
 
 size_t ClientToHost::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.auth.ClientToHost)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // .aspia.proto.auth.LogonRequest logon_request = 1;
-  if (this->has_logon_request()) {
+  if (this->_internal_has_logon_request()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *logon_request_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.logon_request_);
   }
 
   // .aspia.proto.auth.ClientChallenge client_challenge = 2;
-  if (this->has_client_challenge()) {
+  if (this->_internal_has_client_challenge()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *client_challenge_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.client_challenge_);
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void ClientToHost::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const ClientToHost*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const ClientToHost*>(
+      &from));
 }
 
 void ClientToHost::MergeFrom(const ClientToHost& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.auth.ClientToHost)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  ClientToHost* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.auth.ClientToHost)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.has_logon_request()) {
-    mutable_logon_request()->::aspia::proto::auth::LogonRequest::MergeFrom(from.logon_request());
+  if (from._internal_has_logon_request()) {
+    _this->_internal_mutable_logon_request()->::aspia::proto::auth::LogonRequest::MergeFrom(
+        from._internal_logon_request());
   }
-  if (from.has_client_challenge()) {
-    mutable_client_challenge()->::aspia::proto::auth::ClientChallenge::MergeFrom(from.client_challenge());
+  if (from._internal_has_client_challenge()) {
+    _this->_internal_mutable_client_challenge()->::aspia::proto::auth::ClientChallenge::MergeFrom(
+        from._internal_client_challenge());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void ClientToHost::CopyFrom(const ClientToHost& from) {
@@ -1232,227 +1780,234 @@ bool ClientToHost::IsInitialized() const {
   return true;
 }
 
-void ClientToHost::Swap(ClientToHost* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void ClientToHost::InternalSwap(ClientToHost* other) {
   using std::swap;
-  swap(logon_request_, other->logon_request_);
-  swap(client_challenge_, other->client_challenge_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ClientToHost, _impl_.client_challenge_)
+      + sizeof(ClientToHost::_impl_.client_challenge_)
+      - PROTOBUF_FIELD_OFFSET(ClientToHost, _impl_.logon_request_)>(
+          reinterpret_cast<char*>(&_impl_.logon_request_),
+          reinterpret_cast<char*>(&other->_impl_.logon_request_));
 }
 
-::std::string ClientToHost::GetTypeName() const {
+std::string ClientToHost::GetTypeName() const {
   return "aspia.proto.auth.ClientToHost";
 }
 
 
 // ===================================================================
 
-void HostToClient::InitAsDefaultInstance() {
-  ::aspia::proto::auth::_HostToClient_default_instance_._instance.get_mutable()->server_challenge_ = const_cast< ::aspia::proto::auth::ServerChallenge*>(
-      ::aspia::proto::auth::ServerChallenge::internal_default_instance());
-  ::aspia::proto::auth::_HostToClient_default_instance_._instance.get_mutable()->logon_result_ = const_cast< ::aspia::proto::auth::LogonResult*>(
-      ::aspia::proto::auth::LogonResult::internal_default_instance());
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int HostToClient::kServerChallengeFieldNumber;
-const int HostToClient::kLogonResultFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class HostToClient::_Internal {
+ public:
+  static const ::aspia::proto::auth::ServerChallenge& server_challenge(const HostToClient* msg);
+  static const ::aspia::proto::auth::LogonResult& logon_result(const HostToClient* msg);
+};
 
-HostToClient::HostToClient()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_authorization_2eproto::scc_info_HostToClient.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.auth.HostToClient)
+const ::aspia::proto::auth::ServerChallenge&
+HostToClient::_Internal::server_challenge(const HostToClient* msg) {
+  return *msg->_impl_.server_challenge_;
+}
+const ::aspia::proto::auth::LogonResult&
+HostToClient::_Internal::logon_result(const HostToClient* msg) {
+  return *msg->_impl_.logon_result_;
+}
+HostToClient::HostToClient(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.auth.HostToClient)
 }
 HostToClient::HostToClient(const HostToClient& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.has_server_challenge()) {
-    server_challenge_ = new ::aspia::proto::auth::ServerChallenge(*from.server_challenge_);
-  } else {
-    server_challenge_ = NULL;
-  }
-  if (from.has_logon_result()) {
-    logon_result_ = new ::aspia::proto::auth::LogonResult(*from.logon_result_);
-  } else {
-    logon_result_ = NULL;
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  HostToClient* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.server_challenge_){nullptr}
+    , decltype(_impl_.logon_result_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  if (from._internal_has_server_challenge()) {
+    _this->_impl_.server_challenge_ = new ::aspia::proto::auth::ServerChallenge(*from._impl_.server_challenge_);
+  }
+  if (from._internal_has_logon_result()) {
+    _this->_impl_.logon_result_ = new ::aspia::proto::auth::LogonResult(*from._impl_.logon_result_);
   }
   // @@protoc_insertion_point(copy_constructor:aspia.proto.auth.HostToClient)
 }
 
-void HostToClient::SharedCtor() {
-  ::memset(&server_challenge_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&logon_result_) -
-      reinterpret_cast<char*>(&server_challenge_)) + sizeof(logon_result_));
+inline void HostToClient::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.server_challenge_){nullptr}
+    , decltype(_impl_.logon_result_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 HostToClient::~HostToClient() {
   // @@protoc_insertion_point(destructor:aspia.proto.auth.HostToClient)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void HostToClient::SharedDtor() {
-  if (this != internal_default_instance()) delete server_challenge_;
-  if (this != internal_default_instance()) delete logon_result_;
+inline void HostToClient::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.server_challenge_;
+  if (this != internal_default_instance()) delete _impl_.logon_result_;
 }
 
 void HostToClient::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const HostToClient& HostToClient::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_authorization_2eproto::scc_info_HostToClient.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void HostToClient::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.auth.HostToClient)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaNoVirtual() == NULL && server_challenge_ != NULL) {
-    delete server_challenge_;
-  }
-  server_challenge_ = NULL;
-  if (GetArenaNoVirtual() == NULL && logon_result_ != NULL) {
-    delete logon_result_;
-  }
-  logon_result_ = NULL;
-  _internal_metadata_.Clear();
-}
-
-bool HostToClient::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.auth.HostToClient)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  if (GetArenaForAllocation() == nullptr && _impl_.server_challenge_ != nullptr) {
+    delete _impl_.server_challenge_;
+  }
+  _impl_.server_challenge_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.logon_result_ != nullptr) {
+    delete _impl_.logon_result_;
+  }
+  _impl_.logon_result_ = nullptr;
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* HostToClient::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // .aspia.proto.auth.ServerChallenge server_challenge = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_server_challenge()));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_server_challenge(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .aspia.proto.auth.LogonResult logon_result = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_logon_result()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_logon_result(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.auth.HostToClient)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.auth.HostToClient)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void HostToClient::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.auth.HostToClient)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* HostToClient::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.auth.HostToClient)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .aspia.proto.auth.ServerChallenge server_challenge = 1;
-  if (this->has_server_challenge()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      1, this->_internal_server_challenge(), output);
+  if (this->_internal_has_server_challenge()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::server_challenge(this),
+        _Internal::server_challenge(this).GetCachedSize(), target, stream);
   }
 
   // .aspia.proto.auth.LogonResult logon_result = 2;
-  if (this->has_logon_result()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      2, this->_internal_logon_result(), output);
+  if (this->_internal_has_logon_result()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::logon_result(this),
+        _Internal::logon_result(this).GetCachedSize(), target, stream);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.auth.HostToClient)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.auth.HostToClient)
+  return target;
 }
 
 size_t HostToClient::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.auth.HostToClient)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // .aspia.proto.auth.ServerChallenge server_challenge = 1;
-  if (this->has_server_challenge()) {
+  if (this->_internal_has_server_challenge()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *server_challenge_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.server_challenge_);
   }
 
   // .aspia.proto.auth.LogonResult logon_result = 2;
-  if (this->has_logon_result()) {
+  if (this->_internal_has_logon_result()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *logon_result_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.logon_result_);
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void HostToClient::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const HostToClient*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const HostToClient*>(
+      &from));
 }
 
 void HostToClient::MergeFrom(const HostToClient& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.auth.HostToClient)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  HostToClient* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.auth.HostToClient)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.has_server_challenge()) {
-    mutable_server_challenge()->::aspia::proto::auth::ServerChallenge::MergeFrom(from.server_challenge());
+  if (from._internal_has_server_challenge()) {
+    _this->_internal_mutable_server_challenge()->::aspia::proto::auth::ServerChallenge::MergeFrom(
+        from._internal_server_challenge());
   }
-  if (from.has_logon_result()) {
-    mutable_logon_result()->::aspia::proto::auth::LogonResult::MergeFrom(from.logon_result());
+  if (from._internal_has_logon_result()) {
+    _this->_internal_mutable_logon_result()->::aspia::proto::auth::LogonResult::MergeFrom(
+        from._internal_logon_result());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void HostToClient::CopyFrom(const HostToClient& from) {
@@ -1466,18 +2021,18 @@ bool HostToClient::IsInitialized() const {
   return true;
 }
 
-void HostToClient::Swap(HostToClient* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void HostToClient::InternalSwap(HostToClient* other) {
   using std::swap;
-  swap(server_challenge_, other->server_challenge_);
-  swap(logon_result_, other->logon_result_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(HostToClient, _impl_.logon_result_)
+      + sizeof(HostToClient::_impl_.logon_result_)
+      - PROTOBUF_FIELD_OFFSET(HostToClient, _impl_.server_challenge_)>(
+          reinterpret_cast<char*>(&_impl_.server_challenge_),
+          reinterpret_cast<char*>(&other->_impl_.server_challenge_));
 }
 
-::std::string HostToClient::GetTypeName() const {
+std::string HostToClient::GetTypeName() const {
   return "aspia.proto.auth.HostToClient";
 }
 
@@ -1486,27 +2041,32 @@ void HostToClient::InternalSwap(HostToClient* other) {
 }  // namespace auth
 }  // namespace proto
 }  // namespace aspia
-namespace google {
-namespace protobuf {
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::auth::LogonRequest* Arena::CreateMaybeMessage< ::aspia::proto::auth::LogonRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::auth::LogonRequest >(arena);
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::aspia::proto::auth::LogonRequest*
+Arena::CreateMaybeMessage< ::aspia::proto::auth::LogonRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::auth::LogonRequest >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::auth::ServerChallenge* Arena::CreateMaybeMessage< ::aspia::proto::auth::ServerChallenge >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::auth::ServerChallenge >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::auth::ServerChallenge*
+Arena::CreateMaybeMessage< ::aspia::proto::auth::ServerChallenge >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::auth::ServerChallenge >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::auth::ClientChallenge* Arena::CreateMaybeMessage< ::aspia::proto::auth::ClientChallenge >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::auth::ClientChallenge >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::auth::ClientChallenge*
+Arena::CreateMaybeMessage< ::aspia::proto::auth::ClientChallenge >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::auth::ClientChallenge >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::auth::LogonResult* Arena::CreateMaybeMessage< ::aspia::proto::auth::LogonResult >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::auth::LogonResult >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::auth::LogonResult*
+Arena::CreateMaybeMessage< ::aspia::proto::auth::LogonResult >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::auth::LogonResult >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::auth::ClientToHost* Arena::CreateMaybeMessage< ::aspia::proto::auth::ClientToHost >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::auth::ClientToHost >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::auth::ClientToHost*
+Arena::CreateMaybeMessage< ::aspia::proto::auth::ClientToHost >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::auth::ClientToHost >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::auth::HostToClient* Arena::CreateMaybeMessage< ::aspia::proto::auth::HostToClient >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::auth::HostToClient >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::auth::HostToClient*
+Arena::CreateMaybeMessage< ::aspia::proto::auth::HostToClient >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::auth::HostToClient >(arena);
 }
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
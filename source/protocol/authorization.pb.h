@@ -1,156 +1,208 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: authorization.proto
 
-#ifndef PROTOBUF_INCLUDED_authorization_2eproto
-#define PROTOBUF_INCLUDED_authorization_2eproto
+#ifndef GOOGLE_PROTOBUF_INCLUDED_authorization_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_authorization_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3006000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3006000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/message_lite.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/generated_enum_util.h>
 // @@protoc_insertion_point(includes)
-#define PROTOBUF_INTERNAL_EXPORT_protobuf_authorization_2eproto 
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_authorization_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
 
-namespace protobuf_authorization_2eproto {
 // Internal implementation detail -- do not use these members.
-struct TableStruct {
-  static const ::google::protobuf::internal::ParseTableField entries[];
-  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
-  static const ::google::protobuf::internal::ParseTable schema[6];
-  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
-  static const ::google::protobuf::internal::SerializationTable serialization_table[];
-  static const ::google::protobuf::uint32 offsets[];
+struct TableStruct_authorization_2eproto {
+  static const uint32_t offsets[];
 };
-}  // namespace protobuf_authorization_2eproto
 namespace aspia {
 namespace proto {
 namespace auth {
 class ClientChallenge;
-class ClientChallengeDefaultTypeInternal;
+struct ClientChallengeDefaultTypeInternal;
 extern ClientChallengeDefaultTypeInternal _ClientChallenge_default_instance_;
 class ClientToHost;
-class ClientToHostDefaultTypeInternal;
+struct ClientToHostDefaultTypeInternal;
 extern ClientToHostDefaultTypeInternal _ClientToHost_default_instance_;
 class HostToClient;
-class HostToClientDefaultTypeInternal;
+struct HostToClientDefaultTypeInternal;
 extern HostToClientDefaultTypeInternal _HostToClient_default_instance_;
 class LogonRequest;
-class LogonRequestDefaultTypeInternal;
+struct LogonRequestDefaultTypeInternal;
 extern LogonRequestDefaultTypeInternal _LogonRequest_default_instance_;
 class LogonResult;
-class LogonResultDefaultTypeInternal;
+struct LogonResultDefaultTypeInternal;
 extern LogonResultDefaultTypeInternal _LogonResult_default_instance_;
 class ServerChallenge;
-class ServerChallengeDefaultTypeInternal;
+struct ServerChallengeDefaultTypeInternal;
 extern ServerChallengeDefaultTypeInternal _ServerChallenge_default_instance_;
 }  // namespace auth
 }  // namespace proto
 }  // namespace aspia
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 template<> ::aspia::proto::auth::ClientChallenge* Arena::CreateMaybeMessage<::aspia::proto::auth::ClientChallenge>(Arena*);
 template<> ::aspia::proto::auth::ClientToHost* Arena::CreateMaybeMessage<::aspia::proto::auth::ClientToHost>(Arena*);
 template<> ::aspia::proto::auth::HostToClient* Arena::CreateMaybeMessage<::aspia::proto::auth::HostToClient>(Arena*);
 template<> ::aspia::proto::auth::LogonRequest* Arena::CreateMaybeMessage<::aspia::proto::auth::LogonRequest>(Arena*);
 template<> ::aspia::proto::auth::LogonResult* Arena::CreateMaybeMessage<::aspia::proto::auth::LogonResult>(Arena*);
 template<> ::aspia::proto::auth::ServerChallenge* Arena::CreateMaybeMessage<::aspia::proto::auth::ServerChallenge>(Arena*);
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 namespace aspia {
 namespace proto {
 namespace auth {
 
-enum Method {
+enum Method : int {
   METHOD_UNKNOWN = 0,
   METHOD_BASIC = 1,
-  Method_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  Method_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  Method_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Method_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool Method_IsValid(int value);
-const Method Method_MIN = METHOD_UNKNOWN;
-const Method Method_MAX = METHOD_BASIC;
-const int Method_ARRAYSIZE = Method_MAX + 1;
-
-enum SessionType {
+constexpr Method Method_MIN = METHOD_UNKNOWN;
+constexpr Method Method_MAX = METHOD_BASIC;
+constexpr int Method_ARRAYSIZE = Method_MAX + 1;
+
+const std::string& Method_Name(Method value);
+template<typename T>
+inline const std::string& Method_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Method>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Method_Name.");
+  return Method_Name(static_cast<Method>(enum_t_value));
+}
+bool Method_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Method* value);
+enum SessionType : int {
   SESSION_TYPE_UNKNOWN = 0,
   SESSION_TYPE_DESKTOP_MANAGE = 1,
   SESSION_TYPE_DESKTOP_VIEW = 2,
   SESSION_TYPE_FILE_TRANSFER = 4,
   SESSION_TYPE_SYSTEM_INFO = 8,
-  SessionType_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  SessionType_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  SessionType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  SessionType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool SessionType_IsValid(int value);
-const SessionType SessionType_MIN = SESSION_TYPE_UNKNOWN;
-const SessionType SessionType_MAX = SESSION_TYPE_SYSTEM_INFO;
-const int SessionType_ARRAYSIZE = SessionType_MAX + 1;
-
-enum Status {
+constexpr SessionType SessionType_MIN = SESSION_TYPE_UNKNOWN;
+constexpr SessionType SessionType_MAX = SESSION_TYPE_SYSTEM_INFO;
+constexpr int SessionType_ARRAYSIZE = SessionType_MAX + 1;
+
+const std::string& SessionType_Name(SessionType value);
+template<typename T>
+inline const std::string& SessionType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, SessionType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function SessionType_Name.");
+  return SessionType_Name(static_cast<SessionType>(enum_t_value));
+}
+bool SessionType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, SessionType* value);
+enum PasswordHashing : int {
+  PASSWORD_HASHING_SHA512 = 0,
+  PASSWORD_HASHING_ARGON2ID = 1,
+  PasswordHashing_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  PasswordHashing_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool PasswordHashing_IsValid(int value);
+constexpr PasswordHashing PasswordHashing_MIN = PASSWORD_HASHING_SHA512;
+constexpr PasswordHashing PasswordHashing_MAX = PASSWORD_HASHING_ARGON2ID;
+constexpr int PasswordHashing_ARRAYSIZE = PasswordHashing_MAX + 1;
+
+const std::string& PasswordHashing_Name(PasswordHashing value);
+template<typename T>
+inline const std::string& PasswordHashing_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, PasswordHashing>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function PasswordHashing_Name.");
+  return PasswordHashing_Name(static_cast<PasswordHashing>(enum_t_value));
+}
+bool PasswordHashing_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, PasswordHashing* value);
+enum Status : int {
   STATUS_UNKNOWN = 0,
   STATUS_SUCCESS = 1,
   STATUS_ACCESS_DENIED = 2,
   STATUS_CANCELED = 3,
-  Status_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  Status_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  Status_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Status_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool Status_IsValid(int value);
-const Status Status_MIN = STATUS_UNKNOWN;
-const Status Status_MAX = STATUS_CANCELED;
-const int Status_ARRAYSIZE = Status_MAX + 1;
-
+constexpr Status Status_MIN = STATUS_UNKNOWN;
+constexpr Status Status_MAX = STATUS_CANCELED;
+constexpr int Status_ARRAYSIZE = Status_MAX + 1;
+
+const std::string& Status_Name(Status value);
+template<typename T>
+inline const std::string& Status_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Status>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Status_Name.");
+  return Status_Name(static_cast<Status>(enum_t_value));
+}
+bool Status_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Status* value);
 // ===================================================================
 
-class LogonRequest : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.auth.LogonRequest) */ {
+class LogonRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.auth.LogonRequest) */ {
  public:
-  LogonRequest();
-  virtual ~LogonRequest();
+  inline LogonRequest() : LogonRequest(nullptr) {}
+  ~LogonRequest() override;
+  explicit PROTOBUF_CONSTEXPR LogonRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   LogonRequest(const LogonRequest& from);
-
-  inline LogonRequest& operator=(const LogonRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   LogonRequest(LogonRequest&& from) noexcept
     : LogonRequest() {
     *this = ::std::move(from);
   }
 
+  inline LogonRequest& operator=(const LogonRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline LogonRequest& operator=(LogonRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const LogonRequest& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const LogonRequest& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const LogonRequest* internal_default_instance() {
     return reinterpret_cast<const LogonRequest*>(
                &_LogonRequest_default_instance_);
@@ -158,100 +210,181 @@ class LogonRequest : public ::google::protobuf::MessageLite /* @@protoc_insertio
   static constexpr int kIndexInFileMessages =
     0;
 
-  void Swap(LogonRequest* other);
   friend void swap(LogonRequest& a, LogonRequest& b) {
     a.Swap(&b);
   }
+  inline void Swap(LogonRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LogonRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline LogonRequest* New() const final {
-    return CreateMaybeMessage<LogonRequest>(NULL);
-  }
-
-  LogonRequest* New(::google::protobuf::Arena* arena) const final {
+  LogonRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<LogonRequest>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const LogonRequest& from);
   void MergeFrom(const LogonRequest& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(LogonRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.auth.LogonRequest";
   }
+  protected:
+  explicit LogonRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kUsernameFieldNumber = 2,
+    kResumeTicketFieldNumber = 3,
+    kExpectedChallengeFieldNumber = 4,
+    kMethodFieldNumber = 1,
+  };
+  // string username = 2;
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // bytes resume_ticket = 3;
+  void clear_resume_ticket();
+  const std::string& resume_ticket() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_resume_ticket(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_resume_ticket();
+  PROTOBUF_NODISCARD std::string* release_resume_ticket();
+  void set_allocated_resume_ticket(std::string* resume_ticket);
+  private:
+  const std::string& _internal_resume_ticket() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_resume_ticket(const std::string& value);
+  std::string* _internal_mutable_resume_ticket();
+  public:
+
+  // .aspia.proto.auth.ServerChallenge expected_challenge = 4;
+  bool has_expected_challenge() const;
+  private:
+  bool _internal_has_expected_challenge() const;
+  public:
+  void clear_expected_challenge();
+  const ::aspia::proto::auth::ServerChallenge& expected_challenge() const;
+  PROTOBUF_NODISCARD ::aspia::proto::auth::ServerChallenge* release_expected_challenge();
+  ::aspia::proto::auth::ServerChallenge* mutable_expected_challenge();
+  void set_allocated_expected_challenge(::aspia::proto::auth::ServerChallenge* expected_challenge);
+  private:
+  const ::aspia::proto::auth::ServerChallenge& _internal_expected_challenge() const;
+  ::aspia::proto::auth::ServerChallenge* _internal_mutable_expected_challenge();
+  public:
+  void unsafe_arena_set_allocated_expected_challenge(
+      ::aspia::proto::auth::ServerChallenge* expected_challenge);
+  ::aspia::proto::auth::ServerChallenge* unsafe_arena_release_expected_challenge();
+
   // .aspia.proto.auth.Method method = 1;
   void clear_method();
-  static const int kMethodFieldNumber = 1;
   ::aspia::proto::auth::Method method() const;
   void set_method(::aspia::proto::auth::Method value);
+  private:
+  ::aspia::proto::auth::Method _internal_method() const;
+  void _internal_set_method(::aspia::proto::auth::Method value);
+  public:
 
   // @@protoc_insertion_point(class_scope:aspia.proto.auth.LogonRequest)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  int method_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_authorization_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr resume_ticket_;
+    ::aspia::proto::auth::ServerChallenge* expected_challenge_;
+    int method_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_authorization_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ServerChallenge : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.auth.ServerChallenge) */ {
+class ServerChallenge final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.auth.ServerChallenge) */ {
  public:
-  ServerChallenge();
-  virtual ~ServerChallenge();
+  inline ServerChallenge() : ServerChallenge(nullptr) {}
+  ~ServerChallenge() override;
+  explicit PROTOBUF_CONSTEXPR ServerChallenge(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ServerChallenge(const ServerChallenge& from);
-
-  inline ServerChallenge& operator=(const ServerChallenge& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   ServerChallenge(ServerChallenge&& from) noexcept
     : ServerChallenge() {
     *this = ::std::move(from);
   }
 
+  inline ServerChallenge& operator=(const ServerChallenge& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline ServerChallenge& operator=(ServerChallenge&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ServerChallenge& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ServerChallenge& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const ServerChallenge* internal_default_instance() {
     return reinterpret_cast<const ServerChallenge*>(
                &_ServerChallenge_default_instance_);
@@ -259,108 +392,183 @@ class ServerChallenge : public ::google::protobuf::MessageLite /* @@protoc_inser
   static constexpr int kIndexInFileMessages =
     1;
 
-  void Swap(ServerChallenge* other);
   friend void swap(ServerChallenge& a, ServerChallenge& b) {
     a.Swap(&b);
   }
+  inline void Swap(ServerChallenge* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerChallenge* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline ServerChallenge* New() const final {
-    return CreateMaybeMessage<ServerChallenge>(NULL);
-  }
-
-  ServerChallenge* New(::google::protobuf::Arena* arena) const final {
+  ServerChallenge* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ServerChallenge>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const ServerChallenge& from);
   void MergeFrom(const ServerChallenge& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(ServerChallenge* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.auth.ServerChallenge";
   }
+  protected:
+  explicit ServerChallenge(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNonceFieldNumber = 1,
+    kPasswordSaltFieldNumber = 3,
+    kPasswordHashingFieldNumber = 2,
+    kOpsLimitFieldNumber = 4,
+    kMemLimitFieldNumber = 5,
+  };
   // bytes nonce = 1;
   void clear_nonce();
-  static const int kNonceFieldNumber = 1;
-  const ::std::string& nonce() const;
-  void set_nonce(const ::std::string& value);
-  #if LANG_CXX11
-  void set_nonce(::std::string&& value);
-  #endif
-  void set_nonce(const char* value);
-  void set_nonce(const void* value, size_t size);
-  ::std::string* mutable_nonce();
-  ::std::string* release_nonce();
-  void set_allocated_nonce(::std::string* nonce);
+  const std::string& nonce() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_nonce(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_nonce();
+  PROTOBUF_NODISCARD std::string* release_nonce();
+  void set_allocated_nonce(std::string* nonce);
+  private:
+  const std::string& _internal_nonce() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_nonce(const std::string& value);
+  std::string* _internal_mutable_nonce();
+  public:
+
+  // bytes password_salt = 3;
+  void clear_password_salt();
+  const std::string& password_salt() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_password_salt(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_password_salt();
+  PROTOBUF_NODISCARD std::string* release_password_salt();
+  void set_allocated_password_salt(std::string* password_salt);
+  private:
+  const std::string& _internal_password_salt() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_password_salt(const std::string& value);
+  std::string* _internal_mutable_password_salt();
+  public:
+
+  // .aspia.proto.auth.PasswordHashing password_hashing = 2;
+  void clear_password_hashing();
+  ::aspia::proto::auth::PasswordHashing password_hashing() const;
+  void set_password_hashing(::aspia::proto::auth::PasswordHashing value);
+  private:
+  ::aspia::proto::auth::PasswordHashing _internal_password_hashing() const;
+  void _internal_set_password_hashing(::aspia::proto::auth::PasswordHashing value);
+  public:
+
+  // uint32 ops_limit = 4;
+  void clear_ops_limit();
+  uint32_t ops_limit() const;
+  void set_ops_limit(uint32_t value);
+  private:
+  uint32_t _internal_ops_limit() const;
+  void _internal_set_ops_limit(uint32_t value);
+  public:
+
+  // uint32 mem_limit = 5;
+  void clear_mem_limit();
+  uint32_t mem_limit() const;
+  void set_mem_limit(uint32_t value);
+  private:
+  uint32_t _internal_mem_limit() const;
+  void _internal_set_mem_limit(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:aspia.proto.auth.ServerChallenge)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr nonce_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_authorization_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr nonce_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr password_salt_;
+    int password_hashing_;
+    uint32_t ops_limit_;
+    uint32_t mem_limit_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_authorization_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ClientChallenge : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.auth.ClientChallenge) */ {
+class ClientChallenge final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.auth.ClientChallenge) */ {
  public:
-  ClientChallenge();
-  virtual ~ClientChallenge();
+  inline ClientChallenge() : ClientChallenge(nullptr) {}
+  ~ClientChallenge() override;
+  explicit PROTOBUF_CONSTEXPR ClientChallenge(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ClientChallenge(const ClientChallenge& from);
-
-  inline ClientChallenge& operator=(const ClientChallenge& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   ClientChallenge(ClientChallenge&& from) noexcept
     : ClientChallenge() {
     *this = ::std::move(from);
   }
 
+  inline ClientChallenge& operator=(const ClientChallenge& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline ClientChallenge& operator=(ClientChallenge&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ClientChallenge& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ClientChallenge& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const ClientChallenge* internal_default_instance() {
     return reinterpret_cast<const ClientChallenge*>(
                &_ClientChallenge_default_instance_);
@@ -368,130 +576,161 @@ class ClientChallenge : public ::google::protobuf::MessageLite /* @@protoc_inser
   static constexpr int kIndexInFileMessages =
     2;
 
-  void Swap(ClientChallenge* other);
   friend void swap(ClientChallenge& a, ClientChallenge& b) {
     a.Swap(&b);
   }
+  inline void Swap(ClientChallenge* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ClientChallenge* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline ClientChallenge* New() const final {
-    return CreateMaybeMessage<ClientChallenge>(NULL);
-  }
-
-  ClientChallenge* New(::google::protobuf::Arena* arena) const final {
+  ClientChallenge* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ClientChallenge>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const ClientChallenge& from);
   void MergeFrom(const ClientChallenge& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(ClientChallenge* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.auth.ClientChallenge";
   }
+  protected:
+  explicit ClientChallenge(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kUsernameFieldNumber = 2,
+    kSessionKeyFieldNumber = 3,
+    kSessionTypeFieldNumber = 1,
+  };
   // string username = 2;
   void clear_username();
-  static const int kUsernameFieldNumber = 2;
-  const ::std::string& username() const;
-  void set_username(const ::std::string& value);
-  #if LANG_CXX11
-  void set_username(::std::string&& value);
-  #endif
-  void set_username(const char* value);
-  void set_username(const char* value, size_t size);
-  ::std::string* mutable_username();
-  ::std::string* release_username();
-  void set_allocated_username(::std::string* username);
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
 
   // bytes session_key = 3;
   void clear_session_key();
-  static const int kSessionKeyFieldNumber = 3;
-  const ::std::string& session_key() const;
-  void set_session_key(const ::std::string& value);
-  #if LANG_CXX11
-  void set_session_key(::std::string&& value);
-  #endif
-  void set_session_key(const char* value);
-  void set_session_key(const void* value, size_t size);
-  ::std::string* mutable_session_key();
-  ::std::string* release_session_key();
-  void set_allocated_session_key(::std::string* session_key);
+  const std::string& session_key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_session_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_session_key();
+  PROTOBUF_NODISCARD std::string* release_session_key();
+  void set_allocated_session_key(std::string* session_key);
+  private:
+  const std::string& _internal_session_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_session_key(const std::string& value);
+  std::string* _internal_mutable_session_key();
+  public:
 
   // .aspia.proto.auth.SessionType session_type = 1;
   void clear_session_type();
-  static const int kSessionTypeFieldNumber = 1;
   ::aspia::proto::auth::SessionType session_type() const;
   void set_session_type(::aspia::proto::auth::SessionType value);
+  private:
+  ::aspia::proto::auth::SessionType _internal_session_type() const;
+  void _internal_set_session_type(::aspia::proto::auth::SessionType value);
+  public:
 
   // @@protoc_insertion_point(class_scope:aspia.proto.auth.ClientChallenge)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr username_;
-  ::google::protobuf::internal::ArenaStringPtr session_key_;
-  int session_type_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_authorization_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr session_key_;
+    int session_type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_authorization_2eproto;
 };
 // -------------------------------------------------------------------
 
-class LogonResult : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.auth.LogonResult) */ {
+class LogonResult final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.auth.LogonResult) */ {
  public:
-  LogonResult();
-  virtual ~LogonResult();
+  inline LogonResult() : LogonResult(nullptr) {}
+  ~LogonResult() override;
+  explicit PROTOBUF_CONSTEXPR LogonResult(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   LogonResult(const LogonResult& from);
-
-  inline LogonResult& operator=(const LogonResult& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   LogonResult(LogonResult&& from) noexcept
     : LogonResult() {
     *this = ::std::move(from);
   }
 
+  inline LogonResult& operator=(const LogonResult& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline LogonResult& operator=(LogonResult&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const LogonResult& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const LogonResult& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const LogonResult* internal_default_instance() {
     return reinterpret_cast<const LogonResult*>(
                &_LogonResult_default_instance_);
@@ -499,100 +738,161 @@ class LogonResult : public ::google::protobuf::MessageLite /* @@protoc_insertion
   static constexpr int kIndexInFileMessages =
     3;
 
-  void Swap(LogonResult* other);
   friend void swap(LogonResult& a, LogonResult& b) {
     a.Swap(&b);
   }
+  inline void Swap(LogonResult* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LogonResult* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline LogonResult* New() const final {
-    return CreateMaybeMessage<LogonResult>(NULL);
-  }
-
-  LogonResult* New(::google::protobuf::Arena* arena) const final {
+  LogonResult* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<LogonResult>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const LogonResult& from);
   void MergeFrom(const LogonResult& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(LogonResult* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.auth.LogonResult";
   }
+  protected:
+  explicit LogonResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kResumeTicketFieldNumber = 2,
+    kConfigRequestFieldNumber = 3,
+    kStatusFieldNumber = 1,
+  };
+  // bytes resume_ticket = 2;
+  void clear_resume_ticket();
+  const std::string& resume_ticket() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_resume_ticket(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_resume_ticket();
+  PROTOBUF_NODISCARD std::string* release_resume_ticket();
+  void set_allocated_resume_ticket(std::string* resume_ticket);
+  private:
+  const std::string& _internal_resume_ticket() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_resume_ticket(const std::string& value);
+  std::string* _internal_mutable_resume_ticket();
+  public:
+
+  // bytes config_request = 3;
+  void clear_config_request();
+  const std::string& config_request() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_config_request(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_config_request();
+  PROTOBUF_NODISCARD std::string* release_config_request();
+  void set_allocated_config_request(std::string* config_request);
+  private:
+  const std::string& _internal_config_request() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_config_request(const std::string& value);
+  std::string* _internal_mutable_config_request();
+  public:
+
   // .aspia.proto.auth.Status status = 1;
   void clear_status();
-  static const int kStatusFieldNumber = 1;
   ::aspia::proto::auth::Status status() const;
   void set_status(::aspia::proto::auth::Status value);
+  private:
+  ::aspia::proto::auth::Status _internal_status() const;
+  void _internal_set_status(::aspia::proto::auth::Status value);
+  public:
 
   // @@protoc_insertion_point(class_scope:aspia.proto.auth.LogonResult)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  int status_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_authorization_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr resume_ticket_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr config_request_;
+    int status_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_authorization_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ClientToHost : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.auth.ClientToHost) */ {
+class ClientToHost final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.auth.ClientToHost) */ {
  public:
-  ClientToHost();
-  virtual ~ClientToHost();
+  inline ClientToHost() : ClientToHost(nullptr) {}
+  ~ClientToHost() override;
+  explicit PROTOBUF_CONSTEXPR ClientToHost(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ClientToHost(const ClientToHost& from);
-
-  inline ClientToHost& operator=(const ClientToHost& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   ClientToHost(ClientToHost&& from) noexcept
     : ClientToHost() {
     *this = ::std::move(from);
   }
 
+  inline ClientToHost& operator=(const ClientToHost& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline ClientToHost& operator=(ClientToHost&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ClientToHost& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ClientToHost& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const ClientToHost* internal_default_instance() {
     return reinterpret_cast<const ClientToHost*>(
                &_ClientToHost_default_instance_);
@@ -600,119 +900,158 @@ class ClientToHost : public ::google::protobuf::MessageLite /* @@protoc_insertio
   static constexpr int kIndexInFileMessages =
     4;
 
-  void Swap(ClientToHost* other);
   friend void swap(ClientToHost& a, ClientToHost& b) {
     a.Swap(&b);
   }
+  inline void Swap(ClientToHost* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ClientToHost* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline ClientToHost* New() const final {
-    return CreateMaybeMessage<ClientToHost>(NULL);
-  }
-
-  ClientToHost* New(::google::protobuf::Arena* arena) const final {
+  ClientToHost* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ClientToHost>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const ClientToHost& from);
   void MergeFrom(const ClientToHost& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(ClientToHost* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.auth.ClientToHost";
   }
+  protected:
+  explicit ClientToHost(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kLogonRequestFieldNumber = 1,
+    kClientChallengeFieldNumber = 2,
+  };
   // .aspia.proto.auth.LogonRequest logon_request = 1;
   bool has_logon_request() const;
-  void clear_logon_request();
-  static const int kLogonRequestFieldNumber = 1;
   private:
-  const ::aspia::proto::auth::LogonRequest& _internal_logon_request() const;
+  bool _internal_has_logon_request() const;
   public:
+  void clear_logon_request();
   const ::aspia::proto::auth::LogonRequest& logon_request() const;
-  ::aspia::proto::auth::LogonRequest* release_logon_request();
+  PROTOBUF_NODISCARD ::aspia::proto::auth::LogonRequest* release_logon_request();
   ::aspia::proto::auth::LogonRequest* mutable_logon_request();
   void set_allocated_logon_request(::aspia::proto::auth::LogonRequest* logon_request);
+  private:
+  const ::aspia::proto::auth::LogonRequest& _internal_logon_request() const;
+  ::aspia::proto::auth::LogonRequest* _internal_mutable_logon_request();
+  public:
+  void unsafe_arena_set_allocated_logon_request(
+      ::aspia::proto::auth::LogonRequest* logon_request);
+  ::aspia::proto::auth::LogonRequest* unsafe_arena_release_logon_request();
 
   // .aspia.proto.auth.ClientChallenge client_challenge = 2;
   bool has_client_challenge() const;
-  void clear_client_challenge();
-  static const int kClientChallengeFieldNumber = 2;
   private:
-  const ::aspia::proto::auth::ClientChallenge& _internal_client_challenge() const;
+  bool _internal_has_client_challenge() const;
   public:
+  void clear_client_challenge();
   const ::aspia::proto::auth::ClientChallenge& client_challenge() const;
-  ::aspia::proto::auth::ClientChallenge* release_client_challenge();
+  PROTOBUF_NODISCARD ::aspia::proto::auth::ClientChallenge* release_client_challenge();
   ::aspia::proto::auth::ClientChallenge* mutable_client_challenge();
   void set_allocated_client_challenge(::aspia::proto::auth::ClientChallenge* client_challenge);
+  private:
+  const ::aspia::proto::auth::ClientChallenge& _internal_client_challenge() const;
+  ::aspia::proto::auth::ClientChallenge* _internal_mutable_client_challenge();
+  public:
+  void unsafe_arena_set_allocated_client_challenge(
+      ::aspia::proto::auth::ClientChallenge* client_challenge);
+  ::aspia::proto::auth::ClientChallenge* unsafe_arena_release_client_challenge();
 
   // @@protoc_insertion_point(class_scope:aspia.proto.auth.ClientToHost)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::aspia::proto::auth::LogonRequest* logon_request_;
-  ::aspia::proto::auth::ClientChallenge* client_challenge_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_authorization_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::aspia::proto::auth::LogonRequest* logon_request_;
+    ::aspia::proto::auth::ClientChallenge* client_challenge_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_authorization_2eproto;
 };
 // -------------------------------------------------------------------
 
-class HostToClient : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.auth.HostToClient) */ {
+class HostToClient final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.auth.HostToClient) */ {
  public:
-  HostToClient();
-  virtual ~HostToClient();
+  inline HostToClient() : HostToClient(nullptr) {}
+  ~HostToClient() override;
+  explicit PROTOBUF_CONSTEXPR HostToClient(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   HostToClient(const HostToClient& from);
-
-  inline HostToClient& operator=(const HostToClient& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   HostToClient(HostToClient&& from) noexcept
     : HostToClient() {
     *this = ::std::move(from);
   }
 
+  inline HostToClient& operator=(const HostToClient& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline HostToClient& operator=(HostToClient&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const HostToClient& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const HostToClient& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const HostToClient* internal_default_instance() {
     return reinterpret_cast<const HostToClient*>(
                &_HostToClient_default_instance_);
@@ -720,87 +1059,121 @@ class HostToClient : public ::google::protobuf::MessageLite /* @@protoc_insertio
   static constexpr int kIndexInFileMessages =
     5;
 
-  void Swap(HostToClient* other);
   friend void swap(HostToClient& a, HostToClient& b) {
     a.Swap(&b);
   }
+  inline void Swap(HostToClient* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HostToClient* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline HostToClient* New() const final {
-    return CreateMaybeMessage<HostToClient>(NULL);
-  }
-
-  HostToClient* New(::google::protobuf::Arena* arena) const final {
+  HostToClient* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<HostToClient>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const HostToClient& from);
   void MergeFrom(const HostToClient& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(HostToClient* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.auth.HostToClient";
   }
+  protected:
+  explicit HostToClient(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kServerChallengeFieldNumber = 1,
+    kLogonResultFieldNumber = 2,
+  };
   // .aspia.proto.auth.ServerChallenge server_challenge = 1;
   bool has_server_challenge() const;
-  void clear_server_challenge();
-  static const int kServerChallengeFieldNumber = 1;
   private:
-  const ::aspia::proto::auth::ServerChallenge& _internal_server_challenge() const;
+  bool _internal_has_server_challenge() const;
   public:
+  void clear_server_challenge();
   const ::aspia::proto::auth::ServerChallenge& server_challenge() const;
-  ::aspia::proto::auth::ServerChallenge* release_server_challenge();
+  PROTOBUF_NODISCARD ::aspia::proto::auth::ServerChallenge* release_server_challenge();
   ::aspia::proto::auth::ServerChallenge* mutable_server_challenge();
   void set_allocated_server_challenge(::aspia::proto::auth::ServerChallenge* server_challenge);
+  private:
+  const ::aspia::proto::auth::ServerChallenge& _internal_server_challenge() const;
+  ::aspia::proto::auth::ServerChallenge* _internal_mutable_server_challenge();
+  public:
+  void unsafe_arena_set_allocated_server_challenge(
+      ::aspia::proto::auth::ServerChallenge* server_challenge);
+  ::aspia::proto::auth::ServerChallenge* unsafe_arena_release_server_challenge();
 
   // .aspia.proto.auth.LogonResult logon_result = 2;
   bool has_logon_result() const;
-  void clear_logon_result();
-  static const int kLogonResultFieldNumber = 2;
   private:
-  const ::aspia::proto::auth::LogonResult& _internal_logon_result() const;
+  bool _internal_has_logon_result() const;
   public:
+  void clear_logon_result();
   const ::aspia::proto::auth::LogonResult& logon_result() const;
-  ::aspia::proto::auth::LogonResult* release_logon_result();
+  PROTOBUF_NODISCARD ::aspia::proto::auth::LogonResult* release_logon_result();
   ::aspia::proto::auth::LogonResult* mutable_logon_result();
   void set_allocated_logon_result(::aspia::proto::auth::LogonResult* logon_result);
+  private:
+  const ::aspia::proto::auth::LogonResult& _internal_logon_result() const;
+  ::aspia::proto::auth::LogonResult* _internal_mutable_logon_result();
+  public:
+  void unsafe_arena_set_allocated_logon_result(
+      ::aspia::proto::auth::LogonResult* logon_result);
+  ::aspia::proto::auth::LogonResult* unsafe_arena_release_logon_result();
 
   // @@protoc_insertion_point(class_scope:aspia.proto.auth.HostToClient)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::aspia::proto::auth::ServerChallenge* server_challenge_;
-  ::aspia::proto::auth::LogonResult* logon_result_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_authorization_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::aspia::proto::auth::ServerChallenge* server_challenge_;
+    ::aspia::proto::auth::LogonResult* logon_result_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_authorization_2eproto;
 };
 // ===================================================================
 
@@ -815,73 +1188,376 @@ class HostToClient : public ::google::protobuf::MessageLite /* @@protoc_insertio
 
 // .aspia.proto.auth.Method method = 1;
 inline void LogonRequest::clear_method() {
-  method_ = 0;
+  _impl_.method_ = 0;
+}
+inline ::aspia::proto::auth::Method LogonRequest::_internal_method() const {
+  return static_cast< ::aspia::proto::auth::Method >(_impl_.method_);
 }
 inline ::aspia::proto::auth::Method LogonRequest::method() const {
   // @@protoc_insertion_point(field_get:aspia.proto.auth.LogonRequest.method)
-  return static_cast< ::aspia::proto::auth::Method >(method_);
+  return _internal_method();
 }
-inline void LogonRequest::set_method(::aspia::proto::auth::Method value) {
+inline void LogonRequest::_internal_set_method(::aspia::proto::auth::Method value) {
   
-  method_ = value;
+  _impl_.method_ = value;
+}
+inline void LogonRequest::set_method(::aspia::proto::auth::Method value) {
+  _internal_set_method(value);
   // @@protoc_insertion_point(field_set:aspia.proto.auth.LogonRequest.method)
 }
 
+// string username = 2;
+inline void LogonRequest::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& LogonRequest::username() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.auth.LogonRequest.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LogonRequest::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.auth.LogonRequest.username)
+}
+inline std::string* LogonRequest::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.auth.LogonRequest.username)
+  return _s;
+}
+inline const std::string& LogonRequest::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void LogonRequest::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LogonRequest::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LogonRequest::release_username() {
+  // @@protoc_insertion_point(field_release:aspia.proto.auth.LogonRequest.username)
+  return _impl_.username_.Release();
+}
+inline void LogonRequest::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.auth.LogonRequest.username)
+}
+
+// bytes resume_ticket = 3;
+inline void LogonRequest::clear_resume_ticket() {
+  _impl_.resume_ticket_.ClearToEmpty();
+}
+inline const std::string& LogonRequest::resume_ticket() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.auth.LogonRequest.resume_ticket)
+  return _internal_resume_ticket();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LogonRequest::set_resume_ticket(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.resume_ticket_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.auth.LogonRequest.resume_ticket)
+}
+inline std::string* LogonRequest::mutable_resume_ticket() {
+  std::string* _s = _internal_mutable_resume_ticket();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.auth.LogonRequest.resume_ticket)
+  return _s;
+}
+inline const std::string& LogonRequest::_internal_resume_ticket() const {
+  return _impl_.resume_ticket_.Get();
+}
+inline void LogonRequest::_internal_set_resume_ticket(const std::string& value) {
+  
+  _impl_.resume_ticket_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LogonRequest::_internal_mutable_resume_ticket() {
+  
+  return _impl_.resume_ticket_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LogonRequest::release_resume_ticket() {
+  // @@protoc_insertion_point(field_release:aspia.proto.auth.LogonRequest.resume_ticket)
+  return _impl_.resume_ticket_.Release();
+}
+inline void LogonRequest::set_allocated_resume_ticket(std::string* resume_ticket) {
+  if (resume_ticket != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.resume_ticket_.SetAllocated(resume_ticket, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.resume_ticket_.IsDefault()) {
+    _impl_.resume_ticket_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.auth.LogonRequest.resume_ticket)
+}
+
+// .aspia.proto.auth.ServerChallenge expected_challenge = 4;
+inline bool LogonRequest::_internal_has_expected_challenge() const {
+  return this != internal_default_instance() && _impl_.expected_challenge_ != nullptr;
+}
+inline bool LogonRequest::has_expected_challenge() const {
+  return _internal_has_expected_challenge();
+}
+inline void LogonRequest::clear_expected_challenge() {
+  if (GetArenaForAllocation() == nullptr && _impl_.expected_challenge_ != nullptr) {
+    delete _impl_.expected_challenge_;
+  }
+  _impl_.expected_challenge_ = nullptr;
+}
+inline const ::aspia::proto::auth::ServerChallenge& LogonRequest::_internal_expected_challenge() const {
+  const ::aspia::proto::auth::ServerChallenge* p = _impl_.expected_challenge_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::auth::ServerChallenge&>(
+      ::aspia::proto::auth::_ServerChallenge_default_instance_);
+}
+inline const ::aspia::proto::auth::ServerChallenge& LogonRequest::expected_challenge() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.auth.LogonRequest.expected_challenge)
+  return _internal_expected_challenge();
+}
+inline void LogonRequest::unsafe_arena_set_allocated_expected_challenge(
+    ::aspia::proto::auth::ServerChallenge* expected_challenge) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.expected_challenge_);
+  }
+  _impl_.expected_challenge_ = expected_challenge;
+  if (expected_challenge) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.auth.LogonRequest.expected_challenge)
+}
+inline ::aspia::proto::auth::ServerChallenge* LogonRequest::release_expected_challenge() {
+  
+  ::aspia::proto::auth::ServerChallenge* temp = _impl_.expected_challenge_;
+  _impl_.expected_challenge_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::auth::ServerChallenge* LogonRequest::unsafe_arena_release_expected_challenge() {
+  // @@protoc_insertion_point(field_release:aspia.proto.auth.LogonRequest.expected_challenge)
+  
+  ::aspia::proto::auth::ServerChallenge* temp = _impl_.expected_challenge_;
+  _impl_.expected_challenge_ = nullptr;
+  return temp;
+}
+inline ::aspia::proto::auth::ServerChallenge* LogonRequest::_internal_mutable_expected_challenge() {
+  
+  if (_impl_.expected_challenge_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::auth::ServerChallenge>(GetArenaForAllocation());
+    _impl_.expected_challenge_ = p;
+  }
+  return _impl_.expected_challenge_;
+}
+inline ::aspia::proto::auth::ServerChallenge* LogonRequest::mutable_expected_challenge() {
+  ::aspia::proto::auth::ServerChallenge* _msg = _internal_mutable_expected_challenge();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.auth.LogonRequest.expected_challenge)
+  return _msg;
+}
+inline void LogonRequest::set_allocated_expected_challenge(::aspia::proto::auth::ServerChallenge* expected_challenge) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.expected_challenge_;
+  }
+  if (expected_challenge) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(expected_challenge);
+    if (message_arena != submessage_arena) {
+      expected_challenge = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, expected_challenge, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.expected_challenge_ = expected_challenge;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.auth.LogonRequest.expected_challenge)
+}
+
 // -------------------------------------------------------------------
 
 // ServerChallenge
 
 // bytes nonce = 1;
 inline void ServerChallenge::clear_nonce() {
-  nonce_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.nonce_.ClearToEmpty();
 }
-inline const ::std::string& ServerChallenge::nonce() const {
+inline const std::string& ServerChallenge::nonce() const {
   // @@protoc_insertion_point(field_get:aspia.proto.auth.ServerChallenge.nonce)
-  return nonce_.GetNoArena();
+  return _internal_nonce();
 }
-inline void ServerChallenge::set_nonce(const ::std::string& value) {
-  
-  nonce_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ServerChallenge::set_nonce(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.nonce_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:aspia.proto.auth.ServerChallenge.nonce)
 }
-#if LANG_CXX11
-inline void ServerChallenge::set_nonce(::std::string&& value) {
+inline std::string* ServerChallenge::mutable_nonce() {
+  std::string* _s = _internal_mutable_nonce();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.auth.ServerChallenge.nonce)
+  return _s;
+}
+inline const std::string& ServerChallenge::_internal_nonce() const {
+  return _impl_.nonce_.Get();
+}
+inline void ServerChallenge::_internal_set_nonce(const std::string& value) {
   
-  nonce_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.auth.ServerChallenge.nonce)
+  _impl_.nonce_.Set(value, GetArenaForAllocation());
 }
-#endif
-inline void ServerChallenge::set_nonce(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
+inline std::string* ServerChallenge::_internal_mutable_nonce() {
   
-  nonce_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.auth.ServerChallenge.nonce)
+  return _impl_.nonce_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ServerChallenge::release_nonce() {
+  // @@protoc_insertion_point(field_release:aspia.proto.auth.ServerChallenge.nonce)
+  return _impl_.nonce_.Release();
+}
+inline void ServerChallenge::set_allocated_nonce(std::string* nonce) {
+  if (nonce != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.nonce_.SetAllocated(nonce, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.nonce_.IsDefault()) {
+    _impl_.nonce_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.auth.ServerChallenge.nonce)
+}
+
+// .aspia.proto.auth.PasswordHashing password_hashing = 2;
+inline void ServerChallenge::clear_password_hashing() {
+  _impl_.password_hashing_ = 0;
 }
-inline void ServerChallenge::set_nonce(const void* value, size_t size) {
+inline ::aspia::proto::auth::PasswordHashing ServerChallenge::_internal_password_hashing() const {
+  return static_cast< ::aspia::proto::auth::PasswordHashing >(_impl_.password_hashing_);
+}
+inline ::aspia::proto::auth::PasswordHashing ServerChallenge::password_hashing() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.auth.ServerChallenge.password_hashing)
+  return _internal_password_hashing();
+}
+inline void ServerChallenge::_internal_set_password_hashing(::aspia::proto::auth::PasswordHashing value) {
   
-  nonce_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.auth.ServerChallenge.nonce)
+  _impl_.password_hashing_ = value;
+}
+inline void ServerChallenge::set_password_hashing(::aspia::proto::auth::PasswordHashing value) {
+  _internal_set_password_hashing(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.auth.ServerChallenge.password_hashing)
+}
+
+// bytes password_salt = 3;
+inline void ServerChallenge::clear_password_salt() {
+  _impl_.password_salt_.ClearToEmpty();
+}
+inline const std::string& ServerChallenge::password_salt() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.auth.ServerChallenge.password_salt)
+  return _internal_password_salt();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ServerChallenge::set_password_salt(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.password_salt_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.auth.ServerChallenge.password_salt)
 }
-inline ::std::string* ServerChallenge::mutable_nonce() {
+inline std::string* ServerChallenge::mutable_password_salt() {
+  std::string* _s = _internal_mutable_password_salt();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.auth.ServerChallenge.password_salt)
+  return _s;
+}
+inline const std::string& ServerChallenge::_internal_password_salt() const {
+  return _impl_.password_salt_.Get();
+}
+inline void ServerChallenge::_internal_set_password_salt(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.auth.ServerChallenge.nonce)
-  return nonce_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.password_salt_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* ServerChallenge::release_nonce() {
-  // @@protoc_insertion_point(field_release:aspia.proto.auth.ServerChallenge.nonce)
+inline std::string* ServerChallenge::_internal_mutable_password_salt() {
   
-  return nonce_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.password_salt_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ServerChallenge::release_password_salt() {
+  // @@protoc_insertion_point(field_release:aspia.proto.auth.ServerChallenge.password_salt)
+  return _impl_.password_salt_.Release();
 }
-inline void ServerChallenge::set_allocated_nonce(::std::string* nonce) {
-  if (nonce != NULL) {
+inline void ServerChallenge::set_allocated_password_salt(std::string* password_salt) {
+  if (password_salt != nullptr) {
     
   } else {
     
   }
-  nonce_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), nonce);
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.auth.ServerChallenge.nonce)
+  _impl_.password_salt_.SetAllocated(password_salt, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.password_salt_.IsDefault()) {
+    _impl_.password_salt_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.auth.ServerChallenge.password_salt)
+}
+
+// uint32 ops_limit = 4;
+inline void ServerChallenge::clear_ops_limit() {
+  _impl_.ops_limit_ = 0u;
+}
+inline uint32_t ServerChallenge::_internal_ops_limit() const {
+  return _impl_.ops_limit_;
+}
+inline uint32_t ServerChallenge::ops_limit() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.auth.ServerChallenge.ops_limit)
+  return _internal_ops_limit();
+}
+inline void ServerChallenge::_internal_set_ops_limit(uint32_t value) {
+  
+  _impl_.ops_limit_ = value;
+}
+inline void ServerChallenge::set_ops_limit(uint32_t value) {
+  _internal_set_ops_limit(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.auth.ServerChallenge.ops_limit)
+}
+
+// uint32 mem_limit = 5;
+inline void ServerChallenge::clear_mem_limit() {
+  _impl_.mem_limit_ = 0u;
+}
+inline uint32_t ServerChallenge::_internal_mem_limit() const {
+  return _impl_.mem_limit_;
+}
+inline uint32_t ServerChallenge::mem_limit() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.auth.ServerChallenge.mem_limit)
+  return _internal_mem_limit();
+}
+inline void ServerChallenge::_internal_set_mem_limit(uint32_t value) {
+  
+  _impl_.mem_limit_ = value;
+}
+inline void ServerChallenge::set_mem_limit(uint32_t value) {
+  _internal_set_mem_limit(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.auth.ServerChallenge.mem_limit)
 }
 
 // -------------------------------------------------------------------
@@ -890,121 +1566,121 @@ inline void ServerChallenge::set_allocated_nonce(::std::string* nonce) {
 
 // .aspia.proto.auth.SessionType session_type = 1;
 inline void ClientChallenge::clear_session_type() {
-  session_type_ = 0;
+  _impl_.session_type_ = 0;
+}
+inline ::aspia::proto::auth::SessionType ClientChallenge::_internal_session_type() const {
+  return static_cast< ::aspia::proto::auth::SessionType >(_impl_.session_type_);
 }
 inline ::aspia::proto::auth::SessionType ClientChallenge::session_type() const {
   // @@protoc_insertion_point(field_get:aspia.proto.auth.ClientChallenge.session_type)
-  return static_cast< ::aspia::proto::auth::SessionType >(session_type_);
+  return _internal_session_type();
 }
-inline void ClientChallenge::set_session_type(::aspia::proto::auth::SessionType value) {
+inline void ClientChallenge::_internal_set_session_type(::aspia::proto::auth::SessionType value) {
   
-  session_type_ = value;
+  _impl_.session_type_ = value;
+}
+inline void ClientChallenge::set_session_type(::aspia::proto::auth::SessionType value) {
+  _internal_set_session_type(value);
   // @@protoc_insertion_point(field_set:aspia.proto.auth.ClientChallenge.session_type)
 }
 
 // string username = 2;
 inline void ClientChallenge::clear_username() {
-  username_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.username_.ClearToEmpty();
 }
-inline const ::std::string& ClientChallenge::username() const {
+inline const std::string& ClientChallenge::username() const {
   // @@protoc_insertion_point(field_get:aspia.proto.auth.ClientChallenge.username)
-  return username_.GetNoArena();
+  return _internal_username();
 }
-inline void ClientChallenge::set_username(const ::std::string& value) {
-  
-  username_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ClientChallenge::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:aspia.proto.auth.ClientChallenge.username)
 }
-#if LANG_CXX11
-inline void ClientChallenge::set_username(::std::string&& value) {
-  
-  username_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.auth.ClientChallenge.username)
+inline std::string* ClientChallenge::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.auth.ClientChallenge.username)
+  return _s;
 }
-#endif
-inline void ClientChallenge::set_username(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  username_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.auth.ClientChallenge.username)
+inline const std::string& ClientChallenge::_internal_username() const {
+  return _impl_.username_.Get();
 }
-inline void ClientChallenge::set_username(const char* value, size_t size) {
+inline void ClientChallenge::_internal_set_username(const std::string& value) {
   
-  username_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.auth.ClientChallenge.username)
+  _impl_.username_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* ClientChallenge::mutable_username() {
+inline std::string* ClientChallenge::_internal_mutable_username() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.auth.ClientChallenge.username)
-  return username_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.username_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* ClientChallenge::release_username() {
+inline std::string* ClientChallenge::release_username() {
   // @@protoc_insertion_point(field_release:aspia.proto.auth.ClientChallenge.username)
-  
-  return username_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.username_.Release();
 }
-inline void ClientChallenge::set_allocated_username(::std::string* username) {
-  if (username != NULL) {
+inline void ClientChallenge::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
     
   } else {
     
   }
-  username_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), username);
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.auth.ClientChallenge.username)
 }
 
 // bytes session_key = 3;
 inline void ClientChallenge::clear_session_key() {
-  session_key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.session_key_.ClearToEmpty();
 }
-inline const ::std::string& ClientChallenge::session_key() const {
+inline const std::string& ClientChallenge::session_key() const {
   // @@protoc_insertion_point(field_get:aspia.proto.auth.ClientChallenge.session_key)
-  return session_key_.GetNoArena();
+  return _internal_session_key();
 }
-inline void ClientChallenge::set_session_key(const ::std::string& value) {
-  
-  session_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ClientChallenge::set_session_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.session_key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:aspia.proto.auth.ClientChallenge.session_key)
 }
-#if LANG_CXX11
-inline void ClientChallenge::set_session_key(::std::string&& value) {
-  
-  session_key_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.auth.ClientChallenge.session_key)
+inline std::string* ClientChallenge::mutable_session_key() {
+  std::string* _s = _internal_mutable_session_key();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.auth.ClientChallenge.session_key)
+  return _s;
 }
-#endif
-inline void ClientChallenge::set_session_key(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  session_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.auth.ClientChallenge.session_key)
+inline const std::string& ClientChallenge::_internal_session_key() const {
+  return _impl_.session_key_.Get();
 }
-inline void ClientChallenge::set_session_key(const void* value, size_t size) {
+inline void ClientChallenge::_internal_set_session_key(const std::string& value) {
   
-  session_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.auth.ClientChallenge.session_key)
+  _impl_.session_key_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* ClientChallenge::mutable_session_key() {
+inline std::string* ClientChallenge::_internal_mutable_session_key() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.auth.ClientChallenge.session_key)
-  return session_key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.session_key_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* ClientChallenge::release_session_key() {
+inline std::string* ClientChallenge::release_session_key() {
   // @@protoc_insertion_point(field_release:aspia.proto.auth.ClientChallenge.session_key)
-  
-  return session_key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.session_key_.Release();
 }
-inline void ClientChallenge::set_allocated_session_key(::std::string* session_key) {
-  if (session_key != NULL) {
+inline void ClientChallenge::set_allocated_session_key(std::string* session_key) {
+  if (session_key != nullptr) {
     
   } else {
     
   }
-  session_key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), session_key);
+  _impl_.session_key_.SetAllocated(session_key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.session_key_.IsDefault()) {
+    _impl_.session_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.auth.ClientChallenge.session_key)
 }
 
@@ -1014,127 +1690,305 @@ inline void ClientChallenge::set_allocated_session_key(::std::string* session_ke
 
 // .aspia.proto.auth.Status status = 1;
 inline void LogonResult::clear_status() {
-  status_ = 0;
+  _impl_.status_ = 0;
+}
+inline ::aspia::proto::auth::Status LogonResult::_internal_status() const {
+  return static_cast< ::aspia::proto::auth::Status >(_impl_.status_);
 }
 inline ::aspia::proto::auth::Status LogonResult::status() const {
   // @@protoc_insertion_point(field_get:aspia.proto.auth.LogonResult.status)
-  return static_cast< ::aspia::proto::auth::Status >(status_);
+  return _internal_status();
 }
-inline void LogonResult::set_status(::aspia::proto::auth::Status value) {
+inline void LogonResult::_internal_set_status(::aspia::proto::auth::Status value) {
   
-  status_ = value;
+  _impl_.status_ = value;
+}
+inline void LogonResult::set_status(::aspia::proto::auth::Status value) {
+  _internal_set_status(value);
   // @@protoc_insertion_point(field_set:aspia.proto.auth.LogonResult.status)
 }
 
+// bytes resume_ticket = 2;
+inline void LogonResult::clear_resume_ticket() {
+  _impl_.resume_ticket_.ClearToEmpty();
+}
+inline const std::string& LogonResult::resume_ticket() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.auth.LogonResult.resume_ticket)
+  return _internal_resume_ticket();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LogonResult::set_resume_ticket(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.resume_ticket_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.auth.LogonResult.resume_ticket)
+}
+inline std::string* LogonResult::mutable_resume_ticket() {
+  std::string* _s = _internal_mutable_resume_ticket();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.auth.LogonResult.resume_ticket)
+  return _s;
+}
+inline const std::string& LogonResult::_internal_resume_ticket() const {
+  return _impl_.resume_ticket_.Get();
+}
+inline void LogonResult::_internal_set_resume_ticket(const std::string& value) {
+  
+  _impl_.resume_ticket_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LogonResult::_internal_mutable_resume_ticket() {
+  
+  return _impl_.resume_ticket_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LogonResult::release_resume_ticket() {
+  // @@protoc_insertion_point(field_release:aspia.proto.auth.LogonResult.resume_ticket)
+  return _impl_.resume_ticket_.Release();
+}
+inline void LogonResult::set_allocated_resume_ticket(std::string* resume_ticket) {
+  if (resume_ticket != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.resume_ticket_.SetAllocated(resume_ticket, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.resume_ticket_.IsDefault()) {
+    _impl_.resume_ticket_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.auth.LogonResult.resume_ticket)
+}
+
+// bytes config_request = 3;
+inline void LogonResult::clear_config_request() {
+  _impl_.config_request_.ClearToEmpty();
+}
+inline const std::string& LogonResult::config_request() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.auth.LogonResult.config_request)
+  return _internal_config_request();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LogonResult::set_config_request(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.config_request_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.auth.LogonResult.config_request)
+}
+inline std::string* LogonResult::mutable_config_request() {
+  std::string* _s = _internal_mutable_config_request();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.auth.LogonResult.config_request)
+  return _s;
+}
+inline const std::string& LogonResult::_internal_config_request() const {
+  return _impl_.config_request_.Get();
+}
+inline void LogonResult::_internal_set_config_request(const std::string& value) {
+  
+  _impl_.config_request_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LogonResult::_internal_mutable_config_request() {
+  
+  return _impl_.config_request_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LogonResult::release_config_request() {
+  // @@protoc_insertion_point(field_release:aspia.proto.auth.LogonResult.config_request)
+  return _impl_.config_request_.Release();
+}
+inline void LogonResult::set_allocated_config_request(std::string* config_request) {
+  if (config_request != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.config_request_.SetAllocated(config_request, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.config_request_.IsDefault()) {
+    _impl_.config_request_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.auth.LogonResult.config_request)
+}
+
 // -------------------------------------------------------------------
 
 // ClientToHost
 
 // .aspia.proto.auth.LogonRequest logon_request = 1;
+inline bool ClientToHost::_internal_has_logon_request() const {
+  return this != internal_default_instance() && _impl_.logon_request_ != nullptr;
+}
 inline bool ClientToHost::has_logon_request() const {
-  return this != internal_default_instance() && logon_request_ != NULL;
+  return _internal_has_logon_request();
 }
 inline void ClientToHost::clear_logon_request() {
-  if (GetArenaNoVirtual() == NULL && logon_request_ != NULL) {
-    delete logon_request_;
+  if (GetArenaForAllocation() == nullptr && _impl_.logon_request_ != nullptr) {
+    delete _impl_.logon_request_;
   }
-  logon_request_ = NULL;
+  _impl_.logon_request_ = nullptr;
 }
 inline const ::aspia::proto::auth::LogonRequest& ClientToHost::_internal_logon_request() const {
-  return *logon_request_;
+  const ::aspia::proto::auth::LogonRequest* p = _impl_.logon_request_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::auth::LogonRequest&>(
+      ::aspia::proto::auth::_LogonRequest_default_instance_);
 }
 inline const ::aspia::proto::auth::LogonRequest& ClientToHost::logon_request() const {
-  const ::aspia::proto::auth::LogonRequest* p = logon_request_;
   // @@protoc_insertion_point(field_get:aspia.proto.auth.ClientToHost.logon_request)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::auth::LogonRequest*>(
-      &::aspia::proto::auth::_LogonRequest_default_instance_);
+  return _internal_logon_request();
+}
+inline void ClientToHost::unsafe_arena_set_allocated_logon_request(
+    ::aspia::proto::auth::LogonRequest* logon_request) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.logon_request_);
+  }
+  _impl_.logon_request_ = logon_request;
+  if (logon_request) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.auth.ClientToHost.logon_request)
 }
 inline ::aspia::proto::auth::LogonRequest* ClientToHost::release_logon_request() {
+  
+  ::aspia::proto::auth::LogonRequest* temp = _impl_.logon_request_;
+  _impl_.logon_request_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::auth::LogonRequest* ClientToHost::unsafe_arena_release_logon_request() {
   // @@protoc_insertion_point(field_release:aspia.proto.auth.ClientToHost.logon_request)
   
-  ::aspia::proto::auth::LogonRequest* temp = logon_request_;
-  logon_request_ = NULL;
+  ::aspia::proto::auth::LogonRequest* temp = _impl_.logon_request_;
+  _impl_.logon_request_ = nullptr;
   return temp;
 }
-inline ::aspia::proto::auth::LogonRequest* ClientToHost::mutable_logon_request() {
+inline ::aspia::proto::auth::LogonRequest* ClientToHost::_internal_mutable_logon_request() {
   
-  if (logon_request_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::auth::LogonRequest>(GetArenaNoVirtual());
-    logon_request_ = p;
+  if (_impl_.logon_request_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::auth::LogonRequest>(GetArenaForAllocation());
+    _impl_.logon_request_ = p;
   }
+  return _impl_.logon_request_;
+}
+inline ::aspia::proto::auth::LogonRequest* ClientToHost::mutable_logon_request() {
+  ::aspia::proto::auth::LogonRequest* _msg = _internal_mutable_logon_request();
   // @@protoc_insertion_point(field_mutable:aspia.proto.auth.ClientToHost.logon_request)
-  return logon_request_;
+  return _msg;
 }
 inline void ClientToHost::set_allocated_logon_request(::aspia::proto::auth::LogonRequest* logon_request) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete logon_request_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.logon_request_;
   }
   if (logon_request) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(logon_request);
     if (message_arena != submessage_arena) {
-      logon_request = ::google::protobuf::internal::GetOwnedMessage(
+      logon_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, logon_request, submessage_arena);
     }
     
   } else {
     
   }
-  logon_request_ = logon_request;
+  _impl_.logon_request_ = logon_request;
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.auth.ClientToHost.logon_request)
 }
 
 // .aspia.proto.auth.ClientChallenge client_challenge = 2;
+inline bool ClientToHost::_internal_has_client_challenge() const {
+  return this != internal_default_instance() && _impl_.client_challenge_ != nullptr;
+}
 inline bool ClientToHost::has_client_challenge() const {
-  return this != internal_default_instance() && client_challenge_ != NULL;
+  return _internal_has_client_challenge();
 }
 inline void ClientToHost::clear_client_challenge() {
-  if (GetArenaNoVirtual() == NULL && client_challenge_ != NULL) {
-    delete client_challenge_;
+  if (GetArenaForAllocation() == nullptr && _impl_.client_challenge_ != nullptr) {
+    delete _impl_.client_challenge_;
   }
-  client_challenge_ = NULL;
+  _impl_.client_challenge_ = nullptr;
 }
 inline const ::aspia::proto::auth::ClientChallenge& ClientToHost::_internal_client_challenge() const {
-  return *client_challenge_;
+  const ::aspia::proto::auth::ClientChallenge* p = _impl_.client_challenge_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::auth::ClientChallenge&>(
+      ::aspia::proto::auth::_ClientChallenge_default_instance_);
 }
 inline const ::aspia::proto::auth::ClientChallenge& ClientToHost::client_challenge() const {
-  const ::aspia::proto::auth::ClientChallenge* p = client_challenge_;
   // @@protoc_insertion_point(field_get:aspia.proto.auth.ClientToHost.client_challenge)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::auth::ClientChallenge*>(
-      &::aspia::proto::auth::_ClientChallenge_default_instance_);
+  return _internal_client_challenge();
+}
+inline void ClientToHost::unsafe_arena_set_allocated_client_challenge(
+    ::aspia::proto::auth::ClientChallenge* client_challenge) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.client_challenge_);
+  }
+  _impl_.client_challenge_ = client_challenge;
+  if (client_challenge) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.auth.ClientToHost.client_challenge)
 }
 inline ::aspia::proto::auth::ClientChallenge* ClientToHost::release_client_challenge() {
+  
+  ::aspia::proto::auth::ClientChallenge* temp = _impl_.client_challenge_;
+  _impl_.client_challenge_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::auth::ClientChallenge* ClientToHost::unsafe_arena_release_client_challenge() {
   // @@protoc_insertion_point(field_release:aspia.proto.auth.ClientToHost.client_challenge)
   
-  ::aspia::proto::auth::ClientChallenge* temp = client_challenge_;
-  client_challenge_ = NULL;
+  ::aspia::proto::auth::ClientChallenge* temp = _impl_.client_challenge_;
+  _impl_.client_challenge_ = nullptr;
   return temp;
 }
-inline ::aspia::proto::auth::ClientChallenge* ClientToHost::mutable_client_challenge() {
+inline ::aspia::proto::auth::ClientChallenge* ClientToHost::_internal_mutable_client_challenge() {
   
-  if (client_challenge_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::auth::ClientChallenge>(GetArenaNoVirtual());
-    client_challenge_ = p;
+  if (_impl_.client_challenge_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::auth::ClientChallenge>(GetArenaForAllocation());
+    _impl_.client_challenge_ = p;
   }
+  return _impl_.client_challenge_;
+}
+inline ::aspia::proto::auth::ClientChallenge* ClientToHost::mutable_client_challenge() {
+  ::aspia::proto::auth::ClientChallenge* _msg = _internal_mutable_client_challenge();
   // @@protoc_insertion_point(field_mutable:aspia.proto.auth.ClientToHost.client_challenge)
-  return client_challenge_;
+  return _msg;
 }
 inline void ClientToHost::set_allocated_client_challenge(::aspia::proto::auth::ClientChallenge* client_challenge) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete client_challenge_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.client_challenge_;
   }
   if (client_challenge) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(client_challenge);
     if (message_arena != submessage_arena) {
-      client_challenge = ::google::protobuf::internal::GetOwnedMessage(
+      client_challenge = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, client_challenge, submessage_arena);
     }
     
   } else {
     
   }
-  client_challenge_ = client_challenge;
+  _impl_.client_challenge_ = client_challenge;
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.auth.ClientToHost.client_challenge)
 }
 
@@ -1143,110 +1997,182 @@ inline void ClientToHost::set_allocated_client_challenge(::aspia::proto::auth::C
 // HostToClient
 
 // .aspia.proto.auth.ServerChallenge server_challenge = 1;
+inline bool HostToClient::_internal_has_server_challenge() const {
+  return this != internal_default_instance() && _impl_.server_challenge_ != nullptr;
+}
 inline bool HostToClient::has_server_challenge() const {
-  return this != internal_default_instance() && server_challenge_ != NULL;
+  return _internal_has_server_challenge();
 }
 inline void HostToClient::clear_server_challenge() {
-  if (GetArenaNoVirtual() == NULL && server_challenge_ != NULL) {
-    delete server_challenge_;
+  if (GetArenaForAllocation() == nullptr && _impl_.server_challenge_ != nullptr) {
+    delete _impl_.server_challenge_;
   }
-  server_challenge_ = NULL;
+  _impl_.server_challenge_ = nullptr;
 }
 inline const ::aspia::proto::auth::ServerChallenge& HostToClient::_internal_server_challenge() const {
-  return *server_challenge_;
+  const ::aspia::proto::auth::ServerChallenge* p = _impl_.server_challenge_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::auth::ServerChallenge&>(
+      ::aspia::proto::auth::_ServerChallenge_default_instance_);
 }
 inline const ::aspia::proto::auth::ServerChallenge& HostToClient::server_challenge() const {
-  const ::aspia::proto::auth::ServerChallenge* p = server_challenge_;
   // @@protoc_insertion_point(field_get:aspia.proto.auth.HostToClient.server_challenge)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::auth::ServerChallenge*>(
-      &::aspia::proto::auth::_ServerChallenge_default_instance_);
+  return _internal_server_challenge();
+}
+inline void HostToClient::unsafe_arena_set_allocated_server_challenge(
+    ::aspia::proto::auth::ServerChallenge* server_challenge) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.server_challenge_);
+  }
+  _impl_.server_challenge_ = server_challenge;
+  if (server_challenge) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.auth.HostToClient.server_challenge)
 }
 inline ::aspia::proto::auth::ServerChallenge* HostToClient::release_server_challenge() {
+  
+  ::aspia::proto::auth::ServerChallenge* temp = _impl_.server_challenge_;
+  _impl_.server_challenge_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::auth::ServerChallenge* HostToClient::unsafe_arena_release_server_challenge() {
   // @@protoc_insertion_point(field_release:aspia.proto.auth.HostToClient.server_challenge)
   
-  ::aspia::proto::auth::ServerChallenge* temp = server_challenge_;
-  server_challenge_ = NULL;
+  ::aspia::proto::auth::ServerChallenge* temp = _impl_.server_challenge_;
+  _impl_.server_challenge_ = nullptr;
   return temp;
 }
-inline ::aspia::proto::auth::ServerChallenge* HostToClient::mutable_server_challenge() {
+inline ::aspia::proto::auth::ServerChallenge* HostToClient::_internal_mutable_server_challenge() {
   
-  if (server_challenge_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::auth::ServerChallenge>(GetArenaNoVirtual());
-    server_challenge_ = p;
+  if (_impl_.server_challenge_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::auth::ServerChallenge>(GetArenaForAllocation());
+    _impl_.server_challenge_ = p;
   }
+  return _impl_.server_challenge_;
+}
+inline ::aspia::proto::auth::ServerChallenge* HostToClient::mutable_server_challenge() {
+  ::aspia::proto::auth::ServerChallenge* _msg = _internal_mutable_server_challenge();
   // @@protoc_insertion_point(field_mutable:aspia.proto.auth.HostToClient.server_challenge)
-  return server_challenge_;
+  return _msg;
 }
 inline void HostToClient::set_allocated_server_challenge(::aspia::proto::auth::ServerChallenge* server_challenge) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete server_challenge_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.server_challenge_;
   }
   if (server_challenge) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(server_challenge);
     if (message_arena != submessage_arena) {
-      server_challenge = ::google::protobuf::internal::GetOwnedMessage(
+      server_challenge = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, server_challenge, submessage_arena);
     }
     
   } else {
     
   }
-  server_challenge_ = server_challenge;
+  _impl_.server_challenge_ = server_challenge;
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.auth.HostToClient.server_challenge)
 }
 
 // .aspia.proto.auth.LogonResult logon_result = 2;
+inline bool HostToClient::_internal_has_logon_result() const {
+  return this != internal_default_instance() && _impl_.logon_result_ != nullptr;
+}
 inline bool HostToClient::has_logon_result() const {
-  return this != internal_default_instance() && logon_result_ != NULL;
+  return _internal_has_logon_result();
 }
 inline void HostToClient::clear_logon_result() {
-  if (GetArenaNoVirtual() == NULL && logon_result_ != NULL) {
-    delete logon_result_;
+  if (GetArenaForAllocation() == nullptr && _impl_.logon_result_ != nullptr) {
+    delete _impl_.logon_result_;
   }
-  logon_result_ = NULL;
+  _impl_.logon_result_ = nullptr;
 }
 inline const ::aspia::proto::auth::LogonResult& HostToClient::_internal_logon_result() const {
-  return *logon_result_;
+  const ::aspia::proto::auth::LogonResult* p = _impl_.logon_result_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::auth::LogonResult&>(
+      ::aspia::proto::auth::_LogonResult_default_instance_);
 }
 inline const ::aspia::proto::auth::LogonResult& HostToClient::logon_result() const {
-  const ::aspia::proto::auth::LogonResult* p = logon_result_;
   // @@protoc_insertion_point(field_get:aspia.proto.auth.HostToClient.logon_result)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::auth::LogonResult*>(
-      &::aspia::proto::auth::_LogonResult_default_instance_);
+  return _internal_logon_result();
+}
+inline void HostToClient::unsafe_arena_set_allocated_logon_result(
+    ::aspia::proto::auth::LogonResult* logon_result) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.logon_result_);
+  }
+  _impl_.logon_result_ = logon_result;
+  if (logon_result) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.auth.HostToClient.logon_result)
 }
 inline ::aspia::proto::auth::LogonResult* HostToClient::release_logon_result() {
+  
+  ::aspia::proto::auth::LogonResult* temp = _impl_.logon_result_;
+  _impl_.logon_result_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::auth::LogonResult* HostToClient::unsafe_arena_release_logon_result() {
   // @@protoc_insertion_point(field_release:aspia.proto.auth.HostToClient.logon_result)
   
-  ::aspia::proto::auth::LogonResult* temp = logon_result_;
-  logon_result_ = NULL;
+  ::aspia::proto::auth::LogonResult* temp = _impl_.logon_result_;
+  _impl_.logon_result_ = nullptr;
   return temp;
 }
-inline ::aspia::proto::auth::LogonResult* HostToClient::mutable_logon_result() {
+inline ::aspia::proto::auth::LogonResult* HostToClient::_internal_mutable_logon_result() {
   
-  if (logon_result_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::auth::LogonResult>(GetArenaNoVirtual());
-    logon_result_ = p;
+  if (_impl_.logon_result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::auth::LogonResult>(GetArenaForAllocation());
+    _impl_.logon_result_ = p;
   }
+  return _impl_.logon_result_;
+}
+inline ::aspia::proto::auth::LogonResult* HostToClient::mutable_logon_result() {
+  ::aspia::proto::auth::LogonResult* _msg = _internal_mutable_logon_result();
   // @@protoc_insertion_point(field_mutable:aspia.proto.auth.HostToClient.logon_result)
-  return logon_result_;
+  return _msg;
 }
 inline void HostToClient::set_allocated_logon_result(::aspia::proto::auth::LogonResult* logon_result) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete logon_result_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.logon_result_;
   }
   if (logon_result) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(logon_result);
     if (message_arena != submessage_arena) {
-      logon_result = ::google::protobuf::internal::GetOwnedMessage(
+      logon_result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, logon_result, submessage_arena);
     }
     
   } else {
     
   }
-  logon_result_ = logon_result;
+  _impl_.logon_result_ = logon_result;
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.auth.HostToClient.logon_result)
 }
 
@@ -1270,16 +2196,16 @@ inline void HostToClient::set_allocated_logon_result(::aspia::proto::auth::Logon
 }  // namespace proto
 }  // namespace aspia
 
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 
 template <> struct is_proto_enum< ::aspia::proto::auth::Method> : ::std::true_type {};
 template <> struct is_proto_enum< ::aspia::proto::auth::SessionType> : ::std::true_type {};
+template <> struct is_proto_enum< ::aspia::proto::auth::PasswordHashing> : ::std::true_type {};
 template <> struct is_proto_enum< ::aspia::proto::auth::Status> : ::std::true_type {};
 
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_INCLUDED_authorization_2eproto
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_authorization_2eproto
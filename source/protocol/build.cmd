@@ -1,3 +1,9 @@
+for /f "tokens=2" %%v in ('protoc --version') do set PROTOC_VERSION=%%v
+if not "%PROTOC_VERSION%" == "3.21.12" (
+	echo protoc 3.21.12 is required to match the protobuf of the third-party directory
+	exit /b 1
+)
+
 for %%f in (*.proto) do (
 	protoc %%f --cpp_out=.
 )
\ No newline at end of file
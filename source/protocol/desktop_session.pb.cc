@@ -5,314 +5,452 @@
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/port.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/io/zero_copy_stream_impl_lite.h>
-// This is a temporary google only hack
-#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-#include "third_party/protobuf/version.h"
-#endif
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-namespace protobuf_desktop_5fsession_2eproto {
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_desktop_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_ClipboardEvent;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_desktop_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_ConfigRequest;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_desktop_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_CursorShape;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_desktop_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_KeyEvent;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_desktop_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_PixelFormat;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_desktop_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_PointerEvent;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_desktop_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_Rect;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_desktop_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_Size;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_desktop_5fsession_2eproto ::google::protobuf::internal::SCCInfo<1> scc_info_Config;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_desktop_5fsession_2eproto ::google::protobuf::internal::SCCInfo<2> scc_info_VideoPacket;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_desktop_5fsession_2eproto ::google::protobuf::internal::SCCInfo<2> scc_info_VideoPacketFormat;
-}  // namespace protobuf_desktop_5fsession_2eproto
 namespace aspia {
 namespace proto {
 namespace desktop {
-class KeyEventDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<KeyEvent>
-      _instance;
-} _KeyEvent_default_instance_;
-class PointerEventDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<PointerEvent>
-      _instance;
-} _PointerEvent_default_instance_;
-class ClipboardEventDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<ClipboardEvent>
-      _instance;
-} _ClipboardEvent_default_instance_;
-class CursorShapeDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<CursorShape>
-      _instance;
-} _CursorShape_default_instance_;
-class RectDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<Rect>
-      _instance;
-} _Rect_default_instance_;
-class PixelFormatDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<PixelFormat>
-      _instance;
-} _PixelFormat_default_instance_;
-class SizeDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<Size>
-      _instance;
-} _Size_default_instance_;
-class VideoPacketFormatDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<VideoPacketFormat>
-      _instance;
-} _VideoPacketFormat_default_instance_;
-class VideoPacketDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<VideoPacket>
-      _instance;
-} _VideoPacket_default_instance_;
-class ConfigRequestDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<ConfigRequest>
-      _instance;
-} _ConfigRequest_default_instance_;
-class ConfigDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<Config>
-      _instance;
-} _Config_default_instance_;
-class HostToClientDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<HostToClient>
-      _instance;
-} _HostToClient_default_instance_;
-class ClientToHostDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<ClientToHost>
-      _instance;
-} _ClientToHost_default_instance_;
+PROTOBUF_CONSTEXPR KeyEvent::KeyEvent(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.usb_keycode_)*/0u
+  , /*decltype(_impl_.flags_)*/0u
+  , /*decltype(_impl_.probe_time_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct KeyEventDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR KeyEventDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~KeyEventDefaultTypeInternal() {}
+  union {
+    KeyEvent _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 KeyEventDefaultTypeInternal _KeyEvent_default_instance_;
+PROTOBUF_CONSTEXPR PointerEvent::PointerEvent(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.mask_)*/0u
+  , /*decltype(_impl_.x_)*/0
+  , /*decltype(_impl_.probe_time_)*/int64_t{0}
+  , /*decltype(_impl_.y_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PointerEventDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PointerEventDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PointerEventDefaultTypeInternal() {}
+  union {
+    PointerEvent _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PointerEventDefaultTypeInternal _PointerEvent_default_instance_;
+PROTOBUF_CONSTEXPR ClipboardEvent::ClipboardEvent(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.mime_type_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.hash_)*/uint64_t{0u}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.size_)*/0u
+  , /*decltype(_impl_.offset_)*/0u
+  , /*decltype(_impl_.compression_)*/0
+  , /*decltype(_impl_.uncompressed_size_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ClipboardEventDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ClipboardEventDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ClipboardEventDefaultTypeInternal() {}
+  union {
+    ClipboardEvent _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ClipboardEventDefaultTypeInternal _ClipboardEvent_default_instance_;
+PROTOBUF_CONSTEXPR CursorShape::CursorShape(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.flags_)*/0u
+  , /*decltype(_impl_.width_)*/0
+  , /*decltype(_impl_.height_)*/0
+  , /*decltype(_impl_.hotspot_x_)*/0
+  , /*decltype(_impl_.hotspot_y_)*/0
+  , /*decltype(_impl_.compression_)*/0
+  , /*decltype(_impl_.cache_index_)*/0u
+  , /*decltype(_impl_.cache_size_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CursorShapeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CursorShapeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CursorShapeDefaultTypeInternal() {}
+  union {
+    CursorShape _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CursorShapeDefaultTypeInternal _CursorShape_default_instance_;
+PROTOBUF_CONSTEXPR CursorPosition::CursorPosition(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.x_)*/0
+  , /*decltype(_impl_.y_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CursorPositionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CursorPositionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CursorPositionDefaultTypeInternal() {}
+  union {
+    CursorPosition _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CursorPositionDefaultTypeInternal _CursorPosition_default_instance_;
+PROTOBUF_CONSTEXPR Rect::Rect(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.x_)*/0
+  , /*decltype(_impl_.y_)*/0
+  , /*decltype(_impl_.width_)*/0
+  , /*decltype(_impl_.height_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RectDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RectDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RectDefaultTypeInternal() {}
+  union {
+    Rect _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RectDefaultTypeInternal _Rect_default_instance_;
+PROTOBUF_CONSTEXPR PixelFormat::PixelFormat(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.bits_per_pixel_)*/0u
+  , /*decltype(_impl_.red_max_)*/0u
+  , /*decltype(_impl_.green_max_)*/0u
+  , /*decltype(_impl_.blue_max_)*/0u
+  , /*decltype(_impl_.red_shift_)*/0u
+  , /*decltype(_impl_.green_shift_)*/0u
+  , /*decltype(_impl_.blue_shift_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PixelFormatDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PixelFormatDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PixelFormatDefaultTypeInternal() {}
+  union {
+    PixelFormat _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PixelFormatDefaultTypeInternal _PixelFormat_default_instance_;
+PROTOBUF_CONSTEXPR Size::Size(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.width_)*/0
+  , /*decltype(_impl_.height_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SizeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SizeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SizeDefaultTypeInternal() {}
+  union {
+    Size _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SizeDefaultTypeInternal _Size_default_instance_;
+PROTOBUF_CONSTEXPR VideoPacketFormat::VideoPacketFormat(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.screen_size_)*/nullptr
+  , /*decltype(_impl_.pixel_format_)*/nullptr
+  , /*decltype(_impl_.tile_cache_size_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct VideoPacketFormatDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR VideoPacketFormatDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~VideoPacketFormatDefaultTypeInternal() {}
+  union {
+    VideoPacketFormat _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 VideoPacketFormatDefaultTypeInternal _VideoPacketFormat_default_instance_;
+PROTOBUF_CONSTEXPR CopyRect::CopyRect(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.target_rect_)*/nullptr
+  , /*decltype(_impl_.source_x_)*/0
+  , /*decltype(_impl_.source_y_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CopyRectDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CopyRectDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CopyRectDefaultTypeInternal() {}
+  union {
+    CopyRect _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CopyRectDefaultTypeInternal _CopyRect_default_instance_;
+PROTOBUF_CONSTEXPR VideoPacket::VideoPacket(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.dirty_rect_)*/{}
+  , /*decltype(_impl_.copy_rect_)*/{}
+  , /*decltype(_impl_.chunk_)*/{}
+  , /*decltype(_impl_.layer_)*/{}
+  , /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.packed_dirty_rect_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.format_)*/nullptr
+  , /*decltype(_impl_.encoding_)*/0
+  , /*decltype(_impl_.frame_id_)*/0u
+  , /*decltype(_impl_.persistent_stream_)*/false
+  , /*decltype(_impl_.temporal_layer_)*/0u
+  , /*decltype(_impl_.capture_time_)*/int64_t{0}
+  , /*decltype(_impl_.trace_id_)*/0u
+  , /*decltype(_impl_.encode_time_)*/0u
+  , /*decltype(_impl_.psnr_)*/0
+  , /*decltype(_impl_.ssim_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct VideoPacketDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR VideoPacketDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~VideoPacketDefaultTypeInternal() {}
+  union {
+    VideoPacket _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 VideoPacketDefaultTypeInternal _VideoPacket_default_instance_;
+PROTOBUF_CONSTEXPR ConfigRequest::ConfigRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.video_encodings_)*/0u
+  , /*decltype(_impl_.features_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ConfigRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ConfigRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ConfigRequestDefaultTypeInternal() {}
+  union {
+    ConfigRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ConfigRequestDefaultTypeInternal _ConfigRequest_default_instance_;
+PROTOBUF_CONSTEXPR FrameHashes::FrameHashes(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.hash_)*/{}
+  , /*decltype(_impl_.screen_size_)*/nullptr
+  , /*decltype(_impl_.tile_size_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct FrameHashesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FrameHashesDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FrameHashesDefaultTypeInternal() {}
+  union {
+    FrameHashes _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FrameHashesDefaultTypeInternal _FrameHashes_default_instance_;
+PROTOBUF_CONSTEXPR Config::Config(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.cursor_cache_)*/{}
+  , /*decltype(_impl_.pixel_format_)*/nullptr
+  , /*decltype(_impl_.viewport_)*/nullptr
+  , /*decltype(_impl_.frame_hashes_)*/nullptr
+  , /*decltype(_impl_.features_)*/0u
+  , /*decltype(_impl_.video_encoding_)*/0
+  , /*decltype(_impl_.update_interval_)*/0u
+  , /*decltype(_impl_.compress_ratio_)*/0u
+  , /*decltype(_impl_.encoder_threads_)*/0u
+  , /*decltype(_impl_.encoder_tile_columns_)*/0u
+  , /*decltype(_impl_.cursor_cache_next_)*/0u
+  , /*decltype(_impl_.tile_cache_size_)*/0u
+  , /*decltype(_impl_.bandwidth_limit_)*/0u
+  , /*decltype(_impl_.auto_encoding_)*/false
+  , /*decltype(_impl_.initial_bandwidth_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ConfigDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ConfigDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ConfigDefaultTypeInternal() {}
+  union {
+    Config _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ConfigDefaultTypeInternal _Config_default_instance_;
+PROTOBUF_CONSTEXPR Screen::Screen(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.title_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/int64_t{0}
+  , /*decltype(_impl_.window_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ScreenDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ScreenDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ScreenDefaultTypeInternal() {}
+  union {
+    Screen _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ScreenDefaultTypeInternal _Screen_default_instance_;
+PROTOBUF_CONSTEXPR ScreenList::ScreenList(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.screen_)*/{}
+  , /*decltype(_impl_.current_screen_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ScreenListDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ScreenListDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ScreenListDefaultTypeInternal() {}
+  union {
+    ScreenList _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ScreenListDefaultTypeInternal _ScreenList_default_instance_;
+PROTOBUF_CONSTEXPR HostToClient::HostToClient(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.video_packet_)*/nullptr
+  , /*decltype(_impl_.cursor_shape_)*/nullptr
+  , /*decltype(_impl_.clipboard_event_)*/nullptr
+  , /*decltype(_impl_.config_request_)*/nullptr
+  , /*decltype(_impl_.screen_list_)*/nullptr
+  , /*decltype(_impl_.cursor_position_)*/nullptr
+  , /*decltype(_impl_.ping_)*/nullptr
+  , /*decltype(_impl_.latency_probe_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct HostToClientDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HostToClientDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HostToClientDefaultTypeInternal() {}
+  union {
+    HostToClient _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HostToClientDefaultTypeInternal _HostToClient_default_instance_;
+PROTOBUF_CONSTEXPR VideoAck::VideoAck(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.frame_id_)*/0u
+  , /*decltype(_impl_.decode_time_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct VideoAckDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR VideoAckDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~VideoAckDefaultTypeInternal() {}
+  union {
+    VideoAck _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 VideoAckDefaultTypeInternal _VideoAck_default_instance_;
+PROTOBUF_CONSTEXPR LatencyProbe::LatencyProbe(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.time_)*/int64_t{0}
+  , /*decltype(_impl_.host_delay_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LatencyProbeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LatencyProbeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LatencyProbeDefaultTypeInternal() {}
+  union {
+    LatencyProbe _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LatencyProbeDefaultTypeInternal _LatencyProbe_default_instance_;
+PROTOBUF_CONSTEXPR Ping::Ping(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.time_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PingDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PingDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PingDefaultTypeInternal() {}
+  union {
+    Ping _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PingDefaultTypeInternal _Ping_default_instance_;
+PROTOBUF_CONSTEXPR Visibility::Visibility(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.hidden_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct VisibilityDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR VisibilityDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~VisibilityDefaultTypeInternal() {}
+  union {
+    Visibility _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 VisibilityDefaultTypeInternal _Visibility_default_instance_;
+PROTOBUF_CONSTEXPR VisibleArea::VisibleArea(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rect_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct VisibleAreaDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR VisibleAreaDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~VisibleAreaDefaultTypeInternal() {}
+  union {
+    VisibleArea _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 VisibleAreaDefaultTypeInternal _VisibleArea_default_instance_;
+PROTOBUF_CONSTEXPR RefreshRequest::RefreshRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.frames_lost_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RefreshRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RefreshRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RefreshRequestDefaultTypeInternal() {}
+  union {
+    RefreshRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RefreshRequestDefaultTypeInternal _RefreshRequest_default_instance_;
+PROTOBUF_CONSTEXPR InputEvent::InputEvent(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.pointer_event_)*/nullptr
+  , /*decltype(_impl_.key_event_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct InputEventDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR InputEventDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~InputEventDefaultTypeInternal() {}
+  union {
+    InputEvent _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InputEventDefaultTypeInternal _InputEvent_default_instance_;
+PROTOBUF_CONSTEXPR InputEvents::InputEvents(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.event_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct InputEventsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR InputEventsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~InputEventsDefaultTypeInternal() {}
+  union {
+    InputEvents _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InputEventsDefaultTypeInternal _InputEvents_default_instance_;
+PROTOBUF_CONSTEXPR ClientToHost::ClientToHost(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.pointer_event_)*/nullptr
+  , /*decltype(_impl_.key_event_)*/nullptr
+  , /*decltype(_impl_.clipboard_event_)*/nullptr
+  , /*decltype(_impl_.config_)*/nullptr
+  , /*decltype(_impl_.video_ack_)*/nullptr
+  , /*decltype(_impl_.screen_)*/nullptr
+  , /*decltype(_impl_.refresh_request_)*/nullptr
+  , /*decltype(_impl_.input_events_)*/nullptr
+  , /*decltype(_impl_.ping_)*/nullptr
+  , /*decltype(_impl_.visibility_)*/nullptr
+  , /*decltype(_impl_.visible_area_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ClientToHostDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ClientToHostDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ClientToHostDefaultTypeInternal() {}
+  union {
+    ClientToHost _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ClientToHostDefaultTypeInternal _ClientToHost_default_instance_;
 }  // namespace desktop
 }  // namespace proto
 }  // namespace aspia
-namespace protobuf_desktop_5fsession_2eproto {
-static void InitDefaultsKeyEvent() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::desktop::_KeyEvent_default_instance_;
-    new (ptr) ::aspia::proto::desktop::KeyEvent();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::desktop::KeyEvent::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_KeyEvent =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsKeyEvent}, {}};
-
-static void InitDefaultsPointerEvent() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::desktop::_PointerEvent_default_instance_;
-    new (ptr) ::aspia::proto::desktop::PointerEvent();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::desktop::PointerEvent::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_PointerEvent =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsPointerEvent}, {}};
-
-static void InitDefaultsClipboardEvent() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::desktop::_ClipboardEvent_default_instance_;
-    new (ptr) ::aspia::proto::desktop::ClipboardEvent();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::desktop::ClipboardEvent::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_ClipboardEvent =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsClipboardEvent}, {}};
-
-static void InitDefaultsCursorShape() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::desktop::_CursorShape_default_instance_;
-    new (ptr) ::aspia::proto::desktop::CursorShape();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::desktop::CursorShape::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_CursorShape =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsCursorShape}, {}};
-
-static void InitDefaultsRect() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::desktop::_Rect_default_instance_;
-    new (ptr) ::aspia::proto::desktop::Rect();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::desktop::Rect::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_Rect =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsRect}, {}};
-
-static void InitDefaultsPixelFormat() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::desktop::_PixelFormat_default_instance_;
-    new (ptr) ::aspia::proto::desktop::PixelFormat();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::desktop::PixelFormat::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_PixelFormat =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsPixelFormat}, {}};
-
-static void InitDefaultsSize() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::desktop::_Size_default_instance_;
-    new (ptr) ::aspia::proto::desktop::Size();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::desktop::Size::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_Size =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsSize}, {}};
-
-static void InitDefaultsVideoPacketFormat() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::desktop::_VideoPacketFormat_default_instance_;
-    new (ptr) ::aspia::proto::desktop::VideoPacketFormat();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::desktop::VideoPacketFormat::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<2> scc_info_VideoPacketFormat =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 2, InitDefaultsVideoPacketFormat}, {
-      &protobuf_desktop_5fsession_2eproto::scc_info_Size.base,
-      &protobuf_desktop_5fsession_2eproto::scc_info_PixelFormat.base,}};
-
-static void InitDefaultsVideoPacket() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::desktop::_VideoPacket_default_instance_;
-    new (ptr) ::aspia::proto::desktop::VideoPacket();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::desktop::VideoPacket::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<2> scc_info_VideoPacket =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 2, InitDefaultsVideoPacket}, {
-      &protobuf_desktop_5fsession_2eproto::scc_info_VideoPacketFormat.base,
-      &protobuf_desktop_5fsession_2eproto::scc_info_Rect.base,}};
-
-static void InitDefaultsConfigRequest() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::desktop::_ConfigRequest_default_instance_;
-    new (ptr) ::aspia::proto::desktop::ConfigRequest();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::desktop::ConfigRequest::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_ConfigRequest =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsConfigRequest}, {}};
-
-static void InitDefaultsConfig() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::desktop::_Config_default_instance_;
-    new (ptr) ::aspia::proto::desktop::Config();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::desktop::Config::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<1> scc_info_Config =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsConfig}, {
-      &protobuf_desktop_5fsession_2eproto::scc_info_PixelFormat.base,}};
-
-static void InitDefaultsHostToClient() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::desktop::_HostToClient_default_instance_;
-    new (ptr) ::aspia::proto::desktop::HostToClient();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::desktop::HostToClient::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<4> scc_info_HostToClient =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 4, InitDefaultsHostToClient}, {
-      &protobuf_desktop_5fsession_2eproto::scc_info_VideoPacket.base,
-      &protobuf_desktop_5fsession_2eproto::scc_info_CursorShape.base,
-      &protobuf_desktop_5fsession_2eproto::scc_info_ClipboardEvent.base,
-      &protobuf_desktop_5fsession_2eproto::scc_info_ConfigRequest.base,}};
-
-static void InitDefaultsClientToHost() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::desktop::_ClientToHost_default_instance_;
-    new (ptr) ::aspia::proto::desktop::ClientToHost();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::desktop::ClientToHost::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<4> scc_info_ClientToHost =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 4, InitDefaultsClientToHost}, {
-      &protobuf_desktop_5fsession_2eproto::scc_info_PointerEvent.base,
-      &protobuf_desktop_5fsession_2eproto::scc_info_KeyEvent.base,
-      &protobuf_desktop_5fsession_2eproto::scc_info_ClipboardEvent.base,
-      &protobuf_desktop_5fsession_2eproto::scc_info_Config.base,}};
-
-void InitDefaults() {
-  ::google::protobuf::internal::InitSCC(&scc_info_KeyEvent.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_PointerEvent.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_ClipboardEvent.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_CursorShape.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_Rect.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_PixelFormat.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_Size.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_VideoPacketFormat.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_VideoPacket.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_ConfigRequest.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_Config.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_HostToClient.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_ClientToHost.base);
-}
-
-}  // namespace protobuf_desktop_5fsession_2eproto
 namespace aspia {
 namespace proto {
 namespace desktop {
@@ -328,15 +466,62 @@ bool KeyEvent_Flags_IsValid(int value) {
   }
 }
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const KeyEvent_Flags KeyEvent::UNKNOWN;
-const KeyEvent_Flags KeyEvent::CAPSLOCK;
-const KeyEvent_Flags KeyEvent::NUMLOCK;
-const KeyEvent_Flags KeyEvent::PRESSED;
-const KeyEvent_Flags KeyEvent::Flags_MIN;
-const KeyEvent_Flags KeyEvent::Flags_MAX;
-const int KeyEvent::Flags_ARRAYSIZE;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+static ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> KeyEvent_Flags_strings[4] = {};
+
+static const char KeyEvent_Flags_names[] =
+  "CAPSLOCK"
+  "NUMLOCK"
+  "PRESSED"
+  "UNKNOWN";
+
+static const ::PROTOBUF_NAMESPACE_ID::internal::EnumEntry KeyEvent_Flags_entries[] = {
+  { {KeyEvent_Flags_names + 0, 8}, 1 },
+  { {KeyEvent_Flags_names + 8, 7}, 2 },
+  { {KeyEvent_Flags_names + 15, 7}, 4 },
+  { {KeyEvent_Flags_names + 22, 7}, 0 },
+};
+
+static const int KeyEvent_Flags_entries_by_number[] = {
+  3, // 0 -> UNKNOWN
+  0, // 1 -> CAPSLOCK
+  1, // 2 -> NUMLOCK
+  2, // 4 -> PRESSED
+};
+
+const std::string& KeyEvent_Flags_Name(
+    KeyEvent_Flags value) {
+  static const bool dummy =
+      ::PROTOBUF_NAMESPACE_ID::internal::InitializeEnumStrings(
+          KeyEvent_Flags_entries,
+          KeyEvent_Flags_entries_by_number,
+          4, KeyEvent_Flags_strings);
+  (void) dummy;
+  int idx = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumName(
+      KeyEvent_Flags_entries,
+      KeyEvent_Flags_entries_by_number,
+      4, value);
+  return idx == -1 ? ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString() :
+                     KeyEvent_Flags_strings[idx].get();
+}
+bool KeyEvent_Flags_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, KeyEvent_Flags* value) {
+  int int_value;
+  bool success = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumValue(
+      KeyEvent_Flags_entries, 4, name, &int_value);
+  if (success) {
+    *value = static_cast<KeyEvent_Flags>(int_value);
+  }
+  return success;
+}
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr KeyEvent_Flags KeyEvent::UNKNOWN;
+constexpr KeyEvent_Flags KeyEvent::CAPSLOCK;
+constexpr KeyEvent_Flags KeyEvent::NUMLOCK;
+constexpr KeyEvent_Flags KeyEvent::PRESSED;
+constexpr KeyEvent_Flags KeyEvent::Flags_MIN;
+constexpr KeyEvent_Flags KeyEvent::Flags_MAX;
+constexpr int KeyEvent::Flags_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 bool PointerEvent_ButtonMask_IsValid(int value) {
   switch (value) {
     case 0:
@@ -351,17 +536,133 @@ bool PointerEvent_ButtonMask_IsValid(int value) {
   }
 }
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const PointerEvent_ButtonMask PointerEvent::EMPTY;
-const PointerEvent_ButtonMask PointerEvent::LEFT_BUTTON;
-const PointerEvent_ButtonMask PointerEvent::MIDDLE_BUTTON;
-const PointerEvent_ButtonMask PointerEvent::RIGHT_BUTTON;
-const PointerEvent_ButtonMask PointerEvent::WHEEL_UP;
-const PointerEvent_ButtonMask PointerEvent::WHEEL_DOWN;
-const PointerEvent_ButtonMask PointerEvent::ButtonMask_MIN;
-const PointerEvent_ButtonMask PointerEvent::ButtonMask_MAX;
-const int PointerEvent::ButtonMask_ARRAYSIZE;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+static ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> PointerEvent_ButtonMask_strings[6] = {};
+
+static const char PointerEvent_ButtonMask_names[] =
+  "EMPTY"
+  "LEFT_BUTTON"
+  "MIDDLE_BUTTON"
+  "RIGHT_BUTTON"
+  "WHEEL_DOWN"
+  "WHEEL_UP";
+
+static const ::PROTOBUF_NAMESPACE_ID::internal::EnumEntry PointerEvent_ButtonMask_entries[] = {
+  { {PointerEvent_ButtonMask_names + 0, 5}, 0 },
+  { {PointerEvent_ButtonMask_names + 5, 11}, 1 },
+  { {PointerEvent_ButtonMask_names + 16, 13}, 2 },
+  { {PointerEvent_ButtonMask_names + 29, 12}, 4 },
+  { {PointerEvent_ButtonMask_names + 41, 10}, 16 },
+  { {PointerEvent_ButtonMask_names + 51, 8}, 8 },
+};
+
+static const int PointerEvent_ButtonMask_entries_by_number[] = {
+  0, // 0 -> EMPTY
+  1, // 1 -> LEFT_BUTTON
+  2, // 2 -> MIDDLE_BUTTON
+  3, // 4 -> RIGHT_BUTTON
+  5, // 8 -> WHEEL_UP
+  4, // 16 -> WHEEL_DOWN
+};
+
+const std::string& PointerEvent_ButtonMask_Name(
+    PointerEvent_ButtonMask value) {
+  static const bool dummy =
+      ::PROTOBUF_NAMESPACE_ID::internal::InitializeEnumStrings(
+          PointerEvent_ButtonMask_entries,
+          PointerEvent_ButtonMask_entries_by_number,
+          6, PointerEvent_ButtonMask_strings);
+  (void) dummy;
+  int idx = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumName(
+      PointerEvent_ButtonMask_entries,
+      PointerEvent_ButtonMask_entries_by_number,
+      6, value);
+  return idx == -1 ? ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString() :
+                     PointerEvent_ButtonMask_strings[idx].get();
+}
+bool PointerEvent_ButtonMask_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, PointerEvent_ButtonMask* value) {
+  int int_value;
+  bool success = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumValue(
+      PointerEvent_ButtonMask_entries, 6, name, &int_value);
+  if (success) {
+    *value = static_cast<PointerEvent_ButtonMask>(int_value);
+  }
+  return success;
+}
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr PointerEvent_ButtonMask PointerEvent::EMPTY;
+constexpr PointerEvent_ButtonMask PointerEvent::LEFT_BUTTON;
+constexpr PointerEvent_ButtonMask PointerEvent::MIDDLE_BUTTON;
+constexpr PointerEvent_ButtonMask PointerEvent::RIGHT_BUTTON;
+constexpr PointerEvent_ButtonMask PointerEvent::WHEEL_UP;
+constexpr PointerEvent_ButtonMask PointerEvent::WHEEL_DOWN;
+constexpr PointerEvent_ButtonMask PointerEvent::ButtonMask_MIN;
+constexpr PointerEvent_ButtonMask PointerEvent::ButtonMask_MAX;
+constexpr int PointerEvent::ButtonMask_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+bool ClipboardEvent_Type_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> ClipboardEvent_Type_strings[3] = {};
+
+static const char ClipboardEvent_Type_names[] =
+  "TYPE_ANNOUNCE"
+  "TYPE_DATA"
+  "TYPE_REQUEST";
+
+static const ::PROTOBUF_NAMESPACE_ID::internal::EnumEntry ClipboardEvent_Type_entries[] = {
+  { {ClipboardEvent_Type_names + 0, 13}, 1 },
+  { {ClipboardEvent_Type_names + 13, 9}, 0 },
+  { {ClipboardEvent_Type_names + 22, 12}, 2 },
+};
+
+static const int ClipboardEvent_Type_entries_by_number[] = {
+  1, // 0 -> TYPE_DATA
+  0, // 1 -> TYPE_ANNOUNCE
+  2, // 2 -> TYPE_REQUEST
+};
+
+const std::string& ClipboardEvent_Type_Name(
+    ClipboardEvent_Type value) {
+  static const bool dummy =
+      ::PROTOBUF_NAMESPACE_ID::internal::InitializeEnumStrings(
+          ClipboardEvent_Type_entries,
+          ClipboardEvent_Type_entries_by_number,
+          3, ClipboardEvent_Type_strings);
+  (void) dummy;
+  int idx = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumName(
+      ClipboardEvent_Type_entries,
+      ClipboardEvent_Type_entries_by_number,
+      3, value);
+  return idx == -1 ? ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString() :
+                     ClipboardEvent_Type_strings[idx].get();
+}
+bool ClipboardEvent_Type_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ClipboardEvent_Type* value) {
+  int int_value;
+  bool success = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumValue(
+      ClipboardEvent_Type_entries, 3, name, &int_value);
+  if (success) {
+    *value = static_cast<ClipboardEvent_Type>(int_value);
+  }
+  return success;
+}
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr ClipboardEvent_Type ClipboardEvent::TYPE_DATA;
+constexpr ClipboardEvent_Type ClipboardEvent::TYPE_ANNOUNCE;
+constexpr ClipboardEvent_Type ClipboardEvent::TYPE_REQUEST;
+constexpr ClipboardEvent_Type ClipboardEvent::Type_MIN;
+constexpr ClipboardEvent_Type ClipboardEvent::Type_MAX;
+constexpr int ClipboardEvent::Type_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 bool CursorShape_Flags_IsValid(int value) {
   switch (value) {
     case 0:
@@ -373,227 +674,532 @@ bool CursorShape_Flags_IsValid(int value) {
   }
 }
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const CursorShape_Flags CursorShape::UNKNOWN;
-const CursorShape_Flags CursorShape::RESET_CACHE;
-const CursorShape_Flags CursorShape::CACHE;
-const CursorShape_Flags CursorShape::Flags_MIN;
-const CursorShape_Flags CursorShape::Flags_MAX;
-const int CursorShape::Flags_ARRAYSIZE;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+static ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> CursorShape_Flags_strings[3] = {};
+
+static const char CursorShape_Flags_names[] =
+  "CACHE"
+  "RESET_CACHE"
+  "UNKNOWN";
+
+static const ::PROTOBUF_NAMESPACE_ID::internal::EnumEntry CursorShape_Flags_entries[] = {
+  { {CursorShape_Flags_names + 0, 5}, 128 },
+  { {CursorShape_Flags_names + 5, 11}, 64 },
+  { {CursorShape_Flags_names + 16, 7}, 0 },
+};
+
+static const int CursorShape_Flags_entries_by_number[] = {
+  2, // 0 -> UNKNOWN
+  1, // 64 -> RESET_CACHE
+  0, // 128 -> CACHE
+};
+
+const std::string& CursorShape_Flags_Name(
+    CursorShape_Flags value) {
+  static const bool dummy =
+      ::PROTOBUF_NAMESPACE_ID::internal::InitializeEnumStrings(
+          CursorShape_Flags_entries,
+          CursorShape_Flags_entries_by_number,
+          3, CursorShape_Flags_strings);
+  (void) dummy;
+  int idx = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumName(
+      CursorShape_Flags_entries,
+      CursorShape_Flags_entries_by_number,
+      3, value);
+  return idx == -1 ? ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString() :
+                     CursorShape_Flags_strings[idx].get();
+}
+bool CursorShape_Flags_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, CursorShape_Flags* value) {
+  int int_value;
+  bool success = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumValue(
+      CursorShape_Flags_entries, 3, name, &int_value);
+  if (success) {
+    *value = static_cast<CursorShape_Flags>(int_value);
+  }
+  return success;
+}
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr CursorShape_Flags CursorShape::UNKNOWN;
+constexpr CursorShape_Flags CursorShape::RESET_CACHE;
+constexpr CursorShape_Flags CursorShape::CACHE;
+constexpr CursorShape_Flags CursorShape::Flags_MIN;
+constexpr CursorShape_Flags CursorShape::Flags_MAX;
+constexpr int CursorShape::Flags_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+bool Compression_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> Compression_strings[3] = {};
+
+static const char Compression_names[] =
+  "COMPRESSION_LZ4"
+  "COMPRESSION_ZLIB"
+  "COMPRESSION_ZSTD";
+
+static const ::PROTOBUF_NAMESPACE_ID::internal::EnumEntry Compression_entries[] = {
+  { {Compression_names + 0, 15}, 1 },
+  { {Compression_names + 15, 16}, 0 },
+  { {Compression_names + 31, 16}, 2 },
+};
+
+static const int Compression_entries_by_number[] = {
+  1, // 0 -> COMPRESSION_ZLIB
+  0, // 1 -> COMPRESSION_LZ4
+  2, // 2 -> COMPRESSION_ZSTD
+};
+
+const std::string& Compression_Name(
+    Compression value) {
+  static const bool dummy =
+      ::PROTOBUF_NAMESPACE_ID::internal::InitializeEnumStrings(
+          Compression_entries,
+          Compression_entries_by_number,
+          3, Compression_strings);
+  (void) dummy;
+  int idx = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumName(
+      Compression_entries,
+      Compression_entries_by_number,
+      3, value);
+  return idx == -1 ? ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString() :
+                     Compression_strings[idx].get();
+}
+bool Compression_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Compression* value) {
+  int int_value;
+  bool success = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumValue(
+      Compression_entries, 3, name, &int_value);
+  if (success) {
+    *value = static_cast<Compression>(int_value);
+  }
+  return success;
+}
 bool VideoEncoding_IsValid(int value) {
   switch (value) {
     case 0:
     case 1:
     case 2:
     case 4:
+    case 8:
+    case 16:
+    case 32:
+    case 64:
+    case 128:
+    case 256:
+    case 512:
       return true;
     default:
       return false;
   }
 }
 
+static ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> VideoEncoding_strings[11] = {};
+
+static const char VideoEncoding_names[] =
+  "VIDEO_ENCODING_AV1"
+  "VIDEO_ENCODING_H264"
+  "VIDEO_ENCODING_HYBRID"
+  "VIDEO_ENCODING_LZ4"
+  "VIDEO_ENCODING_PALETTE"
+  "VIDEO_ENCODING_UNKNOWN"
+  "VIDEO_ENCODING_VP8"
+  "VIDEO_ENCODING_VP9"
+  "VIDEO_ENCODING_VP9_LOSSY"
+  "VIDEO_ENCODING_ZLIB"
+  "VIDEO_ENCODING_ZSTD";
+
+static const ::PROTOBUF_NAMESPACE_ID::internal::EnumEntry VideoEncoding_entries[] = {
+  { {VideoEncoding_names + 0, 18}, 512 },
+  { {VideoEncoding_names + 18, 19}, 8 },
+  { {VideoEncoding_names + 37, 21}, 128 },
+  { {VideoEncoding_names + 58, 18}, 32 },
+  { {VideoEncoding_names + 76, 22}, 256 },
+  { {VideoEncoding_names + 98, 22}, 0 },
+  { {VideoEncoding_names + 120, 18}, 2 },
+  { {VideoEncoding_names + 138, 18}, 4 },
+  { {VideoEncoding_names + 156, 24}, 16 },
+  { {VideoEncoding_names + 180, 19}, 1 },
+  { {VideoEncoding_names + 199, 19}, 64 },
+};
+
+static const int VideoEncoding_entries_by_number[] = {
+  5, // 0 -> VIDEO_ENCODING_UNKNOWN
+  9, // 1 -> VIDEO_ENCODING_ZLIB
+  6, // 2 -> VIDEO_ENCODING_VP8
+  7, // 4 -> VIDEO_ENCODING_VP9
+  1, // 8 -> VIDEO_ENCODING_H264
+  8, // 16 -> VIDEO_ENCODING_VP9_LOSSY
+  3, // 32 -> VIDEO_ENCODING_LZ4
+  10, // 64 -> VIDEO_ENCODING_ZSTD
+  2, // 128 -> VIDEO_ENCODING_HYBRID
+  4, // 256 -> VIDEO_ENCODING_PALETTE
+  0, // 512 -> VIDEO_ENCODING_AV1
+};
+
+const std::string& VideoEncoding_Name(
+    VideoEncoding value) {
+  static const bool dummy =
+      ::PROTOBUF_NAMESPACE_ID::internal::InitializeEnumStrings(
+          VideoEncoding_entries,
+          VideoEncoding_entries_by_number,
+          11, VideoEncoding_strings);
+  (void) dummy;
+  int idx = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumName(
+      VideoEncoding_entries,
+      VideoEncoding_entries_by_number,
+      11, value);
+  return idx == -1 ? ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString() :
+                     VideoEncoding_strings[idx].get();
+}
+bool VideoEncoding_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, VideoEncoding* value) {
+  int int_value;
+  bool success = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumValue(
+      VideoEncoding_entries, 11, name, &int_value);
+  if (success) {
+    *value = static_cast<VideoEncoding>(int_value);
+  }
+  return success;
+}
 bool Feature_IsValid(int value) {
   switch (value) {
     case 0:
     case 1:
     case 2:
+    case 4:
+    case 8:
+    case 16:
+    case 32:
+    case 64:
+    case 128:
+    case 256:
+    case 512:
+    case 1024:
+    case 2048:
+    case 4096:
+    case 8192:
+    case 16384:
+    case 32768:
+    case 65536:
+    case 131072:
+    case 262144:
       return true;
     default:
       return false;
   }
 }
 
+static ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> Feature_strings[20] = {};
+
+static const char Feature_names[] =
+  "FEATURE_CLIPBOARD"
+  "FEATURE_CLIPBOARD_CHUNKS"
+  "FEATURE_CLIPBOARD_COMPRESSION"
+  "FEATURE_COPY_RECT"
+  "FEATURE_CURSOR_CACHE"
+  "FEATURE_CURSOR_POSITION"
+  "FEATURE_CURSOR_SHAPE"
+  "FEATURE_INPUT_EVENTS"
+  "FEATURE_LATENCY_PROBE"
+  "FEATURE_NONE"
+  "FEATURE_PACKED_RECTS"
+  "FEATURE_REDUCED_EFFECTS"
+  "FEATURE_RESYNC"
+  "FEATURE_SCALING"
+  "FEATURE_SCREEN_LIST"
+  "FEATURE_VIDEO_ACK"
+  "FEATURE_VISIBILITY"
+  "FEATURE_VISIBLE_AREA"
+  "FEATURE_ZLIB_CHUNKS"
+  "FEATURE_ZLIB_STREAM";
+
+static const ::PROTOBUF_NAMESPACE_ID::internal::EnumEntry Feature_entries[] = {
+  { {Feature_names + 0, 17}, 2 },
+  { {Feature_names + 17, 24}, 1024 },
+  { {Feature_names + 41, 29}, 2048 },
+  { {Feature_names + 70, 17}, 4 },
+  { {Feature_names + 87, 20}, 256 },
+  { {Feature_names + 107, 23}, 128 },
+  { {Feature_names + 130, 20}, 1 },
+  { {Feature_names + 150, 20}, 512 },
+  { {Feature_names + 170, 21}, 65536 },
+  { {Feature_names + 191, 12}, 0 },
+  { {Feature_names + 203, 20}, 16384 },
+  { {Feature_names + 223, 23}, 131072 },
+  { {Feature_names + 246, 14}, 32768 },
+  { {Feature_names + 260, 15}, 4096 },
+  { {Feature_names + 275, 19}, 64 },
+  { {Feature_names + 294, 17}, 8 },
+  { {Feature_names + 311, 18}, 8192 },
+  { {Feature_names + 329, 20}, 262144 },
+  { {Feature_names + 349, 19}, 16 },
+  { {Feature_names + 368, 19}, 32 },
+};
+
+static const int Feature_entries_by_number[] = {
+  9, // 0 -> FEATURE_NONE
+  6, // 1 -> FEATURE_CURSOR_SHAPE
+  0, // 2 -> FEATURE_CLIPBOARD
+  3, // 4 -> FEATURE_COPY_RECT
+  15, // 8 -> FEATURE_VIDEO_ACK
+  18, // 16 -> FEATURE_ZLIB_CHUNKS
+  19, // 32 -> FEATURE_ZLIB_STREAM
+  14, // 64 -> FEATURE_SCREEN_LIST
+  5, // 128 -> FEATURE_CURSOR_POSITION
+  4, // 256 -> FEATURE_CURSOR_CACHE
+  7, // 512 -> FEATURE_INPUT_EVENTS
+  1, // 1024 -> FEATURE_CLIPBOARD_CHUNKS
+  2, // 2048 -> FEATURE_CLIPBOARD_COMPRESSION
+  13, // 4096 -> FEATURE_SCALING
+  16, // 8192 -> FEATURE_VISIBILITY
+  10, // 16384 -> FEATURE_PACKED_RECTS
+  12, // 32768 -> FEATURE_RESYNC
+  8, // 65536 -> FEATURE_LATENCY_PROBE
+  11, // 131072 -> FEATURE_REDUCED_EFFECTS
+  17, // 262144 -> FEATURE_VISIBLE_AREA
+};
+
+const std::string& Feature_Name(
+    Feature value) {
+  static const bool dummy =
+      ::PROTOBUF_NAMESPACE_ID::internal::InitializeEnumStrings(
+          Feature_entries,
+          Feature_entries_by_number,
+          20, Feature_strings);
+  (void) dummy;
+  int idx = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumName(
+      Feature_entries,
+      Feature_entries_by_number,
+      20, value);
+  return idx == -1 ? ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString() :
+                     Feature_strings[idx].get();
+}
+bool Feature_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Feature* value) {
+  int int_value;
+  bool success = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumValue(
+      Feature_entries, 20, name, &int_value);
+  if (success) {
+    *value = static_cast<Feature>(int_value);
+  }
+  return success;
+}
 
 // ===================================================================
 
-void KeyEvent::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int KeyEvent::kUsbKeycodeFieldNumber;
-const int KeyEvent::kFlagsFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class KeyEvent::_Internal {
+ public:
+};
 
-KeyEvent::KeyEvent()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_desktop_5fsession_2eproto::scc_info_KeyEvent.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.desktop.KeyEvent)
+KeyEvent::KeyEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.desktop.KeyEvent)
 }
 KeyEvent::KeyEvent(const KeyEvent& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&usb_keycode_, &from.usb_keycode_,
-    static_cast<size_t>(reinterpret_cast<char*>(&flags_) -
-    reinterpret_cast<char*>(&usb_keycode_)) + sizeof(flags_));
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  KeyEvent* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.usb_keycode_){}
+    , decltype(_impl_.flags_){}
+    , decltype(_impl_.probe_time_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::memcpy(&_impl_.usb_keycode_, &from._impl_.usb_keycode_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.probe_time_) -
+    reinterpret_cast<char*>(&_impl_.usb_keycode_)) + sizeof(_impl_.probe_time_));
   // @@protoc_insertion_point(copy_constructor:aspia.proto.desktop.KeyEvent)
 }
 
-void KeyEvent::SharedCtor() {
-  ::memset(&usb_keycode_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&flags_) -
-      reinterpret_cast<char*>(&usb_keycode_)) + sizeof(flags_));
+inline void KeyEvent::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.usb_keycode_){0u}
+    , decltype(_impl_.flags_){0u}
+    , decltype(_impl_.probe_time_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 KeyEvent::~KeyEvent() {
   // @@protoc_insertion_point(destructor:aspia.proto.desktop.KeyEvent)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void KeyEvent::SharedDtor() {
+inline void KeyEvent::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void KeyEvent::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const KeyEvent& KeyEvent::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_desktop_5fsession_2eproto::scc_info_KeyEvent.base);
-  return *internal_default_instance();
-}
-
 
 void KeyEvent::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.desktop.KeyEvent)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&usb_keycode_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&flags_) -
-      reinterpret_cast<char*>(&usb_keycode_)) + sizeof(flags_));
-  _internal_metadata_.Clear();
-}
-
-bool KeyEvent::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.desktop.KeyEvent)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // uint32 usb_keycode = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+  ::memset(&_impl_.usb_keycode_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.probe_time_) -
+      reinterpret_cast<char*>(&_impl_.usb_keycode_)) + sizeof(_impl_.probe_time_));
+  _internal_metadata_.Clear<std::string>();
+}
 
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &usb_keycode_)));
-        } else {
+const char* KeyEvent::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 usb_keycode = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.usb_keycode_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint32 flags = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &flags_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.flags_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 probe_time = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.probe_time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.desktop.KeyEvent)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.desktop.KeyEvent)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void KeyEvent::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.desktop.KeyEvent)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* KeyEvent::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.desktop.KeyEvent)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // uint32 usb_keycode = 1;
-  if (this->usb_keycode() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->usb_keycode(), output);
+  if (this->_internal_usb_keycode() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_usb_keycode(), target);
   }
 
   // uint32 flags = 2;
-  if (this->flags() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->flags(), output);
+  if (this->_internal_flags() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_flags(), target);
+  }
+
+  // int64 probe_time = 3;
+  if (this->_internal_probe_time() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_probe_time(), target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.desktop.KeyEvent)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.desktop.KeyEvent)
+  return target;
 }
 
 size_t KeyEvent::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.desktop.KeyEvent)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // uint32 usb_keycode = 1;
-  if (this->usb_keycode() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->usb_keycode());
+  if (this->_internal_usb_keycode() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_usb_keycode());
   }
 
   // uint32 flags = 2;
-  if (this->flags() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->flags());
+  if (this->_internal_flags() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_flags());
+  }
+
+  // int64 probe_time = 3;
+  if (this->_internal_probe_time() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_probe_time());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void KeyEvent::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const KeyEvent*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const KeyEvent*>(
+      &from));
 }
 
 void KeyEvent::MergeFrom(const KeyEvent& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.KeyEvent)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  KeyEvent* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.KeyEvent)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.usb_keycode() != 0) {
-    set_usb_keycode(from.usb_keycode());
+  if (from._internal_usb_keycode() != 0) {
+    _this->_internal_set_usb_keycode(from._internal_usb_keycode());
   }
-  if (from.flags() != 0) {
-    set_flags(from.flags());
+  if (from._internal_flags() != 0) {
+    _this->_internal_set_flags(from._internal_flags());
   }
+  if (from._internal_probe_time() != 0) {
+    _this->_internal_set_probe_time(from._internal_probe_time());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void KeyEvent::CopyFrom(const KeyEvent& from) {
@@ -607,241 +1213,254 @@ bool KeyEvent::IsInitialized() const {
   return true;
 }
 
-void KeyEvent::Swap(KeyEvent* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void KeyEvent::InternalSwap(KeyEvent* other) {
   using std::swap;
-  swap(usb_keycode_, other->usb_keycode_);
-  swap(flags_, other->flags_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(KeyEvent, _impl_.probe_time_)
+      + sizeof(KeyEvent::_impl_.probe_time_)
+      - PROTOBUF_FIELD_OFFSET(KeyEvent, _impl_.usb_keycode_)>(
+          reinterpret_cast<char*>(&_impl_.usb_keycode_),
+          reinterpret_cast<char*>(&other->_impl_.usb_keycode_));
 }
 
-::std::string KeyEvent::GetTypeName() const {
+std::string KeyEvent::GetTypeName() const {
   return "aspia.proto.desktop.KeyEvent";
 }
 
 
 // ===================================================================
 
-void PointerEvent::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PointerEvent::kMaskFieldNumber;
-const int PointerEvent::kXFieldNumber;
-const int PointerEvent::kYFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class PointerEvent::_Internal {
+ public:
+};
 
-PointerEvent::PointerEvent()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_desktop_5fsession_2eproto::scc_info_PointerEvent.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.desktop.PointerEvent)
+PointerEvent::PointerEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.desktop.PointerEvent)
 }
 PointerEvent::PointerEvent(const PointerEvent& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&mask_, &from.mask_,
-    static_cast<size_t>(reinterpret_cast<char*>(&y_) -
-    reinterpret_cast<char*>(&mask_)) + sizeof(y_));
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  PointerEvent* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.mask_){}
+    , decltype(_impl_.x_){}
+    , decltype(_impl_.probe_time_){}
+    , decltype(_impl_.y_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::memcpy(&_impl_.mask_, &from._impl_.mask_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.y_) -
+    reinterpret_cast<char*>(&_impl_.mask_)) + sizeof(_impl_.y_));
   // @@protoc_insertion_point(copy_constructor:aspia.proto.desktop.PointerEvent)
 }
 
-void PointerEvent::SharedCtor() {
-  ::memset(&mask_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&y_) -
-      reinterpret_cast<char*>(&mask_)) + sizeof(y_));
+inline void PointerEvent::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.mask_){0u}
+    , decltype(_impl_.x_){0}
+    , decltype(_impl_.probe_time_){int64_t{0}}
+    , decltype(_impl_.y_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 PointerEvent::~PointerEvent() {
   // @@protoc_insertion_point(destructor:aspia.proto.desktop.PointerEvent)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PointerEvent::SharedDtor() {
+inline void PointerEvent::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void PointerEvent::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const PointerEvent& PointerEvent::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_desktop_5fsession_2eproto::scc_info_PointerEvent.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void PointerEvent::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.desktop.PointerEvent)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&mask_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&y_) -
-      reinterpret_cast<char*>(&mask_)) + sizeof(y_));
-  _internal_metadata_.Clear();
-}
-
-bool PointerEvent::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.desktop.PointerEvent)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // uint32 mask = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+  ::memset(&_impl_.mask_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.y_) -
+      reinterpret_cast<char*>(&_impl_.mask_)) + sizeof(_impl_.y_));
+  _internal_metadata_.Clear<std::string>();
+}
 
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &mask_)));
-        } else {
+const char* PointerEvent::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 mask = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.mask_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // int32 x = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &x_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.x_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // int32 y = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &y_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.y_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 probe_time = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.probe_time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.desktop.PointerEvent)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.desktop.PointerEvent)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void PointerEvent::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.desktop.PointerEvent)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* PointerEvent::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.desktop.PointerEvent)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // uint32 mask = 1;
-  if (this->mask() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->mask(), output);
+  if (this->_internal_mask() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_mask(), target);
   }
 
   // int32 x = 2;
-  if (this->x() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->x(), output);
+  if (this->_internal_x() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_x(), target);
   }
 
   // int32 y = 3;
-  if (this->y() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->y(), output);
+  if (this->_internal_y() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_y(), target);
+  }
+
+  // int64 probe_time = 4;
+  if (this->_internal_probe_time() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_probe_time(), target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.desktop.PointerEvent)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.desktop.PointerEvent)
+  return target;
 }
 
 size_t PointerEvent::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.desktop.PointerEvent)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // uint32 mask = 1;
-  if (this->mask() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->mask());
+  if (this->_internal_mask() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_mask());
   }
 
   // int32 x = 2;
-  if (this->x() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->x());
+  if (this->_internal_x() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_x());
+  }
+
+  // int64 probe_time = 4;
+  if (this->_internal_probe_time() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_probe_time());
   }
 
   // int32 y = 3;
-  if (this->y() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->y());
+  if (this->_internal_y() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_y());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void PointerEvent::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const PointerEvent*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const PointerEvent*>(
+      &from));
 }
 
 void PointerEvent::MergeFrom(const PointerEvent& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.PointerEvent)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  PointerEvent* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.PointerEvent)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.mask() != 0) {
-    set_mask(from.mask());
+  if (from._internal_mask() != 0) {
+    _this->_internal_set_mask(from._internal_mask());
   }
-  if (from.x() != 0) {
-    set_x(from.x());
+  if (from._internal_x() != 0) {
+    _this->_internal_set_x(from._internal_x());
   }
-  if (from.y() != 0) {
-    set_y(from.y());
+  if (from._internal_probe_time() != 0) {
+    _this->_internal_set_probe_time(from._internal_probe_time());
   }
+  if (from._internal_y() != 0) {
+    _this->_internal_set_y(from._internal_y());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void PointerEvent::CopyFrom(const PointerEvent& from) {
@@ -855,225 +1474,395 @@ bool PointerEvent::IsInitialized() const {
   return true;
 }
 
-void PointerEvent::Swap(PointerEvent* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void PointerEvent::InternalSwap(PointerEvent* other) {
   using std::swap;
-  swap(mask_, other->mask_);
-  swap(x_, other->x_);
-  swap(y_, other->y_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PointerEvent, _impl_.y_)
+      + sizeof(PointerEvent::_impl_.y_)
+      - PROTOBUF_FIELD_OFFSET(PointerEvent, _impl_.mask_)>(
+          reinterpret_cast<char*>(&_impl_.mask_),
+          reinterpret_cast<char*>(&other->_impl_.mask_));
 }
 
-::std::string PointerEvent::GetTypeName() const {
+std::string PointerEvent::GetTypeName() const {
   return "aspia.proto.desktop.PointerEvent";
 }
 
 
 // ===================================================================
 
-void ClipboardEvent::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int ClipboardEvent::kMimeTypeFieldNumber;
-const int ClipboardEvent::kDataFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class ClipboardEvent::_Internal {
+ public:
+};
 
-ClipboardEvent::ClipboardEvent()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_desktop_5fsession_2eproto::scc_info_ClipboardEvent.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.desktop.ClipboardEvent)
+ClipboardEvent::ClipboardEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.desktop.ClipboardEvent)
 }
 ClipboardEvent::ClipboardEvent(const ClipboardEvent& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  mime_type_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.mime_type().size() > 0) {
-    mime_type_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.mime_type_);
-  }
-  data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.data().size() > 0) {
-    data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.data_);
-  }
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  ClipboardEvent* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.mime_type_){}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.hash_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.size_){}
+    , decltype(_impl_.offset_){}
+    , decltype(_impl_.compression_){}
+    , decltype(_impl_.uncompressed_size_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.mime_type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.mime_type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_mime_type().empty()) {
+    _this->_impl_.mime_type_.Set(from._internal_mime_type(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_data().empty()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.hash_, &from._impl_.hash_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.uncompressed_size_) -
+    reinterpret_cast<char*>(&_impl_.hash_)) + sizeof(_impl_.uncompressed_size_));
   // @@protoc_insertion_point(copy_constructor:aspia.proto.desktop.ClipboardEvent)
 }
 
-void ClipboardEvent::SharedCtor() {
-  mime_type_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void ClipboardEvent::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.mime_type_){}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.hash_){uint64_t{0u}}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.size_){0u}
+    , decltype(_impl_.offset_){0u}
+    , decltype(_impl_.compression_){0}
+    , decltype(_impl_.uncompressed_size_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.mime_type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.mime_type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 ClipboardEvent::~ClipboardEvent() {
   // @@protoc_insertion_point(destructor:aspia.proto.desktop.ClipboardEvent)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void ClipboardEvent::SharedDtor() {
-  mime_type_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  data_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void ClipboardEvent::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.mime_type_.Destroy();
+  _impl_.data_.Destroy();
 }
 
 void ClipboardEvent::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ClipboardEvent& ClipboardEvent::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_desktop_5fsession_2eproto::scc_info_ClipboardEvent.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void ClipboardEvent::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.desktop.ClipboardEvent)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  mime_type_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  _internal_metadata_.Clear();
-}
-
-bool ClipboardEvent::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.desktop.ClipboardEvent)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // string mime_type = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_mime_type()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->mime_type().data(), static_cast<int>(this->mime_type().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "aspia.proto.desktop.ClipboardEvent.mime_type"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+  _impl_.mime_type_.ClearToEmpty();
+  _impl_.data_.ClearToEmpty();
+  ::memset(&_impl_.hash_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.uncompressed_size_) -
+      reinterpret_cast<char*>(&_impl_.hash_)) + sizeof(_impl_.uncompressed_size_));
+  _internal_metadata_.Clear<std::string>();
+}
 
+const char* ClipboardEvent::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string mime_type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_mime_type();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
+        } else
+          goto handle_unusual;
+        continue;
       // bytes data = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_data()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .aspia.proto.desktop.ClipboardEvent.Type type = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_type(static_cast<::aspia::proto::desktop::ClipboardEvent_Type>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // fixed64 hash = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _impl_.hash_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 size = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 offset = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .aspia.proto.desktop.Compression compression = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_compression(static_cast<::aspia::proto::desktop::Compression>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 uncompressed_size = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.uncompressed_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.desktop.ClipboardEvent)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.desktop.ClipboardEvent)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void ClipboardEvent::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.desktop.ClipboardEvent)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* ClipboardEvent::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.desktop.ClipboardEvent)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string mime_type = 1;
-  if (this->mime_type().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->mime_type().data(), static_cast<int>(this->mime_type().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_mime_type().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_mime_type().data(), static_cast<int>(this->_internal_mime_type().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "aspia.proto.desktop.ClipboardEvent.mime_type");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->mime_type(), output);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_mime_type(), target);
   }
 
   // bytes data = 2;
-  if (this->data().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      2, this->data(), output);
+  if (!this->_internal_data().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_data(), target);
+  }
+
+  // .aspia.proto.desktop.ClipboardEvent.Type type = 3;
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_type(), target);
+  }
+
+  // fixed64 hash = 4;
+  if (this->_internal_hash() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(4, this->_internal_hash(), target);
+  }
+
+  // uint32 size = 5;
+  if (this->_internal_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_size(), target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.desktop.ClipboardEvent)
+  // uint32 offset = 6;
+  if (this->_internal_offset() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_offset(), target);
+  }
+
+  // .aspia.proto.desktop.Compression compression = 7;
+  if (this->_internal_compression() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      7, this->_internal_compression(), target);
+  }
+
+  // uint32 uncompressed_size = 8;
+  if (this->_internal_uncompressed_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_uncompressed_size(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.desktop.ClipboardEvent)
+  return target;
 }
 
 size_t ClipboardEvent::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.desktop.ClipboardEvent)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // string mime_type = 1;
-  if (this->mime_type().size() > 0) {
+  if (!this->_internal_mime_type().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->mime_type());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_mime_type());
   }
 
   // bytes data = 2;
-  if (this->data().size() > 0) {
+  if (!this->_internal_data().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
+  }
+
+  // fixed64 hash = 4;
+  if (this->_internal_hash() != 0) {
+    total_size += 1 + 8;
+  }
+
+  // .aspia.proto.desktop.ClipboardEvent.Type type = 3;
+  if (this->_internal_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+
+  // uint32 size = 5;
+  if (this->_internal_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_size());
+  }
+
+  // uint32 offset = 6;
+  if (this->_internal_offset() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_offset());
+  }
+
+  // .aspia.proto.desktop.Compression compression = 7;
+  if (this->_internal_compression() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->data());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_compression());
+  }
+
+  // uint32 uncompressed_size = 8;
+  if (this->_internal_uncompressed_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_uncompressed_size());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void ClipboardEvent::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const ClipboardEvent*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const ClipboardEvent*>(
+      &from));
 }
 
 void ClipboardEvent::MergeFrom(const ClipboardEvent& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.ClipboardEvent)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  ClipboardEvent* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.ClipboardEvent)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.mime_type().size() > 0) {
-
-    mime_type_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.mime_type_);
+  if (!from._internal_mime_type().empty()) {
+    _this->_internal_set_mime_type(from._internal_mime_type());
   }
-  if (from.data().size() > 0) {
-
-    data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.data_);
+  if (!from._internal_data().empty()) {
+    _this->_internal_set_data(from._internal_data());
+  }
+  if (from._internal_hash() != 0) {
+    _this->_internal_set_hash(from._internal_hash());
+  }
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  if (from._internal_size() != 0) {
+    _this->_internal_set_size(from._internal_size());
+  }
+  if (from._internal_offset() != 0) {
+    _this->_internal_set_offset(from._internal_offset());
+  }
+  if (from._internal_compression() != 0) {
+    _this->_internal_set_compression(from._internal_compression());
+  }
+  if (from._internal_uncompressed_size() != 0) {
+    _this->_internal_set_uncompressed_size(from._internal_uncompressed_size());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void ClipboardEvent::CopyFrom(const ClipboardEvent& from) {
@@ -1087,340 +1876,404 @@ bool ClipboardEvent::IsInitialized() const {
   return true;
 }
 
-void ClipboardEvent::Swap(ClipboardEvent* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void ClipboardEvent::InternalSwap(ClipboardEvent* other) {
   using std::swap;
-  mime_type_.Swap(&other->mime_type_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  data_.Swap(&other->data_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-}
-
-::std::string ClipboardEvent::GetTypeName() const {
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.mime_type_, lhs_arena,
+      &other->_impl_.mime_type_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ClipboardEvent, _impl_.uncompressed_size_)
+      + sizeof(ClipboardEvent::_impl_.uncompressed_size_)
+      - PROTOBUF_FIELD_OFFSET(ClipboardEvent, _impl_.hash_)>(
+          reinterpret_cast<char*>(&_impl_.hash_),
+          reinterpret_cast<char*>(&other->_impl_.hash_));
+}
+
+std::string ClipboardEvent::GetTypeName() const {
   return "aspia.proto.desktop.ClipboardEvent";
 }
 
 
 // ===================================================================
 
-void CursorShape::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int CursorShape::kFlagsFieldNumber;
-const int CursorShape::kWidthFieldNumber;
-const int CursorShape::kHeightFieldNumber;
-const int CursorShape::kHotspotXFieldNumber;
-const int CursorShape::kHotspotYFieldNumber;
-const int CursorShape::kDataFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class CursorShape::_Internal {
+ public:
+};
 
-CursorShape::CursorShape()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_desktop_5fsession_2eproto::scc_info_CursorShape.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.desktop.CursorShape)
+CursorShape::CursorShape(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.desktop.CursorShape)
 }
 CursorShape::CursorShape(const CursorShape& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.data().size() > 0) {
-    data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.data_);
-  }
-  ::memcpy(&flags_, &from.flags_,
-    static_cast<size_t>(reinterpret_cast<char*>(&hotspot_y_) -
-    reinterpret_cast<char*>(&flags_)) + sizeof(hotspot_y_));
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  CursorShape* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_){}
+    , decltype(_impl_.flags_){}
+    , decltype(_impl_.width_){}
+    , decltype(_impl_.height_){}
+    , decltype(_impl_.hotspot_x_){}
+    , decltype(_impl_.hotspot_y_){}
+    , decltype(_impl_.compression_){}
+    , decltype(_impl_.cache_index_){}
+    , decltype(_impl_.cache_size_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_data().empty()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.flags_, &from._impl_.flags_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.cache_size_) -
+    reinterpret_cast<char*>(&_impl_.flags_)) + sizeof(_impl_.cache_size_));
   // @@protoc_insertion_point(copy_constructor:aspia.proto.desktop.CursorShape)
 }
 
-void CursorShape::SharedCtor() {
-  data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&flags_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&hotspot_y_) -
-      reinterpret_cast<char*>(&flags_)) + sizeof(hotspot_y_));
+inline void CursorShape::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_){}
+    , decltype(_impl_.flags_){0u}
+    , decltype(_impl_.width_){0}
+    , decltype(_impl_.height_){0}
+    , decltype(_impl_.hotspot_x_){0}
+    , decltype(_impl_.hotspot_y_){0}
+    , decltype(_impl_.compression_){0}
+    , decltype(_impl_.cache_index_){0u}
+    , decltype(_impl_.cache_size_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 CursorShape::~CursorShape() {
   // @@protoc_insertion_point(destructor:aspia.proto.desktop.CursorShape)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void CursorShape::SharedDtor() {
-  data_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void CursorShape::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.data_.Destroy();
 }
 
 void CursorShape::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const CursorShape& CursorShape::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_desktop_5fsession_2eproto::scc_info_CursorShape.base);
-  return *internal_default_instance();
-}
-
 
 void CursorShape::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.desktop.CursorShape)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&flags_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&hotspot_y_) -
-      reinterpret_cast<char*>(&flags_)) + sizeof(hotspot_y_));
-  _internal_metadata_.Clear();
-}
-
-bool CursorShape::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.desktop.CursorShape)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // uint32 flags = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+  _impl_.data_.ClearToEmpty();
+  ::memset(&_impl_.flags_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.cache_size_) -
+      reinterpret_cast<char*>(&_impl_.flags_)) + sizeof(_impl_.cache_size_));
+  _internal_metadata_.Clear<std::string>();
+}
 
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &flags_)));
-        } else {
+const char* CursorShape::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 flags = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.flags_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // int32 width = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &width_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.width_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // int32 height = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &height_)));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.height_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // int32 hotspot_x = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &hotspot_x_)));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.hotspot_x_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // int32 hotspot_y = 5;
-      case 5: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(40u /* 40 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &hotspot_y_)));
-        } else {
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.hotspot_y_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // bytes data = 6;
-      case 6: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(50u /* 50 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_data()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .aspia.proto.desktop.Compression compression = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_compression(static_cast<::aspia::proto::desktop::Compression>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 cache_index = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.cache_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 cache_size = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.cache_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.desktop.CursorShape)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.desktop.CursorShape)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void CursorShape::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.desktop.CursorShape)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* CursorShape::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.desktop.CursorShape)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // uint32 flags = 1;
-  if (this->flags() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->flags(), output);
+  if (this->_internal_flags() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_flags(), target);
   }
 
   // int32 width = 2;
-  if (this->width() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->width(), output);
+  if (this->_internal_width() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_width(), target);
   }
 
   // int32 height = 3;
-  if (this->height() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->height(), output);
+  if (this->_internal_height() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_height(), target);
   }
 
   // int32 hotspot_x = 4;
-  if (this->hotspot_x() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(4, this->hotspot_x(), output);
+  if (this->_internal_hotspot_x() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_hotspot_x(), target);
   }
 
   // int32 hotspot_y = 5;
-  if (this->hotspot_y() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(5, this->hotspot_y(), output);
+  if (this->_internal_hotspot_y() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_hotspot_y(), target);
   }
 
   // bytes data = 6;
-  if (this->data().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      6, this->data(), output);
+  if (!this->_internal_data().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        6, this->_internal_data(), target);
+  }
+
+  // .aspia.proto.desktop.Compression compression = 7;
+  if (this->_internal_compression() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      7, this->_internal_compression(), target);
+  }
+
+  // uint32 cache_index = 8;
+  if (this->_internal_cache_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_cache_index(), target);
+  }
+
+  // uint32 cache_size = 9;
+  if (this->_internal_cache_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(9, this->_internal_cache_size(), target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.desktop.CursorShape)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.desktop.CursorShape)
+  return target;
 }
 
 size_t CursorShape::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.desktop.CursorShape)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // bytes data = 6;
-  if (this->data().size() > 0) {
+  if (!this->_internal_data().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->data());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
   }
 
   // uint32 flags = 1;
-  if (this->flags() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->flags());
+  if (this->_internal_flags() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_flags());
   }
 
   // int32 width = 2;
-  if (this->width() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->width());
+  if (this->_internal_width() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_width());
   }
 
   // int32 height = 3;
-  if (this->height() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->height());
+  if (this->_internal_height() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_height());
   }
 
   // int32 hotspot_x = 4;
-  if (this->hotspot_x() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->hotspot_x());
+  if (this->_internal_hotspot_x() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_hotspot_x());
   }
 
   // int32 hotspot_y = 5;
-  if (this->hotspot_y() != 0) {
+  if (this->_internal_hotspot_y() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_hotspot_y());
+  }
+
+  // .aspia.proto.desktop.Compression compression = 7;
+  if (this->_internal_compression() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->hotspot_y());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_compression());
+  }
+
+  // uint32 cache_index = 8;
+  if (this->_internal_cache_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cache_index());
+  }
+
+  // uint32 cache_size = 9;
+  if (this->_internal_cache_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cache_size());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void CursorShape::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const CursorShape*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const CursorShape*>(
+      &from));
 }
 
 void CursorShape::MergeFrom(const CursorShape& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.CursorShape)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  CursorShape* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.CursorShape)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.data().size() > 0) {
-
-    data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.data_);
+  if (!from._internal_data().empty()) {
+    _this->_internal_set_data(from._internal_data());
+  }
+  if (from._internal_flags() != 0) {
+    _this->_internal_set_flags(from._internal_flags());
   }
-  if (from.flags() != 0) {
-    set_flags(from.flags());
+  if (from._internal_width() != 0) {
+    _this->_internal_set_width(from._internal_width());
   }
-  if (from.width() != 0) {
-    set_width(from.width());
+  if (from._internal_height() != 0) {
+    _this->_internal_set_height(from._internal_height());
   }
-  if (from.height() != 0) {
-    set_height(from.height());
+  if (from._internal_hotspot_x() != 0) {
+    _this->_internal_set_hotspot_x(from._internal_hotspot_x());
   }
-  if (from.hotspot_x() != 0) {
-    set_hotspot_x(from.hotspot_x());
+  if (from._internal_hotspot_y() != 0) {
+    _this->_internal_set_hotspot_y(from._internal_hotspot_y());
   }
-  if (from.hotspot_y() != 0) {
-    set_hotspot_y(from.hotspot_y());
+  if (from._internal_compression() != 0) {
+    _this->_internal_set_compression(from._internal_compression());
   }
+  if (from._internal_cache_index() != 0) {
+    _this->_internal_set_cache_index(from._internal_cache_index());
+  }
+  if (from._internal_cache_size() != 0) {
+    _this->_internal_set_cache_size(from._internal_cache_size());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void CursorShape::CopyFrom(const CursorShape& from) {
@@ -1434,276 +2287,473 @@ bool CursorShape::IsInitialized() const {
   return true;
 }
 
-void CursorShape::Swap(CursorShape* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void CursorShape::InternalSwap(CursorShape* other) {
   using std::swap;
-  data_.Swap(&other->data_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(flags_, other->flags_);
-  swap(width_, other->width_);
-  swap(height_, other->height_);
-  swap(hotspot_x_, other->hotspot_x_);
-  swap(hotspot_y_, other->hotspot_y_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-}
-
-::std::string CursorShape::GetTypeName() const {
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CursorShape, _impl_.cache_size_)
+      + sizeof(CursorShape::_impl_.cache_size_)
+      - PROTOBUF_FIELD_OFFSET(CursorShape, _impl_.flags_)>(
+          reinterpret_cast<char*>(&_impl_.flags_),
+          reinterpret_cast<char*>(&other->_impl_.flags_));
+}
+
+std::string CursorShape::GetTypeName() const {
   return "aspia.proto.desktop.CursorShape";
 }
 
 
 // ===================================================================
 
-void Rect::InitAsDefaultInstance() {
+class CursorPosition::_Internal {
+ public:
+};
+
+CursorPosition::CursorPosition(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.desktop.CursorPosition)
+}
+CursorPosition::CursorPosition(const CursorPosition& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  CursorPosition* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.x_){}
+    , decltype(_impl_.y_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::memcpy(&_impl_.x_, &from._impl_.x_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.y_) -
+    reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.y_));
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.desktop.CursorPosition)
+}
+
+inline void CursorPosition::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.x_){0}
+    , decltype(_impl_.y_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+CursorPosition::~CursorPosition() {
+  // @@protoc_insertion_point(destructor:aspia.proto.desktop.CursorPosition)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CursorPosition::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CursorPosition::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CursorPosition::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.desktop.CursorPosition)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.x_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.y_) -
+      reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.y_));
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* CursorPosition::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 x = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.x_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 y = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.y_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CursorPosition::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.desktop.CursorPosition)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 x = 1;
+  if (this->_internal_x() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_x(), target);
+  }
+
+  // int32 y = 2;
+  if (this->_internal_y() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_y(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.desktop.CursorPosition)
+  return target;
+}
+
+size_t CursorPosition::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.desktop.CursorPosition)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 x = 1;
+  if (this->_internal_x() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_x());
+  }
+
+  // int32 y = 2;
+  if (this->_internal_y() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_y());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void CursorPosition::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const CursorPosition*>(
+      &from));
+}
+
+void CursorPosition::MergeFrom(const CursorPosition& from) {
+  CursorPosition* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.CursorPosition)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_x() != 0) {
+    _this->_internal_set_x(from._internal_x());
+  }
+  if (from._internal_y() != 0) {
+    _this->_internal_set_y(from._internal_y());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void CursorPosition::CopyFrom(const CursorPosition& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.desktop.CursorPosition)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CursorPosition::IsInitialized() const {
+  return true;
+}
+
+void CursorPosition::InternalSwap(CursorPosition* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CursorPosition, _impl_.y_)
+      + sizeof(CursorPosition::_impl_.y_)
+      - PROTOBUF_FIELD_OFFSET(CursorPosition, _impl_.x_)>(
+          reinterpret_cast<char*>(&_impl_.x_),
+          reinterpret_cast<char*>(&other->_impl_.x_));
+}
+
+std::string CursorPosition::GetTypeName() const {
+  return "aspia.proto.desktop.CursorPosition";
 }
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Rect::kXFieldNumber;
-const int Rect::kYFieldNumber;
-const int Rect::kWidthFieldNumber;
-const int Rect::kHeightFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-Rect::Rect()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_desktop_5fsession_2eproto::scc_info_Rect.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.desktop.Rect)
+
+// ===================================================================
+
+class Rect::_Internal {
+ public:
+};
+
+Rect::Rect(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.desktop.Rect)
 }
 Rect::Rect(const Rect& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&x_, &from.x_,
-    static_cast<size_t>(reinterpret_cast<char*>(&height_) -
-    reinterpret_cast<char*>(&x_)) + sizeof(height_));
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  Rect* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.x_){}
+    , decltype(_impl_.y_){}
+    , decltype(_impl_.width_){}
+    , decltype(_impl_.height_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::memcpy(&_impl_.x_, &from._impl_.x_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.height_) -
+    reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.height_));
   // @@protoc_insertion_point(copy_constructor:aspia.proto.desktop.Rect)
 }
 
-void Rect::SharedCtor() {
-  ::memset(&x_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&height_) -
-      reinterpret_cast<char*>(&x_)) + sizeof(height_));
+inline void Rect::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.x_){0}
+    , decltype(_impl_.y_){0}
+    , decltype(_impl_.width_){0}
+    , decltype(_impl_.height_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 Rect::~Rect() {
   // @@protoc_insertion_point(destructor:aspia.proto.desktop.Rect)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Rect::SharedDtor() {
+inline void Rect::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void Rect::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Rect& Rect::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_desktop_5fsession_2eproto::scc_info_Rect.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void Rect::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.desktop.Rect)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&x_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&height_) -
-      reinterpret_cast<char*>(&x_)) + sizeof(height_));
-  _internal_metadata_.Clear();
-}
-
-bool Rect::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.desktop.Rect)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // int32 x = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+  ::memset(&_impl_.x_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.height_) -
+      reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.height_));
+  _internal_metadata_.Clear<std::string>();
+}
 
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &x_)));
-        } else {
+const char* Rect::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 x = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.x_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // int32 y = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &y_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.y_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // int32 width = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &width_)));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.width_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // int32 height = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &height_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.height_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.desktop.Rect)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.desktop.Rect)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void Rect::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.desktop.Rect)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* Rect::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.desktop.Rect)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // int32 x = 1;
-  if (this->x() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->x(), output);
+  if (this->_internal_x() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_x(), target);
   }
 
   // int32 y = 2;
-  if (this->y() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->y(), output);
+  if (this->_internal_y() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_y(), target);
   }
 
   // int32 width = 3;
-  if (this->width() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->width(), output);
+  if (this->_internal_width() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_width(), target);
   }
 
   // int32 height = 4;
-  if (this->height() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(4, this->height(), output);
+  if (this->_internal_height() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_height(), target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.desktop.Rect)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.desktop.Rect)
+  return target;
 }
 
 size_t Rect::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.desktop.Rect)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // int32 x = 1;
-  if (this->x() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->x());
+  if (this->_internal_x() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_x());
   }
 
   // int32 y = 2;
-  if (this->y() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->y());
+  if (this->_internal_y() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_y());
   }
 
   // int32 width = 3;
-  if (this->width() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->width());
+  if (this->_internal_width() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_width());
   }
 
   // int32 height = 4;
-  if (this->height() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->height());
+  if (this->_internal_height() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_height());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void Rect::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const Rect*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const Rect*>(
+      &from));
 }
 
 void Rect::MergeFrom(const Rect& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.Rect)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  Rect* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.Rect)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.x() != 0) {
-    set_x(from.x());
+  if (from._internal_x() != 0) {
+    _this->_internal_set_x(from._internal_x());
   }
-  if (from.y() != 0) {
-    set_y(from.y());
+  if (from._internal_y() != 0) {
+    _this->_internal_set_y(from._internal_y());
   }
-  if (from.width() != 0) {
-    set_width(from.width());
+  if (from._internal_width() != 0) {
+    _this->_internal_set_width(from._internal_width());
   }
-  if (from.height() != 0) {
-    set_height(from.height());
+  if (from._internal_height() != 0) {
+    _this->_internal_set_height(from._internal_height());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void Rect::CopyFrom(const Rect& from) {
@@ -1717,363 +2767,326 @@ bool Rect::IsInitialized() const {
   return true;
 }
 
-void Rect::Swap(Rect* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void Rect::InternalSwap(Rect* other) {
   using std::swap;
-  swap(x_, other->x_);
-  swap(y_, other->y_);
-  swap(width_, other->width_);
-  swap(height_, other->height_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Rect, _impl_.height_)
+      + sizeof(Rect::_impl_.height_)
+      - PROTOBUF_FIELD_OFFSET(Rect, _impl_.x_)>(
+          reinterpret_cast<char*>(&_impl_.x_),
+          reinterpret_cast<char*>(&other->_impl_.x_));
 }
 
-::std::string Rect::GetTypeName() const {
+std::string Rect::GetTypeName() const {
   return "aspia.proto.desktop.Rect";
 }
 
 
 // ===================================================================
 
-void PixelFormat::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PixelFormat::kBitsPerPixelFieldNumber;
-const int PixelFormat::kRedMaxFieldNumber;
-const int PixelFormat::kGreenMaxFieldNumber;
-const int PixelFormat::kBlueMaxFieldNumber;
-const int PixelFormat::kRedShiftFieldNumber;
-const int PixelFormat::kGreenShiftFieldNumber;
-const int PixelFormat::kBlueShiftFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-PixelFormat::PixelFormat()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_desktop_5fsession_2eproto::scc_info_PixelFormat.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.desktop.PixelFormat)
+class PixelFormat::_Internal {
+ public:
+};
+
+PixelFormat::PixelFormat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.desktop.PixelFormat)
 }
 PixelFormat::PixelFormat(const PixelFormat& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&bits_per_pixel_, &from.bits_per_pixel_,
-    static_cast<size_t>(reinterpret_cast<char*>(&blue_shift_) -
-    reinterpret_cast<char*>(&bits_per_pixel_)) + sizeof(blue_shift_));
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  PixelFormat* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.bits_per_pixel_){}
+    , decltype(_impl_.red_max_){}
+    , decltype(_impl_.green_max_){}
+    , decltype(_impl_.blue_max_){}
+    , decltype(_impl_.red_shift_){}
+    , decltype(_impl_.green_shift_){}
+    , decltype(_impl_.blue_shift_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::memcpy(&_impl_.bits_per_pixel_, &from._impl_.bits_per_pixel_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.blue_shift_) -
+    reinterpret_cast<char*>(&_impl_.bits_per_pixel_)) + sizeof(_impl_.blue_shift_));
   // @@protoc_insertion_point(copy_constructor:aspia.proto.desktop.PixelFormat)
 }
 
-void PixelFormat::SharedCtor() {
-  ::memset(&bits_per_pixel_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&blue_shift_) -
-      reinterpret_cast<char*>(&bits_per_pixel_)) + sizeof(blue_shift_));
+inline void PixelFormat::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.bits_per_pixel_){0u}
+    , decltype(_impl_.red_max_){0u}
+    , decltype(_impl_.green_max_){0u}
+    , decltype(_impl_.blue_max_){0u}
+    , decltype(_impl_.red_shift_){0u}
+    , decltype(_impl_.green_shift_){0u}
+    , decltype(_impl_.blue_shift_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 PixelFormat::~PixelFormat() {
   // @@protoc_insertion_point(destructor:aspia.proto.desktop.PixelFormat)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PixelFormat::SharedDtor() {
+inline void PixelFormat::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void PixelFormat::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const PixelFormat& PixelFormat::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_desktop_5fsession_2eproto::scc_info_PixelFormat.base);
-  return *internal_default_instance();
-}
-
 
 void PixelFormat::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.desktop.PixelFormat)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&bits_per_pixel_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&blue_shift_) -
-      reinterpret_cast<char*>(&bits_per_pixel_)) + sizeof(blue_shift_));
-  _internal_metadata_.Clear();
-}
-
-bool PixelFormat::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.desktop.PixelFormat)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // uint32 bits_per_pixel = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+  ::memset(&_impl_.bits_per_pixel_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.blue_shift_) -
+      reinterpret_cast<char*>(&_impl_.bits_per_pixel_)) + sizeof(_impl_.blue_shift_));
+  _internal_metadata_.Clear<std::string>();
+}
 
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &bits_per_pixel_)));
-        } else {
+const char* PixelFormat::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 bits_per_pixel = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.bits_per_pixel_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint32 red_max = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &red_max_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.red_max_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint32 green_max = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &green_max_)));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.green_max_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint32 blue_max = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &blue_max_)));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.blue_max_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint32 red_shift = 5;
-      case 5: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(40u /* 40 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &red_shift_)));
-        } else {
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.red_shift_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint32 green_shift = 6;
-      case 6: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(48u /* 48 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &green_shift_)));
-        } else {
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.green_shift_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint32 blue_shift = 7;
-      case 7: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(56u /* 56 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &blue_shift_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.blue_shift_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.desktop.PixelFormat)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.desktop.PixelFormat)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void PixelFormat::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.desktop.PixelFormat)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* PixelFormat::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.desktop.PixelFormat)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // uint32 bits_per_pixel = 1;
-  if (this->bits_per_pixel() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->bits_per_pixel(), output);
+  if (this->_internal_bits_per_pixel() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_bits_per_pixel(), target);
   }
 
   // uint32 red_max = 2;
-  if (this->red_max() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->red_max(), output);
+  if (this->_internal_red_max() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_red_max(), target);
   }
 
   // uint32 green_max = 3;
-  if (this->green_max() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->green_max(), output);
+  if (this->_internal_green_max() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_green_max(), target);
   }
 
   // uint32 blue_max = 4;
-  if (this->blue_max() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(4, this->blue_max(), output);
+  if (this->_internal_blue_max() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_blue_max(), target);
   }
 
   // uint32 red_shift = 5;
-  if (this->red_shift() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(5, this->red_shift(), output);
+  if (this->_internal_red_shift() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_red_shift(), target);
   }
 
   // uint32 green_shift = 6;
-  if (this->green_shift() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(6, this->green_shift(), output);
+  if (this->_internal_green_shift() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_green_shift(), target);
   }
 
   // uint32 blue_shift = 7;
-  if (this->blue_shift() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(7, this->blue_shift(), output);
+  if (this->_internal_blue_shift() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_blue_shift(), target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.desktop.PixelFormat)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.desktop.PixelFormat)
+  return target;
 }
 
 size_t PixelFormat::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.desktop.PixelFormat)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // uint32 bits_per_pixel = 1;
-  if (this->bits_per_pixel() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->bits_per_pixel());
+  if (this->_internal_bits_per_pixel() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_bits_per_pixel());
   }
 
   // uint32 red_max = 2;
-  if (this->red_max() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->red_max());
+  if (this->_internal_red_max() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_red_max());
   }
 
   // uint32 green_max = 3;
-  if (this->green_max() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->green_max());
+  if (this->_internal_green_max() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_green_max());
   }
 
   // uint32 blue_max = 4;
-  if (this->blue_max() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->blue_max());
+  if (this->_internal_blue_max() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_blue_max());
   }
 
   // uint32 red_shift = 5;
-  if (this->red_shift() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->red_shift());
+  if (this->_internal_red_shift() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_red_shift());
   }
 
   // uint32 green_shift = 6;
-  if (this->green_shift() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->green_shift());
+  if (this->_internal_green_shift() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_green_shift());
   }
 
   // uint32 blue_shift = 7;
-  if (this->blue_shift() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->blue_shift());
+  if (this->_internal_blue_shift() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_blue_shift());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void PixelFormat::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const PixelFormat*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const PixelFormat*>(
+      &from));
 }
 
 void PixelFormat::MergeFrom(const PixelFormat& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.PixelFormat)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  PixelFormat* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.PixelFormat)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.bits_per_pixel() != 0) {
-    set_bits_per_pixel(from.bits_per_pixel());
+  if (from._internal_bits_per_pixel() != 0) {
+    _this->_internal_set_bits_per_pixel(from._internal_bits_per_pixel());
   }
-  if (from.red_max() != 0) {
-    set_red_max(from.red_max());
+  if (from._internal_red_max() != 0) {
+    _this->_internal_set_red_max(from._internal_red_max());
   }
-  if (from.green_max() != 0) {
-    set_green_max(from.green_max());
+  if (from._internal_green_max() != 0) {
+    _this->_internal_set_green_max(from._internal_green_max());
   }
-  if (from.blue_max() != 0) {
-    set_blue_max(from.blue_max());
+  if (from._internal_blue_max() != 0) {
+    _this->_internal_set_blue_max(from._internal_blue_max());
   }
-  if (from.red_shift() != 0) {
-    set_red_shift(from.red_shift());
+  if (from._internal_red_shift() != 0) {
+    _this->_internal_set_red_shift(from._internal_red_shift());
   }
-  if (from.green_shift() != 0) {
-    set_green_shift(from.green_shift());
+  if (from._internal_green_shift() != 0) {
+    _this->_internal_set_green_shift(from._internal_green_shift());
   }
-  if (from.blue_shift() != 0) {
-    set_blue_shift(from.blue_shift());
+  if (from._internal_blue_shift() != 0) {
+    _this->_internal_set_blue_shift(from._internal_blue_shift());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void PixelFormat::CopyFrom(const PixelFormat& from) {
@@ -2087,216 +3100,206 @@ bool PixelFormat::IsInitialized() const {
   return true;
 }
 
-void PixelFormat::Swap(PixelFormat* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void PixelFormat::InternalSwap(PixelFormat* other) {
   using std::swap;
-  swap(bits_per_pixel_, other->bits_per_pixel_);
-  swap(red_max_, other->red_max_);
-  swap(green_max_, other->green_max_);
-  swap(blue_max_, other->blue_max_);
-  swap(red_shift_, other->red_shift_);
-  swap(green_shift_, other->green_shift_);
-  swap(blue_shift_, other->blue_shift_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PixelFormat, _impl_.blue_shift_)
+      + sizeof(PixelFormat::_impl_.blue_shift_)
+      - PROTOBUF_FIELD_OFFSET(PixelFormat, _impl_.bits_per_pixel_)>(
+          reinterpret_cast<char*>(&_impl_.bits_per_pixel_),
+          reinterpret_cast<char*>(&other->_impl_.bits_per_pixel_));
 }
 
-::std::string PixelFormat::GetTypeName() const {
+std::string PixelFormat::GetTypeName() const {
   return "aspia.proto.desktop.PixelFormat";
 }
 
 
 // ===================================================================
 
-void Size::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Size::kWidthFieldNumber;
-const int Size::kHeightFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class Size::_Internal {
+ public:
+};
 
-Size::Size()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_desktop_5fsession_2eproto::scc_info_Size.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.desktop.Size)
+Size::Size(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.desktop.Size)
 }
 Size::Size(const Size& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&width_, &from.width_,
-    static_cast<size_t>(reinterpret_cast<char*>(&height_) -
-    reinterpret_cast<char*>(&width_)) + sizeof(height_));
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  Size* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.width_){}
+    , decltype(_impl_.height_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::memcpy(&_impl_.width_, &from._impl_.width_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.height_) -
+    reinterpret_cast<char*>(&_impl_.width_)) + sizeof(_impl_.height_));
   // @@protoc_insertion_point(copy_constructor:aspia.proto.desktop.Size)
 }
 
-void Size::SharedCtor() {
-  ::memset(&width_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&height_) -
-      reinterpret_cast<char*>(&width_)) + sizeof(height_));
+inline void Size::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.width_){0}
+    , decltype(_impl_.height_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 Size::~Size() {
   // @@protoc_insertion_point(destructor:aspia.proto.desktop.Size)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Size::SharedDtor() {
+inline void Size::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void Size::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const Size& Size::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_desktop_5fsession_2eproto::scc_info_Size.base);
-  return *internal_default_instance();
-}
-
 
 void Size::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.desktop.Size)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&width_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&height_) -
-      reinterpret_cast<char*>(&width_)) + sizeof(height_));
-  _internal_metadata_.Clear();
-}
-
-bool Size::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.desktop.Size)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // int32 width = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+  ::memset(&_impl_.width_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.height_) -
+      reinterpret_cast<char*>(&_impl_.width_)) + sizeof(_impl_.height_));
+  _internal_metadata_.Clear<std::string>();
+}
 
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &width_)));
-        } else {
+const char* Size::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 width = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.width_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // int32 height = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &height_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.height_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.desktop.Size)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.desktop.Size)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void Size::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.desktop.Size)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* Size::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.desktop.Size)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // int32 width = 1;
-  if (this->width() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->width(), output);
+  if (this->_internal_width() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_width(), target);
   }
 
   // int32 height = 2;
-  if (this->height() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->height(), output);
+  if (this->_internal_height() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_height(), target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.desktop.Size)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.desktop.Size)
+  return target;
 }
 
 size_t Size::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.desktop.Size)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // int32 width = 1;
-  if (this->width() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->width());
+  if (this->_internal_width() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_width());
   }
 
   // int32 height = 2;
-  if (this->height() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->height());
+  if (this->_internal_height() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_height());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void Size::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const Size*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const Size*>(
+      &from));
 }
 
 void Size::MergeFrom(const Size& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.Size)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  Size* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.Size)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.width() != 0) {
-    set_width(from.width());
+  if (from._internal_width() != 0) {
+    _this->_internal_set_width(from._internal_width());
   }
-  if (from.height() != 0) {
-    set_height(from.height());
+  if (from._internal_height() != 0) {
+    _this->_internal_set_height(from._internal_height());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void Size::CopyFrom(const Size& from) {
@@ -2310,227 +3313,260 @@ bool Size::IsInitialized() const {
   return true;
 }
 
-void Size::Swap(Size* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void Size::InternalSwap(Size* other) {
   using std::swap;
-  swap(width_, other->width_);
-  swap(height_, other->height_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Size, _impl_.height_)
+      + sizeof(Size::_impl_.height_)
+      - PROTOBUF_FIELD_OFFSET(Size, _impl_.width_)>(
+          reinterpret_cast<char*>(&_impl_.width_),
+          reinterpret_cast<char*>(&other->_impl_.width_));
 }
 
-::std::string Size::GetTypeName() const {
+std::string Size::GetTypeName() const {
   return "aspia.proto.desktop.Size";
 }
 
 
 // ===================================================================
 
-void VideoPacketFormat::InitAsDefaultInstance() {
-  ::aspia::proto::desktop::_VideoPacketFormat_default_instance_._instance.get_mutable()->screen_size_ = const_cast< ::aspia::proto::desktop::Size*>(
-      ::aspia::proto::desktop::Size::internal_default_instance());
-  ::aspia::proto::desktop::_VideoPacketFormat_default_instance_._instance.get_mutable()->pixel_format_ = const_cast< ::aspia::proto::desktop::PixelFormat*>(
-      ::aspia::proto::desktop::PixelFormat::internal_default_instance());
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int VideoPacketFormat::kScreenSizeFieldNumber;
-const int VideoPacketFormat::kPixelFormatFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class VideoPacketFormat::_Internal {
+ public:
+  static const ::aspia::proto::desktop::Size& screen_size(const VideoPacketFormat* msg);
+  static const ::aspia::proto::desktop::PixelFormat& pixel_format(const VideoPacketFormat* msg);
+};
 
-VideoPacketFormat::VideoPacketFormat()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_desktop_5fsession_2eproto::scc_info_VideoPacketFormat.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.desktop.VideoPacketFormat)
+const ::aspia::proto::desktop::Size&
+VideoPacketFormat::_Internal::screen_size(const VideoPacketFormat* msg) {
+  return *msg->_impl_.screen_size_;
+}
+const ::aspia::proto::desktop::PixelFormat&
+VideoPacketFormat::_Internal::pixel_format(const VideoPacketFormat* msg) {
+  return *msg->_impl_.pixel_format_;
+}
+VideoPacketFormat::VideoPacketFormat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.desktop.VideoPacketFormat)
 }
 VideoPacketFormat::VideoPacketFormat(const VideoPacketFormat& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.has_screen_size()) {
-    screen_size_ = new ::aspia::proto::desktop::Size(*from.screen_size_);
-  } else {
-    screen_size_ = NULL;
-  }
-  if (from.has_pixel_format()) {
-    pixel_format_ = new ::aspia::proto::desktop::PixelFormat(*from.pixel_format_);
-  } else {
-    pixel_format_ = NULL;
-  }
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  VideoPacketFormat* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.screen_size_){nullptr}
+    , decltype(_impl_.pixel_format_){nullptr}
+    , decltype(_impl_.tile_cache_size_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  if (from._internal_has_screen_size()) {
+    _this->_impl_.screen_size_ = new ::aspia::proto::desktop::Size(*from._impl_.screen_size_);
+  }
+  if (from._internal_has_pixel_format()) {
+    _this->_impl_.pixel_format_ = new ::aspia::proto::desktop::PixelFormat(*from._impl_.pixel_format_);
+  }
+  _this->_impl_.tile_cache_size_ = from._impl_.tile_cache_size_;
   // @@protoc_insertion_point(copy_constructor:aspia.proto.desktop.VideoPacketFormat)
 }
 
-void VideoPacketFormat::SharedCtor() {
-  ::memset(&screen_size_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&pixel_format_) -
-      reinterpret_cast<char*>(&screen_size_)) + sizeof(pixel_format_));
+inline void VideoPacketFormat::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.screen_size_){nullptr}
+    , decltype(_impl_.pixel_format_){nullptr}
+    , decltype(_impl_.tile_cache_size_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 VideoPacketFormat::~VideoPacketFormat() {
   // @@protoc_insertion_point(destructor:aspia.proto.desktop.VideoPacketFormat)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void VideoPacketFormat::SharedDtor() {
-  if (this != internal_default_instance()) delete screen_size_;
-  if (this != internal_default_instance()) delete pixel_format_;
+inline void VideoPacketFormat::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.screen_size_;
+  if (this != internal_default_instance()) delete _impl_.pixel_format_;
 }
 
 void VideoPacketFormat::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const VideoPacketFormat& VideoPacketFormat::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_desktop_5fsession_2eproto::scc_info_VideoPacketFormat.base);
-  return *internal_default_instance();
-}
-
 
 void VideoPacketFormat::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.desktop.VideoPacketFormat)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaNoVirtual() == NULL && screen_size_ != NULL) {
-    delete screen_size_;
-  }
-  screen_size_ = NULL;
-  if (GetArenaNoVirtual() == NULL && pixel_format_ != NULL) {
-    delete pixel_format_;
-  }
-  pixel_format_ = NULL;
-  _internal_metadata_.Clear();
-}
-
-bool VideoPacketFormat::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.desktop.VideoPacketFormat)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  if (GetArenaForAllocation() == nullptr && _impl_.screen_size_ != nullptr) {
+    delete _impl_.screen_size_;
+  }
+  _impl_.screen_size_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.pixel_format_ != nullptr) {
+    delete _impl_.pixel_format_;
+  }
+  _impl_.pixel_format_ = nullptr;
+  _impl_.tile_cache_size_ = 0u;
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* VideoPacketFormat::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // .aspia.proto.desktop.Size screen_size = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_screen_size()));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_screen_size(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .aspia.proto.desktop.PixelFormat pixel_format = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_pixel_format()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_pixel_format(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 tile_cache_size = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.tile_cache_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.desktop.VideoPacketFormat)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.desktop.VideoPacketFormat)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void VideoPacketFormat::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.desktop.VideoPacketFormat)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* VideoPacketFormat::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.desktop.VideoPacketFormat)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .aspia.proto.desktop.Size screen_size = 1;
-  if (this->has_screen_size()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      1, this->_internal_screen_size(), output);
+  if (this->_internal_has_screen_size()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::screen_size(this),
+        _Internal::screen_size(this).GetCachedSize(), target, stream);
   }
 
   // .aspia.proto.desktop.PixelFormat pixel_format = 2;
-  if (this->has_pixel_format()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      2, this->_internal_pixel_format(), output);
+  if (this->_internal_has_pixel_format()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::pixel_format(this),
+        _Internal::pixel_format(this).GetCachedSize(), target, stream);
+  }
+
+  // uint32 tile_cache_size = 3;
+  if (this->_internal_tile_cache_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_tile_cache_size(), target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.desktop.VideoPacketFormat)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.desktop.VideoPacketFormat)
+  return target;
 }
 
 size_t VideoPacketFormat::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.desktop.VideoPacketFormat)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // .aspia.proto.desktop.Size screen_size = 1;
-  if (this->has_screen_size()) {
+  if (this->_internal_has_screen_size()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *screen_size_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.screen_size_);
   }
 
   // .aspia.proto.desktop.PixelFormat pixel_format = 2;
-  if (this->has_pixel_format()) {
+  if (this->_internal_has_pixel_format()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *pixel_format_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.pixel_format_);
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  // uint32 tile_cache_size = 3;
+  if (this->_internal_tile_cache_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_tile_cache_size());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void VideoPacketFormat::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const VideoPacketFormat*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const VideoPacketFormat*>(
+      &from));
 }
 
 void VideoPacketFormat::MergeFrom(const VideoPacketFormat& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.VideoPacketFormat)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  VideoPacketFormat* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.VideoPacketFormat)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.has_screen_size()) {
-    mutable_screen_size()->::aspia::proto::desktop::Size::MergeFrom(from.screen_size());
+  if (from._internal_has_screen_size()) {
+    _this->_internal_mutable_screen_size()->::aspia::proto::desktop::Size::MergeFrom(
+        from._internal_screen_size());
+  }
+  if (from._internal_has_pixel_format()) {
+    _this->_internal_mutable_pixel_format()->::aspia::proto::desktop::PixelFormat::MergeFrom(
+        from._internal_pixel_format());
   }
-  if (from.has_pixel_format()) {
-    mutable_pixel_format()->::aspia::proto::desktop::PixelFormat::MergeFrom(from.pixel_format());
+  if (from._internal_tile_cache_size() != 0) {
+    _this->_internal_set_tile_cache_size(from._internal_tile_cache_size());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void VideoPacketFormat::CopyFrom(const VideoPacketFormat& from) {
@@ -2544,292 +3580,910 @@ bool VideoPacketFormat::IsInitialized() const {
   return true;
 }
 
-void VideoPacketFormat::Swap(VideoPacketFormat* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void VideoPacketFormat::InternalSwap(VideoPacketFormat* other) {
   using std::swap;
-  swap(screen_size_, other->screen_size_);
-  swap(pixel_format_, other->pixel_format_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(VideoPacketFormat, _impl_.tile_cache_size_)
+      + sizeof(VideoPacketFormat::_impl_.tile_cache_size_)
+      - PROTOBUF_FIELD_OFFSET(VideoPacketFormat, _impl_.screen_size_)>(
+          reinterpret_cast<char*>(&_impl_.screen_size_),
+          reinterpret_cast<char*>(&other->_impl_.screen_size_));
 }
 
-::std::string VideoPacketFormat::GetTypeName() const {
+std::string VideoPacketFormat::GetTypeName() const {
   return "aspia.proto.desktop.VideoPacketFormat";
 }
 
 
 // ===================================================================
 
-void VideoPacket::InitAsDefaultInstance() {
-  ::aspia::proto::desktop::_VideoPacket_default_instance_._instance.get_mutable()->format_ = const_cast< ::aspia::proto::desktop::VideoPacketFormat*>(
-      ::aspia::proto::desktop::VideoPacketFormat::internal_default_instance());
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int VideoPacket::kEncodingFieldNumber;
-const int VideoPacket::kFormatFieldNumber;
-const int VideoPacket::kDirtyRectFieldNumber;
-const int VideoPacket::kDataFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-VideoPacket::VideoPacket()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_desktop_5fsession_2eproto::scc_info_VideoPacket.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.desktop.VideoPacket)
-}
-VideoPacket::VideoPacket(const VideoPacket& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL),
-      dirty_rect_(from.dirty_rect_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.data().size() > 0) {
-    data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.data_);
-  }
-  if (from.has_format()) {
-    format_ = new ::aspia::proto::desktop::VideoPacketFormat(*from.format_);
-  } else {
-    format_ = NULL;
-  }
-  encoding_ = from.encoding_;
-  // @@protoc_insertion_point(copy_constructor:aspia.proto.desktop.VideoPacket)
-}
-
-void VideoPacket::SharedCtor() {
-  data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&format_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&encoding_) -
-      reinterpret_cast<char*>(&format_)) + sizeof(encoding_));
-}
-
-VideoPacket::~VideoPacket() {
-  // @@protoc_insertion_point(destructor:aspia.proto.desktop.VideoPacket)
+class CopyRect::_Internal {
+ public:
+  static const ::aspia::proto::desktop::Rect& target_rect(const CopyRect* msg);
+};
+
+const ::aspia::proto::desktop::Rect&
+CopyRect::_Internal::target_rect(const CopyRect* msg) {
+  return *msg->_impl_.target_rect_;
+}
+CopyRect::CopyRect(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.desktop.CopyRect)
+}
+CopyRect::CopyRect(const CopyRect& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  CopyRect* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.target_rect_){nullptr}
+    , decltype(_impl_.source_x_){}
+    , decltype(_impl_.source_y_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  if (from._internal_has_target_rect()) {
+    _this->_impl_.target_rect_ = new ::aspia::proto::desktop::Rect(*from._impl_.target_rect_);
+  }
+  ::memcpy(&_impl_.source_x_, &from._impl_.source_x_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.source_y_) -
+    reinterpret_cast<char*>(&_impl_.source_x_)) + sizeof(_impl_.source_y_));
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.desktop.CopyRect)
+}
+
+inline void CopyRect::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.target_rect_){nullptr}
+    , decltype(_impl_.source_x_){0}
+    , decltype(_impl_.source_y_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+CopyRect::~CopyRect() {
+  // @@protoc_insertion_point(destructor:aspia.proto.desktop.CopyRect)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void VideoPacket::SharedDtor() {
-  data_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete format_;
+inline void CopyRect::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.target_rect_;
 }
 
-void VideoPacket::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const VideoPacket& VideoPacket::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_desktop_5fsession_2eproto::scc_info_VideoPacket.base);
-  return *internal_default_instance();
+void CopyRect::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void VideoPacket::Clear() {
-// @@protoc_insertion_point(message_clear_start:aspia.proto.desktop.VideoPacket)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+void CopyRect::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.desktop.CopyRect)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  dirty_rect_.Clear();
-  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (GetArenaNoVirtual() == NULL && format_ != NULL) {
-    delete format_;
-  }
-  format_ = NULL;
-  encoding_ = 0;
-  _internal_metadata_.Clear();
-}
-
-bool VideoPacket::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.desktop.VideoPacket)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // .aspia.proto.desktop.VideoEncoding encoding = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_encoding(static_cast< ::aspia::proto::desktop::VideoEncoding >(value));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // .aspia.proto.desktop.VideoPacketFormat format = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_format()));
-        } else {
+  if (GetArenaForAllocation() == nullptr && _impl_.target_rect_ != nullptr) {
+    delete _impl_.target_rect_;
+  }
+  _impl_.target_rect_ = nullptr;
+  ::memset(&_impl_.source_x_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.source_y_) -
+      reinterpret_cast<char*>(&_impl_.source_x_)) + sizeof(_impl_.source_y_));
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* CopyRect::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 source_x = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.source_x_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      // repeated .aspia.proto.desktop.Rect dirty_rect = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-                input, add_dirty_rect()));
-        } else {
+        continue;
+      // int32 source_y = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.source_y_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      // bytes data = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_data()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+        continue;
+      // .aspia.proto.desktop.Rect target_rect = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_target_rect(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.desktop.VideoPacket)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.desktop.VideoPacket)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void VideoPacket::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.desktop.VideoPacket)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* CopyRect::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.desktop.CopyRect)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .aspia.proto.desktop.VideoEncoding encoding = 1;
-  if (this->encoding() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->encoding(), output);
+  // int32 source_x = 1;
+  if (this->_internal_source_x() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_source_x(), target);
   }
 
-  // .aspia.proto.desktop.VideoPacketFormat format = 2;
-  if (this->has_format()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      2, this->_internal_format(), output);
+  // int32 source_y = 2;
+  if (this->_internal_source_y() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_source_y(), target);
   }
 
-  // repeated .aspia.proto.desktop.Rect dirty_rect = 3;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->dirty_rect_size()); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      3,
-      this->dirty_rect(static_cast<int>(i)),
-      output);
+  // .aspia.proto.desktop.Rect target_rect = 3;
+  if (this->_internal_has_target_rect()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::target_rect(this),
+        _Internal::target_rect(this).GetCachedSize(), target, stream);
   }
 
-  // bytes data = 4;
-  if (this->data().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      4, this->data(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
   }
-
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.desktop.VideoPacket)
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.desktop.CopyRect)
+  return target;
 }
 
-size_t VideoPacket::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:aspia.proto.desktop.VideoPacket)
+size_t CopyRect::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.desktop.CopyRect)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
-
-  // repeated .aspia.proto.desktop.Rect dirty_rect = 3;
-  {
-    unsigned int count = static_cast<unsigned int>(this->dirty_rect_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          this->dirty_rect(static_cast<int>(i)));
-    }
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  // bytes data = 4;
-  if (this->data().size() > 0) {
+  // .aspia.proto.desktop.Rect target_rect = 3;
+  if (this->_internal_has_target_rect()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->data());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.target_rect_);
   }
 
-  // .aspia.proto.desktop.VideoPacketFormat format = 2;
-  if (this->has_format()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *format_);
+  // int32 source_x = 1;
+  if (this->_internal_source_x() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_source_x());
   }
 
-  // .aspia.proto.desktop.VideoEncoding encoding = 1;
-  if (this->encoding() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->encoding());
+  // int32 source_y = 2;
+  if (this->_internal_source_y() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_source_y());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
-void VideoPacket::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const VideoPacket*>(&from));
+void CopyRect::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const CopyRect*>(
+      &from));
 }
 
-void VideoPacket::MergeFrom(const VideoPacket& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.VideoPacket)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+void CopyRect::MergeFrom(const CopyRect& from) {
+  CopyRect* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.CopyRect)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  dirty_rect_.MergeFrom(from.dirty_rect_);
-  if (from.data().size() > 0) {
-
-    data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.data_);
+  if (from._internal_has_target_rect()) {
+    _this->_internal_mutable_target_rect()->::aspia::proto::desktop::Rect::MergeFrom(
+        from._internal_target_rect());
   }
-  if (from.has_format()) {
-    mutable_format()->::aspia::proto::desktop::VideoPacketFormat::MergeFrom(from.format());
+  if (from._internal_source_x() != 0) {
+    _this->_internal_set_source_x(from._internal_source_x());
   }
-  if (from.encoding() != 0) {
-    set_encoding(from.encoding());
+  if (from._internal_source_y() != 0) {
+    _this->_internal_set_source_y(from._internal_source_y());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void CopyRect::CopyFrom(const CopyRect& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.desktop.CopyRect)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CopyRect::IsInitialized() const {
+  return true;
+}
+
+void CopyRect::InternalSwap(CopyRect* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CopyRect, _impl_.source_y_)
+      + sizeof(CopyRect::_impl_.source_y_)
+      - PROTOBUF_FIELD_OFFSET(CopyRect, _impl_.target_rect_)>(
+          reinterpret_cast<char*>(&_impl_.target_rect_),
+          reinterpret_cast<char*>(&other->_impl_.target_rect_));
+}
+
+std::string CopyRect::GetTypeName() const {
+  return "aspia.proto.desktop.CopyRect";
+}
+
+
+// ===================================================================
+
+class VideoPacket::_Internal {
+ public:
+  static const ::aspia::proto::desktop::VideoPacketFormat& format(const VideoPacket* msg);
+};
+
+const ::aspia::proto::desktop::VideoPacketFormat&
+VideoPacket::_Internal::format(const VideoPacket* msg) {
+  return *msg->_impl_.format_;
+}
+VideoPacket::VideoPacket(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.desktop.VideoPacket)
+}
+VideoPacket::VideoPacket(const VideoPacket& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  VideoPacket* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.dirty_rect_){from._impl_.dirty_rect_}
+    , decltype(_impl_.copy_rect_){from._impl_.copy_rect_}
+    , decltype(_impl_.chunk_){from._impl_.chunk_}
+    , decltype(_impl_.layer_){from._impl_.layer_}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.packed_dirty_rect_){}
+    , decltype(_impl_.format_){nullptr}
+    , decltype(_impl_.encoding_){}
+    , decltype(_impl_.frame_id_){}
+    , decltype(_impl_.persistent_stream_){}
+    , decltype(_impl_.temporal_layer_){}
+    , decltype(_impl_.capture_time_){}
+    , decltype(_impl_.trace_id_){}
+    , decltype(_impl_.encode_time_){}
+    , decltype(_impl_.psnr_){}
+    , decltype(_impl_.ssim_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_data().empty()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.packed_dirty_rect_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.packed_dirty_rect_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_packed_dirty_rect().empty()) {
+    _this->_impl_.packed_dirty_rect_.Set(from._internal_packed_dirty_rect(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_format()) {
+    _this->_impl_.format_ = new ::aspia::proto::desktop::VideoPacketFormat(*from._impl_.format_);
+  }
+  ::memcpy(&_impl_.encoding_, &from._impl_.encoding_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.ssim_) -
+    reinterpret_cast<char*>(&_impl_.encoding_)) + sizeof(_impl_.ssim_));
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.desktop.VideoPacket)
+}
+
+inline void VideoPacket::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.dirty_rect_){arena}
+    , decltype(_impl_.copy_rect_){arena}
+    , decltype(_impl_.chunk_){arena}
+    , decltype(_impl_.layer_){arena}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.packed_dirty_rect_){}
+    , decltype(_impl_.format_){nullptr}
+    , decltype(_impl_.encoding_){0}
+    , decltype(_impl_.frame_id_){0u}
+    , decltype(_impl_.persistent_stream_){false}
+    , decltype(_impl_.temporal_layer_){0u}
+    , decltype(_impl_.capture_time_){int64_t{0}}
+    , decltype(_impl_.trace_id_){0u}
+    , decltype(_impl_.encode_time_){0u}
+    , decltype(_impl_.psnr_){0}
+    , decltype(_impl_.ssim_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.packed_dirty_rect_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.packed_dirty_rect_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+VideoPacket::~VideoPacket() {
+  // @@protoc_insertion_point(destructor:aspia.proto.desktop.VideoPacket)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void VideoPacket::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.dirty_rect_.~RepeatedPtrField();
+  _impl_.copy_rect_.~RepeatedPtrField();
+  _impl_.chunk_.~RepeatedPtrField();
+  _impl_.layer_.~RepeatedPtrField();
+  _impl_.data_.Destroy();
+  _impl_.packed_dirty_rect_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.format_;
+}
+
+void VideoPacket::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void VideoPacket::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.desktop.VideoPacket)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.dirty_rect_.Clear();
+  _impl_.copy_rect_.Clear();
+  _impl_.chunk_.Clear();
+  _impl_.layer_.Clear();
+  _impl_.data_.ClearToEmpty();
+  _impl_.packed_dirty_rect_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.format_ != nullptr) {
+    delete _impl_.format_;
+  }
+  _impl_.format_ = nullptr;
+  ::memset(&_impl_.encoding_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.ssim_) -
+      reinterpret_cast<char*>(&_impl_.encoding_)) + sizeof(_impl_.ssim_));
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* VideoPacket::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .aspia.proto.desktop.VideoEncoding encoding = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_encoding(static_cast<::aspia::proto::desktop::VideoEncoding>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .aspia.proto.desktop.VideoPacketFormat format = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_format(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .aspia.proto.desktop.Rect dirty_rect = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_dirty_rect(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes data = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .aspia.proto.desktop.CopyRect copy_rect = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_copy_rect(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 frame_id = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.frame_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated bytes chunk = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_chunk();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<58>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool persistent_stream = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.persistent_stream_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .aspia.proto.desktop.VideoPacket layer = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_layer(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<74>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 temporal_layer = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.temporal_layer_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 trace_id = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _impl_.trace_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 capture_time = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _impl_.capture_time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 encode_time = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _impl_.encode_time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes packed_dirty_rect = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
+          auto str = _internal_mutable_packed_dirty_rect();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // float psnr = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 125)) {
+          _impl_.psnr_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float ssim = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 133)) {
+          _impl_.ssim_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* VideoPacket::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.desktop.VideoPacket)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .aspia.proto.desktop.VideoEncoding encoding = 1;
+  if (this->_internal_encoding() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_encoding(), target);
+  }
+
+  // .aspia.proto.desktop.VideoPacketFormat format = 2;
+  if (this->_internal_has_format()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::format(this),
+        _Internal::format(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .aspia.proto.desktop.Rect dirty_rect = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_dirty_rect_size()); i < n; i++) {
+    const auto& repfield = this->_internal_dirty_rect(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // bytes data = 4;
+  if (!this->_internal_data().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_data(), target);
+  }
+
+  // repeated .aspia.proto.desktop.CopyRect copy_rect = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_copy_rect_size()); i < n; i++) {
+    const auto& repfield = this->_internal_copy_rect(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // uint32 frame_id = 6;
+  if (this->_internal_frame_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_frame_id(), target);
+  }
+
+  // repeated bytes chunk = 7;
+  for (int i = 0, n = this->_internal_chunk_size(); i < n; i++) {
+    const auto& s = this->_internal_chunk(i);
+    target = stream->WriteBytes(7, s, target);
+  }
+
+  // bool persistent_stream = 8;
+  if (this->_internal_persistent_stream() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(8, this->_internal_persistent_stream(), target);
+  }
+
+  // repeated .aspia.proto.desktop.VideoPacket layer = 9;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_layer_size()); i < n; i++) {
+    const auto& repfield = this->_internal_layer(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(9, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // uint32 temporal_layer = 10;
+  if (this->_internal_temporal_layer() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(10, this->_internal_temporal_layer(), target);
+  }
+
+  // uint32 trace_id = 11;
+  if (this->_internal_trace_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(11, this->_internal_trace_id(), target);
+  }
+
+  // int64 capture_time = 12;
+  if (this->_internal_capture_time() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(12, this->_internal_capture_time(), target);
+  }
+
+  // uint32 encode_time = 13;
+  if (this->_internal_encode_time() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(13, this->_internal_encode_time(), target);
+  }
+
+  // bytes packed_dirty_rect = 14;
+  if (!this->_internal_packed_dirty_rect().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        14, this->_internal_packed_dirty_rect(), target);
+  }
+
+  // float psnr = 15;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_psnr = this->_internal_psnr();
+  uint32_t raw_psnr;
+  memcpy(&raw_psnr, &tmp_psnr, sizeof(tmp_psnr));
+  if (raw_psnr != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(15, this->_internal_psnr(), target);
+  }
+
+  // float ssim = 16;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_ssim = this->_internal_ssim();
+  uint32_t raw_ssim;
+  memcpy(&raw_ssim, &tmp_ssim, sizeof(tmp_ssim));
+  if (raw_ssim != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(16, this->_internal_ssim(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.desktop.VideoPacket)
+  return target;
+}
+
+size_t VideoPacket::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.desktop.VideoPacket)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .aspia.proto.desktop.Rect dirty_rect = 3;
+  total_size += 1UL * this->_internal_dirty_rect_size();
+  for (const auto& msg : this->_impl_.dirty_rect_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .aspia.proto.desktop.CopyRect copy_rect = 5;
+  total_size += 1UL * this->_internal_copy_rect_size();
+  for (const auto& msg : this->_impl_.copy_rect_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated bytes chunk = 7;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.chunk_.size());
+  for (int i = 0, n = _impl_.chunk_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.chunk_.Get(i));
+  }
+
+  // repeated .aspia.proto.desktop.VideoPacket layer = 9;
+  total_size += 1UL * this->_internal_layer_size();
+  for (const auto& msg : this->_impl_.layer_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // bytes data = 4;
+  if (!this->_internal_data().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
+  }
+
+  // bytes packed_dirty_rect = 14;
+  if (!this->_internal_packed_dirty_rect().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_packed_dirty_rect());
+  }
+
+  // .aspia.proto.desktop.VideoPacketFormat format = 2;
+  if (this->_internal_has_format()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.format_);
+  }
+
+  // .aspia.proto.desktop.VideoEncoding encoding = 1;
+  if (this->_internal_encoding() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_encoding());
+  }
+
+  // uint32 frame_id = 6;
+  if (this->_internal_frame_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_frame_id());
+  }
+
+  // bool persistent_stream = 8;
+  if (this->_internal_persistent_stream() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint32 temporal_layer = 10;
+  if (this->_internal_temporal_layer() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_temporal_layer());
+  }
+
+  // int64 capture_time = 12;
+  if (this->_internal_capture_time() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_capture_time());
+  }
+
+  // uint32 trace_id = 11;
+  if (this->_internal_trace_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_trace_id());
+  }
+
+  // uint32 encode_time = 13;
+  if (this->_internal_encode_time() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_encode_time());
+  }
+
+  // float psnr = 15;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_psnr = this->_internal_psnr();
+  uint32_t raw_psnr;
+  memcpy(&raw_psnr, &tmp_psnr, sizeof(tmp_psnr));
+  if (raw_psnr != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float ssim = 16;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_ssim = this->_internal_ssim();
+  uint32_t raw_ssim;
+  memcpy(&raw_ssim, &tmp_ssim, sizeof(tmp_ssim));
+  if (raw_ssim != 0) {
+    total_size += 2 + 4;
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void VideoPacket::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const VideoPacket*>(
+      &from));
+}
+
+void VideoPacket::MergeFrom(const VideoPacket& from) {
+  VideoPacket* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.VideoPacket)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.dirty_rect_.MergeFrom(from._impl_.dirty_rect_);
+  _this->_impl_.copy_rect_.MergeFrom(from._impl_.copy_rect_);
+  _this->_impl_.chunk_.MergeFrom(from._impl_.chunk_);
+  _this->_impl_.layer_.MergeFrom(from._impl_.layer_);
+  if (!from._internal_data().empty()) {
+    _this->_internal_set_data(from._internal_data());
+  }
+  if (!from._internal_packed_dirty_rect().empty()) {
+    _this->_internal_set_packed_dirty_rect(from._internal_packed_dirty_rect());
+  }
+  if (from._internal_has_format()) {
+    _this->_internal_mutable_format()->::aspia::proto::desktop::VideoPacketFormat::MergeFrom(
+        from._internal_format());
+  }
+  if (from._internal_encoding() != 0) {
+    _this->_internal_set_encoding(from._internal_encoding());
+  }
+  if (from._internal_frame_id() != 0) {
+    _this->_internal_set_frame_id(from._internal_frame_id());
+  }
+  if (from._internal_persistent_stream() != 0) {
+    _this->_internal_set_persistent_stream(from._internal_persistent_stream());
+  }
+  if (from._internal_temporal_layer() != 0) {
+    _this->_internal_set_temporal_layer(from._internal_temporal_layer());
+  }
+  if (from._internal_capture_time() != 0) {
+    _this->_internal_set_capture_time(from._internal_capture_time());
+  }
+  if (from._internal_trace_id() != 0) {
+    _this->_internal_set_trace_id(from._internal_trace_id());
+  }
+  if (from._internal_encode_time() != 0) {
+    _this->_internal_set_encode_time(from._internal_encode_time());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_psnr = from._internal_psnr();
+  uint32_t raw_psnr;
+  memcpy(&raw_psnr, &tmp_psnr, sizeof(tmp_psnr));
+  if (raw_psnr != 0) {
+    _this->_internal_set_psnr(from._internal_psnr());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_ssim = from._internal_ssim();
+  uint32_t raw_ssim;
+  memcpy(&raw_ssim, &tmp_ssim, sizeof(tmp_ssim));
+  if (raw_ssim != 0) {
+    _this->_internal_set_ssim(from._internal_ssim());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void VideoPacket::CopyFrom(const VideoPacket& from) {
@@ -2843,1171 +4497,4232 @@ bool VideoPacket::IsInitialized() const {
   return true;
 }
 
-void VideoPacket::Swap(VideoPacket* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void VideoPacket::InternalSwap(VideoPacket* other) {
   using std::swap;
-  CastToBase(&dirty_rect_)->InternalSwap(CastToBase(&other->dirty_rect_));
-  data_.Swap(&other->data_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(format_, other->format_);
-  swap(encoding_, other->encoding_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-}
-
-::std::string VideoPacket::GetTypeName() const {
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.dirty_rect_.InternalSwap(&other->_impl_.dirty_rect_);
+  _impl_.copy_rect_.InternalSwap(&other->_impl_.copy_rect_);
+  _impl_.chunk_.InternalSwap(&other->_impl_.chunk_);
+  _impl_.layer_.InternalSwap(&other->_impl_.layer_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.packed_dirty_rect_, lhs_arena,
+      &other->_impl_.packed_dirty_rect_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(VideoPacket, _impl_.ssim_)
+      + sizeof(VideoPacket::_impl_.ssim_)
+      - PROTOBUF_FIELD_OFFSET(VideoPacket, _impl_.format_)>(
+          reinterpret_cast<char*>(&_impl_.format_),
+          reinterpret_cast<char*>(&other->_impl_.format_));
+}
+
+std::string VideoPacket::GetTypeName() const {
   return "aspia.proto.desktop.VideoPacket";
 }
 
 
 // ===================================================================
 
-void ConfigRequest::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int ConfigRequest::kVideoEncodingsFieldNumber;
-const int ConfigRequest::kFeaturesFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class ConfigRequest::_Internal {
+ public:
+};
 
-ConfigRequest::ConfigRequest()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_desktop_5fsession_2eproto::scc_info_ConfigRequest.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.desktop.ConfigRequest)
+ConfigRequest::ConfigRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.desktop.ConfigRequest)
 }
 ConfigRequest::ConfigRequest(const ConfigRequest& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&video_encodings_, &from.video_encodings_,
-    static_cast<size_t>(reinterpret_cast<char*>(&features_) -
-    reinterpret_cast<char*>(&video_encodings_)) + sizeof(features_));
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  ConfigRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.video_encodings_){}
+    , decltype(_impl_.features_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::memcpy(&_impl_.video_encodings_, &from._impl_.video_encodings_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.features_) -
+    reinterpret_cast<char*>(&_impl_.video_encodings_)) + sizeof(_impl_.features_));
   // @@protoc_insertion_point(copy_constructor:aspia.proto.desktop.ConfigRequest)
 }
 
-void ConfigRequest::SharedCtor() {
-  ::memset(&video_encodings_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&features_) -
-      reinterpret_cast<char*>(&video_encodings_)) + sizeof(features_));
+inline void ConfigRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.video_encodings_){0u}
+    , decltype(_impl_.features_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 ConfigRequest::~ConfigRequest() {
   // @@protoc_insertion_point(destructor:aspia.proto.desktop.ConfigRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void ConfigRequest::SharedDtor() {
+inline void ConfigRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void ConfigRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ConfigRequest& ConfigRequest::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_desktop_5fsession_2eproto::scc_info_ConfigRequest.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void ConfigRequest::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.desktop.ConfigRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&video_encodings_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&features_) -
-      reinterpret_cast<char*>(&video_encodings_)) + sizeof(features_));
-  _internal_metadata_.Clear();
-}
-
-bool ConfigRequest::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.desktop.ConfigRequest)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // uint32 video_encodings = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+  ::memset(&_impl_.video_encodings_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.features_) -
+      reinterpret_cast<char*>(&_impl_.video_encodings_)) + sizeof(_impl_.features_));
+  _internal_metadata_.Clear<std::string>();
+}
 
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &video_encodings_)));
-        } else {
+const char* ConfigRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 video_encodings = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.video_encodings_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint32 features = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &features_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.features_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.desktop.ConfigRequest)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.desktop.ConfigRequest)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void ConfigRequest::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.desktop.ConfigRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* ConfigRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.desktop.ConfigRequest)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // uint32 video_encodings = 1;
-  if (this->video_encodings() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->video_encodings(), output);
+  if (this->_internal_video_encodings() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_video_encodings(), target);
   }
 
   // uint32 features = 2;
-  if (this->features() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->features(), output);
+  if (this->_internal_features() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_features(), target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.desktop.ConfigRequest)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.desktop.ConfigRequest)
+  return target;
 }
 
 size_t ConfigRequest::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.desktop.ConfigRequest)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint32 video_encodings = 1;
+  if (this->_internal_video_encodings() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_video_encodings());
+  }
+
+  // uint32 features = 2;
+  if (this->_internal_features() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_features());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void ConfigRequest::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const ConfigRequest*>(
+      &from));
+}
+
+void ConfigRequest::MergeFrom(const ConfigRequest& from) {
+  ConfigRequest* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.ConfigRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_video_encodings() != 0) {
+    _this->_internal_set_video_encodings(from._internal_video_encodings());
+  }
+  if (from._internal_features() != 0) {
+    _this->_internal_set_features(from._internal_features());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void ConfigRequest::CopyFrom(const ConfigRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.desktop.ConfigRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ConfigRequest::IsInitialized() const {
+  return true;
+}
+
+void ConfigRequest::InternalSwap(ConfigRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ConfigRequest, _impl_.features_)
+      + sizeof(ConfigRequest::_impl_.features_)
+      - PROTOBUF_FIELD_OFFSET(ConfigRequest, _impl_.video_encodings_)>(
+          reinterpret_cast<char*>(&_impl_.video_encodings_),
+          reinterpret_cast<char*>(&other->_impl_.video_encodings_));
+}
+
+std::string ConfigRequest::GetTypeName() const {
+  return "aspia.proto.desktop.ConfigRequest";
+}
+
+
+// ===================================================================
+
+class FrameHashes::_Internal {
+ public:
+  static const ::aspia::proto::desktop::Size& screen_size(const FrameHashes* msg);
+};
+
+const ::aspia::proto::desktop::Size&
+FrameHashes::_Internal::screen_size(const FrameHashes* msg) {
+  return *msg->_impl_.screen_size_;
+}
+FrameHashes::FrameHashes(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.desktop.FrameHashes)
+}
+FrameHashes::FrameHashes(const FrameHashes& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  FrameHashes* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.hash_){from._impl_.hash_}
+    , decltype(_impl_.screen_size_){nullptr}
+    , decltype(_impl_.tile_size_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  if (from._internal_has_screen_size()) {
+    _this->_impl_.screen_size_ = new ::aspia::proto::desktop::Size(*from._impl_.screen_size_);
+  }
+  _this->_impl_.tile_size_ = from._impl_.tile_size_;
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.desktop.FrameHashes)
+}
+
+inline void FrameHashes::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.hash_){arena}
+    , decltype(_impl_.screen_size_){nullptr}
+    , decltype(_impl_.tile_size_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+FrameHashes::~FrameHashes() {
+  // @@protoc_insertion_point(destructor:aspia.proto.desktop.FrameHashes)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void FrameHashes::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.hash_.~RepeatedField();
+  if (this != internal_default_instance()) delete _impl_.screen_size_;
+}
+
+void FrameHashes::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FrameHashes::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.desktop.FrameHashes)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.hash_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.screen_size_ != nullptr) {
+    delete _impl_.screen_size_;
+  }
+  _impl_.screen_size_ = nullptr;
+  _impl_.tile_size_ = 0u;
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* FrameHashes::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .aspia.proto.desktop.Size screen_size = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_screen_size(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 tile_size = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.tile_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated fixed64 hash = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed64Parser(_internal_mutable_hash(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 25) {
+          _internal_add_hash(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr));
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* FrameHashes::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.desktop.FrameHashes)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .aspia.proto.desktop.Size screen_size = 1;
+  if (this->_internal_has_screen_size()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::screen_size(this),
+        _Internal::screen_size(this).GetCachedSize(), target, stream);
+  }
+
+  // uint32 tile_size = 2;
+  if (this->_internal_tile_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_tile_size(), target);
+  }
+
+  // repeated fixed64 hash = 3;
+  if (this->_internal_hash_size() > 0) {
+    target = stream->WriteFixedPacked(3, _internal_hash(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.desktop.FrameHashes)
+  return target;
+}
+
+size_t FrameHashes::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.desktop.FrameHashes)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated fixed64 hash = 3;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_hash_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // .aspia.proto.desktop.Size screen_size = 1;
+  if (this->_internal_has_screen_size()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.screen_size_);
+  }
+
+  // uint32 tile_size = 2;
+  if (this->_internal_tile_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_tile_size());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void FrameHashes::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const FrameHashes*>(
+      &from));
+}
+
+void FrameHashes::MergeFrom(const FrameHashes& from) {
+  FrameHashes* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.FrameHashes)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.hash_.MergeFrom(from._impl_.hash_);
+  if (from._internal_has_screen_size()) {
+    _this->_internal_mutable_screen_size()->::aspia::proto::desktop::Size::MergeFrom(
+        from._internal_screen_size());
+  }
+  if (from._internal_tile_size() != 0) {
+    _this->_internal_set_tile_size(from._internal_tile_size());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void FrameHashes::CopyFrom(const FrameHashes& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.desktop.FrameHashes)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FrameHashes::IsInitialized() const {
+  return true;
+}
+
+void FrameHashes::InternalSwap(FrameHashes* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.hash_.InternalSwap(&other->_impl_.hash_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(FrameHashes, _impl_.tile_size_)
+      + sizeof(FrameHashes::_impl_.tile_size_)
+      - PROTOBUF_FIELD_OFFSET(FrameHashes, _impl_.screen_size_)>(
+          reinterpret_cast<char*>(&_impl_.screen_size_),
+          reinterpret_cast<char*>(&other->_impl_.screen_size_));
+}
+
+std::string FrameHashes::GetTypeName() const {
+  return "aspia.proto.desktop.FrameHashes";
+}
+
+
+// ===================================================================
+
+class Config::_Internal {
+ public:
+  static const ::aspia::proto::desktop::PixelFormat& pixel_format(const Config* msg);
+  static const ::aspia::proto::desktop::Size& viewport(const Config* msg);
+  static const ::aspia::proto::desktop::FrameHashes& frame_hashes(const Config* msg);
+};
+
+const ::aspia::proto::desktop::PixelFormat&
+Config::_Internal::pixel_format(const Config* msg) {
+  return *msg->_impl_.pixel_format_;
+}
+const ::aspia::proto::desktop::Size&
+Config::_Internal::viewport(const Config* msg) {
+  return *msg->_impl_.viewport_;
+}
+const ::aspia::proto::desktop::FrameHashes&
+Config::_Internal::frame_hashes(const Config* msg) {
+  return *msg->_impl_.frame_hashes_;
+}
+Config::Config(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.desktop.Config)
+}
+Config::Config(const Config& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  Config* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.cursor_cache_){from._impl_.cursor_cache_}
+    , decltype(_impl_.pixel_format_){nullptr}
+    , decltype(_impl_.viewport_){nullptr}
+    , decltype(_impl_.frame_hashes_){nullptr}
+    , decltype(_impl_.features_){}
+    , decltype(_impl_.video_encoding_){}
+    , decltype(_impl_.update_interval_){}
+    , decltype(_impl_.compress_ratio_){}
+    , decltype(_impl_.encoder_threads_){}
+    , decltype(_impl_.encoder_tile_columns_){}
+    , decltype(_impl_.cursor_cache_next_){}
+    , decltype(_impl_.tile_cache_size_){}
+    , decltype(_impl_.bandwidth_limit_){}
+    , decltype(_impl_.auto_encoding_){}
+    , decltype(_impl_.initial_bandwidth_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  if (from._internal_has_pixel_format()) {
+    _this->_impl_.pixel_format_ = new ::aspia::proto::desktop::PixelFormat(*from._impl_.pixel_format_);
+  }
+  if (from._internal_has_viewport()) {
+    _this->_impl_.viewport_ = new ::aspia::proto::desktop::Size(*from._impl_.viewport_);
+  }
+  if (from._internal_has_frame_hashes()) {
+    _this->_impl_.frame_hashes_ = new ::aspia::proto::desktop::FrameHashes(*from._impl_.frame_hashes_);
+  }
+  ::memcpy(&_impl_.features_, &from._impl_.features_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.initial_bandwidth_) -
+    reinterpret_cast<char*>(&_impl_.features_)) + sizeof(_impl_.initial_bandwidth_));
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.desktop.Config)
+}
+
+inline void Config::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.cursor_cache_){arena}
+    , decltype(_impl_.pixel_format_){nullptr}
+    , decltype(_impl_.viewport_){nullptr}
+    , decltype(_impl_.frame_hashes_){nullptr}
+    , decltype(_impl_.features_){0u}
+    , decltype(_impl_.video_encoding_){0}
+    , decltype(_impl_.update_interval_){0u}
+    , decltype(_impl_.compress_ratio_){0u}
+    , decltype(_impl_.encoder_threads_){0u}
+    , decltype(_impl_.encoder_tile_columns_){0u}
+    , decltype(_impl_.cursor_cache_next_){0u}
+    , decltype(_impl_.tile_cache_size_){0u}
+    , decltype(_impl_.bandwidth_limit_){0u}
+    , decltype(_impl_.auto_encoding_){false}
+    , decltype(_impl_.initial_bandwidth_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Config::~Config() {
+  // @@protoc_insertion_point(destructor:aspia.proto.desktop.Config)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Config::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.cursor_cache_.~RepeatedField();
+  if (this != internal_default_instance()) delete _impl_.pixel_format_;
+  if (this != internal_default_instance()) delete _impl_.viewport_;
+  if (this != internal_default_instance()) delete _impl_.frame_hashes_;
+}
+
+void Config::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Config::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.desktop.Config)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.cursor_cache_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.pixel_format_ != nullptr) {
+    delete _impl_.pixel_format_;
+  }
+  _impl_.pixel_format_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.viewport_ != nullptr) {
+    delete _impl_.viewport_;
+  }
+  _impl_.viewport_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.frame_hashes_ != nullptr) {
+    delete _impl_.frame_hashes_;
+  }
+  _impl_.frame_hashes_ = nullptr;
+  ::memset(&_impl_.features_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.initial_bandwidth_) -
+      reinterpret_cast<char*>(&_impl_.features_)) + sizeof(_impl_.initial_bandwidth_));
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* Config::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 features = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.features_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .aspia.proto.desktop.VideoEncoding video_encoding = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_video_encoding(static_cast<::aspia::proto::desktop::VideoEncoding>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .aspia.proto.desktop.PixelFormat pixel_format = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_pixel_format(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 update_interval = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.update_interval_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 compress_ratio = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.compress_ratio_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 encoder_threads = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.encoder_threads_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 encoder_tile_columns = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.encoder_tile_columns_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated fixed64 cursor_cache = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed64Parser(_internal_mutable_cursor_cache(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 65) {
+          _internal_add_cursor_cache(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr));
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 cursor_cache_next = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.cursor_cache_next_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 tile_cache_size = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.tile_cache_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .aspia.proto.desktop.Size viewport = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_viewport(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 bandwidth_limit = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _impl_.bandwidth_limit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool auto_encoding = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _impl_.auto_encoding_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .aspia.proto.desktop.FrameHashes frame_hashes = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
+          ptr = ctx->ParseMessage(_internal_mutable_frame_hashes(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 initial_bandwidth = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _impl_.initial_bandwidth_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Config::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.desktop.Config)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 features = 1;
+  if (this->_internal_features() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_features(), target);
+  }
+
+  // .aspia.proto.desktop.VideoEncoding video_encoding = 2;
+  if (this->_internal_video_encoding() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_video_encoding(), target);
+  }
+
+  // .aspia.proto.desktop.PixelFormat pixel_format = 3;
+  if (this->_internal_has_pixel_format()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::pixel_format(this),
+        _Internal::pixel_format(this).GetCachedSize(), target, stream);
+  }
+
+  // uint32 update_interval = 4;
+  if (this->_internal_update_interval() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_update_interval(), target);
+  }
+
+  // uint32 compress_ratio = 5;
+  if (this->_internal_compress_ratio() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_compress_ratio(), target);
+  }
+
+  // uint32 encoder_threads = 6;
+  if (this->_internal_encoder_threads() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_encoder_threads(), target);
+  }
+
+  // uint32 encoder_tile_columns = 7;
+  if (this->_internal_encoder_tile_columns() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_encoder_tile_columns(), target);
+  }
+
+  // repeated fixed64 cursor_cache = 8;
+  if (this->_internal_cursor_cache_size() > 0) {
+    target = stream->WriteFixedPacked(8, _internal_cursor_cache(), target);
+  }
+
+  // uint32 cursor_cache_next = 9;
+  if (this->_internal_cursor_cache_next() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(9, this->_internal_cursor_cache_next(), target);
+  }
+
+  // uint32 tile_cache_size = 10;
+  if (this->_internal_tile_cache_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(10, this->_internal_tile_cache_size(), target);
+  }
+
+  // .aspia.proto.desktop.Size viewport = 11;
+  if (this->_internal_has_viewport()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::viewport(this),
+        _Internal::viewport(this).GetCachedSize(), target, stream);
+  }
+
+  // uint32 bandwidth_limit = 12;
+  if (this->_internal_bandwidth_limit() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(12, this->_internal_bandwidth_limit(), target);
+  }
+
+  // bool auto_encoding = 13;
+  if (this->_internal_auto_encoding() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(13, this->_internal_auto_encoding(), target);
+  }
+
+  // .aspia.proto.desktop.FrameHashes frame_hashes = 14;
+  if (this->_internal_has_frame_hashes()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(14, _Internal::frame_hashes(this),
+        _Internal::frame_hashes(this).GetCachedSize(), target, stream);
+  }
+
+  // uint32 initial_bandwidth = 15;
+  if (this->_internal_initial_bandwidth() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(15, this->_internal_initial_bandwidth(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.desktop.Config)
+  return target;
+}
+
+size_t Config::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.desktop.Config)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated fixed64 cursor_cache = 8;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_cursor_cache_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // .aspia.proto.desktop.PixelFormat pixel_format = 3;
+  if (this->_internal_has_pixel_format()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.pixel_format_);
+  }
+
+  // .aspia.proto.desktop.Size viewport = 11;
+  if (this->_internal_has_viewport()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.viewport_);
+  }
+
+  // .aspia.proto.desktop.FrameHashes frame_hashes = 14;
+  if (this->_internal_has_frame_hashes()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.frame_hashes_);
+  }
+
+  // uint32 features = 1;
+  if (this->_internal_features() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_features());
+  }
+
+  // .aspia.proto.desktop.VideoEncoding video_encoding = 2;
+  if (this->_internal_video_encoding() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_video_encoding());
+  }
+
+  // uint32 update_interval = 4;
+  if (this->_internal_update_interval() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_update_interval());
+  }
+
+  // uint32 compress_ratio = 5;
+  if (this->_internal_compress_ratio() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_compress_ratio());
+  }
+
+  // uint32 encoder_threads = 6;
+  if (this->_internal_encoder_threads() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_encoder_threads());
+  }
+
+  // uint32 encoder_tile_columns = 7;
+  if (this->_internal_encoder_tile_columns() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_encoder_tile_columns());
+  }
+
+  // uint32 cursor_cache_next = 9;
+  if (this->_internal_cursor_cache_next() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cursor_cache_next());
+  }
+
+  // uint32 tile_cache_size = 10;
+  if (this->_internal_tile_cache_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_tile_cache_size());
+  }
+
+  // uint32 bandwidth_limit = 12;
+  if (this->_internal_bandwidth_limit() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_bandwidth_limit());
+  }
+
+  // bool auto_encoding = 13;
+  if (this->_internal_auto_encoding() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint32 initial_bandwidth = 15;
+  if (this->_internal_initial_bandwidth() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_initial_bandwidth());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void Config::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const Config*>(
+      &from));
+}
+
+void Config::MergeFrom(const Config& from) {
+  Config* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.Config)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.cursor_cache_.MergeFrom(from._impl_.cursor_cache_);
+  if (from._internal_has_pixel_format()) {
+    _this->_internal_mutable_pixel_format()->::aspia::proto::desktop::PixelFormat::MergeFrom(
+        from._internal_pixel_format());
+  }
+  if (from._internal_has_viewport()) {
+    _this->_internal_mutable_viewport()->::aspia::proto::desktop::Size::MergeFrom(
+        from._internal_viewport());
+  }
+  if (from._internal_has_frame_hashes()) {
+    _this->_internal_mutable_frame_hashes()->::aspia::proto::desktop::FrameHashes::MergeFrom(
+        from._internal_frame_hashes());
+  }
+  if (from._internal_features() != 0) {
+    _this->_internal_set_features(from._internal_features());
+  }
+  if (from._internal_video_encoding() != 0) {
+    _this->_internal_set_video_encoding(from._internal_video_encoding());
+  }
+  if (from._internal_update_interval() != 0) {
+    _this->_internal_set_update_interval(from._internal_update_interval());
+  }
+  if (from._internal_compress_ratio() != 0) {
+    _this->_internal_set_compress_ratio(from._internal_compress_ratio());
+  }
+  if (from._internal_encoder_threads() != 0) {
+    _this->_internal_set_encoder_threads(from._internal_encoder_threads());
+  }
+  if (from._internal_encoder_tile_columns() != 0) {
+    _this->_internal_set_encoder_tile_columns(from._internal_encoder_tile_columns());
+  }
+  if (from._internal_cursor_cache_next() != 0) {
+    _this->_internal_set_cursor_cache_next(from._internal_cursor_cache_next());
+  }
+  if (from._internal_tile_cache_size() != 0) {
+    _this->_internal_set_tile_cache_size(from._internal_tile_cache_size());
+  }
+  if (from._internal_bandwidth_limit() != 0) {
+    _this->_internal_set_bandwidth_limit(from._internal_bandwidth_limit());
+  }
+  if (from._internal_auto_encoding() != 0) {
+    _this->_internal_set_auto_encoding(from._internal_auto_encoding());
+  }
+  if (from._internal_initial_bandwidth() != 0) {
+    _this->_internal_set_initial_bandwidth(from._internal_initial_bandwidth());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void Config::CopyFrom(const Config& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.desktop.Config)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Config::IsInitialized() const {
+  return true;
+}
+
+void Config::InternalSwap(Config* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.cursor_cache_.InternalSwap(&other->_impl_.cursor_cache_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Config, _impl_.initial_bandwidth_)
+      + sizeof(Config::_impl_.initial_bandwidth_)
+      - PROTOBUF_FIELD_OFFSET(Config, _impl_.pixel_format_)>(
+          reinterpret_cast<char*>(&_impl_.pixel_format_),
+          reinterpret_cast<char*>(&other->_impl_.pixel_format_));
+}
+
+std::string Config::GetTypeName() const {
+  return "aspia.proto.desktop.Config";
+}
+
+
+// ===================================================================
+
+class Screen::_Internal {
+ public:
+};
+
+Screen::Screen(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.desktop.Screen)
+}
+Screen::Screen(const Screen& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  Screen* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.title_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.window_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.title_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.title_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_title().empty()) {
+    _this->_impl_.title_.Set(from._internal_title(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.window_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.window_));
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.desktop.Screen)
+}
+
+inline void Screen::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.title_){}
+    , decltype(_impl_.id_){int64_t{0}}
+    , decltype(_impl_.window_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.title_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.title_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Screen::~Screen() {
+  // @@protoc_insertion_point(destructor:aspia.proto.desktop.Screen)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Screen::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.title_.Destroy();
+}
+
+void Screen::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Screen::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.desktop.Screen)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.title_.ClearToEmpty();
+  ::memset(&_impl_.id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.window_) -
+      reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.window_));
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* Screen::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int64 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string title = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_title();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool window = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.window_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Screen::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.desktop.Screen)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int64 id = 1;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_id(), target);
+  }
+
+  // string title = 2;
+  if (!this->_internal_title().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_title().data(), static_cast<int>(this->_internal_title().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "aspia.proto.desktop.Screen.title");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_title(), target);
+  }
+
+  // bool window = 3;
+  if (this->_internal_window() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_window(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.desktop.Screen)
+  return target;
+}
+
+size_t Screen::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.desktop.Screen)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string title = 2;
+  if (!this->_internal_title().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_title());
+  }
+
+  // int64 id = 1;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_id());
+  }
+
+  // bool window = 3;
+  if (this->_internal_window() != 0) {
+    total_size += 1 + 1;
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void Screen::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const Screen*>(
+      &from));
+}
+
+void Screen::MergeFrom(const Screen& from) {
+  Screen* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.Screen)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_title().empty()) {
+    _this->_internal_set_title(from._internal_title());
+  }
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (from._internal_window() != 0) {
+    _this->_internal_set_window(from._internal_window());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void Screen::CopyFrom(const Screen& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.desktop.Screen)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Screen::IsInitialized() const {
+  return true;
+}
+
+void Screen::InternalSwap(Screen* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.title_, lhs_arena,
+      &other->_impl_.title_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Screen, _impl_.window_)
+      + sizeof(Screen::_impl_.window_)
+      - PROTOBUF_FIELD_OFFSET(Screen, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
+}
+
+std::string Screen::GetTypeName() const {
+  return "aspia.proto.desktop.Screen";
+}
+
+
+// ===================================================================
+
+class ScreenList::_Internal {
+ public:
+};
+
+ScreenList::ScreenList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.desktop.ScreenList)
+}
+ScreenList::ScreenList(const ScreenList& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  ScreenList* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.screen_){from._impl_.screen_}
+    , decltype(_impl_.current_screen_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _this->_impl_.current_screen_ = from._impl_.current_screen_;
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.desktop.ScreenList)
+}
+
+inline void ScreenList::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.screen_){arena}
+    , decltype(_impl_.current_screen_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ScreenList::~ScreenList() {
+  // @@protoc_insertion_point(destructor:aspia.proto.desktop.ScreenList)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ScreenList::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.screen_.~RepeatedPtrField();
+}
+
+void ScreenList::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ScreenList::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.desktop.ScreenList)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.screen_.Clear();
+  _impl_.current_screen_ = int64_t{0};
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* ScreenList::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .aspia.proto.desktop.Screen screen = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_screen(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 current_screen = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.current_screen_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ScreenList::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.desktop.ScreenList)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .aspia.proto.desktop.Screen screen = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_screen_size()); i < n; i++) {
+    const auto& repfield = this->_internal_screen(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // int64 current_screen = 2;
+  if (this->_internal_current_screen() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_current_screen(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.desktop.ScreenList)
+  return target;
+}
+
+size_t ScreenList::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.desktop.ScreenList)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .aspia.proto.desktop.Screen screen = 1;
+  total_size += 1UL * this->_internal_screen_size();
+  for (const auto& msg : this->_impl_.screen_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // int64 current_screen = 2;
+  if (this->_internal_current_screen() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_current_screen());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void ScreenList::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const ScreenList*>(
+      &from));
+}
+
+void ScreenList::MergeFrom(const ScreenList& from) {
+  ScreenList* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.ScreenList)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.screen_.MergeFrom(from._impl_.screen_);
+  if (from._internal_current_screen() != 0) {
+    _this->_internal_set_current_screen(from._internal_current_screen());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void ScreenList::CopyFrom(const ScreenList& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.desktop.ScreenList)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ScreenList::IsInitialized() const {
+  return true;
+}
+
+void ScreenList::InternalSwap(ScreenList* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.screen_.InternalSwap(&other->_impl_.screen_);
+  swap(_impl_.current_screen_, other->_impl_.current_screen_);
+}
+
+std::string ScreenList::GetTypeName() const {
+  return "aspia.proto.desktop.ScreenList";
+}
+
+
+// ===================================================================
+
+class HostToClient::_Internal {
+ public:
+  static const ::aspia::proto::desktop::VideoPacket& video_packet(const HostToClient* msg);
+  static const ::aspia::proto::desktop::CursorShape& cursor_shape(const HostToClient* msg);
+  static const ::aspia::proto::desktop::ClipboardEvent& clipboard_event(const HostToClient* msg);
+  static const ::aspia::proto::desktop::ConfigRequest& config_request(const HostToClient* msg);
+  static const ::aspia::proto::desktop::ScreenList& screen_list(const HostToClient* msg);
+  static const ::aspia::proto::desktop::CursorPosition& cursor_position(const HostToClient* msg);
+  static const ::aspia::proto::desktop::Ping& ping(const HostToClient* msg);
+  static const ::aspia::proto::desktop::LatencyProbe& latency_probe(const HostToClient* msg);
+};
+
+const ::aspia::proto::desktop::VideoPacket&
+HostToClient::_Internal::video_packet(const HostToClient* msg) {
+  return *msg->_impl_.video_packet_;
+}
+const ::aspia::proto::desktop::CursorShape&
+HostToClient::_Internal::cursor_shape(const HostToClient* msg) {
+  return *msg->_impl_.cursor_shape_;
+}
+const ::aspia::proto::desktop::ClipboardEvent&
+HostToClient::_Internal::clipboard_event(const HostToClient* msg) {
+  return *msg->_impl_.clipboard_event_;
+}
+const ::aspia::proto::desktop::ConfigRequest&
+HostToClient::_Internal::config_request(const HostToClient* msg) {
+  return *msg->_impl_.config_request_;
+}
+const ::aspia::proto::desktop::ScreenList&
+HostToClient::_Internal::screen_list(const HostToClient* msg) {
+  return *msg->_impl_.screen_list_;
+}
+const ::aspia::proto::desktop::CursorPosition&
+HostToClient::_Internal::cursor_position(const HostToClient* msg) {
+  return *msg->_impl_.cursor_position_;
+}
+const ::aspia::proto::desktop::Ping&
+HostToClient::_Internal::ping(const HostToClient* msg) {
+  return *msg->_impl_.ping_;
+}
+const ::aspia::proto::desktop::LatencyProbe&
+HostToClient::_Internal::latency_probe(const HostToClient* msg) {
+  return *msg->_impl_.latency_probe_;
+}
+HostToClient::HostToClient(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.desktop.HostToClient)
+}
+HostToClient::HostToClient(const HostToClient& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  HostToClient* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.video_packet_){nullptr}
+    , decltype(_impl_.cursor_shape_){nullptr}
+    , decltype(_impl_.clipboard_event_){nullptr}
+    , decltype(_impl_.config_request_){nullptr}
+    , decltype(_impl_.screen_list_){nullptr}
+    , decltype(_impl_.cursor_position_){nullptr}
+    , decltype(_impl_.ping_){nullptr}
+    , decltype(_impl_.latency_probe_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  if (from._internal_has_video_packet()) {
+    _this->_impl_.video_packet_ = new ::aspia::proto::desktop::VideoPacket(*from._impl_.video_packet_);
+  }
+  if (from._internal_has_cursor_shape()) {
+    _this->_impl_.cursor_shape_ = new ::aspia::proto::desktop::CursorShape(*from._impl_.cursor_shape_);
+  }
+  if (from._internal_has_clipboard_event()) {
+    _this->_impl_.clipboard_event_ = new ::aspia::proto::desktop::ClipboardEvent(*from._impl_.clipboard_event_);
+  }
+  if (from._internal_has_config_request()) {
+    _this->_impl_.config_request_ = new ::aspia::proto::desktop::ConfigRequest(*from._impl_.config_request_);
+  }
+  if (from._internal_has_screen_list()) {
+    _this->_impl_.screen_list_ = new ::aspia::proto::desktop::ScreenList(*from._impl_.screen_list_);
+  }
+  if (from._internal_has_cursor_position()) {
+    _this->_impl_.cursor_position_ = new ::aspia::proto::desktop::CursorPosition(*from._impl_.cursor_position_);
+  }
+  if (from._internal_has_ping()) {
+    _this->_impl_.ping_ = new ::aspia::proto::desktop::Ping(*from._impl_.ping_);
+  }
+  if (from._internal_has_latency_probe()) {
+    _this->_impl_.latency_probe_ = new ::aspia::proto::desktop::LatencyProbe(*from._impl_.latency_probe_);
+  }
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.desktop.HostToClient)
+}
+
+inline void HostToClient::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.video_packet_){nullptr}
+    , decltype(_impl_.cursor_shape_){nullptr}
+    , decltype(_impl_.clipboard_event_){nullptr}
+    , decltype(_impl_.config_request_){nullptr}
+    , decltype(_impl_.screen_list_){nullptr}
+    , decltype(_impl_.cursor_position_){nullptr}
+    , decltype(_impl_.ping_){nullptr}
+    , decltype(_impl_.latency_probe_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+HostToClient::~HostToClient() {
+  // @@protoc_insertion_point(destructor:aspia.proto.desktop.HostToClient)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void HostToClient::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.video_packet_;
+  if (this != internal_default_instance()) delete _impl_.cursor_shape_;
+  if (this != internal_default_instance()) delete _impl_.clipboard_event_;
+  if (this != internal_default_instance()) delete _impl_.config_request_;
+  if (this != internal_default_instance()) delete _impl_.screen_list_;
+  if (this != internal_default_instance()) delete _impl_.cursor_position_;
+  if (this != internal_default_instance()) delete _impl_.ping_;
+  if (this != internal_default_instance()) delete _impl_.latency_probe_;
+}
+
+void HostToClient::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void HostToClient::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.desktop.HostToClient)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.video_packet_ != nullptr) {
+    delete _impl_.video_packet_;
+  }
+  _impl_.video_packet_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.cursor_shape_ != nullptr) {
+    delete _impl_.cursor_shape_;
+  }
+  _impl_.cursor_shape_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.clipboard_event_ != nullptr) {
+    delete _impl_.clipboard_event_;
+  }
+  _impl_.clipboard_event_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.config_request_ != nullptr) {
+    delete _impl_.config_request_;
+  }
+  _impl_.config_request_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.screen_list_ != nullptr) {
+    delete _impl_.screen_list_;
+  }
+  _impl_.screen_list_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.cursor_position_ != nullptr) {
+    delete _impl_.cursor_position_;
+  }
+  _impl_.cursor_position_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.ping_ != nullptr) {
+    delete _impl_.ping_;
+  }
+  _impl_.ping_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.latency_probe_ != nullptr) {
+    delete _impl_.latency_probe_;
+  }
+  _impl_.latency_probe_ = nullptr;
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* HostToClient::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .aspia.proto.desktop.VideoPacket video_packet = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_video_packet(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .aspia.proto.desktop.CursorShape cursor_shape = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_cursor_shape(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .aspia.proto.desktop.ClipboardEvent clipboard_event = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_clipboard_event(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .aspia.proto.desktop.ConfigRequest config_request = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_config_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .aspia.proto.desktop.ScreenList screen_list = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_screen_list(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .aspia.proto.desktop.CursorPosition cursor_position = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_cursor_position(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .aspia.proto.desktop.Ping ping = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_ping(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .aspia.proto.desktop.LatencyProbe latency_probe = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_latency_probe(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* HostToClient::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.desktop.HostToClient)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .aspia.proto.desktop.VideoPacket video_packet = 1;
+  if (this->_internal_has_video_packet()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::video_packet(this),
+        _Internal::video_packet(this).GetCachedSize(), target, stream);
+  }
+
+  // .aspia.proto.desktop.CursorShape cursor_shape = 2;
+  if (this->_internal_has_cursor_shape()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::cursor_shape(this),
+        _Internal::cursor_shape(this).GetCachedSize(), target, stream);
+  }
+
+  // .aspia.proto.desktop.ClipboardEvent clipboard_event = 3;
+  if (this->_internal_has_clipboard_event()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::clipboard_event(this),
+        _Internal::clipboard_event(this).GetCachedSize(), target, stream);
+  }
+
+  // .aspia.proto.desktop.ConfigRequest config_request = 4;
+  if (this->_internal_has_config_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::config_request(this),
+        _Internal::config_request(this).GetCachedSize(), target, stream);
+  }
+
+  // .aspia.proto.desktop.ScreenList screen_list = 5;
+  if (this->_internal_has_screen_list()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::screen_list(this),
+        _Internal::screen_list(this).GetCachedSize(), target, stream);
+  }
+
+  // .aspia.proto.desktop.CursorPosition cursor_position = 6;
+  if (this->_internal_has_cursor_position()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::cursor_position(this),
+        _Internal::cursor_position(this).GetCachedSize(), target, stream);
+  }
+
+  // .aspia.proto.desktop.Ping ping = 7;
+  if (this->_internal_has_ping()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::ping(this),
+        _Internal::ping(this).GetCachedSize(), target, stream);
+  }
+
+  // .aspia.proto.desktop.LatencyProbe latency_probe = 8;
+  if (this->_internal_has_latency_probe()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::latency_probe(this),
+        _Internal::latency_probe(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.desktop.HostToClient)
+  return target;
+}
+
+size_t HostToClient::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.desktop.HostToClient)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .aspia.proto.desktop.VideoPacket video_packet = 1;
+  if (this->_internal_has_video_packet()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.video_packet_);
+  }
+
+  // .aspia.proto.desktop.CursorShape cursor_shape = 2;
+  if (this->_internal_has_cursor_shape()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.cursor_shape_);
+  }
+
+  // .aspia.proto.desktop.ClipboardEvent clipboard_event = 3;
+  if (this->_internal_has_clipboard_event()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.clipboard_event_);
+  }
+
+  // .aspia.proto.desktop.ConfigRequest config_request = 4;
+  if (this->_internal_has_config_request()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.config_request_);
+  }
+
+  // .aspia.proto.desktop.ScreenList screen_list = 5;
+  if (this->_internal_has_screen_list()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.screen_list_);
+  }
+
+  // .aspia.proto.desktop.CursorPosition cursor_position = 6;
+  if (this->_internal_has_cursor_position()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.cursor_position_);
+  }
+
+  // .aspia.proto.desktop.Ping ping = 7;
+  if (this->_internal_has_ping()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.ping_);
+  }
+
+  // .aspia.proto.desktop.LatencyProbe latency_probe = 8;
+  if (this->_internal_has_latency_probe()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.latency_probe_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void HostToClient::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const HostToClient*>(
+      &from));
+}
+
+void HostToClient::MergeFrom(const HostToClient& from) {
+  HostToClient* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.HostToClient)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_video_packet()) {
+    _this->_internal_mutable_video_packet()->::aspia::proto::desktop::VideoPacket::MergeFrom(
+        from._internal_video_packet());
+  }
+  if (from._internal_has_cursor_shape()) {
+    _this->_internal_mutable_cursor_shape()->::aspia::proto::desktop::CursorShape::MergeFrom(
+        from._internal_cursor_shape());
+  }
+  if (from._internal_has_clipboard_event()) {
+    _this->_internal_mutable_clipboard_event()->::aspia::proto::desktop::ClipboardEvent::MergeFrom(
+        from._internal_clipboard_event());
+  }
+  if (from._internal_has_config_request()) {
+    _this->_internal_mutable_config_request()->::aspia::proto::desktop::ConfigRequest::MergeFrom(
+        from._internal_config_request());
+  }
+  if (from._internal_has_screen_list()) {
+    _this->_internal_mutable_screen_list()->::aspia::proto::desktop::ScreenList::MergeFrom(
+        from._internal_screen_list());
+  }
+  if (from._internal_has_cursor_position()) {
+    _this->_internal_mutable_cursor_position()->::aspia::proto::desktop::CursorPosition::MergeFrom(
+        from._internal_cursor_position());
+  }
+  if (from._internal_has_ping()) {
+    _this->_internal_mutable_ping()->::aspia::proto::desktop::Ping::MergeFrom(
+        from._internal_ping());
+  }
+  if (from._internal_has_latency_probe()) {
+    _this->_internal_mutable_latency_probe()->::aspia::proto::desktop::LatencyProbe::MergeFrom(
+        from._internal_latency_probe());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void HostToClient::CopyFrom(const HostToClient& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.desktop.HostToClient)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool HostToClient::IsInitialized() const {
+  return true;
+}
+
+void HostToClient::InternalSwap(HostToClient* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(HostToClient, _impl_.latency_probe_)
+      + sizeof(HostToClient::_impl_.latency_probe_)
+      - PROTOBUF_FIELD_OFFSET(HostToClient, _impl_.video_packet_)>(
+          reinterpret_cast<char*>(&_impl_.video_packet_),
+          reinterpret_cast<char*>(&other->_impl_.video_packet_));
+}
+
+std::string HostToClient::GetTypeName() const {
+  return "aspia.proto.desktop.HostToClient";
+}
+
+
+// ===================================================================
+
+class VideoAck::_Internal {
+ public:
+};
+
+VideoAck::VideoAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.desktop.VideoAck)
+}
+VideoAck::VideoAck(const VideoAck& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  VideoAck* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.frame_id_){}
+    , decltype(_impl_.decode_time_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::memcpy(&_impl_.frame_id_, &from._impl_.frame_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.decode_time_) -
+    reinterpret_cast<char*>(&_impl_.frame_id_)) + sizeof(_impl_.decode_time_));
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.desktop.VideoAck)
+}
+
+inline void VideoAck::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.frame_id_){0u}
+    , decltype(_impl_.decode_time_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+VideoAck::~VideoAck() {
+  // @@protoc_insertion_point(destructor:aspia.proto.desktop.VideoAck)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void VideoAck::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void VideoAck::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void VideoAck::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.desktop.VideoAck)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.frame_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.decode_time_) -
+      reinterpret_cast<char*>(&_impl_.frame_id_)) + sizeof(_impl_.decode_time_));
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* VideoAck::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 frame_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.frame_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 decode_time = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.decode_time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* VideoAck::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.desktop.VideoAck)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 frame_id = 1;
+  if (this->_internal_frame_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_frame_id(), target);
+  }
+
+  // uint32 decode_time = 2;
+  if (this->_internal_decode_time() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_decode_time(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.desktop.VideoAck)
+  return target;
+}
+
+size_t VideoAck::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.desktop.VideoAck)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint32 frame_id = 1;
+  if (this->_internal_frame_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_frame_id());
+  }
+
+  // uint32 decode_time = 2;
+  if (this->_internal_decode_time() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_decode_time());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void VideoAck::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const VideoAck*>(
+      &from));
+}
+
+void VideoAck::MergeFrom(const VideoAck& from) {
+  VideoAck* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.VideoAck)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_frame_id() != 0) {
+    _this->_internal_set_frame_id(from._internal_frame_id());
+  }
+  if (from._internal_decode_time() != 0) {
+    _this->_internal_set_decode_time(from._internal_decode_time());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void VideoAck::CopyFrom(const VideoAck& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.desktop.VideoAck)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool VideoAck::IsInitialized() const {
+  return true;
+}
+
+void VideoAck::InternalSwap(VideoAck* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(VideoAck, _impl_.decode_time_)
+      + sizeof(VideoAck::_impl_.decode_time_)
+      - PROTOBUF_FIELD_OFFSET(VideoAck, _impl_.frame_id_)>(
+          reinterpret_cast<char*>(&_impl_.frame_id_),
+          reinterpret_cast<char*>(&other->_impl_.frame_id_));
+}
+
+std::string VideoAck::GetTypeName() const {
+  return "aspia.proto.desktop.VideoAck";
+}
+
+
+// ===================================================================
+
+class LatencyProbe::_Internal {
+ public:
+};
+
+LatencyProbe::LatencyProbe(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.desktop.LatencyProbe)
+}
+LatencyProbe::LatencyProbe(const LatencyProbe& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  LatencyProbe* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.time_){}
+    , decltype(_impl_.host_delay_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::memcpy(&_impl_.time_, &from._impl_.time_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.host_delay_) -
+    reinterpret_cast<char*>(&_impl_.time_)) + sizeof(_impl_.host_delay_));
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.desktop.LatencyProbe)
+}
+
+inline void LatencyProbe::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.time_){int64_t{0}}
+    , decltype(_impl_.host_delay_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+LatencyProbe::~LatencyProbe() {
+  // @@protoc_insertion_point(destructor:aspia.proto.desktop.LatencyProbe)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LatencyProbe::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void LatencyProbe::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LatencyProbe::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.desktop.LatencyProbe)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.time_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.host_delay_) -
+      reinterpret_cast<char*>(&_impl_.time_)) + sizeof(_impl_.host_delay_));
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* LatencyProbe::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int64 time = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 host_delay = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.host_delay_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LatencyProbe::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.desktop.LatencyProbe)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int64 time = 1;
+  if (this->_internal_time() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_time(), target);
+  }
+
+  // uint32 host_delay = 2;
+  if (this->_internal_host_delay() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_host_delay(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.desktop.LatencyProbe)
+  return target;
+}
+
+size_t LatencyProbe::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.desktop.LatencyProbe)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int64 time = 1;
+  if (this->_internal_time() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_time());
+  }
+
+  // uint32 host_delay = 2;
+  if (this->_internal_host_delay() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_host_delay());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void LatencyProbe::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const LatencyProbe*>(
+      &from));
+}
+
+void LatencyProbe::MergeFrom(const LatencyProbe& from) {
+  LatencyProbe* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.LatencyProbe)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_time() != 0) {
+    _this->_internal_set_time(from._internal_time());
+  }
+  if (from._internal_host_delay() != 0) {
+    _this->_internal_set_host_delay(from._internal_host_delay());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void LatencyProbe::CopyFrom(const LatencyProbe& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.desktop.LatencyProbe)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LatencyProbe::IsInitialized() const {
+  return true;
+}
+
+void LatencyProbe::InternalSwap(LatencyProbe* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LatencyProbe, _impl_.host_delay_)
+      + sizeof(LatencyProbe::_impl_.host_delay_)
+      - PROTOBUF_FIELD_OFFSET(LatencyProbe, _impl_.time_)>(
+          reinterpret_cast<char*>(&_impl_.time_),
+          reinterpret_cast<char*>(&other->_impl_.time_));
+}
+
+std::string LatencyProbe::GetTypeName() const {
+  return "aspia.proto.desktop.LatencyProbe";
+}
+
+
+// ===================================================================
+
+class Ping::_Internal {
+ public:
+};
+
+Ping::Ping(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.desktop.Ping)
+}
+Ping::Ping(const Ping& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  Ping* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.time_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _this->_impl_.time_ = from._impl_.time_;
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.desktop.Ping)
+}
+
+inline void Ping::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.time_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Ping::~Ping() {
+  // @@protoc_insertion_point(destructor:aspia.proto.desktop.Ping)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Ping::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Ping::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Ping::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.desktop.Ping)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.time_ = int64_t{0};
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* Ping::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int64 time = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Ping::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.desktop.Ping)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int64 time = 1;
+  if (this->_internal_time() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_time(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.desktop.Ping)
+  return target;
+}
+
+size_t Ping::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.desktop.Ping)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int64 time = 1;
+  if (this->_internal_time() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_time());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void Ping::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const Ping*>(
+      &from));
+}
+
+void Ping::MergeFrom(const Ping& from) {
+  Ping* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.Ping)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_time() != 0) {
+    _this->_internal_set_time(from._internal_time());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void Ping::CopyFrom(const Ping& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.desktop.Ping)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Ping::IsInitialized() const {
+  return true;
+}
+
+void Ping::InternalSwap(Ping* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.time_, other->_impl_.time_);
+}
+
+std::string Ping::GetTypeName() const {
+  return "aspia.proto.desktop.Ping";
+}
+
+
+// ===================================================================
+
+class Visibility::_Internal {
+ public:
+};
+
+Visibility::Visibility(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.desktop.Visibility)
+}
+Visibility::Visibility(const Visibility& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  Visibility* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.hidden_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _this->_impl_.hidden_ = from._impl_.hidden_;
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.desktop.Visibility)
+}
+
+inline void Visibility::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.hidden_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Visibility::~Visibility() {
+  // @@protoc_insertion_point(destructor:aspia.proto.desktop.Visibility)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Visibility::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Visibility::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Visibility::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.desktop.Visibility)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.hidden_ = false;
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* Visibility::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool hidden = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.hidden_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Visibility::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.desktop.Visibility)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool hidden = 1;
+  if (this->_internal_hidden() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_hidden(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.desktop.Visibility)
+  return target;
+}
+
+size_t Visibility::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.desktop.Visibility)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bool hidden = 1;
+  if (this->_internal_hidden() != 0) {
+    total_size += 1 + 1;
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void Visibility::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const Visibility*>(
+      &from));
+}
+
+void Visibility::MergeFrom(const Visibility& from) {
+  Visibility* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.Visibility)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_hidden() != 0) {
+    _this->_internal_set_hidden(from._internal_hidden());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void Visibility::CopyFrom(const Visibility& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.desktop.Visibility)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Visibility::IsInitialized() const {
+  return true;
+}
+
+void Visibility::InternalSwap(Visibility* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.hidden_, other->_impl_.hidden_);
+}
+
+std::string Visibility::GetTypeName() const {
+  return "aspia.proto.desktop.Visibility";
+}
+
+
+// ===================================================================
+
+class VisibleArea::_Internal {
+ public:
+  static const ::aspia::proto::desktop::Rect& rect(const VisibleArea* msg);
+};
+
+const ::aspia::proto::desktop::Rect&
+VisibleArea::_Internal::rect(const VisibleArea* msg) {
+  return *msg->_impl_.rect_;
+}
+VisibleArea::VisibleArea(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.desktop.VisibleArea)
+}
+VisibleArea::VisibleArea(const VisibleArea& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  VisibleArea* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rect_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  if (from._internal_has_rect()) {
+    _this->_impl_.rect_ = new ::aspia::proto::desktop::Rect(*from._impl_.rect_);
+  }
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.desktop.VisibleArea)
+}
+
+inline void VisibleArea::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rect_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+VisibleArea::~VisibleArea() {
+  // @@protoc_insertion_point(destructor:aspia.proto.desktop.VisibleArea)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void VisibleArea::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.rect_;
+}
+
+void VisibleArea::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void VisibleArea::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.desktop.VisibleArea)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.rect_ != nullptr) {
+    delete _impl_.rect_;
+  }
+  _impl_.rect_ = nullptr;
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* VisibleArea::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .aspia.proto.desktop.Rect rect = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_rect(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* VisibleArea::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.desktop.VisibleArea)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .aspia.proto.desktop.Rect rect = 1;
+  if (this->_internal_has_rect()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::rect(this),
+        _Internal::rect(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.desktop.VisibleArea)
+  return target;
+}
+
+size_t VisibleArea::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.desktop.VisibleArea)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .aspia.proto.desktop.Rect rect = 1;
+  if (this->_internal_has_rect()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.rect_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void VisibleArea::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const VisibleArea*>(
+      &from));
+}
+
+void VisibleArea::MergeFrom(const VisibleArea& from) {
+  VisibleArea* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.VisibleArea)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_rect()) {
+    _this->_internal_mutable_rect()->::aspia::proto::desktop::Rect::MergeFrom(
+        from._internal_rect());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void VisibleArea::CopyFrom(const VisibleArea& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.desktop.VisibleArea)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool VisibleArea::IsInitialized() const {
+  return true;
+}
+
+void VisibleArea::InternalSwap(VisibleArea* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.rect_, other->_impl_.rect_);
+}
+
+std::string VisibleArea::GetTypeName() const {
+  return "aspia.proto.desktop.VisibleArea";
+}
+
+
+// ===================================================================
+
+class RefreshRequest::_Internal {
+ public:
+};
+
+RefreshRequest::RefreshRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.desktop.RefreshRequest)
+}
+RefreshRequest::RefreshRequest(const RefreshRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  RefreshRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.frames_lost_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _this->_impl_.frames_lost_ = from._impl_.frames_lost_;
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.desktop.RefreshRequest)
+}
+
+inline void RefreshRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.frames_lost_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RefreshRequest::~RefreshRequest() {
+  // @@protoc_insertion_point(destructor:aspia.proto.desktop.RefreshRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RefreshRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void RefreshRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RefreshRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.desktop.RefreshRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.frames_lost_ = false;
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* RefreshRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool frames_lost = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.frames_lost_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RefreshRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.desktop.RefreshRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool frames_lost = 1;
+  if (this->_internal_frames_lost() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_frames_lost(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.desktop.RefreshRequest)
+  return target;
+}
+
+size_t RefreshRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.desktop.RefreshRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  // uint32 video_encodings = 1;
-  if (this->video_encodings() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->video_encodings());
+  // bool frames_lost = 1;
+  if (this->_internal_frames_lost() != 0) {
+    total_size += 1 + 1;
   }
 
-  // uint32 features = 2;
-  if (this->features() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->features());
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
   }
-
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
-void ConfigRequest::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const ConfigRequest*>(&from));
+void RefreshRequest::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const RefreshRequest*>(
+      &from));
 }
 
-void ConfigRequest::MergeFrom(const ConfigRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.ConfigRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+void RefreshRequest::MergeFrom(const RefreshRequest& from) {
+  RefreshRequest* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.RefreshRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.video_encodings() != 0) {
-    set_video_encodings(from.video_encodings());
-  }
-  if (from.features() != 0) {
-    set_features(from.features());
+  if (from._internal_frames_lost() != 0) {
+    _this->_internal_set_frames_lost(from._internal_frames_lost());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
-void ConfigRequest::CopyFrom(const ConfigRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.desktop.ConfigRequest)
+void RefreshRequest::CopyFrom(const RefreshRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.desktop.RefreshRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ConfigRequest::IsInitialized() const {
+bool RefreshRequest::IsInitialized() const {
   return true;
 }
 
-void ConfigRequest::Swap(ConfigRequest* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void ConfigRequest::InternalSwap(ConfigRequest* other) {
+void RefreshRequest::InternalSwap(RefreshRequest* other) {
   using std::swap;
-  swap(video_encodings_, other->video_encodings_);
-  swap(features_, other->features_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.frames_lost_, other->_impl_.frames_lost_);
 }
 
-::std::string ConfigRequest::GetTypeName() const {
-  return "aspia.proto.desktop.ConfigRequest";
+std::string RefreshRequest::GetTypeName() const {
+  return "aspia.proto.desktop.RefreshRequest";
 }
 
 
 // ===================================================================
 
-void Config::InitAsDefaultInstance() {
-  ::aspia::proto::desktop::_Config_default_instance_._instance.get_mutable()->pixel_format_ = const_cast< ::aspia::proto::desktop::PixelFormat*>(
-      ::aspia::proto::desktop::PixelFormat::internal_default_instance());
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Config::kFeaturesFieldNumber;
-const int Config::kVideoEncodingFieldNumber;
-const int Config::kPixelFormatFieldNumber;
-const int Config::kUpdateIntervalFieldNumber;
-const int Config::kCompressRatioFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-Config::Config()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_desktop_5fsession_2eproto::scc_info_Config.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.desktop.Config)
-}
-Config::Config(const Config& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.has_pixel_format()) {
-    pixel_format_ = new ::aspia::proto::desktop::PixelFormat(*from.pixel_format_);
-  } else {
-    pixel_format_ = NULL;
-  }
-  ::memcpy(&features_, &from.features_,
-    static_cast<size_t>(reinterpret_cast<char*>(&compress_ratio_) -
-    reinterpret_cast<char*>(&features_)) + sizeof(compress_ratio_));
-  // @@protoc_insertion_point(copy_constructor:aspia.proto.desktop.Config)
-}
-
-void Config::SharedCtor() {
-  ::memset(&pixel_format_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&compress_ratio_) -
-      reinterpret_cast<char*>(&pixel_format_)) + sizeof(compress_ratio_));
-}
-
-Config::~Config() {
-  // @@protoc_insertion_point(destructor:aspia.proto.desktop.Config)
+class InputEvent::_Internal {
+ public:
+  static const ::aspia::proto::desktop::PointerEvent& pointer_event(const InputEvent* msg);
+  static const ::aspia::proto::desktop::KeyEvent& key_event(const InputEvent* msg);
+};
+
+const ::aspia::proto::desktop::PointerEvent&
+InputEvent::_Internal::pointer_event(const InputEvent* msg) {
+  return *msg->_impl_.pointer_event_;
+}
+const ::aspia::proto::desktop::KeyEvent&
+InputEvent::_Internal::key_event(const InputEvent* msg) {
+  return *msg->_impl_.key_event_;
+}
+InputEvent::InputEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.desktop.InputEvent)
+}
+InputEvent::InputEvent(const InputEvent& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  InputEvent* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.pointer_event_){nullptr}
+    , decltype(_impl_.key_event_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  if (from._internal_has_pointer_event()) {
+    _this->_impl_.pointer_event_ = new ::aspia::proto::desktop::PointerEvent(*from._impl_.pointer_event_);
+  }
+  if (from._internal_has_key_event()) {
+    _this->_impl_.key_event_ = new ::aspia::proto::desktop::KeyEvent(*from._impl_.key_event_);
+  }
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.desktop.InputEvent)
+}
+
+inline void InputEvent::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.pointer_event_){nullptr}
+    , decltype(_impl_.key_event_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+InputEvent::~InputEvent() {
+  // @@protoc_insertion_point(destructor:aspia.proto.desktop.InputEvent)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Config::SharedDtor() {
-  if (this != internal_default_instance()) delete pixel_format_;
+inline void InputEvent::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.pointer_event_;
+  if (this != internal_default_instance()) delete _impl_.key_event_;
 }
 
-void Config::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+void InputEvent::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
-const Config& Config::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_desktop_5fsession_2eproto::scc_info_Config.base);
-  return *internal_default_instance();
-}
-
 
-void Config::Clear() {
-// @@protoc_insertion_point(message_clear_start:aspia.proto.desktop.Config)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+void InputEvent::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.desktop.InputEvent)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaNoVirtual() == NULL && pixel_format_ != NULL) {
-    delete pixel_format_;
-  }
-  pixel_format_ = NULL;
-  ::memset(&features_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&compress_ratio_) -
-      reinterpret_cast<char*>(&features_)) + sizeof(compress_ratio_));
-  _internal_metadata_.Clear();
-}
-
-bool Config::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.desktop.Config)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // uint32 features = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &features_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // .aspia.proto.desktop.VideoEncoding video_encoding = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_video_encoding(static_cast< ::aspia::proto::desktop::VideoEncoding >(value));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+  if (GetArenaForAllocation() == nullptr && _impl_.pointer_event_ != nullptr) {
+    delete _impl_.pointer_event_;
+  }
+  _impl_.pointer_event_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.key_event_ != nullptr) {
+    delete _impl_.key_event_;
+  }
+  _impl_.key_event_ = nullptr;
+  _internal_metadata_.Clear<std::string>();
+}
 
-      // .aspia.proto.desktop.PixelFormat pixel_format = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_pixel_format()));
-        } else {
+const char* InputEvent::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .aspia.proto.desktop.PointerEvent pointer_event = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_pointer_event(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      // uint32 update_interval = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &update_interval_)));
-        } else {
+        continue;
+      // .aspia.proto.desktop.KeyEvent key_event = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_key_event(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      // uint32 compress_ratio = 5;
-      case 5: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(40u /* 40 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &compress_ratio_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.desktop.Config)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.desktop.Config)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void Config::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.desktop.Config)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* InputEvent::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.desktop.InputEvent)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // uint32 features = 1;
-  if (this->features() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->features(), output);
-  }
-
-  // .aspia.proto.desktop.VideoEncoding video_encoding = 2;
-  if (this->video_encoding() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      2, this->video_encoding(), output);
-  }
-
-  // .aspia.proto.desktop.PixelFormat pixel_format = 3;
-  if (this->has_pixel_format()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      3, this->_internal_pixel_format(), output);
+  // .aspia.proto.desktop.PointerEvent pointer_event = 1;
+  if (this->_internal_has_pointer_event()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::pointer_event(this),
+        _Internal::pointer_event(this).GetCachedSize(), target, stream);
   }
 
-  // uint32 update_interval = 4;
-  if (this->update_interval() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(4, this->update_interval(), output);
+  // .aspia.proto.desktop.KeyEvent key_event = 2;
+  if (this->_internal_has_key_event()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::key_event(this),
+        _Internal::key_event(this).GetCachedSize(), target, stream);
   }
 
-  // uint32 compress_ratio = 5;
-  if (this->compress_ratio() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(5, this->compress_ratio(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
   }
-
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.desktop.Config)
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.desktop.InputEvent)
+  return target;
 }
 
-size_t Config::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:aspia.proto.desktop.Config)
+size_t InputEvent::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.desktop.InputEvent)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
-
-  // .aspia.proto.desktop.PixelFormat pixel_format = 3;
-  if (this->has_pixel_format()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *pixel_format_);
-  }
-
-  // uint32 features = 1;
-  if (this->features() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->features());
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  // .aspia.proto.desktop.VideoEncoding video_encoding = 2;
-  if (this->video_encoding() != 0) {
+  // .aspia.proto.desktop.PointerEvent pointer_event = 1;
+  if (this->_internal_has_pointer_event()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->video_encoding());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.pointer_event_);
   }
 
-  // uint32 update_interval = 4;
-  if (this->update_interval() != 0) {
+  // .aspia.proto.desktop.KeyEvent key_event = 2;
+  if (this->_internal_has_key_event()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->update_interval());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.key_event_);
   }
 
-  // uint32 compress_ratio = 5;
-  if (this->compress_ratio() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->compress_ratio());
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
   }
-
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
-void Config::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const Config*>(&from));
+void InputEvent::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const InputEvent*>(
+      &from));
 }
 
-void Config::MergeFrom(const Config& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.Config)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+void InputEvent::MergeFrom(const InputEvent& from) {
+  InputEvent* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.InputEvent)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.has_pixel_format()) {
-    mutable_pixel_format()->::aspia::proto::desktop::PixelFormat::MergeFrom(from.pixel_format());
-  }
-  if (from.features() != 0) {
-    set_features(from.features());
+  if (from._internal_has_pointer_event()) {
+    _this->_internal_mutable_pointer_event()->::aspia::proto::desktop::PointerEvent::MergeFrom(
+        from._internal_pointer_event());
   }
-  if (from.video_encoding() != 0) {
-    set_video_encoding(from.video_encoding());
-  }
-  if (from.update_interval() != 0) {
-    set_update_interval(from.update_interval());
-  }
-  if (from.compress_ratio() != 0) {
-    set_compress_ratio(from.compress_ratio());
+  if (from._internal_has_key_event()) {
+    _this->_internal_mutable_key_event()->::aspia::proto::desktop::KeyEvent::MergeFrom(
+        from._internal_key_event());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
-void Config::CopyFrom(const Config& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.desktop.Config)
+void InputEvent::CopyFrom(const InputEvent& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.desktop.InputEvent)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Config::IsInitialized() const {
+bool InputEvent::IsInitialized() const {
   return true;
 }
 
-void Config::Swap(Config* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void Config::InternalSwap(Config* other) {
+void InputEvent::InternalSwap(InputEvent* other) {
   using std::swap;
-  swap(pixel_format_, other->pixel_format_);
-  swap(features_, other->features_);
-  swap(video_encoding_, other->video_encoding_);
-  swap(update_interval_, other->update_interval_);
-  swap(compress_ratio_, other->compress_ratio_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(InputEvent, _impl_.key_event_)
+      + sizeof(InputEvent::_impl_.key_event_)
+      - PROTOBUF_FIELD_OFFSET(InputEvent, _impl_.pointer_event_)>(
+          reinterpret_cast<char*>(&_impl_.pointer_event_),
+          reinterpret_cast<char*>(&other->_impl_.pointer_event_));
 }
 
-::std::string Config::GetTypeName() const {
-  return "aspia.proto.desktop.Config";
+std::string InputEvent::GetTypeName() const {
+  return "aspia.proto.desktop.InputEvent";
 }
 
 
 // ===================================================================
 
-void HostToClient::InitAsDefaultInstance() {
-  ::aspia::proto::desktop::_HostToClient_default_instance_._instance.get_mutable()->video_packet_ = const_cast< ::aspia::proto::desktop::VideoPacket*>(
-      ::aspia::proto::desktop::VideoPacket::internal_default_instance());
-  ::aspia::proto::desktop::_HostToClient_default_instance_._instance.get_mutable()->cursor_shape_ = const_cast< ::aspia::proto::desktop::CursorShape*>(
-      ::aspia::proto::desktop::CursorShape::internal_default_instance());
-  ::aspia::proto::desktop::_HostToClient_default_instance_._instance.get_mutable()->clipboard_event_ = const_cast< ::aspia::proto::desktop::ClipboardEvent*>(
-      ::aspia::proto::desktop::ClipboardEvent::internal_default_instance());
-  ::aspia::proto::desktop::_HostToClient_default_instance_._instance.get_mutable()->config_request_ = const_cast< ::aspia::proto::desktop::ConfigRequest*>(
-      ::aspia::proto::desktop::ConfigRequest::internal_default_instance());
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int HostToClient::kVideoPacketFieldNumber;
-const int HostToClient::kCursorShapeFieldNumber;
-const int HostToClient::kClipboardEventFieldNumber;
-const int HostToClient::kConfigRequestFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-HostToClient::HostToClient()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_desktop_5fsession_2eproto::scc_info_HostToClient.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.desktop.HostToClient)
+class InputEvents::_Internal {
+ public:
+};
+
+InputEvents::InputEvents(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.desktop.InputEvents)
 }
-HostToClient::HostToClient(const HostToClient& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.has_video_packet()) {
-    video_packet_ = new ::aspia::proto::desktop::VideoPacket(*from.video_packet_);
-  } else {
-    video_packet_ = NULL;
-  }
-  if (from.has_cursor_shape()) {
-    cursor_shape_ = new ::aspia::proto::desktop::CursorShape(*from.cursor_shape_);
-  } else {
-    cursor_shape_ = NULL;
-  }
-  if (from.has_clipboard_event()) {
-    clipboard_event_ = new ::aspia::proto::desktop::ClipboardEvent(*from.clipboard_event_);
-  } else {
-    clipboard_event_ = NULL;
-  }
-  if (from.has_config_request()) {
-    config_request_ = new ::aspia::proto::desktop::ConfigRequest(*from.config_request_);
-  } else {
-    config_request_ = NULL;
-  }
-  // @@protoc_insertion_point(copy_constructor:aspia.proto.desktop.HostToClient)
+InputEvents::InputEvents(const InputEvents& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  InputEvents* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.event_){from._impl_.event_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.desktop.InputEvents)
 }
 
-void HostToClient::SharedCtor() {
-  ::memset(&video_packet_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&config_request_) -
-      reinterpret_cast<char*>(&video_packet_)) + sizeof(config_request_));
+inline void InputEvents::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.event_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-HostToClient::~HostToClient() {
-  // @@protoc_insertion_point(destructor:aspia.proto.desktop.HostToClient)
+InputEvents::~InputEvents() {
+  // @@protoc_insertion_point(destructor:aspia.proto.desktop.InputEvents)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void HostToClient::SharedDtor() {
-  if (this != internal_default_instance()) delete video_packet_;
-  if (this != internal_default_instance()) delete cursor_shape_;
-  if (this != internal_default_instance()) delete clipboard_event_;
-  if (this != internal_default_instance()) delete config_request_;
+inline void InputEvents::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.event_.~RepeatedPtrField();
 }
 
-void HostToClient::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+void InputEvents::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
-const HostToClient& HostToClient::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_desktop_5fsession_2eproto::scc_info_HostToClient.base);
-  return *internal_default_instance();
-}
-
 
-void HostToClient::Clear() {
-// @@protoc_insertion_point(message_clear_start:aspia.proto.desktop.HostToClient)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+void InputEvents::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.desktop.InputEvents)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaNoVirtual() == NULL && video_packet_ != NULL) {
-    delete video_packet_;
-  }
-  video_packet_ = NULL;
-  if (GetArenaNoVirtual() == NULL && cursor_shape_ != NULL) {
-    delete cursor_shape_;
-  }
-  cursor_shape_ = NULL;
-  if (GetArenaNoVirtual() == NULL && clipboard_event_ != NULL) {
-    delete clipboard_event_;
-  }
-  clipboard_event_ = NULL;
-  if (GetArenaNoVirtual() == NULL && config_request_ != NULL) {
-    delete config_request_;
-  }
-  config_request_ = NULL;
-  _internal_metadata_.Clear();
-}
-
-bool HostToClient::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.desktop.HostToClient)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // .aspia.proto.desktop.VideoPacket video_packet = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_video_packet()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // .aspia.proto.desktop.CursorShape cursor_shape = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_cursor_shape()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // .aspia.proto.desktop.ClipboardEvent clipboard_event = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_clipboard_event()));
-        } else {
+  _impl_.event_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* InputEvents::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .aspia.proto.desktop.InputEvent event = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_event(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      // .aspia.proto.desktop.ConfigRequest config_request = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_config_request()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.desktop.HostToClient)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.desktop.HostToClient)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void HostToClient::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.desktop.HostToClient)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* InputEvents::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.desktop.InputEvents)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .aspia.proto.desktop.VideoPacket video_packet = 1;
-  if (this->has_video_packet()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      1, this->_internal_video_packet(), output);
-  }
-
-  // .aspia.proto.desktop.CursorShape cursor_shape = 2;
-  if (this->has_cursor_shape()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      2, this->_internal_cursor_shape(), output);
-  }
-
-  // .aspia.proto.desktop.ClipboardEvent clipboard_event = 3;
-  if (this->has_clipboard_event()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      3, this->_internal_clipboard_event(), output);
+  // repeated .aspia.proto.desktop.InputEvent event = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_event_size()); i < n; i++) {
+    const auto& repfield = this->_internal_event(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  // .aspia.proto.desktop.ConfigRequest config_request = 4;
-  if (this->has_config_request()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      4, this->_internal_config_request(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
   }
-
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.desktop.HostToClient)
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.desktop.InputEvents)
+  return target;
 }
 
-size_t HostToClient::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:aspia.proto.desktop.HostToClient)
+size_t InputEvents::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.desktop.InputEvents)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
-
-  // .aspia.proto.desktop.VideoPacket video_packet = 1;
-  if (this->has_video_packet()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *video_packet_);
-  }
-
-  // .aspia.proto.desktop.CursorShape cursor_shape = 2;
-  if (this->has_cursor_shape()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *cursor_shape_);
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  // .aspia.proto.desktop.ClipboardEvent clipboard_event = 3;
-  if (this->has_clipboard_event()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *clipboard_event_);
+  // repeated .aspia.proto.desktop.InputEvent event = 1;
+  total_size += 1UL * this->_internal_event_size();
+  for (const auto& msg : this->_impl_.event_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // .aspia.proto.desktop.ConfigRequest config_request = 4;
-  if (this->has_config_request()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *config_request_);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
   }
-
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
-void HostToClient::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const HostToClient*>(&from));
+void InputEvents::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const InputEvents*>(
+      &from));
 }
 
-void HostToClient::MergeFrom(const HostToClient& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.HostToClient)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+void InputEvents::MergeFrom(const InputEvents& from) {
+  InputEvents* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.InputEvents)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.has_video_packet()) {
-    mutable_video_packet()->::aspia::proto::desktop::VideoPacket::MergeFrom(from.video_packet());
-  }
-  if (from.has_cursor_shape()) {
-    mutable_cursor_shape()->::aspia::proto::desktop::CursorShape::MergeFrom(from.cursor_shape());
-  }
-  if (from.has_clipboard_event()) {
-    mutable_clipboard_event()->::aspia::proto::desktop::ClipboardEvent::MergeFrom(from.clipboard_event());
-  }
-  if (from.has_config_request()) {
-    mutable_config_request()->::aspia::proto::desktop::ConfigRequest::MergeFrom(from.config_request());
-  }
+  _this->_impl_.event_.MergeFrom(from._impl_.event_);
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
-void HostToClient::CopyFrom(const HostToClient& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.desktop.HostToClient)
+void InputEvents::CopyFrom(const InputEvents& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.desktop.InputEvents)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool HostToClient::IsInitialized() const {
+bool InputEvents::IsInitialized() const {
   return true;
 }
 
-void HostToClient::Swap(HostToClient* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void HostToClient::InternalSwap(HostToClient* other) {
+void InputEvents::InternalSwap(InputEvents* other) {
   using std::swap;
-  swap(video_packet_, other->video_packet_);
-  swap(cursor_shape_, other->cursor_shape_);
-  swap(clipboard_event_, other->clipboard_event_);
-  swap(config_request_, other->config_request_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.event_.InternalSwap(&other->_impl_.event_);
 }
 
-::std::string HostToClient::GetTypeName() const {
-  return "aspia.proto.desktop.HostToClient";
+std::string InputEvents::GetTypeName() const {
+  return "aspia.proto.desktop.InputEvents";
 }
 
 
 // ===================================================================
 
-void ClientToHost::InitAsDefaultInstance() {
-  ::aspia::proto::desktop::_ClientToHost_default_instance_._instance.get_mutable()->pointer_event_ = const_cast< ::aspia::proto::desktop::PointerEvent*>(
-      ::aspia::proto::desktop::PointerEvent::internal_default_instance());
-  ::aspia::proto::desktop::_ClientToHost_default_instance_._instance.get_mutable()->key_event_ = const_cast< ::aspia::proto::desktop::KeyEvent*>(
-      ::aspia::proto::desktop::KeyEvent::internal_default_instance());
-  ::aspia::proto::desktop::_ClientToHost_default_instance_._instance.get_mutable()->clipboard_event_ = const_cast< ::aspia::proto::desktop::ClipboardEvent*>(
-      ::aspia::proto::desktop::ClipboardEvent::internal_default_instance());
-  ::aspia::proto::desktop::_ClientToHost_default_instance_._instance.get_mutable()->config_ = const_cast< ::aspia::proto::desktop::Config*>(
-      ::aspia::proto::desktop::Config::internal_default_instance());
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int ClientToHost::kPointerEventFieldNumber;
-const int ClientToHost::kKeyEventFieldNumber;
-const int ClientToHost::kClipboardEventFieldNumber;
-const int ClientToHost::kConfigFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-ClientToHost::ClientToHost()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_desktop_5fsession_2eproto::scc_info_ClientToHost.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.desktop.ClientToHost)
+class ClientToHost::_Internal {
+ public:
+  static const ::aspia::proto::desktop::PointerEvent& pointer_event(const ClientToHost* msg);
+  static const ::aspia::proto::desktop::KeyEvent& key_event(const ClientToHost* msg);
+  static const ::aspia::proto::desktop::ClipboardEvent& clipboard_event(const ClientToHost* msg);
+  static const ::aspia::proto::desktop::Config& config(const ClientToHost* msg);
+  static const ::aspia::proto::desktop::VideoAck& video_ack(const ClientToHost* msg);
+  static const ::aspia::proto::desktop::Screen& screen(const ClientToHost* msg);
+  static const ::aspia::proto::desktop::RefreshRequest& refresh_request(const ClientToHost* msg);
+  static const ::aspia::proto::desktop::InputEvents& input_events(const ClientToHost* msg);
+  static const ::aspia::proto::desktop::Ping& ping(const ClientToHost* msg);
+  static const ::aspia::proto::desktop::Visibility& visibility(const ClientToHost* msg);
+  static const ::aspia::proto::desktop::VisibleArea& visible_area(const ClientToHost* msg);
+};
+
+const ::aspia::proto::desktop::PointerEvent&
+ClientToHost::_Internal::pointer_event(const ClientToHost* msg) {
+  return *msg->_impl_.pointer_event_;
+}
+const ::aspia::proto::desktop::KeyEvent&
+ClientToHost::_Internal::key_event(const ClientToHost* msg) {
+  return *msg->_impl_.key_event_;
+}
+const ::aspia::proto::desktop::ClipboardEvent&
+ClientToHost::_Internal::clipboard_event(const ClientToHost* msg) {
+  return *msg->_impl_.clipboard_event_;
+}
+const ::aspia::proto::desktop::Config&
+ClientToHost::_Internal::config(const ClientToHost* msg) {
+  return *msg->_impl_.config_;
+}
+const ::aspia::proto::desktop::VideoAck&
+ClientToHost::_Internal::video_ack(const ClientToHost* msg) {
+  return *msg->_impl_.video_ack_;
+}
+const ::aspia::proto::desktop::Screen&
+ClientToHost::_Internal::screen(const ClientToHost* msg) {
+  return *msg->_impl_.screen_;
+}
+const ::aspia::proto::desktop::RefreshRequest&
+ClientToHost::_Internal::refresh_request(const ClientToHost* msg) {
+  return *msg->_impl_.refresh_request_;
+}
+const ::aspia::proto::desktop::InputEvents&
+ClientToHost::_Internal::input_events(const ClientToHost* msg) {
+  return *msg->_impl_.input_events_;
+}
+const ::aspia::proto::desktop::Ping&
+ClientToHost::_Internal::ping(const ClientToHost* msg) {
+  return *msg->_impl_.ping_;
+}
+const ::aspia::proto::desktop::Visibility&
+ClientToHost::_Internal::visibility(const ClientToHost* msg) {
+  return *msg->_impl_.visibility_;
+}
+const ::aspia::proto::desktop::VisibleArea&
+ClientToHost::_Internal::visible_area(const ClientToHost* msg) {
+  return *msg->_impl_.visible_area_;
+}
+ClientToHost::ClientToHost(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.desktop.ClientToHost)
 }
 ClientToHost::ClientToHost(const ClientToHost& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.has_pointer_event()) {
-    pointer_event_ = new ::aspia::proto::desktop::PointerEvent(*from.pointer_event_);
-  } else {
-    pointer_event_ = NULL;
-  }
-  if (from.has_key_event()) {
-    key_event_ = new ::aspia::proto::desktop::KeyEvent(*from.key_event_);
-  } else {
-    key_event_ = NULL;
-  }
-  if (from.has_clipboard_event()) {
-    clipboard_event_ = new ::aspia::proto::desktop::ClipboardEvent(*from.clipboard_event_);
-  } else {
-    clipboard_event_ = NULL;
-  }
-  if (from.has_config()) {
-    config_ = new ::aspia::proto::desktop::Config(*from.config_);
-  } else {
-    config_ = NULL;
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  ClientToHost* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.pointer_event_){nullptr}
+    , decltype(_impl_.key_event_){nullptr}
+    , decltype(_impl_.clipboard_event_){nullptr}
+    , decltype(_impl_.config_){nullptr}
+    , decltype(_impl_.video_ack_){nullptr}
+    , decltype(_impl_.screen_){nullptr}
+    , decltype(_impl_.refresh_request_){nullptr}
+    , decltype(_impl_.input_events_){nullptr}
+    , decltype(_impl_.ping_){nullptr}
+    , decltype(_impl_.visibility_){nullptr}
+    , decltype(_impl_.visible_area_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  if (from._internal_has_pointer_event()) {
+    _this->_impl_.pointer_event_ = new ::aspia::proto::desktop::PointerEvent(*from._impl_.pointer_event_);
+  }
+  if (from._internal_has_key_event()) {
+    _this->_impl_.key_event_ = new ::aspia::proto::desktop::KeyEvent(*from._impl_.key_event_);
+  }
+  if (from._internal_has_clipboard_event()) {
+    _this->_impl_.clipboard_event_ = new ::aspia::proto::desktop::ClipboardEvent(*from._impl_.clipboard_event_);
+  }
+  if (from._internal_has_config()) {
+    _this->_impl_.config_ = new ::aspia::proto::desktop::Config(*from._impl_.config_);
+  }
+  if (from._internal_has_video_ack()) {
+    _this->_impl_.video_ack_ = new ::aspia::proto::desktop::VideoAck(*from._impl_.video_ack_);
+  }
+  if (from._internal_has_screen()) {
+    _this->_impl_.screen_ = new ::aspia::proto::desktop::Screen(*from._impl_.screen_);
+  }
+  if (from._internal_has_refresh_request()) {
+    _this->_impl_.refresh_request_ = new ::aspia::proto::desktop::RefreshRequest(*from._impl_.refresh_request_);
+  }
+  if (from._internal_has_input_events()) {
+    _this->_impl_.input_events_ = new ::aspia::proto::desktop::InputEvents(*from._impl_.input_events_);
+  }
+  if (from._internal_has_ping()) {
+    _this->_impl_.ping_ = new ::aspia::proto::desktop::Ping(*from._impl_.ping_);
+  }
+  if (from._internal_has_visibility()) {
+    _this->_impl_.visibility_ = new ::aspia::proto::desktop::Visibility(*from._impl_.visibility_);
+  }
+  if (from._internal_has_visible_area()) {
+    _this->_impl_.visible_area_ = new ::aspia::proto::desktop::VisibleArea(*from._impl_.visible_area_);
   }
   // @@protoc_insertion_point(copy_constructor:aspia.proto.desktop.ClientToHost)
 }
 
-void ClientToHost::SharedCtor() {
-  ::memset(&pointer_event_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&config_) -
-      reinterpret_cast<char*>(&pointer_event_)) + sizeof(config_));
+inline void ClientToHost::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.pointer_event_){nullptr}
+    , decltype(_impl_.key_event_){nullptr}
+    , decltype(_impl_.clipboard_event_){nullptr}
+    , decltype(_impl_.config_){nullptr}
+    , decltype(_impl_.video_ack_){nullptr}
+    , decltype(_impl_.screen_){nullptr}
+    , decltype(_impl_.refresh_request_){nullptr}
+    , decltype(_impl_.input_events_){nullptr}
+    , decltype(_impl_.ping_){nullptr}
+    , decltype(_impl_.visibility_){nullptr}
+    , decltype(_impl_.visible_area_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 ClientToHost::~ClientToHost() {
   // @@protoc_insertion_point(destructor:aspia.proto.desktop.ClientToHost)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void ClientToHost::SharedDtor() {
-  if (this != internal_default_instance()) delete pointer_event_;
-  if (this != internal_default_instance()) delete key_event_;
-  if (this != internal_default_instance()) delete clipboard_event_;
-  if (this != internal_default_instance()) delete config_;
+inline void ClientToHost::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.pointer_event_;
+  if (this != internal_default_instance()) delete _impl_.key_event_;
+  if (this != internal_default_instance()) delete _impl_.clipboard_event_;
+  if (this != internal_default_instance()) delete _impl_.config_;
+  if (this != internal_default_instance()) delete _impl_.video_ack_;
+  if (this != internal_default_instance()) delete _impl_.screen_;
+  if (this != internal_default_instance()) delete _impl_.refresh_request_;
+  if (this != internal_default_instance()) delete _impl_.input_events_;
+  if (this != internal_default_instance()) delete _impl_.ping_;
+  if (this != internal_default_instance()) delete _impl_.visibility_;
+  if (this != internal_default_instance()) delete _impl_.visible_area_;
 }
 
 void ClientToHost::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const ClientToHost& ClientToHost::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_desktop_5fsession_2eproto::scc_info_ClientToHost.base);
-  return *internal_default_instance();
-}
-
 
 void ClientToHost::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.desktop.ClientToHost)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaNoVirtual() == NULL && pointer_event_ != NULL) {
-    delete pointer_event_;
-  }
-  pointer_event_ = NULL;
-  if (GetArenaNoVirtual() == NULL && key_event_ != NULL) {
-    delete key_event_;
-  }
-  key_event_ = NULL;
-  if (GetArenaNoVirtual() == NULL && clipboard_event_ != NULL) {
-    delete clipboard_event_;
-  }
-  clipboard_event_ = NULL;
-  if (GetArenaNoVirtual() == NULL && config_ != NULL) {
-    delete config_;
-  }
-  config_ = NULL;
-  _internal_metadata_.Clear();
-}
-
-bool ClientToHost::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.desktop.ClientToHost)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  if (GetArenaForAllocation() == nullptr && _impl_.pointer_event_ != nullptr) {
+    delete _impl_.pointer_event_;
+  }
+  _impl_.pointer_event_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.key_event_ != nullptr) {
+    delete _impl_.key_event_;
+  }
+  _impl_.key_event_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.clipboard_event_ != nullptr) {
+    delete _impl_.clipboard_event_;
+  }
+  _impl_.clipboard_event_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.config_ != nullptr) {
+    delete _impl_.config_;
+  }
+  _impl_.config_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.video_ack_ != nullptr) {
+    delete _impl_.video_ack_;
+  }
+  _impl_.video_ack_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.screen_ != nullptr) {
+    delete _impl_.screen_;
+  }
+  _impl_.screen_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.refresh_request_ != nullptr) {
+    delete _impl_.refresh_request_;
+  }
+  _impl_.refresh_request_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.input_events_ != nullptr) {
+    delete _impl_.input_events_;
+  }
+  _impl_.input_events_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.ping_ != nullptr) {
+    delete _impl_.ping_;
+  }
+  _impl_.ping_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.visibility_ != nullptr) {
+    delete _impl_.visibility_;
+  }
+  _impl_.visibility_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.visible_area_ != nullptr) {
+    delete _impl_.visible_area_;
+  }
+  _impl_.visible_area_ = nullptr;
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* ClientToHost::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // .aspia.proto.desktop.PointerEvent pointer_event = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_pointer_event()));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_pointer_event(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .aspia.proto.desktop.KeyEvent key_event = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_key_event()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_key_event(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .aspia.proto.desktop.ClipboardEvent clipboard_event = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_clipboard_event()));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_clipboard_event(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .aspia.proto.desktop.Config config = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_config()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_config(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .aspia.proto.desktop.VideoAck video_ack = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_video_ack(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .aspia.proto.desktop.Screen screen = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_screen(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .aspia.proto.desktop.RefreshRequest refresh_request = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_refresh_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .aspia.proto.desktop.InputEvents input_events = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_input_events(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .aspia.proto.desktop.Ping ping = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_ping(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .aspia.proto.desktop.Visibility visibility = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_visibility(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .aspia.proto.desktop.VisibleArea visible_area = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_visible_area(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.desktop.ClientToHost)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.desktop.ClientToHost)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void ClientToHost::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.desktop.ClientToHost)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* ClientToHost::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.desktop.ClientToHost)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .aspia.proto.desktop.PointerEvent pointer_event = 1;
-  if (this->has_pointer_event()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      1, this->_internal_pointer_event(), output);
+  if (this->_internal_has_pointer_event()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::pointer_event(this),
+        _Internal::pointer_event(this).GetCachedSize(), target, stream);
   }
 
   // .aspia.proto.desktop.KeyEvent key_event = 2;
-  if (this->has_key_event()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      2, this->_internal_key_event(), output);
+  if (this->_internal_has_key_event()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::key_event(this),
+        _Internal::key_event(this).GetCachedSize(), target, stream);
   }
 
   // .aspia.proto.desktop.ClipboardEvent clipboard_event = 3;
-  if (this->has_clipboard_event()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      3, this->_internal_clipboard_event(), output);
+  if (this->_internal_has_clipboard_event()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::clipboard_event(this),
+        _Internal::clipboard_event(this).GetCachedSize(), target, stream);
   }
 
   // .aspia.proto.desktop.Config config = 4;
-  if (this->has_config()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      4, this->_internal_config(), output);
+  if (this->_internal_has_config()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::config(this),
+        _Internal::config(this).GetCachedSize(), target, stream);
+  }
+
+  // .aspia.proto.desktop.VideoAck video_ack = 5;
+  if (this->_internal_has_video_ack()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::video_ack(this),
+        _Internal::video_ack(this).GetCachedSize(), target, stream);
+  }
+
+  // .aspia.proto.desktop.Screen screen = 6;
+  if (this->_internal_has_screen()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::screen(this),
+        _Internal::screen(this).GetCachedSize(), target, stream);
+  }
+
+  // .aspia.proto.desktop.RefreshRequest refresh_request = 7;
+  if (this->_internal_has_refresh_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::refresh_request(this),
+        _Internal::refresh_request(this).GetCachedSize(), target, stream);
+  }
+
+  // .aspia.proto.desktop.InputEvents input_events = 8;
+  if (this->_internal_has_input_events()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::input_events(this),
+        _Internal::input_events(this).GetCachedSize(), target, stream);
+  }
+
+  // .aspia.proto.desktop.Ping ping = 9;
+  if (this->_internal_has_ping()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::ping(this),
+        _Internal::ping(this).GetCachedSize(), target, stream);
+  }
+
+  // .aspia.proto.desktop.Visibility visibility = 10;
+  if (this->_internal_has_visibility()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(10, _Internal::visibility(this),
+        _Internal::visibility(this).GetCachedSize(), target, stream);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.desktop.ClientToHost)
+  // .aspia.proto.desktop.VisibleArea visible_area = 11;
+  if (this->_internal_has_visible_area()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::visible_area(this),
+        _Internal::visible_area(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.desktop.ClientToHost)
+  return target;
 }
 
 size_t ClientToHost::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.desktop.ClientToHost)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // .aspia.proto.desktop.PointerEvent pointer_event = 1;
-  if (this->has_pointer_event()) {
+  if (this->_internal_has_pointer_event()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *pointer_event_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.pointer_event_);
   }
 
   // .aspia.proto.desktop.KeyEvent key_event = 2;
-  if (this->has_key_event()) {
+  if (this->_internal_has_key_event()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *key_event_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.key_event_);
   }
 
   // .aspia.proto.desktop.ClipboardEvent clipboard_event = 3;
-  if (this->has_clipboard_event()) {
+  if (this->_internal_has_clipboard_event()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *clipboard_event_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.clipboard_event_);
   }
 
   // .aspia.proto.desktop.Config config = 4;
-  if (this->has_config()) {
+  if (this->_internal_has_config()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.config_);
+  }
+
+  // .aspia.proto.desktop.VideoAck video_ack = 5;
+  if (this->_internal_has_video_ack()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.video_ack_);
+  }
+
+  // .aspia.proto.desktop.Screen screen = 6;
+  if (this->_internal_has_screen()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.screen_);
+  }
+
+  // .aspia.proto.desktop.RefreshRequest refresh_request = 7;
+  if (this->_internal_has_refresh_request()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.refresh_request_);
+  }
+
+  // .aspia.proto.desktop.InputEvents input_events = 8;
+  if (this->_internal_has_input_events()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.input_events_);
+  }
+
+  // .aspia.proto.desktop.Ping ping = 9;
+  if (this->_internal_has_ping()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.ping_);
+  }
+
+  // .aspia.proto.desktop.Visibility visibility = 10;
+  if (this->_internal_has_visibility()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.visibility_);
+  }
+
+  // .aspia.proto.desktop.VisibleArea visible_area = 11;
+  if (this->_internal_has_visible_area()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *config_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.visible_area_);
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void ClientToHost::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const ClientToHost*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const ClientToHost*>(
+      &from));
 }
 
 void ClientToHost::MergeFrom(const ClientToHost& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.ClientToHost)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  ClientToHost* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.desktop.ClientToHost)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.has_pointer_event()) {
-    mutable_pointer_event()->::aspia::proto::desktop::PointerEvent::MergeFrom(from.pointer_event());
+  if (from._internal_has_pointer_event()) {
+    _this->_internal_mutable_pointer_event()->::aspia::proto::desktop::PointerEvent::MergeFrom(
+        from._internal_pointer_event());
+  }
+  if (from._internal_has_key_event()) {
+    _this->_internal_mutable_key_event()->::aspia::proto::desktop::KeyEvent::MergeFrom(
+        from._internal_key_event());
+  }
+  if (from._internal_has_clipboard_event()) {
+    _this->_internal_mutable_clipboard_event()->::aspia::proto::desktop::ClipboardEvent::MergeFrom(
+        from._internal_clipboard_event());
+  }
+  if (from._internal_has_config()) {
+    _this->_internal_mutable_config()->::aspia::proto::desktop::Config::MergeFrom(
+        from._internal_config());
+  }
+  if (from._internal_has_video_ack()) {
+    _this->_internal_mutable_video_ack()->::aspia::proto::desktop::VideoAck::MergeFrom(
+        from._internal_video_ack());
+  }
+  if (from._internal_has_screen()) {
+    _this->_internal_mutable_screen()->::aspia::proto::desktop::Screen::MergeFrom(
+        from._internal_screen());
   }
-  if (from.has_key_event()) {
-    mutable_key_event()->::aspia::proto::desktop::KeyEvent::MergeFrom(from.key_event());
+  if (from._internal_has_refresh_request()) {
+    _this->_internal_mutable_refresh_request()->::aspia::proto::desktop::RefreshRequest::MergeFrom(
+        from._internal_refresh_request());
   }
-  if (from.has_clipboard_event()) {
-    mutable_clipboard_event()->::aspia::proto::desktop::ClipboardEvent::MergeFrom(from.clipboard_event());
+  if (from._internal_has_input_events()) {
+    _this->_internal_mutable_input_events()->::aspia::proto::desktop::InputEvents::MergeFrom(
+        from._internal_input_events());
   }
-  if (from.has_config()) {
-    mutable_config()->::aspia::proto::desktop::Config::MergeFrom(from.config());
+  if (from._internal_has_ping()) {
+    _this->_internal_mutable_ping()->::aspia::proto::desktop::Ping::MergeFrom(
+        from._internal_ping());
   }
+  if (from._internal_has_visibility()) {
+    _this->_internal_mutable_visibility()->::aspia::proto::desktop::Visibility::MergeFrom(
+        from._internal_visibility());
+  }
+  if (from._internal_has_visible_area()) {
+    _this->_internal_mutable_visible_area()->::aspia::proto::desktop::VisibleArea::MergeFrom(
+        from._internal_visible_area());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void ClientToHost::CopyFrom(const ClientToHost& from) {
@@ -4021,20 +8736,18 @@ bool ClientToHost::IsInitialized() const {
   return true;
 }
 
-void ClientToHost::Swap(ClientToHost* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void ClientToHost::InternalSwap(ClientToHost* other) {
   using std::swap;
-  swap(pointer_event_, other->pointer_event_);
-  swap(key_event_, other->key_event_);
-  swap(clipboard_event_, other->clipboard_event_);
-  swap(config_, other->config_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ClientToHost, _impl_.visible_area_)
+      + sizeof(ClientToHost::_impl_.visible_area_)
+      - PROTOBUF_FIELD_OFFSET(ClientToHost, _impl_.pointer_event_)>(
+          reinterpret_cast<char*>(&_impl_.pointer_event_),
+          reinterpret_cast<char*>(&other->_impl_.pointer_event_));
 }
 
-::std::string ClientToHost::GetTypeName() const {
+std::string ClientToHost::GetTypeName() const {
   return "aspia.proto.desktop.ClientToHost";
 }
 
@@ -4043,48 +8756,112 @@ void ClientToHost::InternalSwap(ClientToHost* other) {
 }  // namespace desktop
 }  // namespace proto
 }  // namespace aspia
-namespace google {
-namespace protobuf {
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::desktop::KeyEvent* Arena::CreateMaybeMessage< ::aspia::proto::desktop::KeyEvent >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::desktop::KeyEvent >(arena);
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::aspia::proto::desktop::KeyEvent*
+Arena::CreateMaybeMessage< ::aspia::proto::desktop::KeyEvent >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::desktop::KeyEvent >(arena);
+}
+template<> PROTOBUF_NOINLINE ::aspia::proto::desktop::PointerEvent*
+Arena::CreateMaybeMessage< ::aspia::proto::desktop::PointerEvent >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::desktop::PointerEvent >(arena);
+}
+template<> PROTOBUF_NOINLINE ::aspia::proto::desktop::ClipboardEvent*
+Arena::CreateMaybeMessage< ::aspia::proto::desktop::ClipboardEvent >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::desktop::ClipboardEvent >(arena);
+}
+template<> PROTOBUF_NOINLINE ::aspia::proto::desktop::CursorShape*
+Arena::CreateMaybeMessage< ::aspia::proto::desktop::CursorShape >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::desktop::CursorShape >(arena);
+}
+template<> PROTOBUF_NOINLINE ::aspia::proto::desktop::CursorPosition*
+Arena::CreateMaybeMessage< ::aspia::proto::desktop::CursorPosition >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::desktop::CursorPosition >(arena);
+}
+template<> PROTOBUF_NOINLINE ::aspia::proto::desktop::Rect*
+Arena::CreateMaybeMessage< ::aspia::proto::desktop::Rect >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::desktop::Rect >(arena);
+}
+template<> PROTOBUF_NOINLINE ::aspia::proto::desktop::PixelFormat*
+Arena::CreateMaybeMessage< ::aspia::proto::desktop::PixelFormat >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::desktop::PixelFormat >(arena);
+}
+template<> PROTOBUF_NOINLINE ::aspia::proto::desktop::Size*
+Arena::CreateMaybeMessage< ::aspia::proto::desktop::Size >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::desktop::Size >(arena);
+}
+template<> PROTOBUF_NOINLINE ::aspia::proto::desktop::VideoPacketFormat*
+Arena::CreateMaybeMessage< ::aspia::proto::desktop::VideoPacketFormat >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::desktop::VideoPacketFormat >(arena);
+}
+template<> PROTOBUF_NOINLINE ::aspia::proto::desktop::CopyRect*
+Arena::CreateMaybeMessage< ::aspia::proto::desktop::CopyRect >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::desktop::CopyRect >(arena);
+}
+template<> PROTOBUF_NOINLINE ::aspia::proto::desktop::VideoPacket*
+Arena::CreateMaybeMessage< ::aspia::proto::desktop::VideoPacket >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::desktop::VideoPacket >(arena);
+}
+template<> PROTOBUF_NOINLINE ::aspia::proto::desktop::ConfigRequest*
+Arena::CreateMaybeMessage< ::aspia::proto::desktop::ConfigRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::desktop::ConfigRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::aspia::proto::desktop::FrameHashes*
+Arena::CreateMaybeMessage< ::aspia::proto::desktop::FrameHashes >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::desktop::FrameHashes >(arena);
+}
+template<> PROTOBUF_NOINLINE ::aspia::proto::desktop::Config*
+Arena::CreateMaybeMessage< ::aspia::proto::desktop::Config >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::desktop::Config >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::desktop::PointerEvent* Arena::CreateMaybeMessage< ::aspia::proto::desktop::PointerEvent >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::desktop::PointerEvent >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::desktop::Screen*
+Arena::CreateMaybeMessage< ::aspia::proto::desktop::Screen >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::desktop::Screen >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::desktop::ClipboardEvent* Arena::CreateMaybeMessage< ::aspia::proto::desktop::ClipboardEvent >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::desktop::ClipboardEvent >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::desktop::ScreenList*
+Arena::CreateMaybeMessage< ::aspia::proto::desktop::ScreenList >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::desktop::ScreenList >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::desktop::CursorShape* Arena::CreateMaybeMessage< ::aspia::proto::desktop::CursorShape >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::desktop::CursorShape >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::desktop::HostToClient*
+Arena::CreateMaybeMessage< ::aspia::proto::desktop::HostToClient >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::desktop::HostToClient >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::desktop::Rect* Arena::CreateMaybeMessage< ::aspia::proto::desktop::Rect >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::desktop::Rect >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::desktop::VideoAck*
+Arena::CreateMaybeMessage< ::aspia::proto::desktop::VideoAck >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::desktop::VideoAck >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::desktop::PixelFormat* Arena::CreateMaybeMessage< ::aspia::proto::desktop::PixelFormat >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::desktop::PixelFormat >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::desktop::LatencyProbe*
+Arena::CreateMaybeMessage< ::aspia::proto::desktop::LatencyProbe >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::desktop::LatencyProbe >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::desktop::Size* Arena::CreateMaybeMessage< ::aspia::proto::desktop::Size >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::desktop::Size >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::desktop::Ping*
+Arena::CreateMaybeMessage< ::aspia::proto::desktop::Ping >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::desktop::Ping >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::desktop::VideoPacketFormat* Arena::CreateMaybeMessage< ::aspia::proto::desktop::VideoPacketFormat >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::desktop::VideoPacketFormat >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::desktop::Visibility*
+Arena::CreateMaybeMessage< ::aspia::proto::desktop::Visibility >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::desktop::Visibility >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::desktop::VideoPacket* Arena::CreateMaybeMessage< ::aspia::proto::desktop::VideoPacket >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::desktop::VideoPacket >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::desktop::VisibleArea*
+Arena::CreateMaybeMessage< ::aspia::proto::desktop::VisibleArea >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::desktop::VisibleArea >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::desktop::ConfigRequest* Arena::CreateMaybeMessage< ::aspia::proto::desktop::ConfigRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::desktop::ConfigRequest >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::desktop::RefreshRequest*
+Arena::CreateMaybeMessage< ::aspia::proto::desktop::RefreshRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::desktop::RefreshRequest >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::desktop::Config* Arena::CreateMaybeMessage< ::aspia::proto::desktop::Config >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::desktop::Config >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::desktop::InputEvent*
+Arena::CreateMaybeMessage< ::aspia::proto::desktop::InputEvent >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::desktop::InputEvent >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::desktop::HostToClient* Arena::CreateMaybeMessage< ::aspia::proto::desktop::HostToClient >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::desktop::HostToClient >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::desktop::InputEvents*
+Arena::CreateMaybeMessage< ::aspia::proto::desktop::InputEvents >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::desktop::InputEvents >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::desktop::ClientToHost* Arena::CreateMaybeMessage< ::aspia::proto::desktop::ClientToHost >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::desktop::ClientToHost >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::desktop::ClientToHost*
+Arena::CreateMaybeMessage< ::aspia::proto::desktop::ClientToHost >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::desktop::ClientToHost >(arena);
 }
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -1,211 +1,382 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: desktop_session.proto
 
-#ifndef PROTOBUF_INCLUDED_desktop_5fsession_2eproto
-#define PROTOBUF_INCLUDED_desktop_5fsession_2eproto
+#ifndef GOOGLE_PROTOBUF_INCLUDED_desktop_5fsession_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_desktop_5fsession_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3006000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3006000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/message_lite.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/generated_enum_util.h>
 // @@protoc_insertion_point(includes)
-#define PROTOBUF_INTERNAL_EXPORT_protobuf_desktop_5fsession_2eproto 
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_desktop_5fsession_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
 
-namespace protobuf_desktop_5fsession_2eproto {
 // Internal implementation detail -- do not use these members.
-struct TableStruct {
-  static const ::google::protobuf::internal::ParseTableField entries[];
-  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
-  static const ::google::protobuf::internal::ParseTable schema[13];
-  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
-  static const ::google::protobuf::internal::SerializationTable serialization_table[];
-  static const ::google::protobuf::uint32 offsets[];
+struct TableStruct_desktop_5fsession_2eproto {
+  static const uint32_t offsets[];
 };
-}  // namespace protobuf_desktop_5fsession_2eproto
 namespace aspia {
 namespace proto {
 namespace desktop {
 class ClientToHost;
-class ClientToHostDefaultTypeInternal;
+struct ClientToHostDefaultTypeInternal;
 extern ClientToHostDefaultTypeInternal _ClientToHost_default_instance_;
 class ClipboardEvent;
-class ClipboardEventDefaultTypeInternal;
+struct ClipboardEventDefaultTypeInternal;
 extern ClipboardEventDefaultTypeInternal _ClipboardEvent_default_instance_;
 class Config;
-class ConfigDefaultTypeInternal;
+struct ConfigDefaultTypeInternal;
 extern ConfigDefaultTypeInternal _Config_default_instance_;
 class ConfigRequest;
-class ConfigRequestDefaultTypeInternal;
+struct ConfigRequestDefaultTypeInternal;
 extern ConfigRequestDefaultTypeInternal _ConfigRequest_default_instance_;
+class CopyRect;
+struct CopyRectDefaultTypeInternal;
+extern CopyRectDefaultTypeInternal _CopyRect_default_instance_;
+class CursorPosition;
+struct CursorPositionDefaultTypeInternal;
+extern CursorPositionDefaultTypeInternal _CursorPosition_default_instance_;
 class CursorShape;
-class CursorShapeDefaultTypeInternal;
+struct CursorShapeDefaultTypeInternal;
 extern CursorShapeDefaultTypeInternal _CursorShape_default_instance_;
+class FrameHashes;
+struct FrameHashesDefaultTypeInternal;
+extern FrameHashesDefaultTypeInternal _FrameHashes_default_instance_;
 class HostToClient;
-class HostToClientDefaultTypeInternal;
+struct HostToClientDefaultTypeInternal;
 extern HostToClientDefaultTypeInternal _HostToClient_default_instance_;
+class InputEvent;
+struct InputEventDefaultTypeInternal;
+extern InputEventDefaultTypeInternal _InputEvent_default_instance_;
+class InputEvents;
+struct InputEventsDefaultTypeInternal;
+extern InputEventsDefaultTypeInternal _InputEvents_default_instance_;
 class KeyEvent;
-class KeyEventDefaultTypeInternal;
+struct KeyEventDefaultTypeInternal;
 extern KeyEventDefaultTypeInternal _KeyEvent_default_instance_;
+class LatencyProbe;
+struct LatencyProbeDefaultTypeInternal;
+extern LatencyProbeDefaultTypeInternal _LatencyProbe_default_instance_;
+class Ping;
+struct PingDefaultTypeInternal;
+extern PingDefaultTypeInternal _Ping_default_instance_;
 class PixelFormat;
-class PixelFormatDefaultTypeInternal;
+struct PixelFormatDefaultTypeInternal;
 extern PixelFormatDefaultTypeInternal _PixelFormat_default_instance_;
 class PointerEvent;
-class PointerEventDefaultTypeInternal;
+struct PointerEventDefaultTypeInternal;
 extern PointerEventDefaultTypeInternal _PointerEvent_default_instance_;
 class Rect;
-class RectDefaultTypeInternal;
+struct RectDefaultTypeInternal;
 extern RectDefaultTypeInternal _Rect_default_instance_;
+class RefreshRequest;
+struct RefreshRequestDefaultTypeInternal;
+extern RefreshRequestDefaultTypeInternal _RefreshRequest_default_instance_;
+class Screen;
+struct ScreenDefaultTypeInternal;
+extern ScreenDefaultTypeInternal _Screen_default_instance_;
+class ScreenList;
+struct ScreenListDefaultTypeInternal;
+extern ScreenListDefaultTypeInternal _ScreenList_default_instance_;
 class Size;
-class SizeDefaultTypeInternal;
+struct SizeDefaultTypeInternal;
 extern SizeDefaultTypeInternal _Size_default_instance_;
+class VideoAck;
+struct VideoAckDefaultTypeInternal;
+extern VideoAckDefaultTypeInternal _VideoAck_default_instance_;
 class VideoPacket;
-class VideoPacketDefaultTypeInternal;
+struct VideoPacketDefaultTypeInternal;
 extern VideoPacketDefaultTypeInternal _VideoPacket_default_instance_;
 class VideoPacketFormat;
-class VideoPacketFormatDefaultTypeInternal;
+struct VideoPacketFormatDefaultTypeInternal;
 extern VideoPacketFormatDefaultTypeInternal _VideoPacketFormat_default_instance_;
+class Visibility;
+struct VisibilityDefaultTypeInternal;
+extern VisibilityDefaultTypeInternal _Visibility_default_instance_;
+class VisibleArea;
+struct VisibleAreaDefaultTypeInternal;
+extern VisibleAreaDefaultTypeInternal _VisibleArea_default_instance_;
 }  // namespace desktop
 }  // namespace proto
 }  // namespace aspia
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 template<> ::aspia::proto::desktop::ClientToHost* Arena::CreateMaybeMessage<::aspia::proto::desktop::ClientToHost>(Arena*);
 template<> ::aspia::proto::desktop::ClipboardEvent* Arena::CreateMaybeMessage<::aspia::proto::desktop::ClipboardEvent>(Arena*);
 template<> ::aspia::proto::desktop::Config* Arena::CreateMaybeMessage<::aspia::proto::desktop::Config>(Arena*);
 template<> ::aspia::proto::desktop::ConfigRequest* Arena::CreateMaybeMessage<::aspia::proto::desktop::ConfigRequest>(Arena*);
+template<> ::aspia::proto::desktop::CopyRect* Arena::CreateMaybeMessage<::aspia::proto::desktop::CopyRect>(Arena*);
+template<> ::aspia::proto::desktop::CursorPosition* Arena::CreateMaybeMessage<::aspia::proto::desktop::CursorPosition>(Arena*);
 template<> ::aspia::proto::desktop::CursorShape* Arena::CreateMaybeMessage<::aspia::proto::desktop::CursorShape>(Arena*);
+template<> ::aspia::proto::desktop::FrameHashes* Arena::CreateMaybeMessage<::aspia::proto::desktop::FrameHashes>(Arena*);
 template<> ::aspia::proto::desktop::HostToClient* Arena::CreateMaybeMessage<::aspia::proto::desktop::HostToClient>(Arena*);
+template<> ::aspia::proto::desktop::InputEvent* Arena::CreateMaybeMessage<::aspia::proto::desktop::InputEvent>(Arena*);
+template<> ::aspia::proto::desktop::InputEvents* Arena::CreateMaybeMessage<::aspia::proto::desktop::InputEvents>(Arena*);
 template<> ::aspia::proto::desktop::KeyEvent* Arena::CreateMaybeMessage<::aspia::proto::desktop::KeyEvent>(Arena*);
+template<> ::aspia::proto::desktop::LatencyProbe* Arena::CreateMaybeMessage<::aspia::proto::desktop::LatencyProbe>(Arena*);
+template<> ::aspia::proto::desktop::Ping* Arena::CreateMaybeMessage<::aspia::proto::desktop::Ping>(Arena*);
 template<> ::aspia::proto::desktop::PixelFormat* Arena::CreateMaybeMessage<::aspia::proto::desktop::PixelFormat>(Arena*);
 template<> ::aspia::proto::desktop::PointerEvent* Arena::CreateMaybeMessage<::aspia::proto::desktop::PointerEvent>(Arena*);
 template<> ::aspia::proto::desktop::Rect* Arena::CreateMaybeMessage<::aspia::proto::desktop::Rect>(Arena*);
+template<> ::aspia::proto::desktop::RefreshRequest* Arena::CreateMaybeMessage<::aspia::proto::desktop::RefreshRequest>(Arena*);
+template<> ::aspia::proto::desktop::Screen* Arena::CreateMaybeMessage<::aspia::proto::desktop::Screen>(Arena*);
+template<> ::aspia::proto::desktop::ScreenList* Arena::CreateMaybeMessage<::aspia::proto::desktop::ScreenList>(Arena*);
 template<> ::aspia::proto::desktop::Size* Arena::CreateMaybeMessage<::aspia::proto::desktop::Size>(Arena*);
+template<> ::aspia::proto::desktop::VideoAck* Arena::CreateMaybeMessage<::aspia::proto::desktop::VideoAck>(Arena*);
 template<> ::aspia::proto::desktop::VideoPacket* Arena::CreateMaybeMessage<::aspia::proto::desktop::VideoPacket>(Arena*);
 template<> ::aspia::proto::desktop::VideoPacketFormat* Arena::CreateMaybeMessage<::aspia::proto::desktop::VideoPacketFormat>(Arena*);
-}  // namespace protobuf
-}  // namespace google
+template<> ::aspia::proto::desktop::Visibility* Arena::CreateMaybeMessage<::aspia::proto::desktop::Visibility>(Arena*);
+template<> ::aspia::proto::desktop::VisibleArea* Arena::CreateMaybeMessage<::aspia::proto::desktop::VisibleArea>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
 namespace aspia {
 namespace proto {
 namespace desktop {
 
-enum KeyEvent_Flags {
+enum KeyEvent_Flags : int {
   KeyEvent_Flags_UNKNOWN = 0,
   KeyEvent_Flags_CAPSLOCK = 1,
   KeyEvent_Flags_NUMLOCK = 2,
   KeyEvent_Flags_PRESSED = 4,
-  KeyEvent_Flags_KeyEvent_Flags_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  KeyEvent_Flags_KeyEvent_Flags_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  KeyEvent_Flags_KeyEvent_Flags_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  KeyEvent_Flags_KeyEvent_Flags_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool KeyEvent_Flags_IsValid(int value);
-const KeyEvent_Flags KeyEvent_Flags_Flags_MIN = KeyEvent_Flags_UNKNOWN;
-const KeyEvent_Flags KeyEvent_Flags_Flags_MAX = KeyEvent_Flags_PRESSED;
-const int KeyEvent_Flags_Flags_ARRAYSIZE = KeyEvent_Flags_Flags_MAX + 1;
-
-enum PointerEvent_ButtonMask {
+constexpr KeyEvent_Flags KeyEvent_Flags_Flags_MIN = KeyEvent_Flags_UNKNOWN;
+constexpr KeyEvent_Flags KeyEvent_Flags_Flags_MAX = KeyEvent_Flags_PRESSED;
+constexpr int KeyEvent_Flags_Flags_ARRAYSIZE = KeyEvent_Flags_Flags_MAX + 1;
+
+const std::string& KeyEvent_Flags_Name(KeyEvent_Flags value);
+template<typename T>
+inline const std::string& KeyEvent_Flags_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, KeyEvent_Flags>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function KeyEvent_Flags_Name.");
+  return KeyEvent_Flags_Name(static_cast<KeyEvent_Flags>(enum_t_value));
+}
+bool KeyEvent_Flags_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, KeyEvent_Flags* value);
+enum PointerEvent_ButtonMask : int {
   PointerEvent_ButtonMask_EMPTY = 0,
   PointerEvent_ButtonMask_LEFT_BUTTON = 1,
   PointerEvent_ButtonMask_MIDDLE_BUTTON = 2,
   PointerEvent_ButtonMask_RIGHT_BUTTON = 4,
   PointerEvent_ButtonMask_WHEEL_UP = 8,
   PointerEvent_ButtonMask_WHEEL_DOWN = 16,
-  PointerEvent_ButtonMask_PointerEvent_ButtonMask_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  PointerEvent_ButtonMask_PointerEvent_ButtonMask_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  PointerEvent_ButtonMask_PointerEvent_ButtonMask_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  PointerEvent_ButtonMask_PointerEvent_ButtonMask_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool PointerEvent_ButtonMask_IsValid(int value);
-const PointerEvent_ButtonMask PointerEvent_ButtonMask_ButtonMask_MIN = PointerEvent_ButtonMask_EMPTY;
-const PointerEvent_ButtonMask PointerEvent_ButtonMask_ButtonMask_MAX = PointerEvent_ButtonMask_WHEEL_DOWN;
-const int PointerEvent_ButtonMask_ButtonMask_ARRAYSIZE = PointerEvent_ButtonMask_ButtonMask_MAX + 1;
-
-enum CursorShape_Flags {
+constexpr PointerEvent_ButtonMask PointerEvent_ButtonMask_ButtonMask_MIN = PointerEvent_ButtonMask_EMPTY;
+constexpr PointerEvent_ButtonMask PointerEvent_ButtonMask_ButtonMask_MAX = PointerEvent_ButtonMask_WHEEL_DOWN;
+constexpr int PointerEvent_ButtonMask_ButtonMask_ARRAYSIZE = PointerEvent_ButtonMask_ButtonMask_MAX + 1;
+
+const std::string& PointerEvent_ButtonMask_Name(PointerEvent_ButtonMask value);
+template<typename T>
+inline const std::string& PointerEvent_ButtonMask_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, PointerEvent_ButtonMask>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function PointerEvent_ButtonMask_Name.");
+  return PointerEvent_ButtonMask_Name(static_cast<PointerEvent_ButtonMask>(enum_t_value));
+}
+bool PointerEvent_ButtonMask_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, PointerEvent_ButtonMask* value);
+enum ClipboardEvent_Type : int {
+  ClipboardEvent_Type_TYPE_DATA = 0,
+  ClipboardEvent_Type_TYPE_ANNOUNCE = 1,
+  ClipboardEvent_Type_TYPE_REQUEST = 2,
+  ClipboardEvent_Type_ClipboardEvent_Type_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  ClipboardEvent_Type_ClipboardEvent_Type_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool ClipboardEvent_Type_IsValid(int value);
+constexpr ClipboardEvent_Type ClipboardEvent_Type_Type_MIN = ClipboardEvent_Type_TYPE_DATA;
+constexpr ClipboardEvent_Type ClipboardEvent_Type_Type_MAX = ClipboardEvent_Type_TYPE_REQUEST;
+constexpr int ClipboardEvent_Type_Type_ARRAYSIZE = ClipboardEvent_Type_Type_MAX + 1;
+
+const std::string& ClipboardEvent_Type_Name(ClipboardEvent_Type value);
+template<typename T>
+inline const std::string& ClipboardEvent_Type_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ClipboardEvent_Type>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ClipboardEvent_Type_Name.");
+  return ClipboardEvent_Type_Name(static_cast<ClipboardEvent_Type>(enum_t_value));
+}
+bool ClipboardEvent_Type_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ClipboardEvent_Type* value);
+enum CursorShape_Flags : int {
   CursorShape_Flags_UNKNOWN = 0,
   CursorShape_Flags_RESET_CACHE = 64,
   CursorShape_Flags_CACHE = 128,
-  CursorShape_Flags_CursorShape_Flags_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  CursorShape_Flags_CursorShape_Flags_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  CursorShape_Flags_CursorShape_Flags_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  CursorShape_Flags_CursorShape_Flags_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool CursorShape_Flags_IsValid(int value);
-const CursorShape_Flags CursorShape_Flags_Flags_MIN = CursorShape_Flags_UNKNOWN;
-const CursorShape_Flags CursorShape_Flags_Flags_MAX = CursorShape_Flags_CACHE;
-const int CursorShape_Flags_Flags_ARRAYSIZE = CursorShape_Flags_Flags_MAX + 1;
-
-enum VideoEncoding {
+constexpr CursorShape_Flags CursorShape_Flags_Flags_MIN = CursorShape_Flags_UNKNOWN;
+constexpr CursorShape_Flags CursorShape_Flags_Flags_MAX = CursorShape_Flags_CACHE;
+constexpr int CursorShape_Flags_Flags_ARRAYSIZE = CursorShape_Flags_Flags_MAX + 1;
+
+const std::string& CursorShape_Flags_Name(CursorShape_Flags value);
+template<typename T>
+inline const std::string& CursorShape_Flags_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, CursorShape_Flags>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function CursorShape_Flags_Name.");
+  return CursorShape_Flags_Name(static_cast<CursorShape_Flags>(enum_t_value));
+}
+bool CursorShape_Flags_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, CursorShape_Flags* value);
+enum Compression : int {
+  COMPRESSION_ZLIB = 0,
+  COMPRESSION_LZ4 = 1,
+  COMPRESSION_ZSTD = 2,
+  Compression_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Compression_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool Compression_IsValid(int value);
+constexpr Compression Compression_MIN = COMPRESSION_ZLIB;
+constexpr Compression Compression_MAX = COMPRESSION_ZSTD;
+constexpr int Compression_ARRAYSIZE = Compression_MAX + 1;
+
+const std::string& Compression_Name(Compression value);
+template<typename T>
+inline const std::string& Compression_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Compression>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Compression_Name.");
+  return Compression_Name(static_cast<Compression>(enum_t_value));
+}
+bool Compression_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Compression* value);
+enum VideoEncoding : int {
   VIDEO_ENCODING_UNKNOWN = 0,
   VIDEO_ENCODING_ZLIB = 1,
   VIDEO_ENCODING_VP8 = 2,
   VIDEO_ENCODING_VP9 = 4,
-  VideoEncoding_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  VideoEncoding_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  VIDEO_ENCODING_H264 = 8,
+  VIDEO_ENCODING_VP9_LOSSY = 16,
+  VIDEO_ENCODING_LZ4 = 32,
+  VIDEO_ENCODING_ZSTD = 64,
+  VIDEO_ENCODING_HYBRID = 128,
+  VIDEO_ENCODING_PALETTE = 256,
+  VIDEO_ENCODING_AV1 = 512,
+  VideoEncoding_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  VideoEncoding_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool VideoEncoding_IsValid(int value);
-const VideoEncoding VideoEncoding_MIN = VIDEO_ENCODING_UNKNOWN;
-const VideoEncoding VideoEncoding_MAX = VIDEO_ENCODING_VP9;
-const int VideoEncoding_ARRAYSIZE = VideoEncoding_MAX + 1;
-
-enum Feature {
+constexpr VideoEncoding VideoEncoding_MIN = VIDEO_ENCODING_UNKNOWN;
+constexpr VideoEncoding VideoEncoding_MAX = VIDEO_ENCODING_AV1;
+constexpr int VideoEncoding_ARRAYSIZE = VideoEncoding_MAX + 1;
+
+const std::string& VideoEncoding_Name(VideoEncoding value);
+template<typename T>
+inline const std::string& VideoEncoding_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, VideoEncoding>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function VideoEncoding_Name.");
+  return VideoEncoding_Name(static_cast<VideoEncoding>(enum_t_value));
+}
+bool VideoEncoding_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, VideoEncoding* value);
+enum Feature : int {
   FEATURE_NONE = 0,
   FEATURE_CURSOR_SHAPE = 1,
   FEATURE_CLIPBOARD = 2,
-  Feature_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  Feature_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  FEATURE_COPY_RECT = 4,
+  FEATURE_VIDEO_ACK = 8,
+  FEATURE_ZLIB_CHUNKS = 16,
+  FEATURE_ZLIB_STREAM = 32,
+  FEATURE_SCREEN_LIST = 64,
+  FEATURE_CURSOR_POSITION = 128,
+  FEATURE_CURSOR_CACHE = 256,
+  FEATURE_INPUT_EVENTS = 512,
+  FEATURE_CLIPBOARD_CHUNKS = 1024,
+  FEATURE_CLIPBOARD_COMPRESSION = 2048,
+  FEATURE_SCALING = 4096,
+  FEATURE_VISIBILITY = 8192,
+  FEATURE_PACKED_RECTS = 16384,
+  FEATURE_RESYNC = 32768,
+  FEATURE_LATENCY_PROBE = 65536,
+  FEATURE_REDUCED_EFFECTS = 131072,
+  FEATURE_VISIBLE_AREA = 262144,
+  Feature_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Feature_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool Feature_IsValid(int value);
-const Feature Feature_MIN = FEATURE_NONE;
-const Feature Feature_MAX = FEATURE_CLIPBOARD;
-const int Feature_ARRAYSIZE = Feature_MAX + 1;
-
+constexpr Feature Feature_MIN = FEATURE_NONE;
+constexpr Feature Feature_MAX = FEATURE_VISIBLE_AREA;
+constexpr int Feature_ARRAYSIZE = Feature_MAX + 1;
+
+const std::string& Feature_Name(Feature value);
+template<typename T>
+inline const std::string& Feature_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Feature>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Feature_Name.");
+  return Feature_Name(static_cast<Feature>(enum_t_value));
+}
+bool Feature_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Feature* value);
 // ===================================================================
 
-class KeyEvent : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.KeyEvent) */ {
+class KeyEvent final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.KeyEvent) */ {
  public:
-  KeyEvent();
-  virtual ~KeyEvent();
+  inline KeyEvent() : KeyEvent(nullptr) {}
+  ~KeyEvent() override;
+  explicit PROTOBUF_CONSTEXPR KeyEvent(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   KeyEvent(const KeyEvent& from);
-
-  inline KeyEvent& operator=(const KeyEvent& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   KeyEvent(KeyEvent&& from) noexcept
     : KeyEvent() {
     *this = ::std::move(from);
   }
 
+  inline KeyEvent& operator=(const KeyEvent& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline KeyEvent& operator=(KeyEvent&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const KeyEvent& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const KeyEvent& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const KeyEvent* internal_default_instance() {
     return reinterpret_cast<const KeyEvent*>(
                &_KeyEvent_default_instance_);
@@ -213,126 +384,181 @@ class KeyEvent : public ::google::protobuf::MessageLite /* @@protoc_insertion_po
   static constexpr int kIndexInFileMessages =
     0;
 
-  void Swap(KeyEvent* other);
   friend void swap(KeyEvent& a, KeyEvent& b) {
     a.Swap(&b);
   }
+  inline void Swap(KeyEvent* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(KeyEvent* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline KeyEvent* New() const final {
-    return CreateMaybeMessage<KeyEvent>(NULL);
-  }
-
-  KeyEvent* New(::google::protobuf::Arena* arena) const final {
+  KeyEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<KeyEvent>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const KeyEvent& from);
   void MergeFrom(const KeyEvent& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(KeyEvent* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.desktop.KeyEvent";
   }
+  protected:
+  explicit KeyEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   typedef KeyEvent_Flags Flags;
-  static const Flags UNKNOWN =
+  static constexpr Flags UNKNOWN =
     KeyEvent_Flags_UNKNOWN;
-  static const Flags CAPSLOCK =
+  static constexpr Flags CAPSLOCK =
     KeyEvent_Flags_CAPSLOCK;
-  static const Flags NUMLOCK =
+  static constexpr Flags NUMLOCK =
     KeyEvent_Flags_NUMLOCK;
-  static const Flags PRESSED =
+  static constexpr Flags PRESSED =
     KeyEvent_Flags_PRESSED;
   static inline bool Flags_IsValid(int value) {
     return KeyEvent_Flags_IsValid(value);
   }
-  static const Flags Flags_MIN =
+  static constexpr Flags Flags_MIN =
     KeyEvent_Flags_Flags_MIN;
-  static const Flags Flags_MAX =
+  static constexpr Flags Flags_MAX =
     KeyEvent_Flags_Flags_MAX;
-  static const int Flags_ARRAYSIZE =
+  static constexpr int Flags_ARRAYSIZE =
     KeyEvent_Flags_Flags_ARRAYSIZE;
+  template<typename T>
+  static inline const std::string& Flags_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Flags>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Flags_Name.");
+    return KeyEvent_Flags_Name(enum_t_value);
+  }
+  static inline bool Flags_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Flags* value) {
+    return KeyEvent_Flags_Parse(name, value);
+  }
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kUsbKeycodeFieldNumber = 1,
+    kFlagsFieldNumber = 2,
+    kProbeTimeFieldNumber = 3,
+  };
   // uint32 usb_keycode = 1;
   void clear_usb_keycode();
-  static const int kUsbKeycodeFieldNumber = 1;
-  ::google::protobuf::uint32 usb_keycode() const;
-  void set_usb_keycode(::google::protobuf::uint32 value);
+  uint32_t usb_keycode() const;
+  void set_usb_keycode(uint32_t value);
+  private:
+  uint32_t _internal_usb_keycode() const;
+  void _internal_set_usb_keycode(uint32_t value);
+  public:
 
   // uint32 flags = 2;
   void clear_flags();
-  static const int kFlagsFieldNumber = 2;
-  ::google::protobuf::uint32 flags() const;
-  void set_flags(::google::protobuf::uint32 value);
+  uint32_t flags() const;
+  void set_flags(uint32_t value);
+  private:
+  uint32_t _internal_flags() const;
+  void _internal_set_flags(uint32_t value);
+  public:
+
+  // int64 probe_time = 3;
+  void clear_probe_time();
+  int64_t probe_time() const;
+  void set_probe_time(int64_t value);
+  private:
+  int64_t _internal_probe_time() const;
+  void _internal_set_probe_time(int64_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:aspia.proto.desktop.KeyEvent)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::uint32 usb_keycode_;
-  ::google::protobuf::uint32 flags_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_desktop_5fsession_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t usb_keycode_;
+    uint32_t flags_;
+    int64_t probe_time_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_desktop_5fsession_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PointerEvent : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.PointerEvent) */ {
+class PointerEvent final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.PointerEvent) */ {
  public:
-  PointerEvent();
-  virtual ~PointerEvent();
+  inline PointerEvent() : PointerEvent(nullptr) {}
+  ~PointerEvent() override;
+  explicit PROTOBUF_CONSTEXPR PointerEvent(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PointerEvent(const PointerEvent& from);
-
-  inline PointerEvent& operator=(const PointerEvent& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   PointerEvent(PointerEvent&& from) noexcept
     : PointerEvent() {
     *this = ::std::move(from);
   }
 
+  inline PointerEvent& operator=(const PointerEvent& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline PointerEvent& operator=(PointerEvent&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const PointerEvent& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const PointerEvent& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PointerEvent* internal_default_instance() {
     return reinterpret_cast<const PointerEvent*>(
                &_PointerEvent_default_instance_);
@@ -340,137 +566,196 @@ class PointerEvent : public ::google::protobuf::MessageLite /* @@protoc_insertio
   static constexpr int kIndexInFileMessages =
     1;
 
-  void Swap(PointerEvent* other);
   friend void swap(PointerEvent& a, PointerEvent& b) {
     a.Swap(&b);
   }
+  inline void Swap(PointerEvent* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PointerEvent* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PointerEvent* New() const final {
-    return CreateMaybeMessage<PointerEvent>(NULL);
-  }
-
-  PointerEvent* New(::google::protobuf::Arena* arena) const final {
+  PointerEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<PointerEvent>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const PointerEvent& from);
   void MergeFrom(const PointerEvent& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(PointerEvent* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.desktop.PointerEvent";
   }
+  protected:
+  explicit PointerEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   typedef PointerEvent_ButtonMask ButtonMask;
-  static const ButtonMask EMPTY =
+  static constexpr ButtonMask EMPTY =
     PointerEvent_ButtonMask_EMPTY;
-  static const ButtonMask LEFT_BUTTON =
+  static constexpr ButtonMask LEFT_BUTTON =
     PointerEvent_ButtonMask_LEFT_BUTTON;
-  static const ButtonMask MIDDLE_BUTTON =
+  static constexpr ButtonMask MIDDLE_BUTTON =
     PointerEvent_ButtonMask_MIDDLE_BUTTON;
-  static const ButtonMask RIGHT_BUTTON =
+  static constexpr ButtonMask RIGHT_BUTTON =
     PointerEvent_ButtonMask_RIGHT_BUTTON;
-  static const ButtonMask WHEEL_UP =
+  static constexpr ButtonMask WHEEL_UP =
     PointerEvent_ButtonMask_WHEEL_UP;
-  static const ButtonMask WHEEL_DOWN =
+  static constexpr ButtonMask WHEEL_DOWN =
     PointerEvent_ButtonMask_WHEEL_DOWN;
   static inline bool ButtonMask_IsValid(int value) {
     return PointerEvent_ButtonMask_IsValid(value);
   }
-  static const ButtonMask ButtonMask_MIN =
+  static constexpr ButtonMask ButtonMask_MIN =
     PointerEvent_ButtonMask_ButtonMask_MIN;
-  static const ButtonMask ButtonMask_MAX =
+  static constexpr ButtonMask ButtonMask_MAX =
     PointerEvent_ButtonMask_ButtonMask_MAX;
-  static const int ButtonMask_ARRAYSIZE =
+  static constexpr int ButtonMask_ARRAYSIZE =
     PointerEvent_ButtonMask_ButtonMask_ARRAYSIZE;
+  template<typename T>
+  static inline const std::string& ButtonMask_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, ButtonMask>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function ButtonMask_Name.");
+    return PointerEvent_ButtonMask_Name(enum_t_value);
+  }
+  static inline bool ButtonMask_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      ButtonMask* value) {
+    return PointerEvent_ButtonMask_Parse(name, value);
+  }
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kMaskFieldNumber = 1,
+    kXFieldNumber = 2,
+    kProbeTimeFieldNumber = 4,
+    kYFieldNumber = 3,
+  };
   // uint32 mask = 1;
   void clear_mask();
-  static const int kMaskFieldNumber = 1;
-  ::google::protobuf::uint32 mask() const;
-  void set_mask(::google::protobuf::uint32 value);
+  uint32_t mask() const;
+  void set_mask(uint32_t value);
+  private:
+  uint32_t _internal_mask() const;
+  void _internal_set_mask(uint32_t value);
+  public:
 
   // int32 x = 2;
   void clear_x();
-  static const int kXFieldNumber = 2;
-  ::google::protobuf::int32 x() const;
-  void set_x(::google::protobuf::int32 value);
+  int32_t x() const;
+  void set_x(int32_t value);
+  private:
+  int32_t _internal_x() const;
+  void _internal_set_x(int32_t value);
+  public:
+
+  // int64 probe_time = 4;
+  void clear_probe_time();
+  int64_t probe_time() const;
+  void set_probe_time(int64_t value);
+  private:
+  int64_t _internal_probe_time() const;
+  void _internal_set_probe_time(int64_t value);
+  public:
 
   // int32 y = 3;
   void clear_y();
-  static const int kYFieldNumber = 3;
-  ::google::protobuf::int32 y() const;
-  void set_y(::google::protobuf::int32 value);
+  int32_t y() const;
+  void set_y(int32_t value);
+  private:
+  int32_t _internal_y() const;
+  void _internal_set_y(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:aspia.proto.desktop.PointerEvent)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::uint32 mask_;
-  ::google::protobuf::int32 x_;
-  ::google::protobuf::int32 y_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_desktop_5fsession_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t mask_;
+    int32_t x_;
+    int64_t probe_time_;
+    int32_t y_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_desktop_5fsession_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ClipboardEvent : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.ClipboardEvent) */ {
+class ClipboardEvent final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.ClipboardEvent) */ {
  public:
-  ClipboardEvent();
-  virtual ~ClipboardEvent();
+  inline ClipboardEvent() : ClipboardEvent(nullptr) {}
+  ~ClipboardEvent() override;
+  explicit PROTOBUF_CONSTEXPR ClipboardEvent(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ClipboardEvent(const ClipboardEvent& from);
-
-  inline ClipboardEvent& operator=(const ClipboardEvent& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   ClipboardEvent(ClipboardEvent&& from) noexcept
     : ClipboardEvent() {
     *this = ::std::move(from);
   }
 
+  inline ClipboardEvent& operator=(const ClipboardEvent& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline ClipboardEvent& operator=(ClipboardEvent&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ClipboardEvent& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ClipboardEvent& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const ClipboardEvent* internal_default_instance() {
     return reinterpret_cast<const ClipboardEvent*>(
                &_ClipboardEvent_default_instance_);
@@ -478,123 +763,244 @@ class ClipboardEvent : public ::google::protobuf::MessageLite /* @@protoc_insert
   static constexpr int kIndexInFileMessages =
     2;
 
-  void Swap(ClipboardEvent* other);
   friend void swap(ClipboardEvent& a, ClipboardEvent& b) {
     a.Swap(&b);
   }
+  inline void Swap(ClipboardEvent* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ClipboardEvent* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline ClipboardEvent* New() const final {
-    return CreateMaybeMessage<ClipboardEvent>(NULL);
-  }
-
-  ClipboardEvent* New(::google::protobuf::Arena* arena) const final {
+  ClipboardEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ClipboardEvent>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const ClipboardEvent& from);
   void MergeFrom(const ClipboardEvent& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(ClipboardEvent* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.desktop.ClipboardEvent";
   }
+  protected:
+  explicit ClipboardEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
+  typedef ClipboardEvent_Type Type;
+  static constexpr Type TYPE_DATA =
+    ClipboardEvent_Type_TYPE_DATA;
+  static constexpr Type TYPE_ANNOUNCE =
+    ClipboardEvent_Type_TYPE_ANNOUNCE;
+  static constexpr Type TYPE_REQUEST =
+    ClipboardEvent_Type_TYPE_REQUEST;
+  static inline bool Type_IsValid(int value) {
+    return ClipboardEvent_Type_IsValid(value);
+  }
+  static constexpr Type Type_MIN =
+    ClipboardEvent_Type_Type_MIN;
+  static constexpr Type Type_MAX =
+    ClipboardEvent_Type_Type_MAX;
+  static constexpr int Type_ARRAYSIZE =
+    ClipboardEvent_Type_Type_ARRAYSIZE;
+  template<typename T>
+  static inline const std::string& Type_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Type>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Type_Name.");
+    return ClipboardEvent_Type_Name(enum_t_value);
+  }
+  static inline bool Type_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Type* value) {
+    return ClipboardEvent_Type_Parse(name, value);
+  }
+
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kMimeTypeFieldNumber = 1,
+    kDataFieldNumber = 2,
+    kHashFieldNumber = 4,
+    kTypeFieldNumber = 3,
+    kSizeFieldNumber = 5,
+    kOffsetFieldNumber = 6,
+    kCompressionFieldNumber = 7,
+    kUncompressedSizeFieldNumber = 8,
+  };
   // string mime_type = 1;
   void clear_mime_type();
-  static const int kMimeTypeFieldNumber = 1;
-  const ::std::string& mime_type() const;
-  void set_mime_type(const ::std::string& value);
-  #if LANG_CXX11
-  void set_mime_type(::std::string&& value);
-  #endif
-  void set_mime_type(const char* value);
-  void set_mime_type(const char* value, size_t size);
-  ::std::string* mutable_mime_type();
-  ::std::string* release_mime_type();
-  void set_allocated_mime_type(::std::string* mime_type);
+  const std::string& mime_type() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_mime_type(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_mime_type();
+  PROTOBUF_NODISCARD std::string* release_mime_type();
+  void set_allocated_mime_type(std::string* mime_type);
+  private:
+  const std::string& _internal_mime_type() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_mime_type(const std::string& value);
+  std::string* _internal_mutable_mime_type();
+  public:
 
   // bytes data = 2;
   void clear_data();
-  static const int kDataFieldNumber = 2;
-  const ::std::string& data() const;
-  void set_data(const ::std::string& value);
-  #if LANG_CXX11
-  void set_data(::std::string&& value);
-  #endif
-  void set_data(const char* value);
-  void set_data(const void* value, size_t size);
-  ::std::string* mutable_data();
-  ::std::string* release_data();
-  void set_allocated_data(::std::string* data);
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
+
+  // fixed64 hash = 4;
+  void clear_hash();
+  uint64_t hash() const;
+  void set_hash(uint64_t value);
+  private:
+  uint64_t _internal_hash() const;
+  void _internal_set_hash(uint64_t value);
+  public:
+
+  // .aspia.proto.desktop.ClipboardEvent.Type type = 3;
+  void clear_type();
+  ::aspia::proto::desktop::ClipboardEvent_Type type() const;
+  void set_type(::aspia::proto::desktop::ClipboardEvent_Type value);
+  private:
+  ::aspia::proto::desktop::ClipboardEvent_Type _internal_type() const;
+  void _internal_set_type(::aspia::proto::desktop::ClipboardEvent_Type value);
+  public:
+
+  // uint32 size = 5;
+  void clear_size();
+  uint32_t size() const;
+  void set_size(uint32_t value);
+  private:
+  uint32_t _internal_size() const;
+  void _internal_set_size(uint32_t value);
+  public:
+
+  // uint32 offset = 6;
+  void clear_offset();
+  uint32_t offset() const;
+  void set_offset(uint32_t value);
+  private:
+  uint32_t _internal_offset() const;
+  void _internal_set_offset(uint32_t value);
+  public:
+
+  // .aspia.proto.desktop.Compression compression = 7;
+  void clear_compression();
+  ::aspia::proto::desktop::Compression compression() const;
+  void set_compression(::aspia::proto::desktop::Compression value);
+  private:
+  ::aspia::proto::desktop::Compression _internal_compression() const;
+  void _internal_set_compression(::aspia::proto::desktop::Compression value);
+  public:
+
+  // uint32 uncompressed_size = 8;
+  void clear_uncompressed_size();
+  uint32_t uncompressed_size() const;
+  void set_uncompressed_size(uint32_t value);
+  private:
+  uint32_t _internal_uncompressed_size() const;
+  void _internal_set_uncompressed_size(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:aspia.proto.desktop.ClipboardEvent)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr mime_type_;
-  ::google::protobuf::internal::ArenaStringPtr data_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_desktop_5fsession_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr mime_type_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    uint64_t hash_;
+    int type_;
+    uint32_t size_;
+    uint32_t offset_;
+    int compression_;
+    uint32_t uncompressed_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_desktop_5fsession_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CursorShape : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.CursorShape) */ {
+class CursorShape final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.CursorShape) */ {
  public:
-  CursorShape();
-  virtual ~CursorShape();
+  inline CursorShape() : CursorShape(nullptr) {}
+  ~CursorShape() override;
+  explicit PROTOBUF_CONSTEXPR CursorShape(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   CursorShape(const CursorShape& from);
-
-  inline CursorShape& operator=(const CursorShape& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   CursorShape(CursorShape&& from) noexcept
     : CursorShape() {
     *this = ::std::move(from);
   }
 
+  inline CursorShape& operator=(const CursorShape& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline CursorShape& operator=(CursorShape&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const CursorShape& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const CursorShape& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const CursorShape* internal_default_instance() {
     return reinterpret_cast<const CursorShape*>(
                &_CursorShape_default_instance_);
@@ -602,2666 +1008,9133 @@ class CursorShape : public ::google::protobuf::MessageLite /* @@protoc_insertion
   static constexpr int kIndexInFileMessages =
     3;
 
-  void Swap(CursorShape* other);
   friend void swap(CursorShape& a, CursorShape& b) {
     a.Swap(&b);
   }
+  inline void Swap(CursorShape* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CursorShape* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline CursorShape* New() const final {
-    return CreateMaybeMessage<CursorShape>(NULL);
-  }
-
-  CursorShape* New(::google::protobuf::Arena* arena) const final {
+  CursorShape* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<CursorShape>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const CursorShape& from);
   void MergeFrom(const CursorShape& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(CursorShape* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.desktop.CursorShape";
   }
+  protected:
+  explicit CursorShape(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   typedef CursorShape_Flags Flags;
-  static const Flags UNKNOWN =
+  static constexpr Flags UNKNOWN =
     CursorShape_Flags_UNKNOWN;
-  static const Flags RESET_CACHE =
+  static constexpr Flags RESET_CACHE =
     CursorShape_Flags_RESET_CACHE;
-  static const Flags CACHE =
+  static constexpr Flags CACHE =
     CursorShape_Flags_CACHE;
   static inline bool Flags_IsValid(int value) {
     return CursorShape_Flags_IsValid(value);
   }
-  static const Flags Flags_MIN =
+  static constexpr Flags Flags_MIN =
     CursorShape_Flags_Flags_MIN;
-  static const Flags Flags_MAX =
+  static constexpr Flags Flags_MAX =
     CursorShape_Flags_Flags_MAX;
-  static const int Flags_ARRAYSIZE =
+  static constexpr int Flags_ARRAYSIZE =
     CursorShape_Flags_Flags_ARRAYSIZE;
+  template<typename T>
+  static inline const std::string& Flags_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Flags>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Flags_Name.");
+    return CursorShape_Flags_Name(enum_t_value);
+  }
+  static inline bool Flags_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Flags* value) {
+    return CursorShape_Flags_Parse(name, value);
+  }
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kDataFieldNumber = 6,
+    kFlagsFieldNumber = 1,
+    kWidthFieldNumber = 2,
+    kHeightFieldNumber = 3,
+    kHotspotXFieldNumber = 4,
+    kHotspotYFieldNumber = 5,
+    kCompressionFieldNumber = 7,
+    kCacheIndexFieldNumber = 8,
+    kCacheSizeFieldNumber = 9,
+  };
   // bytes data = 6;
   void clear_data();
-  static const int kDataFieldNumber = 6;
-  const ::std::string& data() const;
-  void set_data(const ::std::string& value);
-  #if LANG_CXX11
-  void set_data(::std::string&& value);
-  #endif
-  void set_data(const char* value);
-  void set_data(const void* value, size_t size);
-  ::std::string* mutable_data();
-  ::std::string* release_data();
-  void set_allocated_data(::std::string* data);
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
 
   // uint32 flags = 1;
   void clear_flags();
-  static const int kFlagsFieldNumber = 1;
-  ::google::protobuf::uint32 flags() const;
-  void set_flags(::google::protobuf::uint32 value);
+  uint32_t flags() const;
+  void set_flags(uint32_t value);
+  private:
+  uint32_t _internal_flags() const;
+  void _internal_set_flags(uint32_t value);
+  public:
 
   // int32 width = 2;
   void clear_width();
-  static const int kWidthFieldNumber = 2;
-  ::google::protobuf::int32 width() const;
-  void set_width(::google::protobuf::int32 value);
+  int32_t width() const;
+  void set_width(int32_t value);
+  private:
+  int32_t _internal_width() const;
+  void _internal_set_width(int32_t value);
+  public:
 
   // int32 height = 3;
   void clear_height();
-  static const int kHeightFieldNumber = 3;
-  ::google::protobuf::int32 height() const;
-  void set_height(::google::protobuf::int32 value);
+  int32_t height() const;
+  void set_height(int32_t value);
+  private:
+  int32_t _internal_height() const;
+  void _internal_set_height(int32_t value);
+  public:
 
   // int32 hotspot_x = 4;
   void clear_hotspot_x();
-  static const int kHotspotXFieldNumber = 4;
-  ::google::protobuf::int32 hotspot_x() const;
-  void set_hotspot_x(::google::protobuf::int32 value);
+  int32_t hotspot_x() const;
+  void set_hotspot_x(int32_t value);
+  private:
+  int32_t _internal_hotspot_x() const;
+  void _internal_set_hotspot_x(int32_t value);
+  public:
 
   // int32 hotspot_y = 5;
   void clear_hotspot_y();
-  static const int kHotspotYFieldNumber = 5;
-  ::google::protobuf::int32 hotspot_y() const;
-  void set_hotspot_y(::google::protobuf::int32 value);
+  int32_t hotspot_y() const;
+  void set_hotspot_y(int32_t value);
+  private:
+  int32_t _internal_hotspot_y() const;
+  void _internal_set_hotspot_y(int32_t value);
+  public:
+
+  // .aspia.proto.desktop.Compression compression = 7;
+  void clear_compression();
+  ::aspia::proto::desktop::Compression compression() const;
+  void set_compression(::aspia::proto::desktop::Compression value);
+  private:
+  ::aspia::proto::desktop::Compression _internal_compression() const;
+  void _internal_set_compression(::aspia::proto::desktop::Compression value);
+  public:
+
+  // uint32 cache_index = 8;
+  void clear_cache_index();
+  uint32_t cache_index() const;
+  void set_cache_index(uint32_t value);
+  private:
+  uint32_t _internal_cache_index() const;
+  void _internal_set_cache_index(uint32_t value);
+  public:
+
+  // uint32 cache_size = 9;
+  void clear_cache_size();
+  uint32_t cache_size() const;
+  void set_cache_size(uint32_t value);
+  private:
+  uint32_t _internal_cache_size() const;
+  void _internal_set_cache_size(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:aspia.proto.desktop.CursorShape)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr data_;
-  ::google::protobuf::uint32 flags_;
-  ::google::protobuf::int32 width_;
-  ::google::protobuf::int32 height_;
-  ::google::protobuf::int32 hotspot_x_;
-  ::google::protobuf::int32 hotspot_y_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_desktop_5fsession_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    uint32_t flags_;
+    int32_t width_;
+    int32_t height_;
+    int32_t hotspot_x_;
+    int32_t hotspot_y_;
+    int compression_;
+    uint32_t cache_index_;
+    uint32_t cache_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_desktop_5fsession_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Rect : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.Rect) */ {
+class CursorPosition final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.CursorPosition) */ {
  public:
-  Rect();
-  virtual ~Rect();
+  inline CursorPosition() : CursorPosition(nullptr) {}
+  ~CursorPosition() override;
+  explicit PROTOBUF_CONSTEXPR CursorPosition(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Rect(const Rect& from);
+  CursorPosition(const CursorPosition& from);
+  CursorPosition(CursorPosition&& from) noexcept
+    : CursorPosition() {
+    *this = ::std::move(from);
+  }
 
-  inline Rect& operator=(const Rect& from) {
+  inline CursorPosition& operator=(const CursorPosition& from) {
     CopyFrom(from);
     return *this;
   }
-  #if LANG_CXX11
+  inline CursorPosition& operator=(CursorPosition&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const CursorPosition& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CursorPosition* internal_default_instance() {
+    return reinterpret_cast<const CursorPosition*>(
+               &_CursorPosition_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(CursorPosition& a, CursorPosition& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CursorPosition* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CursorPosition* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CursorPosition* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CursorPosition>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const CursorPosition& from);
+  void MergeFrom(const CursorPosition& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(CursorPosition* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.desktop.CursorPosition";
+  }
+  protected:
+  explicit CursorPosition(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kXFieldNumber = 1,
+    kYFieldNumber = 2,
+  };
+  // int32 x = 1;
+  void clear_x();
+  int32_t x() const;
+  void set_x(int32_t value);
+  private:
+  int32_t _internal_x() const;
+  void _internal_set_x(int32_t value);
+  public:
+
+  // int32 y = 2;
+  void clear_y();
+  int32_t y() const;
+  void set_y(int32_t value);
+  private:
+  int32_t _internal_y() const;
+  void _internal_set_y(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.desktop.CursorPosition)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t x_;
+    int32_t y_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_desktop_5fsession_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Rect final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.Rect) */ {
+ public:
+  inline Rect() : Rect(nullptr) {}
+  ~Rect() override;
+  explicit PROTOBUF_CONSTEXPR Rect(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Rect(const Rect& from);
   Rect(Rect&& from) noexcept
     : Rect() {
     *this = ::std::move(from);
   }
 
+  inline Rect& operator=(const Rect& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline Rect& operator=(Rect&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const Rect& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const Rect& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const Rect* internal_default_instance() {
     return reinterpret_cast<const Rect*>(
                &_Rect_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    4;
+    5;
 
-  void Swap(Rect* other);
   friend void swap(Rect& a, Rect& b) {
     a.Swap(&b);
   }
+  inline void Swap(Rect* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Rect* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Rect* New() const final {
-    return CreateMaybeMessage<Rect>(NULL);
-  }
-
-  Rect* New(::google::protobuf::Arena* arena) const final {
+  Rect* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Rect>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const Rect& from);
   void MergeFrom(const Rect& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(Rect* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.desktop.Rect";
   }
+  protected:
+  explicit Rect(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kXFieldNumber = 1,
+    kYFieldNumber = 2,
+    kWidthFieldNumber = 3,
+    kHeightFieldNumber = 4,
+  };
   // int32 x = 1;
   void clear_x();
-  static const int kXFieldNumber = 1;
-  ::google::protobuf::int32 x() const;
-  void set_x(::google::protobuf::int32 value);
+  int32_t x() const;
+  void set_x(int32_t value);
+  private:
+  int32_t _internal_x() const;
+  void _internal_set_x(int32_t value);
+  public:
 
   // int32 y = 2;
   void clear_y();
-  static const int kYFieldNumber = 2;
-  ::google::protobuf::int32 y() const;
-  void set_y(::google::protobuf::int32 value);
+  int32_t y() const;
+  void set_y(int32_t value);
+  private:
+  int32_t _internal_y() const;
+  void _internal_set_y(int32_t value);
+  public:
 
   // int32 width = 3;
   void clear_width();
-  static const int kWidthFieldNumber = 3;
-  ::google::protobuf::int32 width() const;
-  void set_width(::google::protobuf::int32 value);
+  int32_t width() const;
+  void set_width(int32_t value);
+  private:
+  int32_t _internal_width() const;
+  void _internal_set_width(int32_t value);
+  public:
 
   // int32 height = 4;
   void clear_height();
-  static const int kHeightFieldNumber = 4;
-  ::google::protobuf::int32 height() const;
-  void set_height(::google::protobuf::int32 value);
+  int32_t height() const;
+  void set_height(int32_t value);
+  private:
+  int32_t _internal_height() const;
+  void _internal_set_height(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:aspia.proto.desktop.Rect)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::int32 x_;
-  ::google::protobuf::int32 y_;
-  ::google::protobuf::int32 width_;
-  ::google::protobuf::int32 height_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_desktop_5fsession_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t x_;
+    int32_t y_;
+    int32_t width_;
+    int32_t height_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_desktop_5fsession_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PixelFormat : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.PixelFormat) */ {
+class PixelFormat final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.PixelFormat) */ {
  public:
-  PixelFormat();
-  virtual ~PixelFormat();
+  inline PixelFormat() : PixelFormat(nullptr) {}
+  ~PixelFormat() override;
+  explicit PROTOBUF_CONSTEXPR PixelFormat(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PixelFormat(const PixelFormat& from);
-
-  inline PixelFormat& operator=(const PixelFormat& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   PixelFormat(PixelFormat&& from) noexcept
     : PixelFormat() {
     *this = ::std::move(from);
   }
 
+  inline PixelFormat& operator=(const PixelFormat& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline PixelFormat& operator=(PixelFormat&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const PixelFormat& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const PixelFormat& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PixelFormat* internal_default_instance() {
     return reinterpret_cast<const PixelFormat*>(
                &_PixelFormat_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    5;
+    6;
 
-  void Swap(PixelFormat* other);
   friend void swap(PixelFormat& a, PixelFormat& b) {
     a.Swap(&b);
   }
+  inline void Swap(PixelFormat* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PixelFormat* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PixelFormat* New() const final {
-    return CreateMaybeMessage<PixelFormat>(NULL);
-  }
-
-  PixelFormat* New(::google::protobuf::Arena* arena) const final {
+  PixelFormat* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<PixelFormat>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const PixelFormat& from);
   void MergeFrom(const PixelFormat& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(PixelFormat* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.desktop.PixelFormat";
   }
+  protected:
+  explicit PixelFormat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kBitsPerPixelFieldNumber = 1,
+    kRedMaxFieldNumber = 2,
+    kGreenMaxFieldNumber = 3,
+    kBlueMaxFieldNumber = 4,
+    kRedShiftFieldNumber = 5,
+    kGreenShiftFieldNumber = 6,
+    kBlueShiftFieldNumber = 7,
+  };
   // uint32 bits_per_pixel = 1;
   void clear_bits_per_pixel();
-  static const int kBitsPerPixelFieldNumber = 1;
-  ::google::protobuf::uint32 bits_per_pixel() const;
-  void set_bits_per_pixel(::google::protobuf::uint32 value);
+  uint32_t bits_per_pixel() const;
+  void set_bits_per_pixel(uint32_t value);
+  private:
+  uint32_t _internal_bits_per_pixel() const;
+  void _internal_set_bits_per_pixel(uint32_t value);
+  public:
 
   // uint32 red_max = 2;
   void clear_red_max();
-  static const int kRedMaxFieldNumber = 2;
-  ::google::protobuf::uint32 red_max() const;
-  void set_red_max(::google::protobuf::uint32 value);
+  uint32_t red_max() const;
+  void set_red_max(uint32_t value);
+  private:
+  uint32_t _internal_red_max() const;
+  void _internal_set_red_max(uint32_t value);
+  public:
 
   // uint32 green_max = 3;
   void clear_green_max();
-  static const int kGreenMaxFieldNumber = 3;
-  ::google::protobuf::uint32 green_max() const;
-  void set_green_max(::google::protobuf::uint32 value);
+  uint32_t green_max() const;
+  void set_green_max(uint32_t value);
+  private:
+  uint32_t _internal_green_max() const;
+  void _internal_set_green_max(uint32_t value);
+  public:
 
   // uint32 blue_max = 4;
   void clear_blue_max();
-  static const int kBlueMaxFieldNumber = 4;
-  ::google::protobuf::uint32 blue_max() const;
-  void set_blue_max(::google::protobuf::uint32 value);
+  uint32_t blue_max() const;
+  void set_blue_max(uint32_t value);
+  private:
+  uint32_t _internal_blue_max() const;
+  void _internal_set_blue_max(uint32_t value);
+  public:
 
   // uint32 red_shift = 5;
   void clear_red_shift();
-  static const int kRedShiftFieldNumber = 5;
-  ::google::protobuf::uint32 red_shift() const;
-  void set_red_shift(::google::protobuf::uint32 value);
+  uint32_t red_shift() const;
+  void set_red_shift(uint32_t value);
+  private:
+  uint32_t _internal_red_shift() const;
+  void _internal_set_red_shift(uint32_t value);
+  public:
 
   // uint32 green_shift = 6;
   void clear_green_shift();
-  static const int kGreenShiftFieldNumber = 6;
-  ::google::protobuf::uint32 green_shift() const;
-  void set_green_shift(::google::protobuf::uint32 value);
+  uint32_t green_shift() const;
+  void set_green_shift(uint32_t value);
+  private:
+  uint32_t _internal_green_shift() const;
+  void _internal_set_green_shift(uint32_t value);
+  public:
 
   // uint32 blue_shift = 7;
   void clear_blue_shift();
-  static const int kBlueShiftFieldNumber = 7;
-  ::google::protobuf::uint32 blue_shift() const;
-  void set_blue_shift(::google::protobuf::uint32 value);
+  uint32_t blue_shift() const;
+  void set_blue_shift(uint32_t value);
+  private:
+  uint32_t _internal_blue_shift() const;
+  void _internal_set_blue_shift(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:aspia.proto.desktop.PixelFormat)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::uint32 bits_per_pixel_;
-  ::google::protobuf::uint32 red_max_;
-  ::google::protobuf::uint32 green_max_;
-  ::google::protobuf::uint32 blue_max_;
-  ::google::protobuf::uint32 red_shift_;
-  ::google::protobuf::uint32 green_shift_;
-  ::google::protobuf::uint32 blue_shift_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_desktop_5fsession_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t bits_per_pixel_;
+    uint32_t red_max_;
+    uint32_t green_max_;
+    uint32_t blue_max_;
+    uint32_t red_shift_;
+    uint32_t green_shift_;
+    uint32_t blue_shift_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_desktop_5fsession_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Size : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.Size) */ {
+class Size final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.Size) */ {
  public:
-  Size();
-  virtual ~Size();
+  inline Size() : Size(nullptr) {}
+  ~Size() override;
+  explicit PROTOBUF_CONSTEXPR Size(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Size(const Size& from);
-
-  inline Size& operator=(const Size& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   Size(Size&& from) noexcept
     : Size() {
     *this = ::std::move(from);
   }
 
+  inline Size& operator=(const Size& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline Size& operator=(Size&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const Size& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const Size& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const Size* internal_default_instance() {
     return reinterpret_cast<const Size*>(
                &_Size_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    6;
+    7;
 
-  void Swap(Size* other);
   friend void swap(Size& a, Size& b) {
     a.Swap(&b);
   }
+  inline void Swap(Size* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Size* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Size* New() const final {
-    return CreateMaybeMessage<Size>(NULL);
-  }
-
-  Size* New(::google::protobuf::Arena* arena) const final {
+  Size* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Size>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const Size& from);
   void MergeFrom(const Size& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(Size* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.desktop.Size";
   }
+  protected:
+  explicit Size(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kWidthFieldNumber = 1,
+    kHeightFieldNumber = 2,
+  };
   // int32 width = 1;
   void clear_width();
-  static const int kWidthFieldNumber = 1;
-  ::google::protobuf::int32 width() const;
-  void set_width(::google::protobuf::int32 value);
+  int32_t width() const;
+  void set_width(int32_t value);
+  private:
+  int32_t _internal_width() const;
+  void _internal_set_width(int32_t value);
+  public:
 
   // int32 height = 2;
   void clear_height();
-  static const int kHeightFieldNumber = 2;
-  ::google::protobuf::int32 height() const;
-  void set_height(::google::protobuf::int32 value);
+  int32_t height() const;
+  void set_height(int32_t value);
+  private:
+  int32_t _internal_height() const;
+  void _internal_set_height(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:aspia.proto.desktop.Size)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::int32 width_;
-  ::google::protobuf::int32 height_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_desktop_5fsession_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t width_;
+    int32_t height_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_desktop_5fsession_2eproto;
 };
 // -------------------------------------------------------------------
 
-class VideoPacketFormat : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.VideoPacketFormat) */ {
+class VideoPacketFormat final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.VideoPacketFormat) */ {
  public:
-  VideoPacketFormat();
-  virtual ~VideoPacketFormat();
+  inline VideoPacketFormat() : VideoPacketFormat(nullptr) {}
+  ~VideoPacketFormat() override;
+  explicit PROTOBUF_CONSTEXPR VideoPacketFormat(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   VideoPacketFormat(const VideoPacketFormat& from);
-
-  inline VideoPacketFormat& operator=(const VideoPacketFormat& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   VideoPacketFormat(VideoPacketFormat&& from) noexcept
     : VideoPacketFormat() {
     *this = ::std::move(from);
   }
 
+  inline VideoPacketFormat& operator=(const VideoPacketFormat& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline VideoPacketFormat& operator=(VideoPacketFormat&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const VideoPacketFormat& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const VideoPacketFormat& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const VideoPacketFormat* internal_default_instance() {
     return reinterpret_cast<const VideoPacketFormat*>(
                &_VideoPacketFormat_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    7;
+    8;
 
-  void Swap(VideoPacketFormat* other);
   friend void swap(VideoPacketFormat& a, VideoPacketFormat& b) {
     a.Swap(&b);
   }
+  inline void Swap(VideoPacketFormat* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(VideoPacketFormat* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline VideoPacketFormat* New() const final {
-    return CreateMaybeMessage<VideoPacketFormat>(NULL);
-  }
-
-  VideoPacketFormat* New(::google::protobuf::Arena* arena) const final {
+  VideoPacketFormat* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<VideoPacketFormat>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const VideoPacketFormat& from);
   void MergeFrom(const VideoPacketFormat& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(VideoPacketFormat* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.desktop.VideoPacketFormat";
   }
+  protected:
+  explicit VideoPacketFormat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kScreenSizeFieldNumber = 1,
+    kPixelFormatFieldNumber = 2,
+    kTileCacheSizeFieldNumber = 3,
+  };
   // .aspia.proto.desktop.Size screen_size = 1;
   bool has_screen_size() const;
-  void clear_screen_size();
-  static const int kScreenSizeFieldNumber = 1;
   private:
-  const ::aspia::proto::desktop::Size& _internal_screen_size() const;
+  bool _internal_has_screen_size() const;
   public:
+  void clear_screen_size();
   const ::aspia::proto::desktop::Size& screen_size() const;
-  ::aspia::proto::desktop::Size* release_screen_size();
+  PROTOBUF_NODISCARD ::aspia::proto::desktop::Size* release_screen_size();
   ::aspia::proto::desktop::Size* mutable_screen_size();
   void set_allocated_screen_size(::aspia::proto::desktop::Size* screen_size);
+  private:
+  const ::aspia::proto::desktop::Size& _internal_screen_size() const;
+  ::aspia::proto::desktop::Size* _internal_mutable_screen_size();
+  public:
+  void unsafe_arena_set_allocated_screen_size(
+      ::aspia::proto::desktop::Size* screen_size);
+  ::aspia::proto::desktop::Size* unsafe_arena_release_screen_size();
 
   // .aspia.proto.desktop.PixelFormat pixel_format = 2;
   bool has_pixel_format() const;
-  void clear_pixel_format();
-  static const int kPixelFormatFieldNumber = 2;
   private:
-  const ::aspia::proto::desktop::PixelFormat& _internal_pixel_format() const;
+  bool _internal_has_pixel_format() const;
   public:
+  void clear_pixel_format();
   const ::aspia::proto::desktop::PixelFormat& pixel_format() const;
-  ::aspia::proto::desktop::PixelFormat* release_pixel_format();
+  PROTOBUF_NODISCARD ::aspia::proto::desktop::PixelFormat* release_pixel_format();
   ::aspia::proto::desktop::PixelFormat* mutable_pixel_format();
   void set_allocated_pixel_format(::aspia::proto::desktop::PixelFormat* pixel_format);
+  private:
+  const ::aspia::proto::desktop::PixelFormat& _internal_pixel_format() const;
+  ::aspia::proto::desktop::PixelFormat* _internal_mutable_pixel_format();
+  public:
+  void unsafe_arena_set_allocated_pixel_format(
+      ::aspia::proto::desktop::PixelFormat* pixel_format);
+  ::aspia::proto::desktop::PixelFormat* unsafe_arena_release_pixel_format();
+
+  // uint32 tile_cache_size = 3;
+  void clear_tile_cache_size();
+  uint32_t tile_cache_size() const;
+  void set_tile_cache_size(uint32_t value);
+  private:
+  uint32_t _internal_tile_cache_size() const;
+  void _internal_set_tile_cache_size(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:aspia.proto.desktop.VideoPacketFormat)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::aspia::proto::desktop::Size* screen_size_;
-  ::aspia::proto::desktop::PixelFormat* pixel_format_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_desktop_5fsession_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::aspia::proto::desktop::Size* screen_size_;
+    ::aspia::proto::desktop::PixelFormat* pixel_format_;
+    uint32_t tile_cache_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_desktop_5fsession_2eproto;
 };
 // -------------------------------------------------------------------
 
-class VideoPacket : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.VideoPacket) */ {
+class CopyRect final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.CopyRect) */ {
  public:
-  VideoPacket();
-  virtual ~VideoPacket();
+  inline CopyRect() : CopyRect(nullptr) {}
+  ~CopyRect() override;
+  explicit PROTOBUF_CONSTEXPR CopyRect(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  VideoPacket(const VideoPacket& from);
+  CopyRect(const CopyRect& from);
+  CopyRect(CopyRect&& from) noexcept
+    : CopyRect() {
+    *this = ::std::move(from);
+  }
 
-  inline VideoPacket& operator=(const VideoPacket& from) {
+  inline CopyRect& operator=(const CopyRect& from) {
     CopyFrom(from);
     return *this;
   }
-  #if LANG_CXX11
+  inline CopyRect& operator=(CopyRect&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const CopyRect& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CopyRect* internal_default_instance() {
+    return reinterpret_cast<const CopyRect*>(
+               &_CopyRect_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(CopyRect& a, CopyRect& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CopyRect* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CopyRect* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CopyRect* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CopyRect>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const CopyRect& from);
+  void MergeFrom(const CopyRect& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(CopyRect* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.desktop.CopyRect";
+  }
+  protected:
+  explicit CopyRect(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTargetRectFieldNumber = 3,
+    kSourceXFieldNumber = 1,
+    kSourceYFieldNumber = 2,
+  };
+  // .aspia.proto.desktop.Rect target_rect = 3;
+  bool has_target_rect() const;
+  private:
+  bool _internal_has_target_rect() const;
+  public:
+  void clear_target_rect();
+  const ::aspia::proto::desktop::Rect& target_rect() const;
+  PROTOBUF_NODISCARD ::aspia::proto::desktop::Rect* release_target_rect();
+  ::aspia::proto::desktop::Rect* mutable_target_rect();
+  void set_allocated_target_rect(::aspia::proto::desktop::Rect* target_rect);
+  private:
+  const ::aspia::proto::desktop::Rect& _internal_target_rect() const;
+  ::aspia::proto::desktop::Rect* _internal_mutable_target_rect();
+  public:
+  void unsafe_arena_set_allocated_target_rect(
+      ::aspia::proto::desktop::Rect* target_rect);
+  ::aspia::proto::desktop::Rect* unsafe_arena_release_target_rect();
+
+  // int32 source_x = 1;
+  void clear_source_x();
+  int32_t source_x() const;
+  void set_source_x(int32_t value);
+  private:
+  int32_t _internal_source_x() const;
+  void _internal_set_source_x(int32_t value);
+  public:
+
+  // int32 source_y = 2;
+  void clear_source_y();
+  int32_t source_y() const;
+  void set_source_y(int32_t value);
+  private:
+  int32_t _internal_source_y() const;
+  void _internal_set_source_y(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.desktop.CopyRect)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::aspia::proto::desktop::Rect* target_rect_;
+    int32_t source_x_;
+    int32_t source_y_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_desktop_5fsession_2eproto;
+};
+// -------------------------------------------------------------------
+
+class VideoPacket final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.VideoPacket) */ {
+ public:
+  inline VideoPacket() : VideoPacket(nullptr) {}
+  ~VideoPacket() override;
+  explicit PROTOBUF_CONSTEXPR VideoPacket(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  VideoPacket(const VideoPacket& from);
   VideoPacket(VideoPacket&& from) noexcept
     : VideoPacket() {
     *this = ::std::move(from);
   }
 
+  inline VideoPacket& operator=(const VideoPacket& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline VideoPacket& operator=(VideoPacket&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const VideoPacket& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const VideoPacket& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const VideoPacket* internal_default_instance() {
     return reinterpret_cast<const VideoPacket*>(
                &_VideoPacket_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    8;
+    10;
 
-  void Swap(VideoPacket* other);
   friend void swap(VideoPacket& a, VideoPacket& b) {
     a.Swap(&b);
   }
+  inline void Swap(VideoPacket* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(VideoPacket* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline VideoPacket* New() const final {
-    return CreateMaybeMessage<VideoPacket>(NULL);
-  }
-
-  VideoPacket* New(::google::protobuf::Arena* arena) const final {
+  VideoPacket* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<VideoPacket>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const VideoPacket& from);
   void MergeFrom(const VideoPacket& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(VideoPacket* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.desktop.VideoPacket";
   }
+  protected:
+  explicit VideoPacket(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kDirtyRectFieldNumber = 3,
+    kCopyRectFieldNumber = 5,
+    kChunkFieldNumber = 7,
+    kLayerFieldNumber = 9,
+    kDataFieldNumber = 4,
+    kPackedDirtyRectFieldNumber = 14,
+    kFormatFieldNumber = 2,
+    kEncodingFieldNumber = 1,
+    kFrameIdFieldNumber = 6,
+    kPersistentStreamFieldNumber = 8,
+    kTemporalLayerFieldNumber = 10,
+    kCaptureTimeFieldNumber = 12,
+    kTraceIdFieldNumber = 11,
+    kEncodeTimeFieldNumber = 13,
+    kPsnrFieldNumber = 15,
+    kSsimFieldNumber = 16,
+  };
   // repeated .aspia.proto.desktop.Rect dirty_rect = 3;
   int dirty_rect_size() const;
+  private:
+  int _internal_dirty_rect_size() const;
+  public:
   void clear_dirty_rect();
-  static const int kDirtyRectFieldNumber = 3;
   ::aspia::proto::desktop::Rect* mutable_dirty_rect(int index);
-  ::google::protobuf::RepeatedPtrField< ::aspia::proto::desktop::Rect >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::desktop::Rect >*
       mutable_dirty_rect();
+  private:
+  const ::aspia::proto::desktop::Rect& _internal_dirty_rect(int index) const;
+  ::aspia::proto::desktop::Rect* _internal_add_dirty_rect();
+  public:
   const ::aspia::proto::desktop::Rect& dirty_rect(int index) const;
   ::aspia::proto::desktop::Rect* add_dirty_rect();
-  const ::google::protobuf::RepeatedPtrField< ::aspia::proto::desktop::Rect >&
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::desktop::Rect >&
       dirty_rect() const;
 
+  // repeated .aspia.proto.desktop.CopyRect copy_rect = 5;
+  int copy_rect_size() const;
+  private:
+  int _internal_copy_rect_size() const;
+  public:
+  void clear_copy_rect();
+  ::aspia::proto::desktop::CopyRect* mutable_copy_rect(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::desktop::CopyRect >*
+      mutable_copy_rect();
+  private:
+  const ::aspia::proto::desktop::CopyRect& _internal_copy_rect(int index) const;
+  ::aspia::proto::desktop::CopyRect* _internal_add_copy_rect();
+  public:
+  const ::aspia::proto::desktop::CopyRect& copy_rect(int index) const;
+  ::aspia::proto::desktop::CopyRect* add_copy_rect();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::desktop::CopyRect >&
+      copy_rect() const;
+
+  // repeated bytes chunk = 7;
+  int chunk_size() const;
+  private:
+  int _internal_chunk_size() const;
+  public:
+  void clear_chunk();
+  const std::string& chunk(int index) const;
+  std::string* mutable_chunk(int index);
+  void set_chunk(int index, const std::string& value);
+  void set_chunk(int index, std::string&& value);
+  void set_chunk(int index, const char* value);
+  void set_chunk(int index, const void* value, size_t size);
+  std::string* add_chunk();
+  void add_chunk(const std::string& value);
+  void add_chunk(std::string&& value);
+  void add_chunk(const char* value);
+  void add_chunk(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& chunk() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_chunk();
+  private:
+  const std::string& _internal_chunk(int index) const;
+  std::string* _internal_add_chunk();
+  public:
+
+  // repeated .aspia.proto.desktop.VideoPacket layer = 9;
+  int layer_size() const;
+  private:
+  int _internal_layer_size() const;
+  public:
+  void clear_layer();
+  ::aspia::proto::desktop::VideoPacket* mutable_layer(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::desktop::VideoPacket >*
+      mutable_layer();
+  private:
+  const ::aspia::proto::desktop::VideoPacket& _internal_layer(int index) const;
+  ::aspia::proto::desktop::VideoPacket* _internal_add_layer();
+  public:
+  const ::aspia::proto::desktop::VideoPacket& layer(int index) const;
+  ::aspia::proto::desktop::VideoPacket* add_layer();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::desktop::VideoPacket >&
+      layer() const;
+
   // bytes data = 4;
   void clear_data();
-  static const int kDataFieldNumber = 4;
-  const ::std::string& data() const;
-  void set_data(const ::std::string& value);
-  #if LANG_CXX11
-  void set_data(::std::string&& value);
-  #endif
-  void set_data(const char* value);
-  void set_data(const void* value, size_t size);
-  ::std::string* mutable_data();
-  ::std::string* release_data();
-  void set_allocated_data(::std::string* data);
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
+
+  // bytes packed_dirty_rect = 14;
+  void clear_packed_dirty_rect();
+  const std::string& packed_dirty_rect() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_packed_dirty_rect(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_packed_dirty_rect();
+  PROTOBUF_NODISCARD std::string* release_packed_dirty_rect();
+  void set_allocated_packed_dirty_rect(std::string* packed_dirty_rect);
+  private:
+  const std::string& _internal_packed_dirty_rect() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_packed_dirty_rect(const std::string& value);
+  std::string* _internal_mutable_packed_dirty_rect();
+  public:
 
   // .aspia.proto.desktop.VideoPacketFormat format = 2;
   bool has_format() const;
-  void clear_format();
-  static const int kFormatFieldNumber = 2;
   private:
-  const ::aspia::proto::desktop::VideoPacketFormat& _internal_format() const;
+  bool _internal_has_format() const;
   public:
+  void clear_format();
   const ::aspia::proto::desktop::VideoPacketFormat& format() const;
-  ::aspia::proto::desktop::VideoPacketFormat* release_format();
+  PROTOBUF_NODISCARD ::aspia::proto::desktop::VideoPacketFormat* release_format();
   ::aspia::proto::desktop::VideoPacketFormat* mutable_format();
   void set_allocated_format(::aspia::proto::desktop::VideoPacketFormat* format);
+  private:
+  const ::aspia::proto::desktop::VideoPacketFormat& _internal_format() const;
+  ::aspia::proto::desktop::VideoPacketFormat* _internal_mutable_format();
+  public:
+  void unsafe_arena_set_allocated_format(
+      ::aspia::proto::desktop::VideoPacketFormat* format);
+  ::aspia::proto::desktop::VideoPacketFormat* unsafe_arena_release_format();
 
   // .aspia.proto.desktop.VideoEncoding encoding = 1;
   void clear_encoding();
-  static const int kEncodingFieldNumber = 1;
   ::aspia::proto::desktop::VideoEncoding encoding() const;
   void set_encoding(::aspia::proto::desktop::VideoEncoding value);
+  private:
+  ::aspia::proto::desktop::VideoEncoding _internal_encoding() const;
+  void _internal_set_encoding(::aspia::proto::desktop::VideoEncoding value);
+  public:
+
+  // uint32 frame_id = 6;
+  void clear_frame_id();
+  uint32_t frame_id() const;
+  void set_frame_id(uint32_t value);
+  private:
+  uint32_t _internal_frame_id() const;
+  void _internal_set_frame_id(uint32_t value);
+  public:
+
+  // bool persistent_stream = 8;
+  void clear_persistent_stream();
+  bool persistent_stream() const;
+  void set_persistent_stream(bool value);
+  private:
+  bool _internal_persistent_stream() const;
+  void _internal_set_persistent_stream(bool value);
+  public:
+
+  // uint32 temporal_layer = 10;
+  void clear_temporal_layer();
+  uint32_t temporal_layer() const;
+  void set_temporal_layer(uint32_t value);
+  private:
+  uint32_t _internal_temporal_layer() const;
+  void _internal_set_temporal_layer(uint32_t value);
+  public:
+
+  // int64 capture_time = 12;
+  void clear_capture_time();
+  int64_t capture_time() const;
+  void set_capture_time(int64_t value);
+  private:
+  int64_t _internal_capture_time() const;
+  void _internal_set_capture_time(int64_t value);
+  public:
+
+  // uint32 trace_id = 11;
+  void clear_trace_id();
+  uint32_t trace_id() const;
+  void set_trace_id(uint32_t value);
+  private:
+  uint32_t _internal_trace_id() const;
+  void _internal_set_trace_id(uint32_t value);
+  public:
+
+  // uint32 encode_time = 13;
+  void clear_encode_time();
+  uint32_t encode_time() const;
+  void set_encode_time(uint32_t value);
+  private:
+  uint32_t _internal_encode_time() const;
+  void _internal_set_encode_time(uint32_t value);
+  public:
+
+  // float psnr = 15;
+  void clear_psnr();
+  float psnr() const;
+  void set_psnr(float value);
+  private:
+  float _internal_psnr() const;
+  void _internal_set_psnr(float value);
+  public:
+
+  // float ssim = 16;
+  void clear_ssim();
+  float ssim() const;
+  void set_ssim(float value);
+  private:
+  float _internal_ssim() const;
+  void _internal_set_ssim(float value);
+  public:
 
   // @@protoc_insertion_point(class_scope:aspia.proto.desktop.VideoPacket)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::RepeatedPtrField< ::aspia::proto::desktop::Rect > dirty_rect_;
-  ::google::protobuf::internal::ArenaStringPtr data_;
-  ::aspia::proto::desktop::VideoPacketFormat* format_;
-  int encoding_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_desktop_5fsession_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::desktop::Rect > dirty_rect_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::desktop::CopyRect > copy_rect_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> chunk_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::desktop::VideoPacket > layer_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr packed_dirty_rect_;
+    ::aspia::proto::desktop::VideoPacketFormat* format_;
+    int encoding_;
+    uint32_t frame_id_;
+    bool persistent_stream_;
+    uint32_t temporal_layer_;
+    int64_t capture_time_;
+    uint32_t trace_id_;
+    uint32_t encode_time_;
+    float psnr_;
+    float ssim_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_desktop_5fsession_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ConfigRequest : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.ConfigRequest) */ {
+class ConfigRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.ConfigRequest) */ {
  public:
-  ConfigRequest();
-  virtual ~ConfigRequest();
+  inline ConfigRequest() : ConfigRequest(nullptr) {}
+  ~ConfigRequest() override;
+  explicit PROTOBUF_CONSTEXPR ConfigRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ConfigRequest(const ConfigRequest& from);
-
-  inline ConfigRequest& operator=(const ConfigRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   ConfigRequest(ConfigRequest&& from) noexcept
     : ConfigRequest() {
     *this = ::std::move(from);
   }
 
+  inline ConfigRequest& operator=(const ConfigRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline ConfigRequest& operator=(ConfigRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ConfigRequest& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ConfigRequest& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const ConfigRequest* internal_default_instance() {
     return reinterpret_cast<const ConfigRequest*>(
                &_ConfigRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    9;
+    11;
 
-  void Swap(ConfigRequest* other);
   friend void swap(ConfigRequest& a, ConfigRequest& b) {
     a.Swap(&b);
   }
+  inline void Swap(ConfigRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ConfigRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline ConfigRequest* New() const final {
-    return CreateMaybeMessage<ConfigRequest>(NULL);
-  }
-
-  ConfigRequest* New(::google::protobuf::Arena* arena) const final {
+  ConfigRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ConfigRequest>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const ConfigRequest& from);
   void MergeFrom(const ConfigRequest& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(ConfigRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.desktop.ConfigRequest";
   }
+  protected:
+  explicit ConfigRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kVideoEncodingsFieldNumber = 1,
+    kFeaturesFieldNumber = 2,
+  };
   // uint32 video_encodings = 1;
   void clear_video_encodings();
-  static const int kVideoEncodingsFieldNumber = 1;
-  ::google::protobuf::uint32 video_encodings() const;
-  void set_video_encodings(::google::protobuf::uint32 value);
+  uint32_t video_encodings() const;
+  void set_video_encodings(uint32_t value);
+  private:
+  uint32_t _internal_video_encodings() const;
+  void _internal_set_video_encodings(uint32_t value);
+  public:
 
   // uint32 features = 2;
   void clear_features();
-  static const int kFeaturesFieldNumber = 2;
-  ::google::protobuf::uint32 features() const;
-  void set_features(::google::protobuf::uint32 value);
+  uint32_t features() const;
+  void set_features(uint32_t value);
+  private:
+  uint32_t _internal_features() const;
+  void _internal_set_features(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:aspia.proto.desktop.ConfigRequest)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::uint32 video_encodings_;
-  ::google::protobuf::uint32 features_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_desktop_5fsession_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t video_encodings_;
+    uint32_t features_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_desktop_5fsession_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Config : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.Config) */ {
+class FrameHashes final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.FrameHashes) */ {
  public:
-  Config();
-  virtual ~Config();
+  inline FrameHashes() : FrameHashes(nullptr) {}
+  ~FrameHashes() override;
+  explicit PROTOBUF_CONSTEXPR FrameHashes(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Config(const Config& from);
+  FrameHashes(const FrameHashes& from);
+  FrameHashes(FrameHashes&& from) noexcept
+    : FrameHashes() {
+    *this = ::std::move(from);
+  }
 
-  inline Config& operator=(const Config& from) {
+  inline FrameHashes& operator=(const FrameHashes& from) {
     CopyFrom(from);
     return *this;
   }
-  #if LANG_CXX11
-  Config(Config&& from) noexcept
-    : Config() {
-    *this = ::std::move(from);
-  }
-
-  inline Config& operator=(Config&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline FrameHashes& operator=(FrameHashes&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const Config& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const Config* internal_default_instance() {
-    return reinterpret_cast<const Config*>(
-               &_Config_default_instance_);
+  static const FrameHashes& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FrameHashes* internal_default_instance() {
+    return reinterpret_cast<const FrameHashes*>(
+               &_FrameHashes_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    10;
+    12;
 
-  void Swap(Config* other);
-  friend void swap(Config& a, Config& b) {
+  friend void swap(FrameHashes& a, FrameHashes& b) {
     a.Swap(&b);
   }
+  inline void Swap(FrameHashes* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FrameHashes* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Config* New() const final {
-    return CreateMaybeMessage<Config>(NULL);
-  }
-
-  Config* New(::google::protobuf::Arena* arena) const final {
-    return CreateMaybeMessage<Config>(arena);
+  FrameHashes* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FrameHashes>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
-  void CopyFrom(const Config& from);
-  void MergeFrom(const Config& from);
-  void Clear() final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const FrameHashes& from);
+  void MergeFrom(const FrameHashes& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(Config* other);
+  void InternalSwap(FrameHashes* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.desktop.FrameHashes";
+  }
+  protected:
+  explicit FrameHashes(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHashFieldNumber = 3,
+    kScreenSizeFieldNumber = 1,
+    kTileSizeFieldNumber = 2,
+  };
+  // repeated fixed64 hash = 3;
+  int hash_size() const;
+  private:
+  int _internal_hash_size() const;
+  public:
+  void clear_hash();
+  private:
+  uint64_t _internal_hash(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_hash() const;
+  void _internal_add_hash(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_hash();
+  public:
+  uint64_t hash(int index) const;
+  void set_hash(int index, uint64_t value);
+  void add_hash(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      hash() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_hash();
+
+  // .aspia.proto.desktop.Size screen_size = 1;
+  bool has_screen_size() const;
+  private:
+  bool _internal_has_screen_size() const;
+  public:
+  void clear_screen_size();
+  const ::aspia::proto::desktop::Size& screen_size() const;
+  PROTOBUF_NODISCARD ::aspia::proto::desktop::Size* release_screen_size();
+  ::aspia::proto::desktop::Size* mutable_screen_size();
+  void set_allocated_screen_size(::aspia::proto::desktop::Size* screen_size);
+  private:
+  const ::aspia::proto::desktop::Size& _internal_screen_size() const;
+  ::aspia::proto::desktop::Size* _internal_mutable_screen_size();
+  public:
+  void unsafe_arena_set_allocated_screen_size(
+      ::aspia::proto::desktop::Size* screen_size);
+  ::aspia::proto::desktop::Size* unsafe_arena_release_screen_size();
+
+  // uint32 tile_size = 2;
+  void clear_tile_size();
+  uint32_t tile_size() const;
+  void set_tile_size(uint32_t value);
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+  uint32_t _internal_tile_size() const;
+  void _internal_set_tile_size(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.desktop.FrameHashes)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > hash_;
+    ::aspia::proto::desktop::Size* screen_size_;
+    uint32_t tile_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_desktop_5fsession_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Config final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.Config) */ {
+ public:
+  inline Config() : Config(nullptr) {}
+  ~Config() override;
+  explicit PROTOBUF_CONSTEXPR Config(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Config(const Config& from);
+  Config(Config&& from) noexcept
+    : Config() {
+    *this = ::std::move(from);
+  }
+
+  inline Config& operator=(const Config& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Config& operator=(Config&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const Config& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Config* internal_default_instance() {
+    return reinterpret_cast<const Config*>(
+               &_Config_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(Config& a, Config& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Config* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Config* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
   }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+
+  // implements Message ----------------------------------------------
+
+  Config* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Config>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const Config& from);
+  void MergeFrom(const Config& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(Config* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.desktop.Config";
   }
+  protected:
+  explicit Config(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kCursorCacheFieldNumber = 8,
+    kPixelFormatFieldNumber = 3,
+    kViewportFieldNumber = 11,
+    kFrameHashesFieldNumber = 14,
+    kFeaturesFieldNumber = 1,
+    kVideoEncodingFieldNumber = 2,
+    kUpdateIntervalFieldNumber = 4,
+    kCompressRatioFieldNumber = 5,
+    kEncoderThreadsFieldNumber = 6,
+    kEncoderTileColumnsFieldNumber = 7,
+    kCursorCacheNextFieldNumber = 9,
+    kTileCacheSizeFieldNumber = 10,
+    kBandwidthLimitFieldNumber = 12,
+    kAutoEncodingFieldNumber = 13,
+    kInitialBandwidthFieldNumber = 15,
+  };
+  // repeated fixed64 cursor_cache = 8;
+  int cursor_cache_size() const;
+  private:
+  int _internal_cursor_cache_size() const;
+  public:
+  void clear_cursor_cache();
+  private:
+  uint64_t _internal_cursor_cache(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_cursor_cache() const;
+  void _internal_add_cursor_cache(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_cursor_cache();
+  public:
+  uint64_t cursor_cache(int index) const;
+  void set_cursor_cache(int index, uint64_t value);
+  void add_cursor_cache(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      cursor_cache() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_cursor_cache();
+
   // .aspia.proto.desktop.PixelFormat pixel_format = 3;
   bool has_pixel_format() const;
-  void clear_pixel_format();
-  static const int kPixelFormatFieldNumber = 3;
   private:
-  const ::aspia::proto::desktop::PixelFormat& _internal_pixel_format() const;
+  bool _internal_has_pixel_format() const;
   public:
+  void clear_pixel_format();
   const ::aspia::proto::desktop::PixelFormat& pixel_format() const;
-  ::aspia::proto::desktop::PixelFormat* release_pixel_format();
+  PROTOBUF_NODISCARD ::aspia::proto::desktop::PixelFormat* release_pixel_format();
   ::aspia::proto::desktop::PixelFormat* mutable_pixel_format();
   void set_allocated_pixel_format(::aspia::proto::desktop::PixelFormat* pixel_format);
+  private:
+  const ::aspia::proto::desktop::PixelFormat& _internal_pixel_format() const;
+  ::aspia::proto::desktop::PixelFormat* _internal_mutable_pixel_format();
+  public:
+  void unsafe_arena_set_allocated_pixel_format(
+      ::aspia::proto::desktop::PixelFormat* pixel_format);
+  ::aspia::proto::desktop::PixelFormat* unsafe_arena_release_pixel_format();
+
+  // .aspia.proto.desktop.Size viewport = 11;
+  bool has_viewport() const;
+  private:
+  bool _internal_has_viewport() const;
+  public:
+  void clear_viewport();
+  const ::aspia::proto::desktop::Size& viewport() const;
+  PROTOBUF_NODISCARD ::aspia::proto::desktop::Size* release_viewport();
+  ::aspia::proto::desktop::Size* mutable_viewport();
+  void set_allocated_viewport(::aspia::proto::desktop::Size* viewport);
+  private:
+  const ::aspia::proto::desktop::Size& _internal_viewport() const;
+  ::aspia::proto::desktop::Size* _internal_mutable_viewport();
+  public:
+  void unsafe_arena_set_allocated_viewport(
+      ::aspia::proto::desktop::Size* viewport);
+  ::aspia::proto::desktop::Size* unsafe_arena_release_viewport();
+
+  // .aspia.proto.desktop.FrameHashes frame_hashes = 14;
+  bool has_frame_hashes() const;
+  private:
+  bool _internal_has_frame_hashes() const;
+  public:
+  void clear_frame_hashes();
+  const ::aspia::proto::desktop::FrameHashes& frame_hashes() const;
+  PROTOBUF_NODISCARD ::aspia::proto::desktop::FrameHashes* release_frame_hashes();
+  ::aspia::proto::desktop::FrameHashes* mutable_frame_hashes();
+  void set_allocated_frame_hashes(::aspia::proto::desktop::FrameHashes* frame_hashes);
+  private:
+  const ::aspia::proto::desktop::FrameHashes& _internal_frame_hashes() const;
+  ::aspia::proto::desktop::FrameHashes* _internal_mutable_frame_hashes();
+  public:
+  void unsafe_arena_set_allocated_frame_hashes(
+      ::aspia::proto::desktop::FrameHashes* frame_hashes);
+  ::aspia::proto::desktop::FrameHashes* unsafe_arena_release_frame_hashes();
 
   // uint32 features = 1;
   void clear_features();
-  static const int kFeaturesFieldNumber = 1;
-  ::google::protobuf::uint32 features() const;
-  void set_features(::google::protobuf::uint32 value);
+  uint32_t features() const;
+  void set_features(uint32_t value);
+  private:
+  uint32_t _internal_features() const;
+  void _internal_set_features(uint32_t value);
+  public:
 
   // .aspia.proto.desktop.VideoEncoding video_encoding = 2;
   void clear_video_encoding();
-  static const int kVideoEncodingFieldNumber = 2;
   ::aspia::proto::desktop::VideoEncoding video_encoding() const;
   void set_video_encoding(::aspia::proto::desktop::VideoEncoding value);
+  private:
+  ::aspia::proto::desktop::VideoEncoding _internal_video_encoding() const;
+  void _internal_set_video_encoding(::aspia::proto::desktop::VideoEncoding value);
+  public:
 
   // uint32 update_interval = 4;
   void clear_update_interval();
-  static const int kUpdateIntervalFieldNumber = 4;
-  ::google::protobuf::uint32 update_interval() const;
-  void set_update_interval(::google::protobuf::uint32 value);
+  uint32_t update_interval() const;
+  void set_update_interval(uint32_t value);
+  private:
+  uint32_t _internal_update_interval() const;
+  void _internal_set_update_interval(uint32_t value);
+  public:
 
   // uint32 compress_ratio = 5;
   void clear_compress_ratio();
-  static const int kCompressRatioFieldNumber = 5;
-  ::google::protobuf::uint32 compress_ratio() const;
-  void set_compress_ratio(::google::protobuf::uint32 value);
+  uint32_t compress_ratio() const;
+  void set_compress_ratio(uint32_t value);
+  private:
+  uint32_t _internal_compress_ratio() const;
+  void _internal_set_compress_ratio(uint32_t value);
+  public:
+
+  // uint32 encoder_threads = 6;
+  void clear_encoder_threads();
+  uint32_t encoder_threads() const;
+  void set_encoder_threads(uint32_t value);
+  private:
+  uint32_t _internal_encoder_threads() const;
+  void _internal_set_encoder_threads(uint32_t value);
+  public:
+
+  // uint32 encoder_tile_columns = 7;
+  void clear_encoder_tile_columns();
+  uint32_t encoder_tile_columns() const;
+  void set_encoder_tile_columns(uint32_t value);
+  private:
+  uint32_t _internal_encoder_tile_columns() const;
+  void _internal_set_encoder_tile_columns(uint32_t value);
+  public:
+
+  // uint32 cursor_cache_next = 9;
+  void clear_cursor_cache_next();
+  uint32_t cursor_cache_next() const;
+  void set_cursor_cache_next(uint32_t value);
+  private:
+  uint32_t _internal_cursor_cache_next() const;
+  void _internal_set_cursor_cache_next(uint32_t value);
+  public:
+
+  // uint32 tile_cache_size = 10;
+  void clear_tile_cache_size();
+  uint32_t tile_cache_size() const;
+  void set_tile_cache_size(uint32_t value);
+  private:
+  uint32_t _internal_tile_cache_size() const;
+  void _internal_set_tile_cache_size(uint32_t value);
+  public:
+
+  // uint32 bandwidth_limit = 12;
+  void clear_bandwidth_limit();
+  uint32_t bandwidth_limit() const;
+  void set_bandwidth_limit(uint32_t value);
+  private:
+  uint32_t _internal_bandwidth_limit() const;
+  void _internal_set_bandwidth_limit(uint32_t value);
+  public:
+
+  // bool auto_encoding = 13;
+  void clear_auto_encoding();
+  bool auto_encoding() const;
+  void set_auto_encoding(bool value);
+  private:
+  bool _internal_auto_encoding() const;
+  void _internal_set_auto_encoding(bool value);
+  public:
+
+  // uint32 initial_bandwidth = 15;
+  void clear_initial_bandwidth();
+  uint32_t initial_bandwidth() const;
+  void set_initial_bandwidth(uint32_t value);
+  private:
+  uint32_t _internal_initial_bandwidth() const;
+  void _internal_set_initial_bandwidth(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:aspia.proto.desktop.Config)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::aspia::proto::desktop::PixelFormat* pixel_format_;
-  ::google::protobuf::uint32 features_;
-  int video_encoding_;
-  ::google::protobuf::uint32 update_interval_;
-  ::google::protobuf::uint32 compress_ratio_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_desktop_5fsession_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > cursor_cache_;
+    ::aspia::proto::desktop::PixelFormat* pixel_format_;
+    ::aspia::proto::desktop::Size* viewport_;
+    ::aspia::proto::desktop::FrameHashes* frame_hashes_;
+    uint32_t features_;
+    int video_encoding_;
+    uint32_t update_interval_;
+    uint32_t compress_ratio_;
+    uint32_t encoder_threads_;
+    uint32_t encoder_tile_columns_;
+    uint32_t cursor_cache_next_;
+    uint32_t tile_cache_size_;
+    uint32_t bandwidth_limit_;
+    bool auto_encoding_;
+    uint32_t initial_bandwidth_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_desktop_5fsession_2eproto;
 };
 // -------------------------------------------------------------------
 
-class HostToClient : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.HostToClient) */ {
+class Screen final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.Screen) */ {
  public:
-  HostToClient();
-  virtual ~HostToClient();
+  inline Screen() : Screen(nullptr) {}
+  ~Screen() override;
+  explicit PROTOBUF_CONSTEXPR Screen(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  HostToClient(const HostToClient& from);
+  Screen(const Screen& from);
+  Screen(Screen&& from) noexcept
+    : Screen() {
+    *this = ::std::move(from);
+  }
 
-  inline HostToClient& operator=(const HostToClient& from) {
+  inline Screen& operator=(const Screen& from) {
     CopyFrom(from);
     return *this;
   }
-  #if LANG_CXX11
-  HostToClient(HostToClient&& from) noexcept
-    : HostToClient() {
-    *this = ::std::move(from);
-  }
-
-  inline HostToClient& operator=(HostToClient&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline Screen& operator=(Screen&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const HostToClient& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const HostToClient* internal_default_instance() {
-    return reinterpret_cast<const HostToClient*>(
-               &_HostToClient_default_instance_);
+  static const Screen& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Screen* internal_default_instance() {
+    return reinterpret_cast<const Screen*>(
+               &_Screen_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    11;
+    14;
 
-  void Swap(HostToClient* other);
-  friend void swap(HostToClient& a, HostToClient& b) {
+  friend void swap(Screen& a, Screen& b) {
     a.Swap(&b);
   }
+  inline void Swap(Screen* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Screen* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline HostToClient* New() const final {
-    return CreateMaybeMessage<HostToClient>(NULL);
+  Screen* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Screen>(arena);
   }
-
-  HostToClient* New(::google::protobuf::Arena* arena) const final {
-    return CreateMaybeMessage<HostToClient>(arena);
-  }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
-  void CopyFrom(const HostToClient& from);
-  void MergeFrom(const HostToClient& from);
-  void Clear() final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const Screen& from);
+  void MergeFrom(const Screen& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(HostToClient* other);
+  void InternalSwap(Screen* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.desktop.Screen";
   }
+  protected:
+  explicit Screen(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // .aspia.proto.desktop.VideoPacket video_packet = 1;
-  bool has_video_packet() const;
-  void clear_video_packet();
-  static const int kVideoPacketFieldNumber = 1;
-  private:
-  const ::aspia::proto::desktop::VideoPacket& _internal_video_packet() const;
-  public:
-  const ::aspia::proto::desktop::VideoPacket& video_packet() const;
-  ::aspia::proto::desktop::VideoPacket* release_video_packet();
-  ::aspia::proto::desktop::VideoPacket* mutable_video_packet();
-  void set_allocated_video_packet(::aspia::proto::desktop::VideoPacket* video_packet);
-
-  // .aspia.proto.desktop.CursorShape cursor_shape = 2;
-  bool has_cursor_shape() const;
-  void clear_cursor_shape();
-  static const int kCursorShapeFieldNumber = 2;
+  enum : int {
+    kTitleFieldNumber = 2,
+    kIdFieldNumber = 1,
+    kWindowFieldNumber = 3,
+  };
+  // string title = 2;
+  void clear_title();
+  const std::string& title() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_title(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_title();
+  PROTOBUF_NODISCARD std::string* release_title();
+  void set_allocated_title(std::string* title);
   private:
-  const ::aspia::proto::desktop::CursorShape& _internal_cursor_shape() const;
+  const std::string& _internal_title() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_title(const std::string& value);
+  std::string* _internal_mutable_title();
   public:
-  const ::aspia::proto::desktop::CursorShape& cursor_shape() const;
-  ::aspia::proto::desktop::CursorShape* release_cursor_shape();
-  ::aspia::proto::desktop::CursorShape* mutable_cursor_shape();
-  void set_allocated_cursor_shape(::aspia::proto::desktop::CursorShape* cursor_shape);
 
-  // .aspia.proto.desktop.ClipboardEvent clipboard_event = 3;
-  bool has_clipboard_event() const;
-  void clear_clipboard_event();
-  static const int kClipboardEventFieldNumber = 3;
+  // int64 id = 1;
+  void clear_id();
+  int64_t id() const;
+  void set_id(int64_t value);
   private:
-  const ::aspia::proto::desktop::ClipboardEvent& _internal_clipboard_event() const;
+  int64_t _internal_id() const;
+  void _internal_set_id(int64_t value);
   public:
-  const ::aspia::proto::desktop::ClipboardEvent& clipboard_event() const;
-  ::aspia::proto::desktop::ClipboardEvent* release_clipboard_event();
-  ::aspia::proto::desktop::ClipboardEvent* mutable_clipboard_event();
-  void set_allocated_clipboard_event(::aspia::proto::desktop::ClipboardEvent* clipboard_event);
 
-  // .aspia.proto.desktop.ConfigRequest config_request = 4;
-  bool has_config_request() const;
-  void clear_config_request();
-  static const int kConfigRequestFieldNumber = 4;
+  // bool window = 3;
+  void clear_window();
+  bool window() const;
+  void set_window(bool value);
   private:
-  const ::aspia::proto::desktop::ConfigRequest& _internal_config_request() const;
+  bool _internal_window() const;
+  void _internal_set_window(bool value);
   public:
-  const ::aspia::proto::desktop::ConfigRequest& config_request() const;
-  ::aspia::proto::desktop::ConfigRequest* release_config_request();
-  ::aspia::proto::desktop::ConfigRequest* mutable_config_request();
-  void set_allocated_config_request(::aspia::proto::desktop::ConfigRequest* config_request);
 
-  // @@protoc_insertion_point(class_scope:aspia.proto.desktop.HostToClient)
+  // @@protoc_insertion_point(class_scope:aspia.proto.desktop.Screen)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::aspia::proto::desktop::VideoPacket* video_packet_;
-  ::aspia::proto::desktop::CursorShape* cursor_shape_;
-  ::aspia::proto::desktop::ClipboardEvent* clipboard_event_;
-  ::aspia::proto::desktop::ConfigRequest* config_request_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_desktop_5fsession_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr title_;
+    int64_t id_;
+    bool window_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_desktop_5fsession_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ClientToHost : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.ClientToHost) */ {
+class ScreenList final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.ScreenList) */ {
  public:
-  ClientToHost();
-  virtual ~ClientToHost();
+  inline ScreenList() : ScreenList(nullptr) {}
+  ~ScreenList() override;
+  explicit PROTOBUF_CONSTEXPR ScreenList(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ClientToHost(const ClientToHost& from);
+  ScreenList(const ScreenList& from);
+  ScreenList(ScreenList&& from) noexcept
+    : ScreenList() {
+    *this = ::std::move(from);
+  }
 
-  inline ClientToHost& operator=(const ClientToHost& from) {
+  inline ScreenList& operator=(const ScreenList& from) {
     CopyFrom(from);
     return *this;
   }
-  #if LANG_CXX11
-  ClientToHost(ClientToHost&& from) noexcept
-    : ClientToHost() {
-    *this = ::std::move(from);
-  }
-
-  inline ClientToHost& operator=(ClientToHost&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline ScreenList& operator=(ScreenList&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ClientToHost& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const ClientToHost* internal_default_instance() {
-    return reinterpret_cast<const ClientToHost*>(
-               &_ClientToHost_default_instance_);
+  static const ScreenList& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ScreenList* internal_default_instance() {
+    return reinterpret_cast<const ScreenList*>(
+               &_ScreenList_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    12;
+    15;
 
-  void Swap(ClientToHost* other);
-  friend void swap(ClientToHost& a, ClientToHost& b) {
+  friend void swap(ScreenList& a, ScreenList& b) {
     a.Swap(&b);
   }
+  inline void Swap(ScreenList* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ScreenList* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline ClientToHost* New() const final {
-    return CreateMaybeMessage<ClientToHost>(NULL);
-  }
-
-  ClientToHost* New(::google::protobuf::Arena* arena) const final {
-    return CreateMaybeMessage<ClientToHost>(arena);
+  ScreenList* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ScreenList>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
-  void CopyFrom(const ClientToHost& from);
-  void MergeFrom(const ClientToHost& from);
-  void Clear() final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const ScreenList& from);
+  void MergeFrom(const ScreenList& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(ClientToHost* other);
+  void InternalSwap(ScreenList* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.desktop.ScreenList";
   }
+  protected:
+  explicit ScreenList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // .aspia.proto.desktop.PointerEvent pointer_event = 1;
-  bool has_pointer_event() const;
-  void clear_pointer_event();
-  static const int kPointerEventFieldNumber = 1;
-  private:
-  const ::aspia::proto::desktop::PointerEvent& _internal_pointer_event() const;
-  public:
-  const ::aspia::proto::desktop::PointerEvent& pointer_event() const;
-  ::aspia::proto::desktop::PointerEvent* release_pointer_event();
-  ::aspia::proto::desktop::PointerEvent* mutable_pointer_event();
-  void set_allocated_pointer_event(::aspia::proto::desktop::PointerEvent* pointer_event);
-
-  // .aspia.proto.desktop.KeyEvent key_event = 2;
-  bool has_key_event() const;
-  void clear_key_event();
-  static const int kKeyEventFieldNumber = 2;
+  enum : int {
+    kScreenFieldNumber = 1,
+    kCurrentScreenFieldNumber = 2,
+  };
+  // repeated .aspia.proto.desktop.Screen screen = 1;
+  int screen_size() const;
   private:
-  const ::aspia::proto::desktop::KeyEvent& _internal_key_event() const;
+  int _internal_screen_size() const;
   public:
-  const ::aspia::proto::desktop::KeyEvent& key_event() const;
-  ::aspia::proto::desktop::KeyEvent* release_key_event();
-  ::aspia::proto::desktop::KeyEvent* mutable_key_event();
-  void set_allocated_key_event(::aspia::proto::desktop::KeyEvent* key_event);
-
-  // .aspia.proto.desktop.ClipboardEvent clipboard_event = 3;
-  bool has_clipboard_event() const;
-  void clear_clipboard_event();
-  static const int kClipboardEventFieldNumber = 3;
+  void clear_screen();
+  ::aspia::proto::desktop::Screen* mutable_screen(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::desktop::Screen >*
+      mutable_screen();
   private:
-  const ::aspia::proto::desktop::ClipboardEvent& _internal_clipboard_event() const;
+  const ::aspia::proto::desktop::Screen& _internal_screen(int index) const;
+  ::aspia::proto::desktop::Screen* _internal_add_screen();
   public:
-  const ::aspia::proto::desktop::ClipboardEvent& clipboard_event() const;
-  ::aspia::proto::desktop::ClipboardEvent* release_clipboard_event();
-  ::aspia::proto::desktop::ClipboardEvent* mutable_clipboard_event();
-  void set_allocated_clipboard_event(::aspia::proto::desktop::ClipboardEvent* clipboard_event);
-
-  // .aspia.proto.desktop.Config config = 4;
-  bool has_config() const;
-  void clear_config();
-  static const int kConfigFieldNumber = 4;
+  const ::aspia::proto::desktop::Screen& screen(int index) const;
+  ::aspia::proto::desktop::Screen* add_screen();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::desktop::Screen >&
+      screen() const;
+
+  // int64 current_screen = 2;
+  void clear_current_screen();
+  int64_t current_screen() const;
+  void set_current_screen(int64_t value);
   private:
-  const ::aspia::proto::desktop::Config& _internal_config() const;
+  int64_t _internal_current_screen() const;
+  void _internal_set_current_screen(int64_t value);
   public:
-  const ::aspia::proto::desktop::Config& config() const;
-  ::aspia::proto::desktop::Config* release_config();
-  ::aspia::proto::desktop::Config* mutable_config();
-  void set_allocated_config(::aspia::proto::desktop::Config* config);
 
-  // @@protoc_insertion_point(class_scope:aspia.proto.desktop.ClientToHost)
+  // @@protoc_insertion_point(class_scope:aspia.proto.desktop.ScreenList)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::aspia::proto::desktop::PointerEvent* pointer_event_;
-  ::aspia::proto::desktop::KeyEvent* key_event_;
-  ::aspia::proto::desktop::ClipboardEvent* clipboard_event_;
-  ::aspia::proto::desktop::Config* config_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_desktop_5fsession_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::desktop::Screen > screen_;
+    int64_t current_screen_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_desktop_5fsession_2eproto;
 };
+// -------------------------------------------------------------------
+
+class HostToClient final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.HostToClient) */ {
+ public:
+  inline HostToClient() : HostToClient(nullptr) {}
+  ~HostToClient() override;
+  explicit PROTOBUF_CONSTEXPR HostToClient(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HostToClient(const HostToClient& from);
+  HostToClient(HostToClient&& from) noexcept
+    : HostToClient() {
+    *this = ::std::move(from);
+  }
+
+  inline HostToClient& operator=(const HostToClient& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HostToClient& operator=(HostToClient&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const HostToClient& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HostToClient* internal_default_instance() {
+    return reinterpret_cast<const HostToClient*>(
+               &_HostToClient_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(HostToClient& a, HostToClient& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HostToClient* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HostToClient* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  HostToClient* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HostToClient>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const HostToClient& from);
+  void MergeFrom(const HostToClient& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(HostToClient* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.desktop.HostToClient";
+  }
+  protected:
+  explicit HostToClient(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kVideoPacketFieldNumber = 1,
+    kCursorShapeFieldNumber = 2,
+    kClipboardEventFieldNumber = 3,
+    kConfigRequestFieldNumber = 4,
+    kScreenListFieldNumber = 5,
+    kCursorPositionFieldNumber = 6,
+    kPingFieldNumber = 7,
+    kLatencyProbeFieldNumber = 8,
+  };
+  // .aspia.proto.desktop.VideoPacket video_packet = 1;
+  bool has_video_packet() const;
+  private:
+  bool _internal_has_video_packet() const;
+  public:
+  void clear_video_packet();
+  const ::aspia::proto::desktop::VideoPacket& video_packet() const;
+  PROTOBUF_NODISCARD ::aspia::proto::desktop::VideoPacket* release_video_packet();
+  ::aspia::proto::desktop::VideoPacket* mutable_video_packet();
+  void set_allocated_video_packet(::aspia::proto::desktop::VideoPacket* video_packet);
+  private:
+  const ::aspia::proto::desktop::VideoPacket& _internal_video_packet() const;
+  ::aspia::proto::desktop::VideoPacket* _internal_mutable_video_packet();
+  public:
+  void unsafe_arena_set_allocated_video_packet(
+      ::aspia::proto::desktop::VideoPacket* video_packet);
+  ::aspia::proto::desktop::VideoPacket* unsafe_arena_release_video_packet();
+
+  // .aspia.proto.desktop.CursorShape cursor_shape = 2;
+  bool has_cursor_shape() const;
+  private:
+  bool _internal_has_cursor_shape() const;
+  public:
+  void clear_cursor_shape();
+  const ::aspia::proto::desktop::CursorShape& cursor_shape() const;
+  PROTOBUF_NODISCARD ::aspia::proto::desktop::CursorShape* release_cursor_shape();
+  ::aspia::proto::desktop::CursorShape* mutable_cursor_shape();
+  void set_allocated_cursor_shape(::aspia::proto::desktop::CursorShape* cursor_shape);
+  private:
+  const ::aspia::proto::desktop::CursorShape& _internal_cursor_shape() const;
+  ::aspia::proto::desktop::CursorShape* _internal_mutable_cursor_shape();
+  public:
+  void unsafe_arena_set_allocated_cursor_shape(
+      ::aspia::proto::desktop::CursorShape* cursor_shape);
+  ::aspia::proto::desktop::CursorShape* unsafe_arena_release_cursor_shape();
+
+  // .aspia.proto.desktop.ClipboardEvent clipboard_event = 3;
+  bool has_clipboard_event() const;
+  private:
+  bool _internal_has_clipboard_event() const;
+  public:
+  void clear_clipboard_event();
+  const ::aspia::proto::desktop::ClipboardEvent& clipboard_event() const;
+  PROTOBUF_NODISCARD ::aspia::proto::desktop::ClipboardEvent* release_clipboard_event();
+  ::aspia::proto::desktop::ClipboardEvent* mutable_clipboard_event();
+  void set_allocated_clipboard_event(::aspia::proto::desktop::ClipboardEvent* clipboard_event);
+  private:
+  const ::aspia::proto::desktop::ClipboardEvent& _internal_clipboard_event() const;
+  ::aspia::proto::desktop::ClipboardEvent* _internal_mutable_clipboard_event();
+  public:
+  void unsafe_arena_set_allocated_clipboard_event(
+      ::aspia::proto::desktop::ClipboardEvent* clipboard_event);
+  ::aspia::proto::desktop::ClipboardEvent* unsafe_arena_release_clipboard_event();
+
+  // .aspia.proto.desktop.ConfigRequest config_request = 4;
+  bool has_config_request() const;
+  private:
+  bool _internal_has_config_request() const;
+  public:
+  void clear_config_request();
+  const ::aspia::proto::desktop::ConfigRequest& config_request() const;
+  PROTOBUF_NODISCARD ::aspia::proto::desktop::ConfigRequest* release_config_request();
+  ::aspia::proto::desktop::ConfigRequest* mutable_config_request();
+  void set_allocated_config_request(::aspia::proto::desktop::ConfigRequest* config_request);
+  private:
+  const ::aspia::proto::desktop::ConfigRequest& _internal_config_request() const;
+  ::aspia::proto::desktop::ConfigRequest* _internal_mutable_config_request();
+  public:
+  void unsafe_arena_set_allocated_config_request(
+      ::aspia::proto::desktop::ConfigRequest* config_request);
+  ::aspia::proto::desktop::ConfigRequest* unsafe_arena_release_config_request();
+
+  // .aspia.proto.desktop.ScreenList screen_list = 5;
+  bool has_screen_list() const;
+  private:
+  bool _internal_has_screen_list() const;
+  public:
+  void clear_screen_list();
+  const ::aspia::proto::desktop::ScreenList& screen_list() const;
+  PROTOBUF_NODISCARD ::aspia::proto::desktop::ScreenList* release_screen_list();
+  ::aspia::proto::desktop::ScreenList* mutable_screen_list();
+  void set_allocated_screen_list(::aspia::proto::desktop::ScreenList* screen_list);
+  private:
+  const ::aspia::proto::desktop::ScreenList& _internal_screen_list() const;
+  ::aspia::proto::desktop::ScreenList* _internal_mutable_screen_list();
+  public:
+  void unsafe_arena_set_allocated_screen_list(
+      ::aspia::proto::desktop::ScreenList* screen_list);
+  ::aspia::proto::desktop::ScreenList* unsafe_arena_release_screen_list();
+
+  // .aspia.proto.desktop.CursorPosition cursor_position = 6;
+  bool has_cursor_position() const;
+  private:
+  bool _internal_has_cursor_position() const;
+  public:
+  void clear_cursor_position();
+  const ::aspia::proto::desktop::CursorPosition& cursor_position() const;
+  PROTOBUF_NODISCARD ::aspia::proto::desktop::CursorPosition* release_cursor_position();
+  ::aspia::proto::desktop::CursorPosition* mutable_cursor_position();
+  void set_allocated_cursor_position(::aspia::proto::desktop::CursorPosition* cursor_position);
+  private:
+  const ::aspia::proto::desktop::CursorPosition& _internal_cursor_position() const;
+  ::aspia::proto::desktop::CursorPosition* _internal_mutable_cursor_position();
+  public:
+  void unsafe_arena_set_allocated_cursor_position(
+      ::aspia::proto::desktop::CursorPosition* cursor_position);
+  ::aspia::proto::desktop::CursorPosition* unsafe_arena_release_cursor_position();
+
+  // .aspia.proto.desktop.Ping ping = 7;
+  bool has_ping() const;
+  private:
+  bool _internal_has_ping() const;
+  public:
+  void clear_ping();
+  const ::aspia::proto::desktop::Ping& ping() const;
+  PROTOBUF_NODISCARD ::aspia::proto::desktop::Ping* release_ping();
+  ::aspia::proto::desktop::Ping* mutable_ping();
+  void set_allocated_ping(::aspia::proto::desktop::Ping* ping);
+  private:
+  const ::aspia::proto::desktop::Ping& _internal_ping() const;
+  ::aspia::proto::desktop::Ping* _internal_mutable_ping();
+  public:
+  void unsafe_arena_set_allocated_ping(
+      ::aspia::proto::desktop::Ping* ping);
+  ::aspia::proto::desktop::Ping* unsafe_arena_release_ping();
+
+  // .aspia.proto.desktop.LatencyProbe latency_probe = 8;
+  bool has_latency_probe() const;
+  private:
+  bool _internal_has_latency_probe() const;
+  public:
+  void clear_latency_probe();
+  const ::aspia::proto::desktop::LatencyProbe& latency_probe() const;
+  PROTOBUF_NODISCARD ::aspia::proto::desktop::LatencyProbe* release_latency_probe();
+  ::aspia::proto::desktop::LatencyProbe* mutable_latency_probe();
+  void set_allocated_latency_probe(::aspia::proto::desktop::LatencyProbe* latency_probe);
+  private:
+  const ::aspia::proto::desktop::LatencyProbe& _internal_latency_probe() const;
+  ::aspia::proto::desktop::LatencyProbe* _internal_mutable_latency_probe();
+  public:
+  void unsafe_arena_set_allocated_latency_probe(
+      ::aspia::proto::desktop::LatencyProbe* latency_probe);
+  ::aspia::proto::desktop::LatencyProbe* unsafe_arena_release_latency_probe();
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.desktop.HostToClient)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::aspia::proto::desktop::VideoPacket* video_packet_;
+    ::aspia::proto::desktop::CursorShape* cursor_shape_;
+    ::aspia::proto::desktop::ClipboardEvent* clipboard_event_;
+    ::aspia::proto::desktop::ConfigRequest* config_request_;
+    ::aspia::proto::desktop::ScreenList* screen_list_;
+    ::aspia::proto::desktop::CursorPosition* cursor_position_;
+    ::aspia::proto::desktop::Ping* ping_;
+    ::aspia::proto::desktop::LatencyProbe* latency_probe_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_desktop_5fsession_2eproto;
+};
+// -------------------------------------------------------------------
+
+class VideoAck final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.VideoAck) */ {
+ public:
+  inline VideoAck() : VideoAck(nullptr) {}
+  ~VideoAck() override;
+  explicit PROTOBUF_CONSTEXPR VideoAck(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  VideoAck(const VideoAck& from);
+  VideoAck(VideoAck&& from) noexcept
+    : VideoAck() {
+    *this = ::std::move(from);
+  }
+
+  inline VideoAck& operator=(const VideoAck& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline VideoAck& operator=(VideoAck&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const VideoAck& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const VideoAck* internal_default_instance() {
+    return reinterpret_cast<const VideoAck*>(
+               &_VideoAck_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(VideoAck& a, VideoAck& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(VideoAck* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(VideoAck* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  VideoAck* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<VideoAck>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const VideoAck& from);
+  void MergeFrom(const VideoAck& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(VideoAck* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.desktop.VideoAck";
+  }
+  protected:
+  explicit VideoAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFrameIdFieldNumber = 1,
+    kDecodeTimeFieldNumber = 2,
+  };
+  // uint32 frame_id = 1;
+  void clear_frame_id();
+  uint32_t frame_id() const;
+  void set_frame_id(uint32_t value);
+  private:
+  uint32_t _internal_frame_id() const;
+  void _internal_set_frame_id(uint32_t value);
+  public:
+
+  // uint32 decode_time = 2;
+  void clear_decode_time();
+  uint32_t decode_time() const;
+  void set_decode_time(uint32_t value);
+  private:
+  uint32_t _internal_decode_time() const;
+  void _internal_set_decode_time(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.desktop.VideoAck)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t frame_id_;
+    uint32_t decode_time_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_desktop_5fsession_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LatencyProbe final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.LatencyProbe) */ {
+ public:
+  inline LatencyProbe() : LatencyProbe(nullptr) {}
+  ~LatencyProbe() override;
+  explicit PROTOBUF_CONSTEXPR LatencyProbe(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LatencyProbe(const LatencyProbe& from);
+  LatencyProbe(LatencyProbe&& from) noexcept
+    : LatencyProbe() {
+    *this = ::std::move(from);
+  }
+
+  inline LatencyProbe& operator=(const LatencyProbe& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LatencyProbe& operator=(LatencyProbe&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const LatencyProbe& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LatencyProbe* internal_default_instance() {
+    return reinterpret_cast<const LatencyProbe*>(
+               &_LatencyProbe_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(LatencyProbe& a, LatencyProbe& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LatencyProbe* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LatencyProbe* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LatencyProbe* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LatencyProbe>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const LatencyProbe& from);
+  void MergeFrom(const LatencyProbe& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(LatencyProbe* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.desktop.LatencyProbe";
+  }
+  protected:
+  explicit LatencyProbe(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTimeFieldNumber = 1,
+    kHostDelayFieldNumber = 2,
+  };
+  // int64 time = 1;
+  void clear_time();
+  int64_t time() const;
+  void set_time(int64_t value);
+  private:
+  int64_t _internal_time() const;
+  void _internal_set_time(int64_t value);
+  public:
+
+  // uint32 host_delay = 2;
+  void clear_host_delay();
+  uint32_t host_delay() const;
+  void set_host_delay(uint32_t value);
+  private:
+  uint32_t _internal_host_delay() const;
+  void _internal_set_host_delay(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.desktop.LatencyProbe)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t time_;
+    uint32_t host_delay_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_desktop_5fsession_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Ping final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.Ping) */ {
+ public:
+  inline Ping() : Ping(nullptr) {}
+  ~Ping() override;
+  explicit PROTOBUF_CONSTEXPR Ping(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Ping(const Ping& from);
+  Ping(Ping&& from) noexcept
+    : Ping() {
+    *this = ::std::move(from);
+  }
+
+  inline Ping& operator=(const Ping& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Ping& operator=(Ping&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const Ping& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Ping* internal_default_instance() {
+    return reinterpret_cast<const Ping*>(
+               &_Ping_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(Ping& a, Ping& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Ping* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Ping* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Ping* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Ping>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const Ping& from);
+  void MergeFrom(const Ping& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(Ping* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.desktop.Ping";
+  }
+  protected:
+  explicit Ping(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTimeFieldNumber = 1,
+  };
+  // int64 time = 1;
+  void clear_time();
+  int64_t time() const;
+  void set_time(int64_t value);
+  private:
+  int64_t _internal_time() const;
+  void _internal_set_time(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.desktop.Ping)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t time_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_desktop_5fsession_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Visibility final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.Visibility) */ {
+ public:
+  inline Visibility() : Visibility(nullptr) {}
+  ~Visibility() override;
+  explicit PROTOBUF_CONSTEXPR Visibility(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Visibility(const Visibility& from);
+  Visibility(Visibility&& from) noexcept
+    : Visibility() {
+    *this = ::std::move(from);
+  }
+
+  inline Visibility& operator=(const Visibility& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Visibility& operator=(Visibility&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const Visibility& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Visibility* internal_default_instance() {
+    return reinterpret_cast<const Visibility*>(
+               &_Visibility_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(Visibility& a, Visibility& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Visibility* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Visibility* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Visibility* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Visibility>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const Visibility& from);
+  void MergeFrom(const Visibility& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(Visibility* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.desktop.Visibility";
+  }
+  protected:
+  explicit Visibility(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHiddenFieldNumber = 1,
+  };
+  // bool hidden = 1;
+  void clear_hidden();
+  bool hidden() const;
+  void set_hidden(bool value);
+  private:
+  bool _internal_hidden() const;
+  void _internal_set_hidden(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.desktop.Visibility)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    bool hidden_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_desktop_5fsession_2eproto;
+};
+// -------------------------------------------------------------------
+
+class VisibleArea final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.VisibleArea) */ {
+ public:
+  inline VisibleArea() : VisibleArea(nullptr) {}
+  ~VisibleArea() override;
+  explicit PROTOBUF_CONSTEXPR VisibleArea(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  VisibleArea(const VisibleArea& from);
+  VisibleArea(VisibleArea&& from) noexcept
+    : VisibleArea() {
+    *this = ::std::move(from);
+  }
+
+  inline VisibleArea& operator=(const VisibleArea& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline VisibleArea& operator=(VisibleArea&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const VisibleArea& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const VisibleArea* internal_default_instance() {
+    return reinterpret_cast<const VisibleArea*>(
+               &_VisibleArea_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(VisibleArea& a, VisibleArea& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(VisibleArea* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(VisibleArea* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  VisibleArea* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<VisibleArea>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const VisibleArea& from);
+  void MergeFrom(const VisibleArea& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(VisibleArea* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.desktop.VisibleArea";
+  }
+  protected:
+  explicit VisibleArea(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRectFieldNumber = 1,
+  };
+  // .aspia.proto.desktop.Rect rect = 1;
+  bool has_rect() const;
+  private:
+  bool _internal_has_rect() const;
+  public:
+  void clear_rect();
+  const ::aspia::proto::desktop::Rect& rect() const;
+  PROTOBUF_NODISCARD ::aspia::proto::desktop::Rect* release_rect();
+  ::aspia::proto::desktop::Rect* mutable_rect();
+  void set_allocated_rect(::aspia::proto::desktop::Rect* rect);
+  private:
+  const ::aspia::proto::desktop::Rect& _internal_rect() const;
+  ::aspia::proto::desktop::Rect* _internal_mutable_rect();
+  public:
+  void unsafe_arena_set_allocated_rect(
+      ::aspia::proto::desktop::Rect* rect);
+  ::aspia::proto::desktop::Rect* unsafe_arena_release_rect();
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.desktop.VisibleArea)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::aspia::proto::desktop::Rect* rect_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_desktop_5fsession_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RefreshRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.RefreshRequest) */ {
+ public:
+  inline RefreshRequest() : RefreshRequest(nullptr) {}
+  ~RefreshRequest() override;
+  explicit PROTOBUF_CONSTEXPR RefreshRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RefreshRequest(const RefreshRequest& from);
+  RefreshRequest(RefreshRequest&& from) noexcept
+    : RefreshRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline RefreshRequest& operator=(const RefreshRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RefreshRequest& operator=(RefreshRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const RefreshRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RefreshRequest* internal_default_instance() {
+    return reinterpret_cast<const RefreshRequest*>(
+               &_RefreshRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(RefreshRequest& a, RefreshRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RefreshRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RefreshRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RefreshRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RefreshRequest>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const RefreshRequest& from);
+  void MergeFrom(const RefreshRequest& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(RefreshRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.desktop.RefreshRequest";
+  }
+  protected:
+  explicit RefreshRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFramesLostFieldNumber = 1,
+  };
+  // bool frames_lost = 1;
+  void clear_frames_lost();
+  bool frames_lost() const;
+  void set_frames_lost(bool value);
+  private:
+  bool _internal_frames_lost() const;
+  void _internal_set_frames_lost(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.desktop.RefreshRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    bool frames_lost_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_desktop_5fsession_2eproto;
+};
+// -------------------------------------------------------------------
+
+class InputEvent final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.InputEvent) */ {
+ public:
+  inline InputEvent() : InputEvent(nullptr) {}
+  ~InputEvent() override;
+  explicit PROTOBUF_CONSTEXPR InputEvent(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  InputEvent(const InputEvent& from);
+  InputEvent(InputEvent&& from) noexcept
+    : InputEvent() {
+    *this = ::std::move(from);
+  }
+
+  inline InputEvent& operator=(const InputEvent& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline InputEvent& operator=(InputEvent&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const InputEvent& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const InputEvent* internal_default_instance() {
+    return reinterpret_cast<const InputEvent*>(
+               &_InputEvent_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
+
+  friend void swap(InputEvent& a, InputEvent& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(InputEvent* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(InputEvent* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  InputEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<InputEvent>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const InputEvent& from);
+  void MergeFrom(const InputEvent& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(InputEvent* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.desktop.InputEvent";
+  }
+  protected:
+  explicit InputEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPointerEventFieldNumber = 1,
+    kKeyEventFieldNumber = 2,
+  };
+  // .aspia.proto.desktop.PointerEvent pointer_event = 1;
+  bool has_pointer_event() const;
+  private:
+  bool _internal_has_pointer_event() const;
+  public:
+  void clear_pointer_event();
+  const ::aspia::proto::desktop::PointerEvent& pointer_event() const;
+  PROTOBUF_NODISCARD ::aspia::proto::desktop::PointerEvent* release_pointer_event();
+  ::aspia::proto::desktop::PointerEvent* mutable_pointer_event();
+  void set_allocated_pointer_event(::aspia::proto::desktop::PointerEvent* pointer_event);
+  private:
+  const ::aspia::proto::desktop::PointerEvent& _internal_pointer_event() const;
+  ::aspia::proto::desktop::PointerEvent* _internal_mutable_pointer_event();
+  public:
+  void unsafe_arena_set_allocated_pointer_event(
+      ::aspia::proto::desktop::PointerEvent* pointer_event);
+  ::aspia::proto::desktop::PointerEvent* unsafe_arena_release_pointer_event();
+
+  // .aspia.proto.desktop.KeyEvent key_event = 2;
+  bool has_key_event() const;
+  private:
+  bool _internal_has_key_event() const;
+  public:
+  void clear_key_event();
+  const ::aspia::proto::desktop::KeyEvent& key_event() const;
+  PROTOBUF_NODISCARD ::aspia::proto::desktop::KeyEvent* release_key_event();
+  ::aspia::proto::desktop::KeyEvent* mutable_key_event();
+  void set_allocated_key_event(::aspia::proto::desktop::KeyEvent* key_event);
+  private:
+  const ::aspia::proto::desktop::KeyEvent& _internal_key_event() const;
+  ::aspia::proto::desktop::KeyEvent* _internal_mutable_key_event();
+  public:
+  void unsafe_arena_set_allocated_key_event(
+      ::aspia::proto::desktop::KeyEvent* key_event);
+  ::aspia::proto::desktop::KeyEvent* unsafe_arena_release_key_event();
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.desktop.InputEvent)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::aspia::proto::desktop::PointerEvent* pointer_event_;
+    ::aspia::proto::desktop::KeyEvent* key_event_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_desktop_5fsession_2eproto;
+};
+// -------------------------------------------------------------------
+
+class InputEvents final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.InputEvents) */ {
+ public:
+  inline InputEvents() : InputEvents(nullptr) {}
+  ~InputEvents() override;
+  explicit PROTOBUF_CONSTEXPR InputEvents(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  InputEvents(const InputEvents& from);
+  InputEvents(InputEvents&& from) noexcept
+    : InputEvents() {
+    *this = ::std::move(from);
+  }
+
+  inline InputEvents& operator=(const InputEvents& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline InputEvents& operator=(InputEvents&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const InputEvents& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const InputEvents* internal_default_instance() {
+    return reinterpret_cast<const InputEvents*>(
+               &_InputEvents_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
+
+  friend void swap(InputEvents& a, InputEvents& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(InputEvents* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(InputEvents* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  InputEvents* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<InputEvents>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const InputEvents& from);
+  void MergeFrom(const InputEvents& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(InputEvents* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.desktop.InputEvents";
+  }
+  protected:
+  explicit InputEvents(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEventFieldNumber = 1,
+  };
+  // repeated .aspia.proto.desktop.InputEvent event = 1;
+  int event_size() const;
+  private:
+  int _internal_event_size() const;
+  public:
+  void clear_event();
+  ::aspia::proto::desktop::InputEvent* mutable_event(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::desktop::InputEvent >*
+      mutable_event();
+  private:
+  const ::aspia::proto::desktop::InputEvent& _internal_event(int index) const;
+  ::aspia::proto::desktop::InputEvent* _internal_add_event();
+  public:
+  const ::aspia::proto::desktop::InputEvent& event(int index) const;
+  ::aspia::proto::desktop::InputEvent* add_event();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::desktop::InputEvent >&
+      event() const;
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.desktop.InputEvents)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::desktop::InputEvent > event_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_desktop_5fsession_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ClientToHost final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.desktop.ClientToHost) */ {
+ public:
+  inline ClientToHost() : ClientToHost(nullptr) {}
+  ~ClientToHost() override;
+  explicit PROTOBUF_CONSTEXPR ClientToHost(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ClientToHost(const ClientToHost& from);
+  ClientToHost(ClientToHost&& from) noexcept
+    : ClientToHost() {
+    *this = ::std::move(from);
+  }
+
+  inline ClientToHost& operator=(const ClientToHost& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ClientToHost& operator=(ClientToHost&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ClientToHost& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ClientToHost* internal_default_instance() {
+    return reinterpret_cast<const ClientToHost*>(
+               &_ClientToHost_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    25;
+
+  friend void swap(ClientToHost& a, ClientToHost& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ClientToHost* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ClientToHost* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ClientToHost* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ClientToHost>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const ClientToHost& from);
+  void MergeFrom(const ClientToHost& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(ClientToHost* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.desktop.ClientToHost";
+  }
+  protected:
+  explicit ClientToHost(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPointerEventFieldNumber = 1,
+    kKeyEventFieldNumber = 2,
+    kClipboardEventFieldNumber = 3,
+    kConfigFieldNumber = 4,
+    kVideoAckFieldNumber = 5,
+    kScreenFieldNumber = 6,
+    kRefreshRequestFieldNumber = 7,
+    kInputEventsFieldNumber = 8,
+    kPingFieldNumber = 9,
+    kVisibilityFieldNumber = 10,
+    kVisibleAreaFieldNumber = 11,
+  };
+  // .aspia.proto.desktop.PointerEvent pointer_event = 1;
+  bool has_pointer_event() const;
+  private:
+  bool _internal_has_pointer_event() const;
+  public:
+  void clear_pointer_event();
+  const ::aspia::proto::desktop::PointerEvent& pointer_event() const;
+  PROTOBUF_NODISCARD ::aspia::proto::desktop::PointerEvent* release_pointer_event();
+  ::aspia::proto::desktop::PointerEvent* mutable_pointer_event();
+  void set_allocated_pointer_event(::aspia::proto::desktop::PointerEvent* pointer_event);
+  private:
+  const ::aspia::proto::desktop::PointerEvent& _internal_pointer_event() const;
+  ::aspia::proto::desktop::PointerEvent* _internal_mutable_pointer_event();
+  public:
+  void unsafe_arena_set_allocated_pointer_event(
+      ::aspia::proto::desktop::PointerEvent* pointer_event);
+  ::aspia::proto::desktop::PointerEvent* unsafe_arena_release_pointer_event();
+
+  // .aspia.proto.desktop.KeyEvent key_event = 2;
+  bool has_key_event() const;
+  private:
+  bool _internal_has_key_event() const;
+  public:
+  void clear_key_event();
+  const ::aspia::proto::desktop::KeyEvent& key_event() const;
+  PROTOBUF_NODISCARD ::aspia::proto::desktop::KeyEvent* release_key_event();
+  ::aspia::proto::desktop::KeyEvent* mutable_key_event();
+  void set_allocated_key_event(::aspia::proto::desktop::KeyEvent* key_event);
+  private:
+  const ::aspia::proto::desktop::KeyEvent& _internal_key_event() const;
+  ::aspia::proto::desktop::KeyEvent* _internal_mutable_key_event();
+  public:
+  void unsafe_arena_set_allocated_key_event(
+      ::aspia::proto::desktop::KeyEvent* key_event);
+  ::aspia::proto::desktop::KeyEvent* unsafe_arena_release_key_event();
+
+  // .aspia.proto.desktop.ClipboardEvent clipboard_event = 3;
+  bool has_clipboard_event() const;
+  private:
+  bool _internal_has_clipboard_event() const;
+  public:
+  void clear_clipboard_event();
+  const ::aspia::proto::desktop::ClipboardEvent& clipboard_event() const;
+  PROTOBUF_NODISCARD ::aspia::proto::desktop::ClipboardEvent* release_clipboard_event();
+  ::aspia::proto::desktop::ClipboardEvent* mutable_clipboard_event();
+  void set_allocated_clipboard_event(::aspia::proto::desktop::ClipboardEvent* clipboard_event);
+  private:
+  const ::aspia::proto::desktop::ClipboardEvent& _internal_clipboard_event() const;
+  ::aspia::proto::desktop::ClipboardEvent* _internal_mutable_clipboard_event();
+  public:
+  void unsafe_arena_set_allocated_clipboard_event(
+      ::aspia::proto::desktop::ClipboardEvent* clipboard_event);
+  ::aspia::proto::desktop::ClipboardEvent* unsafe_arena_release_clipboard_event();
+
+  // .aspia.proto.desktop.Config config = 4;
+  bool has_config() const;
+  private:
+  bool _internal_has_config() const;
+  public:
+  void clear_config();
+  const ::aspia::proto::desktop::Config& config() const;
+  PROTOBUF_NODISCARD ::aspia::proto::desktop::Config* release_config();
+  ::aspia::proto::desktop::Config* mutable_config();
+  void set_allocated_config(::aspia::proto::desktop::Config* config);
+  private:
+  const ::aspia::proto::desktop::Config& _internal_config() const;
+  ::aspia::proto::desktop::Config* _internal_mutable_config();
+  public:
+  void unsafe_arena_set_allocated_config(
+      ::aspia::proto::desktop::Config* config);
+  ::aspia::proto::desktop::Config* unsafe_arena_release_config();
+
+  // .aspia.proto.desktop.VideoAck video_ack = 5;
+  bool has_video_ack() const;
+  private:
+  bool _internal_has_video_ack() const;
+  public:
+  void clear_video_ack();
+  const ::aspia::proto::desktop::VideoAck& video_ack() const;
+  PROTOBUF_NODISCARD ::aspia::proto::desktop::VideoAck* release_video_ack();
+  ::aspia::proto::desktop::VideoAck* mutable_video_ack();
+  void set_allocated_video_ack(::aspia::proto::desktop::VideoAck* video_ack);
+  private:
+  const ::aspia::proto::desktop::VideoAck& _internal_video_ack() const;
+  ::aspia::proto::desktop::VideoAck* _internal_mutable_video_ack();
+  public:
+  void unsafe_arena_set_allocated_video_ack(
+      ::aspia::proto::desktop::VideoAck* video_ack);
+  ::aspia::proto::desktop::VideoAck* unsafe_arena_release_video_ack();
+
+  // .aspia.proto.desktop.Screen screen = 6;
+  bool has_screen() const;
+  private:
+  bool _internal_has_screen() const;
+  public:
+  void clear_screen();
+  const ::aspia::proto::desktop::Screen& screen() const;
+  PROTOBUF_NODISCARD ::aspia::proto::desktop::Screen* release_screen();
+  ::aspia::proto::desktop::Screen* mutable_screen();
+  void set_allocated_screen(::aspia::proto::desktop::Screen* screen);
+  private:
+  const ::aspia::proto::desktop::Screen& _internal_screen() const;
+  ::aspia::proto::desktop::Screen* _internal_mutable_screen();
+  public:
+  void unsafe_arena_set_allocated_screen(
+      ::aspia::proto::desktop::Screen* screen);
+  ::aspia::proto::desktop::Screen* unsafe_arena_release_screen();
+
+  // .aspia.proto.desktop.RefreshRequest refresh_request = 7;
+  bool has_refresh_request() const;
+  private:
+  bool _internal_has_refresh_request() const;
+  public:
+  void clear_refresh_request();
+  const ::aspia::proto::desktop::RefreshRequest& refresh_request() const;
+  PROTOBUF_NODISCARD ::aspia::proto::desktop::RefreshRequest* release_refresh_request();
+  ::aspia::proto::desktop::RefreshRequest* mutable_refresh_request();
+  void set_allocated_refresh_request(::aspia::proto::desktop::RefreshRequest* refresh_request);
+  private:
+  const ::aspia::proto::desktop::RefreshRequest& _internal_refresh_request() const;
+  ::aspia::proto::desktop::RefreshRequest* _internal_mutable_refresh_request();
+  public:
+  void unsafe_arena_set_allocated_refresh_request(
+      ::aspia::proto::desktop::RefreshRequest* refresh_request);
+  ::aspia::proto::desktop::RefreshRequest* unsafe_arena_release_refresh_request();
+
+  // .aspia.proto.desktop.InputEvents input_events = 8;
+  bool has_input_events() const;
+  private:
+  bool _internal_has_input_events() const;
+  public:
+  void clear_input_events();
+  const ::aspia::proto::desktop::InputEvents& input_events() const;
+  PROTOBUF_NODISCARD ::aspia::proto::desktop::InputEvents* release_input_events();
+  ::aspia::proto::desktop::InputEvents* mutable_input_events();
+  void set_allocated_input_events(::aspia::proto::desktop::InputEvents* input_events);
+  private:
+  const ::aspia::proto::desktop::InputEvents& _internal_input_events() const;
+  ::aspia::proto::desktop::InputEvents* _internal_mutable_input_events();
+  public:
+  void unsafe_arena_set_allocated_input_events(
+      ::aspia::proto::desktop::InputEvents* input_events);
+  ::aspia::proto::desktop::InputEvents* unsafe_arena_release_input_events();
+
+  // .aspia.proto.desktop.Ping ping = 9;
+  bool has_ping() const;
+  private:
+  bool _internal_has_ping() const;
+  public:
+  void clear_ping();
+  const ::aspia::proto::desktop::Ping& ping() const;
+  PROTOBUF_NODISCARD ::aspia::proto::desktop::Ping* release_ping();
+  ::aspia::proto::desktop::Ping* mutable_ping();
+  void set_allocated_ping(::aspia::proto::desktop::Ping* ping);
+  private:
+  const ::aspia::proto::desktop::Ping& _internal_ping() const;
+  ::aspia::proto::desktop::Ping* _internal_mutable_ping();
+  public:
+  void unsafe_arena_set_allocated_ping(
+      ::aspia::proto::desktop::Ping* ping);
+  ::aspia::proto::desktop::Ping* unsafe_arena_release_ping();
+
+  // .aspia.proto.desktop.Visibility visibility = 10;
+  bool has_visibility() const;
+  private:
+  bool _internal_has_visibility() const;
+  public:
+  void clear_visibility();
+  const ::aspia::proto::desktop::Visibility& visibility() const;
+  PROTOBUF_NODISCARD ::aspia::proto::desktop::Visibility* release_visibility();
+  ::aspia::proto::desktop::Visibility* mutable_visibility();
+  void set_allocated_visibility(::aspia::proto::desktop::Visibility* visibility);
+  private:
+  const ::aspia::proto::desktop::Visibility& _internal_visibility() const;
+  ::aspia::proto::desktop::Visibility* _internal_mutable_visibility();
+  public:
+  void unsafe_arena_set_allocated_visibility(
+      ::aspia::proto::desktop::Visibility* visibility);
+  ::aspia::proto::desktop::Visibility* unsafe_arena_release_visibility();
+
+  // .aspia.proto.desktop.VisibleArea visible_area = 11;
+  bool has_visible_area() const;
+  private:
+  bool _internal_has_visible_area() const;
+  public:
+  void clear_visible_area();
+  const ::aspia::proto::desktop::VisibleArea& visible_area() const;
+  PROTOBUF_NODISCARD ::aspia::proto::desktop::VisibleArea* release_visible_area();
+  ::aspia::proto::desktop::VisibleArea* mutable_visible_area();
+  void set_allocated_visible_area(::aspia::proto::desktop::VisibleArea* visible_area);
+  private:
+  const ::aspia::proto::desktop::VisibleArea& _internal_visible_area() const;
+  ::aspia::proto::desktop::VisibleArea* _internal_mutable_visible_area();
+  public:
+  void unsafe_arena_set_allocated_visible_area(
+      ::aspia::proto::desktop::VisibleArea* visible_area);
+  ::aspia::proto::desktop::VisibleArea* unsafe_arena_release_visible_area();
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.desktop.ClientToHost)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::aspia::proto::desktop::PointerEvent* pointer_event_;
+    ::aspia::proto::desktop::KeyEvent* key_event_;
+    ::aspia::proto::desktop::ClipboardEvent* clipboard_event_;
+    ::aspia::proto::desktop::Config* config_;
+    ::aspia::proto::desktop::VideoAck* video_ack_;
+    ::aspia::proto::desktop::Screen* screen_;
+    ::aspia::proto::desktop::RefreshRequest* refresh_request_;
+    ::aspia::proto::desktop::InputEvents* input_events_;
+    ::aspia::proto::desktop::Ping* ping_;
+    ::aspia::proto::desktop::Visibility* visibility_;
+    ::aspia::proto::desktop::VisibleArea* visible_area_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_desktop_5fsession_2eproto;
+};
+// ===================================================================
+
+
 // ===================================================================
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// KeyEvent
+
+// uint32 usb_keycode = 1;
+inline void KeyEvent::clear_usb_keycode() {
+  _impl_.usb_keycode_ = 0u;
+}
+inline uint32_t KeyEvent::_internal_usb_keycode() const {
+  return _impl_.usb_keycode_;
+}
+inline uint32_t KeyEvent::usb_keycode() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.KeyEvent.usb_keycode)
+  return _internal_usb_keycode();
+}
+inline void KeyEvent::_internal_set_usb_keycode(uint32_t value) {
+  
+  _impl_.usb_keycode_ = value;
+}
+inline void KeyEvent::set_usb_keycode(uint32_t value) {
+  _internal_set_usb_keycode(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.KeyEvent.usb_keycode)
+}
+
+// uint32 flags = 2;
+inline void KeyEvent::clear_flags() {
+  _impl_.flags_ = 0u;
+}
+inline uint32_t KeyEvent::_internal_flags() const {
+  return _impl_.flags_;
+}
+inline uint32_t KeyEvent::flags() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.KeyEvent.flags)
+  return _internal_flags();
+}
+inline void KeyEvent::_internal_set_flags(uint32_t value) {
+  
+  _impl_.flags_ = value;
+}
+inline void KeyEvent::set_flags(uint32_t value) {
+  _internal_set_flags(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.KeyEvent.flags)
+}
+
+// int64 probe_time = 3;
+inline void KeyEvent::clear_probe_time() {
+  _impl_.probe_time_ = int64_t{0};
+}
+inline int64_t KeyEvent::_internal_probe_time() const {
+  return _impl_.probe_time_;
+}
+inline int64_t KeyEvent::probe_time() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.KeyEvent.probe_time)
+  return _internal_probe_time();
+}
+inline void KeyEvent::_internal_set_probe_time(int64_t value) {
+  
+  _impl_.probe_time_ = value;
+}
+inline void KeyEvent::set_probe_time(int64_t value) {
+  _internal_set_probe_time(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.KeyEvent.probe_time)
+}
+
+// -------------------------------------------------------------------
+
+// PointerEvent
+
+// uint32 mask = 1;
+inline void PointerEvent::clear_mask() {
+  _impl_.mask_ = 0u;
+}
+inline uint32_t PointerEvent::_internal_mask() const {
+  return _impl_.mask_;
+}
+inline uint32_t PointerEvent::mask() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.PointerEvent.mask)
+  return _internal_mask();
+}
+inline void PointerEvent::_internal_set_mask(uint32_t value) {
+  
+  _impl_.mask_ = value;
+}
+inline void PointerEvent::set_mask(uint32_t value) {
+  _internal_set_mask(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.PointerEvent.mask)
+}
+
+// int32 x = 2;
+inline void PointerEvent::clear_x() {
+  _impl_.x_ = 0;
+}
+inline int32_t PointerEvent::_internal_x() const {
+  return _impl_.x_;
+}
+inline int32_t PointerEvent::x() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.PointerEvent.x)
+  return _internal_x();
+}
+inline void PointerEvent::_internal_set_x(int32_t value) {
+  
+  _impl_.x_ = value;
+}
+inline void PointerEvent::set_x(int32_t value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.PointerEvent.x)
+}
+
+// int32 y = 3;
+inline void PointerEvent::clear_y() {
+  _impl_.y_ = 0;
+}
+inline int32_t PointerEvent::_internal_y() const {
+  return _impl_.y_;
+}
+inline int32_t PointerEvent::y() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.PointerEvent.y)
+  return _internal_y();
+}
+inline void PointerEvent::_internal_set_y(int32_t value) {
+  
+  _impl_.y_ = value;
+}
+inline void PointerEvent::set_y(int32_t value) {
+  _internal_set_y(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.PointerEvent.y)
+}
+
+// int64 probe_time = 4;
+inline void PointerEvent::clear_probe_time() {
+  _impl_.probe_time_ = int64_t{0};
+}
+inline int64_t PointerEvent::_internal_probe_time() const {
+  return _impl_.probe_time_;
+}
+inline int64_t PointerEvent::probe_time() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.PointerEvent.probe_time)
+  return _internal_probe_time();
+}
+inline void PointerEvent::_internal_set_probe_time(int64_t value) {
+  
+  _impl_.probe_time_ = value;
+}
+inline void PointerEvent::set_probe_time(int64_t value) {
+  _internal_set_probe_time(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.PointerEvent.probe_time)
+}
+
+// -------------------------------------------------------------------
+
+// ClipboardEvent
+
+// string mime_type = 1;
+inline void ClipboardEvent::clear_mime_type() {
+  _impl_.mime_type_.ClearToEmpty();
+}
+inline const std::string& ClipboardEvent::mime_type() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.ClipboardEvent.mime_type)
+  return _internal_mime_type();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ClipboardEvent::set_mime_type(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.mime_type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.ClipboardEvent.mime_type)
+}
+inline std::string* ClipboardEvent::mutable_mime_type() {
+  std::string* _s = _internal_mutable_mime_type();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.ClipboardEvent.mime_type)
+  return _s;
+}
+inline const std::string& ClipboardEvent::_internal_mime_type() const {
+  return _impl_.mime_type_.Get();
+}
+inline void ClipboardEvent::_internal_set_mime_type(const std::string& value) {
+  
+  _impl_.mime_type_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ClipboardEvent::_internal_mutable_mime_type() {
+  
+  return _impl_.mime_type_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ClipboardEvent::release_mime_type() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.ClipboardEvent.mime_type)
+  return _impl_.mime_type_.Release();
+}
+inline void ClipboardEvent::set_allocated_mime_type(std::string* mime_type) {
+  if (mime_type != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.mime_type_.SetAllocated(mime_type, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.mime_type_.IsDefault()) {
+    _impl_.mime_type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.ClipboardEvent.mime_type)
+}
+
+// bytes data = 2;
+inline void ClipboardEvent::clear_data() {
+  _impl_.data_.ClearToEmpty();
+}
+inline const std::string& ClipboardEvent::data() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.ClipboardEvent.data)
+  return _internal_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ClipboardEvent::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.ClipboardEvent.data)
+}
+inline std::string* ClipboardEvent::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.ClipboardEvent.data)
+  return _s;
+}
+inline const std::string& ClipboardEvent::_internal_data() const {
+  return _impl_.data_.Get();
+}
+inline void ClipboardEvent::_internal_set_data(const std::string& value) {
+  
+  _impl_.data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ClipboardEvent::_internal_mutable_data() {
+  
+  return _impl_.data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ClipboardEvent::release_data() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.ClipboardEvent.data)
+  return _impl_.data_.Release();
+}
+inline void ClipboardEvent::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.ClipboardEvent.data)
+}
+
+// .aspia.proto.desktop.ClipboardEvent.Type type = 3;
+inline void ClipboardEvent::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::aspia::proto::desktop::ClipboardEvent_Type ClipboardEvent::_internal_type() const {
+  return static_cast< ::aspia::proto::desktop::ClipboardEvent_Type >(_impl_.type_);
+}
+inline ::aspia::proto::desktop::ClipboardEvent_Type ClipboardEvent::type() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.ClipboardEvent.type)
+  return _internal_type();
+}
+inline void ClipboardEvent::_internal_set_type(::aspia::proto::desktop::ClipboardEvent_Type value) {
+  
+  _impl_.type_ = value;
+}
+inline void ClipboardEvent::set_type(::aspia::proto::desktop::ClipboardEvent_Type value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.ClipboardEvent.type)
+}
+
+// fixed64 hash = 4;
+inline void ClipboardEvent::clear_hash() {
+  _impl_.hash_ = uint64_t{0u};
+}
+inline uint64_t ClipboardEvent::_internal_hash() const {
+  return _impl_.hash_;
+}
+inline uint64_t ClipboardEvent::hash() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.ClipboardEvent.hash)
+  return _internal_hash();
+}
+inline void ClipboardEvent::_internal_set_hash(uint64_t value) {
+  
+  _impl_.hash_ = value;
+}
+inline void ClipboardEvent::set_hash(uint64_t value) {
+  _internal_set_hash(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.ClipboardEvent.hash)
+}
+
+// uint32 size = 5;
+inline void ClipboardEvent::clear_size() {
+  _impl_.size_ = 0u;
+}
+inline uint32_t ClipboardEvent::_internal_size() const {
+  return _impl_.size_;
+}
+inline uint32_t ClipboardEvent::size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.ClipboardEvent.size)
+  return _internal_size();
+}
+inline void ClipboardEvent::_internal_set_size(uint32_t value) {
+  
+  _impl_.size_ = value;
+}
+inline void ClipboardEvent::set_size(uint32_t value) {
+  _internal_set_size(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.ClipboardEvent.size)
+}
+
+// uint32 offset = 6;
+inline void ClipboardEvent::clear_offset() {
+  _impl_.offset_ = 0u;
+}
+inline uint32_t ClipboardEvent::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline uint32_t ClipboardEvent::offset() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.ClipboardEvent.offset)
+  return _internal_offset();
+}
+inline void ClipboardEvent::_internal_set_offset(uint32_t value) {
+  
+  _impl_.offset_ = value;
+}
+inline void ClipboardEvent::set_offset(uint32_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.ClipboardEvent.offset)
+}
+
+// .aspia.proto.desktop.Compression compression = 7;
+inline void ClipboardEvent::clear_compression() {
+  _impl_.compression_ = 0;
+}
+inline ::aspia::proto::desktop::Compression ClipboardEvent::_internal_compression() const {
+  return static_cast< ::aspia::proto::desktop::Compression >(_impl_.compression_);
+}
+inline ::aspia::proto::desktop::Compression ClipboardEvent::compression() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.ClipboardEvent.compression)
+  return _internal_compression();
+}
+inline void ClipboardEvent::_internal_set_compression(::aspia::proto::desktop::Compression value) {
+  
+  _impl_.compression_ = value;
+}
+inline void ClipboardEvent::set_compression(::aspia::proto::desktop::Compression value) {
+  _internal_set_compression(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.ClipboardEvent.compression)
+}
+
+// uint32 uncompressed_size = 8;
+inline void ClipboardEvent::clear_uncompressed_size() {
+  _impl_.uncompressed_size_ = 0u;
+}
+inline uint32_t ClipboardEvent::_internal_uncompressed_size() const {
+  return _impl_.uncompressed_size_;
+}
+inline uint32_t ClipboardEvent::uncompressed_size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.ClipboardEvent.uncompressed_size)
+  return _internal_uncompressed_size();
+}
+inline void ClipboardEvent::_internal_set_uncompressed_size(uint32_t value) {
+  
+  _impl_.uncompressed_size_ = value;
+}
+inline void ClipboardEvent::set_uncompressed_size(uint32_t value) {
+  _internal_set_uncompressed_size(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.ClipboardEvent.uncompressed_size)
+}
+
+// -------------------------------------------------------------------
+
+// CursorShape
+
+// uint32 flags = 1;
+inline void CursorShape::clear_flags() {
+  _impl_.flags_ = 0u;
+}
+inline uint32_t CursorShape::_internal_flags() const {
+  return _impl_.flags_;
+}
+inline uint32_t CursorShape::flags() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.CursorShape.flags)
+  return _internal_flags();
+}
+inline void CursorShape::_internal_set_flags(uint32_t value) {
+  
+  _impl_.flags_ = value;
+}
+inline void CursorShape::set_flags(uint32_t value) {
+  _internal_set_flags(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.CursorShape.flags)
+}
+
+// int32 width = 2;
+inline void CursorShape::clear_width() {
+  _impl_.width_ = 0;
+}
+inline int32_t CursorShape::_internal_width() const {
+  return _impl_.width_;
+}
+inline int32_t CursorShape::width() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.CursorShape.width)
+  return _internal_width();
+}
+inline void CursorShape::_internal_set_width(int32_t value) {
+  
+  _impl_.width_ = value;
+}
+inline void CursorShape::set_width(int32_t value) {
+  _internal_set_width(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.CursorShape.width)
+}
+
+// int32 height = 3;
+inline void CursorShape::clear_height() {
+  _impl_.height_ = 0;
+}
+inline int32_t CursorShape::_internal_height() const {
+  return _impl_.height_;
+}
+inline int32_t CursorShape::height() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.CursorShape.height)
+  return _internal_height();
+}
+inline void CursorShape::_internal_set_height(int32_t value) {
+  
+  _impl_.height_ = value;
+}
+inline void CursorShape::set_height(int32_t value) {
+  _internal_set_height(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.CursorShape.height)
+}
+
+// int32 hotspot_x = 4;
+inline void CursorShape::clear_hotspot_x() {
+  _impl_.hotspot_x_ = 0;
+}
+inline int32_t CursorShape::_internal_hotspot_x() const {
+  return _impl_.hotspot_x_;
+}
+inline int32_t CursorShape::hotspot_x() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.CursorShape.hotspot_x)
+  return _internal_hotspot_x();
+}
+inline void CursorShape::_internal_set_hotspot_x(int32_t value) {
+  
+  _impl_.hotspot_x_ = value;
+}
+inline void CursorShape::set_hotspot_x(int32_t value) {
+  _internal_set_hotspot_x(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.CursorShape.hotspot_x)
+}
+
+// int32 hotspot_y = 5;
+inline void CursorShape::clear_hotspot_y() {
+  _impl_.hotspot_y_ = 0;
+}
+inline int32_t CursorShape::_internal_hotspot_y() const {
+  return _impl_.hotspot_y_;
+}
+inline int32_t CursorShape::hotspot_y() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.CursorShape.hotspot_y)
+  return _internal_hotspot_y();
+}
+inline void CursorShape::_internal_set_hotspot_y(int32_t value) {
+  
+  _impl_.hotspot_y_ = value;
+}
+inline void CursorShape::set_hotspot_y(int32_t value) {
+  _internal_set_hotspot_y(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.CursorShape.hotspot_y)
+}
+
+// bytes data = 6;
+inline void CursorShape::clear_data() {
+  _impl_.data_.ClearToEmpty();
+}
+inline const std::string& CursorShape::data() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.CursorShape.data)
+  return _internal_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CursorShape::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.CursorShape.data)
+}
+inline std::string* CursorShape::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.CursorShape.data)
+  return _s;
+}
+inline const std::string& CursorShape::_internal_data() const {
+  return _impl_.data_.Get();
+}
+inline void CursorShape::_internal_set_data(const std::string& value) {
+  
+  _impl_.data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CursorShape::_internal_mutable_data() {
+  
+  return _impl_.data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CursorShape::release_data() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.CursorShape.data)
+  return _impl_.data_.Release();
+}
+inline void CursorShape::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.CursorShape.data)
+}
+
+// .aspia.proto.desktop.Compression compression = 7;
+inline void CursorShape::clear_compression() {
+  _impl_.compression_ = 0;
+}
+inline ::aspia::proto::desktop::Compression CursorShape::_internal_compression() const {
+  return static_cast< ::aspia::proto::desktop::Compression >(_impl_.compression_);
+}
+inline ::aspia::proto::desktop::Compression CursorShape::compression() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.CursorShape.compression)
+  return _internal_compression();
+}
+inline void CursorShape::_internal_set_compression(::aspia::proto::desktop::Compression value) {
+  
+  _impl_.compression_ = value;
+}
+inline void CursorShape::set_compression(::aspia::proto::desktop::Compression value) {
+  _internal_set_compression(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.CursorShape.compression)
+}
+
+// uint32 cache_index = 8;
+inline void CursorShape::clear_cache_index() {
+  _impl_.cache_index_ = 0u;
+}
+inline uint32_t CursorShape::_internal_cache_index() const {
+  return _impl_.cache_index_;
+}
+inline uint32_t CursorShape::cache_index() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.CursorShape.cache_index)
+  return _internal_cache_index();
+}
+inline void CursorShape::_internal_set_cache_index(uint32_t value) {
+  
+  _impl_.cache_index_ = value;
+}
+inline void CursorShape::set_cache_index(uint32_t value) {
+  _internal_set_cache_index(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.CursorShape.cache_index)
+}
+
+// uint32 cache_size = 9;
+inline void CursorShape::clear_cache_size() {
+  _impl_.cache_size_ = 0u;
+}
+inline uint32_t CursorShape::_internal_cache_size() const {
+  return _impl_.cache_size_;
+}
+inline uint32_t CursorShape::cache_size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.CursorShape.cache_size)
+  return _internal_cache_size();
+}
+inline void CursorShape::_internal_set_cache_size(uint32_t value) {
+  
+  _impl_.cache_size_ = value;
+}
+inline void CursorShape::set_cache_size(uint32_t value) {
+  _internal_set_cache_size(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.CursorShape.cache_size)
+}
+
+// -------------------------------------------------------------------
+
+// CursorPosition
+
+// int32 x = 1;
+inline void CursorPosition::clear_x() {
+  _impl_.x_ = 0;
+}
+inline int32_t CursorPosition::_internal_x() const {
+  return _impl_.x_;
+}
+inline int32_t CursorPosition::x() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.CursorPosition.x)
+  return _internal_x();
+}
+inline void CursorPosition::_internal_set_x(int32_t value) {
+  
+  _impl_.x_ = value;
+}
+inline void CursorPosition::set_x(int32_t value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.CursorPosition.x)
+}
+
+// int32 y = 2;
+inline void CursorPosition::clear_y() {
+  _impl_.y_ = 0;
+}
+inline int32_t CursorPosition::_internal_y() const {
+  return _impl_.y_;
+}
+inline int32_t CursorPosition::y() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.CursorPosition.y)
+  return _internal_y();
+}
+inline void CursorPosition::_internal_set_y(int32_t value) {
+  
+  _impl_.y_ = value;
+}
+inline void CursorPosition::set_y(int32_t value) {
+  _internal_set_y(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.CursorPosition.y)
+}
+
+// -------------------------------------------------------------------
+
+// Rect
+
+// int32 x = 1;
+inline void Rect::clear_x() {
+  _impl_.x_ = 0;
+}
+inline int32_t Rect::_internal_x() const {
+  return _impl_.x_;
+}
+inline int32_t Rect::x() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Rect.x)
+  return _internal_x();
+}
+inline void Rect::_internal_set_x(int32_t value) {
+  
+  _impl_.x_ = value;
+}
+inline void Rect::set_x(int32_t value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Rect.x)
+}
+
+// int32 y = 2;
+inline void Rect::clear_y() {
+  _impl_.y_ = 0;
+}
+inline int32_t Rect::_internal_y() const {
+  return _impl_.y_;
+}
+inline int32_t Rect::y() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Rect.y)
+  return _internal_y();
+}
+inline void Rect::_internal_set_y(int32_t value) {
+  
+  _impl_.y_ = value;
+}
+inline void Rect::set_y(int32_t value) {
+  _internal_set_y(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Rect.y)
+}
+
+// int32 width = 3;
+inline void Rect::clear_width() {
+  _impl_.width_ = 0;
+}
+inline int32_t Rect::_internal_width() const {
+  return _impl_.width_;
+}
+inline int32_t Rect::width() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Rect.width)
+  return _internal_width();
+}
+inline void Rect::_internal_set_width(int32_t value) {
+  
+  _impl_.width_ = value;
+}
+inline void Rect::set_width(int32_t value) {
+  _internal_set_width(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Rect.width)
+}
+
+// int32 height = 4;
+inline void Rect::clear_height() {
+  _impl_.height_ = 0;
+}
+inline int32_t Rect::_internal_height() const {
+  return _impl_.height_;
+}
+inline int32_t Rect::height() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Rect.height)
+  return _internal_height();
+}
+inline void Rect::_internal_set_height(int32_t value) {
+  
+  _impl_.height_ = value;
+}
+inline void Rect::set_height(int32_t value) {
+  _internal_set_height(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Rect.height)
+}
+
+// -------------------------------------------------------------------
+
+// PixelFormat
+
+// uint32 bits_per_pixel = 1;
+inline void PixelFormat::clear_bits_per_pixel() {
+  _impl_.bits_per_pixel_ = 0u;
+}
+inline uint32_t PixelFormat::_internal_bits_per_pixel() const {
+  return _impl_.bits_per_pixel_;
+}
+inline uint32_t PixelFormat::bits_per_pixel() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.PixelFormat.bits_per_pixel)
+  return _internal_bits_per_pixel();
+}
+inline void PixelFormat::_internal_set_bits_per_pixel(uint32_t value) {
+  
+  _impl_.bits_per_pixel_ = value;
+}
+inline void PixelFormat::set_bits_per_pixel(uint32_t value) {
+  _internal_set_bits_per_pixel(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.PixelFormat.bits_per_pixel)
+}
+
+// uint32 red_max = 2;
+inline void PixelFormat::clear_red_max() {
+  _impl_.red_max_ = 0u;
+}
+inline uint32_t PixelFormat::_internal_red_max() const {
+  return _impl_.red_max_;
+}
+inline uint32_t PixelFormat::red_max() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.PixelFormat.red_max)
+  return _internal_red_max();
+}
+inline void PixelFormat::_internal_set_red_max(uint32_t value) {
+  
+  _impl_.red_max_ = value;
+}
+inline void PixelFormat::set_red_max(uint32_t value) {
+  _internal_set_red_max(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.PixelFormat.red_max)
+}
+
+// uint32 green_max = 3;
+inline void PixelFormat::clear_green_max() {
+  _impl_.green_max_ = 0u;
+}
+inline uint32_t PixelFormat::_internal_green_max() const {
+  return _impl_.green_max_;
+}
+inline uint32_t PixelFormat::green_max() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.PixelFormat.green_max)
+  return _internal_green_max();
+}
+inline void PixelFormat::_internal_set_green_max(uint32_t value) {
+  
+  _impl_.green_max_ = value;
+}
+inline void PixelFormat::set_green_max(uint32_t value) {
+  _internal_set_green_max(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.PixelFormat.green_max)
+}
+
+// uint32 blue_max = 4;
+inline void PixelFormat::clear_blue_max() {
+  _impl_.blue_max_ = 0u;
+}
+inline uint32_t PixelFormat::_internal_blue_max() const {
+  return _impl_.blue_max_;
+}
+inline uint32_t PixelFormat::blue_max() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.PixelFormat.blue_max)
+  return _internal_blue_max();
+}
+inline void PixelFormat::_internal_set_blue_max(uint32_t value) {
+  
+  _impl_.blue_max_ = value;
+}
+inline void PixelFormat::set_blue_max(uint32_t value) {
+  _internal_set_blue_max(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.PixelFormat.blue_max)
+}
+
+// uint32 red_shift = 5;
+inline void PixelFormat::clear_red_shift() {
+  _impl_.red_shift_ = 0u;
+}
+inline uint32_t PixelFormat::_internal_red_shift() const {
+  return _impl_.red_shift_;
+}
+inline uint32_t PixelFormat::red_shift() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.PixelFormat.red_shift)
+  return _internal_red_shift();
+}
+inline void PixelFormat::_internal_set_red_shift(uint32_t value) {
+  
+  _impl_.red_shift_ = value;
+}
+inline void PixelFormat::set_red_shift(uint32_t value) {
+  _internal_set_red_shift(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.PixelFormat.red_shift)
+}
+
+// uint32 green_shift = 6;
+inline void PixelFormat::clear_green_shift() {
+  _impl_.green_shift_ = 0u;
+}
+inline uint32_t PixelFormat::_internal_green_shift() const {
+  return _impl_.green_shift_;
+}
+inline uint32_t PixelFormat::green_shift() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.PixelFormat.green_shift)
+  return _internal_green_shift();
+}
+inline void PixelFormat::_internal_set_green_shift(uint32_t value) {
+  
+  _impl_.green_shift_ = value;
+}
+inline void PixelFormat::set_green_shift(uint32_t value) {
+  _internal_set_green_shift(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.PixelFormat.green_shift)
+}
+
+// uint32 blue_shift = 7;
+inline void PixelFormat::clear_blue_shift() {
+  _impl_.blue_shift_ = 0u;
+}
+inline uint32_t PixelFormat::_internal_blue_shift() const {
+  return _impl_.blue_shift_;
+}
+inline uint32_t PixelFormat::blue_shift() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.PixelFormat.blue_shift)
+  return _internal_blue_shift();
+}
+inline void PixelFormat::_internal_set_blue_shift(uint32_t value) {
+  
+  _impl_.blue_shift_ = value;
+}
+inline void PixelFormat::set_blue_shift(uint32_t value) {
+  _internal_set_blue_shift(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.PixelFormat.blue_shift)
+}
+
+// -------------------------------------------------------------------
+
+// Size
+
+// int32 width = 1;
+inline void Size::clear_width() {
+  _impl_.width_ = 0;
+}
+inline int32_t Size::_internal_width() const {
+  return _impl_.width_;
+}
+inline int32_t Size::width() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Size.width)
+  return _internal_width();
+}
+inline void Size::_internal_set_width(int32_t value) {
+  
+  _impl_.width_ = value;
+}
+inline void Size::set_width(int32_t value) {
+  _internal_set_width(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Size.width)
+}
+
+// int32 height = 2;
+inline void Size::clear_height() {
+  _impl_.height_ = 0;
+}
+inline int32_t Size::_internal_height() const {
+  return _impl_.height_;
+}
+inline int32_t Size::height() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Size.height)
+  return _internal_height();
+}
+inline void Size::_internal_set_height(int32_t value) {
+  
+  _impl_.height_ = value;
+}
+inline void Size::set_height(int32_t value) {
+  _internal_set_height(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Size.height)
+}
+
+// -------------------------------------------------------------------
+
+// VideoPacketFormat
+
+// .aspia.proto.desktop.Size screen_size = 1;
+inline bool VideoPacketFormat::_internal_has_screen_size() const {
+  return this != internal_default_instance() && _impl_.screen_size_ != nullptr;
+}
+inline bool VideoPacketFormat::has_screen_size() const {
+  return _internal_has_screen_size();
+}
+inline void VideoPacketFormat::clear_screen_size() {
+  if (GetArenaForAllocation() == nullptr && _impl_.screen_size_ != nullptr) {
+    delete _impl_.screen_size_;
+  }
+  _impl_.screen_size_ = nullptr;
+}
+inline const ::aspia::proto::desktop::Size& VideoPacketFormat::_internal_screen_size() const {
+  const ::aspia::proto::desktop::Size* p = _impl_.screen_size_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::desktop::Size&>(
+      ::aspia::proto::desktop::_Size_default_instance_);
+}
+inline const ::aspia::proto::desktop::Size& VideoPacketFormat::screen_size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.VideoPacketFormat.screen_size)
+  return _internal_screen_size();
+}
+inline void VideoPacketFormat::unsafe_arena_set_allocated_screen_size(
+    ::aspia::proto::desktop::Size* screen_size) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.screen_size_);
+  }
+  _impl_.screen_size_ = screen_size;
+  if (screen_size) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.desktop.VideoPacketFormat.screen_size)
+}
+inline ::aspia::proto::desktop::Size* VideoPacketFormat::release_screen_size() {
+  
+  ::aspia::proto::desktop::Size* temp = _impl_.screen_size_;
+  _impl_.screen_size_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::desktop::Size* VideoPacketFormat::unsafe_arena_release_screen_size() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.VideoPacketFormat.screen_size)
+  
+  ::aspia::proto::desktop::Size* temp = _impl_.screen_size_;
+  _impl_.screen_size_ = nullptr;
+  return temp;
+}
+inline ::aspia::proto::desktop::Size* VideoPacketFormat::_internal_mutable_screen_size() {
+  
+  if (_impl_.screen_size_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::desktop::Size>(GetArenaForAllocation());
+    _impl_.screen_size_ = p;
+  }
+  return _impl_.screen_size_;
+}
+inline ::aspia::proto::desktop::Size* VideoPacketFormat::mutable_screen_size() {
+  ::aspia::proto::desktop::Size* _msg = _internal_mutable_screen_size();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.VideoPacketFormat.screen_size)
+  return _msg;
+}
+inline void VideoPacketFormat::set_allocated_screen_size(::aspia::proto::desktop::Size* screen_size) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.screen_size_;
+  }
+  if (screen_size) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(screen_size);
+    if (message_arena != submessage_arena) {
+      screen_size = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, screen_size, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.screen_size_ = screen_size;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.VideoPacketFormat.screen_size)
+}
+
+// .aspia.proto.desktop.PixelFormat pixel_format = 2;
+inline bool VideoPacketFormat::_internal_has_pixel_format() const {
+  return this != internal_default_instance() && _impl_.pixel_format_ != nullptr;
+}
+inline bool VideoPacketFormat::has_pixel_format() const {
+  return _internal_has_pixel_format();
+}
+inline void VideoPacketFormat::clear_pixel_format() {
+  if (GetArenaForAllocation() == nullptr && _impl_.pixel_format_ != nullptr) {
+    delete _impl_.pixel_format_;
+  }
+  _impl_.pixel_format_ = nullptr;
+}
+inline const ::aspia::proto::desktop::PixelFormat& VideoPacketFormat::_internal_pixel_format() const {
+  const ::aspia::proto::desktop::PixelFormat* p = _impl_.pixel_format_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::desktop::PixelFormat&>(
+      ::aspia::proto::desktop::_PixelFormat_default_instance_);
+}
+inline const ::aspia::proto::desktop::PixelFormat& VideoPacketFormat::pixel_format() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.VideoPacketFormat.pixel_format)
+  return _internal_pixel_format();
+}
+inline void VideoPacketFormat::unsafe_arena_set_allocated_pixel_format(
+    ::aspia::proto::desktop::PixelFormat* pixel_format) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pixel_format_);
+  }
+  _impl_.pixel_format_ = pixel_format;
+  if (pixel_format) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.desktop.VideoPacketFormat.pixel_format)
+}
+inline ::aspia::proto::desktop::PixelFormat* VideoPacketFormat::release_pixel_format() {
+  
+  ::aspia::proto::desktop::PixelFormat* temp = _impl_.pixel_format_;
+  _impl_.pixel_format_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::desktop::PixelFormat* VideoPacketFormat::unsafe_arena_release_pixel_format() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.VideoPacketFormat.pixel_format)
+  
+  ::aspia::proto::desktop::PixelFormat* temp = _impl_.pixel_format_;
+  _impl_.pixel_format_ = nullptr;
+  return temp;
+}
+inline ::aspia::proto::desktop::PixelFormat* VideoPacketFormat::_internal_mutable_pixel_format() {
+  
+  if (_impl_.pixel_format_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::desktop::PixelFormat>(GetArenaForAllocation());
+    _impl_.pixel_format_ = p;
+  }
+  return _impl_.pixel_format_;
+}
+inline ::aspia::proto::desktop::PixelFormat* VideoPacketFormat::mutable_pixel_format() {
+  ::aspia::proto::desktop::PixelFormat* _msg = _internal_mutable_pixel_format();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.VideoPacketFormat.pixel_format)
+  return _msg;
+}
+inline void VideoPacketFormat::set_allocated_pixel_format(::aspia::proto::desktop::PixelFormat* pixel_format) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.pixel_format_;
+  }
+  if (pixel_format) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(pixel_format);
+    if (message_arena != submessage_arena) {
+      pixel_format = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, pixel_format, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.pixel_format_ = pixel_format;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.VideoPacketFormat.pixel_format)
+}
+
+// uint32 tile_cache_size = 3;
+inline void VideoPacketFormat::clear_tile_cache_size() {
+  _impl_.tile_cache_size_ = 0u;
+}
+inline uint32_t VideoPacketFormat::_internal_tile_cache_size() const {
+  return _impl_.tile_cache_size_;
+}
+inline uint32_t VideoPacketFormat::tile_cache_size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.VideoPacketFormat.tile_cache_size)
+  return _internal_tile_cache_size();
+}
+inline void VideoPacketFormat::_internal_set_tile_cache_size(uint32_t value) {
+  
+  _impl_.tile_cache_size_ = value;
+}
+inline void VideoPacketFormat::set_tile_cache_size(uint32_t value) {
+  _internal_set_tile_cache_size(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.VideoPacketFormat.tile_cache_size)
+}
+
+// -------------------------------------------------------------------
+
+// CopyRect
+
+// int32 source_x = 1;
+inline void CopyRect::clear_source_x() {
+  _impl_.source_x_ = 0;
+}
+inline int32_t CopyRect::_internal_source_x() const {
+  return _impl_.source_x_;
+}
+inline int32_t CopyRect::source_x() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.CopyRect.source_x)
+  return _internal_source_x();
+}
+inline void CopyRect::_internal_set_source_x(int32_t value) {
+  
+  _impl_.source_x_ = value;
+}
+inline void CopyRect::set_source_x(int32_t value) {
+  _internal_set_source_x(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.CopyRect.source_x)
+}
+
+// int32 source_y = 2;
+inline void CopyRect::clear_source_y() {
+  _impl_.source_y_ = 0;
+}
+inline int32_t CopyRect::_internal_source_y() const {
+  return _impl_.source_y_;
+}
+inline int32_t CopyRect::source_y() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.CopyRect.source_y)
+  return _internal_source_y();
+}
+inline void CopyRect::_internal_set_source_y(int32_t value) {
+  
+  _impl_.source_y_ = value;
+}
+inline void CopyRect::set_source_y(int32_t value) {
+  _internal_set_source_y(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.CopyRect.source_y)
+}
+
+// .aspia.proto.desktop.Rect target_rect = 3;
+inline bool CopyRect::_internal_has_target_rect() const {
+  return this != internal_default_instance() && _impl_.target_rect_ != nullptr;
+}
+inline bool CopyRect::has_target_rect() const {
+  return _internal_has_target_rect();
+}
+inline void CopyRect::clear_target_rect() {
+  if (GetArenaForAllocation() == nullptr && _impl_.target_rect_ != nullptr) {
+    delete _impl_.target_rect_;
+  }
+  _impl_.target_rect_ = nullptr;
+}
+inline const ::aspia::proto::desktop::Rect& CopyRect::_internal_target_rect() const {
+  const ::aspia::proto::desktop::Rect* p = _impl_.target_rect_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::desktop::Rect&>(
+      ::aspia::proto::desktop::_Rect_default_instance_);
+}
+inline const ::aspia::proto::desktop::Rect& CopyRect::target_rect() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.CopyRect.target_rect)
+  return _internal_target_rect();
+}
+inline void CopyRect::unsafe_arena_set_allocated_target_rect(
+    ::aspia::proto::desktop::Rect* target_rect) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.target_rect_);
+  }
+  _impl_.target_rect_ = target_rect;
+  if (target_rect) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.desktop.CopyRect.target_rect)
+}
+inline ::aspia::proto::desktop::Rect* CopyRect::release_target_rect() {
+  
+  ::aspia::proto::desktop::Rect* temp = _impl_.target_rect_;
+  _impl_.target_rect_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::desktop::Rect* CopyRect::unsafe_arena_release_target_rect() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.CopyRect.target_rect)
+  
+  ::aspia::proto::desktop::Rect* temp = _impl_.target_rect_;
+  _impl_.target_rect_ = nullptr;
+  return temp;
+}
+inline ::aspia::proto::desktop::Rect* CopyRect::_internal_mutable_target_rect() {
+  
+  if (_impl_.target_rect_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::desktop::Rect>(GetArenaForAllocation());
+    _impl_.target_rect_ = p;
+  }
+  return _impl_.target_rect_;
+}
+inline ::aspia::proto::desktop::Rect* CopyRect::mutable_target_rect() {
+  ::aspia::proto::desktop::Rect* _msg = _internal_mutable_target_rect();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.CopyRect.target_rect)
+  return _msg;
+}
+inline void CopyRect::set_allocated_target_rect(::aspia::proto::desktop::Rect* target_rect) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.target_rect_;
+  }
+  if (target_rect) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(target_rect);
+    if (message_arena != submessage_arena) {
+      target_rect = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, target_rect, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.target_rect_ = target_rect;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.CopyRect.target_rect)
+}
+
+// -------------------------------------------------------------------
+
+// VideoPacket
+
+// .aspia.proto.desktop.VideoEncoding encoding = 1;
+inline void VideoPacket::clear_encoding() {
+  _impl_.encoding_ = 0;
+}
+inline ::aspia::proto::desktop::VideoEncoding VideoPacket::_internal_encoding() const {
+  return static_cast< ::aspia::proto::desktop::VideoEncoding >(_impl_.encoding_);
+}
+inline ::aspia::proto::desktop::VideoEncoding VideoPacket::encoding() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.VideoPacket.encoding)
+  return _internal_encoding();
+}
+inline void VideoPacket::_internal_set_encoding(::aspia::proto::desktop::VideoEncoding value) {
+  
+  _impl_.encoding_ = value;
+}
+inline void VideoPacket::set_encoding(::aspia::proto::desktop::VideoEncoding value) {
+  _internal_set_encoding(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.VideoPacket.encoding)
+}
+
+// .aspia.proto.desktop.VideoPacketFormat format = 2;
+inline bool VideoPacket::_internal_has_format() const {
+  return this != internal_default_instance() && _impl_.format_ != nullptr;
+}
+inline bool VideoPacket::has_format() const {
+  return _internal_has_format();
+}
+inline void VideoPacket::clear_format() {
+  if (GetArenaForAllocation() == nullptr && _impl_.format_ != nullptr) {
+    delete _impl_.format_;
+  }
+  _impl_.format_ = nullptr;
+}
+inline const ::aspia::proto::desktop::VideoPacketFormat& VideoPacket::_internal_format() const {
+  const ::aspia::proto::desktop::VideoPacketFormat* p = _impl_.format_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::desktop::VideoPacketFormat&>(
+      ::aspia::proto::desktop::_VideoPacketFormat_default_instance_);
+}
+inline const ::aspia::proto::desktop::VideoPacketFormat& VideoPacket::format() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.VideoPacket.format)
+  return _internal_format();
+}
+inline void VideoPacket::unsafe_arena_set_allocated_format(
+    ::aspia::proto::desktop::VideoPacketFormat* format) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.format_);
+  }
+  _impl_.format_ = format;
+  if (format) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.desktop.VideoPacket.format)
+}
+inline ::aspia::proto::desktop::VideoPacketFormat* VideoPacket::release_format() {
+  
+  ::aspia::proto::desktop::VideoPacketFormat* temp = _impl_.format_;
+  _impl_.format_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::desktop::VideoPacketFormat* VideoPacket::unsafe_arena_release_format() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.VideoPacket.format)
+  
+  ::aspia::proto::desktop::VideoPacketFormat* temp = _impl_.format_;
+  _impl_.format_ = nullptr;
+  return temp;
+}
+inline ::aspia::proto::desktop::VideoPacketFormat* VideoPacket::_internal_mutable_format() {
+  
+  if (_impl_.format_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::desktop::VideoPacketFormat>(GetArenaForAllocation());
+    _impl_.format_ = p;
+  }
+  return _impl_.format_;
+}
+inline ::aspia::proto::desktop::VideoPacketFormat* VideoPacket::mutable_format() {
+  ::aspia::proto::desktop::VideoPacketFormat* _msg = _internal_mutable_format();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.VideoPacket.format)
+  return _msg;
+}
+inline void VideoPacket::set_allocated_format(::aspia::proto::desktop::VideoPacketFormat* format) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.format_;
+  }
+  if (format) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(format);
+    if (message_arena != submessage_arena) {
+      format = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, format, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.format_ = format;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.VideoPacket.format)
+}
+
+// repeated .aspia.proto.desktop.Rect dirty_rect = 3;
+inline int VideoPacket::_internal_dirty_rect_size() const {
+  return _impl_.dirty_rect_.size();
+}
+inline int VideoPacket::dirty_rect_size() const {
+  return _internal_dirty_rect_size();
+}
+inline void VideoPacket::clear_dirty_rect() {
+  _impl_.dirty_rect_.Clear();
+}
+inline ::aspia::proto::desktop::Rect* VideoPacket::mutable_dirty_rect(int index) {
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.VideoPacket.dirty_rect)
+  return _impl_.dirty_rect_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::desktop::Rect >*
+VideoPacket::mutable_dirty_rect() {
+  // @@protoc_insertion_point(field_mutable_list:aspia.proto.desktop.VideoPacket.dirty_rect)
+  return &_impl_.dirty_rect_;
+}
+inline const ::aspia::proto::desktop::Rect& VideoPacket::_internal_dirty_rect(int index) const {
+  return _impl_.dirty_rect_.Get(index);
+}
+inline const ::aspia::proto::desktop::Rect& VideoPacket::dirty_rect(int index) const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.VideoPacket.dirty_rect)
+  return _internal_dirty_rect(index);
+}
+inline ::aspia::proto::desktop::Rect* VideoPacket::_internal_add_dirty_rect() {
+  return _impl_.dirty_rect_.Add();
+}
+inline ::aspia::proto::desktop::Rect* VideoPacket::add_dirty_rect() {
+  ::aspia::proto::desktop::Rect* _add = _internal_add_dirty_rect();
+  // @@protoc_insertion_point(field_add:aspia.proto.desktop.VideoPacket.dirty_rect)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::desktop::Rect >&
+VideoPacket::dirty_rect() const {
+  // @@protoc_insertion_point(field_list:aspia.proto.desktop.VideoPacket.dirty_rect)
+  return _impl_.dirty_rect_;
+}
+
+// bytes data = 4;
+inline void VideoPacket::clear_data() {
+  _impl_.data_.ClearToEmpty();
+}
+inline const std::string& VideoPacket::data() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.VideoPacket.data)
+  return _internal_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void VideoPacket::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.VideoPacket.data)
+}
+inline std::string* VideoPacket::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.VideoPacket.data)
+  return _s;
+}
+inline const std::string& VideoPacket::_internal_data() const {
+  return _impl_.data_.Get();
+}
+inline void VideoPacket::_internal_set_data(const std::string& value) {
+  
+  _impl_.data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* VideoPacket::_internal_mutable_data() {
+  
+  return _impl_.data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* VideoPacket::release_data() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.VideoPacket.data)
+  return _impl_.data_.Release();
+}
+inline void VideoPacket::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.VideoPacket.data)
+}
+
+// repeated .aspia.proto.desktop.CopyRect copy_rect = 5;
+inline int VideoPacket::_internal_copy_rect_size() const {
+  return _impl_.copy_rect_.size();
+}
+inline int VideoPacket::copy_rect_size() const {
+  return _internal_copy_rect_size();
+}
+inline void VideoPacket::clear_copy_rect() {
+  _impl_.copy_rect_.Clear();
+}
+inline ::aspia::proto::desktop::CopyRect* VideoPacket::mutable_copy_rect(int index) {
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.VideoPacket.copy_rect)
+  return _impl_.copy_rect_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::desktop::CopyRect >*
+VideoPacket::mutable_copy_rect() {
+  // @@protoc_insertion_point(field_mutable_list:aspia.proto.desktop.VideoPacket.copy_rect)
+  return &_impl_.copy_rect_;
+}
+inline const ::aspia::proto::desktop::CopyRect& VideoPacket::_internal_copy_rect(int index) const {
+  return _impl_.copy_rect_.Get(index);
+}
+inline const ::aspia::proto::desktop::CopyRect& VideoPacket::copy_rect(int index) const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.VideoPacket.copy_rect)
+  return _internal_copy_rect(index);
+}
+inline ::aspia::proto::desktop::CopyRect* VideoPacket::_internal_add_copy_rect() {
+  return _impl_.copy_rect_.Add();
+}
+inline ::aspia::proto::desktop::CopyRect* VideoPacket::add_copy_rect() {
+  ::aspia::proto::desktop::CopyRect* _add = _internal_add_copy_rect();
+  // @@protoc_insertion_point(field_add:aspia.proto.desktop.VideoPacket.copy_rect)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::desktop::CopyRect >&
+VideoPacket::copy_rect() const {
+  // @@protoc_insertion_point(field_list:aspia.proto.desktop.VideoPacket.copy_rect)
+  return _impl_.copy_rect_;
+}
+
+// uint32 frame_id = 6;
+inline void VideoPacket::clear_frame_id() {
+  _impl_.frame_id_ = 0u;
+}
+inline uint32_t VideoPacket::_internal_frame_id() const {
+  return _impl_.frame_id_;
+}
+inline uint32_t VideoPacket::frame_id() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.VideoPacket.frame_id)
+  return _internal_frame_id();
+}
+inline void VideoPacket::_internal_set_frame_id(uint32_t value) {
+  
+  _impl_.frame_id_ = value;
+}
+inline void VideoPacket::set_frame_id(uint32_t value) {
+  _internal_set_frame_id(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.VideoPacket.frame_id)
+}
+
+// repeated bytes chunk = 7;
+inline int VideoPacket::_internal_chunk_size() const {
+  return _impl_.chunk_.size();
+}
+inline int VideoPacket::chunk_size() const {
+  return _internal_chunk_size();
+}
+inline void VideoPacket::clear_chunk() {
+  _impl_.chunk_.Clear();
+}
+inline std::string* VideoPacket::add_chunk() {
+  std::string* _s = _internal_add_chunk();
+  // @@protoc_insertion_point(field_add_mutable:aspia.proto.desktop.VideoPacket.chunk)
+  return _s;
+}
+inline const std::string& VideoPacket::_internal_chunk(int index) const {
+  return _impl_.chunk_.Get(index);
+}
+inline const std::string& VideoPacket::chunk(int index) const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.VideoPacket.chunk)
+  return _internal_chunk(index);
+}
+inline std::string* VideoPacket::mutable_chunk(int index) {
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.VideoPacket.chunk)
+  return _impl_.chunk_.Mutable(index);
+}
+inline void VideoPacket::set_chunk(int index, const std::string& value) {
+  _impl_.chunk_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.VideoPacket.chunk)
+}
+inline void VideoPacket::set_chunk(int index, std::string&& value) {
+  _impl_.chunk_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.VideoPacket.chunk)
+}
+inline void VideoPacket::set_chunk(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.chunk_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:aspia.proto.desktop.VideoPacket.chunk)
+}
+inline void VideoPacket::set_chunk(int index, const void* value, size_t size) {
+  _impl_.chunk_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:aspia.proto.desktop.VideoPacket.chunk)
+}
+inline std::string* VideoPacket::_internal_add_chunk() {
+  return _impl_.chunk_.Add();
+}
+inline void VideoPacket::add_chunk(const std::string& value) {
+  _impl_.chunk_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:aspia.proto.desktop.VideoPacket.chunk)
+}
+inline void VideoPacket::add_chunk(std::string&& value) {
+  _impl_.chunk_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:aspia.proto.desktop.VideoPacket.chunk)
+}
+inline void VideoPacket::add_chunk(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.chunk_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:aspia.proto.desktop.VideoPacket.chunk)
+}
+inline void VideoPacket::add_chunk(const void* value, size_t size) {
+  _impl_.chunk_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:aspia.proto.desktop.VideoPacket.chunk)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+VideoPacket::chunk() const {
+  // @@protoc_insertion_point(field_list:aspia.proto.desktop.VideoPacket.chunk)
+  return _impl_.chunk_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+VideoPacket::mutable_chunk() {
+  // @@protoc_insertion_point(field_mutable_list:aspia.proto.desktop.VideoPacket.chunk)
+  return &_impl_.chunk_;
+}
+
+// bool persistent_stream = 8;
+inline void VideoPacket::clear_persistent_stream() {
+  _impl_.persistent_stream_ = false;
+}
+inline bool VideoPacket::_internal_persistent_stream() const {
+  return _impl_.persistent_stream_;
+}
+inline bool VideoPacket::persistent_stream() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.VideoPacket.persistent_stream)
+  return _internal_persistent_stream();
+}
+inline void VideoPacket::_internal_set_persistent_stream(bool value) {
+  
+  _impl_.persistent_stream_ = value;
+}
+inline void VideoPacket::set_persistent_stream(bool value) {
+  _internal_set_persistent_stream(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.VideoPacket.persistent_stream)
+}
+
+// repeated .aspia.proto.desktop.VideoPacket layer = 9;
+inline int VideoPacket::_internal_layer_size() const {
+  return _impl_.layer_.size();
+}
+inline int VideoPacket::layer_size() const {
+  return _internal_layer_size();
+}
+inline void VideoPacket::clear_layer() {
+  _impl_.layer_.Clear();
+}
+inline ::aspia::proto::desktop::VideoPacket* VideoPacket::mutable_layer(int index) {
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.VideoPacket.layer)
+  return _impl_.layer_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::desktop::VideoPacket >*
+VideoPacket::mutable_layer() {
+  // @@protoc_insertion_point(field_mutable_list:aspia.proto.desktop.VideoPacket.layer)
+  return &_impl_.layer_;
+}
+inline const ::aspia::proto::desktop::VideoPacket& VideoPacket::_internal_layer(int index) const {
+  return _impl_.layer_.Get(index);
+}
+inline const ::aspia::proto::desktop::VideoPacket& VideoPacket::layer(int index) const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.VideoPacket.layer)
+  return _internal_layer(index);
+}
+inline ::aspia::proto::desktop::VideoPacket* VideoPacket::_internal_add_layer() {
+  return _impl_.layer_.Add();
+}
+inline ::aspia::proto::desktop::VideoPacket* VideoPacket::add_layer() {
+  ::aspia::proto::desktop::VideoPacket* _add = _internal_add_layer();
+  // @@protoc_insertion_point(field_add:aspia.proto.desktop.VideoPacket.layer)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::desktop::VideoPacket >&
+VideoPacket::layer() const {
+  // @@protoc_insertion_point(field_list:aspia.proto.desktop.VideoPacket.layer)
+  return _impl_.layer_;
+}
+
+// uint32 temporal_layer = 10;
+inline void VideoPacket::clear_temporal_layer() {
+  _impl_.temporal_layer_ = 0u;
+}
+inline uint32_t VideoPacket::_internal_temporal_layer() const {
+  return _impl_.temporal_layer_;
+}
+inline uint32_t VideoPacket::temporal_layer() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.VideoPacket.temporal_layer)
+  return _internal_temporal_layer();
+}
+inline void VideoPacket::_internal_set_temporal_layer(uint32_t value) {
+  
+  _impl_.temporal_layer_ = value;
+}
+inline void VideoPacket::set_temporal_layer(uint32_t value) {
+  _internal_set_temporal_layer(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.VideoPacket.temporal_layer)
+}
+
+// uint32 trace_id = 11;
+inline void VideoPacket::clear_trace_id() {
+  _impl_.trace_id_ = 0u;
+}
+inline uint32_t VideoPacket::_internal_trace_id() const {
+  return _impl_.trace_id_;
+}
+inline uint32_t VideoPacket::trace_id() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.VideoPacket.trace_id)
+  return _internal_trace_id();
+}
+inline void VideoPacket::_internal_set_trace_id(uint32_t value) {
+  
+  _impl_.trace_id_ = value;
+}
+inline void VideoPacket::set_trace_id(uint32_t value) {
+  _internal_set_trace_id(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.VideoPacket.trace_id)
+}
+
+// int64 capture_time = 12;
+inline void VideoPacket::clear_capture_time() {
+  _impl_.capture_time_ = int64_t{0};
+}
+inline int64_t VideoPacket::_internal_capture_time() const {
+  return _impl_.capture_time_;
+}
+inline int64_t VideoPacket::capture_time() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.VideoPacket.capture_time)
+  return _internal_capture_time();
+}
+inline void VideoPacket::_internal_set_capture_time(int64_t value) {
+  
+  _impl_.capture_time_ = value;
+}
+inline void VideoPacket::set_capture_time(int64_t value) {
+  _internal_set_capture_time(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.VideoPacket.capture_time)
+}
+
+// uint32 encode_time = 13;
+inline void VideoPacket::clear_encode_time() {
+  _impl_.encode_time_ = 0u;
+}
+inline uint32_t VideoPacket::_internal_encode_time() const {
+  return _impl_.encode_time_;
+}
+inline uint32_t VideoPacket::encode_time() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.VideoPacket.encode_time)
+  return _internal_encode_time();
+}
+inline void VideoPacket::_internal_set_encode_time(uint32_t value) {
+  
+  _impl_.encode_time_ = value;
+}
+inline void VideoPacket::set_encode_time(uint32_t value) {
+  _internal_set_encode_time(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.VideoPacket.encode_time)
+}
+
+// bytes packed_dirty_rect = 14;
+inline void VideoPacket::clear_packed_dirty_rect() {
+  _impl_.packed_dirty_rect_.ClearToEmpty();
+}
+inline const std::string& VideoPacket::packed_dirty_rect() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.VideoPacket.packed_dirty_rect)
+  return _internal_packed_dirty_rect();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void VideoPacket::set_packed_dirty_rect(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.packed_dirty_rect_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.VideoPacket.packed_dirty_rect)
+}
+inline std::string* VideoPacket::mutable_packed_dirty_rect() {
+  std::string* _s = _internal_mutable_packed_dirty_rect();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.VideoPacket.packed_dirty_rect)
+  return _s;
+}
+inline const std::string& VideoPacket::_internal_packed_dirty_rect() const {
+  return _impl_.packed_dirty_rect_.Get();
+}
+inline void VideoPacket::_internal_set_packed_dirty_rect(const std::string& value) {
+  
+  _impl_.packed_dirty_rect_.Set(value, GetArenaForAllocation());
+}
+inline std::string* VideoPacket::_internal_mutable_packed_dirty_rect() {
+  
+  return _impl_.packed_dirty_rect_.Mutable(GetArenaForAllocation());
+}
+inline std::string* VideoPacket::release_packed_dirty_rect() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.VideoPacket.packed_dirty_rect)
+  return _impl_.packed_dirty_rect_.Release();
+}
+inline void VideoPacket::set_allocated_packed_dirty_rect(std::string* packed_dirty_rect) {
+  if (packed_dirty_rect != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.packed_dirty_rect_.SetAllocated(packed_dirty_rect, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.packed_dirty_rect_.IsDefault()) {
+    _impl_.packed_dirty_rect_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.VideoPacket.packed_dirty_rect)
+}
+
+// float psnr = 15;
+inline void VideoPacket::clear_psnr() {
+  _impl_.psnr_ = 0;
+}
+inline float VideoPacket::_internal_psnr() const {
+  return _impl_.psnr_;
+}
+inline float VideoPacket::psnr() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.VideoPacket.psnr)
+  return _internal_psnr();
+}
+inline void VideoPacket::_internal_set_psnr(float value) {
+  
+  _impl_.psnr_ = value;
+}
+inline void VideoPacket::set_psnr(float value) {
+  _internal_set_psnr(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.VideoPacket.psnr)
+}
+
+// float ssim = 16;
+inline void VideoPacket::clear_ssim() {
+  _impl_.ssim_ = 0;
+}
+inline float VideoPacket::_internal_ssim() const {
+  return _impl_.ssim_;
+}
+inline float VideoPacket::ssim() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.VideoPacket.ssim)
+  return _internal_ssim();
+}
+inline void VideoPacket::_internal_set_ssim(float value) {
+  
+  _impl_.ssim_ = value;
+}
+inline void VideoPacket::set_ssim(float value) {
+  _internal_set_ssim(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.VideoPacket.ssim)
+}
+
+// -------------------------------------------------------------------
+
+// ConfigRequest
+
+// uint32 video_encodings = 1;
+inline void ConfigRequest::clear_video_encodings() {
+  _impl_.video_encodings_ = 0u;
+}
+inline uint32_t ConfigRequest::_internal_video_encodings() const {
+  return _impl_.video_encodings_;
+}
+inline uint32_t ConfigRequest::video_encodings() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.ConfigRequest.video_encodings)
+  return _internal_video_encodings();
+}
+inline void ConfigRequest::_internal_set_video_encodings(uint32_t value) {
+  
+  _impl_.video_encodings_ = value;
+}
+inline void ConfigRequest::set_video_encodings(uint32_t value) {
+  _internal_set_video_encodings(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.ConfigRequest.video_encodings)
+}
+
+// uint32 features = 2;
+inline void ConfigRequest::clear_features() {
+  _impl_.features_ = 0u;
+}
+inline uint32_t ConfigRequest::_internal_features() const {
+  return _impl_.features_;
+}
+inline uint32_t ConfigRequest::features() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.ConfigRequest.features)
+  return _internal_features();
+}
+inline void ConfigRequest::_internal_set_features(uint32_t value) {
+  
+  _impl_.features_ = value;
+}
+inline void ConfigRequest::set_features(uint32_t value) {
+  _internal_set_features(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.ConfigRequest.features)
+}
+
+// -------------------------------------------------------------------
+
+// FrameHashes
+
+// .aspia.proto.desktop.Size screen_size = 1;
+inline bool FrameHashes::_internal_has_screen_size() const {
+  return this != internal_default_instance() && _impl_.screen_size_ != nullptr;
+}
+inline bool FrameHashes::has_screen_size() const {
+  return _internal_has_screen_size();
+}
+inline void FrameHashes::clear_screen_size() {
+  if (GetArenaForAllocation() == nullptr && _impl_.screen_size_ != nullptr) {
+    delete _impl_.screen_size_;
+  }
+  _impl_.screen_size_ = nullptr;
+}
+inline const ::aspia::proto::desktop::Size& FrameHashes::_internal_screen_size() const {
+  const ::aspia::proto::desktop::Size* p = _impl_.screen_size_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::desktop::Size&>(
+      ::aspia::proto::desktop::_Size_default_instance_);
+}
+inline const ::aspia::proto::desktop::Size& FrameHashes::screen_size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.FrameHashes.screen_size)
+  return _internal_screen_size();
+}
+inline void FrameHashes::unsafe_arena_set_allocated_screen_size(
+    ::aspia::proto::desktop::Size* screen_size) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.screen_size_);
+  }
+  _impl_.screen_size_ = screen_size;
+  if (screen_size) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.desktop.FrameHashes.screen_size)
+}
+inline ::aspia::proto::desktop::Size* FrameHashes::release_screen_size() {
+  
+  ::aspia::proto::desktop::Size* temp = _impl_.screen_size_;
+  _impl_.screen_size_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::desktop::Size* FrameHashes::unsafe_arena_release_screen_size() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.FrameHashes.screen_size)
+  
+  ::aspia::proto::desktop::Size* temp = _impl_.screen_size_;
+  _impl_.screen_size_ = nullptr;
+  return temp;
+}
+inline ::aspia::proto::desktop::Size* FrameHashes::_internal_mutable_screen_size() {
+  
+  if (_impl_.screen_size_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::desktop::Size>(GetArenaForAllocation());
+    _impl_.screen_size_ = p;
+  }
+  return _impl_.screen_size_;
+}
+inline ::aspia::proto::desktop::Size* FrameHashes::mutable_screen_size() {
+  ::aspia::proto::desktop::Size* _msg = _internal_mutable_screen_size();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.FrameHashes.screen_size)
+  return _msg;
+}
+inline void FrameHashes::set_allocated_screen_size(::aspia::proto::desktop::Size* screen_size) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.screen_size_;
+  }
+  if (screen_size) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(screen_size);
+    if (message_arena != submessage_arena) {
+      screen_size = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, screen_size, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.screen_size_ = screen_size;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.FrameHashes.screen_size)
+}
+
+// uint32 tile_size = 2;
+inline void FrameHashes::clear_tile_size() {
+  _impl_.tile_size_ = 0u;
+}
+inline uint32_t FrameHashes::_internal_tile_size() const {
+  return _impl_.tile_size_;
+}
+inline uint32_t FrameHashes::tile_size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.FrameHashes.tile_size)
+  return _internal_tile_size();
+}
+inline void FrameHashes::_internal_set_tile_size(uint32_t value) {
+  
+  _impl_.tile_size_ = value;
+}
+inline void FrameHashes::set_tile_size(uint32_t value) {
+  _internal_set_tile_size(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.FrameHashes.tile_size)
+}
+
+// repeated fixed64 hash = 3;
+inline int FrameHashes::_internal_hash_size() const {
+  return _impl_.hash_.size();
+}
+inline int FrameHashes::hash_size() const {
+  return _internal_hash_size();
+}
+inline void FrameHashes::clear_hash() {
+  _impl_.hash_.Clear();
+}
+inline uint64_t FrameHashes::_internal_hash(int index) const {
+  return _impl_.hash_.Get(index);
+}
+inline uint64_t FrameHashes::hash(int index) const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.FrameHashes.hash)
+  return _internal_hash(index);
+}
+inline void FrameHashes::set_hash(int index, uint64_t value) {
+  _impl_.hash_.Set(index, value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.FrameHashes.hash)
+}
+inline void FrameHashes::_internal_add_hash(uint64_t value) {
+  _impl_.hash_.Add(value);
+}
+inline void FrameHashes::add_hash(uint64_t value) {
+  _internal_add_hash(value);
+  // @@protoc_insertion_point(field_add:aspia.proto.desktop.FrameHashes.hash)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+FrameHashes::_internal_hash() const {
+  return _impl_.hash_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+FrameHashes::hash() const {
+  // @@protoc_insertion_point(field_list:aspia.proto.desktop.FrameHashes.hash)
+  return _internal_hash();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+FrameHashes::_internal_mutable_hash() {
+  return &_impl_.hash_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+FrameHashes::mutable_hash() {
+  // @@protoc_insertion_point(field_mutable_list:aspia.proto.desktop.FrameHashes.hash)
+  return _internal_mutable_hash();
+}
+
+// -------------------------------------------------------------------
+
+// Config
+
+// uint32 features = 1;
+inline void Config::clear_features() {
+  _impl_.features_ = 0u;
+}
+inline uint32_t Config::_internal_features() const {
+  return _impl_.features_;
+}
+inline uint32_t Config::features() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Config.features)
+  return _internal_features();
+}
+inline void Config::_internal_set_features(uint32_t value) {
+  
+  _impl_.features_ = value;
+}
+inline void Config::set_features(uint32_t value) {
+  _internal_set_features(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Config.features)
+}
+
+// .aspia.proto.desktop.VideoEncoding video_encoding = 2;
+inline void Config::clear_video_encoding() {
+  _impl_.video_encoding_ = 0;
+}
+inline ::aspia::proto::desktop::VideoEncoding Config::_internal_video_encoding() const {
+  return static_cast< ::aspia::proto::desktop::VideoEncoding >(_impl_.video_encoding_);
+}
+inline ::aspia::proto::desktop::VideoEncoding Config::video_encoding() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Config.video_encoding)
+  return _internal_video_encoding();
+}
+inline void Config::_internal_set_video_encoding(::aspia::proto::desktop::VideoEncoding value) {
+  
+  _impl_.video_encoding_ = value;
+}
+inline void Config::set_video_encoding(::aspia::proto::desktop::VideoEncoding value) {
+  _internal_set_video_encoding(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Config.video_encoding)
+}
+
+// .aspia.proto.desktop.PixelFormat pixel_format = 3;
+inline bool Config::_internal_has_pixel_format() const {
+  return this != internal_default_instance() && _impl_.pixel_format_ != nullptr;
+}
+inline bool Config::has_pixel_format() const {
+  return _internal_has_pixel_format();
+}
+inline void Config::clear_pixel_format() {
+  if (GetArenaForAllocation() == nullptr && _impl_.pixel_format_ != nullptr) {
+    delete _impl_.pixel_format_;
+  }
+  _impl_.pixel_format_ = nullptr;
+}
+inline const ::aspia::proto::desktop::PixelFormat& Config::_internal_pixel_format() const {
+  const ::aspia::proto::desktop::PixelFormat* p = _impl_.pixel_format_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::desktop::PixelFormat&>(
+      ::aspia::proto::desktop::_PixelFormat_default_instance_);
+}
+inline const ::aspia::proto::desktop::PixelFormat& Config::pixel_format() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Config.pixel_format)
+  return _internal_pixel_format();
+}
+inline void Config::unsafe_arena_set_allocated_pixel_format(
+    ::aspia::proto::desktop::PixelFormat* pixel_format) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pixel_format_);
+  }
+  _impl_.pixel_format_ = pixel_format;
+  if (pixel_format) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.desktop.Config.pixel_format)
+}
+inline ::aspia::proto::desktop::PixelFormat* Config::release_pixel_format() {
+  
+  ::aspia::proto::desktop::PixelFormat* temp = _impl_.pixel_format_;
+  _impl_.pixel_format_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::desktop::PixelFormat* Config::unsafe_arena_release_pixel_format() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.Config.pixel_format)
+  
+  ::aspia::proto::desktop::PixelFormat* temp = _impl_.pixel_format_;
+  _impl_.pixel_format_ = nullptr;
+  return temp;
+}
+inline ::aspia::proto::desktop::PixelFormat* Config::_internal_mutable_pixel_format() {
+  
+  if (_impl_.pixel_format_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::desktop::PixelFormat>(GetArenaForAllocation());
+    _impl_.pixel_format_ = p;
+  }
+  return _impl_.pixel_format_;
+}
+inline ::aspia::proto::desktop::PixelFormat* Config::mutable_pixel_format() {
+  ::aspia::proto::desktop::PixelFormat* _msg = _internal_mutable_pixel_format();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.Config.pixel_format)
+  return _msg;
+}
+inline void Config::set_allocated_pixel_format(::aspia::proto::desktop::PixelFormat* pixel_format) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.pixel_format_;
+  }
+  if (pixel_format) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(pixel_format);
+    if (message_arena != submessage_arena) {
+      pixel_format = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, pixel_format, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.pixel_format_ = pixel_format;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.Config.pixel_format)
+}
+
+// uint32 update_interval = 4;
+inline void Config::clear_update_interval() {
+  _impl_.update_interval_ = 0u;
+}
+inline uint32_t Config::_internal_update_interval() const {
+  return _impl_.update_interval_;
+}
+inline uint32_t Config::update_interval() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Config.update_interval)
+  return _internal_update_interval();
+}
+inline void Config::_internal_set_update_interval(uint32_t value) {
+  
+  _impl_.update_interval_ = value;
+}
+inline void Config::set_update_interval(uint32_t value) {
+  _internal_set_update_interval(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Config.update_interval)
+}
+
+// uint32 compress_ratio = 5;
+inline void Config::clear_compress_ratio() {
+  _impl_.compress_ratio_ = 0u;
+}
+inline uint32_t Config::_internal_compress_ratio() const {
+  return _impl_.compress_ratio_;
+}
+inline uint32_t Config::compress_ratio() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Config.compress_ratio)
+  return _internal_compress_ratio();
+}
+inline void Config::_internal_set_compress_ratio(uint32_t value) {
+  
+  _impl_.compress_ratio_ = value;
+}
+inline void Config::set_compress_ratio(uint32_t value) {
+  _internal_set_compress_ratio(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Config.compress_ratio)
+}
+
+// uint32 encoder_threads = 6;
+inline void Config::clear_encoder_threads() {
+  _impl_.encoder_threads_ = 0u;
+}
+inline uint32_t Config::_internal_encoder_threads() const {
+  return _impl_.encoder_threads_;
+}
+inline uint32_t Config::encoder_threads() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Config.encoder_threads)
+  return _internal_encoder_threads();
+}
+inline void Config::_internal_set_encoder_threads(uint32_t value) {
+  
+  _impl_.encoder_threads_ = value;
+}
+inline void Config::set_encoder_threads(uint32_t value) {
+  _internal_set_encoder_threads(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Config.encoder_threads)
+}
+
+// uint32 encoder_tile_columns = 7;
+inline void Config::clear_encoder_tile_columns() {
+  _impl_.encoder_tile_columns_ = 0u;
+}
+inline uint32_t Config::_internal_encoder_tile_columns() const {
+  return _impl_.encoder_tile_columns_;
+}
+inline uint32_t Config::encoder_tile_columns() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Config.encoder_tile_columns)
+  return _internal_encoder_tile_columns();
+}
+inline void Config::_internal_set_encoder_tile_columns(uint32_t value) {
+  
+  _impl_.encoder_tile_columns_ = value;
+}
+inline void Config::set_encoder_tile_columns(uint32_t value) {
+  _internal_set_encoder_tile_columns(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Config.encoder_tile_columns)
+}
+
+// repeated fixed64 cursor_cache = 8;
+inline int Config::_internal_cursor_cache_size() const {
+  return _impl_.cursor_cache_.size();
+}
+inline int Config::cursor_cache_size() const {
+  return _internal_cursor_cache_size();
+}
+inline void Config::clear_cursor_cache() {
+  _impl_.cursor_cache_.Clear();
+}
+inline uint64_t Config::_internal_cursor_cache(int index) const {
+  return _impl_.cursor_cache_.Get(index);
+}
+inline uint64_t Config::cursor_cache(int index) const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Config.cursor_cache)
+  return _internal_cursor_cache(index);
+}
+inline void Config::set_cursor_cache(int index, uint64_t value) {
+  _impl_.cursor_cache_.Set(index, value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Config.cursor_cache)
+}
+inline void Config::_internal_add_cursor_cache(uint64_t value) {
+  _impl_.cursor_cache_.Add(value);
+}
+inline void Config::add_cursor_cache(uint64_t value) {
+  _internal_add_cursor_cache(value);
+  // @@protoc_insertion_point(field_add:aspia.proto.desktop.Config.cursor_cache)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+Config::_internal_cursor_cache() const {
+  return _impl_.cursor_cache_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+Config::cursor_cache() const {
+  // @@protoc_insertion_point(field_list:aspia.proto.desktop.Config.cursor_cache)
+  return _internal_cursor_cache();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+Config::_internal_mutable_cursor_cache() {
+  return &_impl_.cursor_cache_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+Config::mutable_cursor_cache() {
+  // @@protoc_insertion_point(field_mutable_list:aspia.proto.desktop.Config.cursor_cache)
+  return _internal_mutable_cursor_cache();
+}
+
+// uint32 cursor_cache_next = 9;
+inline void Config::clear_cursor_cache_next() {
+  _impl_.cursor_cache_next_ = 0u;
+}
+inline uint32_t Config::_internal_cursor_cache_next() const {
+  return _impl_.cursor_cache_next_;
+}
+inline uint32_t Config::cursor_cache_next() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Config.cursor_cache_next)
+  return _internal_cursor_cache_next();
+}
+inline void Config::_internal_set_cursor_cache_next(uint32_t value) {
+  
+  _impl_.cursor_cache_next_ = value;
+}
+inline void Config::set_cursor_cache_next(uint32_t value) {
+  _internal_set_cursor_cache_next(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Config.cursor_cache_next)
+}
+
+// uint32 tile_cache_size = 10;
+inline void Config::clear_tile_cache_size() {
+  _impl_.tile_cache_size_ = 0u;
+}
+inline uint32_t Config::_internal_tile_cache_size() const {
+  return _impl_.tile_cache_size_;
+}
+inline uint32_t Config::tile_cache_size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Config.tile_cache_size)
+  return _internal_tile_cache_size();
+}
+inline void Config::_internal_set_tile_cache_size(uint32_t value) {
+  
+  _impl_.tile_cache_size_ = value;
+}
+inline void Config::set_tile_cache_size(uint32_t value) {
+  _internal_set_tile_cache_size(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Config.tile_cache_size)
+}
+
+// .aspia.proto.desktop.Size viewport = 11;
+inline bool Config::_internal_has_viewport() const {
+  return this != internal_default_instance() && _impl_.viewport_ != nullptr;
+}
+inline bool Config::has_viewport() const {
+  return _internal_has_viewport();
+}
+inline void Config::clear_viewport() {
+  if (GetArenaForAllocation() == nullptr && _impl_.viewport_ != nullptr) {
+    delete _impl_.viewport_;
+  }
+  _impl_.viewport_ = nullptr;
+}
+inline const ::aspia::proto::desktop::Size& Config::_internal_viewport() const {
+  const ::aspia::proto::desktop::Size* p = _impl_.viewport_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::desktop::Size&>(
+      ::aspia::proto::desktop::_Size_default_instance_);
+}
+inline const ::aspia::proto::desktop::Size& Config::viewport() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Config.viewport)
+  return _internal_viewport();
+}
+inline void Config::unsafe_arena_set_allocated_viewport(
+    ::aspia::proto::desktop::Size* viewport) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.viewport_);
+  }
+  _impl_.viewport_ = viewport;
+  if (viewport) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.desktop.Config.viewport)
+}
+inline ::aspia::proto::desktop::Size* Config::release_viewport() {
+  
+  ::aspia::proto::desktop::Size* temp = _impl_.viewport_;
+  _impl_.viewport_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::desktop::Size* Config::unsafe_arena_release_viewport() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.Config.viewport)
+  
+  ::aspia::proto::desktop::Size* temp = _impl_.viewport_;
+  _impl_.viewport_ = nullptr;
+  return temp;
+}
+inline ::aspia::proto::desktop::Size* Config::_internal_mutable_viewport() {
+  
+  if (_impl_.viewport_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::desktop::Size>(GetArenaForAllocation());
+    _impl_.viewport_ = p;
+  }
+  return _impl_.viewport_;
+}
+inline ::aspia::proto::desktop::Size* Config::mutable_viewport() {
+  ::aspia::proto::desktop::Size* _msg = _internal_mutable_viewport();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.Config.viewport)
+  return _msg;
+}
+inline void Config::set_allocated_viewport(::aspia::proto::desktop::Size* viewport) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.viewport_;
+  }
+  if (viewport) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(viewport);
+    if (message_arena != submessage_arena) {
+      viewport = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, viewport, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.viewport_ = viewport;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.Config.viewport)
+}
+
+// uint32 bandwidth_limit = 12;
+inline void Config::clear_bandwidth_limit() {
+  _impl_.bandwidth_limit_ = 0u;
+}
+inline uint32_t Config::_internal_bandwidth_limit() const {
+  return _impl_.bandwidth_limit_;
+}
+inline uint32_t Config::bandwidth_limit() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Config.bandwidth_limit)
+  return _internal_bandwidth_limit();
+}
+inline void Config::_internal_set_bandwidth_limit(uint32_t value) {
+  
+  _impl_.bandwidth_limit_ = value;
+}
+inline void Config::set_bandwidth_limit(uint32_t value) {
+  _internal_set_bandwidth_limit(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Config.bandwidth_limit)
+}
+
+// bool auto_encoding = 13;
+inline void Config::clear_auto_encoding() {
+  _impl_.auto_encoding_ = false;
+}
+inline bool Config::_internal_auto_encoding() const {
+  return _impl_.auto_encoding_;
+}
+inline bool Config::auto_encoding() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Config.auto_encoding)
+  return _internal_auto_encoding();
+}
+inline void Config::_internal_set_auto_encoding(bool value) {
+  
+  _impl_.auto_encoding_ = value;
+}
+inline void Config::set_auto_encoding(bool value) {
+  _internal_set_auto_encoding(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Config.auto_encoding)
+}
+
+// .aspia.proto.desktop.FrameHashes frame_hashes = 14;
+inline bool Config::_internal_has_frame_hashes() const {
+  return this != internal_default_instance() && _impl_.frame_hashes_ != nullptr;
+}
+inline bool Config::has_frame_hashes() const {
+  return _internal_has_frame_hashes();
+}
+inline void Config::clear_frame_hashes() {
+  if (GetArenaForAllocation() == nullptr && _impl_.frame_hashes_ != nullptr) {
+    delete _impl_.frame_hashes_;
+  }
+  _impl_.frame_hashes_ = nullptr;
+}
+inline const ::aspia::proto::desktop::FrameHashes& Config::_internal_frame_hashes() const {
+  const ::aspia::proto::desktop::FrameHashes* p = _impl_.frame_hashes_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::desktop::FrameHashes&>(
+      ::aspia::proto::desktop::_FrameHashes_default_instance_);
+}
+inline const ::aspia::proto::desktop::FrameHashes& Config::frame_hashes() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Config.frame_hashes)
+  return _internal_frame_hashes();
+}
+inline void Config::unsafe_arena_set_allocated_frame_hashes(
+    ::aspia::proto::desktop::FrameHashes* frame_hashes) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.frame_hashes_);
+  }
+  _impl_.frame_hashes_ = frame_hashes;
+  if (frame_hashes) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.desktop.Config.frame_hashes)
+}
+inline ::aspia::proto::desktop::FrameHashes* Config::release_frame_hashes() {
+  
+  ::aspia::proto::desktop::FrameHashes* temp = _impl_.frame_hashes_;
+  _impl_.frame_hashes_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::desktop::FrameHashes* Config::unsafe_arena_release_frame_hashes() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.Config.frame_hashes)
+  
+  ::aspia::proto::desktop::FrameHashes* temp = _impl_.frame_hashes_;
+  _impl_.frame_hashes_ = nullptr;
+  return temp;
+}
+inline ::aspia::proto::desktop::FrameHashes* Config::_internal_mutable_frame_hashes() {
+  
+  if (_impl_.frame_hashes_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::desktop::FrameHashes>(GetArenaForAllocation());
+    _impl_.frame_hashes_ = p;
+  }
+  return _impl_.frame_hashes_;
+}
+inline ::aspia::proto::desktop::FrameHashes* Config::mutable_frame_hashes() {
+  ::aspia::proto::desktop::FrameHashes* _msg = _internal_mutable_frame_hashes();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.Config.frame_hashes)
+  return _msg;
+}
+inline void Config::set_allocated_frame_hashes(::aspia::proto::desktop::FrameHashes* frame_hashes) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.frame_hashes_;
+  }
+  if (frame_hashes) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(frame_hashes);
+    if (message_arena != submessage_arena) {
+      frame_hashes = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, frame_hashes, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.frame_hashes_ = frame_hashes;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.Config.frame_hashes)
+}
+
+// uint32 initial_bandwidth = 15;
+inline void Config::clear_initial_bandwidth() {
+  _impl_.initial_bandwidth_ = 0u;
+}
+inline uint32_t Config::_internal_initial_bandwidth() const {
+  return _impl_.initial_bandwidth_;
+}
+inline uint32_t Config::initial_bandwidth() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Config.initial_bandwidth)
+  return _internal_initial_bandwidth();
+}
+inline void Config::_internal_set_initial_bandwidth(uint32_t value) {
+  
+  _impl_.initial_bandwidth_ = value;
+}
+inline void Config::set_initial_bandwidth(uint32_t value) {
+  _internal_set_initial_bandwidth(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Config.initial_bandwidth)
+}
 
-// ===================================================================
+// -------------------------------------------------------------------
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// KeyEvent
+// Screen
 
-// uint32 usb_keycode = 1;
-inline void KeyEvent::clear_usb_keycode() {
-  usb_keycode_ = 0u;
+// int64 id = 1;
+inline void Screen::clear_id() {
+  _impl_.id_ = int64_t{0};
 }
-inline ::google::protobuf::uint32 KeyEvent::usb_keycode() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.KeyEvent.usb_keycode)
-  return usb_keycode_;
+inline int64_t Screen::_internal_id() const {
+  return _impl_.id_;
 }
-inline void KeyEvent::set_usb_keycode(::google::protobuf::uint32 value) {
+inline int64_t Screen::id() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Screen.id)
+  return _internal_id();
+}
+inline void Screen::_internal_set_id(int64_t value) {
   
-  usb_keycode_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.desktop.KeyEvent.usb_keycode)
+  _impl_.id_ = value;
+}
+inline void Screen::set_id(int64_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Screen.id)
 }
 
-// uint32 flags = 2;
-inline void KeyEvent::clear_flags() {
-  flags_ = 0u;
+// string title = 2;
+inline void Screen::clear_title() {
+  _impl_.title_.ClearToEmpty();
 }
-inline ::google::protobuf::uint32 KeyEvent::flags() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.KeyEvent.flags)
-  return flags_;
+inline const std::string& Screen::title() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Screen.title)
+  return _internal_title();
 }
-inline void KeyEvent::set_flags(::google::protobuf::uint32 value) {
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Screen::set_title(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.title_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Screen.title)
+}
+inline std::string* Screen::mutable_title() {
+  std::string* _s = _internal_mutable_title();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.Screen.title)
+  return _s;
+}
+inline const std::string& Screen::_internal_title() const {
+  return _impl_.title_.Get();
+}
+inline void Screen::_internal_set_title(const std::string& value) {
   
-  flags_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.desktop.KeyEvent.flags)
+  _impl_.title_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Screen::_internal_mutable_title() {
+  
+  return _impl_.title_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Screen::release_title() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.Screen.title)
+  return _impl_.title_.Release();
+}
+inline void Screen::set_allocated_title(std::string* title) {
+  if (title != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.title_.SetAllocated(title, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.title_.IsDefault()) {
+    _impl_.title_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.Screen.title)
+}
+
+// bool window = 3;
+inline void Screen::clear_window() {
+  _impl_.window_ = false;
+}
+inline bool Screen::_internal_window() const {
+  return _impl_.window_;
+}
+inline bool Screen::window() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Screen.window)
+  return _internal_window();
+}
+inline void Screen::_internal_set_window(bool value) {
+  
+  _impl_.window_ = value;
+}
+inline void Screen::set_window(bool value) {
+  _internal_set_window(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Screen.window)
 }
 
 // -------------------------------------------------------------------
 
-// PointerEvent
+// ScreenList
 
-// uint32 mask = 1;
-inline void PointerEvent::clear_mask() {
-  mask_ = 0u;
+// repeated .aspia.proto.desktop.Screen screen = 1;
+inline int ScreenList::_internal_screen_size() const {
+  return _impl_.screen_.size();
 }
-inline ::google::protobuf::uint32 PointerEvent::mask() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.PointerEvent.mask)
-  return mask_;
+inline int ScreenList::screen_size() const {
+  return _internal_screen_size();
+}
+inline void ScreenList::clear_screen() {
+  _impl_.screen_.Clear();
+}
+inline ::aspia::proto::desktop::Screen* ScreenList::mutable_screen(int index) {
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.ScreenList.screen)
+  return _impl_.screen_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::desktop::Screen >*
+ScreenList::mutable_screen() {
+  // @@protoc_insertion_point(field_mutable_list:aspia.proto.desktop.ScreenList.screen)
+  return &_impl_.screen_;
+}
+inline const ::aspia::proto::desktop::Screen& ScreenList::_internal_screen(int index) const {
+  return _impl_.screen_.Get(index);
+}
+inline const ::aspia::proto::desktop::Screen& ScreenList::screen(int index) const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.ScreenList.screen)
+  return _internal_screen(index);
+}
+inline ::aspia::proto::desktop::Screen* ScreenList::_internal_add_screen() {
+  return _impl_.screen_.Add();
+}
+inline ::aspia::proto::desktop::Screen* ScreenList::add_screen() {
+  ::aspia::proto::desktop::Screen* _add = _internal_add_screen();
+  // @@protoc_insertion_point(field_add:aspia.proto.desktop.ScreenList.screen)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::desktop::Screen >&
+ScreenList::screen() const {
+  // @@protoc_insertion_point(field_list:aspia.proto.desktop.ScreenList.screen)
+  return _impl_.screen_;
 }
-inline void PointerEvent::set_mask(::google::protobuf::uint32 value) {
+
+// int64 current_screen = 2;
+inline void ScreenList::clear_current_screen() {
+  _impl_.current_screen_ = int64_t{0};
+}
+inline int64_t ScreenList::_internal_current_screen() const {
+  return _impl_.current_screen_;
+}
+inline int64_t ScreenList::current_screen() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.ScreenList.current_screen)
+  return _internal_current_screen();
+}
+inline void ScreenList::_internal_set_current_screen(int64_t value) {
   
-  mask_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.desktop.PointerEvent.mask)
+  _impl_.current_screen_ = value;
+}
+inline void ScreenList::set_current_screen(int64_t value) {
+  _internal_set_current_screen(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.ScreenList.current_screen)
 }
 
-// int32 x = 2;
-inline void PointerEvent::clear_x() {
-  x_ = 0;
+// -------------------------------------------------------------------
+
+// HostToClient
+
+// .aspia.proto.desktop.VideoPacket video_packet = 1;
+inline bool HostToClient::_internal_has_video_packet() const {
+  return this != internal_default_instance() && _impl_.video_packet_ != nullptr;
 }
-inline ::google::protobuf::int32 PointerEvent::x() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.PointerEvent.x)
-  return x_;
+inline bool HostToClient::has_video_packet() const {
+  return _internal_has_video_packet();
+}
+inline void HostToClient::clear_video_packet() {
+  if (GetArenaForAllocation() == nullptr && _impl_.video_packet_ != nullptr) {
+    delete _impl_.video_packet_;
+  }
+  _impl_.video_packet_ = nullptr;
+}
+inline const ::aspia::proto::desktop::VideoPacket& HostToClient::_internal_video_packet() const {
+  const ::aspia::proto::desktop::VideoPacket* p = _impl_.video_packet_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::desktop::VideoPacket&>(
+      ::aspia::proto::desktop::_VideoPacket_default_instance_);
+}
+inline const ::aspia::proto::desktop::VideoPacket& HostToClient::video_packet() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.HostToClient.video_packet)
+  return _internal_video_packet();
+}
+inline void HostToClient::unsafe_arena_set_allocated_video_packet(
+    ::aspia::proto::desktop::VideoPacket* video_packet) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.video_packet_);
+  }
+  _impl_.video_packet_ = video_packet;
+  if (video_packet) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.desktop.HostToClient.video_packet)
 }
-inline void PointerEvent::set_x(::google::protobuf::int32 value) {
+inline ::aspia::proto::desktop::VideoPacket* HostToClient::release_video_packet() {
   
-  x_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.desktop.PointerEvent.x)
+  ::aspia::proto::desktop::VideoPacket* temp = _impl_.video_packet_;
+  _impl_.video_packet_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::desktop::VideoPacket* HostToClient::unsafe_arena_release_video_packet() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.HostToClient.video_packet)
+  
+  ::aspia::proto::desktop::VideoPacket* temp = _impl_.video_packet_;
+  _impl_.video_packet_ = nullptr;
+  return temp;
+}
+inline ::aspia::proto::desktop::VideoPacket* HostToClient::_internal_mutable_video_packet() {
+  
+  if (_impl_.video_packet_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::desktop::VideoPacket>(GetArenaForAllocation());
+    _impl_.video_packet_ = p;
+  }
+  return _impl_.video_packet_;
+}
+inline ::aspia::proto::desktop::VideoPacket* HostToClient::mutable_video_packet() {
+  ::aspia::proto::desktop::VideoPacket* _msg = _internal_mutable_video_packet();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.HostToClient.video_packet)
+  return _msg;
+}
+inline void HostToClient::set_allocated_video_packet(::aspia::proto::desktop::VideoPacket* video_packet) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.video_packet_;
+  }
+  if (video_packet) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(video_packet);
+    if (message_arena != submessage_arena) {
+      video_packet = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, video_packet, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.video_packet_ = video_packet;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.HostToClient.video_packet)
+}
+
+// .aspia.proto.desktop.CursorShape cursor_shape = 2;
+inline bool HostToClient::_internal_has_cursor_shape() const {
+  return this != internal_default_instance() && _impl_.cursor_shape_ != nullptr;
+}
+inline bool HostToClient::has_cursor_shape() const {
+  return _internal_has_cursor_shape();
+}
+inline void HostToClient::clear_cursor_shape() {
+  if (GetArenaForAllocation() == nullptr && _impl_.cursor_shape_ != nullptr) {
+    delete _impl_.cursor_shape_;
+  }
+  _impl_.cursor_shape_ = nullptr;
+}
+inline const ::aspia::proto::desktop::CursorShape& HostToClient::_internal_cursor_shape() const {
+  const ::aspia::proto::desktop::CursorShape* p = _impl_.cursor_shape_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::desktop::CursorShape&>(
+      ::aspia::proto::desktop::_CursorShape_default_instance_);
+}
+inline const ::aspia::proto::desktop::CursorShape& HostToClient::cursor_shape() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.HostToClient.cursor_shape)
+  return _internal_cursor_shape();
+}
+inline void HostToClient::unsafe_arena_set_allocated_cursor_shape(
+    ::aspia::proto::desktop::CursorShape* cursor_shape) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.cursor_shape_);
+  }
+  _impl_.cursor_shape_ = cursor_shape;
+  if (cursor_shape) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.desktop.HostToClient.cursor_shape)
+}
+inline ::aspia::proto::desktop::CursorShape* HostToClient::release_cursor_shape() {
+  
+  ::aspia::proto::desktop::CursorShape* temp = _impl_.cursor_shape_;
+  _impl_.cursor_shape_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::desktop::CursorShape* HostToClient::unsafe_arena_release_cursor_shape() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.HostToClient.cursor_shape)
+  
+  ::aspia::proto::desktop::CursorShape* temp = _impl_.cursor_shape_;
+  _impl_.cursor_shape_ = nullptr;
+  return temp;
+}
+inline ::aspia::proto::desktop::CursorShape* HostToClient::_internal_mutable_cursor_shape() {
+  
+  if (_impl_.cursor_shape_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::desktop::CursorShape>(GetArenaForAllocation());
+    _impl_.cursor_shape_ = p;
+  }
+  return _impl_.cursor_shape_;
+}
+inline ::aspia::proto::desktop::CursorShape* HostToClient::mutable_cursor_shape() {
+  ::aspia::proto::desktop::CursorShape* _msg = _internal_mutable_cursor_shape();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.HostToClient.cursor_shape)
+  return _msg;
+}
+inline void HostToClient::set_allocated_cursor_shape(::aspia::proto::desktop::CursorShape* cursor_shape) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.cursor_shape_;
+  }
+  if (cursor_shape) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(cursor_shape);
+    if (message_arena != submessage_arena) {
+      cursor_shape = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, cursor_shape, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.cursor_shape_ = cursor_shape;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.HostToClient.cursor_shape)
+}
+
+// .aspia.proto.desktop.ClipboardEvent clipboard_event = 3;
+inline bool HostToClient::_internal_has_clipboard_event() const {
+  return this != internal_default_instance() && _impl_.clipboard_event_ != nullptr;
+}
+inline bool HostToClient::has_clipboard_event() const {
+  return _internal_has_clipboard_event();
+}
+inline void HostToClient::clear_clipboard_event() {
+  if (GetArenaForAllocation() == nullptr && _impl_.clipboard_event_ != nullptr) {
+    delete _impl_.clipboard_event_;
+  }
+  _impl_.clipboard_event_ = nullptr;
+}
+inline const ::aspia::proto::desktop::ClipboardEvent& HostToClient::_internal_clipboard_event() const {
+  const ::aspia::proto::desktop::ClipboardEvent* p = _impl_.clipboard_event_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::desktop::ClipboardEvent&>(
+      ::aspia::proto::desktop::_ClipboardEvent_default_instance_);
+}
+inline const ::aspia::proto::desktop::ClipboardEvent& HostToClient::clipboard_event() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.HostToClient.clipboard_event)
+  return _internal_clipboard_event();
+}
+inline void HostToClient::unsafe_arena_set_allocated_clipboard_event(
+    ::aspia::proto::desktop::ClipboardEvent* clipboard_event) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.clipboard_event_);
+  }
+  _impl_.clipboard_event_ = clipboard_event;
+  if (clipboard_event) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.desktop.HostToClient.clipboard_event)
+}
+inline ::aspia::proto::desktop::ClipboardEvent* HostToClient::release_clipboard_event() {
+  
+  ::aspia::proto::desktop::ClipboardEvent* temp = _impl_.clipboard_event_;
+  _impl_.clipboard_event_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::desktop::ClipboardEvent* HostToClient::unsafe_arena_release_clipboard_event() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.HostToClient.clipboard_event)
+  
+  ::aspia::proto::desktop::ClipboardEvent* temp = _impl_.clipboard_event_;
+  _impl_.clipboard_event_ = nullptr;
+  return temp;
+}
+inline ::aspia::proto::desktop::ClipboardEvent* HostToClient::_internal_mutable_clipboard_event() {
+  
+  if (_impl_.clipboard_event_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::desktop::ClipboardEvent>(GetArenaForAllocation());
+    _impl_.clipboard_event_ = p;
+  }
+  return _impl_.clipboard_event_;
+}
+inline ::aspia::proto::desktop::ClipboardEvent* HostToClient::mutable_clipboard_event() {
+  ::aspia::proto::desktop::ClipboardEvent* _msg = _internal_mutable_clipboard_event();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.HostToClient.clipboard_event)
+  return _msg;
+}
+inline void HostToClient::set_allocated_clipboard_event(::aspia::proto::desktop::ClipboardEvent* clipboard_event) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.clipboard_event_;
+  }
+  if (clipboard_event) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(clipboard_event);
+    if (message_arena != submessage_arena) {
+      clipboard_event = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, clipboard_event, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.clipboard_event_ = clipboard_event;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.HostToClient.clipboard_event)
+}
+
+// .aspia.proto.desktop.ConfigRequest config_request = 4;
+inline bool HostToClient::_internal_has_config_request() const {
+  return this != internal_default_instance() && _impl_.config_request_ != nullptr;
+}
+inline bool HostToClient::has_config_request() const {
+  return _internal_has_config_request();
+}
+inline void HostToClient::clear_config_request() {
+  if (GetArenaForAllocation() == nullptr && _impl_.config_request_ != nullptr) {
+    delete _impl_.config_request_;
+  }
+  _impl_.config_request_ = nullptr;
+}
+inline const ::aspia::proto::desktop::ConfigRequest& HostToClient::_internal_config_request() const {
+  const ::aspia::proto::desktop::ConfigRequest* p = _impl_.config_request_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::desktop::ConfigRequest&>(
+      ::aspia::proto::desktop::_ConfigRequest_default_instance_);
+}
+inline const ::aspia::proto::desktop::ConfigRequest& HostToClient::config_request() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.HostToClient.config_request)
+  return _internal_config_request();
+}
+inline void HostToClient::unsafe_arena_set_allocated_config_request(
+    ::aspia::proto::desktop::ConfigRequest* config_request) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.config_request_);
+  }
+  _impl_.config_request_ = config_request;
+  if (config_request) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.desktop.HostToClient.config_request)
+}
+inline ::aspia::proto::desktop::ConfigRequest* HostToClient::release_config_request() {
+  
+  ::aspia::proto::desktop::ConfigRequest* temp = _impl_.config_request_;
+  _impl_.config_request_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::desktop::ConfigRequest* HostToClient::unsafe_arena_release_config_request() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.HostToClient.config_request)
+  
+  ::aspia::proto::desktop::ConfigRequest* temp = _impl_.config_request_;
+  _impl_.config_request_ = nullptr;
+  return temp;
+}
+inline ::aspia::proto::desktop::ConfigRequest* HostToClient::_internal_mutable_config_request() {
+  
+  if (_impl_.config_request_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::desktop::ConfigRequest>(GetArenaForAllocation());
+    _impl_.config_request_ = p;
+  }
+  return _impl_.config_request_;
+}
+inline ::aspia::proto::desktop::ConfigRequest* HostToClient::mutable_config_request() {
+  ::aspia::proto::desktop::ConfigRequest* _msg = _internal_mutable_config_request();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.HostToClient.config_request)
+  return _msg;
+}
+inline void HostToClient::set_allocated_config_request(::aspia::proto::desktop::ConfigRequest* config_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.config_request_;
+  }
+  if (config_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(config_request);
+    if (message_arena != submessage_arena) {
+      config_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, config_request, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.config_request_ = config_request;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.HostToClient.config_request)
 }
 
-// int32 y = 3;
-inline void PointerEvent::clear_y() {
-  y_ = 0;
-}
-inline ::google::protobuf::int32 PointerEvent::y() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.PointerEvent.y)
-  return y_;
+// .aspia.proto.desktop.ScreenList screen_list = 5;
+inline bool HostToClient::_internal_has_screen_list() const {
+  return this != internal_default_instance() && _impl_.screen_list_ != nullptr;
 }
-inline void PointerEvent::set_y(::google::protobuf::int32 value) {
-  
-  y_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.desktop.PointerEvent.y)
+inline bool HostToClient::has_screen_list() const {
+  return _internal_has_screen_list();
 }
-
-// -------------------------------------------------------------------
-
-// ClipboardEvent
-
-// string mime_type = 1;
-inline void ClipboardEvent::clear_mime_type() {
-  mime_type_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void HostToClient::clear_screen_list() {
+  if (GetArenaForAllocation() == nullptr && _impl_.screen_list_ != nullptr) {
+    delete _impl_.screen_list_;
+  }
+  _impl_.screen_list_ = nullptr;
 }
-inline const ::std::string& ClipboardEvent::mime_type() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.ClipboardEvent.mime_type)
-  return mime_type_.GetNoArena();
+inline const ::aspia::proto::desktop::ScreenList& HostToClient::_internal_screen_list() const {
+  const ::aspia::proto::desktop::ScreenList* p = _impl_.screen_list_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::desktop::ScreenList&>(
+      ::aspia::proto::desktop::_ScreenList_default_instance_);
 }
-inline void ClipboardEvent::set_mime_type(const ::std::string& value) {
-  
-  mime_type_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:aspia.proto.desktop.ClipboardEvent.mime_type)
+inline const ::aspia::proto::desktop::ScreenList& HostToClient::screen_list() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.HostToClient.screen_list)
+  return _internal_screen_list();
 }
-#if LANG_CXX11
-inline void ClipboardEvent::set_mime_type(::std::string&& value) {
-  
-  mime_type_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.desktop.ClipboardEvent.mime_type)
+inline void HostToClient::unsafe_arena_set_allocated_screen_list(
+    ::aspia::proto::desktop::ScreenList* screen_list) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.screen_list_);
+  }
+  _impl_.screen_list_ = screen_list;
+  if (screen_list) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.desktop.HostToClient.screen_list)
 }
-#endif
-inline void ClipboardEvent::set_mime_type(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
+inline ::aspia::proto::desktop::ScreenList* HostToClient::release_screen_list() {
   
-  mime_type_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.desktop.ClipboardEvent.mime_type)
+  ::aspia::proto::desktop::ScreenList* temp = _impl_.screen_list_;
+  _impl_.screen_list_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void ClipboardEvent::set_mime_type(const char* value, size_t size) {
+inline ::aspia::proto::desktop::ScreenList* HostToClient::unsafe_arena_release_screen_list() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.HostToClient.screen_list)
   
-  mime_type_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.desktop.ClipboardEvent.mime_type)
+  ::aspia::proto::desktop::ScreenList* temp = _impl_.screen_list_;
+  _impl_.screen_list_ = nullptr;
+  return temp;
 }
-inline ::std::string* ClipboardEvent::mutable_mime_type() {
+inline ::aspia::proto::desktop::ScreenList* HostToClient::_internal_mutable_screen_list() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.ClipboardEvent.mime_type)
-  return mime_type_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (_impl_.screen_list_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::desktop::ScreenList>(GetArenaForAllocation());
+    _impl_.screen_list_ = p;
+  }
+  return _impl_.screen_list_;
 }
-inline ::std::string* ClipboardEvent::release_mime_type() {
-  // @@protoc_insertion_point(field_release:aspia.proto.desktop.ClipboardEvent.mime_type)
-  
-  return mime_type_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::aspia::proto::desktop::ScreenList* HostToClient::mutable_screen_list() {
+  ::aspia::proto::desktop::ScreenList* _msg = _internal_mutable_screen_list();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.HostToClient.screen_list)
+  return _msg;
 }
-inline void ClipboardEvent::set_allocated_mime_type(::std::string* mime_type) {
-  if (mime_type != NULL) {
+inline void HostToClient::set_allocated_screen_list(::aspia::proto::desktop::ScreenList* screen_list) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.screen_list_;
+  }
+  if (screen_list) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(screen_list);
+    if (message_arena != submessage_arena) {
+      screen_list = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, screen_list, submessage_arena);
+    }
     
   } else {
     
   }
-  mime_type_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), mime_type);
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.ClipboardEvent.mime_type)
+  _impl_.screen_list_ = screen_list;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.HostToClient.screen_list)
 }
 
-// bytes data = 2;
-inline void ClipboardEvent::clear_data() {
-  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// .aspia.proto.desktop.CursorPosition cursor_position = 6;
+inline bool HostToClient::_internal_has_cursor_position() const {
+  return this != internal_default_instance() && _impl_.cursor_position_ != nullptr;
 }
-inline const ::std::string& ClipboardEvent::data() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.ClipboardEvent.data)
-  return data_.GetNoArena();
+inline bool HostToClient::has_cursor_position() const {
+  return _internal_has_cursor_position();
 }
-inline void ClipboardEvent::set_data(const ::std::string& value) {
-  
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:aspia.proto.desktop.ClipboardEvent.data)
+inline void HostToClient::clear_cursor_position() {
+  if (GetArenaForAllocation() == nullptr && _impl_.cursor_position_ != nullptr) {
+    delete _impl_.cursor_position_;
+  }
+  _impl_.cursor_position_ = nullptr;
 }
-#if LANG_CXX11
-inline void ClipboardEvent::set_data(::std::string&& value) {
-  
-  data_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.desktop.ClipboardEvent.data)
+inline const ::aspia::proto::desktop::CursorPosition& HostToClient::_internal_cursor_position() const {
+  const ::aspia::proto::desktop::CursorPosition* p = _impl_.cursor_position_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::desktop::CursorPosition&>(
+      ::aspia::proto::desktop::_CursorPosition_default_instance_);
 }
-#endif
-inline void ClipboardEvent::set_data(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.desktop.ClipboardEvent.data)
+inline const ::aspia::proto::desktop::CursorPosition& HostToClient::cursor_position() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.HostToClient.cursor_position)
+  return _internal_cursor_position();
+}
+inline void HostToClient::unsafe_arena_set_allocated_cursor_position(
+    ::aspia::proto::desktop::CursorPosition* cursor_position) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.cursor_position_);
+  }
+  _impl_.cursor_position_ = cursor_position;
+  if (cursor_position) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.desktop.HostToClient.cursor_position)
 }
-inline void ClipboardEvent::set_data(const void* value, size_t size) {
+inline ::aspia::proto::desktop::CursorPosition* HostToClient::release_cursor_position() {
   
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.desktop.ClipboardEvent.data)
+  ::aspia::proto::desktop::CursorPosition* temp = _impl_.cursor_position_;
+  _impl_.cursor_position_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline ::std::string* ClipboardEvent::mutable_data() {
+inline ::aspia::proto::desktop::CursorPosition* HostToClient::unsafe_arena_release_cursor_position() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.HostToClient.cursor_position)
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.ClipboardEvent.data)
-  return data_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::aspia::proto::desktop::CursorPosition* temp = _impl_.cursor_position_;
+  _impl_.cursor_position_ = nullptr;
+  return temp;
 }
-inline ::std::string* ClipboardEvent::release_data() {
-  // @@protoc_insertion_point(field_release:aspia.proto.desktop.ClipboardEvent.data)
+inline ::aspia::proto::desktop::CursorPosition* HostToClient::_internal_mutable_cursor_position() {
   
-  return data_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (_impl_.cursor_position_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::desktop::CursorPosition>(GetArenaForAllocation());
+    _impl_.cursor_position_ = p;
+  }
+  return _impl_.cursor_position_;
+}
+inline ::aspia::proto::desktop::CursorPosition* HostToClient::mutable_cursor_position() {
+  ::aspia::proto::desktop::CursorPosition* _msg = _internal_mutable_cursor_position();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.HostToClient.cursor_position)
+  return _msg;
 }
-inline void ClipboardEvent::set_allocated_data(::std::string* data) {
-  if (data != NULL) {
+inline void HostToClient::set_allocated_cursor_position(::aspia::proto::desktop::CursorPosition* cursor_position) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.cursor_position_;
+  }
+  if (cursor_position) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(cursor_position);
+    if (message_arena != submessage_arena) {
+      cursor_position = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, cursor_position, submessage_arena);
+    }
     
   } else {
     
   }
-  data_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), data);
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.ClipboardEvent.data)
+  _impl_.cursor_position_ = cursor_position;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.HostToClient.cursor_position)
 }
 
-// -------------------------------------------------------------------
-
-// CursorShape
-
-// uint32 flags = 1;
-inline void CursorShape::clear_flags() {
-  flags_ = 0u;
-}
-inline ::google::protobuf::uint32 CursorShape::flags() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.CursorShape.flags)
-  return flags_;
+// .aspia.proto.desktop.Ping ping = 7;
+inline bool HostToClient::_internal_has_ping() const {
+  return this != internal_default_instance() && _impl_.ping_ != nullptr;
 }
-inline void CursorShape::set_flags(::google::protobuf::uint32 value) {
-  
-  flags_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.desktop.CursorShape.flags)
+inline bool HostToClient::has_ping() const {
+  return _internal_has_ping();
 }
-
-// int32 width = 2;
-inline void CursorShape::clear_width() {
-  width_ = 0;
+inline void HostToClient::clear_ping() {
+  if (GetArenaForAllocation() == nullptr && _impl_.ping_ != nullptr) {
+    delete _impl_.ping_;
+  }
+  _impl_.ping_ = nullptr;
 }
-inline ::google::protobuf::int32 CursorShape::width() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.CursorShape.width)
-  return width_;
+inline const ::aspia::proto::desktop::Ping& HostToClient::_internal_ping() const {
+  const ::aspia::proto::desktop::Ping* p = _impl_.ping_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::desktop::Ping&>(
+      ::aspia::proto::desktop::_Ping_default_instance_);
 }
-inline void CursorShape::set_width(::google::protobuf::int32 value) {
-  
-  width_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.desktop.CursorShape.width)
+inline const ::aspia::proto::desktop::Ping& HostToClient::ping() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.HostToClient.ping)
+  return _internal_ping();
 }
-
-// int32 height = 3;
-inline void CursorShape::clear_height() {
-  height_ = 0;
+inline void HostToClient::unsafe_arena_set_allocated_ping(
+    ::aspia::proto::desktop::Ping* ping) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.ping_);
+  }
+  _impl_.ping_ = ping;
+  if (ping) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.desktop.HostToClient.ping)
 }
-inline ::google::protobuf::int32 CursorShape::height() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.CursorShape.height)
-  return height_;
+inline ::aspia::proto::desktop::Ping* HostToClient::release_ping() {
+  
+  ::aspia::proto::desktop::Ping* temp = _impl_.ping_;
+  _impl_.ping_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void CursorShape::set_height(::google::protobuf::int32 value) {
+inline ::aspia::proto::desktop::Ping* HostToClient::unsafe_arena_release_ping() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.HostToClient.ping)
   
-  height_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.desktop.CursorShape.height)
+  ::aspia::proto::desktop::Ping* temp = _impl_.ping_;
+  _impl_.ping_ = nullptr;
+  return temp;
 }
-
-// int32 hotspot_x = 4;
-inline void CursorShape::clear_hotspot_x() {
-  hotspot_x_ = 0;
+inline ::aspia::proto::desktop::Ping* HostToClient::_internal_mutable_ping() {
+  
+  if (_impl_.ping_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::desktop::Ping>(GetArenaForAllocation());
+    _impl_.ping_ = p;
+  }
+  return _impl_.ping_;
 }
-inline ::google::protobuf::int32 CursorShape::hotspot_x() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.CursorShape.hotspot_x)
-  return hotspot_x_;
+inline ::aspia::proto::desktop::Ping* HostToClient::mutable_ping() {
+  ::aspia::proto::desktop::Ping* _msg = _internal_mutable_ping();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.HostToClient.ping)
+  return _msg;
 }
-inline void CursorShape::set_hotspot_x(::google::protobuf::int32 value) {
-  
-  hotspot_x_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.desktop.CursorShape.hotspot_x)
+inline void HostToClient::set_allocated_ping(::aspia::proto::desktop::Ping* ping) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.ping_;
+  }
+  if (ping) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(ping);
+    if (message_arena != submessage_arena) {
+      ping = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, ping, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.ping_ = ping;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.HostToClient.ping)
 }
 
-// int32 hotspot_y = 5;
-inline void CursorShape::clear_hotspot_y() {
-  hotspot_y_ = 0;
-}
-inline ::google::protobuf::int32 CursorShape::hotspot_y() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.CursorShape.hotspot_y)
-  return hotspot_y_;
+// .aspia.proto.desktop.LatencyProbe latency_probe = 8;
+inline bool HostToClient::_internal_has_latency_probe() const {
+  return this != internal_default_instance() && _impl_.latency_probe_ != nullptr;
 }
-inline void CursorShape::set_hotspot_y(::google::protobuf::int32 value) {
-  
-  hotspot_y_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.desktop.CursorShape.hotspot_y)
+inline bool HostToClient::has_latency_probe() const {
+  return _internal_has_latency_probe();
 }
-
-// bytes data = 6;
-inline void CursorShape::clear_data() {
-  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void HostToClient::clear_latency_probe() {
+  if (GetArenaForAllocation() == nullptr && _impl_.latency_probe_ != nullptr) {
+    delete _impl_.latency_probe_;
+  }
+  _impl_.latency_probe_ = nullptr;
 }
-inline const ::std::string& CursorShape::data() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.CursorShape.data)
-  return data_.GetNoArena();
+inline const ::aspia::proto::desktop::LatencyProbe& HostToClient::_internal_latency_probe() const {
+  const ::aspia::proto::desktop::LatencyProbe* p = _impl_.latency_probe_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::desktop::LatencyProbe&>(
+      ::aspia::proto::desktop::_LatencyProbe_default_instance_);
 }
-inline void CursorShape::set_data(const ::std::string& value) {
-  
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:aspia.proto.desktop.CursorShape.data)
+inline const ::aspia::proto::desktop::LatencyProbe& HostToClient::latency_probe() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.HostToClient.latency_probe)
+  return _internal_latency_probe();
 }
-#if LANG_CXX11
-inline void CursorShape::set_data(::std::string&& value) {
-  
-  data_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.desktop.CursorShape.data)
+inline void HostToClient::unsafe_arena_set_allocated_latency_probe(
+    ::aspia::proto::desktop::LatencyProbe* latency_probe) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.latency_probe_);
+  }
+  _impl_.latency_probe_ = latency_probe;
+  if (latency_probe) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.desktop.HostToClient.latency_probe)
 }
-#endif
-inline void CursorShape::set_data(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
+inline ::aspia::proto::desktop::LatencyProbe* HostToClient::release_latency_probe() {
   
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.desktop.CursorShape.data)
+  ::aspia::proto::desktop::LatencyProbe* temp = _impl_.latency_probe_;
+  _impl_.latency_probe_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void CursorShape::set_data(const void* value, size_t size) {
+inline ::aspia::proto::desktop::LatencyProbe* HostToClient::unsafe_arena_release_latency_probe() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.HostToClient.latency_probe)
   
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.desktop.CursorShape.data)
+  ::aspia::proto::desktop::LatencyProbe* temp = _impl_.latency_probe_;
+  _impl_.latency_probe_ = nullptr;
+  return temp;
 }
-inline ::std::string* CursorShape::mutable_data() {
+inline ::aspia::proto::desktop::LatencyProbe* HostToClient::_internal_mutable_latency_probe() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.CursorShape.data)
-  return data_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (_impl_.latency_probe_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::desktop::LatencyProbe>(GetArenaForAllocation());
+    _impl_.latency_probe_ = p;
+  }
+  return _impl_.latency_probe_;
 }
-inline ::std::string* CursorShape::release_data() {
-  // @@protoc_insertion_point(field_release:aspia.proto.desktop.CursorShape.data)
-  
-  return data_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::aspia::proto::desktop::LatencyProbe* HostToClient::mutable_latency_probe() {
+  ::aspia::proto::desktop::LatencyProbe* _msg = _internal_mutable_latency_probe();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.HostToClient.latency_probe)
+  return _msg;
 }
-inline void CursorShape::set_allocated_data(::std::string* data) {
-  if (data != NULL) {
+inline void HostToClient::set_allocated_latency_probe(::aspia::proto::desktop::LatencyProbe* latency_probe) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.latency_probe_;
+  }
+  if (latency_probe) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(latency_probe);
+    if (message_arena != submessage_arena) {
+      latency_probe = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, latency_probe, submessage_arena);
+    }
     
   } else {
     
   }
-  data_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), data);
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.CursorShape.data)
+  _impl_.latency_probe_ = latency_probe;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.HostToClient.latency_probe)
 }
 
 // -------------------------------------------------------------------
 
-// Rect
+// VideoAck
 
-// int32 x = 1;
-inline void Rect::clear_x() {
-  x_ = 0;
+// uint32 frame_id = 1;
+inline void VideoAck::clear_frame_id() {
+  _impl_.frame_id_ = 0u;
 }
-inline ::google::protobuf::int32 Rect::x() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Rect.x)
-  return x_;
+inline uint32_t VideoAck::_internal_frame_id() const {
+  return _impl_.frame_id_;
+}
+inline uint32_t VideoAck::frame_id() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.VideoAck.frame_id)
+  return _internal_frame_id();
 }
-inline void Rect::set_x(::google::protobuf::int32 value) {
+inline void VideoAck::_internal_set_frame_id(uint32_t value) {
   
-  x_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Rect.x)
+  _impl_.frame_id_ = value;
+}
+inline void VideoAck::set_frame_id(uint32_t value) {
+  _internal_set_frame_id(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.VideoAck.frame_id)
 }
 
-// int32 y = 2;
-inline void Rect::clear_y() {
-  y_ = 0;
+// uint32 decode_time = 2;
+inline void VideoAck::clear_decode_time() {
+  _impl_.decode_time_ = 0u;
 }
-inline ::google::protobuf::int32 Rect::y() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Rect.y)
-  return y_;
+inline uint32_t VideoAck::_internal_decode_time() const {
+  return _impl_.decode_time_;
+}
+inline uint32_t VideoAck::decode_time() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.VideoAck.decode_time)
+  return _internal_decode_time();
 }
-inline void Rect::set_y(::google::protobuf::int32 value) {
+inline void VideoAck::_internal_set_decode_time(uint32_t value) {
   
-  y_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Rect.y)
+  _impl_.decode_time_ = value;
+}
+inline void VideoAck::set_decode_time(uint32_t value) {
+  _internal_set_decode_time(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.VideoAck.decode_time)
 }
 
-// int32 width = 3;
-inline void Rect::clear_width() {
-  width_ = 0;
+// -------------------------------------------------------------------
+
+// LatencyProbe
+
+// int64 time = 1;
+inline void LatencyProbe::clear_time() {
+  _impl_.time_ = int64_t{0};
 }
-inline ::google::protobuf::int32 Rect::width() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Rect.width)
-  return width_;
+inline int64_t LatencyProbe::_internal_time() const {
+  return _impl_.time_;
 }
-inline void Rect::set_width(::google::protobuf::int32 value) {
+inline int64_t LatencyProbe::time() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.LatencyProbe.time)
+  return _internal_time();
+}
+inline void LatencyProbe::_internal_set_time(int64_t value) {
   
-  width_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Rect.width)
+  _impl_.time_ = value;
+}
+inline void LatencyProbe::set_time(int64_t value) {
+  _internal_set_time(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.LatencyProbe.time)
 }
 
-// int32 height = 4;
-inline void Rect::clear_height() {
-  height_ = 0;
+// uint32 host_delay = 2;
+inline void LatencyProbe::clear_host_delay() {
+  _impl_.host_delay_ = 0u;
 }
-inline ::google::protobuf::int32 Rect::height() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Rect.height)
-  return height_;
+inline uint32_t LatencyProbe::_internal_host_delay() const {
+  return _impl_.host_delay_;
 }
-inline void Rect::set_height(::google::protobuf::int32 value) {
+inline uint32_t LatencyProbe::host_delay() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.LatencyProbe.host_delay)
+  return _internal_host_delay();
+}
+inline void LatencyProbe::_internal_set_host_delay(uint32_t value) {
   
-  height_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Rect.height)
+  _impl_.host_delay_ = value;
+}
+inline void LatencyProbe::set_host_delay(uint32_t value) {
+  _internal_set_host_delay(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.LatencyProbe.host_delay)
 }
 
 // -------------------------------------------------------------------
 
-// PixelFormat
+// Ping
 
-// uint32 bits_per_pixel = 1;
-inline void PixelFormat::clear_bits_per_pixel() {
-  bits_per_pixel_ = 0u;
-}
-inline ::google::protobuf::uint32 PixelFormat::bits_per_pixel() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.PixelFormat.bits_per_pixel)
-  return bits_per_pixel_;
+// int64 time = 1;
+inline void Ping::clear_time() {
+  _impl_.time_ = int64_t{0};
 }
-inline void PixelFormat::set_bits_per_pixel(::google::protobuf::uint32 value) {
-  
-  bits_per_pixel_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.desktop.PixelFormat.bits_per_pixel)
-}
-
-// uint32 red_max = 2;
-inline void PixelFormat::clear_red_max() {
-  red_max_ = 0u;
+inline int64_t Ping::_internal_time() const {
+  return _impl_.time_;
 }
-inline ::google::protobuf::uint32 PixelFormat::red_max() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.PixelFormat.red_max)
-  return red_max_;
+inline int64_t Ping::time() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Ping.time)
+  return _internal_time();
 }
-inline void PixelFormat::set_red_max(::google::protobuf::uint32 value) {
+inline void Ping::_internal_set_time(int64_t value) {
   
-  red_max_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.desktop.PixelFormat.red_max)
+  _impl_.time_ = value;
+}
+inline void Ping::set_time(int64_t value) {
+  _internal_set_time(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Ping.time)
 }
 
-// uint32 green_max = 3;
-inline void PixelFormat::clear_green_max() {
-  green_max_ = 0u;
+// -------------------------------------------------------------------
+
+// Visibility
+
+// bool hidden = 1;
+inline void Visibility::clear_hidden() {
+  _impl_.hidden_ = false;
 }
-inline ::google::protobuf::uint32 PixelFormat::green_max() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.PixelFormat.green_max)
-  return green_max_;
+inline bool Visibility::_internal_hidden() const {
+  return _impl_.hidden_;
+}
+inline bool Visibility::hidden() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Visibility.hidden)
+  return _internal_hidden();
 }
-inline void PixelFormat::set_green_max(::google::protobuf::uint32 value) {
+inline void Visibility::_internal_set_hidden(bool value) {
   
-  green_max_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.desktop.PixelFormat.green_max)
+  _impl_.hidden_ = value;
 }
-
-// uint32 blue_max = 4;
-inline void PixelFormat::clear_blue_max() {
-  blue_max_ = 0u;
+inline void Visibility::set_hidden(bool value) {
+  _internal_set_hidden(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Visibility.hidden)
 }
-inline ::google::protobuf::uint32 PixelFormat::blue_max() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.PixelFormat.blue_max)
-  return blue_max_;
+
+// -------------------------------------------------------------------
+
+// VisibleArea
+
+// .aspia.proto.desktop.Rect rect = 1;
+inline bool VisibleArea::_internal_has_rect() const {
+  return this != internal_default_instance() && _impl_.rect_ != nullptr;
 }
-inline void PixelFormat::set_blue_max(::google::protobuf::uint32 value) {
-  
-  blue_max_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.desktop.PixelFormat.blue_max)
+inline bool VisibleArea::has_rect() const {
+  return _internal_has_rect();
 }
-
-// uint32 red_shift = 5;
-inline void PixelFormat::clear_red_shift() {
-  red_shift_ = 0u;
+inline void VisibleArea::clear_rect() {
+  if (GetArenaForAllocation() == nullptr && _impl_.rect_ != nullptr) {
+    delete _impl_.rect_;
+  }
+  _impl_.rect_ = nullptr;
 }
-inline ::google::protobuf::uint32 PixelFormat::red_shift() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.PixelFormat.red_shift)
-  return red_shift_;
+inline const ::aspia::proto::desktop::Rect& VisibleArea::_internal_rect() const {
+  const ::aspia::proto::desktop::Rect* p = _impl_.rect_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::desktop::Rect&>(
+      ::aspia::proto::desktop::_Rect_default_instance_);
 }
-inline void PixelFormat::set_red_shift(::google::protobuf::uint32 value) {
-  
-  red_shift_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.desktop.PixelFormat.red_shift)
+inline const ::aspia::proto::desktop::Rect& VisibleArea::rect() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.VisibleArea.rect)
+  return _internal_rect();
 }
-
-// uint32 green_shift = 6;
-inline void PixelFormat::clear_green_shift() {
-  green_shift_ = 0u;
+inline void VisibleArea::unsafe_arena_set_allocated_rect(
+    ::aspia::proto::desktop::Rect* rect) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.rect_);
+  }
+  _impl_.rect_ = rect;
+  if (rect) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.desktop.VisibleArea.rect)
 }
-inline ::google::protobuf::uint32 PixelFormat::green_shift() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.PixelFormat.green_shift)
-  return green_shift_;
+inline ::aspia::proto::desktop::Rect* VisibleArea::release_rect() {
+  
+  ::aspia::proto::desktop::Rect* temp = _impl_.rect_;
+  _impl_.rect_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void PixelFormat::set_green_shift(::google::protobuf::uint32 value) {
+inline ::aspia::proto::desktop::Rect* VisibleArea::unsafe_arena_release_rect() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.VisibleArea.rect)
   
-  green_shift_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.desktop.PixelFormat.green_shift)
+  ::aspia::proto::desktop::Rect* temp = _impl_.rect_;
+  _impl_.rect_ = nullptr;
+  return temp;
 }
-
-// uint32 blue_shift = 7;
-inline void PixelFormat::clear_blue_shift() {
-  blue_shift_ = 0u;
+inline ::aspia::proto::desktop::Rect* VisibleArea::_internal_mutable_rect() {
+  
+  if (_impl_.rect_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::desktop::Rect>(GetArenaForAllocation());
+    _impl_.rect_ = p;
+  }
+  return _impl_.rect_;
 }
-inline ::google::protobuf::uint32 PixelFormat::blue_shift() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.PixelFormat.blue_shift)
-  return blue_shift_;
+inline ::aspia::proto::desktop::Rect* VisibleArea::mutable_rect() {
+  ::aspia::proto::desktop::Rect* _msg = _internal_mutable_rect();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.VisibleArea.rect)
+  return _msg;
 }
-inline void PixelFormat::set_blue_shift(::google::protobuf::uint32 value) {
-  
-  blue_shift_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.desktop.PixelFormat.blue_shift)
+inline void VisibleArea::set_allocated_rect(::aspia::proto::desktop::Rect* rect) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.rect_;
+  }
+  if (rect) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(rect);
+    if (message_arena != submessage_arena) {
+      rect = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, rect, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.rect_ = rect;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.VisibleArea.rect)
 }
 
 // -------------------------------------------------------------------
 
-// Size
+// RefreshRequest
 
-// int32 width = 1;
-inline void Size::clear_width() {
-  width_ = 0;
-}
-inline ::google::protobuf::int32 Size::width() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Size.width)
-  return width_;
-}
-inline void Size::set_width(::google::protobuf::int32 value) {
-  
-  width_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Size.width)
+// bool frames_lost = 1;
+inline void RefreshRequest::clear_frames_lost() {
+  _impl_.frames_lost_ = false;
 }
-
-// int32 height = 2;
-inline void Size::clear_height() {
-  height_ = 0;
+inline bool RefreshRequest::_internal_frames_lost() const {
+  return _impl_.frames_lost_;
 }
-inline ::google::protobuf::int32 Size::height() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Size.height)
-  return height_;
+inline bool RefreshRequest::frames_lost() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.RefreshRequest.frames_lost)
+  return _internal_frames_lost();
 }
-inline void Size::set_height(::google::protobuf::int32 value) {
+inline void RefreshRequest::_internal_set_frames_lost(bool value) {
   
-  height_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Size.height)
+  _impl_.frames_lost_ = value;
+}
+inline void RefreshRequest::set_frames_lost(bool value) {
+  _internal_set_frames_lost(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.desktop.RefreshRequest.frames_lost)
 }
 
 // -------------------------------------------------------------------
 
-// VideoPacketFormat
+// InputEvent
 
-// .aspia.proto.desktop.Size screen_size = 1;
-inline bool VideoPacketFormat::has_screen_size() const {
-  return this != internal_default_instance() && screen_size_ != NULL;
+// .aspia.proto.desktop.PointerEvent pointer_event = 1;
+inline bool InputEvent::_internal_has_pointer_event() const {
+  return this != internal_default_instance() && _impl_.pointer_event_ != nullptr;
 }
-inline void VideoPacketFormat::clear_screen_size() {
-  if (GetArenaNoVirtual() == NULL && screen_size_ != NULL) {
-    delete screen_size_;
+inline bool InputEvent::has_pointer_event() const {
+  return _internal_has_pointer_event();
+}
+inline void InputEvent::clear_pointer_event() {
+  if (GetArenaForAllocation() == nullptr && _impl_.pointer_event_ != nullptr) {
+    delete _impl_.pointer_event_;
+  }
+  _impl_.pointer_event_ = nullptr;
+}
+inline const ::aspia::proto::desktop::PointerEvent& InputEvent::_internal_pointer_event() const {
+  const ::aspia::proto::desktop::PointerEvent* p = _impl_.pointer_event_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::desktop::PointerEvent&>(
+      ::aspia::proto::desktop::_PointerEvent_default_instance_);
+}
+inline const ::aspia::proto::desktop::PointerEvent& InputEvent::pointer_event() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.InputEvent.pointer_event)
+  return _internal_pointer_event();
+}
+inline void InputEvent::unsafe_arena_set_allocated_pointer_event(
+    ::aspia::proto::desktop::PointerEvent* pointer_event) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pointer_event_);
+  }
+  _impl_.pointer_event_ = pointer_event;
+  if (pointer_event) {
+    
+  } else {
+    
   }
-  screen_size_ = NULL;
-}
-inline const ::aspia::proto::desktop::Size& VideoPacketFormat::_internal_screen_size() const {
-  return *screen_size_;
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.desktop.InputEvent.pointer_event)
 }
-inline const ::aspia::proto::desktop::Size& VideoPacketFormat::screen_size() const {
-  const ::aspia::proto::desktop::Size* p = screen_size_;
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.VideoPacketFormat.screen_size)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::desktop::Size*>(
-      &::aspia::proto::desktop::_Size_default_instance_);
+inline ::aspia::proto::desktop::PointerEvent* InputEvent::release_pointer_event() {
+  
+  ::aspia::proto::desktop::PointerEvent* temp = _impl_.pointer_event_;
+  _impl_.pointer_event_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline ::aspia::proto::desktop::Size* VideoPacketFormat::release_screen_size() {
-  // @@protoc_insertion_point(field_release:aspia.proto.desktop.VideoPacketFormat.screen_size)
+inline ::aspia::proto::desktop::PointerEvent* InputEvent::unsafe_arena_release_pointer_event() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.InputEvent.pointer_event)
   
-  ::aspia::proto::desktop::Size* temp = screen_size_;
-  screen_size_ = NULL;
+  ::aspia::proto::desktop::PointerEvent* temp = _impl_.pointer_event_;
+  _impl_.pointer_event_ = nullptr;
   return temp;
 }
-inline ::aspia::proto::desktop::Size* VideoPacketFormat::mutable_screen_size() {
+inline ::aspia::proto::desktop::PointerEvent* InputEvent::_internal_mutable_pointer_event() {
   
-  if (screen_size_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::desktop::Size>(GetArenaNoVirtual());
-    screen_size_ = p;
+  if (_impl_.pointer_event_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::desktop::PointerEvent>(GetArenaForAllocation());
+    _impl_.pointer_event_ = p;
   }
-  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.VideoPacketFormat.screen_size)
-  return screen_size_;
+  return _impl_.pointer_event_;
 }
-inline void VideoPacketFormat::set_allocated_screen_size(::aspia::proto::desktop::Size* screen_size) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete screen_size_;
+inline ::aspia::proto::desktop::PointerEvent* InputEvent::mutable_pointer_event() {
+  ::aspia::proto::desktop::PointerEvent* _msg = _internal_mutable_pointer_event();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.InputEvent.pointer_event)
+  return _msg;
+}
+inline void InputEvent::set_allocated_pointer_event(::aspia::proto::desktop::PointerEvent* pointer_event) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.pointer_event_;
   }
-  if (screen_size) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+  if (pointer_event) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(pointer_event);
     if (message_arena != submessage_arena) {
-      screen_size = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, screen_size, submessage_arena);
+      pointer_event = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, pointer_event, submessage_arena);
     }
     
   } else {
     
   }
-  screen_size_ = screen_size;
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.VideoPacketFormat.screen_size)
+  _impl_.pointer_event_ = pointer_event;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.InputEvent.pointer_event)
 }
 
-// .aspia.proto.desktop.PixelFormat pixel_format = 2;
-inline bool VideoPacketFormat::has_pixel_format() const {
-  return this != internal_default_instance() && pixel_format_ != NULL;
+// .aspia.proto.desktop.KeyEvent key_event = 2;
+inline bool InputEvent::_internal_has_key_event() const {
+  return this != internal_default_instance() && _impl_.key_event_ != nullptr;
 }
-inline void VideoPacketFormat::clear_pixel_format() {
-  if (GetArenaNoVirtual() == NULL && pixel_format_ != NULL) {
-    delete pixel_format_;
+inline bool InputEvent::has_key_event() const {
+  return _internal_has_key_event();
+}
+inline void InputEvent::clear_key_event() {
+  if (GetArenaForAllocation() == nullptr && _impl_.key_event_ != nullptr) {
+    delete _impl_.key_event_;
   }
-  pixel_format_ = NULL;
+  _impl_.key_event_ = nullptr;
 }
-inline const ::aspia::proto::desktop::PixelFormat& VideoPacketFormat::_internal_pixel_format() const {
-  return *pixel_format_;
+inline const ::aspia::proto::desktop::KeyEvent& InputEvent::_internal_key_event() const {
+  const ::aspia::proto::desktop::KeyEvent* p = _impl_.key_event_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::desktop::KeyEvent&>(
+      ::aspia::proto::desktop::_KeyEvent_default_instance_);
 }
-inline const ::aspia::proto::desktop::PixelFormat& VideoPacketFormat::pixel_format() const {
-  const ::aspia::proto::desktop::PixelFormat* p = pixel_format_;
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.VideoPacketFormat.pixel_format)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::desktop::PixelFormat*>(
-      &::aspia::proto::desktop::_PixelFormat_default_instance_);
+inline const ::aspia::proto::desktop::KeyEvent& InputEvent::key_event() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.InputEvent.key_event)
+  return _internal_key_event();
 }
-inline ::aspia::proto::desktop::PixelFormat* VideoPacketFormat::release_pixel_format() {
-  // @@protoc_insertion_point(field_release:aspia.proto.desktop.VideoPacketFormat.pixel_format)
+inline void InputEvent::unsafe_arena_set_allocated_key_event(
+    ::aspia::proto::desktop::KeyEvent* key_event) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.key_event_);
+  }
+  _impl_.key_event_ = key_event;
+  if (key_event) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.desktop.InputEvent.key_event)
+}
+inline ::aspia::proto::desktop::KeyEvent* InputEvent::release_key_event() {
   
-  ::aspia::proto::desktop::PixelFormat* temp = pixel_format_;
-  pixel_format_ = NULL;
+  ::aspia::proto::desktop::KeyEvent* temp = _impl_.key_event_;
+  _impl_.key_event_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::aspia::proto::desktop::PixelFormat* VideoPacketFormat::mutable_pixel_format() {
+inline ::aspia::proto::desktop::KeyEvent* InputEvent::unsafe_arena_release_key_event() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.InputEvent.key_event)
+  
+  ::aspia::proto::desktop::KeyEvent* temp = _impl_.key_event_;
+  _impl_.key_event_ = nullptr;
+  return temp;
+}
+inline ::aspia::proto::desktop::KeyEvent* InputEvent::_internal_mutable_key_event() {
   
-  if (pixel_format_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::desktop::PixelFormat>(GetArenaNoVirtual());
-    pixel_format_ = p;
+  if (_impl_.key_event_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::desktop::KeyEvent>(GetArenaForAllocation());
+    _impl_.key_event_ = p;
   }
-  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.VideoPacketFormat.pixel_format)
-  return pixel_format_;
+  return _impl_.key_event_;
 }
-inline void VideoPacketFormat::set_allocated_pixel_format(::aspia::proto::desktop::PixelFormat* pixel_format) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete pixel_format_;
+inline ::aspia::proto::desktop::KeyEvent* InputEvent::mutable_key_event() {
+  ::aspia::proto::desktop::KeyEvent* _msg = _internal_mutable_key_event();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.InputEvent.key_event)
+  return _msg;
+}
+inline void InputEvent::set_allocated_key_event(::aspia::proto::desktop::KeyEvent* key_event) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.key_event_;
   }
-  if (pixel_format) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+  if (key_event) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(key_event);
     if (message_arena != submessage_arena) {
-      pixel_format = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, pixel_format, submessage_arena);
+      key_event = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, key_event, submessage_arena);
     }
     
   } else {
     
   }
-  pixel_format_ = pixel_format;
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.VideoPacketFormat.pixel_format)
+  _impl_.key_event_ = key_event;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.InputEvent.key_event)
 }
 
 // -------------------------------------------------------------------
 
-// VideoPacket
+// InputEvents
 
-// .aspia.proto.desktop.VideoEncoding encoding = 1;
-inline void VideoPacket::clear_encoding() {
-  encoding_ = 0;
+// repeated .aspia.proto.desktop.InputEvent event = 1;
+inline int InputEvents::_internal_event_size() const {
+  return _impl_.event_.size();
 }
-inline ::aspia::proto::desktop::VideoEncoding VideoPacket::encoding() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.VideoPacket.encoding)
-  return static_cast< ::aspia::proto::desktop::VideoEncoding >(encoding_);
+inline int InputEvents::event_size() const {
+  return _internal_event_size();
 }
-inline void VideoPacket::set_encoding(::aspia::proto::desktop::VideoEncoding value) {
-  
-  encoding_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.desktop.VideoPacket.encoding)
+inline void InputEvents::clear_event() {
+  _impl_.event_.Clear();
+}
+inline ::aspia::proto::desktop::InputEvent* InputEvents::mutable_event(int index) {
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.InputEvents.event)
+  return _impl_.event_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::desktop::InputEvent >*
+InputEvents::mutable_event() {
+  // @@protoc_insertion_point(field_mutable_list:aspia.proto.desktop.InputEvents.event)
+  return &_impl_.event_;
+}
+inline const ::aspia::proto::desktop::InputEvent& InputEvents::_internal_event(int index) const {
+  return _impl_.event_.Get(index);
+}
+inline const ::aspia::proto::desktop::InputEvent& InputEvents::event(int index) const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.InputEvents.event)
+  return _internal_event(index);
+}
+inline ::aspia::proto::desktop::InputEvent* InputEvents::_internal_add_event() {
+  return _impl_.event_.Add();
+}
+inline ::aspia::proto::desktop::InputEvent* InputEvents::add_event() {
+  ::aspia::proto::desktop::InputEvent* _add = _internal_add_event();
+  // @@protoc_insertion_point(field_add:aspia.proto.desktop.InputEvents.event)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::desktop::InputEvent >&
+InputEvents::event() const {
+  // @@protoc_insertion_point(field_list:aspia.proto.desktop.InputEvents.event)
+  return _impl_.event_;
 }
 
-// .aspia.proto.desktop.VideoPacketFormat format = 2;
-inline bool VideoPacket::has_format() const {
-  return this != internal_default_instance() && format_ != NULL;
+// -------------------------------------------------------------------
+
+// ClientToHost
+
+// .aspia.proto.desktop.PointerEvent pointer_event = 1;
+inline bool ClientToHost::_internal_has_pointer_event() const {
+  return this != internal_default_instance() && _impl_.pointer_event_ != nullptr;
 }
-inline void VideoPacket::clear_format() {
-  if (GetArenaNoVirtual() == NULL && format_ != NULL) {
-    delete format_;
+inline bool ClientToHost::has_pointer_event() const {
+  return _internal_has_pointer_event();
+}
+inline void ClientToHost::clear_pointer_event() {
+  if (GetArenaForAllocation() == nullptr && _impl_.pointer_event_ != nullptr) {
+    delete _impl_.pointer_event_;
   }
-  format_ = NULL;
+  _impl_.pointer_event_ = nullptr;
 }
-inline const ::aspia::proto::desktop::VideoPacketFormat& VideoPacket::_internal_format() const {
-  return *format_;
+inline const ::aspia::proto::desktop::PointerEvent& ClientToHost::_internal_pointer_event() const {
+  const ::aspia::proto::desktop::PointerEvent* p = _impl_.pointer_event_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::desktop::PointerEvent&>(
+      ::aspia::proto::desktop::_PointerEvent_default_instance_);
 }
-inline const ::aspia::proto::desktop::VideoPacketFormat& VideoPacket::format() const {
-  const ::aspia::proto::desktop::VideoPacketFormat* p = format_;
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.VideoPacket.format)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::desktop::VideoPacketFormat*>(
-      &::aspia::proto::desktop::_VideoPacketFormat_default_instance_);
+inline const ::aspia::proto::desktop::PointerEvent& ClientToHost::pointer_event() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.ClientToHost.pointer_event)
+  return _internal_pointer_event();
 }
-inline ::aspia::proto::desktop::VideoPacketFormat* VideoPacket::release_format() {
-  // @@protoc_insertion_point(field_release:aspia.proto.desktop.VideoPacket.format)
+inline void ClientToHost::unsafe_arena_set_allocated_pointer_event(
+    ::aspia::proto::desktop::PointerEvent* pointer_event) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pointer_event_);
+  }
+  _impl_.pointer_event_ = pointer_event;
+  if (pointer_event) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.desktop.ClientToHost.pointer_event)
+}
+inline ::aspia::proto::desktop::PointerEvent* ClientToHost::release_pointer_event() {
   
-  ::aspia::proto::desktop::VideoPacketFormat* temp = format_;
-  format_ = NULL;
+  ::aspia::proto::desktop::PointerEvent* temp = _impl_.pointer_event_;
+  _impl_.pointer_event_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::aspia::proto::desktop::VideoPacketFormat* VideoPacket::mutable_format() {
+inline ::aspia::proto::desktop::PointerEvent* ClientToHost::unsafe_arena_release_pointer_event() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.ClientToHost.pointer_event)
+  
+  ::aspia::proto::desktop::PointerEvent* temp = _impl_.pointer_event_;
+  _impl_.pointer_event_ = nullptr;
+  return temp;
+}
+inline ::aspia::proto::desktop::PointerEvent* ClientToHost::_internal_mutable_pointer_event() {
   
-  if (format_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::desktop::VideoPacketFormat>(GetArenaNoVirtual());
-    format_ = p;
+  if (_impl_.pointer_event_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::desktop::PointerEvent>(GetArenaForAllocation());
+    _impl_.pointer_event_ = p;
   }
-  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.VideoPacket.format)
-  return format_;
+  return _impl_.pointer_event_;
 }
-inline void VideoPacket::set_allocated_format(::aspia::proto::desktop::VideoPacketFormat* format) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete format_;
+inline ::aspia::proto::desktop::PointerEvent* ClientToHost::mutable_pointer_event() {
+  ::aspia::proto::desktop::PointerEvent* _msg = _internal_mutable_pointer_event();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.ClientToHost.pointer_event)
+  return _msg;
+}
+inline void ClientToHost::set_allocated_pointer_event(::aspia::proto::desktop::PointerEvent* pointer_event) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.pointer_event_;
   }
-  if (format) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+  if (pointer_event) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(pointer_event);
     if (message_arena != submessage_arena) {
-      format = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, format, submessage_arena);
+      pointer_event = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, pointer_event, submessage_arena);
     }
     
   } else {
     
   }
-  format_ = format;
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.VideoPacket.format)
+  _impl_.pointer_event_ = pointer_event;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.ClientToHost.pointer_event)
 }
 
-// repeated .aspia.proto.desktop.Rect dirty_rect = 3;
-inline int VideoPacket::dirty_rect_size() const {
-  return dirty_rect_.size();
-}
-inline void VideoPacket::clear_dirty_rect() {
-  dirty_rect_.Clear();
-}
-inline ::aspia::proto::desktop::Rect* VideoPacket::mutable_dirty_rect(int index) {
-  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.VideoPacket.dirty_rect)
-  return dirty_rect_.Mutable(index);
-}
-inline ::google::protobuf::RepeatedPtrField< ::aspia::proto::desktop::Rect >*
-VideoPacket::mutable_dirty_rect() {
-  // @@protoc_insertion_point(field_mutable_list:aspia.proto.desktop.VideoPacket.dirty_rect)
-  return &dirty_rect_;
-}
-inline const ::aspia::proto::desktop::Rect& VideoPacket::dirty_rect(int index) const {
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.VideoPacket.dirty_rect)
-  return dirty_rect_.Get(index);
-}
-inline ::aspia::proto::desktop::Rect* VideoPacket::add_dirty_rect() {
-  // @@protoc_insertion_point(field_add:aspia.proto.desktop.VideoPacket.dirty_rect)
-  return dirty_rect_.Add();
+// .aspia.proto.desktop.KeyEvent key_event = 2;
+inline bool ClientToHost::_internal_has_key_event() const {
+  return this != internal_default_instance() && _impl_.key_event_ != nullptr;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::aspia::proto::desktop::Rect >&
-VideoPacket::dirty_rect() const {
-  // @@protoc_insertion_point(field_list:aspia.proto.desktop.VideoPacket.dirty_rect)
-  return dirty_rect_;
+inline bool ClientToHost::has_key_event() const {
+  return _internal_has_key_event();
 }
-
-// bytes data = 4;
-inline void VideoPacket::clear_data() {
-  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void ClientToHost::clear_key_event() {
+  if (GetArenaForAllocation() == nullptr && _impl_.key_event_ != nullptr) {
+    delete _impl_.key_event_;
+  }
+  _impl_.key_event_ = nullptr;
 }
-inline const ::std::string& VideoPacket::data() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.VideoPacket.data)
-  return data_.GetNoArena();
+inline const ::aspia::proto::desktop::KeyEvent& ClientToHost::_internal_key_event() const {
+  const ::aspia::proto::desktop::KeyEvent* p = _impl_.key_event_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::desktop::KeyEvent&>(
+      ::aspia::proto::desktop::_KeyEvent_default_instance_);
 }
-inline void VideoPacket::set_data(const ::std::string& value) {
-  
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:aspia.proto.desktop.VideoPacket.data)
+inline const ::aspia::proto::desktop::KeyEvent& ClientToHost::key_event() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.ClientToHost.key_event)
+  return _internal_key_event();
 }
-#if LANG_CXX11
-inline void VideoPacket::set_data(::std::string&& value) {
-  
-  data_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.desktop.VideoPacket.data)
+inline void ClientToHost::unsafe_arena_set_allocated_key_event(
+    ::aspia::proto::desktop::KeyEvent* key_event) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.key_event_);
+  }
+  _impl_.key_event_ = key_event;
+  if (key_event) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.desktop.ClientToHost.key_event)
 }
-#endif
-inline void VideoPacket::set_data(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
+inline ::aspia::proto::desktop::KeyEvent* ClientToHost::release_key_event() {
   
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.desktop.VideoPacket.data)
+  ::aspia::proto::desktop::KeyEvent* temp = _impl_.key_event_;
+  _impl_.key_event_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void VideoPacket::set_data(const void* value, size_t size) {
+inline ::aspia::proto::desktop::KeyEvent* ClientToHost::unsafe_arena_release_key_event() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.ClientToHost.key_event)
   
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.desktop.VideoPacket.data)
+  ::aspia::proto::desktop::KeyEvent* temp = _impl_.key_event_;
+  _impl_.key_event_ = nullptr;
+  return temp;
 }
-inline ::std::string* VideoPacket::mutable_data() {
+inline ::aspia::proto::desktop::KeyEvent* ClientToHost::_internal_mutable_key_event() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.VideoPacket.data)
-  return data_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (_impl_.key_event_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::desktop::KeyEvent>(GetArenaForAllocation());
+    _impl_.key_event_ = p;
+  }
+  return _impl_.key_event_;
 }
-inline ::std::string* VideoPacket::release_data() {
-  // @@protoc_insertion_point(field_release:aspia.proto.desktop.VideoPacket.data)
-  
-  return data_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::aspia::proto::desktop::KeyEvent* ClientToHost::mutable_key_event() {
+  ::aspia::proto::desktop::KeyEvent* _msg = _internal_mutable_key_event();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.ClientToHost.key_event)
+  return _msg;
 }
-inline void VideoPacket::set_allocated_data(::std::string* data) {
-  if (data != NULL) {
+inline void ClientToHost::set_allocated_key_event(::aspia::proto::desktop::KeyEvent* key_event) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.key_event_;
+  }
+  if (key_event) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(key_event);
+    if (message_arena != submessage_arena) {
+      key_event = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, key_event, submessage_arena);
+    }
     
   } else {
     
   }
-  data_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), data);
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.VideoPacket.data)
+  _impl_.key_event_ = key_event;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.ClientToHost.key_event)
 }
 
-// -------------------------------------------------------------------
-
-// ConfigRequest
-
-// uint32 video_encodings = 1;
-inline void ConfigRequest::clear_video_encodings() {
-  video_encodings_ = 0u;
-}
-inline ::google::protobuf::uint32 ConfigRequest::video_encodings() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.ConfigRequest.video_encodings)
-  return video_encodings_;
+// .aspia.proto.desktop.ClipboardEvent clipboard_event = 3;
+inline bool ClientToHost::_internal_has_clipboard_event() const {
+  return this != internal_default_instance() && _impl_.clipboard_event_ != nullptr;
 }
-inline void ConfigRequest::set_video_encodings(::google::protobuf::uint32 value) {
-  
-  video_encodings_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.desktop.ConfigRequest.video_encodings)
+inline bool ClientToHost::has_clipboard_event() const {
+  return _internal_has_clipboard_event();
 }
-
-// uint32 features = 2;
-inline void ConfigRequest::clear_features() {
-  features_ = 0u;
+inline void ClientToHost::clear_clipboard_event() {
+  if (GetArenaForAllocation() == nullptr && _impl_.clipboard_event_ != nullptr) {
+    delete _impl_.clipboard_event_;
+  }
+  _impl_.clipboard_event_ = nullptr;
 }
-inline ::google::protobuf::uint32 ConfigRequest::features() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.ConfigRequest.features)
-  return features_;
+inline const ::aspia::proto::desktop::ClipboardEvent& ClientToHost::_internal_clipboard_event() const {
+  const ::aspia::proto::desktop::ClipboardEvent* p = _impl_.clipboard_event_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::desktop::ClipboardEvent&>(
+      ::aspia::proto::desktop::_ClipboardEvent_default_instance_);
 }
-inline void ConfigRequest::set_features(::google::protobuf::uint32 value) {
-  
-  features_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.desktop.ConfigRequest.features)
+inline const ::aspia::proto::desktop::ClipboardEvent& ClientToHost::clipboard_event() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.ClientToHost.clipboard_event)
+  return _internal_clipboard_event();
 }
-
-// -------------------------------------------------------------------
-
-// Config
-
-// uint32 features = 1;
-inline void Config::clear_features() {
-  features_ = 0u;
+inline void ClientToHost::unsafe_arena_set_allocated_clipboard_event(
+    ::aspia::proto::desktop::ClipboardEvent* clipboard_event) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.clipboard_event_);
+  }
+  _impl_.clipboard_event_ = clipboard_event;
+  if (clipboard_event) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.desktop.ClientToHost.clipboard_event)
 }
-inline ::google::protobuf::uint32 Config::features() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Config.features)
-  return features_;
+inline ::aspia::proto::desktop::ClipboardEvent* ClientToHost::release_clipboard_event() {
+  
+  ::aspia::proto::desktop::ClipboardEvent* temp = _impl_.clipboard_event_;
+  _impl_.clipboard_event_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void Config::set_features(::google::protobuf::uint32 value) {
+inline ::aspia::proto::desktop::ClipboardEvent* ClientToHost::unsafe_arena_release_clipboard_event() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.ClientToHost.clipboard_event)
   
-  features_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Config.features)
+  ::aspia::proto::desktop::ClipboardEvent* temp = _impl_.clipboard_event_;
+  _impl_.clipboard_event_ = nullptr;
+  return temp;
 }
-
-// .aspia.proto.desktop.VideoEncoding video_encoding = 2;
-inline void Config::clear_video_encoding() {
-  video_encoding_ = 0;
+inline ::aspia::proto::desktop::ClipboardEvent* ClientToHost::_internal_mutable_clipboard_event() {
+  
+  if (_impl_.clipboard_event_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::desktop::ClipboardEvent>(GetArenaForAllocation());
+    _impl_.clipboard_event_ = p;
+  }
+  return _impl_.clipboard_event_;
 }
-inline ::aspia::proto::desktop::VideoEncoding Config::video_encoding() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Config.video_encoding)
-  return static_cast< ::aspia::proto::desktop::VideoEncoding >(video_encoding_);
+inline ::aspia::proto::desktop::ClipboardEvent* ClientToHost::mutable_clipboard_event() {
+  ::aspia::proto::desktop::ClipboardEvent* _msg = _internal_mutable_clipboard_event();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.ClientToHost.clipboard_event)
+  return _msg;
 }
-inline void Config::set_video_encoding(::aspia::proto::desktop::VideoEncoding value) {
-  
-  video_encoding_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Config.video_encoding)
+inline void ClientToHost::set_allocated_clipboard_event(::aspia::proto::desktop::ClipboardEvent* clipboard_event) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.clipboard_event_;
+  }
+  if (clipboard_event) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(clipboard_event);
+    if (message_arena != submessage_arena) {
+      clipboard_event = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, clipboard_event, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.clipboard_event_ = clipboard_event;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.ClientToHost.clipboard_event)
 }
 
-// .aspia.proto.desktop.PixelFormat pixel_format = 3;
-inline bool Config::has_pixel_format() const {
-  return this != internal_default_instance() && pixel_format_ != NULL;
+// .aspia.proto.desktop.Config config = 4;
+inline bool ClientToHost::_internal_has_config() const {
+  return this != internal_default_instance() && _impl_.config_ != nullptr;
 }
-inline void Config::clear_pixel_format() {
-  if (GetArenaNoVirtual() == NULL && pixel_format_ != NULL) {
-    delete pixel_format_;
+inline bool ClientToHost::has_config() const {
+  return _internal_has_config();
+}
+inline void ClientToHost::clear_config() {
+  if (GetArenaForAllocation() == nullptr && _impl_.config_ != nullptr) {
+    delete _impl_.config_;
   }
-  pixel_format_ = NULL;
+  _impl_.config_ = nullptr;
 }
-inline const ::aspia::proto::desktop::PixelFormat& Config::_internal_pixel_format() const {
-  return *pixel_format_;
+inline const ::aspia::proto::desktop::Config& ClientToHost::_internal_config() const {
+  const ::aspia::proto::desktop::Config* p = _impl_.config_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::desktop::Config&>(
+      ::aspia::proto::desktop::_Config_default_instance_);
 }
-inline const ::aspia::proto::desktop::PixelFormat& Config::pixel_format() const {
-  const ::aspia::proto::desktop::PixelFormat* p = pixel_format_;
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Config.pixel_format)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::desktop::PixelFormat*>(
-      &::aspia::proto::desktop::_PixelFormat_default_instance_);
+inline const ::aspia::proto::desktop::Config& ClientToHost::config() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.ClientToHost.config)
+  return _internal_config();
 }
-inline ::aspia::proto::desktop::PixelFormat* Config::release_pixel_format() {
-  // @@protoc_insertion_point(field_release:aspia.proto.desktop.Config.pixel_format)
+inline void ClientToHost::unsafe_arena_set_allocated_config(
+    ::aspia::proto::desktop::Config* config) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.config_);
+  }
+  _impl_.config_ = config;
+  if (config) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.desktop.ClientToHost.config)
+}
+inline ::aspia::proto::desktop::Config* ClientToHost::release_config() {
+  
+  ::aspia::proto::desktop::Config* temp = _impl_.config_;
+  _impl_.config_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::desktop::Config* ClientToHost::unsafe_arena_release_config() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.ClientToHost.config)
   
-  ::aspia::proto::desktop::PixelFormat* temp = pixel_format_;
-  pixel_format_ = NULL;
+  ::aspia::proto::desktop::Config* temp = _impl_.config_;
+  _impl_.config_ = nullptr;
   return temp;
 }
-inline ::aspia::proto::desktop::PixelFormat* Config::mutable_pixel_format() {
+inline ::aspia::proto::desktop::Config* ClientToHost::_internal_mutable_config() {
   
-  if (pixel_format_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::desktop::PixelFormat>(GetArenaNoVirtual());
-    pixel_format_ = p;
+  if (_impl_.config_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::desktop::Config>(GetArenaForAllocation());
+    _impl_.config_ = p;
   }
-  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.Config.pixel_format)
-  return pixel_format_;
+  return _impl_.config_;
 }
-inline void Config::set_allocated_pixel_format(::aspia::proto::desktop::PixelFormat* pixel_format) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete pixel_format_;
+inline ::aspia::proto::desktop::Config* ClientToHost::mutable_config() {
+  ::aspia::proto::desktop::Config* _msg = _internal_mutable_config();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.ClientToHost.config)
+  return _msg;
+}
+inline void ClientToHost::set_allocated_config(::aspia::proto::desktop::Config* config) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.config_;
   }
-  if (pixel_format) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+  if (config) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(config);
     if (message_arena != submessage_arena) {
-      pixel_format = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, pixel_format, submessage_arena);
+      config = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, config, submessage_arena);
     }
     
   } else {
     
   }
-  pixel_format_ = pixel_format;
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.Config.pixel_format)
+  _impl_.config_ = config;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.ClientToHost.config)
 }
 
-// uint32 update_interval = 4;
-inline void Config::clear_update_interval() {
-  update_interval_ = 0u;
-}
-inline ::google::protobuf::uint32 Config::update_interval() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Config.update_interval)
-  return update_interval_;
-}
-inline void Config::set_update_interval(::google::protobuf::uint32 value) {
-  
-  update_interval_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Config.update_interval)
+// .aspia.proto.desktop.VideoAck video_ack = 5;
+inline bool ClientToHost::_internal_has_video_ack() const {
+  return this != internal_default_instance() && _impl_.video_ack_ != nullptr;
 }
-
-// uint32 compress_ratio = 5;
-inline void Config::clear_compress_ratio() {
-  compress_ratio_ = 0u;
+inline bool ClientToHost::has_video_ack() const {
+  return _internal_has_video_ack();
 }
-inline ::google::protobuf::uint32 Config::compress_ratio() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.Config.compress_ratio)
-  return compress_ratio_;
+inline void ClientToHost::clear_video_ack() {
+  if (GetArenaForAllocation() == nullptr && _impl_.video_ack_ != nullptr) {
+    delete _impl_.video_ack_;
+  }
+  _impl_.video_ack_ = nullptr;
 }
-inline void Config::set_compress_ratio(::google::protobuf::uint32 value) {
-  
-  compress_ratio_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.desktop.Config.compress_ratio)
+inline const ::aspia::proto::desktop::VideoAck& ClientToHost::_internal_video_ack() const {
+  const ::aspia::proto::desktop::VideoAck* p = _impl_.video_ack_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::desktop::VideoAck&>(
+      ::aspia::proto::desktop::_VideoAck_default_instance_);
 }
-
-// -------------------------------------------------------------------
-
-// HostToClient
-
-// .aspia.proto.desktop.VideoPacket video_packet = 1;
-inline bool HostToClient::has_video_packet() const {
-  return this != internal_default_instance() && video_packet_ != NULL;
+inline const ::aspia::proto::desktop::VideoAck& ClientToHost::video_ack() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.ClientToHost.video_ack)
+  return _internal_video_ack();
 }
-inline void HostToClient::clear_video_packet() {
-  if (GetArenaNoVirtual() == NULL && video_packet_ != NULL) {
-    delete video_packet_;
+inline void ClientToHost::unsafe_arena_set_allocated_video_ack(
+    ::aspia::proto::desktop::VideoAck* video_ack) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.video_ack_);
   }
-  video_packet_ = NULL;
-}
-inline const ::aspia::proto::desktop::VideoPacket& HostToClient::_internal_video_packet() const {
-  return *video_packet_;
+  _impl_.video_ack_ = video_ack;
+  if (video_ack) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.desktop.ClientToHost.video_ack)
 }
-inline const ::aspia::proto::desktop::VideoPacket& HostToClient::video_packet() const {
-  const ::aspia::proto::desktop::VideoPacket* p = video_packet_;
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.HostToClient.video_packet)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::desktop::VideoPacket*>(
-      &::aspia::proto::desktop::_VideoPacket_default_instance_);
+inline ::aspia::proto::desktop::VideoAck* ClientToHost::release_video_ack() {
+  
+  ::aspia::proto::desktop::VideoAck* temp = _impl_.video_ack_;
+  _impl_.video_ack_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline ::aspia::proto::desktop::VideoPacket* HostToClient::release_video_packet() {
-  // @@protoc_insertion_point(field_release:aspia.proto.desktop.HostToClient.video_packet)
+inline ::aspia::proto::desktop::VideoAck* ClientToHost::unsafe_arena_release_video_ack() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.ClientToHost.video_ack)
   
-  ::aspia::proto::desktop::VideoPacket* temp = video_packet_;
-  video_packet_ = NULL;
+  ::aspia::proto::desktop::VideoAck* temp = _impl_.video_ack_;
+  _impl_.video_ack_ = nullptr;
   return temp;
 }
-inline ::aspia::proto::desktop::VideoPacket* HostToClient::mutable_video_packet() {
+inline ::aspia::proto::desktop::VideoAck* ClientToHost::_internal_mutable_video_ack() {
   
-  if (video_packet_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::desktop::VideoPacket>(GetArenaNoVirtual());
-    video_packet_ = p;
+  if (_impl_.video_ack_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::desktop::VideoAck>(GetArenaForAllocation());
+    _impl_.video_ack_ = p;
   }
-  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.HostToClient.video_packet)
-  return video_packet_;
+  return _impl_.video_ack_;
 }
-inline void HostToClient::set_allocated_video_packet(::aspia::proto::desktop::VideoPacket* video_packet) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete video_packet_;
+inline ::aspia::proto::desktop::VideoAck* ClientToHost::mutable_video_ack() {
+  ::aspia::proto::desktop::VideoAck* _msg = _internal_mutable_video_ack();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.ClientToHost.video_ack)
+  return _msg;
+}
+inline void ClientToHost::set_allocated_video_ack(::aspia::proto::desktop::VideoAck* video_ack) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.video_ack_;
   }
-  if (video_packet) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+  if (video_ack) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(video_ack);
     if (message_arena != submessage_arena) {
-      video_packet = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, video_packet, submessage_arena);
+      video_ack = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, video_ack, submessage_arena);
     }
     
   } else {
     
   }
-  video_packet_ = video_packet;
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.HostToClient.video_packet)
+  _impl_.video_ack_ = video_ack;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.ClientToHost.video_ack)
 }
 
-// .aspia.proto.desktop.CursorShape cursor_shape = 2;
-inline bool HostToClient::has_cursor_shape() const {
-  return this != internal_default_instance() && cursor_shape_ != NULL;
-}
-inline void HostToClient::clear_cursor_shape() {
-  if (GetArenaNoVirtual() == NULL && cursor_shape_ != NULL) {
-    delete cursor_shape_;
-  }
-  cursor_shape_ = NULL;
+// .aspia.proto.desktop.Screen screen = 6;
+inline bool ClientToHost::_internal_has_screen() const {
+  return this != internal_default_instance() && _impl_.screen_ != nullptr;
 }
-inline const ::aspia::proto::desktop::CursorShape& HostToClient::_internal_cursor_shape() const {
-  return *cursor_shape_;
+inline bool ClientToHost::has_screen() const {
+  return _internal_has_screen();
 }
-inline const ::aspia::proto::desktop::CursorShape& HostToClient::cursor_shape() const {
-  const ::aspia::proto::desktop::CursorShape* p = cursor_shape_;
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.HostToClient.cursor_shape)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::desktop::CursorShape*>(
-      &::aspia::proto::desktop::_CursorShape_default_instance_);
+inline void ClientToHost::clear_screen() {
+  if (GetArenaForAllocation() == nullptr && _impl_.screen_ != nullptr) {
+    delete _impl_.screen_;
+  }
+  _impl_.screen_ = nullptr;
 }
-inline ::aspia::proto::desktop::CursorShape* HostToClient::release_cursor_shape() {
-  // @@protoc_insertion_point(field_release:aspia.proto.desktop.HostToClient.cursor_shape)
-  
-  ::aspia::proto::desktop::CursorShape* temp = cursor_shape_;
-  cursor_shape_ = NULL;
-  return temp;
+inline const ::aspia::proto::desktop::Screen& ClientToHost::_internal_screen() const {
+  const ::aspia::proto::desktop::Screen* p = _impl_.screen_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::desktop::Screen&>(
+      ::aspia::proto::desktop::_Screen_default_instance_);
 }
-inline ::aspia::proto::desktop::CursorShape* HostToClient::mutable_cursor_shape() {
-  
-  if (cursor_shape_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::desktop::CursorShape>(GetArenaNoVirtual());
-    cursor_shape_ = p;
-  }
-  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.HostToClient.cursor_shape)
-  return cursor_shape_;
+inline const ::aspia::proto::desktop::Screen& ClientToHost::screen() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.ClientToHost.screen)
+  return _internal_screen();
 }
-inline void HostToClient::set_allocated_cursor_shape(::aspia::proto::desktop::CursorShape* cursor_shape) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete cursor_shape_;
+inline void ClientToHost::unsafe_arena_set_allocated_screen(
+    ::aspia::proto::desktop::Screen* screen) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.screen_);
   }
-  if (cursor_shape) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
-    if (message_arena != submessage_arena) {
-      cursor_shape = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, cursor_shape, submessage_arena);
-    }
+  _impl_.screen_ = screen;
+  if (screen) {
     
   } else {
     
   }
-  cursor_shape_ = cursor_shape;
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.HostToClient.cursor_shape)
-}
-
-// .aspia.proto.desktop.ClipboardEvent clipboard_event = 3;
-inline bool HostToClient::has_clipboard_event() const {
-  return this != internal_default_instance() && clipboard_event_ != NULL;
-}
-inline void HostToClient::clear_clipboard_event() {
-  if (GetArenaNoVirtual() == NULL && clipboard_event_ != NULL) {
-    delete clipboard_event_;
-  }
-  clipboard_event_ = NULL;
-}
-inline const ::aspia::proto::desktop::ClipboardEvent& HostToClient::_internal_clipboard_event() const {
-  return *clipboard_event_;
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.desktop.ClientToHost.screen)
 }
-inline const ::aspia::proto::desktop::ClipboardEvent& HostToClient::clipboard_event() const {
-  const ::aspia::proto::desktop::ClipboardEvent* p = clipboard_event_;
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.HostToClient.clipboard_event)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::desktop::ClipboardEvent*>(
-      &::aspia::proto::desktop::_ClipboardEvent_default_instance_);
+inline ::aspia::proto::desktop::Screen* ClientToHost::release_screen() {
+  
+  ::aspia::proto::desktop::Screen* temp = _impl_.screen_;
+  _impl_.screen_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline ::aspia::proto::desktop::ClipboardEvent* HostToClient::release_clipboard_event() {
-  // @@protoc_insertion_point(field_release:aspia.proto.desktop.HostToClient.clipboard_event)
+inline ::aspia::proto::desktop::Screen* ClientToHost::unsafe_arena_release_screen() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.ClientToHost.screen)
   
-  ::aspia::proto::desktop::ClipboardEvent* temp = clipboard_event_;
-  clipboard_event_ = NULL;
+  ::aspia::proto::desktop::Screen* temp = _impl_.screen_;
+  _impl_.screen_ = nullptr;
   return temp;
 }
-inline ::aspia::proto::desktop::ClipboardEvent* HostToClient::mutable_clipboard_event() {
+inline ::aspia::proto::desktop::Screen* ClientToHost::_internal_mutable_screen() {
   
-  if (clipboard_event_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::desktop::ClipboardEvent>(GetArenaNoVirtual());
-    clipboard_event_ = p;
+  if (_impl_.screen_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::desktop::Screen>(GetArenaForAllocation());
+    _impl_.screen_ = p;
   }
-  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.HostToClient.clipboard_event)
-  return clipboard_event_;
+  return _impl_.screen_;
 }
-inline void HostToClient::set_allocated_clipboard_event(::aspia::proto::desktop::ClipboardEvent* clipboard_event) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete clipboard_event_;
+inline ::aspia::proto::desktop::Screen* ClientToHost::mutable_screen() {
+  ::aspia::proto::desktop::Screen* _msg = _internal_mutable_screen();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.ClientToHost.screen)
+  return _msg;
+}
+inline void ClientToHost::set_allocated_screen(::aspia::proto::desktop::Screen* screen) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.screen_;
   }
-  if (clipboard_event) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+  if (screen) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(screen);
     if (message_arena != submessage_arena) {
-      clipboard_event = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, clipboard_event, submessage_arena);
+      screen = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, screen, submessage_arena);
     }
     
   } else {
     
   }
-  clipboard_event_ = clipboard_event;
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.HostToClient.clipboard_event)
+  _impl_.screen_ = screen;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.ClientToHost.screen)
 }
 
-// .aspia.proto.desktop.ConfigRequest config_request = 4;
-inline bool HostToClient::has_config_request() const {
-  return this != internal_default_instance() && config_request_ != NULL;
+// .aspia.proto.desktop.RefreshRequest refresh_request = 7;
+inline bool ClientToHost::_internal_has_refresh_request() const {
+  return this != internal_default_instance() && _impl_.refresh_request_ != nullptr;
 }
-inline void HostToClient::clear_config_request() {
-  if (GetArenaNoVirtual() == NULL && config_request_ != NULL) {
-    delete config_request_;
+inline bool ClientToHost::has_refresh_request() const {
+  return _internal_has_refresh_request();
+}
+inline void ClientToHost::clear_refresh_request() {
+  if (GetArenaForAllocation() == nullptr && _impl_.refresh_request_ != nullptr) {
+    delete _impl_.refresh_request_;
   }
-  config_request_ = NULL;
+  _impl_.refresh_request_ = nullptr;
 }
-inline const ::aspia::proto::desktop::ConfigRequest& HostToClient::_internal_config_request() const {
-  return *config_request_;
+inline const ::aspia::proto::desktop::RefreshRequest& ClientToHost::_internal_refresh_request() const {
+  const ::aspia::proto::desktop::RefreshRequest* p = _impl_.refresh_request_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::desktop::RefreshRequest&>(
+      ::aspia::proto::desktop::_RefreshRequest_default_instance_);
 }
-inline const ::aspia::proto::desktop::ConfigRequest& HostToClient::config_request() const {
-  const ::aspia::proto::desktop::ConfigRequest* p = config_request_;
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.HostToClient.config_request)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::desktop::ConfigRequest*>(
-      &::aspia::proto::desktop::_ConfigRequest_default_instance_);
+inline const ::aspia::proto::desktop::RefreshRequest& ClientToHost::refresh_request() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.ClientToHost.refresh_request)
+  return _internal_refresh_request();
 }
-inline ::aspia::proto::desktop::ConfigRequest* HostToClient::release_config_request() {
-  // @@protoc_insertion_point(field_release:aspia.proto.desktop.HostToClient.config_request)
+inline void ClientToHost::unsafe_arena_set_allocated_refresh_request(
+    ::aspia::proto::desktop::RefreshRequest* refresh_request) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.refresh_request_);
+  }
+  _impl_.refresh_request_ = refresh_request;
+  if (refresh_request) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.desktop.ClientToHost.refresh_request)
+}
+inline ::aspia::proto::desktop::RefreshRequest* ClientToHost::release_refresh_request() {
   
-  ::aspia::proto::desktop::ConfigRequest* temp = config_request_;
-  config_request_ = NULL;
+  ::aspia::proto::desktop::RefreshRequest* temp = _impl_.refresh_request_;
+  _impl_.refresh_request_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::aspia::proto::desktop::ConfigRequest* HostToClient::mutable_config_request() {
+inline ::aspia::proto::desktop::RefreshRequest* ClientToHost::unsafe_arena_release_refresh_request() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.ClientToHost.refresh_request)
+  
+  ::aspia::proto::desktop::RefreshRequest* temp = _impl_.refresh_request_;
+  _impl_.refresh_request_ = nullptr;
+  return temp;
+}
+inline ::aspia::proto::desktop::RefreshRequest* ClientToHost::_internal_mutable_refresh_request() {
   
-  if (config_request_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::desktop::ConfigRequest>(GetArenaNoVirtual());
-    config_request_ = p;
+  if (_impl_.refresh_request_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::desktop::RefreshRequest>(GetArenaForAllocation());
+    _impl_.refresh_request_ = p;
   }
-  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.HostToClient.config_request)
-  return config_request_;
+  return _impl_.refresh_request_;
 }
-inline void HostToClient::set_allocated_config_request(::aspia::proto::desktop::ConfigRequest* config_request) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete config_request_;
+inline ::aspia::proto::desktop::RefreshRequest* ClientToHost::mutable_refresh_request() {
+  ::aspia::proto::desktop::RefreshRequest* _msg = _internal_mutable_refresh_request();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.ClientToHost.refresh_request)
+  return _msg;
+}
+inline void ClientToHost::set_allocated_refresh_request(::aspia::proto::desktop::RefreshRequest* refresh_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.refresh_request_;
   }
-  if (config_request) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+  if (refresh_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(refresh_request);
     if (message_arena != submessage_arena) {
-      config_request = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, config_request, submessage_arena);
+      refresh_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, refresh_request, submessage_arena);
     }
     
   } else {
     
   }
-  config_request_ = config_request;
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.HostToClient.config_request)
+  _impl_.refresh_request_ = refresh_request;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.ClientToHost.refresh_request)
 }
 
-// -------------------------------------------------------------------
-
-// ClientToHost
-
-// .aspia.proto.desktop.PointerEvent pointer_event = 1;
-inline bool ClientToHost::has_pointer_event() const {
-  return this != internal_default_instance() && pointer_event_ != NULL;
+// .aspia.proto.desktop.InputEvents input_events = 8;
+inline bool ClientToHost::_internal_has_input_events() const {
+  return this != internal_default_instance() && _impl_.input_events_ != nullptr;
 }
-inline void ClientToHost::clear_pointer_event() {
-  if (GetArenaNoVirtual() == NULL && pointer_event_ != NULL) {
-    delete pointer_event_;
+inline bool ClientToHost::has_input_events() const {
+  return _internal_has_input_events();
+}
+inline void ClientToHost::clear_input_events() {
+  if (GetArenaForAllocation() == nullptr && _impl_.input_events_ != nullptr) {
+    delete _impl_.input_events_;
   }
-  pointer_event_ = NULL;
+  _impl_.input_events_ = nullptr;
 }
-inline const ::aspia::proto::desktop::PointerEvent& ClientToHost::_internal_pointer_event() const {
-  return *pointer_event_;
+inline const ::aspia::proto::desktop::InputEvents& ClientToHost::_internal_input_events() const {
+  const ::aspia::proto::desktop::InputEvents* p = _impl_.input_events_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::desktop::InputEvents&>(
+      ::aspia::proto::desktop::_InputEvents_default_instance_);
 }
-inline const ::aspia::proto::desktop::PointerEvent& ClientToHost::pointer_event() const {
-  const ::aspia::proto::desktop::PointerEvent* p = pointer_event_;
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.ClientToHost.pointer_event)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::desktop::PointerEvent*>(
-      &::aspia::proto::desktop::_PointerEvent_default_instance_);
+inline const ::aspia::proto::desktop::InputEvents& ClientToHost::input_events() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.ClientToHost.input_events)
+  return _internal_input_events();
 }
-inline ::aspia::proto::desktop::PointerEvent* ClientToHost::release_pointer_event() {
-  // @@protoc_insertion_point(field_release:aspia.proto.desktop.ClientToHost.pointer_event)
+inline void ClientToHost::unsafe_arena_set_allocated_input_events(
+    ::aspia::proto::desktop::InputEvents* input_events) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.input_events_);
+  }
+  _impl_.input_events_ = input_events;
+  if (input_events) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.desktop.ClientToHost.input_events)
+}
+inline ::aspia::proto::desktop::InputEvents* ClientToHost::release_input_events() {
   
-  ::aspia::proto::desktop::PointerEvent* temp = pointer_event_;
-  pointer_event_ = NULL;
+  ::aspia::proto::desktop::InputEvents* temp = _impl_.input_events_;
+  _impl_.input_events_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::aspia::proto::desktop::PointerEvent* ClientToHost::mutable_pointer_event() {
+inline ::aspia::proto::desktop::InputEvents* ClientToHost::unsafe_arena_release_input_events() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.ClientToHost.input_events)
+  
+  ::aspia::proto::desktop::InputEvents* temp = _impl_.input_events_;
+  _impl_.input_events_ = nullptr;
+  return temp;
+}
+inline ::aspia::proto::desktop::InputEvents* ClientToHost::_internal_mutable_input_events() {
   
-  if (pointer_event_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::desktop::PointerEvent>(GetArenaNoVirtual());
-    pointer_event_ = p;
+  if (_impl_.input_events_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::desktop::InputEvents>(GetArenaForAllocation());
+    _impl_.input_events_ = p;
   }
-  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.ClientToHost.pointer_event)
-  return pointer_event_;
+  return _impl_.input_events_;
 }
-inline void ClientToHost::set_allocated_pointer_event(::aspia::proto::desktop::PointerEvent* pointer_event) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete pointer_event_;
+inline ::aspia::proto::desktop::InputEvents* ClientToHost::mutable_input_events() {
+  ::aspia::proto::desktop::InputEvents* _msg = _internal_mutable_input_events();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.ClientToHost.input_events)
+  return _msg;
+}
+inline void ClientToHost::set_allocated_input_events(::aspia::proto::desktop::InputEvents* input_events) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.input_events_;
   }
-  if (pointer_event) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+  if (input_events) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(input_events);
     if (message_arena != submessage_arena) {
-      pointer_event = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, pointer_event, submessage_arena);
+      input_events = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, input_events, submessage_arena);
     }
     
   } else {
     
   }
-  pointer_event_ = pointer_event;
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.ClientToHost.pointer_event)
+  _impl_.input_events_ = input_events;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.ClientToHost.input_events)
 }
 
-// .aspia.proto.desktop.KeyEvent key_event = 2;
-inline bool ClientToHost::has_key_event() const {
-  return this != internal_default_instance() && key_event_ != NULL;
+// .aspia.proto.desktop.Ping ping = 9;
+inline bool ClientToHost::_internal_has_ping() const {
+  return this != internal_default_instance() && _impl_.ping_ != nullptr;
 }
-inline void ClientToHost::clear_key_event() {
-  if (GetArenaNoVirtual() == NULL && key_event_ != NULL) {
-    delete key_event_;
+inline bool ClientToHost::has_ping() const {
+  return _internal_has_ping();
+}
+inline void ClientToHost::clear_ping() {
+  if (GetArenaForAllocation() == nullptr && _impl_.ping_ != nullptr) {
+    delete _impl_.ping_;
   }
-  key_event_ = NULL;
+  _impl_.ping_ = nullptr;
 }
-inline const ::aspia::proto::desktop::KeyEvent& ClientToHost::_internal_key_event() const {
-  return *key_event_;
+inline const ::aspia::proto::desktop::Ping& ClientToHost::_internal_ping() const {
+  const ::aspia::proto::desktop::Ping* p = _impl_.ping_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::desktop::Ping&>(
+      ::aspia::proto::desktop::_Ping_default_instance_);
 }
-inline const ::aspia::proto::desktop::KeyEvent& ClientToHost::key_event() const {
-  const ::aspia::proto::desktop::KeyEvent* p = key_event_;
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.ClientToHost.key_event)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::desktop::KeyEvent*>(
-      &::aspia::proto::desktop::_KeyEvent_default_instance_);
+inline const ::aspia::proto::desktop::Ping& ClientToHost::ping() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.ClientToHost.ping)
+  return _internal_ping();
 }
-inline ::aspia::proto::desktop::KeyEvent* ClientToHost::release_key_event() {
-  // @@protoc_insertion_point(field_release:aspia.proto.desktop.ClientToHost.key_event)
+inline void ClientToHost::unsafe_arena_set_allocated_ping(
+    ::aspia::proto::desktop::Ping* ping) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.ping_);
+  }
+  _impl_.ping_ = ping;
+  if (ping) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.desktop.ClientToHost.ping)
+}
+inline ::aspia::proto::desktop::Ping* ClientToHost::release_ping() {
   
-  ::aspia::proto::desktop::KeyEvent* temp = key_event_;
-  key_event_ = NULL;
+  ::aspia::proto::desktop::Ping* temp = _impl_.ping_;
+  _impl_.ping_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::aspia::proto::desktop::KeyEvent* ClientToHost::mutable_key_event() {
+inline ::aspia::proto::desktop::Ping* ClientToHost::unsafe_arena_release_ping() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.ClientToHost.ping)
+  
+  ::aspia::proto::desktop::Ping* temp = _impl_.ping_;
+  _impl_.ping_ = nullptr;
+  return temp;
+}
+inline ::aspia::proto::desktop::Ping* ClientToHost::_internal_mutable_ping() {
   
-  if (key_event_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::desktop::KeyEvent>(GetArenaNoVirtual());
-    key_event_ = p;
+  if (_impl_.ping_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::desktop::Ping>(GetArenaForAllocation());
+    _impl_.ping_ = p;
   }
-  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.ClientToHost.key_event)
-  return key_event_;
+  return _impl_.ping_;
 }
-inline void ClientToHost::set_allocated_key_event(::aspia::proto::desktop::KeyEvent* key_event) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete key_event_;
+inline ::aspia::proto::desktop::Ping* ClientToHost::mutable_ping() {
+  ::aspia::proto::desktop::Ping* _msg = _internal_mutable_ping();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.ClientToHost.ping)
+  return _msg;
+}
+inline void ClientToHost::set_allocated_ping(::aspia::proto::desktop::Ping* ping) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.ping_;
   }
-  if (key_event) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+  if (ping) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(ping);
     if (message_arena != submessage_arena) {
-      key_event = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, key_event, submessage_arena);
+      ping = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, ping, submessage_arena);
     }
     
   } else {
     
   }
-  key_event_ = key_event;
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.ClientToHost.key_event)
+  _impl_.ping_ = ping;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.ClientToHost.ping)
 }
 
-// .aspia.proto.desktop.ClipboardEvent clipboard_event = 3;
-inline bool ClientToHost::has_clipboard_event() const {
-  return this != internal_default_instance() && clipboard_event_ != NULL;
+// .aspia.proto.desktop.Visibility visibility = 10;
+inline bool ClientToHost::_internal_has_visibility() const {
+  return this != internal_default_instance() && _impl_.visibility_ != nullptr;
 }
-inline void ClientToHost::clear_clipboard_event() {
-  if (GetArenaNoVirtual() == NULL && clipboard_event_ != NULL) {
-    delete clipboard_event_;
+inline bool ClientToHost::has_visibility() const {
+  return _internal_has_visibility();
+}
+inline void ClientToHost::clear_visibility() {
+  if (GetArenaForAllocation() == nullptr && _impl_.visibility_ != nullptr) {
+    delete _impl_.visibility_;
   }
-  clipboard_event_ = NULL;
+  _impl_.visibility_ = nullptr;
 }
-inline const ::aspia::proto::desktop::ClipboardEvent& ClientToHost::_internal_clipboard_event() const {
-  return *clipboard_event_;
+inline const ::aspia::proto::desktop::Visibility& ClientToHost::_internal_visibility() const {
+  const ::aspia::proto::desktop::Visibility* p = _impl_.visibility_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::desktop::Visibility&>(
+      ::aspia::proto::desktop::_Visibility_default_instance_);
 }
-inline const ::aspia::proto::desktop::ClipboardEvent& ClientToHost::clipboard_event() const {
-  const ::aspia::proto::desktop::ClipboardEvent* p = clipboard_event_;
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.ClientToHost.clipboard_event)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::desktop::ClipboardEvent*>(
-      &::aspia::proto::desktop::_ClipboardEvent_default_instance_);
+inline const ::aspia::proto::desktop::Visibility& ClientToHost::visibility() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.ClientToHost.visibility)
+  return _internal_visibility();
 }
-inline ::aspia::proto::desktop::ClipboardEvent* ClientToHost::release_clipboard_event() {
-  // @@protoc_insertion_point(field_release:aspia.proto.desktop.ClientToHost.clipboard_event)
+inline void ClientToHost::unsafe_arena_set_allocated_visibility(
+    ::aspia::proto::desktop::Visibility* visibility) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.visibility_);
+  }
+  _impl_.visibility_ = visibility;
+  if (visibility) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.desktop.ClientToHost.visibility)
+}
+inline ::aspia::proto::desktop::Visibility* ClientToHost::release_visibility() {
   
-  ::aspia::proto::desktop::ClipboardEvent* temp = clipboard_event_;
-  clipboard_event_ = NULL;
+  ::aspia::proto::desktop::Visibility* temp = _impl_.visibility_;
+  _impl_.visibility_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::aspia::proto::desktop::ClipboardEvent* ClientToHost::mutable_clipboard_event() {
+inline ::aspia::proto::desktop::Visibility* ClientToHost::unsafe_arena_release_visibility() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.ClientToHost.visibility)
   
-  if (clipboard_event_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::desktop::ClipboardEvent>(GetArenaNoVirtual());
-    clipboard_event_ = p;
+  ::aspia::proto::desktop::Visibility* temp = _impl_.visibility_;
+  _impl_.visibility_ = nullptr;
+  return temp;
+}
+inline ::aspia::proto::desktop::Visibility* ClientToHost::_internal_mutable_visibility() {
+  
+  if (_impl_.visibility_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::desktop::Visibility>(GetArenaForAllocation());
+    _impl_.visibility_ = p;
   }
-  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.ClientToHost.clipboard_event)
-  return clipboard_event_;
+  return _impl_.visibility_;
 }
-inline void ClientToHost::set_allocated_clipboard_event(::aspia::proto::desktop::ClipboardEvent* clipboard_event) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete clipboard_event_;
+inline ::aspia::proto::desktop::Visibility* ClientToHost::mutable_visibility() {
+  ::aspia::proto::desktop::Visibility* _msg = _internal_mutable_visibility();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.ClientToHost.visibility)
+  return _msg;
+}
+inline void ClientToHost::set_allocated_visibility(::aspia::proto::desktop::Visibility* visibility) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.visibility_;
   }
-  if (clipboard_event) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+  if (visibility) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(visibility);
     if (message_arena != submessage_arena) {
-      clipboard_event = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, clipboard_event, submessage_arena);
+      visibility = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, visibility, submessage_arena);
     }
     
   } else {
     
   }
-  clipboard_event_ = clipboard_event;
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.ClientToHost.clipboard_event)
+  _impl_.visibility_ = visibility;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.ClientToHost.visibility)
 }
 
-// .aspia.proto.desktop.Config config = 4;
-inline bool ClientToHost::has_config() const {
-  return this != internal_default_instance() && config_ != NULL;
+// .aspia.proto.desktop.VisibleArea visible_area = 11;
+inline bool ClientToHost::_internal_has_visible_area() const {
+  return this != internal_default_instance() && _impl_.visible_area_ != nullptr;
 }
-inline void ClientToHost::clear_config() {
-  if (GetArenaNoVirtual() == NULL && config_ != NULL) {
-    delete config_;
+inline bool ClientToHost::has_visible_area() const {
+  return _internal_has_visible_area();
+}
+inline void ClientToHost::clear_visible_area() {
+  if (GetArenaForAllocation() == nullptr && _impl_.visible_area_ != nullptr) {
+    delete _impl_.visible_area_;
   }
-  config_ = NULL;
+  _impl_.visible_area_ = nullptr;
 }
-inline const ::aspia::proto::desktop::Config& ClientToHost::_internal_config() const {
-  return *config_;
+inline const ::aspia::proto::desktop::VisibleArea& ClientToHost::_internal_visible_area() const {
+  const ::aspia::proto::desktop::VisibleArea* p = _impl_.visible_area_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::desktop::VisibleArea&>(
+      ::aspia::proto::desktop::_VisibleArea_default_instance_);
 }
-inline const ::aspia::proto::desktop::Config& ClientToHost::config() const {
-  const ::aspia::proto::desktop::Config* p = config_;
-  // @@protoc_insertion_point(field_get:aspia.proto.desktop.ClientToHost.config)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::desktop::Config*>(
-      &::aspia::proto::desktop::_Config_default_instance_);
+inline const ::aspia::proto::desktop::VisibleArea& ClientToHost::visible_area() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.desktop.ClientToHost.visible_area)
+  return _internal_visible_area();
 }
-inline ::aspia::proto::desktop::Config* ClientToHost::release_config() {
-  // @@protoc_insertion_point(field_release:aspia.proto.desktop.ClientToHost.config)
+inline void ClientToHost::unsafe_arena_set_allocated_visible_area(
+    ::aspia::proto::desktop::VisibleArea* visible_area) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.visible_area_);
+  }
+  _impl_.visible_area_ = visible_area;
+  if (visible_area) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.desktop.ClientToHost.visible_area)
+}
+inline ::aspia::proto::desktop::VisibleArea* ClientToHost::release_visible_area() {
   
-  ::aspia::proto::desktop::Config* temp = config_;
-  config_ = NULL;
+  ::aspia::proto::desktop::VisibleArea* temp = _impl_.visible_area_;
+  _impl_.visible_area_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::aspia::proto::desktop::Config* ClientToHost::mutable_config() {
+inline ::aspia::proto::desktop::VisibleArea* ClientToHost::unsafe_arena_release_visible_area() {
+  // @@protoc_insertion_point(field_release:aspia.proto.desktop.ClientToHost.visible_area)
+  
+  ::aspia::proto::desktop::VisibleArea* temp = _impl_.visible_area_;
+  _impl_.visible_area_ = nullptr;
+  return temp;
+}
+inline ::aspia::proto::desktop::VisibleArea* ClientToHost::_internal_mutable_visible_area() {
   
-  if (config_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::desktop::Config>(GetArenaNoVirtual());
-    config_ = p;
+  if (_impl_.visible_area_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::desktop::VisibleArea>(GetArenaForAllocation());
+    _impl_.visible_area_ = p;
   }
-  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.ClientToHost.config)
-  return config_;
+  return _impl_.visible_area_;
 }
-inline void ClientToHost::set_allocated_config(::aspia::proto::desktop::Config* config) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete config_;
+inline ::aspia::proto::desktop::VisibleArea* ClientToHost::mutable_visible_area() {
+  ::aspia::proto::desktop::VisibleArea* _msg = _internal_mutable_visible_area();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.desktop.ClientToHost.visible_area)
+  return _msg;
+}
+inline void ClientToHost::set_allocated_visible_area(::aspia::proto::desktop::VisibleArea* visible_area) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.visible_area_;
   }
-  if (config) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+  if (visible_area) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(visible_area);
     if (message_arena != submessage_arena) {
-      config = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, config, submessage_arena);
+      visible_area = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, visible_area, submessage_arena);
     }
     
   } else {
     
   }
-  config_ = config;
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.ClientToHost.config)
+  _impl_.visible_area_ = visible_area;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.desktop.ClientToHost.visible_area)
 }
 
 #ifdef __GNUC__
@@ -3291,6 +10164,32 @@ inline void ClientToHost::set_allocated_config(::aspia::proto::desktop::Config*
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -3298,18 +10197,19 @@ inline void ClientToHost::set_allocated_config(::aspia::proto::desktop::Config*
 }  // namespace proto
 }  // namespace aspia
 
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 
 template <> struct is_proto_enum< ::aspia::proto::desktop::KeyEvent_Flags> : ::std::true_type {};
 template <> struct is_proto_enum< ::aspia::proto::desktop::PointerEvent_ButtonMask> : ::std::true_type {};
+template <> struct is_proto_enum< ::aspia::proto::desktop::ClipboardEvent_Type> : ::std::true_type {};
 template <> struct is_proto_enum< ::aspia::proto::desktop::CursorShape_Flags> : ::std::true_type {};
+template <> struct is_proto_enum< ::aspia::proto::desktop::Compression> : ::std::true_type {};
 template <> struct is_proto_enum< ::aspia::proto::desktop::VideoEncoding> : ::std::true_type {};
 template <> struct is_proto_enum< ::aspia::proto::desktop::Feature> : ::std::true_type {};
 
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_INCLUDED_desktop_5fsession_2eproto
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_desktop_5fsession_2eproto
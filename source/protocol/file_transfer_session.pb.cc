@@ -5,357 +5,355 @@
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/port.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/io/zero_copy_stream_impl_lite.h>
-// This is a temporary google only hack
-#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-#include "third_party/protobuf/version.h"
-#endif
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-namespace protobuf_file_5ftransfer_5fsession_2eproto {
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_CreateDirectoryRequest;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_DownloadRequest;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_DriveListRequest;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_DriveList_Item;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_FileListRequest;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_FileList_Item;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_Packet;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_PacketRequest;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_RemoveRequest;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_RenameRequest;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_UploadRequest;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<1> scc_info_DriveList;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto ::google::protobuf::internal::SCCInfo<1> scc_info_FileList;
-}  // namespace protobuf_file_5ftransfer_5fsession_2eproto
 namespace aspia {
 namespace proto {
 namespace file_transfer {
-class DriveList_ItemDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<DriveList_Item>
-      _instance;
-} _DriveList_Item_default_instance_;
-class DriveListDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<DriveList>
-      _instance;
-} _DriveList_default_instance_;
-class DriveListRequestDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<DriveListRequest>
-      _instance;
-} _DriveListRequest_default_instance_;
-class FileList_ItemDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<FileList_Item>
-      _instance;
-} _FileList_Item_default_instance_;
-class FileListDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<FileList>
-      _instance;
-} _FileList_default_instance_;
-class FileListRequestDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<FileListRequest>
-      _instance;
-} _FileListRequest_default_instance_;
-class UploadRequestDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<UploadRequest>
-      _instance;
-} _UploadRequest_default_instance_;
-class DownloadRequestDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<DownloadRequest>
-      _instance;
-} _DownloadRequest_default_instance_;
-class PacketRequestDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<PacketRequest>
-      _instance;
-} _PacketRequest_default_instance_;
-class PacketDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<Packet>
-      _instance;
-} _Packet_default_instance_;
-class CreateDirectoryRequestDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<CreateDirectoryRequest>
-      _instance;
-} _CreateDirectoryRequest_default_instance_;
-class RenameRequestDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<RenameRequest>
-      _instance;
-} _RenameRequest_default_instance_;
-class RemoveRequestDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<RemoveRequest>
-      _instance;
-} _RemoveRequest_default_instance_;
-class ReplyDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<Reply>
-      _instance;
-} _Reply_default_instance_;
-class RequestDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<Request>
-      _instance;
-} _Request_default_instance_;
+PROTOBUF_CONSTEXPR DriveList_Item::DriveList_Item(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DriveList_ItemDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DriveList_ItemDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DriveList_ItemDefaultTypeInternal() {}
+  union {
+    DriveList_Item _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DriveList_ItemDefaultTypeInternal _DriveList_Item_default_instance_;
+PROTOBUF_CONSTEXPR DriveList::DriveList(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.item_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DriveListDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DriveListDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DriveListDefaultTypeInternal() {}
+  union {
+    DriveList _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DriveListDefaultTypeInternal _DriveList_default_instance_;
+PROTOBUF_CONSTEXPR DriveListRequest::DriveListRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.dummy_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DriveListRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DriveListRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DriveListRequestDefaultTypeInternal() {}
+  union {
+    DriveListRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DriveListRequestDefaultTypeInternal _DriveListRequest_default_instance_;
+PROTOBUF_CONSTEXPR FileList_Item::FileList_Item(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.size_)*/uint64_t{0u}
+  , /*decltype(_impl_.modification_time_)*/int64_t{0}
+  , /*decltype(_impl_.is_directory_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct FileList_ItemDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FileList_ItemDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FileList_ItemDefaultTypeInternal() {}
+  union {
+    FileList_Item _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FileList_ItemDefaultTypeInternal _FileList_Item_default_instance_;
+PROTOBUF_CONSTEXPR FileList::FileList(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.item_)*/{}
+  , /*decltype(_impl_.continuation_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.modification_time_)*/int64_t{0}
+  , /*decltype(_impl_.not_modified_)*/false
+  , /*decltype(_impl_.truncated_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct FileListDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FileListDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FileListDefaultTypeInternal() {}
+  union {
+    FileList _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FileListDefaultTypeInternal _FileList_default_instance_;
+PROTOBUF_CONSTEXPR FileListRequest::FileListRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.continuation_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.max_items_)*/0u
+  , /*decltype(_impl_.recursive_)*/false
+  , /*decltype(_impl_.single_part_)*/false
+  , /*decltype(_impl_.modification_time_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct FileListRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FileListRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FileListRequestDefaultTypeInternal() {}
+  union {
+    FileListRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FileListRequestDefaultTypeInternal _FileListRequest_default_instance_;
+PROTOBUF_CONSTEXPR PartialFile::PartialFile(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.last_block_hash_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.size_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PartialFileDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PartialFileDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PartialFileDefaultTypeInternal() {}
+  union {
+    PartialFile _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PartialFileDefaultTypeInternal _PartialFile_default_instance_;
+PROTOBUF_CONSTEXPR FileSignature::FileSignature(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.weak_hashes_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.strong_hashes_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.block_size_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct FileSignatureDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FileSignatureDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FileSignatureDefaultTypeInternal() {}
+  union {
+    FileSignature _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FileSignatureDefaultTypeInternal _FileSignature_default_instance_;
+PROTOBUF_CONSTEXPR BlockCopy::BlockCopy(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.block_index_)*/uint64_t{0u}
+  , /*decltype(_impl_.data_offset_)*/0u
+  , /*decltype(_impl_.block_count_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BlockCopyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BlockCopyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BlockCopyDefaultTypeInternal() {}
+  union {
+    BlockCopy _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BlockCopyDefaultTypeInternal _BlockCopy_default_instance_;
+PROTOBUF_CONSTEXPR ZeroRange::ZeroRange(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.size_)*/uint64_t{0u}
+  , /*decltype(_impl_.data_offset_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ZeroRangeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ZeroRangeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ZeroRangeDefaultTypeInternal() {}
+  union {
+    ZeroRange _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ZeroRangeDefaultTypeInternal _ZeroRange_default_instance_;
+PROTOBUF_CONSTEXPR UploadRequest::UploadRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.packet_)*/nullptr
+  , /*decltype(_impl_.overwrite_)*/false
+  , /*decltype(_impl_.resume_)*/false
+  , /*decltype(_impl_.delta_)*/false
+  , /*decltype(_impl_.archive_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct UploadRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UploadRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UploadRequestDefaultTypeInternal() {}
+  union {
+    UploadRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UploadRequestDefaultTypeInternal _UploadRequest_default_instance_;
+PROTOBUF_CONSTEXPR DownloadRequest::DownloadRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.packet_size_)*/0u
+  , /*decltype(_impl_.compression_)*/0
+  , /*decltype(_impl_.archive_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DownloadRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DownloadRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DownloadRequestDefaultTypeInternal() {}
+  union {
+    DownloadRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DownloadRequestDefaultTypeInternal _DownloadRequest_default_instance_;
+PROTOBUF_CONSTEXPR PacketRequest::PacketRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.partial_file_)*/nullptr
+  , /*decltype(_impl_.signature_)*/nullptr
+  , /*decltype(_impl_.dummy_)*/0u
+  , /*decltype(_impl_.packet_size_)*/0u
+  , /*decltype(_impl_.compression_)*/0
+  , /*decltype(_impl_.zero_ranges_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PacketRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PacketRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PacketRequestDefaultTypeInternal() {}
+  union {
+    PacketRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PacketRequestDefaultTypeInternal _PacketRequest_default_instance_;
+PROTOBUF_CONSTEXPR Packet::Packet(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.block_copies_)*/{}
+  , /*decltype(_impl_.zero_ranges_)*/{}
+  , /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.file_hash_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.file_size_)*/uint64_t{0u}
+  , /*decltype(_impl_.flags_)*/0u
+  , /*decltype(_impl_.compression_)*/0
+  , /*decltype(_impl_.offset_)*/uint64_t{0u}
+  , /*decltype(_impl_.copied_size_)*/uint64_t{0u}
+  , /*decltype(_impl_.data_size_)*/0u
+  , /*decltype(_impl_.solid_)*/false
+  , /*decltype(_impl_.zero_size_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PacketDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PacketDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PacketDefaultTypeInternal() {}
+  union {
+    Packet _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PacketDefaultTypeInternal _Packet_default_instance_;
+PROTOBUF_CONSTEXPR CreateDirectoryRequest::CreateDirectoryRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CreateDirectoryRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CreateDirectoryRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CreateDirectoryRequestDefaultTypeInternal() {}
+  union {
+    CreateDirectoryRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CreateDirectoryRequestDefaultTypeInternal _CreateDirectoryRequest_default_instance_;
+PROTOBUF_CONSTEXPR RenameRequest::RenameRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.old_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.new_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RenameRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RenameRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RenameRequestDefaultTypeInternal() {}
+  union {
+    RenameRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RenameRequestDefaultTypeInternal _RenameRequest_default_instance_;
+PROTOBUF_CONSTEXPR RemoveRequest::RemoveRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.recursive_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RemoveRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RemoveRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RemoveRequestDefaultTypeInternal() {}
+  union {
+    RemoveRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RemoveRequestDefaultTypeInternal _RemoveRequest_default_instance_;
+PROTOBUF_CONSTEXPR RemoteCopyRequest::RemoteCopyRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.target_address_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.target_user_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.target_password_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.target_path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.target_port_)*/0u
+  , /*decltype(_impl_.overwrite_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RemoteCopyRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RemoteCopyRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RemoteCopyRequestDefaultTypeInternal() {}
+  union {
+    RemoteCopyRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RemoteCopyRequestDefaultTypeInternal _RemoteCopyRequest_default_instance_;
+PROTOBUF_CONSTEXPR Reply::Reply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.existing_files_)*/{}
+  , /*decltype(_impl_.failed_files_)*/{}
+  , /*decltype(_impl_.error_string_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.drive_list_)*/nullptr
+  , /*decltype(_impl_.file_list_)*/nullptr
+  , /*decltype(_impl_.packet_)*/nullptr
+  , /*decltype(_impl_.partial_file_)*/nullptr
+  , /*decltype(_impl_.signature_)*/nullptr
+  , /*decltype(_impl_.status_)*/0
+  , /*decltype(_impl_.zero_ranges_)*/false
+  , /*decltype(_impl_.request_id_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReplyDefaultTypeInternal() {}
+  union {
+    Reply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReplyDefaultTypeInternal _Reply_default_instance_;
+PROTOBUF_CONSTEXPR Request::Request(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.drive_list_request_)*/nullptr
+  , /*decltype(_impl_.file_list_request_)*/nullptr
+  , /*decltype(_impl_.create_directory_request_)*/nullptr
+  , /*decltype(_impl_.rename_request_)*/nullptr
+  , /*decltype(_impl_.remove_request_)*/nullptr
+  , /*decltype(_impl_.download_request_)*/nullptr
+  , /*decltype(_impl_.upload_request_)*/nullptr
+  , /*decltype(_impl_.packet_request_)*/nullptr
+  , /*decltype(_impl_.packet_)*/nullptr
+  , /*decltype(_impl_.remote_copy_request_)*/nullptr
+  , /*decltype(_impl_.request_id_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RequestDefaultTypeInternal() {}
+  union {
+    Request _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RequestDefaultTypeInternal _Request_default_instance_;
 }  // namespace file_transfer
 }  // namespace proto
 }  // namespace aspia
-namespace protobuf_file_5ftransfer_5fsession_2eproto {
-static void InitDefaultsDriveList_Item() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::file_transfer::_DriveList_Item_default_instance_;
-    new (ptr) ::aspia::proto::file_transfer::DriveList_Item();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::file_transfer::DriveList_Item::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_DriveList_Item =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsDriveList_Item}, {}};
-
-static void InitDefaultsDriveList() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::file_transfer::_DriveList_default_instance_;
-    new (ptr) ::aspia::proto::file_transfer::DriveList();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::file_transfer::DriveList::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<1> scc_info_DriveList =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsDriveList}, {
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_DriveList_Item.base,}};
-
-static void InitDefaultsDriveListRequest() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::file_transfer::_DriveListRequest_default_instance_;
-    new (ptr) ::aspia::proto::file_transfer::DriveListRequest();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::file_transfer::DriveListRequest::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_DriveListRequest =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsDriveListRequest}, {}};
-
-static void InitDefaultsFileList_Item() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::file_transfer::_FileList_Item_default_instance_;
-    new (ptr) ::aspia::proto::file_transfer::FileList_Item();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::file_transfer::FileList_Item::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_FileList_Item =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsFileList_Item}, {}};
-
-static void InitDefaultsFileList() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::file_transfer::_FileList_default_instance_;
-    new (ptr) ::aspia::proto::file_transfer::FileList();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::file_transfer::FileList::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<1> scc_info_FileList =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsFileList}, {
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_FileList_Item.base,}};
-
-static void InitDefaultsFileListRequest() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::file_transfer::_FileListRequest_default_instance_;
-    new (ptr) ::aspia::proto::file_transfer::FileListRequest();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::file_transfer::FileListRequest::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_FileListRequest =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsFileListRequest}, {}};
-
-static void InitDefaultsUploadRequest() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::file_transfer::_UploadRequest_default_instance_;
-    new (ptr) ::aspia::proto::file_transfer::UploadRequest();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::file_transfer::UploadRequest::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_UploadRequest =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsUploadRequest}, {}};
-
-static void InitDefaultsDownloadRequest() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::file_transfer::_DownloadRequest_default_instance_;
-    new (ptr) ::aspia::proto::file_transfer::DownloadRequest();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::file_transfer::DownloadRequest::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_DownloadRequest =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsDownloadRequest}, {}};
-
-static void InitDefaultsPacketRequest() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::file_transfer::_PacketRequest_default_instance_;
-    new (ptr) ::aspia::proto::file_transfer::PacketRequest();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::file_transfer::PacketRequest::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_PacketRequest =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsPacketRequest}, {}};
-
-static void InitDefaultsPacket() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::file_transfer::_Packet_default_instance_;
-    new (ptr) ::aspia::proto::file_transfer::Packet();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::file_transfer::Packet::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_Packet =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsPacket}, {}};
-
-static void InitDefaultsCreateDirectoryRequest() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::file_transfer::_CreateDirectoryRequest_default_instance_;
-    new (ptr) ::aspia::proto::file_transfer::CreateDirectoryRequest();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::file_transfer::CreateDirectoryRequest::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_CreateDirectoryRequest =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsCreateDirectoryRequest}, {}};
-
-static void InitDefaultsRenameRequest() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::file_transfer::_RenameRequest_default_instance_;
-    new (ptr) ::aspia::proto::file_transfer::RenameRequest();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::file_transfer::RenameRequest::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_RenameRequest =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsRenameRequest}, {}};
-
-static void InitDefaultsRemoveRequest() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::file_transfer::_RemoveRequest_default_instance_;
-    new (ptr) ::aspia::proto::file_transfer::RemoveRequest();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::file_transfer::RemoveRequest::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_RemoveRequest =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsRemoveRequest}, {}};
-
-static void InitDefaultsReply() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::file_transfer::_Reply_default_instance_;
-    new (ptr) ::aspia::proto::file_transfer::Reply();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::file_transfer::Reply::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<3> scc_info_Reply =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 3, InitDefaultsReply}, {
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_DriveList.base,
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_FileList.base,
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_Packet.base,}};
-
-static void InitDefaultsRequest() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::file_transfer::_Request_default_instance_;
-    new (ptr) ::aspia::proto::file_transfer::Request();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::file_transfer::Request::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<9> scc_info_Request =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 9, InitDefaultsRequest}, {
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_DriveListRequest.base,
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_FileListRequest.base,
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_CreateDirectoryRequest.base,
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_RenameRequest.base,
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_RemoveRequest.base,
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_DownloadRequest.base,
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_UploadRequest.base,
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_PacketRequest.base,
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_Packet.base,}};
-
-void InitDefaults() {
-  ::google::protobuf::internal::InitSCC(&scc_info_DriveList_Item.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_DriveList.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_DriveListRequest.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_FileList_Item.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_FileList.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_FileListRequest.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_UploadRequest.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_DownloadRequest.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_PacketRequest.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_Packet.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_CreateDirectoryRequest.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_RenameRequest.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_RemoveRequest.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_Reply.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_Request.base);
-}
-
-}  // namespace protobuf_file_5ftransfer_5fsession_2eproto
 namespace aspia {
 namespace proto {
 namespace file_transfer {
@@ -375,19 +373,78 @@ bool DriveList_Item_Type_IsValid(int value) {
   }
 }
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const DriveList_Item_Type DriveList_Item::TYPE_UNKNOWN;
-const DriveList_Item_Type DriveList_Item::TYPE_CDROM;
-const DriveList_Item_Type DriveList_Item::TYPE_REMOVABLE;
-const DriveList_Item_Type DriveList_Item::TYPE_FIXED;
-const DriveList_Item_Type DriveList_Item::TYPE_REMOTE;
-const DriveList_Item_Type DriveList_Item::TYPE_RAM;
-const DriveList_Item_Type DriveList_Item::TYPE_HOME_FOLDER;
-const DriveList_Item_Type DriveList_Item::TYPE_DESKTOP_FOLDER;
-const DriveList_Item_Type DriveList_Item::Type_MIN;
-const DriveList_Item_Type DriveList_Item::Type_MAX;
-const int DriveList_Item::Type_ARRAYSIZE;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+static ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> DriveList_Item_Type_strings[8] = {};
+
+static const char DriveList_Item_Type_names[] =
+  "TYPE_CDROM"
+  "TYPE_DESKTOP_FOLDER"
+  "TYPE_FIXED"
+  "TYPE_HOME_FOLDER"
+  "TYPE_RAM"
+  "TYPE_REMOTE"
+  "TYPE_REMOVABLE"
+  "TYPE_UNKNOWN";
+
+static const ::PROTOBUF_NAMESPACE_ID::internal::EnumEntry DriveList_Item_Type_entries[] = {
+  { {DriveList_Item_Type_names + 0, 10}, 1 },
+  { {DriveList_Item_Type_names + 10, 19}, 7 },
+  { {DriveList_Item_Type_names + 29, 10}, 3 },
+  { {DriveList_Item_Type_names + 39, 16}, 6 },
+  { {DriveList_Item_Type_names + 55, 8}, 5 },
+  { {DriveList_Item_Type_names + 63, 11}, 4 },
+  { {DriveList_Item_Type_names + 74, 14}, 2 },
+  { {DriveList_Item_Type_names + 88, 12}, 0 },
+};
+
+static const int DriveList_Item_Type_entries_by_number[] = {
+  7, // 0 -> TYPE_UNKNOWN
+  0, // 1 -> TYPE_CDROM
+  6, // 2 -> TYPE_REMOVABLE
+  2, // 3 -> TYPE_FIXED
+  5, // 4 -> TYPE_REMOTE
+  4, // 5 -> TYPE_RAM
+  3, // 6 -> TYPE_HOME_FOLDER
+  1, // 7 -> TYPE_DESKTOP_FOLDER
+};
+
+const std::string& DriveList_Item_Type_Name(
+    DriveList_Item_Type value) {
+  static const bool dummy =
+      ::PROTOBUF_NAMESPACE_ID::internal::InitializeEnumStrings(
+          DriveList_Item_Type_entries,
+          DriveList_Item_Type_entries_by_number,
+          8, DriveList_Item_Type_strings);
+  (void) dummy;
+  int idx = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumName(
+      DriveList_Item_Type_entries,
+      DriveList_Item_Type_entries_by_number,
+      8, value);
+  return idx == -1 ? ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString() :
+                     DriveList_Item_Type_strings[idx].get();
+}
+bool DriveList_Item_Type_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, DriveList_Item_Type* value) {
+  int int_value;
+  bool success = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumValue(
+      DriveList_Item_Type_entries, 8, name, &int_value);
+  if (success) {
+    *value = static_cast<DriveList_Item_Type>(int_value);
+  }
+  return success;
+}
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr DriveList_Item_Type DriveList_Item::TYPE_UNKNOWN;
+constexpr DriveList_Item_Type DriveList_Item::TYPE_CDROM;
+constexpr DriveList_Item_Type DriveList_Item::TYPE_REMOVABLE;
+constexpr DriveList_Item_Type DriveList_Item::TYPE_FIXED;
+constexpr DriveList_Item_Type DriveList_Item::TYPE_REMOTE;
+constexpr DriveList_Item_Type DriveList_Item::TYPE_RAM;
+constexpr DriveList_Item_Type DriveList_Item::TYPE_HOME_FOLDER;
+constexpr DriveList_Item_Type DriveList_Item::TYPE_DESKTOP_FOLDER;
+constexpr DriveList_Item_Type DriveList_Item::Type_MIN;
+constexpr DriveList_Item_Type DriveList_Item::Type_MAX;
+constexpr int DriveList_Item::Type_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 bool Packet_Flags_IsValid(int value) {
   switch (value) {
     case 0:
@@ -400,15 +457,62 @@ bool Packet_Flags_IsValid(int value) {
   }
 }
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const Packet_Flags Packet::FLAG_ERROR;
-const Packet_Flags Packet::FLAG_PACKET;
-const Packet_Flags Packet::FLAG_FIRST_PACKET;
-const Packet_Flags Packet::FLAG_LAST_PACKET;
-const Packet_Flags Packet::Flags_MIN;
-const Packet_Flags Packet::Flags_MAX;
-const int Packet::Flags_ARRAYSIZE;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+static ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> Packet_Flags_strings[4] = {};
+
+static const char Packet_Flags_names[] =
+  "FLAG_ERROR"
+  "FLAG_FIRST_PACKET"
+  "FLAG_LAST_PACKET"
+  "FLAG_PACKET";
+
+static const ::PROTOBUF_NAMESPACE_ID::internal::EnumEntry Packet_Flags_entries[] = {
+  { {Packet_Flags_names + 0, 10}, 0 },
+  { {Packet_Flags_names + 10, 17}, 2 },
+  { {Packet_Flags_names + 27, 16}, 4 },
+  { {Packet_Flags_names + 43, 11}, 1 },
+};
+
+static const int Packet_Flags_entries_by_number[] = {
+  0, // 0 -> FLAG_ERROR
+  3, // 1 -> FLAG_PACKET
+  1, // 2 -> FLAG_FIRST_PACKET
+  2, // 4 -> FLAG_LAST_PACKET
+};
+
+const std::string& Packet_Flags_Name(
+    Packet_Flags value) {
+  static const bool dummy =
+      ::PROTOBUF_NAMESPACE_ID::internal::InitializeEnumStrings(
+          Packet_Flags_entries,
+          Packet_Flags_entries_by_number,
+          4, Packet_Flags_strings);
+  (void) dummy;
+  int idx = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumName(
+      Packet_Flags_entries,
+      Packet_Flags_entries_by_number,
+      4, value);
+  return idx == -1 ? ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString() :
+                     Packet_Flags_strings[idx].get();
+}
+bool Packet_Flags_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Packet_Flags* value) {
+  int int_value;
+  bool success = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumValue(
+      Packet_Flags_entries, 4, name, &int_value);
+  if (success) {
+    *value = static_cast<Packet_Flags>(int_value);
+  }
+  return success;
+}
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Packet_Flags Packet::FLAG_ERROR;
+constexpr Packet_Flags Packet::FLAG_PACKET;
+constexpr Packet_Flags Packet::FLAG_FIRST_PACKET;
+constexpr Packet_Flags Packet::FLAG_LAST_PACKET;
+constexpr Packet_Flags Packet::Flags_MIN;
+constexpr Packet_Flags Packet::Flags_MAX;
+constexpr int Packet::Flags_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 bool Status_IsValid(int value) {
   switch (value) {
     case 0:
@@ -425,212 +529,354 @@ bool Status_IsValid(int value) {
     case 11:
     case 12:
     case 13:
+    case 14:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> Status_strings[15] = {};
+
+static const char Status_names[] =
+  "STATUS_ACCESS_DENIED"
+  "STATUS_CANCELED"
+  "STATUS_DISK_FULL"
+  "STATUS_FILE_CREATE_ERROR"
+  "STATUS_FILE_OPEN_ERROR"
+  "STATUS_FILE_READ_ERROR"
+  "STATUS_FILE_WRITE_ERROR"
+  "STATUS_INVALID_PATH_NAME"
+  "STATUS_INVALID_REQUEST"
+  "STATUS_NO_DRIVES_FOUND"
+  "STATUS_NO_LOGGED_ON_USER"
+  "STATUS_PATH_ALREADY_EXISTS"
+  "STATUS_PATH_NOT_FOUND"
+  "STATUS_SUCCESS"
+  "STATUS_UNKNOWN";
+
+static const ::PROTOBUF_NAMESPACE_ID::internal::EnumEntry Status_entries[] = {
+  { {Status_names + 0, 20}, 9 },
+  { {Status_names + 20, 15}, 14 },
+  { {Status_names + 35, 16}, 8 },
+  { {Status_names + 51, 24}, 11 },
+  { {Status_names + 75, 22}, 10 },
+  { {Status_names + 97, 22}, 13 },
+  { {Status_names + 119, 23}, 12 },
+  { {Status_names + 142, 24}, 4 },
+  { {Status_names + 166, 22}, 3 },
+  { {Status_names + 188, 22}, 7 },
+  { {Status_names + 210, 24}, 2 },
+  { {Status_names + 234, 26}, 6 },
+  { {Status_names + 260, 21}, 5 },
+  { {Status_names + 281, 14}, 1 },
+  { {Status_names + 295, 14}, 0 },
+};
+
+static const int Status_entries_by_number[] = {
+  14, // 0 -> STATUS_UNKNOWN
+  13, // 1 -> STATUS_SUCCESS
+  10, // 2 -> STATUS_NO_LOGGED_ON_USER
+  8, // 3 -> STATUS_INVALID_REQUEST
+  7, // 4 -> STATUS_INVALID_PATH_NAME
+  12, // 5 -> STATUS_PATH_NOT_FOUND
+  11, // 6 -> STATUS_PATH_ALREADY_EXISTS
+  9, // 7 -> STATUS_NO_DRIVES_FOUND
+  2, // 8 -> STATUS_DISK_FULL
+  0, // 9 -> STATUS_ACCESS_DENIED
+  4, // 10 -> STATUS_FILE_OPEN_ERROR
+  3, // 11 -> STATUS_FILE_CREATE_ERROR
+  6, // 12 -> STATUS_FILE_WRITE_ERROR
+  5, // 13 -> STATUS_FILE_READ_ERROR
+  1, // 14 -> STATUS_CANCELED
+};
+
+const std::string& Status_Name(
+    Status value) {
+  static const bool dummy =
+      ::PROTOBUF_NAMESPACE_ID::internal::InitializeEnumStrings(
+          Status_entries,
+          Status_entries_by_number,
+          15, Status_strings);
+  (void) dummy;
+  int idx = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumName(
+      Status_entries,
+      Status_entries_by_number,
+      15, value);
+  return idx == -1 ? ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString() :
+                     Status_strings[idx].get();
+}
+bool Status_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Status* value) {
+  int int_value;
+  bool success = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumValue(
+      Status_entries, 15, name, &int_value);
+  if (success) {
+    *value = static_cast<Status>(int_value);
+  }
+  return success;
+}
+bool PacketCompression_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
       return true;
     default:
       return false;
   }
 }
 
+static ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> PacketCompression_strings[3] = {};
+
+static const char PacketCompression_names[] =
+  "PACKET_COMPRESSION_LZ4"
+  "PACKET_COMPRESSION_NONE"
+  "PACKET_COMPRESSION_ZSTD";
+
+static const ::PROTOBUF_NAMESPACE_ID::internal::EnumEntry PacketCompression_entries[] = {
+  { {PacketCompression_names + 0, 22}, 1 },
+  { {PacketCompression_names + 22, 23}, 0 },
+  { {PacketCompression_names + 45, 23}, 2 },
+};
+
+static const int PacketCompression_entries_by_number[] = {
+  1, // 0 -> PACKET_COMPRESSION_NONE
+  0, // 1 -> PACKET_COMPRESSION_LZ4
+  2, // 2 -> PACKET_COMPRESSION_ZSTD
+};
+
+const std::string& PacketCompression_Name(
+    PacketCompression value) {
+  static const bool dummy =
+      ::PROTOBUF_NAMESPACE_ID::internal::InitializeEnumStrings(
+          PacketCompression_entries,
+          PacketCompression_entries_by_number,
+          3, PacketCompression_strings);
+  (void) dummy;
+  int idx = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumName(
+      PacketCompression_entries,
+      PacketCompression_entries_by_number,
+      3, value);
+  return idx == -1 ? ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString() :
+                     PacketCompression_strings[idx].get();
+}
+bool PacketCompression_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, PacketCompression* value) {
+  int int_value;
+  bool success = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumValue(
+      PacketCompression_entries, 3, name, &int_value);
+  if (success) {
+    *value = static_cast<PacketCompression>(int_value);
+  }
+  return success;
+}
 
 // ===================================================================
 
-void DriveList_Item::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int DriveList_Item::kTypeFieldNumber;
-const int DriveList_Item::kPathFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class DriveList_Item::_Internal {
+ public:
+};
 
-DriveList_Item::DriveList_Item()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_DriveList_Item.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.DriveList.Item)
+DriveList_Item::DriveList_Item(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.file_transfer.DriveList.Item)
 }
 DriveList_Item::DriveList_Item(const DriveList_Item& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.path().size() > 0) {
-    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
-  }
-  type_ = from.type_;
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  DriveList_Item* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.path_){}
+    , decltype(_impl_.type_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_path().empty()) {
+    _this->_impl_.path_.Set(from._internal_path(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.type_ = from._impl_.type_;
   // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.DriveList.Item)
 }
 
-void DriveList_Item::SharedCtor() {
-  path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  type_ = 0;
+inline void DriveList_Item::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.path_){}
+    , decltype(_impl_.type_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 DriveList_Item::~DriveList_Item() {
   // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.DriveList.Item)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void DriveList_Item::SharedDtor() {
-  path_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void DriveList_Item::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.path_.Destroy();
 }
 
 void DriveList_Item::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const DriveList_Item& DriveList_Item::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_DriveList_Item.base);
-  return *internal_default_instance();
-}
-
 
 void DriveList_Item::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.DriveList.Item)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  type_ = 0;
-  _internal_metadata_.Clear();
-}
-
-bool DriveList_Item::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.DriveList.Item)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // .aspia.proto.file_transfer.DriveList.Item.Type type = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_type(static_cast< ::aspia::proto::file_transfer::DriveList_Item_Type >(value));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+  _impl_.path_.ClearToEmpty();
+  _impl_.type_ = 0;
+  _internal_metadata_.Clear<std::string>();
+}
 
+const char* DriveList_Item::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .aspia.proto.file_transfer.DriveList.Item.Type type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_type(static_cast<::aspia::proto::file_transfer::DriveList_Item_Type>(val));
+        } else
+          goto handle_unusual;
+        continue;
       // string path = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_path()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->path().data(), static_cast<int>(this->path().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "aspia.proto.file_transfer.DriveList.Item.path"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.DriveList.Item)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.DriveList.Item)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void DriveList_Item::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.DriveList.Item)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* DriveList_Item::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.file_transfer.DriveList.Item)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .aspia.proto.file_transfer.DriveList.Item.Type type = 1;
-  if (this->type() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->type(), output);
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
   }
 
   // string path = 2;
-  if (this->path().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->path().data(), static_cast<int>(this->path().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_path().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_path().data(), static_cast<int>(this->_internal_path().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "aspia.proto.file_transfer.DriveList.Item.path");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->path(), output);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_path(), target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.DriveList.Item)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.file_transfer.DriveList.Item)
+  return target;
 }
 
 size_t DriveList_Item::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.DriveList.Item)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // string path = 2;
-  if (this->path().size() > 0) {
+  if (!this->_internal_path().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->path());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_path());
   }
 
   // .aspia.proto.file_transfer.DriveList.Item.Type type = 1;
-  if (this->type() != 0) {
+  if (this->_internal_type() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void DriveList_Item::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const DriveList_Item*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const DriveList_Item*>(
+      &from));
 }
 
 void DriveList_Item::MergeFrom(const DriveList_Item& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.DriveList.Item)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  DriveList_Item* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.DriveList.Item)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.path().size() > 0) {
-
-    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
+  if (!from._internal_path().empty()) {
+    _this->_internal_set_path(from._internal_path());
   }
-  if (from.type() != 0) {
-    set_type(from.type());
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void DriveList_Item::CopyFrom(const DriveList_Item& from) {
@@ -644,179 +890,186 @@ bool DriveList_Item::IsInitialized() const {
   return true;
 }
 
-void DriveList_Item::Swap(DriveList_Item* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void DriveList_Item::InternalSwap(DriveList_Item* other) {
   using std::swap;
-  path_.Swap(&other->path_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(type_, other->type_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.path_, lhs_arena,
+      &other->_impl_.path_, rhs_arena
+  );
+  swap(_impl_.type_, other->_impl_.type_);
 }
 
-::std::string DriveList_Item::GetTypeName() const {
+std::string DriveList_Item::GetTypeName() const {
   return "aspia.proto.file_transfer.DriveList.Item";
 }
 
 
 // ===================================================================
 
-void DriveList::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int DriveList::kItemFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class DriveList::_Internal {
+ public:
+};
 
-DriveList::DriveList()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_DriveList.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.DriveList)
+DriveList::DriveList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.file_transfer.DriveList)
 }
 DriveList::DriveList(const DriveList& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL),
-      item_(from.item_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  DriveList* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.item_){from._impl_.item_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.DriveList)
 }
 
-void DriveList::SharedCtor() {
+inline void DriveList::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.item_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 DriveList::~DriveList() {
   // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.DriveList)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void DriveList::SharedDtor() {
+inline void DriveList::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.item_.~RepeatedPtrField();
 }
 
 void DriveList::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const DriveList& DriveList::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_DriveList.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void DriveList::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.DriveList)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  item_.Clear();
-  _internal_metadata_.Clear();
-}
-
-bool DriveList::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.DriveList)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.item_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* DriveList::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // repeated .aspia.proto.file_transfer.DriveList.Item item = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-                input, add_item()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_item(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.DriveList)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.DriveList)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void DriveList::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.DriveList)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* DriveList::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.file_transfer.DriveList)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // repeated .aspia.proto.file_transfer.DriveList.Item item = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->item_size()); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      1,
-      this->item(static_cast<int>(i)),
-      output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_item_size()); i < n; i++) {
+    const auto& repfield = this->_internal_item(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.DriveList)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.file_transfer.DriveList)
+  return target;
 }
 
 size_t DriveList::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.DriveList)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // repeated .aspia.proto.file_transfer.DriveList.Item item = 1;
-  {
-    unsigned int count = static_cast<unsigned int>(this->item_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          this->item(static_cast<int>(i)));
-    }
+  total_size += 1UL * this->_internal_item_size();
+  for (const auto& msg : this->_impl_.item_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void DriveList::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const DriveList*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const DriveList*>(
+      &from));
 }
 
 void DriveList::MergeFrom(const DriveList& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.DriveList)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  DriveList* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.DriveList)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  item_.MergeFrom(from.item_);
+  _this->_impl_.item_.MergeFrom(from._impl_.item_);
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void DriveList::CopyFrom(const DriveList& from) {
@@ -830,174 +1083,173 @@ bool DriveList::IsInitialized() const {
   return true;
 }
 
-void DriveList::Swap(DriveList* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void DriveList::InternalSwap(DriveList* other) {
   using std::swap;
-  CastToBase(&item_)->InternalSwap(CastToBase(&other->item_));
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.item_.InternalSwap(&other->_impl_.item_);
 }
 
-::std::string DriveList::GetTypeName() const {
+std::string DriveList::GetTypeName() const {
   return "aspia.proto.file_transfer.DriveList";
 }
 
 
 // ===================================================================
 
-void DriveListRequest::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int DriveListRequest::kDummyFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class DriveListRequest::_Internal {
+ public:
+};
 
-DriveListRequest::DriveListRequest()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_DriveListRequest.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.DriveListRequest)
+DriveListRequest::DriveListRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.file_transfer.DriveListRequest)
 }
 DriveListRequest::DriveListRequest(const DriveListRequest& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  dummy_ = from.dummy_;
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  DriveListRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.dummy_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _this->_impl_.dummy_ = from._impl_.dummy_;
   // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.DriveListRequest)
 }
 
-void DriveListRequest::SharedCtor() {
-  dummy_ = 0u;
+inline void DriveListRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.dummy_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 DriveListRequest::~DriveListRequest() {
   // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.DriveListRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void DriveListRequest::SharedDtor() {
+inline void DriveListRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void DriveListRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const DriveListRequest& DriveListRequest::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_DriveListRequest.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void DriveListRequest::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.DriveListRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  dummy_ = 0u;
-  _internal_metadata_.Clear();
-}
-
-bool DriveListRequest::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.DriveListRequest)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.dummy_ = 0u;
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* DriveListRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // uint32 dummy = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &dummy_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.dummy_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.DriveListRequest)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.DriveListRequest)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void DriveListRequest::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.DriveListRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* DriveListRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.file_transfer.DriveListRequest)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // uint32 dummy = 1;
-  if (this->dummy() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->dummy(), output);
+  if (this->_internal_dummy() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_dummy(), target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.DriveListRequest)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.file_transfer.DriveListRequest)
+  return target;
 }
 
 size_t DriveListRequest::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.DriveListRequest)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // uint32 dummy = 1;
-  if (this->dummy() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->dummy());
+  if (this->_internal_dummy() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_dummy());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void DriveListRequest::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const DriveListRequest*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const DriveListRequest*>(
+      &from));
 }
 
 void DriveListRequest::MergeFrom(const DriveListRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.DriveListRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  DriveListRequest* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.DriveListRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.dummy() != 0) {
-    set_dummy(from.dummy());
+  if (from._internal_dummy() != 0) {
+    _this->_internal_set_dummy(from._internal_dummy());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void DriveListRequest::CopyFrom(const DriveListRequest& from) {
@@ -1011,283 +1263,271 @@ bool DriveListRequest::IsInitialized() const {
   return true;
 }
 
-void DriveListRequest::Swap(DriveListRequest* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void DriveListRequest::InternalSwap(DriveListRequest* other) {
   using std::swap;
-  swap(dummy_, other->dummy_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.dummy_, other->_impl_.dummy_);
 }
 
-::std::string DriveListRequest::GetTypeName() const {
+std::string DriveListRequest::GetTypeName() const {
   return "aspia.proto.file_transfer.DriveListRequest";
 }
 
 
 // ===================================================================
 
-void FileList_Item::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int FileList_Item::kNameFieldNumber;
-const int FileList_Item::kSizeFieldNumber;
-const int FileList_Item::kModificationTimeFieldNumber;
-const int FileList_Item::kIsDirectoryFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class FileList_Item::_Internal {
+ public:
+};
 
-FileList_Item::FileList_Item()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_FileList_Item.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.FileList.Item)
+FileList_Item::FileList_Item(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.file_transfer.FileList.Item)
 }
 FileList_Item::FileList_Item(const FileList_Item& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.name().size() > 0) {
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
-  }
-  ::memcpy(&size_, &from.size_,
-    static_cast<size_t>(reinterpret_cast<char*>(&is_directory_) -
-    reinterpret_cast<char*>(&size_)) + sizeof(is_directory_));
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  FileList_Item* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.size_){}
+    , decltype(_impl_.modification_time_){}
+    , decltype(_impl_.is_directory_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.size_, &from._impl_.size_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.is_directory_) -
+    reinterpret_cast<char*>(&_impl_.size_)) + sizeof(_impl_.is_directory_));
   // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.FileList.Item)
 }
 
-void FileList_Item::SharedCtor() {
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&size_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&is_directory_) -
-      reinterpret_cast<char*>(&size_)) + sizeof(is_directory_));
+inline void FileList_Item::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.size_){uint64_t{0u}}
+    , decltype(_impl_.modification_time_){int64_t{0}}
+    , decltype(_impl_.is_directory_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 FileList_Item::~FileList_Item() {
   // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.FileList.Item)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void FileList_Item::SharedDtor() {
-  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void FileList_Item::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
 }
 
 void FileList_Item::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const FileList_Item& FileList_Item::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_FileList_Item.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void FileList_Item::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.FileList.Item)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&size_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&is_directory_) -
-      reinterpret_cast<char*>(&size_)) + sizeof(is_directory_));
-  _internal_metadata_.Clear();
-}
-
-bool FileList_Item::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.FileList.Item)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // string name = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->name().data(), static_cast<int>(this->name().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "aspia.proto.file_transfer.FileList.Item.name"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+  _impl_.name_.ClearToEmpty();
+  ::memset(&_impl_.size_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.is_directory_) -
+      reinterpret_cast<char*>(&_impl_.size_)) + sizeof(_impl_.is_directory_));
+  _internal_metadata_.Clear<std::string>();
+}
 
+const char* FileList_Item::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
+        } else
+          goto handle_unusual;
+        continue;
       // uint64 size = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &size_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // int64 modification_time = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &modification_time_)));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.modification_time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // bool is_directory = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &is_directory_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.is_directory_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.FileList.Item)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.FileList.Item)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void FileList_Item::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.FileList.Item)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* FileList_Item::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.file_transfer.FileList.Item)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string name = 1;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), static_cast<int>(this->name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "aspia.proto.file_transfer.FileList.Item.name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->name(), output);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
 
   // uint64 size = 2;
-  if (this->size() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->size(), output);
+  if (this->_internal_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_size(), target);
   }
 
   // int64 modification_time = 3;
-  if (this->modification_time() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(3, this->modification_time(), output);
+  if (this->_internal_modification_time() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_modification_time(), target);
   }
 
   // bool is_directory = 4;
-  if (this->is_directory() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(4, this->is_directory(), output);
+  if (this->_internal_is_directory() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_is_directory(), target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.FileList.Item)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.file_transfer.FileList.Item)
+  return target;
 }
 
 size_t FileList_Item::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.FileList.Item)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // string name = 1;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->name());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
 
   // uint64 size = 2;
-  if (this->size() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->size());
+  if (this->_internal_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_size());
   }
 
   // int64 modification_time = 3;
-  if (this->modification_time() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int64Size(
-        this->modification_time());
+  if (this->_internal_modification_time() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_modification_time());
   }
 
   // bool is_directory = 4;
-  if (this->is_directory() != 0) {
+  if (this->_internal_is_directory() != 0) {
     total_size += 1 + 1;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void FileList_Item::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const FileList_Item*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const FileList_Item*>(
+      &from));
 }
 
 void FileList_Item::MergeFrom(const FileList_Item& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.FileList.Item)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  FileList_Item* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.FileList.Item)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.name().size() > 0) {
-
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
-  if (from.size() != 0) {
-    set_size(from.size());
+  if (from._internal_size() != 0) {
+    _this->_internal_set_size(from._internal_size());
   }
-  if (from.modification_time() != 0) {
-    set_modification_time(from.modification_time());
+  if (from._internal_modification_time() != 0) {
+    _this->_internal_set_modification_time(from._internal_modification_time());
   }
-  if (from.is_directory() != 0) {
-    set_is_directory(from.is_directory());
+  if (from._internal_is_directory() != 0) {
+    _this->_internal_set_is_directory(from._internal_is_directory());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void FileList_Item::CopyFrom(const FileList_Item& from) {
@@ -1301,181 +1541,293 @@ bool FileList_Item::IsInitialized() const {
   return true;
 }
 
-void FileList_Item::Swap(FileList_Item* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void FileList_Item::InternalSwap(FileList_Item* other) {
   using std::swap;
-  name_.Swap(&other->name_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(size_, other->size_);
-  swap(modification_time_, other->modification_time_);
-  swap(is_directory_, other->is_directory_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-}
-
-::std::string FileList_Item::GetTypeName() const {
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(FileList_Item, _impl_.is_directory_)
+      + sizeof(FileList_Item::_impl_.is_directory_)
+      - PROTOBUF_FIELD_OFFSET(FileList_Item, _impl_.size_)>(
+          reinterpret_cast<char*>(&_impl_.size_),
+          reinterpret_cast<char*>(&other->_impl_.size_));
+}
+
+std::string FileList_Item::GetTypeName() const {
   return "aspia.proto.file_transfer.FileList.Item";
 }
 
 
 // ===================================================================
 
-void FileList::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int FileList::kItemFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class FileList::_Internal {
+ public:
+};
 
-FileList::FileList()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_FileList.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.FileList)
+FileList::FileList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.file_transfer.FileList)
 }
 FileList::FileList(const FileList& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL),
-      item_(from.item_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  FileList* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.item_){from._impl_.item_}
+    , decltype(_impl_.continuation_id_){}
+    , decltype(_impl_.modification_time_){}
+    , decltype(_impl_.not_modified_){}
+    , decltype(_impl_.truncated_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::memcpy(&_impl_.continuation_id_, &from._impl_.continuation_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.truncated_) -
+    reinterpret_cast<char*>(&_impl_.continuation_id_)) + sizeof(_impl_.truncated_));
   // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.FileList)
 }
 
-void FileList::SharedCtor() {
+inline void FileList::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.item_){arena}
+    , decltype(_impl_.continuation_id_){uint64_t{0u}}
+    , decltype(_impl_.modification_time_){int64_t{0}}
+    , decltype(_impl_.not_modified_){false}
+    , decltype(_impl_.truncated_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 FileList::~FileList() {
   // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.FileList)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void FileList::SharedDtor() {
+inline void FileList::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.item_.~RepeatedPtrField();
 }
 
 void FileList::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const FileList& FileList::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_FileList.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void FileList::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.FileList)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  item_.Clear();
-  _internal_metadata_.Clear();
-}
-
-bool FileList::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.FileList)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.item_.Clear();
+  ::memset(&_impl_.continuation_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.truncated_) -
+      reinterpret_cast<char*>(&_impl_.continuation_id_)) + sizeof(_impl_.truncated_));
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* FileList::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // repeated .aspia.proto.file_transfer.FileList.Item item = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-                input, add_item()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_item(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 continuation_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.continuation_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 modification_time = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.modification_time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool not_modified = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.not_modified_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool truncated = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.truncated_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.FileList)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.FileList)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void FileList::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.FileList)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* FileList::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.file_transfer.FileList)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // repeated .aspia.proto.file_transfer.FileList.Item item = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->item_size()); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      1,
-      this->item(static_cast<int>(i)),
-      output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_item_size()); i < n; i++) {
+    const auto& repfield = this->_internal_item(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // uint64 continuation_id = 2;
+  if (this->_internal_continuation_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_continuation_id(), target);
+  }
+
+  // int64 modification_time = 3;
+  if (this->_internal_modification_time() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_modification_time(), target);
+  }
+
+  // bool not_modified = 4;
+  if (this->_internal_not_modified() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_not_modified(), target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.FileList)
+  // bool truncated = 5;
+  if (this->_internal_truncated() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_truncated(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.file_transfer.FileList)
+  return target;
 }
 
 size_t FileList::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.FileList)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // repeated .aspia.proto.file_transfer.FileList.Item item = 1;
-  {
-    unsigned int count = static_cast<unsigned int>(this->item_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          this->item(static_cast<int>(i)));
-    }
+  total_size += 1UL * this->_internal_item_size();
+  for (const auto& msg : this->_impl_.item_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // uint64 continuation_id = 2;
+  if (this->_internal_continuation_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_continuation_id());
+  }
+
+  // int64 modification_time = 3;
+  if (this->_internal_modification_time() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_modification_time());
+  }
+
+  // bool not_modified = 4;
+  if (this->_internal_not_modified() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool truncated = 5;
+  if (this->_internal_truncated() != 0) {
+    total_size += 1 + 1;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void FileList::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const FileList*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const FileList*>(
+      &from));
 }
 
 void FileList::MergeFrom(const FileList& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.FileList)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  FileList* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.FileList)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  item_.MergeFrom(from.item_);
+  _this->_impl_.item_.MergeFrom(from._impl_.item_);
+  if (from._internal_continuation_id() != 0) {
+    _this->_internal_set_continuation_id(from._internal_continuation_id());
+  }
+  if (from._internal_modification_time() != 0) {
+    _this->_internal_set_modification_time(from._internal_modification_time());
+  }
+  if (from._internal_not_modified() != 0) {
+    _this->_internal_set_not_modified(from._internal_not_modified());
+  }
+  if (from._internal_truncated() != 0) {
+    _this->_internal_set_truncated(from._internal_truncated());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void FileList::CopyFrom(const FileList& from) {
@@ -1489,411 +1841,1628 @@ bool FileList::IsInitialized() const {
   return true;
 }
 
-void FileList::Swap(FileList* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void FileList::InternalSwap(FileList* other) {
   using std::swap;
-  CastToBase(&item_)->InternalSwap(CastToBase(&other->item_));
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.item_.InternalSwap(&other->_impl_.item_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(FileList, _impl_.truncated_)
+      + sizeof(FileList::_impl_.truncated_)
+      - PROTOBUF_FIELD_OFFSET(FileList, _impl_.continuation_id_)>(
+          reinterpret_cast<char*>(&_impl_.continuation_id_),
+          reinterpret_cast<char*>(&other->_impl_.continuation_id_));
 }
 
-::std::string FileList::GetTypeName() const {
+std::string FileList::GetTypeName() const {
   return "aspia.proto.file_transfer.FileList";
 }
 
 
 // ===================================================================
 
-void FileListRequest::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int FileListRequest::kPathFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class FileListRequest::_Internal {
+ public:
+};
 
-FileListRequest::FileListRequest()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_FileListRequest.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.FileListRequest)
+FileListRequest::FileListRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.file_transfer.FileListRequest)
 }
 FileListRequest::FileListRequest(const FileListRequest& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.path().size() > 0) {
-    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
-  }
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  FileListRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.path_){}
+    , decltype(_impl_.continuation_id_){}
+    , decltype(_impl_.max_items_){}
+    , decltype(_impl_.recursive_){}
+    , decltype(_impl_.single_part_){}
+    , decltype(_impl_.modification_time_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_path().empty()) {
+    _this->_impl_.path_.Set(from._internal_path(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.continuation_id_, &from._impl_.continuation_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.modification_time_) -
+    reinterpret_cast<char*>(&_impl_.continuation_id_)) + sizeof(_impl_.modification_time_));
   // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.FileListRequest)
 }
 
-void FileListRequest::SharedCtor() {
-  path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void FileListRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.path_){}
+    , decltype(_impl_.continuation_id_){uint64_t{0u}}
+    , decltype(_impl_.max_items_){0u}
+    , decltype(_impl_.recursive_){false}
+    , decltype(_impl_.single_part_){false}
+    , decltype(_impl_.modification_time_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 FileListRequest::~FileListRequest() {
   // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.FileListRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void FileListRequest::SharedDtor() {
-  path_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void FileListRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.path_.Destroy();
 }
 
 void FileListRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const FileListRequest& FileListRequest::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_FileListRequest.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void FileListRequest::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.FileListRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  _internal_metadata_.Clear();
-}
-
-bool FileListRequest::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.FileListRequest)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.path_.ClearToEmpty();
+  ::memset(&_impl_.continuation_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.modification_time_) -
+      reinterpret_cast<char*>(&_impl_.continuation_id_)) + sizeof(_impl_.modification_time_));
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* FileListRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string path = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_path()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->path().data(), static_cast<int>(this->path().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "aspia.proto.file_transfer.FileListRequest.path"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 max_items = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.max_items_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 continuation_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.continuation_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool recursive = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.recursive_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 modification_time = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.modification_time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool single_part = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.single_part_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.FileListRequest)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.FileListRequest)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void FileListRequest::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.FileListRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* FileListRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.file_transfer.FileListRequest)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string path = 1;
-  if (this->path().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->path().data(), static_cast<int>(this->path().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_path().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_path().data(), static_cast<int>(this->_internal_path().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "aspia.proto.file_transfer.FileListRequest.path");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->path(), output);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_path(), target);
+  }
+
+  // uint32 max_items = 2;
+  if (this->_internal_max_items() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_max_items(), target);
+  }
+
+  // uint64 continuation_id = 3;
+  if (this->_internal_continuation_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_continuation_id(), target);
+  }
+
+  // bool recursive = 4;
+  if (this->_internal_recursive() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_recursive(), target);
+  }
+
+  // int64 modification_time = 5;
+  if (this->_internal_modification_time() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(5, this->_internal_modification_time(), target);
+  }
+
+  // bool single_part = 6;
+  if (this->_internal_single_part() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_single_part(), target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.FileListRequest)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.file_transfer.FileListRequest)
+  return target;
 }
 
 size_t FileListRequest::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.FileListRequest)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // string path = 1;
-  if (this->path().size() > 0) {
+  if (!this->_internal_path().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->path());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_path());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  // uint64 continuation_id = 3;
+  if (this->_internal_continuation_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_continuation_id());
+  }
+
+  // uint32 max_items = 2;
+  if (this->_internal_max_items() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_max_items());
+  }
+
+  // bool recursive = 4;
+  if (this->_internal_recursive() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool single_part = 6;
+  if (this->_internal_single_part() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // int64 modification_time = 5;
+  if (this->_internal_modification_time() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_modification_time());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void FileListRequest::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const FileListRequest*>(
+      &from));
+}
+
+void FileListRequest::MergeFrom(const FileListRequest& from) {
+  FileListRequest* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.FileListRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_path().empty()) {
+    _this->_internal_set_path(from._internal_path());
+  }
+  if (from._internal_continuation_id() != 0) {
+    _this->_internal_set_continuation_id(from._internal_continuation_id());
+  }
+  if (from._internal_max_items() != 0) {
+    _this->_internal_set_max_items(from._internal_max_items());
+  }
+  if (from._internal_recursive() != 0) {
+    _this->_internal_set_recursive(from._internal_recursive());
+  }
+  if (from._internal_single_part() != 0) {
+    _this->_internal_set_single_part(from._internal_single_part());
+  }
+  if (from._internal_modification_time() != 0) {
+    _this->_internal_set_modification_time(from._internal_modification_time());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void FileListRequest::CopyFrom(const FileListRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.file_transfer.FileListRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FileListRequest::IsInitialized() const {
+  return true;
+}
+
+void FileListRequest::InternalSwap(FileListRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.path_, lhs_arena,
+      &other->_impl_.path_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(FileListRequest, _impl_.modification_time_)
+      + sizeof(FileListRequest::_impl_.modification_time_)
+      - PROTOBUF_FIELD_OFFSET(FileListRequest, _impl_.continuation_id_)>(
+          reinterpret_cast<char*>(&_impl_.continuation_id_),
+          reinterpret_cast<char*>(&other->_impl_.continuation_id_));
+}
+
+std::string FileListRequest::GetTypeName() const {
+  return "aspia.proto.file_transfer.FileListRequest";
+}
+
+
+// ===================================================================
+
+class PartialFile::_Internal {
+ public:
+};
+
+PartialFile::PartialFile(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.file_transfer.PartialFile)
+}
+PartialFile::PartialFile(const PartialFile& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  PartialFile* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.last_block_hash_){}
+    , decltype(_impl_.size_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.last_block_hash_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.last_block_hash_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_last_block_hash().empty()) {
+    _this->_impl_.last_block_hash_.Set(from._internal_last_block_hash(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.size_ = from._impl_.size_;
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.PartialFile)
+}
+
+inline void PartialFile::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.last_block_hash_){}
+    , decltype(_impl_.size_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.last_block_hash_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.last_block_hash_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PartialFile::~PartialFile() {
+  // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.PartialFile)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PartialFile::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.last_block_hash_.Destroy();
+}
+
+void PartialFile::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PartialFile::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.PartialFile)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.last_block_hash_.ClearToEmpty();
+  _impl_.size_ = uint64_t{0u};
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* PartialFile::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 size = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes last_block_hash = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_last_block_hash();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PartialFile::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.file_transfer.PartialFile)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 size = 1;
+  if (this->_internal_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_size(), target);
+  }
+
+  // bytes last_block_hash = 2;
+  if (!this->_internal_last_block_hash().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_last_block_hash(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.file_transfer.PartialFile)
+  return target;
+}
+
+size_t PartialFile::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.PartialFile)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes last_block_hash = 2;
+  if (!this->_internal_last_block_hash().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_last_block_hash());
+  }
+
+  // uint64 size = 1;
+  if (this->_internal_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_size());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void PartialFile::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const PartialFile*>(
+      &from));
+}
+
+void PartialFile::MergeFrom(const PartialFile& from) {
+  PartialFile* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.PartialFile)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_last_block_hash().empty()) {
+    _this->_internal_set_last_block_hash(from._internal_last_block_hash());
+  }
+  if (from._internal_size() != 0) {
+    _this->_internal_set_size(from._internal_size());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void PartialFile::CopyFrom(const PartialFile& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.file_transfer.PartialFile)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PartialFile::IsInitialized() const {
+  return true;
+}
+
+void PartialFile::InternalSwap(PartialFile* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.last_block_hash_, lhs_arena,
+      &other->_impl_.last_block_hash_, rhs_arena
+  );
+  swap(_impl_.size_, other->_impl_.size_);
+}
+
+std::string PartialFile::GetTypeName() const {
+  return "aspia.proto.file_transfer.PartialFile";
+}
+
+
+// ===================================================================
+
+class FileSignature::_Internal {
+ public:
+};
+
+FileSignature::FileSignature(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.file_transfer.FileSignature)
+}
+FileSignature::FileSignature(const FileSignature& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  FileSignature* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.weak_hashes_){}
+    , decltype(_impl_.strong_hashes_){}
+    , decltype(_impl_.block_size_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.weak_hashes_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.weak_hashes_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_weak_hashes().empty()) {
+    _this->_impl_.weak_hashes_.Set(from._internal_weak_hashes(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.strong_hashes_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.strong_hashes_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_strong_hashes().empty()) {
+    _this->_impl_.strong_hashes_.Set(from._internal_strong_hashes(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.block_size_ = from._impl_.block_size_;
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.FileSignature)
+}
+
+inline void FileSignature::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.weak_hashes_){}
+    , decltype(_impl_.strong_hashes_){}
+    , decltype(_impl_.block_size_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.weak_hashes_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.weak_hashes_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.strong_hashes_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.strong_hashes_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+FileSignature::~FileSignature() {
+  // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.FileSignature)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void FileSignature::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.weak_hashes_.Destroy();
+  _impl_.strong_hashes_.Destroy();
+}
+
+void FileSignature::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FileSignature::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.FileSignature)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.weak_hashes_.ClearToEmpty();
+  _impl_.strong_hashes_.ClearToEmpty();
+  _impl_.block_size_ = 0u;
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* FileSignature::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 block_size = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.block_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes weak_hashes = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_weak_hashes();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes strong_hashes = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_strong_hashes();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* FileSignature::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.file_transfer.FileSignature)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 block_size = 1;
+  if (this->_internal_block_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_block_size(), target);
+  }
+
+  // bytes weak_hashes = 2;
+  if (!this->_internal_weak_hashes().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_weak_hashes(), target);
+  }
+
+  // bytes strong_hashes = 3;
+  if (!this->_internal_strong_hashes().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_strong_hashes(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.file_transfer.FileSignature)
+  return target;
+}
+
+size_t FileSignature::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.FileSignature)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes weak_hashes = 2;
+  if (!this->_internal_weak_hashes().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_weak_hashes());
+  }
+
+  // bytes strong_hashes = 3;
+  if (!this->_internal_strong_hashes().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_strong_hashes());
+  }
+
+  // uint32 block_size = 1;
+  if (this->_internal_block_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_block_size());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void FileSignature::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const FileSignature*>(
+      &from));
+}
+
+void FileSignature::MergeFrom(const FileSignature& from) {
+  FileSignature* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.FileSignature)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_weak_hashes().empty()) {
+    _this->_internal_set_weak_hashes(from._internal_weak_hashes());
+  }
+  if (!from._internal_strong_hashes().empty()) {
+    _this->_internal_set_strong_hashes(from._internal_strong_hashes());
+  }
+  if (from._internal_block_size() != 0) {
+    _this->_internal_set_block_size(from._internal_block_size());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void FileSignature::CopyFrom(const FileSignature& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.file_transfer.FileSignature)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FileSignature::IsInitialized() const {
+  return true;
+}
+
+void FileSignature::InternalSwap(FileSignature* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.weak_hashes_, lhs_arena,
+      &other->_impl_.weak_hashes_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.strong_hashes_, lhs_arena,
+      &other->_impl_.strong_hashes_, rhs_arena
+  );
+  swap(_impl_.block_size_, other->_impl_.block_size_);
+}
+
+std::string FileSignature::GetTypeName() const {
+  return "aspia.proto.file_transfer.FileSignature";
+}
+
+
+// ===================================================================
+
+class BlockCopy::_Internal {
+ public:
+};
+
+BlockCopy::BlockCopy(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.file_transfer.BlockCopy)
+}
+BlockCopy::BlockCopy(const BlockCopy& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  BlockCopy* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.block_index_){}
+    , decltype(_impl_.data_offset_){}
+    , decltype(_impl_.block_count_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::memcpy(&_impl_.block_index_, &from._impl_.block_index_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.block_count_) -
+    reinterpret_cast<char*>(&_impl_.block_index_)) + sizeof(_impl_.block_count_));
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.BlockCopy)
+}
+
+inline void BlockCopy::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.block_index_){uint64_t{0u}}
+    , decltype(_impl_.data_offset_){0u}
+    , decltype(_impl_.block_count_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+BlockCopy::~BlockCopy() {
+  // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.BlockCopy)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BlockCopy::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void BlockCopy::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BlockCopy::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.BlockCopy)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.block_index_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.block_count_) -
+      reinterpret_cast<char*>(&_impl_.block_index_)) + sizeof(_impl_.block_count_));
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* BlockCopy::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 data_offset = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.data_offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 block_index = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.block_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 block_count = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.block_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BlockCopy::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.file_transfer.BlockCopy)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 data_offset = 1;
+  if (this->_internal_data_offset() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_data_offset(), target);
+  }
+
+  // uint64 block_index = 2;
+  if (this->_internal_block_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_block_index(), target);
+  }
+
+  // uint32 block_count = 3;
+  if (this->_internal_block_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_block_count(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.file_transfer.BlockCopy)
+  return target;
+}
+
+size_t BlockCopy::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.BlockCopy)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 block_index = 2;
+  if (this->_internal_block_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_block_index());
+  }
+
+  // uint32 data_offset = 1;
+  if (this->_internal_data_offset() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_data_offset());
+  }
+
+  // uint32 block_count = 3;
+  if (this->_internal_block_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_block_count());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void BlockCopy::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const BlockCopy*>(
+      &from));
+}
+
+void BlockCopy::MergeFrom(const BlockCopy& from) {
+  BlockCopy* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.BlockCopy)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_block_index() != 0) {
+    _this->_internal_set_block_index(from._internal_block_index());
+  }
+  if (from._internal_data_offset() != 0) {
+    _this->_internal_set_data_offset(from._internal_data_offset());
+  }
+  if (from._internal_block_count() != 0) {
+    _this->_internal_set_block_count(from._internal_block_count());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void BlockCopy::CopyFrom(const BlockCopy& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.file_transfer.BlockCopy)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BlockCopy::IsInitialized() const {
+  return true;
+}
+
+void BlockCopy::InternalSwap(BlockCopy* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(BlockCopy, _impl_.block_count_)
+      + sizeof(BlockCopy::_impl_.block_count_)
+      - PROTOBUF_FIELD_OFFSET(BlockCopy, _impl_.block_index_)>(
+          reinterpret_cast<char*>(&_impl_.block_index_),
+          reinterpret_cast<char*>(&other->_impl_.block_index_));
+}
+
+std::string BlockCopy::GetTypeName() const {
+  return "aspia.proto.file_transfer.BlockCopy";
+}
+
+
+// ===================================================================
+
+class ZeroRange::_Internal {
+ public:
+};
+
+ZeroRange::ZeroRange(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.file_transfer.ZeroRange)
+}
+ZeroRange::ZeroRange(const ZeroRange& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  ZeroRange* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.size_){}
+    , decltype(_impl_.data_offset_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::memcpy(&_impl_.size_, &from._impl_.size_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.data_offset_) -
+    reinterpret_cast<char*>(&_impl_.size_)) + sizeof(_impl_.data_offset_));
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.ZeroRange)
+}
+
+inline void ZeroRange::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.size_){uint64_t{0u}}
+    , decltype(_impl_.data_offset_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ZeroRange::~ZeroRange() {
+  // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.ZeroRange)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ZeroRange::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ZeroRange::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ZeroRange::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.ZeroRange)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.size_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.data_offset_) -
+      reinterpret_cast<char*>(&_impl_.size_)) + sizeof(_impl_.data_offset_));
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* ZeroRange::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 data_offset = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.data_offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 size = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ZeroRange::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.file_transfer.ZeroRange)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 data_offset = 1;
+  if (this->_internal_data_offset() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_data_offset(), target);
+  }
+
+  // uint64 size = 2;
+  if (this->_internal_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_size(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.file_transfer.ZeroRange)
+  return target;
+}
+
+size_t ZeroRange::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.ZeroRange)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 size = 2;
+  if (this->_internal_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_size());
+  }
+
+  // uint32 data_offset = 1;
+  if (this->_internal_data_offset() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_data_offset());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
-void FileListRequest::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const FileListRequest*>(&from));
+void ZeroRange::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const ZeroRange*>(
+      &from));
 }
 
-void FileListRequest::MergeFrom(const FileListRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.FileListRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+void ZeroRange::MergeFrom(const ZeroRange& from) {
+  ZeroRange* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.ZeroRange)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.path().size() > 0) {
-
-    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
+  if (from._internal_size() != 0) {
+    _this->_internal_set_size(from._internal_size());
   }
+  if (from._internal_data_offset() != 0) {
+    _this->_internal_set_data_offset(from._internal_data_offset());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
-void FileListRequest::CopyFrom(const FileListRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.file_transfer.FileListRequest)
+void ZeroRange::CopyFrom(const ZeroRange& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.file_transfer.ZeroRange)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool FileListRequest::IsInitialized() const {
+bool ZeroRange::IsInitialized() const {
   return true;
 }
 
-void FileListRequest::Swap(FileListRequest* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void FileListRequest::InternalSwap(FileListRequest* other) {
+void ZeroRange::InternalSwap(ZeroRange* other) {
   using std::swap;
-  path_.Swap(&other->path_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ZeroRange, _impl_.data_offset_)
+      + sizeof(ZeroRange::_impl_.data_offset_)
+      - PROTOBUF_FIELD_OFFSET(ZeroRange, _impl_.size_)>(
+          reinterpret_cast<char*>(&_impl_.size_),
+          reinterpret_cast<char*>(&other->_impl_.size_));
 }
 
-::std::string FileListRequest::GetTypeName() const {
-  return "aspia.proto.file_transfer.FileListRequest";
+std::string ZeroRange::GetTypeName() const {
+  return "aspia.proto.file_transfer.ZeroRange";
 }
 
 
 // ===================================================================
 
-void UploadRequest::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int UploadRequest::kPathFieldNumber;
-const int UploadRequest::kOverwriteFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class UploadRequest::_Internal {
+ public:
+  static const ::aspia::proto::file_transfer::Packet& packet(const UploadRequest* msg);
+};
 
-UploadRequest::UploadRequest()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_UploadRequest.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.UploadRequest)
+const ::aspia::proto::file_transfer::Packet&
+UploadRequest::_Internal::packet(const UploadRequest* msg) {
+  return *msg->_impl_.packet_;
+}
+UploadRequest::UploadRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.file_transfer.UploadRequest)
 }
 UploadRequest::UploadRequest(const UploadRequest& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.path().size() > 0) {
-    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
-  }
-  overwrite_ = from.overwrite_;
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  UploadRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.path_){}
+    , decltype(_impl_.packet_){nullptr}
+    , decltype(_impl_.overwrite_){}
+    , decltype(_impl_.resume_){}
+    , decltype(_impl_.delta_){}
+    , decltype(_impl_.archive_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_path().empty()) {
+    _this->_impl_.path_.Set(from._internal_path(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_packet()) {
+    _this->_impl_.packet_ = new ::aspia::proto::file_transfer::Packet(*from._impl_.packet_);
+  }
+  ::memcpy(&_impl_.overwrite_, &from._impl_.overwrite_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.archive_) -
+    reinterpret_cast<char*>(&_impl_.overwrite_)) + sizeof(_impl_.archive_));
   // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.UploadRequest)
 }
 
-void UploadRequest::SharedCtor() {
-  path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  overwrite_ = false;
+inline void UploadRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.path_){}
+    , decltype(_impl_.packet_){nullptr}
+    , decltype(_impl_.overwrite_){false}
+    , decltype(_impl_.resume_){false}
+    , decltype(_impl_.delta_){false}
+    , decltype(_impl_.archive_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 UploadRequest::~UploadRequest() {
   // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.UploadRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void UploadRequest::SharedDtor() {
-  path_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void UploadRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.path_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.packet_;
 }
 
 void UploadRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const UploadRequest& UploadRequest::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_UploadRequest.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void UploadRequest::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.UploadRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  overwrite_ = false;
-  _internal_metadata_.Clear();
-}
-
-bool UploadRequest::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.UploadRequest)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // string path = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_path()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->path().data(), static_cast<int>(this->path().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "aspia.proto.file_transfer.UploadRequest.path"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+  _impl_.path_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.packet_ != nullptr) {
+    delete _impl_.packet_;
+  }
+  _impl_.packet_ = nullptr;
+  ::memset(&_impl_.overwrite_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.archive_) -
+      reinterpret_cast<char*>(&_impl_.overwrite_)) + sizeof(_impl_.archive_));
+  _internal_metadata_.Clear<std::string>();
+}
 
+const char* UploadRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string path = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
+        } else
+          goto handle_unusual;
+        continue;
       // bool overwrite = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &overwrite_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.overwrite_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .aspia.proto.file_transfer.Packet packet = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_packet(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool resume = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.resume_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool delta = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.delta_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool archive = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.archive_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.UploadRequest)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.UploadRequest)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void UploadRequest::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.UploadRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* UploadRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.file_transfer.UploadRequest)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string path = 1;
-  if (this->path().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->path().data(), static_cast<int>(this->path().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_path().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_path().data(), static_cast<int>(this->_internal_path().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "aspia.proto.file_transfer.UploadRequest.path");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->path(), output);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_path(), target);
   }
 
   // bool overwrite = 2;
-  if (this->overwrite() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(2, this->overwrite(), output);
+  if (this->_internal_overwrite() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_overwrite(), target);
+  }
+
+  // .aspia.proto.file_transfer.Packet packet = 3;
+  if (this->_internal_has_packet()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::packet(this),
+        _Internal::packet(this).GetCachedSize(), target, stream);
+  }
+
+  // bool resume = 4;
+  if (this->_internal_resume() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_resume(), target);
+  }
+
+  // bool delta = 5;
+  if (this->_internal_delta() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_delta(), target);
+  }
+
+  // bool archive = 6;
+  if (this->_internal_archive() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_archive(), target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.UploadRequest)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.file_transfer.UploadRequest)
+  return target;
 }
 
 size_t UploadRequest::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.UploadRequest)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // string path = 1;
-  if (this->path().size() > 0) {
+  if (!this->_internal_path().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_path());
+  }
+
+  // .aspia.proto.file_transfer.Packet packet = 3;
+  if (this->_internal_has_packet()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->path());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.packet_);
   }
 
   // bool overwrite = 2;
-  if (this->overwrite() != 0) {
+  if (this->_internal_overwrite() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool resume = 4;
+  if (this->_internal_resume() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool delta = 5;
+  if (this->_internal_delta() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool archive = 6;
+  if (this->_internal_archive() != 0) {
     total_size += 1 + 1;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void UploadRequest::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const UploadRequest*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const UploadRequest*>(
+      &from));
 }
 
 void UploadRequest::MergeFrom(const UploadRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.UploadRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  UploadRequest* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.UploadRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.path().size() > 0) {
-
-    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
+  if (!from._internal_path().empty()) {
+    _this->_internal_set_path(from._internal_path());
+  }
+  if (from._internal_has_packet()) {
+    _this->_internal_mutable_packet()->::aspia::proto::file_transfer::Packet::MergeFrom(
+        from._internal_packet());
+  }
+  if (from._internal_overwrite() != 0) {
+    _this->_internal_set_overwrite(from._internal_overwrite());
+  }
+  if (from._internal_resume() != 0) {
+    _this->_internal_set_resume(from._internal_resume());
+  }
+  if (from._internal_delta() != 0) {
+    _this->_internal_set_delta(from._internal_delta());
   }
-  if (from.overwrite() != 0) {
-    set_overwrite(from.overwrite());
+  if (from._internal_archive() != 0) {
+    _this->_internal_set_archive(from._internal_archive());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void UploadRequest::CopyFrom(const UploadRequest& from) {
@@ -1907,188 +3476,285 @@ bool UploadRequest::IsInitialized() const {
   return true;
 }
 
-void UploadRequest::Swap(UploadRequest* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void UploadRequest::InternalSwap(UploadRequest* other) {
   using std::swap;
-  path_.Swap(&other->path_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(overwrite_, other->overwrite_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-}
-
-::std::string UploadRequest::GetTypeName() const {
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.path_, lhs_arena,
+      &other->_impl_.path_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(UploadRequest, _impl_.archive_)
+      + sizeof(UploadRequest::_impl_.archive_)
+      - PROTOBUF_FIELD_OFFSET(UploadRequest, _impl_.packet_)>(
+          reinterpret_cast<char*>(&_impl_.packet_),
+          reinterpret_cast<char*>(&other->_impl_.packet_));
+}
+
+std::string UploadRequest::GetTypeName() const {
   return "aspia.proto.file_transfer.UploadRequest";
 }
 
 
 // ===================================================================
 
-void DownloadRequest::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int DownloadRequest::kPathFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class DownloadRequest::_Internal {
+ public:
+};
 
-DownloadRequest::DownloadRequest()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_DownloadRequest.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.DownloadRequest)
+DownloadRequest::DownloadRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.file_transfer.DownloadRequest)
 }
 DownloadRequest::DownloadRequest(const DownloadRequest& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.path().size() > 0) {
-    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
-  }
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  DownloadRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.path_){}
+    , decltype(_impl_.packet_size_){}
+    , decltype(_impl_.compression_){}
+    , decltype(_impl_.archive_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_path().empty()) {
+    _this->_impl_.path_.Set(from._internal_path(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.packet_size_, &from._impl_.packet_size_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.archive_) -
+    reinterpret_cast<char*>(&_impl_.packet_size_)) + sizeof(_impl_.archive_));
   // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.DownloadRequest)
 }
 
-void DownloadRequest::SharedCtor() {
-  path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void DownloadRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.path_){}
+    , decltype(_impl_.packet_size_){0u}
+    , decltype(_impl_.compression_){0}
+    , decltype(_impl_.archive_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 DownloadRequest::~DownloadRequest() {
   // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.DownloadRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void DownloadRequest::SharedDtor() {
-  path_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void DownloadRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.path_.Destroy();
 }
 
 void DownloadRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const DownloadRequest& DownloadRequest::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_DownloadRequest.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void DownloadRequest::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.DownloadRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  _internal_metadata_.Clear();
-}
-
-bool DownloadRequest::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.DownloadRequest)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.path_.ClearToEmpty();
+  ::memset(&_impl_.packet_size_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.archive_) -
+      reinterpret_cast<char*>(&_impl_.packet_size_)) + sizeof(_impl_.archive_));
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* DownloadRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string path = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_path()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->path().data(), static_cast<int>(this->path().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "aspia.proto.file_transfer.DownloadRequest.path"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 packet_size = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.packet_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .aspia.proto.file_transfer.PacketCompression compression = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_compression(static_cast<::aspia::proto::file_transfer::PacketCompression>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool archive = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.archive_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.DownloadRequest)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.DownloadRequest)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void DownloadRequest::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.DownloadRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* DownloadRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.file_transfer.DownloadRequest)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string path = 1;
-  if (this->path().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->path().data(), static_cast<int>(this->path().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_path().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_path().data(), static_cast<int>(this->_internal_path().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "aspia.proto.file_transfer.DownloadRequest.path");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->path(), output);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_path(), target);
+  }
+
+  // uint32 packet_size = 2;
+  if (this->_internal_packet_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_packet_size(), target);
+  }
+
+  // .aspia.proto.file_transfer.PacketCompression compression = 3;
+  if (this->_internal_compression() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_compression(), target);
+  }
+
+  // bool archive = 4;
+  if (this->_internal_archive() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_archive(), target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.DownloadRequest)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.file_transfer.DownloadRequest)
+  return target;
 }
 
 size_t DownloadRequest::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.DownloadRequest)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // string path = 1;
-  if (this->path().size() > 0) {
+  if (!this->_internal_path().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_path());
+  }
+
+  // uint32 packet_size = 2;
+  if (this->_internal_packet_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_packet_size());
+  }
+
+  // .aspia.proto.file_transfer.PacketCompression compression = 3;
+  if (this->_internal_compression() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->path());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_compression());
+  }
+
+  // bool archive = 4;
+  if (this->_internal_archive() != 0) {
+    total_size += 1 + 1;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void DownloadRequest::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const DownloadRequest*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const DownloadRequest*>(
+      &from));
 }
 
 void DownloadRequest::MergeFrom(const DownloadRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.DownloadRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  DownloadRequest* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.DownloadRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.path().size() > 0) {
-
-    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
+  if (!from._internal_path().empty()) {
+    _this->_internal_set_path(from._internal_path());
   }
+  if (from._internal_packet_size() != 0) {
+    _this->_internal_set_packet_size(from._internal_packet_size());
+  }
+  if (from._internal_compression() != 0) {
+    _this->_internal_set_compression(from._internal_compression());
+  }
+  if (from._internal_archive() != 0) {
+    _this->_internal_set_archive(from._internal_archive());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void DownloadRequest::CopyFrom(const DownloadRequest& from) {
@@ -2102,175 +3768,345 @@ bool DownloadRequest::IsInitialized() const {
   return true;
 }
 
-void DownloadRequest::Swap(DownloadRequest* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void DownloadRequest::InternalSwap(DownloadRequest* other) {
   using std::swap;
-  path_.Swap(&other->path_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-}
-
-::std::string DownloadRequest::GetTypeName() const {
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.path_, lhs_arena,
+      &other->_impl_.path_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(DownloadRequest, _impl_.archive_)
+      + sizeof(DownloadRequest::_impl_.archive_)
+      - PROTOBUF_FIELD_OFFSET(DownloadRequest, _impl_.packet_size_)>(
+          reinterpret_cast<char*>(&_impl_.packet_size_),
+          reinterpret_cast<char*>(&other->_impl_.packet_size_));
+}
+
+std::string DownloadRequest::GetTypeName() const {
   return "aspia.proto.file_transfer.DownloadRequest";
 }
 
 
 // ===================================================================
 
-void PacketRequest::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PacketRequest::kDummyFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class PacketRequest::_Internal {
+ public:
+  static const ::aspia::proto::file_transfer::PartialFile& partial_file(const PacketRequest* msg);
+  static const ::aspia::proto::file_transfer::FileSignature& signature(const PacketRequest* msg);
+};
 
-PacketRequest::PacketRequest()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_PacketRequest.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.PacketRequest)
+const ::aspia::proto::file_transfer::PartialFile&
+PacketRequest::_Internal::partial_file(const PacketRequest* msg) {
+  return *msg->_impl_.partial_file_;
+}
+const ::aspia::proto::file_transfer::FileSignature&
+PacketRequest::_Internal::signature(const PacketRequest* msg) {
+  return *msg->_impl_.signature_;
+}
+PacketRequest::PacketRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.file_transfer.PacketRequest)
 }
 PacketRequest::PacketRequest(const PacketRequest& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  dummy_ = from.dummy_;
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  PacketRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.partial_file_){nullptr}
+    , decltype(_impl_.signature_){nullptr}
+    , decltype(_impl_.dummy_){}
+    , decltype(_impl_.packet_size_){}
+    , decltype(_impl_.compression_){}
+    , decltype(_impl_.zero_ranges_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  if (from._internal_has_partial_file()) {
+    _this->_impl_.partial_file_ = new ::aspia::proto::file_transfer::PartialFile(*from._impl_.partial_file_);
+  }
+  if (from._internal_has_signature()) {
+    _this->_impl_.signature_ = new ::aspia::proto::file_transfer::FileSignature(*from._impl_.signature_);
+  }
+  ::memcpy(&_impl_.dummy_, &from._impl_.dummy_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.zero_ranges_) -
+    reinterpret_cast<char*>(&_impl_.dummy_)) + sizeof(_impl_.zero_ranges_));
   // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.PacketRequest)
 }
 
-void PacketRequest::SharedCtor() {
-  dummy_ = 0u;
+inline void PacketRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.partial_file_){nullptr}
+    , decltype(_impl_.signature_){nullptr}
+    , decltype(_impl_.dummy_){0u}
+    , decltype(_impl_.packet_size_){0u}
+    , decltype(_impl_.compression_){0}
+    , decltype(_impl_.zero_ranges_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 PacketRequest::~PacketRequest() {
   // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.PacketRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PacketRequest::SharedDtor() {
+inline void PacketRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.partial_file_;
+  if (this != internal_default_instance()) delete _impl_.signature_;
 }
 
 void PacketRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const PacketRequest& PacketRequest::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_PacketRequest.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void PacketRequest::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.PacketRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  dummy_ = 0u;
-  _internal_metadata_.Clear();
-}
-
-bool PacketRequest::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.PacketRequest)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  if (GetArenaForAllocation() == nullptr && _impl_.partial_file_ != nullptr) {
+    delete _impl_.partial_file_;
+  }
+  _impl_.partial_file_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.signature_ != nullptr) {
+    delete _impl_.signature_;
+  }
+  _impl_.signature_ = nullptr;
+  ::memset(&_impl_.dummy_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.zero_ranges_) -
+      reinterpret_cast<char*>(&_impl_.dummy_)) + sizeof(_impl_.zero_ranges_));
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* PacketRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // uint32 dummy = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &dummy_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.dummy_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 packet_size = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.packet_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .aspia.proto.file_transfer.PacketCompression compression = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_compression(static_cast<::aspia::proto::file_transfer::PacketCompression>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .aspia.proto.file_transfer.PartialFile partial_file = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_partial_file(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .aspia.proto.file_transfer.FileSignature signature = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_signature(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool zero_ranges = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.zero_ranges_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.PacketRequest)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.PacketRequest)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void PacketRequest::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.PacketRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* PacketRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.file_transfer.PacketRequest)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // uint32 dummy = 1;
-  if (this->dummy() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->dummy(), output);
+  if (this->_internal_dummy() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_dummy(), target);
+  }
+
+  // uint32 packet_size = 2;
+  if (this->_internal_packet_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_packet_size(), target);
+  }
+
+  // .aspia.proto.file_transfer.PacketCompression compression = 3;
+  if (this->_internal_compression() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_compression(), target);
+  }
+
+  // .aspia.proto.file_transfer.PartialFile partial_file = 4;
+  if (this->_internal_has_partial_file()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::partial_file(this),
+        _Internal::partial_file(this).GetCachedSize(), target, stream);
+  }
+
+  // .aspia.proto.file_transfer.FileSignature signature = 5;
+  if (this->_internal_has_signature()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::signature(this),
+        _Internal::signature(this).GetCachedSize(), target, stream);
+  }
+
+  // bool zero_ranges = 6;
+  if (this->_internal_zero_ranges() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_zero_ranges(), target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.PacketRequest)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.file_transfer.PacketRequest)
+  return target;
 }
 
 size_t PacketRequest::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.PacketRequest)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .aspia.proto.file_transfer.PartialFile partial_file = 4;
+  if (this->_internal_has_partial_file()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.partial_file_);
+  }
+
+  // .aspia.proto.file_transfer.FileSignature signature = 5;
+  if (this->_internal_has_signature()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.signature_);
+  }
 
   // uint32 dummy = 1;
-  if (this->dummy() != 0) {
+  if (this->_internal_dummy() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_dummy());
+  }
+
+  // uint32 packet_size = 2;
+  if (this->_internal_packet_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_packet_size());
+  }
+
+  // .aspia.proto.file_transfer.PacketCompression compression = 3;
+  if (this->_internal_compression() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->dummy());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_compression());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  // bool zero_ranges = 6;
+  if (this->_internal_zero_ranges() != 0) {
+    total_size += 1 + 1;
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void PacketRequest::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const PacketRequest*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const PacketRequest*>(
+      &from));
 }
 
 void PacketRequest::MergeFrom(const PacketRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.PacketRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  PacketRequest* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.PacketRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.dummy() != 0) {
-    set_dummy(from.dummy());
+  if (from._internal_has_partial_file()) {
+    _this->_internal_mutable_partial_file()->::aspia::proto::file_transfer::PartialFile::MergeFrom(
+        from._internal_partial_file());
   }
+  if (from._internal_has_signature()) {
+    _this->_internal_mutable_signature()->::aspia::proto::file_transfer::FileSignature::MergeFrom(
+        from._internal_signature());
+  }
+  if (from._internal_dummy() != 0) {
+    _this->_internal_set_dummy(from._internal_dummy());
+  }
+  if (from._internal_packet_size() != 0) {
+    _this->_internal_set_packet_size(from._internal_packet_size());
+  }
+  if (from._internal_compression() != 0) {
+    _this->_internal_set_compression(from._internal_compression());
+  }
+  if (from._internal_zero_ranges() != 0) {
+    _this->_internal_set_zero_ranges(from._internal_zero_ranges());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void PacketRequest::CopyFrom(const PacketRequest& from) {
@@ -2284,247 +4120,501 @@ bool PacketRequest::IsInitialized() const {
   return true;
 }
 
-void PacketRequest::Swap(PacketRequest* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void PacketRequest::InternalSwap(PacketRequest* other) {
   using std::swap;
-  swap(dummy_, other->dummy_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PacketRequest, _impl_.zero_ranges_)
+      + sizeof(PacketRequest::_impl_.zero_ranges_)
+      - PROTOBUF_FIELD_OFFSET(PacketRequest, _impl_.partial_file_)>(
+          reinterpret_cast<char*>(&_impl_.partial_file_),
+          reinterpret_cast<char*>(&other->_impl_.partial_file_));
 }
 
-::std::string PacketRequest::GetTypeName() const {
+std::string PacketRequest::GetTypeName() const {
   return "aspia.proto.file_transfer.PacketRequest";
 }
 
 
 // ===================================================================
 
-void Packet::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Packet::kFlagsFieldNumber;
-const int Packet::kFileSizeFieldNumber;
-const int Packet::kDataFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class Packet::_Internal {
+ public:
+};
 
-Packet::Packet()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_Packet.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.Packet)
+Packet::Packet(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.file_transfer.Packet)
 }
 Packet::Packet(const Packet& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.data().size() > 0) {
-    data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.data_);
-  }
-  ::memcpy(&file_size_, &from.file_size_,
-    static_cast<size_t>(reinterpret_cast<char*>(&flags_) -
-    reinterpret_cast<char*>(&file_size_)) + sizeof(flags_));
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  Packet* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.block_copies_){from._impl_.block_copies_}
+    , decltype(_impl_.zero_ranges_){from._impl_.zero_ranges_}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.file_hash_){}
+    , decltype(_impl_.file_size_){}
+    , decltype(_impl_.flags_){}
+    , decltype(_impl_.compression_){}
+    , decltype(_impl_.offset_){}
+    , decltype(_impl_.copied_size_){}
+    , decltype(_impl_.data_size_){}
+    , decltype(_impl_.solid_){}
+    , decltype(_impl_.zero_size_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_data().empty()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.file_hash_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_hash_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_file_hash().empty()) {
+    _this->_impl_.file_hash_.Set(from._internal_file_hash(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.file_size_, &from._impl_.file_size_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.zero_size_) -
+    reinterpret_cast<char*>(&_impl_.file_size_)) + sizeof(_impl_.zero_size_));
   // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.Packet)
 }
 
-void Packet::SharedCtor() {
-  data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&file_size_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&flags_) -
-      reinterpret_cast<char*>(&file_size_)) + sizeof(flags_));
+inline void Packet::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.block_copies_){arena}
+    , decltype(_impl_.zero_ranges_){arena}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.file_hash_){}
+    , decltype(_impl_.file_size_){uint64_t{0u}}
+    , decltype(_impl_.flags_){0u}
+    , decltype(_impl_.compression_){0}
+    , decltype(_impl_.offset_){uint64_t{0u}}
+    , decltype(_impl_.copied_size_){uint64_t{0u}}
+    , decltype(_impl_.data_size_){0u}
+    , decltype(_impl_.solid_){false}
+    , decltype(_impl_.zero_size_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.file_hash_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_hash_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Packet::~Packet() {
   // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.Packet)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Packet::SharedDtor() {
-  data_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void Packet::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.block_copies_.~RepeatedPtrField();
+  _impl_.zero_ranges_.~RepeatedPtrField();
+  _impl_.data_.Destroy();
+  _impl_.file_hash_.Destroy();
 }
 
 void Packet::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Packet& Packet::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_Packet.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void Packet::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.Packet)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&file_size_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&flags_) -
-      reinterpret_cast<char*>(&file_size_)) + sizeof(flags_));
-  _internal_metadata_.Clear();
-}
-
-bool Packet::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.Packet)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.block_copies_.Clear();
+  _impl_.zero_ranges_.Clear();
+  _impl_.data_.ClearToEmpty();
+  _impl_.file_hash_.ClearToEmpty();
+  ::memset(&_impl_.file_size_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.zero_size_) -
+      reinterpret_cast<char*>(&_impl_.file_size_)) + sizeof(_impl_.zero_size_));
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* Packet::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // uint32 flags = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &flags_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.flags_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint64 file_size = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &file_size_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.file_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // bytes data = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_data()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .aspia.proto.file_transfer.PacketCompression compression = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_compression(static_cast<::aspia::proto::file_transfer::PacketCompression>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 data_size = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.data_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 offset = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .aspia.proto.file_transfer.BlockCopy block_copies = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_block_copies(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<58>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 copied_size = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.copied_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .aspia.proto.file_transfer.ZeroRange zero_ranges = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_zero_ranges(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<74>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 zero_size = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.zero_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes file_hash = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          auto str = _internal_mutable_file_hash();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool solid = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _impl_.solid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.Packet)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.Packet)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void Packet::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.Packet)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* Packet::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.file_transfer.Packet)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // uint32 flags = 1;
-  if (this->flags() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->flags(), output);
+  if (this->_internal_flags() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_flags(), target);
   }
 
   // uint64 file_size = 2;
-  if (this->file_size() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->file_size(), output);
+  if (this->_internal_file_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_file_size(), target);
   }
 
   // bytes data = 3;
-  if (this->data().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      3, this->data(), output);
+  if (!this->_internal_data().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_data(), target);
+  }
+
+  // .aspia.proto.file_transfer.PacketCompression compression = 4;
+  if (this->_internal_compression() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_compression(), target);
+  }
+
+  // uint32 data_size = 5;
+  if (this->_internal_data_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_data_size(), target);
+  }
+
+  // uint64 offset = 6;
+  if (this->_internal_offset() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_offset(), target);
+  }
+
+  // repeated .aspia.proto.file_transfer.BlockCopy block_copies = 7;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_block_copies_size()); i < n; i++) {
+    const auto& repfield = this->_internal_block_copies(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(7, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // uint64 copied_size = 8;
+  if (this->_internal_copied_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_copied_size(), target);
+  }
+
+  // repeated .aspia.proto.file_transfer.ZeroRange zero_ranges = 9;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_zero_ranges_size()); i < n; i++) {
+    const auto& repfield = this->_internal_zero_ranges(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(9, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // uint64 zero_size = 10;
+  if (this->_internal_zero_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(10, this->_internal_zero_size(), target);
+  }
+
+  // bytes file_hash = 11;
+  if (!this->_internal_file_hash().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        11, this->_internal_file_hash(), target);
+  }
+
+  // bool solid = 12;
+  if (this->_internal_solid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(12, this->_internal_solid(), target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.Packet)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.file_transfer.Packet)
+  return target;
 }
 
 size_t Packet::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.Packet)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .aspia.proto.file_transfer.BlockCopy block_copies = 7;
+  total_size += 1UL * this->_internal_block_copies_size();
+  for (const auto& msg : this->_impl_.block_copies_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .aspia.proto.file_transfer.ZeroRange zero_ranges = 9;
+  total_size += 1UL * this->_internal_zero_ranges_size();
+  for (const auto& msg : this->_impl_.zero_ranges_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
 
   // bytes data = 3;
-  if (this->data().size() > 0) {
+  if (!this->_internal_data().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->data());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
   }
 
-  // uint64 file_size = 2;
-  if (this->file_size() != 0) {
+  // bytes file_hash = 11;
+  if (!this->_internal_file_hash().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->file_size());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_file_hash());
+  }
+
+  // uint64 file_size = 2;
+  if (this->_internal_file_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_file_size());
   }
 
   // uint32 flags = 1;
-  if (this->flags() != 0) {
+  if (this->_internal_flags() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_flags());
+  }
+
+  // .aspia.proto.file_transfer.PacketCompression compression = 4;
+  if (this->_internal_compression() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->flags());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_compression());
+  }
+
+  // uint64 offset = 6;
+  if (this->_internal_offset() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_offset());
+  }
+
+  // uint64 copied_size = 8;
+  if (this->_internal_copied_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_copied_size());
+  }
+
+  // uint32 data_size = 5;
+  if (this->_internal_data_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_data_size());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  // bool solid = 12;
+  if (this->_internal_solid() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint64 zero_size = 10;
+  if (this->_internal_zero_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_zero_size());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void Packet::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const Packet*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const Packet*>(
+      &from));
 }
 
 void Packet::MergeFrom(const Packet& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.Packet)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  Packet* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.Packet)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.data().size() > 0) {
-
-    data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.data_);
+  _this->_impl_.block_copies_.MergeFrom(from._impl_.block_copies_);
+  _this->_impl_.zero_ranges_.MergeFrom(from._impl_.zero_ranges_);
+  if (!from._internal_data().empty()) {
+    _this->_internal_set_data(from._internal_data());
+  }
+  if (!from._internal_file_hash().empty()) {
+    _this->_internal_set_file_hash(from._internal_file_hash());
   }
-  if (from.file_size() != 0) {
-    set_file_size(from.file_size());
+  if (from._internal_file_size() != 0) {
+    _this->_internal_set_file_size(from._internal_file_size());
   }
-  if (from.flags() != 0) {
-    set_flags(from.flags());
+  if (from._internal_flags() != 0) {
+    _this->_internal_set_flags(from._internal_flags());
   }
+  if (from._internal_compression() != 0) {
+    _this->_internal_set_compression(from._internal_compression());
+  }
+  if (from._internal_offset() != 0) {
+    _this->_internal_set_offset(from._internal_offset());
+  }
+  if (from._internal_copied_size() != 0) {
+    _this->_internal_set_copied_size(from._internal_copied_size());
+  }
+  if (from._internal_data_size() != 0) {
+    _this->_internal_set_data_size(from._internal_data_size());
+  }
+  if (from._internal_solid() != 0) {
+    _this->_internal_set_solid(from._internal_solid());
+  }
+  if (from._internal_zero_size() != 0) {
+    _this->_internal_set_zero_size(from._internal_zero_size());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void Packet::CopyFrom(const Packet& from) {
@@ -2538,189 +4628,210 @@ bool Packet::IsInitialized() const {
   return true;
 }
 
-void Packet::Swap(Packet* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void Packet::InternalSwap(Packet* other) {
   using std::swap;
-  data_.Swap(&other->data_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(file_size_, other->file_size_);
-  swap(flags_, other->flags_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-}
-
-::std::string Packet::GetTypeName() const {
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.block_copies_.InternalSwap(&other->_impl_.block_copies_);
+  _impl_.zero_ranges_.InternalSwap(&other->_impl_.zero_ranges_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.file_hash_, lhs_arena,
+      &other->_impl_.file_hash_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Packet, _impl_.zero_size_)
+      + sizeof(Packet::_impl_.zero_size_)
+      - PROTOBUF_FIELD_OFFSET(Packet, _impl_.file_size_)>(
+          reinterpret_cast<char*>(&_impl_.file_size_),
+          reinterpret_cast<char*>(&other->_impl_.file_size_));
+}
+
+std::string Packet::GetTypeName() const {
   return "aspia.proto.file_transfer.Packet";
 }
 
 
 // ===================================================================
 
-void CreateDirectoryRequest::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int CreateDirectoryRequest::kPathFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class CreateDirectoryRequest::_Internal {
+ public:
+};
 
-CreateDirectoryRequest::CreateDirectoryRequest()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_CreateDirectoryRequest.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.CreateDirectoryRequest)
+CreateDirectoryRequest::CreateDirectoryRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.file_transfer.CreateDirectoryRequest)
 }
 CreateDirectoryRequest::CreateDirectoryRequest(const CreateDirectoryRequest& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.path().size() > 0) {
-    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  CreateDirectoryRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.path_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_path().empty()) {
+    _this->_impl_.path_.Set(from._internal_path(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.CreateDirectoryRequest)
 }
 
-void CreateDirectoryRequest::SharedCtor() {
-  path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void CreateDirectoryRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.path_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 CreateDirectoryRequest::~CreateDirectoryRequest() {
   // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.CreateDirectoryRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void CreateDirectoryRequest::SharedDtor() {
-  path_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void CreateDirectoryRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.path_.Destroy();
 }
 
 void CreateDirectoryRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const CreateDirectoryRequest& CreateDirectoryRequest::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_CreateDirectoryRequest.base);
-  return *internal_default_instance();
-}
-
 
 void CreateDirectoryRequest::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.CreateDirectoryRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  _internal_metadata_.Clear();
-}
-
-bool CreateDirectoryRequest::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.CreateDirectoryRequest)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.path_.ClearToEmpty();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* CreateDirectoryRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string path = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_path()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->path().data(), static_cast<int>(this->path().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "aspia.proto.file_transfer.CreateDirectoryRequest.path"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.CreateDirectoryRequest)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.CreateDirectoryRequest)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void CreateDirectoryRequest::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.CreateDirectoryRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* CreateDirectoryRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.file_transfer.CreateDirectoryRequest)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string path = 1;
-  if (this->path().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->path().data(), static_cast<int>(this->path().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_path().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_path().data(), static_cast<int>(this->_internal_path().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "aspia.proto.file_transfer.CreateDirectoryRequest.path");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->path(), output);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_path(), target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.CreateDirectoryRequest)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.file_transfer.CreateDirectoryRequest)
+  return target;
 }
 
 size_t CreateDirectoryRequest::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.CreateDirectoryRequest)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // string path = 1;
-  if (this->path().size() > 0) {
+  if (!this->_internal_path().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->path());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_path());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void CreateDirectoryRequest::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const CreateDirectoryRequest*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const CreateDirectoryRequest*>(
+      &from));
 }
 
 void CreateDirectoryRequest::MergeFrom(const CreateDirectoryRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.CreateDirectoryRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  CreateDirectoryRequest* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.CreateDirectoryRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.path().size() > 0) {
-
-    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
+  if (!from._internal_path().empty()) {
+    _this->_internal_set_path(from._internal_path());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void CreateDirectoryRequest::CopyFrom(const CreateDirectoryRequest& from) {
@@ -2734,232 +4845,244 @@ bool CreateDirectoryRequest::IsInitialized() const {
   return true;
 }
 
-void CreateDirectoryRequest::Swap(CreateDirectoryRequest* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void CreateDirectoryRequest::InternalSwap(CreateDirectoryRequest* other) {
   using std::swap;
-  path_.Swap(&other->path_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.path_, lhs_arena,
+      &other->_impl_.path_, rhs_arena
+  );
 }
 
-::std::string CreateDirectoryRequest::GetTypeName() const {
+std::string CreateDirectoryRequest::GetTypeName() const {
   return "aspia.proto.file_transfer.CreateDirectoryRequest";
 }
 
 
 // ===================================================================
 
-void RenameRequest::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int RenameRequest::kOldNameFieldNumber;
-const int RenameRequest::kNewNameFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class RenameRequest::_Internal {
+ public:
+};
 
-RenameRequest::RenameRequest()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_RenameRequest.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.RenameRequest)
+RenameRequest::RenameRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.file_transfer.RenameRequest)
 }
 RenameRequest::RenameRequest(const RenameRequest& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  old_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.old_name().size() > 0) {
-    old_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.old_name_);
-  }
-  new_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.new_name().size() > 0) {
-    new_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.new_name_);
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  RenameRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.old_name_){}
+    , decltype(_impl_.new_name_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.old_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.old_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_old_name().empty()) {
+    _this->_impl_.old_name_.Set(from._internal_old_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.new_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.new_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_new_name().empty()) {
+    _this->_impl_.new_name_.Set(from._internal_new_name(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.RenameRequest)
 }
 
-void RenameRequest::SharedCtor() {
-  old_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  new_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void RenameRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.old_name_){}
+    , decltype(_impl_.new_name_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.old_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.old_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.new_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.new_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 RenameRequest::~RenameRequest() {
   // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.RenameRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void RenameRequest::SharedDtor() {
-  old_name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  new_name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void RenameRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.old_name_.Destroy();
+  _impl_.new_name_.Destroy();
 }
 
 void RenameRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const RenameRequest& RenameRequest::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_RenameRequest.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void RenameRequest::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.RenameRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  old_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  new_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  _internal_metadata_.Clear();
-}
-
-bool RenameRequest::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.RenameRequest)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.old_name_.ClearToEmpty();
+  _impl_.new_name_.ClearToEmpty();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* RenameRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string old_name = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_old_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->old_name().data(), static_cast<int>(this->old_name().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "aspia.proto.file_transfer.RenameRequest.old_name"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_old_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
+        } else
+          goto handle_unusual;
+        continue;
       // string new_name = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_new_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->new_name().data(), static_cast<int>(this->new_name().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "aspia.proto.file_transfer.RenameRequest.new_name"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_new_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.RenameRequest)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.RenameRequest)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void RenameRequest::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.RenameRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* RenameRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.file_transfer.RenameRequest)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string old_name = 1;
-  if (this->old_name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->old_name().data(), static_cast<int>(this->old_name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_old_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_old_name().data(), static_cast<int>(this->_internal_old_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "aspia.proto.file_transfer.RenameRequest.old_name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->old_name(), output);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_old_name(), target);
   }
 
   // string new_name = 2;
-  if (this->new_name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->new_name().data(), static_cast<int>(this->new_name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_new_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_new_name().data(), static_cast<int>(this->_internal_new_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "aspia.proto.file_transfer.RenameRequest.new_name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->new_name(), output);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_new_name(), target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.RenameRequest)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.file_transfer.RenameRequest)
+  return target;
 }
 
 size_t RenameRequest::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.RenameRequest)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // string old_name = 1;
-  if (this->old_name().size() > 0) {
+  if (!this->_internal_old_name().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->old_name());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_old_name());
   }
 
   // string new_name = 2;
-  if (this->new_name().size() > 0) {
+  if (!this->_internal_new_name().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->new_name());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_new_name());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void RenameRequest::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const RenameRequest*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const RenameRequest*>(
+      &from));
 }
 
 void RenameRequest::MergeFrom(const RenameRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.RenameRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  RenameRequest* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.RenameRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.old_name().size() > 0) {
-
-    old_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.old_name_);
+  if (!from._internal_old_name().empty()) {
+    _this->_internal_set_old_name(from._internal_old_name());
   }
-  if (from.new_name().size() > 0) {
-
-    new_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.new_name_);
+  if (!from._internal_new_name().empty()) {
+    _this->_internal_set_new_name(from._internal_new_name());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void RenameRequest::CopyFrom(const RenameRequest& from) {
@@ -2973,189 +5096,228 @@ bool RenameRequest::IsInitialized() const {
   return true;
 }
 
-void RenameRequest::Swap(RenameRequest* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void RenameRequest::InternalSwap(RenameRequest* other) {
   using std::swap;
-  old_name_.Swap(&other->old_name_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  new_name_.Swap(&other->new_name_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-}
-
-::std::string RenameRequest::GetTypeName() const {
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.old_name_, lhs_arena,
+      &other->_impl_.old_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.new_name_, lhs_arena,
+      &other->_impl_.new_name_, rhs_arena
+  );
+}
+
+std::string RenameRequest::GetTypeName() const {
   return "aspia.proto.file_transfer.RenameRequest";
 }
 
 
 // ===================================================================
 
-void RemoveRequest::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int RemoveRequest::kPathFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class RemoveRequest::_Internal {
+ public:
+};
 
-RemoveRequest::RemoveRequest()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_RemoveRequest.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.RemoveRequest)
+RemoveRequest::RemoveRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.file_transfer.RemoveRequest)
 }
 RemoveRequest::RemoveRequest(const RemoveRequest& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.path().size() > 0) {
-    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
-  }
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  RemoveRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.path_){}
+    , decltype(_impl_.recursive_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_path().empty()) {
+    _this->_impl_.path_.Set(from._internal_path(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.recursive_ = from._impl_.recursive_;
   // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.RemoveRequest)
 }
 
-void RemoveRequest::SharedCtor() {
-  path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void RemoveRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.path_){}
+    , decltype(_impl_.recursive_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 RemoveRequest::~RemoveRequest() {
   // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.RemoveRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void RemoveRequest::SharedDtor() {
-  path_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void RemoveRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.path_.Destroy();
 }
 
 void RemoveRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const RemoveRequest& RemoveRequest::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_RemoveRequest.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void RemoveRequest::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.RemoveRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  _internal_metadata_.Clear();
-}
-
-bool RemoveRequest::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.RemoveRequest)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.path_.ClearToEmpty();
+  _impl_.recursive_ = false;
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* RemoveRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string path = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_path()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->path().data(), static_cast<int>(this->path().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "aspia.proto.file_transfer.RemoveRequest.path"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool recursive = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.recursive_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.RemoveRequest)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.RemoveRequest)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void RemoveRequest::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.RemoveRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* RemoveRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.file_transfer.RemoveRequest)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string path = 1;
-  if (this->path().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->path().data(), static_cast<int>(this->path().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_path().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_path().data(), static_cast<int>(this->_internal_path().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "aspia.proto.file_transfer.RemoveRequest.path");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->path(), output);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_path(), target);
+  }
+
+  // bool recursive = 2;
+  if (this->_internal_recursive() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_recursive(), target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.RemoveRequest)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.file_transfer.RemoveRequest)
+  return target;
 }
 
 size_t RemoveRequest::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.RemoveRequest)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // string path = 1;
-  if (this->path().size() > 0) {
+  if (!this->_internal_path().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->path());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_path());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  // bool recursive = 2;
+  if (this->_internal_recursive() != 0) {
+    total_size += 1 + 1;
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void RemoveRequest::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const RemoveRequest*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const RemoveRequest*>(
+      &from));
 }
 
 void RemoveRequest::MergeFrom(const RemoveRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.RemoveRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  RemoveRequest* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.RemoveRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.path().size() > 0) {
-
-    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
+  if (!from._internal_path().empty()) {
+    _this->_internal_set_path(from._internal_path());
+  }
+  if (from._internal_recursive() != 0) {
+    _this->_internal_set_recursive(from._internal_recursive());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void RemoveRequest::CopyFrom(const RemoveRequest& from) {
@@ -3169,301 +5331,1026 @@ bool RemoveRequest::IsInitialized() const {
   return true;
 }
 
-void RemoveRequest::Swap(RemoveRequest* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void RemoveRequest::InternalSwap(RemoveRequest* other) {
   using std::swap;
-  path_.Swap(&other->path_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.path_, lhs_arena,
+      &other->_impl_.path_, rhs_arena
+  );
+  swap(_impl_.recursive_, other->_impl_.recursive_);
 }
 
-::std::string RemoveRequest::GetTypeName() const {
+std::string RemoveRequest::GetTypeName() const {
   return "aspia.proto.file_transfer.RemoveRequest";
 }
 
 
 // ===================================================================
 
-void Reply::InitAsDefaultInstance() {
-  ::aspia::proto::file_transfer::_Reply_default_instance_._instance.get_mutable()->drive_list_ = const_cast< ::aspia::proto::file_transfer::DriveList*>(
-      ::aspia::proto::file_transfer::DriveList::internal_default_instance());
-  ::aspia::proto::file_transfer::_Reply_default_instance_._instance.get_mutable()->file_list_ = const_cast< ::aspia::proto::file_transfer::FileList*>(
-      ::aspia::proto::file_transfer::FileList::internal_default_instance());
-  ::aspia::proto::file_transfer::_Reply_default_instance_._instance.get_mutable()->packet_ = const_cast< ::aspia::proto::file_transfer::Packet*>(
-      ::aspia::proto::file_transfer::Packet::internal_default_instance());
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Reply::kStatusFieldNumber;
-const int Reply::kDriveListFieldNumber;
-const int Reply::kFileListFieldNumber;
-const int Reply::kPacketFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-Reply::Reply()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_Reply.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.Reply)
+class RemoteCopyRequest::_Internal {
+ public:
+};
+
+RemoteCopyRequest::RemoteCopyRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.file_transfer.RemoteCopyRequest)
+}
+RemoteCopyRequest::RemoteCopyRequest(const RemoteCopyRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  RemoteCopyRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.path_){}
+    , decltype(_impl_.target_address_){}
+    , decltype(_impl_.target_user_name_){}
+    , decltype(_impl_.target_password_){}
+    , decltype(_impl_.target_path_){}
+    , decltype(_impl_.target_port_){}
+    , decltype(_impl_.overwrite_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_path().empty()) {
+    _this->_impl_.path_.Set(from._internal_path(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.target_address_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.target_address_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_target_address().empty()) {
+    _this->_impl_.target_address_.Set(from._internal_target_address(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.target_user_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.target_user_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_target_user_name().empty()) {
+    _this->_impl_.target_user_name_.Set(from._internal_target_user_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.target_password_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.target_password_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_target_password().empty()) {
+    _this->_impl_.target_password_.Set(from._internal_target_password(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.target_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.target_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_target_path().empty()) {
+    _this->_impl_.target_path_.Set(from._internal_target_path(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.target_port_, &from._impl_.target_port_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.overwrite_) -
+    reinterpret_cast<char*>(&_impl_.target_port_)) + sizeof(_impl_.overwrite_));
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.RemoteCopyRequest)
+}
+
+inline void RemoteCopyRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.path_){}
+    , decltype(_impl_.target_address_){}
+    , decltype(_impl_.target_user_name_){}
+    , decltype(_impl_.target_password_){}
+    , decltype(_impl_.target_path_){}
+    , decltype(_impl_.target_port_){0u}
+    , decltype(_impl_.overwrite_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.target_address_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.target_address_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.target_user_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.target_user_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.target_password_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.target_password_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.target_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.target_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+RemoteCopyRequest::~RemoteCopyRequest() {
+  // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.RemoteCopyRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RemoteCopyRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.path_.Destroy();
+  _impl_.target_address_.Destroy();
+  _impl_.target_user_name_.Destroy();
+  _impl_.target_password_.Destroy();
+  _impl_.target_path_.Destroy();
+}
+
+void RemoteCopyRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RemoteCopyRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.RemoteCopyRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.path_.ClearToEmpty();
+  _impl_.target_address_.ClearToEmpty();
+  _impl_.target_user_name_.ClearToEmpty();
+  _impl_.target_password_.ClearToEmpty();
+  _impl_.target_path_.ClearToEmpty();
+  ::memset(&_impl_.target_port_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.overwrite_) -
+      reinterpret_cast<char*>(&_impl_.target_port_)) + sizeof(_impl_.overwrite_));
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* RemoteCopyRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string path = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // string target_address = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_target_address();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 target_port = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.target_port_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string target_user_name = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_target_user_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // string target_password = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_target_password();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // string target_path = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_target_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool overwrite = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.overwrite_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RemoteCopyRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.file_transfer.RemoteCopyRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string path = 1;
+  if (!this->_internal_path().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_path().data(), static_cast<int>(this->_internal_path().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "aspia.proto.file_transfer.RemoteCopyRequest.path");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_path(), target);
+  }
+
+  // string target_address = 2;
+  if (!this->_internal_target_address().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_target_address().data(), static_cast<int>(this->_internal_target_address().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "aspia.proto.file_transfer.RemoteCopyRequest.target_address");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_target_address(), target);
+  }
+
+  // uint32 target_port = 3;
+  if (this->_internal_target_port() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_target_port(), target);
+  }
+
+  // string target_user_name = 4;
+  if (!this->_internal_target_user_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_target_user_name().data(), static_cast<int>(this->_internal_target_user_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "aspia.proto.file_transfer.RemoteCopyRequest.target_user_name");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_target_user_name(), target);
+  }
+
+  // string target_password = 5;
+  if (!this->_internal_target_password().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_target_password().data(), static_cast<int>(this->_internal_target_password().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "aspia.proto.file_transfer.RemoteCopyRequest.target_password");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_target_password(), target);
+  }
+
+  // string target_path = 6;
+  if (!this->_internal_target_path().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_target_path().data(), static_cast<int>(this->_internal_target_path().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "aspia.proto.file_transfer.RemoteCopyRequest.target_path");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_target_path(), target);
+  }
+
+  // bool overwrite = 7;
+  if (this->_internal_overwrite() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_overwrite(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.file_transfer.RemoteCopyRequest)
+  return target;
+}
+
+size_t RemoteCopyRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.RemoteCopyRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string path = 1;
+  if (!this->_internal_path().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_path());
+  }
+
+  // string target_address = 2;
+  if (!this->_internal_target_address().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_target_address());
+  }
+
+  // string target_user_name = 4;
+  if (!this->_internal_target_user_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_target_user_name());
+  }
+
+  // string target_password = 5;
+  if (!this->_internal_target_password().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_target_password());
+  }
+
+  // string target_path = 6;
+  if (!this->_internal_target_path().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_target_path());
+  }
+
+  // uint32 target_port = 3;
+  if (this->_internal_target_port() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_target_port());
+  }
+
+  // bool overwrite = 7;
+  if (this->_internal_overwrite() != 0) {
+    total_size += 1 + 1;
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void RemoteCopyRequest::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const RemoteCopyRequest*>(
+      &from));
+}
+
+void RemoteCopyRequest::MergeFrom(const RemoteCopyRequest& from) {
+  RemoteCopyRequest* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.RemoteCopyRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_path().empty()) {
+    _this->_internal_set_path(from._internal_path());
+  }
+  if (!from._internal_target_address().empty()) {
+    _this->_internal_set_target_address(from._internal_target_address());
+  }
+  if (!from._internal_target_user_name().empty()) {
+    _this->_internal_set_target_user_name(from._internal_target_user_name());
+  }
+  if (!from._internal_target_password().empty()) {
+    _this->_internal_set_target_password(from._internal_target_password());
+  }
+  if (!from._internal_target_path().empty()) {
+    _this->_internal_set_target_path(from._internal_target_path());
+  }
+  if (from._internal_target_port() != 0) {
+    _this->_internal_set_target_port(from._internal_target_port());
+  }
+  if (from._internal_overwrite() != 0) {
+    _this->_internal_set_overwrite(from._internal_overwrite());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void RemoteCopyRequest::CopyFrom(const RemoteCopyRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.file_transfer.RemoteCopyRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RemoteCopyRequest::IsInitialized() const {
+  return true;
+}
+
+void RemoteCopyRequest::InternalSwap(RemoteCopyRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.path_, lhs_arena,
+      &other->_impl_.path_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.target_address_, lhs_arena,
+      &other->_impl_.target_address_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.target_user_name_, lhs_arena,
+      &other->_impl_.target_user_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.target_password_, lhs_arena,
+      &other->_impl_.target_password_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.target_path_, lhs_arena,
+      &other->_impl_.target_path_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RemoteCopyRequest, _impl_.overwrite_)
+      + sizeof(RemoteCopyRequest::_impl_.overwrite_)
+      - PROTOBUF_FIELD_OFFSET(RemoteCopyRequest, _impl_.target_port_)>(
+          reinterpret_cast<char*>(&_impl_.target_port_),
+          reinterpret_cast<char*>(&other->_impl_.target_port_));
+}
+
+std::string RemoteCopyRequest::GetTypeName() const {
+  return "aspia.proto.file_transfer.RemoteCopyRequest";
+}
+
+
+// ===================================================================
+
+class Reply::_Internal {
+ public:
+  static const ::aspia::proto::file_transfer::DriveList& drive_list(const Reply* msg);
+  static const ::aspia::proto::file_transfer::FileList& file_list(const Reply* msg);
+  static const ::aspia::proto::file_transfer::Packet& packet(const Reply* msg);
+  static const ::aspia::proto::file_transfer::PartialFile& partial_file(const Reply* msg);
+  static const ::aspia::proto::file_transfer::FileSignature& signature(const Reply* msg);
+};
+
+const ::aspia::proto::file_transfer::DriveList&
+Reply::_Internal::drive_list(const Reply* msg) {
+  return *msg->_impl_.drive_list_;
+}
+const ::aspia::proto::file_transfer::FileList&
+Reply::_Internal::file_list(const Reply* msg) {
+  return *msg->_impl_.file_list_;
+}
+const ::aspia::proto::file_transfer::Packet&
+Reply::_Internal::packet(const Reply* msg) {
+  return *msg->_impl_.packet_;
+}
+const ::aspia::proto::file_transfer::PartialFile&
+Reply::_Internal::partial_file(const Reply* msg) {
+  return *msg->_impl_.partial_file_;
+}
+const ::aspia::proto::file_transfer::FileSignature&
+Reply::_Internal::signature(const Reply* msg) {
+  return *msg->_impl_.signature_;
+}
+Reply::Reply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.file_transfer.Reply)
 }
 Reply::Reply(const Reply& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.has_drive_list()) {
-    drive_list_ = new ::aspia::proto::file_transfer::DriveList(*from.drive_list_);
-  } else {
-    drive_list_ = NULL;
-  }
-  if (from.has_file_list()) {
-    file_list_ = new ::aspia::proto::file_transfer::FileList(*from.file_list_);
-  } else {
-    file_list_ = NULL;
-  }
-  if (from.has_packet()) {
-    packet_ = new ::aspia::proto::file_transfer::Packet(*from.packet_);
-  } else {
-    packet_ = NULL;
-  }
-  status_ = from.status_;
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  Reply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.existing_files_){from._impl_.existing_files_}
+    , decltype(_impl_.failed_files_){from._impl_.failed_files_}
+    , decltype(_impl_.error_string_){}
+    , decltype(_impl_.drive_list_){nullptr}
+    , decltype(_impl_.file_list_){nullptr}
+    , decltype(_impl_.packet_){nullptr}
+    , decltype(_impl_.partial_file_){nullptr}
+    , decltype(_impl_.signature_){nullptr}
+    , decltype(_impl_.status_){}
+    , decltype(_impl_.zero_ranges_){}
+    , decltype(_impl_.request_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.error_string_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_string_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_error_string().empty()) {
+    _this->_impl_.error_string_.Set(from._internal_error_string(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_drive_list()) {
+    _this->_impl_.drive_list_ = new ::aspia::proto::file_transfer::DriveList(*from._impl_.drive_list_);
+  }
+  if (from._internal_has_file_list()) {
+    _this->_impl_.file_list_ = new ::aspia::proto::file_transfer::FileList(*from._impl_.file_list_);
+  }
+  if (from._internal_has_packet()) {
+    _this->_impl_.packet_ = new ::aspia::proto::file_transfer::Packet(*from._impl_.packet_);
+  }
+  if (from._internal_has_partial_file()) {
+    _this->_impl_.partial_file_ = new ::aspia::proto::file_transfer::PartialFile(*from._impl_.partial_file_);
+  }
+  if (from._internal_has_signature()) {
+    _this->_impl_.signature_ = new ::aspia::proto::file_transfer::FileSignature(*from._impl_.signature_);
+  }
+  ::memcpy(&_impl_.status_, &from._impl_.status_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.request_id_) -
+    reinterpret_cast<char*>(&_impl_.status_)) + sizeof(_impl_.request_id_));
   // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.Reply)
 }
 
-void Reply::SharedCtor() {
-  ::memset(&drive_list_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&status_) -
-      reinterpret_cast<char*>(&drive_list_)) + sizeof(status_));
+inline void Reply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.existing_files_){arena}
+    , decltype(_impl_.failed_files_){arena}
+    , decltype(_impl_.error_string_){}
+    , decltype(_impl_.drive_list_){nullptr}
+    , decltype(_impl_.file_list_){nullptr}
+    , decltype(_impl_.packet_){nullptr}
+    , decltype(_impl_.partial_file_){nullptr}
+    , decltype(_impl_.signature_){nullptr}
+    , decltype(_impl_.status_){0}
+    , decltype(_impl_.zero_ranges_){false}
+    , decltype(_impl_.request_id_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.error_string_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_string_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Reply::~Reply() {
   // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.Reply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Reply::SharedDtor() {
-  if (this != internal_default_instance()) delete drive_list_;
-  if (this != internal_default_instance()) delete file_list_;
-  if (this != internal_default_instance()) delete packet_;
+inline void Reply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.existing_files_.~RepeatedPtrField();
+  _impl_.failed_files_.~RepeatedPtrField();
+  _impl_.error_string_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.drive_list_;
+  if (this != internal_default_instance()) delete _impl_.file_list_;
+  if (this != internal_default_instance()) delete _impl_.packet_;
+  if (this != internal_default_instance()) delete _impl_.partial_file_;
+  if (this != internal_default_instance()) delete _impl_.signature_;
 }
 
 void Reply::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Reply& Reply::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_Reply.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void Reply::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.Reply)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaNoVirtual() == NULL && drive_list_ != NULL) {
-    delete drive_list_;
-  }
-  drive_list_ = NULL;
-  if (GetArenaNoVirtual() == NULL && file_list_ != NULL) {
-    delete file_list_;
-  }
-  file_list_ = NULL;
-  if (GetArenaNoVirtual() == NULL && packet_ != NULL) {
-    delete packet_;
-  }
-  packet_ = NULL;
-  status_ = 0;
-  _internal_metadata_.Clear();
-}
-
-bool Reply::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.Reply)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.existing_files_.Clear();
+  _impl_.failed_files_.Clear();
+  _impl_.error_string_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.drive_list_ != nullptr) {
+    delete _impl_.drive_list_;
+  }
+  _impl_.drive_list_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.file_list_ != nullptr) {
+    delete _impl_.file_list_;
+  }
+  _impl_.file_list_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.packet_ != nullptr) {
+    delete _impl_.packet_;
+  }
+  _impl_.packet_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.partial_file_ != nullptr) {
+    delete _impl_.partial_file_;
+  }
+  _impl_.partial_file_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.signature_ != nullptr) {
+    delete _impl_.signature_;
+  }
+  _impl_.signature_ = nullptr;
+  ::memset(&_impl_.status_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.request_id_) -
+      reinterpret_cast<char*>(&_impl_.status_)) + sizeof(_impl_.request_id_));
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* Reply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // .aspia.proto.file_transfer.Status status = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_status(static_cast< ::aspia::proto::file_transfer::Status >(value));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_status(static_cast<::aspia::proto::file_transfer::Status>(val));
+        } else
+          goto handle_unusual;
+        continue;
       // .aspia.proto.file_transfer.DriveList drive_list = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_drive_list()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_drive_list(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .aspia.proto.file_transfer.FileList file_list = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_file_list()));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_file_list(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .aspia.proto.file_transfer.Packet packet = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_packet()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_packet(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .aspia.proto.file_transfer.PartialFile partial_file = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_partial_file(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .aspia.proto.file_transfer.FileSignature signature = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_signature(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool zero_ranges = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.zero_ranges_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 request_id = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.request_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string error_string = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          auto str = _internal_mutable_error_string();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string existing_files = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_existing_files();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, nullptr));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<82>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string failed_files = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_failed_files();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, nullptr));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<90>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.Reply)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.Reply)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void Reply::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.Reply)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* Reply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.file_transfer.Reply)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .aspia.proto.file_transfer.Status status = 1;
-  if (this->status() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->status(), output);
+  if (this->_internal_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_status(), target);
   }
 
   // .aspia.proto.file_transfer.DriveList drive_list = 2;
-  if (this->has_drive_list()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      2, this->_internal_drive_list(), output);
+  if (this->_internal_has_drive_list()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::drive_list(this),
+        _Internal::drive_list(this).GetCachedSize(), target, stream);
   }
 
   // .aspia.proto.file_transfer.FileList file_list = 3;
-  if (this->has_file_list()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      3, this->_internal_file_list(), output);
+  if (this->_internal_has_file_list()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::file_list(this),
+        _Internal::file_list(this).GetCachedSize(), target, stream);
   }
 
   // .aspia.proto.file_transfer.Packet packet = 4;
-  if (this->has_packet()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      4, this->_internal_packet(), output);
+  if (this->_internal_has_packet()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::packet(this),
+        _Internal::packet(this).GetCachedSize(), target, stream);
+  }
+
+  // .aspia.proto.file_transfer.PartialFile partial_file = 5;
+  if (this->_internal_has_partial_file()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::partial_file(this),
+        _Internal::partial_file(this).GetCachedSize(), target, stream);
+  }
+
+  // .aspia.proto.file_transfer.FileSignature signature = 6;
+  if (this->_internal_has_signature()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::signature(this),
+        _Internal::signature(this).GetCachedSize(), target, stream);
+  }
+
+  // bool zero_ranges = 7;
+  if (this->_internal_zero_ranges() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_zero_ranges(), target);
+  }
+
+  // uint64 request_id = 8;
+  if (this->_internal_request_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_request_id(), target);
+  }
+
+  // string error_string = 9;
+  if (!this->_internal_error_string().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error_string().data(), static_cast<int>(this->_internal_error_string().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "aspia.proto.file_transfer.Reply.error_string");
+    target = stream->WriteStringMaybeAliased(
+        9, this->_internal_error_string(), target);
+  }
+
+  // repeated string existing_files = 10;
+  for (int i = 0, n = this->_internal_existing_files_size(); i < n; i++) {
+    const auto& s = this->_internal_existing_files(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "aspia.proto.file_transfer.Reply.existing_files");
+    target = stream->WriteString(10, s, target);
+  }
+
+  // repeated string failed_files = 11;
+  for (int i = 0, n = this->_internal_failed_files_size(); i < n; i++) {
+    const auto& s = this->_internal_failed_files(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "aspia.proto.file_transfer.Reply.failed_files");
+    target = stream->WriteString(11, s, target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.Reply)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.file_transfer.Reply)
+  return target;
 }
 
 size_t Reply::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.Reply)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string existing_files = 10;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.existing_files_.size());
+  for (int i = 0, n = _impl_.existing_files_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.existing_files_.Get(i));
+  }
+
+  // repeated string failed_files = 11;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.failed_files_.size());
+  for (int i = 0, n = _impl_.failed_files_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.failed_files_.Get(i));
+  }
+
+  // string error_string = 9;
+  if (!this->_internal_error_string().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_error_string());
+  }
 
   // .aspia.proto.file_transfer.DriveList drive_list = 2;
-  if (this->has_drive_list()) {
+  if (this->_internal_has_drive_list()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *drive_list_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.drive_list_);
   }
 
   // .aspia.proto.file_transfer.FileList file_list = 3;
-  if (this->has_file_list()) {
+  if (this->_internal_has_file_list()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *file_list_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.file_list_);
   }
 
   // .aspia.proto.file_transfer.Packet packet = 4;
-  if (this->has_packet()) {
+  if (this->_internal_has_packet()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.packet_);
+  }
+
+  // .aspia.proto.file_transfer.PartialFile partial_file = 5;
+  if (this->_internal_has_partial_file()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.partial_file_);
+  }
+
+  // .aspia.proto.file_transfer.FileSignature signature = 6;
+  if (this->_internal_has_signature()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *packet_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.signature_);
   }
 
   // .aspia.proto.file_transfer.Status status = 1;
-  if (this->status() != 0) {
+  if (this->_internal_status() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->status());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+  }
+
+  // bool zero_ranges = 7;
+  if (this->_internal_zero_ranges() != 0) {
+    total_size += 1 + 1;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  // uint64 request_id = 8;
+  if (this->_internal_request_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_request_id());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void Reply::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const Reply*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const Reply*>(
+      &from));
 }
 
 void Reply::MergeFrom(const Reply& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.Reply)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  Reply* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.Reply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.has_drive_list()) {
-    mutable_drive_list()->::aspia::proto::file_transfer::DriveList::MergeFrom(from.drive_list());
+  _this->_impl_.existing_files_.MergeFrom(from._impl_.existing_files_);
+  _this->_impl_.failed_files_.MergeFrom(from._impl_.failed_files_);
+  if (!from._internal_error_string().empty()) {
+    _this->_internal_set_error_string(from._internal_error_string());
+  }
+  if (from._internal_has_drive_list()) {
+    _this->_internal_mutable_drive_list()->::aspia::proto::file_transfer::DriveList::MergeFrom(
+        from._internal_drive_list());
+  }
+  if (from._internal_has_file_list()) {
+    _this->_internal_mutable_file_list()->::aspia::proto::file_transfer::FileList::MergeFrom(
+        from._internal_file_list());
+  }
+  if (from._internal_has_packet()) {
+    _this->_internal_mutable_packet()->::aspia::proto::file_transfer::Packet::MergeFrom(
+        from._internal_packet());
+  }
+  if (from._internal_has_partial_file()) {
+    _this->_internal_mutable_partial_file()->::aspia::proto::file_transfer::PartialFile::MergeFrom(
+        from._internal_partial_file());
+  }
+  if (from._internal_has_signature()) {
+    _this->_internal_mutable_signature()->::aspia::proto::file_transfer::FileSignature::MergeFrom(
+        from._internal_signature());
   }
-  if (from.has_file_list()) {
-    mutable_file_list()->::aspia::proto::file_transfer::FileList::MergeFrom(from.file_list());
+  if (from._internal_status() != 0) {
+    _this->_internal_set_status(from._internal_status());
   }
-  if (from.has_packet()) {
-    mutable_packet()->::aspia::proto::file_transfer::Packet::MergeFrom(from.packet());
+  if (from._internal_zero_ranges() != 0) {
+    _this->_internal_set_zero_ranges(from._internal_zero_ranges());
   }
-  if (from.status() != 0) {
-    set_status(from.status());
+  if (from._internal_request_id() != 0) {
+    _this->_internal_set_request_id(from._internal_request_id());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void Reply::CopyFrom(const Reply& from) {
@@ -3477,516 +6364,596 @@ bool Reply::IsInitialized() const {
   return true;
 }
 
-void Reply::Swap(Reply* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void Reply::InternalSwap(Reply* other) {
   using std::swap;
-  swap(drive_list_, other->drive_list_);
-  swap(file_list_, other->file_list_);
-  swap(packet_, other->packet_);
-  swap(status_, other->status_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-}
-
-::std::string Reply::GetTypeName() const {
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.existing_files_.InternalSwap(&other->_impl_.existing_files_);
+  _impl_.failed_files_.InternalSwap(&other->_impl_.failed_files_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_string_, lhs_arena,
+      &other->_impl_.error_string_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Reply, _impl_.request_id_)
+      + sizeof(Reply::_impl_.request_id_)
+      - PROTOBUF_FIELD_OFFSET(Reply, _impl_.drive_list_)>(
+          reinterpret_cast<char*>(&_impl_.drive_list_),
+          reinterpret_cast<char*>(&other->_impl_.drive_list_));
+}
+
+std::string Reply::GetTypeName() const {
   return "aspia.proto.file_transfer.Reply";
 }
 
 
 // ===================================================================
 
-void Request::InitAsDefaultInstance() {
-  ::aspia::proto::file_transfer::_Request_default_instance_._instance.get_mutable()->drive_list_request_ = const_cast< ::aspia::proto::file_transfer::DriveListRequest*>(
-      ::aspia::proto::file_transfer::DriveListRequest::internal_default_instance());
-  ::aspia::proto::file_transfer::_Request_default_instance_._instance.get_mutable()->file_list_request_ = const_cast< ::aspia::proto::file_transfer::FileListRequest*>(
-      ::aspia::proto::file_transfer::FileListRequest::internal_default_instance());
-  ::aspia::proto::file_transfer::_Request_default_instance_._instance.get_mutable()->create_directory_request_ = const_cast< ::aspia::proto::file_transfer::CreateDirectoryRequest*>(
-      ::aspia::proto::file_transfer::CreateDirectoryRequest::internal_default_instance());
-  ::aspia::proto::file_transfer::_Request_default_instance_._instance.get_mutable()->rename_request_ = const_cast< ::aspia::proto::file_transfer::RenameRequest*>(
-      ::aspia::proto::file_transfer::RenameRequest::internal_default_instance());
-  ::aspia::proto::file_transfer::_Request_default_instance_._instance.get_mutable()->remove_request_ = const_cast< ::aspia::proto::file_transfer::RemoveRequest*>(
-      ::aspia::proto::file_transfer::RemoveRequest::internal_default_instance());
-  ::aspia::proto::file_transfer::_Request_default_instance_._instance.get_mutable()->download_request_ = const_cast< ::aspia::proto::file_transfer::DownloadRequest*>(
-      ::aspia::proto::file_transfer::DownloadRequest::internal_default_instance());
-  ::aspia::proto::file_transfer::_Request_default_instance_._instance.get_mutable()->upload_request_ = const_cast< ::aspia::proto::file_transfer::UploadRequest*>(
-      ::aspia::proto::file_transfer::UploadRequest::internal_default_instance());
-  ::aspia::proto::file_transfer::_Request_default_instance_._instance.get_mutable()->packet_request_ = const_cast< ::aspia::proto::file_transfer::PacketRequest*>(
-      ::aspia::proto::file_transfer::PacketRequest::internal_default_instance());
-  ::aspia::proto::file_transfer::_Request_default_instance_._instance.get_mutable()->packet_ = const_cast< ::aspia::proto::file_transfer::Packet*>(
-      ::aspia::proto::file_transfer::Packet::internal_default_instance());
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Request::kDriveListRequestFieldNumber;
-const int Request::kFileListRequestFieldNumber;
-const int Request::kCreateDirectoryRequestFieldNumber;
-const int Request::kRenameRequestFieldNumber;
-const int Request::kRemoveRequestFieldNumber;
-const int Request::kDownloadRequestFieldNumber;
-const int Request::kUploadRequestFieldNumber;
-const int Request::kPacketRequestFieldNumber;
-const int Request::kPacketFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-Request::Request()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_file_5ftransfer_5fsession_2eproto::scc_info_Request.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.file_transfer.Request)
+class Request::_Internal {
+ public:
+  static const ::aspia::proto::file_transfer::DriveListRequest& drive_list_request(const Request* msg);
+  static const ::aspia::proto::file_transfer::FileListRequest& file_list_request(const Request* msg);
+  static const ::aspia::proto::file_transfer::CreateDirectoryRequest& create_directory_request(const Request* msg);
+  static const ::aspia::proto::file_transfer::RenameRequest& rename_request(const Request* msg);
+  static const ::aspia::proto::file_transfer::RemoveRequest& remove_request(const Request* msg);
+  static const ::aspia::proto::file_transfer::DownloadRequest& download_request(const Request* msg);
+  static const ::aspia::proto::file_transfer::UploadRequest& upload_request(const Request* msg);
+  static const ::aspia::proto::file_transfer::PacketRequest& packet_request(const Request* msg);
+  static const ::aspia::proto::file_transfer::Packet& packet(const Request* msg);
+  static const ::aspia::proto::file_transfer::RemoteCopyRequest& remote_copy_request(const Request* msg);
+};
+
+const ::aspia::proto::file_transfer::DriveListRequest&
+Request::_Internal::drive_list_request(const Request* msg) {
+  return *msg->_impl_.drive_list_request_;
+}
+const ::aspia::proto::file_transfer::FileListRequest&
+Request::_Internal::file_list_request(const Request* msg) {
+  return *msg->_impl_.file_list_request_;
+}
+const ::aspia::proto::file_transfer::CreateDirectoryRequest&
+Request::_Internal::create_directory_request(const Request* msg) {
+  return *msg->_impl_.create_directory_request_;
+}
+const ::aspia::proto::file_transfer::RenameRequest&
+Request::_Internal::rename_request(const Request* msg) {
+  return *msg->_impl_.rename_request_;
+}
+const ::aspia::proto::file_transfer::RemoveRequest&
+Request::_Internal::remove_request(const Request* msg) {
+  return *msg->_impl_.remove_request_;
+}
+const ::aspia::proto::file_transfer::DownloadRequest&
+Request::_Internal::download_request(const Request* msg) {
+  return *msg->_impl_.download_request_;
+}
+const ::aspia::proto::file_transfer::UploadRequest&
+Request::_Internal::upload_request(const Request* msg) {
+  return *msg->_impl_.upload_request_;
+}
+const ::aspia::proto::file_transfer::PacketRequest&
+Request::_Internal::packet_request(const Request* msg) {
+  return *msg->_impl_.packet_request_;
+}
+const ::aspia::proto::file_transfer::Packet&
+Request::_Internal::packet(const Request* msg) {
+  return *msg->_impl_.packet_;
+}
+const ::aspia::proto::file_transfer::RemoteCopyRequest&
+Request::_Internal::remote_copy_request(const Request* msg) {
+  return *msg->_impl_.remote_copy_request_;
+}
+Request::Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.file_transfer.Request)
 }
 Request::Request(const Request& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.has_drive_list_request()) {
-    drive_list_request_ = new ::aspia::proto::file_transfer::DriveListRequest(*from.drive_list_request_);
-  } else {
-    drive_list_request_ = NULL;
-  }
-  if (from.has_file_list_request()) {
-    file_list_request_ = new ::aspia::proto::file_transfer::FileListRequest(*from.file_list_request_);
-  } else {
-    file_list_request_ = NULL;
-  }
-  if (from.has_create_directory_request()) {
-    create_directory_request_ = new ::aspia::proto::file_transfer::CreateDirectoryRequest(*from.create_directory_request_);
-  } else {
-    create_directory_request_ = NULL;
-  }
-  if (from.has_rename_request()) {
-    rename_request_ = new ::aspia::proto::file_transfer::RenameRequest(*from.rename_request_);
-  } else {
-    rename_request_ = NULL;
-  }
-  if (from.has_remove_request()) {
-    remove_request_ = new ::aspia::proto::file_transfer::RemoveRequest(*from.remove_request_);
-  } else {
-    remove_request_ = NULL;
-  }
-  if (from.has_download_request()) {
-    download_request_ = new ::aspia::proto::file_transfer::DownloadRequest(*from.download_request_);
-  } else {
-    download_request_ = NULL;
-  }
-  if (from.has_upload_request()) {
-    upload_request_ = new ::aspia::proto::file_transfer::UploadRequest(*from.upload_request_);
-  } else {
-    upload_request_ = NULL;
-  }
-  if (from.has_packet_request()) {
-    packet_request_ = new ::aspia::proto::file_transfer::PacketRequest(*from.packet_request_);
-  } else {
-    packet_request_ = NULL;
-  }
-  if (from.has_packet()) {
-    packet_ = new ::aspia::proto::file_transfer::Packet(*from.packet_);
-  } else {
-    packet_ = NULL;
-  }
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  Request* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.drive_list_request_){nullptr}
+    , decltype(_impl_.file_list_request_){nullptr}
+    , decltype(_impl_.create_directory_request_){nullptr}
+    , decltype(_impl_.rename_request_){nullptr}
+    , decltype(_impl_.remove_request_){nullptr}
+    , decltype(_impl_.download_request_){nullptr}
+    , decltype(_impl_.upload_request_){nullptr}
+    , decltype(_impl_.packet_request_){nullptr}
+    , decltype(_impl_.packet_){nullptr}
+    , decltype(_impl_.remote_copy_request_){nullptr}
+    , decltype(_impl_.request_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  if (from._internal_has_drive_list_request()) {
+    _this->_impl_.drive_list_request_ = new ::aspia::proto::file_transfer::DriveListRequest(*from._impl_.drive_list_request_);
+  }
+  if (from._internal_has_file_list_request()) {
+    _this->_impl_.file_list_request_ = new ::aspia::proto::file_transfer::FileListRequest(*from._impl_.file_list_request_);
+  }
+  if (from._internal_has_create_directory_request()) {
+    _this->_impl_.create_directory_request_ = new ::aspia::proto::file_transfer::CreateDirectoryRequest(*from._impl_.create_directory_request_);
+  }
+  if (from._internal_has_rename_request()) {
+    _this->_impl_.rename_request_ = new ::aspia::proto::file_transfer::RenameRequest(*from._impl_.rename_request_);
+  }
+  if (from._internal_has_remove_request()) {
+    _this->_impl_.remove_request_ = new ::aspia::proto::file_transfer::RemoveRequest(*from._impl_.remove_request_);
+  }
+  if (from._internal_has_download_request()) {
+    _this->_impl_.download_request_ = new ::aspia::proto::file_transfer::DownloadRequest(*from._impl_.download_request_);
+  }
+  if (from._internal_has_upload_request()) {
+    _this->_impl_.upload_request_ = new ::aspia::proto::file_transfer::UploadRequest(*from._impl_.upload_request_);
+  }
+  if (from._internal_has_packet_request()) {
+    _this->_impl_.packet_request_ = new ::aspia::proto::file_transfer::PacketRequest(*from._impl_.packet_request_);
+  }
+  if (from._internal_has_packet()) {
+    _this->_impl_.packet_ = new ::aspia::proto::file_transfer::Packet(*from._impl_.packet_);
+  }
+  if (from._internal_has_remote_copy_request()) {
+    _this->_impl_.remote_copy_request_ = new ::aspia::proto::file_transfer::RemoteCopyRequest(*from._impl_.remote_copy_request_);
+  }
+  _this->_impl_.request_id_ = from._impl_.request_id_;
   // @@protoc_insertion_point(copy_constructor:aspia.proto.file_transfer.Request)
 }
 
-void Request::SharedCtor() {
-  ::memset(&drive_list_request_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&packet_) -
-      reinterpret_cast<char*>(&drive_list_request_)) + sizeof(packet_));
+inline void Request::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.drive_list_request_){nullptr}
+    , decltype(_impl_.file_list_request_){nullptr}
+    , decltype(_impl_.create_directory_request_){nullptr}
+    , decltype(_impl_.rename_request_){nullptr}
+    , decltype(_impl_.remove_request_){nullptr}
+    , decltype(_impl_.download_request_){nullptr}
+    , decltype(_impl_.upload_request_){nullptr}
+    , decltype(_impl_.packet_request_){nullptr}
+    , decltype(_impl_.packet_){nullptr}
+    , decltype(_impl_.remote_copy_request_){nullptr}
+    , decltype(_impl_.request_id_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 Request::~Request() {
   // @@protoc_insertion_point(destructor:aspia.proto.file_transfer.Request)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Request::SharedDtor() {
-  if (this != internal_default_instance()) delete drive_list_request_;
-  if (this != internal_default_instance()) delete file_list_request_;
-  if (this != internal_default_instance()) delete create_directory_request_;
-  if (this != internal_default_instance()) delete rename_request_;
-  if (this != internal_default_instance()) delete remove_request_;
-  if (this != internal_default_instance()) delete download_request_;
-  if (this != internal_default_instance()) delete upload_request_;
-  if (this != internal_default_instance()) delete packet_request_;
-  if (this != internal_default_instance()) delete packet_;
+inline void Request::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.drive_list_request_;
+  if (this != internal_default_instance()) delete _impl_.file_list_request_;
+  if (this != internal_default_instance()) delete _impl_.create_directory_request_;
+  if (this != internal_default_instance()) delete _impl_.rename_request_;
+  if (this != internal_default_instance()) delete _impl_.remove_request_;
+  if (this != internal_default_instance()) delete _impl_.download_request_;
+  if (this != internal_default_instance()) delete _impl_.upload_request_;
+  if (this != internal_default_instance()) delete _impl_.packet_request_;
+  if (this != internal_default_instance()) delete _impl_.packet_;
+  if (this != internal_default_instance()) delete _impl_.remote_copy_request_;
 }
 
 void Request::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const Request& Request::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_file_5ftransfer_5fsession_2eproto::scc_info_Request.base);
-  return *internal_default_instance();
-}
-
 
 void Request::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.file_transfer.Request)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaNoVirtual() == NULL && drive_list_request_ != NULL) {
-    delete drive_list_request_;
-  }
-  drive_list_request_ = NULL;
-  if (GetArenaNoVirtual() == NULL && file_list_request_ != NULL) {
-    delete file_list_request_;
-  }
-  file_list_request_ = NULL;
-  if (GetArenaNoVirtual() == NULL && create_directory_request_ != NULL) {
-    delete create_directory_request_;
-  }
-  create_directory_request_ = NULL;
-  if (GetArenaNoVirtual() == NULL && rename_request_ != NULL) {
-    delete rename_request_;
-  }
-  rename_request_ = NULL;
-  if (GetArenaNoVirtual() == NULL && remove_request_ != NULL) {
-    delete remove_request_;
-  }
-  remove_request_ = NULL;
-  if (GetArenaNoVirtual() == NULL && download_request_ != NULL) {
-    delete download_request_;
-  }
-  download_request_ = NULL;
-  if (GetArenaNoVirtual() == NULL && upload_request_ != NULL) {
-    delete upload_request_;
-  }
-  upload_request_ = NULL;
-  if (GetArenaNoVirtual() == NULL && packet_request_ != NULL) {
-    delete packet_request_;
-  }
-  packet_request_ = NULL;
-  if (GetArenaNoVirtual() == NULL && packet_ != NULL) {
-    delete packet_;
-  }
-  packet_ = NULL;
-  _internal_metadata_.Clear();
-}
-
-bool Request::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.file_transfer.Request)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  if (GetArenaForAllocation() == nullptr && _impl_.drive_list_request_ != nullptr) {
+    delete _impl_.drive_list_request_;
+  }
+  _impl_.drive_list_request_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.file_list_request_ != nullptr) {
+    delete _impl_.file_list_request_;
+  }
+  _impl_.file_list_request_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.create_directory_request_ != nullptr) {
+    delete _impl_.create_directory_request_;
+  }
+  _impl_.create_directory_request_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.rename_request_ != nullptr) {
+    delete _impl_.rename_request_;
+  }
+  _impl_.rename_request_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.remove_request_ != nullptr) {
+    delete _impl_.remove_request_;
+  }
+  _impl_.remove_request_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.download_request_ != nullptr) {
+    delete _impl_.download_request_;
+  }
+  _impl_.download_request_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.upload_request_ != nullptr) {
+    delete _impl_.upload_request_;
+  }
+  _impl_.upload_request_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.packet_request_ != nullptr) {
+    delete _impl_.packet_request_;
+  }
+  _impl_.packet_request_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.packet_ != nullptr) {
+    delete _impl_.packet_;
+  }
+  _impl_.packet_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.remote_copy_request_ != nullptr) {
+    delete _impl_.remote_copy_request_;
+  }
+  _impl_.remote_copy_request_ = nullptr;
+  _impl_.request_id_ = uint64_t{0u};
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // .aspia.proto.file_transfer.DriveListRequest drive_list_request = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_drive_list_request()));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_drive_list_request(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .aspia.proto.file_transfer.FileListRequest file_list_request = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_file_list_request()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_file_list_request(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .aspia.proto.file_transfer.CreateDirectoryRequest create_directory_request = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_create_directory_request()));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_create_directory_request(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .aspia.proto.file_transfer.RenameRequest rename_request = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_rename_request()));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_rename_request(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .aspia.proto.file_transfer.RemoveRequest remove_request = 5;
-      case 5: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(42u /* 42 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_remove_request()));
-        } else {
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_remove_request(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .aspia.proto.file_transfer.DownloadRequest download_request = 6;
-      case 6: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(50u /* 50 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_download_request()));
-        } else {
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_download_request(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .aspia.proto.file_transfer.UploadRequest upload_request = 7;
-      case 7: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(58u /* 58 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_upload_request()));
-        } else {
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_upload_request(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .aspia.proto.file_transfer.PacketRequest packet_request = 8;
-      case 8: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(66u /* 66 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_packet_request()));
-        } else {
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_packet_request(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .aspia.proto.file_transfer.Packet packet = 9;
-      case 9: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(74u /* 74 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_packet()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_packet(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 request_id = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.request_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .aspia.proto.file_transfer.RemoteCopyRequest remote_copy_request = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_remote_copy_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.file_transfer.Request)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.file_transfer.Request)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void Request::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.file_transfer.Request)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* Request::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.file_transfer.Request)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .aspia.proto.file_transfer.DriveListRequest drive_list_request = 1;
-  if (this->has_drive_list_request()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      1, this->_internal_drive_list_request(), output);
+  if (this->_internal_has_drive_list_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::drive_list_request(this),
+        _Internal::drive_list_request(this).GetCachedSize(), target, stream);
   }
 
   // .aspia.proto.file_transfer.FileListRequest file_list_request = 2;
-  if (this->has_file_list_request()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      2, this->_internal_file_list_request(), output);
+  if (this->_internal_has_file_list_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::file_list_request(this),
+        _Internal::file_list_request(this).GetCachedSize(), target, stream);
   }
 
   // .aspia.proto.file_transfer.CreateDirectoryRequest create_directory_request = 3;
-  if (this->has_create_directory_request()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      3, this->_internal_create_directory_request(), output);
+  if (this->_internal_has_create_directory_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::create_directory_request(this),
+        _Internal::create_directory_request(this).GetCachedSize(), target, stream);
   }
 
   // .aspia.proto.file_transfer.RenameRequest rename_request = 4;
-  if (this->has_rename_request()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      4, this->_internal_rename_request(), output);
+  if (this->_internal_has_rename_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::rename_request(this),
+        _Internal::rename_request(this).GetCachedSize(), target, stream);
   }
 
   // .aspia.proto.file_transfer.RemoveRequest remove_request = 5;
-  if (this->has_remove_request()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      5, this->_internal_remove_request(), output);
+  if (this->_internal_has_remove_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::remove_request(this),
+        _Internal::remove_request(this).GetCachedSize(), target, stream);
   }
 
   // .aspia.proto.file_transfer.DownloadRequest download_request = 6;
-  if (this->has_download_request()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      6, this->_internal_download_request(), output);
+  if (this->_internal_has_download_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::download_request(this),
+        _Internal::download_request(this).GetCachedSize(), target, stream);
   }
 
   // .aspia.proto.file_transfer.UploadRequest upload_request = 7;
-  if (this->has_upload_request()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      7, this->_internal_upload_request(), output);
+  if (this->_internal_has_upload_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::upload_request(this),
+        _Internal::upload_request(this).GetCachedSize(), target, stream);
   }
 
   // .aspia.proto.file_transfer.PacketRequest packet_request = 8;
-  if (this->has_packet_request()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      8, this->_internal_packet_request(), output);
+  if (this->_internal_has_packet_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::packet_request(this),
+        _Internal::packet_request(this).GetCachedSize(), target, stream);
   }
 
   // .aspia.proto.file_transfer.Packet packet = 9;
-  if (this->has_packet()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      9, this->_internal_packet(), output);
+  if (this->_internal_has_packet()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::packet(this),
+        _Internal::packet(this).GetCachedSize(), target, stream);
+  }
+
+  // uint64 request_id = 10;
+  if (this->_internal_request_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(10, this->_internal_request_id(), target);
+  }
+
+  // .aspia.proto.file_transfer.RemoteCopyRequest remote_copy_request = 11;
+  if (this->_internal_has_remote_copy_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::remote_copy_request(this),
+        _Internal::remote_copy_request(this).GetCachedSize(), target, stream);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.file_transfer.Request)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.file_transfer.Request)
+  return target;
 }
 
 size_t Request::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.file_transfer.Request)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // .aspia.proto.file_transfer.DriveListRequest drive_list_request = 1;
-  if (this->has_drive_list_request()) {
+  if (this->_internal_has_drive_list_request()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *drive_list_request_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.drive_list_request_);
   }
 
   // .aspia.proto.file_transfer.FileListRequest file_list_request = 2;
-  if (this->has_file_list_request()) {
+  if (this->_internal_has_file_list_request()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *file_list_request_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.file_list_request_);
   }
 
   // .aspia.proto.file_transfer.CreateDirectoryRequest create_directory_request = 3;
-  if (this->has_create_directory_request()) {
+  if (this->_internal_has_create_directory_request()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *create_directory_request_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.create_directory_request_);
   }
 
   // .aspia.proto.file_transfer.RenameRequest rename_request = 4;
-  if (this->has_rename_request()) {
+  if (this->_internal_has_rename_request()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *rename_request_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.rename_request_);
   }
 
   // .aspia.proto.file_transfer.RemoveRequest remove_request = 5;
-  if (this->has_remove_request()) {
+  if (this->_internal_has_remove_request()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *remove_request_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.remove_request_);
   }
 
   // .aspia.proto.file_transfer.DownloadRequest download_request = 6;
-  if (this->has_download_request()) {
+  if (this->_internal_has_download_request()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *download_request_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.download_request_);
   }
 
   // .aspia.proto.file_transfer.UploadRequest upload_request = 7;
-  if (this->has_upload_request()) {
+  if (this->_internal_has_upload_request()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *upload_request_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.upload_request_);
   }
 
   // .aspia.proto.file_transfer.PacketRequest packet_request = 8;
-  if (this->has_packet_request()) {
+  if (this->_internal_has_packet_request()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *packet_request_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.packet_request_);
   }
 
   // .aspia.proto.file_transfer.Packet packet = 9;
-  if (this->has_packet()) {
+  if (this->_internal_has_packet()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *packet_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.packet_);
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  // .aspia.proto.file_transfer.RemoteCopyRequest remote_copy_request = 11;
+  if (this->_internal_has_remote_copy_request()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.remote_copy_request_);
+  }
+
+  // uint64 request_id = 10;
+  if (this->_internal_request_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_request_id());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void Request::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const Request*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const Request*>(
+      &from));
 }
 
 void Request::MergeFrom(const Request& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.Request)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  Request* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.file_transfer.Request)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.has_drive_list_request()) {
-    mutable_drive_list_request()->::aspia::proto::file_transfer::DriveListRequest::MergeFrom(from.drive_list_request());
+  if (from._internal_has_drive_list_request()) {
+    _this->_internal_mutable_drive_list_request()->::aspia::proto::file_transfer::DriveListRequest::MergeFrom(
+        from._internal_drive_list_request());
+  }
+  if (from._internal_has_file_list_request()) {
+    _this->_internal_mutable_file_list_request()->::aspia::proto::file_transfer::FileListRequest::MergeFrom(
+        from._internal_file_list_request());
+  }
+  if (from._internal_has_create_directory_request()) {
+    _this->_internal_mutable_create_directory_request()->::aspia::proto::file_transfer::CreateDirectoryRequest::MergeFrom(
+        from._internal_create_directory_request());
   }
-  if (from.has_file_list_request()) {
-    mutable_file_list_request()->::aspia::proto::file_transfer::FileListRequest::MergeFrom(from.file_list_request());
+  if (from._internal_has_rename_request()) {
+    _this->_internal_mutable_rename_request()->::aspia::proto::file_transfer::RenameRequest::MergeFrom(
+        from._internal_rename_request());
   }
-  if (from.has_create_directory_request()) {
-    mutable_create_directory_request()->::aspia::proto::file_transfer::CreateDirectoryRequest::MergeFrom(from.create_directory_request());
+  if (from._internal_has_remove_request()) {
+    _this->_internal_mutable_remove_request()->::aspia::proto::file_transfer::RemoveRequest::MergeFrom(
+        from._internal_remove_request());
   }
-  if (from.has_rename_request()) {
-    mutable_rename_request()->::aspia::proto::file_transfer::RenameRequest::MergeFrom(from.rename_request());
+  if (from._internal_has_download_request()) {
+    _this->_internal_mutable_download_request()->::aspia::proto::file_transfer::DownloadRequest::MergeFrom(
+        from._internal_download_request());
   }
-  if (from.has_remove_request()) {
-    mutable_remove_request()->::aspia::proto::file_transfer::RemoveRequest::MergeFrom(from.remove_request());
+  if (from._internal_has_upload_request()) {
+    _this->_internal_mutable_upload_request()->::aspia::proto::file_transfer::UploadRequest::MergeFrom(
+        from._internal_upload_request());
   }
-  if (from.has_download_request()) {
-    mutable_download_request()->::aspia::proto::file_transfer::DownloadRequest::MergeFrom(from.download_request());
+  if (from._internal_has_packet_request()) {
+    _this->_internal_mutable_packet_request()->::aspia::proto::file_transfer::PacketRequest::MergeFrom(
+        from._internal_packet_request());
   }
-  if (from.has_upload_request()) {
-    mutable_upload_request()->::aspia::proto::file_transfer::UploadRequest::MergeFrom(from.upload_request());
+  if (from._internal_has_packet()) {
+    _this->_internal_mutable_packet()->::aspia::proto::file_transfer::Packet::MergeFrom(
+        from._internal_packet());
   }
-  if (from.has_packet_request()) {
-    mutable_packet_request()->::aspia::proto::file_transfer::PacketRequest::MergeFrom(from.packet_request());
+  if (from._internal_has_remote_copy_request()) {
+    _this->_internal_mutable_remote_copy_request()->::aspia::proto::file_transfer::RemoteCopyRequest::MergeFrom(
+        from._internal_remote_copy_request());
   }
-  if (from.has_packet()) {
-    mutable_packet()->::aspia::proto::file_transfer::Packet::MergeFrom(from.packet());
+  if (from._internal_request_id() != 0) {
+    _this->_internal_set_request_id(from._internal_request_id());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void Request::CopyFrom(const Request& from) {
@@ -4000,25 +6967,18 @@ bool Request::IsInitialized() const {
   return true;
 }
 
-void Request::Swap(Request* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void Request::InternalSwap(Request* other) {
   using std::swap;
-  swap(drive_list_request_, other->drive_list_request_);
-  swap(file_list_request_, other->file_list_request_);
-  swap(create_directory_request_, other->create_directory_request_);
-  swap(rename_request_, other->rename_request_);
-  swap(remove_request_, other->remove_request_);
-  swap(download_request_, other->download_request_);
-  swap(upload_request_, other->upload_request_);
-  swap(packet_request_, other->packet_request_);
-  swap(packet_, other->packet_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-}
-
-::std::string Request::GetTypeName() const {
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Request, _impl_.request_id_)
+      + sizeof(Request::_impl_.request_id_)
+      - PROTOBUF_FIELD_OFFSET(Request, _impl_.drive_list_request_)>(
+          reinterpret_cast<char*>(&_impl_.drive_list_request_),
+          reinterpret_cast<char*>(&other->_impl_.drive_list_request_));
+}
+
+std::string Request::GetTypeName() const {
   return "aspia.proto.file_transfer.Request";
 }
 
@@ -4027,54 +6987,88 @@ void Request::InternalSwap(Request* other) {
 }  // namespace file_transfer
 }  // namespace proto
 }  // namespace aspia
-namespace google {
-namespace protobuf {
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::file_transfer::DriveList_Item* Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::DriveList_Item >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::file_transfer::DriveList_Item >(arena);
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::aspia::proto::file_transfer::DriveList_Item*
+Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::DriveList_Item >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::file_transfer::DriveList_Item >(arena);
+}
+template<> PROTOBUF_NOINLINE ::aspia::proto::file_transfer::DriveList*
+Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::DriveList >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::file_transfer::DriveList >(arena);
+}
+template<> PROTOBUF_NOINLINE ::aspia::proto::file_transfer::DriveListRequest*
+Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::DriveListRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::file_transfer::DriveListRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::aspia::proto::file_transfer::FileList_Item*
+Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::FileList_Item >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::file_transfer::FileList_Item >(arena);
+}
+template<> PROTOBUF_NOINLINE ::aspia::proto::file_transfer::FileList*
+Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::FileList >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::file_transfer::FileList >(arena);
+}
+template<> PROTOBUF_NOINLINE ::aspia::proto::file_transfer::FileListRequest*
+Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::FileListRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::file_transfer::FileListRequest >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::file_transfer::DriveList* Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::DriveList >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::file_transfer::DriveList >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::file_transfer::PartialFile*
+Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::PartialFile >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::file_transfer::PartialFile >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::file_transfer::DriveListRequest* Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::DriveListRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::file_transfer::DriveListRequest >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::file_transfer::FileSignature*
+Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::FileSignature >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::file_transfer::FileSignature >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::file_transfer::FileList_Item* Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::FileList_Item >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::file_transfer::FileList_Item >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::file_transfer::BlockCopy*
+Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::BlockCopy >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::file_transfer::BlockCopy >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::file_transfer::FileList* Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::FileList >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::file_transfer::FileList >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::file_transfer::ZeroRange*
+Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::ZeroRange >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::file_transfer::ZeroRange >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::file_transfer::FileListRequest* Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::FileListRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::file_transfer::FileListRequest >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::file_transfer::UploadRequest*
+Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::UploadRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::file_transfer::UploadRequest >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::file_transfer::UploadRequest* Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::UploadRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::file_transfer::UploadRequest >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::file_transfer::DownloadRequest*
+Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::DownloadRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::file_transfer::DownloadRequest >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::file_transfer::DownloadRequest* Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::DownloadRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::file_transfer::DownloadRequest >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::file_transfer::PacketRequest*
+Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::PacketRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::file_transfer::PacketRequest >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::file_transfer::PacketRequest* Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::PacketRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::file_transfer::PacketRequest >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::file_transfer::Packet*
+Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::Packet >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::file_transfer::Packet >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::file_transfer::Packet* Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::Packet >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::file_transfer::Packet >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::file_transfer::CreateDirectoryRequest*
+Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::CreateDirectoryRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::file_transfer::CreateDirectoryRequest >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::file_transfer::CreateDirectoryRequest* Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::CreateDirectoryRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::file_transfer::CreateDirectoryRequest >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::file_transfer::RenameRequest*
+Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::RenameRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::file_transfer::RenameRequest >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::file_transfer::RenameRequest* Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::RenameRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::file_transfer::RenameRequest >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::file_transfer::RemoveRequest*
+Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::RemoveRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::file_transfer::RemoveRequest >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::file_transfer::RemoveRequest* Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::RemoveRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::file_transfer::RemoveRequest >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::file_transfer::RemoteCopyRequest*
+Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::RemoteCopyRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::file_transfer::RemoteCopyRequest >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::file_transfer::Reply* Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::Reply >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::file_transfer::Reply >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::file_transfer::Reply*
+Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::Reply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::file_transfer::Reply >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::file_transfer::Request* Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::Request >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::file_transfer::Request >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::file_transfer::Request*
+Arena::CreateMaybeMessage< ::aspia::proto::file_transfer::Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::file_transfer::Request >(arena);
 }
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -1,102 +1,115 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: file_transfer_session.proto
 
-#ifndef PROTOBUF_INCLUDED_file_5ftransfer_5fsession_2eproto
-#define PROTOBUF_INCLUDED_file_5ftransfer_5fsession_2eproto
+#ifndef GOOGLE_PROTOBUF_INCLUDED_file_5ftransfer_5fsession_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_file_5ftransfer_5fsession_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3006000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3006000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/message_lite.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/generated_enum_util.h>
 // @@protoc_insertion_point(includes)
-#define PROTOBUF_INTERNAL_EXPORT_protobuf_file_5ftransfer_5fsession_2eproto 
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_file_5ftransfer_5fsession_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
 
-namespace protobuf_file_5ftransfer_5fsession_2eproto {
 // Internal implementation detail -- do not use these members.
-struct TableStruct {
-  static const ::google::protobuf::internal::ParseTableField entries[];
-  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
-  static const ::google::protobuf::internal::ParseTable schema[15];
-  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
-  static const ::google::protobuf::internal::SerializationTable serialization_table[];
-  static const ::google::protobuf::uint32 offsets[];
+struct TableStruct_file_5ftransfer_5fsession_2eproto {
+  static const uint32_t offsets[];
 };
-}  // namespace protobuf_file_5ftransfer_5fsession_2eproto
 namespace aspia {
 namespace proto {
 namespace file_transfer {
+class BlockCopy;
+struct BlockCopyDefaultTypeInternal;
+extern BlockCopyDefaultTypeInternal _BlockCopy_default_instance_;
 class CreateDirectoryRequest;
-class CreateDirectoryRequestDefaultTypeInternal;
+struct CreateDirectoryRequestDefaultTypeInternal;
 extern CreateDirectoryRequestDefaultTypeInternal _CreateDirectoryRequest_default_instance_;
 class DownloadRequest;
-class DownloadRequestDefaultTypeInternal;
+struct DownloadRequestDefaultTypeInternal;
 extern DownloadRequestDefaultTypeInternal _DownloadRequest_default_instance_;
 class DriveList;
-class DriveListDefaultTypeInternal;
+struct DriveListDefaultTypeInternal;
 extern DriveListDefaultTypeInternal _DriveList_default_instance_;
 class DriveListRequest;
-class DriveListRequestDefaultTypeInternal;
+struct DriveListRequestDefaultTypeInternal;
 extern DriveListRequestDefaultTypeInternal _DriveListRequest_default_instance_;
 class DriveList_Item;
-class DriveList_ItemDefaultTypeInternal;
+struct DriveList_ItemDefaultTypeInternal;
 extern DriveList_ItemDefaultTypeInternal _DriveList_Item_default_instance_;
 class FileList;
-class FileListDefaultTypeInternal;
+struct FileListDefaultTypeInternal;
 extern FileListDefaultTypeInternal _FileList_default_instance_;
 class FileListRequest;
-class FileListRequestDefaultTypeInternal;
+struct FileListRequestDefaultTypeInternal;
 extern FileListRequestDefaultTypeInternal _FileListRequest_default_instance_;
 class FileList_Item;
-class FileList_ItemDefaultTypeInternal;
+struct FileList_ItemDefaultTypeInternal;
 extern FileList_ItemDefaultTypeInternal _FileList_Item_default_instance_;
+class FileSignature;
+struct FileSignatureDefaultTypeInternal;
+extern FileSignatureDefaultTypeInternal _FileSignature_default_instance_;
 class Packet;
-class PacketDefaultTypeInternal;
+struct PacketDefaultTypeInternal;
 extern PacketDefaultTypeInternal _Packet_default_instance_;
 class PacketRequest;
-class PacketRequestDefaultTypeInternal;
+struct PacketRequestDefaultTypeInternal;
 extern PacketRequestDefaultTypeInternal _PacketRequest_default_instance_;
+class PartialFile;
+struct PartialFileDefaultTypeInternal;
+extern PartialFileDefaultTypeInternal _PartialFile_default_instance_;
+class RemoteCopyRequest;
+struct RemoteCopyRequestDefaultTypeInternal;
+extern RemoteCopyRequestDefaultTypeInternal _RemoteCopyRequest_default_instance_;
 class RemoveRequest;
-class RemoveRequestDefaultTypeInternal;
+struct RemoveRequestDefaultTypeInternal;
 extern RemoveRequestDefaultTypeInternal _RemoveRequest_default_instance_;
 class RenameRequest;
-class RenameRequestDefaultTypeInternal;
+struct RenameRequestDefaultTypeInternal;
 extern RenameRequestDefaultTypeInternal _RenameRequest_default_instance_;
 class Reply;
-class ReplyDefaultTypeInternal;
+struct ReplyDefaultTypeInternal;
 extern ReplyDefaultTypeInternal _Reply_default_instance_;
 class Request;
-class RequestDefaultTypeInternal;
+struct RequestDefaultTypeInternal;
 extern RequestDefaultTypeInternal _Request_default_instance_;
 class UploadRequest;
-class UploadRequestDefaultTypeInternal;
+struct UploadRequestDefaultTypeInternal;
 extern UploadRequestDefaultTypeInternal _UploadRequest_default_instance_;
+class ZeroRange;
+struct ZeroRangeDefaultTypeInternal;
+extern ZeroRangeDefaultTypeInternal _ZeroRange_default_instance_;
 }  // namespace file_transfer
 }  // namespace proto
 }  // namespace aspia
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
+template<> ::aspia::proto::file_transfer::BlockCopy* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::BlockCopy>(Arena*);
 template<> ::aspia::proto::file_transfer::CreateDirectoryRequest* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::CreateDirectoryRequest>(Arena*);
 template<> ::aspia::proto::file_transfer::DownloadRequest* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::DownloadRequest>(Arena*);
 template<> ::aspia::proto::file_transfer::DriveList* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::DriveList>(Arena*);
@@ -105,20 +118,23 @@ template<> ::aspia::proto::file_transfer::DriveList_Item* Arena::CreateMaybeMess
 template<> ::aspia::proto::file_transfer::FileList* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::FileList>(Arena*);
 template<> ::aspia::proto::file_transfer::FileListRequest* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::FileListRequest>(Arena*);
 template<> ::aspia::proto::file_transfer::FileList_Item* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::FileList_Item>(Arena*);
+template<> ::aspia::proto::file_transfer::FileSignature* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::FileSignature>(Arena*);
 template<> ::aspia::proto::file_transfer::Packet* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::Packet>(Arena*);
 template<> ::aspia::proto::file_transfer::PacketRequest* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::PacketRequest>(Arena*);
+template<> ::aspia::proto::file_transfer::PartialFile* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::PartialFile>(Arena*);
+template<> ::aspia::proto::file_transfer::RemoteCopyRequest* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::RemoteCopyRequest>(Arena*);
 template<> ::aspia::proto::file_transfer::RemoveRequest* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::RemoveRequest>(Arena*);
 template<> ::aspia::proto::file_transfer::RenameRequest* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::RenameRequest>(Arena*);
 template<> ::aspia::proto::file_transfer::Reply* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::Reply>(Arena*);
 template<> ::aspia::proto::file_transfer::Request* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::Request>(Arena*);
 template<> ::aspia::proto::file_transfer::UploadRequest* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::UploadRequest>(Arena*);
-}  // namespace protobuf
-}  // namespace google
+template<> ::aspia::proto::file_transfer::ZeroRange* Arena::CreateMaybeMessage<::aspia::proto::file_transfer::ZeroRange>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
 namespace aspia {
 namespace proto {
 namespace file_transfer {
 
-enum DriveList_Item_Type {
+enum DriveList_Item_Type : int {
   DriveList_Item_Type_TYPE_UNKNOWN = 0,
   DriveList_Item_Type_TYPE_CDROM = 1,
   DriveList_Item_Type_TYPE_REMOVABLE = 2,
@@ -127,28 +143,48 @@ enum DriveList_Item_Type {
   DriveList_Item_Type_TYPE_RAM = 5,
   DriveList_Item_Type_TYPE_HOME_FOLDER = 6,
   DriveList_Item_Type_TYPE_DESKTOP_FOLDER = 7,
-  DriveList_Item_Type_DriveList_Item_Type_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  DriveList_Item_Type_DriveList_Item_Type_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  DriveList_Item_Type_DriveList_Item_Type_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  DriveList_Item_Type_DriveList_Item_Type_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool DriveList_Item_Type_IsValid(int value);
-const DriveList_Item_Type DriveList_Item_Type_Type_MIN = DriveList_Item_Type_TYPE_UNKNOWN;
-const DriveList_Item_Type DriveList_Item_Type_Type_MAX = DriveList_Item_Type_TYPE_DESKTOP_FOLDER;
-const int DriveList_Item_Type_Type_ARRAYSIZE = DriveList_Item_Type_Type_MAX + 1;
-
-enum Packet_Flags {
+constexpr DriveList_Item_Type DriveList_Item_Type_Type_MIN = DriveList_Item_Type_TYPE_UNKNOWN;
+constexpr DriveList_Item_Type DriveList_Item_Type_Type_MAX = DriveList_Item_Type_TYPE_DESKTOP_FOLDER;
+constexpr int DriveList_Item_Type_Type_ARRAYSIZE = DriveList_Item_Type_Type_MAX + 1;
+
+const std::string& DriveList_Item_Type_Name(DriveList_Item_Type value);
+template<typename T>
+inline const std::string& DriveList_Item_Type_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, DriveList_Item_Type>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function DriveList_Item_Type_Name.");
+  return DriveList_Item_Type_Name(static_cast<DriveList_Item_Type>(enum_t_value));
+}
+bool DriveList_Item_Type_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, DriveList_Item_Type* value);
+enum Packet_Flags : int {
   Packet_Flags_FLAG_ERROR = 0,
   Packet_Flags_FLAG_PACKET = 1,
   Packet_Flags_FLAG_FIRST_PACKET = 2,
   Packet_Flags_FLAG_LAST_PACKET = 4,
-  Packet_Flags_Packet_Flags_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  Packet_Flags_Packet_Flags_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  Packet_Flags_Packet_Flags_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Packet_Flags_Packet_Flags_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool Packet_Flags_IsValid(int value);
-const Packet_Flags Packet_Flags_Flags_MIN = Packet_Flags_FLAG_ERROR;
-const Packet_Flags Packet_Flags_Flags_MAX = Packet_Flags_FLAG_LAST_PACKET;
-const int Packet_Flags_Flags_ARRAYSIZE = Packet_Flags_Flags_MAX + 1;
-
-enum Status {
+constexpr Packet_Flags Packet_Flags_Flags_MIN = Packet_Flags_FLAG_ERROR;
+constexpr Packet_Flags Packet_Flags_Flags_MAX = Packet_Flags_FLAG_LAST_PACKET;
+constexpr int Packet_Flags_Flags_ARRAYSIZE = Packet_Flags_Flags_MAX + 1;
+
+const std::string& Packet_Flags_Name(Packet_Flags value);
+template<typename T>
+inline const std::string& Packet_Flags_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Packet_Flags>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Packet_Flags_Name.");
+  return Packet_Flags_Name(static_cast<Packet_Flags>(enum_t_value));
+}
+bool Packet_Flags_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Packet_Flags* value);
+enum Status : int {
   STATUS_UNKNOWN = 0,
   STATUS_SUCCESS = 1,
   STATUS_NO_LOGGED_ON_USER = 2,
@@ -163,45 +199,83 @@ enum Status {
   STATUS_FILE_CREATE_ERROR = 11,
   STATUS_FILE_WRITE_ERROR = 12,
   STATUS_FILE_READ_ERROR = 13,
-  Status_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  Status_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  STATUS_CANCELED = 14,
+  Status_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Status_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool Status_IsValid(int value);
-const Status Status_MIN = STATUS_UNKNOWN;
-const Status Status_MAX = STATUS_FILE_READ_ERROR;
-const int Status_ARRAYSIZE = Status_MAX + 1;
-
+constexpr Status Status_MIN = STATUS_UNKNOWN;
+constexpr Status Status_MAX = STATUS_CANCELED;
+constexpr int Status_ARRAYSIZE = Status_MAX + 1;
+
+const std::string& Status_Name(Status value);
+template<typename T>
+inline const std::string& Status_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Status>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Status_Name.");
+  return Status_Name(static_cast<Status>(enum_t_value));
+}
+bool Status_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Status* value);
+enum PacketCompression : int {
+  PACKET_COMPRESSION_NONE = 0,
+  PACKET_COMPRESSION_LZ4 = 1,
+  PACKET_COMPRESSION_ZSTD = 2,
+  PacketCompression_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  PacketCompression_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool PacketCompression_IsValid(int value);
+constexpr PacketCompression PacketCompression_MIN = PACKET_COMPRESSION_NONE;
+constexpr PacketCompression PacketCompression_MAX = PACKET_COMPRESSION_ZSTD;
+constexpr int PacketCompression_ARRAYSIZE = PacketCompression_MAX + 1;
+
+const std::string& PacketCompression_Name(PacketCompression value);
+template<typename T>
+inline const std::string& PacketCompression_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, PacketCompression>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function PacketCompression_Name.");
+  return PacketCompression_Name(static_cast<PacketCompression>(enum_t_value));
+}
+bool PacketCompression_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, PacketCompression* value);
 // ===================================================================
 
-class DriveList_Item : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.DriveList.Item) */ {
+class DriveList_Item final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.DriveList.Item) */ {
  public:
-  DriveList_Item();
-  virtual ~DriveList_Item();
+  inline DriveList_Item() : DriveList_Item(nullptr) {}
+  ~DriveList_Item() override;
+  explicit PROTOBUF_CONSTEXPR DriveList_Item(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   DriveList_Item(const DriveList_Item& from);
-
-  inline DriveList_Item& operator=(const DriveList_Item& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   DriveList_Item(DriveList_Item&& from) noexcept
     : DriveList_Item() {
     *this = ::std::move(from);
   }
 
+  inline DriveList_Item& operator=(const DriveList_Item& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline DriveList_Item& operator=(DriveList_Item&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const DriveList_Item& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const DriveList_Item& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const DriveList_Item* internal_default_instance() {
     return reinterpret_cast<const DriveList_Item*>(
                &_DriveList_Item_default_instance_);
@@ -209,142 +283,183 @@ class DriveList_Item : public ::google::protobuf::MessageLite /* @@protoc_insert
   static constexpr int kIndexInFileMessages =
     0;
 
-  void Swap(DriveList_Item* other);
   friend void swap(DriveList_Item& a, DriveList_Item& b) {
     a.Swap(&b);
   }
+  inline void Swap(DriveList_Item* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DriveList_Item* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline DriveList_Item* New() const final {
-    return CreateMaybeMessage<DriveList_Item>(NULL);
-  }
-
-  DriveList_Item* New(::google::protobuf::Arena* arena) const final {
+  DriveList_Item* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<DriveList_Item>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const DriveList_Item& from);
   void MergeFrom(const DriveList_Item& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(DriveList_Item* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.file_transfer.DriveList.Item";
   }
+  protected:
+  explicit DriveList_Item(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   typedef DriveList_Item_Type Type;
-  static const Type TYPE_UNKNOWN =
+  static constexpr Type TYPE_UNKNOWN =
     DriveList_Item_Type_TYPE_UNKNOWN;
-  static const Type TYPE_CDROM =
+  static constexpr Type TYPE_CDROM =
     DriveList_Item_Type_TYPE_CDROM;
-  static const Type TYPE_REMOVABLE =
+  static constexpr Type TYPE_REMOVABLE =
     DriveList_Item_Type_TYPE_REMOVABLE;
-  static const Type TYPE_FIXED =
+  static constexpr Type TYPE_FIXED =
     DriveList_Item_Type_TYPE_FIXED;
-  static const Type TYPE_REMOTE =
+  static constexpr Type TYPE_REMOTE =
     DriveList_Item_Type_TYPE_REMOTE;
-  static const Type TYPE_RAM =
+  static constexpr Type TYPE_RAM =
     DriveList_Item_Type_TYPE_RAM;
-  static const Type TYPE_HOME_FOLDER =
+  static constexpr Type TYPE_HOME_FOLDER =
     DriveList_Item_Type_TYPE_HOME_FOLDER;
-  static const Type TYPE_DESKTOP_FOLDER =
+  static constexpr Type TYPE_DESKTOP_FOLDER =
     DriveList_Item_Type_TYPE_DESKTOP_FOLDER;
   static inline bool Type_IsValid(int value) {
     return DriveList_Item_Type_IsValid(value);
   }
-  static const Type Type_MIN =
+  static constexpr Type Type_MIN =
     DriveList_Item_Type_Type_MIN;
-  static const Type Type_MAX =
+  static constexpr Type Type_MAX =
     DriveList_Item_Type_Type_MAX;
-  static const int Type_ARRAYSIZE =
+  static constexpr int Type_ARRAYSIZE =
     DriveList_Item_Type_Type_ARRAYSIZE;
+  template<typename T>
+  static inline const std::string& Type_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Type>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Type_Name.");
+    return DriveList_Item_Type_Name(enum_t_value);
+  }
+  static inline bool Type_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Type* value) {
+    return DriveList_Item_Type_Parse(name, value);
+  }
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kPathFieldNumber = 2,
+    kTypeFieldNumber = 1,
+  };
   // string path = 2;
   void clear_path();
-  static const int kPathFieldNumber = 2;
-  const ::std::string& path() const;
-  void set_path(const ::std::string& value);
-  #if LANG_CXX11
-  void set_path(::std::string&& value);
-  #endif
-  void set_path(const char* value);
-  void set_path(const char* value, size_t size);
-  ::std::string* mutable_path();
-  ::std::string* release_path();
-  void set_allocated_path(::std::string* path);
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
 
   // .aspia.proto.file_transfer.DriveList.Item.Type type = 1;
   void clear_type();
-  static const int kTypeFieldNumber = 1;
   ::aspia::proto::file_transfer::DriveList_Item_Type type() const;
   void set_type(::aspia::proto::file_transfer::DriveList_Item_Type value);
+  private:
+  ::aspia::proto::file_transfer::DriveList_Item_Type _internal_type() const;
+  void _internal_set_type(::aspia::proto::file_transfer::DriveList_Item_Type value);
+  public:
 
   // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.DriveList.Item)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr path_;
-  int type_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+    int type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5ftransfer_5fsession_2eproto;
 };
 // -------------------------------------------------------------------
 
-class DriveList : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.DriveList) */ {
+class DriveList final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.DriveList) */ {
  public:
-  DriveList();
-  virtual ~DriveList();
+  inline DriveList() : DriveList(nullptr) {}
+  ~DriveList() override;
+  explicit PROTOBUF_CONSTEXPR DriveList(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   DriveList(const DriveList& from);
-
-  inline DriveList& operator=(const DriveList& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   DriveList(DriveList&& from) noexcept
     : DriveList() {
     *this = ::std::move(from);
   }
 
+  inline DriveList& operator=(const DriveList& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline DriveList& operator=(DriveList&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const DriveList& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const DriveList& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const DriveList* internal_default_instance() {
     return reinterpret_cast<const DriveList*>(
                &_DriveList_default_instance_);
@@ -352,50 +467,62 @@ class DriveList : public ::google::protobuf::MessageLite /* @@protoc_insertion_p
   static constexpr int kIndexInFileMessages =
     1;
 
-  void Swap(DriveList* other);
   friend void swap(DriveList& a, DriveList& b) {
     a.Swap(&b);
   }
+  inline void Swap(DriveList* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DriveList* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline DriveList* New() const final {
-    return CreateMaybeMessage<DriveList>(NULL);
-  }
-
-  DriveList* New(::google::protobuf::Arena* arena) const final {
+  DriveList* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<DriveList>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const DriveList& from);
   void MergeFrom(const DriveList& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(DriveList* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.file_transfer.DriveList";
   }
+  protected:
+  explicit DriveList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
@@ -403,57 +530,77 @@ class DriveList : public ::google::protobuf::MessageLite /* @@protoc_insertion_p
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kItemFieldNumber = 1,
+  };
   // repeated .aspia.proto.file_transfer.DriveList.Item item = 1;
   int item_size() const;
+  private:
+  int _internal_item_size() const;
+  public:
   void clear_item();
-  static const int kItemFieldNumber = 1;
   ::aspia::proto::file_transfer::DriveList_Item* mutable_item(int index);
-  ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::DriveList_Item >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::file_transfer::DriveList_Item >*
       mutable_item();
+  private:
+  const ::aspia::proto::file_transfer::DriveList_Item& _internal_item(int index) const;
+  ::aspia::proto::file_transfer::DriveList_Item* _internal_add_item();
+  public:
   const ::aspia::proto::file_transfer::DriveList_Item& item(int index) const;
   ::aspia::proto::file_transfer::DriveList_Item* add_item();
-  const ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::DriveList_Item >&
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::file_transfer::DriveList_Item >&
       item() const;
 
   // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.DriveList)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::DriveList_Item > item_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::file_transfer::DriveList_Item > item_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5ftransfer_5fsession_2eproto;
 };
 // -------------------------------------------------------------------
 
-class DriveListRequest : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.DriveListRequest) */ {
+class DriveListRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.DriveListRequest) */ {
  public:
-  DriveListRequest();
-  virtual ~DriveListRequest();
+  inline DriveListRequest() : DriveListRequest(nullptr) {}
+  ~DriveListRequest() override;
+  explicit PROTOBUF_CONSTEXPR DriveListRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   DriveListRequest(const DriveListRequest& from);
-
-  inline DriveListRequest& operator=(const DriveListRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   DriveListRequest(DriveListRequest&& from) noexcept
     : DriveListRequest() {
     *this = ::std::move(from);
   }
 
+  inline DriveListRequest& operator=(const DriveListRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline DriveListRequest& operator=(DriveListRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const DriveListRequest& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const DriveListRequest& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const DriveListRequest* internal_default_instance() {
     return reinterpret_cast<const DriveListRequest*>(
                &_DriveListRequest_default_instance_);
@@ -461,100 +608,129 @@ class DriveListRequest : public ::google::protobuf::MessageLite /* @@protoc_inse
   static constexpr int kIndexInFileMessages =
     2;
 
-  void Swap(DriveListRequest* other);
   friend void swap(DriveListRequest& a, DriveListRequest& b) {
     a.Swap(&b);
   }
+  inline void Swap(DriveListRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DriveListRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline DriveListRequest* New() const final {
-    return CreateMaybeMessage<DriveListRequest>(NULL);
-  }
-
-  DriveListRequest* New(::google::protobuf::Arena* arena) const final {
+  DriveListRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<DriveListRequest>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const DriveListRequest& from);
   void MergeFrom(const DriveListRequest& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(DriveListRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.file_transfer.DriveListRequest";
   }
+  protected:
+  explicit DriveListRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kDummyFieldNumber = 1,
+  };
   // uint32 dummy = 1;
   void clear_dummy();
-  static const int kDummyFieldNumber = 1;
-  ::google::protobuf::uint32 dummy() const;
-  void set_dummy(::google::protobuf::uint32 value);
+  uint32_t dummy() const;
+  void set_dummy(uint32_t value);
+  private:
+  uint32_t _internal_dummy() const;
+  void _internal_set_dummy(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.DriveListRequest)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::uint32 dummy_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t dummy_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5ftransfer_5fsession_2eproto;
 };
 // -------------------------------------------------------------------
 
-class FileList_Item : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.FileList.Item) */ {
+class FileList_Item final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.FileList.Item) */ {
  public:
-  FileList_Item();
-  virtual ~FileList_Item();
+  inline FileList_Item() : FileList_Item(nullptr) {}
+  ~FileList_Item() override;
+  explicit PROTOBUF_CONSTEXPR FileList_Item(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   FileList_Item(const FileList_Item& from);
-
-  inline FileList_Item& operator=(const FileList_Item& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   FileList_Item(FileList_Item&& from) noexcept
     : FileList_Item() {
     *this = ::std::move(from);
   }
 
+  inline FileList_Item& operator=(const FileList_Item& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline FileList_Item& operator=(FileList_Item&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const FileList_Item& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const FileList_Item& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const FileList_Item* internal_default_instance() {
     return reinterpret_cast<const FileList_Item*>(
                &_FileList_Item_default_instance_);
@@ -562,129 +738,167 @@ class FileList_Item : public ::google::protobuf::MessageLite /* @@protoc_inserti
   static constexpr int kIndexInFileMessages =
     3;
 
-  void Swap(FileList_Item* other);
   friend void swap(FileList_Item& a, FileList_Item& b) {
     a.Swap(&b);
   }
+  inline void Swap(FileList_Item* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FileList_Item* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline FileList_Item* New() const final {
-    return CreateMaybeMessage<FileList_Item>(NULL);
-  }
-
-  FileList_Item* New(::google::protobuf::Arena* arena) const final {
+  FileList_Item* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<FileList_Item>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const FileList_Item& from);
   void MergeFrom(const FileList_Item& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(FileList_Item* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.file_transfer.FileList.Item";
   }
+  protected:
+  explicit FileList_Item(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNameFieldNumber = 1,
+    kSizeFieldNumber = 2,
+    kModificationTimeFieldNumber = 3,
+    kIsDirectoryFieldNumber = 4,
+  };
   // string name = 1;
   void clear_name();
-  static const int kNameFieldNumber = 1;
-  const ::std::string& name() const;
-  void set_name(const ::std::string& value);
-  #if LANG_CXX11
-  void set_name(::std::string&& value);
-  #endif
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
-  ::std::string* mutable_name();
-  ::std::string* release_name();
-  void set_allocated_name(::std::string* name);
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
 
   // uint64 size = 2;
   void clear_size();
-  static const int kSizeFieldNumber = 2;
-  ::google::protobuf::uint64 size() const;
-  void set_size(::google::protobuf::uint64 value);
+  uint64_t size() const;
+  void set_size(uint64_t value);
+  private:
+  uint64_t _internal_size() const;
+  void _internal_set_size(uint64_t value);
+  public:
 
   // int64 modification_time = 3;
   void clear_modification_time();
-  static const int kModificationTimeFieldNumber = 3;
-  ::google::protobuf::int64 modification_time() const;
-  void set_modification_time(::google::protobuf::int64 value);
+  int64_t modification_time() const;
+  void set_modification_time(int64_t value);
+  private:
+  int64_t _internal_modification_time() const;
+  void _internal_set_modification_time(int64_t value);
+  public:
 
   // bool is_directory = 4;
   void clear_is_directory();
-  static const int kIsDirectoryFieldNumber = 4;
   bool is_directory() const;
   void set_is_directory(bool value);
+  private:
+  bool _internal_is_directory() const;
+  void _internal_set_is_directory(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.FileList.Item)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr name_;
-  ::google::protobuf::uint64 size_;
-  ::google::protobuf::int64 modification_time_;
-  bool is_directory_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint64_t size_;
+    int64_t modification_time_;
+    bool is_directory_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5ftransfer_5fsession_2eproto;
 };
 // -------------------------------------------------------------------
 
-class FileList : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.FileList) */ {
+class FileList final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.FileList) */ {
  public:
-  FileList();
-  virtual ~FileList();
+  inline FileList() : FileList(nullptr) {}
+  ~FileList() override;
+  explicit PROTOBUF_CONSTEXPR FileList(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   FileList(const FileList& from);
-
-  inline FileList& operator=(const FileList& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   FileList(FileList&& from) noexcept
     : FileList() {
     *this = ::std::move(from);
   }
 
+  inline FileList& operator=(const FileList& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline FileList& operator=(FileList&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const FileList& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const FileList& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const FileList* internal_default_instance() {
     return reinterpret_cast<const FileList*>(
                &_FileList_default_instance_);
@@ -692,50 +906,62 @@ class FileList : public ::google::protobuf::MessageLite /* @@protoc_insertion_po
   static constexpr int kIndexInFileMessages =
     4;
 
-  void Swap(FileList* other);
   friend void swap(FileList& a, FileList& b) {
     a.Swap(&b);
   }
+  inline void Swap(FileList* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FileList* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline FileList* New() const final {
-    return CreateMaybeMessage<FileList>(NULL);
-  }
-
-  FileList* New(::google::protobuf::Arena* arena) const final {
+  FileList* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<FileList>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const FileList& from);
   void MergeFrom(const FileList& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(FileList* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.file_transfer.FileList";
   }
+  protected:
+  explicit FileList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
@@ -743,57 +969,121 @@ class FileList : public ::google::protobuf::MessageLite /* @@protoc_insertion_po
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kItemFieldNumber = 1,
+    kContinuationIdFieldNumber = 2,
+    kModificationTimeFieldNumber = 3,
+    kNotModifiedFieldNumber = 4,
+    kTruncatedFieldNumber = 5,
+  };
   // repeated .aspia.proto.file_transfer.FileList.Item item = 1;
   int item_size() const;
+  private:
+  int _internal_item_size() const;
+  public:
   void clear_item();
-  static const int kItemFieldNumber = 1;
   ::aspia::proto::file_transfer::FileList_Item* mutable_item(int index);
-  ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::FileList_Item >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::file_transfer::FileList_Item >*
       mutable_item();
+  private:
+  const ::aspia::proto::file_transfer::FileList_Item& _internal_item(int index) const;
+  ::aspia::proto::file_transfer::FileList_Item* _internal_add_item();
+  public:
   const ::aspia::proto::file_transfer::FileList_Item& item(int index) const;
   ::aspia::proto::file_transfer::FileList_Item* add_item();
-  const ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::FileList_Item >&
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::file_transfer::FileList_Item >&
       item() const;
 
+  // uint64 continuation_id = 2;
+  void clear_continuation_id();
+  uint64_t continuation_id() const;
+  void set_continuation_id(uint64_t value);
+  private:
+  uint64_t _internal_continuation_id() const;
+  void _internal_set_continuation_id(uint64_t value);
+  public:
+
+  // int64 modification_time = 3;
+  void clear_modification_time();
+  int64_t modification_time() const;
+  void set_modification_time(int64_t value);
+  private:
+  int64_t _internal_modification_time() const;
+  void _internal_set_modification_time(int64_t value);
+  public:
+
+  // bool not_modified = 4;
+  void clear_not_modified();
+  bool not_modified() const;
+  void set_not_modified(bool value);
+  private:
+  bool _internal_not_modified() const;
+  void _internal_set_not_modified(bool value);
+  public:
+
+  // bool truncated = 5;
+  void clear_truncated();
+  bool truncated() const;
+  void set_truncated(bool value);
+  private:
+  bool _internal_truncated() const;
+  void _internal_set_truncated(bool value);
+  public:
+
   // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.FileList)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::FileList_Item > item_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::file_transfer::FileList_Item > item_;
+    uint64_t continuation_id_;
+    int64_t modification_time_;
+    bool not_modified_;
+    bool truncated_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5ftransfer_5fsession_2eproto;
 };
 // -------------------------------------------------------------------
 
-class FileListRequest : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.FileListRequest) */ {
+class FileListRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.FileListRequest) */ {
  public:
-  FileListRequest();
-  virtual ~FileListRequest();
+  inline FileListRequest() : FileListRequest(nullptr) {}
+  ~FileListRequest() override;
+  explicit PROTOBUF_CONSTEXPR FileListRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   FileListRequest(const FileListRequest& from);
-
-  inline FileListRequest& operator=(const FileListRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   FileListRequest(FileListRequest&& from) noexcept
     : FileListRequest() {
     *this = ::std::move(from);
   }
 
+  inline FileListRequest& operator=(const FileListRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline FileListRequest& operator=(FileListRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const FileListRequest& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const FileListRequest& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const FileListRequest* internal_default_instance() {
     return reinterpret_cast<const FileListRequest*>(
                &_FileListRequest_default_instance_);
@@ -801,2011 +1091,5253 @@ class FileListRequest : public ::google::protobuf::MessageLite /* @@protoc_inser
   static constexpr int kIndexInFileMessages =
     5;
 
-  void Swap(FileListRequest* other);
   friend void swap(FileListRequest& a, FileListRequest& b) {
     a.Swap(&b);
   }
+  inline void Swap(FileListRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FileListRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline FileListRequest* New() const final {
-    return CreateMaybeMessage<FileListRequest>(NULL);
-  }
-
-  FileListRequest* New(::google::protobuf::Arena* arena) const final {
+  FileListRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<FileListRequest>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const FileListRequest& from);
   void MergeFrom(const FileListRequest& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(FileListRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.file_transfer.FileListRequest";
   }
+  protected:
+  explicit FileListRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kPathFieldNumber = 1,
+    kContinuationIdFieldNumber = 3,
+    kMaxItemsFieldNumber = 2,
+    kRecursiveFieldNumber = 4,
+    kSinglePartFieldNumber = 6,
+    kModificationTimeFieldNumber = 5,
+  };
   // string path = 1;
   void clear_path();
-  static const int kPathFieldNumber = 1;
-  const ::std::string& path() const;
-  void set_path(const ::std::string& value);
-  #if LANG_CXX11
-  void set_path(::std::string&& value);
-  #endif
-  void set_path(const char* value);
-  void set_path(const char* value, size_t size);
-  ::std::string* mutable_path();
-  ::std::string* release_path();
-  void set_allocated_path(::std::string* path);
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
+
+  // uint64 continuation_id = 3;
+  void clear_continuation_id();
+  uint64_t continuation_id() const;
+  void set_continuation_id(uint64_t value);
+  private:
+  uint64_t _internal_continuation_id() const;
+  void _internal_set_continuation_id(uint64_t value);
+  public:
+
+  // uint32 max_items = 2;
+  void clear_max_items();
+  uint32_t max_items() const;
+  void set_max_items(uint32_t value);
+  private:
+  uint32_t _internal_max_items() const;
+  void _internal_set_max_items(uint32_t value);
+  public:
+
+  // bool recursive = 4;
+  void clear_recursive();
+  bool recursive() const;
+  void set_recursive(bool value);
+  private:
+  bool _internal_recursive() const;
+  void _internal_set_recursive(bool value);
+  public:
+
+  // bool single_part = 6;
+  void clear_single_part();
+  bool single_part() const;
+  void set_single_part(bool value);
+  private:
+  bool _internal_single_part() const;
+  void _internal_set_single_part(bool value);
+  public:
+
+  // int64 modification_time = 5;
+  void clear_modification_time();
+  int64_t modification_time() const;
+  void set_modification_time(int64_t value);
+  private:
+  int64_t _internal_modification_time() const;
+  void _internal_set_modification_time(int64_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.FileListRequest)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr path_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+    uint64_t continuation_id_;
+    uint32_t max_items_;
+    bool recursive_;
+    bool single_part_;
+    int64_t modification_time_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5ftransfer_5fsession_2eproto;
 };
 // -------------------------------------------------------------------
 
-class UploadRequest : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.UploadRequest) */ {
+class PartialFile final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.PartialFile) */ {
  public:
-  UploadRequest();
-  virtual ~UploadRequest();
+  inline PartialFile() : PartialFile(nullptr) {}
+  ~PartialFile() override;
+  explicit PROTOBUF_CONSTEXPR PartialFile(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  UploadRequest(const UploadRequest& from);
+  PartialFile(const PartialFile& from);
+  PartialFile(PartialFile&& from) noexcept
+    : PartialFile() {
+    *this = ::std::move(from);
+  }
 
-  inline UploadRequest& operator=(const UploadRequest& from) {
+  inline PartialFile& operator=(const PartialFile& from) {
     CopyFrom(from);
     return *this;
   }
-  #if LANG_CXX11
-  UploadRequest(UploadRequest&& from) noexcept
-    : UploadRequest() {
-    *this = ::std::move(from);
-  }
-
-  inline UploadRequest& operator=(UploadRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline PartialFile& operator=(PartialFile&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const UploadRequest& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const UploadRequest* internal_default_instance() {
-    return reinterpret_cast<const UploadRequest*>(
-               &_UploadRequest_default_instance_);
+  static const PartialFile& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PartialFile* internal_default_instance() {
+    return reinterpret_cast<const PartialFile*>(
+               &_PartialFile_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     6;
 
-  void Swap(UploadRequest* other);
-  friend void swap(UploadRequest& a, UploadRequest& b) {
+  friend void swap(PartialFile& a, PartialFile& b) {
     a.Swap(&b);
   }
+  inline void Swap(PartialFile* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PartialFile* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline UploadRequest* New() const final {
-    return CreateMaybeMessage<UploadRequest>(NULL);
-  }
-
-  UploadRequest* New(::google::protobuf::Arena* arena) const final {
-    return CreateMaybeMessage<UploadRequest>(arena);
+  PartialFile* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PartialFile>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
-  void CopyFrom(const UploadRequest& from);
-  void MergeFrom(const UploadRequest& from);
-  void Clear() final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const PartialFile& from);
+  void MergeFrom(const PartialFile& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(UploadRequest* other);
+  void InternalSwap(PartialFile* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.file_transfer.PartialFile";
   }
+  protected:
+  explicit PartialFile(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // string path = 1;
-  void clear_path();
-  static const int kPathFieldNumber = 1;
-  const ::std::string& path() const;
-  void set_path(const ::std::string& value);
-  #if LANG_CXX11
-  void set_path(::std::string&& value);
-  #endif
-  void set_path(const char* value);
-  void set_path(const char* value, size_t size);
-  ::std::string* mutable_path();
-  ::std::string* release_path();
-  void set_allocated_path(::std::string* path);
+  enum : int {
+    kLastBlockHashFieldNumber = 2,
+    kSizeFieldNumber = 1,
+  };
+  // bytes last_block_hash = 2;
+  void clear_last_block_hash();
+  const std::string& last_block_hash() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_last_block_hash(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_last_block_hash();
+  PROTOBUF_NODISCARD std::string* release_last_block_hash();
+  void set_allocated_last_block_hash(std::string* last_block_hash);
+  private:
+  const std::string& _internal_last_block_hash() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_last_block_hash(const std::string& value);
+  std::string* _internal_mutable_last_block_hash();
+  public:
 
-  // bool overwrite = 2;
-  void clear_overwrite();
-  static const int kOverwriteFieldNumber = 2;
-  bool overwrite() const;
-  void set_overwrite(bool value);
+  // uint64 size = 1;
+  void clear_size();
+  uint64_t size() const;
+  void set_size(uint64_t value);
+  private:
+  uint64_t _internal_size() const;
+  void _internal_set_size(uint64_t value);
+  public:
 
-  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.UploadRequest)
+  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.PartialFile)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr path_;
-  bool overwrite_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr last_block_hash_;
+    uint64_t size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5ftransfer_5fsession_2eproto;
 };
 // -------------------------------------------------------------------
 
-class DownloadRequest : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.DownloadRequest) */ {
+class FileSignature final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.FileSignature) */ {
  public:
-  DownloadRequest();
-  virtual ~DownloadRequest();
+  inline FileSignature() : FileSignature(nullptr) {}
+  ~FileSignature() override;
+  explicit PROTOBUF_CONSTEXPR FileSignature(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  DownloadRequest(const DownloadRequest& from);
+  FileSignature(const FileSignature& from);
+  FileSignature(FileSignature&& from) noexcept
+    : FileSignature() {
+    *this = ::std::move(from);
+  }
 
-  inline DownloadRequest& operator=(const DownloadRequest& from) {
+  inline FileSignature& operator=(const FileSignature& from) {
     CopyFrom(from);
     return *this;
   }
-  #if LANG_CXX11
-  DownloadRequest(DownloadRequest&& from) noexcept
-    : DownloadRequest() {
-    *this = ::std::move(from);
-  }
-
-  inline DownloadRequest& operator=(DownloadRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline FileSignature& operator=(FileSignature&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const DownloadRequest& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const DownloadRequest* internal_default_instance() {
-    return reinterpret_cast<const DownloadRequest*>(
-               &_DownloadRequest_default_instance_);
+  static const FileSignature& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FileSignature* internal_default_instance() {
+    return reinterpret_cast<const FileSignature*>(
+               &_FileSignature_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     7;
 
-  void Swap(DownloadRequest* other);
-  friend void swap(DownloadRequest& a, DownloadRequest& b) {
+  friend void swap(FileSignature& a, FileSignature& b) {
     a.Swap(&b);
   }
+  inline void Swap(FileSignature* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FileSignature* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline DownloadRequest* New() const final {
-    return CreateMaybeMessage<DownloadRequest>(NULL);
-  }
-
-  DownloadRequest* New(::google::protobuf::Arena* arena) const final {
-    return CreateMaybeMessage<DownloadRequest>(arena);
+  FileSignature* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FileSignature>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
-  void CopyFrom(const DownloadRequest& from);
-  void MergeFrom(const DownloadRequest& from);
-  void Clear() final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const FileSignature& from);
+  void MergeFrom(const FileSignature& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(DownloadRequest* other);
+  void InternalSwap(FileSignature* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.file_transfer.FileSignature";
   }
+  protected:
+  explicit FileSignature(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // string path = 1;
-  void clear_path();
-  static const int kPathFieldNumber = 1;
-  const ::std::string& path() const;
-  void set_path(const ::std::string& value);
-  #if LANG_CXX11
-  void set_path(::std::string&& value);
-  #endif
-  void set_path(const char* value);
-  void set_path(const char* value, size_t size);
-  ::std::string* mutable_path();
-  ::std::string* release_path();
-  void set_allocated_path(::std::string* path);
+  enum : int {
+    kWeakHashesFieldNumber = 2,
+    kStrongHashesFieldNumber = 3,
+    kBlockSizeFieldNumber = 1,
+  };
+  // bytes weak_hashes = 2;
+  void clear_weak_hashes();
+  const std::string& weak_hashes() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_weak_hashes(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_weak_hashes();
+  PROTOBUF_NODISCARD std::string* release_weak_hashes();
+  void set_allocated_weak_hashes(std::string* weak_hashes);
+  private:
+  const std::string& _internal_weak_hashes() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_weak_hashes(const std::string& value);
+  std::string* _internal_mutable_weak_hashes();
+  public:
 
-  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.DownloadRequest)
- private:
+  // bytes strong_hashes = 3;
+  void clear_strong_hashes();
+  const std::string& strong_hashes() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_strong_hashes(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_strong_hashes();
+  PROTOBUF_NODISCARD std::string* release_strong_hashes();
+  void set_allocated_strong_hashes(std::string* strong_hashes);
+  private:
+  const std::string& _internal_strong_hashes() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_strong_hashes(const std::string& value);
+  std::string* _internal_mutable_strong_hashes();
+  public:
+
+  // uint32 block_size = 1;
+  void clear_block_size();
+  uint32_t block_size() const;
+  void set_block_size(uint32_t value);
+  private:
+  uint32_t _internal_block_size() const;
+  void _internal_set_block_size(uint32_t value);
+  public:
 
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr path_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
+  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.FileSignature)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr weak_hashes_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr strong_hashes_;
+    uint32_t block_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5ftransfer_5fsession_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PacketRequest : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.PacketRequest) */ {
+class BlockCopy final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.BlockCopy) */ {
  public:
-  PacketRequest();
-  virtual ~PacketRequest();
-
-  PacketRequest(const PacketRequest& from);
+  inline BlockCopy() : BlockCopy(nullptr) {}
+  ~BlockCopy() override;
+  explicit PROTOBUF_CONSTEXPR BlockCopy(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  inline PacketRequest& operator=(const PacketRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
-  PacketRequest(PacketRequest&& from) noexcept
-    : PacketRequest() {
+  BlockCopy(const BlockCopy& from);
+  BlockCopy(BlockCopy&& from) noexcept
+    : BlockCopy() {
     *this = ::std::move(from);
   }
 
-  inline PacketRequest& operator=(PacketRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline BlockCopy& operator=(const BlockCopy& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BlockCopy& operator=(BlockCopy&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const PacketRequest& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const PacketRequest* internal_default_instance() {
-    return reinterpret_cast<const PacketRequest*>(
-               &_PacketRequest_default_instance_);
+  static const BlockCopy& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BlockCopy* internal_default_instance() {
+    return reinterpret_cast<const BlockCopy*>(
+               &_BlockCopy_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     8;
 
-  void Swap(PacketRequest* other);
-  friend void swap(PacketRequest& a, PacketRequest& b) {
+  friend void swap(BlockCopy& a, BlockCopy& b) {
     a.Swap(&b);
   }
+  inline void Swap(BlockCopy* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BlockCopy* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PacketRequest* New() const final {
-    return CreateMaybeMessage<PacketRequest>(NULL);
-  }
-
-  PacketRequest* New(::google::protobuf::Arena* arena) const final {
-    return CreateMaybeMessage<PacketRequest>(arena);
+  BlockCopy* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BlockCopy>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
-  void CopyFrom(const PacketRequest& from);
-  void MergeFrom(const PacketRequest& from);
-  void Clear() final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const BlockCopy& from);
+  void MergeFrom(const BlockCopy& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(PacketRequest* other);
+  void InternalSwap(BlockCopy* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.file_transfer.BlockCopy";
   }
+  protected:
+  explicit BlockCopy(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // uint32 dummy = 1;
-  void clear_dummy();
-  static const int kDummyFieldNumber = 1;
-  ::google::protobuf::uint32 dummy() const;
-  void set_dummy(::google::protobuf::uint32 value);
+  enum : int {
+    kBlockIndexFieldNumber = 2,
+    kDataOffsetFieldNumber = 1,
+    kBlockCountFieldNumber = 3,
+  };
+  // uint64 block_index = 2;
+  void clear_block_index();
+  uint64_t block_index() const;
+  void set_block_index(uint64_t value);
+  private:
+  uint64_t _internal_block_index() const;
+  void _internal_set_block_index(uint64_t value);
+  public:
 
-  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.PacketRequest)
- private:
+  // uint32 data_offset = 1;
+  void clear_data_offset();
+  uint32_t data_offset() const;
+  void set_data_offset(uint32_t value);
+  private:
+  uint32_t _internal_data_offset() const;
+  void _internal_set_data_offset(uint32_t value);
+  public:
+
+  // uint32 block_count = 3;
+  void clear_block_count();
+  uint32_t block_count() const;
+  void set_block_count(uint32_t value);
+  private:
+  uint32_t _internal_block_count() const;
+  void _internal_set_block_count(uint32_t value);
+  public:
 
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::uint32 dummy_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
+  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.BlockCopy)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t block_index_;
+    uint32_t data_offset_;
+    uint32_t block_count_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5ftransfer_5fsession_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Packet : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.Packet) */ {
+class ZeroRange final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.ZeroRange) */ {
  public:
-  Packet();
-  virtual ~Packet();
+  inline ZeroRange() : ZeroRange(nullptr) {}
+  ~ZeroRange() override;
+  explicit PROTOBUF_CONSTEXPR ZeroRange(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Packet(const Packet& from);
+  ZeroRange(const ZeroRange& from);
+  ZeroRange(ZeroRange&& from) noexcept
+    : ZeroRange() {
+    *this = ::std::move(from);
+  }
 
-  inline Packet& operator=(const Packet& from) {
+  inline ZeroRange& operator=(const ZeroRange& from) {
     CopyFrom(from);
     return *this;
   }
-  #if LANG_CXX11
-  Packet(Packet&& from) noexcept
-    : Packet() {
-    *this = ::std::move(from);
-  }
-
-  inline Packet& operator=(Packet&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline ZeroRange& operator=(ZeroRange&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const Packet& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const Packet* internal_default_instance() {
-    return reinterpret_cast<const Packet*>(
-               &_Packet_default_instance_);
+  static const ZeroRange& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ZeroRange* internal_default_instance() {
+    return reinterpret_cast<const ZeroRange*>(
+               &_ZeroRange_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     9;
 
-  void Swap(Packet* other);
-  friend void swap(Packet& a, Packet& b) {
+  friend void swap(ZeroRange& a, ZeroRange& b) {
     a.Swap(&b);
   }
+  inline void Swap(ZeroRange* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ZeroRange* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Packet* New() const final {
-    return CreateMaybeMessage<Packet>(NULL);
-  }
-
-  Packet* New(::google::protobuf::Arena* arena) const final {
-    return CreateMaybeMessage<Packet>(arena);
+  ZeroRange* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ZeroRange>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
-  void CopyFrom(const Packet& from);
-  void MergeFrom(const Packet& from);
-  void Clear() final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const ZeroRange& from);
+  void MergeFrom(const ZeroRange& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(Packet* other);
+  void InternalSwap(ZeroRange* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.file_transfer.ZeroRange";
   }
+  protected:
+  explicit ZeroRange(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
-  typedef Packet_Flags Flags;
-  static const Flags FLAG_ERROR =
-    Packet_Flags_FLAG_ERROR;
-  static const Flags FLAG_PACKET =
-    Packet_Flags_FLAG_PACKET;
-  static const Flags FLAG_FIRST_PACKET =
-    Packet_Flags_FLAG_FIRST_PACKET;
-  static const Flags FLAG_LAST_PACKET =
-    Packet_Flags_FLAG_LAST_PACKET;
-  static inline bool Flags_IsValid(int value) {
-    return Packet_Flags_IsValid(value);
-  }
-  static const Flags Flags_MIN =
-    Packet_Flags_Flags_MIN;
-  static const Flags Flags_MAX =
-    Packet_Flags_Flags_MAX;
-  static const int Flags_ARRAYSIZE =
-    Packet_Flags_Flags_ARRAYSIZE;
-
   // accessors -------------------------------------------------------
 
-  // bytes data = 3;
-  void clear_data();
-  static const int kDataFieldNumber = 3;
-  const ::std::string& data() const;
-  void set_data(const ::std::string& value);
-  #if LANG_CXX11
-  void set_data(::std::string&& value);
-  #endif
-  void set_data(const char* value);
-  void set_data(const void* value, size_t size);
-  ::std::string* mutable_data();
-  ::std::string* release_data();
-  void set_allocated_data(::std::string* data);
-
-  // uint64 file_size = 2;
-  void clear_file_size();
-  static const int kFileSizeFieldNumber = 2;
-  ::google::protobuf::uint64 file_size() const;
-  void set_file_size(::google::protobuf::uint64 value);
+  enum : int {
+    kSizeFieldNumber = 2,
+    kDataOffsetFieldNumber = 1,
+  };
+  // uint64 size = 2;
+  void clear_size();
+  uint64_t size() const;
+  void set_size(uint64_t value);
+  private:
+  uint64_t _internal_size() const;
+  void _internal_set_size(uint64_t value);
+  public:
 
-  // uint32 flags = 1;
-  void clear_flags();
-  static const int kFlagsFieldNumber = 1;
-  ::google::protobuf::uint32 flags() const;
-  void set_flags(::google::protobuf::uint32 value);
+  // uint32 data_offset = 1;
+  void clear_data_offset();
+  uint32_t data_offset() const;
+  void set_data_offset(uint32_t value);
+  private:
+  uint32_t _internal_data_offset() const;
+  void _internal_set_data_offset(uint32_t value);
+  public:
 
-  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.Packet)
+  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.ZeroRange)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr data_;
-  ::google::protobuf::uint64 file_size_;
-  ::google::protobuf::uint32 flags_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t size_;
+    uint32_t data_offset_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5ftransfer_5fsession_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CreateDirectoryRequest : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.CreateDirectoryRequest) */ {
+class UploadRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.UploadRequest) */ {
  public:
-  CreateDirectoryRequest();
-  virtual ~CreateDirectoryRequest();
+  inline UploadRequest() : UploadRequest(nullptr) {}
+  ~UploadRequest() override;
+  explicit PROTOBUF_CONSTEXPR UploadRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  CreateDirectoryRequest(const CreateDirectoryRequest& from);
+  UploadRequest(const UploadRequest& from);
+  UploadRequest(UploadRequest&& from) noexcept
+    : UploadRequest() {
+    *this = ::std::move(from);
+  }
 
-  inline CreateDirectoryRequest& operator=(const CreateDirectoryRequest& from) {
+  inline UploadRequest& operator=(const UploadRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  #if LANG_CXX11
-  CreateDirectoryRequest(CreateDirectoryRequest&& from) noexcept
-    : CreateDirectoryRequest() {
-    *this = ::std::move(from);
-  }
-
-  inline CreateDirectoryRequest& operator=(CreateDirectoryRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline UploadRequest& operator=(UploadRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const CreateDirectoryRequest& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const CreateDirectoryRequest* internal_default_instance() {
-    return reinterpret_cast<const CreateDirectoryRequest*>(
-               &_CreateDirectoryRequest_default_instance_);
+  static const UploadRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UploadRequest* internal_default_instance() {
+    return reinterpret_cast<const UploadRequest*>(
+               &_UploadRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     10;
 
-  void Swap(CreateDirectoryRequest* other);
-  friend void swap(CreateDirectoryRequest& a, CreateDirectoryRequest& b) {
+  friend void swap(UploadRequest& a, UploadRequest& b) {
     a.Swap(&b);
   }
+  inline void Swap(UploadRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UploadRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline CreateDirectoryRequest* New() const final {
-    return CreateMaybeMessage<CreateDirectoryRequest>(NULL);
-  }
-
-  CreateDirectoryRequest* New(::google::protobuf::Arena* arena) const final {
-    return CreateMaybeMessage<CreateDirectoryRequest>(arena);
+  UploadRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UploadRequest>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
-  void CopyFrom(const CreateDirectoryRequest& from);
-  void MergeFrom(const CreateDirectoryRequest& from);
-  void Clear() final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const UploadRequest& from);
+  void MergeFrom(const UploadRequest& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(CreateDirectoryRequest* other);
+  void InternalSwap(UploadRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.file_transfer.UploadRequest";
   }
+  protected:
+  explicit UploadRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kPathFieldNumber = 1,
+    kPacketFieldNumber = 3,
+    kOverwriteFieldNumber = 2,
+    kResumeFieldNumber = 4,
+    kDeltaFieldNumber = 5,
+    kArchiveFieldNumber = 6,
+  };
   // string path = 1;
   void clear_path();
-  static const int kPathFieldNumber = 1;
-  const ::std::string& path() const;
-  void set_path(const ::std::string& value);
-  #if LANG_CXX11
-  void set_path(::std::string&& value);
-  #endif
-  void set_path(const char* value);
-  void set_path(const char* value, size_t size);
-  ::std::string* mutable_path();
-  ::std::string* release_path();
-  void set_allocated_path(::std::string* path);
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
 
-  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.CreateDirectoryRequest)
- private:
+  // .aspia.proto.file_transfer.Packet packet = 3;
+  bool has_packet() const;
+  private:
+  bool _internal_has_packet() const;
+  public:
+  void clear_packet();
+  const ::aspia::proto::file_transfer::Packet& packet() const;
+  PROTOBUF_NODISCARD ::aspia::proto::file_transfer::Packet* release_packet();
+  ::aspia::proto::file_transfer::Packet* mutable_packet();
+  void set_allocated_packet(::aspia::proto::file_transfer::Packet* packet);
+  private:
+  const ::aspia::proto::file_transfer::Packet& _internal_packet() const;
+  ::aspia::proto::file_transfer::Packet* _internal_mutable_packet();
+  public:
+  void unsafe_arena_set_allocated_packet(
+      ::aspia::proto::file_transfer::Packet* packet);
+  ::aspia::proto::file_transfer::Packet* unsafe_arena_release_packet();
+
+  // bool overwrite = 2;
+  void clear_overwrite();
+  bool overwrite() const;
+  void set_overwrite(bool value);
+  private:
+  bool _internal_overwrite() const;
+  void _internal_set_overwrite(bool value);
+  public:
+
+  // bool resume = 4;
+  void clear_resume();
+  bool resume() const;
+  void set_resume(bool value);
+  private:
+  bool _internal_resume() const;
+  void _internal_set_resume(bool value);
+  public:
+
+  // bool delta = 5;
+  void clear_delta();
+  bool delta() const;
+  void set_delta(bool value);
+  private:
+  bool _internal_delta() const;
+  void _internal_set_delta(bool value);
+  public:
 
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr path_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
+  // bool archive = 6;
+  void clear_archive();
+  bool archive() const;
+  void set_archive(bool value);
+  private:
+  bool _internal_archive() const;
+  void _internal_set_archive(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.UploadRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+    ::aspia::proto::file_transfer::Packet* packet_;
+    bool overwrite_;
+    bool resume_;
+    bool delta_;
+    bool archive_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5ftransfer_5fsession_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RenameRequest : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.RenameRequest) */ {
+class DownloadRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.DownloadRequest) */ {
  public:
-  RenameRequest();
-  virtual ~RenameRequest();
+  inline DownloadRequest() : DownloadRequest(nullptr) {}
+  ~DownloadRequest() override;
+  explicit PROTOBUF_CONSTEXPR DownloadRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  RenameRequest(const RenameRequest& from);
+  DownloadRequest(const DownloadRequest& from);
+  DownloadRequest(DownloadRequest&& from) noexcept
+    : DownloadRequest() {
+    *this = ::std::move(from);
+  }
 
-  inline RenameRequest& operator=(const RenameRequest& from) {
+  inline DownloadRequest& operator=(const DownloadRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  #if LANG_CXX11
-  RenameRequest(RenameRequest&& from) noexcept
-    : RenameRequest() {
-    *this = ::std::move(from);
-  }
-
-  inline RenameRequest& operator=(RenameRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline DownloadRequest& operator=(DownloadRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const RenameRequest& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const RenameRequest* internal_default_instance() {
-    return reinterpret_cast<const RenameRequest*>(
-               &_RenameRequest_default_instance_);
+  static const DownloadRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DownloadRequest* internal_default_instance() {
+    return reinterpret_cast<const DownloadRequest*>(
+               &_DownloadRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     11;
 
-  void Swap(RenameRequest* other);
-  friend void swap(RenameRequest& a, RenameRequest& b) {
+  friend void swap(DownloadRequest& a, DownloadRequest& b) {
     a.Swap(&b);
   }
+  inline void Swap(DownloadRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DownloadRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline RenameRequest* New() const final {
-    return CreateMaybeMessage<RenameRequest>(NULL);
-  }
-
-  RenameRequest* New(::google::protobuf::Arena* arena) const final {
-    return CreateMaybeMessage<RenameRequest>(arena);
+  DownloadRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DownloadRequest>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
-  void CopyFrom(const RenameRequest& from);
-  void MergeFrom(const RenameRequest& from);
-  void Clear() final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const DownloadRequest& from);
+  void MergeFrom(const DownloadRequest& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(RenameRequest* other);
+  void InternalSwap(DownloadRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.file_transfer.DownloadRequest";
   }
+  protected:
+  explicit DownloadRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // string old_name = 1;
-  void clear_old_name();
-  static const int kOldNameFieldNumber = 1;
-  const ::std::string& old_name() const;
-  void set_old_name(const ::std::string& value);
-  #if LANG_CXX11
-  void set_old_name(::std::string&& value);
-  #endif
-  void set_old_name(const char* value);
-  void set_old_name(const char* value, size_t size);
-  ::std::string* mutable_old_name();
-  ::std::string* release_old_name();
-  void set_allocated_old_name(::std::string* old_name);
+  enum : int {
+    kPathFieldNumber = 1,
+    kPacketSizeFieldNumber = 2,
+    kCompressionFieldNumber = 3,
+    kArchiveFieldNumber = 4,
+  };
+  // string path = 1;
+  void clear_path();
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
 
-  // string new_name = 2;
-  void clear_new_name();
-  static const int kNewNameFieldNumber = 2;
-  const ::std::string& new_name() const;
-  void set_new_name(const ::std::string& value);
-  #if LANG_CXX11
-  void set_new_name(::std::string&& value);
-  #endif
-  void set_new_name(const char* value);
-  void set_new_name(const char* value, size_t size);
-  ::std::string* mutable_new_name();
-  ::std::string* release_new_name();
-  void set_allocated_new_name(::std::string* new_name);
+  // uint32 packet_size = 2;
+  void clear_packet_size();
+  uint32_t packet_size() const;
+  void set_packet_size(uint32_t value);
+  private:
+  uint32_t _internal_packet_size() const;
+  void _internal_set_packet_size(uint32_t value);
+  public:
 
-  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.RenameRequest)
- private:
+  // .aspia.proto.file_transfer.PacketCompression compression = 3;
+  void clear_compression();
+  ::aspia::proto::file_transfer::PacketCompression compression() const;
+  void set_compression(::aspia::proto::file_transfer::PacketCompression value);
+  private:
+  ::aspia::proto::file_transfer::PacketCompression _internal_compression() const;
+  void _internal_set_compression(::aspia::proto::file_transfer::PacketCompression value);
+  public:
+
+  // bool archive = 4;
+  void clear_archive();
+  bool archive() const;
+  void set_archive(bool value);
+  private:
+  bool _internal_archive() const;
+  void _internal_set_archive(bool value);
+  public:
 
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr old_name_;
-  ::google::protobuf::internal::ArenaStringPtr new_name_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
+  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.DownloadRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+    uint32_t packet_size_;
+    int compression_;
+    bool archive_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5ftransfer_5fsession_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RemoveRequest : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.RemoveRequest) */ {
+class PacketRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.PacketRequest) */ {
  public:
-  RemoveRequest();
-  virtual ~RemoveRequest();
+  inline PacketRequest() : PacketRequest(nullptr) {}
+  ~PacketRequest() override;
+  explicit PROTOBUF_CONSTEXPR PacketRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  RemoveRequest(const RemoveRequest& from);
+  PacketRequest(const PacketRequest& from);
+  PacketRequest(PacketRequest&& from) noexcept
+    : PacketRequest() {
+    *this = ::std::move(from);
+  }
 
-  inline RemoveRequest& operator=(const RemoveRequest& from) {
+  inline PacketRequest& operator=(const PacketRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  #if LANG_CXX11
-  RemoveRequest(RemoveRequest&& from) noexcept
-    : RemoveRequest() {
-    *this = ::std::move(from);
-  }
-
-  inline RemoveRequest& operator=(RemoveRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline PacketRequest& operator=(PacketRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const RemoveRequest& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const RemoveRequest* internal_default_instance() {
-    return reinterpret_cast<const RemoveRequest*>(
-               &_RemoveRequest_default_instance_);
+  static const PacketRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PacketRequest* internal_default_instance() {
+    return reinterpret_cast<const PacketRequest*>(
+               &_PacketRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     12;
 
-  void Swap(RemoveRequest* other);
-  friend void swap(RemoveRequest& a, RemoveRequest& b) {
+  friend void swap(PacketRequest& a, PacketRequest& b) {
     a.Swap(&b);
   }
+  inline void Swap(PacketRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PacketRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline RemoveRequest* New() const final {
-    return CreateMaybeMessage<RemoveRequest>(NULL);
+  PacketRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PacketRequest>(arena);
   }
-
-  RemoveRequest* New(::google::protobuf::Arena* arena) const final {
-    return CreateMaybeMessage<RemoveRequest>(arena);
-  }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
-  void CopyFrom(const RemoveRequest& from);
-  void MergeFrom(const RemoveRequest& from);
-  void Clear() final;
-  bool IsInitialized() const final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const PacketRequest& from);
+  void MergeFrom(const PacketRequest& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(RemoveRequest* other);
+  void InternalSwap(PacketRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.file_transfer.PacketRequest";
   }
+  protected:
+  explicit PacketRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // string path = 1;
-  void clear_path();
-  static const int kPathFieldNumber = 1;
-  const ::std::string& path() const;
-  void set_path(const ::std::string& value);
-  #if LANG_CXX11
-  void set_path(::std::string&& value);
-  #endif
-  void set_path(const char* value);
-  void set_path(const char* value, size_t size);
-  ::std::string* mutable_path();
-  ::std::string* release_path();
-  void set_allocated_path(::std::string* path);
+  enum : int {
+    kPartialFileFieldNumber = 4,
+    kSignatureFieldNumber = 5,
+    kDummyFieldNumber = 1,
+    kPacketSizeFieldNumber = 2,
+    kCompressionFieldNumber = 3,
+    kZeroRangesFieldNumber = 6,
+  };
+  // .aspia.proto.file_transfer.PartialFile partial_file = 4;
+  bool has_partial_file() const;
+  private:
+  bool _internal_has_partial_file() const;
+  public:
+  void clear_partial_file();
+  const ::aspia::proto::file_transfer::PartialFile& partial_file() const;
+  PROTOBUF_NODISCARD ::aspia::proto::file_transfer::PartialFile* release_partial_file();
+  ::aspia::proto::file_transfer::PartialFile* mutable_partial_file();
+  void set_allocated_partial_file(::aspia::proto::file_transfer::PartialFile* partial_file);
+  private:
+  const ::aspia::proto::file_transfer::PartialFile& _internal_partial_file() const;
+  ::aspia::proto::file_transfer::PartialFile* _internal_mutable_partial_file();
+  public:
+  void unsafe_arena_set_allocated_partial_file(
+      ::aspia::proto::file_transfer::PartialFile* partial_file);
+  ::aspia::proto::file_transfer::PartialFile* unsafe_arena_release_partial_file();
 
-  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.RemoveRequest)
- private:
+  // .aspia.proto.file_transfer.FileSignature signature = 5;
+  bool has_signature() const;
+  private:
+  bool _internal_has_signature() const;
+  public:
+  void clear_signature();
+  const ::aspia::proto::file_transfer::FileSignature& signature() const;
+  PROTOBUF_NODISCARD ::aspia::proto::file_transfer::FileSignature* release_signature();
+  ::aspia::proto::file_transfer::FileSignature* mutable_signature();
+  void set_allocated_signature(::aspia::proto::file_transfer::FileSignature* signature);
+  private:
+  const ::aspia::proto::file_transfer::FileSignature& _internal_signature() const;
+  ::aspia::proto::file_transfer::FileSignature* _internal_mutable_signature();
+  public:
+  void unsafe_arena_set_allocated_signature(
+      ::aspia::proto::file_transfer::FileSignature* signature);
+  ::aspia::proto::file_transfer::FileSignature* unsafe_arena_release_signature();
+
+  // uint32 dummy = 1;
+  void clear_dummy();
+  uint32_t dummy() const;
+  void set_dummy(uint32_t value);
+  private:
+  uint32_t _internal_dummy() const;
+  void _internal_set_dummy(uint32_t value);
+  public:
+
+  // uint32 packet_size = 2;
+  void clear_packet_size();
+  uint32_t packet_size() const;
+  void set_packet_size(uint32_t value);
+  private:
+  uint32_t _internal_packet_size() const;
+  void _internal_set_packet_size(uint32_t value);
+  public:
+
+  // .aspia.proto.file_transfer.PacketCompression compression = 3;
+  void clear_compression();
+  ::aspia::proto::file_transfer::PacketCompression compression() const;
+  void set_compression(::aspia::proto::file_transfer::PacketCompression value);
+  private:
+  ::aspia::proto::file_transfer::PacketCompression _internal_compression() const;
+  void _internal_set_compression(::aspia::proto::file_transfer::PacketCompression value);
+  public:
+
+  // bool zero_ranges = 6;
+  void clear_zero_ranges();
+  bool zero_ranges() const;
+  void set_zero_ranges(bool value);
+  private:
+  bool _internal_zero_ranges() const;
+  void _internal_set_zero_ranges(bool value);
+  public:
 
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr path_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
+  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.PacketRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::aspia::proto::file_transfer::PartialFile* partial_file_;
+    ::aspia::proto::file_transfer::FileSignature* signature_;
+    uint32_t dummy_;
+    uint32_t packet_size_;
+    int compression_;
+    bool zero_ranges_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5ftransfer_5fsession_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Reply : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.Reply) */ {
+class Packet final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.Packet) */ {
  public:
-  Reply();
-  virtual ~Reply();
+  inline Packet() : Packet(nullptr) {}
+  ~Packet() override;
+  explicit PROTOBUF_CONSTEXPR Packet(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Reply(const Reply& from);
+  Packet(const Packet& from);
+  Packet(Packet&& from) noexcept
+    : Packet() {
+    *this = ::std::move(from);
+  }
 
-  inline Reply& operator=(const Reply& from) {
+  inline Packet& operator=(const Packet& from) {
     CopyFrom(from);
     return *this;
   }
-  #if LANG_CXX11
-  Reply(Reply&& from) noexcept
-    : Reply() {
-    *this = ::std::move(from);
-  }
-
-  inline Reply& operator=(Reply&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline Packet& operator=(Packet&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const Reply& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const Reply* internal_default_instance() {
-    return reinterpret_cast<const Reply*>(
-               &_Reply_default_instance_);
+  static const Packet& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Packet* internal_default_instance() {
+    return reinterpret_cast<const Packet*>(
+               &_Packet_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     13;
 
-  void Swap(Reply* other);
-  friend void swap(Reply& a, Reply& b) {
+  friend void swap(Packet& a, Packet& b) {
     a.Swap(&b);
   }
+  inline void Swap(Packet* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Packet* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Reply* New() const final {
-    return CreateMaybeMessage<Reply>(NULL);
-  }
-
-  Reply* New(::google::protobuf::Arena* arena) const final {
-    return CreateMaybeMessage<Reply>(arena);
+  Packet* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Packet>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
-  void CopyFrom(const Reply& from);
-  void MergeFrom(const Reply& from);
-  void Clear() final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const Packet& from);
+  void MergeFrom(const Packet& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(Reply* other);
+  void InternalSwap(Packet* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.file_transfer.Packet";
   }
+  protected:
+  explicit Packet(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
+  typedef Packet_Flags Flags;
+  static constexpr Flags FLAG_ERROR =
+    Packet_Flags_FLAG_ERROR;
+  static constexpr Flags FLAG_PACKET =
+    Packet_Flags_FLAG_PACKET;
+  static constexpr Flags FLAG_FIRST_PACKET =
+    Packet_Flags_FLAG_FIRST_PACKET;
+  static constexpr Flags FLAG_LAST_PACKET =
+    Packet_Flags_FLAG_LAST_PACKET;
+  static inline bool Flags_IsValid(int value) {
+    return Packet_Flags_IsValid(value);
+  }
+  static constexpr Flags Flags_MIN =
+    Packet_Flags_Flags_MIN;
+  static constexpr Flags Flags_MAX =
+    Packet_Flags_Flags_MAX;
+  static constexpr int Flags_ARRAYSIZE =
+    Packet_Flags_Flags_ARRAYSIZE;
+  template<typename T>
+  static inline const std::string& Flags_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Flags>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Flags_Name.");
+    return Packet_Flags_Name(enum_t_value);
+  }
+  static inline bool Flags_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Flags* value) {
+    return Packet_Flags_Parse(name, value);
+  }
+
   // accessors -------------------------------------------------------
 
-  // .aspia.proto.file_transfer.DriveList drive_list = 2;
-  bool has_drive_list() const;
-  void clear_drive_list();
-  static const int kDriveListFieldNumber = 2;
+  enum : int {
+    kBlockCopiesFieldNumber = 7,
+    kZeroRangesFieldNumber = 9,
+    kDataFieldNumber = 3,
+    kFileHashFieldNumber = 11,
+    kFileSizeFieldNumber = 2,
+    kFlagsFieldNumber = 1,
+    kCompressionFieldNumber = 4,
+    kOffsetFieldNumber = 6,
+    kCopiedSizeFieldNumber = 8,
+    kDataSizeFieldNumber = 5,
+    kSolidFieldNumber = 12,
+    kZeroSizeFieldNumber = 10,
+  };
+  // repeated .aspia.proto.file_transfer.BlockCopy block_copies = 7;
+  int block_copies_size() const;
   private:
-  const ::aspia::proto::file_transfer::DriveList& _internal_drive_list() const;
+  int _internal_block_copies_size() const;
   public:
-  const ::aspia::proto::file_transfer::DriveList& drive_list() const;
-  ::aspia::proto::file_transfer::DriveList* release_drive_list();
-  ::aspia::proto::file_transfer::DriveList* mutable_drive_list();
-  void set_allocated_drive_list(::aspia::proto::file_transfer::DriveList* drive_list);
+  void clear_block_copies();
+  ::aspia::proto::file_transfer::BlockCopy* mutable_block_copies(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::file_transfer::BlockCopy >*
+      mutable_block_copies();
+  private:
+  const ::aspia::proto::file_transfer::BlockCopy& _internal_block_copies(int index) const;
+  ::aspia::proto::file_transfer::BlockCopy* _internal_add_block_copies();
+  public:
+  const ::aspia::proto::file_transfer::BlockCopy& block_copies(int index) const;
+  ::aspia::proto::file_transfer::BlockCopy* add_block_copies();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::file_transfer::BlockCopy >&
+      block_copies() const;
 
-  // .aspia.proto.file_transfer.FileList file_list = 3;
-  bool has_file_list() const;
-  void clear_file_list();
-  static const int kFileListFieldNumber = 3;
+  // repeated .aspia.proto.file_transfer.ZeroRange zero_ranges = 9;
+  int zero_ranges_size() const;
   private:
-  const ::aspia::proto::file_transfer::FileList& _internal_file_list() const;
+  int _internal_zero_ranges_size() const;
   public:
-  const ::aspia::proto::file_transfer::FileList& file_list() const;
-  ::aspia::proto::file_transfer::FileList* release_file_list();
-  ::aspia::proto::file_transfer::FileList* mutable_file_list();
-  void set_allocated_file_list(::aspia::proto::file_transfer::FileList* file_list);
+  void clear_zero_ranges();
+  ::aspia::proto::file_transfer::ZeroRange* mutable_zero_ranges(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::file_transfer::ZeroRange >*
+      mutable_zero_ranges();
+  private:
+  const ::aspia::proto::file_transfer::ZeroRange& _internal_zero_ranges(int index) const;
+  ::aspia::proto::file_transfer::ZeroRange* _internal_add_zero_ranges();
+  public:
+  const ::aspia::proto::file_transfer::ZeroRange& zero_ranges(int index) const;
+  ::aspia::proto::file_transfer::ZeroRange* add_zero_ranges();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::file_transfer::ZeroRange >&
+      zero_ranges() const;
 
-  // .aspia.proto.file_transfer.Packet packet = 4;
-  bool has_packet() const;
-  void clear_packet();
-  static const int kPacketFieldNumber = 4;
+  // bytes data = 3;
+  void clear_data();
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
   private:
-  const ::aspia::proto::file_transfer::Packet& _internal_packet() const;
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
   public:
-  const ::aspia::proto::file_transfer::Packet& packet() const;
-  ::aspia::proto::file_transfer::Packet* release_packet();
-  ::aspia::proto::file_transfer::Packet* mutable_packet();
-  void set_allocated_packet(::aspia::proto::file_transfer::Packet* packet);
 
-  // .aspia.proto.file_transfer.Status status = 1;
-  void clear_status();
-  static const int kStatusFieldNumber = 1;
-  ::aspia::proto::file_transfer::Status status() const;
-  void set_status(::aspia::proto::file_transfer::Status value);
+  // bytes file_hash = 11;
+  void clear_file_hash();
+  const std::string& file_hash() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_file_hash(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_file_hash();
+  PROTOBUF_NODISCARD std::string* release_file_hash();
+  void set_allocated_file_hash(std::string* file_hash);
+  private:
+  const std::string& _internal_file_hash() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_file_hash(const std::string& value);
+  std::string* _internal_mutable_file_hash();
+  public:
 
-  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.Reply)
- private:
+  // uint64 file_size = 2;
+  void clear_file_size();
+  uint64_t file_size() const;
+  void set_file_size(uint64_t value);
+  private:
+  uint64_t _internal_file_size() const;
+  void _internal_set_file_size(uint64_t value);
+  public:
+
+  // uint32 flags = 1;
+  void clear_flags();
+  uint32_t flags() const;
+  void set_flags(uint32_t value);
+  private:
+  uint32_t _internal_flags() const;
+  void _internal_set_flags(uint32_t value);
+  public:
+
+  // .aspia.proto.file_transfer.PacketCompression compression = 4;
+  void clear_compression();
+  ::aspia::proto::file_transfer::PacketCompression compression() const;
+  void set_compression(::aspia::proto::file_transfer::PacketCompression value);
+  private:
+  ::aspia::proto::file_transfer::PacketCompression _internal_compression() const;
+  void _internal_set_compression(::aspia::proto::file_transfer::PacketCompression value);
+  public:
+
+  // uint64 offset = 6;
+  void clear_offset();
+  uint64_t offset() const;
+  void set_offset(uint64_t value);
+  private:
+  uint64_t _internal_offset() const;
+  void _internal_set_offset(uint64_t value);
+  public:
+
+  // uint64 copied_size = 8;
+  void clear_copied_size();
+  uint64_t copied_size() const;
+  void set_copied_size(uint64_t value);
+  private:
+  uint64_t _internal_copied_size() const;
+  void _internal_set_copied_size(uint64_t value);
+  public:
+
+  // uint32 data_size = 5;
+  void clear_data_size();
+  uint32_t data_size() const;
+  void set_data_size(uint32_t value);
+  private:
+  uint32_t _internal_data_size() const;
+  void _internal_set_data_size(uint32_t value);
+  public:
+
+  // bool solid = 12;
+  void clear_solid();
+  bool solid() const;
+  void set_solid(bool value);
+  private:
+  bool _internal_solid() const;
+  void _internal_set_solid(bool value);
+  public:
+
+  // uint64 zero_size = 10;
+  void clear_zero_size();
+  uint64_t zero_size() const;
+  void set_zero_size(uint64_t value);
+  private:
+  uint64_t _internal_zero_size() const;
+  void _internal_set_zero_size(uint64_t value);
+  public:
 
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::aspia::proto::file_transfer::DriveList* drive_list_;
-  ::aspia::proto::file_transfer::FileList* file_list_;
-  ::aspia::proto::file_transfer::Packet* packet_;
-  int status_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
+  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.Packet)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::file_transfer::BlockCopy > block_copies_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::file_transfer::ZeroRange > zero_ranges_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr file_hash_;
+    uint64_t file_size_;
+    uint32_t flags_;
+    int compression_;
+    uint64_t offset_;
+    uint64_t copied_size_;
+    uint32_t data_size_;
+    bool solid_;
+    uint64_t zero_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5ftransfer_5fsession_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Request : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.Request) */ {
+class CreateDirectoryRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.CreateDirectoryRequest) */ {
  public:
-  Request();
-  virtual ~Request();
+  inline CreateDirectoryRequest() : CreateDirectoryRequest(nullptr) {}
+  ~CreateDirectoryRequest() override;
+  explicit PROTOBUF_CONSTEXPR CreateDirectoryRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Request(const Request& from);
+  CreateDirectoryRequest(const CreateDirectoryRequest& from);
+  CreateDirectoryRequest(CreateDirectoryRequest&& from) noexcept
+    : CreateDirectoryRequest() {
+    *this = ::std::move(from);
+  }
 
-  inline Request& operator=(const Request& from) {
+  inline CreateDirectoryRequest& operator=(const CreateDirectoryRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  #if LANG_CXX11
-  Request(Request&& from) noexcept
-    : Request() {
-    *this = ::std::move(from);
-  }
-
-  inline Request& operator=(Request&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline CreateDirectoryRequest& operator=(CreateDirectoryRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const Request& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const Request* internal_default_instance() {
-    return reinterpret_cast<const Request*>(
-               &_Request_default_instance_);
+  static const CreateDirectoryRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CreateDirectoryRequest* internal_default_instance() {
+    return reinterpret_cast<const CreateDirectoryRequest*>(
+               &_CreateDirectoryRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     14;
 
-  void Swap(Request* other);
-  friend void swap(Request& a, Request& b) {
+  friend void swap(CreateDirectoryRequest& a, CreateDirectoryRequest& b) {
     a.Swap(&b);
   }
+  inline void Swap(CreateDirectoryRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CreateDirectoryRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Request* New() const final {
-    return CreateMaybeMessage<Request>(NULL);
-  }
-
-  Request* New(::google::protobuf::Arena* arena) const final {
-    return CreateMaybeMessage<Request>(arena);
+  CreateDirectoryRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CreateDirectoryRequest>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
-  void CopyFrom(const Request& from);
-  void MergeFrom(const Request& from);
-  void Clear() final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const CreateDirectoryRequest& from);
+  void MergeFrom(const CreateDirectoryRequest& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(Request* other);
+  void InternalSwap(CreateDirectoryRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.file_transfer.CreateDirectoryRequest";
   }
+  protected:
+  explicit CreateDirectoryRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // .aspia.proto.file_transfer.DriveListRequest drive_list_request = 1;
-  bool has_drive_list_request() const;
-  void clear_drive_list_request();
-  static const int kDriveListRequestFieldNumber = 1;
-  private:
-  const ::aspia::proto::file_transfer::DriveListRequest& _internal_drive_list_request() const;
-  public:
-  const ::aspia::proto::file_transfer::DriveListRequest& drive_list_request() const;
-  ::aspia::proto::file_transfer::DriveListRequest* release_drive_list_request();
-  ::aspia::proto::file_transfer::DriveListRequest* mutable_drive_list_request();
-  void set_allocated_drive_list_request(::aspia::proto::file_transfer::DriveListRequest* drive_list_request);
-
-  // .aspia.proto.file_transfer.FileListRequest file_list_request = 2;
-  bool has_file_list_request() const;
-  void clear_file_list_request();
-  static const int kFileListRequestFieldNumber = 2;
+  enum : int {
+    kPathFieldNumber = 1,
+  };
+  // string path = 1;
+  void clear_path();
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
   private:
-  const ::aspia::proto::file_transfer::FileListRequest& _internal_file_list_request() const;
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
   public:
-  const ::aspia::proto::file_transfer::FileListRequest& file_list_request() const;
-  ::aspia::proto::file_transfer::FileListRequest* release_file_list_request();
-  ::aspia::proto::file_transfer::FileListRequest* mutable_file_list_request();
-  void set_allocated_file_list_request(::aspia::proto::file_transfer::FileListRequest* file_list_request);
 
-  // .aspia.proto.file_transfer.CreateDirectoryRequest create_directory_request = 3;
-  bool has_create_directory_request() const;
-  void clear_create_directory_request();
-  static const int kCreateDirectoryRequestFieldNumber = 3;
-  private:
-  const ::aspia::proto::file_transfer::CreateDirectoryRequest& _internal_create_directory_request() const;
-  public:
-  const ::aspia::proto::file_transfer::CreateDirectoryRequest& create_directory_request() const;
-  ::aspia::proto::file_transfer::CreateDirectoryRequest* release_create_directory_request();
-  ::aspia::proto::file_transfer::CreateDirectoryRequest* mutable_create_directory_request();
-  void set_allocated_create_directory_request(::aspia::proto::file_transfer::CreateDirectoryRequest* create_directory_request);
+  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.CreateDirectoryRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5ftransfer_5fsession_2eproto;
+};
+// -------------------------------------------------------------------
 
-  // .aspia.proto.file_transfer.RenameRequest rename_request = 4;
-  bool has_rename_request() const;
-  void clear_rename_request();
-  static const int kRenameRequestFieldNumber = 4;
-  private:
-  const ::aspia::proto::file_transfer::RenameRequest& _internal_rename_request() const;
-  public:
-  const ::aspia::proto::file_transfer::RenameRequest& rename_request() const;
-  ::aspia::proto::file_transfer::RenameRequest* release_rename_request();
-  ::aspia::proto::file_transfer::RenameRequest* mutable_rename_request();
-  void set_allocated_rename_request(::aspia::proto::file_transfer::RenameRequest* rename_request);
+class RenameRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.RenameRequest) */ {
+ public:
+  inline RenameRequest() : RenameRequest(nullptr) {}
+  ~RenameRequest() override;
+  explicit PROTOBUF_CONSTEXPR RenameRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  // .aspia.proto.file_transfer.RemoveRequest remove_request = 5;
-  bool has_remove_request() const;
-  void clear_remove_request();
-  static const int kRemoveRequestFieldNumber = 5;
-  private:
-  const ::aspia::proto::file_transfer::RemoveRequest& _internal_remove_request() const;
-  public:
-  const ::aspia::proto::file_transfer::RemoveRequest& remove_request() const;
-  ::aspia::proto::file_transfer::RemoveRequest* release_remove_request();
-  ::aspia::proto::file_transfer::RemoveRequest* mutable_remove_request();
-  void set_allocated_remove_request(::aspia::proto::file_transfer::RemoveRequest* remove_request);
+  RenameRequest(const RenameRequest& from);
+  RenameRequest(RenameRequest&& from) noexcept
+    : RenameRequest() {
+    *this = ::std::move(from);
+  }
 
-  // .aspia.proto.file_transfer.DownloadRequest download_request = 6;
-  bool has_download_request() const;
-  void clear_download_request();
-  static const int kDownloadRequestFieldNumber = 6;
-  private:
-  const ::aspia::proto::file_transfer::DownloadRequest& _internal_download_request() const;
-  public:
-  const ::aspia::proto::file_transfer::DownloadRequest& download_request() const;
-  ::aspia::proto::file_transfer::DownloadRequest* release_download_request();
-  ::aspia::proto::file_transfer::DownloadRequest* mutable_download_request();
-  void set_allocated_download_request(::aspia::proto::file_transfer::DownloadRequest* download_request);
+  inline RenameRequest& operator=(const RenameRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RenameRequest& operator=(RenameRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const RenameRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RenameRequest* internal_default_instance() {
+    return reinterpret_cast<const RenameRequest*>(
+               &_RenameRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(RenameRequest& a, RenameRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RenameRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RenameRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RenameRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RenameRequest>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const RenameRequest& from);
+  void MergeFrom(const RenameRequest& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  // .aspia.proto.file_transfer.UploadRequest upload_request = 7;
-  bool has_upload_request() const;
-  void clear_upload_request();
-  static const int kUploadRequestFieldNumber = 7;
   private:
-  const ::aspia::proto::file_transfer::UploadRequest& _internal_upload_request() const;
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(RenameRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.file_transfer.RenameRequest";
+  }
+  protected:
+  explicit RenameRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  const ::aspia::proto::file_transfer::UploadRequest& upload_request() const;
-  ::aspia::proto::file_transfer::UploadRequest* release_upload_request();
-  ::aspia::proto::file_transfer::UploadRequest* mutable_upload_request();
-  void set_allocated_upload_request(::aspia::proto::file_transfer::UploadRequest* upload_request);
 
-  // .aspia.proto.file_transfer.PacketRequest packet_request = 8;
-  bool has_packet_request() const;
-  void clear_packet_request();
-  static const int kPacketRequestFieldNumber = 8;
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOldNameFieldNumber = 1,
+    kNewNameFieldNumber = 2,
+  };
+  // string old_name = 1;
+  void clear_old_name();
+  const std::string& old_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_old_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_old_name();
+  PROTOBUF_NODISCARD std::string* release_old_name();
+  void set_allocated_old_name(std::string* old_name);
   private:
-  const ::aspia::proto::file_transfer::PacketRequest& _internal_packet_request() const;
+  const std::string& _internal_old_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_old_name(const std::string& value);
+  std::string* _internal_mutable_old_name();
   public:
-  const ::aspia::proto::file_transfer::PacketRequest& packet_request() const;
-  ::aspia::proto::file_transfer::PacketRequest* release_packet_request();
-  ::aspia::proto::file_transfer::PacketRequest* mutable_packet_request();
-  void set_allocated_packet_request(::aspia::proto::file_transfer::PacketRequest* packet_request);
 
-  // .aspia.proto.file_transfer.Packet packet = 9;
-  bool has_packet() const;
-  void clear_packet();
-  static const int kPacketFieldNumber = 9;
+  // string new_name = 2;
+  void clear_new_name();
+  const std::string& new_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_new_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_new_name();
+  PROTOBUF_NODISCARD std::string* release_new_name();
+  void set_allocated_new_name(std::string* new_name);
   private:
-  const ::aspia::proto::file_transfer::Packet& _internal_packet() const;
+  const std::string& _internal_new_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_new_name(const std::string& value);
+  std::string* _internal_mutable_new_name();
   public:
-  const ::aspia::proto::file_transfer::Packet& packet() const;
-  ::aspia::proto::file_transfer::Packet* release_packet();
-  ::aspia::proto::file_transfer::Packet* mutable_packet();
-  void set_allocated_packet(::aspia::proto::file_transfer::Packet* packet);
 
-  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.Request)
+  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.RenameRequest)
  private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr old_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr new_name_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5ftransfer_5fsession_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RemoveRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.RemoveRequest) */ {
+ public:
+  inline RemoveRequest() : RemoveRequest(nullptr) {}
+  ~RemoveRequest() override;
+  explicit PROTOBUF_CONSTEXPR RemoveRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RemoveRequest(const RemoveRequest& from);
+  RemoveRequest(RemoveRequest&& from) noexcept
+    : RemoveRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline RemoveRequest& operator=(const RemoveRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RemoveRequest& operator=(RemoveRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const RemoveRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RemoveRequest* internal_default_instance() {
+    return reinterpret_cast<const RemoveRequest*>(
+               &_RemoveRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(RemoveRequest& a, RemoveRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RemoveRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RemoveRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RemoveRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RemoveRequest>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const RemoveRequest& from);
+  void MergeFrom(const RemoveRequest& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(RemoveRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.file_transfer.RemoveRequest";
+  }
+  protected:
+  explicit RemoveRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPathFieldNumber = 1,
+    kRecursiveFieldNumber = 2,
+  };
+  // string path = 1;
+  void clear_path();
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
+
+  // bool recursive = 2;
+  void clear_recursive();
+  bool recursive() const;
+  void set_recursive(bool value);
+  private:
+  bool _internal_recursive() const;
+  void _internal_set_recursive(bool value);
+  public:
 
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::aspia::proto::file_transfer::DriveListRequest* drive_list_request_;
-  ::aspia::proto::file_transfer::FileListRequest* file_list_request_;
-  ::aspia::proto::file_transfer::CreateDirectoryRequest* create_directory_request_;
-  ::aspia::proto::file_transfer::RenameRequest* rename_request_;
-  ::aspia::proto::file_transfer::RemoveRequest* remove_request_;
-  ::aspia::proto::file_transfer::DownloadRequest* download_request_;
-  ::aspia::proto::file_transfer::UploadRequest* upload_request_;
-  ::aspia::proto::file_transfer::PacketRequest* packet_request_;
-  ::aspia::proto::file_transfer::Packet* packet_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_file_5ftransfer_5fsession_2eproto::TableStruct;
+  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.RemoveRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+    bool recursive_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5ftransfer_5fsession_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
 
+class RemoteCopyRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.RemoteCopyRequest) */ {
+ public:
+  inline RemoteCopyRequest() : RemoteCopyRequest(nullptr) {}
+  ~RemoteCopyRequest() override;
+  explicit PROTOBUF_CONSTEXPR RemoteCopyRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// ===================================================================
+  RemoteCopyRequest(const RemoteCopyRequest& from);
+  RemoteCopyRequest(RemoteCopyRequest&& from) noexcept
+    : RemoteCopyRequest() {
+    *this = ::std::move(from);
+  }
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// DriveList_Item
+  inline RemoteCopyRequest& operator=(const RemoteCopyRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RemoteCopyRequest& operator=(RemoteCopyRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// .aspia.proto.file_transfer.DriveList.Item.Type type = 1;
-inline void DriveList_Item::clear_type() {
-  type_ = 0;
-}
-inline ::aspia::proto::file_transfer::DriveList_Item_Type DriveList_Item::type() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.DriveList.Item.type)
-  return static_cast< ::aspia::proto::file_transfer::DriveList_Item_Type >(type_);
-}
-inline void DriveList_Item::set_type(::aspia::proto::file_transfer::DriveList_Item_Type value) {
-  
-  type_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.DriveList.Item.type)
-}
+  static const RemoteCopyRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RemoteCopyRequest* internal_default_instance() {
+    return reinterpret_cast<const RemoteCopyRequest*>(
+               &_RemoteCopyRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
 
-// string path = 2;
-inline void DriveList_Item::clear_path() {
-  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline const ::std::string& DriveList_Item::path() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.DriveList.Item.path)
-  return path_.GetNoArena();
-}
-inline void DriveList_Item::set_path(const ::std::string& value) {
-  
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.DriveList.Item.path)
+  friend void swap(RemoteCopyRequest& a, RemoteCopyRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RemoteCopyRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RemoteCopyRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RemoteCopyRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RemoteCopyRequest>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const RemoteCopyRequest& from);
+  void MergeFrom(const RemoteCopyRequest& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(RemoteCopyRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.file_transfer.RemoteCopyRequest";
+  }
+  protected:
+  explicit RemoteCopyRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPathFieldNumber = 1,
+    kTargetAddressFieldNumber = 2,
+    kTargetUserNameFieldNumber = 4,
+    kTargetPasswordFieldNumber = 5,
+    kTargetPathFieldNumber = 6,
+    kTargetPortFieldNumber = 3,
+    kOverwriteFieldNumber = 7,
+  };
+  // string path = 1;
+  void clear_path();
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
+
+  // string target_address = 2;
+  void clear_target_address();
+  const std::string& target_address() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_target_address(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_target_address();
+  PROTOBUF_NODISCARD std::string* release_target_address();
+  void set_allocated_target_address(std::string* target_address);
+  private:
+  const std::string& _internal_target_address() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_target_address(const std::string& value);
+  std::string* _internal_mutable_target_address();
+  public:
+
+  // string target_user_name = 4;
+  void clear_target_user_name();
+  const std::string& target_user_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_target_user_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_target_user_name();
+  PROTOBUF_NODISCARD std::string* release_target_user_name();
+  void set_allocated_target_user_name(std::string* target_user_name);
+  private:
+  const std::string& _internal_target_user_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_target_user_name(const std::string& value);
+  std::string* _internal_mutable_target_user_name();
+  public:
+
+  // string target_password = 5;
+  void clear_target_password();
+  const std::string& target_password() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_target_password(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_target_password();
+  PROTOBUF_NODISCARD std::string* release_target_password();
+  void set_allocated_target_password(std::string* target_password);
+  private:
+  const std::string& _internal_target_password() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_target_password(const std::string& value);
+  std::string* _internal_mutable_target_password();
+  public:
+
+  // string target_path = 6;
+  void clear_target_path();
+  const std::string& target_path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_target_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_target_path();
+  PROTOBUF_NODISCARD std::string* release_target_path();
+  void set_allocated_target_path(std::string* target_path);
+  private:
+  const std::string& _internal_target_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_target_path(const std::string& value);
+  std::string* _internal_mutable_target_path();
+  public:
+
+  // uint32 target_port = 3;
+  void clear_target_port();
+  uint32_t target_port() const;
+  void set_target_port(uint32_t value);
+  private:
+  uint32_t _internal_target_port() const;
+  void _internal_set_target_port(uint32_t value);
+  public:
+
+  // bool overwrite = 7;
+  void clear_overwrite();
+  bool overwrite() const;
+  void set_overwrite(bool value);
+  private:
+  bool _internal_overwrite() const;
+  void _internal_set_overwrite(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.RemoteCopyRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr target_address_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr target_user_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr target_password_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr target_path_;
+    uint32_t target_port_;
+    bool overwrite_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5ftransfer_5fsession_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Reply final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.Reply) */ {
+ public:
+  inline Reply() : Reply(nullptr) {}
+  ~Reply() override;
+  explicit PROTOBUF_CONSTEXPR Reply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Reply(const Reply& from);
+  Reply(Reply&& from) noexcept
+    : Reply() {
+    *this = ::std::move(from);
+  }
+
+  inline Reply& operator=(const Reply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Reply& operator=(Reply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const Reply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Reply* internal_default_instance() {
+    return reinterpret_cast<const Reply*>(
+               &_Reply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(Reply& a, Reply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Reply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Reply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Reply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Reply>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const Reply& from);
+  void MergeFrom(const Reply& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(Reply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.file_transfer.Reply";
+  }
+  protected:
+  explicit Reply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kExistingFilesFieldNumber = 10,
+    kFailedFilesFieldNumber = 11,
+    kErrorStringFieldNumber = 9,
+    kDriveListFieldNumber = 2,
+    kFileListFieldNumber = 3,
+    kPacketFieldNumber = 4,
+    kPartialFileFieldNumber = 5,
+    kSignatureFieldNumber = 6,
+    kStatusFieldNumber = 1,
+    kZeroRangesFieldNumber = 7,
+    kRequestIdFieldNumber = 8,
+  };
+  // repeated string existing_files = 10;
+  int existing_files_size() const;
+  private:
+  int _internal_existing_files_size() const;
+  public:
+  void clear_existing_files();
+  const std::string& existing_files(int index) const;
+  std::string* mutable_existing_files(int index);
+  void set_existing_files(int index, const std::string& value);
+  void set_existing_files(int index, std::string&& value);
+  void set_existing_files(int index, const char* value);
+  void set_existing_files(int index, const char* value, size_t size);
+  std::string* add_existing_files();
+  void add_existing_files(const std::string& value);
+  void add_existing_files(std::string&& value);
+  void add_existing_files(const char* value);
+  void add_existing_files(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& existing_files() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_existing_files();
+  private:
+  const std::string& _internal_existing_files(int index) const;
+  std::string* _internal_add_existing_files();
+  public:
+
+  // repeated string failed_files = 11;
+  int failed_files_size() const;
+  private:
+  int _internal_failed_files_size() const;
+  public:
+  void clear_failed_files();
+  const std::string& failed_files(int index) const;
+  std::string* mutable_failed_files(int index);
+  void set_failed_files(int index, const std::string& value);
+  void set_failed_files(int index, std::string&& value);
+  void set_failed_files(int index, const char* value);
+  void set_failed_files(int index, const char* value, size_t size);
+  std::string* add_failed_files();
+  void add_failed_files(const std::string& value);
+  void add_failed_files(std::string&& value);
+  void add_failed_files(const char* value);
+  void add_failed_files(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& failed_files() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_failed_files();
+  private:
+  const std::string& _internal_failed_files(int index) const;
+  std::string* _internal_add_failed_files();
+  public:
+
+  // string error_string = 9;
+  void clear_error_string();
+  const std::string& error_string() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_string(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error_string();
+  PROTOBUF_NODISCARD std::string* release_error_string();
+  void set_allocated_error_string(std::string* error_string);
+  private:
+  const std::string& _internal_error_string() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_string(const std::string& value);
+  std::string* _internal_mutable_error_string();
+  public:
+
+  // .aspia.proto.file_transfer.DriveList drive_list = 2;
+  bool has_drive_list() const;
+  private:
+  bool _internal_has_drive_list() const;
+  public:
+  void clear_drive_list();
+  const ::aspia::proto::file_transfer::DriveList& drive_list() const;
+  PROTOBUF_NODISCARD ::aspia::proto::file_transfer::DriveList* release_drive_list();
+  ::aspia::proto::file_transfer::DriveList* mutable_drive_list();
+  void set_allocated_drive_list(::aspia::proto::file_transfer::DriveList* drive_list);
+  private:
+  const ::aspia::proto::file_transfer::DriveList& _internal_drive_list() const;
+  ::aspia::proto::file_transfer::DriveList* _internal_mutable_drive_list();
+  public:
+  void unsafe_arena_set_allocated_drive_list(
+      ::aspia::proto::file_transfer::DriveList* drive_list);
+  ::aspia::proto::file_transfer::DriveList* unsafe_arena_release_drive_list();
+
+  // .aspia.proto.file_transfer.FileList file_list = 3;
+  bool has_file_list() const;
+  private:
+  bool _internal_has_file_list() const;
+  public:
+  void clear_file_list();
+  const ::aspia::proto::file_transfer::FileList& file_list() const;
+  PROTOBUF_NODISCARD ::aspia::proto::file_transfer::FileList* release_file_list();
+  ::aspia::proto::file_transfer::FileList* mutable_file_list();
+  void set_allocated_file_list(::aspia::proto::file_transfer::FileList* file_list);
+  private:
+  const ::aspia::proto::file_transfer::FileList& _internal_file_list() const;
+  ::aspia::proto::file_transfer::FileList* _internal_mutable_file_list();
+  public:
+  void unsafe_arena_set_allocated_file_list(
+      ::aspia::proto::file_transfer::FileList* file_list);
+  ::aspia::proto::file_transfer::FileList* unsafe_arena_release_file_list();
+
+  // .aspia.proto.file_transfer.Packet packet = 4;
+  bool has_packet() const;
+  private:
+  bool _internal_has_packet() const;
+  public:
+  void clear_packet();
+  const ::aspia::proto::file_transfer::Packet& packet() const;
+  PROTOBUF_NODISCARD ::aspia::proto::file_transfer::Packet* release_packet();
+  ::aspia::proto::file_transfer::Packet* mutable_packet();
+  void set_allocated_packet(::aspia::proto::file_transfer::Packet* packet);
+  private:
+  const ::aspia::proto::file_transfer::Packet& _internal_packet() const;
+  ::aspia::proto::file_transfer::Packet* _internal_mutable_packet();
+  public:
+  void unsafe_arena_set_allocated_packet(
+      ::aspia::proto::file_transfer::Packet* packet);
+  ::aspia::proto::file_transfer::Packet* unsafe_arena_release_packet();
+
+  // .aspia.proto.file_transfer.PartialFile partial_file = 5;
+  bool has_partial_file() const;
+  private:
+  bool _internal_has_partial_file() const;
+  public:
+  void clear_partial_file();
+  const ::aspia::proto::file_transfer::PartialFile& partial_file() const;
+  PROTOBUF_NODISCARD ::aspia::proto::file_transfer::PartialFile* release_partial_file();
+  ::aspia::proto::file_transfer::PartialFile* mutable_partial_file();
+  void set_allocated_partial_file(::aspia::proto::file_transfer::PartialFile* partial_file);
+  private:
+  const ::aspia::proto::file_transfer::PartialFile& _internal_partial_file() const;
+  ::aspia::proto::file_transfer::PartialFile* _internal_mutable_partial_file();
+  public:
+  void unsafe_arena_set_allocated_partial_file(
+      ::aspia::proto::file_transfer::PartialFile* partial_file);
+  ::aspia::proto::file_transfer::PartialFile* unsafe_arena_release_partial_file();
+
+  // .aspia.proto.file_transfer.FileSignature signature = 6;
+  bool has_signature() const;
+  private:
+  bool _internal_has_signature() const;
+  public:
+  void clear_signature();
+  const ::aspia::proto::file_transfer::FileSignature& signature() const;
+  PROTOBUF_NODISCARD ::aspia::proto::file_transfer::FileSignature* release_signature();
+  ::aspia::proto::file_transfer::FileSignature* mutable_signature();
+  void set_allocated_signature(::aspia::proto::file_transfer::FileSignature* signature);
+  private:
+  const ::aspia::proto::file_transfer::FileSignature& _internal_signature() const;
+  ::aspia::proto::file_transfer::FileSignature* _internal_mutable_signature();
+  public:
+  void unsafe_arena_set_allocated_signature(
+      ::aspia::proto::file_transfer::FileSignature* signature);
+  ::aspia::proto::file_transfer::FileSignature* unsafe_arena_release_signature();
+
+  // .aspia.proto.file_transfer.Status status = 1;
+  void clear_status();
+  ::aspia::proto::file_transfer::Status status() const;
+  void set_status(::aspia::proto::file_transfer::Status value);
+  private:
+  ::aspia::proto::file_transfer::Status _internal_status() const;
+  void _internal_set_status(::aspia::proto::file_transfer::Status value);
+  public:
+
+  // bool zero_ranges = 7;
+  void clear_zero_ranges();
+  bool zero_ranges() const;
+  void set_zero_ranges(bool value);
+  private:
+  bool _internal_zero_ranges() const;
+  void _internal_set_zero_ranges(bool value);
+  public:
+
+  // uint64 request_id = 8;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.Reply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> existing_files_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> failed_files_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_string_;
+    ::aspia::proto::file_transfer::DriveList* drive_list_;
+    ::aspia::proto::file_transfer::FileList* file_list_;
+    ::aspia::proto::file_transfer::Packet* packet_;
+    ::aspia::proto::file_transfer::PartialFile* partial_file_;
+    ::aspia::proto::file_transfer::FileSignature* signature_;
+    int status_;
+    bool zero_ranges_;
+    uint64_t request_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5ftransfer_5fsession_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Request final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.file_transfer.Request) */ {
+ public:
+  inline Request() : Request(nullptr) {}
+  ~Request() override;
+  explicit PROTOBUF_CONSTEXPR Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Request(const Request& from);
+  Request(Request&& from) noexcept
+    : Request() {
+    *this = ::std::move(from);
+  }
+
+  inline Request& operator=(const Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Request& operator=(Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Request* internal_default_instance() {
+    return reinterpret_cast<const Request*>(
+               &_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(Request& a, Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Request>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const Request& from);
+  void MergeFrom(const Request& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(Request* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.file_transfer.Request";
+  }
+  protected:
+  explicit Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDriveListRequestFieldNumber = 1,
+    kFileListRequestFieldNumber = 2,
+    kCreateDirectoryRequestFieldNumber = 3,
+    kRenameRequestFieldNumber = 4,
+    kRemoveRequestFieldNumber = 5,
+    kDownloadRequestFieldNumber = 6,
+    kUploadRequestFieldNumber = 7,
+    kPacketRequestFieldNumber = 8,
+    kPacketFieldNumber = 9,
+    kRemoteCopyRequestFieldNumber = 11,
+    kRequestIdFieldNumber = 10,
+  };
+  // .aspia.proto.file_transfer.DriveListRequest drive_list_request = 1;
+  bool has_drive_list_request() const;
+  private:
+  bool _internal_has_drive_list_request() const;
+  public:
+  void clear_drive_list_request();
+  const ::aspia::proto::file_transfer::DriveListRequest& drive_list_request() const;
+  PROTOBUF_NODISCARD ::aspia::proto::file_transfer::DriveListRequest* release_drive_list_request();
+  ::aspia::proto::file_transfer::DriveListRequest* mutable_drive_list_request();
+  void set_allocated_drive_list_request(::aspia::proto::file_transfer::DriveListRequest* drive_list_request);
+  private:
+  const ::aspia::proto::file_transfer::DriveListRequest& _internal_drive_list_request() const;
+  ::aspia::proto::file_transfer::DriveListRequest* _internal_mutable_drive_list_request();
+  public:
+  void unsafe_arena_set_allocated_drive_list_request(
+      ::aspia::proto::file_transfer::DriveListRequest* drive_list_request);
+  ::aspia::proto::file_transfer::DriveListRequest* unsafe_arena_release_drive_list_request();
+
+  // .aspia.proto.file_transfer.FileListRequest file_list_request = 2;
+  bool has_file_list_request() const;
+  private:
+  bool _internal_has_file_list_request() const;
+  public:
+  void clear_file_list_request();
+  const ::aspia::proto::file_transfer::FileListRequest& file_list_request() const;
+  PROTOBUF_NODISCARD ::aspia::proto::file_transfer::FileListRequest* release_file_list_request();
+  ::aspia::proto::file_transfer::FileListRequest* mutable_file_list_request();
+  void set_allocated_file_list_request(::aspia::proto::file_transfer::FileListRequest* file_list_request);
+  private:
+  const ::aspia::proto::file_transfer::FileListRequest& _internal_file_list_request() const;
+  ::aspia::proto::file_transfer::FileListRequest* _internal_mutable_file_list_request();
+  public:
+  void unsafe_arena_set_allocated_file_list_request(
+      ::aspia::proto::file_transfer::FileListRequest* file_list_request);
+  ::aspia::proto::file_transfer::FileListRequest* unsafe_arena_release_file_list_request();
+
+  // .aspia.proto.file_transfer.CreateDirectoryRequest create_directory_request = 3;
+  bool has_create_directory_request() const;
+  private:
+  bool _internal_has_create_directory_request() const;
+  public:
+  void clear_create_directory_request();
+  const ::aspia::proto::file_transfer::CreateDirectoryRequest& create_directory_request() const;
+  PROTOBUF_NODISCARD ::aspia::proto::file_transfer::CreateDirectoryRequest* release_create_directory_request();
+  ::aspia::proto::file_transfer::CreateDirectoryRequest* mutable_create_directory_request();
+  void set_allocated_create_directory_request(::aspia::proto::file_transfer::CreateDirectoryRequest* create_directory_request);
+  private:
+  const ::aspia::proto::file_transfer::CreateDirectoryRequest& _internal_create_directory_request() const;
+  ::aspia::proto::file_transfer::CreateDirectoryRequest* _internal_mutable_create_directory_request();
+  public:
+  void unsafe_arena_set_allocated_create_directory_request(
+      ::aspia::proto::file_transfer::CreateDirectoryRequest* create_directory_request);
+  ::aspia::proto::file_transfer::CreateDirectoryRequest* unsafe_arena_release_create_directory_request();
+
+  // .aspia.proto.file_transfer.RenameRequest rename_request = 4;
+  bool has_rename_request() const;
+  private:
+  bool _internal_has_rename_request() const;
+  public:
+  void clear_rename_request();
+  const ::aspia::proto::file_transfer::RenameRequest& rename_request() const;
+  PROTOBUF_NODISCARD ::aspia::proto::file_transfer::RenameRequest* release_rename_request();
+  ::aspia::proto::file_transfer::RenameRequest* mutable_rename_request();
+  void set_allocated_rename_request(::aspia::proto::file_transfer::RenameRequest* rename_request);
+  private:
+  const ::aspia::proto::file_transfer::RenameRequest& _internal_rename_request() const;
+  ::aspia::proto::file_transfer::RenameRequest* _internal_mutable_rename_request();
+  public:
+  void unsafe_arena_set_allocated_rename_request(
+      ::aspia::proto::file_transfer::RenameRequest* rename_request);
+  ::aspia::proto::file_transfer::RenameRequest* unsafe_arena_release_rename_request();
+
+  // .aspia.proto.file_transfer.RemoveRequest remove_request = 5;
+  bool has_remove_request() const;
+  private:
+  bool _internal_has_remove_request() const;
+  public:
+  void clear_remove_request();
+  const ::aspia::proto::file_transfer::RemoveRequest& remove_request() const;
+  PROTOBUF_NODISCARD ::aspia::proto::file_transfer::RemoveRequest* release_remove_request();
+  ::aspia::proto::file_transfer::RemoveRequest* mutable_remove_request();
+  void set_allocated_remove_request(::aspia::proto::file_transfer::RemoveRequest* remove_request);
+  private:
+  const ::aspia::proto::file_transfer::RemoveRequest& _internal_remove_request() const;
+  ::aspia::proto::file_transfer::RemoveRequest* _internal_mutable_remove_request();
+  public:
+  void unsafe_arena_set_allocated_remove_request(
+      ::aspia::proto::file_transfer::RemoveRequest* remove_request);
+  ::aspia::proto::file_transfer::RemoveRequest* unsafe_arena_release_remove_request();
+
+  // .aspia.proto.file_transfer.DownloadRequest download_request = 6;
+  bool has_download_request() const;
+  private:
+  bool _internal_has_download_request() const;
+  public:
+  void clear_download_request();
+  const ::aspia::proto::file_transfer::DownloadRequest& download_request() const;
+  PROTOBUF_NODISCARD ::aspia::proto::file_transfer::DownloadRequest* release_download_request();
+  ::aspia::proto::file_transfer::DownloadRequest* mutable_download_request();
+  void set_allocated_download_request(::aspia::proto::file_transfer::DownloadRequest* download_request);
+  private:
+  const ::aspia::proto::file_transfer::DownloadRequest& _internal_download_request() const;
+  ::aspia::proto::file_transfer::DownloadRequest* _internal_mutable_download_request();
+  public:
+  void unsafe_arena_set_allocated_download_request(
+      ::aspia::proto::file_transfer::DownloadRequest* download_request);
+  ::aspia::proto::file_transfer::DownloadRequest* unsafe_arena_release_download_request();
+
+  // .aspia.proto.file_transfer.UploadRequest upload_request = 7;
+  bool has_upload_request() const;
+  private:
+  bool _internal_has_upload_request() const;
+  public:
+  void clear_upload_request();
+  const ::aspia::proto::file_transfer::UploadRequest& upload_request() const;
+  PROTOBUF_NODISCARD ::aspia::proto::file_transfer::UploadRequest* release_upload_request();
+  ::aspia::proto::file_transfer::UploadRequest* mutable_upload_request();
+  void set_allocated_upload_request(::aspia::proto::file_transfer::UploadRequest* upload_request);
+  private:
+  const ::aspia::proto::file_transfer::UploadRequest& _internal_upload_request() const;
+  ::aspia::proto::file_transfer::UploadRequest* _internal_mutable_upload_request();
+  public:
+  void unsafe_arena_set_allocated_upload_request(
+      ::aspia::proto::file_transfer::UploadRequest* upload_request);
+  ::aspia::proto::file_transfer::UploadRequest* unsafe_arena_release_upload_request();
+
+  // .aspia.proto.file_transfer.PacketRequest packet_request = 8;
+  bool has_packet_request() const;
+  private:
+  bool _internal_has_packet_request() const;
+  public:
+  void clear_packet_request();
+  const ::aspia::proto::file_transfer::PacketRequest& packet_request() const;
+  PROTOBUF_NODISCARD ::aspia::proto::file_transfer::PacketRequest* release_packet_request();
+  ::aspia::proto::file_transfer::PacketRequest* mutable_packet_request();
+  void set_allocated_packet_request(::aspia::proto::file_transfer::PacketRequest* packet_request);
+  private:
+  const ::aspia::proto::file_transfer::PacketRequest& _internal_packet_request() const;
+  ::aspia::proto::file_transfer::PacketRequest* _internal_mutable_packet_request();
+  public:
+  void unsafe_arena_set_allocated_packet_request(
+      ::aspia::proto::file_transfer::PacketRequest* packet_request);
+  ::aspia::proto::file_transfer::PacketRequest* unsafe_arena_release_packet_request();
+
+  // .aspia.proto.file_transfer.Packet packet = 9;
+  bool has_packet() const;
+  private:
+  bool _internal_has_packet() const;
+  public:
+  void clear_packet();
+  const ::aspia::proto::file_transfer::Packet& packet() const;
+  PROTOBUF_NODISCARD ::aspia::proto::file_transfer::Packet* release_packet();
+  ::aspia::proto::file_transfer::Packet* mutable_packet();
+  void set_allocated_packet(::aspia::proto::file_transfer::Packet* packet);
+  private:
+  const ::aspia::proto::file_transfer::Packet& _internal_packet() const;
+  ::aspia::proto::file_transfer::Packet* _internal_mutable_packet();
+  public:
+  void unsafe_arena_set_allocated_packet(
+      ::aspia::proto::file_transfer::Packet* packet);
+  ::aspia::proto::file_transfer::Packet* unsafe_arena_release_packet();
+
+  // .aspia.proto.file_transfer.RemoteCopyRequest remote_copy_request = 11;
+  bool has_remote_copy_request() const;
+  private:
+  bool _internal_has_remote_copy_request() const;
+  public:
+  void clear_remote_copy_request();
+  const ::aspia::proto::file_transfer::RemoteCopyRequest& remote_copy_request() const;
+  PROTOBUF_NODISCARD ::aspia::proto::file_transfer::RemoteCopyRequest* release_remote_copy_request();
+  ::aspia::proto::file_transfer::RemoteCopyRequest* mutable_remote_copy_request();
+  void set_allocated_remote_copy_request(::aspia::proto::file_transfer::RemoteCopyRequest* remote_copy_request);
+  private:
+  const ::aspia::proto::file_transfer::RemoteCopyRequest& _internal_remote_copy_request() const;
+  ::aspia::proto::file_transfer::RemoteCopyRequest* _internal_mutable_remote_copy_request();
+  public:
+  void unsafe_arena_set_allocated_remote_copy_request(
+      ::aspia::proto::file_transfer::RemoteCopyRequest* remote_copy_request);
+  ::aspia::proto::file_transfer::RemoteCopyRequest* unsafe_arena_release_remote_copy_request();
+
+  // uint64 request_id = 10;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.file_transfer.Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::aspia::proto::file_transfer::DriveListRequest* drive_list_request_;
+    ::aspia::proto::file_transfer::FileListRequest* file_list_request_;
+    ::aspia::proto::file_transfer::CreateDirectoryRequest* create_directory_request_;
+    ::aspia::proto::file_transfer::RenameRequest* rename_request_;
+    ::aspia::proto::file_transfer::RemoveRequest* remove_request_;
+    ::aspia::proto::file_transfer::DownloadRequest* download_request_;
+    ::aspia::proto::file_transfer::UploadRequest* upload_request_;
+    ::aspia::proto::file_transfer::PacketRequest* packet_request_;
+    ::aspia::proto::file_transfer::Packet* packet_;
+    ::aspia::proto::file_transfer::RemoteCopyRequest* remote_copy_request_;
+    uint64_t request_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5ftransfer_5fsession_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// DriveList_Item
+
+// .aspia.proto.file_transfer.DriveList.Item.Type type = 1;
+inline void DriveList_Item::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::aspia::proto::file_transfer::DriveList_Item_Type DriveList_Item::_internal_type() const {
+  return static_cast< ::aspia::proto::file_transfer::DriveList_Item_Type >(_impl_.type_);
+}
+inline ::aspia::proto::file_transfer::DriveList_Item_Type DriveList_Item::type() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.DriveList.Item.type)
+  return _internal_type();
+}
+inline void DriveList_Item::_internal_set_type(::aspia::proto::file_transfer::DriveList_Item_Type value) {
+  
+  _impl_.type_ = value;
+}
+inline void DriveList_Item::set_type(::aspia::proto::file_transfer::DriveList_Item_Type value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.DriveList.Item.type)
+}
+
+// string path = 2;
+inline void DriveList_Item::clear_path() {
+  _impl_.path_.ClearToEmpty();
+}
+inline const std::string& DriveList_Item::path() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.DriveList.Item.path)
+  return _internal_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DriveList_Item::set_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.DriveList.Item.path)
+}
+inline std::string* DriveList_Item::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.DriveList.Item.path)
+  return _s;
+}
+inline const std::string& DriveList_Item::_internal_path() const {
+  return _impl_.path_.Get();
+}
+inline void DriveList_Item::_internal_set_path(const std::string& value) {
+  
+  _impl_.path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DriveList_Item::_internal_mutable_path() {
+  
+  return _impl_.path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DriveList_Item::release_path() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.DriveList.Item.path)
+  return _impl_.path_.Release();
+}
+inline void DriveList_Item::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.DriveList.Item.path)
+}
+
+// -------------------------------------------------------------------
+
+// DriveList
+
+// repeated .aspia.proto.file_transfer.DriveList.Item item = 1;
+inline int DriveList::_internal_item_size() const {
+  return _impl_.item_.size();
+}
+inline int DriveList::item_size() const {
+  return _internal_item_size();
+}
+inline void DriveList::clear_item() {
+  _impl_.item_.Clear();
+}
+inline ::aspia::proto::file_transfer::DriveList_Item* DriveList::mutable_item(int index) {
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.DriveList.item)
+  return _impl_.item_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::file_transfer::DriveList_Item >*
+DriveList::mutable_item() {
+  // @@protoc_insertion_point(field_mutable_list:aspia.proto.file_transfer.DriveList.item)
+  return &_impl_.item_;
+}
+inline const ::aspia::proto::file_transfer::DriveList_Item& DriveList::_internal_item(int index) const {
+  return _impl_.item_.Get(index);
+}
+inline const ::aspia::proto::file_transfer::DriveList_Item& DriveList::item(int index) const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.DriveList.item)
+  return _internal_item(index);
+}
+inline ::aspia::proto::file_transfer::DriveList_Item* DriveList::_internal_add_item() {
+  return _impl_.item_.Add();
+}
+inline ::aspia::proto::file_transfer::DriveList_Item* DriveList::add_item() {
+  ::aspia::proto::file_transfer::DriveList_Item* _add = _internal_add_item();
+  // @@protoc_insertion_point(field_add:aspia.proto.file_transfer.DriveList.item)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::file_transfer::DriveList_Item >&
+DriveList::item() const {
+  // @@protoc_insertion_point(field_list:aspia.proto.file_transfer.DriveList.item)
+  return _impl_.item_;
+}
+
+// -------------------------------------------------------------------
+
+// DriveListRequest
+
+// uint32 dummy = 1;
+inline void DriveListRequest::clear_dummy() {
+  _impl_.dummy_ = 0u;
+}
+inline uint32_t DriveListRequest::_internal_dummy() const {
+  return _impl_.dummy_;
+}
+inline uint32_t DriveListRequest::dummy() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.DriveListRequest.dummy)
+  return _internal_dummy();
+}
+inline void DriveListRequest::_internal_set_dummy(uint32_t value) {
+  
+  _impl_.dummy_ = value;
+}
+inline void DriveListRequest::set_dummy(uint32_t value) {
+  _internal_set_dummy(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.DriveListRequest.dummy)
+}
+
+// -------------------------------------------------------------------
+
+// FileList_Item
+
+// string name = 1;
+inline void FileList_Item::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& FileList_Item::name() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileList.Item.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FileList_Item::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileList.Item.name)
+}
+inline std::string* FileList_Item::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.FileList.Item.name)
+  return _s;
+}
+inline const std::string& FileList_Item::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void FileList_Item::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FileList_Item::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FileList_Item::release_name() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.FileList.Item.name)
+  return _impl_.name_.Release();
+}
+inline void FileList_Item::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.FileList.Item.name)
+}
+
+// uint64 size = 2;
+inline void FileList_Item::clear_size() {
+  _impl_.size_ = uint64_t{0u};
+}
+inline uint64_t FileList_Item::_internal_size() const {
+  return _impl_.size_;
+}
+inline uint64_t FileList_Item::size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileList.Item.size)
+  return _internal_size();
+}
+inline void FileList_Item::_internal_set_size(uint64_t value) {
+  
+  _impl_.size_ = value;
+}
+inline void FileList_Item::set_size(uint64_t value) {
+  _internal_set_size(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileList.Item.size)
+}
+
+// int64 modification_time = 3;
+inline void FileList_Item::clear_modification_time() {
+  _impl_.modification_time_ = int64_t{0};
+}
+inline int64_t FileList_Item::_internal_modification_time() const {
+  return _impl_.modification_time_;
+}
+inline int64_t FileList_Item::modification_time() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileList.Item.modification_time)
+  return _internal_modification_time();
+}
+inline void FileList_Item::_internal_set_modification_time(int64_t value) {
+  
+  _impl_.modification_time_ = value;
+}
+inline void FileList_Item::set_modification_time(int64_t value) {
+  _internal_set_modification_time(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileList.Item.modification_time)
+}
+
+// bool is_directory = 4;
+inline void FileList_Item::clear_is_directory() {
+  _impl_.is_directory_ = false;
+}
+inline bool FileList_Item::_internal_is_directory() const {
+  return _impl_.is_directory_;
+}
+inline bool FileList_Item::is_directory() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileList.Item.is_directory)
+  return _internal_is_directory();
+}
+inline void FileList_Item::_internal_set_is_directory(bool value) {
+  
+  _impl_.is_directory_ = value;
+}
+inline void FileList_Item::set_is_directory(bool value) {
+  _internal_set_is_directory(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileList.Item.is_directory)
+}
+
+// -------------------------------------------------------------------
+
+// FileList
+
+// repeated .aspia.proto.file_transfer.FileList.Item item = 1;
+inline int FileList::_internal_item_size() const {
+  return _impl_.item_.size();
+}
+inline int FileList::item_size() const {
+  return _internal_item_size();
+}
+inline void FileList::clear_item() {
+  _impl_.item_.Clear();
+}
+inline ::aspia::proto::file_transfer::FileList_Item* FileList::mutable_item(int index) {
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.FileList.item)
+  return _impl_.item_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::file_transfer::FileList_Item >*
+FileList::mutable_item() {
+  // @@protoc_insertion_point(field_mutable_list:aspia.proto.file_transfer.FileList.item)
+  return &_impl_.item_;
+}
+inline const ::aspia::proto::file_transfer::FileList_Item& FileList::_internal_item(int index) const {
+  return _impl_.item_.Get(index);
+}
+inline const ::aspia::proto::file_transfer::FileList_Item& FileList::item(int index) const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileList.item)
+  return _internal_item(index);
+}
+inline ::aspia::proto::file_transfer::FileList_Item* FileList::_internal_add_item() {
+  return _impl_.item_.Add();
+}
+inline ::aspia::proto::file_transfer::FileList_Item* FileList::add_item() {
+  ::aspia::proto::file_transfer::FileList_Item* _add = _internal_add_item();
+  // @@protoc_insertion_point(field_add:aspia.proto.file_transfer.FileList.item)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::file_transfer::FileList_Item >&
+FileList::item() const {
+  // @@protoc_insertion_point(field_list:aspia.proto.file_transfer.FileList.item)
+  return _impl_.item_;
+}
+
+// uint64 continuation_id = 2;
+inline void FileList::clear_continuation_id() {
+  _impl_.continuation_id_ = uint64_t{0u};
+}
+inline uint64_t FileList::_internal_continuation_id() const {
+  return _impl_.continuation_id_;
+}
+inline uint64_t FileList::continuation_id() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileList.continuation_id)
+  return _internal_continuation_id();
+}
+inline void FileList::_internal_set_continuation_id(uint64_t value) {
+  
+  _impl_.continuation_id_ = value;
+}
+inline void FileList::set_continuation_id(uint64_t value) {
+  _internal_set_continuation_id(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileList.continuation_id)
+}
+
+// int64 modification_time = 3;
+inline void FileList::clear_modification_time() {
+  _impl_.modification_time_ = int64_t{0};
+}
+inline int64_t FileList::_internal_modification_time() const {
+  return _impl_.modification_time_;
+}
+inline int64_t FileList::modification_time() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileList.modification_time)
+  return _internal_modification_time();
+}
+inline void FileList::_internal_set_modification_time(int64_t value) {
+  
+  _impl_.modification_time_ = value;
+}
+inline void FileList::set_modification_time(int64_t value) {
+  _internal_set_modification_time(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileList.modification_time)
+}
+
+// bool not_modified = 4;
+inline void FileList::clear_not_modified() {
+  _impl_.not_modified_ = false;
+}
+inline bool FileList::_internal_not_modified() const {
+  return _impl_.not_modified_;
+}
+inline bool FileList::not_modified() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileList.not_modified)
+  return _internal_not_modified();
+}
+inline void FileList::_internal_set_not_modified(bool value) {
+  
+  _impl_.not_modified_ = value;
+}
+inline void FileList::set_not_modified(bool value) {
+  _internal_set_not_modified(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileList.not_modified)
+}
+
+// bool truncated = 5;
+inline void FileList::clear_truncated() {
+  _impl_.truncated_ = false;
+}
+inline bool FileList::_internal_truncated() const {
+  return _impl_.truncated_;
+}
+inline bool FileList::truncated() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileList.truncated)
+  return _internal_truncated();
+}
+inline void FileList::_internal_set_truncated(bool value) {
+  
+  _impl_.truncated_ = value;
+}
+inline void FileList::set_truncated(bool value) {
+  _internal_set_truncated(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileList.truncated)
+}
+
+// -------------------------------------------------------------------
+
+// FileListRequest
+
+// string path = 1;
+inline void FileListRequest::clear_path() {
+  _impl_.path_.ClearToEmpty();
+}
+inline const std::string& FileListRequest::path() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileListRequest.path)
+  return _internal_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FileListRequest::set_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileListRequest.path)
+}
+inline std::string* FileListRequest::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.FileListRequest.path)
+  return _s;
+}
+inline const std::string& FileListRequest::_internal_path() const {
+  return _impl_.path_.Get();
+}
+inline void FileListRequest::_internal_set_path(const std::string& value) {
+  
+  _impl_.path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FileListRequest::_internal_mutable_path() {
+  
+  return _impl_.path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FileListRequest::release_path() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.FileListRequest.path)
+  return _impl_.path_.Release();
+}
+inline void FileListRequest::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.FileListRequest.path)
+}
+
+// uint32 max_items = 2;
+inline void FileListRequest::clear_max_items() {
+  _impl_.max_items_ = 0u;
+}
+inline uint32_t FileListRequest::_internal_max_items() const {
+  return _impl_.max_items_;
+}
+inline uint32_t FileListRequest::max_items() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileListRequest.max_items)
+  return _internal_max_items();
+}
+inline void FileListRequest::_internal_set_max_items(uint32_t value) {
+  
+  _impl_.max_items_ = value;
+}
+inline void FileListRequest::set_max_items(uint32_t value) {
+  _internal_set_max_items(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileListRequest.max_items)
+}
+
+// uint64 continuation_id = 3;
+inline void FileListRequest::clear_continuation_id() {
+  _impl_.continuation_id_ = uint64_t{0u};
+}
+inline uint64_t FileListRequest::_internal_continuation_id() const {
+  return _impl_.continuation_id_;
+}
+inline uint64_t FileListRequest::continuation_id() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileListRequest.continuation_id)
+  return _internal_continuation_id();
+}
+inline void FileListRequest::_internal_set_continuation_id(uint64_t value) {
+  
+  _impl_.continuation_id_ = value;
+}
+inline void FileListRequest::set_continuation_id(uint64_t value) {
+  _internal_set_continuation_id(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileListRequest.continuation_id)
+}
+
+// bool recursive = 4;
+inline void FileListRequest::clear_recursive() {
+  _impl_.recursive_ = false;
+}
+inline bool FileListRequest::_internal_recursive() const {
+  return _impl_.recursive_;
+}
+inline bool FileListRequest::recursive() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileListRequest.recursive)
+  return _internal_recursive();
+}
+inline void FileListRequest::_internal_set_recursive(bool value) {
+  
+  _impl_.recursive_ = value;
+}
+inline void FileListRequest::set_recursive(bool value) {
+  _internal_set_recursive(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileListRequest.recursive)
+}
+
+// int64 modification_time = 5;
+inline void FileListRequest::clear_modification_time() {
+  _impl_.modification_time_ = int64_t{0};
+}
+inline int64_t FileListRequest::_internal_modification_time() const {
+  return _impl_.modification_time_;
+}
+inline int64_t FileListRequest::modification_time() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileListRequest.modification_time)
+  return _internal_modification_time();
+}
+inline void FileListRequest::_internal_set_modification_time(int64_t value) {
+  
+  _impl_.modification_time_ = value;
+}
+inline void FileListRequest::set_modification_time(int64_t value) {
+  _internal_set_modification_time(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileListRequest.modification_time)
+}
+
+// bool single_part = 6;
+inline void FileListRequest::clear_single_part() {
+  _impl_.single_part_ = false;
+}
+inline bool FileListRequest::_internal_single_part() const {
+  return _impl_.single_part_;
+}
+inline bool FileListRequest::single_part() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileListRequest.single_part)
+  return _internal_single_part();
+}
+inline void FileListRequest::_internal_set_single_part(bool value) {
+  
+  _impl_.single_part_ = value;
+}
+inline void FileListRequest::set_single_part(bool value) {
+  _internal_set_single_part(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileListRequest.single_part)
+}
+
+// -------------------------------------------------------------------
+
+// PartialFile
+
+// uint64 size = 1;
+inline void PartialFile::clear_size() {
+  _impl_.size_ = uint64_t{0u};
+}
+inline uint64_t PartialFile::_internal_size() const {
+  return _impl_.size_;
+}
+inline uint64_t PartialFile::size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.PartialFile.size)
+  return _internal_size();
+}
+inline void PartialFile::_internal_set_size(uint64_t value) {
+  
+  _impl_.size_ = value;
+}
+inline void PartialFile::set_size(uint64_t value) {
+  _internal_set_size(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.PartialFile.size)
+}
+
+// bytes last_block_hash = 2;
+inline void PartialFile::clear_last_block_hash() {
+  _impl_.last_block_hash_.ClearToEmpty();
+}
+inline const std::string& PartialFile::last_block_hash() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.PartialFile.last_block_hash)
+  return _internal_last_block_hash();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PartialFile::set_last_block_hash(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.last_block_hash_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.PartialFile.last_block_hash)
+}
+inline std::string* PartialFile::mutable_last_block_hash() {
+  std::string* _s = _internal_mutable_last_block_hash();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.PartialFile.last_block_hash)
+  return _s;
+}
+inline const std::string& PartialFile::_internal_last_block_hash() const {
+  return _impl_.last_block_hash_.Get();
+}
+inline void PartialFile::_internal_set_last_block_hash(const std::string& value) {
+  
+  _impl_.last_block_hash_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PartialFile::_internal_mutable_last_block_hash() {
+  
+  return _impl_.last_block_hash_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PartialFile::release_last_block_hash() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.PartialFile.last_block_hash)
+  return _impl_.last_block_hash_.Release();
+}
+inline void PartialFile::set_allocated_last_block_hash(std::string* last_block_hash) {
+  if (last_block_hash != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.last_block_hash_.SetAllocated(last_block_hash, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.last_block_hash_.IsDefault()) {
+    _impl_.last_block_hash_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.PartialFile.last_block_hash)
+}
+
+// -------------------------------------------------------------------
+
+// FileSignature
+
+// uint32 block_size = 1;
+inline void FileSignature::clear_block_size() {
+  _impl_.block_size_ = 0u;
+}
+inline uint32_t FileSignature::_internal_block_size() const {
+  return _impl_.block_size_;
+}
+inline uint32_t FileSignature::block_size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileSignature.block_size)
+  return _internal_block_size();
+}
+inline void FileSignature::_internal_set_block_size(uint32_t value) {
+  
+  _impl_.block_size_ = value;
+}
+inline void FileSignature::set_block_size(uint32_t value) {
+  _internal_set_block_size(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileSignature.block_size)
+}
+
+// bytes weak_hashes = 2;
+inline void FileSignature::clear_weak_hashes() {
+  _impl_.weak_hashes_.ClearToEmpty();
+}
+inline const std::string& FileSignature::weak_hashes() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileSignature.weak_hashes)
+  return _internal_weak_hashes();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FileSignature::set_weak_hashes(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.weak_hashes_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileSignature.weak_hashes)
+}
+inline std::string* FileSignature::mutable_weak_hashes() {
+  std::string* _s = _internal_mutable_weak_hashes();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.FileSignature.weak_hashes)
+  return _s;
+}
+inline const std::string& FileSignature::_internal_weak_hashes() const {
+  return _impl_.weak_hashes_.Get();
+}
+inline void FileSignature::_internal_set_weak_hashes(const std::string& value) {
+  
+  _impl_.weak_hashes_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FileSignature::_internal_mutable_weak_hashes() {
+  
+  return _impl_.weak_hashes_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FileSignature::release_weak_hashes() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.FileSignature.weak_hashes)
+  return _impl_.weak_hashes_.Release();
+}
+inline void FileSignature::set_allocated_weak_hashes(std::string* weak_hashes) {
+  if (weak_hashes != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.weak_hashes_.SetAllocated(weak_hashes, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.weak_hashes_.IsDefault()) {
+    _impl_.weak_hashes_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.FileSignature.weak_hashes)
+}
+
+// bytes strong_hashes = 3;
+inline void FileSignature::clear_strong_hashes() {
+  _impl_.strong_hashes_.ClearToEmpty();
+}
+inline const std::string& FileSignature::strong_hashes() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileSignature.strong_hashes)
+  return _internal_strong_hashes();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FileSignature::set_strong_hashes(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.strong_hashes_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileSignature.strong_hashes)
+}
+inline std::string* FileSignature::mutable_strong_hashes() {
+  std::string* _s = _internal_mutable_strong_hashes();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.FileSignature.strong_hashes)
+  return _s;
+}
+inline const std::string& FileSignature::_internal_strong_hashes() const {
+  return _impl_.strong_hashes_.Get();
+}
+inline void FileSignature::_internal_set_strong_hashes(const std::string& value) {
+  
+  _impl_.strong_hashes_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FileSignature::_internal_mutable_strong_hashes() {
+  
+  return _impl_.strong_hashes_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FileSignature::release_strong_hashes() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.FileSignature.strong_hashes)
+  return _impl_.strong_hashes_.Release();
+}
+inline void FileSignature::set_allocated_strong_hashes(std::string* strong_hashes) {
+  if (strong_hashes != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.strong_hashes_.SetAllocated(strong_hashes, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.strong_hashes_.IsDefault()) {
+    _impl_.strong_hashes_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.FileSignature.strong_hashes)
+}
+
+// -------------------------------------------------------------------
+
+// BlockCopy
+
+// uint32 data_offset = 1;
+inline void BlockCopy::clear_data_offset() {
+  _impl_.data_offset_ = 0u;
+}
+inline uint32_t BlockCopy::_internal_data_offset() const {
+  return _impl_.data_offset_;
+}
+inline uint32_t BlockCopy::data_offset() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.BlockCopy.data_offset)
+  return _internal_data_offset();
+}
+inline void BlockCopy::_internal_set_data_offset(uint32_t value) {
+  
+  _impl_.data_offset_ = value;
+}
+inline void BlockCopy::set_data_offset(uint32_t value) {
+  _internal_set_data_offset(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.BlockCopy.data_offset)
+}
+
+// uint64 block_index = 2;
+inline void BlockCopy::clear_block_index() {
+  _impl_.block_index_ = uint64_t{0u};
+}
+inline uint64_t BlockCopy::_internal_block_index() const {
+  return _impl_.block_index_;
+}
+inline uint64_t BlockCopy::block_index() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.BlockCopy.block_index)
+  return _internal_block_index();
+}
+inline void BlockCopy::_internal_set_block_index(uint64_t value) {
+  
+  _impl_.block_index_ = value;
+}
+inline void BlockCopy::set_block_index(uint64_t value) {
+  _internal_set_block_index(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.BlockCopy.block_index)
+}
+
+// uint32 block_count = 3;
+inline void BlockCopy::clear_block_count() {
+  _impl_.block_count_ = 0u;
+}
+inline uint32_t BlockCopy::_internal_block_count() const {
+  return _impl_.block_count_;
+}
+inline uint32_t BlockCopy::block_count() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.BlockCopy.block_count)
+  return _internal_block_count();
+}
+inline void BlockCopy::_internal_set_block_count(uint32_t value) {
+  
+  _impl_.block_count_ = value;
+}
+inline void BlockCopy::set_block_count(uint32_t value) {
+  _internal_set_block_count(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.BlockCopy.block_count)
+}
+
+// -------------------------------------------------------------------
+
+// ZeroRange
+
+// uint32 data_offset = 1;
+inline void ZeroRange::clear_data_offset() {
+  _impl_.data_offset_ = 0u;
+}
+inline uint32_t ZeroRange::_internal_data_offset() const {
+  return _impl_.data_offset_;
+}
+inline uint32_t ZeroRange::data_offset() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.ZeroRange.data_offset)
+  return _internal_data_offset();
+}
+inline void ZeroRange::_internal_set_data_offset(uint32_t value) {
+  
+  _impl_.data_offset_ = value;
+}
+inline void ZeroRange::set_data_offset(uint32_t value) {
+  _internal_set_data_offset(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.ZeroRange.data_offset)
+}
+
+// uint64 size = 2;
+inline void ZeroRange::clear_size() {
+  _impl_.size_ = uint64_t{0u};
+}
+inline uint64_t ZeroRange::_internal_size() const {
+  return _impl_.size_;
+}
+inline uint64_t ZeroRange::size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.ZeroRange.size)
+  return _internal_size();
+}
+inline void ZeroRange::_internal_set_size(uint64_t value) {
+  
+  _impl_.size_ = value;
+}
+inline void ZeroRange::set_size(uint64_t value) {
+  _internal_set_size(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.ZeroRange.size)
+}
+
+// -------------------------------------------------------------------
+
+// UploadRequest
+
+// string path = 1;
+inline void UploadRequest::clear_path() {
+  _impl_.path_.ClearToEmpty();
+}
+inline const std::string& UploadRequest::path() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.UploadRequest.path)
+  return _internal_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UploadRequest::set_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.UploadRequest.path)
+}
+inline std::string* UploadRequest::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.UploadRequest.path)
+  return _s;
+}
+inline const std::string& UploadRequest::_internal_path() const {
+  return _impl_.path_.Get();
+}
+inline void UploadRequest::_internal_set_path(const std::string& value) {
+  
+  _impl_.path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UploadRequest::_internal_mutable_path() {
+  
+  return _impl_.path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UploadRequest::release_path() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.UploadRequest.path)
+  return _impl_.path_.Release();
+}
+inline void UploadRequest::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.UploadRequest.path)
+}
+
+// bool overwrite = 2;
+inline void UploadRequest::clear_overwrite() {
+  _impl_.overwrite_ = false;
+}
+inline bool UploadRequest::_internal_overwrite() const {
+  return _impl_.overwrite_;
+}
+inline bool UploadRequest::overwrite() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.UploadRequest.overwrite)
+  return _internal_overwrite();
+}
+inline void UploadRequest::_internal_set_overwrite(bool value) {
+  
+  _impl_.overwrite_ = value;
+}
+inline void UploadRequest::set_overwrite(bool value) {
+  _internal_set_overwrite(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.UploadRequest.overwrite)
+}
+
+// .aspia.proto.file_transfer.Packet packet = 3;
+inline bool UploadRequest::_internal_has_packet() const {
+  return this != internal_default_instance() && _impl_.packet_ != nullptr;
+}
+inline bool UploadRequest::has_packet() const {
+  return _internal_has_packet();
+}
+inline void UploadRequest::clear_packet() {
+  if (GetArenaForAllocation() == nullptr && _impl_.packet_ != nullptr) {
+    delete _impl_.packet_;
+  }
+  _impl_.packet_ = nullptr;
+}
+inline const ::aspia::proto::file_transfer::Packet& UploadRequest::_internal_packet() const {
+  const ::aspia::proto::file_transfer::Packet* p = _impl_.packet_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::file_transfer::Packet&>(
+      ::aspia::proto::file_transfer::_Packet_default_instance_);
+}
+inline const ::aspia::proto::file_transfer::Packet& UploadRequest::packet() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.UploadRequest.packet)
+  return _internal_packet();
+}
+inline void UploadRequest::unsafe_arena_set_allocated_packet(
+    ::aspia::proto::file_transfer::Packet* packet) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.packet_);
+  }
+  _impl_.packet_ = packet;
+  if (packet) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.file_transfer.UploadRequest.packet)
+}
+inline ::aspia::proto::file_transfer::Packet* UploadRequest::release_packet() {
+  
+  ::aspia::proto::file_transfer::Packet* temp = _impl_.packet_;
+  _impl_.packet_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::file_transfer::Packet* UploadRequest::unsafe_arena_release_packet() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.UploadRequest.packet)
+  
+  ::aspia::proto::file_transfer::Packet* temp = _impl_.packet_;
+  _impl_.packet_ = nullptr;
+  return temp;
+}
+inline ::aspia::proto::file_transfer::Packet* UploadRequest::_internal_mutable_packet() {
+  
+  if (_impl_.packet_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::Packet>(GetArenaForAllocation());
+    _impl_.packet_ = p;
+  }
+  return _impl_.packet_;
+}
+inline ::aspia::proto::file_transfer::Packet* UploadRequest::mutable_packet() {
+  ::aspia::proto::file_transfer::Packet* _msg = _internal_mutable_packet();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.UploadRequest.packet)
+  return _msg;
+}
+inline void UploadRequest::set_allocated_packet(::aspia::proto::file_transfer::Packet* packet) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.packet_;
+  }
+  if (packet) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(packet);
+    if (message_arena != submessage_arena) {
+      packet = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, packet, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.packet_ = packet;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.UploadRequest.packet)
+}
+
+// bool resume = 4;
+inline void UploadRequest::clear_resume() {
+  _impl_.resume_ = false;
+}
+inline bool UploadRequest::_internal_resume() const {
+  return _impl_.resume_;
+}
+inline bool UploadRequest::resume() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.UploadRequest.resume)
+  return _internal_resume();
+}
+inline void UploadRequest::_internal_set_resume(bool value) {
+  
+  _impl_.resume_ = value;
+}
+inline void UploadRequest::set_resume(bool value) {
+  _internal_set_resume(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.UploadRequest.resume)
+}
+
+// bool delta = 5;
+inline void UploadRequest::clear_delta() {
+  _impl_.delta_ = false;
+}
+inline bool UploadRequest::_internal_delta() const {
+  return _impl_.delta_;
+}
+inline bool UploadRequest::delta() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.UploadRequest.delta)
+  return _internal_delta();
+}
+inline void UploadRequest::_internal_set_delta(bool value) {
+  
+  _impl_.delta_ = value;
+}
+inline void UploadRequest::set_delta(bool value) {
+  _internal_set_delta(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.UploadRequest.delta)
+}
+
+// bool archive = 6;
+inline void UploadRequest::clear_archive() {
+  _impl_.archive_ = false;
+}
+inline bool UploadRequest::_internal_archive() const {
+  return _impl_.archive_;
+}
+inline bool UploadRequest::archive() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.UploadRequest.archive)
+  return _internal_archive();
+}
+inline void UploadRequest::_internal_set_archive(bool value) {
+  
+  _impl_.archive_ = value;
+}
+inline void UploadRequest::set_archive(bool value) {
+  _internal_set_archive(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.UploadRequest.archive)
+}
+
+// -------------------------------------------------------------------
+
+// DownloadRequest
+
+// string path = 1;
+inline void DownloadRequest::clear_path() {
+  _impl_.path_.ClearToEmpty();
+}
+inline const std::string& DownloadRequest::path() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.DownloadRequest.path)
+  return _internal_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DownloadRequest::set_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.DownloadRequest.path)
+}
+inline std::string* DownloadRequest::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.DownloadRequest.path)
+  return _s;
+}
+inline const std::string& DownloadRequest::_internal_path() const {
+  return _impl_.path_.Get();
+}
+inline void DownloadRequest::_internal_set_path(const std::string& value) {
+  
+  _impl_.path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DownloadRequest::_internal_mutable_path() {
+  
+  return _impl_.path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DownloadRequest::release_path() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.DownloadRequest.path)
+  return _impl_.path_.Release();
+}
+inline void DownloadRequest::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.DownloadRequest.path)
+}
+
+// uint32 packet_size = 2;
+inline void DownloadRequest::clear_packet_size() {
+  _impl_.packet_size_ = 0u;
+}
+inline uint32_t DownloadRequest::_internal_packet_size() const {
+  return _impl_.packet_size_;
+}
+inline uint32_t DownloadRequest::packet_size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.DownloadRequest.packet_size)
+  return _internal_packet_size();
+}
+inline void DownloadRequest::_internal_set_packet_size(uint32_t value) {
+  
+  _impl_.packet_size_ = value;
+}
+inline void DownloadRequest::set_packet_size(uint32_t value) {
+  _internal_set_packet_size(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.DownloadRequest.packet_size)
+}
+
+// .aspia.proto.file_transfer.PacketCompression compression = 3;
+inline void DownloadRequest::clear_compression() {
+  _impl_.compression_ = 0;
+}
+inline ::aspia::proto::file_transfer::PacketCompression DownloadRequest::_internal_compression() const {
+  return static_cast< ::aspia::proto::file_transfer::PacketCompression >(_impl_.compression_);
+}
+inline ::aspia::proto::file_transfer::PacketCompression DownloadRequest::compression() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.DownloadRequest.compression)
+  return _internal_compression();
+}
+inline void DownloadRequest::_internal_set_compression(::aspia::proto::file_transfer::PacketCompression value) {
+  
+  _impl_.compression_ = value;
+}
+inline void DownloadRequest::set_compression(::aspia::proto::file_transfer::PacketCompression value) {
+  _internal_set_compression(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.DownloadRequest.compression)
+}
+
+// bool archive = 4;
+inline void DownloadRequest::clear_archive() {
+  _impl_.archive_ = false;
+}
+inline bool DownloadRequest::_internal_archive() const {
+  return _impl_.archive_;
+}
+inline bool DownloadRequest::archive() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.DownloadRequest.archive)
+  return _internal_archive();
+}
+inline void DownloadRequest::_internal_set_archive(bool value) {
+  
+  _impl_.archive_ = value;
+}
+inline void DownloadRequest::set_archive(bool value) {
+  _internal_set_archive(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.DownloadRequest.archive)
+}
+
+// -------------------------------------------------------------------
+
+// PacketRequest
+
+// uint32 dummy = 1;
+inline void PacketRequest::clear_dummy() {
+  _impl_.dummy_ = 0u;
+}
+inline uint32_t PacketRequest::_internal_dummy() const {
+  return _impl_.dummy_;
+}
+inline uint32_t PacketRequest::dummy() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.PacketRequest.dummy)
+  return _internal_dummy();
+}
+inline void PacketRequest::_internal_set_dummy(uint32_t value) {
+  
+  _impl_.dummy_ = value;
+}
+inline void PacketRequest::set_dummy(uint32_t value) {
+  _internal_set_dummy(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.PacketRequest.dummy)
+}
+
+// uint32 packet_size = 2;
+inline void PacketRequest::clear_packet_size() {
+  _impl_.packet_size_ = 0u;
+}
+inline uint32_t PacketRequest::_internal_packet_size() const {
+  return _impl_.packet_size_;
+}
+inline uint32_t PacketRequest::packet_size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.PacketRequest.packet_size)
+  return _internal_packet_size();
+}
+inline void PacketRequest::_internal_set_packet_size(uint32_t value) {
+  
+  _impl_.packet_size_ = value;
+}
+inline void PacketRequest::set_packet_size(uint32_t value) {
+  _internal_set_packet_size(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.PacketRequest.packet_size)
+}
+
+// .aspia.proto.file_transfer.PacketCompression compression = 3;
+inline void PacketRequest::clear_compression() {
+  _impl_.compression_ = 0;
+}
+inline ::aspia::proto::file_transfer::PacketCompression PacketRequest::_internal_compression() const {
+  return static_cast< ::aspia::proto::file_transfer::PacketCompression >(_impl_.compression_);
+}
+inline ::aspia::proto::file_transfer::PacketCompression PacketRequest::compression() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.PacketRequest.compression)
+  return _internal_compression();
+}
+inline void PacketRequest::_internal_set_compression(::aspia::proto::file_transfer::PacketCompression value) {
+  
+  _impl_.compression_ = value;
+}
+inline void PacketRequest::set_compression(::aspia::proto::file_transfer::PacketCompression value) {
+  _internal_set_compression(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.PacketRequest.compression)
+}
+
+// .aspia.proto.file_transfer.PartialFile partial_file = 4;
+inline bool PacketRequest::_internal_has_partial_file() const {
+  return this != internal_default_instance() && _impl_.partial_file_ != nullptr;
+}
+inline bool PacketRequest::has_partial_file() const {
+  return _internal_has_partial_file();
+}
+inline void PacketRequest::clear_partial_file() {
+  if (GetArenaForAllocation() == nullptr && _impl_.partial_file_ != nullptr) {
+    delete _impl_.partial_file_;
+  }
+  _impl_.partial_file_ = nullptr;
+}
+inline const ::aspia::proto::file_transfer::PartialFile& PacketRequest::_internal_partial_file() const {
+  const ::aspia::proto::file_transfer::PartialFile* p = _impl_.partial_file_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::file_transfer::PartialFile&>(
+      ::aspia::proto::file_transfer::_PartialFile_default_instance_);
+}
+inline const ::aspia::proto::file_transfer::PartialFile& PacketRequest::partial_file() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.PacketRequest.partial_file)
+  return _internal_partial_file();
+}
+inline void PacketRequest::unsafe_arena_set_allocated_partial_file(
+    ::aspia::proto::file_transfer::PartialFile* partial_file) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.partial_file_);
+  }
+  _impl_.partial_file_ = partial_file;
+  if (partial_file) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.file_transfer.PacketRequest.partial_file)
+}
+inline ::aspia::proto::file_transfer::PartialFile* PacketRequest::release_partial_file() {
+  
+  ::aspia::proto::file_transfer::PartialFile* temp = _impl_.partial_file_;
+  _impl_.partial_file_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::file_transfer::PartialFile* PacketRequest::unsafe_arena_release_partial_file() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.PacketRequest.partial_file)
+  
+  ::aspia::proto::file_transfer::PartialFile* temp = _impl_.partial_file_;
+  _impl_.partial_file_ = nullptr;
+  return temp;
+}
+inline ::aspia::proto::file_transfer::PartialFile* PacketRequest::_internal_mutable_partial_file() {
+  
+  if (_impl_.partial_file_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::PartialFile>(GetArenaForAllocation());
+    _impl_.partial_file_ = p;
+  }
+  return _impl_.partial_file_;
+}
+inline ::aspia::proto::file_transfer::PartialFile* PacketRequest::mutable_partial_file() {
+  ::aspia::proto::file_transfer::PartialFile* _msg = _internal_mutable_partial_file();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.PacketRequest.partial_file)
+  return _msg;
+}
+inline void PacketRequest::set_allocated_partial_file(::aspia::proto::file_transfer::PartialFile* partial_file) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.partial_file_;
+  }
+  if (partial_file) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(partial_file);
+    if (message_arena != submessage_arena) {
+      partial_file = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, partial_file, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.partial_file_ = partial_file;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.PacketRequest.partial_file)
+}
+
+// .aspia.proto.file_transfer.FileSignature signature = 5;
+inline bool PacketRequest::_internal_has_signature() const {
+  return this != internal_default_instance() && _impl_.signature_ != nullptr;
+}
+inline bool PacketRequest::has_signature() const {
+  return _internal_has_signature();
+}
+inline void PacketRequest::clear_signature() {
+  if (GetArenaForAllocation() == nullptr && _impl_.signature_ != nullptr) {
+    delete _impl_.signature_;
+  }
+  _impl_.signature_ = nullptr;
+}
+inline const ::aspia::proto::file_transfer::FileSignature& PacketRequest::_internal_signature() const {
+  const ::aspia::proto::file_transfer::FileSignature* p = _impl_.signature_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::file_transfer::FileSignature&>(
+      ::aspia::proto::file_transfer::_FileSignature_default_instance_);
+}
+inline const ::aspia::proto::file_transfer::FileSignature& PacketRequest::signature() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.PacketRequest.signature)
+  return _internal_signature();
 }
-#if LANG_CXX11
-inline void DriveList_Item::set_path(::std::string&& value) {
-  
-  path_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.DriveList.Item.path)
+inline void PacketRequest::unsafe_arena_set_allocated_signature(
+    ::aspia::proto::file_transfer::FileSignature* signature) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.signature_);
+  }
+  _impl_.signature_ = signature;
+  if (signature) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.file_transfer.PacketRequest.signature)
 }
-#endif
-inline void DriveList_Item::set_path(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
+inline ::aspia::proto::file_transfer::FileSignature* PacketRequest::release_signature() {
   
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.DriveList.Item.path)
+  ::aspia::proto::file_transfer::FileSignature* temp = _impl_.signature_;
+  _impl_.signature_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void DriveList_Item::set_path(const char* value, size_t size) {
+inline ::aspia::proto::file_transfer::FileSignature* PacketRequest::unsafe_arena_release_signature() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.PacketRequest.signature)
   
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.DriveList.Item.path)
+  ::aspia::proto::file_transfer::FileSignature* temp = _impl_.signature_;
+  _impl_.signature_ = nullptr;
+  return temp;
 }
-inline ::std::string* DriveList_Item::mutable_path() {
+inline ::aspia::proto::file_transfer::FileSignature* PacketRequest::_internal_mutable_signature() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.DriveList.Item.path)
-  return path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (_impl_.signature_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::FileSignature>(GetArenaForAllocation());
+    _impl_.signature_ = p;
+  }
+  return _impl_.signature_;
 }
-inline ::std::string* DriveList_Item::release_path() {
-  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.DriveList.Item.path)
-  
-  return path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::aspia::proto::file_transfer::FileSignature* PacketRequest::mutable_signature() {
+  ::aspia::proto::file_transfer::FileSignature* _msg = _internal_mutable_signature();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.PacketRequest.signature)
+  return _msg;
 }
-inline void DriveList_Item::set_allocated_path(::std::string* path) {
-  if (path != NULL) {
+inline void PacketRequest::set_allocated_signature(::aspia::proto::file_transfer::FileSignature* signature) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.signature_;
+  }
+  if (signature) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(signature);
+    if (message_arena != submessage_arena) {
+      signature = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, signature, submessage_arena);
+    }
     
   } else {
     
   }
-  path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), path);
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.DriveList.Item.path)
+  _impl_.signature_ = signature;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.PacketRequest.signature)
 }
 
-// -------------------------------------------------------------------
-
-// DriveList
-
-// repeated .aspia.proto.file_transfer.DriveList.Item item = 1;
-inline int DriveList::item_size() const {
-  return item_.size();
-}
-inline void DriveList::clear_item() {
-  item_.Clear();
-}
-inline ::aspia::proto::file_transfer::DriveList_Item* DriveList::mutable_item(int index) {
-  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.DriveList.item)
-  return item_.Mutable(index);
+// bool zero_ranges = 6;
+inline void PacketRequest::clear_zero_ranges() {
+  _impl_.zero_ranges_ = false;
 }
-inline ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::DriveList_Item >*
-DriveList::mutable_item() {
-  // @@protoc_insertion_point(field_mutable_list:aspia.proto.file_transfer.DriveList.item)
-  return &item_;
+inline bool PacketRequest::_internal_zero_ranges() const {
+  return _impl_.zero_ranges_;
 }
-inline const ::aspia::proto::file_transfer::DriveList_Item& DriveList::item(int index) const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.DriveList.item)
-  return item_.Get(index);
+inline bool PacketRequest::zero_ranges() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.PacketRequest.zero_ranges)
+  return _internal_zero_ranges();
 }
-inline ::aspia::proto::file_transfer::DriveList_Item* DriveList::add_item() {
-  // @@protoc_insertion_point(field_add:aspia.proto.file_transfer.DriveList.item)
-  return item_.Add();
+inline void PacketRequest::_internal_set_zero_ranges(bool value) {
+  
+  _impl_.zero_ranges_ = value;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::DriveList_Item >&
-DriveList::item() const {
-  // @@protoc_insertion_point(field_list:aspia.proto.file_transfer.DriveList.item)
-  return item_;
+inline void PacketRequest::set_zero_ranges(bool value) {
+  _internal_set_zero_ranges(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.PacketRequest.zero_ranges)
 }
 
 // -------------------------------------------------------------------
 
-// DriveListRequest
+// Packet
 
-// uint32 dummy = 1;
-inline void DriveListRequest::clear_dummy() {
-  dummy_ = 0u;
+// uint32 flags = 1;
+inline void Packet::clear_flags() {
+  _impl_.flags_ = 0u;
 }
-inline ::google::protobuf::uint32 DriveListRequest::dummy() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.DriveListRequest.dummy)
-  return dummy_;
+inline uint32_t Packet::_internal_flags() const {
+  return _impl_.flags_;
 }
-inline void DriveListRequest::set_dummy(::google::protobuf::uint32 value) {
+inline uint32_t Packet::flags() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Packet.flags)
+  return _internal_flags();
+}
+inline void Packet::_internal_set_flags(uint32_t value) {
   
-  dummy_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.DriveListRequest.dummy)
+  _impl_.flags_ = value;
+}
+inline void Packet::set_flags(uint32_t value) {
+  _internal_set_flags(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Packet.flags)
 }
 
-// -------------------------------------------------------------------
-
-// FileList_Item
-
-// string name = 1;
-inline void FileList_Item::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// uint64 file_size = 2;
+inline void Packet::clear_file_size() {
+  _impl_.file_size_ = uint64_t{0u};
 }
-inline const ::std::string& FileList_Item::name() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileList.Item.name)
-  return name_.GetNoArena();
+inline uint64_t Packet::_internal_file_size() const {
+  return _impl_.file_size_;
 }
-inline void FileList_Item::set_name(const ::std::string& value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileList.Item.name)
+inline uint64_t Packet::file_size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Packet.file_size)
+  return _internal_file_size();
 }
-#if LANG_CXX11
-inline void FileList_Item::set_name(::std::string&& value) {
+inline void Packet::_internal_set_file_size(uint64_t value) {
   
-  name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.FileList.Item.name)
+  _impl_.file_size_ = value;
 }
-#endif
-inline void FileList_Item::set_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.FileList.Item.name)
+inline void Packet::set_file_size(uint64_t value) {
+  _internal_set_file_size(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Packet.file_size)
 }
-inline void FileList_Item::set_name(const char* value, size_t size) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.FileList.Item.name)
+
+// bytes data = 3;
+inline void Packet::clear_data() {
+  _impl_.data_.ClearToEmpty();
+}
+inline const std::string& Packet::data() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Packet.data)
+  return _internal_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Packet::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Packet.data)
 }
-inline ::std::string* FileList_Item::mutable_name() {
+inline std::string* Packet::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Packet.data)
+  return _s;
+}
+inline const std::string& Packet::_internal_data() const {
+  return _impl_.data_.Get();
+}
+inline void Packet::_internal_set_data(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.FileList.Item.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.data_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* FileList_Item::release_name() {
-  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.FileList.Item.name)
+inline std::string* Packet::_internal_mutable_data() {
   
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Packet::release_data() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Packet.data)
+  return _impl_.data_.Release();
 }
-inline void FileList_Item::set_allocated_name(::std::string* name) {
-  if (name != NULL) {
+inline void Packet::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
     
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.FileList.Item.name)
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Packet.data)
 }
 
-// uint64 size = 2;
-inline void FileList_Item::clear_size() {
-  size_ = GOOGLE_ULONGLONG(0);
+// .aspia.proto.file_transfer.PacketCompression compression = 4;
+inline void Packet::clear_compression() {
+  _impl_.compression_ = 0;
 }
-inline ::google::protobuf::uint64 FileList_Item::size() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileList.Item.size)
-  return size_;
+inline ::aspia::proto::file_transfer::PacketCompression Packet::_internal_compression() const {
+  return static_cast< ::aspia::proto::file_transfer::PacketCompression >(_impl_.compression_);
+}
+inline ::aspia::proto::file_transfer::PacketCompression Packet::compression() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Packet.compression)
+  return _internal_compression();
 }
-inline void FileList_Item::set_size(::google::protobuf::uint64 value) {
+inline void Packet::_internal_set_compression(::aspia::proto::file_transfer::PacketCompression value) {
   
-  size_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileList.Item.size)
+  _impl_.compression_ = value;
+}
+inline void Packet::set_compression(::aspia::proto::file_transfer::PacketCompression value) {
+  _internal_set_compression(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Packet.compression)
 }
 
-// int64 modification_time = 3;
-inline void FileList_Item::clear_modification_time() {
-  modification_time_ = GOOGLE_LONGLONG(0);
+// uint32 data_size = 5;
+inline void Packet::clear_data_size() {
+  _impl_.data_size_ = 0u;
 }
-inline ::google::protobuf::int64 FileList_Item::modification_time() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileList.Item.modification_time)
-  return modification_time_;
+inline uint32_t Packet::_internal_data_size() const {
+  return _impl_.data_size_;
+}
+inline uint32_t Packet::data_size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Packet.data_size)
+  return _internal_data_size();
 }
-inline void FileList_Item::set_modification_time(::google::protobuf::int64 value) {
+inline void Packet::_internal_set_data_size(uint32_t value) {
   
-  modification_time_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileList.Item.modification_time)
+  _impl_.data_size_ = value;
+}
+inline void Packet::set_data_size(uint32_t value) {
+  _internal_set_data_size(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Packet.data_size)
 }
 
-// bool is_directory = 4;
-inline void FileList_Item::clear_is_directory() {
-  is_directory_ = false;
+// uint64 offset = 6;
+inline void Packet::clear_offset() {
+  _impl_.offset_ = uint64_t{0u};
 }
-inline bool FileList_Item::is_directory() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileList.Item.is_directory)
-  return is_directory_;
+inline uint64_t Packet::_internal_offset() const {
+  return _impl_.offset_;
 }
-inline void FileList_Item::set_is_directory(bool value) {
+inline uint64_t Packet::offset() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Packet.offset)
+  return _internal_offset();
+}
+inline void Packet::_internal_set_offset(uint64_t value) {
   
-  is_directory_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileList.Item.is_directory)
+  _impl_.offset_ = value;
+}
+inline void Packet::set_offset(uint64_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Packet.offset)
 }
 
-// -------------------------------------------------------------------
-
-// FileList
-
-// repeated .aspia.proto.file_transfer.FileList.Item item = 1;
-inline int FileList::item_size() const {
-  return item_.size();
+// repeated .aspia.proto.file_transfer.BlockCopy block_copies = 7;
+inline int Packet::_internal_block_copies_size() const {
+  return _impl_.block_copies_.size();
 }
-inline void FileList::clear_item() {
-  item_.Clear();
+inline int Packet::block_copies_size() const {
+  return _internal_block_copies_size();
 }
-inline ::aspia::proto::file_transfer::FileList_Item* FileList::mutable_item(int index) {
-  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.FileList.item)
-  return item_.Mutable(index);
+inline void Packet::clear_block_copies() {
+  _impl_.block_copies_.Clear();
 }
-inline ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::FileList_Item >*
-FileList::mutable_item() {
-  // @@protoc_insertion_point(field_mutable_list:aspia.proto.file_transfer.FileList.item)
-  return &item_;
+inline ::aspia::proto::file_transfer::BlockCopy* Packet::mutable_block_copies(int index) {
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Packet.block_copies)
+  return _impl_.block_copies_.Mutable(index);
 }
-inline const ::aspia::proto::file_transfer::FileList_Item& FileList::item(int index) const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileList.item)
-  return item_.Get(index);
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::file_transfer::BlockCopy >*
+Packet::mutable_block_copies() {
+  // @@protoc_insertion_point(field_mutable_list:aspia.proto.file_transfer.Packet.block_copies)
+  return &_impl_.block_copies_;
 }
-inline ::aspia::proto::file_transfer::FileList_Item* FileList::add_item() {
-  // @@protoc_insertion_point(field_add:aspia.proto.file_transfer.FileList.item)
-  return item_.Add();
+inline const ::aspia::proto::file_transfer::BlockCopy& Packet::_internal_block_copies(int index) const {
+  return _impl_.block_copies_.Get(index);
 }
-inline const ::google::protobuf::RepeatedPtrField< ::aspia::proto::file_transfer::FileList_Item >&
-FileList::item() const {
-  // @@protoc_insertion_point(field_list:aspia.proto.file_transfer.FileList.item)
-  return item_;
+inline const ::aspia::proto::file_transfer::BlockCopy& Packet::block_copies(int index) const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Packet.block_copies)
+  return _internal_block_copies(index);
+}
+inline ::aspia::proto::file_transfer::BlockCopy* Packet::_internal_add_block_copies() {
+  return _impl_.block_copies_.Add();
+}
+inline ::aspia::proto::file_transfer::BlockCopy* Packet::add_block_copies() {
+  ::aspia::proto::file_transfer::BlockCopy* _add = _internal_add_block_copies();
+  // @@protoc_insertion_point(field_add:aspia.proto.file_transfer.Packet.block_copies)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::file_transfer::BlockCopy >&
+Packet::block_copies() const {
+  // @@protoc_insertion_point(field_list:aspia.proto.file_transfer.Packet.block_copies)
+  return _impl_.block_copies_;
 }
 
-// -------------------------------------------------------------------
+// uint64 copied_size = 8;
+inline void Packet::clear_copied_size() {
+  _impl_.copied_size_ = uint64_t{0u};
+}
+inline uint64_t Packet::_internal_copied_size() const {
+  return _impl_.copied_size_;
+}
+inline uint64_t Packet::copied_size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Packet.copied_size)
+  return _internal_copied_size();
+}
+inline void Packet::_internal_set_copied_size(uint64_t value) {
+  
+  _impl_.copied_size_ = value;
+}
+inline void Packet::set_copied_size(uint64_t value) {
+  _internal_set_copied_size(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Packet.copied_size)
+}
 
-// FileListRequest
+// repeated .aspia.proto.file_transfer.ZeroRange zero_ranges = 9;
+inline int Packet::_internal_zero_ranges_size() const {
+  return _impl_.zero_ranges_.size();
+}
+inline int Packet::zero_ranges_size() const {
+  return _internal_zero_ranges_size();
+}
+inline void Packet::clear_zero_ranges() {
+  _impl_.zero_ranges_.Clear();
+}
+inline ::aspia::proto::file_transfer::ZeroRange* Packet::mutable_zero_ranges(int index) {
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Packet.zero_ranges)
+  return _impl_.zero_ranges_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::file_transfer::ZeroRange >*
+Packet::mutable_zero_ranges() {
+  // @@protoc_insertion_point(field_mutable_list:aspia.proto.file_transfer.Packet.zero_ranges)
+  return &_impl_.zero_ranges_;
+}
+inline const ::aspia::proto::file_transfer::ZeroRange& Packet::_internal_zero_ranges(int index) const {
+  return _impl_.zero_ranges_.Get(index);
+}
+inline const ::aspia::proto::file_transfer::ZeroRange& Packet::zero_ranges(int index) const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Packet.zero_ranges)
+  return _internal_zero_ranges(index);
+}
+inline ::aspia::proto::file_transfer::ZeroRange* Packet::_internal_add_zero_ranges() {
+  return _impl_.zero_ranges_.Add();
+}
+inline ::aspia::proto::file_transfer::ZeroRange* Packet::add_zero_ranges() {
+  ::aspia::proto::file_transfer::ZeroRange* _add = _internal_add_zero_ranges();
+  // @@protoc_insertion_point(field_add:aspia.proto.file_transfer.Packet.zero_ranges)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aspia::proto::file_transfer::ZeroRange >&
+Packet::zero_ranges() const {
+  // @@protoc_insertion_point(field_list:aspia.proto.file_transfer.Packet.zero_ranges)
+  return _impl_.zero_ranges_;
+}
 
-// string path = 1;
-inline void FileListRequest::clear_path() {
-  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// uint64 zero_size = 10;
+inline void Packet::clear_zero_size() {
+  _impl_.zero_size_ = uint64_t{0u};
 }
-inline const ::std::string& FileListRequest::path() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.FileListRequest.path)
-  return path_.GetNoArena();
+inline uint64_t Packet::_internal_zero_size() const {
+  return _impl_.zero_size_;
 }
-inline void FileListRequest::set_path(const ::std::string& value) {
-  
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.FileListRequest.path)
+inline uint64_t Packet::zero_size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Packet.zero_size)
+  return _internal_zero_size();
 }
-#if LANG_CXX11
-inline void FileListRequest::set_path(::std::string&& value) {
+inline void Packet::_internal_set_zero_size(uint64_t value) {
   
-  path_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.FileListRequest.path)
+  _impl_.zero_size_ = value;
 }
-#endif
-inline void FileListRequest::set_path(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.FileListRequest.path)
+inline void Packet::set_zero_size(uint64_t value) {
+  _internal_set_zero_size(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Packet.zero_size)
 }
-inline void FileListRequest::set_path(const char* value, size_t size) {
-  
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.FileListRequest.path)
+
+// bytes file_hash = 11;
+inline void Packet::clear_file_hash() {
+  _impl_.file_hash_.ClearToEmpty();
+}
+inline const std::string& Packet::file_hash() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Packet.file_hash)
+  return _internal_file_hash();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Packet::set_file_hash(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.file_hash_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Packet.file_hash)
+}
+inline std::string* Packet::mutable_file_hash() {
+  std::string* _s = _internal_mutable_file_hash();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Packet.file_hash)
+  return _s;
 }
-inline ::std::string* FileListRequest::mutable_path() {
+inline const std::string& Packet::_internal_file_hash() const {
+  return _impl_.file_hash_.Get();
+}
+inline void Packet::_internal_set_file_hash(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.FileListRequest.path)
-  return path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.file_hash_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* FileListRequest::release_path() {
-  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.FileListRequest.path)
+inline std::string* Packet::_internal_mutable_file_hash() {
   
-  return path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.file_hash_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Packet::release_file_hash() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Packet.file_hash)
+  return _impl_.file_hash_.Release();
 }
-inline void FileListRequest::set_allocated_path(::std::string* path) {
-  if (path != NULL) {
+inline void Packet::set_allocated_file_hash(std::string* file_hash) {
+  if (file_hash != nullptr) {
     
   } else {
     
   }
-  path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), path);
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.FileListRequest.path)
+  _impl_.file_hash_.SetAllocated(file_hash, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.file_hash_.IsDefault()) {
+    _impl_.file_hash_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Packet.file_hash)
+}
+
+// bool solid = 12;
+inline void Packet::clear_solid() {
+  _impl_.solid_ = false;
+}
+inline bool Packet::_internal_solid() const {
+  return _impl_.solid_;
+}
+inline bool Packet::solid() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Packet.solid)
+  return _internal_solid();
+}
+inline void Packet::_internal_set_solid(bool value) {
+  
+  _impl_.solid_ = value;
+}
+inline void Packet::set_solid(bool value) {
+  _internal_set_solid(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Packet.solid)
 }
 
 // -------------------------------------------------------------------
 
-// UploadRequest
+// CreateDirectoryRequest
 
 // string path = 1;
-inline void UploadRequest::clear_path() {
-  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void CreateDirectoryRequest::clear_path() {
+  _impl_.path_.ClearToEmpty();
 }
-inline const ::std::string& UploadRequest::path() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.UploadRequest.path)
-  return path_.GetNoArena();
+inline const std::string& CreateDirectoryRequest::path() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.CreateDirectoryRequest.path)
+  return _internal_path();
 }
-inline void UploadRequest::set_path(const ::std::string& value) {
-  
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.UploadRequest.path)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CreateDirectoryRequest::set_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.CreateDirectoryRequest.path)
 }
-#if LANG_CXX11
-inline void UploadRequest::set_path(::std::string&& value) {
-  
-  path_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.UploadRequest.path)
+inline std::string* CreateDirectoryRequest::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.CreateDirectoryRequest.path)
+  return _s;
 }
-#endif
-inline void UploadRequest::set_path(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.UploadRequest.path)
+inline const std::string& CreateDirectoryRequest::_internal_path() const {
+  return _impl_.path_.Get();
 }
-inline void UploadRequest::set_path(const char* value, size_t size) {
+inline void CreateDirectoryRequest::_internal_set_path(const std::string& value) {
   
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.UploadRequest.path)
+  _impl_.path_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* UploadRequest::mutable_path() {
+inline std::string* CreateDirectoryRequest::_internal_mutable_path() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.UploadRequest.path)
-  return path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.path_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* UploadRequest::release_path() {
-  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.UploadRequest.path)
-  
-  return path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline std::string* CreateDirectoryRequest::release_path() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.CreateDirectoryRequest.path)
+  return _impl_.path_.Release();
 }
-inline void UploadRequest::set_allocated_path(::std::string* path) {
-  if (path != NULL) {
+inline void CreateDirectoryRequest::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
     
   } else {
     
   }
-  path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), path);
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.UploadRequest.path)
-}
-
-// bool overwrite = 2;
-inline void UploadRequest::clear_overwrite() {
-  overwrite_ = false;
-}
-inline bool UploadRequest::overwrite() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.UploadRequest.overwrite)
-  return overwrite_;
-}
-inline void UploadRequest::set_overwrite(bool value) {
-  
-  overwrite_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.UploadRequest.overwrite)
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.CreateDirectoryRequest.path)
 }
 
 // -------------------------------------------------------------------
 
-// DownloadRequest
+// RenameRequest
 
-// string path = 1;
-inline void DownloadRequest::clear_path() {
-  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// string old_name = 1;
+inline void RenameRequest::clear_old_name() {
+  _impl_.old_name_.ClearToEmpty();
 }
-inline const ::std::string& DownloadRequest::path() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.DownloadRequest.path)
-  return path_.GetNoArena();
+inline const std::string& RenameRequest::old_name() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.RenameRequest.old_name)
+  return _internal_old_name();
 }
-inline void DownloadRequest::set_path(const ::std::string& value) {
-  
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.DownloadRequest.path)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RenameRequest::set_old_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.old_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.RenameRequest.old_name)
 }
-#if LANG_CXX11
-inline void DownloadRequest::set_path(::std::string&& value) {
-  
-  path_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.DownloadRequest.path)
+inline std::string* RenameRequest::mutable_old_name() {
+  std::string* _s = _internal_mutable_old_name();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.RenameRequest.old_name)
+  return _s;
 }
-#endif
-inline void DownloadRequest::set_path(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.DownloadRequest.path)
+inline const std::string& RenameRequest::_internal_old_name() const {
+  return _impl_.old_name_.Get();
 }
-inline void DownloadRequest::set_path(const char* value, size_t size) {
+inline void RenameRequest::_internal_set_old_name(const std::string& value) {
   
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.DownloadRequest.path)
+  _impl_.old_name_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* DownloadRequest::mutable_path() {
+inline std::string* RenameRequest::_internal_mutable_old_name() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.DownloadRequest.path)
-  return path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.old_name_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* DownloadRequest::release_path() {
-  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.DownloadRequest.path)
-  
-  return path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline std::string* RenameRequest::release_old_name() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.RenameRequest.old_name)
+  return _impl_.old_name_.Release();
 }
-inline void DownloadRequest::set_allocated_path(::std::string* path) {
-  if (path != NULL) {
+inline void RenameRequest::set_allocated_old_name(std::string* old_name) {
+  if (old_name != nullptr) {
     
   } else {
     
   }
-  path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), path);
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.DownloadRequest.path)
+  _impl_.old_name_.SetAllocated(old_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.old_name_.IsDefault()) {
+    _impl_.old_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.RenameRequest.old_name)
 }
 
-// -------------------------------------------------------------------
-
-// PacketRequest
-
-// uint32 dummy = 1;
-inline void PacketRequest::clear_dummy() {
-  dummy_ = 0u;
+// string new_name = 2;
+inline void RenameRequest::clear_new_name() {
+  _impl_.new_name_.ClearToEmpty();
 }
-inline ::google::protobuf::uint32 PacketRequest::dummy() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.PacketRequest.dummy)
-  return dummy_;
+inline const std::string& RenameRequest::new_name() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.RenameRequest.new_name)
+  return _internal_new_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RenameRequest::set_new_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.new_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.RenameRequest.new_name)
+}
+inline std::string* RenameRequest::mutable_new_name() {
+  std::string* _s = _internal_mutable_new_name();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.RenameRequest.new_name)
+  return _s;
 }
-inline void PacketRequest::set_dummy(::google::protobuf::uint32 value) {
+inline const std::string& RenameRequest::_internal_new_name() const {
+  return _impl_.new_name_.Get();
+}
+inline void RenameRequest::_internal_set_new_name(const std::string& value) {
   
-  dummy_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.PacketRequest.dummy)
+  _impl_.new_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RenameRequest::_internal_mutable_new_name() {
+  
+  return _impl_.new_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RenameRequest::release_new_name() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.RenameRequest.new_name)
+  return _impl_.new_name_.Release();
+}
+inline void RenameRequest::set_allocated_new_name(std::string* new_name) {
+  if (new_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.new_name_.SetAllocated(new_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.new_name_.IsDefault()) {
+    _impl_.new_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.RenameRequest.new_name)
 }
 
 // -------------------------------------------------------------------
 
-// Packet
+// RemoveRequest
 
-// uint32 flags = 1;
-inline void Packet::clear_flags() {
-  flags_ = 0u;
+// string path = 1;
+inline void RemoveRequest::clear_path() {
+  _impl_.path_.ClearToEmpty();
+}
+inline const std::string& RemoveRequest::path() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.RemoveRequest.path)
+  return _internal_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RemoveRequest::set_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.RemoveRequest.path)
+}
+inline std::string* RemoveRequest::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.RemoveRequest.path)
+  return _s;
 }
-inline ::google::protobuf::uint32 Packet::flags() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Packet.flags)
-  return flags_;
+inline const std::string& RemoveRequest::_internal_path() const {
+  return _impl_.path_.Get();
 }
-inline void Packet::set_flags(::google::protobuf::uint32 value) {
+inline void RemoveRequest::_internal_set_path(const std::string& value) {
   
-  flags_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Packet.flags)
+  _impl_.path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RemoveRequest::_internal_mutable_path() {
+  
+  return _impl_.path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RemoveRequest::release_path() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.RemoveRequest.path)
+  return _impl_.path_.Release();
+}
+inline void RemoveRequest::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.RemoveRequest.path)
 }
 
-// uint64 file_size = 2;
-inline void Packet::clear_file_size() {
-  file_size_ = GOOGLE_ULONGLONG(0);
+// bool recursive = 2;
+inline void RemoveRequest::clear_recursive() {
+  _impl_.recursive_ = false;
 }
-inline ::google::protobuf::uint64 Packet::file_size() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Packet.file_size)
-  return file_size_;
+inline bool RemoveRequest::_internal_recursive() const {
+  return _impl_.recursive_;
+}
+inline bool RemoveRequest::recursive() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.RemoveRequest.recursive)
+  return _internal_recursive();
 }
-inline void Packet::set_file_size(::google::protobuf::uint64 value) {
+inline void RemoveRequest::_internal_set_recursive(bool value) {
   
-  file_size_ = value;
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Packet.file_size)
+  _impl_.recursive_ = value;
+}
+inline void RemoveRequest::set_recursive(bool value) {
+  _internal_set_recursive(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.RemoveRequest.recursive)
 }
 
-// bytes data = 3;
-inline void Packet::clear_data() {
-  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// -------------------------------------------------------------------
+
+// RemoteCopyRequest
+
+// string path = 1;
+inline void RemoteCopyRequest::clear_path() {
+  _impl_.path_.ClearToEmpty();
 }
-inline const ::std::string& Packet::data() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Packet.data)
-  return data_.GetNoArena();
+inline const std::string& RemoteCopyRequest::path() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.RemoteCopyRequest.path)
+  return _internal_path();
 }
-inline void Packet::set_data(const ::std::string& value) {
-  
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Packet.data)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RemoteCopyRequest::set_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.RemoteCopyRequest.path)
 }
-#if LANG_CXX11
-inline void Packet::set_data(::std::string&& value) {
-  
-  data_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.Packet.data)
+inline std::string* RemoteCopyRequest::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.RemoteCopyRequest.path)
+  return _s;
 }
-#endif
-inline void Packet::set_data(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.Packet.data)
+inline const std::string& RemoteCopyRequest::_internal_path() const {
+  return _impl_.path_.Get();
 }
-inline void Packet::set_data(const void* value, size_t size) {
+inline void RemoteCopyRequest::_internal_set_path(const std::string& value) {
   
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.Packet.data)
+  _impl_.path_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* Packet::mutable_data() {
+inline std::string* RemoteCopyRequest::_internal_mutable_path() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Packet.data)
-  return data_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.path_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* Packet::release_data() {
-  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Packet.data)
-  
-  return data_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline std::string* RemoteCopyRequest::release_path() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.RemoteCopyRequest.path)
+  return _impl_.path_.Release();
 }
-inline void Packet::set_allocated_data(::std::string* data) {
-  if (data != NULL) {
+inline void RemoteCopyRequest::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
     
   } else {
     
   }
-  data_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), data);
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Packet.data)
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.RemoteCopyRequest.path)
 }
 
-// -------------------------------------------------------------------
-
-// CreateDirectoryRequest
-
-// string path = 1;
-inline void CreateDirectoryRequest::clear_path() {
-  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// string target_address = 2;
+inline void RemoteCopyRequest::clear_target_address() {
+  _impl_.target_address_.ClearToEmpty();
 }
-inline const ::std::string& CreateDirectoryRequest::path() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.CreateDirectoryRequest.path)
-  return path_.GetNoArena();
+inline const std::string& RemoteCopyRequest::target_address() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.RemoteCopyRequest.target_address)
+  return _internal_target_address();
 }
-inline void CreateDirectoryRequest::set_path(const ::std::string& value) {
-  
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.CreateDirectoryRequest.path)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RemoteCopyRequest::set_target_address(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.target_address_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.RemoteCopyRequest.target_address)
 }
-#if LANG_CXX11
-inline void CreateDirectoryRequest::set_path(::std::string&& value) {
-  
-  path_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.CreateDirectoryRequest.path)
+inline std::string* RemoteCopyRequest::mutable_target_address() {
+  std::string* _s = _internal_mutable_target_address();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.RemoteCopyRequest.target_address)
+  return _s;
 }
-#endif
-inline void CreateDirectoryRequest::set_path(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.CreateDirectoryRequest.path)
+inline const std::string& RemoteCopyRequest::_internal_target_address() const {
+  return _impl_.target_address_.Get();
 }
-inline void CreateDirectoryRequest::set_path(const char* value, size_t size) {
+inline void RemoteCopyRequest::_internal_set_target_address(const std::string& value) {
   
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.CreateDirectoryRequest.path)
+  _impl_.target_address_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* CreateDirectoryRequest::mutable_path() {
+inline std::string* RemoteCopyRequest::_internal_mutable_target_address() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.CreateDirectoryRequest.path)
-  return path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.target_address_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* CreateDirectoryRequest::release_path() {
-  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.CreateDirectoryRequest.path)
-  
-  return path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline std::string* RemoteCopyRequest::release_target_address() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.RemoteCopyRequest.target_address)
+  return _impl_.target_address_.Release();
 }
-inline void CreateDirectoryRequest::set_allocated_path(::std::string* path) {
-  if (path != NULL) {
+inline void RemoteCopyRequest::set_allocated_target_address(std::string* target_address) {
+  if (target_address != nullptr) {
     
   } else {
     
   }
-  path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), path);
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.CreateDirectoryRequest.path)
+  _impl_.target_address_.SetAllocated(target_address, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.target_address_.IsDefault()) {
+    _impl_.target_address_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.RemoteCopyRequest.target_address)
 }
 
-// -------------------------------------------------------------------
-
-// RenameRequest
-
-// string old_name = 1;
-inline void RenameRequest::clear_old_name() {
-  old_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// uint32 target_port = 3;
+inline void RemoteCopyRequest::clear_target_port() {
+  _impl_.target_port_ = 0u;
 }
-inline const ::std::string& RenameRequest::old_name() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.RenameRequest.old_name)
-  return old_name_.GetNoArena();
+inline uint32_t RemoteCopyRequest::_internal_target_port() const {
+  return _impl_.target_port_;
 }
-inline void RenameRequest::set_old_name(const ::std::string& value) {
-  
-  old_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.RenameRequest.old_name)
+inline uint32_t RemoteCopyRequest::target_port() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.RemoteCopyRequest.target_port)
+  return _internal_target_port();
 }
-#if LANG_CXX11
-inline void RenameRequest::set_old_name(::std::string&& value) {
+inline void RemoteCopyRequest::_internal_set_target_port(uint32_t value) {
   
-  old_name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.RenameRequest.old_name)
+  _impl_.target_port_ = value;
 }
-#endif
-inline void RenameRequest::set_old_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  old_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.RenameRequest.old_name)
+inline void RemoteCopyRequest::set_target_port(uint32_t value) {
+  _internal_set_target_port(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.RemoteCopyRequest.target_port)
 }
-inline void RenameRequest::set_old_name(const char* value, size_t size) {
-  
-  old_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.RenameRequest.old_name)
+
+// string target_user_name = 4;
+inline void RemoteCopyRequest::clear_target_user_name() {
+  _impl_.target_user_name_.ClearToEmpty();
+}
+inline const std::string& RemoteCopyRequest::target_user_name() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.RemoteCopyRequest.target_user_name)
+  return _internal_target_user_name();
 }
-inline ::std::string* RenameRequest::mutable_old_name() {
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RemoteCopyRequest::set_target_user_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.target_user_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.RemoteCopyRequest.target_user_name)
+}
+inline std::string* RemoteCopyRequest::mutable_target_user_name() {
+  std::string* _s = _internal_mutable_target_user_name();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.RemoteCopyRequest.target_user_name)
+  return _s;
+}
+inline const std::string& RemoteCopyRequest::_internal_target_user_name() const {
+  return _impl_.target_user_name_.Get();
+}
+inline void RemoteCopyRequest::_internal_set_target_user_name(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.RenameRequest.old_name)
-  return old_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.target_user_name_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* RenameRequest::release_old_name() {
-  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.RenameRequest.old_name)
+inline std::string* RemoteCopyRequest::_internal_mutable_target_user_name() {
   
-  return old_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.target_user_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RemoteCopyRequest::release_target_user_name() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.RemoteCopyRequest.target_user_name)
+  return _impl_.target_user_name_.Release();
 }
-inline void RenameRequest::set_allocated_old_name(::std::string* old_name) {
-  if (old_name != NULL) {
+inline void RemoteCopyRequest::set_allocated_target_user_name(std::string* target_user_name) {
+  if (target_user_name != nullptr) {
     
   } else {
     
   }
-  old_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), old_name);
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.RenameRequest.old_name)
+  _impl_.target_user_name_.SetAllocated(target_user_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.target_user_name_.IsDefault()) {
+    _impl_.target_user_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.RemoteCopyRequest.target_user_name)
 }
 
-// string new_name = 2;
-inline void RenameRequest::clear_new_name() {
-  new_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// string target_password = 5;
+inline void RemoteCopyRequest::clear_target_password() {
+  _impl_.target_password_.ClearToEmpty();
 }
-inline const ::std::string& RenameRequest::new_name() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.RenameRequest.new_name)
-  return new_name_.GetNoArena();
+inline const std::string& RemoteCopyRequest::target_password() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.RemoteCopyRequest.target_password)
+  return _internal_target_password();
 }
-inline void RenameRequest::set_new_name(const ::std::string& value) {
-  
-  new_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.RenameRequest.new_name)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RemoteCopyRequest::set_target_password(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.target_password_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.RemoteCopyRequest.target_password)
 }
-#if LANG_CXX11
-inline void RenameRequest::set_new_name(::std::string&& value) {
-  
-  new_name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.RenameRequest.new_name)
+inline std::string* RemoteCopyRequest::mutable_target_password() {
+  std::string* _s = _internal_mutable_target_password();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.RemoteCopyRequest.target_password)
+  return _s;
 }
-#endif
-inline void RenameRequest::set_new_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  new_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.RenameRequest.new_name)
+inline const std::string& RemoteCopyRequest::_internal_target_password() const {
+  return _impl_.target_password_.Get();
 }
-inline void RenameRequest::set_new_name(const char* value, size_t size) {
+inline void RemoteCopyRequest::_internal_set_target_password(const std::string& value) {
   
-  new_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.RenameRequest.new_name)
+  _impl_.target_password_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* RenameRequest::mutable_new_name() {
+inline std::string* RemoteCopyRequest::_internal_mutable_target_password() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.RenameRequest.new_name)
-  return new_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.target_password_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* RenameRequest::release_new_name() {
-  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.RenameRequest.new_name)
-  
-  return new_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline std::string* RemoteCopyRequest::release_target_password() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.RemoteCopyRequest.target_password)
+  return _impl_.target_password_.Release();
 }
-inline void RenameRequest::set_allocated_new_name(::std::string* new_name) {
-  if (new_name != NULL) {
+inline void RemoteCopyRequest::set_allocated_target_password(std::string* target_password) {
+  if (target_password != nullptr) {
     
   } else {
     
   }
-  new_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), new_name);
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.RenameRequest.new_name)
+  _impl_.target_password_.SetAllocated(target_password, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.target_password_.IsDefault()) {
+    _impl_.target_password_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.RemoteCopyRequest.target_password)
 }
 
-// -------------------------------------------------------------------
-
-// RemoveRequest
-
-// string path = 1;
-inline void RemoveRequest::clear_path() {
-  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// string target_path = 6;
+inline void RemoteCopyRequest::clear_target_path() {
+  _impl_.target_path_.ClearToEmpty();
 }
-inline const ::std::string& RemoveRequest::path() const {
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.RemoveRequest.path)
-  return path_.GetNoArena();
+inline const std::string& RemoteCopyRequest::target_path() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.RemoteCopyRequest.target_path)
+  return _internal_target_path();
 }
-inline void RemoveRequest::set_path(const ::std::string& value) {
-  
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.RemoveRequest.path)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RemoteCopyRequest::set_target_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.target_path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.RemoteCopyRequest.target_path)
 }
-#if LANG_CXX11
-inline void RemoveRequest::set_path(::std::string&& value) {
-  
-  path_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.file_transfer.RemoveRequest.path)
+inline std::string* RemoteCopyRequest::mutable_target_path() {
+  std::string* _s = _internal_mutable_target_path();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.RemoteCopyRequest.target_path)
+  return _s;
 }
-#endif
-inline void RemoveRequest::set_path(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.RemoveRequest.path)
+inline const std::string& RemoteCopyRequest::_internal_target_path() const {
+  return _impl_.target_path_.Get();
 }
-inline void RemoveRequest::set_path(const char* value, size_t size) {
+inline void RemoteCopyRequest::_internal_set_target_path(const std::string& value) {
   
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.RemoveRequest.path)
+  _impl_.target_path_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* RemoveRequest::mutable_path() {
+inline std::string* RemoteCopyRequest::_internal_mutable_target_path() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.RemoveRequest.path)
-  return path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.target_path_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* RemoveRequest::release_path() {
-  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.RemoveRequest.path)
-  
-  return path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline std::string* RemoteCopyRequest::release_target_path() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.RemoteCopyRequest.target_path)
+  return _impl_.target_path_.Release();
 }
-inline void RemoveRequest::set_allocated_path(::std::string* path) {
-  if (path != NULL) {
+inline void RemoteCopyRequest::set_allocated_target_path(std::string* target_path) {
+  if (target_path != nullptr) {
     
   } else {
     
   }
-  path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), path);
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.RemoveRequest.path)
+  _impl_.target_path_.SetAllocated(target_path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.target_path_.IsDefault()) {
+    _impl_.target_path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.RemoteCopyRequest.target_path)
+}
+
+// bool overwrite = 7;
+inline void RemoteCopyRequest::clear_overwrite() {
+  _impl_.overwrite_ = false;
+}
+inline bool RemoteCopyRequest::_internal_overwrite() const {
+  return _impl_.overwrite_;
+}
+inline bool RemoteCopyRequest::overwrite() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.RemoteCopyRequest.overwrite)
+  return _internal_overwrite();
+}
+inline void RemoteCopyRequest::_internal_set_overwrite(bool value) {
+  
+  _impl_.overwrite_ = value;
+}
+inline void RemoteCopyRequest::set_overwrite(bool value) {
+  _internal_set_overwrite(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.RemoteCopyRequest.overwrite)
 }
 
 // -------------------------------------------------------------------
@@ -2814,178 +6346,712 @@ inline void RemoveRequest::set_allocated_path(::std::string* path) {
 
 // .aspia.proto.file_transfer.Status status = 1;
 inline void Reply::clear_status() {
-  status_ = 0;
+  _impl_.status_ = 0;
+}
+inline ::aspia::proto::file_transfer::Status Reply::_internal_status() const {
+  return static_cast< ::aspia::proto::file_transfer::Status >(_impl_.status_);
 }
 inline ::aspia::proto::file_transfer::Status Reply::status() const {
   // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Reply.status)
-  return static_cast< ::aspia::proto::file_transfer::Status >(status_);
+  return _internal_status();
 }
-inline void Reply::set_status(::aspia::proto::file_transfer::Status value) {
+inline void Reply::_internal_set_status(::aspia::proto::file_transfer::Status value) {
   
-  status_ = value;
+  _impl_.status_ = value;
+}
+inline void Reply::set_status(::aspia::proto::file_transfer::Status value) {
+  _internal_set_status(value);
   // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Reply.status)
 }
 
 // .aspia.proto.file_transfer.DriveList drive_list = 2;
+inline bool Reply::_internal_has_drive_list() const {
+  return this != internal_default_instance() && _impl_.drive_list_ != nullptr;
+}
 inline bool Reply::has_drive_list() const {
-  return this != internal_default_instance() && drive_list_ != NULL;
+  return _internal_has_drive_list();
 }
 inline void Reply::clear_drive_list() {
-  if (GetArenaNoVirtual() == NULL && drive_list_ != NULL) {
-    delete drive_list_;
+  if (GetArenaForAllocation() == nullptr && _impl_.drive_list_ != nullptr) {
+    delete _impl_.drive_list_;
   }
-  drive_list_ = NULL;
+  _impl_.drive_list_ = nullptr;
 }
 inline const ::aspia::proto::file_transfer::DriveList& Reply::_internal_drive_list() const {
-  return *drive_list_;
+  const ::aspia::proto::file_transfer::DriveList* p = _impl_.drive_list_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::file_transfer::DriveList&>(
+      ::aspia::proto::file_transfer::_DriveList_default_instance_);
 }
 inline const ::aspia::proto::file_transfer::DriveList& Reply::drive_list() const {
-  const ::aspia::proto::file_transfer::DriveList* p = drive_list_;
   // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Reply.drive_list)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::file_transfer::DriveList*>(
-      &::aspia::proto::file_transfer::_DriveList_default_instance_);
+  return _internal_drive_list();
+}
+inline void Reply::unsafe_arena_set_allocated_drive_list(
+    ::aspia::proto::file_transfer::DriveList* drive_list) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.drive_list_);
+  }
+  _impl_.drive_list_ = drive_list;
+  if (drive_list) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.file_transfer.Reply.drive_list)
 }
 inline ::aspia::proto::file_transfer::DriveList* Reply::release_drive_list() {
+  
+  ::aspia::proto::file_transfer::DriveList* temp = _impl_.drive_list_;
+  _impl_.drive_list_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::file_transfer::DriveList* Reply::unsafe_arena_release_drive_list() {
   // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Reply.drive_list)
   
-  ::aspia::proto::file_transfer::DriveList* temp = drive_list_;
-  drive_list_ = NULL;
+  ::aspia::proto::file_transfer::DriveList* temp = _impl_.drive_list_;
+  _impl_.drive_list_ = nullptr;
   return temp;
 }
-inline ::aspia::proto::file_transfer::DriveList* Reply::mutable_drive_list() {
+inline ::aspia::proto::file_transfer::DriveList* Reply::_internal_mutable_drive_list() {
   
-  if (drive_list_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::DriveList>(GetArenaNoVirtual());
-    drive_list_ = p;
+  if (_impl_.drive_list_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::DriveList>(GetArenaForAllocation());
+    _impl_.drive_list_ = p;
   }
+  return _impl_.drive_list_;
+}
+inline ::aspia::proto::file_transfer::DriveList* Reply::mutable_drive_list() {
+  ::aspia::proto::file_transfer::DriveList* _msg = _internal_mutable_drive_list();
   // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Reply.drive_list)
-  return drive_list_;
+  return _msg;
 }
 inline void Reply::set_allocated_drive_list(::aspia::proto::file_transfer::DriveList* drive_list) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete drive_list_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.drive_list_;
   }
   if (drive_list) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(drive_list);
     if (message_arena != submessage_arena) {
-      drive_list = ::google::protobuf::internal::GetOwnedMessage(
+      drive_list = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, drive_list, submessage_arena);
     }
     
   } else {
     
   }
-  drive_list_ = drive_list;
+  _impl_.drive_list_ = drive_list;
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Reply.drive_list)
 }
 
 // .aspia.proto.file_transfer.FileList file_list = 3;
+inline bool Reply::_internal_has_file_list() const {
+  return this != internal_default_instance() && _impl_.file_list_ != nullptr;
+}
 inline bool Reply::has_file_list() const {
-  return this != internal_default_instance() && file_list_ != NULL;
+  return _internal_has_file_list();
 }
 inline void Reply::clear_file_list() {
-  if (GetArenaNoVirtual() == NULL && file_list_ != NULL) {
-    delete file_list_;
+  if (GetArenaForAllocation() == nullptr && _impl_.file_list_ != nullptr) {
+    delete _impl_.file_list_;
   }
-  file_list_ = NULL;
+  _impl_.file_list_ = nullptr;
 }
 inline const ::aspia::proto::file_transfer::FileList& Reply::_internal_file_list() const {
-  return *file_list_;
+  const ::aspia::proto::file_transfer::FileList* p = _impl_.file_list_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::file_transfer::FileList&>(
+      ::aspia::proto::file_transfer::_FileList_default_instance_);
 }
 inline const ::aspia::proto::file_transfer::FileList& Reply::file_list() const {
-  const ::aspia::proto::file_transfer::FileList* p = file_list_;
   // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Reply.file_list)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::file_transfer::FileList*>(
-      &::aspia::proto::file_transfer::_FileList_default_instance_);
+  return _internal_file_list();
+}
+inline void Reply::unsafe_arena_set_allocated_file_list(
+    ::aspia::proto::file_transfer::FileList* file_list) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.file_list_);
+  }
+  _impl_.file_list_ = file_list;
+  if (file_list) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.file_transfer.Reply.file_list)
 }
 inline ::aspia::proto::file_transfer::FileList* Reply::release_file_list() {
+  
+  ::aspia::proto::file_transfer::FileList* temp = _impl_.file_list_;
+  _impl_.file_list_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::file_transfer::FileList* Reply::unsafe_arena_release_file_list() {
   // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Reply.file_list)
   
-  ::aspia::proto::file_transfer::FileList* temp = file_list_;
-  file_list_ = NULL;
+  ::aspia::proto::file_transfer::FileList* temp = _impl_.file_list_;
+  _impl_.file_list_ = nullptr;
+  return temp;
+}
+inline ::aspia::proto::file_transfer::FileList* Reply::_internal_mutable_file_list() {
+  
+  if (_impl_.file_list_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::FileList>(GetArenaForAllocation());
+    _impl_.file_list_ = p;
+  }
+  return _impl_.file_list_;
+}
+inline ::aspia::proto::file_transfer::FileList* Reply::mutable_file_list() {
+  ::aspia::proto::file_transfer::FileList* _msg = _internal_mutable_file_list();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Reply.file_list)
+  return _msg;
+}
+inline void Reply::set_allocated_file_list(::aspia::proto::file_transfer::FileList* file_list) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.file_list_;
+  }
+  if (file_list) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(file_list);
+    if (message_arena != submessage_arena) {
+      file_list = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, file_list, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.file_list_ = file_list;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Reply.file_list)
+}
+
+// .aspia.proto.file_transfer.Packet packet = 4;
+inline bool Reply::_internal_has_packet() const {
+  return this != internal_default_instance() && _impl_.packet_ != nullptr;
+}
+inline bool Reply::has_packet() const {
+  return _internal_has_packet();
+}
+inline void Reply::clear_packet() {
+  if (GetArenaForAllocation() == nullptr && _impl_.packet_ != nullptr) {
+    delete _impl_.packet_;
+  }
+  _impl_.packet_ = nullptr;
+}
+inline const ::aspia::proto::file_transfer::Packet& Reply::_internal_packet() const {
+  const ::aspia::proto::file_transfer::Packet* p = _impl_.packet_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::file_transfer::Packet&>(
+      ::aspia::proto::file_transfer::_Packet_default_instance_);
+}
+inline const ::aspia::proto::file_transfer::Packet& Reply::packet() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Reply.packet)
+  return _internal_packet();
+}
+inline void Reply::unsafe_arena_set_allocated_packet(
+    ::aspia::proto::file_transfer::Packet* packet) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.packet_);
+  }
+  _impl_.packet_ = packet;
+  if (packet) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.file_transfer.Reply.packet)
+}
+inline ::aspia::proto::file_transfer::Packet* Reply::release_packet() {
+  
+  ::aspia::proto::file_transfer::Packet* temp = _impl_.packet_;
+  _impl_.packet_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::file_transfer::Packet* Reply::unsafe_arena_release_packet() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Reply.packet)
+  
+  ::aspia::proto::file_transfer::Packet* temp = _impl_.packet_;
+  _impl_.packet_ = nullptr;
+  return temp;
+}
+inline ::aspia::proto::file_transfer::Packet* Reply::_internal_mutable_packet() {
+  
+  if (_impl_.packet_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::Packet>(GetArenaForAllocation());
+    _impl_.packet_ = p;
+  }
+  return _impl_.packet_;
+}
+inline ::aspia::proto::file_transfer::Packet* Reply::mutable_packet() {
+  ::aspia::proto::file_transfer::Packet* _msg = _internal_mutable_packet();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Reply.packet)
+  return _msg;
+}
+inline void Reply::set_allocated_packet(::aspia::proto::file_transfer::Packet* packet) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.packet_;
+  }
+  if (packet) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(packet);
+    if (message_arena != submessage_arena) {
+      packet = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, packet, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.packet_ = packet;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Reply.packet)
+}
+
+// .aspia.proto.file_transfer.PartialFile partial_file = 5;
+inline bool Reply::_internal_has_partial_file() const {
+  return this != internal_default_instance() && _impl_.partial_file_ != nullptr;
+}
+inline bool Reply::has_partial_file() const {
+  return _internal_has_partial_file();
+}
+inline void Reply::clear_partial_file() {
+  if (GetArenaForAllocation() == nullptr && _impl_.partial_file_ != nullptr) {
+    delete _impl_.partial_file_;
+  }
+  _impl_.partial_file_ = nullptr;
+}
+inline const ::aspia::proto::file_transfer::PartialFile& Reply::_internal_partial_file() const {
+  const ::aspia::proto::file_transfer::PartialFile* p = _impl_.partial_file_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::file_transfer::PartialFile&>(
+      ::aspia::proto::file_transfer::_PartialFile_default_instance_);
+}
+inline const ::aspia::proto::file_transfer::PartialFile& Reply::partial_file() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Reply.partial_file)
+  return _internal_partial_file();
+}
+inline void Reply::unsafe_arena_set_allocated_partial_file(
+    ::aspia::proto::file_transfer::PartialFile* partial_file) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.partial_file_);
+  }
+  _impl_.partial_file_ = partial_file;
+  if (partial_file) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.file_transfer.Reply.partial_file)
+}
+inline ::aspia::proto::file_transfer::PartialFile* Reply::release_partial_file() {
+  
+  ::aspia::proto::file_transfer::PartialFile* temp = _impl_.partial_file_;
+  _impl_.partial_file_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::file_transfer::PartialFile* Reply::unsafe_arena_release_partial_file() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Reply.partial_file)
+  
+  ::aspia::proto::file_transfer::PartialFile* temp = _impl_.partial_file_;
+  _impl_.partial_file_ = nullptr;
+  return temp;
+}
+inline ::aspia::proto::file_transfer::PartialFile* Reply::_internal_mutable_partial_file() {
+  
+  if (_impl_.partial_file_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::PartialFile>(GetArenaForAllocation());
+    _impl_.partial_file_ = p;
+  }
+  return _impl_.partial_file_;
+}
+inline ::aspia::proto::file_transfer::PartialFile* Reply::mutable_partial_file() {
+  ::aspia::proto::file_transfer::PartialFile* _msg = _internal_mutable_partial_file();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Reply.partial_file)
+  return _msg;
+}
+inline void Reply::set_allocated_partial_file(::aspia::proto::file_transfer::PartialFile* partial_file) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.partial_file_;
+  }
+  if (partial_file) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(partial_file);
+    if (message_arena != submessage_arena) {
+      partial_file = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, partial_file, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.partial_file_ = partial_file;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Reply.partial_file)
+}
+
+// .aspia.proto.file_transfer.FileSignature signature = 6;
+inline bool Reply::_internal_has_signature() const {
+  return this != internal_default_instance() && _impl_.signature_ != nullptr;
+}
+inline bool Reply::has_signature() const {
+  return _internal_has_signature();
+}
+inline void Reply::clear_signature() {
+  if (GetArenaForAllocation() == nullptr && _impl_.signature_ != nullptr) {
+    delete _impl_.signature_;
+  }
+  _impl_.signature_ = nullptr;
+}
+inline const ::aspia::proto::file_transfer::FileSignature& Reply::_internal_signature() const {
+  const ::aspia::proto::file_transfer::FileSignature* p = _impl_.signature_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::file_transfer::FileSignature&>(
+      ::aspia::proto::file_transfer::_FileSignature_default_instance_);
+}
+inline const ::aspia::proto::file_transfer::FileSignature& Reply::signature() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Reply.signature)
+  return _internal_signature();
+}
+inline void Reply::unsafe_arena_set_allocated_signature(
+    ::aspia::proto::file_transfer::FileSignature* signature) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.signature_);
+  }
+  _impl_.signature_ = signature;
+  if (signature) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.file_transfer.Reply.signature)
+}
+inline ::aspia::proto::file_transfer::FileSignature* Reply::release_signature() {
+  
+  ::aspia::proto::file_transfer::FileSignature* temp = _impl_.signature_;
+  _impl_.signature_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::file_transfer::FileSignature* Reply::unsafe_arena_release_signature() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Reply.signature)
+  
+  ::aspia::proto::file_transfer::FileSignature* temp = _impl_.signature_;
+  _impl_.signature_ = nullptr;
   return temp;
 }
-inline ::aspia::proto::file_transfer::FileList* Reply::mutable_file_list() {
+inline ::aspia::proto::file_transfer::FileSignature* Reply::_internal_mutable_signature() {
   
-  if (file_list_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::FileList>(GetArenaNoVirtual());
-    file_list_ = p;
+  if (_impl_.signature_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::FileSignature>(GetArenaForAllocation());
+    _impl_.signature_ = p;
   }
-  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Reply.file_list)
-  return file_list_;
+  return _impl_.signature_;
 }
-inline void Reply::set_allocated_file_list(::aspia::proto::file_transfer::FileList* file_list) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete file_list_;
+inline ::aspia::proto::file_transfer::FileSignature* Reply::mutable_signature() {
+  ::aspia::proto::file_transfer::FileSignature* _msg = _internal_mutable_signature();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Reply.signature)
+  return _msg;
+}
+inline void Reply::set_allocated_signature(::aspia::proto::file_transfer::FileSignature* signature) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.signature_;
   }
-  if (file_list) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+  if (signature) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(signature);
     if (message_arena != submessage_arena) {
-      file_list = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, file_list, submessage_arena);
+      signature = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, signature, submessage_arena);
     }
     
   } else {
     
   }
-  file_list_ = file_list;
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Reply.file_list)
+  _impl_.signature_ = signature;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Reply.signature)
 }
 
-// .aspia.proto.file_transfer.Packet packet = 4;
-inline bool Reply::has_packet() const {
-  return this != internal_default_instance() && packet_ != NULL;
+// bool zero_ranges = 7;
+inline void Reply::clear_zero_ranges() {
+  _impl_.zero_ranges_ = false;
 }
-inline void Reply::clear_packet() {
-  if (GetArenaNoVirtual() == NULL && packet_ != NULL) {
-    delete packet_;
-  }
-  packet_ = NULL;
+inline bool Reply::_internal_zero_ranges() const {
+  return _impl_.zero_ranges_;
 }
-inline const ::aspia::proto::file_transfer::Packet& Reply::_internal_packet() const {
-  return *packet_;
+inline bool Reply::zero_ranges() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Reply.zero_ranges)
+  return _internal_zero_ranges();
 }
-inline const ::aspia::proto::file_transfer::Packet& Reply::packet() const {
-  const ::aspia::proto::file_transfer::Packet* p = packet_;
-  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Reply.packet)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::file_transfer::Packet*>(
-      &::aspia::proto::file_transfer::_Packet_default_instance_);
+inline void Reply::_internal_set_zero_ranges(bool value) {
+  
+  _impl_.zero_ranges_ = value;
 }
-inline ::aspia::proto::file_transfer::Packet* Reply::release_packet() {
-  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Reply.packet)
+inline void Reply::set_zero_ranges(bool value) {
+  _internal_set_zero_ranges(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Reply.zero_ranges)
+}
+
+// uint64 request_id = 8;
+inline void Reply::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t Reply::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t Reply::request_id() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Reply.request_id)
+  return _internal_request_id();
+}
+inline void Reply::_internal_set_request_id(uint64_t value) {
   
-  ::aspia::proto::file_transfer::Packet* temp = packet_;
-  packet_ = NULL;
-  return temp;
+  _impl_.request_id_ = value;
 }
-inline ::aspia::proto::file_transfer::Packet* Reply::mutable_packet() {
+inline void Reply::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Reply.request_id)
+}
+
+// string error_string = 9;
+inline void Reply::clear_error_string() {
+  _impl_.error_string_.ClearToEmpty();
+}
+inline const std::string& Reply::error_string() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Reply.error_string)
+  return _internal_error_string();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Reply::set_error_string(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_string_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Reply.error_string)
+}
+inline std::string* Reply::mutable_error_string() {
+  std::string* _s = _internal_mutable_error_string();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Reply.error_string)
+  return _s;
+}
+inline const std::string& Reply::_internal_error_string() const {
+  return _impl_.error_string_.Get();
+}
+inline void Reply::_internal_set_error_string(const std::string& value) {
   
-  if (packet_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::Packet>(GetArenaNoVirtual());
-    packet_ = p;
-  }
-  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Reply.packet)
-  return packet_;
+  _impl_.error_string_.Set(value, GetArenaForAllocation());
 }
-inline void Reply::set_allocated_packet(::aspia::proto::file_transfer::Packet* packet) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete packet_;
-  }
-  if (packet) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
-    if (message_arena != submessage_arena) {
-      packet = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, packet, submessage_arena);
-    }
+inline std::string* Reply::_internal_mutable_error_string() {
+  
+  return _impl_.error_string_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Reply::release_error_string() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Reply.error_string)
+  return _impl_.error_string_.Release();
+}
+inline void Reply::set_allocated_error_string(std::string* error_string) {
+  if (error_string != nullptr) {
     
   } else {
     
   }
-  packet_ = packet;
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Reply.packet)
+  _impl_.error_string_.SetAllocated(error_string, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_string_.IsDefault()) {
+    _impl_.error_string_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Reply.error_string)
+}
+
+// repeated string existing_files = 10;
+inline int Reply::_internal_existing_files_size() const {
+  return _impl_.existing_files_.size();
+}
+inline int Reply::existing_files_size() const {
+  return _internal_existing_files_size();
+}
+inline void Reply::clear_existing_files() {
+  _impl_.existing_files_.Clear();
+}
+inline std::string* Reply::add_existing_files() {
+  std::string* _s = _internal_add_existing_files();
+  // @@protoc_insertion_point(field_add_mutable:aspia.proto.file_transfer.Reply.existing_files)
+  return _s;
+}
+inline const std::string& Reply::_internal_existing_files(int index) const {
+  return _impl_.existing_files_.Get(index);
+}
+inline const std::string& Reply::existing_files(int index) const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Reply.existing_files)
+  return _internal_existing_files(index);
+}
+inline std::string* Reply::mutable_existing_files(int index) {
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Reply.existing_files)
+  return _impl_.existing_files_.Mutable(index);
+}
+inline void Reply::set_existing_files(int index, const std::string& value) {
+  _impl_.existing_files_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Reply.existing_files)
+}
+inline void Reply::set_existing_files(int index, std::string&& value) {
+  _impl_.existing_files_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Reply.existing_files)
+}
+inline void Reply::set_existing_files(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.existing_files_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.Reply.existing_files)
+}
+inline void Reply::set_existing_files(int index, const char* value, size_t size) {
+  _impl_.existing_files_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.Reply.existing_files)
+}
+inline std::string* Reply::_internal_add_existing_files() {
+  return _impl_.existing_files_.Add();
+}
+inline void Reply::add_existing_files(const std::string& value) {
+  _impl_.existing_files_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:aspia.proto.file_transfer.Reply.existing_files)
+}
+inline void Reply::add_existing_files(std::string&& value) {
+  _impl_.existing_files_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:aspia.proto.file_transfer.Reply.existing_files)
+}
+inline void Reply::add_existing_files(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.existing_files_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:aspia.proto.file_transfer.Reply.existing_files)
+}
+inline void Reply::add_existing_files(const char* value, size_t size) {
+  _impl_.existing_files_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:aspia.proto.file_transfer.Reply.existing_files)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+Reply::existing_files() const {
+  // @@protoc_insertion_point(field_list:aspia.proto.file_transfer.Reply.existing_files)
+  return _impl_.existing_files_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+Reply::mutable_existing_files() {
+  // @@protoc_insertion_point(field_mutable_list:aspia.proto.file_transfer.Reply.existing_files)
+  return &_impl_.existing_files_;
+}
+
+// repeated string failed_files = 11;
+inline int Reply::_internal_failed_files_size() const {
+  return _impl_.failed_files_.size();
+}
+inline int Reply::failed_files_size() const {
+  return _internal_failed_files_size();
+}
+inline void Reply::clear_failed_files() {
+  _impl_.failed_files_.Clear();
+}
+inline std::string* Reply::add_failed_files() {
+  std::string* _s = _internal_add_failed_files();
+  // @@protoc_insertion_point(field_add_mutable:aspia.proto.file_transfer.Reply.failed_files)
+  return _s;
+}
+inline const std::string& Reply::_internal_failed_files(int index) const {
+  return _impl_.failed_files_.Get(index);
+}
+inline const std::string& Reply::failed_files(int index) const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Reply.failed_files)
+  return _internal_failed_files(index);
+}
+inline std::string* Reply::mutable_failed_files(int index) {
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Reply.failed_files)
+  return _impl_.failed_files_.Mutable(index);
+}
+inline void Reply::set_failed_files(int index, const std::string& value) {
+  _impl_.failed_files_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Reply.failed_files)
+}
+inline void Reply::set_failed_files(int index, std::string&& value) {
+  _impl_.failed_files_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Reply.failed_files)
+}
+inline void Reply::set_failed_files(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.failed_files_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:aspia.proto.file_transfer.Reply.failed_files)
+}
+inline void Reply::set_failed_files(int index, const char* value, size_t size) {
+  _impl_.failed_files_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:aspia.proto.file_transfer.Reply.failed_files)
+}
+inline std::string* Reply::_internal_add_failed_files() {
+  return _impl_.failed_files_.Add();
+}
+inline void Reply::add_failed_files(const std::string& value) {
+  _impl_.failed_files_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:aspia.proto.file_transfer.Reply.failed_files)
+}
+inline void Reply::add_failed_files(std::string&& value) {
+  _impl_.failed_files_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:aspia.proto.file_transfer.Reply.failed_files)
+}
+inline void Reply::add_failed_files(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.failed_files_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:aspia.proto.file_transfer.Reply.failed_files)
+}
+inline void Reply::add_failed_files(const char* value, size_t size) {
+  _impl_.failed_files_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:aspia.proto.file_transfer.Reply.failed_files)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+Reply::failed_files() const {
+  // @@protoc_insertion_point(field_list:aspia.proto.file_transfer.Reply.failed_files)
+  return _impl_.failed_files_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+Reply::mutable_failed_files() {
+  // @@protoc_insertion_point(field_mutable_list:aspia.proto.file_transfer.Reply.failed_files)
+  return &_impl_.failed_files_;
 }
 
 // -------------------------------------------------------------------
@@ -2993,491 +7059,925 @@ inline void Reply::set_allocated_packet(::aspia::proto::file_transfer::Packet* p
 // Request
 
 // .aspia.proto.file_transfer.DriveListRequest drive_list_request = 1;
+inline bool Request::_internal_has_drive_list_request() const {
+  return this != internal_default_instance() && _impl_.drive_list_request_ != nullptr;
+}
 inline bool Request::has_drive_list_request() const {
-  return this != internal_default_instance() && drive_list_request_ != NULL;
+  return _internal_has_drive_list_request();
 }
 inline void Request::clear_drive_list_request() {
-  if (GetArenaNoVirtual() == NULL && drive_list_request_ != NULL) {
-    delete drive_list_request_;
+  if (GetArenaForAllocation() == nullptr && _impl_.drive_list_request_ != nullptr) {
+    delete _impl_.drive_list_request_;
   }
-  drive_list_request_ = NULL;
+  _impl_.drive_list_request_ = nullptr;
 }
 inline const ::aspia::proto::file_transfer::DriveListRequest& Request::_internal_drive_list_request() const {
-  return *drive_list_request_;
+  const ::aspia::proto::file_transfer::DriveListRequest* p = _impl_.drive_list_request_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::file_transfer::DriveListRequest&>(
+      ::aspia::proto::file_transfer::_DriveListRequest_default_instance_);
 }
 inline const ::aspia::proto::file_transfer::DriveListRequest& Request::drive_list_request() const {
-  const ::aspia::proto::file_transfer::DriveListRequest* p = drive_list_request_;
   // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Request.drive_list_request)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::file_transfer::DriveListRequest*>(
-      &::aspia::proto::file_transfer::_DriveListRequest_default_instance_);
+  return _internal_drive_list_request();
+}
+inline void Request::unsafe_arena_set_allocated_drive_list_request(
+    ::aspia::proto::file_transfer::DriveListRequest* drive_list_request) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.drive_list_request_);
+  }
+  _impl_.drive_list_request_ = drive_list_request;
+  if (drive_list_request) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.file_transfer.Request.drive_list_request)
 }
 inline ::aspia::proto::file_transfer::DriveListRequest* Request::release_drive_list_request() {
+  
+  ::aspia::proto::file_transfer::DriveListRequest* temp = _impl_.drive_list_request_;
+  _impl_.drive_list_request_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::file_transfer::DriveListRequest* Request::unsafe_arena_release_drive_list_request() {
   // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Request.drive_list_request)
   
-  ::aspia::proto::file_transfer::DriveListRequest* temp = drive_list_request_;
-  drive_list_request_ = NULL;
+  ::aspia::proto::file_transfer::DriveListRequest* temp = _impl_.drive_list_request_;
+  _impl_.drive_list_request_ = nullptr;
   return temp;
 }
-inline ::aspia::proto::file_transfer::DriveListRequest* Request::mutable_drive_list_request() {
+inline ::aspia::proto::file_transfer::DriveListRequest* Request::_internal_mutable_drive_list_request() {
   
-  if (drive_list_request_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::DriveListRequest>(GetArenaNoVirtual());
-    drive_list_request_ = p;
+  if (_impl_.drive_list_request_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::DriveListRequest>(GetArenaForAllocation());
+    _impl_.drive_list_request_ = p;
   }
+  return _impl_.drive_list_request_;
+}
+inline ::aspia::proto::file_transfer::DriveListRequest* Request::mutable_drive_list_request() {
+  ::aspia::proto::file_transfer::DriveListRequest* _msg = _internal_mutable_drive_list_request();
   // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Request.drive_list_request)
-  return drive_list_request_;
+  return _msg;
 }
 inline void Request::set_allocated_drive_list_request(::aspia::proto::file_transfer::DriveListRequest* drive_list_request) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete drive_list_request_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.drive_list_request_;
   }
   if (drive_list_request) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(drive_list_request);
     if (message_arena != submessage_arena) {
-      drive_list_request = ::google::protobuf::internal::GetOwnedMessage(
+      drive_list_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, drive_list_request, submessage_arena);
     }
     
   } else {
     
   }
-  drive_list_request_ = drive_list_request;
+  _impl_.drive_list_request_ = drive_list_request;
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Request.drive_list_request)
 }
 
 // .aspia.proto.file_transfer.FileListRequest file_list_request = 2;
+inline bool Request::_internal_has_file_list_request() const {
+  return this != internal_default_instance() && _impl_.file_list_request_ != nullptr;
+}
 inline bool Request::has_file_list_request() const {
-  return this != internal_default_instance() && file_list_request_ != NULL;
+  return _internal_has_file_list_request();
 }
 inline void Request::clear_file_list_request() {
-  if (GetArenaNoVirtual() == NULL && file_list_request_ != NULL) {
-    delete file_list_request_;
+  if (GetArenaForAllocation() == nullptr && _impl_.file_list_request_ != nullptr) {
+    delete _impl_.file_list_request_;
   }
-  file_list_request_ = NULL;
+  _impl_.file_list_request_ = nullptr;
 }
 inline const ::aspia::proto::file_transfer::FileListRequest& Request::_internal_file_list_request() const {
-  return *file_list_request_;
+  const ::aspia::proto::file_transfer::FileListRequest* p = _impl_.file_list_request_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::file_transfer::FileListRequest&>(
+      ::aspia::proto::file_transfer::_FileListRequest_default_instance_);
 }
 inline const ::aspia::proto::file_transfer::FileListRequest& Request::file_list_request() const {
-  const ::aspia::proto::file_transfer::FileListRequest* p = file_list_request_;
   // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Request.file_list_request)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::file_transfer::FileListRequest*>(
-      &::aspia::proto::file_transfer::_FileListRequest_default_instance_);
+  return _internal_file_list_request();
+}
+inline void Request::unsafe_arena_set_allocated_file_list_request(
+    ::aspia::proto::file_transfer::FileListRequest* file_list_request) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.file_list_request_);
+  }
+  _impl_.file_list_request_ = file_list_request;
+  if (file_list_request) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.file_transfer.Request.file_list_request)
 }
 inline ::aspia::proto::file_transfer::FileListRequest* Request::release_file_list_request() {
+  
+  ::aspia::proto::file_transfer::FileListRequest* temp = _impl_.file_list_request_;
+  _impl_.file_list_request_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::file_transfer::FileListRequest* Request::unsafe_arena_release_file_list_request() {
   // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Request.file_list_request)
   
-  ::aspia::proto::file_transfer::FileListRequest* temp = file_list_request_;
-  file_list_request_ = NULL;
+  ::aspia::proto::file_transfer::FileListRequest* temp = _impl_.file_list_request_;
+  _impl_.file_list_request_ = nullptr;
   return temp;
 }
-inline ::aspia::proto::file_transfer::FileListRequest* Request::mutable_file_list_request() {
+inline ::aspia::proto::file_transfer::FileListRequest* Request::_internal_mutable_file_list_request() {
   
-  if (file_list_request_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::FileListRequest>(GetArenaNoVirtual());
-    file_list_request_ = p;
+  if (_impl_.file_list_request_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::FileListRequest>(GetArenaForAllocation());
+    _impl_.file_list_request_ = p;
   }
+  return _impl_.file_list_request_;
+}
+inline ::aspia::proto::file_transfer::FileListRequest* Request::mutable_file_list_request() {
+  ::aspia::proto::file_transfer::FileListRequest* _msg = _internal_mutable_file_list_request();
   // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Request.file_list_request)
-  return file_list_request_;
+  return _msg;
 }
 inline void Request::set_allocated_file_list_request(::aspia::proto::file_transfer::FileListRequest* file_list_request) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete file_list_request_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.file_list_request_;
   }
   if (file_list_request) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(file_list_request);
     if (message_arena != submessage_arena) {
-      file_list_request = ::google::protobuf::internal::GetOwnedMessage(
+      file_list_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, file_list_request, submessage_arena);
     }
     
   } else {
     
   }
-  file_list_request_ = file_list_request;
+  _impl_.file_list_request_ = file_list_request;
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Request.file_list_request)
 }
 
 // .aspia.proto.file_transfer.CreateDirectoryRequest create_directory_request = 3;
+inline bool Request::_internal_has_create_directory_request() const {
+  return this != internal_default_instance() && _impl_.create_directory_request_ != nullptr;
+}
 inline bool Request::has_create_directory_request() const {
-  return this != internal_default_instance() && create_directory_request_ != NULL;
+  return _internal_has_create_directory_request();
 }
 inline void Request::clear_create_directory_request() {
-  if (GetArenaNoVirtual() == NULL && create_directory_request_ != NULL) {
-    delete create_directory_request_;
+  if (GetArenaForAllocation() == nullptr && _impl_.create_directory_request_ != nullptr) {
+    delete _impl_.create_directory_request_;
   }
-  create_directory_request_ = NULL;
+  _impl_.create_directory_request_ = nullptr;
 }
 inline const ::aspia::proto::file_transfer::CreateDirectoryRequest& Request::_internal_create_directory_request() const {
-  return *create_directory_request_;
+  const ::aspia::proto::file_transfer::CreateDirectoryRequest* p = _impl_.create_directory_request_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::file_transfer::CreateDirectoryRequest&>(
+      ::aspia::proto::file_transfer::_CreateDirectoryRequest_default_instance_);
 }
 inline const ::aspia::proto::file_transfer::CreateDirectoryRequest& Request::create_directory_request() const {
-  const ::aspia::proto::file_transfer::CreateDirectoryRequest* p = create_directory_request_;
   // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Request.create_directory_request)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::file_transfer::CreateDirectoryRequest*>(
-      &::aspia::proto::file_transfer::_CreateDirectoryRequest_default_instance_);
+  return _internal_create_directory_request();
+}
+inline void Request::unsafe_arena_set_allocated_create_directory_request(
+    ::aspia::proto::file_transfer::CreateDirectoryRequest* create_directory_request) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.create_directory_request_);
+  }
+  _impl_.create_directory_request_ = create_directory_request;
+  if (create_directory_request) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.file_transfer.Request.create_directory_request)
 }
 inline ::aspia::proto::file_transfer::CreateDirectoryRequest* Request::release_create_directory_request() {
+  
+  ::aspia::proto::file_transfer::CreateDirectoryRequest* temp = _impl_.create_directory_request_;
+  _impl_.create_directory_request_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::file_transfer::CreateDirectoryRequest* Request::unsafe_arena_release_create_directory_request() {
   // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Request.create_directory_request)
   
-  ::aspia::proto::file_transfer::CreateDirectoryRequest* temp = create_directory_request_;
-  create_directory_request_ = NULL;
+  ::aspia::proto::file_transfer::CreateDirectoryRequest* temp = _impl_.create_directory_request_;
+  _impl_.create_directory_request_ = nullptr;
   return temp;
 }
-inline ::aspia::proto::file_transfer::CreateDirectoryRequest* Request::mutable_create_directory_request() {
+inline ::aspia::proto::file_transfer::CreateDirectoryRequest* Request::_internal_mutable_create_directory_request() {
   
-  if (create_directory_request_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::CreateDirectoryRequest>(GetArenaNoVirtual());
-    create_directory_request_ = p;
+  if (_impl_.create_directory_request_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::CreateDirectoryRequest>(GetArenaForAllocation());
+    _impl_.create_directory_request_ = p;
   }
+  return _impl_.create_directory_request_;
+}
+inline ::aspia::proto::file_transfer::CreateDirectoryRequest* Request::mutable_create_directory_request() {
+  ::aspia::proto::file_transfer::CreateDirectoryRequest* _msg = _internal_mutable_create_directory_request();
   // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Request.create_directory_request)
-  return create_directory_request_;
+  return _msg;
 }
 inline void Request::set_allocated_create_directory_request(::aspia::proto::file_transfer::CreateDirectoryRequest* create_directory_request) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete create_directory_request_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.create_directory_request_;
   }
   if (create_directory_request) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(create_directory_request);
     if (message_arena != submessage_arena) {
-      create_directory_request = ::google::protobuf::internal::GetOwnedMessage(
+      create_directory_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, create_directory_request, submessage_arena);
     }
     
   } else {
     
   }
-  create_directory_request_ = create_directory_request;
+  _impl_.create_directory_request_ = create_directory_request;
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Request.create_directory_request)
 }
 
 // .aspia.proto.file_transfer.RenameRequest rename_request = 4;
+inline bool Request::_internal_has_rename_request() const {
+  return this != internal_default_instance() && _impl_.rename_request_ != nullptr;
+}
 inline bool Request::has_rename_request() const {
-  return this != internal_default_instance() && rename_request_ != NULL;
+  return _internal_has_rename_request();
 }
 inline void Request::clear_rename_request() {
-  if (GetArenaNoVirtual() == NULL && rename_request_ != NULL) {
-    delete rename_request_;
+  if (GetArenaForAllocation() == nullptr && _impl_.rename_request_ != nullptr) {
+    delete _impl_.rename_request_;
   }
-  rename_request_ = NULL;
+  _impl_.rename_request_ = nullptr;
 }
 inline const ::aspia::proto::file_transfer::RenameRequest& Request::_internal_rename_request() const {
-  return *rename_request_;
+  const ::aspia::proto::file_transfer::RenameRequest* p = _impl_.rename_request_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::file_transfer::RenameRequest&>(
+      ::aspia::proto::file_transfer::_RenameRequest_default_instance_);
 }
 inline const ::aspia::proto::file_transfer::RenameRequest& Request::rename_request() const {
-  const ::aspia::proto::file_transfer::RenameRequest* p = rename_request_;
   // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Request.rename_request)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::file_transfer::RenameRequest*>(
-      &::aspia::proto::file_transfer::_RenameRequest_default_instance_);
+  return _internal_rename_request();
+}
+inline void Request::unsafe_arena_set_allocated_rename_request(
+    ::aspia::proto::file_transfer::RenameRequest* rename_request) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.rename_request_);
+  }
+  _impl_.rename_request_ = rename_request;
+  if (rename_request) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.file_transfer.Request.rename_request)
 }
 inline ::aspia::proto::file_transfer::RenameRequest* Request::release_rename_request() {
+  
+  ::aspia::proto::file_transfer::RenameRequest* temp = _impl_.rename_request_;
+  _impl_.rename_request_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::file_transfer::RenameRequest* Request::unsafe_arena_release_rename_request() {
   // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Request.rename_request)
   
-  ::aspia::proto::file_transfer::RenameRequest* temp = rename_request_;
-  rename_request_ = NULL;
+  ::aspia::proto::file_transfer::RenameRequest* temp = _impl_.rename_request_;
+  _impl_.rename_request_ = nullptr;
   return temp;
 }
-inline ::aspia::proto::file_transfer::RenameRequest* Request::mutable_rename_request() {
+inline ::aspia::proto::file_transfer::RenameRequest* Request::_internal_mutable_rename_request() {
   
-  if (rename_request_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::RenameRequest>(GetArenaNoVirtual());
-    rename_request_ = p;
+  if (_impl_.rename_request_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::RenameRequest>(GetArenaForAllocation());
+    _impl_.rename_request_ = p;
   }
+  return _impl_.rename_request_;
+}
+inline ::aspia::proto::file_transfer::RenameRequest* Request::mutable_rename_request() {
+  ::aspia::proto::file_transfer::RenameRequest* _msg = _internal_mutable_rename_request();
   // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Request.rename_request)
-  return rename_request_;
+  return _msg;
 }
 inline void Request::set_allocated_rename_request(::aspia::proto::file_transfer::RenameRequest* rename_request) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete rename_request_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.rename_request_;
   }
   if (rename_request) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(rename_request);
     if (message_arena != submessage_arena) {
-      rename_request = ::google::protobuf::internal::GetOwnedMessage(
+      rename_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, rename_request, submessage_arena);
     }
     
   } else {
     
   }
-  rename_request_ = rename_request;
+  _impl_.rename_request_ = rename_request;
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Request.rename_request)
 }
 
 // .aspia.proto.file_transfer.RemoveRequest remove_request = 5;
+inline bool Request::_internal_has_remove_request() const {
+  return this != internal_default_instance() && _impl_.remove_request_ != nullptr;
+}
 inline bool Request::has_remove_request() const {
-  return this != internal_default_instance() && remove_request_ != NULL;
+  return _internal_has_remove_request();
 }
 inline void Request::clear_remove_request() {
-  if (GetArenaNoVirtual() == NULL && remove_request_ != NULL) {
-    delete remove_request_;
+  if (GetArenaForAllocation() == nullptr && _impl_.remove_request_ != nullptr) {
+    delete _impl_.remove_request_;
   }
-  remove_request_ = NULL;
+  _impl_.remove_request_ = nullptr;
 }
 inline const ::aspia::proto::file_transfer::RemoveRequest& Request::_internal_remove_request() const {
-  return *remove_request_;
+  const ::aspia::proto::file_transfer::RemoveRequest* p = _impl_.remove_request_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::file_transfer::RemoveRequest&>(
+      ::aspia::proto::file_transfer::_RemoveRequest_default_instance_);
 }
 inline const ::aspia::proto::file_transfer::RemoveRequest& Request::remove_request() const {
-  const ::aspia::proto::file_transfer::RemoveRequest* p = remove_request_;
   // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Request.remove_request)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::file_transfer::RemoveRequest*>(
-      &::aspia::proto::file_transfer::_RemoveRequest_default_instance_);
+  return _internal_remove_request();
+}
+inline void Request::unsafe_arena_set_allocated_remove_request(
+    ::aspia::proto::file_transfer::RemoveRequest* remove_request) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.remove_request_);
+  }
+  _impl_.remove_request_ = remove_request;
+  if (remove_request) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.file_transfer.Request.remove_request)
 }
 inline ::aspia::proto::file_transfer::RemoveRequest* Request::release_remove_request() {
+  
+  ::aspia::proto::file_transfer::RemoveRequest* temp = _impl_.remove_request_;
+  _impl_.remove_request_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::file_transfer::RemoveRequest* Request::unsafe_arena_release_remove_request() {
   // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Request.remove_request)
   
-  ::aspia::proto::file_transfer::RemoveRequest* temp = remove_request_;
-  remove_request_ = NULL;
+  ::aspia::proto::file_transfer::RemoveRequest* temp = _impl_.remove_request_;
+  _impl_.remove_request_ = nullptr;
   return temp;
 }
-inline ::aspia::proto::file_transfer::RemoveRequest* Request::mutable_remove_request() {
+inline ::aspia::proto::file_transfer::RemoveRequest* Request::_internal_mutable_remove_request() {
   
-  if (remove_request_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::RemoveRequest>(GetArenaNoVirtual());
-    remove_request_ = p;
+  if (_impl_.remove_request_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::RemoveRequest>(GetArenaForAllocation());
+    _impl_.remove_request_ = p;
   }
+  return _impl_.remove_request_;
+}
+inline ::aspia::proto::file_transfer::RemoveRequest* Request::mutable_remove_request() {
+  ::aspia::proto::file_transfer::RemoveRequest* _msg = _internal_mutable_remove_request();
   // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Request.remove_request)
-  return remove_request_;
+  return _msg;
 }
 inline void Request::set_allocated_remove_request(::aspia::proto::file_transfer::RemoveRequest* remove_request) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete remove_request_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.remove_request_;
   }
   if (remove_request) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(remove_request);
     if (message_arena != submessage_arena) {
-      remove_request = ::google::protobuf::internal::GetOwnedMessage(
+      remove_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, remove_request, submessage_arena);
     }
     
   } else {
     
   }
-  remove_request_ = remove_request;
+  _impl_.remove_request_ = remove_request;
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Request.remove_request)
 }
 
 // .aspia.proto.file_transfer.DownloadRequest download_request = 6;
+inline bool Request::_internal_has_download_request() const {
+  return this != internal_default_instance() && _impl_.download_request_ != nullptr;
+}
 inline bool Request::has_download_request() const {
-  return this != internal_default_instance() && download_request_ != NULL;
+  return _internal_has_download_request();
 }
 inline void Request::clear_download_request() {
-  if (GetArenaNoVirtual() == NULL && download_request_ != NULL) {
-    delete download_request_;
+  if (GetArenaForAllocation() == nullptr && _impl_.download_request_ != nullptr) {
+    delete _impl_.download_request_;
   }
-  download_request_ = NULL;
+  _impl_.download_request_ = nullptr;
 }
 inline const ::aspia::proto::file_transfer::DownloadRequest& Request::_internal_download_request() const {
-  return *download_request_;
+  const ::aspia::proto::file_transfer::DownloadRequest* p = _impl_.download_request_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::file_transfer::DownloadRequest&>(
+      ::aspia::proto::file_transfer::_DownloadRequest_default_instance_);
 }
 inline const ::aspia::proto::file_transfer::DownloadRequest& Request::download_request() const {
-  const ::aspia::proto::file_transfer::DownloadRequest* p = download_request_;
   // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Request.download_request)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::file_transfer::DownloadRequest*>(
-      &::aspia::proto::file_transfer::_DownloadRequest_default_instance_);
+  return _internal_download_request();
+}
+inline void Request::unsafe_arena_set_allocated_download_request(
+    ::aspia::proto::file_transfer::DownloadRequest* download_request) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.download_request_);
+  }
+  _impl_.download_request_ = download_request;
+  if (download_request) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.file_transfer.Request.download_request)
 }
 inline ::aspia::proto::file_transfer::DownloadRequest* Request::release_download_request() {
+  
+  ::aspia::proto::file_transfer::DownloadRequest* temp = _impl_.download_request_;
+  _impl_.download_request_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::file_transfer::DownloadRequest* Request::unsafe_arena_release_download_request() {
   // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Request.download_request)
   
-  ::aspia::proto::file_transfer::DownloadRequest* temp = download_request_;
-  download_request_ = NULL;
+  ::aspia::proto::file_transfer::DownloadRequest* temp = _impl_.download_request_;
+  _impl_.download_request_ = nullptr;
   return temp;
 }
-inline ::aspia::proto::file_transfer::DownloadRequest* Request::mutable_download_request() {
+inline ::aspia::proto::file_transfer::DownloadRequest* Request::_internal_mutable_download_request() {
   
-  if (download_request_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::DownloadRequest>(GetArenaNoVirtual());
-    download_request_ = p;
+  if (_impl_.download_request_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::DownloadRequest>(GetArenaForAllocation());
+    _impl_.download_request_ = p;
   }
+  return _impl_.download_request_;
+}
+inline ::aspia::proto::file_transfer::DownloadRequest* Request::mutable_download_request() {
+  ::aspia::proto::file_transfer::DownloadRequest* _msg = _internal_mutable_download_request();
   // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Request.download_request)
-  return download_request_;
+  return _msg;
 }
 inline void Request::set_allocated_download_request(::aspia::proto::file_transfer::DownloadRequest* download_request) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete download_request_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.download_request_;
   }
   if (download_request) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(download_request);
     if (message_arena != submessage_arena) {
-      download_request = ::google::protobuf::internal::GetOwnedMessage(
+      download_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, download_request, submessage_arena);
     }
     
   } else {
     
   }
-  download_request_ = download_request;
+  _impl_.download_request_ = download_request;
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Request.download_request)
 }
 
 // .aspia.proto.file_transfer.UploadRequest upload_request = 7;
+inline bool Request::_internal_has_upload_request() const {
+  return this != internal_default_instance() && _impl_.upload_request_ != nullptr;
+}
 inline bool Request::has_upload_request() const {
-  return this != internal_default_instance() && upload_request_ != NULL;
+  return _internal_has_upload_request();
 }
 inline void Request::clear_upload_request() {
-  if (GetArenaNoVirtual() == NULL && upload_request_ != NULL) {
-    delete upload_request_;
+  if (GetArenaForAllocation() == nullptr && _impl_.upload_request_ != nullptr) {
+    delete _impl_.upload_request_;
   }
-  upload_request_ = NULL;
+  _impl_.upload_request_ = nullptr;
 }
 inline const ::aspia::proto::file_transfer::UploadRequest& Request::_internal_upload_request() const {
-  return *upload_request_;
+  const ::aspia::proto::file_transfer::UploadRequest* p = _impl_.upload_request_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::file_transfer::UploadRequest&>(
+      ::aspia::proto::file_transfer::_UploadRequest_default_instance_);
 }
 inline const ::aspia::proto::file_transfer::UploadRequest& Request::upload_request() const {
-  const ::aspia::proto::file_transfer::UploadRequest* p = upload_request_;
   // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Request.upload_request)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::file_transfer::UploadRequest*>(
-      &::aspia::proto::file_transfer::_UploadRequest_default_instance_);
+  return _internal_upload_request();
+}
+inline void Request::unsafe_arena_set_allocated_upload_request(
+    ::aspia::proto::file_transfer::UploadRequest* upload_request) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.upload_request_);
+  }
+  _impl_.upload_request_ = upload_request;
+  if (upload_request) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.file_transfer.Request.upload_request)
 }
 inline ::aspia::proto::file_transfer::UploadRequest* Request::release_upload_request() {
+  
+  ::aspia::proto::file_transfer::UploadRequest* temp = _impl_.upload_request_;
+  _impl_.upload_request_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::file_transfer::UploadRequest* Request::unsafe_arena_release_upload_request() {
   // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Request.upload_request)
   
-  ::aspia::proto::file_transfer::UploadRequest* temp = upload_request_;
-  upload_request_ = NULL;
+  ::aspia::proto::file_transfer::UploadRequest* temp = _impl_.upload_request_;
+  _impl_.upload_request_ = nullptr;
   return temp;
 }
-inline ::aspia::proto::file_transfer::UploadRequest* Request::mutable_upload_request() {
+inline ::aspia::proto::file_transfer::UploadRequest* Request::_internal_mutable_upload_request() {
   
-  if (upload_request_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::UploadRequest>(GetArenaNoVirtual());
-    upload_request_ = p;
+  if (_impl_.upload_request_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::UploadRequest>(GetArenaForAllocation());
+    _impl_.upload_request_ = p;
   }
+  return _impl_.upload_request_;
+}
+inline ::aspia::proto::file_transfer::UploadRequest* Request::mutable_upload_request() {
+  ::aspia::proto::file_transfer::UploadRequest* _msg = _internal_mutable_upload_request();
   // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Request.upload_request)
-  return upload_request_;
+  return _msg;
 }
 inline void Request::set_allocated_upload_request(::aspia::proto::file_transfer::UploadRequest* upload_request) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete upload_request_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.upload_request_;
   }
   if (upload_request) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(upload_request);
     if (message_arena != submessage_arena) {
-      upload_request = ::google::protobuf::internal::GetOwnedMessage(
+      upload_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, upload_request, submessage_arena);
     }
     
   } else {
     
   }
-  upload_request_ = upload_request;
+  _impl_.upload_request_ = upload_request;
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Request.upload_request)
 }
 
 // .aspia.proto.file_transfer.PacketRequest packet_request = 8;
+inline bool Request::_internal_has_packet_request() const {
+  return this != internal_default_instance() && _impl_.packet_request_ != nullptr;
+}
 inline bool Request::has_packet_request() const {
-  return this != internal_default_instance() && packet_request_ != NULL;
+  return _internal_has_packet_request();
 }
 inline void Request::clear_packet_request() {
-  if (GetArenaNoVirtual() == NULL && packet_request_ != NULL) {
-    delete packet_request_;
+  if (GetArenaForAllocation() == nullptr && _impl_.packet_request_ != nullptr) {
+    delete _impl_.packet_request_;
   }
-  packet_request_ = NULL;
+  _impl_.packet_request_ = nullptr;
 }
 inline const ::aspia::proto::file_transfer::PacketRequest& Request::_internal_packet_request() const {
-  return *packet_request_;
+  const ::aspia::proto::file_transfer::PacketRequest* p = _impl_.packet_request_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::file_transfer::PacketRequest&>(
+      ::aspia::proto::file_transfer::_PacketRequest_default_instance_);
 }
 inline const ::aspia::proto::file_transfer::PacketRequest& Request::packet_request() const {
-  const ::aspia::proto::file_transfer::PacketRequest* p = packet_request_;
   // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Request.packet_request)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::file_transfer::PacketRequest*>(
-      &::aspia::proto::file_transfer::_PacketRequest_default_instance_);
+  return _internal_packet_request();
+}
+inline void Request::unsafe_arena_set_allocated_packet_request(
+    ::aspia::proto::file_transfer::PacketRequest* packet_request) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.packet_request_);
+  }
+  _impl_.packet_request_ = packet_request;
+  if (packet_request) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.file_transfer.Request.packet_request)
 }
 inline ::aspia::proto::file_transfer::PacketRequest* Request::release_packet_request() {
+  
+  ::aspia::proto::file_transfer::PacketRequest* temp = _impl_.packet_request_;
+  _impl_.packet_request_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::file_transfer::PacketRequest* Request::unsafe_arena_release_packet_request() {
   // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Request.packet_request)
   
-  ::aspia::proto::file_transfer::PacketRequest* temp = packet_request_;
-  packet_request_ = NULL;
+  ::aspia::proto::file_transfer::PacketRequest* temp = _impl_.packet_request_;
+  _impl_.packet_request_ = nullptr;
   return temp;
 }
-inline ::aspia::proto::file_transfer::PacketRequest* Request::mutable_packet_request() {
+inline ::aspia::proto::file_transfer::PacketRequest* Request::_internal_mutable_packet_request() {
   
-  if (packet_request_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::PacketRequest>(GetArenaNoVirtual());
-    packet_request_ = p;
+  if (_impl_.packet_request_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::PacketRequest>(GetArenaForAllocation());
+    _impl_.packet_request_ = p;
   }
+  return _impl_.packet_request_;
+}
+inline ::aspia::proto::file_transfer::PacketRequest* Request::mutable_packet_request() {
+  ::aspia::proto::file_transfer::PacketRequest* _msg = _internal_mutable_packet_request();
   // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Request.packet_request)
-  return packet_request_;
+  return _msg;
 }
 inline void Request::set_allocated_packet_request(::aspia::proto::file_transfer::PacketRequest* packet_request) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete packet_request_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.packet_request_;
   }
   if (packet_request) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(packet_request);
     if (message_arena != submessage_arena) {
-      packet_request = ::google::protobuf::internal::GetOwnedMessage(
+      packet_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, packet_request, submessage_arena);
     }
     
   } else {
     
   }
-  packet_request_ = packet_request;
+  _impl_.packet_request_ = packet_request;
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Request.packet_request)
 }
 
 // .aspia.proto.file_transfer.Packet packet = 9;
+inline bool Request::_internal_has_packet() const {
+  return this != internal_default_instance() && _impl_.packet_ != nullptr;
+}
 inline bool Request::has_packet() const {
-  return this != internal_default_instance() && packet_ != NULL;
+  return _internal_has_packet();
 }
 inline void Request::clear_packet() {
-  if (GetArenaNoVirtual() == NULL && packet_ != NULL) {
-    delete packet_;
+  if (GetArenaForAllocation() == nullptr && _impl_.packet_ != nullptr) {
+    delete _impl_.packet_;
   }
-  packet_ = NULL;
+  _impl_.packet_ = nullptr;
 }
 inline const ::aspia::proto::file_transfer::Packet& Request::_internal_packet() const {
-  return *packet_;
+  const ::aspia::proto::file_transfer::Packet* p = _impl_.packet_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::file_transfer::Packet&>(
+      ::aspia::proto::file_transfer::_Packet_default_instance_);
 }
 inline const ::aspia::proto::file_transfer::Packet& Request::packet() const {
-  const ::aspia::proto::file_transfer::Packet* p = packet_;
   // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Request.packet)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::file_transfer::Packet*>(
-      &::aspia::proto::file_transfer::_Packet_default_instance_);
+  return _internal_packet();
+}
+inline void Request::unsafe_arena_set_allocated_packet(
+    ::aspia::proto::file_transfer::Packet* packet) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.packet_);
+  }
+  _impl_.packet_ = packet;
+  if (packet) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.file_transfer.Request.packet)
 }
 inline ::aspia::proto::file_transfer::Packet* Request::release_packet() {
+  
+  ::aspia::proto::file_transfer::Packet* temp = _impl_.packet_;
+  _impl_.packet_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::file_transfer::Packet* Request::unsafe_arena_release_packet() {
   // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Request.packet)
   
-  ::aspia::proto::file_transfer::Packet* temp = packet_;
-  packet_ = NULL;
+  ::aspia::proto::file_transfer::Packet* temp = _impl_.packet_;
+  _impl_.packet_ = nullptr;
   return temp;
 }
-inline ::aspia::proto::file_transfer::Packet* Request::mutable_packet() {
+inline ::aspia::proto::file_transfer::Packet* Request::_internal_mutable_packet() {
   
-  if (packet_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::Packet>(GetArenaNoVirtual());
-    packet_ = p;
+  if (_impl_.packet_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::Packet>(GetArenaForAllocation());
+    _impl_.packet_ = p;
   }
+  return _impl_.packet_;
+}
+inline ::aspia::proto::file_transfer::Packet* Request::mutable_packet() {
+  ::aspia::proto::file_transfer::Packet* _msg = _internal_mutable_packet();
   // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Request.packet)
-  return packet_;
+  return _msg;
 }
 inline void Request::set_allocated_packet(::aspia::proto::file_transfer::Packet* packet) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete packet_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.packet_;
   }
   if (packet) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(packet);
     if (message_arena != submessage_arena) {
-      packet = ::google::protobuf::internal::GetOwnedMessage(
+      packet = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, packet, submessage_arena);
     }
     
   } else {
     
   }
-  packet_ = packet;
+  _impl_.packet_ = packet;
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Request.packet)
 }
 
+// uint64 request_id = 10;
+inline void Request::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t Request::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t Request::request_id() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Request.request_id)
+  return _internal_request_id();
+}
+inline void Request::_internal_set_request_id(uint64_t value) {
+  
+  _impl_.request_id_ = value;
+}
+inline void Request::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.file_transfer.Request.request_id)
+}
+
+// .aspia.proto.file_transfer.RemoteCopyRequest remote_copy_request = 11;
+inline bool Request::_internal_has_remote_copy_request() const {
+  return this != internal_default_instance() && _impl_.remote_copy_request_ != nullptr;
+}
+inline bool Request::has_remote_copy_request() const {
+  return _internal_has_remote_copy_request();
+}
+inline void Request::clear_remote_copy_request() {
+  if (GetArenaForAllocation() == nullptr && _impl_.remote_copy_request_ != nullptr) {
+    delete _impl_.remote_copy_request_;
+  }
+  _impl_.remote_copy_request_ = nullptr;
+}
+inline const ::aspia::proto::file_transfer::RemoteCopyRequest& Request::_internal_remote_copy_request() const {
+  const ::aspia::proto::file_transfer::RemoteCopyRequest* p = _impl_.remote_copy_request_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::file_transfer::RemoteCopyRequest&>(
+      ::aspia::proto::file_transfer::_RemoteCopyRequest_default_instance_);
+}
+inline const ::aspia::proto::file_transfer::RemoteCopyRequest& Request::remote_copy_request() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.file_transfer.Request.remote_copy_request)
+  return _internal_remote_copy_request();
+}
+inline void Request::unsafe_arena_set_allocated_remote_copy_request(
+    ::aspia::proto::file_transfer::RemoteCopyRequest* remote_copy_request) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.remote_copy_request_);
+  }
+  _impl_.remote_copy_request_ = remote_copy_request;
+  if (remote_copy_request) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.file_transfer.Request.remote_copy_request)
+}
+inline ::aspia::proto::file_transfer::RemoteCopyRequest* Request::release_remote_copy_request() {
+  
+  ::aspia::proto::file_transfer::RemoteCopyRequest* temp = _impl_.remote_copy_request_;
+  _impl_.remote_copy_request_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::file_transfer::RemoteCopyRequest* Request::unsafe_arena_release_remote_copy_request() {
+  // @@protoc_insertion_point(field_release:aspia.proto.file_transfer.Request.remote_copy_request)
+  
+  ::aspia::proto::file_transfer::RemoteCopyRequest* temp = _impl_.remote_copy_request_;
+  _impl_.remote_copy_request_ = nullptr;
+  return temp;
+}
+inline ::aspia::proto::file_transfer::RemoteCopyRequest* Request::_internal_mutable_remote_copy_request() {
+  
+  if (_impl_.remote_copy_request_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::file_transfer::RemoteCopyRequest>(GetArenaForAllocation());
+    _impl_.remote_copy_request_ = p;
+  }
+  return _impl_.remote_copy_request_;
+}
+inline ::aspia::proto::file_transfer::RemoteCopyRequest* Request::mutable_remote_copy_request() {
+  ::aspia::proto::file_transfer::RemoteCopyRequest* _msg = _internal_mutable_remote_copy_request();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.file_transfer.Request.remote_copy_request)
+  return _msg;
+}
+inline void Request::set_allocated_remote_copy_request(::aspia::proto::file_transfer::RemoteCopyRequest* remote_copy_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.remote_copy_request_;
+  }
+  if (remote_copy_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(remote_copy_request);
+    if (message_arena != submessage_arena) {
+      remote_copy_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, remote_copy_request, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.remote_copy_request_ = remote_copy_request;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.file_transfer.Request.remote_copy_request)
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -3509,6 +8009,16 @@ inline void Request::set_allocated_packet(::aspia::proto::file_transfer::Packet*
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -3516,16 +8026,16 @@ inline void Request::set_allocated_packet(::aspia::proto::file_transfer::Packet*
 }  // namespace proto
 }  // namespace aspia
 
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 
 template <> struct is_proto_enum< ::aspia::proto::file_transfer::DriveList_Item_Type> : ::std::true_type {};
 template <> struct is_proto_enum< ::aspia::proto::file_transfer::Packet_Flags> : ::std::true_type {};
 template <> struct is_proto_enum< ::aspia::proto::file_transfer::Status> : ::std::true_type {};
+template <> struct is_proto_enum< ::aspia::proto::file_transfer::PacketCompression> : ::std::true_type {};
 
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_INCLUDED_file_5ftransfer_5fsession_2eproto
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_file_5ftransfer_5fsession_2eproto
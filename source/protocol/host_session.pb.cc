@@ -0,0 +1,879 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: host_session.proto
+
+#include "host_session.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace aspia {
+namespace proto {
+namespace host {
+PROTOBUF_CONSTEXPR MemoryUsage::MemoryUsage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.process_)*/int64_t{0}
+  , /*decltype(_impl_.frames_)*/int64_t{0}
+  , /*decltype(_impl_.differ_)*/int64_t{0}
+  , /*decltype(_impl_.encoder_)*/int64_t{0}
+  , /*decltype(_impl_.queues_)*/int64_t{0}
+  , /*decltype(_impl_.caches_)*/int64_t{0}
+  , /*decltype(_impl_.degradation_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MemoryUsageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MemoryUsageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MemoryUsageDefaultTypeInternal() {}
+  union {
+    MemoryUsage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MemoryUsageDefaultTypeInternal _MemoryUsage_default_instance_;
+PROTOBUF_CONSTEXPR SessionStatistics::SessionStatistics(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.memory_usage_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SessionStatisticsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SessionStatisticsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SessionStatisticsDefaultTypeInternal() {}
+  union {
+    SessionStatistics _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SessionStatisticsDefaultTypeInternal _SessionStatistics_default_instance_;
+PROTOBUF_CONSTEXPR StartSession::StartSession(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.session_type_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.channel_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StartSessionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StartSessionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StartSessionDefaultTypeInternal() {}
+  union {
+    StartSession _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StartSessionDefaultTypeInternal _StartSession_default_instance_;
+}  // namespace host
+}  // namespace proto
+}  // namespace aspia
+namespace aspia {
+namespace proto {
+namespace host {
+
+// ===================================================================
+
+class MemoryUsage::_Internal {
+ public:
+};
+
+MemoryUsage::MemoryUsage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.host.MemoryUsage)
+}
+MemoryUsage::MemoryUsage(const MemoryUsage& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  MemoryUsage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.process_){}
+    , decltype(_impl_.frames_){}
+    , decltype(_impl_.differ_){}
+    , decltype(_impl_.encoder_){}
+    , decltype(_impl_.queues_){}
+    , decltype(_impl_.caches_){}
+    , decltype(_impl_.degradation_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::memcpy(&_impl_.process_, &from._impl_.process_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.degradation_) -
+    reinterpret_cast<char*>(&_impl_.process_)) + sizeof(_impl_.degradation_));
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.host.MemoryUsage)
+}
+
+inline void MemoryUsage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.process_){int64_t{0}}
+    , decltype(_impl_.frames_){int64_t{0}}
+    , decltype(_impl_.differ_){int64_t{0}}
+    , decltype(_impl_.encoder_){int64_t{0}}
+    , decltype(_impl_.queues_){int64_t{0}}
+    , decltype(_impl_.caches_){int64_t{0}}
+    , decltype(_impl_.degradation_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+MemoryUsage::~MemoryUsage() {
+  // @@protoc_insertion_point(destructor:aspia.proto.host.MemoryUsage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MemoryUsage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void MemoryUsage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MemoryUsage::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.host.MemoryUsage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.process_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.degradation_) -
+      reinterpret_cast<char*>(&_impl_.process_)) + sizeof(_impl_.degradation_));
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* MemoryUsage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int64 process = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.process_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 frames = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.frames_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 differ = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.differ_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 encoder = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.encoder_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 queues = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.queues_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 caches = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.caches_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 degradation = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.degradation_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MemoryUsage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.host.MemoryUsage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int64 process = 1;
+  if (this->_internal_process() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_process(), target);
+  }
+
+  // int64 frames = 2;
+  if (this->_internal_frames() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_frames(), target);
+  }
+
+  // int64 differ = 3;
+  if (this->_internal_differ() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_differ(), target);
+  }
+
+  // int64 encoder = 4;
+  if (this->_internal_encoder() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_encoder(), target);
+  }
+
+  // int64 queues = 5;
+  if (this->_internal_queues() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(5, this->_internal_queues(), target);
+  }
+
+  // int64 caches = 6;
+  if (this->_internal_caches() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(6, this->_internal_caches(), target);
+  }
+
+  // int32 degradation = 7;
+  if (this->_internal_degradation() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_degradation(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.host.MemoryUsage)
+  return target;
+}
+
+size_t MemoryUsage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.host.MemoryUsage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int64 process = 1;
+  if (this->_internal_process() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_process());
+  }
+
+  // int64 frames = 2;
+  if (this->_internal_frames() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_frames());
+  }
+
+  // int64 differ = 3;
+  if (this->_internal_differ() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_differ());
+  }
+
+  // int64 encoder = 4;
+  if (this->_internal_encoder() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_encoder());
+  }
+
+  // int64 queues = 5;
+  if (this->_internal_queues() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_queues());
+  }
+
+  // int64 caches = 6;
+  if (this->_internal_caches() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_caches());
+  }
+
+  // int32 degradation = 7;
+  if (this->_internal_degradation() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_degradation());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void MemoryUsage::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const MemoryUsage*>(
+      &from));
+}
+
+void MemoryUsage::MergeFrom(const MemoryUsage& from) {
+  MemoryUsage* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.host.MemoryUsage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_process() != 0) {
+    _this->_internal_set_process(from._internal_process());
+  }
+  if (from._internal_frames() != 0) {
+    _this->_internal_set_frames(from._internal_frames());
+  }
+  if (from._internal_differ() != 0) {
+    _this->_internal_set_differ(from._internal_differ());
+  }
+  if (from._internal_encoder() != 0) {
+    _this->_internal_set_encoder(from._internal_encoder());
+  }
+  if (from._internal_queues() != 0) {
+    _this->_internal_set_queues(from._internal_queues());
+  }
+  if (from._internal_caches() != 0) {
+    _this->_internal_set_caches(from._internal_caches());
+  }
+  if (from._internal_degradation() != 0) {
+    _this->_internal_set_degradation(from._internal_degradation());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void MemoryUsage::CopyFrom(const MemoryUsage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.host.MemoryUsage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MemoryUsage::IsInitialized() const {
+  return true;
+}
+
+void MemoryUsage::InternalSwap(MemoryUsage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MemoryUsage, _impl_.degradation_)
+      + sizeof(MemoryUsage::_impl_.degradation_)
+      - PROTOBUF_FIELD_OFFSET(MemoryUsage, _impl_.process_)>(
+          reinterpret_cast<char*>(&_impl_.process_),
+          reinterpret_cast<char*>(&other->_impl_.process_));
+}
+
+std::string MemoryUsage::GetTypeName() const {
+  return "aspia.proto.host.MemoryUsage";
+}
+
+
+// ===================================================================
+
+class SessionStatistics::_Internal {
+ public:
+  static const ::aspia::proto::host::MemoryUsage& memory_usage(const SessionStatistics* msg);
+};
+
+const ::aspia::proto::host::MemoryUsage&
+SessionStatistics::_Internal::memory_usage(const SessionStatistics* msg) {
+  return *msg->_impl_.memory_usage_;
+}
+SessionStatistics::SessionStatistics(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.host.SessionStatistics)
+}
+SessionStatistics::SessionStatistics(const SessionStatistics& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  SessionStatistics* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.memory_usage_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  if (from._internal_has_memory_usage()) {
+    _this->_impl_.memory_usage_ = new ::aspia::proto::host::MemoryUsage(*from._impl_.memory_usage_);
+  }
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.host.SessionStatistics)
+}
+
+inline void SessionStatistics::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.memory_usage_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SessionStatistics::~SessionStatistics() {
+  // @@protoc_insertion_point(destructor:aspia.proto.host.SessionStatistics)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SessionStatistics::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.memory_usage_;
+}
+
+void SessionStatistics::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SessionStatistics::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.host.SessionStatistics)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.memory_usage_ != nullptr) {
+    delete _impl_.memory_usage_;
+  }
+  _impl_.memory_usage_ = nullptr;
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* SessionStatistics::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .aspia.proto.host.MemoryUsage memory_usage = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_memory_usage(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SessionStatistics::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.host.SessionStatistics)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .aspia.proto.host.MemoryUsage memory_usage = 1;
+  if (this->_internal_has_memory_usage()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::memory_usage(this),
+        _Internal::memory_usage(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.host.SessionStatistics)
+  return target;
+}
+
+size_t SessionStatistics::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.host.SessionStatistics)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .aspia.proto.host.MemoryUsage memory_usage = 1;
+  if (this->_internal_has_memory_usage()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.memory_usage_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void SessionStatistics::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const SessionStatistics*>(
+      &from));
+}
+
+void SessionStatistics::MergeFrom(const SessionStatistics& from) {
+  SessionStatistics* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.host.SessionStatistics)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_memory_usage()) {
+    _this->_internal_mutable_memory_usage()->::aspia::proto::host::MemoryUsage::MergeFrom(
+        from._internal_memory_usage());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void SessionStatistics::CopyFrom(const SessionStatistics& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.host.SessionStatistics)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SessionStatistics::IsInitialized() const {
+  return true;
+}
+
+void SessionStatistics::InternalSwap(SessionStatistics* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.memory_usage_, other->_impl_.memory_usage_);
+}
+
+std::string SessionStatistics::GetTypeName() const {
+  return "aspia.proto.host.SessionStatistics";
+}
+
+
+// ===================================================================
+
+class StartSession::_Internal {
+ public:
+};
+
+StartSession::StartSession(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.host.StartSession)
+}
+StartSession::StartSession(const StartSession& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  StartSession* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.session_type_){}
+    , decltype(_impl_.channel_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.session_type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_session_type().empty()) {
+    _this->_impl_.session_type_.Set(from._internal_session_type(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.channel_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.channel_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_channel_id().empty()) {
+    _this->_impl_.channel_id_.Set(from._internal_channel_id(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.host.StartSession)
+}
+
+inline void StartSession::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.session_type_){}
+    , decltype(_impl_.channel_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.session_type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.channel_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.channel_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+StartSession::~StartSession() {
+  // @@protoc_insertion_point(destructor:aspia.proto.host.StartSession)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StartSession::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.session_type_.Destroy();
+  _impl_.channel_id_.Destroy();
+}
+
+void StartSession::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StartSession::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.host.StartSession)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.session_type_.ClearToEmpty();
+  _impl_.channel_id_.ClearToEmpty();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* StartSession::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string session_type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_session_type();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // string channel_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_channel_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StartSession::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.host.StartSession)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string session_type = 1;
+  if (!this->_internal_session_type().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_session_type().data(), static_cast<int>(this->_internal_session_type().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "aspia.proto.host.StartSession.session_type");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_session_type(), target);
+  }
+
+  // string channel_id = 2;
+  if (!this->_internal_channel_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_channel_id().data(), static_cast<int>(this->_internal_channel_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "aspia.proto.host.StartSession.channel_id");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_channel_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.host.StartSession)
+  return target;
+}
+
+size_t StartSession::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.host.StartSession)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string session_type = 1;
+  if (!this->_internal_session_type().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_session_type());
+  }
+
+  // string channel_id = 2;
+  if (!this->_internal_channel_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_channel_id());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void StartSession::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const StartSession*>(
+      &from));
+}
+
+void StartSession::MergeFrom(const StartSession& from) {
+  StartSession* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.host.StartSession)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_session_type().empty()) {
+    _this->_internal_set_session_type(from._internal_session_type());
+  }
+  if (!from._internal_channel_id().empty()) {
+    _this->_internal_set_channel_id(from._internal_channel_id());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void StartSession::CopyFrom(const StartSession& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.host.StartSession)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StartSession::IsInitialized() const {
+  return true;
+}
+
+void StartSession::InternalSwap(StartSession* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.session_type_, lhs_arena,
+      &other->_impl_.session_type_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.channel_id_, lhs_arena,
+      &other->_impl_.channel_id_, rhs_arena
+  );
+}
+
+std::string StartSession::GetTypeName() const {
+  return "aspia.proto.host.StartSession";
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace host
+}  // namespace proto
+}  // namespace aspia
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::aspia::proto::host::MemoryUsage*
+Arena::CreateMaybeMessage< ::aspia::proto::host::MemoryUsage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::host::MemoryUsage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::aspia::proto::host::SessionStatistics*
+Arena::CreateMaybeMessage< ::aspia::proto::host::SessionStatistics >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::host::SessionStatistics >(arena);
+}
+template<> PROTOBUF_NOINLINE ::aspia::proto::host::StartSession*
+Arena::CreateMaybeMessage< ::aspia::proto::host::StartSession >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::host::StartSession >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,920 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: host_session.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_host_5fsession_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_host_5fsession_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/message_lite.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_host_5fsession_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_host_5fsession_2eproto {
+  static const uint32_t offsets[];
+};
+namespace aspia {
+namespace proto {
+namespace host {
+class MemoryUsage;
+struct MemoryUsageDefaultTypeInternal;
+extern MemoryUsageDefaultTypeInternal _MemoryUsage_default_instance_;
+class SessionStatistics;
+struct SessionStatisticsDefaultTypeInternal;
+extern SessionStatisticsDefaultTypeInternal _SessionStatistics_default_instance_;
+class StartSession;
+struct StartSessionDefaultTypeInternal;
+extern StartSessionDefaultTypeInternal _StartSession_default_instance_;
+}  // namespace host
+}  // namespace proto
+}  // namespace aspia
+PROTOBUF_NAMESPACE_OPEN
+template<> ::aspia::proto::host::MemoryUsage* Arena::CreateMaybeMessage<::aspia::proto::host::MemoryUsage>(Arena*);
+template<> ::aspia::proto::host::SessionStatistics* Arena::CreateMaybeMessage<::aspia::proto::host::SessionStatistics>(Arena*);
+template<> ::aspia::proto::host::StartSession* Arena::CreateMaybeMessage<::aspia::proto::host::StartSession>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace aspia {
+namespace proto {
+namespace host {
+
+// ===================================================================
+
+class MemoryUsage final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.host.MemoryUsage) */ {
+ public:
+  inline MemoryUsage() : MemoryUsage(nullptr) {}
+  ~MemoryUsage() override;
+  explicit PROTOBUF_CONSTEXPR MemoryUsage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MemoryUsage(const MemoryUsage& from);
+  MemoryUsage(MemoryUsage&& from) noexcept
+    : MemoryUsage() {
+    *this = ::std::move(from);
+  }
+
+  inline MemoryUsage& operator=(const MemoryUsage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MemoryUsage& operator=(MemoryUsage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const MemoryUsage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MemoryUsage* internal_default_instance() {
+    return reinterpret_cast<const MemoryUsage*>(
+               &_MemoryUsage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(MemoryUsage& a, MemoryUsage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MemoryUsage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MemoryUsage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MemoryUsage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MemoryUsage>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const MemoryUsage& from);
+  void MergeFrom(const MemoryUsage& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(MemoryUsage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.host.MemoryUsage";
+  }
+  protected:
+  explicit MemoryUsage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kProcessFieldNumber = 1,
+    kFramesFieldNumber = 2,
+    kDifferFieldNumber = 3,
+    kEncoderFieldNumber = 4,
+    kQueuesFieldNumber = 5,
+    kCachesFieldNumber = 6,
+    kDegradationFieldNumber = 7,
+  };
+  // int64 process = 1;
+  void clear_process();
+  int64_t process() const;
+  void set_process(int64_t value);
+  private:
+  int64_t _internal_process() const;
+  void _internal_set_process(int64_t value);
+  public:
+
+  // int64 frames = 2;
+  void clear_frames();
+  int64_t frames() const;
+  void set_frames(int64_t value);
+  private:
+  int64_t _internal_frames() const;
+  void _internal_set_frames(int64_t value);
+  public:
+
+  // int64 differ = 3;
+  void clear_differ();
+  int64_t differ() const;
+  void set_differ(int64_t value);
+  private:
+  int64_t _internal_differ() const;
+  void _internal_set_differ(int64_t value);
+  public:
+
+  // int64 encoder = 4;
+  void clear_encoder();
+  int64_t encoder() const;
+  void set_encoder(int64_t value);
+  private:
+  int64_t _internal_encoder() const;
+  void _internal_set_encoder(int64_t value);
+  public:
+
+  // int64 queues = 5;
+  void clear_queues();
+  int64_t queues() const;
+  void set_queues(int64_t value);
+  private:
+  int64_t _internal_queues() const;
+  void _internal_set_queues(int64_t value);
+  public:
+
+  // int64 caches = 6;
+  void clear_caches();
+  int64_t caches() const;
+  void set_caches(int64_t value);
+  private:
+  int64_t _internal_caches() const;
+  void _internal_set_caches(int64_t value);
+  public:
+
+  // int32 degradation = 7;
+  void clear_degradation();
+  int32_t degradation() const;
+  void set_degradation(int32_t value);
+  private:
+  int32_t _internal_degradation() const;
+  void _internal_set_degradation(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.host.MemoryUsage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t process_;
+    int64_t frames_;
+    int64_t differ_;
+    int64_t encoder_;
+    int64_t queues_;
+    int64_t caches_;
+    int32_t degradation_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_host_5fsession_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SessionStatistics final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.host.SessionStatistics) */ {
+ public:
+  inline SessionStatistics() : SessionStatistics(nullptr) {}
+  ~SessionStatistics() override;
+  explicit PROTOBUF_CONSTEXPR SessionStatistics(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SessionStatistics(const SessionStatistics& from);
+  SessionStatistics(SessionStatistics&& from) noexcept
+    : SessionStatistics() {
+    *this = ::std::move(from);
+  }
+
+  inline SessionStatistics& operator=(const SessionStatistics& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SessionStatistics& operator=(SessionStatistics&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const SessionStatistics& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SessionStatistics* internal_default_instance() {
+    return reinterpret_cast<const SessionStatistics*>(
+               &_SessionStatistics_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(SessionStatistics& a, SessionStatistics& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SessionStatistics* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SessionStatistics* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SessionStatistics* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SessionStatistics>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const SessionStatistics& from);
+  void MergeFrom(const SessionStatistics& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(SessionStatistics* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.host.SessionStatistics";
+  }
+  protected:
+  explicit SessionStatistics(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMemoryUsageFieldNumber = 1,
+  };
+  // .aspia.proto.host.MemoryUsage memory_usage = 1;
+  bool has_memory_usage() const;
+  private:
+  bool _internal_has_memory_usage() const;
+  public:
+  void clear_memory_usage();
+  const ::aspia::proto::host::MemoryUsage& memory_usage() const;
+  PROTOBUF_NODISCARD ::aspia::proto::host::MemoryUsage* release_memory_usage();
+  ::aspia::proto::host::MemoryUsage* mutable_memory_usage();
+  void set_allocated_memory_usage(::aspia::proto::host::MemoryUsage* memory_usage);
+  private:
+  const ::aspia::proto::host::MemoryUsage& _internal_memory_usage() const;
+  ::aspia::proto::host::MemoryUsage* _internal_mutable_memory_usage();
+  public:
+  void unsafe_arena_set_allocated_memory_usage(
+      ::aspia::proto::host::MemoryUsage* memory_usage);
+  ::aspia::proto::host::MemoryUsage* unsafe_arena_release_memory_usage();
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.host.SessionStatistics)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::aspia::proto::host::MemoryUsage* memory_usage_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_host_5fsession_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StartSession final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.host.StartSession) */ {
+ public:
+  inline StartSession() : StartSession(nullptr) {}
+  ~StartSession() override;
+  explicit PROTOBUF_CONSTEXPR StartSession(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StartSession(const StartSession& from);
+  StartSession(StartSession&& from) noexcept
+    : StartSession() {
+    *this = ::std::move(from);
+  }
+
+  inline StartSession& operator=(const StartSession& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StartSession& operator=(StartSession&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const StartSession& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StartSession* internal_default_instance() {
+    return reinterpret_cast<const StartSession*>(
+               &_StartSession_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(StartSession& a, StartSession& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StartSession* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StartSession* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StartSession* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StartSession>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const StartSession& from);
+  void MergeFrom(const StartSession& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(StartSession* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.host.StartSession";
+  }
+  protected:
+  explicit StartSession(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSessionTypeFieldNumber = 1,
+    kChannelIdFieldNumber = 2,
+  };
+  // string session_type = 1;
+  void clear_session_type();
+  const std::string& session_type() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_session_type(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_session_type();
+  PROTOBUF_NODISCARD std::string* release_session_type();
+  void set_allocated_session_type(std::string* session_type);
+  private:
+  const std::string& _internal_session_type() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_session_type(const std::string& value);
+  std::string* _internal_mutable_session_type();
+  public:
+
+  // string channel_id = 2;
+  void clear_channel_id();
+  const std::string& channel_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_channel_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_channel_id();
+  PROTOBUF_NODISCARD std::string* release_channel_id();
+  void set_allocated_channel_id(std::string* channel_id);
+  private:
+  const std::string& _internal_channel_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_channel_id(const std::string& value);
+  std::string* _internal_mutable_channel_id();
+  public:
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.host.StartSession)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr session_type_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr channel_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_host_5fsession_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// MemoryUsage
+
+// int64 process = 1;
+inline void MemoryUsage::clear_process() {
+  _impl_.process_ = int64_t{0};
+}
+inline int64_t MemoryUsage::_internal_process() const {
+  return _impl_.process_;
+}
+inline int64_t MemoryUsage::process() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.host.MemoryUsage.process)
+  return _internal_process();
+}
+inline void MemoryUsage::_internal_set_process(int64_t value) {
+  
+  _impl_.process_ = value;
+}
+inline void MemoryUsage::set_process(int64_t value) {
+  _internal_set_process(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.host.MemoryUsage.process)
+}
+
+// int64 frames = 2;
+inline void MemoryUsage::clear_frames() {
+  _impl_.frames_ = int64_t{0};
+}
+inline int64_t MemoryUsage::_internal_frames() const {
+  return _impl_.frames_;
+}
+inline int64_t MemoryUsage::frames() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.host.MemoryUsage.frames)
+  return _internal_frames();
+}
+inline void MemoryUsage::_internal_set_frames(int64_t value) {
+  
+  _impl_.frames_ = value;
+}
+inline void MemoryUsage::set_frames(int64_t value) {
+  _internal_set_frames(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.host.MemoryUsage.frames)
+}
+
+// int64 differ = 3;
+inline void MemoryUsage::clear_differ() {
+  _impl_.differ_ = int64_t{0};
+}
+inline int64_t MemoryUsage::_internal_differ() const {
+  return _impl_.differ_;
+}
+inline int64_t MemoryUsage::differ() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.host.MemoryUsage.differ)
+  return _internal_differ();
+}
+inline void MemoryUsage::_internal_set_differ(int64_t value) {
+  
+  _impl_.differ_ = value;
+}
+inline void MemoryUsage::set_differ(int64_t value) {
+  _internal_set_differ(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.host.MemoryUsage.differ)
+}
+
+// int64 encoder = 4;
+inline void MemoryUsage::clear_encoder() {
+  _impl_.encoder_ = int64_t{0};
+}
+inline int64_t MemoryUsage::_internal_encoder() const {
+  return _impl_.encoder_;
+}
+inline int64_t MemoryUsage::encoder() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.host.MemoryUsage.encoder)
+  return _internal_encoder();
+}
+inline void MemoryUsage::_internal_set_encoder(int64_t value) {
+  
+  _impl_.encoder_ = value;
+}
+inline void MemoryUsage::set_encoder(int64_t value) {
+  _internal_set_encoder(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.host.MemoryUsage.encoder)
+}
+
+// int64 queues = 5;
+inline void MemoryUsage::clear_queues() {
+  _impl_.queues_ = int64_t{0};
+}
+inline int64_t MemoryUsage::_internal_queues() const {
+  return _impl_.queues_;
+}
+inline int64_t MemoryUsage::queues() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.host.MemoryUsage.queues)
+  return _internal_queues();
+}
+inline void MemoryUsage::_internal_set_queues(int64_t value) {
+  
+  _impl_.queues_ = value;
+}
+inline void MemoryUsage::set_queues(int64_t value) {
+  _internal_set_queues(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.host.MemoryUsage.queues)
+}
+
+// int64 caches = 6;
+inline void MemoryUsage::clear_caches() {
+  _impl_.caches_ = int64_t{0};
+}
+inline int64_t MemoryUsage::_internal_caches() const {
+  return _impl_.caches_;
+}
+inline int64_t MemoryUsage::caches() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.host.MemoryUsage.caches)
+  return _internal_caches();
+}
+inline void MemoryUsage::_internal_set_caches(int64_t value) {
+  
+  _impl_.caches_ = value;
+}
+inline void MemoryUsage::set_caches(int64_t value) {
+  _internal_set_caches(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.host.MemoryUsage.caches)
+}
+
+// int32 degradation = 7;
+inline void MemoryUsage::clear_degradation() {
+  _impl_.degradation_ = 0;
+}
+inline int32_t MemoryUsage::_internal_degradation() const {
+  return _impl_.degradation_;
+}
+inline int32_t MemoryUsage::degradation() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.host.MemoryUsage.degradation)
+  return _internal_degradation();
+}
+inline void MemoryUsage::_internal_set_degradation(int32_t value) {
+  
+  _impl_.degradation_ = value;
+}
+inline void MemoryUsage::set_degradation(int32_t value) {
+  _internal_set_degradation(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.host.MemoryUsage.degradation)
+}
+
+// -------------------------------------------------------------------
+
+// SessionStatistics
+
+// .aspia.proto.host.MemoryUsage memory_usage = 1;
+inline bool SessionStatistics::_internal_has_memory_usage() const {
+  return this != internal_default_instance() && _impl_.memory_usage_ != nullptr;
+}
+inline bool SessionStatistics::has_memory_usage() const {
+  return _internal_has_memory_usage();
+}
+inline void SessionStatistics::clear_memory_usage() {
+  if (GetArenaForAllocation() == nullptr && _impl_.memory_usage_ != nullptr) {
+    delete _impl_.memory_usage_;
+  }
+  _impl_.memory_usage_ = nullptr;
+}
+inline const ::aspia::proto::host::MemoryUsage& SessionStatistics::_internal_memory_usage() const {
+  const ::aspia::proto::host::MemoryUsage* p = _impl_.memory_usage_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::host::MemoryUsage&>(
+      ::aspia::proto::host::_MemoryUsage_default_instance_);
+}
+inline const ::aspia::proto::host::MemoryUsage& SessionStatistics::memory_usage() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.host.SessionStatistics.memory_usage)
+  return _internal_memory_usage();
+}
+inline void SessionStatistics::unsafe_arena_set_allocated_memory_usage(
+    ::aspia::proto::host::MemoryUsage* memory_usage) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.memory_usage_);
+  }
+  _impl_.memory_usage_ = memory_usage;
+  if (memory_usage) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.host.SessionStatistics.memory_usage)
+}
+inline ::aspia::proto::host::MemoryUsage* SessionStatistics::release_memory_usage() {
+  
+  ::aspia::proto::host::MemoryUsage* temp = _impl_.memory_usage_;
+  _impl_.memory_usage_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::host::MemoryUsage* SessionStatistics::unsafe_arena_release_memory_usage() {
+  // @@protoc_insertion_point(field_release:aspia.proto.host.SessionStatistics.memory_usage)
+  
+  ::aspia::proto::host::MemoryUsage* temp = _impl_.memory_usage_;
+  _impl_.memory_usage_ = nullptr;
+  return temp;
+}
+inline ::aspia::proto::host::MemoryUsage* SessionStatistics::_internal_mutable_memory_usage() {
+  
+  if (_impl_.memory_usage_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::host::MemoryUsage>(GetArenaForAllocation());
+    _impl_.memory_usage_ = p;
+  }
+  return _impl_.memory_usage_;
+}
+inline ::aspia::proto::host::MemoryUsage* SessionStatistics::mutable_memory_usage() {
+  ::aspia::proto::host::MemoryUsage* _msg = _internal_mutable_memory_usage();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.host.SessionStatistics.memory_usage)
+  return _msg;
+}
+inline void SessionStatistics::set_allocated_memory_usage(::aspia::proto::host::MemoryUsage* memory_usage) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.memory_usage_;
+  }
+  if (memory_usage) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(memory_usage);
+    if (message_arena != submessage_arena) {
+      memory_usage = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, memory_usage, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.memory_usage_ = memory_usage;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.host.SessionStatistics.memory_usage)
+}
+
+// -------------------------------------------------------------------
+
+// StartSession
+
+// string session_type = 1;
+inline void StartSession::clear_session_type() {
+  _impl_.session_type_.ClearToEmpty();
+}
+inline const std::string& StartSession::session_type() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.host.StartSession.session_type)
+  return _internal_session_type();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void StartSession::set_session_type(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.session_type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.host.StartSession.session_type)
+}
+inline std::string* StartSession::mutable_session_type() {
+  std::string* _s = _internal_mutable_session_type();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.host.StartSession.session_type)
+  return _s;
+}
+inline const std::string& StartSession::_internal_session_type() const {
+  return _impl_.session_type_.Get();
+}
+inline void StartSession::_internal_set_session_type(const std::string& value) {
+  
+  _impl_.session_type_.Set(value, GetArenaForAllocation());
+}
+inline std::string* StartSession::_internal_mutable_session_type() {
+  
+  return _impl_.session_type_.Mutable(GetArenaForAllocation());
+}
+inline std::string* StartSession::release_session_type() {
+  // @@protoc_insertion_point(field_release:aspia.proto.host.StartSession.session_type)
+  return _impl_.session_type_.Release();
+}
+inline void StartSession::set_allocated_session_type(std::string* session_type) {
+  if (session_type != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.session_type_.SetAllocated(session_type, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.session_type_.IsDefault()) {
+    _impl_.session_type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.host.StartSession.session_type)
+}
+
+// string channel_id = 2;
+inline void StartSession::clear_channel_id() {
+  _impl_.channel_id_.ClearToEmpty();
+}
+inline const std::string& StartSession::channel_id() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.host.StartSession.channel_id)
+  return _internal_channel_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void StartSession::set_channel_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.channel_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.host.StartSession.channel_id)
+}
+inline std::string* StartSession::mutable_channel_id() {
+  std::string* _s = _internal_mutable_channel_id();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.host.StartSession.channel_id)
+  return _s;
+}
+inline const std::string& StartSession::_internal_channel_id() const {
+  return _impl_.channel_id_.Get();
+}
+inline void StartSession::_internal_set_channel_id(const std::string& value) {
+  
+  _impl_.channel_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* StartSession::_internal_mutable_channel_id() {
+  
+  return _impl_.channel_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* StartSession::release_channel_id() {
+  // @@protoc_insertion_point(field_release:aspia.proto.host.StartSession.channel_id)
+  return _impl_.channel_id_.Release();
+}
+inline void StartSession::set_allocated_channel_id(std::string* channel_id) {
+  if (channel_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.channel_id_.SetAllocated(channel_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.channel_id_.IsDefault()) {
+    _impl_.channel_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.host.StartSession.channel_id)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace host
+}  // namespace proto
+}  // namespace aspia
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_host_5fsession_2eproto
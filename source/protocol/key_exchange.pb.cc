@@ -5,243 +5,597 @@
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/port.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/io/zero_copy_stream_impl_lite.h>
-// This is a temporary google only hack
-#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-#include "third_party/protobuf/version.h"
-#endif
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
 namespace aspia {
 namespace proto {
-class HelloMessageDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<HelloMessage>
-      _instance;
-} _HelloMessage_default_instance_;
+PROTOBUF_CONSTEXPR HelloMessage::HelloMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.public_key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.nonce_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.path_token_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.challenge_nonce_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.ciphers_)*/0u
+  , /*decltype(_impl_.chunk_size_)*/0u
+  , /*decltype(_impl_.path_switch_)*/false
+  , /*decltype(_impl_.typed_frames_)*/false
+  , /*decltype(_impl_.batch_frames_)*/false
+  , /*decltype(_impl_.fragment_frames_)*/false
+  , /*decltype(_impl_.datagrams_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct HelloMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HelloMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HelloMessageDefaultTypeInternal() {}
+  union {
+    HelloMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HelloMessageDefaultTypeInternal _HelloMessage_default_instance_;
+PROTOBUF_CONSTEXPR PathMessage::PathMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.addresses_)*/{}
+  , /*decltype(_impl_.token_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.port_)*/0u
+  , /*decltype(_impl_.datagram_port_)*/0u
+  , /*decltype(_impl_.switch_path_)*/false
+  , /*decltype(_impl_.datagram_stop_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PathMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PathMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PathMessageDefaultTypeInternal() {}
+  union {
+    PathMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PathMessageDefaultTypeInternal _PathMessage_default_instance_;
 }  // namespace proto
 }  // namespace aspia
-namespace protobuf_key_5fexchange_2eproto {
-static void InitDefaultsHelloMessage() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::_HelloMessage_default_instance_;
-    new (ptr) ::aspia::proto::HelloMessage();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+namespace aspia {
+namespace proto {
+bool HelloMessage_Cipher_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
   }
-  ::aspia::proto::HelloMessage::InitAsDefaultInstance();
 }
 
-::google::protobuf::internal::SCCInfo<0> scc_info_HelloMessage =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsHelloMessage}, {}};
-
-void InitDefaults() {
-  ::google::protobuf::internal::InitSCC(&scc_info_HelloMessage.base);
+static ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> HelloMessage_Cipher_strings[3] = {};
+
+static const char HelloMessage_Cipher_names[] =
+  "CIPHER_AES256_GCM"
+  "CIPHER_XCHACHA20_POLY1305"
+  "CIPHER_XSALSA20_POLY1305";
+
+static const ::PROTOBUF_NAMESPACE_ID::internal::EnumEntry HelloMessage_Cipher_entries[] = {
+  { {HelloMessage_Cipher_names + 0, 17}, 2 },
+  { {HelloMessage_Cipher_names + 17, 25}, 1 },
+  { {HelloMessage_Cipher_names + 42, 24}, 0 },
+};
+
+static const int HelloMessage_Cipher_entries_by_number[] = {
+  2, // 0 -> CIPHER_XSALSA20_POLY1305
+  1, // 1 -> CIPHER_XCHACHA20_POLY1305
+  0, // 2 -> CIPHER_AES256_GCM
+};
+
+const std::string& HelloMessage_Cipher_Name(
+    HelloMessage_Cipher value) {
+  static const bool dummy =
+      ::PROTOBUF_NAMESPACE_ID::internal::InitializeEnumStrings(
+          HelloMessage_Cipher_entries,
+          HelloMessage_Cipher_entries_by_number,
+          3, HelloMessage_Cipher_strings);
+  (void) dummy;
+  int idx = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumName(
+      HelloMessage_Cipher_entries,
+      HelloMessage_Cipher_entries_by_number,
+      3, value);
+  return idx == -1 ? ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString() :
+                     HelloMessage_Cipher_strings[idx].get();
 }
-
-}  // namespace protobuf_key_5fexchange_2eproto
-namespace aspia {
-namespace proto {
+bool HelloMessage_Cipher_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, HelloMessage_Cipher* value) {
+  int int_value;
+  bool success = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumValue(
+      HelloMessage_Cipher_entries, 3, name, &int_value);
+  if (success) {
+    *value = static_cast<HelloMessage_Cipher>(int_value);
+  }
+  return success;
+}
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr HelloMessage_Cipher HelloMessage::CIPHER_XSALSA20_POLY1305;
+constexpr HelloMessage_Cipher HelloMessage::CIPHER_XCHACHA20_POLY1305;
+constexpr HelloMessage_Cipher HelloMessage::CIPHER_AES256_GCM;
+constexpr HelloMessage_Cipher HelloMessage::Cipher_MIN;
+constexpr HelloMessage_Cipher HelloMessage::Cipher_MAX;
+constexpr int HelloMessage::Cipher_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 
 // ===================================================================
 
-void HelloMessage::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int HelloMessage::kPublicKeyFieldNumber;
-const int HelloMessage::kNonceFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class HelloMessage::_Internal {
+ public:
+};
 
-HelloMessage::HelloMessage()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_key_5fexchange_2eproto::scc_info_HelloMessage.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.HelloMessage)
+HelloMessage::HelloMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.HelloMessage)
 }
 HelloMessage::HelloMessage(const HelloMessage& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  public_key_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.public_key().size() > 0) {
-    public_key_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.public_key_);
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  HelloMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.public_key_){}
+    , decltype(_impl_.nonce_){}
+    , decltype(_impl_.path_token_){}
+    , decltype(_impl_.challenge_nonce_){}
+    , decltype(_impl_.ciphers_){}
+    , decltype(_impl_.chunk_size_){}
+    , decltype(_impl_.path_switch_){}
+    , decltype(_impl_.typed_frames_){}
+    , decltype(_impl_.batch_frames_){}
+    , decltype(_impl_.fragment_frames_){}
+    , decltype(_impl_.datagrams_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.public_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.public_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_public_key().empty()) {
+    _this->_impl_.public_key_.Set(from._internal_public_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.nonce_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.nonce_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_nonce().empty()) {
+    _this->_impl_.nonce_.Set(from._internal_nonce(), 
+      _this->GetArenaForAllocation());
   }
-  nonce_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.nonce().size() > 0) {
-    nonce_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.nonce_);
+  _impl_.path_token_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_token_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_path_token().empty()) {
+    _this->_impl_.path_token_.Set(from._internal_path_token(), 
+      _this->GetArenaForAllocation());
   }
+  _impl_.challenge_nonce_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.challenge_nonce_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_challenge_nonce().empty()) {
+    _this->_impl_.challenge_nonce_.Set(from._internal_challenge_nonce(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.ciphers_, &from._impl_.ciphers_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.datagrams_) -
+    reinterpret_cast<char*>(&_impl_.ciphers_)) + sizeof(_impl_.datagrams_));
   // @@protoc_insertion_point(copy_constructor:aspia.proto.HelloMessage)
 }
 
-void HelloMessage::SharedCtor() {
-  public_key_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  nonce_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void HelloMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.public_key_){}
+    , decltype(_impl_.nonce_){}
+    , decltype(_impl_.path_token_){}
+    , decltype(_impl_.challenge_nonce_){}
+    , decltype(_impl_.ciphers_){0u}
+    , decltype(_impl_.chunk_size_){0u}
+    , decltype(_impl_.path_switch_){false}
+    , decltype(_impl_.typed_frames_){false}
+    , decltype(_impl_.batch_frames_){false}
+    , decltype(_impl_.fragment_frames_){false}
+    , decltype(_impl_.datagrams_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.public_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.public_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.nonce_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.nonce_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.path_token_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_token_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.challenge_nonce_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.challenge_nonce_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 HelloMessage::~HelloMessage() {
   // @@protoc_insertion_point(destructor:aspia.proto.HelloMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void HelloMessage::SharedDtor() {
-  public_key_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  nonce_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void HelloMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.public_key_.Destroy();
+  _impl_.nonce_.Destroy();
+  _impl_.path_token_.Destroy();
+  _impl_.challenge_nonce_.Destroy();
 }
 
 void HelloMessage::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const HelloMessage& HelloMessage::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_key_5fexchange_2eproto::scc_info_HelloMessage.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void HelloMessage::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.HelloMessage)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  public_key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  nonce_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  _internal_metadata_.Clear();
-}
-
-bool HelloMessage::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.HelloMessage)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.public_key_.ClearToEmpty();
+  _impl_.nonce_.ClearToEmpty();
+  _impl_.path_token_.ClearToEmpty();
+  _impl_.challenge_nonce_.ClearToEmpty();
+  ::memset(&_impl_.ciphers_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.datagrams_) -
+      reinterpret_cast<char*>(&_impl_.ciphers_)) + sizeof(_impl_.datagrams_));
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* HelloMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // bytes public_key = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_public_key()));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_public_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // bytes nonce = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_nonce()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_nonce();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 ciphers = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.ciphers_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 chunk_size = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.chunk_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+        continue;
+      // bool path_switch = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.path_switch_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes path_token = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_path_token();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool typed_frames = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.typed_frames_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes challenge_nonce = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          auto str = _internal_mutable_challenge_nonce();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool batch_frames = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.batch_frames_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool fragment_frames = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.fragment_frames_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool datagrams = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _impl_.datagrams_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.HelloMessage)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.HelloMessage)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void HelloMessage::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.HelloMessage)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* HelloMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.HelloMessage)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // bytes public_key = 1;
-  if (this->public_key().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      1, this->public_key(), output);
+  if (!this->_internal_public_key().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_public_key(), target);
   }
 
   // bytes nonce = 2;
-  if (this->nonce().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      2, this->nonce(), output);
+  if (!this->_internal_nonce().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_nonce(), target);
+  }
+
+  // uint32 ciphers = 3;
+  if (this->_internal_ciphers() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_ciphers(), target);
+  }
+
+  // uint32 chunk_size = 4;
+  if (this->_internal_chunk_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_chunk_size(), target);
+  }
+
+  // bool path_switch = 5;
+  if (this->_internal_path_switch() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_path_switch(), target);
+  }
+
+  // bytes path_token = 6;
+  if (!this->_internal_path_token().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        6, this->_internal_path_token(), target);
+  }
+
+  // bool typed_frames = 7;
+  if (this->_internal_typed_frames() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_typed_frames(), target);
+  }
+
+  // bytes challenge_nonce = 8;
+  if (!this->_internal_challenge_nonce().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        8, this->_internal_challenge_nonce(), target);
+  }
+
+  // bool batch_frames = 9;
+  if (this->_internal_batch_frames() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(9, this->_internal_batch_frames(), target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.HelloMessage)
+  // bool fragment_frames = 10;
+  if (this->_internal_fragment_frames() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(10, this->_internal_fragment_frames(), target);
+  }
+
+  // bool datagrams = 11;
+  if (this->_internal_datagrams() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(11, this->_internal_datagrams(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.HelloMessage)
+  return target;
 }
 
 size_t HelloMessage::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.HelloMessage)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // bytes public_key = 1;
-  if (this->public_key().size() > 0) {
+  if (!this->_internal_public_key().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->public_key());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_public_key());
   }
 
   // bytes nonce = 2;
-  if (this->nonce().size() > 0) {
+  if (!this->_internal_nonce().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_nonce());
+  }
+
+  // bytes path_token = 6;
+  if (!this->_internal_path_token().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->nonce());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_path_token());
+  }
+
+  // bytes challenge_nonce = 8;
+  if (!this->_internal_challenge_nonce().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_challenge_nonce());
+  }
+
+  // uint32 ciphers = 3;
+  if (this->_internal_ciphers() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_ciphers());
+  }
+
+  // uint32 chunk_size = 4;
+  if (this->_internal_chunk_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_chunk_size());
+  }
+
+  // bool path_switch = 5;
+  if (this->_internal_path_switch() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool typed_frames = 7;
+  if (this->_internal_typed_frames() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool batch_frames = 9;
+  if (this->_internal_batch_frames() != 0) {
+    total_size += 1 + 1;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  // bool fragment_frames = 10;
+  if (this->_internal_fragment_frames() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool datagrams = 11;
+  if (this->_internal_datagrams() != 0) {
+    total_size += 1 + 1;
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void HelloMessage::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const HelloMessage*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const HelloMessage*>(
+      &from));
 }
 
 void HelloMessage::MergeFrom(const HelloMessage& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.HelloMessage)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  HelloMessage* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.HelloMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.public_key().size() > 0) {
-
-    public_key_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.public_key_);
+  if (!from._internal_public_key().empty()) {
+    _this->_internal_set_public_key(from._internal_public_key());
   }
-  if (from.nonce().size() > 0) {
-
-    nonce_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.nonce_);
+  if (!from._internal_nonce().empty()) {
+    _this->_internal_set_nonce(from._internal_nonce());
+  }
+  if (!from._internal_path_token().empty()) {
+    _this->_internal_set_path_token(from._internal_path_token());
+  }
+  if (!from._internal_challenge_nonce().empty()) {
+    _this->_internal_set_challenge_nonce(from._internal_challenge_nonce());
+  }
+  if (from._internal_ciphers() != 0) {
+    _this->_internal_set_ciphers(from._internal_ciphers());
+  }
+  if (from._internal_chunk_size() != 0) {
+    _this->_internal_set_chunk_size(from._internal_chunk_size());
+  }
+  if (from._internal_path_switch() != 0) {
+    _this->_internal_set_path_switch(from._internal_path_switch());
   }
+  if (from._internal_typed_frames() != 0) {
+    _this->_internal_set_typed_frames(from._internal_typed_frames());
+  }
+  if (from._internal_batch_frames() != 0) {
+    _this->_internal_set_batch_frames(from._internal_batch_frames());
+  }
+  if (from._internal_fragment_frames() != 0) {
+    _this->_internal_set_fragment_frames(from._internal_fragment_frames());
+  }
+  if (from._internal_datagrams() != 0) {
+    _this->_internal_set_datagrams(from._internal_datagrams());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void HelloMessage::CopyFrom(const HelloMessage& from) {
@@ -255,33 +609,400 @@ bool HelloMessage::IsInitialized() const {
   return true;
 }
 
-void HelloMessage::Swap(HelloMessage* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void HelloMessage::InternalSwap(HelloMessage* other) {
   using std::swap;
-  public_key_.Swap(&other->public_key_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  nonce_.Swap(&other->nonce_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.public_key_, lhs_arena,
+      &other->_impl_.public_key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.nonce_, lhs_arena,
+      &other->_impl_.nonce_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.path_token_, lhs_arena,
+      &other->_impl_.path_token_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.challenge_nonce_, lhs_arena,
+      &other->_impl_.challenge_nonce_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(HelloMessage, _impl_.datagrams_)
+      + sizeof(HelloMessage::_impl_.datagrams_)
+      - PROTOBUF_FIELD_OFFSET(HelloMessage, _impl_.ciphers_)>(
+          reinterpret_cast<char*>(&_impl_.ciphers_),
+          reinterpret_cast<char*>(&other->_impl_.ciphers_));
 }
 
-::std::string HelloMessage::GetTypeName() const {
+std::string HelloMessage::GetTypeName() const {
   return "aspia.proto.HelloMessage";
 }
 
 
+// ===================================================================
+
+class PathMessage::_Internal {
+ public:
+};
+
+PathMessage::PathMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.PathMessage)
+}
+PathMessage::PathMessage(const PathMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  PathMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.addresses_){from._impl_.addresses_}
+    , decltype(_impl_.token_){}
+    , decltype(_impl_.port_){}
+    , decltype(_impl_.datagram_port_){}
+    , decltype(_impl_.switch_path_){}
+    , decltype(_impl_.datagram_stop_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.token_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.token_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_token().empty()) {
+    _this->_impl_.token_.Set(from._internal_token(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.port_, &from._impl_.port_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.datagram_stop_) -
+    reinterpret_cast<char*>(&_impl_.port_)) + sizeof(_impl_.datagram_stop_));
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.PathMessage)
+}
+
+inline void PathMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.addresses_){arena}
+    , decltype(_impl_.token_){}
+    , decltype(_impl_.port_){0u}
+    , decltype(_impl_.datagram_port_){0u}
+    , decltype(_impl_.switch_path_){false}
+    , decltype(_impl_.datagram_stop_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.token_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.token_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PathMessage::~PathMessage() {
+  // @@protoc_insertion_point(destructor:aspia.proto.PathMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PathMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.addresses_.~RepeatedPtrField();
+  _impl_.token_.Destroy();
+}
+
+void PathMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PathMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.PathMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.addresses_.Clear();
+  _impl_.token_.ClearToEmpty();
+  ::memset(&_impl_.port_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.datagram_stop_) -
+      reinterpret_cast<char*>(&_impl_.port_)) + sizeof(_impl_.datagram_stop_));
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* PathMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated string addresses = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_addresses();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, nullptr));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 port = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.port_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes token = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_token();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool switch_path = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.switch_path_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 datagram_port = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.datagram_port_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool datagram_stop = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.datagram_stop_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PathMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.PathMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated string addresses = 1;
+  for (int i = 0, n = this->_internal_addresses_size(); i < n; i++) {
+    const auto& s = this->_internal_addresses(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "aspia.proto.PathMessage.addresses");
+    target = stream->WriteString(1, s, target);
+  }
+
+  // uint32 port = 2;
+  if (this->_internal_port() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_port(), target);
+  }
+
+  // bytes token = 3;
+  if (!this->_internal_token().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_token(), target);
+  }
+
+  // bool switch_path = 4;
+  if (this->_internal_switch_path() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_switch_path(), target);
+  }
+
+  // uint32 datagram_port = 5;
+  if (this->_internal_datagram_port() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_datagram_port(), target);
+  }
+
+  // bool datagram_stop = 6;
+  if (this->_internal_datagram_stop() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_datagram_stop(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.PathMessage)
+  return target;
+}
+
+size_t PathMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.PathMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string addresses = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.addresses_.size());
+  for (int i = 0, n = _impl_.addresses_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.addresses_.Get(i));
+  }
+
+  // bytes token = 3;
+  if (!this->_internal_token().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_token());
+  }
+
+  // uint32 port = 2;
+  if (this->_internal_port() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_port());
+  }
+
+  // uint32 datagram_port = 5;
+  if (this->_internal_datagram_port() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_datagram_port());
+  }
+
+  // bool switch_path = 4;
+  if (this->_internal_switch_path() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool datagram_stop = 6;
+  if (this->_internal_datagram_stop() != 0) {
+    total_size += 1 + 1;
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void PathMessage::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const PathMessage*>(
+      &from));
+}
+
+void PathMessage::MergeFrom(const PathMessage& from) {
+  PathMessage* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.PathMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.addresses_.MergeFrom(from._impl_.addresses_);
+  if (!from._internal_token().empty()) {
+    _this->_internal_set_token(from._internal_token());
+  }
+  if (from._internal_port() != 0) {
+    _this->_internal_set_port(from._internal_port());
+  }
+  if (from._internal_datagram_port() != 0) {
+    _this->_internal_set_datagram_port(from._internal_datagram_port());
+  }
+  if (from._internal_switch_path() != 0) {
+    _this->_internal_set_switch_path(from._internal_switch_path());
+  }
+  if (from._internal_datagram_stop() != 0) {
+    _this->_internal_set_datagram_stop(from._internal_datagram_stop());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void PathMessage::CopyFrom(const PathMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.PathMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PathMessage::IsInitialized() const {
+  return true;
+}
+
+void PathMessage::InternalSwap(PathMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.addresses_.InternalSwap(&other->_impl_.addresses_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.token_, lhs_arena,
+      &other->_impl_.token_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PathMessage, _impl_.datagram_stop_)
+      + sizeof(PathMessage::_impl_.datagram_stop_)
+      - PROTOBUF_FIELD_OFFSET(PathMessage, _impl_.port_)>(
+          reinterpret_cast<char*>(&_impl_.port_),
+          reinterpret_cast<char*>(&other->_impl_.port_));
+}
+
+std::string PathMessage::GetTypeName() const {
+  return "aspia.proto.PathMessage";
+}
+
+
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace proto
 }  // namespace aspia
-namespace google {
-namespace protobuf {
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::HelloMessage* Arena::CreateMaybeMessage< ::aspia::proto::HelloMessage >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::HelloMessage >(arena);
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::aspia::proto::HelloMessage*
+Arena::CreateMaybeMessage< ::aspia::proto::HelloMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::HelloMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::aspia::proto::PathMessage*
+Arena::CreateMaybeMessage< ::aspia::proto::PathMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::PathMessage >(arena);
 }
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -1,94 +1,122 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: key_exchange.proto
 
-#ifndef PROTOBUF_INCLUDED_key_5fexchange_2eproto
-#define PROTOBUF_INCLUDED_key_5fexchange_2eproto
+#ifndef GOOGLE_PROTOBUF_INCLUDED_key_5fexchange_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_key_5fexchange_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3006000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3006000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/message_lite.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_util.h>
 // @@protoc_insertion_point(includes)
-#define PROTOBUF_INTERNAL_EXPORT_protobuf_key_5fexchange_2eproto 
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_key_5fexchange_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
 
-namespace protobuf_key_5fexchange_2eproto {
 // Internal implementation detail -- do not use these members.
-struct TableStruct {
-  static const ::google::protobuf::internal::ParseTableField entries[];
-  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
-  static const ::google::protobuf::internal::ParseTable schema[1];
-  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
-  static const ::google::protobuf::internal::SerializationTable serialization_table[];
-  static const ::google::protobuf::uint32 offsets[];
+struct TableStruct_key_5fexchange_2eproto {
+  static const uint32_t offsets[];
 };
-}  // namespace protobuf_key_5fexchange_2eproto
 namespace aspia {
 namespace proto {
 class HelloMessage;
-class HelloMessageDefaultTypeInternal;
+struct HelloMessageDefaultTypeInternal;
 extern HelloMessageDefaultTypeInternal _HelloMessage_default_instance_;
+class PathMessage;
+struct PathMessageDefaultTypeInternal;
+extern PathMessageDefaultTypeInternal _PathMessage_default_instance_;
 }  // namespace proto
 }  // namespace aspia
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 template<> ::aspia::proto::HelloMessage* Arena::CreateMaybeMessage<::aspia::proto::HelloMessage>(Arena*);
-}  // namespace protobuf
-}  // namespace google
+template<> ::aspia::proto::PathMessage* Arena::CreateMaybeMessage<::aspia::proto::PathMessage>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
 namespace aspia {
 namespace proto {
 
+enum HelloMessage_Cipher : int {
+  HelloMessage_Cipher_CIPHER_XSALSA20_POLY1305 = 0,
+  HelloMessage_Cipher_CIPHER_XCHACHA20_POLY1305 = 1,
+  HelloMessage_Cipher_CIPHER_AES256_GCM = 2,
+  HelloMessage_Cipher_HelloMessage_Cipher_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  HelloMessage_Cipher_HelloMessage_Cipher_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool HelloMessage_Cipher_IsValid(int value);
+constexpr HelloMessage_Cipher HelloMessage_Cipher_Cipher_MIN = HelloMessage_Cipher_CIPHER_XSALSA20_POLY1305;
+constexpr HelloMessage_Cipher HelloMessage_Cipher_Cipher_MAX = HelloMessage_Cipher_CIPHER_AES256_GCM;
+constexpr int HelloMessage_Cipher_Cipher_ARRAYSIZE = HelloMessage_Cipher_Cipher_MAX + 1;
+
+const std::string& HelloMessage_Cipher_Name(HelloMessage_Cipher value);
+template<typename T>
+inline const std::string& HelloMessage_Cipher_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, HelloMessage_Cipher>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function HelloMessage_Cipher_Name.");
+  return HelloMessage_Cipher_Name(static_cast<HelloMessage_Cipher>(enum_t_value));
+}
+bool HelloMessage_Cipher_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, HelloMessage_Cipher* value);
 // ===================================================================
 
-class HelloMessage : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.HelloMessage) */ {
+class HelloMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.HelloMessage) */ {
  public:
-  HelloMessage();
-  virtual ~HelloMessage();
+  inline HelloMessage() : HelloMessage(nullptr) {}
+  ~HelloMessage() override;
+  explicit PROTOBUF_CONSTEXPR HelloMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   HelloMessage(const HelloMessage& from);
-
-  inline HelloMessage& operator=(const HelloMessage& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   HelloMessage(HelloMessage&& from) noexcept
     : HelloMessage() {
     *this = ::std::move(from);
   }
 
+  inline HelloMessage& operator=(const HelloMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline HelloMessage& operator=(HelloMessage&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const HelloMessage& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const HelloMessage& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const HelloMessage* internal_default_instance() {
     return reinterpret_cast<const HelloMessage*>(
                &_HelloMessage_default_instance_);
@@ -96,91 +124,455 @@ class HelloMessage : public ::google::protobuf::MessageLite /* @@protoc_insertio
   static constexpr int kIndexInFileMessages =
     0;
 
-  void Swap(HelloMessage* other);
   friend void swap(HelloMessage& a, HelloMessage& b) {
     a.Swap(&b);
   }
+  inline void Swap(HelloMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HelloMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline HelloMessage* New() const final {
-    return CreateMaybeMessage<HelloMessage>(NULL);
-  }
-
-  HelloMessage* New(::google::protobuf::Arena* arena) const final {
+  HelloMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<HelloMessage>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const HelloMessage& from);
   void MergeFrom(const HelloMessage& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(HelloMessage* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.HelloMessage";
   }
+  protected:
+  explicit HelloMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
+  typedef HelloMessage_Cipher Cipher;
+  static constexpr Cipher CIPHER_XSALSA20_POLY1305 =
+    HelloMessage_Cipher_CIPHER_XSALSA20_POLY1305;
+  static constexpr Cipher CIPHER_XCHACHA20_POLY1305 =
+    HelloMessage_Cipher_CIPHER_XCHACHA20_POLY1305;
+  static constexpr Cipher CIPHER_AES256_GCM =
+    HelloMessage_Cipher_CIPHER_AES256_GCM;
+  static inline bool Cipher_IsValid(int value) {
+    return HelloMessage_Cipher_IsValid(value);
+  }
+  static constexpr Cipher Cipher_MIN =
+    HelloMessage_Cipher_Cipher_MIN;
+  static constexpr Cipher Cipher_MAX =
+    HelloMessage_Cipher_Cipher_MAX;
+  static constexpr int Cipher_ARRAYSIZE =
+    HelloMessage_Cipher_Cipher_ARRAYSIZE;
+  template<typename T>
+  static inline const std::string& Cipher_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Cipher>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Cipher_Name.");
+    return HelloMessage_Cipher_Name(enum_t_value);
+  }
+  static inline bool Cipher_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Cipher* value) {
+    return HelloMessage_Cipher_Parse(name, value);
+  }
+
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kPublicKeyFieldNumber = 1,
+    kNonceFieldNumber = 2,
+    kPathTokenFieldNumber = 6,
+    kChallengeNonceFieldNumber = 8,
+    kCiphersFieldNumber = 3,
+    kChunkSizeFieldNumber = 4,
+    kPathSwitchFieldNumber = 5,
+    kTypedFramesFieldNumber = 7,
+    kBatchFramesFieldNumber = 9,
+    kFragmentFramesFieldNumber = 10,
+    kDatagramsFieldNumber = 11,
+  };
   // bytes public_key = 1;
   void clear_public_key();
-  static const int kPublicKeyFieldNumber = 1;
-  const ::std::string& public_key() const;
-  void set_public_key(const ::std::string& value);
-  #if LANG_CXX11
-  void set_public_key(::std::string&& value);
-  #endif
-  void set_public_key(const char* value);
-  void set_public_key(const void* value, size_t size);
-  ::std::string* mutable_public_key();
-  ::std::string* release_public_key();
-  void set_allocated_public_key(::std::string* public_key);
+  const std::string& public_key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_public_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_public_key();
+  PROTOBUF_NODISCARD std::string* release_public_key();
+  void set_allocated_public_key(std::string* public_key);
+  private:
+  const std::string& _internal_public_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_public_key(const std::string& value);
+  std::string* _internal_mutable_public_key();
+  public:
 
   // bytes nonce = 2;
   void clear_nonce();
-  static const int kNonceFieldNumber = 2;
-  const ::std::string& nonce() const;
-  void set_nonce(const ::std::string& value);
-  #if LANG_CXX11
-  void set_nonce(::std::string&& value);
-  #endif
-  void set_nonce(const char* value);
-  void set_nonce(const void* value, size_t size);
-  ::std::string* mutable_nonce();
-  ::std::string* release_nonce();
-  void set_allocated_nonce(::std::string* nonce);
+  const std::string& nonce() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_nonce(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_nonce();
+  PROTOBUF_NODISCARD std::string* release_nonce();
+  void set_allocated_nonce(std::string* nonce);
+  private:
+  const std::string& _internal_nonce() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_nonce(const std::string& value);
+  std::string* _internal_mutable_nonce();
+  public:
+
+  // bytes path_token = 6;
+  void clear_path_token();
+  const std::string& path_token() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path_token(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path_token();
+  PROTOBUF_NODISCARD std::string* release_path_token();
+  void set_allocated_path_token(std::string* path_token);
+  private:
+  const std::string& _internal_path_token() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path_token(const std::string& value);
+  std::string* _internal_mutable_path_token();
+  public:
+
+  // bytes challenge_nonce = 8;
+  void clear_challenge_nonce();
+  const std::string& challenge_nonce() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_challenge_nonce(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_challenge_nonce();
+  PROTOBUF_NODISCARD std::string* release_challenge_nonce();
+  void set_allocated_challenge_nonce(std::string* challenge_nonce);
+  private:
+  const std::string& _internal_challenge_nonce() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_challenge_nonce(const std::string& value);
+  std::string* _internal_mutable_challenge_nonce();
+  public:
+
+  // uint32 ciphers = 3;
+  void clear_ciphers();
+  uint32_t ciphers() const;
+  void set_ciphers(uint32_t value);
+  private:
+  uint32_t _internal_ciphers() const;
+  void _internal_set_ciphers(uint32_t value);
+  public:
+
+  // uint32 chunk_size = 4;
+  void clear_chunk_size();
+  uint32_t chunk_size() const;
+  void set_chunk_size(uint32_t value);
+  private:
+  uint32_t _internal_chunk_size() const;
+  void _internal_set_chunk_size(uint32_t value);
+  public:
+
+  // bool path_switch = 5;
+  void clear_path_switch();
+  bool path_switch() const;
+  void set_path_switch(bool value);
+  private:
+  bool _internal_path_switch() const;
+  void _internal_set_path_switch(bool value);
+  public:
+
+  // bool typed_frames = 7;
+  void clear_typed_frames();
+  bool typed_frames() const;
+  void set_typed_frames(bool value);
+  private:
+  bool _internal_typed_frames() const;
+  void _internal_set_typed_frames(bool value);
+  public:
+
+  // bool batch_frames = 9;
+  void clear_batch_frames();
+  bool batch_frames() const;
+  void set_batch_frames(bool value);
+  private:
+  bool _internal_batch_frames() const;
+  void _internal_set_batch_frames(bool value);
+  public:
+
+  // bool fragment_frames = 10;
+  void clear_fragment_frames();
+  bool fragment_frames() const;
+  void set_fragment_frames(bool value);
+  private:
+  bool _internal_fragment_frames() const;
+  void _internal_set_fragment_frames(bool value);
+  public:
+
+  // bool datagrams = 11;
+  void clear_datagrams();
+  bool datagrams() const;
+  void set_datagrams(bool value);
+  private:
+  bool _internal_datagrams() const;
+  void _internal_set_datagrams(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:aspia.proto.HelloMessage)
  private:
+  class _Internal;
 
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr public_key_;
-  ::google::protobuf::internal::ArenaStringPtr nonce_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_key_5fexchange_2eproto::TableStruct;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr public_key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr nonce_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_token_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr challenge_nonce_;
+    uint32_t ciphers_;
+    uint32_t chunk_size_;
+    bool path_switch_;
+    bool typed_frames_;
+    bool batch_frames_;
+    bool fragment_frames_;
+    bool datagrams_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fexchange_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PathMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.PathMessage) */ {
+ public:
+  inline PathMessage() : PathMessage(nullptr) {}
+  ~PathMessage() override;
+  explicit PROTOBUF_CONSTEXPR PathMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PathMessage(const PathMessage& from);
+  PathMessage(PathMessage&& from) noexcept
+    : PathMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline PathMessage& operator=(const PathMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PathMessage& operator=(PathMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const PathMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PathMessage* internal_default_instance() {
+    return reinterpret_cast<const PathMessage*>(
+               &_PathMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(PathMessage& a, PathMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PathMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PathMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PathMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PathMessage>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const PathMessage& from);
+  void MergeFrom(const PathMessage& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(PathMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.PathMessage";
+  }
+  protected:
+  explicit PathMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAddressesFieldNumber = 1,
+    kTokenFieldNumber = 3,
+    kPortFieldNumber = 2,
+    kDatagramPortFieldNumber = 5,
+    kSwitchPathFieldNumber = 4,
+    kDatagramStopFieldNumber = 6,
+  };
+  // repeated string addresses = 1;
+  int addresses_size() const;
+  private:
+  int _internal_addresses_size() const;
+  public:
+  void clear_addresses();
+  const std::string& addresses(int index) const;
+  std::string* mutable_addresses(int index);
+  void set_addresses(int index, const std::string& value);
+  void set_addresses(int index, std::string&& value);
+  void set_addresses(int index, const char* value);
+  void set_addresses(int index, const char* value, size_t size);
+  std::string* add_addresses();
+  void add_addresses(const std::string& value);
+  void add_addresses(std::string&& value);
+  void add_addresses(const char* value);
+  void add_addresses(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& addresses() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_addresses();
+  private:
+  const std::string& _internal_addresses(int index) const;
+  std::string* _internal_add_addresses();
+  public:
+
+  // bytes token = 3;
+  void clear_token();
+  const std::string& token() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_token(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_token();
+  PROTOBUF_NODISCARD std::string* release_token();
+  void set_allocated_token(std::string* token);
+  private:
+  const std::string& _internal_token() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_token(const std::string& value);
+  std::string* _internal_mutable_token();
+  public:
+
+  // uint32 port = 2;
+  void clear_port();
+  uint32_t port() const;
+  void set_port(uint32_t value);
+  private:
+  uint32_t _internal_port() const;
+  void _internal_set_port(uint32_t value);
+  public:
+
+  // uint32 datagram_port = 5;
+  void clear_datagram_port();
+  uint32_t datagram_port() const;
+  void set_datagram_port(uint32_t value);
+  private:
+  uint32_t _internal_datagram_port() const;
+  void _internal_set_datagram_port(uint32_t value);
+  public:
+
+  // bool switch_path = 4;
+  void clear_switch_path();
+  bool switch_path() const;
+  void set_switch_path(bool value);
+  private:
+  bool _internal_switch_path() const;
+  void _internal_set_switch_path(bool value);
+  public:
+
+  // bool datagram_stop = 6;
+  void clear_datagram_stop();
+  bool datagram_stop() const;
+  void set_datagram_stop(bool value);
+  private:
+  bool _internal_datagram_stop() const;
+  void _internal_set_datagram_stop(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.PathMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> addresses_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr token_;
+    uint32_t port_;
+    uint32_t datagram_port_;
+    bool switch_path_;
+    bool datagram_stop_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fexchange_2eproto;
 };
 // ===================================================================
 
@@ -195,119 +587,571 @@ class HelloMessage : public ::google::protobuf::MessageLite /* @@protoc_insertio
 
 // bytes public_key = 1;
 inline void HelloMessage::clear_public_key() {
-  public_key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.public_key_.ClearToEmpty();
 }
-inline const ::std::string& HelloMessage::public_key() const {
+inline const std::string& HelloMessage::public_key() const {
   // @@protoc_insertion_point(field_get:aspia.proto.HelloMessage.public_key)
-  return public_key_.GetNoArena();
+  return _internal_public_key();
 }
-inline void HelloMessage::set_public_key(const ::std::string& value) {
-  
-  public_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HelloMessage::set_public_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.public_key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:aspia.proto.HelloMessage.public_key)
 }
-#if LANG_CXX11
-inline void HelloMessage::set_public_key(::std::string&& value) {
-  
-  public_key_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.HelloMessage.public_key)
+inline std::string* HelloMessage::mutable_public_key() {
+  std::string* _s = _internal_mutable_public_key();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.HelloMessage.public_key)
+  return _s;
 }
-#endif
-inline void HelloMessage::set_public_key(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  public_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.HelloMessage.public_key)
+inline const std::string& HelloMessage::_internal_public_key() const {
+  return _impl_.public_key_.Get();
 }
-inline void HelloMessage::set_public_key(const void* value, size_t size) {
+inline void HelloMessage::_internal_set_public_key(const std::string& value) {
   
-  public_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.HelloMessage.public_key)
+  _impl_.public_key_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* HelloMessage::mutable_public_key() {
+inline std::string* HelloMessage::_internal_mutable_public_key() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.HelloMessage.public_key)
-  return public_key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.public_key_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* HelloMessage::release_public_key() {
+inline std::string* HelloMessage::release_public_key() {
   // @@protoc_insertion_point(field_release:aspia.proto.HelloMessage.public_key)
-  
-  return public_key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.public_key_.Release();
 }
-inline void HelloMessage::set_allocated_public_key(::std::string* public_key) {
-  if (public_key != NULL) {
+inline void HelloMessage::set_allocated_public_key(std::string* public_key) {
+  if (public_key != nullptr) {
     
   } else {
     
   }
-  public_key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), public_key);
+  _impl_.public_key_.SetAllocated(public_key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.public_key_.IsDefault()) {
+    _impl_.public_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.HelloMessage.public_key)
 }
 
 // bytes nonce = 2;
 inline void HelloMessage::clear_nonce() {
-  nonce_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.nonce_.ClearToEmpty();
 }
-inline const ::std::string& HelloMessage::nonce() const {
+inline const std::string& HelloMessage::nonce() const {
   // @@protoc_insertion_point(field_get:aspia.proto.HelloMessage.nonce)
-  return nonce_.GetNoArena();
+  return _internal_nonce();
 }
-inline void HelloMessage::set_nonce(const ::std::string& value) {
-  
-  nonce_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HelloMessage::set_nonce(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.nonce_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:aspia.proto.HelloMessage.nonce)
 }
-#if LANG_CXX11
-inline void HelloMessage::set_nonce(::std::string&& value) {
+inline std::string* HelloMessage::mutable_nonce() {
+  std::string* _s = _internal_mutable_nonce();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.HelloMessage.nonce)
+  return _s;
+}
+inline const std::string& HelloMessage::_internal_nonce() const {
+  return _impl_.nonce_.Get();
+}
+inline void HelloMessage::_internal_set_nonce(const std::string& value) {
   
-  nonce_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.HelloMessage.nonce)
+  _impl_.nonce_.Set(value, GetArenaForAllocation());
 }
-#endif
-inline void HelloMessage::set_nonce(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
+inline std::string* HelloMessage::_internal_mutable_nonce() {
   
-  nonce_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.HelloMessage.nonce)
+  return _impl_.nonce_.Mutable(GetArenaForAllocation());
+}
+inline std::string* HelloMessage::release_nonce() {
+  // @@protoc_insertion_point(field_release:aspia.proto.HelloMessage.nonce)
+  return _impl_.nonce_.Release();
 }
-inline void HelloMessage::set_nonce(const void* value, size_t size) {
+inline void HelloMessage::set_allocated_nonce(std::string* nonce) {
+  if (nonce != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.nonce_.SetAllocated(nonce, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.nonce_.IsDefault()) {
+    _impl_.nonce_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.HelloMessage.nonce)
+}
+
+// uint32 ciphers = 3;
+inline void HelloMessage::clear_ciphers() {
+  _impl_.ciphers_ = 0u;
+}
+inline uint32_t HelloMessage::_internal_ciphers() const {
+  return _impl_.ciphers_;
+}
+inline uint32_t HelloMessage::ciphers() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.HelloMessage.ciphers)
+  return _internal_ciphers();
+}
+inline void HelloMessage::_internal_set_ciphers(uint32_t value) {
   
-  nonce_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.HelloMessage.nonce)
+  _impl_.ciphers_ = value;
+}
+inline void HelloMessage::set_ciphers(uint32_t value) {
+  _internal_set_ciphers(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.HelloMessage.ciphers)
+}
+
+// uint32 chunk_size = 4;
+inline void HelloMessage::clear_chunk_size() {
+  _impl_.chunk_size_ = 0u;
+}
+inline uint32_t HelloMessage::_internal_chunk_size() const {
+  return _impl_.chunk_size_;
+}
+inline uint32_t HelloMessage::chunk_size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.HelloMessage.chunk_size)
+  return _internal_chunk_size();
 }
-inline ::std::string* HelloMessage::mutable_nonce() {
+inline void HelloMessage::_internal_set_chunk_size(uint32_t value) {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.HelloMessage.nonce)
-  return nonce_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.chunk_size_ = value;
 }
-inline ::std::string* HelloMessage::release_nonce() {
-  // @@protoc_insertion_point(field_release:aspia.proto.HelloMessage.nonce)
+inline void HelloMessage::set_chunk_size(uint32_t value) {
+  _internal_set_chunk_size(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.HelloMessage.chunk_size)
+}
+
+// bool path_switch = 5;
+inline void HelloMessage::clear_path_switch() {
+  _impl_.path_switch_ = false;
+}
+inline bool HelloMessage::_internal_path_switch() const {
+  return _impl_.path_switch_;
+}
+inline bool HelloMessage::path_switch() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.HelloMessage.path_switch)
+  return _internal_path_switch();
+}
+inline void HelloMessage::_internal_set_path_switch(bool value) {
   
-  return nonce_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.path_switch_ = value;
 }
-inline void HelloMessage::set_allocated_nonce(::std::string* nonce) {
-  if (nonce != NULL) {
+inline void HelloMessage::set_path_switch(bool value) {
+  _internal_set_path_switch(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.HelloMessage.path_switch)
+}
+
+// bytes path_token = 6;
+inline void HelloMessage::clear_path_token() {
+  _impl_.path_token_.ClearToEmpty();
+}
+inline const std::string& HelloMessage::path_token() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.HelloMessage.path_token)
+  return _internal_path_token();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HelloMessage::set_path_token(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.path_token_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.HelloMessage.path_token)
+}
+inline std::string* HelloMessage::mutable_path_token() {
+  std::string* _s = _internal_mutable_path_token();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.HelloMessage.path_token)
+  return _s;
+}
+inline const std::string& HelloMessage::_internal_path_token() const {
+  return _impl_.path_token_.Get();
+}
+inline void HelloMessage::_internal_set_path_token(const std::string& value) {
+  
+  _impl_.path_token_.Set(value, GetArenaForAllocation());
+}
+inline std::string* HelloMessage::_internal_mutable_path_token() {
+  
+  return _impl_.path_token_.Mutable(GetArenaForAllocation());
+}
+inline std::string* HelloMessage::release_path_token() {
+  // @@protoc_insertion_point(field_release:aspia.proto.HelloMessage.path_token)
+  return _impl_.path_token_.Release();
+}
+inline void HelloMessage::set_allocated_path_token(std::string* path_token) {
+  if (path_token != nullptr) {
     
   } else {
     
   }
-  nonce_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), nonce);
-  // @@protoc_insertion_point(field_set_allocated:aspia.proto.HelloMessage.nonce)
+  _impl_.path_token_.SetAllocated(path_token, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_token_.IsDefault()) {
+    _impl_.path_token_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.HelloMessage.path_token)
+}
+
+// bool typed_frames = 7;
+inline void HelloMessage::clear_typed_frames() {
+  _impl_.typed_frames_ = false;
+}
+inline bool HelloMessage::_internal_typed_frames() const {
+  return _impl_.typed_frames_;
+}
+inline bool HelloMessage::typed_frames() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.HelloMessage.typed_frames)
+  return _internal_typed_frames();
+}
+inline void HelloMessage::_internal_set_typed_frames(bool value) {
+  
+  _impl_.typed_frames_ = value;
+}
+inline void HelloMessage::set_typed_frames(bool value) {
+  _internal_set_typed_frames(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.HelloMessage.typed_frames)
+}
+
+// bytes challenge_nonce = 8;
+inline void HelloMessage::clear_challenge_nonce() {
+  _impl_.challenge_nonce_.ClearToEmpty();
+}
+inline const std::string& HelloMessage::challenge_nonce() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.HelloMessage.challenge_nonce)
+  return _internal_challenge_nonce();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HelloMessage::set_challenge_nonce(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.challenge_nonce_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.HelloMessage.challenge_nonce)
+}
+inline std::string* HelloMessage::mutable_challenge_nonce() {
+  std::string* _s = _internal_mutable_challenge_nonce();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.HelloMessage.challenge_nonce)
+  return _s;
+}
+inline const std::string& HelloMessage::_internal_challenge_nonce() const {
+  return _impl_.challenge_nonce_.Get();
+}
+inline void HelloMessage::_internal_set_challenge_nonce(const std::string& value) {
+  
+  _impl_.challenge_nonce_.Set(value, GetArenaForAllocation());
+}
+inline std::string* HelloMessage::_internal_mutable_challenge_nonce() {
+  
+  return _impl_.challenge_nonce_.Mutable(GetArenaForAllocation());
+}
+inline std::string* HelloMessage::release_challenge_nonce() {
+  // @@protoc_insertion_point(field_release:aspia.proto.HelloMessage.challenge_nonce)
+  return _impl_.challenge_nonce_.Release();
+}
+inline void HelloMessage::set_allocated_challenge_nonce(std::string* challenge_nonce) {
+  if (challenge_nonce != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.challenge_nonce_.SetAllocated(challenge_nonce, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.challenge_nonce_.IsDefault()) {
+    _impl_.challenge_nonce_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.HelloMessage.challenge_nonce)
+}
+
+// bool batch_frames = 9;
+inline void HelloMessage::clear_batch_frames() {
+  _impl_.batch_frames_ = false;
+}
+inline bool HelloMessage::_internal_batch_frames() const {
+  return _impl_.batch_frames_;
+}
+inline bool HelloMessage::batch_frames() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.HelloMessage.batch_frames)
+  return _internal_batch_frames();
+}
+inline void HelloMessage::_internal_set_batch_frames(bool value) {
+  
+  _impl_.batch_frames_ = value;
+}
+inline void HelloMessage::set_batch_frames(bool value) {
+  _internal_set_batch_frames(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.HelloMessage.batch_frames)
+}
+
+// bool fragment_frames = 10;
+inline void HelloMessage::clear_fragment_frames() {
+  _impl_.fragment_frames_ = false;
+}
+inline bool HelloMessage::_internal_fragment_frames() const {
+  return _impl_.fragment_frames_;
+}
+inline bool HelloMessage::fragment_frames() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.HelloMessage.fragment_frames)
+  return _internal_fragment_frames();
+}
+inline void HelloMessage::_internal_set_fragment_frames(bool value) {
+  
+  _impl_.fragment_frames_ = value;
+}
+inline void HelloMessage::set_fragment_frames(bool value) {
+  _internal_set_fragment_frames(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.HelloMessage.fragment_frames)
+}
+
+// bool datagrams = 11;
+inline void HelloMessage::clear_datagrams() {
+  _impl_.datagrams_ = false;
+}
+inline bool HelloMessage::_internal_datagrams() const {
+  return _impl_.datagrams_;
+}
+inline bool HelloMessage::datagrams() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.HelloMessage.datagrams)
+  return _internal_datagrams();
+}
+inline void HelloMessage::_internal_set_datagrams(bool value) {
+  
+  _impl_.datagrams_ = value;
+}
+inline void HelloMessage::set_datagrams(bool value) {
+  _internal_set_datagrams(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.HelloMessage.datagrams)
+}
+
+// -------------------------------------------------------------------
+
+// PathMessage
+
+// repeated string addresses = 1;
+inline int PathMessage::_internal_addresses_size() const {
+  return _impl_.addresses_.size();
+}
+inline int PathMessage::addresses_size() const {
+  return _internal_addresses_size();
+}
+inline void PathMessage::clear_addresses() {
+  _impl_.addresses_.Clear();
+}
+inline std::string* PathMessage::add_addresses() {
+  std::string* _s = _internal_add_addresses();
+  // @@protoc_insertion_point(field_add_mutable:aspia.proto.PathMessage.addresses)
+  return _s;
+}
+inline const std::string& PathMessage::_internal_addresses(int index) const {
+  return _impl_.addresses_.Get(index);
+}
+inline const std::string& PathMessage::addresses(int index) const {
+  // @@protoc_insertion_point(field_get:aspia.proto.PathMessage.addresses)
+  return _internal_addresses(index);
+}
+inline std::string* PathMessage::mutable_addresses(int index) {
+  // @@protoc_insertion_point(field_mutable:aspia.proto.PathMessage.addresses)
+  return _impl_.addresses_.Mutable(index);
+}
+inline void PathMessage::set_addresses(int index, const std::string& value) {
+  _impl_.addresses_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.PathMessage.addresses)
+}
+inline void PathMessage::set_addresses(int index, std::string&& value) {
+  _impl_.addresses_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:aspia.proto.PathMessage.addresses)
+}
+inline void PathMessage::set_addresses(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.addresses_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:aspia.proto.PathMessage.addresses)
+}
+inline void PathMessage::set_addresses(int index, const char* value, size_t size) {
+  _impl_.addresses_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:aspia.proto.PathMessage.addresses)
+}
+inline std::string* PathMessage::_internal_add_addresses() {
+  return _impl_.addresses_.Add();
+}
+inline void PathMessage::add_addresses(const std::string& value) {
+  _impl_.addresses_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:aspia.proto.PathMessage.addresses)
+}
+inline void PathMessage::add_addresses(std::string&& value) {
+  _impl_.addresses_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:aspia.proto.PathMessage.addresses)
+}
+inline void PathMessage::add_addresses(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.addresses_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:aspia.proto.PathMessage.addresses)
+}
+inline void PathMessage::add_addresses(const char* value, size_t size) {
+  _impl_.addresses_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:aspia.proto.PathMessage.addresses)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+PathMessage::addresses() const {
+  // @@protoc_insertion_point(field_list:aspia.proto.PathMessage.addresses)
+  return _impl_.addresses_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+PathMessage::mutable_addresses() {
+  // @@protoc_insertion_point(field_mutable_list:aspia.proto.PathMessage.addresses)
+  return &_impl_.addresses_;
+}
+
+// uint32 port = 2;
+inline void PathMessage::clear_port() {
+  _impl_.port_ = 0u;
+}
+inline uint32_t PathMessage::_internal_port() const {
+  return _impl_.port_;
+}
+inline uint32_t PathMessage::port() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.PathMessage.port)
+  return _internal_port();
+}
+inline void PathMessage::_internal_set_port(uint32_t value) {
+  
+  _impl_.port_ = value;
+}
+inline void PathMessage::set_port(uint32_t value) {
+  _internal_set_port(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.PathMessage.port)
+}
+
+// bytes token = 3;
+inline void PathMessage::clear_token() {
+  _impl_.token_.ClearToEmpty();
+}
+inline const std::string& PathMessage::token() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.PathMessage.token)
+  return _internal_token();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PathMessage::set_token(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.token_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.PathMessage.token)
+}
+inline std::string* PathMessage::mutable_token() {
+  std::string* _s = _internal_mutable_token();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.PathMessage.token)
+  return _s;
+}
+inline const std::string& PathMessage::_internal_token() const {
+  return _impl_.token_.Get();
+}
+inline void PathMessage::_internal_set_token(const std::string& value) {
+  
+  _impl_.token_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PathMessage::_internal_mutable_token() {
+  
+  return _impl_.token_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PathMessage::release_token() {
+  // @@protoc_insertion_point(field_release:aspia.proto.PathMessage.token)
+  return _impl_.token_.Release();
+}
+inline void PathMessage::set_allocated_token(std::string* token) {
+  if (token != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.token_.SetAllocated(token, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.token_.IsDefault()) {
+    _impl_.token_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.PathMessage.token)
+}
+
+// bool switch_path = 4;
+inline void PathMessage::clear_switch_path() {
+  _impl_.switch_path_ = false;
+}
+inline bool PathMessage::_internal_switch_path() const {
+  return _impl_.switch_path_;
+}
+inline bool PathMessage::switch_path() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.PathMessage.switch_path)
+  return _internal_switch_path();
+}
+inline void PathMessage::_internal_set_switch_path(bool value) {
+  
+  _impl_.switch_path_ = value;
+}
+inline void PathMessage::set_switch_path(bool value) {
+  _internal_set_switch_path(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.PathMessage.switch_path)
+}
+
+// uint32 datagram_port = 5;
+inline void PathMessage::clear_datagram_port() {
+  _impl_.datagram_port_ = 0u;
+}
+inline uint32_t PathMessage::_internal_datagram_port() const {
+  return _impl_.datagram_port_;
+}
+inline uint32_t PathMessage::datagram_port() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.PathMessage.datagram_port)
+  return _internal_datagram_port();
+}
+inline void PathMessage::_internal_set_datagram_port(uint32_t value) {
+  
+  _impl_.datagram_port_ = value;
+}
+inline void PathMessage::set_datagram_port(uint32_t value) {
+  _internal_set_datagram_port(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.PathMessage.datagram_port)
+}
+
+// bool datagram_stop = 6;
+inline void PathMessage::clear_datagram_stop() {
+  _impl_.datagram_stop_ = false;
+}
+inline bool PathMessage::_internal_datagram_stop() const {
+  return _impl_.datagram_stop_;
+}
+inline bool PathMessage::datagram_stop() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.PathMessage.datagram_stop)
+  return _internal_datagram_stop();
+}
+inline void PathMessage::_internal_set_datagram_stop(bool value) {
+  
+  _impl_.datagram_stop_ = value;
+}
+inline void PathMessage::set_datagram_stop(bool value) {
+  _internal_set_datagram_stop(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.PathMessage.datagram_stop)
 }
 
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace proto
 }  // namespace aspia
 
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::aspia::proto::HelloMessage_Cipher> : ::std::true_type {};
+
+PROTOBUF_NAMESPACE_CLOSE
+
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_INCLUDED_key_5fexchange_2eproto
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_key_5fexchange_2eproto
@@ -5,429 +5,394 @@
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/port.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/io/zero_copy_stream_impl_lite.h>
-// This is a temporary google only hack
-#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-#include "third_party/protobuf/version.h"
-#endif
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-namespace protobuf_notifier_2eproto {
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_notifier_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_KillSession;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_notifier_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_Session;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_notifier_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_SessionClose;
-}  // namespace protobuf_notifier_2eproto
 namespace aspia {
 namespace proto {
 namespace notifier {
-class SessionDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<Session>
-      _instance;
-} _Session_default_instance_;
-class SessionCloseDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<SessionClose>
-      _instance;
-} _SessionClose_default_instance_;
-class KillSessionDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<KillSession>
-      _instance;
-} _KillSession_default_instance_;
-class NotifierToServiceDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<NotifierToService>
-      _instance;
-} _NotifierToService_default_instance_;
-class ServiceToNotifierDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<ServiceToNotifier>
-      _instance;
-} _ServiceToNotifier_default_instance_;
+PROTOBUF_CONSTEXPR Session::Session(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.uuid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.remote_address_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.session_type_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SessionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SessionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SessionDefaultTypeInternal() {}
+  union {
+    Session _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SessionDefaultTypeInternal _Session_default_instance_;
+PROTOBUF_CONSTEXPR SessionClose::SessionClose(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.uuid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SessionCloseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SessionCloseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SessionCloseDefaultTypeInternal() {}
+  union {
+    SessionClose _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SessionCloseDefaultTypeInternal _SessionClose_default_instance_;
+PROTOBUF_CONSTEXPR KillSession::KillSession(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.uuid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct KillSessionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR KillSessionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~KillSessionDefaultTypeInternal() {}
+  union {
+    KillSession _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 KillSessionDefaultTypeInternal _KillSession_default_instance_;
+PROTOBUF_CONSTEXPR NotifierToService::NotifierToService(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.kill_session_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct NotifierToServiceDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NotifierToServiceDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NotifierToServiceDefaultTypeInternal() {}
+  union {
+    NotifierToService _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NotifierToServiceDefaultTypeInternal _NotifierToService_default_instance_;
+PROTOBUF_CONSTEXPR ServiceToNotifier::ServiceToNotifier(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.session_)*/nullptr
+  , /*decltype(_impl_.session_close_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ServiceToNotifierDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServiceToNotifierDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServiceToNotifierDefaultTypeInternal() {}
+  union {
+    ServiceToNotifier _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServiceToNotifierDefaultTypeInternal _ServiceToNotifier_default_instance_;
 }  // namespace notifier
 }  // namespace proto
 }  // namespace aspia
-namespace protobuf_notifier_2eproto {
-static void InitDefaultsSession() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::notifier::_Session_default_instance_;
-    new (ptr) ::aspia::proto::notifier::Session();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::notifier::Session::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_Session =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsSession}, {}};
-
-static void InitDefaultsSessionClose() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::notifier::_SessionClose_default_instance_;
-    new (ptr) ::aspia::proto::notifier::SessionClose();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::notifier::SessionClose::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_SessionClose =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsSessionClose}, {}};
-
-static void InitDefaultsKillSession() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::notifier::_KillSession_default_instance_;
-    new (ptr) ::aspia::proto::notifier::KillSession();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::notifier::KillSession::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_KillSession =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsKillSession}, {}};
-
-static void InitDefaultsNotifierToService() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::notifier::_NotifierToService_default_instance_;
-    new (ptr) ::aspia::proto::notifier::NotifierToService();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::notifier::NotifierToService::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<1> scc_info_NotifierToService =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsNotifierToService}, {
-      &protobuf_notifier_2eproto::scc_info_KillSession.base,}};
-
-static void InitDefaultsServiceToNotifier() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::notifier::_ServiceToNotifier_default_instance_;
-    new (ptr) ::aspia::proto::notifier::ServiceToNotifier();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::notifier::ServiceToNotifier::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<2> scc_info_ServiceToNotifier =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 2, InitDefaultsServiceToNotifier}, {
-      &protobuf_notifier_2eproto::scc_info_Session.base,
-      &protobuf_notifier_2eproto::scc_info_SessionClose.base,}};
-
-void InitDefaults() {
-  ::google::protobuf::internal::InitSCC(&scc_info_Session.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_SessionClose.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_KillSession.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_NotifierToService.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_ServiceToNotifier.base);
-}
-
-}  // namespace protobuf_notifier_2eproto
 namespace aspia {
 namespace proto {
 namespace notifier {
 
 // ===================================================================
 
-void Session::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Session::kUuidFieldNumber;
-const int Session::kRemoteAddressFieldNumber;
-const int Session::kUsernameFieldNumber;
-const int Session::kSessionTypeFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class Session::_Internal {
+ public:
+};
 
-Session::Session()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_notifier_2eproto::scc_info_Session.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.notifier.Session)
+Session::Session(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.notifier.Session)
 }
 Session::Session(const Session& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  uuid_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.uuid().size() > 0) {
-    uuid_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.uuid_);
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  Session* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.uuid_){}
+    , decltype(_impl_.remote_address_){}
+    , decltype(_impl_.username_){}
+    , decltype(_impl_.session_type_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.uuid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_uuid().empty()) {
+    _this->_impl_.uuid_.Set(from._internal_uuid(), 
+      _this->GetArenaForAllocation());
   }
-  remote_address_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.remote_address().size() > 0) {
-    remote_address_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.remote_address_);
+  _impl_.remote_address_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.remote_address_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_remote_address().empty()) {
+    _this->_impl_.remote_address_.Set(from._internal_remote_address(), 
+      _this->GetArenaForAllocation());
   }
-  username_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.username().size() > 0) {
-    username_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.username_);
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_username().empty()) {
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
   }
-  session_type_ = from.session_type_;
+  _this->_impl_.session_type_ = from._impl_.session_type_;
   // @@protoc_insertion_point(copy_constructor:aspia.proto.notifier.Session)
 }
 
-void Session::SharedCtor() {
-  uuid_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  remote_address_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  username_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  session_type_ = 0;
+inline void Session::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.uuid_){}
+    , decltype(_impl_.remote_address_){}
+    , decltype(_impl_.username_){}
+    , decltype(_impl_.session_type_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.uuid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.remote_address_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.remote_address_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Session::~Session() {
   // @@protoc_insertion_point(destructor:aspia.proto.notifier.Session)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Session::SharedDtor() {
-  uuid_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  remote_address_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  username_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void Session::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.uuid_.Destroy();
+  _impl_.remote_address_.Destroy();
+  _impl_.username_.Destroy();
 }
 
 void Session::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const Session& Session::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_notifier_2eproto::scc_info_Session.base);
-  return *internal_default_instance();
-}
-
 
 void Session::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.notifier.Session)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  uuid_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  remote_address_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  username_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  session_type_ = 0;
-  _internal_metadata_.Clear();
-}
-
-bool Session::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.notifier.Session)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.uuid_.ClearToEmpty();
+  _impl_.remote_address_.ClearToEmpty();
+  _impl_.username_.ClearToEmpty();
+  _impl_.session_type_ = 0;
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* Session::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string uuid = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_uuid()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->uuid().data(), static_cast<int>(this->uuid().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "aspia.proto.notifier.Session.uuid"));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_uuid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string remote_address = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_remote_address()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->remote_address().data(), static_cast<int>(this->remote_address().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "aspia.proto.notifier.Session.remote_address"));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_remote_address();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string username = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_username()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->username().data(), static_cast<int>(this->username().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "aspia.proto.notifier.Session.username"));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_username();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .aspia.proto.auth.SessionType session_type = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_session_type(static_cast< ::aspia::proto::auth::SessionType >(value));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_session_type(static_cast<::aspia::proto::auth::SessionType>(val));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.notifier.Session)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.notifier.Session)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void Session::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.notifier.Session)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* Session::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.notifier.Session)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string uuid = 1;
-  if (this->uuid().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->uuid().data(), static_cast<int>(this->uuid().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_uuid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_uuid().data(), static_cast<int>(this->_internal_uuid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "aspia.proto.notifier.Session.uuid");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->uuid(), output);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_uuid(), target);
   }
 
   // string remote_address = 2;
-  if (this->remote_address().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->remote_address().data(), static_cast<int>(this->remote_address().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_remote_address().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_remote_address().data(), static_cast<int>(this->_internal_remote_address().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "aspia.proto.notifier.Session.remote_address");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->remote_address(), output);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_remote_address(), target);
   }
 
   // string username = 3;
-  if (this->username().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->username().data(), static_cast<int>(this->username().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_username().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "aspia.proto.notifier.Session.username");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      3, this->username(), output);
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_username(), target);
   }
 
   // .aspia.proto.auth.SessionType session_type = 4;
-  if (this->session_type() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      4, this->session_type(), output);
+  if (this->_internal_session_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_session_type(), target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.notifier.Session)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.notifier.Session)
+  return target;
 }
 
 size_t Session::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.notifier.Session)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // string uuid = 1;
-  if (this->uuid().size() > 0) {
+  if (!this->_internal_uuid().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->uuid());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_uuid());
   }
 
   // string remote_address = 2;
-  if (this->remote_address().size() > 0) {
+  if (!this->_internal_remote_address().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->remote_address());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_remote_address());
   }
 
   // string username = 3;
-  if (this->username().size() > 0) {
+  if (!this->_internal_username().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->username());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_username());
   }
 
   // .aspia.proto.auth.SessionType session_type = 4;
-  if (this->session_type() != 0) {
+  if (this->_internal_session_type() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->session_type());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_session_type());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void Session::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const Session*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const Session*>(
+      &from));
 }
 
 void Session::MergeFrom(const Session& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.notifier.Session)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  Session* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.notifier.Session)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.uuid().size() > 0) {
-
-    uuid_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.uuid_);
+  if (!from._internal_uuid().empty()) {
+    _this->_internal_set_uuid(from._internal_uuid());
   }
-  if (from.remote_address().size() > 0) {
-
-    remote_address_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.remote_address_);
+  if (!from._internal_remote_address().empty()) {
+    _this->_internal_set_remote_address(from._internal_remote_address());
   }
-  if (from.username().size() > 0) {
-
-    username_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.username_);
+  if (!from._internal_username().empty()) {
+    _this->_internal_set_username(from._internal_username());
   }
-  if (from.session_type() != 0) {
-    set_session_type(from.session_type());
+  if (from._internal_session_type() != 0) {
+    _this->_internal_set_session_type(from._internal_session_type());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void Session::CopyFrom(const Session& from) {
@@ -441,192 +406,207 @@ bool Session::IsInitialized() const {
   return true;
 }
 
-void Session::Swap(Session* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void Session::InternalSwap(Session* other) {
   using std::swap;
-  uuid_.Swap(&other->uuid_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  remote_address_.Swap(&other->remote_address_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  username_.Swap(&other->username_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(session_type_, other->session_type_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-}
-
-::std::string Session::GetTypeName() const {
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.uuid_, lhs_arena,
+      &other->_impl_.uuid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.remote_address_, lhs_arena,
+      &other->_impl_.remote_address_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+  swap(_impl_.session_type_, other->_impl_.session_type_);
+}
+
+std::string Session::GetTypeName() const {
   return "aspia.proto.notifier.Session";
 }
 
 
 // ===================================================================
 
-void SessionClose::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int SessionClose::kUuidFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class SessionClose::_Internal {
+ public:
+};
 
-SessionClose::SessionClose()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_notifier_2eproto::scc_info_SessionClose.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.notifier.SessionClose)
+SessionClose::SessionClose(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.notifier.SessionClose)
 }
 SessionClose::SessionClose(const SessionClose& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  uuid_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.uuid().size() > 0) {
-    uuid_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.uuid_);
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  SessionClose* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.uuid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.uuid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_uuid().empty()) {
+    _this->_impl_.uuid_.Set(from._internal_uuid(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:aspia.proto.notifier.SessionClose)
 }
 
-void SessionClose::SharedCtor() {
-  uuid_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void SessionClose::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.uuid_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.uuid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 SessionClose::~SessionClose() {
   // @@protoc_insertion_point(destructor:aspia.proto.notifier.SessionClose)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void SessionClose::SharedDtor() {
-  uuid_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void SessionClose::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.uuid_.Destroy();
 }
 
 void SessionClose::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const SessionClose& SessionClose::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_notifier_2eproto::scc_info_SessionClose.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void SessionClose::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.notifier.SessionClose)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  uuid_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  _internal_metadata_.Clear();
-}
-
-bool SessionClose::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.notifier.SessionClose)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.uuid_.ClearToEmpty();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* SessionClose::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string uuid = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_uuid()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->uuid().data(), static_cast<int>(this->uuid().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "aspia.proto.notifier.SessionClose.uuid"));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_uuid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.notifier.SessionClose)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.notifier.SessionClose)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void SessionClose::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.notifier.SessionClose)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* SessionClose::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.notifier.SessionClose)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string uuid = 1;
-  if (this->uuid().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->uuid().data(), static_cast<int>(this->uuid().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_uuid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_uuid().data(), static_cast<int>(this->_internal_uuid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "aspia.proto.notifier.SessionClose.uuid");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->uuid(), output);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_uuid(), target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.notifier.SessionClose)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.notifier.SessionClose)
+  return target;
 }
 
 size_t SessionClose::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.notifier.SessionClose)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // string uuid = 1;
-  if (this->uuid().size() > 0) {
+  if (!this->_internal_uuid().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->uuid());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_uuid());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void SessionClose::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const SessionClose*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const SessionClose*>(
+      &from));
 }
 
 void SessionClose::MergeFrom(const SessionClose& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.notifier.SessionClose)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  SessionClose* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.notifier.SessionClose)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.uuid().size() > 0) {
-
-    uuid_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.uuid_);
+  if (!from._internal_uuid().empty()) {
+    _this->_internal_set_uuid(from._internal_uuid());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void SessionClose::CopyFrom(const SessionClose& from) {
@@ -640,187 +620,198 @@ bool SessionClose::IsInitialized() const {
   return true;
 }
 
-void SessionClose::Swap(SessionClose* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void SessionClose::InternalSwap(SessionClose* other) {
   using std::swap;
-  uuid_.Swap(&other->uuid_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.uuid_, lhs_arena,
+      &other->_impl_.uuid_, rhs_arena
+  );
 }
 
-::std::string SessionClose::GetTypeName() const {
+std::string SessionClose::GetTypeName() const {
   return "aspia.proto.notifier.SessionClose";
 }
 
 
 // ===================================================================
 
-void KillSession::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int KillSession::kUuidFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class KillSession::_Internal {
+ public:
+};
 
-KillSession::KillSession()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_notifier_2eproto::scc_info_KillSession.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.notifier.KillSession)
+KillSession::KillSession(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.notifier.KillSession)
 }
 KillSession::KillSession(const KillSession& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  uuid_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.uuid().size() > 0) {
-    uuid_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.uuid_);
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  KillSession* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.uuid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.uuid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_uuid().empty()) {
+    _this->_impl_.uuid_.Set(from._internal_uuid(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:aspia.proto.notifier.KillSession)
 }
 
-void KillSession::SharedCtor() {
-  uuid_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void KillSession::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.uuid_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.uuid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 KillSession::~KillSession() {
   // @@protoc_insertion_point(destructor:aspia.proto.notifier.KillSession)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void KillSession::SharedDtor() {
-  uuid_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void KillSession::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.uuid_.Destroy();
 }
 
 void KillSession::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const KillSession& KillSession::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_notifier_2eproto::scc_info_KillSession.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void KillSession::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.notifier.KillSession)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  uuid_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  _internal_metadata_.Clear();
-}
-
-bool KillSession::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.notifier.KillSession)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.uuid_.ClearToEmpty();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* KillSession::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string uuid = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_uuid()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->uuid().data(), static_cast<int>(this->uuid().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "aspia.proto.notifier.KillSession.uuid"));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_uuid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.notifier.KillSession)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.notifier.KillSession)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void KillSession::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.notifier.KillSession)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* KillSession::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.notifier.KillSession)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string uuid = 1;
-  if (this->uuid().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->uuid().data(), static_cast<int>(this->uuid().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_uuid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_uuid().data(), static_cast<int>(this->_internal_uuid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "aspia.proto.notifier.KillSession.uuid");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->uuid(), output);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_uuid(), target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.notifier.KillSession)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.notifier.KillSession)
+  return target;
 }
 
 size_t KillSession::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.notifier.KillSession)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // string uuid = 1;
-  if (this->uuid().size() > 0) {
+  if (!this->_internal_uuid().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->uuid());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_uuid());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void KillSession::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const KillSession*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const KillSession*>(
+      &from));
 }
 
 void KillSession::MergeFrom(const KillSession& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.notifier.KillSession)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  KillSession* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.notifier.KillSession)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.uuid().size() > 0) {
-
-    uuid_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.uuid_);
+  if (!from._internal_uuid().empty()) {
+    _this->_internal_set_uuid(from._internal_uuid());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void KillSession::CopyFrom(const KillSession& from) {
@@ -834,184 +825,193 @@ bool KillSession::IsInitialized() const {
   return true;
 }
 
-void KillSession::Swap(KillSession* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void KillSession::InternalSwap(KillSession* other) {
   using std::swap;
-  uuid_.Swap(&other->uuid_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.uuid_, lhs_arena,
+      &other->_impl_.uuid_, rhs_arena
+  );
 }
 
-::std::string KillSession::GetTypeName() const {
+std::string KillSession::GetTypeName() const {
   return "aspia.proto.notifier.KillSession";
 }
 
 
 // ===================================================================
 
-void NotifierToService::InitAsDefaultInstance() {
-  ::aspia::proto::notifier::_NotifierToService_default_instance_._instance.get_mutable()->kill_session_ = const_cast< ::aspia::proto::notifier::KillSession*>(
-      ::aspia::proto::notifier::KillSession::internal_default_instance());
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int NotifierToService::kKillSessionFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class NotifierToService::_Internal {
+ public:
+  static const ::aspia::proto::notifier::KillSession& kill_session(const NotifierToService* msg);
+};
 
-NotifierToService::NotifierToService()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_notifier_2eproto::scc_info_NotifierToService.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.notifier.NotifierToService)
+const ::aspia::proto::notifier::KillSession&
+NotifierToService::_Internal::kill_session(const NotifierToService* msg) {
+  return *msg->_impl_.kill_session_;
+}
+NotifierToService::NotifierToService(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.notifier.NotifierToService)
 }
 NotifierToService::NotifierToService(const NotifierToService& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.has_kill_session()) {
-    kill_session_ = new ::aspia::proto::notifier::KillSession(*from.kill_session_);
-  } else {
-    kill_session_ = NULL;
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  NotifierToService* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.kill_session_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  if (from._internal_has_kill_session()) {
+    _this->_impl_.kill_session_ = new ::aspia::proto::notifier::KillSession(*from._impl_.kill_session_);
   }
   // @@protoc_insertion_point(copy_constructor:aspia.proto.notifier.NotifierToService)
 }
 
-void NotifierToService::SharedCtor() {
-  kill_session_ = NULL;
+inline void NotifierToService::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.kill_session_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 NotifierToService::~NotifierToService() {
   // @@protoc_insertion_point(destructor:aspia.proto.notifier.NotifierToService)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void NotifierToService::SharedDtor() {
-  if (this != internal_default_instance()) delete kill_session_;
+inline void NotifierToService::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.kill_session_;
 }
 
 void NotifierToService::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const NotifierToService& NotifierToService::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_notifier_2eproto::scc_info_NotifierToService.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void NotifierToService::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.notifier.NotifierToService)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaNoVirtual() == NULL && kill_session_ != NULL) {
-    delete kill_session_;
+  if (GetArenaForAllocation() == nullptr && _impl_.kill_session_ != nullptr) {
+    delete _impl_.kill_session_;
   }
-  kill_session_ = NULL;
-  _internal_metadata_.Clear();
-}
-
-bool NotifierToService::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.notifier.NotifierToService)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.kill_session_ = nullptr;
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* NotifierToService::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // .aspia.proto.notifier.KillSession kill_session = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_kill_session()));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_kill_session(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.notifier.NotifierToService)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.notifier.NotifierToService)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void NotifierToService::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.notifier.NotifierToService)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* NotifierToService::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.notifier.NotifierToService)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .aspia.proto.notifier.KillSession kill_session = 1;
-  if (this->has_kill_session()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      1, this->_internal_kill_session(), output);
+  if (this->_internal_has_kill_session()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::kill_session(this),
+        _Internal::kill_session(this).GetCachedSize(), target, stream);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.notifier.NotifierToService)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.notifier.NotifierToService)
+  return target;
 }
 
 size_t NotifierToService::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.notifier.NotifierToService)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // .aspia.proto.notifier.KillSession kill_session = 1;
-  if (this->has_kill_session()) {
+  if (this->_internal_has_kill_session()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *kill_session_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.kill_session_);
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void NotifierToService::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const NotifierToService*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const NotifierToService*>(
+      &from));
 }
 
 void NotifierToService::MergeFrom(const NotifierToService& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.notifier.NotifierToService)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  NotifierToService* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.notifier.NotifierToService)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.has_kill_session()) {
-    mutable_kill_session()->::aspia::proto::notifier::KillSession::MergeFrom(from.kill_session());
+  if (from._internal_has_kill_session()) {
+    _this->_internal_mutable_kill_session()->::aspia::proto::notifier::KillSession::MergeFrom(
+        from._internal_kill_session());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void NotifierToService::CopyFrom(const NotifierToService& from) {
@@ -1025,226 +1025,229 @@ bool NotifierToService::IsInitialized() const {
   return true;
 }
 
-void NotifierToService::Swap(NotifierToService* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void NotifierToService::InternalSwap(NotifierToService* other) {
   using std::swap;
-  swap(kill_session_, other->kill_session_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.kill_session_, other->_impl_.kill_session_);
 }
 
-::std::string NotifierToService::GetTypeName() const {
+std::string NotifierToService::GetTypeName() const {
   return "aspia.proto.notifier.NotifierToService";
 }
 
 
 // ===================================================================
 
-void ServiceToNotifier::InitAsDefaultInstance() {
-  ::aspia::proto::notifier::_ServiceToNotifier_default_instance_._instance.get_mutable()->session_ = const_cast< ::aspia::proto::notifier::Session*>(
-      ::aspia::proto::notifier::Session::internal_default_instance());
-  ::aspia::proto::notifier::_ServiceToNotifier_default_instance_._instance.get_mutable()->session_close_ = const_cast< ::aspia::proto::notifier::SessionClose*>(
-      ::aspia::proto::notifier::SessionClose::internal_default_instance());
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int ServiceToNotifier::kSessionFieldNumber;
-const int ServiceToNotifier::kSessionCloseFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class ServiceToNotifier::_Internal {
+ public:
+  static const ::aspia::proto::notifier::Session& session(const ServiceToNotifier* msg);
+  static const ::aspia::proto::notifier::SessionClose& session_close(const ServiceToNotifier* msg);
+};
 
-ServiceToNotifier::ServiceToNotifier()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_notifier_2eproto::scc_info_ServiceToNotifier.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.notifier.ServiceToNotifier)
+const ::aspia::proto::notifier::Session&
+ServiceToNotifier::_Internal::session(const ServiceToNotifier* msg) {
+  return *msg->_impl_.session_;
+}
+const ::aspia::proto::notifier::SessionClose&
+ServiceToNotifier::_Internal::session_close(const ServiceToNotifier* msg) {
+  return *msg->_impl_.session_close_;
+}
+ServiceToNotifier::ServiceToNotifier(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.notifier.ServiceToNotifier)
 }
 ServiceToNotifier::ServiceToNotifier(const ServiceToNotifier& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.has_session()) {
-    session_ = new ::aspia::proto::notifier::Session(*from.session_);
-  } else {
-    session_ = NULL;
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  ServiceToNotifier* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.session_){nullptr}
+    , decltype(_impl_.session_close_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  if (from._internal_has_session()) {
+    _this->_impl_.session_ = new ::aspia::proto::notifier::Session(*from._impl_.session_);
   }
-  if (from.has_session_close()) {
-    session_close_ = new ::aspia::proto::notifier::SessionClose(*from.session_close_);
-  } else {
-    session_close_ = NULL;
+  if (from._internal_has_session_close()) {
+    _this->_impl_.session_close_ = new ::aspia::proto::notifier::SessionClose(*from._impl_.session_close_);
   }
   // @@protoc_insertion_point(copy_constructor:aspia.proto.notifier.ServiceToNotifier)
 }
 
-void ServiceToNotifier::SharedCtor() {
-  ::memset(&session_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&session_close_) -
-      reinterpret_cast<char*>(&session_)) + sizeof(session_close_));
+inline void ServiceToNotifier::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.session_){nullptr}
+    , decltype(_impl_.session_close_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 ServiceToNotifier::~ServiceToNotifier() {
   // @@protoc_insertion_point(destructor:aspia.proto.notifier.ServiceToNotifier)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void ServiceToNotifier::SharedDtor() {
-  if (this != internal_default_instance()) delete session_;
-  if (this != internal_default_instance()) delete session_close_;
+inline void ServiceToNotifier::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.session_;
+  if (this != internal_default_instance()) delete _impl_.session_close_;
 }
 
 void ServiceToNotifier::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const ServiceToNotifier& ServiceToNotifier::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_notifier_2eproto::scc_info_ServiceToNotifier.base);
-  return *internal_default_instance();
-}
-
 
 void ServiceToNotifier::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.notifier.ServiceToNotifier)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaNoVirtual() == NULL && session_ != NULL) {
-    delete session_;
+  if (GetArenaForAllocation() == nullptr && _impl_.session_ != nullptr) {
+    delete _impl_.session_;
   }
-  session_ = NULL;
-  if (GetArenaNoVirtual() == NULL && session_close_ != NULL) {
-    delete session_close_;
+  _impl_.session_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.session_close_ != nullptr) {
+    delete _impl_.session_close_;
   }
-  session_close_ = NULL;
-  _internal_metadata_.Clear();
-}
-
-bool ServiceToNotifier::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.notifier.ServiceToNotifier)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.session_close_ = nullptr;
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* ServiceToNotifier::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // .aspia.proto.notifier.Session session = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_session()));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_session(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .aspia.proto.notifier.SessionClose session_close = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_session_close()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_session_close(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.notifier.ServiceToNotifier)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.notifier.ServiceToNotifier)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void ServiceToNotifier::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.notifier.ServiceToNotifier)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* ServiceToNotifier::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.notifier.ServiceToNotifier)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .aspia.proto.notifier.Session session = 1;
-  if (this->has_session()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      1, this->_internal_session(), output);
+  if (this->_internal_has_session()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::session(this),
+        _Internal::session(this).GetCachedSize(), target, stream);
   }
 
   // .aspia.proto.notifier.SessionClose session_close = 2;
-  if (this->has_session_close()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      2, this->_internal_session_close(), output);
+  if (this->_internal_has_session_close()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::session_close(this),
+        _Internal::session_close(this).GetCachedSize(), target, stream);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.notifier.ServiceToNotifier)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.notifier.ServiceToNotifier)
+  return target;
 }
 
 size_t ServiceToNotifier::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.notifier.ServiceToNotifier)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // .aspia.proto.notifier.Session session = 1;
-  if (this->has_session()) {
+  if (this->_internal_has_session()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *session_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.session_);
   }
 
   // .aspia.proto.notifier.SessionClose session_close = 2;
-  if (this->has_session_close()) {
+  if (this->_internal_has_session_close()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *session_close_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.session_close_);
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void ServiceToNotifier::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const ServiceToNotifier*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const ServiceToNotifier*>(
+      &from));
 }
 
 void ServiceToNotifier::MergeFrom(const ServiceToNotifier& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.notifier.ServiceToNotifier)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  ServiceToNotifier* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.notifier.ServiceToNotifier)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.has_session()) {
-    mutable_session()->::aspia::proto::notifier::Session::MergeFrom(from.session());
+  if (from._internal_has_session()) {
+    _this->_internal_mutable_session()->::aspia::proto::notifier::Session::MergeFrom(
+        from._internal_session());
   }
-  if (from.has_session_close()) {
-    mutable_session_close()->::aspia::proto::notifier::SessionClose::MergeFrom(from.session_close());
+  if (from._internal_has_session_close()) {
+    _this->_internal_mutable_session_close()->::aspia::proto::notifier::SessionClose::MergeFrom(
+        from._internal_session_close());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void ServiceToNotifier::CopyFrom(const ServiceToNotifier& from) {
@@ -1258,18 +1261,18 @@ bool ServiceToNotifier::IsInitialized() const {
   return true;
 }
 
-void ServiceToNotifier::Swap(ServiceToNotifier* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void ServiceToNotifier::InternalSwap(ServiceToNotifier* other) {
   using std::swap;
-  swap(session_, other->session_);
-  swap(session_close_, other->session_close_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ServiceToNotifier, _impl_.session_close_)
+      + sizeof(ServiceToNotifier::_impl_.session_close_)
+      - PROTOBUF_FIELD_OFFSET(ServiceToNotifier, _impl_.session_)>(
+          reinterpret_cast<char*>(&_impl_.session_),
+          reinterpret_cast<char*>(&other->_impl_.session_));
 }
 
-::std::string ServiceToNotifier::GetTypeName() const {
+std::string ServiceToNotifier::GetTypeName() const {
   return "aspia.proto.notifier.ServiceToNotifier";
 }
 
@@ -1278,24 +1281,28 @@ void ServiceToNotifier::InternalSwap(ServiceToNotifier* other) {
 }  // namespace notifier
 }  // namespace proto
 }  // namespace aspia
-namespace google {
-namespace protobuf {
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::notifier::Session* Arena::CreateMaybeMessage< ::aspia::proto::notifier::Session >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::notifier::Session >(arena);
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::aspia::proto::notifier::Session*
+Arena::CreateMaybeMessage< ::aspia::proto::notifier::Session >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::notifier::Session >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::notifier::SessionClose* Arena::CreateMaybeMessage< ::aspia::proto::notifier::SessionClose >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::notifier::SessionClose >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::notifier::SessionClose*
+Arena::CreateMaybeMessage< ::aspia::proto::notifier::SessionClose >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::notifier::SessionClose >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::notifier::KillSession* Arena::CreateMaybeMessage< ::aspia::proto::notifier::KillSession >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::notifier::KillSession >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::notifier::KillSession*
+Arena::CreateMaybeMessage< ::aspia::proto::notifier::KillSession >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::notifier::KillSession >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::notifier::NotifierToService* Arena::CreateMaybeMessage< ::aspia::proto::notifier::NotifierToService >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::notifier::NotifierToService >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::notifier::NotifierToService*
+Arena::CreateMaybeMessage< ::aspia::proto::notifier::NotifierToService >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::notifier::NotifierToService >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::notifier::ServiceToNotifier* Arena::CreateMaybeMessage< ::aspia::proto::notifier::ServiceToNotifier >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::notifier::ServiceToNotifier >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::notifier::ServiceToNotifier*
+Arena::CreateMaybeMessage< ::aspia::proto::notifier::ServiceToNotifier >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::notifier::ServiceToNotifier >(arena);
 }
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -1,114 +1,115 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: notifier.proto
 
-#ifndef PROTOBUF_INCLUDED_notifier_2eproto
-#define PROTOBUF_INCLUDED_notifier_2eproto
+#ifndef GOOGLE_PROTOBUF_INCLUDED_notifier_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_notifier_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3006000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3006000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/message_lite.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include "authorization.pb.h"
 // @@protoc_insertion_point(includes)
-#define PROTOBUF_INTERNAL_EXPORT_protobuf_notifier_2eproto 
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_notifier_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
 
-namespace protobuf_notifier_2eproto {
 // Internal implementation detail -- do not use these members.
-struct TableStruct {
-  static const ::google::protobuf::internal::ParseTableField entries[];
-  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
-  static const ::google::protobuf::internal::ParseTable schema[5];
-  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
-  static const ::google::protobuf::internal::SerializationTable serialization_table[];
-  static const ::google::protobuf::uint32 offsets[];
+struct TableStruct_notifier_2eproto {
+  static const uint32_t offsets[];
 };
-}  // namespace protobuf_notifier_2eproto
 namespace aspia {
 namespace proto {
 namespace notifier {
 class KillSession;
-class KillSessionDefaultTypeInternal;
+struct KillSessionDefaultTypeInternal;
 extern KillSessionDefaultTypeInternal _KillSession_default_instance_;
 class NotifierToService;
-class NotifierToServiceDefaultTypeInternal;
+struct NotifierToServiceDefaultTypeInternal;
 extern NotifierToServiceDefaultTypeInternal _NotifierToService_default_instance_;
 class ServiceToNotifier;
-class ServiceToNotifierDefaultTypeInternal;
+struct ServiceToNotifierDefaultTypeInternal;
 extern ServiceToNotifierDefaultTypeInternal _ServiceToNotifier_default_instance_;
 class Session;
-class SessionDefaultTypeInternal;
+struct SessionDefaultTypeInternal;
 extern SessionDefaultTypeInternal _Session_default_instance_;
 class SessionClose;
-class SessionCloseDefaultTypeInternal;
+struct SessionCloseDefaultTypeInternal;
 extern SessionCloseDefaultTypeInternal _SessionClose_default_instance_;
 }  // namespace notifier
 }  // namespace proto
 }  // namespace aspia
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 template<> ::aspia::proto::notifier::KillSession* Arena::CreateMaybeMessage<::aspia::proto::notifier::KillSession>(Arena*);
 template<> ::aspia::proto::notifier::NotifierToService* Arena::CreateMaybeMessage<::aspia::proto::notifier::NotifierToService>(Arena*);
 template<> ::aspia::proto::notifier::ServiceToNotifier* Arena::CreateMaybeMessage<::aspia::proto::notifier::ServiceToNotifier>(Arena*);
 template<> ::aspia::proto::notifier::Session* Arena::CreateMaybeMessage<::aspia::proto::notifier::Session>(Arena*);
 template<> ::aspia::proto::notifier::SessionClose* Arena::CreateMaybeMessage<::aspia::proto::notifier::SessionClose>(Arena*);
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 namespace aspia {
 namespace proto {
 namespace notifier {
 
 // ===================================================================
 
-class Session : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.notifier.Session) */ {
+class Session final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.notifier.Session) */ {
  public:
-  Session();
-  virtual ~Session();
+  inline Session() : Session(nullptr) {}
+  ~Session() override;
+  explicit PROTOBUF_CONSTEXPR Session(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Session(const Session& from);
-
-  inline Session& operator=(const Session& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   Session(Session&& from) noexcept
     : Session() {
     *this = ::std::move(from);
   }
 
+  inline Session& operator=(const Session& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline Session& operator=(Session&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const Session& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const Session& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const Session* internal_default_instance() {
     return reinterpret_cast<const Session*>(
                &_Session_default_instance_);
@@ -116,145 +117,177 @@ class Session : public ::google::protobuf::MessageLite /* @@protoc_insertion_poi
   static constexpr int kIndexInFileMessages =
     0;
 
-  void Swap(Session* other);
   friend void swap(Session& a, Session& b) {
     a.Swap(&b);
   }
+  inline void Swap(Session* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Session* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Session* New() const final {
-    return CreateMaybeMessage<Session>(NULL);
-  }
-
-  Session* New(::google::protobuf::Arena* arena) const final {
+  Session* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Session>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const Session& from);
   void MergeFrom(const Session& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(Session* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.notifier.Session";
   }
+  protected:
+  explicit Session(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kUuidFieldNumber = 1,
+    kRemoteAddressFieldNumber = 2,
+    kUsernameFieldNumber = 3,
+    kSessionTypeFieldNumber = 4,
+  };
   // string uuid = 1;
   void clear_uuid();
-  static const int kUuidFieldNumber = 1;
-  const ::std::string& uuid() const;
-  void set_uuid(const ::std::string& value);
-  #if LANG_CXX11
-  void set_uuid(::std::string&& value);
-  #endif
-  void set_uuid(const char* value);
-  void set_uuid(const char* value, size_t size);
-  ::std::string* mutable_uuid();
-  ::std::string* release_uuid();
-  void set_allocated_uuid(::std::string* uuid);
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
 
   // string remote_address = 2;
   void clear_remote_address();
-  static const int kRemoteAddressFieldNumber = 2;
-  const ::std::string& remote_address() const;
-  void set_remote_address(const ::std::string& value);
-  #if LANG_CXX11
-  void set_remote_address(::std::string&& value);
-  #endif
-  void set_remote_address(const char* value);
-  void set_remote_address(const char* value, size_t size);
-  ::std::string* mutable_remote_address();
-  ::std::string* release_remote_address();
-  void set_allocated_remote_address(::std::string* remote_address);
+  const std::string& remote_address() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_remote_address(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_remote_address();
+  PROTOBUF_NODISCARD std::string* release_remote_address();
+  void set_allocated_remote_address(std::string* remote_address);
+  private:
+  const std::string& _internal_remote_address() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_remote_address(const std::string& value);
+  std::string* _internal_mutable_remote_address();
+  public:
 
   // string username = 3;
   void clear_username();
-  static const int kUsernameFieldNumber = 3;
-  const ::std::string& username() const;
-  void set_username(const ::std::string& value);
-  #if LANG_CXX11
-  void set_username(::std::string&& value);
-  #endif
-  void set_username(const char* value);
-  void set_username(const char* value, size_t size);
-  ::std::string* mutable_username();
-  ::std::string* release_username();
-  void set_allocated_username(::std::string* username);
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
 
   // .aspia.proto.auth.SessionType session_type = 4;
   void clear_session_type();
-  static const int kSessionTypeFieldNumber = 4;
   ::aspia::proto::auth::SessionType session_type() const;
   void set_session_type(::aspia::proto::auth::SessionType value);
+  private:
+  ::aspia::proto::auth::SessionType _internal_session_type() const;
+  void _internal_set_session_type(::aspia::proto::auth::SessionType value);
+  public:
 
   // @@protoc_insertion_point(class_scope:aspia.proto.notifier.Session)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr uuid_;
-  ::google::protobuf::internal::ArenaStringPtr remote_address_;
-  ::google::protobuf::internal::ArenaStringPtr username_;
-  int session_type_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_notifier_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr remote_address_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    int session_type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_notifier_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SessionClose : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.notifier.SessionClose) */ {
+class SessionClose final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.notifier.SessionClose) */ {
  public:
-  SessionClose();
-  virtual ~SessionClose();
+  inline SessionClose() : SessionClose(nullptr) {}
+  ~SessionClose() override;
+  explicit PROTOBUF_CONSTEXPR SessionClose(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SessionClose(const SessionClose& from);
-
-  inline SessionClose& operator=(const SessionClose& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   SessionClose(SessionClose&& from) noexcept
     : SessionClose() {
     *this = ::std::move(from);
   }
 
+  inline SessionClose& operator=(const SessionClose& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline SessionClose& operator=(SessionClose&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const SessionClose& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const SessionClose& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const SessionClose* internal_default_instance() {
     return reinterpret_cast<const SessionClose*>(
                &_SessionClose_default_instance_);
@@ -262,108 +295,134 @@ class SessionClose : public ::google::protobuf::MessageLite /* @@protoc_insertio
   static constexpr int kIndexInFileMessages =
     1;
 
-  void Swap(SessionClose* other);
   friend void swap(SessionClose& a, SessionClose& b) {
     a.Swap(&b);
   }
+  inline void Swap(SessionClose* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SessionClose* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline SessionClose* New() const final {
-    return CreateMaybeMessage<SessionClose>(NULL);
-  }
-
-  SessionClose* New(::google::protobuf::Arena* arena) const final {
+  SessionClose* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<SessionClose>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const SessionClose& from);
   void MergeFrom(const SessionClose& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(SessionClose* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.notifier.SessionClose";
   }
+  protected:
+  explicit SessionClose(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kUuidFieldNumber = 1,
+  };
   // string uuid = 1;
   void clear_uuid();
-  static const int kUuidFieldNumber = 1;
-  const ::std::string& uuid() const;
-  void set_uuid(const ::std::string& value);
-  #if LANG_CXX11
-  void set_uuid(::std::string&& value);
-  #endif
-  void set_uuid(const char* value);
-  void set_uuid(const char* value, size_t size);
-  ::std::string* mutable_uuid();
-  ::std::string* release_uuid();
-  void set_allocated_uuid(::std::string* uuid);
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
 
   // @@protoc_insertion_point(class_scope:aspia.proto.notifier.SessionClose)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr uuid_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_notifier_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_notifier_2eproto;
 };
 // -------------------------------------------------------------------
 
-class KillSession : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.notifier.KillSession) */ {
+class KillSession final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.notifier.KillSession) */ {
  public:
-  KillSession();
-  virtual ~KillSession();
+  inline KillSession() : KillSession(nullptr) {}
+  ~KillSession() override;
+  explicit PROTOBUF_CONSTEXPR KillSession(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   KillSession(const KillSession& from);
-
-  inline KillSession& operator=(const KillSession& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   KillSession(KillSession&& from) noexcept
     : KillSession() {
     *this = ::std::move(from);
   }
 
+  inline KillSession& operator=(const KillSession& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline KillSession& operator=(KillSession&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const KillSession& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const KillSession& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const KillSession* internal_default_instance() {
     return reinterpret_cast<const KillSession*>(
                &_KillSession_default_instance_);
@@ -371,108 +430,134 @@ class KillSession : public ::google::protobuf::MessageLite /* @@protoc_insertion
   static constexpr int kIndexInFileMessages =
     2;
 
-  void Swap(KillSession* other);
   friend void swap(KillSession& a, KillSession& b) {
     a.Swap(&b);
   }
+  inline void Swap(KillSession* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(KillSession* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline KillSession* New() const final {
-    return CreateMaybeMessage<KillSession>(NULL);
-  }
-
-  KillSession* New(::google::protobuf::Arena* arena) const final {
+  KillSession* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<KillSession>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const KillSession& from);
   void MergeFrom(const KillSession& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(KillSession* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.notifier.KillSession";
   }
+  protected:
+  explicit KillSession(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kUuidFieldNumber = 1,
+  };
   // string uuid = 1;
   void clear_uuid();
-  static const int kUuidFieldNumber = 1;
-  const ::std::string& uuid() const;
-  void set_uuid(const ::std::string& value);
-  #if LANG_CXX11
-  void set_uuid(::std::string&& value);
-  #endif
-  void set_uuid(const char* value);
-  void set_uuid(const char* value, size_t size);
-  ::std::string* mutable_uuid();
-  ::std::string* release_uuid();
-  void set_allocated_uuid(::std::string* uuid);
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
 
   // @@protoc_insertion_point(class_scope:aspia.proto.notifier.KillSession)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr uuid_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_notifier_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_notifier_2eproto;
 };
 // -------------------------------------------------------------------
 
-class NotifierToService : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.notifier.NotifierToService) */ {
+class NotifierToService final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.notifier.NotifierToService) */ {
  public:
-  NotifierToService();
-  virtual ~NotifierToService();
+  inline NotifierToService() : NotifierToService(nullptr) {}
+  ~NotifierToService() override;
+  explicit PROTOBUF_CONSTEXPR NotifierToService(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   NotifierToService(const NotifierToService& from);
-
-  inline NotifierToService& operator=(const NotifierToService& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   NotifierToService(NotifierToService&& from) noexcept
     : NotifierToService() {
     *this = ::std::move(from);
   }
 
+  inline NotifierToService& operator=(const NotifierToService& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline NotifierToService& operator=(NotifierToService&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const NotifierToService& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const NotifierToService& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const NotifierToService* internal_default_instance() {
     return reinterpret_cast<const NotifierToService*>(
                &_NotifierToService_default_instance_);
@@ -480,106 +565,138 @@ class NotifierToService : public ::google::protobuf::MessageLite /* @@protoc_ins
   static constexpr int kIndexInFileMessages =
     3;
 
-  void Swap(NotifierToService* other);
   friend void swap(NotifierToService& a, NotifierToService& b) {
     a.Swap(&b);
   }
+  inline void Swap(NotifierToService* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NotifierToService* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline NotifierToService* New() const final {
-    return CreateMaybeMessage<NotifierToService>(NULL);
-  }
-
-  NotifierToService* New(::google::protobuf::Arena* arena) const final {
+  NotifierToService* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<NotifierToService>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const NotifierToService& from);
   void MergeFrom(const NotifierToService& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(NotifierToService* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.notifier.NotifierToService";
   }
+  protected:
+  explicit NotifierToService(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kKillSessionFieldNumber = 1,
+  };
   // .aspia.proto.notifier.KillSession kill_session = 1;
   bool has_kill_session() const;
-  void clear_kill_session();
-  static const int kKillSessionFieldNumber = 1;
   private:
-  const ::aspia::proto::notifier::KillSession& _internal_kill_session() const;
+  bool _internal_has_kill_session() const;
   public:
+  void clear_kill_session();
   const ::aspia::proto::notifier::KillSession& kill_session() const;
-  ::aspia::proto::notifier::KillSession* release_kill_session();
+  PROTOBUF_NODISCARD ::aspia::proto::notifier::KillSession* release_kill_session();
   ::aspia::proto::notifier::KillSession* mutable_kill_session();
   void set_allocated_kill_session(::aspia::proto::notifier::KillSession* kill_session);
+  private:
+  const ::aspia::proto::notifier::KillSession& _internal_kill_session() const;
+  ::aspia::proto::notifier::KillSession* _internal_mutable_kill_session();
+  public:
+  void unsafe_arena_set_allocated_kill_session(
+      ::aspia::proto::notifier::KillSession* kill_session);
+  ::aspia::proto::notifier::KillSession* unsafe_arena_release_kill_session();
 
   // @@protoc_insertion_point(class_scope:aspia.proto.notifier.NotifierToService)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::aspia::proto::notifier::KillSession* kill_session_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_notifier_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::aspia::proto::notifier::KillSession* kill_session_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_notifier_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ServiceToNotifier : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.notifier.ServiceToNotifier) */ {
+class ServiceToNotifier final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.notifier.ServiceToNotifier) */ {
  public:
-  ServiceToNotifier();
-  virtual ~ServiceToNotifier();
+  inline ServiceToNotifier() : ServiceToNotifier(nullptr) {}
+  ~ServiceToNotifier() override;
+  explicit PROTOBUF_CONSTEXPR ServiceToNotifier(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ServiceToNotifier(const ServiceToNotifier& from);
-
-  inline ServiceToNotifier& operator=(const ServiceToNotifier& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   ServiceToNotifier(ServiceToNotifier&& from) noexcept
     : ServiceToNotifier() {
     *this = ::std::move(from);
   }
 
+  inline ServiceToNotifier& operator=(const ServiceToNotifier& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline ServiceToNotifier& operator=(ServiceToNotifier&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ServiceToNotifier& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ServiceToNotifier& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const ServiceToNotifier* internal_default_instance() {
     return reinterpret_cast<const ServiceToNotifier*>(
                &_ServiceToNotifier_default_instance_);
@@ -587,87 +704,121 @@ class ServiceToNotifier : public ::google::protobuf::MessageLite /* @@protoc_ins
   static constexpr int kIndexInFileMessages =
     4;
 
-  void Swap(ServiceToNotifier* other);
   friend void swap(ServiceToNotifier& a, ServiceToNotifier& b) {
     a.Swap(&b);
   }
+  inline void Swap(ServiceToNotifier* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServiceToNotifier* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline ServiceToNotifier* New() const final {
-    return CreateMaybeMessage<ServiceToNotifier>(NULL);
-  }
-
-  ServiceToNotifier* New(::google::protobuf::Arena* arena) const final {
+  ServiceToNotifier* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ServiceToNotifier>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const ServiceToNotifier& from);
   void MergeFrom(const ServiceToNotifier& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(ServiceToNotifier* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.notifier.ServiceToNotifier";
   }
+  protected:
+  explicit ServiceToNotifier(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kSessionFieldNumber = 1,
+    kSessionCloseFieldNumber = 2,
+  };
   // .aspia.proto.notifier.Session session = 1;
   bool has_session() const;
-  void clear_session();
-  static const int kSessionFieldNumber = 1;
   private:
-  const ::aspia::proto::notifier::Session& _internal_session() const;
+  bool _internal_has_session() const;
   public:
+  void clear_session();
   const ::aspia::proto::notifier::Session& session() const;
-  ::aspia::proto::notifier::Session* release_session();
+  PROTOBUF_NODISCARD ::aspia::proto::notifier::Session* release_session();
   ::aspia::proto::notifier::Session* mutable_session();
   void set_allocated_session(::aspia::proto::notifier::Session* session);
+  private:
+  const ::aspia::proto::notifier::Session& _internal_session() const;
+  ::aspia::proto::notifier::Session* _internal_mutable_session();
+  public:
+  void unsafe_arena_set_allocated_session(
+      ::aspia::proto::notifier::Session* session);
+  ::aspia::proto::notifier::Session* unsafe_arena_release_session();
 
   // .aspia.proto.notifier.SessionClose session_close = 2;
   bool has_session_close() const;
-  void clear_session_close();
-  static const int kSessionCloseFieldNumber = 2;
   private:
-  const ::aspia::proto::notifier::SessionClose& _internal_session_close() const;
+  bool _internal_has_session_close() const;
   public:
+  void clear_session_close();
   const ::aspia::proto::notifier::SessionClose& session_close() const;
-  ::aspia::proto::notifier::SessionClose* release_session_close();
+  PROTOBUF_NODISCARD ::aspia::proto::notifier::SessionClose* release_session_close();
   ::aspia::proto::notifier::SessionClose* mutable_session_close();
   void set_allocated_session_close(::aspia::proto::notifier::SessionClose* session_close);
+  private:
+  const ::aspia::proto::notifier::SessionClose& _internal_session_close() const;
+  ::aspia::proto::notifier::SessionClose* _internal_mutable_session_close();
+  public:
+  void unsafe_arena_set_allocated_session_close(
+      ::aspia::proto::notifier::SessionClose* session_close);
+  ::aspia::proto::notifier::SessionClose* unsafe_arena_release_session_close();
 
   // @@protoc_insertion_point(class_scope:aspia.proto.notifier.ServiceToNotifier)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::aspia::proto::notifier::Session* session_;
-  ::aspia::proto::notifier::SessionClose* session_close_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_notifier_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::aspia::proto::notifier::Session* session_;
+    ::aspia::proto::notifier::SessionClose* session_close_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_notifier_2eproto;
 };
 // ===================================================================
 
@@ -682,174 +833,171 @@ class ServiceToNotifier : public ::google::protobuf::MessageLite /* @@protoc_ins
 
 // string uuid = 1;
 inline void Session::clear_uuid() {
-  uuid_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.uuid_.ClearToEmpty();
 }
-inline const ::std::string& Session::uuid() const {
+inline const std::string& Session::uuid() const {
   // @@protoc_insertion_point(field_get:aspia.proto.notifier.Session.uuid)
-  return uuid_.GetNoArena();
+  return _internal_uuid();
 }
-inline void Session::set_uuid(const ::std::string& value) {
-  
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Session::set_uuid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.uuid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:aspia.proto.notifier.Session.uuid)
 }
-#if LANG_CXX11
-inline void Session::set_uuid(::std::string&& value) {
-  
-  uuid_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.notifier.Session.uuid)
+inline std::string* Session::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.notifier.Session.uuid)
+  return _s;
 }
-#endif
-inline void Session::set_uuid(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.notifier.Session.uuid)
+inline const std::string& Session::_internal_uuid() const {
+  return _impl_.uuid_.Get();
 }
-inline void Session::set_uuid(const char* value, size_t size) {
+inline void Session::_internal_set_uuid(const std::string& value) {
   
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.notifier.Session.uuid)
+  _impl_.uuid_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* Session::mutable_uuid() {
+inline std::string* Session::_internal_mutable_uuid() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.notifier.Session.uuid)
-  return uuid_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.uuid_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* Session::release_uuid() {
+inline std::string* Session::release_uuid() {
   // @@protoc_insertion_point(field_release:aspia.proto.notifier.Session.uuid)
-  
-  return uuid_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.uuid_.Release();
 }
-inline void Session::set_allocated_uuid(::std::string* uuid) {
-  if (uuid != NULL) {
+inline void Session::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
     
   } else {
     
   }
-  uuid_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), uuid);
+  _impl_.uuid_.SetAllocated(uuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.notifier.Session.uuid)
 }
 
 // string remote_address = 2;
 inline void Session::clear_remote_address() {
-  remote_address_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.remote_address_.ClearToEmpty();
 }
-inline const ::std::string& Session::remote_address() const {
+inline const std::string& Session::remote_address() const {
   // @@protoc_insertion_point(field_get:aspia.proto.notifier.Session.remote_address)
-  return remote_address_.GetNoArena();
+  return _internal_remote_address();
 }
-inline void Session::set_remote_address(const ::std::string& value) {
-  
-  remote_address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Session::set_remote_address(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.remote_address_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:aspia.proto.notifier.Session.remote_address)
 }
-#if LANG_CXX11
-inline void Session::set_remote_address(::std::string&& value) {
-  
-  remote_address_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.notifier.Session.remote_address)
+inline std::string* Session::mutable_remote_address() {
+  std::string* _s = _internal_mutable_remote_address();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.notifier.Session.remote_address)
+  return _s;
 }
-#endif
-inline void Session::set_remote_address(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  remote_address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.notifier.Session.remote_address)
+inline const std::string& Session::_internal_remote_address() const {
+  return _impl_.remote_address_.Get();
 }
-inline void Session::set_remote_address(const char* value, size_t size) {
+inline void Session::_internal_set_remote_address(const std::string& value) {
   
-  remote_address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.notifier.Session.remote_address)
+  _impl_.remote_address_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* Session::mutable_remote_address() {
+inline std::string* Session::_internal_mutable_remote_address() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.notifier.Session.remote_address)
-  return remote_address_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.remote_address_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* Session::release_remote_address() {
+inline std::string* Session::release_remote_address() {
   // @@protoc_insertion_point(field_release:aspia.proto.notifier.Session.remote_address)
-  
-  return remote_address_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.remote_address_.Release();
 }
-inline void Session::set_allocated_remote_address(::std::string* remote_address) {
-  if (remote_address != NULL) {
+inline void Session::set_allocated_remote_address(std::string* remote_address) {
+  if (remote_address != nullptr) {
     
   } else {
     
   }
-  remote_address_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), remote_address);
+  _impl_.remote_address_.SetAllocated(remote_address, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.remote_address_.IsDefault()) {
+    _impl_.remote_address_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.notifier.Session.remote_address)
 }
 
 // string username = 3;
 inline void Session::clear_username() {
-  username_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.username_.ClearToEmpty();
 }
-inline const ::std::string& Session::username() const {
+inline const std::string& Session::username() const {
   // @@protoc_insertion_point(field_get:aspia.proto.notifier.Session.username)
-  return username_.GetNoArena();
+  return _internal_username();
 }
-inline void Session::set_username(const ::std::string& value) {
-  
-  username_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Session::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:aspia.proto.notifier.Session.username)
 }
-#if LANG_CXX11
-inline void Session::set_username(::std::string&& value) {
-  
-  username_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.notifier.Session.username)
+inline std::string* Session::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.notifier.Session.username)
+  return _s;
 }
-#endif
-inline void Session::set_username(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  username_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.notifier.Session.username)
+inline const std::string& Session::_internal_username() const {
+  return _impl_.username_.Get();
 }
-inline void Session::set_username(const char* value, size_t size) {
+inline void Session::_internal_set_username(const std::string& value) {
   
-  username_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.notifier.Session.username)
+  _impl_.username_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* Session::mutable_username() {
+inline std::string* Session::_internal_mutable_username() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.notifier.Session.username)
-  return username_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.username_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* Session::release_username() {
+inline std::string* Session::release_username() {
   // @@protoc_insertion_point(field_release:aspia.proto.notifier.Session.username)
-  
-  return username_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.username_.Release();
 }
-inline void Session::set_allocated_username(::std::string* username) {
-  if (username != NULL) {
+inline void Session::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
     
   } else {
     
   }
-  username_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), username);
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.notifier.Session.username)
 }
 
 // .aspia.proto.auth.SessionType session_type = 4;
 inline void Session::clear_session_type() {
-  session_type_ = 0;
+  _impl_.session_type_ = 0;
+}
+inline ::aspia::proto::auth::SessionType Session::_internal_session_type() const {
+  return static_cast< ::aspia::proto::auth::SessionType >(_impl_.session_type_);
 }
 inline ::aspia::proto::auth::SessionType Session::session_type() const {
   // @@protoc_insertion_point(field_get:aspia.proto.notifier.Session.session_type)
-  return static_cast< ::aspia::proto::auth::SessionType >(session_type_);
+  return _internal_session_type();
 }
-inline void Session::set_session_type(::aspia::proto::auth::SessionType value) {
+inline void Session::_internal_set_session_type(::aspia::proto::auth::SessionType value) {
   
-  session_type_ = value;
+  _impl_.session_type_ = value;
+}
+inline void Session::set_session_type(::aspia::proto::auth::SessionType value) {
+  _internal_set_session_type(value);
   // @@protoc_insertion_point(field_set:aspia.proto.notifier.Session.session_type)
 }
 
@@ -859,54 +1007,51 @@ inline void Session::set_session_type(::aspia::proto::auth::SessionType value) {
 
 // string uuid = 1;
 inline void SessionClose::clear_uuid() {
-  uuid_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.uuid_.ClearToEmpty();
 }
-inline const ::std::string& SessionClose::uuid() const {
+inline const std::string& SessionClose::uuid() const {
   // @@protoc_insertion_point(field_get:aspia.proto.notifier.SessionClose.uuid)
-  return uuid_.GetNoArena();
+  return _internal_uuid();
 }
-inline void SessionClose::set_uuid(const ::std::string& value) {
-  
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SessionClose::set_uuid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.uuid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:aspia.proto.notifier.SessionClose.uuid)
 }
-#if LANG_CXX11
-inline void SessionClose::set_uuid(::std::string&& value) {
-  
-  uuid_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.notifier.SessionClose.uuid)
+inline std::string* SessionClose::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.notifier.SessionClose.uuid)
+  return _s;
 }
-#endif
-inline void SessionClose::set_uuid(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.notifier.SessionClose.uuid)
+inline const std::string& SessionClose::_internal_uuid() const {
+  return _impl_.uuid_.Get();
 }
-inline void SessionClose::set_uuid(const char* value, size_t size) {
+inline void SessionClose::_internal_set_uuid(const std::string& value) {
   
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.notifier.SessionClose.uuid)
+  _impl_.uuid_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* SessionClose::mutable_uuid() {
+inline std::string* SessionClose::_internal_mutable_uuid() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.notifier.SessionClose.uuid)
-  return uuid_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.uuid_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* SessionClose::release_uuid() {
+inline std::string* SessionClose::release_uuid() {
   // @@protoc_insertion_point(field_release:aspia.proto.notifier.SessionClose.uuid)
-  
-  return uuid_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.uuid_.Release();
 }
-inline void SessionClose::set_allocated_uuid(::std::string* uuid) {
-  if (uuid != NULL) {
+inline void SessionClose::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
     
   } else {
     
   }
-  uuid_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), uuid);
+  _impl_.uuid_.SetAllocated(uuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.notifier.SessionClose.uuid)
 }
 
@@ -916,54 +1061,51 @@ inline void SessionClose::set_allocated_uuid(::std::string* uuid) {
 
 // string uuid = 1;
 inline void KillSession::clear_uuid() {
-  uuid_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.uuid_.ClearToEmpty();
 }
-inline const ::std::string& KillSession::uuid() const {
+inline const std::string& KillSession::uuid() const {
   // @@protoc_insertion_point(field_get:aspia.proto.notifier.KillSession.uuid)
-  return uuid_.GetNoArena();
+  return _internal_uuid();
 }
-inline void KillSession::set_uuid(const ::std::string& value) {
-  
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void KillSession::set_uuid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.uuid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:aspia.proto.notifier.KillSession.uuid)
 }
-#if LANG_CXX11
-inline void KillSession::set_uuid(::std::string&& value) {
-  
-  uuid_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.notifier.KillSession.uuid)
+inline std::string* KillSession::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.notifier.KillSession.uuid)
+  return _s;
 }
-#endif
-inline void KillSession::set_uuid(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.notifier.KillSession.uuid)
+inline const std::string& KillSession::_internal_uuid() const {
+  return _impl_.uuid_.Get();
 }
-inline void KillSession::set_uuid(const char* value, size_t size) {
+inline void KillSession::_internal_set_uuid(const std::string& value) {
   
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.notifier.KillSession.uuid)
+  _impl_.uuid_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* KillSession::mutable_uuid() {
+inline std::string* KillSession::_internal_mutable_uuid() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.notifier.KillSession.uuid)
-  return uuid_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.uuid_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* KillSession::release_uuid() {
+inline std::string* KillSession::release_uuid() {
   // @@protoc_insertion_point(field_release:aspia.proto.notifier.KillSession.uuid)
-  
-  return uuid_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.uuid_.Release();
 }
-inline void KillSession::set_allocated_uuid(::std::string* uuid) {
-  if (uuid != NULL) {
+inline void KillSession::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
     
   } else {
     
   }
-  uuid_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), uuid);
+  _impl_.uuid_.SetAllocated(uuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.notifier.KillSession.uuid)
 }
 
@@ -972,56 +1114,92 @@ inline void KillSession::set_allocated_uuid(::std::string* uuid) {
 // NotifierToService
 
 // .aspia.proto.notifier.KillSession kill_session = 1;
+inline bool NotifierToService::_internal_has_kill_session() const {
+  return this != internal_default_instance() && _impl_.kill_session_ != nullptr;
+}
 inline bool NotifierToService::has_kill_session() const {
-  return this != internal_default_instance() && kill_session_ != NULL;
+  return _internal_has_kill_session();
 }
 inline void NotifierToService::clear_kill_session() {
-  if (GetArenaNoVirtual() == NULL && kill_session_ != NULL) {
-    delete kill_session_;
+  if (GetArenaForAllocation() == nullptr && _impl_.kill_session_ != nullptr) {
+    delete _impl_.kill_session_;
   }
-  kill_session_ = NULL;
+  _impl_.kill_session_ = nullptr;
 }
 inline const ::aspia::proto::notifier::KillSession& NotifierToService::_internal_kill_session() const {
-  return *kill_session_;
+  const ::aspia::proto::notifier::KillSession* p = _impl_.kill_session_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::notifier::KillSession&>(
+      ::aspia::proto::notifier::_KillSession_default_instance_);
 }
 inline const ::aspia::proto::notifier::KillSession& NotifierToService::kill_session() const {
-  const ::aspia::proto::notifier::KillSession* p = kill_session_;
   // @@protoc_insertion_point(field_get:aspia.proto.notifier.NotifierToService.kill_session)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::notifier::KillSession*>(
-      &::aspia::proto::notifier::_KillSession_default_instance_);
+  return _internal_kill_session();
+}
+inline void NotifierToService::unsafe_arena_set_allocated_kill_session(
+    ::aspia::proto::notifier::KillSession* kill_session) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.kill_session_);
+  }
+  _impl_.kill_session_ = kill_session;
+  if (kill_session) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.notifier.NotifierToService.kill_session)
 }
 inline ::aspia::proto::notifier::KillSession* NotifierToService::release_kill_session() {
+  
+  ::aspia::proto::notifier::KillSession* temp = _impl_.kill_session_;
+  _impl_.kill_session_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::notifier::KillSession* NotifierToService::unsafe_arena_release_kill_session() {
   // @@protoc_insertion_point(field_release:aspia.proto.notifier.NotifierToService.kill_session)
   
-  ::aspia::proto::notifier::KillSession* temp = kill_session_;
-  kill_session_ = NULL;
+  ::aspia::proto::notifier::KillSession* temp = _impl_.kill_session_;
+  _impl_.kill_session_ = nullptr;
   return temp;
 }
-inline ::aspia::proto::notifier::KillSession* NotifierToService::mutable_kill_session() {
+inline ::aspia::proto::notifier::KillSession* NotifierToService::_internal_mutable_kill_session() {
   
-  if (kill_session_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::notifier::KillSession>(GetArenaNoVirtual());
-    kill_session_ = p;
+  if (_impl_.kill_session_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::notifier::KillSession>(GetArenaForAllocation());
+    _impl_.kill_session_ = p;
   }
+  return _impl_.kill_session_;
+}
+inline ::aspia::proto::notifier::KillSession* NotifierToService::mutable_kill_session() {
+  ::aspia::proto::notifier::KillSession* _msg = _internal_mutable_kill_session();
   // @@protoc_insertion_point(field_mutable:aspia.proto.notifier.NotifierToService.kill_session)
-  return kill_session_;
+  return _msg;
 }
 inline void NotifierToService::set_allocated_kill_session(::aspia::proto::notifier::KillSession* kill_session) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete kill_session_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.kill_session_;
   }
   if (kill_session) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(kill_session);
     if (message_arena != submessage_arena) {
-      kill_session = ::google::protobuf::internal::GetOwnedMessage(
+      kill_session = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, kill_session, submessage_arena);
     }
     
   } else {
     
   }
-  kill_session_ = kill_session;
+  _impl_.kill_session_ = kill_session;
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.notifier.NotifierToService.kill_session)
 }
 
@@ -1030,110 +1208,182 @@ inline void NotifierToService::set_allocated_kill_session(::aspia::proto::notifi
 // ServiceToNotifier
 
 // .aspia.proto.notifier.Session session = 1;
+inline bool ServiceToNotifier::_internal_has_session() const {
+  return this != internal_default_instance() && _impl_.session_ != nullptr;
+}
 inline bool ServiceToNotifier::has_session() const {
-  return this != internal_default_instance() && session_ != NULL;
+  return _internal_has_session();
 }
 inline void ServiceToNotifier::clear_session() {
-  if (GetArenaNoVirtual() == NULL && session_ != NULL) {
-    delete session_;
+  if (GetArenaForAllocation() == nullptr && _impl_.session_ != nullptr) {
+    delete _impl_.session_;
   }
-  session_ = NULL;
+  _impl_.session_ = nullptr;
 }
 inline const ::aspia::proto::notifier::Session& ServiceToNotifier::_internal_session() const {
-  return *session_;
+  const ::aspia::proto::notifier::Session* p = _impl_.session_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::notifier::Session&>(
+      ::aspia::proto::notifier::_Session_default_instance_);
 }
 inline const ::aspia::proto::notifier::Session& ServiceToNotifier::session() const {
-  const ::aspia::proto::notifier::Session* p = session_;
   // @@protoc_insertion_point(field_get:aspia.proto.notifier.ServiceToNotifier.session)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::notifier::Session*>(
-      &::aspia::proto::notifier::_Session_default_instance_);
+  return _internal_session();
+}
+inline void ServiceToNotifier::unsafe_arena_set_allocated_session(
+    ::aspia::proto::notifier::Session* session) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.session_);
+  }
+  _impl_.session_ = session;
+  if (session) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.notifier.ServiceToNotifier.session)
 }
 inline ::aspia::proto::notifier::Session* ServiceToNotifier::release_session() {
+  
+  ::aspia::proto::notifier::Session* temp = _impl_.session_;
+  _impl_.session_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::notifier::Session* ServiceToNotifier::unsafe_arena_release_session() {
   // @@protoc_insertion_point(field_release:aspia.proto.notifier.ServiceToNotifier.session)
   
-  ::aspia::proto::notifier::Session* temp = session_;
-  session_ = NULL;
+  ::aspia::proto::notifier::Session* temp = _impl_.session_;
+  _impl_.session_ = nullptr;
   return temp;
 }
-inline ::aspia::proto::notifier::Session* ServiceToNotifier::mutable_session() {
+inline ::aspia::proto::notifier::Session* ServiceToNotifier::_internal_mutable_session() {
   
-  if (session_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::notifier::Session>(GetArenaNoVirtual());
-    session_ = p;
+  if (_impl_.session_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::notifier::Session>(GetArenaForAllocation());
+    _impl_.session_ = p;
   }
+  return _impl_.session_;
+}
+inline ::aspia::proto::notifier::Session* ServiceToNotifier::mutable_session() {
+  ::aspia::proto::notifier::Session* _msg = _internal_mutable_session();
   // @@protoc_insertion_point(field_mutable:aspia.proto.notifier.ServiceToNotifier.session)
-  return session_;
+  return _msg;
 }
 inline void ServiceToNotifier::set_allocated_session(::aspia::proto::notifier::Session* session) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete session_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.session_;
   }
   if (session) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(session);
     if (message_arena != submessage_arena) {
-      session = ::google::protobuf::internal::GetOwnedMessage(
+      session = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, session, submessage_arena);
     }
     
   } else {
     
   }
-  session_ = session;
+  _impl_.session_ = session;
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.notifier.ServiceToNotifier.session)
 }
 
 // .aspia.proto.notifier.SessionClose session_close = 2;
+inline bool ServiceToNotifier::_internal_has_session_close() const {
+  return this != internal_default_instance() && _impl_.session_close_ != nullptr;
+}
 inline bool ServiceToNotifier::has_session_close() const {
-  return this != internal_default_instance() && session_close_ != NULL;
+  return _internal_has_session_close();
 }
 inline void ServiceToNotifier::clear_session_close() {
-  if (GetArenaNoVirtual() == NULL && session_close_ != NULL) {
-    delete session_close_;
+  if (GetArenaForAllocation() == nullptr && _impl_.session_close_ != nullptr) {
+    delete _impl_.session_close_;
   }
-  session_close_ = NULL;
+  _impl_.session_close_ = nullptr;
 }
 inline const ::aspia::proto::notifier::SessionClose& ServiceToNotifier::_internal_session_close() const {
-  return *session_close_;
+  const ::aspia::proto::notifier::SessionClose* p = _impl_.session_close_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::notifier::SessionClose&>(
+      ::aspia::proto::notifier::_SessionClose_default_instance_);
 }
 inline const ::aspia::proto::notifier::SessionClose& ServiceToNotifier::session_close() const {
-  const ::aspia::proto::notifier::SessionClose* p = session_close_;
   // @@protoc_insertion_point(field_get:aspia.proto.notifier.ServiceToNotifier.session_close)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::notifier::SessionClose*>(
-      &::aspia::proto::notifier::_SessionClose_default_instance_);
+  return _internal_session_close();
+}
+inline void ServiceToNotifier::unsafe_arena_set_allocated_session_close(
+    ::aspia::proto::notifier::SessionClose* session_close) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.session_close_);
+  }
+  _impl_.session_close_ = session_close;
+  if (session_close) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.notifier.ServiceToNotifier.session_close)
 }
 inline ::aspia::proto::notifier::SessionClose* ServiceToNotifier::release_session_close() {
+  
+  ::aspia::proto::notifier::SessionClose* temp = _impl_.session_close_;
+  _impl_.session_close_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::notifier::SessionClose* ServiceToNotifier::unsafe_arena_release_session_close() {
   // @@protoc_insertion_point(field_release:aspia.proto.notifier.ServiceToNotifier.session_close)
   
-  ::aspia::proto::notifier::SessionClose* temp = session_close_;
-  session_close_ = NULL;
+  ::aspia::proto::notifier::SessionClose* temp = _impl_.session_close_;
+  _impl_.session_close_ = nullptr;
   return temp;
 }
-inline ::aspia::proto::notifier::SessionClose* ServiceToNotifier::mutable_session_close() {
+inline ::aspia::proto::notifier::SessionClose* ServiceToNotifier::_internal_mutable_session_close() {
   
-  if (session_close_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::notifier::SessionClose>(GetArenaNoVirtual());
-    session_close_ = p;
+  if (_impl_.session_close_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::notifier::SessionClose>(GetArenaForAllocation());
+    _impl_.session_close_ = p;
   }
+  return _impl_.session_close_;
+}
+inline ::aspia::proto::notifier::SessionClose* ServiceToNotifier::mutable_session_close() {
+  ::aspia::proto::notifier::SessionClose* _msg = _internal_mutable_session_close();
   // @@protoc_insertion_point(field_mutable:aspia.proto.notifier.ServiceToNotifier.session_close)
-  return session_close_;
+  return _msg;
 }
 inline void ServiceToNotifier::set_allocated_session_close(::aspia::proto::notifier::SessionClose* session_close) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete session_close_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.session_close_;
   }
   if (session_close) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(session_close);
     if (message_arena != submessage_arena) {
-      session_close = ::google::protobuf::internal::GetOwnedMessage(
+      session_close = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, session_close, submessage_arena);
     }
     
   } else {
     
   }
-  session_close_ = session_close;
+  _impl_.session_close_ = session_close;
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.notifier.ServiceToNotifier.session_close)
 }
 
@@ -1157,4 +1407,5 @@ inline void ServiceToNotifier::set_allocated_session_close(::aspia::proto::notif
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_INCLUDED_notifier_2eproto
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_notifier_2eproto
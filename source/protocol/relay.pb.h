@@ -0,0 +1,1003 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: relay.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_relay_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_relay_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/message_lite.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_util.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_relay_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_relay_2eproto {
+  static const uint32_t offsets[];
+};
+namespace aspia {
+namespace proto {
+namespace relay {
+class Incoming;
+struct IncomingDefaultTypeInternal;
+extern IncomingDefaultTypeInternal _Incoming_default_instance_;
+class Reply;
+struct ReplyDefaultTypeInternal;
+extern ReplyDefaultTypeInternal _Reply_default_instance_;
+class Request;
+struct RequestDefaultTypeInternal;
+extern RequestDefaultTypeInternal _Request_default_instance_;
+}  // namespace relay
+}  // namespace proto
+}  // namespace aspia
+PROTOBUF_NAMESPACE_OPEN
+template<> ::aspia::proto::relay::Incoming* Arena::CreateMaybeMessage<::aspia::proto::relay::Incoming>(Arena*);
+template<> ::aspia::proto::relay::Reply* Arena::CreateMaybeMessage<::aspia::proto::relay::Reply>(Arena*);
+template<> ::aspia::proto::relay::Request* Arena::CreateMaybeMessage<::aspia::proto::relay::Request>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace aspia {
+namespace proto {
+namespace relay {
+
+enum Request_Type : int {
+  Request_Type_TYPE_UNKNOWN = 0,
+  Request_Type_TYPE_REGISTER = 1,
+  Request_Type_TYPE_ACCEPT = 2,
+  Request_Type_TYPE_CONNECT = 3,
+  Request_Type_Request_Type_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Request_Type_Request_Type_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool Request_Type_IsValid(int value);
+constexpr Request_Type Request_Type_Type_MIN = Request_Type_TYPE_UNKNOWN;
+constexpr Request_Type Request_Type_Type_MAX = Request_Type_TYPE_CONNECT;
+constexpr int Request_Type_Type_ARRAYSIZE = Request_Type_Type_MAX + 1;
+
+const std::string& Request_Type_Name(Request_Type value);
+template<typename T>
+inline const std::string& Request_Type_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Request_Type>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Request_Type_Name.");
+  return Request_Type_Name(static_cast<Request_Type>(enum_t_value));
+}
+bool Request_Type_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Request_Type* value);
+enum Reply_Status : int {
+  Reply_Status_STATUS_UNKNOWN = 0,
+  Reply_Status_STATUS_SUCCESS = 1,
+  Reply_Status_STATUS_INVALID = 2,
+  Reply_Status_STATUS_ACCESS_DENIED = 3,
+  Reply_Status_STATUS_HOST_NOT_FOUND = 4,
+  Reply_Status_STATUS_HOST_TIMEOUT = 5,
+  Reply_Status_STATUS_BUSY = 6,
+  Reply_Status_Reply_Status_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Reply_Status_Reply_Status_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool Reply_Status_IsValid(int value);
+constexpr Reply_Status Reply_Status_Status_MIN = Reply_Status_STATUS_UNKNOWN;
+constexpr Reply_Status Reply_Status_Status_MAX = Reply_Status_STATUS_BUSY;
+constexpr int Reply_Status_Status_ARRAYSIZE = Reply_Status_Status_MAX + 1;
+
+const std::string& Reply_Status_Name(Reply_Status value);
+template<typename T>
+inline const std::string& Reply_Status_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Reply_Status>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Reply_Status_Name.");
+  return Reply_Status_Name(static_cast<Reply_Status>(enum_t_value));
+}
+bool Reply_Status_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Reply_Status* value);
+// ===================================================================
+
+class Request final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.relay.Request) */ {
+ public:
+  inline Request() : Request(nullptr) {}
+  ~Request() override;
+  explicit PROTOBUF_CONSTEXPR Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Request(const Request& from);
+  Request(Request&& from) noexcept
+    : Request() {
+    *this = ::std::move(from);
+  }
+
+  inline Request& operator=(const Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Request& operator=(Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Request* internal_default_instance() {
+    return reinterpret_cast<const Request*>(
+               &_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Request& a, Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Request>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const Request& from);
+  void MergeFrom(const Request& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(Request* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.relay.Request";
+  }
+  protected:
+  explicit Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Request_Type Type;
+  static constexpr Type TYPE_UNKNOWN =
+    Request_Type_TYPE_UNKNOWN;
+  static constexpr Type TYPE_REGISTER =
+    Request_Type_TYPE_REGISTER;
+  static constexpr Type TYPE_ACCEPT =
+    Request_Type_TYPE_ACCEPT;
+  static constexpr Type TYPE_CONNECT =
+    Request_Type_TYPE_CONNECT;
+  static inline bool Type_IsValid(int value) {
+    return Request_Type_IsValid(value);
+  }
+  static constexpr Type Type_MIN =
+    Request_Type_Type_MIN;
+  static constexpr Type Type_MAX =
+    Request_Type_Type_MAX;
+  static constexpr int Type_ARRAYSIZE =
+    Request_Type_Type_ARRAYSIZE;
+  template<typename T>
+  static inline const std::string& Type_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Type>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Type_Name.");
+    return Request_Type_Name(enum_t_value);
+  }
+  static inline bool Type_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Type* value) {
+    return Request_Type_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHostIdFieldNumber = 2,
+    kSecretFieldNumber = 3,
+    kHostKeyFieldNumber = 6,
+    kTypeFieldNumber = 1,
+    kHopsFieldNumber = 5,
+    kTokenFieldNumber = 4,
+  };
+  // string host_id = 2;
+  void clear_host_id();
+  const std::string& host_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_host_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_host_id();
+  PROTOBUF_NODISCARD std::string* release_host_id();
+  void set_allocated_host_id(std::string* host_id);
+  private:
+  const std::string& _internal_host_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_host_id(const std::string& value);
+  std::string* _internal_mutable_host_id();
+  public:
+
+  // string secret = 3;
+  void clear_secret();
+  const std::string& secret() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_secret(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_secret();
+  PROTOBUF_NODISCARD std::string* release_secret();
+  void set_allocated_secret(std::string* secret);
+  private:
+  const std::string& _internal_secret() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_secret(const std::string& value);
+  std::string* _internal_mutable_secret();
+  public:
+
+  // bytes host_key = 6;
+  void clear_host_key();
+  const std::string& host_key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_host_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_host_key();
+  PROTOBUF_NODISCARD std::string* release_host_key();
+  void set_allocated_host_key(std::string* host_key);
+  private:
+  const std::string& _internal_host_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_host_key(const std::string& value);
+  std::string* _internal_mutable_host_key();
+  public:
+
+  // .aspia.proto.relay.Request.Type type = 1;
+  void clear_type();
+  ::aspia::proto::relay::Request_Type type() const;
+  void set_type(::aspia::proto::relay::Request_Type value);
+  private:
+  ::aspia::proto::relay::Request_Type _internal_type() const;
+  void _internal_set_type(::aspia::proto::relay::Request_Type value);
+  public:
+
+  // uint32 hops = 5;
+  void clear_hops();
+  uint32_t hops() const;
+  void set_hops(uint32_t value);
+  private:
+  uint32_t _internal_hops() const;
+  void _internal_set_hops(uint32_t value);
+  public:
+
+  // uint64 token = 4;
+  void clear_token();
+  uint64_t token() const;
+  void set_token(uint64_t value);
+  private:
+  uint64_t _internal_token() const;
+  void _internal_set_token(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.relay.Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr host_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr secret_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr host_key_;
+    int type_;
+    uint32_t hops_;
+    uint64_t token_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_relay_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Reply final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.relay.Reply) */ {
+ public:
+  inline Reply() : Reply(nullptr) {}
+  ~Reply() override;
+  explicit PROTOBUF_CONSTEXPR Reply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Reply(const Reply& from);
+  Reply(Reply&& from) noexcept
+    : Reply() {
+    *this = ::std::move(from);
+  }
+
+  inline Reply& operator=(const Reply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Reply& operator=(Reply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const Reply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Reply* internal_default_instance() {
+    return reinterpret_cast<const Reply*>(
+               &_Reply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Reply& a, Reply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Reply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Reply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Reply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Reply>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const Reply& from);
+  void MergeFrom(const Reply& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(Reply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.relay.Reply";
+  }
+  protected:
+  explicit Reply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Reply_Status Status;
+  static constexpr Status STATUS_UNKNOWN =
+    Reply_Status_STATUS_UNKNOWN;
+  static constexpr Status STATUS_SUCCESS =
+    Reply_Status_STATUS_SUCCESS;
+  static constexpr Status STATUS_INVALID =
+    Reply_Status_STATUS_INVALID;
+  static constexpr Status STATUS_ACCESS_DENIED =
+    Reply_Status_STATUS_ACCESS_DENIED;
+  static constexpr Status STATUS_HOST_NOT_FOUND =
+    Reply_Status_STATUS_HOST_NOT_FOUND;
+  static constexpr Status STATUS_HOST_TIMEOUT =
+    Reply_Status_STATUS_HOST_TIMEOUT;
+  static constexpr Status STATUS_BUSY =
+    Reply_Status_STATUS_BUSY;
+  static inline bool Status_IsValid(int value) {
+    return Reply_Status_IsValid(value);
+  }
+  static constexpr Status Status_MIN =
+    Reply_Status_Status_MIN;
+  static constexpr Status Status_MAX =
+    Reply_Status_Status_MAX;
+  static constexpr int Status_ARRAYSIZE =
+    Reply_Status_Status_ARRAYSIZE;
+  template<typename T>
+  static inline const std::string& Status_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Status>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Status_Name.");
+    return Reply_Status_Name(enum_t_value);
+  }
+  static inline bool Status_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Status* value) {
+    return Reply_Status_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAddressFieldNumber = 2,
+    kStatusFieldNumber = 1,
+  };
+  // string address = 2;
+  void clear_address();
+  const std::string& address() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_address(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_address();
+  PROTOBUF_NODISCARD std::string* release_address();
+  void set_allocated_address(std::string* address);
+  private:
+  const std::string& _internal_address() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_address(const std::string& value);
+  std::string* _internal_mutable_address();
+  public:
+
+  // .aspia.proto.relay.Reply.Status status = 1;
+  void clear_status();
+  ::aspia::proto::relay::Reply_Status status() const;
+  void set_status(::aspia::proto::relay::Reply_Status value);
+  private:
+  ::aspia::proto::relay::Reply_Status _internal_status() const;
+  void _internal_set_status(::aspia::proto::relay::Reply_Status value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.relay.Reply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr address_;
+    int status_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_relay_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Incoming final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.relay.Incoming) */ {
+ public:
+  inline Incoming() : Incoming(nullptr) {}
+  ~Incoming() override;
+  explicit PROTOBUF_CONSTEXPR Incoming(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Incoming(const Incoming& from);
+  Incoming(Incoming&& from) noexcept
+    : Incoming() {
+    *this = ::std::move(from);
+  }
+
+  inline Incoming& operator=(const Incoming& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Incoming& operator=(Incoming&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const Incoming& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Incoming* internal_default_instance() {
+    return reinterpret_cast<const Incoming*>(
+               &_Incoming_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(Incoming& a, Incoming& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Incoming* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Incoming* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Incoming* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Incoming>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const Incoming& from);
+  void MergeFrom(const Incoming& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(Incoming* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.relay.Incoming";
+  }
+  protected:
+  explicit Incoming(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTokenFieldNumber = 1,
+  };
+  // uint64 token = 1;
+  void clear_token();
+  uint64_t token() const;
+  void set_token(uint64_t value);
+  private:
+  uint64_t _internal_token() const;
+  void _internal_set_token(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.relay.Incoming)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t token_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_relay_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Request
+
+// .aspia.proto.relay.Request.Type type = 1;
+inline void Request::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::aspia::proto::relay::Request_Type Request::_internal_type() const {
+  return static_cast< ::aspia::proto::relay::Request_Type >(_impl_.type_);
+}
+inline ::aspia::proto::relay::Request_Type Request::type() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.relay.Request.type)
+  return _internal_type();
+}
+inline void Request::_internal_set_type(::aspia::proto::relay::Request_Type value) {
+  
+  _impl_.type_ = value;
+}
+inline void Request::set_type(::aspia::proto::relay::Request_Type value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.relay.Request.type)
+}
+
+// string host_id = 2;
+inline void Request::clear_host_id() {
+  _impl_.host_id_.ClearToEmpty();
+}
+inline const std::string& Request::host_id() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.relay.Request.host_id)
+  return _internal_host_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Request::set_host_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.host_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.relay.Request.host_id)
+}
+inline std::string* Request::mutable_host_id() {
+  std::string* _s = _internal_mutable_host_id();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.relay.Request.host_id)
+  return _s;
+}
+inline const std::string& Request::_internal_host_id() const {
+  return _impl_.host_id_.Get();
+}
+inline void Request::_internal_set_host_id(const std::string& value) {
+  
+  _impl_.host_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Request::_internal_mutable_host_id() {
+  
+  return _impl_.host_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Request::release_host_id() {
+  // @@protoc_insertion_point(field_release:aspia.proto.relay.Request.host_id)
+  return _impl_.host_id_.Release();
+}
+inline void Request::set_allocated_host_id(std::string* host_id) {
+  if (host_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.host_id_.SetAllocated(host_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.host_id_.IsDefault()) {
+    _impl_.host_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.relay.Request.host_id)
+}
+
+// string secret = 3;
+inline void Request::clear_secret() {
+  _impl_.secret_.ClearToEmpty();
+}
+inline const std::string& Request::secret() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.relay.Request.secret)
+  return _internal_secret();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Request::set_secret(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.secret_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.relay.Request.secret)
+}
+inline std::string* Request::mutable_secret() {
+  std::string* _s = _internal_mutable_secret();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.relay.Request.secret)
+  return _s;
+}
+inline const std::string& Request::_internal_secret() const {
+  return _impl_.secret_.Get();
+}
+inline void Request::_internal_set_secret(const std::string& value) {
+  
+  _impl_.secret_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Request::_internal_mutable_secret() {
+  
+  return _impl_.secret_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Request::release_secret() {
+  // @@protoc_insertion_point(field_release:aspia.proto.relay.Request.secret)
+  return _impl_.secret_.Release();
+}
+inline void Request::set_allocated_secret(std::string* secret) {
+  if (secret != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.secret_.SetAllocated(secret, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.secret_.IsDefault()) {
+    _impl_.secret_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.relay.Request.secret)
+}
+
+// uint64 token = 4;
+inline void Request::clear_token() {
+  _impl_.token_ = uint64_t{0u};
+}
+inline uint64_t Request::_internal_token() const {
+  return _impl_.token_;
+}
+inline uint64_t Request::token() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.relay.Request.token)
+  return _internal_token();
+}
+inline void Request::_internal_set_token(uint64_t value) {
+  
+  _impl_.token_ = value;
+}
+inline void Request::set_token(uint64_t value) {
+  _internal_set_token(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.relay.Request.token)
+}
+
+// uint32 hops = 5;
+inline void Request::clear_hops() {
+  _impl_.hops_ = 0u;
+}
+inline uint32_t Request::_internal_hops() const {
+  return _impl_.hops_;
+}
+inline uint32_t Request::hops() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.relay.Request.hops)
+  return _internal_hops();
+}
+inline void Request::_internal_set_hops(uint32_t value) {
+  
+  _impl_.hops_ = value;
+}
+inline void Request::set_hops(uint32_t value) {
+  _internal_set_hops(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.relay.Request.hops)
+}
+
+// bytes host_key = 6;
+inline void Request::clear_host_key() {
+  _impl_.host_key_.ClearToEmpty();
+}
+inline const std::string& Request::host_key() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.relay.Request.host_key)
+  return _internal_host_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Request::set_host_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.host_key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.relay.Request.host_key)
+}
+inline std::string* Request::mutable_host_key() {
+  std::string* _s = _internal_mutable_host_key();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.relay.Request.host_key)
+  return _s;
+}
+inline const std::string& Request::_internal_host_key() const {
+  return _impl_.host_key_.Get();
+}
+inline void Request::_internal_set_host_key(const std::string& value) {
+  
+  _impl_.host_key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Request::_internal_mutable_host_key() {
+  
+  return _impl_.host_key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Request::release_host_key() {
+  // @@protoc_insertion_point(field_release:aspia.proto.relay.Request.host_key)
+  return _impl_.host_key_.Release();
+}
+inline void Request::set_allocated_host_key(std::string* host_key) {
+  if (host_key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.host_key_.SetAllocated(host_key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.host_key_.IsDefault()) {
+    _impl_.host_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.relay.Request.host_key)
+}
+
+// -------------------------------------------------------------------
+
+// Reply
+
+// .aspia.proto.relay.Reply.Status status = 1;
+inline void Reply::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::aspia::proto::relay::Reply_Status Reply::_internal_status() const {
+  return static_cast< ::aspia::proto::relay::Reply_Status >(_impl_.status_);
+}
+inline ::aspia::proto::relay::Reply_Status Reply::status() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.relay.Reply.status)
+  return _internal_status();
+}
+inline void Reply::_internal_set_status(::aspia::proto::relay::Reply_Status value) {
+  
+  _impl_.status_ = value;
+}
+inline void Reply::set_status(::aspia::proto::relay::Reply_Status value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.relay.Reply.status)
+}
+
+// string address = 2;
+inline void Reply::clear_address() {
+  _impl_.address_.ClearToEmpty();
+}
+inline const std::string& Reply::address() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.relay.Reply.address)
+  return _internal_address();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Reply::set_address(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.address_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:aspia.proto.relay.Reply.address)
+}
+inline std::string* Reply::mutable_address() {
+  std::string* _s = _internal_mutable_address();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.relay.Reply.address)
+  return _s;
+}
+inline const std::string& Reply::_internal_address() const {
+  return _impl_.address_.Get();
+}
+inline void Reply::_internal_set_address(const std::string& value) {
+  
+  _impl_.address_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Reply::_internal_mutable_address() {
+  
+  return _impl_.address_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Reply::release_address() {
+  // @@protoc_insertion_point(field_release:aspia.proto.relay.Reply.address)
+  return _impl_.address_.Release();
+}
+inline void Reply::set_allocated_address(std::string* address) {
+  if (address != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.address_.SetAllocated(address, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.address_.IsDefault()) {
+    _impl_.address_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.relay.Reply.address)
+}
+
+// -------------------------------------------------------------------
+
+// Incoming
+
+// uint64 token = 1;
+inline void Incoming::clear_token() {
+  _impl_.token_ = uint64_t{0u};
+}
+inline uint64_t Incoming::_internal_token() const {
+  return _impl_.token_;
+}
+inline uint64_t Incoming::token() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.relay.Incoming.token)
+  return _internal_token();
+}
+inline void Incoming::_internal_set_token(uint64_t value) {
+  
+  _impl_.token_ = value;
+}
+inline void Incoming::set_token(uint64_t value) {
+  _internal_set_token(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.relay.Incoming.token)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace relay
+}  // namespace proto
+}  // namespace aspia
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::aspia::proto::relay::Request_Type> : ::std::true_type {};
+template <> struct is_proto_enum< ::aspia::proto::relay::Reply_Status> : ::std::true_type {};
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_relay_2eproto
@@ -5,315 +5,284 @@
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/port.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/io/zero_copy_stream_impl_lite.h>
-// This is a temporary google only hack
-#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-#include "third_party/protobuf/version.h"
-#endif
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-namespace protobuf_system_5finfo_5fsession_2eproto {
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_system_5finfo_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_Category;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_system_5finfo_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_CategoryList;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_system_5finfo_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_CategoryListRequest;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_system_5finfo_5fsession_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_CategoryRequest;
-}  // namespace protobuf_system_5finfo_5fsession_2eproto
 namespace aspia {
 namespace proto {
 namespace system_info {
-class CategoryListRequestDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<CategoryListRequest>
-      _instance;
-} _CategoryListRequest_default_instance_;
-class CategoryListDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<CategoryList>
-      _instance;
-} _CategoryList_default_instance_;
-class CategoryRequestDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<CategoryRequest>
-      _instance;
-} _CategoryRequest_default_instance_;
-class CategoryDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<Category>
-      _instance;
-} _Category_default_instance_;
-class RequestDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<Request>
-      _instance;
-} _Request_default_instance_;
-class ReplyDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<Reply>
-      _instance;
-} _Reply_default_instance_;
+PROTOBUF_CONSTEXPR CategoryListRequest::CategoryListRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.dummy_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CategoryListRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CategoryListRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CategoryListRequestDefaultTypeInternal() {}
+  union {
+    CategoryListRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CategoryListRequestDefaultTypeInternal _CategoryListRequest_default_instance_;
+PROTOBUF_CONSTEXPR CategoryList::CategoryList(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.uuid_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CategoryListDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CategoryListDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CategoryListDefaultTypeInternal() {}
+  union {
+    CategoryList _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CategoryListDefaultTypeInternal _CategoryList_default_instance_;
+PROTOBUF_CONSTEXPR CategoryRequest::CategoryRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.uuid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CategoryRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CategoryRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CategoryRequestDefaultTypeInternal() {}
+  union {
+    CategoryRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CategoryRequestDefaultTypeInternal _CategoryRequest_default_instance_;
+PROTOBUF_CONSTEXPR CategoryBatchRequest::CategoryBatchRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.uuid_)*/{}
+  , /*decltype(_impl_.compress_)*/false
+  , /*decltype(_impl_.compression_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CategoryBatchRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CategoryBatchRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CategoryBatchRequestDefaultTypeInternal() {}
+  union {
+    CategoryBatchRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CategoryBatchRequestDefaultTypeInternal _CategoryBatchRequest_default_instance_;
+PROTOBUF_CONSTEXPR Category::Category(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.uuid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.compression_)*/0
+  , /*decltype(_impl_.uncompressed_size_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CategoryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CategoryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CategoryDefaultTypeInternal() {}
+  union {
+    Category _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CategoryDefaultTypeInternal _Category_default_instance_;
+PROTOBUF_CONSTEXPR Request::Request(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.category_list_request_)*/nullptr
+  , /*decltype(_impl_.category_request_)*/nullptr
+  , /*decltype(_impl_.category_batch_request_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RequestDefaultTypeInternal() {}
+  union {
+    Request _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RequestDefaultTypeInternal _Request_default_instance_;
+PROTOBUF_CONSTEXPR Reply::Reply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.category_list_)*/nullptr
+  , /*decltype(_impl_.category_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReplyDefaultTypeInternal() {}
+  union {
+    Reply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReplyDefaultTypeInternal _Reply_default_instance_;
 }  // namespace system_info
 }  // namespace proto
 }  // namespace aspia
-namespace protobuf_system_5finfo_5fsession_2eproto {
-static void InitDefaultsCategoryListRequest() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::system_info::_CategoryListRequest_default_instance_;
-    new (ptr) ::aspia::proto::system_info::CategoryListRequest();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::system_info::CategoryListRequest::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_CategoryListRequest =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsCategoryListRequest}, {}};
-
-static void InitDefaultsCategoryList() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::system_info::_CategoryList_default_instance_;
-    new (ptr) ::aspia::proto::system_info::CategoryList();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::system_info::CategoryList::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_CategoryList =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsCategoryList}, {}};
-
-static void InitDefaultsCategoryRequest() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::system_info::_CategoryRequest_default_instance_;
-    new (ptr) ::aspia::proto::system_info::CategoryRequest();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::system_info::CategoryRequest::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_CategoryRequest =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsCategoryRequest}, {}};
-
-static void InitDefaultsCategory() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::system_info::_Category_default_instance_;
-    new (ptr) ::aspia::proto::system_info::Category();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::system_info::Category::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_Category =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsCategory}, {}};
-
-static void InitDefaultsRequest() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::system_info::_Request_default_instance_;
-    new (ptr) ::aspia::proto::system_info::Request();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::system_info::Request::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<2> scc_info_Request =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 2, InitDefaultsRequest}, {
-      &protobuf_system_5finfo_5fsession_2eproto::scc_info_CategoryListRequest.base,
-      &protobuf_system_5finfo_5fsession_2eproto::scc_info_CategoryRequest.base,}};
-
-static void InitDefaultsReply() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::aspia::proto::system_info::_Reply_default_instance_;
-    new (ptr) ::aspia::proto::system_info::Reply();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::aspia::proto::system_info::Reply::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<2> scc_info_Reply =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 2, InitDefaultsReply}, {
-      &protobuf_system_5finfo_5fsession_2eproto::scc_info_CategoryList.base,
-      &protobuf_system_5finfo_5fsession_2eproto::scc_info_Category.base,}};
-
-void InitDefaults() {
-  ::google::protobuf::internal::InitSCC(&scc_info_CategoryListRequest.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_CategoryList.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_CategoryRequest.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_Category.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_Request.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_Reply.base);
-}
-
-}  // namespace protobuf_system_5finfo_5fsession_2eproto
 namespace aspia {
 namespace proto {
 namespace system_info {
 
 // ===================================================================
 
-void CategoryListRequest::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int CategoryListRequest::kDummyFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class CategoryListRequest::_Internal {
+ public:
+};
 
-CategoryListRequest::CategoryListRequest()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_system_5finfo_5fsession_2eproto::scc_info_CategoryListRequest.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.system_info.CategoryListRequest)
+CategoryListRequest::CategoryListRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.system_info.CategoryListRequest)
 }
 CategoryListRequest::CategoryListRequest(const CategoryListRequest& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  dummy_ = from.dummy_;
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  CategoryListRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.dummy_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _this->_impl_.dummy_ = from._impl_.dummy_;
   // @@protoc_insertion_point(copy_constructor:aspia.proto.system_info.CategoryListRequest)
 }
 
-void CategoryListRequest::SharedCtor() {
-  dummy_ = 0u;
+inline void CategoryListRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.dummy_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 CategoryListRequest::~CategoryListRequest() {
   // @@protoc_insertion_point(destructor:aspia.proto.system_info.CategoryListRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void CategoryListRequest::SharedDtor() {
+inline void CategoryListRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void CategoryListRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const CategoryListRequest& CategoryListRequest::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_system_5finfo_5fsession_2eproto::scc_info_CategoryListRequest.base);
-  return *internal_default_instance();
-}
-
 
 void CategoryListRequest::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.system_info.CategoryListRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  dummy_ = 0u;
-  _internal_metadata_.Clear();
-}
-
-bool CategoryListRequest::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.system_info.CategoryListRequest)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.dummy_ = 0u;
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* CategoryListRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // uint32 dummy = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &dummy_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.dummy_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.system_info.CategoryListRequest)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.system_info.CategoryListRequest)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void CategoryListRequest::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.system_info.CategoryListRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* CategoryListRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.system_info.CategoryListRequest)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // uint32 dummy = 1;
-  if (this->dummy() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->dummy(), output);
+  if (this->_internal_dummy() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_dummy(), target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.system_info.CategoryListRequest)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.system_info.CategoryListRequest)
+  return target;
 }
 
 size_t CategoryListRequest::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.system_info.CategoryListRequest)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // uint32 dummy = 1;
-  if (this->dummy() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->dummy());
+  if (this->_internal_dummy() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_dummy());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void CategoryListRequest::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const CategoryListRequest*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const CategoryListRequest*>(
+      &from));
 }
 
 void CategoryListRequest::MergeFrom(const CategoryListRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.system_info.CategoryListRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  CategoryListRequest* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.system_info.CategoryListRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.dummy() != 0) {
-    set_dummy(from.dummy());
+  if (from._internal_dummy() != 0) {
+    _this->_internal_set_dummy(from._internal_dummy());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void CategoryListRequest::CopyFrom(const CategoryListRequest& from) {
@@ -327,180 +296,185 @@ bool CategoryListRequest::IsInitialized() const {
   return true;
 }
 
-void CategoryListRequest::Swap(CategoryListRequest* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void CategoryListRequest::InternalSwap(CategoryListRequest* other) {
   using std::swap;
-  swap(dummy_, other->dummy_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.dummy_, other->_impl_.dummy_);
 }
 
-::std::string CategoryListRequest::GetTypeName() const {
+std::string CategoryListRequest::GetTypeName() const {
   return "aspia.proto.system_info.CategoryListRequest";
 }
 
 
 // ===================================================================
 
-void CategoryList::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int CategoryList::kUuidFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class CategoryList::_Internal {
+ public:
+};
 
-CategoryList::CategoryList()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_system_5finfo_5fsession_2eproto::scc_info_CategoryList.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.system_info.CategoryList)
+CategoryList::CategoryList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.system_info.CategoryList)
 }
 CategoryList::CategoryList(const CategoryList& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL),
-      uuid_(from.uuid_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  CategoryList* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.uuid_){from._impl_.uuid_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:aspia.proto.system_info.CategoryList)
 }
 
-void CategoryList::SharedCtor() {
+inline void CategoryList::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.uuid_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 CategoryList::~CategoryList() {
   // @@protoc_insertion_point(destructor:aspia.proto.system_info.CategoryList)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void CategoryList::SharedDtor() {
+inline void CategoryList::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.uuid_.~RepeatedPtrField();
 }
 
 void CategoryList::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const CategoryList& CategoryList::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_system_5finfo_5fsession_2eproto::scc_info_CategoryList.base);
-  return *internal_default_instance();
-}
-
 
 void CategoryList::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.system_info.CategoryList)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  uuid_.Clear();
-  _internal_metadata_.Clear();
-}
-
-bool CategoryList::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.system_info.CategoryList)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.uuid_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* CategoryList::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // repeated string uuid = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->add_uuid()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->uuid(this->uuid_size() - 1).data(),
-            static_cast<int>(this->uuid(this->uuid_size() - 1).length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "aspia.proto.system_info.CategoryList.uuid"));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_uuid();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, nullptr));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.system_info.CategoryList)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.system_info.CategoryList)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void CategoryList::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.system_info.CategoryList)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* CategoryList::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.system_info.CategoryList)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // repeated string uuid = 1;
-  for (int i = 0, n = this->uuid_size(); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->uuid(i).data(), static_cast<int>(this->uuid(i).length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  for (int i = 0, n = this->_internal_uuid_size(); i < n; i++) {
+    const auto& s = this->_internal_uuid(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "aspia.proto.system_info.CategoryList.uuid");
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->uuid(i), output);
+    target = stream->WriteString(1, s, target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.system_info.CategoryList)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.system_info.CategoryList)
+  return target;
 }
 
 size_t CategoryList::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.system_info.CategoryList)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // repeated string uuid = 1;
   total_size += 1 *
-      ::google::protobuf::internal::FromIntSize(this->uuid_size());
-  for (int i = 0, n = this->uuid_size(); i < n; i++) {
-    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
-      this->uuid(i));
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.uuid_.size());
+  for (int i = 0, n = _impl_.uuid_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.uuid_.Get(i));
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void CategoryList::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const CategoryList*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const CategoryList*>(
+      &from));
 }
 
 void CategoryList::MergeFrom(const CategoryList& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.system_info.CategoryList)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  CategoryList* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.system_info.CategoryList)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  uuid_.MergeFrom(from.uuid_);
+  _this->_impl_.uuid_.MergeFrom(from._impl_.uuid_);
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void CategoryList::CopyFrom(const CategoryList& from) {
@@ -514,223 +488,234 @@ bool CategoryList::IsInitialized() const {
   return true;
 }
 
-void CategoryList::Swap(CategoryList* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void CategoryList::InternalSwap(CategoryList* other) {
   using std::swap;
-  uuid_.InternalSwap(CastToBase(&other->uuid_));
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.uuid_.InternalSwap(&other->_impl_.uuid_);
 }
 
-::std::string CategoryList::GetTypeName() const {
+std::string CategoryList::GetTypeName() const {
   return "aspia.proto.system_info.CategoryList";
 }
 
 
 // ===================================================================
 
-void CategoryRequest::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int CategoryRequest::kUuidFieldNumber;
-const int CategoryRequest::kDataFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class CategoryRequest::_Internal {
+ public:
+};
 
-CategoryRequest::CategoryRequest()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_system_5finfo_5fsession_2eproto::scc_info_CategoryRequest.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.system_info.CategoryRequest)
+CategoryRequest::CategoryRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.system_info.CategoryRequest)
 }
 CategoryRequest::CategoryRequest(const CategoryRequest& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  uuid_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.uuid().size() > 0) {
-    uuid_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.uuid_);
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  CategoryRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.uuid_){}
+    , decltype(_impl_.data_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.uuid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_uuid().empty()) {
+    _this->_impl_.uuid_.Set(from._internal_uuid(), 
+      _this->GetArenaForAllocation());
   }
-  data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.data().size() > 0) {
-    data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.data_);
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_data().empty()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:aspia.proto.system_info.CategoryRequest)
 }
 
-void CategoryRequest::SharedCtor() {
-  uuid_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void CategoryRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.uuid_){}
+    , decltype(_impl_.data_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.uuid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 CategoryRequest::~CategoryRequest() {
   // @@protoc_insertion_point(destructor:aspia.proto.system_info.CategoryRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void CategoryRequest::SharedDtor() {
-  uuid_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  data_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void CategoryRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.uuid_.Destroy();
+  _impl_.data_.Destroy();
 }
 
 void CategoryRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const CategoryRequest& CategoryRequest::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_system_5finfo_5fsession_2eproto::scc_info_CategoryRequest.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void CategoryRequest::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.system_info.CategoryRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  uuid_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  _internal_metadata_.Clear();
-}
-
-bool CategoryRequest::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.system_info.CategoryRequest)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.uuid_.ClearToEmpty();
+  _impl_.data_.ClearToEmpty();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* CategoryRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string uuid = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_uuid()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->uuid().data(), static_cast<int>(this->uuid().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "aspia.proto.system_info.CategoryRequest.uuid"));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_uuid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // bytes data = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_data()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.system_info.CategoryRequest)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.system_info.CategoryRequest)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void CategoryRequest::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.system_info.CategoryRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* CategoryRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.system_info.CategoryRequest)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string uuid = 1;
-  if (this->uuid().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->uuid().data(), static_cast<int>(this->uuid().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_uuid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_uuid().data(), static_cast<int>(this->_internal_uuid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "aspia.proto.system_info.CategoryRequest.uuid");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->uuid(), output);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_uuid(), target);
   }
 
   // bytes data = 2;
-  if (this->data().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      2, this->data(), output);
+  if (!this->_internal_data().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_data(), target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.system_info.CategoryRequest)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.system_info.CategoryRequest)
+  return target;
 }
 
 size_t CategoryRequest::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.system_info.CategoryRequest)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // string uuid = 1;
-  if (this->uuid().size() > 0) {
+  if (!this->_internal_uuid().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->uuid());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_uuid());
   }
 
   // bytes data = 2;
-  if (this->data().size() > 0) {
+  if (!this->_internal_data().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->data());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void CategoryRequest::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const CategoryRequest*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const CategoryRequest*>(
+      &from));
 }
 
 void CategoryRequest::MergeFrom(const CategoryRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.system_info.CategoryRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  CategoryRequest* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.system_info.CategoryRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.uuid().size() > 0) {
-
-    uuid_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.uuid_);
+  if (!from._internal_uuid().empty()) {
+    _this->_internal_set_uuid(from._internal_uuid());
   }
-  if (from.data().size() > 0) {
-
-    data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.data_);
+  if (!from._internal_data().empty()) {
+    _this->_internal_set_data(from._internal_data());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void CategoryRequest::CopyFrom(const CategoryRequest& from) {
@@ -744,226 +729,555 @@ bool CategoryRequest::IsInitialized() const {
   return true;
 }
 
-void CategoryRequest::Swap(CategoryRequest* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void CategoryRequest::InternalSwap(CategoryRequest* other) {
   using std::swap;
-  uuid_.Swap(&other->uuid_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  data_.Swap(&other->data_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-}
-
-::std::string CategoryRequest::GetTypeName() const {
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.uuid_, lhs_arena,
+      &other->_impl_.uuid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+}
+
+std::string CategoryRequest::GetTypeName() const {
   return "aspia.proto.system_info.CategoryRequest";
 }
 
 
 // ===================================================================
 
-void Category::InitAsDefaultInstance() {
+class CategoryBatchRequest::_Internal {
+ public:
+};
+
+CategoryBatchRequest::CategoryBatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.system_info.CategoryBatchRequest)
+}
+CategoryBatchRequest::CategoryBatchRequest(const CategoryBatchRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  CategoryBatchRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.uuid_){from._impl_.uuid_}
+    , decltype(_impl_.compress_){}
+    , decltype(_impl_.compression_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::memcpy(&_impl_.compress_, &from._impl_.compress_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.compression_) -
+    reinterpret_cast<char*>(&_impl_.compress_)) + sizeof(_impl_.compression_));
+  // @@protoc_insertion_point(copy_constructor:aspia.proto.system_info.CategoryBatchRequest)
+}
+
+inline void CategoryBatchRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.uuid_){arena}
+    , decltype(_impl_.compress_){false}
+    , decltype(_impl_.compression_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+CategoryBatchRequest::~CategoryBatchRequest() {
+  // @@protoc_insertion_point(destructor:aspia.proto.system_info.CategoryBatchRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CategoryBatchRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.uuid_.~RepeatedPtrField();
+}
+
+void CategoryBatchRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CategoryBatchRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:aspia.proto.system_info.CategoryBatchRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.uuid_.Clear();
+  ::memset(&_impl_.compress_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.compression_) -
+      reinterpret_cast<char*>(&_impl_.compress_)) + sizeof(_impl_.compression_));
+  _internal_metadata_.Clear<std::string>();
 }
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Category::kUuidFieldNumber;
-const int Category::kDataFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-Category::Category()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_system_5finfo_5fsession_2eproto::scc_info_Category.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.system_info.Category)
+const char* CategoryBatchRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated string uuid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_uuid();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, nullptr));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool compress = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.compress_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .aspia.proto.desktop.Compression compression = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_compression(static_cast<::aspia::proto::desktop::Compression>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CategoryBatchRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.system_info.CategoryBatchRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated string uuid = 1;
+  for (int i = 0, n = this->_internal_uuid_size(); i < n; i++) {
+    const auto& s = this->_internal_uuid(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "aspia.proto.system_info.CategoryBatchRequest.uuid");
+    target = stream->WriteString(1, s, target);
+  }
+
+  // bool compress = 2;
+  if (this->_internal_compress() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_compress(), target);
+  }
+
+  // .aspia.proto.desktop.Compression compression = 3;
+  if (this->_internal_compression() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_compression(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.system_info.CategoryBatchRequest)
+  return target;
+}
+
+size_t CategoryBatchRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aspia.proto.system_info.CategoryBatchRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string uuid = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.uuid_.size());
+  for (int i = 0, n = _impl_.uuid_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.uuid_.Get(i));
+  }
+
+  // bool compress = 2;
+  if (this->_internal_compress() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // .aspia.proto.desktop.Compression compression = 3;
+  if (this->_internal_compression() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_compression());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void CategoryBatchRequest::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const CategoryBatchRequest*>(
+      &from));
+}
+
+void CategoryBatchRequest::MergeFrom(const CategoryBatchRequest& from) {
+  CategoryBatchRequest* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.system_info.CategoryBatchRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.uuid_.MergeFrom(from._impl_.uuid_);
+  if (from._internal_compress() != 0) {
+    _this->_internal_set_compress(from._internal_compress());
+  }
+  if (from._internal_compression() != 0) {
+    _this->_internal_set_compression(from._internal_compression());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void CategoryBatchRequest::CopyFrom(const CategoryBatchRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aspia.proto.system_info.CategoryBatchRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CategoryBatchRequest::IsInitialized() const {
+  return true;
+}
+
+void CategoryBatchRequest::InternalSwap(CategoryBatchRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.uuid_.InternalSwap(&other->_impl_.uuid_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CategoryBatchRequest, _impl_.compression_)
+      + sizeof(CategoryBatchRequest::_impl_.compression_)
+      - PROTOBUF_FIELD_OFFSET(CategoryBatchRequest, _impl_.compress_)>(
+          reinterpret_cast<char*>(&_impl_.compress_),
+          reinterpret_cast<char*>(&other->_impl_.compress_));
+}
+
+std::string CategoryBatchRequest::GetTypeName() const {
+  return "aspia.proto.system_info.CategoryBatchRequest";
+}
+
+
+// ===================================================================
+
+class Category::_Internal {
+ public:
+};
+
+Category::Category(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.system_info.Category)
 }
 Category::Category(const Category& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  uuid_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.uuid().size() > 0) {
-    uuid_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.uuid_);
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  Category* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.uuid_){}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.compression_){}
+    , decltype(_impl_.uncompressed_size_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.uuid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_uuid().empty()) {
+    _this->_impl_.uuid_.Set(from._internal_uuid(), 
+      _this->GetArenaForAllocation());
   }
-  data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.data().size() > 0) {
-    data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.data_);
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_data().empty()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
   }
+  ::memcpy(&_impl_.compression_, &from._impl_.compression_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.uncompressed_size_) -
+    reinterpret_cast<char*>(&_impl_.compression_)) + sizeof(_impl_.uncompressed_size_));
   // @@protoc_insertion_point(copy_constructor:aspia.proto.system_info.Category)
 }
 
-void Category::SharedCtor() {
-  uuid_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void Category::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.uuid_){}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.compression_){0}
+    , decltype(_impl_.uncompressed_size_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.uuid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Category::~Category() {
   // @@protoc_insertion_point(destructor:aspia.proto.system_info.Category)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Category::SharedDtor() {
-  uuid_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  data_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void Category::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.uuid_.Destroy();
+  _impl_.data_.Destroy();
 }
 
 void Category::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const Category& Category::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_system_5finfo_5fsession_2eproto::scc_info_Category.base);
-  return *internal_default_instance();
-}
-
 
 void Category::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.system_info.Category)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  uuid_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  _internal_metadata_.Clear();
-}
-
-bool Category::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.system_info.Category)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.uuid_.ClearToEmpty();
+  _impl_.data_.ClearToEmpty();
+  ::memset(&_impl_.compression_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.uncompressed_size_) -
+      reinterpret_cast<char*>(&_impl_.compression_)) + sizeof(_impl_.uncompressed_size_));
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* Category::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string uuid = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_uuid()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->uuid().data(), static_cast<int>(this->uuid().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "aspia.proto.system_info.Category.uuid"));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_uuid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // bytes data = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_data()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .aspia.proto.desktop.Compression compression = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_compression(static_cast<::aspia::proto::desktop::Compression>(val));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+        continue;
+      // uint32 uncompressed_size = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.uncompressed_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.system_info.Category)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.system_info.Category)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void Category::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.system_info.Category)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* Category::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.system_info.Category)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string uuid = 1;
-  if (this->uuid().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->uuid().data(), static_cast<int>(this->uuid().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_uuid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_uuid().data(), static_cast<int>(this->_internal_uuid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "aspia.proto.system_info.Category.uuid");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->uuid(), output);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_uuid(), target);
   }
 
   // bytes data = 2;
-  if (this->data().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      2, this->data(), output);
+  if (!this->_internal_data().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_data(), target);
+  }
+
+  // .aspia.proto.desktop.Compression compression = 3;
+  if (this->_internal_compression() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_compression(), target);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.system_info.Category)
+  // uint32 uncompressed_size = 4;
+  if (this->_internal_uncompressed_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_uncompressed_size(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.system_info.Category)
+  return target;
 }
 
 size_t Category::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.system_info.Category)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // string uuid = 1;
-  if (this->uuid().size() > 0) {
+  if (!this->_internal_uuid().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->uuid());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_uuid());
   }
 
   // bytes data = 2;
-  if (this->data().size() > 0) {
+  if (!this->_internal_data().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
+  }
+
+  // .aspia.proto.desktop.Compression compression = 3;
+  if (this->_internal_compression() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->data());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_compression());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  // uint32 uncompressed_size = 4;
+  if (this->_internal_uncompressed_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_uncompressed_size());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void Category::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const Category*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const Category*>(
+      &from));
 }
 
 void Category::MergeFrom(const Category& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.system_info.Category)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  Category* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.system_info.Category)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.uuid().size() > 0) {
-
-    uuid_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.uuid_);
+  if (!from._internal_uuid().empty()) {
+    _this->_internal_set_uuid(from._internal_uuid());
   }
-  if (from.data().size() > 0) {
-
-    data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.data_);
+  if (!from._internal_data().empty()) {
+    _this->_internal_set_data(from._internal_data());
+  }
+  if (from._internal_compression() != 0) {
+    _this->_internal_set_compression(from._internal_compression());
   }
+  if (from._internal_uncompressed_size() != 0) {
+    _this->_internal_set_uncompressed_size(from._internal_uncompressed_size());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void Category::CopyFrom(const Category& from) {
@@ -977,229 +1291,285 @@ bool Category::IsInitialized() const {
   return true;
 }
 
-void Category::Swap(Category* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void Category::InternalSwap(Category* other) {
   using std::swap;
-  uuid_.Swap(&other->uuid_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  data_.Swap(&other->data_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-}
-
-::std::string Category::GetTypeName() const {
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.uuid_, lhs_arena,
+      &other->_impl_.uuid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Category, _impl_.uncompressed_size_)
+      + sizeof(Category::_impl_.uncompressed_size_)
+      - PROTOBUF_FIELD_OFFSET(Category, _impl_.compression_)>(
+          reinterpret_cast<char*>(&_impl_.compression_),
+          reinterpret_cast<char*>(&other->_impl_.compression_));
+}
+
+std::string Category::GetTypeName() const {
   return "aspia.proto.system_info.Category";
 }
 
 
 // ===================================================================
 
-void Request::InitAsDefaultInstance() {
-  ::aspia::proto::system_info::_Request_default_instance_._instance.get_mutable()->category_list_request_ = const_cast< ::aspia::proto::system_info::CategoryListRequest*>(
-      ::aspia::proto::system_info::CategoryListRequest::internal_default_instance());
-  ::aspia::proto::system_info::_Request_default_instance_._instance.get_mutable()->category_request_ = const_cast< ::aspia::proto::system_info::CategoryRequest*>(
-      ::aspia::proto::system_info::CategoryRequest::internal_default_instance());
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Request::kCategoryListRequestFieldNumber;
-const int Request::kCategoryRequestFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class Request::_Internal {
+ public:
+  static const ::aspia::proto::system_info::CategoryListRequest& category_list_request(const Request* msg);
+  static const ::aspia::proto::system_info::CategoryRequest& category_request(const Request* msg);
+  static const ::aspia::proto::system_info::CategoryBatchRequest& category_batch_request(const Request* msg);
+};
 
-Request::Request()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_system_5finfo_5fsession_2eproto::scc_info_Request.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.system_info.Request)
+const ::aspia::proto::system_info::CategoryListRequest&
+Request::_Internal::category_list_request(const Request* msg) {
+  return *msg->_impl_.category_list_request_;
+}
+const ::aspia::proto::system_info::CategoryRequest&
+Request::_Internal::category_request(const Request* msg) {
+  return *msg->_impl_.category_request_;
+}
+const ::aspia::proto::system_info::CategoryBatchRequest&
+Request::_Internal::category_batch_request(const Request* msg) {
+  return *msg->_impl_.category_batch_request_;
+}
+Request::Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.system_info.Request)
 }
 Request::Request(const Request& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.has_category_list_request()) {
-    category_list_request_ = new ::aspia::proto::system_info::CategoryListRequest(*from.category_list_request_);
-  } else {
-    category_list_request_ = NULL;
-  }
-  if (from.has_category_request()) {
-    category_request_ = new ::aspia::proto::system_info::CategoryRequest(*from.category_request_);
-  } else {
-    category_request_ = NULL;
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  Request* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.category_list_request_){nullptr}
+    , decltype(_impl_.category_request_){nullptr}
+    , decltype(_impl_.category_batch_request_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  if (from._internal_has_category_list_request()) {
+    _this->_impl_.category_list_request_ = new ::aspia::proto::system_info::CategoryListRequest(*from._impl_.category_list_request_);
+  }
+  if (from._internal_has_category_request()) {
+    _this->_impl_.category_request_ = new ::aspia::proto::system_info::CategoryRequest(*from._impl_.category_request_);
+  }
+  if (from._internal_has_category_batch_request()) {
+    _this->_impl_.category_batch_request_ = new ::aspia::proto::system_info::CategoryBatchRequest(*from._impl_.category_batch_request_);
   }
   // @@protoc_insertion_point(copy_constructor:aspia.proto.system_info.Request)
 }
 
-void Request::SharedCtor() {
-  ::memset(&category_list_request_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&category_request_) -
-      reinterpret_cast<char*>(&category_list_request_)) + sizeof(category_request_));
+inline void Request::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.category_list_request_){nullptr}
+    , decltype(_impl_.category_request_){nullptr}
+    , decltype(_impl_.category_batch_request_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 Request::~Request() {
   // @@protoc_insertion_point(destructor:aspia.proto.system_info.Request)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Request::SharedDtor() {
-  if (this != internal_default_instance()) delete category_list_request_;
-  if (this != internal_default_instance()) delete category_request_;
+inline void Request::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.category_list_request_;
+  if (this != internal_default_instance()) delete _impl_.category_request_;
+  if (this != internal_default_instance()) delete _impl_.category_batch_request_;
 }
 
 void Request::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const Request& Request::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_system_5finfo_5fsession_2eproto::scc_info_Request.base);
-  return *internal_default_instance();
-}
-
 
 void Request::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.system_info.Request)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaNoVirtual() == NULL && category_list_request_ != NULL) {
-    delete category_list_request_;
-  }
-  category_list_request_ = NULL;
-  if (GetArenaNoVirtual() == NULL && category_request_ != NULL) {
-    delete category_request_;
-  }
-  category_request_ = NULL;
-  _internal_metadata_.Clear();
-}
-
-bool Request::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.system_info.Request)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  if (GetArenaForAllocation() == nullptr && _impl_.category_list_request_ != nullptr) {
+    delete _impl_.category_list_request_;
+  }
+  _impl_.category_list_request_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.category_request_ != nullptr) {
+    delete _impl_.category_request_;
+  }
+  _impl_.category_request_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.category_batch_request_ != nullptr) {
+    delete _impl_.category_batch_request_;
+  }
+  _impl_.category_batch_request_ = nullptr;
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // .aspia.proto.system_info.CategoryListRequest category_list_request = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_category_list_request()));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_category_list_request(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .aspia.proto.system_info.CategoryRequest category_request = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_category_request()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_category_request(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+        continue;
+      // .aspia.proto.system_info.CategoryBatchRequest category_batch_request = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_category_batch_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.system_info.Request)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.system_info.Request)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void Request::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.system_info.Request)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* Request::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.system_info.Request)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .aspia.proto.system_info.CategoryListRequest category_list_request = 1;
-  if (this->has_category_list_request()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      1, this->_internal_category_list_request(), output);
+  if (this->_internal_has_category_list_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::category_list_request(this),
+        _Internal::category_list_request(this).GetCachedSize(), target, stream);
   }
 
   // .aspia.proto.system_info.CategoryRequest category_request = 2;
-  if (this->has_category_request()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      2, this->_internal_category_request(), output);
+  if (this->_internal_has_category_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::category_request(this),
+        _Internal::category_request(this).GetCachedSize(), target, stream);
+  }
+
+  // .aspia.proto.system_info.CategoryBatchRequest category_batch_request = 3;
+  if (this->_internal_has_category_batch_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::category_batch_request(this),
+        _Internal::category_batch_request(this).GetCachedSize(), target, stream);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.system_info.Request)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.system_info.Request)
+  return target;
 }
 
 size_t Request::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.system_info.Request)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // .aspia.proto.system_info.CategoryListRequest category_list_request = 1;
-  if (this->has_category_list_request()) {
+  if (this->_internal_has_category_list_request()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *category_list_request_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.category_list_request_);
   }
 
   // .aspia.proto.system_info.CategoryRequest category_request = 2;
-  if (this->has_category_request()) {
+  if (this->_internal_has_category_request()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.category_request_);
+  }
+
+  // .aspia.proto.system_info.CategoryBatchRequest category_batch_request = 3;
+  if (this->_internal_has_category_batch_request()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *category_request_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.category_batch_request_);
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void Request::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const Request*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const Request*>(
+      &from));
 }
 
 void Request::MergeFrom(const Request& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.system_info.Request)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  Request* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.system_info.Request)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.has_category_list_request()) {
-    mutable_category_list_request()->::aspia::proto::system_info::CategoryListRequest::MergeFrom(from.category_list_request());
+  if (from._internal_has_category_list_request()) {
+    _this->_internal_mutable_category_list_request()->::aspia::proto::system_info::CategoryListRequest::MergeFrom(
+        from._internal_category_list_request());
+  }
+  if (from._internal_has_category_request()) {
+    _this->_internal_mutable_category_request()->::aspia::proto::system_info::CategoryRequest::MergeFrom(
+        from._internal_category_request());
   }
-  if (from.has_category_request()) {
-    mutable_category_request()->::aspia::proto::system_info::CategoryRequest::MergeFrom(from.category_request());
+  if (from._internal_has_category_batch_request()) {
+    _this->_internal_mutable_category_batch_request()->::aspia::proto::system_info::CategoryBatchRequest::MergeFrom(
+        from._internal_category_batch_request());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void Request::CopyFrom(const Request& from) {
@@ -1213,227 +1583,234 @@ bool Request::IsInitialized() const {
   return true;
 }
 
-void Request::Swap(Request* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void Request::InternalSwap(Request* other) {
   using std::swap;
-  swap(category_list_request_, other->category_list_request_);
-  swap(category_request_, other->category_request_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Request, _impl_.category_batch_request_)
+      + sizeof(Request::_impl_.category_batch_request_)
+      - PROTOBUF_FIELD_OFFSET(Request, _impl_.category_list_request_)>(
+          reinterpret_cast<char*>(&_impl_.category_list_request_),
+          reinterpret_cast<char*>(&other->_impl_.category_list_request_));
 }
 
-::std::string Request::GetTypeName() const {
+std::string Request::GetTypeName() const {
   return "aspia.proto.system_info.Request";
 }
 
 
 // ===================================================================
 
-void Reply::InitAsDefaultInstance() {
-  ::aspia::proto::system_info::_Reply_default_instance_._instance.get_mutable()->category_list_ = const_cast< ::aspia::proto::system_info::CategoryList*>(
-      ::aspia::proto::system_info::CategoryList::internal_default_instance());
-  ::aspia::proto::system_info::_Reply_default_instance_._instance.get_mutable()->category_ = const_cast< ::aspia::proto::system_info::Category*>(
-      ::aspia::proto::system_info::Category::internal_default_instance());
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Reply::kCategoryListFieldNumber;
-const int Reply::kCategoryFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class Reply::_Internal {
+ public:
+  static const ::aspia::proto::system_info::CategoryList& category_list(const Reply* msg);
+  static const ::aspia::proto::system_info::Category& category(const Reply* msg);
+};
 
-Reply::Reply()
-  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_system_5finfo_5fsession_2eproto::scc_info_Reply.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:aspia.proto.system_info.Reply)
+const ::aspia::proto::system_info::CategoryList&
+Reply::_Internal::category_list(const Reply* msg) {
+  return *msg->_impl_.category_list_;
+}
+const ::aspia::proto::system_info::Category&
+Reply::_Internal::category(const Reply* msg) {
+  return *msg->_impl_.category_;
+}
+Reply::Reply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:aspia.proto.system_info.Reply)
 }
 Reply::Reply(const Reply& from)
-  : ::google::protobuf::MessageLite(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.has_category_list()) {
-    category_list_ = new ::aspia::proto::system_info::CategoryList(*from.category_list_);
-  } else {
-    category_list_ = NULL;
-  }
-  if (from.has_category()) {
-    category_ = new ::aspia::proto::system_info::Category(*from.category_);
-  } else {
-    category_ = NULL;
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  Reply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.category_list_){nullptr}
+    , decltype(_impl_.category_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  if (from._internal_has_category_list()) {
+    _this->_impl_.category_list_ = new ::aspia::proto::system_info::CategoryList(*from._impl_.category_list_);
+  }
+  if (from._internal_has_category()) {
+    _this->_impl_.category_ = new ::aspia::proto::system_info::Category(*from._impl_.category_);
   }
   // @@protoc_insertion_point(copy_constructor:aspia.proto.system_info.Reply)
 }
 
-void Reply::SharedCtor() {
-  ::memset(&category_list_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&category_) -
-      reinterpret_cast<char*>(&category_list_)) + sizeof(category_));
+inline void Reply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.category_list_){nullptr}
+    , decltype(_impl_.category_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 Reply::~Reply() {
   // @@protoc_insertion_point(destructor:aspia.proto.system_info.Reply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Reply::SharedDtor() {
-  if (this != internal_default_instance()) delete category_list_;
-  if (this != internal_default_instance()) delete category_;
+inline void Reply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.category_list_;
+  if (this != internal_default_instance()) delete _impl_.category_;
 }
 
 void Reply::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const Reply& Reply::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_system_5finfo_5fsession_2eproto::scc_info_Reply.base);
-  return *internal_default_instance();
-}
-
 
 void Reply::Clear() {
 // @@protoc_insertion_point(message_clear_start:aspia.proto.system_info.Reply)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaNoVirtual() == NULL && category_list_ != NULL) {
-    delete category_list_;
-  }
-  category_list_ = NULL;
-  if (GetArenaNoVirtual() == NULL && category_ != NULL) {
-    delete category_;
-  }
-  category_ = NULL;
-  _internal_metadata_.Clear();
-}
-
-bool Reply::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::LiteUnknownFieldSetter unknown_fields_setter(
-      &_internal_metadata_);
-  ::google::protobuf::io::StringOutputStream unknown_fields_output(
-      unknown_fields_setter.buffer());
-  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-      &unknown_fields_output, false);
-  // @@protoc_insertion_point(parse_start:aspia.proto.system_info.Reply)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  if (GetArenaForAllocation() == nullptr && _impl_.category_list_ != nullptr) {
+    delete _impl_.category_list_;
+  }
+  _impl_.category_list_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.category_ != nullptr) {
+    delete _impl_.category_;
+  }
+  _impl_.category_ = nullptr;
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* Reply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // .aspia.proto.system_info.CategoryList category_list = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_category_list()));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_category_list(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .aspia.proto.system_info.Category category = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_category()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_category(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
-            input, tag, &unknown_fields_stream));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:aspia.proto.system_info.Reply)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:aspia.proto.system_info.Reply)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void Reply::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:aspia.proto.system_info.Reply)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* Reply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aspia.proto.system_info.Reply)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .aspia.proto.system_info.CategoryList category_list = 1;
-  if (this->has_category_list()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      1, this->_internal_category_list(), output);
+  if (this->_internal_has_category_list()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::category_list(this),
+        _Internal::category_list(this).GetCachedSize(), target, stream);
   }
 
   // .aspia.proto.system_info.Category category = 2;
-  if (this->has_category()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessage(
-      2, this->_internal_category(), output);
+  if (this->_internal_has_category()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::category(this),
+        _Internal::category(this).GetCachedSize(), target, stream);
   }
 
-  output->WriteRaw((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).data(),
-                   static_cast<int>((::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size()));
-  // @@protoc_insertion_point(serialize_end:aspia.proto.system_info.Reply)
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aspia.proto.system_info.Reply)
+  return target;
 }
 
 size_t Reply::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:aspia.proto.system_info.Reply)
   size_t total_size = 0;
 
-  total_size += (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()).size();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // .aspia.proto.system_info.CategoryList category_list = 1;
-  if (this->has_category_list()) {
+  if (this->_internal_has_category_list()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *category_list_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.category_list_);
   }
 
   // .aspia.proto.system_info.Category category = 2;
-  if (this->has_category()) {
+  if (this->_internal_has_category()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *category_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.category_);
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void Reply::CheckTypeAndMergeFrom(
-    const ::google::protobuf::MessageLite& from) {
-  MergeFrom(*::google::protobuf::down_cast<const Reply*>(&from));
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const Reply*>(
+      &from));
 }
 
 void Reply::MergeFrom(const Reply& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.system_info.Reply)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  Reply* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:aspia.proto.system_info.Reply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.has_category_list()) {
-    mutable_category_list()->::aspia::proto::system_info::CategoryList::MergeFrom(from.category_list());
+  if (from._internal_has_category_list()) {
+    _this->_internal_mutable_category_list()->::aspia::proto::system_info::CategoryList::MergeFrom(
+        from._internal_category_list());
   }
-  if (from.has_category()) {
-    mutable_category()->::aspia::proto::system_info::Category::MergeFrom(from.category());
+  if (from._internal_has_category()) {
+    _this->_internal_mutable_category()->::aspia::proto::system_info::Category::MergeFrom(
+        from._internal_category());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void Reply::CopyFrom(const Reply& from) {
@@ -1447,18 +1824,18 @@ bool Reply::IsInitialized() const {
   return true;
 }
 
-void Reply::Swap(Reply* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void Reply::InternalSwap(Reply* other) {
   using std::swap;
-  swap(category_list_, other->category_list_);
-  swap(category_, other->category_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Reply, _impl_.category_)
+      + sizeof(Reply::_impl_.category_)
+      - PROTOBUF_FIELD_OFFSET(Reply, _impl_.category_list_)>(
+          reinterpret_cast<char*>(&_impl_.category_list_),
+          reinterpret_cast<char*>(&other->_impl_.category_list_));
 }
 
-::std::string Reply::GetTypeName() const {
+std::string Reply::GetTypeName() const {
   return "aspia.proto.system_info.Reply";
 }
 
@@ -1467,27 +1844,36 @@ void Reply::InternalSwap(Reply* other) {
 }  // namespace system_info
 }  // namespace proto
 }  // namespace aspia
-namespace google {
-namespace protobuf {
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::system_info::CategoryListRequest* Arena::CreateMaybeMessage< ::aspia::proto::system_info::CategoryListRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::system_info::CategoryListRequest >(arena);
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::aspia::proto::system_info::CategoryListRequest*
+Arena::CreateMaybeMessage< ::aspia::proto::system_info::CategoryListRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::system_info::CategoryListRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::aspia::proto::system_info::CategoryList*
+Arena::CreateMaybeMessage< ::aspia::proto::system_info::CategoryList >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::system_info::CategoryList >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::system_info::CategoryList* Arena::CreateMaybeMessage< ::aspia::proto::system_info::CategoryList >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::system_info::CategoryList >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::system_info::CategoryRequest*
+Arena::CreateMaybeMessage< ::aspia::proto::system_info::CategoryRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::system_info::CategoryRequest >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::system_info::CategoryRequest* Arena::CreateMaybeMessage< ::aspia::proto::system_info::CategoryRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::system_info::CategoryRequest >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::system_info::CategoryBatchRequest*
+Arena::CreateMaybeMessage< ::aspia::proto::system_info::CategoryBatchRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::system_info::CategoryBatchRequest >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::system_info::Category* Arena::CreateMaybeMessage< ::aspia::proto::system_info::Category >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::system_info::Category >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::system_info::Category*
+Arena::CreateMaybeMessage< ::aspia::proto::system_info::Category >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::system_info::Category >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::system_info::Request* Arena::CreateMaybeMessage< ::aspia::proto::system_info::Request >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::system_info::Request >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::system_info::Request*
+Arena::CreateMaybeMessage< ::aspia::proto::system_info::Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::system_info::Request >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::aspia::proto::system_info::Reply* Arena::CreateMaybeMessage< ::aspia::proto::system_info::Reply >(Arena* arena) {
-  return Arena::CreateInternal< ::aspia::proto::system_info::Reply >(arena);
+template<> PROTOBUF_NOINLINE ::aspia::proto::system_info::Reply*
+Arena::CreateMaybeMessage< ::aspia::proto::system_info::Reply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aspia::proto::system_info::Reply >(arena);
 }
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
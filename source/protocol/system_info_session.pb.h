@@ -1,117 +1,123 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: system_info_session.proto
 
-#ifndef PROTOBUF_INCLUDED_system_5finfo_5fsession_2eproto
-#define PROTOBUF_INCLUDED_system_5finfo_5fsession_2eproto
+#ifndef GOOGLE_PROTOBUF_INCLUDED_system_5finfo_5fsession_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_system_5finfo_5fsession_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3006000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3006000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/message_lite.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include "desktop_session.pb.h"
 // @@protoc_insertion_point(includes)
-#define PROTOBUF_INTERNAL_EXPORT_protobuf_system_5finfo_5fsession_2eproto 
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_system_5finfo_5fsession_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
 
-namespace protobuf_system_5finfo_5fsession_2eproto {
 // Internal implementation detail -- do not use these members.
-struct TableStruct {
-  static const ::google::protobuf::internal::ParseTableField entries[];
-  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
-  static const ::google::protobuf::internal::ParseTable schema[6];
-  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
-  static const ::google::protobuf::internal::SerializationTable serialization_table[];
-  static const ::google::protobuf::uint32 offsets[];
+struct TableStruct_system_5finfo_5fsession_2eproto {
+  static const uint32_t offsets[];
 };
-}  // namespace protobuf_system_5finfo_5fsession_2eproto
 namespace aspia {
 namespace proto {
 namespace system_info {
 class Category;
-class CategoryDefaultTypeInternal;
+struct CategoryDefaultTypeInternal;
 extern CategoryDefaultTypeInternal _Category_default_instance_;
+class CategoryBatchRequest;
+struct CategoryBatchRequestDefaultTypeInternal;
+extern CategoryBatchRequestDefaultTypeInternal _CategoryBatchRequest_default_instance_;
 class CategoryList;
-class CategoryListDefaultTypeInternal;
+struct CategoryListDefaultTypeInternal;
 extern CategoryListDefaultTypeInternal _CategoryList_default_instance_;
 class CategoryListRequest;
-class CategoryListRequestDefaultTypeInternal;
+struct CategoryListRequestDefaultTypeInternal;
 extern CategoryListRequestDefaultTypeInternal _CategoryListRequest_default_instance_;
 class CategoryRequest;
-class CategoryRequestDefaultTypeInternal;
+struct CategoryRequestDefaultTypeInternal;
 extern CategoryRequestDefaultTypeInternal _CategoryRequest_default_instance_;
 class Reply;
-class ReplyDefaultTypeInternal;
+struct ReplyDefaultTypeInternal;
 extern ReplyDefaultTypeInternal _Reply_default_instance_;
 class Request;
-class RequestDefaultTypeInternal;
+struct RequestDefaultTypeInternal;
 extern RequestDefaultTypeInternal _Request_default_instance_;
 }  // namespace system_info
 }  // namespace proto
 }  // namespace aspia
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 template<> ::aspia::proto::system_info::Category* Arena::CreateMaybeMessage<::aspia::proto::system_info::Category>(Arena*);
+template<> ::aspia::proto::system_info::CategoryBatchRequest* Arena::CreateMaybeMessage<::aspia::proto::system_info::CategoryBatchRequest>(Arena*);
 template<> ::aspia::proto::system_info::CategoryList* Arena::CreateMaybeMessage<::aspia::proto::system_info::CategoryList>(Arena*);
 template<> ::aspia::proto::system_info::CategoryListRequest* Arena::CreateMaybeMessage<::aspia::proto::system_info::CategoryListRequest>(Arena*);
 template<> ::aspia::proto::system_info::CategoryRequest* Arena::CreateMaybeMessage<::aspia::proto::system_info::CategoryRequest>(Arena*);
 template<> ::aspia::proto::system_info::Reply* Arena::CreateMaybeMessage<::aspia::proto::system_info::Reply>(Arena*);
 template<> ::aspia::proto::system_info::Request* Arena::CreateMaybeMessage<::aspia::proto::system_info::Request>(Arena*);
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 namespace aspia {
 namespace proto {
 namespace system_info {
 
 // ===================================================================
 
-class CategoryListRequest : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.system_info.CategoryListRequest) */ {
+class CategoryListRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.system_info.CategoryListRequest) */ {
  public:
-  CategoryListRequest();
-  virtual ~CategoryListRequest();
+  inline CategoryListRequest() : CategoryListRequest(nullptr) {}
+  ~CategoryListRequest() override;
+  explicit PROTOBUF_CONSTEXPR CategoryListRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   CategoryListRequest(const CategoryListRequest& from);
-
-  inline CategoryListRequest& operator=(const CategoryListRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   CategoryListRequest(CategoryListRequest&& from) noexcept
     : CategoryListRequest() {
     *this = ::std::move(from);
   }
 
+  inline CategoryListRequest& operator=(const CategoryListRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline CategoryListRequest& operator=(CategoryListRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const CategoryListRequest& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const CategoryListRequest& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const CategoryListRequest* internal_default_instance() {
     return reinterpret_cast<const CategoryListRequest*>(
                &_CategoryListRequest_default_instance_);
@@ -119,100 +125,129 @@ class CategoryListRequest : public ::google::protobuf::MessageLite /* @@protoc_i
   static constexpr int kIndexInFileMessages =
     0;
 
-  void Swap(CategoryListRequest* other);
   friend void swap(CategoryListRequest& a, CategoryListRequest& b) {
     a.Swap(&b);
   }
+  inline void Swap(CategoryListRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CategoryListRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline CategoryListRequest* New() const final {
-    return CreateMaybeMessage<CategoryListRequest>(NULL);
-  }
-
-  CategoryListRequest* New(::google::protobuf::Arena* arena) const final {
+  CategoryListRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<CategoryListRequest>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const CategoryListRequest& from);
   void MergeFrom(const CategoryListRequest& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(CategoryListRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.system_info.CategoryListRequest";
   }
+  protected:
+  explicit CategoryListRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kDummyFieldNumber = 1,
+  };
   // uint32 dummy = 1;
   void clear_dummy();
-  static const int kDummyFieldNumber = 1;
-  ::google::protobuf::uint32 dummy() const;
-  void set_dummy(::google::protobuf::uint32 value);
+  uint32_t dummy() const;
+  void set_dummy(uint32_t value);
+  private:
+  uint32_t _internal_dummy() const;
+  void _internal_set_dummy(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:aspia.proto.system_info.CategoryListRequest)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::uint32 dummy_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_system_5finfo_5fsession_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t dummy_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_system_5finfo_5fsession_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CategoryList : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.system_info.CategoryList) */ {
+class CategoryList final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.system_info.CategoryList) */ {
  public:
-  CategoryList();
-  virtual ~CategoryList();
+  inline CategoryList() : CategoryList(nullptr) {}
+  ~CategoryList() override;
+  explicit PROTOBUF_CONSTEXPR CategoryList(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   CategoryList(const CategoryList& from);
-
-  inline CategoryList& operator=(const CategoryList& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   CategoryList(CategoryList&& from) noexcept
     : CategoryList() {
     *this = ::std::move(from);
   }
 
+  inline CategoryList& operator=(const CategoryList& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline CategoryList& operator=(CategoryList&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const CategoryList& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const CategoryList& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const CategoryList* internal_default_instance() {
     return reinterpret_cast<const CategoryList*>(
                &_CategoryList_default_instance_);
@@ -220,116 +255,144 @@ class CategoryList : public ::google::protobuf::MessageLite /* @@protoc_insertio
   static constexpr int kIndexInFileMessages =
     1;
 
-  void Swap(CategoryList* other);
   friend void swap(CategoryList& a, CategoryList& b) {
     a.Swap(&b);
   }
+  inline void Swap(CategoryList* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CategoryList* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline CategoryList* New() const final {
-    return CreateMaybeMessage<CategoryList>(NULL);
-  }
-
-  CategoryList* New(::google::protobuf::Arena* arena) const final {
+  CategoryList* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<CategoryList>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const CategoryList& from);
   void MergeFrom(const CategoryList& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(CategoryList* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.system_info.CategoryList";
   }
+  protected:
+  explicit CategoryList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kUuidFieldNumber = 1,
+  };
   // repeated string uuid = 1;
   int uuid_size() const;
+  private:
+  int _internal_uuid_size() const;
+  public:
   void clear_uuid();
-  static const int kUuidFieldNumber = 1;
-  const ::std::string& uuid(int index) const;
-  ::std::string* mutable_uuid(int index);
-  void set_uuid(int index, const ::std::string& value);
-  #if LANG_CXX11
-  void set_uuid(int index, ::std::string&& value);
-  #endif
+  const std::string& uuid(int index) const;
+  std::string* mutable_uuid(int index);
+  void set_uuid(int index, const std::string& value);
+  void set_uuid(int index, std::string&& value);
   void set_uuid(int index, const char* value);
   void set_uuid(int index, const char* value, size_t size);
-  ::std::string* add_uuid();
-  void add_uuid(const ::std::string& value);
-  #if LANG_CXX11
-  void add_uuid(::std::string&& value);
-  #endif
+  std::string* add_uuid();
+  void add_uuid(const std::string& value);
+  void add_uuid(std::string&& value);
   void add_uuid(const char* value);
   void add_uuid(const char* value, size_t size);
-  const ::google::protobuf::RepeatedPtrField< ::std::string>& uuid() const;
-  ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_uuid();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& uuid() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_uuid();
+  private:
+  const std::string& _internal_uuid(int index) const;
+  std::string* _internal_add_uuid();
+  public:
 
   // @@protoc_insertion_point(class_scope:aspia.proto.system_info.CategoryList)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::RepeatedPtrField< ::std::string> uuid_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_system_5finfo_5fsession_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> uuid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_system_5finfo_5fsession_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CategoryRequest : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.system_info.CategoryRequest) */ {
+class CategoryRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.system_info.CategoryRequest) */ {
  public:
-  CategoryRequest();
-  virtual ~CategoryRequest();
+  inline CategoryRequest() : CategoryRequest(nullptr) {}
+  ~CategoryRequest() override;
+  explicit PROTOBUF_CONSTEXPR CategoryRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   CategoryRequest(const CategoryRequest& from);
-
-  inline CategoryRequest& operator=(const CategoryRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   CategoryRequest(CategoryRequest&& from) noexcept
     : CategoryRequest() {
     *this = ::std::move(from);
   }
 
+  inline CategoryRequest& operator=(const CategoryRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline CategoryRequest& operator=(CategoryRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const CategoryRequest& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const CategoryRequest& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const CategoryRequest* internal_default_instance() {
     return reinterpret_cast<const CategoryRequest*>(
                &_CategoryRequest_default_instance_);
@@ -337,455 +400,791 @@ class CategoryRequest : public ::google::protobuf::MessageLite /* @@protoc_inser
   static constexpr int kIndexInFileMessages =
     2;
 
-  void Swap(CategoryRequest* other);
   friend void swap(CategoryRequest& a, CategoryRequest& b) {
     a.Swap(&b);
   }
+  inline void Swap(CategoryRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CategoryRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline CategoryRequest* New() const final {
-    return CreateMaybeMessage<CategoryRequest>(NULL);
-  }
-
-  CategoryRequest* New(::google::protobuf::Arena* arena) const final {
+  CategoryRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<CategoryRequest>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const CategoryRequest& from);
   void MergeFrom(const CategoryRequest& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(CategoryRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.system_info.CategoryRequest";
   }
+  protected:
+  explicit CategoryRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kUuidFieldNumber = 1,
+    kDataFieldNumber = 2,
+  };
   // string uuid = 1;
   void clear_uuid();
-  static const int kUuidFieldNumber = 1;
-  const ::std::string& uuid() const;
-  void set_uuid(const ::std::string& value);
-  #if LANG_CXX11
-  void set_uuid(::std::string&& value);
-  #endif
-  void set_uuid(const char* value);
-  void set_uuid(const char* value, size_t size);
-  ::std::string* mutable_uuid();
-  ::std::string* release_uuid();
-  void set_allocated_uuid(::std::string* uuid);
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
 
   // bytes data = 2;
   void clear_data();
-  static const int kDataFieldNumber = 2;
-  const ::std::string& data() const;
-  void set_data(const ::std::string& value);
-  #if LANG_CXX11
-  void set_data(::std::string&& value);
-  #endif
-  void set_data(const char* value);
-  void set_data(const void* value, size_t size);
-  ::std::string* mutable_data();
-  ::std::string* release_data();
-  void set_allocated_data(::std::string* data);
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
 
   // @@protoc_insertion_point(class_scope:aspia.proto.system_info.CategoryRequest)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr uuid_;
-  ::google::protobuf::internal::ArenaStringPtr data_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_system_5finfo_5fsession_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_system_5finfo_5fsession_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Category : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.system_info.Category) */ {
+class CategoryBatchRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.system_info.CategoryBatchRequest) */ {
  public:
-  Category();
-  virtual ~Category();
+  inline CategoryBatchRequest() : CategoryBatchRequest(nullptr) {}
+  ~CategoryBatchRequest() override;
+  explicit PROTOBUF_CONSTEXPR CategoryBatchRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Category(const Category& from);
+  CategoryBatchRequest(const CategoryBatchRequest& from);
+  CategoryBatchRequest(CategoryBatchRequest&& from) noexcept
+    : CategoryBatchRequest() {
+    *this = ::std::move(from);
+  }
 
-  inline Category& operator=(const Category& from) {
+  inline CategoryBatchRequest& operator=(const CategoryBatchRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  #if LANG_CXX11
+  inline CategoryBatchRequest& operator=(CategoryBatchRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const CategoryBatchRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CategoryBatchRequest* internal_default_instance() {
+    return reinterpret_cast<const CategoryBatchRequest*>(
+               &_CategoryBatchRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(CategoryBatchRequest& a, CategoryBatchRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CategoryBatchRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CategoryBatchRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CategoryBatchRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CategoryBatchRequest>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const CategoryBatchRequest& from);
+  void MergeFrom(const CategoryBatchRequest& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(CategoryBatchRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.system_info.CategoryBatchRequest";
+  }
+  protected:
+  explicit CategoryBatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUuidFieldNumber = 1,
+    kCompressFieldNumber = 2,
+    kCompressionFieldNumber = 3,
+  };
+  // repeated string uuid = 1;
+  int uuid_size() const;
+  private:
+  int _internal_uuid_size() const;
+  public:
+  void clear_uuid();
+  const std::string& uuid(int index) const;
+  std::string* mutable_uuid(int index);
+  void set_uuid(int index, const std::string& value);
+  void set_uuid(int index, std::string&& value);
+  void set_uuid(int index, const char* value);
+  void set_uuid(int index, const char* value, size_t size);
+  std::string* add_uuid();
+  void add_uuid(const std::string& value);
+  void add_uuid(std::string&& value);
+  void add_uuid(const char* value);
+  void add_uuid(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& uuid() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_uuid();
+  private:
+  const std::string& _internal_uuid(int index) const;
+  std::string* _internal_add_uuid();
+  public:
+
+  // bool compress = 2;
+  void clear_compress();
+  bool compress() const;
+  void set_compress(bool value);
+  private:
+  bool _internal_compress() const;
+  void _internal_set_compress(bool value);
+  public:
+
+  // .aspia.proto.desktop.Compression compression = 3;
+  void clear_compression();
+  ::aspia::proto::desktop::Compression compression() const;
+  void set_compression(::aspia::proto::desktop::Compression value);
+  private:
+  ::aspia::proto::desktop::Compression _internal_compression() const;
+  void _internal_set_compression(::aspia::proto::desktop::Compression value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:aspia.proto.system_info.CategoryBatchRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> uuid_;
+    bool compress_;
+    int compression_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_system_5finfo_5fsession_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Category final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.system_info.Category) */ {
+ public:
+  inline Category() : Category(nullptr) {}
+  ~Category() override;
+  explicit PROTOBUF_CONSTEXPR Category(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Category(const Category& from);
   Category(Category&& from) noexcept
     : Category() {
     *this = ::std::move(from);
   }
 
+  inline Category& operator=(const Category& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline Category& operator=(Category&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const Category& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const Category& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const Category* internal_default_instance() {
     return reinterpret_cast<const Category*>(
                &_Category_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    3;
+    4;
 
-  void Swap(Category* other);
   friend void swap(Category& a, Category& b) {
     a.Swap(&b);
   }
+  inline void Swap(Category* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Category* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Category* New() const final {
-    return CreateMaybeMessage<Category>(NULL);
-  }
-
-  Category* New(::google::protobuf::Arena* arena) const final {
+  Category* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Category>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const Category& from);
   void MergeFrom(const Category& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(Category* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.system_info.Category";
   }
+  protected:
+  explicit Category(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kUuidFieldNumber = 1,
+    kDataFieldNumber = 2,
+    kCompressionFieldNumber = 3,
+    kUncompressedSizeFieldNumber = 4,
+  };
   // string uuid = 1;
   void clear_uuid();
-  static const int kUuidFieldNumber = 1;
-  const ::std::string& uuid() const;
-  void set_uuid(const ::std::string& value);
-  #if LANG_CXX11
-  void set_uuid(::std::string&& value);
-  #endif
-  void set_uuid(const char* value);
-  void set_uuid(const char* value, size_t size);
-  ::std::string* mutable_uuid();
-  ::std::string* release_uuid();
-  void set_allocated_uuid(::std::string* uuid);
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
 
   // bytes data = 2;
   void clear_data();
-  static const int kDataFieldNumber = 2;
-  const ::std::string& data() const;
-  void set_data(const ::std::string& value);
-  #if LANG_CXX11
-  void set_data(::std::string&& value);
-  #endif
-  void set_data(const char* value);
-  void set_data(const void* value, size_t size);
-  ::std::string* mutable_data();
-  ::std::string* release_data();
-  void set_allocated_data(::std::string* data);
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
+
+  // .aspia.proto.desktop.Compression compression = 3;
+  void clear_compression();
+  ::aspia::proto::desktop::Compression compression() const;
+  void set_compression(::aspia::proto::desktop::Compression value);
+  private:
+  ::aspia::proto::desktop::Compression _internal_compression() const;
+  void _internal_set_compression(::aspia::proto::desktop::Compression value);
+  public:
+
+  // uint32 uncompressed_size = 4;
+  void clear_uncompressed_size();
+  uint32_t uncompressed_size() const;
+  void set_uncompressed_size(uint32_t value);
+  private:
+  uint32_t _internal_uncompressed_size() const;
+  void _internal_set_uncompressed_size(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:aspia.proto.system_info.Category)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr uuid_;
-  ::google::protobuf::internal::ArenaStringPtr data_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_system_5finfo_5fsession_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    int compression_;
+    uint32_t uncompressed_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_system_5finfo_5fsession_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Request : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.system_info.Request) */ {
+class Request final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.system_info.Request) */ {
  public:
-  Request();
-  virtual ~Request();
+  inline Request() : Request(nullptr) {}
+  ~Request() override;
+  explicit PROTOBUF_CONSTEXPR Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Request(const Request& from);
-
-  inline Request& operator=(const Request& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   Request(Request&& from) noexcept
     : Request() {
     *this = ::std::move(from);
   }
 
+  inline Request& operator=(const Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline Request& operator=(Request&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const Request& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const Request& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const Request* internal_default_instance() {
     return reinterpret_cast<const Request*>(
                &_Request_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    4;
+    5;
 
-  void Swap(Request* other);
   friend void swap(Request& a, Request& b) {
     a.Swap(&b);
   }
+  inline void Swap(Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Request* New() const final {
-    return CreateMaybeMessage<Request>(NULL);
-  }
-
-  Request* New(::google::protobuf::Arena* arena) const final {
+  Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Request>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const Request& from);
   void MergeFrom(const Request& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(Request* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.system_info.Request";
   }
+  protected:
+  explicit Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kCategoryListRequestFieldNumber = 1,
+    kCategoryRequestFieldNumber = 2,
+    kCategoryBatchRequestFieldNumber = 3,
+  };
   // .aspia.proto.system_info.CategoryListRequest category_list_request = 1;
   bool has_category_list_request() const;
-  void clear_category_list_request();
-  static const int kCategoryListRequestFieldNumber = 1;
   private:
-  const ::aspia::proto::system_info::CategoryListRequest& _internal_category_list_request() const;
+  bool _internal_has_category_list_request() const;
   public:
+  void clear_category_list_request();
   const ::aspia::proto::system_info::CategoryListRequest& category_list_request() const;
-  ::aspia::proto::system_info::CategoryListRequest* release_category_list_request();
+  PROTOBUF_NODISCARD ::aspia::proto::system_info::CategoryListRequest* release_category_list_request();
   ::aspia::proto::system_info::CategoryListRequest* mutable_category_list_request();
   void set_allocated_category_list_request(::aspia::proto::system_info::CategoryListRequest* category_list_request);
+  private:
+  const ::aspia::proto::system_info::CategoryListRequest& _internal_category_list_request() const;
+  ::aspia::proto::system_info::CategoryListRequest* _internal_mutable_category_list_request();
+  public:
+  void unsafe_arena_set_allocated_category_list_request(
+      ::aspia::proto::system_info::CategoryListRequest* category_list_request);
+  ::aspia::proto::system_info::CategoryListRequest* unsafe_arena_release_category_list_request();
 
   // .aspia.proto.system_info.CategoryRequest category_request = 2;
   bool has_category_request() const;
-  void clear_category_request();
-  static const int kCategoryRequestFieldNumber = 2;
   private:
-  const ::aspia::proto::system_info::CategoryRequest& _internal_category_request() const;
+  bool _internal_has_category_request() const;
   public:
+  void clear_category_request();
   const ::aspia::proto::system_info::CategoryRequest& category_request() const;
-  ::aspia::proto::system_info::CategoryRequest* release_category_request();
+  PROTOBUF_NODISCARD ::aspia::proto::system_info::CategoryRequest* release_category_request();
   ::aspia::proto::system_info::CategoryRequest* mutable_category_request();
   void set_allocated_category_request(::aspia::proto::system_info::CategoryRequest* category_request);
+  private:
+  const ::aspia::proto::system_info::CategoryRequest& _internal_category_request() const;
+  ::aspia::proto::system_info::CategoryRequest* _internal_mutable_category_request();
+  public:
+  void unsafe_arena_set_allocated_category_request(
+      ::aspia::proto::system_info::CategoryRequest* category_request);
+  ::aspia::proto::system_info::CategoryRequest* unsafe_arena_release_category_request();
+
+  // .aspia.proto.system_info.CategoryBatchRequest category_batch_request = 3;
+  bool has_category_batch_request() const;
+  private:
+  bool _internal_has_category_batch_request() const;
+  public:
+  void clear_category_batch_request();
+  const ::aspia::proto::system_info::CategoryBatchRequest& category_batch_request() const;
+  PROTOBUF_NODISCARD ::aspia::proto::system_info::CategoryBatchRequest* release_category_batch_request();
+  ::aspia::proto::system_info::CategoryBatchRequest* mutable_category_batch_request();
+  void set_allocated_category_batch_request(::aspia::proto::system_info::CategoryBatchRequest* category_batch_request);
+  private:
+  const ::aspia::proto::system_info::CategoryBatchRequest& _internal_category_batch_request() const;
+  ::aspia::proto::system_info::CategoryBatchRequest* _internal_mutable_category_batch_request();
+  public:
+  void unsafe_arena_set_allocated_category_batch_request(
+      ::aspia::proto::system_info::CategoryBatchRequest* category_batch_request);
+  ::aspia::proto::system_info::CategoryBatchRequest* unsafe_arena_release_category_batch_request();
 
   // @@protoc_insertion_point(class_scope:aspia.proto.system_info.Request)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::aspia::proto::system_info::CategoryListRequest* category_list_request_;
-  ::aspia::proto::system_info::CategoryRequest* category_request_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_system_5finfo_5fsession_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::aspia::proto::system_info::CategoryListRequest* category_list_request_;
+    ::aspia::proto::system_info::CategoryRequest* category_request_;
+    ::aspia::proto::system_info::CategoryBatchRequest* category_batch_request_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_system_5finfo_5fsession_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Reply : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.system_info.Reply) */ {
+class Reply final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:aspia.proto.system_info.Reply) */ {
  public:
-  Reply();
-  virtual ~Reply();
+  inline Reply() : Reply(nullptr) {}
+  ~Reply() override;
+  explicit PROTOBUF_CONSTEXPR Reply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Reply(const Reply& from);
-
-  inline Reply& operator=(const Reply& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   Reply(Reply&& from) noexcept
     : Reply() {
     *this = ::std::move(from);
   }
 
+  inline Reply& operator=(const Reply& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline Reply& operator=(Reply&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const Reply& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const Reply& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const Reply* internal_default_instance() {
     return reinterpret_cast<const Reply*>(
                &_Reply_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    5;
+    6;
 
-  void Swap(Reply* other);
   friend void swap(Reply& a, Reply& b) {
     a.Swap(&b);
   }
+  inline void Swap(Reply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Reply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Reply* New() const final {
-    return CreateMaybeMessage<Reply>(NULL);
-  }
-
-  Reply* New(::google::protobuf::Arena* arena) const final {
+  Reply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Reply>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const Reply& from);
   void MergeFrom(const Reply& from);
-  void Clear() final;
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(Reply* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aspia.proto.system_info.Reply";
   }
+  protected:
+  explicit Reply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::std::string GetTypeName() const final;
+  std::string GetTypeName() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kCategoryListFieldNumber = 1,
+    kCategoryFieldNumber = 2,
+  };
   // .aspia.proto.system_info.CategoryList category_list = 1;
   bool has_category_list() const;
-  void clear_category_list();
-  static const int kCategoryListFieldNumber = 1;
   private:
-  const ::aspia::proto::system_info::CategoryList& _internal_category_list() const;
+  bool _internal_has_category_list() const;
   public:
+  void clear_category_list();
   const ::aspia::proto::system_info::CategoryList& category_list() const;
-  ::aspia::proto::system_info::CategoryList* release_category_list();
+  PROTOBUF_NODISCARD ::aspia::proto::system_info::CategoryList* release_category_list();
   ::aspia::proto::system_info::CategoryList* mutable_category_list();
   void set_allocated_category_list(::aspia::proto::system_info::CategoryList* category_list);
+  private:
+  const ::aspia::proto::system_info::CategoryList& _internal_category_list() const;
+  ::aspia::proto::system_info::CategoryList* _internal_mutable_category_list();
+  public:
+  void unsafe_arena_set_allocated_category_list(
+      ::aspia::proto::system_info::CategoryList* category_list);
+  ::aspia::proto::system_info::CategoryList* unsafe_arena_release_category_list();
 
   // .aspia.proto.system_info.Category category = 2;
   bool has_category() const;
-  void clear_category();
-  static const int kCategoryFieldNumber = 2;
   private:
-  const ::aspia::proto::system_info::Category& _internal_category() const;
+  bool _internal_has_category() const;
   public:
+  void clear_category();
   const ::aspia::proto::system_info::Category& category() const;
-  ::aspia::proto::system_info::Category* release_category();
+  PROTOBUF_NODISCARD ::aspia::proto::system_info::Category* release_category();
   ::aspia::proto::system_info::Category* mutable_category();
   void set_allocated_category(::aspia::proto::system_info::Category* category);
+  private:
+  const ::aspia::proto::system_info::Category& _internal_category() const;
+  ::aspia::proto::system_info::Category* _internal_mutable_category();
+  public:
+  void unsafe_arena_set_allocated_category(
+      ::aspia::proto::system_info::Category* category);
+  ::aspia::proto::system_info::Category* unsafe_arena_release_category();
 
   // @@protoc_insertion_point(class_scope:aspia.proto.system_info.Reply)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
-  ::aspia::proto::system_info::CategoryList* category_list_;
-  ::aspia::proto::system_info::Category* category_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_system_5finfo_5fsession_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::aspia::proto::system_info::CategoryList* category_list_;
+    ::aspia::proto::system_info::Category* category_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_system_5finfo_5fsession_2eproto;
 };
 // ===================================================================
 
@@ -800,15 +1199,21 @@ class Reply : public ::google::protobuf::MessageLite /* @@protoc_insertion_point
 
 // uint32 dummy = 1;
 inline void CategoryListRequest::clear_dummy() {
-  dummy_ = 0u;
+  _impl_.dummy_ = 0u;
+}
+inline uint32_t CategoryListRequest::_internal_dummy() const {
+  return _impl_.dummy_;
 }
-inline ::google::protobuf::uint32 CategoryListRequest::dummy() const {
+inline uint32_t CategoryListRequest::dummy() const {
   // @@protoc_insertion_point(field_get:aspia.proto.system_info.CategoryListRequest.dummy)
-  return dummy_;
+  return _internal_dummy();
 }
-inline void CategoryListRequest::set_dummy(::google::protobuf::uint32 value) {
+inline void CategoryListRequest::_internal_set_dummy(uint32_t value) {
   
-  dummy_ = value;
+  _impl_.dummy_ = value;
+}
+inline void CategoryListRequest::set_dummy(uint32_t value) {
+  _internal_set_dummy(value);
   // @@protoc_insertion_point(field_set:aspia.proto.system_info.CategoryListRequest.dummy)
 }
 
@@ -817,72 +1222,78 @@ inline void CategoryListRequest::set_dummy(::google::protobuf::uint32 value) {
 // CategoryList
 
 // repeated string uuid = 1;
+inline int CategoryList::_internal_uuid_size() const {
+  return _impl_.uuid_.size();
+}
 inline int CategoryList::uuid_size() const {
-  return uuid_.size();
+  return _internal_uuid_size();
 }
 inline void CategoryList::clear_uuid() {
-  uuid_.Clear();
+  _impl_.uuid_.Clear();
+}
+inline std::string* CategoryList::add_uuid() {
+  std::string* _s = _internal_add_uuid();
+  // @@protoc_insertion_point(field_add_mutable:aspia.proto.system_info.CategoryList.uuid)
+  return _s;
+}
+inline const std::string& CategoryList::_internal_uuid(int index) const {
+  return _impl_.uuid_.Get(index);
 }
-inline const ::std::string& CategoryList::uuid(int index) const {
+inline const std::string& CategoryList::uuid(int index) const {
   // @@protoc_insertion_point(field_get:aspia.proto.system_info.CategoryList.uuid)
-  return uuid_.Get(index);
+  return _internal_uuid(index);
 }
-inline ::std::string* CategoryList::mutable_uuid(int index) {
+inline std::string* CategoryList::mutable_uuid(int index) {
   // @@protoc_insertion_point(field_mutable:aspia.proto.system_info.CategoryList.uuid)
-  return uuid_.Mutable(index);
+  return _impl_.uuid_.Mutable(index);
 }
-inline void CategoryList::set_uuid(int index, const ::std::string& value) {
+inline void CategoryList::set_uuid(int index, const std::string& value) {
+  _impl_.uuid_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set:aspia.proto.system_info.CategoryList.uuid)
-  uuid_.Mutable(index)->assign(value);
 }
-#if LANG_CXX11
-inline void CategoryList::set_uuid(int index, ::std::string&& value) {
+inline void CategoryList::set_uuid(int index, std::string&& value) {
+  _impl_.uuid_.Mutable(index)->assign(std::move(value));
   // @@protoc_insertion_point(field_set:aspia.proto.system_info.CategoryList.uuid)
-  uuid_.Mutable(index)->assign(std::move(value));
 }
-#endif
 inline void CategoryList::set_uuid(int index, const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  uuid_.Mutable(index)->assign(value);
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.uuid_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set_char:aspia.proto.system_info.CategoryList.uuid)
 }
 inline void CategoryList::set_uuid(int index, const char* value, size_t size) {
-  uuid_.Mutable(index)->assign(
+  _impl_.uuid_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_set_pointer:aspia.proto.system_info.CategoryList.uuid)
 }
-inline ::std::string* CategoryList::add_uuid() {
-  // @@protoc_insertion_point(field_add_mutable:aspia.proto.system_info.CategoryList.uuid)
-  return uuid_.Add();
+inline std::string* CategoryList::_internal_add_uuid() {
+  return _impl_.uuid_.Add();
 }
-inline void CategoryList::add_uuid(const ::std::string& value) {
-  uuid_.Add()->assign(value);
+inline void CategoryList::add_uuid(const std::string& value) {
+  _impl_.uuid_.Add()->assign(value);
   // @@protoc_insertion_point(field_add:aspia.proto.system_info.CategoryList.uuid)
 }
-#if LANG_CXX11
-inline void CategoryList::add_uuid(::std::string&& value) {
-  uuid_.Add(std::move(value));
+inline void CategoryList::add_uuid(std::string&& value) {
+  _impl_.uuid_.Add(std::move(value));
   // @@protoc_insertion_point(field_add:aspia.proto.system_info.CategoryList.uuid)
 }
-#endif
 inline void CategoryList::add_uuid(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  uuid_.Add()->assign(value);
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.uuid_.Add()->assign(value);
   // @@protoc_insertion_point(field_add_char:aspia.proto.system_info.CategoryList.uuid)
 }
 inline void CategoryList::add_uuid(const char* value, size_t size) {
-  uuid_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  _impl_.uuid_.Add()->assign(reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_add_pointer:aspia.proto.system_info.CategoryList.uuid)
 }
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
 CategoryList::uuid() const {
   // @@protoc_insertion_point(field_list:aspia.proto.system_info.CategoryList.uuid)
-  return uuid_;
+  return _impl_.uuid_;
 }
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
 CategoryList::mutable_uuid() {
   // @@protoc_insertion_point(field_mutable_list:aspia.proto.system_info.CategoryList.uuid)
-  return &uuid_;
+  return &_impl_.uuid_;
 }
 
 // -------------------------------------------------------------------
@@ -891,441 +1302,822 @@ CategoryList::mutable_uuid() {
 
 // string uuid = 1;
 inline void CategoryRequest::clear_uuid() {
-  uuid_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.uuid_.ClearToEmpty();
 }
-inline const ::std::string& CategoryRequest::uuid() const {
+inline const std::string& CategoryRequest::uuid() const {
   // @@protoc_insertion_point(field_get:aspia.proto.system_info.CategoryRequest.uuid)
-  return uuid_.GetNoArena();
+  return _internal_uuid();
 }
-inline void CategoryRequest::set_uuid(const ::std::string& value) {
-  
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CategoryRequest::set_uuid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.uuid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:aspia.proto.system_info.CategoryRequest.uuid)
 }
-#if LANG_CXX11
-inline void CategoryRequest::set_uuid(::std::string&& value) {
-  
-  uuid_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.system_info.CategoryRequest.uuid)
+inline std::string* CategoryRequest::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.system_info.CategoryRequest.uuid)
+  return _s;
 }
-#endif
-inline void CategoryRequest::set_uuid(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.system_info.CategoryRequest.uuid)
+inline const std::string& CategoryRequest::_internal_uuid() const {
+  return _impl_.uuid_.Get();
 }
-inline void CategoryRequest::set_uuid(const char* value, size_t size) {
+inline void CategoryRequest::_internal_set_uuid(const std::string& value) {
   
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.system_info.CategoryRequest.uuid)
+  _impl_.uuid_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* CategoryRequest::mutable_uuid() {
+inline std::string* CategoryRequest::_internal_mutable_uuid() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.system_info.CategoryRequest.uuid)
-  return uuid_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.uuid_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* CategoryRequest::release_uuid() {
+inline std::string* CategoryRequest::release_uuid() {
   // @@protoc_insertion_point(field_release:aspia.proto.system_info.CategoryRequest.uuid)
-  
-  return uuid_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.uuid_.Release();
 }
-inline void CategoryRequest::set_allocated_uuid(::std::string* uuid) {
-  if (uuid != NULL) {
+inline void CategoryRequest::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
     
   } else {
     
   }
-  uuid_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), uuid);
+  _impl_.uuid_.SetAllocated(uuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.system_info.CategoryRequest.uuid)
 }
 
 // bytes data = 2;
 inline void CategoryRequest::clear_data() {
-  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.data_.ClearToEmpty();
 }
-inline const ::std::string& CategoryRequest::data() const {
+inline const std::string& CategoryRequest::data() const {
   // @@protoc_insertion_point(field_get:aspia.proto.system_info.CategoryRequest.data)
-  return data_.GetNoArena();
+  return _internal_data();
 }
-inline void CategoryRequest::set_data(const ::std::string& value) {
-  
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CategoryRequest::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:aspia.proto.system_info.CategoryRequest.data)
 }
-#if LANG_CXX11
-inline void CategoryRequest::set_data(::std::string&& value) {
-  
-  data_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.system_info.CategoryRequest.data)
+inline std::string* CategoryRequest::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.system_info.CategoryRequest.data)
+  return _s;
 }
-#endif
-inline void CategoryRequest::set_data(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.system_info.CategoryRequest.data)
+inline const std::string& CategoryRequest::_internal_data() const {
+  return _impl_.data_.Get();
 }
-inline void CategoryRequest::set_data(const void* value, size_t size) {
+inline void CategoryRequest::_internal_set_data(const std::string& value) {
   
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.system_info.CategoryRequest.data)
+  _impl_.data_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* CategoryRequest::mutable_data() {
+inline std::string* CategoryRequest::_internal_mutable_data() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.system_info.CategoryRequest.data)
-  return data_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.data_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* CategoryRequest::release_data() {
+inline std::string* CategoryRequest::release_data() {
   // @@protoc_insertion_point(field_release:aspia.proto.system_info.CategoryRequest.data)
-  
-  return data_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.data_.Release();
 }
-inline void CategoryRequest::set_allocated_data(::std::string* data) {
-  if (data != NULL) {
+inline void CategoryRequest::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
     
   } else {
     
   }
-  data_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), data);
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.system_info.CategoryRequest.data)
 }
 
 // -------------------------------------------------------------------
 
+// CategoryBatchRequest
+
+// repeated string uuid = 1;
+inline int CategoryBatchRequest::_internal_uuid_size() const {
+  return _impl_.uuid_.size();
+}
+inline int CategoryBatchRequest::uuid_size() const {
+  return _internal_uuid_size();
+}
+inline void CategoryBatchRequest::clear_uuid() {
+  _impl_.uuid_.Clear();
+}
+inline std::string* CategoryBatchRequest::add_uuid() {
+  std::string* _s = _internal_add_uuid();
+  // @@protoc_insertion_point(field_add_mutable:aspia.proto.system_info.CategoryBatchRequest.uuid)
+  return _s;
+}
+inline const std::string& CategoryBatchRequest::_internal_uuid(int index) const {
+  return _impl_.uuid_.Get(index);
+}
+inline const std::string& CategoryBatchRequest::uuid(int index) const {
+  // @@protoc_insertion_point(field_get:aspia.proto.system_info.CategoryBatchRequest.uuid)
+  return _internal_uuid(index);
+}
+inline std::string* CategoryBatchRequest::mutable_uuid(int index) {
+  // @@protoc_insertion_point(field_mutable:aspia.proto.system_info.CategoryBatchRequest.uuid)
+  return _impl_.uuid_.Mutable(index);
+}
+inline void CategoryBatchRequest::set_uuid(int index, const std::string& value) {
+  _impl_.uuid_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.system_info.CategoryBatchRequest.uuid)
+}
+inline void CategoryBatchRequest::set_uuid(int index, std::string&& value) {
+  _impl_.uuid_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:aspia.proto.system_info.CategoryBatchRequest.uuid)
+}
+inline void CategoryBatchRequest::set_uuid(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.uuid_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:aspia.proto.system_info.CategoryBatchRequest.uuid)
+}
+inline void CategoryBatchRequest::set_uuid(int index, const char* value, size_t size) {
+  _impl_.uuid_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:aspia.proto.system_info.CategoryBatchRequest.uuid)
+}
+inline std::string* CategoryBatchRequest::_internal_add_uuid() {
+  return _impl_.uuid_.Add();
+}
+inline void CategoryBatchRequest::add_uuid(const std::string& value) {
+  _impl_.uuid_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:aspia.proto.system_info.CategoryBatchRequest.uuid)
+}
+inline void CategoryBatchRequest::add_uuid(std::string&& value) {
+  _impl_.uuid_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:aspia.proto.system_info.CategoryBatchRequest.uuid)
+}
+inline void CategoryBatchRequest::add_uuid(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.uuid_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:aspia.proto.system_info.CategoryBatchRequest.uuid)
+}
+inline void CategoryBatchRequest::add_uuid(const char* value, size_t size) {
+  _impl_.uuid_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:aspia.proto.system_info.CategoryBatchRequest.uuid)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+CategoryBatchRequest::uuid() const {
+  // @@protoc_insertion_point(field_list:aspia.proto.system_info.CategoryBatchRequest.uuid)
+  return _impl_.uuid_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+CategoryBatchRequest::mutable_uuid() {
+  // @@protoc_insertion_point(field_mutable_list:aspia.proto.system_info.CategoryBatchRequest.uuid)
+  return &_impl_.uuid_;
+}
+
+// bool compress = 2;
+inline void CategoryBatchRequest::clear_compress() {
+  _impl_.compress_ = false;
+}
+inline bool CategoryBatchRequest::_internal_compress() const {
+  return _impl_.compress_;
+}
+inline bool CategoryBatchRequest::compress() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.system_info.CategoryBatchRequest.compress)
+  return _internal_compress();
+}
+inline void CategoryBatchRequest::_internal_set_compress(bool value) {
+  
+  _impl_.compress_ = value;
+}
+inline void CategoryBatchRequest::set_compress(bool value) {
+  _internal_set_compress(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.system_info.CategoryBatchRequest.compress)
+}
+
+// .aspia.proto.desktop.Compression compression = 3;
+inline void CategoryBatchRequest::clear_compression() {
+  _impl_.compression_ = 0;
+}
+inline ::aspia::proto::desktop::Compression CategoryBatchRequest::_internal_compression() const {
+  return static_cast< ::aspia::proto::desktop::Compression >(_impl_.compression_);
+}
+inline ::aspia::proto::desktop::Compression CategoryBatchRequest::compression() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.system_info.CategoryBatchRequest.compression)
+  return _internal_compression();
+}
+inline void CategoryBatchRequest::_internal_set_compression(::aspia::proto::desktop::Compression value) {
+  
+  _impl_.compression_ = value;
+}
+inline void CategoryBatchRequest::set_compression(::aspia::proto::desktop::Compression value) {
+  _internal_set_compression(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.system_info.CategoryBatchRequest.compression)
+}
+
+// -------------------------------------------------------------------
+
 // Category
 
 // string uuid = 1;
 inline void Category::clear_uuid() {
-  uuid_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.uuid_.ClearToEmpty();
 }
-inline const ::std::string& Category::uuid() const {
+inline const std::string& Category::uuid() const {
   // @@protoc_insertion_point(field_get:aspia.proto.system_info.Category.uuid)
-  return uuid_.GetNoArena();
+  return _internal_uuid();
 }
-inline void Category::set_uuid(const ::std::string& value) {
-  
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Category::set_uuid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.uuid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:aspia.proto.system_info.Category.uuid)
 }
-#if LANG_CXX11
-inline void Category::set_uuid(::std::string&& value) {
-  
-  uuid_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.system_info.Category.uuid)
+inline std::string* Category::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.system_info.Category.uuid)
+  return _s;
 }
-#endif
-inline void Category::set_uuid(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.system_info.Category.uuid)
+inline const std::string& Category::_internal_uuid() const {
+  return _impl_.uuid_.Get();
 }
-inline void Category::set_uuid(const char* value, size_t size) {
+inline void Category::_internal_set_uuid(const std::string& value) {
   
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.system_info.Category.uuid)
+  _impl_.uuid_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* Category::mutable_uuid() {
+inline std::string* Category::_internal_mutable_uuid() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.system_info.Category.uuid)
-  return uuid_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.uuid_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* Category::release_uuid() {
+inline std::string* Category::release_uuid() {
   // @@protoc_insertion_point(field_release:aspia.proto.system_info.Category.uuid)
-  
-  return uuid_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.uuid_.Release();
 }
-inline void Category::set_allocated_uuid(::std::string* uuid) {
-  if (uuid != NULL) {
+inline void Category::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
     
   } else {
     
   }
-  uuid_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), uuid);
+  _impl_.uuid_.SetAllocated(uuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.system_info.Category.uuid)
 }
 
 // bytes data = 2;
 inline void Category::clear_data() {
-  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.data_.ClearToEmpty();
 }
-inline const ::std::string& Category::data() const {
+inline const std::string& Category::data() const {
   // @@protoc_insertion_point(field_get:aspia.proto.system_info.Category.data)
-  return data_.GetNoArena();
+  return _internal_data();
 }
-inline void Category::set_data(const ::std::string& value) {
-  
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Category::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:aspia.proto.system_info.Category.data)
 }
-#if LANG_CXX11
-inline void Category::set_data(::std::string&& value) {
-  
-  data_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:aspia.proto.system_info.Category.data)
+inline std::string* Category::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.system_info.Category.data)
+  return _s;
 }
-#endif
-inline void Category::set_data(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:aspia.proto.system_info.Category.data)
+inline const std::string& Category::_internal_data() const {
+  return _impl_.data_.Get();
 }
-inline void Category::set_data(const void* value, size_t size) {
+inline void Category::_internal_set_data(const std::string& value) {
   
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:aspia.proto.system_info.Category.data)
+  _impl_.data_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* Category::mutable_data() {
+inline std::string* Category::_internal_mutable_data() {
   
-  // @@protoc_insertion_point(field_mutable:aspia.proto.system_info.Category.data)
-  return data_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.data_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* Category::release_data() {
+inline std::string* Category::release_data() {
   // @@protoc_insertion_point(field_release:aspia.proto.system_info.Category.data)
-  
-  return data_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.data_.Release();
 }
-inline void Category::set_allocated_data(::std::string* data) {
-  if (data != NULL) {
+inline void Category::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
     
   } else {
     
   }
-  data_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), data);
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.system_info.Category.data)
 }
 
+// .aspia.proto.desktop.Compression compression = 3;
+inline void Category::clear_compression() {
+  _impl_.compression_ = 0;
+}
+inline ::aspia::proto::desktop::Compression Category::_internal_compression() const {
+  return static_cast< ::aspia::proto::desktop::Compression >(_impl_.compression_);
+}
+inline ::aspia::proto::desktop::Compression Category::compression() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.system_info.Category.compression)
+  return _internal_compression();
+}
+inline void Category::_internal_set_compression(::aspia::proto::desktop::Compression value) {
+  
+  _impl_.compression_ = value;
+}
+inline void Category::set_compression(::aspia::proto::desktop::Compression value) {
+  _internal_set_compression(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.system_info.Category.compression)
+}
+
+// uint32 uncompressed_size = 4;
+inline void Category::clear_uncompressed_size() {
+  _impl_.uncompressed_size_ = 0u;
+}
+inline uint32_t Category::_internal_uncompressed_size() const {
+  return _impl_.uncompressed_size_;
+}
+inline uint32_t Category::uncompressed_size() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.system_info.Category.uncompressed_size)
+  return _internal_uncompressed_size();
+}
+inline void Category::_internal_set_uncompressed_size(uint32_t value) {
+  
+  _impl_.uncompressed_size_ = value;
+}
+inline void Category::set_uncompressed_size(uint32_t value) {
+  _internal_set_uncompressed_size(value);
+  // @@protoc_insertion_point(field_set:aspia.proto.system_info.Category.uncompressed_size)
+}
+
 // -------------------------------------------------------------------
 
 // Request
 
 // .aspia.proto.system_info.CategoryListRequest category_list_request = 1;
+inline bool Request::_internal_has_category_list_request() const {
+  return this != internal_default_instance() && _impl_.category_list_request_ != nullptr;
+}
 inline bool Request::has_category_list_request() const {
-  return this != internal_default_instance() && category_list_request_ != NULL;
+  return _internal_has_category_list_request();
 }
 inline void Request::clear_category_list_request() {
-  if (GetArenaNoVirtual() == NULL && category_list_request_ != NULL) {
-    delete category_list_request_;
+  if (GetArenaForAllocation() == nullptr && _impl_.category_list_request_ != nullptr) {
+    delete _impl_.category_list_request_;
   }
-  category_list_request_ = NULL;
+  _impl_.category_list_request_ = nullptr;
 }
 inline const ::aspia::proto::system_info::CategoryListRequest& Request::_internal_category_list_request() const {
-  return *category_list_request_;
+  const ::aspia::proto::system_info::CategoryListRequest* p = _impl_.category_list_request_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::system_info::CategoryListRequest&>(
+      ::aspia::proto::system_info::_CategoryListRequest_default_instance_);
 }
 inline const ::aspia::proto::system_info::CategoryListRequest& Request::category_list_request() const {
-  const ::aspia::proto::system_info::CategoryListRequest* p = category_list_request_;
   // @@protoc_insertion_point(field_get:aspia.proto.system_info.Request.category_list_request)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::system_info::CategoryListRequest*>(
-      &::aspia::proto::system_info::_CategoryListRequest_default_instance_);
+  return _internal_category_list_request();
+}
+inline void Request::unsafe_arena_set_allocated_category_list_request(
+    ::aspia::proto::system_info::CategoryListRequest* category_list_request) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.category_list_request_);
+  }
+  _impl_.category_list_request_ = category_list_request;
+  if (category_list_request) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.system_info.Request.category_list_request)
 }
 inline ::aspia::proto::system_info::CategoryListRequest* Request::release_category_list_request() {
+  
+  ::aspia::proto::system_info::CategoryListRequest* temp = _impl_.category_list_request_;
+  _impl_.category_list_request_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::system_info::CategoryListRequest* Request::unsafe_arena_release_category_list_request() {
   // @@protoc_insertion_point(field_release:aspia.proto.system_info.Request.category_list_request)
   
-  ::aspia::proto::system_info::CategoryListRequest* temp = category_list_request_;
-  category_list_request_ = NULL;
+  ::aspia::proto::system_info::CategoryListRequest* temp = _impl_.category_list_request_;
+  _impl_.category_list_request_ = nullptr;
   return temp;
 }
-inline ::aspia::proto::system_info::CategoryListRequest* Request::mutable_category_list_request() {
+inline ::aspia::proto::system_info::CategoryListRequest* Request::_internal_mutable_category_list_request() {
   
-  if (category_list_request_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::system_info::CategoryListRequest>(GetArenaNoVirtual());
-    category_list_request_ = p;
+  if (_impl_.category_list_request_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::system_info::CategoryListRequest>(GetArenaForAllocation());
+    _impl_.category_list_request_ = p;
   }
+  return _impl_.category_list_request_;
+}
+inline ::aspia::proto::system_info::CategoryListRequest* Request::mutable_category_list_request() {
+  ::aspia::proto::system_info::CategoryListRequest* _msg = _internal_mutable_category_list_request();
   // @@protoc_insertion_point(field_mutable:aspia.proto.system_info.Request.category_list_request)
-  return category_list_request_;
+  return _msg;
 }
 inline void Request::set_allocated_category_list_request(::aspia::proto::system_info::CategoryListRequest* category_list_request) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete category_list_request_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.category_list_request_;
   }
   if (category_list_request) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(category_list_request);
     if (message_arena != submessage_arena) {
-      category_list_request = ::google::protobuf::internal::GetOwnedMessage(
+      category_list_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, category_list_request, submessage_arena);
     }
     
   } else {
     
   }
-  category_list_request_ = category_list_request;
+  _impl_.category_list_request_ = category_list_request;
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.system_info.Request.category_list_request)
 }
 
 // .aspia.proto.system_info.CategoryRequest category_request = 2;
+inline bool Request::_internal_has_category_request() const {
+  return this != internal_default_instance() && _impl_.category_request_ != nullptr;
+}
 inline bool Request::has_category_request() const {
-  return this != internal_default_instance() && category_request_ != NULL;
+  return _internal_has_category_request();
 }
 inline void Request::clear_category_request() {
-  if (GetArenaNoVirtual() == NULL && category_request_ != NULL) {
-    delete category_request_;
+  if (GetArenaForAllocation() == nullptr && _impl_.category_request_ != nullptr) {
+    delete _impl_.category_request_;
   }
-  category_request_ = NULL;
+  _impl_.category_request_ = nullptr;
 }
 inline const ::aspia::proto::system_info::CategoryRequest& Request::_internal_category_request() const {
-  return *category_request_;
+  const ::aspia::proto::system_info::CategoryRequest* p = _impl_.category_request_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::system_info::CategoryRequest&>(
+      ::aspia::proto::system_info::_CategoryRequest_default_instance_);
 }
 inline const ::aspia::proto::system_info::CategoryRequest& Request::category_request() const {
-  const ::aspia::proto::system_info::CategoryRequest* p = category_request_;
   // @@protoc_insertion_point(field_get:aspia.proto.system_info.Request.category_request)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::system_info::CategoryRequest*>(
-      &::aspia::proto::system_info::_CategoryRequest_default_instance_);
+  return _internal_category_request();
+}
+inline void Request::unsafe_arena_set_allocated_category_request(
+    ::aspia::proto::system_info::CategoryRequest* category_request) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.category_request_);
+  }
+  _impl_.category_request_ = category_request;
+  if (category_request) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.system_info.Request.category_request)
 }
 inline ::aspia::proto::system_info::CategoryRequest* Request::release_category_request() {
+  
+  ::aspia::proto::system_info::CategoryRequest* temp = _impl_.category_request_;
+  _impl_.category_request_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::system_info::CategoryRequest* Request::unsafe_arena_release_category_request() {
   // @@protoc_insertion_point(field_release:aspia.proto.system_info.Request.category_request)
   
-  ::aspia::proto::system_info::CategoryRequest* temp = category_request_;
-  category_request_ = NULL;
+  ::aspia::proto::system_info::CategoryRequest* temp = _impl_.category_request_;
+  _impl_.category_request_ = nullptr;
   return temp;
 }
-inline ::aspia::proto::system_info::CategoryRequest* Request::mutable_category_request() {
+inline ::aspia::proto::system_info::CategoryRequest* Request::_internal_mutable_category_request() {
   
-  if (category_request_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::system_info::CategoryRequest>(GetArenaNoVirtual());
-    category_request_ = p;
+  if (_impl_.category_request_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::system_info::CategoryRequest>(GetArenaForAllocation());
+    _impl_.category_request_ = p;
   }
+  return _impl_.category_request_;
+}
+inline ::aspia::proto::system_info::CategoryRequest* Request::mutable_category_request() {
+  ::aspia::proto::system_info::CategoryRequest* _msg = _internal_mutable_category_request();
   // @@protoc_insertion_point(field_mutable:aspia.proto.system_info.Request.category_request)
-  return category_request_;
+  return _msg;
 }
 inline void Request::set_allocated_category_request(::aspia::proto::system_info::CategoryRequest* category_request) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete category_request_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.category_request_;
   }
   if (category_request) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(category_request);
     if (message_arena != submessage_arena) {
-      category_request = ::google::protobuf::internal::GetOwnedMessage(
+      category_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, category_request, submessage_arena);
     }
     
   } else {
     
   }
-  category_request_ = category_request;
+  _impl_.category_request_ = category_request;
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.system_info.Request.category_request)
 }
 
+// .aspia.proto.system_info.CategoryBatchRequest category_batch_request = 3;
+inline bool Request::_internal_has_category_batch_request() const {
+  return this != internal_default_instance() && _impl_.category_batch_request_ != nullptr;
+}
+inline bool Request::has_category_batch_request() const {
+  return _internal_has_category_batch_request();
+}
+inline void Request::clear_category_batch_request() {
+  if (GetArenaForAllocation() == nullptr && _impl_.category_batch_request_ != nullptr) {
+    delete _impl_.category_batch_request_;
+  }
+  _impl_.category_batch_request_ = nullptr;
+}
+inline const ::aspia::proto::system_info::CategoryBatchRequest& Request::_internal_category_batch_request() const {
+  const ::aspia::proto::system_info::CategoryBatchRequest* p = _impl_.category_batch_request_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::system_info::CategoryBatchRequest&>(
+      ::aspia::proto::system_info::_CategoryBatchRequest_default_instance_);
+}
+inline const ::aspia::proto::system_info::CategoryBatchRequest& Request::category_batch_request() const {
+  // @@protoc_insertion_point(field_get:aspia.proto.system_info.Request.category_batch_request)
+  return _internal_category_batch_request();
+}
+inline void Request::unsafe_arena_set_allocated_category_batch_request(
+    ::aspia::proto::system_info::CategoryBatchRequest* category_batch_request) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.category_batch_request_);
+  }
+  _impl_.category_batch_request_ = category_batch_request;
+  if (category_batch_request) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.system_info.Request.category_batch_request)
+}
+inline ::aspia::proto::system_info::CategoryBatchRequest* Request::release_category_batch_request() {
+  
+  ::aspia::proto::system_info::CategoryBatchRequest* temp = _impl_.category_batch_request_;
+  _impl_.category_batch_request_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::system_info::CategoryBatchRequest* Request::unsafe_arena_release_category_batch_request() {
+  // @@protoc_insertion_point(field_release:aspia.proto.system_info.Request.category_batch_request)
+  
+  ::aspia::proto::system_info::CategoryBatchRequest* temp = _impl_.category_batch_request_;
+  _impl_.category_batch_request_ = nullptr;
+  return temp;
+}
+inline ::aspia::proto::system_info::CategoryBatchRequest* Request::_internal_mutable_category_batch_request() {
+  
+  if (_impl_.category_batch_request_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::system_info::CategoryBatchRequest>(GetArenaForAllocation());
+    _impl_.category_batch_request_ = p;
+  }
+  return _impl_.category_batch_request_;
+}
+inline ::aspia::proto::system_info::CategoryBatchRequest* Request::mutable_category_batch_request() {
+  ::aspia::proto::system_info::CategoryBatchRequest* _msg = _internal_mutable_category_batch_request();
+  // @@protoc_insertion_point(field_mutable:aspia.proto.system_info.Request.category_batch_request)
+  return _msg;
+}
+inline void Request::set_allocated_category_batch_request(::aspia::proto::system_info::CategoryBatchRequest* category_batch_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.category_batch_request_;
+  }
+  if (category_batch_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(category_batch_request);
+    if (message_arena != submessage_arena) {
+      category_batch_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, category_batch_request, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.category_batch_request_ = category_batch_request;
+  // @@protoc_insertion_point(field_set_allocated:aspia.proto.system_info.Request.category_batch_request)
+}
+
 // -------------------------------------------------------------------
 
 // Reply
 
 // .aspia.proto.system_info.CategoryList category_list = 1;
+inline bool Reply::_internal_has_category_list() const {
+  return this != internal_default_instance() && _impl_.category_list_ != nullptr;
+}
 inline bool Reply::has_category_list() const {
-  return this != internal_default_instance() && category_list_ != NULL;
+  return _internal_has_category_list();
 }
 inline void Reply::clear_category_list() {
-  if (GetArenaNoVirtual() == NULL && category_list_ != NULL) {
-    delete category_list_;
+  if (GetArenaForAllocation() == nullptr && _impl_.category_list_ != nullptr) {
+    delete _impl_.category_list_;
   }
-  category_list_ = NULL;
+  _impl_.category_list_ = nullptr;
 }
 inline const ::aspia::proto::system_info::CategoryList& Reply::_internal_category_list() const {
-  return *category_list_;
+  const ::aspia::proto::system_info::CategoryList* p = _impl_.category_list_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::system_info::CategoryList&>(
+      ::aspia::proto::system_info::_CategoryList_default_instance_);
 }
 inline const ::aspia::proto::system_info::CategoryList& Reply::category_list() const {
-  const ::aspia::proto::system_info::CategoryList* p = category_list_;
   // @@protoc_insertion_point(field_get:aspia.proto.system_info.Reply.category_list)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::system_info::CategoryList*>(
-      &::aspia::proto::system_info::_CategoryList_default_instance_);
+  return _internal_category_list();
+}
+inline void Reply::unsafe_arena_set_allocated_category_list(
+    ::aspia::proto::system_info::CategoryList* category_list) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.category_list_);
+  }
+  _impl_.category_list_ = category_list;
+  if (category_list) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.system_info.Reply.category_list)
 }
 inline ::aspia::proto::system_info::CategoryList* Reply::release_category_list() {
+  
+  ::aspia::proto::system_info::CategoryList* temp = _impl_.category_list_;
+  _impl_.category_list_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::system_info::CategoryList* Reply::unsafe_arena_release_category_list() {
   // @@protoc_insertion_point(field_release:aspia.proto.system_info.Reply.category_list)
   
-  ::aspia::proto::system_info::CategoryList* temp = category_list_;
-  category_list_ = NULL;
+  ::aspia::proto::system_info::CategoryList* temp = _impl_.category_list_;
+  _impl_.category_list_ = nullptr;
   return temp;
 }
-inline ::aspia::proto::system_info::CategoryList* Reply::mutable_category_list() {
+inline ::aspia::proto::system_info::CategoryList* Reply::_internal_mutable_category_list() {
   
-  if (category_list_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::system_info::CategoryList>(GetArenaNoVirtual());
-    category_list_ = p;
+  if (_impl_.category_list_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::system_info::CategoryList>(GetArenaForAllocation());
+    _impl_.category_list_ = p;
   }
+  return _impl_.category_list_;
+}
+inline ::aspia::proto::system_info::CategoryList* Reply::mutable_category_list() {
+  ::aspia::proto::system_info::CategoryList* _msg = _internal_mutable_category_list();
   // @@protoc_insertion_point(field_mutable:aspia.proto.system_info.Reply.category_list)
-  return category_list_;
+  return _msg;
 }
 inline void Reply::set_allocated_category_list(::aspia::proto::system_info::CategoryList* category_list) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete category_list_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.category_list_;
   }
   if (category_list) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(category_list);
     if (message_arena != submessage_arena) {
-      category_list = ::google::protobuf::internal::GetOwnedMessage(
+      category_list = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, category_list, submessage_arena);
     }
     
   } else {
     
   }
-  category_list_ = category_list;
+  _impl_.category_list_ = category_list;
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.system_info.Reply.category_list)
 }
 
 // .aspia.proto.system_info.Category category = 2;
+inline bool Reply::_internal_has_category() const {
+  return this != internal_default_instance() && _impl_.category_ != nullptr;
+}
 inline bool Reply::has_category() const {
-  return this != internal_default_instance() && category_ != NULL;
+  return _internal_has_category();
 }
 inline void Reply::clear_category() {
-  if (GetArenaNoVirtual() == NULL && category_ != NULL) {
-    delete category_;
+  if (GetArenaForAllocation() == nullptr && _impl_.category_ != nullptr) {
+    delete _impl_.category_;
   }
-  category_ = NULL;
+  _impl_.category_ = nullptr;
 }
 inline const ::aspia::proto::system_info::Category& Reply::_internal_category() const {
-  return *category_;
+  const ::aspia::proto::system_info::Category* p = _impl_.category_;
+  return p != nullptr ? *p : reinterpret_cast<const ::aspia::proto::system_info::Category&>(
+      ::aspia::proto::system_info::_Category_default_instance_);
 }
 inline const ::aspia::proto::system_info::Category& Reply::category() const {
-  const ::aspia::proto::system_info::Category* p = category_;
   // @@protoc_insertion_point(field_get:aspia.proto.system_info.Reply.category)
-  return p != NULL ? *p : *reinterpret_cast<const ::aspia::proto::system_info::Category*>(
-      &::aspia::proto::system_info::_Category_default_instance_);
+  return _internal_category();
+}
+inline void Reply::unsafe_arena_set_allocated_category(
+    ::aspia::proto::system_info::Category* category) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.category_);
+  }
+  _impl_.category_ = category;
+  if (category) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aspia.proto.system_info.Reply.category)
 }
 inline ::aspia::proto::system_info::Category* Reply::release_category() {
+  
+  ::aspia::proto::system_info::Category* temp = _impl_.category_;
+  _impl_.category_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::aspia::proto::system_info::Category* Reply::unsafe_arena_release_category() {
   // @@protoc_insertion_point(field_release:aspia.proto.system_info.Reply.category)
   
-  ::aspia::proto::system_info::Category* temp = category_;
-  category_ = NULL;
+  ::aspia::proto::system_info::Category* temp = _impl_.category_;
+  _impl_.category_ = nullptr;
   return temp;
 }
-inline ::aspia::proto::system_info::Category* Reply::mutable_category() {
+inline ::aspia::proto::system_info::Category* Reply::_internal_mutable_category() {
   
-  if (category_ == NULL) {
-    auto* p = CreateMaybeMessage<::aspia::proto::system_info::Category>(GetArenaNoVirtual());
-    category_ = p;
+  if (_impl_.category_ == nullptr) {
+    auto* p = CreateMaybeMessage<::aspia::proto::system_info::Category>(GetArenaForAllocation());
+    _impl_.category_ = p;
   }
+  return _impl_.category_;
+}
+inline ::aspia::proto::system_info::Category* Reply::mutable_category() {
+  ::aspia::proto::system_info::Category* _msg = _internal_mutable_category();
   // @@protoc_insertion_point(field_mutable:aspia.proto.system_info.Reply.category)
-  return category_;
+  return _msg;
 }
 inline void Reply::set_allocated_category(::aspia::proto::system_info::Category* category) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete category_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.category_;
   }
   if (category) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(category);
     if (message_arena != submessage_arena) {
-      category = ::google::protobuf::internal::GetOwnedMessage(
+      category = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, category, submessage_arena);
     }
     
   } else {
     
   }
-  category_ = category;
+  _impl_.category_ = category;
   // @@protoc_insertion_point(field_set_allocated:aspia.proto.system_info.Reply.category)
 }
 
@@ -1342,6 +2134,8 @@ inline void Reply::set_allocated_category(::aspia::proto::system_info::Category*
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -1351,4 +2145,5 @@ inline void Reply::set_allocated_category(::aspia::proto::system_info::Category*
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_INCLUDED_system_5finfo_5fsession_2eproto
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_system_5finfo_5fsession_2eproto
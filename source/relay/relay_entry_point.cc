@@ -0,0 +1,13 @@
+//
+// PROJECT:         Aspia
+// FILE:            relay/relay_entry_point.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "relay/relay_main.h"
+
+int main(int argc, char *argv[])
+{
+    return aspia::relayMain(argc, argv);
+}
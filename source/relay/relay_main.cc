@@ -0,0 +1,62 @@
+//
+// PROJECT:         Aspia
+// FILE:            relay/relay_main.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "relay/relay_main.h"
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+
+#include "relay/relay_server.h"
+#include "version.h"
+
+namespace aspia {
+
+int relayMain(int argc, char *argv[])
+{
+    QCoreApplication application(argc, argv);
+    application.setOrganizationName(QStringLiteral("Aspia"));
+    application.setApplicationName(QStringLiteral("Relay"));
+    application.setApplicationVersion(QStringLiteral(ASPIA_VERSION_STRING));
+
+    QCommandLineOption port_option(QStringLiteral("port"),
+                                   QStringLiteral("Port for the hosts and the clients."),
+                                   QStringLiteral("port"),
+                                   QString::number(kDefaultRelayTcpPort));
+    QCommandLineOption secret_option(QStringLiteral("secret"),
+                                     QStringLiteral("Secret which the hosts need to "
+                                                    "register. Required."),
+                                     QStringLiteral("secret"));
+    QCommandLineOption peer_option(QStringLiteral("peer"),
+                                   QStringLiteral("Relay to which the clients of the unknown "
+                                                  "hosts are forwarded. Can be repeated."),
+                                   QStringLiteral("address[:port]"));
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(
+        QStringLiteral("Connects the clients to the hosts which are registered on the relay. "
+                       "The sessions stay encrypted between the host and the client. The "
+                       "clients connect to the address \"host_id@relay_address\"."));
+    parser.addHelpOption();
+    parser.addVersionOption();
+    parser.addOption(port_option);
+    parser.addOption(secret_option);
+    parser.addOption(peer_option);
+    parser.process(application);
+
+    RelayServer server;
+    server.setSecret(parser.value(secret_option));
+
+    if (!server.setPeers(parser.values(peer_option)))
+        return 1;
+
+    if (!server.start(parser.value(port_option).toInt()))
+        return 1;
+
+    return application.exec();
+}
+
+} // namespace aspia
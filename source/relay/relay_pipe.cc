@@ -0,0 +1,124 @@
+//
+// PROJECT:         Aspia
+// FILE:            relay/relay_pipe.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "relay/relay_pipe.h"
+
+#include <QTimer>
+
+namespace aspia {
+
+namespace {
+
+// Maximum size of the data which waits to be written to the receiver. The reading of the
+// sender is stopped above it.
+constexpr qint64 kMaxPendingSize = 256 * 1024;
+
+// The data of the socket is read by the blocks of this size.
+constexpr qint64 kReadBlockSize = 64 * 1024;
+
+// The time for the delivery of the rest of the data after one side is disconnected.
+constexpr std::chrono::seconds kCloseTimeout{ 10 };
+
+int pipe_count = 0;
+
+} // namespace
+
+RelayPipe::RelayPipe(QTcpSocket* first, QTcpSocket* second, QObject* parent)
+    : QObject(parent),
+      first_(first),
+      second_(second)
+{
+    ++pipe_count;
+
+    for (QTcpSocket* socket : { first, second })
+    {
+        QTcpSocket* other = (socket == first) ? second : first;
+
+        socket->disconnect();
+        socket->setParent(this);
+        socket->setSocketOption(QTcpSocket::LowDelayOption, 1);
+
+        // The socket does not buffer more than the pipe forwards at once.
+        socket->setReadBufferSize(kMaxPendingSize);
+
+        connect(socket, &QTcpSocket::readyRead, this,
+                [this, socket, other]() { forward(socket, other); });
+
+        connect(socket, &QTcpSocket::bytesWritten, this,
+                [this, socket, other]() { forward(other, socket); });
+
+        connect(socket, &QTcpSocket::disconnected, this, &RelayPipe::close,
+                Qt::QueuedConnection);
+    }
+
+    // The data which is received with the request of the relay is forwarded at once.
+    forward(first, second);
+    forward(second, first);
+
+    // The disconnection which is received before the pipe is lost.
+    if (first->state() != QTcpSocket::ConnectedState ||
+        second->state() != QTcpSocket::ConnectedState)
+    {
+        close();
+    }
+}
+
+RelayPipe::~RelayPipe()
+{
+    --pipe_count;
+}
+
+// static
+int RelayPipe::pipeCount()
+{
+    return pipe_count;
+}
+
+void RelayPipe::forward(QTcpSocket* source, QTcpSocket* target)
+{
+    if (closed_)
+        return;
+
+    while (source->bytesAvailable() > 0 && target->bytesToWrite() < kMaxPendingSize)
+    {
+        const qint64 size = qMin(qMin(source->bytesAvailable(), kReadBlockSize),
+                                 kMaxPendingSize - target->bytesToWrite());
+
+        const QByteArray buffer = source->read(size);
+        if (buffer.isEmpty() || target->write(buffer) != buffer.size())
+        {
+            first_->abort();
+            second_->abort();
+            return;
+        }
+    }
+}
+
+void RelayPipe::close()
+{
+    if (!closed_)
+    {
+        // The data which is received before the disconnection is delivered to the other side.
+        forward(first_, second_);
+        forward(second_, first_);
+
+        closed_ = true;
+
+        first_->disconnectFromHost();
+        second_->disconnectFromHost();
+
+        QTimer::singleShot(kCloseTimeout, this, &RelayPipe::deleteLater);
+    }
+
+    if (first_->state() == QTcpSocket::UnconnectedState &&
+        second_->state() == QTcpSocket::UnconnectedState)
+    {
+        deleteLater();
+    }
+}
+
+} // namespace aspia
@@ -0,0 +1,47 @@
+//
+// PROJECT:         Aspia
+// FILE:            relay/relay_pipe.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_RELAY__RELAY_PIPE_H
+#define _ASPIA_RELAY__RELAY_PIPE_H
+
+#include <QTcpSocket>
+
+namespace aspia {
+
+//
+// Forwards the bytes between the client and the host without changes. The data of each
+// direction is read while fewer than kMaxPendingSize bytes wait to be written to the other
+// socket, so the slow receiver slows down the sender by the TCP flow control and the relay
+// does not buffer the stream. When any socket is disconnected, the other one is closed after
+// the rest of the data is written, and the pipe deletes itself with the sockets.
+//
+class RelayPipe : public QObject
+{
+    Q_OBJECT
+
+public:
+    // Takes the ownership of the sockets.
+    RelayPipe(QTcpSocket* first, QTcpSocket* second, QObject* parent = nullptr);
+    ~RelayPipe();
+
+    // The number of the pipes which are not deleted.
+    static int pipeCount();
+
+private:
+    void forward(QTcpSocket* source, QTcpSocket* target);
+    void close();
+
+    QTcpSocket* first_;
+    QTcpSocket* second_;
+    bool closed_ = false;
+
+    Q_DISABLE_COPY(RelayPipe)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_RELAY__RELAY_PIPE_H
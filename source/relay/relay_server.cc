@@ -0,0 +1,542 @@
+//
+// PROJECT:         Aspia
+// FILE:            relay/relay_server.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "relay/relay_server.h"
+
+#include <QDebug>
+#include <QTimer>
+#include <QTimerEvent>
+
+#include <memory>
+
+#include "base/message_serialization.h"
+#include "crypto/random.h"
+#include "network/relay_protocol.h"
+#include "relay/relay_pipe.h"
+
+extern "C" {
+#define SODIUM_STATIC
+
+#pragma warning(push, 3)
+#include <sodium.h>
+#pragma warning(pop)
+} // extern "C"
+
+namespace aspia {
+
+namespace {
+
+// The time for the request of a new connection.
+constexpr std::chrono::seconds kRequestTimeout{ 15 };
+
+// The time for the connection of the host to the waiting client.
+constexpr std::chrono::seconds kAcceptTimeout{ 15 };
+
+// The time for the reply of the peer to the forwarded client.
+constexpr std::chrono::seconds kPeerTimeout{ 15 };
+
+// The interval of the check of the pending connections.
+constexpr std::chrono::seconds kTimeoutCheckInterval{ 1 };
+
+// The connections above the limit are closed at once.
+constexpr int kMaxPendingSockets = 1024;
+
+// The clients above the limits of the waiting clients are rejected at once.
+constexpr int kMaxWaitingClients = 4096;
+constexpr int kMaxWaitingClientsPerHost = 64;
+
+// The limit of the key of the host in the registration.
+constexpr size_t kMaxHostKeySize = 64;
+
+// The client is not forwarded further by the peers, so the wrong configuration of the peers
+// does not forward it round.
+constexpr quint32 kMaxHops = 2;
+
+quint64 generateToken()
+{
+    quint64 token;
+
+    do
+    {
+        token = (static_cast<quint64>(Random::generateNumber()) << 32) | Random::generateNumber();
+    }
+    while (!token);
+
+    return token;
+}
+
+bool isEqualKey(const QByteArray& key, const std::string& other)
+{
+    if (key.size() != static_cast<int>(other.size()))
+        return false;
+
+    return sodium_memcmp(key.constData(), other.data(), other.size()) == 0;
+}
+
+QString peerAddress(const QTcpSocket* socket)
+{
+    const QHostAddress address = socket->peerAddress();
+
+    bool ok = false;
+    const QHostAddress ipv4_address(address.toIPv4Address(&ok));
+    if (ok)
+        return ipv4_address.toString();
+
+    return address.toString();
+}
+
+} // namespace
+
+RelayServer::RelayServer(QObject* parent)
+    : QObject(parent)
+{
+    // Nothing
+}
+
+void RelayServer::setSecret(const QString& secret)
+{
+    secret_ = secret.toUtf8();
+}
+
+bool RelayServer::setPeers(const QStringList& peers)
+{
+    peers_.clear();
+
+    for (const QString& text : peers)
+    {
+        Peer peer;
+
+        if (!RelayProtocol::parseAddress(text, &peer.address, &peer.port))
+        {
+            qWarning() << "Invalid address of the peer:" << text;
+            return false;
+        }
+
+        peers_.push_back(peer);
+    }
+
+    return true;
+}
+
+bool RelayServer::start(int port)
+{
+    if (!tcp_server_.isNull())
+    {
+        qWarning("Server already started");
+        return false;
+    }
+
+    // Without the secret any peer can register the hosts.
+    if (secret_.isEmpty())
+    {
+        qWarning("The secret of the relay is not set");
+        return false;
+    }
+
+    tcp_server_ = new QTcpServer(this);
+
+    connect(tcp_server_, &QTcpServer::newConnection, this, &RelayServer::onNewConnection);
+
+    if (!tcp_server_->listen(QHostAddress::Any, port))
+    {
+        qWarning() << "listen failed: " << tcp_server_->errorString();
+        return false;
+    }
+
+    qInfo() << "Relay is started on port" << port << "with" << peers_.size() << "peers";
+    return true;
+}
+
+void RelayServer::timerEvent(QTimerEvent* event)
+{
+    if (event->timerId() != timeout_timer_id_)
+    {
+        QObject::timerEvent(event);
+        return;
+    }
+
+    auto it = pending_sockets_.begin();
+
+    while (it != pending_sockets_.end())
+    {
+        QTcpSocket* socket = it->socket;
+
+        if (!socket)
+        {
+            it = pending_sockets_.erase(it);
+        }
+        else if (it->start_time.hasExpired(std::chrono::milliseconds(kRequestTimeout).count()))
+        {
+            qWarning() << "Request timeout for" << peerAddress(socket);
+
+            it = pending_sockets_.erase(it);
+            socket->abort();
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    auto client = clients_.begin();
+
+    while (client != clients_.end())
+    {
+        QTcpSocket* socket = client->socket;
+
+        if (!socket)
+        {
+            client = clients_.erase(client);
+        }
+        else if (client->start_time.hasExpired(
+                     std::chrono::milliseconds(kAcceptTimeout).count()))
+        {
+            client = clients_.erase(client);
+
+            sendReply(socket, proto::relay::Reply::STATUS_HOST_TIMEOUT);
+            socket->disconnectFromHost();
+        }
+        else
+        {
+            ++client;
+        }
+    }
+
+    if (pending_sockets_.isEmpty() && clients_.isEmpty())
+    {
+        killTimer(timeout_timer_id_);
+        timeout_timer_id_ = 0;
+    }
+}
+
+void RelayServer::onNewConnection()
+{
+    while (QTcpSocket* socket = tcp_server_->nextPendingConnection())
+    {
+        // The socket is deleted when it is closed until it is passed to the pipe.
+        connect(socket, &QTcpSocket::disconnected, socket, &QTcpSocket::deleteLater,
+                Qt::QueuedConnection);
+
+        if (pending_sockets_.size() >= kMaxPendingSockets)
+        {
+            qWarning() << "Too many pending connections. Connection from" << peerAddress(socket)
+                       << "is rejected";
+
+            socket->abort();
+            socket->deleteLater();
+            continue;
+        }
+
+        connect(socket, &QTcpSocket::readyRead, this,
+                [this, socket]() { onRequestReadyRead(socket); });
+
+        PendingSocket pending_socket;
+        pending_socket.socket = socket;
+        pending_socket.start_time.start();
+
+        pending_sockets_.push_back(pending_socket);
+        startTimeoutTimer();
+    }
+}
+
+void RelayServer::onRequestReadyRead(QTcpSocket* socket)
+{
+    QByteArray buffer;
+
+    const RelayProtocol::ReadResult result = RelayProtocol::readMessage(socket, &buffer);
+    if (result == RelayProtocol::ReadResult::PENDING)
+        return;
+
+    // The next data of the connection is not a request.
+    socket->disconnect(this);
+
+    for (auto it = pending_sockets_.begin(); it != pending_sockets_.end(); ++it)
+    {
+        if (it->socket == socket)
+        {
+            pending_sockets_.erase(it);
+            break;
+        }
+    }
+
+    proto::relay::Request request;
+
+    if (result == RelayProtocol::ReadResult::INVALID || !parseMessage(buffer, request))
+    {
+        qWarning() << "Invalid request from" << peerAddress(socket);
+        sendReply(socket, proto::relay::Reply::STATUS_INVALID);
+        socket->disconnectFromHost();
+        return;
+    }
+
+    switch (request.type())
+    {
+        case proto::relay::Request::TYPE_REGISTER:
+            registerHost(socket, request);
+            break;
+
+        case proto::relay::Request::TYPE_CONNECT:
+            connectClient(socket, request);
+            break;
+
+        case proto::relay::Request::TYPE_ACCEPT:
+            acceptClient(socket, request);
+            break;
+
+        default:
+        {
+            sendReply(socket, proto::relay::Reply::STATUS_INVALID);
+            socket->disconnectFromHost();
+        }
+        break;
+    }
+}
+
+void RelayServer::registerHost(QTcpSocket* socket, const proto::relay::Request& request)
+{
+    const QString host_id = QString::fromStdString(request.host_id());
+
+    if (host_id.isEmpty() || host_id.contains(RelayProtocol::kHostIdSeparator))
+    {
+        sendReply(socket, proto::relay::Reply::STATUS_INVALID);
+        socket->disconnectFromHost();
+        return;
+    }
+
+    if (request.host_key().empty() || request.host_key().size() > kMaxHostKeySize)
+    {
+        sendReply(socket, proto::relay::Reply::STATUS_INVALID);
+        socket->disconnectFromHost();
+        return;
+    }
+
+    if (!isEqualKey(secret_, request.secret()))
+    {
+        qWarning() << "Wrong secret of host" << host_id << "from" << peerAddress(socket);
+        sendReply(socket, proto::relay::Reply::STATUS_ACCESS_DENIED);
+        socket->disconnectFromHost();
+        return;
+    }
+
+    // The host which has lost the previous connection registers again before the relay
+    // notices it. The connection is replaced only by the same host, so the known secret of
+    // the relay does not allow to take the clients of the other hosts.
+    const Host previous = hosts_.value(host_id);
+    if (!previous.socket.isNull())
+    {
+        if (!isEqualKey(previous.key, request.host_key()))
+        {
+            qWarning() << "Host" << host_id << "is registered with another key. Registration from"
+                       << peerAddress(socket) << "is rejected";
+            sendReply(socket, proto::relay::Reply::STATUS_ACCESS_DENIED);
+            socket->disconnectFromHost();
+            return;
+        }
+
+        previous.socket->abort();
+    }
+
+    Host host;
+    host.socket = socket;
+    host.key = QByteArray::fromStdString(request.host_key());
+
+    hosts_.insert(host_id, host);
+
+    socket->setSocketOption(QTcpSocket::KeepAliveOption, 1);
+
+    // The host sends only the pings after the registration.
+    connect(socket, &QTcpSocket::readyRead, socket, [socket]() { socket->readAll(); });
+
+    connect(socket, &QTcpSocket::disconnected, this, [this, host_id, socket]()
+    {
+        if (hosts_.value(host_id).socket == socket)
+        {
+            qInfo() << "Host" << host_id << "is unregistered";
+            hosts_.remove(host_id);
+        }
+    });
+
+    qInfo() << "Host" << host_id << "is registered from" << peerAddress(socket);
+
+    // The host offers its public address to the clients for the direct connections.
+    proto::relay::Reply reply;
+    reply.set_status(proto::relay::Reply::STATUS_SUCCESS);
+    reply.set_address(peerAddress(socket).toStdString());
+
+    RelayProtocol::writeMessage(socket, serializeMessage(reply));
+}
+
+void RelayServer::connectClient(QTcpSocket* socket, const proto::relay::Request& request)
+{
+    const QString host_id = QString::fromStdString(request.host_id());
+
+    QPointer<QTcpSocket> host = hosts_.value(host_id).socket;
+    if (host.isNull() || host->state() != QTcpSocket::ConnectedState)
+    {
+        forwardClient(socket, request, 0);
+        return;
+    }
+
+    int host_clients = 0;
+
+    for (auto it = clients_.constBegin(); it != clients_.constEnd(); ++it)
+    {
+        if (it->host_id == host_id && !it->socket.isNull())
+            ++host_clients;
+    }
+
+    if (clients_.size() >= kMaxWaitingClients || host_clients >= kMaxWaitingClientsPerHost)
+    {
+        qWarning() << "Too many waiting clients. Client" << peerAddress(socket)
+                   << "of host" << host_id << "is rejected";
+
+        sendReply(socket, proto::relay::Reply::STATUS_BUSY);
+        socket->disconnectFromHost();
+        return;
+    }
+
+    const quint64 token = generateToken();
+
+    WaitingClient client;
+    client.socket = socket;
+    client.start_time.start();
+    client.host_id = host_id;
+
+    clients_.insert(token, client);
+    startTimeoutTimer();
+
+    proto::relay::Incoming incoming;
+    incoming.set_token(token);
+
+    RelayProtocol::writeMessage(host, serializeMessage(incoming));
+}
+
+void RelayServer::acceptClient(QTcpSocket* socket, const proto::relay::Request& request)
+{
+    QPointer<QTcpSocket> client = clients_.take(request.token()).socket;
+
+    if (client.isNull() || client->state() != QTcpSocket::ConnectedState)
+    {
+        sendReply(socket, proto::relay::Reply::STATUS_INVALID);
+        socket->disconnectFromHost();
+        return;
+    }
+
+    qInfo() << "Client" << peerAddress(client) << "is connected to host"
+            << peerAddress(socket) << ". Pipes:" << RelayPipe::pipeCount() + 1;
+
+    sendReply(client, proto::relay::Reply::STATUS_SUCCESS);
+    sendReply(socket, proto::relay::Reply::STATUS_SUCCESS);
+
+    new RelayPipe(client, socket, this);
+}
+
+void RelayServer::forwardClient(QTcpSocket* socket,
+                                const proto::relay::Request& request,
+                                int peer_index)
+{
+    if (peer_index >= peers_.size() || request.hops() >= kMaxHops)
+    {
+        sendReply(socket, proto::relay::Reply::STATUS_HOST_NOT_FOUND);
+        socket->disconnectFromHost();
+        return;
+    }
+
+    const Peer& peer = peers_[peer_index];
+
+    QPointer<QTcpSocket> client = socket;
+    QTcpSocket* peer_socket = new QTcpSocket(this);
+
+    proto::relay::Request forwarded_request = request;
+    forwarded_request.set_hops(request.hops() + 1);
+
+    connect(peer_socket, &QTcpSocket::connected, peer_socket, [peer_socket, forwarded_request]()
+    {
+        RelayProtocol::writeMessage(peer_socket, serializeMessage(forwarded_request));
+    });
+
+    // The error may be received after the failed reply, so the next peer is tried once.
+    std::shared_ptr<bool> finished = std::make_shared<bool>(false);
+
+    auto try_next_peer = [this, client, peer_socket, request, peer_index, finished]()
+    {
+        if (*finished)
+            return;
+
+        *finished = true;
+
+        peer_socket->abort();
+        peer_socket->deleteLater();
+
+        if (!client.isNull() && client->state() == QTcpSocket::ConnectedState)
+            forwardClient(client, request, peer_index + 1);
+    };
+
+    // The peer which does not reply is skipped.
+    QTimer* timer = new QTimer(peer_socket);
+    timer->setSingleShot(true);
+    connect(timer, &QTimer::timeout, this, try_next_peer);
+    timer->start(kPeerTimeout);
+
+    connect(peer_socket, QOverload<QTcpSocket::SocketError>::of(&QTcpSocket::error),
+            this, try_next_peer, Qt::QueuedConnection);
+
+    connect(peer_socket, &QTcpSocket::readyRead, this,
+            [this, client, peer_socket, timer, try_next_peer, finished]()
+    {
+        QByteArray buffer;
+
+        const RelayProtocol::ReadResult result =
+            RelayProtocol::readMessage(peer_socket, &buffer);
+        if (result == RelayProtocol::ReadResult::PENDING)
+            return;
+
+        proto::relay::Reply reply;
+
+        if (result == RelayProtocol::ReadResult::INVALID || !parseMessage(buffer, reply) ||
+            reply.status() != proto::relay::Reply::STATUS_SUCCESS)
+        {
+            try_next_peer();
+            return;
+        }
+
+        *finished = true;
+        delete timer;
+
+        if (client.isNull() || client->state() != QTcpSocket::ConnectedState)
+        {
+            peer_socket->abort();
+            peer_socket->deleteLater();
+            return;
+        }
+
+        qInfo() << "Client" << peerAddress(client) << "is forwarded to peer"
+                << peerAddress(peer_socket) << ". Pipes:" << RelayPipe::pipeCount() + 1;
+
+        sendReply(client, proto::relay::Reply::STATUS_SUCCESS);
+
+        new RelayPipe(client, peer_socket, this);
+    });
+
+    peer_socket->connectToHost(peer.address, peer.port);
+}
+
+void RelayServer::sendReply(QTcpSocket* socket, proto::relay::Reply::Status status)
+{
+    proto::relay::Reply reply;
+    reply.set_status(status);
+
+    RelayProtocol::writeMessage(socket, serializeMessage(reply));
+}
+
+void RelayServer::startTimeoutTimer()
+{
+    if (!timeout_timer_id_)
+        timeout_timer_id_ = startTimer(kTimeoutCheckInterval);
+}
+
+} // namespace aspia
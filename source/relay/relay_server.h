@@ -0,0 +1,115 @@
+//
+// PROJECT:         Aspia
+// FILE:            relay/relay_server.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_RELAY__RELAY_SERVER_H
+#define _ASPIA_RELAY__RELAY_SERVER_H
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QList>
+#include <QPointer>
+#include <QStringList>
+#include <QTcpServer>
+#include <QTcpSocket>
+
+#include "protocol/relay.pb.h"
+
+namespace aspia {
+
+//
+// Connects the clients to the hosts which can not accept the direct connections. The hosts
+// keep the registration connections open. When a client connects to the registered host,
+// the host is asked to open one more connection for it, and the bytes of the two connections
+// are forwarded by RelayPipe. The relay does not take part in the key exchange, so it can not
+// read the sessions.
+//
+// The relays of the different regions are connected by the peers. The client of the host
+// which is not registered on the relay is forwarded to the peers one by one, so the client
+// connects to the nearest relay and the host registers on its own nearest relay.
+//
+class RelayServer : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit RelayServer(QObject* parent = nullptr);
+    ~RelayServer() = default;
+
+    // Must be called before the start. Only the hosts with this secret can register. The relay
+    // is not started without the secret.
+    void setSecret(const QString& secret);
+
+    // Must be called before the start. The peers are "address" or "address:port".
+    bool setPeers(const QStringList& peers);
+
+    bool start(int port);
+
+protected:
+    // QObject implementation.
+    void timerEvent(QTimerEvent* event) override;
+
+private:
+    void onNewConnection();
+    void onRequestReadyRead(QTcpSocket* socket);
+    void registerHost(QTcpSocket* socket, const proto::relay::Request& request);
+    void connectClient(QTcpSocket* socket, const proto::relay::Request& request);
+    void acceptClient(QTcpSocket* socket, const proto::relay::Request& request);
+
+    // Tries the peers from |peer_index| until one of them connects the client to the host.
+    void forwardClient(QTcpSocket* socket, const proto::relay::Request& request, int peer_index);
+
+    void sendReply(QTcpSocket* socket, proto::relay::Reply::Status status);
+    void startTimeoutTimer();
+
+    QPointer<QTcpServer> tcp_server_;
+    QByteArray secret_;
+
+    struct Peer
+    {
+        QString address;
+        int port;
+    };
+
+    QList<Peer> peers_;
+
+    // The connections which have not sent the request yet.
+    struct PendingSocket
+    {
+        QPointer<QTcpSocket> socket;
+        QElapsedTimer start_time;
+    };
+
+    QList<PendingSocket> pending_sockets_;
+
+    // The registration connections of the hosts and the keys with which they are registered.
+    struct Host
+    {
+        QPointer<QTcpSocket> socket;
+        QByteArray key;
+    };
+
+    QHash<QString, Host> hosts_;
+
+    // The clients which wait for the connections of the hosts. They are limited by the host
+    // and in total, and are rejected after kAcceptTimeout.
+    struct WaitingClient
+    {
+        QPointer<QTcpSocket> socket;
+        QElapsedTimer start_time;
+        QString host_id;
+    };
+
+    QHash<quint64, WaitingClient> clients_;
+
+    int timeout_timer_id_ = 0;
+
+    Q_DISABLE_COPY(RelayServer)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_RELAY__RELAY_SERVER_H
@@ -0,0 +1,24 @@
+//
+// PROJECT:         Aspia
+// FILE:            system_info/category.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "system_info/category.h"
+
+#include "system_info/category_dmi.h"
+
+namespace aspia {
+
+// static
+std::vector<std::unique_ptr<Category>> Category::createAll()
+{
+    std::vector<std::unique_ptr<Category>> categories;
+
+    categories.push_back(std::make_unique<CategoryDmi>());
+
+    return categories;
+}
+
+} // namespace aspia
@@ -0,0 +1,39 @@
+//
+// PROJECT:         Aspia
+// FILE:            system_info/category.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_SYSTEM_INFO__CATEGORY_H
+#define _ASPIA_SYSTEM_INFO__CATEGORY_H
+
+#include <QtGlobal>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace aspia {
+
+//
+// The category of the system information which is collected by the host. The data of the
+// category is a serialized message of its protocol.
+//
+class Category
+{
+public:
+    virtual ~Category() = default;
+
+    // The unique identifier by which the client requests the category.
+    virtual const char* uuid() const = 0;
+
+    // Collects the information. It may take a long time, so it is called in a background thread.
+    virtual std::string collect() = 0;
+
+    static std::vector<std::unique_ptr<Category>> createAll();
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_SYSTEM_INFO__CATEGORY_H
@@ -0,0 +1,308 @@
+//
+// PROJECT:         Aspia
+// FILE:            system_info/category_dmi.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "system_info/category_dmi.h"
+
+#include <QDebug>
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#include "system_info/protocol/dmi.pb.h"
+
+namespace aspia {
+
+namespace {
+
+constexpr DWORD kRawSmbiosSignature = 'RSMB';
+
+// The header of the data returned by GetSystemFirmwareTable.
+struct RawSmbiosData
+{
+    quint8 used_20_calling_method;
+    quint8 major_version;
+    quint8 minor_version;
+    quint8 dmi_revision;
+    quint32 length;
+    quint8 table_data[1];
+};
+
+constexpr size_t kRawSmbiosHeaderSize = offsetof(RawSmbiosData, table_data);
+
+enum TableType : quint8
+{
+    TABLE_TYPE_BIOS   = 0,
+    TABLE_TYPE_SYSTEM = 1,
+    TABLE_TYPE_END    = 127
+};
+
+constexpr size_t kTableHeaderSize = 4;
+
+// One structure of the SMBIOS table: the formatted area followed by the strings.
+class Table
+{
+public:
+    Table(const quint8* data, size_t length, const quint8* strings, const quint8* end)
+        : data_(data), length_(length), strings_(strings), end_(end)
+    {
+        // Nothing
+    }
+
+    size_t length() const { return length_; }
+
+    quint8 byte(size_t offset) const
+    {
+        return offset < length_ ? data_[offset] : 0;
+    }
+
+    quint16 word(size_t offset) const
+    {
+        return static_cast<quint16>(byte(offset) | (byte(offset + 1) << 8));
+    }
+
+    quint32 dword(size_t offset) const
+    {
+        return static_cast<quint32>(word(offset)) |
+               (static_cast<quint32>(word(offset + 2)) << 16);
+    }
+
+    quint64 qword(size_t offset) const
+    {
+        return static_cast<quint64>(dword(offset)) |
+               (static_cast<quint64>(dword(offset + 4)) << 32);
+    }
+
+    // The strings are numbered from one. Zero means that the string is not specified.
+    std::string string(size_t offset) const
+    {
+        quint8 number = byte(offset);
+        if (!number)
+            return std::string();
+
+        const quint8* current = strings_;
+
+        while (current < end_ && *current)
+        {
+            const quint8* string_end = current;
+            while (string_end < end_ && *string_end)
+                ++string_end;
+
+            if (--number == 0)
+            {
+                QString string = QString::fromLatin1(reinterpret_cast<const char*>(current),
+                                                     static_cast<int>(string_end - current));
+                return string.trimmed().toStdString();
+            }
+
+            current = string_end + 1;
+        }
+
+        return std::string();
+    }
+
+private:
+    const quint8* data_;
+    size_t length_;
+    const quint8* strings_;
+    const quint8* end_;
+};
+
+void readBios(const Table& table, system_info::dmi::Bios* bios)
+{
+    bios->set_manufacturer(table.string(0x04));
+    bios->set_version(table.string(0x05));
+    bios->set_date(table.string(0x08));
+
+    const quint16 segment = table.word(0x06);
+    if (segment)
+    {
+        const QString address =
+            QString::number(segment * 16, 16).rightJustified(5, QLatin1Char('0')).toUpper();
+        bios->set_address((address + QLatin1Char('h')).toStdString());
+        bios->set_runtime_size((0x10000 - segment) * 16);
+    }
+
+    bios->set_size((static_cast<quint64>(table.byte(0x09)) + 1) * 64 * 1024);
+
+    if (table.length() >= 0x18)
+    {
+        bios->set_bios_revision(
+            QString("%1.%2").arg(table.byte(0x14)).arg(table.byte(0x15)).toStdString());
+
+        if (table.byte(0x16) != 0xFF)
+        {
+            bios->set_firmware_revision(
+                QString("%1.%2").arg(table.byte(0x16)).arg(table.byte(0x17)).toStdString());
+        }
+    }
+
+    const quint64 flags = table.qword(0x0A);
+    const quint8 ext1 = table.length() >= 0x13 ? table.byte(0x12) : 0;
+    const quint8 ext2 = table.length() >= 0x14 ? table.byte(0x13) : 0;
+
+    auto bit = [](quint64 value, int index) { return (value & (1ULL << index)) != 0; };
+
+    system_info::dmi::Bios::Characteristics* item = bios->mutable_characteristics();
+
+    item->set_has_isa(bit(flags, 4));
+    item->set_has_mca(bit(flags, 5));
+    item->set_has_eisa(bit(flags, 6));
+    item->set_has_pci(bit(flags, 7));
+    item->set_has_pc_card(bit(flags, 8));
+    item->set_has_pnp(bit(flags, 9));
+    item->set_has_apm(bit(flags, 10));
+    item->set_has_bios_upgradeable(bit(flags, 11));
+    item->set_has_bios_shadowing(bit(flags, 12));
+    item->set_has_vlb(bit(flags, 13));
+    item->set_has_escd(bit(flags, 14));
+    item->set_has_boot_from_cd(bit(flags, 15));
+    item->set_has_selectable_boot(bit(flags, 16));
+    item->set_has_socketed_boot_rom(bit(flags, 17));
+    item->set_has_boot_from_pc_card(bit(flags, 18));
+    item->set_has_edd(bit(flags, 19));
+    item->set_has_japanese_floppy_for_nec9800(bit(flags, 20));
+    item->set_has_japanece_floppy_for_toshiba(bit(flags, 21));
+    item->set_has_525_360kb_floppy(bit(flags, 22));
+    item->set_has_525_12mb_floppy(bit(flags, 23));
+    item->set_has_35_720kb_floppy(bit(flags, 24));
+    item->set_has_35_288mb_floppy(bit(flags, 25));
+    item->set_has_print_screen(bit(flags, 26));
+    item->set_has_8042_keyboard(bit(flags, 27));
+    item->set_has_serial(bit(flags, 28));
+    item->set_has_printer(bit(flags, 29));
+    item->set_has_cga_video(bit(flags, 30));
+    item->set_has_nec_pc98(bit(flags, 31));
+
+    item->set_has_acpi(bit(ext1, 0));
+    item->set_has_usb_legacy(bit(ext1, 1));
+    item->set_has_agp(bit(ext1, 2));
+    item->set_has_i2o_boot(bit(ext1, 3));
+    item->set_has_ls120_boot(bit(ext1, 4));
+    item->set_has_atapi_zip_drive_boot(bit(ext1, 5));
+    item->set_has_ieee1394_boot(bit(ext1, 6));
+    item->set_has_smart_battery(bit(ext1, 7));
+
+    item->set_has_bios_boot_specification(bit(ext2, 0));
+    item->set_has_key_init_network_boot(bit(ext2, 1));
+    item->set_has_targeted_content_distrib(bit(ext2, 2));
+    item->set_has_uefi(bit(ext2, 3));
+    item->set_has_virtual_machine(bit(ext2, 4));
+}
+
+system_info::dmi::System::WakeupType wakeupType(quint8 value)
+{
+    switch (value)
+    {
+        case 0x01: return system_info::dmi::System::WAKEUP_TYPE_OTHER;
+        case 0x03: return system_info::dmi::System::WAKEUP_TYPE_APM_TIMER;
+        case 0x04: return system_info::dmi::System::WAKEUP_TYPE_MODEM_RING;
+        case 0x05: return system_info::dmi::System::WAKEUP_TYPE_LAN_REMOTE;
+        case 0x06: return system_info::dmi::System::WAKEUP_TYPE_POWER_SWITCH;
+        case 0x07: return system_info::dmi::System::WAKEUP_TYPE_PCI_PME;
+        case 0x08: return system_info::dmi::System::WAKEUP_TYPE_AC_POWER_RESTORED;
+        default: return system_info::dmi::System::WAKEUP_TYPE_UNKNOWN;
+    }
+}
+
+void readSystem(const Table& table, system_info::dmi::System* system)
+{
+    system->set_manufacturer(table.string(0x04));
+    system->set_product_name(table.string(0x05));
+    system->set_version(table.string(0x06));
+    system->set_serial_number(table.string(0x07));
+
+    // SMBIOS 2.1.
+    if (table.length() >= 0x19)
+    {
+        // The first three fields are in the little-endian order.
+        system->set_uuid(QString("%1-%2-%3-%4%5-%6%7%8%9%10%11")
+            .arg(table.dword(0x08), 8, 16, QLatin1Char('0'))
+            .arg(table.word(0x0C), 4, 16, QLatin1Char('0'))
+            .arg(table.word(0x0E), 4, 16, QLatin1Char('0'))
+            .arg(table.byte(0x10), 2, 16, QLatin1Char('0'))
+            .arg(table.byte(0x11), 2, 16, QLatin1Char('0'))
+            .arg(table.byte(0x12), 2, 16, QLatin1Char('0'))
+            .arg(table.byte(0x13), 2, 16, QLatin1Char('0'))
+            .arg(table.byte(0x14), 2, 16, QLatin1Char('0'))
+            .arg(table.byte(0x15), 2, 16, QLatin1Char('0'))
+            .arg(table.byte(0x16), 2, 16, QLatin1Char('0'))
+            .arg(table.byte(0x17), 2, 16, QLatin1Char('0'))
+            .toUpper().toStdString());
+
+        system->set_wakeup_type(wakeupType(table.byte(0x18)));
+    }
+
+    // SMBIOS 2.4.
+    if (table.length() >= 0x1B)
+    {
+        system->set_sku_number(table.string(0x19));
+        system->set_family(table.string(0x1A));
+    }
+}
+
+} // namespace
+
+// static
+const char CategoryDmi::kUuid[] = "{B0B73D57-2CDC-4814-9AE0-C7AF7DDDD60E}";
+
+std::string CategoryDmi::collect()
+{
+    const UINT size = GetSystemFirmwareTable(kRawSmbiosSignature, 0, nullptr, 0);
+    if (size < kRawSmbiosHeaderSize)
+    {
+        qWarning("GetSystemFirmwareTable failed");
+        return std::string();
+    }
+
+    std::vector<quint8> buffer(size);
+
+    if (GetSystemFirmwareTable(kRawSmbiosSignature, 0, buffer.data(), size) != size)
+    {
+        qWarning("GetSystemFirmwareTable failed");
+        return std::string();
+    }
+
+    const RawSmbiosData* smbios = reinterpret_cast<const RawSmbiosData*>(buffer.data());
+
+    const quint8* current = smbios->table_data;
+    const quint8* end = current + qMin<size_t>(smbios->length, size - kRawSmbiosHeaderSize);
+
+    system_info::dmi::Dmi dmi;
+
+    while (current + kTableHeaderSize <= end)
+    {
+        const quint8 type = current[0];
+        const quint8 length = current[1];
+
+        if (length < kTableHeaderSize || current + length > end)
+            break;
+
+        // The strings are ended by two zeros.
+        const quint8* strings = current + length;
+        const quint8* next = strings;
+
+        while (next + 1 < end && (next[0] || next[1]))
+            ++next;
+
+        next += 2;
+
+        Table table(current, length, strings, qMin(next, end));
+
+        if (type == TABLE_TYPE_BIOS)
+            readBios(table, dmi.add_bios());
+        else if (type == TABLE_TYPE_SYSTEM)
+            readSystem(table, dmi.add_system());
+        else if (type == TABLE_TYPE_END)
+            break;
+
+        current = next;
+    }
+
+    return dmi.SerializeAsString();
+}
+
+} // namespace aspia
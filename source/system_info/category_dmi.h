@@ -0,0 +1,37 @@
+//
+// PROJECT:         Aspia
+// FILE:            system_info/category_dmi.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_SYSTEM_INFO__CATEGORY_DMI_H
+#define _ASPIA_SYSTEM_INFO__CATEGORY_DMI_H
+
+#include "system_info/category.h"
+
+namespace aspia {
+
+//
+// The information of the SMBIOS tables of the firmware. The data is a serialized
+// |system_info::dmi::Dmi|.
+//
+class CategoryDmi : public Category
+{
+public:
+    static const char kUuid[];
+
+    CategoryDmi() = default;
+    ~CategoryDmi() = default;
+
+    // Category implementation.
+    const char* uuid() const override { return kUuid; }
+    std::string collect() override;
+
+private:
+    Q_DISABLE_COPY(CategoryDmi)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_SYSTEM_INFO__CATEGORY_DMI_H
@@ -7,17 +7,235 @@
 
 #include "system_info/ui/dmi_parser.h"
 
+#include <QDebug>
+
+#include "system_info/category_dmi.h"
+#include "system_info/protocol/dmi.pb.h"
+#include "system_info/ui/info_model.h"
+#include "system_info/ui/parse_thread.h"
+
 namespace aspia {
 
+namespace {
+
+// The groups are expanded after the parsing if there are not more of them.
+constexpr int kMaxExpandedGroups = 32;
+
+using Characteristics = system_info::dmi::Bios::Characteristics;
+
+struct Characteristic
+{
+    const char* name;
+    bool (Characteristics::*value)() const;
+};
+
+const Characteristic kCharacteristics[] =
+{
+    { QT_TRANSLATE_NOOP("DmiParser", "ISA"), &Characteristics::has_isa },
+    { QT_TRANSLATE_NOOP("DmiParser", "MCA"), &Characteristics::has_mca },
+    { QT_TRANSLATE_NOOP("DmiParser", "EISA"), &Characteristics::has_eisa },
+    { QT_TRANSLATE_NOOP("DmiParser", "PCI"), &Characteristics::has_pci },
+    { QT_TRANSLATE_NOOP("DmiParser", "PC Card (PCMCIA)"), &Characteristics::has_pc_card },
+    { QT_TRANSLATE_NOOP("DmiParser", "Plug and Play"), &Characteristics::has_pnp },
+    { QT_TRANSLATE_NOOP("DmiParser", "APM"), &Characteristics::has_apm },
+    { QT_TRANSLATE_NOOP("DmiParser", "BIOS is Upgradeable (Flash)"),
+      &Characteristics::has_bios_upgradeable },
+    { QT_TRANSLATE_NOOP("DmiParser", "BIOS Shadowing"), &Characteristics::has_bios_shadowing },
+    { QT_TRANSLATE_NOOP("DmiParser", "VL-VESA"), &Characteristics::has_vlb },
+    { QT_TRANSLATE_NOOP("DmiParser", "ESCD"), &Characteristics::has_escd },
+    { QT_TRANSLATE_NOOP("DmiParser", "Boot from CD"), &Characteristics::has_boot_from_cd },
+    { QT_TRANSLATE_NOOP("DmiParser", "Selectable Boot"), &Characteristics::has_selectable_boot },
+    { QT_TRANSLATE_NOOP("DmiParser", "BIOS ROM is Socketed"),
+      &Characteristics::has_socketed_boot_rom },
+    { QT_TRANSLATE_NOOP("DmiParser", "Boot from PC Card (PCMCIA)"),
+      &Characteristics::has_boot_from_pc_card },
+    { QT_TRANSLATE_NOOP("DmiParser", "EDD"), &Characteristics::has_edd },
+    { QT_TRANSLATE_NOOP("DmiParser", "Japanese Floppy for NEC 9800 1.2 MB"),
+      &Characteristics::has_japanese_floppy_for_nec9800 },
+    { QT_TRANSLATE_NOOP("DmiParser", "Japanese Floppy for Toshiba 1.2 MB"),
+      &Characteristics::has_japanece_floppy_for_toshiba },
+    { QT_TRANSLATE_NOOP("DmiParser", "5.25\" / 360 kB Floppy"),
+      &Characteristics::has_525_360kb_floppy },
+    { QT_TRANSLATE_NOOP("DmiParser", "5.25\" / 1.2 MB Floppy"),
+      &Characteristics::has_525_12mb_floppy },
+    { QT_TRANSLATE_NOOP("DmiParser", "3.5\" / 720 kB Floppy"),
+      &Characteristics::has_35_720kb_floppy },
+    { QT_TRANSLATE_NOOP("DmiParser", "3.5\" / 2.88 MB Floppy"),
+      &Characteristics::has_35_288mb_floppy },
+    { QT_TRANSLATE_NOOP("DmiParser", "Print Screen"), &Characteristics::has_print_screen },
+    { QT_TRANSLATE_NOOP("DmiParser", "8042 Keyboard"), &Characteristics::has_8042_keyboard },
+    { QT_TRANSLATE_NOOP("DmiParser", "Serial"), &Characteristics::has_serial },
+    { QT_TRANSLATE_NOOP("DmiParser", "Printer"), &Characteristics::has_printer },
+    { QT_TRANSLATE_NOOP("DmiParser", "CGA/Mono Video"), &Characteristics::has_cga_video },
+    { QT_TRANSLATE_NOOP("DmiParser", "NEC PC-98"), &Characteristics::has_nec_pc98 },
+    { QT_TRANSLATE_NOOP("DmiParser", "ACPI"), &Characteristics::has_acpi },
+    { QT_TRANSLATE_NOOP("DmiParser", "USB Legacy"), &Characteristics::has_usb_legacy },
+    { QT_TRANSLATE_NOOP("DmiParser", "AGP"), &Characteristics::has_agp },
+    { QT_TRANSLATE_NOOP("DmiParser", "I2O Boot"), &Characteristics::has_i2o_boot },
+    { QT_TRANSLATE_NOOP("DmiParser", "LS-120 Boot"), &Characteristics::has_ls120_boot },
+    { QT_TRANSLATE_NOOP("DmiParser", "ATAPI ZIP Drive Boot"),
+      &Characteristics::has_atapi_zip_drive_boot },
+    { QT_TRANSLATE_NOOP("DmiParser", "IEEE 1394 Boot"), &Characteristics::has_ieee1394_boot },
+    { QT_TRANSLATE_NOOP("DmiParser", "Smart Battery"), &Characteristics::has_smart_battery },
+    { QT_TRANSLATE_NOOP("DmiParser", "BIOS Boot Specification"),
+      &Characteristics::has_bios_boot_specification },
+    { QT_TRANSLATE_NOOP("DmiParser", "Function Key-initiated Network Boot"),
+      &Characteristics::has_key_init_network_boot },
+    { QT_TRANSLATE_NOOP("DmiParser", "Targeted Content Distribution"),
+      &Characteristics::has_targeted_content_distrib },
+    { QT_TRANSLATE_NOOP("DmiParser", "UEFI"), &Characteristics::has_uefi },
+    { QT_TRANSLATE_NOOP("DmiParser", "Virtual Machine"), &Characteristics::has_virtual_machine }
+};
+
+QString wakeupTypeToString(system_info::dmi::System::WakeupType value)
+{
+    switch (value)
+    {
+        case system_info::dmi::System::WAKEUP_TYPE_OTHER:
+            return DmiParser::tr("Other");
+        case system_info::dmi::System::WAKEUP_TYPE_APM_TIMER:
+            return DmiParser::tr("APM Timer");
+        case system_info::dmi::System::WAKEUP_TYPE_MODEM_RING:
+            return DmiParser::tr("Modem Ring");
+        case system_info::dmi::System::WAKEUP_TYPE_LAN_REMOTE:
+            return DmiParser::tr("LAN Remote");
+        case system_info::dmi::System::WAKEUP_TYPE_POWER_SWITCH:
+            return DmiParser::tr("Power Switch");
+        case system_info::dmi::System::WAKEUP_TYPE_PCI_PME:
+            return DmiParser::tr("PCI PME#");
+        case system_info::dmi::System::WAKEUP_TYPE_AC_POWER_RESTORED:
+            return DmiParser::tr("AC Power Restored");
+        default:
+            return DmiParser::tr("Unknown");
+    }
+}
+
+void addField(InfoModel::Group* group, const QString& name, const std::string& value)
+{
+    // The strings which are absent in the tables are not shown.
+    if (!value.empty())
+        group->fields.emplace_back(name, QString::fromStdString(value));
+}
+
+// Called in the parse thread. The translations are thread-safe.
+InfoModel::Groups parseDmi(const QByteArray& data)
+{
+    system_info::dmi::Dmi dmi;
+    if (!dmi.ParseFromArray(data.constData(), data.size()))
+    {
+        qWarning("Invalid DMI data");
+        return InfoModel::Groups();
+    }
+
+    InfoModel::Groups groups;
+
+    for (const auto& bios : dmi.bios())
+    {
+        InfoModel::Group group;
+        group.title = DmiParser::tr("BIOS");
+
+        addField(&group, DmiParser::tr("Manufacturer"), bios.manufacturer());
+        addField(&group, DmiParser::tr("Version"), bios.version());
+        addField(&group, DmiParser::tr("Date"), bios.date());
+        group.fields.emplace_back(DmiParser::tr("Size"),
+                                  DmiParser::tr("%1 kB").arg(bios.size() / 1024));
+        addField(&group, DmiParser::tr("BIOS Revision"), bios.bios_revision());
+        addField(&group, DmiParser::tr("Firmware Revision"), bios.firmware_revision());
+        addField(&group, DmiParser::tr("Address"), bios.address());
+
+        if (bios.runtime_size())
+        {
+            group.fields.emplace_back(DmiParser::tr("Runtime Size"),
+                                      DmiParser::tr("%1 bytes").arg(bios.runtime_size()));
+        }
+
+        for (const auto& characteristic : kCharacteristics)
+        {
+            const bool supported = (bios.characteristics().*characteristic.value)();
+
+            group.fields.emplace_back(
+                DmiParser::tr(characteristic.name),
+                supported ? DmiParser::tr("Supported") : DmiParser::tr("Not Supported"));
+        }
+
+        groups.push_back(std::move(group));
+    }
+
+    for (const auto& system : dmi.system())
+    {
+        InfoModel::Group group;
+        group.title = DmiParser::tr("System");
+
+        addField(&group, DmiParser::tr("Manufacturer"), system.manufacturer());
+        addField(&group, DmiParser::tr("Product Name"), system.product_name());
+        addField(&group, DmiParser::tr("Version"), system.version());
+        addField(&group, DmiParser::tr("Serial Number"), system.serial_number());
+        addField(&group, DmiParser::tr("UUID"), system.uuid());
+        group.fields.emplace_back(DmiParser::tr("Wakeup Type"),
+                                  wakeupTypeToString(system.wakeup_type()));
+        addField(&group, DmiParser::tr("SKU Number"), system.sku_number());
+        addField(&group, DmiParser::tr("Family"), system.family());
+
+        groups.push_back(std::move(group));
+    }
+
+    return groups;
+}
+
+} // namespace
+
 DmiParser::DmiParser(QWidget* parent)
-    : Parser(parent)
+    : Parser(parent),
+      model_(new InfoModel(this))
 {
     ui.setupUi(this);
+    ui.tree->setModel(model_);
 }
 
+DmiParser::~DmiParser() = default;
+
 void DmiParser::readReply(const QString& uuid, const QByteArray& data)
 {
+    if (uuid != QLatin1String(CategoryDmi::kUuid))
+        return;
+
+    if (parse_thread_)
+    {
+        pending_data_ = data;
+        return;
+    }
+
+    startParsing(data);
+}
+
+void DmiParser::startParsing(const QByteArray& data)
+{
+    parse_thread_ = std::make_unique<ParseThread>(parseDmi, data, nullptr);
+
+    connect(parse_thread_.get(), &QThread::finished, this, &DmiParser::onParseFinished);
+
+    parse_thread_->start(QThread::LowPriority);
+}
+
+void DmiParser::onParseFinished()
+{
+    model_->setGroups(parse_thread_->takeGroups());
+
+    // The fields of a group are added to the model when it is expanded.
+    const int group_count = model_->rowCount(QModelIndex());
+    if (group_count <= kMaxExpandedGroups)
+    {
+        for (int row = 0; row < group_count; ++row)
+            ui.tree->expand(model_->index(row, 0, QModelIndex()));
+    }
+
+    parse_thread_.reset();
 
+    if (!pending_data_.isEmpty())
+    {
+        startParsing(pending_data_);
+        pending_data_.clear();
+    }
 }
 
 } // namespace aspia
@@ -8,24 +8,40 @@
 #ifndef _ASPIA_SYSTEM_INFO__UI__DMI_PARSER_H
 #define _ASPIA_SYSTEM_INFO__UI__DMI_PARSER_H
 
+#include <memory>
+
 #include "system_info/ui/parser.h"
 #include "ui_dmi_parser.h"
 
 namespace aspia {
 
+class InfoModel;
+class ParseThread;
+
 class DmiParser : public Parser
 {
     Q_OBJECT
 
 public:
     DmiParser(QWidget* parent);
+    ~DmiParser();
 
 public slots:
     // Parser implementation.
     void readReply(const QString& uuid, const QByteArray& data) override;
 
+private slots:
+    void onParseFinished();
+
 private:
+    void startParsing(const QByteArray& data);
+
     Ui::DmiParser ui;
+    InfoModel* model_;
+
+    // The reply which is received during the parsing of the previous one is parsed after it.
+    std::unique_ptr<ParseThread> parse_thread_;
+    QByteArray pending_data_;
 
     Q_DISABLE_COPY(DmiParser)
 };
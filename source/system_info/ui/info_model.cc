@@ -0,0 +1,148 @@
+//
+// PROJECT:         Aspia
+// FILE:            system_info/ui/info_model.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "system_info/ui/info_model.h"
+
+namespace aspia {
+
+namespace {
+
+// The groups added to the view at once while it is scrolled.
+constexpr int kFetchSize = 256;
+
+// The internal id of the groups. The fields keep the row of their group plus one.
+constexpr quintptr kGroupId = 0;
+
+enum Column { COLUMN_FIELD = 0, COLUMN_VALUE = 1, COLUMN_COUNT = 2 };
+
+} // namespace
+
+InfoModel::InfoModel(QObject* parent)
+    : QAbstractItemModel(parent)
+{
+    // Nothing
+}
+
+void InfoModel::setGroups(Groups&& groups)
+{
+    beginResetModel();
+
+    groups_ = std::move(groups);
+    fetched_groups_ = 0;
+    fetched_fields_.assign(groups_.size(), false);
+
+    endResetModel();
+}
+
+QModelIndex InfoModel::index(int row, int column, const QModelIndex& parent) const
+{
+    if (!hasIndex(row, column, parent))
+        return QModelIndex();
+
+    if (!parent.isValid())
+        return createIndex(row, column, kGroupId);
+
+    return createIndex(row, column, static_cast<quintptr>(parent.row()) + 1);
+}
+
+QModelIndex InfoModel::parent(const QModelIndex& child) const
+{
+    if (!child.isValid() || child.internalId() == kGroupId)
+        return QModelIndex();
+
+    return createIndex(static_cast<int>(child.internalId() - 1), 0, kGroupId);
+}
+
+int InfoModel::rowCount(const QModelIndex& parent) const
+{
+    if (!parent.isValid())
+        return fetched_groups_;
+
+    if (parent.internalId() != kGroupId || parent.column() != COLUMN_FIELD)
+        return 0;
+
+    const size_t group = static_cast<size_t>(parent.row());
+    return fetched_fields_[group] ? static_cast<int>(groups_[group].fields.size()) : 0;
+}
+
+int InfoModel::columnCount(const QModelIndex& /* parent */) const
+{
+    return COLUMN_COUNT;
+}
+
+bool InfoModel::hasChildren(const QModelIndex& parent) const
+{
+    if (!parent.isValid())
+        return !groups_.empty();
+
+    if (parent.internalId() != kGroupId || parent.column() != COLUMN_FIELD)
+        return false;
+
+    return !groups_[parent.row()].fields.empty();
+}
+
+QVariant InfoModel::data(const QModelIndex& index, int role) const
+{
+    if (!index.isValid() || role != Qt::DisplayRole)
+        return QVariant();
+
+    if (index.internalId() == kGroupId)
+    {
+        if (index.column() != COLUMN_FIELD)
+            return QVariant();
+
+        return groups_[index.row()].title;
+    }
+
+    const auto& field = groups_[index.internalId() - 1].fields[index.row()];
+    return index.column() == COLUMN_FIELD ? field.first : field.second;
+}
+
+QVariant InfoModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (orientation != Qt::Horizontal || role != Qt::DisplayRole)
+        return QVariant();
+
+    return section == COLUMN_FIELD ? tr("Field") : tr("Value");
+}
+
+bool InfoModel::canFetchMore(const QModelIndex& parent) const
+{
+    if (!parent.isValid())
+        return fetched_groups_ < static_cast<int>(groups_.size());
+
+    if (parent.internalId() != kGroupId || parent.column() != COLUMN_FIELD)
+        return false;
+
+    return !fetched_fields_[parent.row()];
+}
+
+void InfoModel::fetchMore(const QModelIndex& parent)
+{
+    if (!canFetchMore(parent))
+        return;
+
+    if (!parent.isValid())
+    {
+        const int count = qMin(kFetchSize, static_cast<int>(groups_.size()) - fetched_groups_);
+
+        beginInsertRows(QModelIndex(), fetched_groups_, fetched_groups_ + count - 1);
+        fetched_groups_ += count;
+        endInsertRows();
+        return;
+    }
+
+    // The view asks for the fields of the expanded group only once, so all of them are added.
+    const size_t group = static_cast<size_t>(parent.row());
+    const int count = static_cast<int>(groups_[group].fields.size());
+
+    beginInsertRows(parent, 0, count - 1);
+    fetched_fields_[group] = true;
+    endInsertRows();
+}
+
+} // namespace aspia
@@ -0,0 +1,65 @@
+//
+// PROJECT:         Aspia
+// FILE:            system_info/ui/info_model.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_SYSTEM_INFO__UI__INFO_MODEL_H
+#define _ASPIA_SYSTEM_INFO__UI__INFO_MODEL_H
+
+#include <QAbstractItemModel>
+
+#include <utility>
+#include <vector>
+
+namespace aspia {
+
+//
+// The parsed category of the system information: the groups (the tables of the firmware, the
+// devices and so on) with their fields. There are no items for the rows, so the view asks only
+// for the visible ones. The groups are added to the view in portions while it is scrolled and
+// the fields of a group when it is expanded.
+//
+class InfoModel : public QAbstractItemModel
+{
+    Q_OBJECT
+
+public:
+    struct Group
+    {
+        QString title;
+        std::vector<std::pair<QString, QString>> fields;
+    };
+
+    using Groups = std::vector<Group>;
+
+    explicit InfoModel(QObject* parent);
+    ~InfoModel() = default;
+
+    void setGroups(Groups&& groups);
+
+    // QAbstractItemModel implementation.
+    QModelIndex index(int row, int column, const QModelIndex& parent) const override;
+    QModelIndex parent(const QModelIndex& child) const override;
+    int rowCount(const QModelIndex& parent) const override;
+    int columnCount(const QModelIndex& parent) const override;
+    bool hasChildren(const QModelIndex& parent) const override;
+    QVariant data(const QModelIndex& index, int role) const override;
+    QVariant headerData(int section, Qt::Orientation orientation, int role) const override;
+    bool canFetchMore(const QModelIndex& parent) const override;
+    void fetchMore(const QModelIndex& parent) override;
+
+private:
+    Groups groups_;
+
+    // The number of the groups in the view and whether the fields of each group are in it.
+    int fetched_groups_ = 0;
+    std::vector<bool> fetched_fields_;
+
+    Q_DISABLE_COPY(InfoModel)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_SYSTEM_INFO__UI__INFO_MODEL_H
@@ -0,0 +1,38 @@
+//
+// PROJECT:         Aspia
+// FILE:            system_info/ui/parse_thread.cc
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#include "system_info/ui/parse_thread.h"
+
+namespace aspia {
+
+ParseThread::ParseThread(ParseFunction function, const QByteArray& data, QObject* parent)
+    : QThread(parent),
+      function_(std::move(function)),
+      data_(data)
+{
+    // Nothing
+}
+
+ParseThread::~ParseThread()
+{
+    wait();
+}
+
+InfoModel::Groups ParseThread::takeGroups()
+{
+    // The groups are written only by run().
+    wait();
+    return std::move(groups_);
+}
+
+void ParseThread::run()
+{
+    groups_ = function_(data_);
+    data_.clear();
+}
+
+} // namespace aspia
@@ -0,0 +1,50 @@
+//
+// PROJECT:         Aspia
+// FILE:            system_info/ui/parse_thread.h
+// LICENSE:         GNU General Public License 3
+// PROGRAMMERS:     Dmitry Chapyshev (dmitry@aspia.ru)
+//
+
+#ifndef _ASPIA_SYSTEM_INFO__UI__PARSE_THREAD_H
+#define _ASPIA_SYSTEM_INFO__UI__PARSE_THREAD_H
+
+#include <QByteArray>
+#include <QThread>
+
+#include <functional>
+
+#include "system_info/ui/info_model.h"
+
+namespace aspia {
+
+//
+// Parses the data of a category in the background, so the large categories do not block the
+// window. The groups are taken by the parser after finished().
+//
+class ParseThread : public QThread
+{
+public:
+    using ParseFunction = std::function<InfoModel::Groups(const QByteArray& data)>;
+
+    ParseThread(ParseFunction function, const QByteArray& data, QObject* parent);
+
+    // Waits for the parsing if it is not finished.
+    ~ParseThread();
+
+    InfoModel::Groups takeGroups();
+
+protected:
+    // QThread implementation.
+    void run() override;
+
+private:
+    ParseFunction function_;
+    QByteArray data_;
+    InfoModel::Groups groups_;
+
+    Q_DISABLE_COPY(ParseThread)
+};
+
+} // namespace aspia
+
+#endif // _ASPIA_SYSTEM_INFO__UI__PARSE_THREAD_H